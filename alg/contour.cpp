@@ -22,14 +22,24 @@
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
+#include <atomic>
 #include <climits>
+#include <cmath>
+#include <condition_variable>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -218,6 +228,305 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                     GDALContourGenerateByBands()                     */
+/************************************************************************/
+
+namespace
+{
+struct ContourFragment
+{
+    double level = 0;
+    marching_squares::LineString ls{};
+    bool closed = false;
+};
+
+// Line writer collecting the lines generated for a band of the raster
+struct ContourFragmentCollector
+{
+    CPL_DISALLOW_COPY_ASSIGN(ContourFragmentCollector)
+
+    explicit ContourFragmentCollector(std::vector<ContourFragment> &fragments)
+        : fragments_(fragments)
+    {
+    }
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        fragments_.emplace_back();
+        fragments_.back().level = level;
+        fragments_.back().ls.splice(fragments_.back().ls.end(), ls);
+        fragments_.back().closed = closed;
+    }
+
+  private:
+    std::vector<ContourFragment> &fragments_;
+};
+}  // namespace
+
+// Generate contour lines by horizontal bands of the raster processed in
+// parallel, and join the lines that cross the seams between bands.
+static bool GDALContourGenerateByBands(
+    GDALRasterBandH hBand, bool useNoData, double noDataValue,
+    marching_squares::FixedLevelRangeIterator &levels,
+    GDALRingAppender &appender, int nNumThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const int nXSize = GDALGetRasterBandXSize(hBand);
+    const int nYSize = GDALGetRasterBandYSize(hBand);
+    constexpr int MIN_BAND_HEIGHT = 128;
+    const int nBandHeight =
+        std::max(MIN_BAND_HEIGHT, DIV_ROUND_UP(nYSize, nNumThreads * 4));
+    const int nBands = DIV_ROUND_UP(nYSize, nBandHeight);
+
+    std::vector<std::vector<ContourFragment>> aaoBandFragments(nBands);
+
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nBands));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("CONTOUR", "Processing %d bands of %d lines with %d threads",
+             nBands, nBandHeight, poQueue ? nThreads : 1);
+
+    std::mutex oReadMutex;
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nLinesDone = 0;
+    int nJobsDone = 0;
+    std::atomic<int> nNextBand{0};
+    std::atomic<bool> bSuccess{true};
+    std::atomic<bool> bStop{false};
+    CPLErrorAccumulator oErrorAccumulator;
+
+    const auto Job = [&]()
+    {
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            while (!bStop)
+            {
+                const int iBand = nNextBand++;
+                if (iBand >= nBands)
+                    break;
+                const int nYStart = iBand * nBandHeight;
+                const int nYEnd = std::min(nYSize, nYStart + nBandHeight);
+                bool bOK = true;
+                try
+                {
+                    std::vector<double> adfLine(nXSize);
+                    ContourFragmentCollector collector(
+                        aaoBandFragments[iBand]);
+                    // The merger flushes its remaining lines when destroyed
+                    SegmentMerger<ContourFragmentCollector,
+                                  FixedLevelRangeIterator>
+                        writer(collector, levels, /* polygonize */ false);
+                    ContourGenerator<decltype(writer), FixedLevelRangeIterator>
+                        cg(nXSize, nYSize, useNoData, noDataValue, writer,
+                           levels);
+                    for (int iY = std::max(0, nYStart - 1);
+                         bOK && iY < nYEnd && !bStop; ++iY)
+                    {
+                        {
+                            std::lock_guard oLock(oReadMutex);
+                            bOK = GDALRasterIO(hBand, GF_Read, 0, iY, nXSize,
+                                               1, adfLine.data(), nXSize, 1,
+                                               GDT_Float64, 0, 0) == CE_None;
+                        }
+                        if (!bOK)
+                            break;
+                        if (iY < nYStart)
+                        {
+                            cg.setStartLine(nYStart, adfLine.data());
+                        }
+                        else
+                        {
+                            cg.feedLine(adfLine.data());
+                            std::lock_guard oLock(oMutex);
+                            ++nLinesDone;
+                            oCV.notify_one();
+                        }
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+                    bOK = false;
+                }
+                if (!bOK)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        ++nJobsDone;
+        oCV.notify_one();
+    };
+
+    const int nJobs = poQueue ? nThreads : 1;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue || !poQueue->SubmitJob(Job))
+            Job();
+    }
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nJobsDone < nJobs)
+        {
+            oCV.wait(oLock);
+            const double dfProgress = static_cast<double>(nLinesDone) / nYSize;
+            oLock.unlock();
+            if (!bStop && pfnProgress &&
+                !pfnProgress(dfProgress, "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bSuccess = false;
+                bStop = true;
+            }
+            oLock.lock();
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    if (!bSuccess)
+        return false;
+
+    /* -------------------------------------------------------------------- */
+    /*      Index the extremities of the lines that lie on a seam.          */
+    /* -------------------------------------------------------------------- */
+    std::vector<ContourFragment> aoFragments;
+    for (auto &aoBandFragments : aaoBandFragments)
+    {
+        for (auto &oFragment : aoBandFragments)
+            aoFragments.push_back(std::move(oFragment));
+        aoBandFragments.clear();
+    }
+
+    // Seams are at the boundary between the pixel centers of the last line
+    // of a band and the first line of the next one.
+    const auto IsOnSeam = [nBandHeight, nYSize](const Point &p)
+    {
+        const double dfY = p.y + 0.5;
+        return dfY > 0 && dfY < nYSize && dfY == std::floor(dfY) &&
+               (static_cast<int>(dfY) % nBandHeight) == 0;
+    };
+
+    // Extremity of a fragment: 0 for its front, 1 for its back
+    typedef std::pair<size_t, int> Extremity;
+    std::map<std::tuple<double, double, double>, std::vector<Extremity>>
+        oMapSeamPoints;
+    for (size_t i = 0; i < aoFragments.size(); ++i)
+    {
+        const auto &oFragment = aoFragments[i];
+        if (oFragment.closed || oFragment.ls.empty())
+            continue;
+        for (int iEnd = 0; iEnd < 2; ++iEnd)
+        {
+            const Point &p =
+                iEnd == 0 ? oFragment.ls.front() : oFragment.ls.back();
+            if (IsOnSeam(p))
+                oMapSeamPoints[std::make_tuple(oFragment.level, p.x, p.y)]
+                    .emplace_back(i, iEnd);
+        }
+    }
+
+    // Returns the extremity of another fragment connected to the passed one,
+    // or a fragment index equal to aoFragments.size() if there is none.
+    const auto GetConnected = [&aoFragments, &oMapSeamPoints,
+                               &IsOnSeam](const Extremity &oExtremity)
+    {
+        const auto &oFragment = aoFragments[oExtremity.first];
+        const Point &p = oExtremity.second == 0 ? oFragment.ls.front()
+                                                : oFragment.ls.back();
+        if (!oFragment.closed && IsOnSeam(p))
+        {
+            const auto oIter =
+                oMapSeamPoints.find(std::make_tuple(oFragment.level, p.x, p.y));
+            if (oIter != oMapSeamPoints.end())
+            {
+                for (const auto &oOther : oIter->second)
+                {
+                    if (oOther != oExtremity)
+                        return oOther;
+                }
+            }
+        }
+        return Extremity(aoFragments.size(), 0);
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Join the fragments and write the lines.                         */
+    /* -------------------------------------------------------------------- */
+    std::vector<bool> abVisited(aoFragments.size());
+    for (size_t i = 0; i < aoFragments.size(); ++i)
+    {
+        if (abVisited[i] || aoFragments[i].ls.empty())
+            continue;
+        if (aoFragments[i].closed)
+        {
+            appender.addLine(aoFragments[i].level, aoFragments[i].ls,
+                             /* closed */ true);
+            continue;
+        }
+
+        // Go backwards up to the start of the line, or back to this
+        // fragment for a ring.
+        Extremity oStart(i, 0);
+        for (size_t nIter = 0; nIter < aoFragments.size(); ++nIter)
+        {
+            const Extremity oPrev = GetConnected(oStart);
+            if (oPrev.first == aoFragments.size() || abVisited[oPrev.first])
+                break;
+            if (oPrev.first == i)
+            {
+                oStart = Extremity(i, 0);
+                break;
+            }
+            oStart = Extremity(oPrev.first, 1 - oPrev.second);
+        }
+
+        LineString ls;
+        Extremity oCur = oStart;
+        while (true)
+        {
+            abVisited[oCur.first] = true;
+            const Extremity oNext =
+                GetConnected(Extremity(oCur.first, 1 - oCur.second));
+            auto &fragmentLS = aoFragments[oCur.first].ls;
+            if (oCur.second == 0)
+            {
+                if (!ls.empty())
+                    fragmentLS.pop_front();
+                ls.splice(ls.end(), fragmentLS);
+            }
+            else
+            {
+                auto oIter = fragmentLS.rbegin();
+                if (!ls.empty())
+                    ++oIter;
+                for (; oIter != fragmentLS.rend(); ++oIter)
+                    ls.push_back(*oIter);
+                fragmentLS.clear();
+            }
+            if (oNext.first == aoFragments.size() || abVisited[oNext.first])
+                break;
+            oCur = oNext;
+        }
+        appender.addLine(aoFragments[i].level, ls, /* closed */ false);
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -563,6 +872,14 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=number_of_threads|ALL_CPUS
+ *
+ * (GDAL >= 3.12) Number of threads used to generate contour lines, by
+ * horizontal bands of the raster whose lines are joined at the seams between
+ * bands. Features are written from the calling thread once all bands are
+ * processed, possibly in a different order than with a single thread. Only
+ * used in line contouring mode. Defaults to 1.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -680,6 +997,12 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(options, "NUM_THREADS", "1");
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszNumThreads);
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -895,12 +1218,21 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 fixedLevels.erase(uniqueIt, fixedLevels.end());
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nNumThreads > 1)
+                {
+                    ok = GDALContourGenerateByBands(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        nNumThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
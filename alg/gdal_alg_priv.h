@@ -20,7 +20,11 @@
 
 #include <cstdint>
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include "gdal_alg.h"
 #include "ogr_spatialref.h"
@@ -139,6 +143,14 @@ template <class DataType, class EqualityTest> class GDALRasterPolygonEnumeratorT
     void CompleteMerges();
 
     void Clear();
+
+    static int GetStripHeight(int nYSize, int nNumThreads);
+
+    bool EnumerateByStrips(
+        int nXSize, int nYSize, int nStripHeight, int nNumThreads,
+        const std::function<bool(int iY, DataType *panLineVal)> &pfnReadLine,
+        std::vector<int> *panPolySizes, GDALProgressFunc pfnProgress,
+        void *pProgressArg);
 };
 
 struct IntEqualityTest
@@ -203,6 +215,12 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to generate the backmap.
+    int nBackMapThreads;
+
+    // File in which the backmap is cached, or nullptr.
+    char *pszBackMapFilename;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
@@ -291,6 +309,16 @@ struct GDALApproxTransformInfo
 
     int bOwnSubtransformer = 0;
 
+    // Whether results are looked up in / stored to the process-wide cache
+    // controlled by GDAL_APPROX_TRANSFORMER_CACHE_SIZE.
+    bool bUseCache = false;
+    // Lazily computed, since the base transformer may still be modified
+    // after the approximate transformer is created.
+    bool bCacheKeyComputed = false;
+    // Identifier of the serialized base transformer, or -1 if not cacheable.
+    int nCacheKeyId = -1;
+    std::mutex oCacheKeyMutex{};
+
     GDALApproxTransformInfo() : sTI()
     {
         memset(&sTI, 0, sizeof(sTI));
@@ -410,6 +438,57 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                                     int bReversed, const char *pszSourceDataset,
                                     CSLConstList papszTransformOptions);
 
+int CPL_DLL GDALChecksumChunk(const void *pData, GDALDataType eDataType,
+                              int nXOff, int nYOff, int nXSize, int nYSize,
+                              GSpacing nLineSpace, int nBandXSize);
+
+/************************************************************************/
+/*                       GDALCutlineSegmentIndex                        */
+/************************************************************************/
+
+/** Edges of a cutline in source pixel coordinates, bucketed by strips of
+ * source rows, so that the cutline mask of a warp chunk can be rasterized
+ * without visiting the edges that do not cross its rows. The result is the
+ * same as GDALRasterizeGeometries() without ALL_TOUCHED.
+ */
+class GDALCutlineSegmentIndex
+{
+    struct Segment
+    {
+        double dfX1;
+        double dfY1;
+        double dfX2;
+        double dfY2;
+        int nPolygon;
+    };
+
+    int m_nRasterYSize = 0;
+    OGREnvelope m_sEnvelope{};
+    std::vector<Segment> m_asSegments{};
+    std::vector<std::vector<int>> m_aanStrips{};
+
+    GDALCutlineSegmentIndex() = default;
+
+  public:
+    static std::unique_ptr<GDALCutlineSegmentIndex>
+    Create(OGRGeometryH hCutline, int nRasterYSize);
+
+    /** Envelope of the cutline */
+    const OGREnvelope &GetEnvelope() const
+    {
+        return m_sEnvelope;
+    }
+
+    void Rasterize(int nXOff, int nYOff, int nXSize, int nYSize,
+                   GByte *pabyMask) const;
+};
+
+CPLErr GDALWarpCutlineMaskerWithIndex(void *pMaskFuncArg,
+                                      const GDALCutlineSegmentIndex *poIndex,
+                                      int nXOff, int nYOff, int nXSize,
+                                      int nYSize, float *pafMask,
+                                      int *pnValidityFlag);
+
 #endif /* #ifndef DOXYGEN_SKIP */
 
 #endif /* ndef GDAL_ALG_PRIV_H_INCLUDED */
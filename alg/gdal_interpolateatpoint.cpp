@@ -20,7 +20,12 @@
 #include "gdal_vectorx.h"
 
 #include <algorithm>
+#include <cmath>
 #include <complex>
+#include <limits>
+
+// Dimension of the square windows read from the band and kept in the cache
+constexpr int INTERP_CACHE_BLOCK_SIZE = 64;
 
 template <typename T> bool areEqualReal(double dfNoDataValue, T dfOut);
 
@@ -38,10 +43,11 @@ template <> bool areEqualReal(double dfNoDataValue, std::complex<double> dfOut)
 template <typename T>
 bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
                                    std::unique_ptr<DoublePointsCache> &cache,
+                                   SharedDoublePointsCache *poSharedCache,
                                    gdal::Vector2i point,
                                    gdal::Vector2i dimensions, T *padfOut)
 {
-    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_SIZE = INTERP_CACHE_BLOCK_SIZE;
 
     const int nX = point.x();
     const int nY = point.y();
@@ -102,7 +108,12 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
 
             constexpr int nTypeFactor = sizeof(T) / sizeof(double);
             std::shared_ptr<std::vector<double>> poValue;
-            if (!cache->tryGet(nKey, poValue))
+            if (!cache->tryGet(nKey, poValue) && poSharedCache &&
+                poSharedCache->tryGet(nKey, poValue))
+            {
+                cache->insert(nKey, poValue);
+            }
+            else if (!poValue)
             {
                 const GDALDataType eDataType =
                     bIsComplex ? GDT_CFloat64 : GDT_Float64;
@@ -118,6 +129,8 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
                     return false;
                 }
                 cache->insert(nKey, poValue);
+                if (poSharedCache)
+                    poSharedCache->insert(nKey, poValue);
             }
 
             double *padfAsDouble = reinterpret_cast<double *>(padfOut);
@@ -165,6 +178,7 @@ template <typename T>
 bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
                                 GDALRIOResampleAlg eResampleAlg,
                                 std::unique_ptr<DoublePointsCache> &cache,
+                                SharedDoublePointsCache *poSharedCache,
                                 double dfXIn, double dfYIn, T &out)
 {
     const gdal::Vector2i rasterSize{pBand->GetXSize(), pBand->GetYSize()};
@@ -355,9 +369,9 @@ bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
 
         // CubicSpline interpolation.
         T adfReadData[16] = {0.0};
-        if (!GDALInterpExtractValuesWindow(pBand, cache, dNew - dOutOfBorder,
-                                           {nKernelSize, nKernelSize},
-                                           adfReadData))
+        if (!GDALInterpExtractValuesWindow(
+                pBand, cache, poSharedCache, dNew - dOutOfBorder,
+                {nKernelSize, nKernelSize}, adfReadData))
         {
             return FALSE;
         }
@@ -380,9 +394,9 @@ bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
 
         // Bilinear interpolation.
         T adfReadData[4] = {0.0};
-        if (!GDALInterpExtractValuesWindow(pBand, cache, d - dOutOfBorder,
-                                           {nKernelSize, nKernelSize},
-                                           adfReadData))
+        if (!GDALInterpExtractValuesWindow(
+                pBand, cache, poSharedCache, d - dOutOfBorder,
+                {nKernelSize, nKernelSize}, adfReadData))
         {
             return FALSE;
         }
@@ -396,7 +410,8 @@ bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
     {
         const gdal::Vector2i d = inLoc.cast<int>();
         T adfOut[1] = {};
-        if (!GDALInterpExtractValuesWindow(pBand, cache, d, {1, 1}, adfOut) ||
+        if (!GDALInterpExtractValuesWindow(pBand, cache, poSharedCache, d,
+                                           {1, 1}, adfOut) ||
             (bGotNoDataValue && areEqualReal(dfNoDataValue, adfOut[0])))
         {
             return FALSE;
@@ -416,7 +431,8 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
                             GDALRIOResampleAlg eResampleAlg,
                             std::unique_ptr<DoublePointsCache> &cache,
                             const double dfXIn, const double dfYIn,
-                            double *pdfOutputReal, double *pdfOutputImag)
+                            double *pdfOutputReal, double *pdfOutputImag,
+                            SharedDoublePointsCache *poSharedCache)
 {
     const bool bIsComplex =
         CPL_TO_BOOL(GDALDataTypeIsComplex(pBand->GetRasterDataType()));
@@ -424,8 +440,8 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
     if (bIsComplex)
     {
         std::complex<double> out{};
-        res = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache, dfXIn,
-                                         dfYIn, out);
+        res = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache,
+                                         poSharedCache, dfXIn, dfYIn, out);
         *pdfOutputReal = out.real();
         if (pdfOutputImag)
             *pdfOutputImag = out.imag();
@@ -433,11 +449,107 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
     else
     {
         double out{};
-        res = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache, dfXIn,
-                                         dfYIn, out);
+        res = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache,
+                                         poSharedCache, dfXIn, dfYIn, out);
         *pdfOutputReal = out;
         if (pdfOutputImag)
             *pdfOutputImag = 0;
     }
     return res;
 }
+
+/************************************************************************/
+/*                 GDALInterpolateAtPointsSortByBlock()                 */
+/************************************************************************/
+
+/** Return the indices of the points sorted by the cache window that contains
+ * them, so that consecutive points processed in that order hit the same
+ * windows of the cache. Points with invalid coordinates are put at the end.
+ */
+std::vector<size_t> GDALInterpolateAtPointsSortByBlock(size_t nPointCount,
+                                                       const double *padfX,
+                                                       const double *padfY)
+{
+    std::vector<uint64_t> anKeys(nPointCount);
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        const double dfX = padfX[i];
+        const double dfY = padfY[i];
+        if (dfX >= 0 && dfY >= 0 && dfX < std::numeric_limits<int>::max() &&
+            dfY < std::numeric_limits<int>::max())
+        {
+            const uint64_t nBlockX =
+                static_cast<int>(dfX) / INTERP_CACHE_BLOCK_SIZE;
+            const uint64_t nBlockY =
+                static_cast<int>(dfY) / INTERP_CACHE_BLOCK_SIZE;
+            anKeys[i] = (nBlockY << 32) | nBlockX;
+        }
+        else
+        {
+            anKeys[i] = std::numeric_limits<uint64_t>::max();
+        }
+    }
+
+    std::vector<size_t> anIndices(nPointCount);
+    for (size_t i = 0; i < nPointCount; ++i)
+        anIndices[i] = i;
+    std::stable_sort(anIndices.begin(), anIndices.end(),
+                     [&anKeys](size_t a, size_t b)
+                     { return anKeys[a] < anKeys[b]; });
+    return anIndices;
+}
+
+/************************************************************************/
+/*                      GDALInterpolateAtPoints()                       */
+/************************************************************************/
+
+/** Interpolate the points whose indices are given by panIndices, in that
+ * order, and write the results at the same indices in the output arrays.
+ * The real (and imaginary) value of a point that cannot be interpolated is
+ * set to NaN.
+ *
+ * @return the number of points successfully interpolated.
+ */
+size_t GDALInterpolateAtPoints(GDALRasterBand *pBand,
+                               GDALRIOResampleAlg eResampleAlg,
+                               std::unique_ptr<DoublePointsCache> &cache,
+                               const size_t *panIndices, size_t nIndexCount,
+                               const double *padfX, const double *padfY,
+                               double *padfOutputReal, double *padfOutputImag,
+                               int *pabSuccess)
+{
+    const bool bIsComplex =
+        CPL_TO_BOOL(GDALDataTypeIsComplex(pBand->GetRasterDataType()));
+    constexpr double dfNaN = std::numeric_limits<double>::quiet_NaN();
+    size_t nSuccessCount = 0;
+    for (size_t i = 0; i < nIndexCount; ++i)
+    {
+        const size_t iPoint = panIndices[i];
+        double dfReal = 0;
+        double dfImag = 0;
+        bool bRet;
+        if (bIsComplex)
+        {
+            std::complex<double> out{};
+            bRet = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache,
+                                              nullptr, padfX[iPoint],
+                                              padfY[iPoint], out);
+            dfReal = out.real();
+            dfImag = out.imag();
+        }
+        else
+        {
+            bRet = GDALInterpolateAtPointImpl(pBand, eResampleAlg, cache,
+                                              nullptr, padfX[iPoint],
+                                              padfY[iPoint], dfReal);
+        }
+        if (bRet)
+            ++nSuccessCount;
+        padfOutputReal[iPoint] = bRet ? dfReal : dfNaN;
+        if (padfOutputImag)
+            padfOutputImag[iPoint] = bRet ? dfImag : dfNaN;
+        if (pabSuccess)
+            pabSuccess[iPoint] = bRet;
+    }
+    return nSuccessCount;
+}
@@ -24,10 +24,17 @@
 #include "gdal_priv.h"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 using DoublePointsCache =
     lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>>;
 
+// Thread-safe cache of blocks, that can be shared by several users of
+// distinct datasets opened on the same file, in addition to their own cache.
+using SharedDoublePointsCache =
+    lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>, std::mutex>;
+
 class CPL_DLL GDALDoublePointsCache
 {
   public:
@@ -39,7 +46,18 @@ bool CPL_DLL GDALInterpolateAtPoint(GDALRasterBand *pBand,
                                     std::unique_ptr<DoublePointsCache> &cache,
                                     const double dfXIn, const double dfYIn,
                                     double *pdfOutputReal,
-                                    double *pdfOutputImag);
+                                    double *pdfOutputImag,
+                                    SharedDoublePointsCache *poSharedCache =
+                                        nullptr);
+
+std::vector<size_t> CPL_DLL GDALInterpolateAtPointsSortByBlock(
+    size_t nPointCount, const double *padfX, const double *padfY);
+
+size_t CPL_DLL GDALInterpolateAtPoints(
+    GDALRasterBand *pBand, GDALRIOResampleAlg eResampleAlg,
+    std::unique_ptr<DoublePointsCache> &cache, const size_t *panIndices,
+    size_t nIndexCount, const double *padfX, const double *padfY,
+    double *padfOutputReal, double *padfOutputImag, int *pabSuccess);
 
 /*! @endcond */
 
@@ -261,6 +261,9 @@ typedef struct
     GDALDataset *poDS;
     // the key is (nYBlock << 32) | nXBlock)
     lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>> *poCacheDEM;
+    // DEM blocks shared with the transformers cloned from this one, for
+    // example by the threads of the warping kernel.
+    std::shared_ptr<SharedDoublePointsCache> *poSharedCacheDEM;
 
     OGRCoordinateTransformation *poCT;
 
@@ -535,6 +538,14 @@ static void *GDALCreateSimilarRPCTransformer(void *hTransformArg,
             &sRPC, psInfo->bReversed, psInfo->dfPixErrThreshold, papszOptions));
     CSLDestroy(papszOptions);
 
+    // Share the DEM blocks read by the clones, which query the same DEM.
+    // psInfo->poSharedCacheDEM is not modified after the creation of psInfo,
+    // so this is safe even if clones are created concurrently.
+    if (psNewInfo && psNewInfo->poSharedCacheDEM && psInfo->poSharedCacheDEM)
+    {
+        *(psNewInfo->poSharedCacheDEM) = *(psInfo->poSharedCacheDEM);
+    }
+
     return psNewInfo;
 }
 
@@ -984,10 +995,18 @@ void *GDALCreateRPCTransformerV2(const GDALRPCInfoV2 *psRPCInfo, int bReversed,
     /*      Open DEM if needed.                                             */
     /* -------------------------------------------------------------------- */
 
-    if (psTransform->pszDEMPath != nullptr && !GDALRPCOpenDEM(psTransform))
+    if (psTransform->pszDEMPath != nullptr)
     {
-        GDALDestroyRPCTransformer(psTransform);
-        return nullptr;
+        if (!GDALRPCOpenDEM(psTransform))
+        {
+            GDALDestroyRPCTransformer(psTransform);
+            return nullptr;
+        }
+        constexpr int SHARED_CACHE_DEM_BLOCKS = 256;
+        psTransform->poSharedCacheDEM =
+            new std::shared_ptr<SharedDoublePointsCache>(
+                std::make_shared<SharedDoublePointsCache>(
+                    SHARED_CACHE_DEM_BLOCKS));
     }
 
     /* -------------------------------------------------------------------- */
@@ -1109,6 +1128,7 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
     if (psTransform->poDS)
         GDALClose(psTransform->poDS);
     delete psTransform->poCacheDEM;
+    delete psTransform->poSharedCacheDEM;
     if (psTransform->poCT)
         OCTDestroyCoordinateTransformation(
             reinterpret_cast<OGRCoordinateTransformationH>(psTransform->poCT));
@@ -1394,9 +1414,11 @@ static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
     }
 
     std::unique_ptr<DoublePointsCache> cacheDEM{psTransform->poCacheDEM};
-    int res =
-        GDALInterpolateAtPoint(psTransform->poDS->GetRasterBand(1), eResample,
-                               cacheDEM, dfXIn, dfYIn, pdfDEMH, nullptr);
+    int res = GDALInterpolateAtPoint(
+        psTransform->poDS->GetRasterBand(1), eResample, cacheDEM, dfXIn, dfYIn,
+        pdfDEMH, nullptr,
+        psTransform->poSharedCacheDEM ? psTransform->poSharedCacheDEM->get()
+                                      : nullptr);
     psTransform->poCacheDEM = cacheDEM.release();
     return res;
 }
@@ -17,12 +17,45 @@
 #include <cmath>
 #include <cstddef>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_alg_priv.h"
+
+constexpr int LARGEST_MODULO = 43;
+static const int anPrimes[11] = {7,  11, 13, 17, 19,           23,
+                                 29, 31, 37, 41, LARGEST_MODULO};
+
+/************************************************************************/
+/*                           IntFromDouble()                            */
+/************************************************************************/
+
+static int IntFromDouble(double dfVal)
+{
+    int nVal;
+    if (!std::isfinite(dfVal))
+    {
+        nVal = INT_MIN;
+    }
+    else
+    {
+        // Standard behavior of GDALCopyWords when converting
+        // from floating point to Int32.
+        dfVal += 0.5;
+
+        if (dfVal < -2147483647.0)
+            nVal = -2147483647;
+        else if (dfVal > 2147483647)
+            nVal = 2147483647;
+        else
+            nVal = static_cast<GInt32>(floor(dfVal));
+    }
+    return nVal;
+}
 
 /************************************************************************/
 /*                         GDALChecksumImage()                          */
@@ -51,10 +84,6 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
 {
     VALIDATE_POINTER1(hBand, "GDALChecksumImage", 0);
 
-    constexpr int LARGEST_MODULO = 43;
-    const static int anPrimes[11] = {
-        7, 11, 13, 17, 19, 23, 29, 31, 37, 41, LARGEST_MODULO};
-
     int nChecksum = 0;
     int iPrime = 0;
     const GDALDataType eDataType = GDALGetRasterDataType(hBand);
@@ -64,29 +93,6 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
          eDataType == GDT_Float64 || eDataType == GDT_CFloat16 ||
          eDataType == GDT_CFloat32 || eDataType == GDT_CFloat64);
 
-    const auto IntFromDouble = [](double dfVal)
-    {
-        int nVal;
-        if (!std::isfinite(dfVal))
-        {
-            nVal = INT_MIN;
-        }
-        else
-        {
-            // Standard behavior of GDALCopyWords when converting
-            // from floating point to Int32.
-            dfVal += 0.5;
-
-            if (dfVal < -2147483647.0)
-                nVal = -2147483647;
-            else if (dfVal > 2147483647)
-                nVal = 2147483647;
-            else
-                nVal = static_cast<GInt32>(floor(dfVal));
-        }
-        return nVal;
-    };
-
     const auto ClampForCoverity = [](int x)
     {
 #ifdef __COVERITY__
@@ -373,3 +379,91 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
     // coverity[return_overflow]
     return nChecksum;
 }
+
+/************************************************************************/
+/*                         GDALChecksumChunk()                          */
+/************************************************************************/
+
+/**
+ * Compute the contribution of a chunk of a band to its checksum.
+ *
+ * The checksum returned by GDALChecksumImage() for a whole band is the sum,
+ * modulo 65536, of the values returned by this function for a set of chunks
+ * covering the band, which can thus be computed independently.
+ *
+ * @param pData values of the chunk, of the band data type.
+ * @param eDataType band data type.
+ * @param nXOff column of the chunk in the band.
+ * @param nYOff line of the chunk in the band.
+ * @param nXSize chunk width.
+ * @param nYSize chunk height.
+ * @param nLineSpace number of bytes between the start of two lines of pData.
+ * @param nBandXSize width of the band.
+ *
+ * @return Checksum contribution, between 0 and 65535, or -1 in case of error.
+ */
+
+int GDALChecksumChunk(const void *pData, GDALDataType eDataType, int nXOff,
+                      int nYOff, int nXSize, int nYSize, GSpacing nLineSpace,
+                      int nBandXSize)
+{
+    const bool bComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eDataType));
+    const bool bIsFloatingPoint =
+        CPL_TO_BOOL(GDALDataTypeIsFloating(eDataType));
+    const int nValsPerIter = bComplex ? 2 : 1;
+    const size_t nCount = static_cast<size_t>(nValsPerIter) * nXSize;
+    const GDALDataType eDstDataType =
+        bIsFloatingPoint ? (bComplex ? GDT_CFloat64 : GDT_Float64)
+                         : (bComplex ? GDT_CInt32 : GDT_Int32);
+    const int nSrcDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nDstDTSize = GDALGetDataTypeSizeBytes(eDstDataType);
+
+    std::vector<GByte> abyLine;
+    try
+    {
+        abyLine.resize(static_cast<size_t>(nXSize) * nDstDTSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALChecksumChunk()");
+        return -1;
+    }
+
+    int nChecksum = 0;
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        GDALCopyWords64(static_cast<const GByte *>(pData) + iY * nLineSpace,
+                        eDataType, nSrcDTSize, abyLine.data(), eDstDataType,
+                        nDstDTSize, nXSize);
+        // Initialize iPrime so that it is consistent with a per full line
+        // iteration strategy
+        int iPrime = static_cast<int>(
+            (nValsPerIter *
+             (static_cast<int64_t>(nYOff + iY) * nBandXSize + nXOff)) %
+            11);
+        if (bIsFloatingPoint)
+        {
+            const double *padfLine =
+                reinterpret_cast<const double *>(abyLine.data());
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                nChecksum += IntFromDouble(padfLine[i]) % anPrimes[iPrime++];
+                if (iPrime > 10)
+                    iPrime = 0;
+            }
+        }
+        else
+        {
+            const int *panLine = reinterpret_cast<const int *>(abyLine.data());
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                nChecksum += panLine[i] % anPrimes[iPrime++];
+                if (iPrime > 10)
+                    iPrime = 0;
+            }
+        }
+        nChecksum &= 0xffff;
+    }
+    return nChecksum;
+}
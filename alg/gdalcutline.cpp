@@ -18,12 +18,15 @@
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "memdataset.h"
 #include "ogr_api.h"
@@ -214,6 +217,244 @@ static int CutlineTransformer(void *pTransformArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                          RasterizeCutline()                          */
+/************************************************************************/
+
+// Burns 255 in the pixels of pabyPolyMask that are inside the cutline.
+static CPLErr RasterizeCutline(const GDALWarpOptions *psWO,
+                               OGRGeometryH hPolygon, int nXOff, int nYOff,
+                               int nXSize, int nYSize, GByte *pabyPolyMask)
+{
+    auto poMEMDS =
+        MEMDataset::Create("warp_temp", nXSize, nYSize, 0, GDT_Byte, nullptr);
+    GDALRasterBandH hMEMBand =
+        MEMCreateRasterBandEx(poMEMDS, 1, pabyPolyMask, GDT_Byte, 0, 0, false);
+    poMEMDS->AddMEMBand(hMEMBand);
+
+    GDALDatasetH hMemDS = GDALDataset::ToHandle(poMEMDS);
+    double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    GDALSetGeoTransform(hMemDS, adfGeoTransform);
+
+    /* -------------------------------------------------------------------- */
+    /*      Burn the polygon into the mask with 1.0 values.                 */
+    /* -------------------------------------------------------------------- */
+    int nTargetBand = 1;
+    double dfBurnValue = 255.0;
+    char **papszRasterizeOptions = nullptr;
+
+    if (CPLFetchBool(psWO->papszWarpOptions, "CUTLINE_ALL_TOUCHED", false))
+        papszRasterizeOptions =
+            CSLSetNameValue(papszRasterizeOptions, "ALL_TOUCHED", "TRUE");
+
+    int anXYOff[2] = {nXOff, nYOff};
+
+    const CPLErr eErr = GDALRasterizeGeometries(
+        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
+        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+
+    CSLDestroy(papszRasterizeOptions);
+
+    // Close and ensure data flushed to underlying array.
+    GDALClose(hMemDS);
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                   GDALCutlineSegmentIndex::Create()                  */
+/************************************************************************/
+
+// Number of source rows per strip of the index
+constexpr int CUTLINE_INDEX_STRIP_HEIGHT = 32;
+
+/** Builds the index of the edges of a polygon or multipolygon cutline, in
+ * source pixel coordinates, for source rows [0, nRasterYSize[.
+ *
+ * Returns nullptr if the cutline has non-finite coordinates.
+ */
+std::unique_ptr<GDALCutlineSegmentIndex>
+GDALCutlineSegmentIndex::Create(OGRGeometryH hCutline, int nRasterYSize)
+{
+    const OGRGeometry *poCutline = OGRGeometry::FromHandle(hCutline);
+    const auto eType = wkbFlatten(poCutline->getGeometryType());
+    if (eType != wkbPolygon && eType != wkbMultiPolygon)
+        return nullptr;
+
+    std::unique_ptr<GDALCutlineSegmentIndex> poIndex(
+        new GDALCutlineSegmentIndex());
+    poIndex->m_nRasterYSize = nRasterYSize;
+    poCutline->getEnvelope(&poIndex->m_sEnvelope);
+
+    std::vector<const OGRPolygon *> apoPolygons;
+    if (eType == wkbPolygon)
+        apoPolygons.push_back(poCutline->toPolygon());
+    else
+    {
+        for (const auto *poPolygon : *(poCutline->toMultiPolygon()))
+            apoPolygons.push_back(poPolygon);
+    }
+
+    // Collect the edges the same way as GDALRasterizeGeometries(): each
+    // polygon of a multipolygon is filled separately, and rings are walked
+    // clockwise, starting with the edge from their last point to their
+    // first one.
+    auto &asSegments = poIndex->m_asSegments;
+    for (int iPolygon = 0; iPolygon < static_cast<int>(apoPolygons.size());
+         ++iPolygon)
+    {
+        for (const auto *poRing : *(apoPolygons[iPolygon]))
+        {
+            const int nCount = poRing->getNumPoints();
+            if (nCount == 0)
+                continue;
+            const bool bClockwise = CPL_TO_BOOL(poRing->isClockwise());
+            const auto GetPoint = [poRing, nCount, bClockwise](int i)
+            {
+                const int j = bClockwise ? i : nCount - 1 - i;
+                return std::make_pair(poRing->getX(j), poRing->getY(j));
+            };
+            for (int i = 0; i < nCount; ++i)
+            {
+                const auto oP1 = GetPoint(i == 0 ? nCount - 1 : i - 1);
+                const auto oP2 = GetPoint(i);
+                if (!std::isfinite(oP1.first) || !std::isfinite(oP1.second) ||
+                    !std::isfinite(oP2.first) || !std::isfinite(oP2.second))
+                {
+                    return nullptr;
+                }
+                asSegments.push_back(Segment{oP1.first, oP1.second,
+                                             oP2.first, oP2.second, iPolygon});
+            }
+        }
+    }
+
+    const int nStrips =
+        nRasterYSize / CUTLINE_INDEX_STRIP_HEIGHT +
+        ((nRasterYSize % CUTLINE_INDEX_STRIP_HEIGHT) != 0 ? 1 : 0);
+    poIndex->m_aanStrips.resize(nStrips);
+    for (int i = 0; i < static_cast<int>(asSegments.size()); ++i)
+    {
+        const auto &sSeg = asSegments[i];
+        const double dfYMin = std::min(sSeg.dfY1, sSeg.dfY2);
+        const double dfYMax = std::max(sSeg.dfY1, sSeg.dfY2);
+        if (dfYMax < 0 || dfYMin > nRasterYSize)
+            continue;
+        const int iStripMin = static_cast<int>(std::max(
+            0.0, std::floor(dfYMin / CUTLINE_INDEX_STRIP_HEIGHT)));
+        const int iStripMax = static_cast<int>(
+            std::min(static_cast<double>(nStrips - 1),
+                     std::floor(dfYMax / CUTLINE_INDEX_STRIP_HEIGHT)));
+        for (int iStrip = iStripMin; iStrip <= iStripMax; ++iStrip)
+            poIndex->m_aanStrips[iStrip].push_back(i);
+    }
+
+    return poIndex;
+}
+
+/************************************************************************/
+/*                 GDALCutlineSegmentIndex::Rasterize()                 */
+/************************************************************************/
+
+/** Burns 255 in the pixels of pabyMask (of size nXSize * nYSize), whose
+ * center is inside the cutline, for the chunk at (nXOff, nYOff).
+ *
+ * This is the scanline algorithm of GDALdllImageFilledPolygon(), with the
+ * same arithmetic, restricted to the edges of the strips of the chunk rows.
+ */
+void GDALCutlineSegmentIndex::Rasterize(int nXOff, int nYOff, int nXSize,
+                                        int nYSize, GByte *pabyMask) const
+{
+    std::vector<int> anInts;
+
+    const auto BurnSpan =
+        [pabyMask, nXSize](int iY, int nXStart, int nXEnd)
+    {
+        nXStart = std::max(nXStart, 0);
+        nXEnd = std::min(nXEnd, nXSize - 1);
+        if (nXStart <= nXEnd)
+        {
+            memset(pabyMask + static_cast<size_t>(iY) * nXSize + nXStart, 255,
+                   nXEnd - nXStart + 1);
+        }
+    };
+
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        const int iRow = nYOff + iY;
+        if (iRow < 0 || iRow >= m_nRasterYSize)
+            continue;
+        const auto &anStrip = m_aanStrips[iRow / CUTLINE_INDEX_STRIP_HEIGHT];
+
+        const double dy = iY + 0.5;  // Center height of line.
+
+        size_t i = 0;
+        while (i < anStrip.size())
+        {
+            // Edges are sorted by polygon, and each polygon is filled with
+            // the even-odd rule.
+            const int nPolygon = m_asSegments[anStrip[i]].nPolygon;
+            anInts.clear();
+            for (; i < anStrip.size() &&
+                   m_asSegments[anStrip[i]].nPolygon == nPolygon;
+                 ++i)
+            {
+                const Segment &sSeg = m_asSegments[anStrip[i]];
+                double dy1 = sSeg.dfY1 - nYOff;
+                double dy2 = sSeg.dfY2 - nYOff;
+
+                if ((dy1 < dy && dy2 < dy) || (dy1 > dy && dy2 > dy))
+                    continue;
+
+                double dx1 = 0.0;
+                double dx2 = 0.0;
+                if (dy1 < dy2)
+                {
+                    dx1 = sSeg.dfX1 - nXOff;
+                    dx2 = sSeg.dfX2 - nXOff;
+                }
+                else if (dy1 > dy2)
+                {
+                    std::swap(dy1, dy2);
+                    dx2 = sSeg.dfX1 - nXOff;
+                    dx1 = sSeg.dfX2 - nXOff;
+                }
+                else
+                {
+                    // Bottom horizontal segments are filled separately, and
+                    // top ones are skipped.
+                    const double dfX1 = sSeg.dfX1 - nXOff;
+                    const double dfX2 = sSeg.dfX2 - nXOff;
+                    if (dfX1 > dfX2)
+                    {
+                        const int horizontal_x1 =
+                            static_cast<int>(floor(dfX2 + 0.5));
+                        const int horizontal_x2 =
+                            static_cast<int>(floor(dfX1 + 0.5));
+                        if (horizontal_x1 < nXSize && horizontal_x2 > 0)
+                            BurnSpan(iY, horizontal_x1, horizontal_x2 - 1);
+                    }
+                    continue;
+                }
+
+                if (dy < dy2 && dy >= dy1)
+                {
+                    const double intersect =
+                        (dy - dy1) * (dx2 - dx1) / (dy2 - dy1) + dx1;
+                    anInts.push_back(static_cast<int>(floor(intersect + 0.5)));
+                }
+            }
+
+            std::sort(anInts.begin(), anInts.end());
+            for (size_t j = 0; j + 1 < anInts.size(); j += 2)
+            {
+                if (anInts[j] < nXSize && anInts[j + 1] > 0)
+                    BurnSpan(iY, anInts[j], anInts[j + 1] - 1);
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                       GDALWarpCutlineMasker()                        */
 /*                                                                      */
@@ -239,21 +480,44 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
                                void *pValidityMask, int *pnValidityFlag)
 
 {
-    if (pnValidityFlag)
-        *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
-
-    if (nXSize < 1 || nYSize < 1)
-        return CE_None;
-
-    /* -------------------------------------------------------------------- */
-    /*      Do some minimal checking.                                       */
-    /* -------------------------------------------------------------------- */
     if (!bMaskIsFloat)
     {
+        if (pnValidityFlag)
+            *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
+        if (nXSize < 1 || nYSize < 1)
+            return CE_None;
         CPLAssert(false);
         return CE_Failure;
     }
 
+    return GDALWarpCutlineMaskerWithIndex(
+        pMaskFuncArg, nullptr, nXOff, nYOff, nXSize, nYSize,
+        static_cast<float *>(pValidityMask), pnValidityFlag);
+}
+
+/************************************************************************/
+/*                   GDALWarpCutlineMaskerWithIndex()                   */
+/************************************************************************/
+
+/** Same as GDALWarpCutlineMaskerEx() with a float mask, but using an
+ * optional index of the cutline edges, built once for all the chunks of a
+ * warp operation, to rasterize the cutline.
+ *
+ * poIndex must be nullptr when CUTLINE_ALL_TOUCHED is set.
+ */
+CPLErr GDALWarpCutlineMaskerWithIndex(void *pMaskFuncArg,
+                                      const GDALCutlineSegmentIndex *poIndex,
+                                      int nXOff, int nYOff, int nXSize,
+                                      int nYSize, float *pafMask,
+                                      int *pnValidityFlag)
+
+{
+    if (pnValidityFlag)
+        *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
+
+    if (nXSize < 1 || nYSize < 1)
+        return CE_None;
+
     GDALWarpOptions *psWO = static_cast<GDALWarpOptions *>(pMaskFuncArg);
 
     if (psWO == nullptr || psWO->hCutline == nullptr)
@@ -276,9 +540,10 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     }
 
     OGREnvelope sEnvelope;
-    OGR_G_GetEnvelope(hPolygon, &sEnvelope);
-
-    float *pafMask = static_cast<float *>(pValidityMask);
+    if (poIndex)
+        sEnvelope = poIndex->GetEnvelope();
+    else
+        OGR_G_GetEnvelope(hPolygon, &sEnvelope);
 
     if (sEnvelope.MaxX + psWO->dfCutlineBlendDist < nXOff ||
         sEnvelope.MinX - psWO->dfCutlineBlendDist > nXOff + nXSize ||
@@ -296,8 +561,11 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     }
 
     // And now check if the chunk to warp is fully contained within the cutline
-    // to save rasterization.
-    if (OGRGeometryFactory::haveGEOS()
+    // to save rasterization. With an index and no blend distance,
+    // rasterization is cheap and tells the same, whereas GEOS would have to
+    // process the whole cutline.
+    if ((poIndex == nullptr || psWO->dfCutlineBlendDist != 0.0) &&
+        OGRGeometryFactory::haveGEOS()
 #ifdef DEBUG
         // Env var just for debugging purposes
         && !CPLTestBool(
@@ -333,41 +601,33 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     /* -------------------------------------------------------------------- */
     /*      Create a byte buffer into which we can burn the                 */
-    /*      mask polygon and wrap it up as a memory dataset.                */
+    /*      mask polygon.                                                   */
     /* -------------------------------------------------------------------- */
     GByte *pabyPolyMask = static_cast<GByte *>(CPLCalloc(nXSize, nYSize));
+    CPLErr eErr = CE_None;
 
-    auto poMEMDS =
-        MEMDataset::Create("warp_temp", nXSize, nYSize, 0, GDT_Byte, nullptr);
-    GDALRasterBandH hMEMBand =
-        MEMCreateRasterBandEx(poMEMDS, 1, pabyPolyMask, GDT_Byte, 0, 0, false);
-    poMEMDS->AddMEMBand(hMEMBand);
-
-    GDALDatasetH hMemDS = GDALDataset::ToHandle(poMEMDS);
-    double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
-    GDALSetGeoTransform(hMemDS, adfGeoTransform);
-
-    /* -------------------------------------------------------------------- */
-    /*      Burn the polygon into the mask with 1.0 values.                 */
-    /* -------------------------------------------------------------------- */
-    int nTargetBand = 1;
-    double dfBurnValue = 255.0;
-    char **papszRasterizeOptions = nullptr;
-
-    if (CPLFetchBool(psWO->papszWarpOptions, "CUTLINE_ALL_TOUCHED", false))
-        papszRasterizeOptions =
-            CSLSetNameValue(papszRasterizeOptions, "ALL_TOUCHED", "TRUE");
-
-    int anXYOff[2] = {nXOff, nYOff};
-
-    CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+    if (poIndex)
+    {
+        poIndex->Rasterize(nXOff, nYOff, nXSize, nYSize, pabyPolyMask);
 
-    CSLDestroy(papszRasterizeOptions);
+        const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+        if (psWO->dfCutlineBlendDist == 0.0 &&
+            std::all_of(pabyPolyMask, pabyPolyMask + nPixels,
+                        [](GByte b) { return b != 0; }))
+        {
+            if (pnValidityFlag)
+                *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
 
-    // Close and ensure data flushed to underlying array.
-    GDALClose(hMemDS);
+            CPLDebug("WARP", "Source chunk fully contained within cutline.");
+            CPLFree(pabyPolyMask);
+            return CE_None;
+        }
+    }
+    else
+    {
+        eErr = RasterizeCutline(psWO, hPolygon, nXOff, nYOff, nXSize, nYSize,
+                                pabyPolyMask);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      In the case with no blend distance, we just apply this as a     */
@@ -378,14 +638,13 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         for (int i = nXSize * nYSize - 1; i >= 0; i--)
         {
             if (pabyPolyMask[i] == 0)
-                static_cast<float *>(pValidityMask)[i] = 0.0;
+                pafMask[i] = 0.0;
         }
     }
     else
     {
         eErr = BlendMaskGenerator(nXOff, nYOff, nXSize, nYSize, pabyPolyMask,
-                                  static_cast<float *>(pValidityMask), hPolygon,
-                                  psWO->dfCutlineBlendDist);
+                                  pafMask, hPolygon, psWO->dfCutlineBlendDist);
     }
 
     /* -------------------------------------------------------------------- */
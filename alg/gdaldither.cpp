@@ -37,6 +37,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -44,6 +48,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #ifdef USE_NEON_OPTIMIZATIONS
 #define USE_SSE2
@@ -96,6 +101,240 @@ typedef struct
     GByte nPadding;
 } ColorIndex;
 
+/************************************************************************/
+/*                       GetAlgNumThreads()                             */
+/************************************************************************/
+
+static int GetAlgNumThreads()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    if (EQUAL(pszThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszThreads), 1, 1024);
+}
+
+/************************************************************************/
+/*                      DitherMultiThreaded()                           */
+/************************************************************************/
+
+// Multi-threaded version of the processing loop of GDALDitherRGB2PCT(),
+// when using a color cube, that produces the same result.
+//
+// Lines are read and written by chunks by the calling thread. Each line of a
+// chunk is processed by a worker thread, which lags behind the thread that
+// processes the previous line, so that the error it diffuses is complete
+// before being used: the error applied to pixel i comes from pixels i - 1, i
+// and i + 1 of the previous line.
+static CPLErr DitherMultiThreaded(GDALRasterBandH hRed, GDALRasterBandH hGreen,
+                                  GDALRasterBandH hBlue,
+                                  GDALRasterBandH hTarget, int *anPCT,
+                                  const GByte *pabyColorMap, int nCLevels,
+                                  int bDither, int nNumThreads,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hRed);
+    const int nYSize = GDALGetRasterBandYSize(hRed);
+
+    const GDALThreadReservation oThreadReservation(nNumThreads);
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+
+    // Chunks of about 64 MB, counting the 3 input bytes, the output byte
+    // and the 3 error values of each pixel
+    constexpr size_t CHUNK_SIZE = 64 * 1024 * 1024;
+    const size_t nPixelSize = 4 + (bDither ? 3 * sizeof(int) : 0);
+    const int nChunkLines = static_cast<int>(
+        std::clamp<size_t>(CHUNK_SIZE / (nPixelSize * nXSize),
+                           std::min(nThreads, nYSize), nYSize));
+    const size_t nChunkPixels = static_cast<size_t>(nXSize) * nChunkLines;
+    const size_t nErrorLineSize = static_cast<size_t>(nXSize + 2) * 3;
+
+    std::vector<GByte> abyRed;
+    std::vector<GByte> abyGreen;
+    std::vector<GByte> abyBlue;
+    std::vector<GByte> abyIndex;
+    // Error diffused to each line of the chunk by the previous one, and by
+    // the last line of the chunk to the next chunk
+    std::vector<int> anError;
+    // Number of pixels processed in each line of the chunk
+    std::unique_ptr<std::atomic<int>[]> anDone;
+    try
+    {
+        abyRed.resize(nChunkPixels);
+        abyGreen.resize(nChunkPixels);
+        abyBlue.resize(nChunkPixels);
+        abyIndex.resize(nChunkPixels);
+        if (bDither)
+            anError.resize(nErrorLineSize * (nChunkLines + 1));
+        anDone.reset(new std::atomic<int>[nChunkLines]);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate dithering working buffers");
+        return CE_Failure;
+    }
+
+    const auto ProcessLine =
+        [&, nXSize](int iLine, std::atomic<int> *pnPrevDone)
+    {
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        const GByte *pabyRed = abyRed.data() + nOffset;
+        const GByte *pabyGreen = abyGreen.data() + nOffset;
+        const GByte *pabyBlue = abyBlue.data() + nOffset;
+        GByte *pabyIndex = abyIndex.data() + nOffset;
+        const int *panErrorIn =
+            bDither ? anError.data() + nErrorLineSize * iLine : nullptr;
+        int *panError =
+            bDither ? anError.data() + nErrorLineSize * (iLine + 1) : nullptr;
+        if (bDither)
+        {
+            // Other values are initialized by assignment before being
+            // accumulated to
+            memset(panError, 0, 6 * sizeof(int));
+        }
+
+        int nLastRedError = 0;
+        int nLastGreenError = 0;
+        int nLastBlueError = 0;
+
+        constexpr int BLOCK_SIZE = 64;
+        for (int iBlock = 0; iBlock < nXSize; iBlock += BLOCK_SIZE)
+        {
+            const int iBlockEnd = std::min(iBlock + BLOCK_SIZE, nXSize);
+            if (pnPrevDone)
+            {
+                const int nNeeded = std::min(iBlockEnd + 1, nXSize);
+                while (pnPrevDone->load(std::memory_order_acquire) < nNeeded)
+                    std::this_thread::yield();
+            }
+
+            for (int i = iBlock; i < iBlockEnd; i++)
+            {
+                int nRed = pabyRed[i];
+                int nGreen = pabyGreen[i];
+                int nBlue = pabyBlue[i];
+                if (bDither)
+                {
+                    nRed = std::max(
+                        0, std::min(255, nRed + panErrorIn[i * 3 + 0 + 3]));
+                    nGreen = std::max(
+                        0, std::min(255, nGreen + panErrorIn[i * 3 + 1 + 3]));
+                    nBlue = std::max(
+                        0, std::min(255, nBlue + panErrorIn[i * 3 + 2 + 3]));
+                }
+
+                const int nRedValue =
+                    std::max(0, std::min(255, nRed + nLastRedError));
+                const int nGreenValue =
+                    std::max(0, std::min(255, nGreen + nLastGreenError));
+                const int nBlueValue =
+                    std::max(0, std::min(255, nBlue + nLastBlueError));
+
+                const int iRed = nRedValue * nCLevels / 256;
+                const int iGreen = nGreenValue * nCLevels / 256;
+                const int iBlue = nBlueValue * nCLevels / 256;
+
+                const int iIndex = pabyColorMap[iRed + iGreen * nCLevels +
+                                                iBlue * nCLevels * nCLevels];
+                pabyIndex[i] = static_cast<GByte>(iIndex);
+                if (!bDither)
+                    continue;
+
+                int nError = nRedValue - CAST_PCT(anPCT)[4 * iIndex + 0];
+                int nSixth = nError / 6;
+                panError[i * 3] += nSixth;
+                panError[i * 3 + 6] = nSixth;
+                panError[i * 3 + 3] += nError - 5 * nSixth;
+                nLastRedError = 2 * nSixth;
+
+                nError = nGreenValue - CAST_PCT(anPCT)[4 * iIndex + 1];
+                nSixth = nError / 6;
+                panError[i * 3 + 1] += nSixth;
+                panError[i * 3 + 6 + 1] = nSixth;
+                panError[i * 3 + 3 + 1] += nError - 5 * nSixth;
+                nLastGreenError = 2 * nSixth;
+
+                nError = nBlueValue - CAST_PCT(anPCT)[4 * iIndex + 2];
+                nSixth = nError / 6;
+                panError[i * 3 + 2] += nSixth;
+                panError[i * 3 + 6 + 2] = nSixth;
+                panError[i * 3 + 3 + 2] += nError - 5 * nSixth;
+                nLastBlueError = 2 * nSixth;
+            }
+
+            anDone[iLine].store(iBlockEnd, std::memory_order_release);
+        }
+    };
+
+    for (int iChunkLine = 0; iChunkLine < nYSize; iChunkLine += nChunkLines)
+    {
+        if (!pfnProgress(iChunkLine / static_cast<double>(nYSize), nullptr,
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User Terminated");
+            return CE_Failure;
+        }
+
+        const int nLines = std::min(nChunkLines, nYSize - iChunkLine);
+        CPLErr err = GDALRasterIO(hRed, GF_Read, 0, iChunkLine, nXSize, nLines,
+                                  abyRed.data(), nXSize, nLines, GDT_Byte, 0,
+                                  0);
+        if (err == CE_None)
+            err = GDALRasterIO(hGreen, GF_Read, 0, iChunkLine, nXSize, nLines,
+                               abyGreen.data(), nXSize, nLines, GDT_Byte, 0,
+                               0);
+        if (err == CE_None)
+            err = GDALRasterIO(hBlue, GF_Read, 0, iChunkLine, nXSize, nLines,
+                               abyBlue.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        if (err != CE_None)
+            return err;
+
+        for (int i = 0; i < nLines; ++i)
+            anDone[i] = 0;
+
+        // Lines are handed out in order to jobs as soon as they are idle, so
+        // that the line a job waits for is always being processed.
+        std::atomic<int> nNextLine{0};
+        const auto Job = [&]()
+        {
+            int iLine;
+            while ((iLine = nNextLine++) < nLines)
+            {
+                ProcessLine(iLine, bDither && iLine > 0 ? &anDone[iLine - 1]
+                                                        : nullptr);
+            }
+        };
+        for (int iJob = 0; iJob < nThreads; ++iJob)
+        {
+            if (!poQueue || !poQueue->SubmitJob(Job))
+                Job();
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+
+        err = GDALRasterIO(hTarget, GF_Write, 0, iChunkLine, nXSize, nLines,
+                           abyIndex.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        if (err != CE_None)
+            return err;
+
+        // The error diffused by the last line of the chunk applies to the
+        // first line of the next one
+        if (bDither)
+        {
+            std::copy_n(anError.begin() + nErrorLineSize * nLines,
+                        nErrorLineSize, anError.begin());
+        }
+    }
+
+    pfnProgress(1.0, nullptr, pProgressArg);
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                         GDALDitherRGB2PCT()                          */
 /************************************************************************/
@@ -133,6 +372,11 @@ static inline bool IsColorCodeSet(GUInt32 nColorCode)
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
  *
+ * Starting with GDAL 3.12, the number of threads used can be specified with
+ * the GDAL_NUM_THREADS configuration option (an integer or ALL_CPUS; defaults
+ * to 1). Lines are then processed in a pipelined way, with a result identical
+ * to single-threaded processing.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 
@@ -301,6 +545,26 @@ int GDALDitherRGB2PCTInternal(
         }
 
         FindNearestColor(nColors, anPCT, pabyColorMap, nCLevels);
+
+        // Not worth using threads for small images
+        constexpr int MIN_LINES_PER_THREAD = 32;
+        const int nNumThreads =
+            std::min(GetAlgNumThreads(), nYSize / MIN_LINES_PER_THREAD);
+        if (nNumThreads > 1)
+        {
+            const CPLErr err = DitherMultiThreaded(
+                hRed, hGreen, hBlue, hTarget, anPCT, pabyColorMap, nCLevels,
+                bDither, nNumThreads, pfnProgress, pProgressArg);
+
+            CPLFree(pabyRed);
+            CPLFree(pabyGreen);
+            CPLFree(pabyBlue);
+            CPLFree(pabyIndex);
+            CPLFree(panError);
+            CPLFree(pabyColorMap);
+
+            return err;
+        }
     }
     else
     {
@@ -32,10 +32,12 @@
 #include "cpl_error.h"
 #include "cpl_minixml.h"
 #include "cpl_quad_tree.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1080,6 +1082,24 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     psTransform->adfBackMapGeoTransform[4] = 0.0;
     psTransform->adfBackMapGeoTransform[5] = -dfPixelYSize;
 
+    /* -------------------------------------------------------------------- */
+    /*      Reuse a previously computed backmap if possible.                */
+    /* -------------------------------------------------------------------- */
+    std::string osSignature;
+    if (psTransform->pszBackMapFilename)
+    {
+        osSignature = GetBackMapSignature(psTransform);
+        bool bLoaded = false;
+        if (!LoadBackMap(psTransform, osSignature, bLoaded))
+            return false;
+        if (bLoaded)
+        {
+            CPLDebug("GEOLOC", "Backmap loaded from %s",
+                     psTransform->pszBackMapFilename);
+            return true;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate backmap.                                               */
     /* -------------------------------------------------------------------- */
@@ -1148,12 +1168,6 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
-    // Keep those objects in this outer scope, so they are re-used, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
     /*      pushing into the backmap.                                       */
@@ -1211,219 +1225,319 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    const auto SetBackMap = [pAccessors](int iBMX, int iBMY, float fBMX,
+                                         float fBMY)
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        pAccessors->backMapXAccessor.Set(iBMX, iBMY, fBMX);
+        pAccessors->backMapYAccessor.Set(iBMX, iBMY, fBMY);
+        pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+    };
+
+    // Weighted update of the backmap nodes around (dBMX, dBMY), when no
+    // geolocation cell matching the top-left node has been found.
+    const auto UpdateBackmapAround =
+        [&](double dfX, double dfY, double dBMX, double dBMY)
+    {
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
+
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return;
+
+        const double fracBMX = dBMX - iBMX;
+        const double fracBMY = dBMY - iBMY;
+
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
         {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
+
+    // Process the samples of a block of the geolocation array. This only
+    // reads the geolocation array: backmap updates are passed to
+    // setBackMap() and updateBackmapAround(), so that blocks can be
+    // processed by worker threads that record those updates.
+    const auto ProcessBlock =
+        [&](int iYBlock, int iXBlock, OGRPoint &oPoint, OGRLinearRing &oRing,
+            auto &&setBackMap, auto &&updateBackmapAround)
+    {
 #if 0
         CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
                  iYBlock, iXBlock,
                  yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
                  xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
 #endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        for (double dfY = yStartEnd[iYBlock].first;
+             dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        {
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
             {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
+                // Use forward geolocation array interpolation to compute
+                // the georeferenced position corresponding to (dfX, dfY)
+                double dfGeoLocX;
+                double dfGeoLocY;
+                if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
+                                   dfGeoLocY))
+                    continue;
 
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
+                // Compute the floating point coordinates in the pixel space
+                // of the backmap
+                const double dBMX =
+                    static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
 
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
+                const double dBMY =
+                    static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
 
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+                // Get top left index by truncation
+                const int iBMX = static_cast<int>(std::floor(dBMX));
+                const int iBMY = static_cast<int>(std::floor(dBMY));
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
-                    {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+                if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
+                    iBMY < nBMYSize)
+                {
+                    // Compute the georeferenced position of the top-left
+                    // index of the backmap
+                    double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+                    const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
 
-                        bool bMatchingGeoLocCellFound = false;
+                    bool bMatchingGeoLocCellFound = false;
 
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+                    const int nOuterIters =
+                        psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                                fabs(dfGeoX) >= 180
+                            ? 2
+                            : 1;
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+                    for (int iOuterIter = 0; iOuterIter < nOuterIters;
+                         ++iOuterIter)
+                    {
+                        if (iOuterIter == 1 && dfGeoX >= 180)
+                            dfGeoX -= 360;
+                        else if (iOuterIter == 1 && dfGeoX <= -180)
+                            dfGeoX += 360;
+
+                        // Identify a cell (quadrilateral in georeferenced
+                        // space) in the geolocation array in which dfGeoX,
+                        // dfGeoY falls into.
+                        oPoint.setX(dfGeoX);
+                        oPoint.setY(dfGeoY);
+                        const int nX = static_cast<int>(std::floor(dfX));
+                        const int nY = static_cast<int>(std::floor(dfY));
+                        for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0;
+                             sx++)
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            for (int sy = -1;
+                                 !bMatchingGeoLocCellFound && sy <= 0; sy++)
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
+                                const int pixel = nX + sx;
+                                const int line = nY + sy;
+                                double x0, y0, x1, y1, x2, y2, x3, y3;
+                                if (!PixelLineToXY(psTransform, pixel, line, x0,
+                                                   y0) ||
+                                    !PixelLineToXY(psTransform, pixel + 1, line,
+                                                   x2, y2) ||
+                                    !PixelLineToXY(psTransform, pixel, line + 1,
+                                                   x1, y1) ||
+                                    !PixelLineToXY(psTransform, pixel + 1,
+                                                   line + 1, x3, y3))
                                 {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
+                                    break;
+                                }
 
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
+                                int nIters = 1;
+                                if (psTransform
+                                        ->bGeographicSRSWithMinus180Plus180LongRange &&
+                                    std::fabs(x0) > 170 &&
+                                    std::fabs(x1) > 170 &&
+                                    std::fabs(x2) > 170 &&
+                                    std::fabs(x3) > 170 &&
+                                    (std::fabs(x1 - x0) > 180 ||
+                                     std::fabs(x2 - x0) > 180 ||
+                                     std::fabs(x3 - x0) > 180))
+                                {
+                                    nIters = 2;
+                                    if (x0 > 0)
+                                        x0 -= 360;
+                                    if (x1 > 0)
+                                        x1 -= 360;
+                                    if (x2 > 0)
+                                        x2 -= 360;
+                                    if (x3 > 0)
+                                        x3 -= 360;
+                                }
+                                for (int iIter = 0; iIter < nIters; ++iIter)
+                                {
+                                    if (iIter == 1)
                                     {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
+                                        x0 += 360;
+                                        x1 += 360;
+                                        x2 += 360;
+                                        x3 += 360;
                                     }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
+
+                                    oRing.setPoint(0, x0, y0);
+                                    oRing.setPoint(1, x2, y2);
+                                    oRing.setPoint(2, x3, y3);
+                                    oRing.setPoint(3, x1, y1);
+                                    oRing.setPoint(4, x0, y0);
+                                    if (oRing.isPointInRing(&oPoint) ||
+                                        oRing.isPointOnRingBoundary(&oPoint))
                                     {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
+                                        bMatchingGeoLocCellFound = true;
+                                        double dfBMXValue = pixel;
+                                        double dfBMYValue = line;
+                                        GDALInverseBilinearInterpolation(
+                                            dfGeoX, dfGeoY, x0, y0, x1, y1, x2,
+                                            y2, x3, y3, dfBMXValue, dfBMYValue);
+
+                                        dfBMXValue =
+                                            (dfBMXValue +
+                                             dfGeorefConventionOffset) *
+                                                psTransform->dfPIXEL_STEP +
+                                            psTransform->dfPIXEL_OFFSET;
+                                        dfBMYValue =
+                                            (dfBMYValue +
+                                             dfGeorefConventionOffset) *
+                                                psTransform->dfLINE_STEP +
+                                            psTransform->dfLINE_OFFSET;
+
+                                        setBackMap(
+                                            iBMX, iBMY,
+                                            static_cast<float>(dfBMXValue),
+                                            static_cast<float>(dfBMYValue));
                                     }
                                 }
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
                     }
-
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
-
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
+                    if (bMatchingGeoLocCellFound)
                         continue;
+                }
 
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
-
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
+                // We will end up here in non-nominal cases, with nodata,
+                // holes, etc.
+                updateBackmapAround(dfX, dfY, dBMX, dBMY);
+            }
+        }
+    };
 
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
+    CPLWorkerThreadPool *poThreadPool =
+        psTransform->bUseArray && psTransform->nBackMapThreads > 1
+            ? GDALGetGlobalThreadPool(psTransform->nBackMapThreads)
+            : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        // Keep those objects in this outer scope, so they are re-used, to
+        // save memory allocations.
+        OGRPoint oPoint;
+        OGRLinearRing oRing;
+        oRing.setNumPoints(5);
 
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
+        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        {
+            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+            {
+                ProcessBlock(iYBlock, iXBlock, oPoint, oRing, SetBackMap,
+                             UpdateBackmapAround);
+            }
+        }
+    }
+    else
+    {
+        // Blocks are processed by batches: worker threads record the
+        // updates of a block, that are then applied in the same order as
+        // in the sequential case, so that the result is the same.
+        struct BackMapUpdate
+        {
+            bool bExact;  // From a matching geolocation cell.
+            int iBMX;
+            int iBMY;
+            float fBMX;
+            float fBMY;
+            double dfX;
+            double dfY;
+            double dBMX;
+            double dBMY;
+        };
+
+        const int nBlocks = nXBlocks * nYBlocks;
+        const int nBatchSize = psTransform->nBackMapThreads;
+        std::vector<std::vector<BackMapUpdate>> aaoUpdates(nBatchSize);
+        for (int iBatchStart = 0; iBatchStart < nBlocks;
+             iBatchStart += nBatchSize)
+        {
+            const int nBatchBlocks =
+                std::min(nBatchSize, nBlocks - iBatchStart);
+            for (int i = 0; i < nBatchBlocks; ++i)
+            {
+                const auto Job = [&ProcessBlock, &aaoUpdates, nXBlocks,
+                                  iBatchStart, i]()
+                {
+                    auto &aoUpdates = aaoUpdates[i];
+                    aoUpdates.clear();
+                    OGRPoint oPoint;
+                    OGRLinearRing oRing;
+                    oRing.setNumPoints(5);
+                    const int iBlock = iBatchStart + i;
+                    ProcessBlock(
+                        iBlock / nXBlocks, iBlock % nXBlocks, oPoint, oRing,
+                        [&aoUpdates](int iBMX, int iBMY, float fBMX,
+                                     float fBMY) {
+                            aoUpdates.push_back(
+                                {true, iBMX, iBMY, fBMX, fBMY, 0, 0, 0, 0});
+                        },
+                        [&aoUpdates](double dfX, double dfY, double dBMX,
+                                     double dBMY) {
+                            aoUpdates.push_back(
+                                {false, 0, 0, 0, 0, dfX, dfY, dBMX, dBMY});
+                        });
+                };
+                if (!poQueue->SubmitJob(Job))
+                    Job();
+            }
+            poQueue->WaitCompletion();
 
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
+            for (int i = 0; i < nBatchBlocks; ++i)
+            {
+                for (const auto &oUpdate : aaoUpdates[i])
+                {
+                    if (oUpdate.bExact)
+                        SetBackMap(oUpdate.iBMX, oUpdate.iBMY, oUpdate.fBMX,
+                                   oUpdate.fBMY);
+                    else
+                        UpdateBackmapAround(oUpdate.dfX, oUpdate.dfY,
+                                            oUpdate.dBMX, oUpdate.dBMY);
                 }
             }
         }
@@ -1481,12 +1595,17 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
 
     constexpr double dfMaxSearchDist = 3.0;
     constexpr int nSmoothingIterations = 1;
+    CPLStringList aosFillOptions;
+    if (psTransform->nBackMapThreads > 1)
+        aosFillOptions.SetNameValue(
+            "NUM_THREADS", CPLSPrintf("%d", psTransform->nBackMapThreads));
     for (int i = 1; i <= 2; i++)
     {
         GDALFillNodata(GDALRasterBand::ToHandle(poBackmapDS->GetRasterBand(i)),
                        nullptr, dfMaxSearchDist,
                        0,  // unused parameter
-                       nSmoothingIterations, nullptr, nullptr, nullptr);
+                       nSmoothingIterations, aosFillOptions.List(), nullptr,
+                       nullptr);
     }
 
 #ifdef DEBUG_GEOLOC
@@ -1571,12 +1690,184 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     }
 #endif
 
+    if (psTransform->pszBackMapFilename)
+    {
+        pAccessors->FlushBackmapCaches();
+        if (SaveBackMap(psTransform, poBackmapDS, osSignature))
+        {
+            CPLDebug("GEOLOC", "Backmap saved in %s",
+                     psTransform->pszBackMapFilename);
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined, "Cannot save backmap in %s",
+                     psTransform->pszBackMapFilename);
+        }
+    }
+
     pAccessors->ReleaseBackmapDataset(poBackmapDS);
     CPLDebug("GEOLOC", "Ending backmap generation");
 
     return true;
 }
 
+/************************************************************************/
+/*                   GDALGeoLoc::GetBackMapSignature()                  */
+/************************************************************************/
+
+// Return a string identifying the backmap of a transformer: its size and
+// geotransform, the parameters it depends on, and a hash of the geolocation
+// arrays.
+template <class Accessors>
+std::string GDALGeoLoc<Accessors>::GetBackMapSignature(
+    const GDALGeoLocTransformInfo *psTransform)
+{
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    const int nXSize = psTransform->nGeoLocXSize;
+    const int nYSize = psTransform->nGeoLocYSize;
+
+    CPL_SHA256Context sContext;
+    CPL_SHA256Init(&sContext);
+    std::vector<double> adfValues;
+    constexpr int TILE_SIZE = GDALGeoLocDatasetAccessors::TILE_SIZE;
+    START_ITER_PER_BLOCK(nXSize, TILE_SIZE, nYSize, TILE_SIZE, (void)0,
+                         iXStart, iXEnd, iYStart, iYEnd)
+    {
+        for (int iY = iYStart; iY < iYEnd; ++iY)
+        {
+            adfValues.clear();
+            for (int iX = iXStart; iX < iXEnd; ++iX)
+            {
+                adfValues.push_back(pAccessors->geolocXAccessor.Get(iX, iY));
+                adfValues.push_back(pAccessors->geolocYAccessor.Get(iX, iY));
+            }
+            CPL_SHA256Update(&sContext, adfValues.data(),
+                             adfValues.size() * sizeof(double));
+        }
+    }
+    END_ITER_PER_BLOCK
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256Final(&sContext, abyHash);
+    char *pszHash = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+
+    const double *padfGT = psTransform->adfBackMapGeoTransform;
+    std::string osSignature(CPLSPrintf(
+        "version=1 geoloc=%dx%d pixel=%.17g,%.17g line=%.17g,%.17g "
+        "top_left_corner=%d normalize_longitude=%d nodata=%.17g "
+        "backmap=%dx%d gt=%.17g,%.17g,%.17g,%.17g,%.17g,%.17g hash=",
+        nXSize, nYSize, psTransform->dfPIXEL_OFFSET, psTransform->dfPIXEL_STEP,
+        psTransform->dfLINE_OFFSET, psTransform->dfLINE_STEP,
+        static_cast<int>(psTransform->bOriginIsTopLeftCorner),
+        static_cast<int>(
+            psTransform->bGeographicSRSWithMinus180Plus180LongRange),
+        psTransform->bHasNoData ? psTransform->dfNoDataX
+                                : std::numeric_limits<double>::quiet_NaN(),
+        psTransform->nBackMapWidth, psTransform->nBackMapHeight, padfGT[0],
+        padfGT[1], padfGT[2], padfGT[3], padfGT[4], padfGT[5]));
+    osSignature += pszHash;
+    CPLFree(pszHash);
+    return osSignature;
+}
+
+/************************************************************************/
+/*                       GDALGeoLoc::LoadBackMap()                      */
+/************************************************************************/
+
+// Load the backmap from psTransform->pszBackMapFilename if it exists and
+// was computed with the same signature. bLoaded is set to false if the
+// file can't be used, in which case the backmap must be generated.
+// Returns false in case of error.
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::LoadBackMap(GDALGeoLocTransformInfo *psTransform,
+                                        const std::string &osSignature,
+                                        bool &bLoaded)
+{
+    bLoaded = false;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(psTransform->pszBackMapFilename, &sStat) != 0)
+        return true;
+
+    std::unique_ptr<GDALDataset> poDS(
+        GDALDataset::Open(psTransform->pszBackMapFilename, GDAL_OF_RASTER));
+    const char *pszSignature =
+        poDS ? poDS->GetMetadataItem("GEOLOC_BACKMAP_SIGNATURE") : nullptr;
+    if (!pszSignature || osSignature != pszSignature ||
+        poDS->GetRasterCount() != 2 ||
+        poDS->GetRasterXSize() != psTransform->nBackMapWidth ||
+        poDS->GetRasterYSize() != psTransform->nBackMapHeight)
+    {
+        CPLDebug("GEOLOC",
+                 "%s is not a backmap of the current geolocation arrays. "
+                 "It will be overwritten",
+                 psTransform->pszBackMapFilename);
+        return true;
+    }
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    if (!pAccessors->AllocateBackMap())
+        return false;
+    pAccessors->FreeWghtsBackMap();
+
+    auto poBackmapDS = pAccessors->GetBackmapDataset();
+    const CPLErr eErr = GDALDatasetCopyWholeRaster(
+        GDALDataset::ToHandle(poDS.get()), GDALDataset::ToHandle(poBackmapDS),
+        nullptr, nullptr, nullptr);
+    pAccessors->ReleaseBackmapDataset(poBackmapDS);
+
+    bLoaded = eErr == CE_None;
+    return bLoaded;
+}
+
+/************************************************************************/
+/*                       GDALGeoLoc::SaveBackMap()                      */
+/************************************************************************/
+
+// Save the backmap in psTransform->pszBackMapFilename. The file is first
+// written under a temporary name, so that a partially written file is never
+// used.
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::SaveBackMap(
+    const GDALGeoLocTransformInfo *psTransform, GDALDataset *poBackmapDS,
+    const std::string &osSignature)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poDriver)
+        return false;
+
+    const std::string osTmpFilename =
+        std::string(psTransform->pszBackMapFilename) + ".tmp";
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("TILED", "YES");
+    aosOptions.SetNameValue("COMPRESS", "DEFLATE");
+    aosOptions.SetNameValue("PREDICTOR", "3");
+    std::unique_ptr<GDALDataset> poDS(poDriver->Create(
+        osTmpFilename.c_str(), psTransform->nBackMapWidth,
+        psTransform->nBackMapHeight, 2, GDT_Float32, aosOptions.List()));
+    if (!poDS)
+        return false;
+
+    poDS->SetGeoTransform(
+        GDALGeoTransform(psTransform->adfBackMapGeoTransform));
+    poDS->SetMetadataItem("GEOLOC_BACKMAP_SIGNATURE", osSignature.c_str());
+    for (int i = 1; i <= 2; ++i)
+        poDS->GetRasterBand(i)->SetNoDataValue(INVALID_BMXY);
+
+    bool bOK = GDALDatasetCopyWholeRaster(GDALDataset::ToHandle(poBackmapDS),
+                                          GDALDataset::ToHandle(poDS.get()),
+                                          nullptr, nullptr,
+                                          nullptr) == CE_None;
+    bOK = poDS->Close() == CE_None && bOK;
+    poDS.reset();
+    if (bOK)
+        bOK = VSIRename(osTmpFilename.c_str(),
+                        psTransform->pszBackMapFilename) == 0;
+    if (!bOK)
+        VSIUnlink(osTmpFilename.c_str());
+    return bOK;
+}
+
 /*! @endcond */
 
 /************************************************************************/
@@ -1791,6 +2082,19 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    const char *pszThreads =
+        CSLFetchNameValue(papszTransformOptions, "NUM_THREADS");
+    if (pszThreads == nullptr)
+        pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    psTransform->nBackMapThreads =
+        std::max(1, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                  : atoi(pszThreads));
+
+    const char *pszBackMapFilename =
+        CSLFetchNameValue(papszTransformOptions, "GEOLOC_BACKMAP_FILENAME");
+    if (pszBackMapFilename && pszBackMapFilename[0])
+        psTransform->pszBackMapFilename = CPLStrdup(pszBackMapFilename);
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
@@ -2077,6 +2381,7 @@ void GDALDestroyGeoLocTransformer(void *pTransformAlg)
         static_cast<GDALGeoLocTransformInfo *>(pTransformAlg);
 
     CSLDestroy(psTransform->papszGeolocationInfo);
+    CPLFree(psTransform->pszBackMapFilename);
 
     if (psTransform->bUseArray)
         delete static_cast<GDALGeoLocCArrayAccessors *>(
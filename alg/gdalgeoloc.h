@@ -15,6 +15,10 @@
 
 #include "gdal_alg_priv.h"
 
+#include <string>
+
+class GDALDataset;
+
 /************************************************************************/
 /*                           GDALGeoLoc                                 */
 /************************************************************************/
@@ -27,6 +31,16 @@ template <class Accessors> struct GDALGeoLoc
 
     static bool GenerateBackMap(GDALGeoLocTransformInfo *psTransform);
 
+    static std::string
+    GetBackMapSignature(const GDALGeoLocTransformInfo *psTransform);
+
+    static bool LoadBackMap(GDALGeoLocTransformInfo *psTransform,
+                            const std::string &osSignature, bool &bLoaded);
+
+    static bool SaveBackMap(const GDALGeoLocTransformInfo *psTransform,
+                            GDALDataset *poBackmapDS,
+                            const std::string &osSignature);
+
     static bool PixelLineToXY(const GDALGeoLocTransformInfo *psTransform,
                               const int nGeoLocPixel, const int nGeoLocLine,
                               double &dfX, double &dfY);
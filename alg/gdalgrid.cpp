@@ -22,8 +22,8 @@
 #include <cstring>
 
 #include <limits>
-#include <map>
 #include <utility>
+#include <vector>
 #include <algorithm>
 
 #include "cpl_conv.h"
@@ -56,6 +56,79 @@ static void GDALGridGetPointBounds(const void *hFeature, CPLRectObj *pBounds)
     pBounds->maxy = dfY;
 }
 
+/************************************************************************/
+/*                          GDALGridNeighbors                           */
+/************************************************************************/
+
+namespace
+{
+// Points found in the search area of a grid node, to be sorted by increasing
+// distance. Points at the same distance keep the order in which they were
+// added.
+class GDALGridNeighbors
+{
+  public:
+    struct Neighbor
+    {
+        double dfR2;
+        double dfZ;
+        size_t nOrder;
+
+        bool operator<(const Neighbor &other) const
+        {
+            return dfR2 < other.dfR2 ||
+                   (dfR2 == other.dfR2 && nOrder < other.nOrder);
+        }
+    };
+
+    typedef std::vector<Neighbor>::const_iterator const_iterator;
+
+    void Add(double dfR2, double dfZ)
+    {
+        m_aoNeighbors.push_back(Neighbor{dfR2, dfZ, m_aoNeighbors.size()});
+    }
+
+    // Sort by increasing distance, and keep only the nMaxPoints nearest
+    // points if nMaxPoints > 0.
+    void Sort(GUInt32 nMaxPoints)
+    {
+        if (nMaxPoints > 0 && nMaxPoints < m_aoNeighbors.size())
+        {
+            std::nth_element(m_aoNeighbors.begin(),
+                             m_aoNeighbors.begin() + nMaxPoints,
+                             m_aoNeighbors.end());
+            m_aoNeighbors.resize(nMaxPoints);
+        }
+        std::sort(m_aoNeighbors.begin(), m_aoNeighbors.end());
+    }
+
+    const_iterator begin() const
+    {
+        return m_aoNeighbors.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_aoNeighbors.end();
+    }
+
+  private:
+    std::vector<Neighbor> m_aoNeighbors{};
+};
+
+// Maximum number of points to take from a quadrant, given the maximum number
+// of points overall and per quadrant (0 meaning no limit).
+GUInt32 GDALGridGetMaxPointsPerQuadrant(GUInt32 nMaxPoints,
+                                        GUInt32 nMaxPointsPerQuadrant)
+{
+    if (nMaxPoints == 0)
+        return nMaxPointsPerQuadrant;
+    if (nMaxPointsPerQuadrant == 0)
+        return nMaxPoints;
+    return std::min(nMaxPoints, nMaxPointsPerQuadrant);
+}
+}  // namespace
+
 /************************************************************************/
 /*                   GDALGridInverseDistanceToAPower()                  */
 /************************************************************************/
@@ -263,7 +336,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
 
-    std::multimap<double, double> oMapDistanceToZValues;
+    GDALGridNeighbors oNeighbors;
 
     const double dfSearchRadius = dfRadius;
     CPLRectObj sAoi;
@@ -294,8 +367,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             // is point within real distance?
             if (dfR2 <= dfRPower2)
             {
-                oMapDistanceToZValues.insert(
-                    std::make_pair(dfRsmoothed2, padfZ[i]));
+                oNeighbors.Add(dfRsmoothed2, padfZ[i]);
             }
         }
     }
@@ -305,16 +377,13 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     double dfDenominator = 0.0;
     GUInt32 n = 0;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
-    for (std::multimap<double, double>::iterator oMapDistanceToZValuesIter =
-             oMapDistanceToZValues.begin();
-         oMapDistanceToZValuesIter != oMapDistanceToZValues.end();
-         ++oMapDistanceToZValuesIter)
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
+    oNeighbors.Sort(nMaxPoints);
+    for (const auto &oNeighbor : oNeighbors)
     {
-        const double dfR2 = oMapDistanceToZValuesIter->first;
-        const double dfZ = oMapDistanceToZValuesIter->second;
+        const double dfR2 = oNeighbor.dfR2;
+        const double dfZ = oNeighbor.dfZ;
 
         const double dfW = pow(dfR2, dfPowerDiv2);
         const double dfInvW = 1.0 / dfW;
@@ -371,7 +440,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     const double dfSearchRadius = dfRadius;
     CPLRectObj sAoi;
@@ -404,24 +473,25 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRsmoothed2, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRsmoothed2, padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(GDALGridGetMaxPointsPerQuadrant(
+            nMaxPoints, nMaxPointsPerQuadrant));
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -432,8 +502,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
     GUInt32 n = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -443,8 +512,8 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             continue;
         }
 
-        const double dfR2 = aoIter[iQuadrant]->first;
-        const double dfZ = aoIter[iQuadrant]->second;
+        const double dfR2 = aoIter[iQuadrant]->dfR2;
+        const double dfZ = aoIter[iQuadrant]->dfZ;
         ++aoIter[iQuadrant];
 
         const double dfW = pow(dfR2, dfPowerDiv2);
@@ -752,7 +821,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
     CPLAssert(phQuadTree);
 
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     const double dfSearchRadius =
         std::max(poOptions->dfRadius1, poOptions->dfRadius2);
@@ -779,24 +848,26 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRXSquare + dfRYSquare, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRXSquare + dfRYSquare,
+                                                      padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(GDALGridGetMaxPointsPerQuadrant(
+            nMaxPoints, nMaxPointsPerQuadrant));
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -806,8 +877,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     GUInt32 n = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -817,7 +887,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
             continue;
         }
 
-        const double dfZ = aoIter[iQuadrant]->second;
+        const double dfZ = aoIter[iQuadrant]->dfZ;
         ++aoIter[iQuadrant];
 
         dfNominator += dfZ;
@@ -1174,7 +1244,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
         CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
@@ -1191,24 +1261,25 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRXSquare + dfRYSquare, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRXSquare + dfRYSquare,
+                                                      padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(nMaxPointsPerQuadrant);
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -1219,8 +1290,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     GUInt32 n = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -1230,7 +1300,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
             continue;
         }
 
-        const double dfZ = aoIter[iQuadrant]->second;
+        const double dfZ = aoIter[iQuadrant]->dfZ;
         ++aoIter[iQuadrant];
 
         if (IS_MIN)
@@ -1627,7 +1697,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
         CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
@@ -1644,24 +1714,25 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRXSquare + dfRYSquare, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRXSquare + dfRYSquare,
+                                                      padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(nMaxPointsPerQuadrant);
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -1672,8 +1743,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     GUInt32 n = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -1683,7 +1753,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
             continue;
         }
 
-        const double dfZ = aoIter[iQuadrant]->second;
+        const double dfZ = aoIter[iQuadrant]->dfZ;
         ++aoIter[iQuadrant];
 
         if (dfMinimumValue > dfZ)
@@ -1889,7 +1959,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
         CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
@@ -1906,24 +1976,25 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRXSquare + dfRYSquare, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRXSquare + dfRYSquare,
+                                                      padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(nMaxPointsPerQuadrant);
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -1932,8 +2003,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     GUInt32 n = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -2153,7 +2223,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
         CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
-    std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
+    GDALGridNeighbors aoNeighborsPerQuadrant[4];
 
     if (nFeatureCount != 0)
     {
@@ -2170,24 +2240,25 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
             {
                 const int iQuadrant =
                     ((dfRX >= 0) ? 1 : 0) | (((dfRY >= 0) ? 1 : 0) << 1);
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].insert(
-                    std::make_pair(dfRXSquare + dfRYSquare, padfZ[i]));
+                aoNeighborsPerQuadrant[iQuadrant].Add(dfRXSquare + dfRYSquare,
+                                                      padfZ[i]);
             }
         }
     }
     CPLFree(papsPoints);
 
-    std::multimap<double, double>::iterator aoIter[] = {
-        oMapDistanceToZValuesPerQuadrant[0].begin(),
-        oMapDistanceToZValuesPerQuadrant[1].begin(),
-        oMapDistanceToZValuesPerQuadrant[2].begin(),
-        oMapDistanceToZValuesPerQuadrant[3].begin(),
+    for (auto &oNeighbors : aoNeighborsPerQuadrant)
+        oNeighbors.Sort(nMaxPointsPerQuadrant);
+    GDALGridNeighbors::const_iterator aoIter[] = {
+        aoNeighborsPerQuadrant[0].begin(),
+        aoNeighborsPerQuadrant[1].begin(),
+        aoNeighborsPerQuadrant[2].begin(),
+        aoNeighborsPerQuadrant[3].begin(),
     };
     constexpr int ALL_QUADRANT_FLAGS = 1 + 2 + 4 + 8;
 
-    // Examine all "neighbors" within the radius (sorted by distance via the
-    // multimap), and use the closest n points based on distance until the max
-    // is reached.
+    // Examine all "neighbors" within the radius (sorted by distance), and use
+    // the closest n points based on distance until the max is reached.
     // Do that by fetching the nearest point in quadrant 0, then the nearest
     // point in quadrant 1, 2 and 3, and starting again with the next nearest
     // point in quarant 0, etc.
@@ -2197,8 +2268,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     double dfAccumulator = 0;
     for (int iQuadrant = 0; /* true */; iQuadrant = (iQuadrant + 1) % 4)
     {
-        if (aoIter[iQuadrant] ==
-                oMapDistanceToZValuesPerQuadrant[iQuadrant].end() ||
+        if (aoIter[iQuadrant] == aoNeighborsPerQuadrant[iQuadrant].end() ||
             (nMaxPointsPerQuadrant > 0 &&
              anPerQuadrant[iQuadrant] >= nMaxPointsPerQuadrant))
         {
@@ -2208,7 +2278,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
             continue;
         }
 
-        dfAccumulator += sqrt(aoIter[iQuadrant]->first);
+        dfAccumulator += sqrt(aoIter[iQuadrant]->dfR2);
         ++aoIter[iQuadrant];
 
         n++;
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -37,6 +38,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 template <typename T> static T *HISTOGRAM(T *h, int n, int r, int g, int b)
 {
@@ -124,6 +126,10 @@ static Colorbox *largest_box(Colorbox *usedboxes);
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
  *
+ * Starting with GDAL 3.12, the histogram is collected using the number of
+ * threads specified by the GDAL_NUM_THREADS configuration option (an integer
+ * or ALL_CPUS; defaults to 1).
+ *
  * @return returns CE_None on success or CE_Failure if an error occurs.
  */
 
@@ -262,6 +268,148 @@ static inline int *FindAndInsertColorCount(HashHistogram *psHashHistogram,
     }
 }
 
+/************************************************************************/
+/*                       GetAlgNumThreads()                             */
+/************************************************************************/
+
+static int GetAlgNumThreads()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    if (EQUAL(pszThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszThreads), 1, 1024);
+}
+
+/************************************************************************/
+/*                   CollectHistogramMultiThreaded()                    */
+/************************************************************************/
+
+// Collect the histogram of the image, and the bounds of its colors in box,
+// by chunks of lines read by the calling thread. The pixels of each chunk
+// are split between jobs that accumulate them into per-thread histograms,
+// which are summed at the end.
+template <class T>
+static CPLErr CollectHistogramMultiThreaded(
+    GDALRasterBandH hRed, GDALRasterBandH hGreen, GDALRasterBandH hBlue,
+    int nXSize, int nYSize, int nColorShift, int nCLevels, T *histogram,
+    Colorbox *box, int nNumThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const GDALThreadReservation oThreadReservation(nNumThreads);
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+
+    struct JobState
+    {
+        std::vector<T> anHistogram{};
+        int rmin = 999;
+        int gmin = 999;
+        int bmin = 999;
+        int rmax = -1;
+        int gmax = -1;
+        int bmax = -1;
+    };
+
+    // Chunks of about 16 MB
+    constexpr int CHUNK_SIZE = 16 * 1024 * 1024;
+    const int nChunkLines =
+        std::clamp(CHUNK_SIZE / (3 * nXSize), std::min(nThreads, nYSize),
+                   nYSize);
+    const size_t nChunkPixels = static_cast<size_t>(nXSize) * nChunkLines;
+    const int nCLevelsCube = nCLevels * nCLevels * nCLevels;
+
+    std::vector<GByte> abyRed;
+    std::vector<GByte> abyGreen;
+    std::vector<GByte> abyBlue;
+    std::vector<JobState> asJobStates(nThreads);
+    try
+    {
+        abyRed.resize(nChunkPixels);
+        abyGreen.resize(nChunkPixels);
+        abyBlue.resize(nChunkPixels);
+        for (auto &sJobState : asJobStates)
+            sJobState.anHistogram.resize(nCLevelsCube);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate histogram working buffers");
+        return CE_Failure;
+    }
+
+    for (int iLine = 0; iLine < nYSize; iLine += nChunkLines)
+    {
+        if (!pfnProgress(iLine / static_cast<double>(nYSize),
+                         "Generating Histogram", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User Terminated");
+            return CE_Failure;
+        }
+
+        const int nLines = std::min(nChunkLines, nYSize - iLine);
+        CPLErr err =
+            GDALRasterIO(hRed, GF_Read, 0, iLine, nXSize, nLines, abyRed.data(),
+                         nXSize, nLines, GDT_Byte, 0, 0);
+        if (err == CE_None)
+            err = GDALRasterIO(hGreen, GF_Read, 0, iLine, nXSize, nLines,
+                               abyGreen.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        if (err == CE_None)
+            err = GDALRasterIO(hBlue, GF_Read, 0, iLine, nXSize, nLines,
+                               abyBlue.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        if (err != CE_None)
+            return err;
+
+        const size_t nPixels = static_cast<size_t>(nXSize) * nLines;
+        const size_t nPixelsPerJob = DIV_ROUND_UP(nPixels, nThreads);
+        for (int iJob = 0; iJob < nThreads; ++iJob)
+        {
+            const auto Job = [&, iJob]()
+            {
+                JobState &sState = asJobStates[iJob];
+                T *panHistogram = sState.anHistogram.data();
+                const size_t nStart = iJob * nPixelsPerJob;
+                const size_t nEnd = std::min(nPixels, nStart + nPixelsPerJob);
+                for (size_t i = nStart; i < nEnd; ++i)
+                {
+                    const int nRed = abyRed[i] >> nColorShift;
+                    const int nGreen = abyGreen[i] >> nColorShift;
+                    const int nBlue = abyBlue[i] >> nColorShift;
+
+                    sState.rmin = std::min(sState.rmin, nRed);
+                    sState.gmin = std::min(sState.gmin, nGreen);
+                    sState.bmin = std::min(sState.bmin, nBlue);
+                    sState.rmax = std::max(sState.rmax, nRed);
+                    sState.gmax = std::max(sState.gmax, nGreen);
+                    sState.bmax = std::max(sState.bmax, nBlue);
+
+                    (*HISTOGRAM(panHistogram, nCLevels, nRed, nGreen,
+                                nBlue))++;
+                }
+            };
+            if (!poQueue || !poQueue->SubmitJob(Job))
+                Job();
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+    }
+
+    for (const auto &sJobState : asJobStates)
+    {
+        box->rmin = std::min(box->rmin, sJobState.rmin);
+        box->gmin = std::min(box->gmin, sJobState.gmin);
+        box->bmin = std::min(box->bmin, sJobState.bmin);
+        box->rmax = std::max(box->rmax, sJobState.rmax);
+        box->gmax = std::max(box->gmax, sJobState.gmax);
+        box->bmax = std::max(box->bmax, sJobState.bmax);
+        for (int i = 0; i < nCLevelsCube; ++i)
+            histogram[i] += sJobState.anHistogram[i];
+    }
+
+    return CE_None;
+}
+
 template <class T>
 int GDALComputeMedianCutPCTInternal(
     GDALRasterBandH hRed, GDALRasterBandH hGreen, GDALRasterBandH hBlue,
@@ -423,6 +571,19 @@ int GDALComputeMedianCutPCTInternal(
     GByte anGreen[256] = {};
     GByte anBlue[256] = {};
 
+    // The histogram can be collected in parallel into per-thread histograms
+    // when it is a small enough table (it is with the default 5 bits per
+    // component), and when the order in which colors are met does not matter.
+    int nHistogramThreads = 1;
+    if (histogram != nullptr && nColorShift != 0 &&
+        static_cast<size_t>(nCLevelsCube) * sizeof(T) <= 1024 * 1024)
+    {
+        // Not worth it for small images
+        constexpr int MIN_LINES_PER_THREAD = 32;
+        nHistogramThreads = std::min(GetAlgNumThreads(),
+                                     nYSize / MIN_LINES_PER_THREAD);
+    }
+
     GByte *pabyRedLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
     GByte *pabyGreenLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
     GByte *pabyBlueLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
@@ -434,64 +595,76 @@ int GDALComputeMedianCutPCTInternal(
         goto end_and_cleanup;
     }
 
-    for (int iLine = 0; iLine < nYSize; iLine++)
+    if (nHistogramThreads > 1)
     {
-        if (!pfnProgress(iLine / static_cast<double>(nYSize),
-                         "Generating Histogram", pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User Terminated");
-            err = CE_Failure;
-            goto end_and_cleanup;
-        }
-
-        err = GDALRasterIO(hRed, GF_Read, 0, iLine, nXSize, 1, pabyRedLine,
-                           nXSize, 1, GDT_Byte, 0, 0);
-        if (err == CE_None)
-            err = GDALRasterIO(hGreen, GF_Read, 0, iLine, nXSize, 1,
-                               pabyGreenLine, nXSize, 1, GDT_Byte, 0, 0);
-        if (err == CE_None)
-            err = GDALRasterIO(hBlue, GF_Read, 0, iLine, nXSize, 1,
-                               pabyBlueLine, nXSize, 1, GDT_Byte, 0, 0);
+        err = CollectHistogramMultiThreaded(
+            hRed, hGreen, hBlue, nXSize, nYSize, nColorShift, nCLevels,
+            histogram, usedboxes, nHistogramThreads, pfnProgress, pProgressArg);
         if (err != CE_None)
             goto end_and_cleanup;
+    }
 
-        for (int iPixel = 0; iPixel < nXSize; iPixel++)
+    else
+    {
+        for (int iLine = 0; iLine < nYSize; iLine++)
         {
-            const int nRed = pabyRedLine[iPixel] >> nColorShift;
-            const int nGreen = pabyGreenLine[iPixel] >> nColorShift;
-            const int nBlue = pabyBlueLine[iPixel] >> nColorShift;
-
-            usedboxes->rmin = std::min(usedboxes->rmin, nRed);
-            usedboxes->gmin = std::min(usedboxes->gmin, nGreen);
-            usedboxes->bmin = std::min(usedboxes->bmin, nBlue);
-            usedboxes->rmax = std::max(usedboxes->rmax, nRed);
-            usedboxes->gmax = std::max(usedboxes->gmax, nGreen);
-            usedboxes->bmax = std::max(usedboxes->bmax, nBlue);
-
-            bool bFirstOccurrence;
-            if (psHashHistogram)
-            {
-                int *pnColor = FindAndInsertColorCount(
-                    psHashHistogram, MAKE_COLOR_CODE(nRed, nGreen, nBlue));
-                bFirstOccurrence = (*pnColor == 0);
-                (*pnColor)++;
-            }
-            else
+            if (!pfnProgress(iLine / static_cast<double>(nYSize),
+                             "Generating Histogram", pProgressArg))
             {
-                T *pnColor =
-                    HISTOGRAM(histogram, nCLevels, nRed, nGreen, nBlue);
-                bFirstOccurrence = (*pnColor == 0);
-                (*pnColor)++;
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User Terminated");
+                err = CE_Failure;
+                goto end_and_cleanup;
             }
-            if (bFirstOccurrence)
+
+            err = GDALRasterIO(hRed, GF_Read, 0, iLine, nXSize, 1, pabyRedLine,
+                               nXSize, 1, GDT_Byte, 0, 0);
+            if (err == CE_None)
+                err = GDALRasterIO(hGreen, GF_Read, 0, iLine, nXSize, 1,
+                                   pabyGreenLine, nXSize, 1, GDT_Byte, 0, 0);
+            if (err == CE_None)
+                err = GDALRasterIO(hBlue, GF_Read, 0, iLine, nXSize, 1,
+                                   pabyBlueLine, nXSize, 1, GDT_Byte, 0, 0);
+            if (err != CE_None)
+                goto end_and_cleanup;
+
+            for (int iPixel = 0; iPixel < nXSize; iPixel++)
             {
-                if (nColorShift == 0 && nColorCounter < nColors)
+                const int nRed = pabyRedLine[iPixel] >> nColorShift;
+                const int nGreen = pabyGreenLine[iPixel] >> nColorShift;
+                const int nBlue = pabyBlueLine[iPixel] >> nColorShift;
+
+                usedboxes->rmin = std::min(usedboxes->rmin, nRed);
+                usedboxes->gmin = std::min(usedboxes->gmin, nGreen);
+                usedboxes->bmin = std::min(usedboxes->bmin, nBlue);
+                usedboxes->rmax = std::max(usedboxes->rmax, nRed);
+                usedboxes->gmax = std::max(usedboxes->gmax, nGreen);
+                usedboxes->bmax = std::max(usedboxes->bmax, nBlue);
+
+                bool bFirstOccurrence;
+                if (psHashHistogram)
+                {
+                    int *pnColor = FindAndInsertColorCount(
+                        psHashHistogram, MAKE_COLOR_CODE(nRed, nGreen, nBlue));
+                    bFirstOccurrence = (*pnColor == 0);
+                    (*pnColor)++;
+                }
+                else
                 {
-                    anRed[nColorCounter] = static_cast<GByte>(nRed);
-                    anGreen[nColorCounter] = static_cast<GByte>(nGreen);
-                    anBlue[nColorCounter] = static_cast<GByte>(nBlue);
+                    T *pnColor =
+                        HISTOGRAM(histogram, nCLevels, nRed, nGreen, nBlue);
+                    bFirstOccurrence = (*pnColor == 0);
+                    (*pnColor)++;
+                }
+                if (bFirstOccurrence)
+                {
+                    if (nColorShift == 0 && nColorCounter < nColors)
+                    {
+                        anRed[nColorCounter] = static_cast<GByte>(nRed);
+                        anGreen[nColorCounter] = static_cast<GByte>(nGreen);
+                        anBlue[nColorCounter] = static_cast<GByte>(nBlue);
+                    }
+                    nColorCounter++;
                 }
-                nColorCounter++;
             }
         }
     }
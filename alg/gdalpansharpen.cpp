@@ -23,6 +23,7 @@
 #include <cstring>
 #include <limits>
 #include <new>
+#include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -33,7 +34,13 @@
 #include "../frmts/vrt/vrtdataset.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
-// #include "gdalsse_priv.h"
+
+/* We restrict to 64bit processors because they are guaranteed to have SSE2 */
+/* Could possibly be used too on 32bit, but we would need to check at runtime */
+#if defined(__x86_64) || defined(_M_X64) || defined(USE_NEON_OPTIMIZATIONS)
+#define USE_SSE2
+#include "gdalsse_priv.h"
+#endif
 
 // Limit types to practical use cases.
 #define LIMIT_TYPES 1
@@ -507,6 +514,43 @@ GDALPansharpenOperation::Initialize(const GDALPansharpenOptions *psOptionsIn)
     return CE_None;
 }
 
+/************************************************************************/
+/*                         CallWithBandLayout()                         */
+/************************************************************************/
+
+// Call func() with the number of input and output bands as compile-time
+// constants, for the configurations that have specialized kernels, that is
+// when the output bands are the first input bands, in order. func() returns
+// the number of values it processed. 0 is returned for other configurations.
+template <class Func>
+static size_t CallWithBandLayout(const GDALPansharpenOptions *psOptions,
+                                 Func &&func)
+{
+    const auto IsLayout = [psOptions](int nInput, int nOutput)
+    {
+        if (psOptions->nInputSpectralBands != nInput ||
+            psOptions->nOutPansharpenedBands != nOutput)
+            return false;
+        for (int i = 0; i < nOutput; i++)
+        {
+            if (psOptions->panOutPansharpenedBands[i] != i)
+                return false;
+        }
+        return true;
+    };
+
+    if (IsLayout(3, 3))
+        return func(std::integral_constant<int, 3>(),
+                    std::integral_constant<int, 3>());
+    if (IsLayout(4, 4))
+        return func(std::integral_constant<int, 4>(),
+                    std::integral_constant<int, 4>());
+    if (IsLayout(4, 3))
+        return func(std::integral_constant<int, 4>(),
+                    std::integral_constant<int, 3>());
+    return 0;
+}
+
 /************************************************************************/
 /*                    WeightedBroveyWithNoData()                        */
 /************************************************************************/
@@ -527,7 +571,28 @@ void GDALPansharpenOperation::WeightedBroveyWithNoData(
     else
         validValue = noData - 1;
 
-    for (size_t j = 0; j < nValues; j++)
+    size_t j = 0;  // Used after for.
+#ifdef USE_SSE2
+    if constexpr (std::is_same_v<WorkDataType, OutDataType> &&
+                  (std::is_same_v<WorkDataType, GByte> ||
+                   std::is_same_v<WorkDataType, GUInt16> ||
+                   std::is_same_v<WorkDataType, float> ||
+                   std::is_same_v<WorkDataType, double>))
+    {
+        j = CallWithBandLayout(
+            psOptions,
+            [&](auto nInput, auto nOutput)
+            {
+                return WeightedBroveyWithNoDataInternal<
+                    WorkDataType, decltype(nInput)::value,
+                    decltype(nOutput)::value>(
+                    pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                    nBandValues, noData, validValue, nMaxValue);
+            });
+    }
+#endif
+
+    for (; j < nValues; j++)
     {
         double dfPseudoPanchro = 0.0;
         for (int i = 0; i < psOptions->nInputSpectralBands; i++)
@@ -611,7 +676,26 @@ void GDALPansharpenOperation::WeightedBrovey3(
         return;
     }
 
-    for (size_t j = 0; j < nValues; j++)
+    size_t j = 0;  // Used after for.
+#ifdef USE_SSE2
+    if constexpr (std::is_same_v<WorkDataType, OutDataType> &&
+                  (std::is_same_v<WorkDataType, float> ||
+                   std::is_same_v<WorkDataType, double>))
+    {
+        j = CallWithBandLayout(
+            psOptions,
+            [&](auto nInput, auto nOutput)
+            {
+                return WeightedBroveyFloatingPointInternal<
+                    WorkDataType, decltype(nInput)::value,
+                    decltype(nOutput)::value>(pPanBuffer,
+                                              pUpsampledSpectralBuffer,
+                                              pDataBuf, nValues, nBandValues);
+            });
+    }
+#endif
+
+    for (; j < nValues; j++)
     {
         double dfFactor = 0.0;
         // if( pPanBuffer[j] == 0 )
@@ -644,12 +728,7 @@ void GDALPansharpenOperation::WeightedBrovey3(
     }
 }
 
-/* We restrict to 64bit processors because they are guaranteed to have SSE2 */
-/* Could possibly be used too on 32bit, but we would need to check at runtime */
-#if defined(__x86_64) || defined(_M_X64) || defined(USE_NEON_OPTIMIZATIONS)
-
-#define USE_SSE2
-#include "gdalsse_priv.h"
+#ifdef USE_SSE2
 
 template <class T, int NINPUT, int NOUTPUT>
 size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
@@ -722,6 +801,136 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
     return j;
 }
 
+// Same as WeightedBroveyWithNoData(), on 4 values at a time, for integer and
+// floating-point types.
+template <class T, int NINPUT, int NOUTPUT>
+size_t GDALPansharpenOperation::WeightedBroveyWithNoDataInternal(
+    const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
+    size_t nValues, size_t nBandValues, T noData, T validValue,
+    T nMaxValue) const
+{
+    static_assert(NINPUT == 3 || NINPUT == 4);
+    static_assert(NOUTPUT == 3 || NOUTPUT == 4);
+    constexpr bool bIsInteger = std::numeric_limits<T>::is_integer;
+
+    XMMReg4Double w[NINPUT];
+    for (int i = 0; i < NINPUT; i++)
+        w[i] = XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + i);
+
+    const XMMReg4Double zero = XMMReg4Double::Zero();
+    const XMMReg4Double allOnes = XMMReg4Double::Equals(zero, zero);
+    const XMMReg4Double noDataReg =
+        XMMReg4Double::Set1(static_cast<double>(noData));
+    const XMMReg4Double validValueReg =
+        XMMReg4Double::Set1(static_cast<double>(validValue));
+    // For integer types, values in [noData - 0.5, noData + 0.5[ are rounded
+    // to noData.
+    const XMMReg4Double noDataLow = XMMReg4Double::Set1(noData - 0.5);
+    const XMMReg4Double noDataHigh = XMMReg4Double::Set1(noData + 0.5);
+    const XMMReg4Double maxValue = XMMReg4Double::Set1(
+        bIsInteger && nMaxValue == 0
+            ? static_cast<double>(cpl::NumericLimits<T>::max())
+            : static_cast<double>(nMaxValue));
+
+    size_t j = 0;  // Used after for.
+    for (; j + 3 < nValues; j += 4)
+    {
+        XMMReg4Double val[NINPUT];
+        for (int i = 0; i < NINPUT; i++)
+        {
+            val[i] = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                             i * nBandValues + j);
+        }
+
+        XMMReg4Double pseudoPanchro = zero;
+        for (int i = 0; i < NINPUT; i++)
+            pseudoPanchro += w[i] * val[i];
+        for (int i = 0; i < NINPUT; i++)
+        {
+            pseudoPanchro = XMMReg4Double::Ternary(
+                XMMReg4Double::Equals(val[i], noDataReg), zero, pseudoPanchro);
+        }
+
+        const XMMReg4Double pan = XMMReg4Double::Load4Val(pPanBuffer + j);
+        const XMMReg4Double isNoData = XMMReg4Double::Ternary(
+            XMMReg4Double::Equals(pan, noDataReg), allOnes,
+            XMMReg4Double::Equals(pseudoPanchro, zero));
+        const XMMReg4Double factor = pan / pseudoPanchro;
+
+        for (int i = 0; i < NOUTPUT; i++)
+        {
+            T *pOut = pDataBuf + i * nBandValues + j;
+            XMMReg4Double res = val[i] * factor;
+            if constexpr (bIsInteger)
+            {
+                res = XMMReg4Double::Ternary(
+                    XMMReg4Double::Greater(zero, res), zero,
+                    XMMReg4Double::Min(res, maxValue));
+                res = XMMReg4Double::Ternary(
+                    XMMReg4Double::Greater(noDataLow, res), res,
+                    XMMReg4Double::Ternary(
+                        XMMReg4Double::Greater(noDataHigh, res), validValueReg,
+                        res));
+            }
+            else
+            {
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    // Compare with nodata after conversion to float
+                    res.Store4Val(pOut);
+                    res = XMMReg4Double::Load4Val(pOut);
+                }
+                res = XMMReg4Double::Ternary(
+                    XMMReg4Double::Equals(res, noDataReg), validValueReg, res);
+            }
+            XMMReg4Double::Ternary(isNoData, noDataReg, res).Store4Val(pOut);
+        }
+    }
+    return j;
+}
+
+// Same as WeightedBrovey3() without bit depth, on 4 values at a time, for
+// floating-point types.
+template <class T, int NINPUT, int NOUTPUT>
+size_t GDALPansharpenOperation::WeightedBroveyFloatingPointInternal(
+    const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
+    size_t nValues, size_t nBandValues) const
+{
+    static_assert(NINPUT == 3 || NINPUT == 4);
+    static_assert(NOUTPUT == 3 || NOUTPUT == 4);
+
+    XMMReg4Double w[NINPUT];
+    for (int i = 0; i < NINPUT; i++)
+        w[i] = XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + i);
+
+    const XMMReg4Double zero = XMMReg4Double::Zero();
+
+    size_t j = 0;  // Used after for.
+    for (; j + 3 < nValues; j += 4)
+    {
+        XMMReg4Double val[NINPUT];
+        for (int i = 0; i < NINPUT; i++)
+        {
+            val[i] = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                             i * nBandValues + j);
+        }
+
+        XMMReg4Double pseudoPanchro = zero;
+        for (int i = 0; i < NINPUT; i++)
+            pseudoPanchro += w[i] * val[i];
+
+        // Unlike the And() trick of the integer case, this keeps NaN
+        // factors, as ComputeFactor() does.
+        const XMMReg4Double factor = XMMReg4Double::Ternary(
+            XMMReg4Double::Equals(pseudoPanchro, zero), zero,
+            XMMReg4Double::Load4Val(pPanBuffer + j) / pseudoPanchro);
+
+        for (int i = 0; i < NOUTPUT; i++)
+            (val[i] * factor).Store4Val(pDataBuf + i * nBandValues + j);
+    }
+    return j;
+}
+
 #else
 
 template <class T, int NINPUT, int NOUTPUT>
@@ -797,41 +1006,18 @@ void GDALPansharpenOperation::WeightedBroveyPositiveWeights(
 
     if (nMaxValue == 0)
         nMaxValue = cpl::NumericLimits<T>::max();
-    size_t j;
-    if (psOptions->nInputSpectralBands == 3 &&
-        psOptions->nOutPansharpenedBands == 3 &&
-        psOptions->panOutPansharpenedBands[0] == 0 &&
-        psOptions->panOutPansharpenedBands[1] == 1 &&
-        psOptions->panOutPansharpenedBands[2] == 2)
-    {
-        j = WeightedBroveyPositiveWeightsInternal<T, 3, 3>(
-            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
-            nBandValues, nMaxValue);
-    }
-    else if (psOptions->nInputSpectralBands == 4 &&
-             psOptions->nOutPansharpenedBands == 4 &&
-             psOptions->panOutPansharpenedBands[0] == 0 &&
-             psOptions->panOutPansharpenedBands[1] == 1 &&
-             psOptions->panOutPansharpenedBands[2] == 2 &&
-             psOptions->panOutPansharpenedBands[3] == 3)
-    {
-        j = WeightedBroveyPositiveWeightsInternal<T, 4, 4>(
-            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
-            nBandValues, nMaxValue);
-    }
-    else if (psOptions->nInputSpectralBands == 4 &&
-             psOptions->nOutPansharpenedBands == 3 &&
-             psOptions->panOutPansharpenedBands[0] == 0 &&
-             psOptions->panOutPansharpenedBands[1] == 1 &&
-             psOptions->panOutPansharpenedBands[2] == 2)
-    {
-        j = WeightedBroveyPositiveWeightsInternal<T, 4, 3>(
-            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
-            nBandValues, nMaxValue);
-    }
-    else
+    size_t j = CallWithBandLayout(
+        psOptions,
+        [&](auto nInput, auto nOutput)
+        {
+            return WeightedBroveyPositiveWeightsInternal<
+                T, decltype(nInput)::value, decltype(nOutput)::value>(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues, nMaxValue);
+        });
+    if (j == 0)
     {
-        for (j = 0; j + 1 < nValues; j += 2)
+        for (; j + 1 < nValues; j += 2)
         {
             double dfFactor = 0.0;
             double dfFactor2 = 0.0;
@@ -1236,6 +1422,15 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
     if (nSpectralYSize == 0)
         nSpectralYSize = 1;
 
+    // When the multispectral bands are at the resolution of the panchromatic
+    // band and aligned on its pixel grid, they are read directly in the
+    // buffer used by the pansharpening kernels, without any resampling.
+    const bool bSameGrid =
+        m_panToMSGT[1] == 1.0 && m_panToMSGT[5] == 1.0 &&
+        sExtraArg.dfXOff == nSpectralXOff &&
+        sExtraArg.dfYOff == nSpectralYOff && nSpectralXSize == nXSize &&
+        nSpectralYSize == nYSize;
+
     // When upsampling, extract the multispectral data at
     // full resolution in a temp buffer, and then do the upsampling.
     if (nSpectralXSize < nXSize && nSpectralYSize < nYSize &&
@@ -1452,6 +1647,7 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
     }
     else
     {
+        GDALRasterIOExtraArg *psExtraArg = bSameGrid ? nullptr : &sExtraArg;
         if (!anInputBands.empty())
         {
             // Use dataset RasterIO when possible.
@@ -1459,7 +1655,7 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
                 GF_Read, nSpectralXOff, nSpectralYOff, nSpectralXSize,
                 nSpectralYSize, pUpsampledSpectralBuffer, nXSize, nYSize,
                 eWorkDataType, static_cast<int>(anInputBands.size()),
-                &anInputBands[0], 0, 0, 0, &sExtraArg);
+                &anInputBands[0], 0, 0, 0, psExtraArg);
         }
         else
         {
@@ -1471,7 +1667,7 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
                     nSpectralYSize,
                     pUpsampledSpectralBuffer + static_cast<size_t>(i) * nXSize *
                                                    nYSize * nDataTypeSize,
-                    nXSize, nYSize, eWorkDataType, 0, 0, &sExtraArg);
+                    nXSize, nYSize, eWorkDataType, 0, 0, psExtraArg);
             }
         }
         if (eErr != CE_None)
@@ -1485,7 +1681,7 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
     // In case NBITS was not set on the spectral bands, clamp the values
     // if overshoot might have occurred.
     int nBitDepth = psOptions->nBitDepth;
-    if (nBitDepth &&
+    if (nBitDepth && !bSameGrid &&
         (eResampleAlg == GRIORA_Cubic || eResampleAlg == GRIORA_CubicSpline ||
          eResampleAlg == GRIORA_Lanczos))
     {
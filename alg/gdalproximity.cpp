@@ -18,6 +18,9 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -25,6 +28,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -33,6 +37,273 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+/************************************************************************/
+/*                    ComputeRowDistanceTransform()                     */
+/************************************************************************/
+
+/** Second pass of the exact Euclidean distance transform of Meijster et
+ * al. / Felzenszwalb et al.: given for each pixel of a row the distance to
+ * the nearest target pixel in its column (or -1 if there is none), compute
+ * the square of the distance to the nearest target pixel, as the lower
+ * envelope of the parabolas rooted at each column.
+ *
+ * padfSqDist[i] is set to -1 if there is no target pixel at all.
+ */
+static void ComputeRowDistanceTransform(const GInt32 *panColDist, int nXSize,
+                                        double *padfSqDist, int *panV,
+                                        double *padfZ)
+{
+    // panV[] are the columns of the parabolas of the lower envelope, and
+    // padfZ[k] the abscissa from which parabola k is the lowest one.
+    int k = -1;
+    for (int q = 0; q < nXSize; ++q)
+    {
+        if (panColDist[q] < 0)
+            continue;
+        const double dfFq =
+            static_cast<double>(panColDist[q]) * panColDist[q] +
+            static_cast<double>(q) * q;
+        double dfS = -std::numeric_limits<double>::infinity();
+        while (k >= 0)
+        {
+            const int v = panV[k];
+            const double dfFv =
+                static_cast<double>(panColDist[v]) * panColDist[v] +
+                static_cast<double>(v) * v;
+            dfS = (dfFq - dfFv) / (2.0 * (q - v));
+            if (dfS > padfZ[k])
+                break;
+            --k;
+            dfS = -std::numeric_limits<double>::infinity();
+        }
+        ++k;
+        panV[k] = q;
+        padfZ[k] = dfS;
+    }
+
+    if (k < 0)
+    {
+        std::fill(padfSqDist, padfSqDist + nXSize, -1.0);
+        return;
+    }
+
+    int j = 0;
+    for (int x = 0; x < nXSize; ++x)
+    {
+        while (j < k && padfZ[j + 1] < x)
+            ++j;
+        const int v = panV[j];
+        const double dfDX = x - v;
+        padfSqDist[x] = dfDX * dfDX +
+                        static_cast<double>(panColDist[v]) * panColDist[v];
+    }
+}
+
+/************************************************************************/
+/*                     GDALComputeProximityExact()                      */
+/************************************************************************/
+
+/** Exact Euclidean proximity computation, in two passes over the raster.
+ *
+ * The first pass, from top to bottom, stores in hWorkProximityBand the
+ * distance of each pixel to the nearest target pixel above it in its column.
+ * The second pass, from bottom to top, combines it with the distance to the
+ * nearest target pixel below, and computes the distance transform of each
+ * row. Both passes work on strips of lines, and the rows of a strip are
+ * processed in parallel in the second pass.
+ */
+static CPLErr GDALComputeProximityExact(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hWorkProximityBand,
+    GDALRasterBandH hProximityBand, int nXSize, int nYSize, double dfMaxDist,
+    double dfDistMult, const double *pdfSrcNoData, float fNoDataValue,
+    bool bFixedBufVal, double dfFixedBufVal, int nTargetValues,
+    const int *panTargetValues, int nNumThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const auto IsTarget = [nTargetValues, panTargetValues](GInt32 nVal)
+    {
+        if (nTargetValues == 0)
+            return nVal != 0;
+        for (int i = 0; i < nTargetValues; i++)
+        {
+            if (nVal == panTargetValues[i])
+                return true;
+        }
+        return false;
+    };
+
+    constexpr int STRIP_PIXELS = 4 * 1024 * 1024;
+    const int nStripLines =
+        std::max(1, std::min(nYSize, STRIP_PIXELS / nXSize));
+    const size_t nStripSize = static_cast<size_t>(nStripLines) * nXSize;
+
+    std::vector<GInt32> anSrc;
+    std::vector<GInt32> anColDist;
+    std::vector<float> afProximity;
+    std::vector<GInt32> anNearest;
+    try
+    {
+        anSrc.resize(nStripSize);
+        anColDist.resize(nStripSize);
+        afProximity.resize(nStripSize);
+        anNearest.resize(nXSize, -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffers");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: distance to the nearest target pixel above.         */
+    /*      anNearest[] is the line of the last target pixel of each        */
+    /*      column.                                                         */
+    /* -------------------------------------------------------------------- */
+    for (int iStripLine = 0; iStripLine < nYSize; iStripLine += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iStripLine);
+        if (GDALRasterIO(hSrcBand, GF_Read, 0, iStripLine, nXSize, nLines,
+                         anSrc.data(), nXSize, nLines, GDT_Int32, 0,
+                         0) != CE_None)
+            return CE_Failure;
+
+        for (int iLine = 0; iLine < nLines; ++iLine)
+        {
+            const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+            for (int i = 0; i < nXSize; ++i)
+            {
+                if (IsTarget(anSrc[nOffset + i]))
+                    anNearest[i] = iStripLine + iLine;
+                anColDist[nOffset + i] =
+                    anNearest[i] < 0 ? -1 : iStripLine + iLine - anNearest[i];
+            }
+        }
+
+        if (GDALRasterIO(hWorkProximityBand, GF_Write, 0, iStripLine, nXSize,
+                         nLines, anColDist.data(), nXSize, nLines, GDT_Int32,
+                         0, 0) != CE_None)
+            return CE_Failure;
+
+        if (!pfnProgress(0.25 * (iStripLine + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass, from bottom to top.                                */
+    /* -------------------------------------------------------------------- */
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nStripLines));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("GDAL",
+             "Computing exact proximity by strips of %d lines with %d "
+             "threads",
+             nStripLines, poQueue ? nThreads : 1);
+
+    const double dfMaxDistSq = dfMaxDist * dfMaxDist;
+    std::fill(anNearest.begin(), anNearest.end(), -1);
+    for (int iStripEnd = nYSize; iStripEnd > 0; iStripEnd -= nStripLines)
+    {
+        const int iStripLine = std::max(0, iStripEnd - nStripLines);
+        const int nLines = iStripEnd - iStripLine;
+        if (GDALRasterIO(hSrcBand, GF_Read, 0, iStripLine, nXSize, nLines,
+                         anSrc.data(), nXSize, nLines, GDT_Int32, 0,
+                         0) != CE_None ||
+            GDALRasterIO(hWorkProximityBand, GF_Read, 0, iStripLine, nXSize,
+                         nLines, anColDist.data(), nXSize, nLines, GDT_Int32,
+                         0, 0) != CE_None)
+            return CE_Failure;
+
+        // anNearest[] is now the line of the next target pixel of each
+        // column.
+        for (int iLine = nLines - 1; iLine >= 0; --iLine)
+        {
+            const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+            for (int i = 0; i < nXSize; ++i)
+            {
+                if (IsTarget(anSrc[nOffset + i]))
+                    anNearest[i] = iStripLine + iLine;
+                if (anNearest[i] >= 0)
+                {
+                    const GInt32 nBelow = anNearest[i] - (iStripLine + iLine);
+                    GInt32 &nColDist = anColDist[nOffset + i];
+                    if (nColDist < 0 || nBelow < nColDist)
+                        nColDist = nBelow;
+                }
+            }
+        }
+
+        std::atomic<int> nNextLine{0};
+        const auto Job = [&]()
+        {
+            std::vector<double> adfSqDist(nXSize);
+            std::vector<int> anV(nXSize);
+            std::vector<double> adfZ(nXSize);
+            while (true)
+            {
+                const int iLine = nNextLine++;
+                if (iLine >= nLines)
+                    break;
+                const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+                ComputeRowDistanceTransform(anColDist.data() + nOffset,
+                                            nXSize, adfSqDist.data(),
+                                            anV.data(), adfZ.data());
+                for (int i = 0; i < nXSize; ++i)
+                {
+                    const double dfSqDist = adfSqDist[i];
+                    float &fProximity = afProximity[nOffset + i];
+                    if (dfSqDist == 0)
+                        fProximity = 0.0f;
+                    else if (dfSqDist < 0 || dfSqDist > dfMaxDistSq ||
+                             (pdfSrcNoData &&
+                              anSrc[nOffset + i] == *pdfSrcNoData))
+                        fProximity = fNoDataValue;
+                    else if (bFixedBufVal)
+                        fProximity = static_cast<float>(dfFixedBufVal);
+                    else
+                        fProximity =
+                            static_cast<float>(sqrt(dfSqDist) * dfDistMult);
+                }
+            }
+        };
+
+        if (poQueue)
+        {
+            for (int i = 0; i < nThreads; ++i)
+            {
+                if (!poQueue->SubmitJob(Job))
+                    Job();
+            }
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            Job();
+        }
+
+        if (GDALRasterIO(hProximityBand, GF_Write, 0, iStripLine, nXSize,
+                         nLines, afProximity.data(), nXSize, nLines,
+                         GDT_Float32, 0, 0) != CE_None)
+            return CE_Failure;
+
+        if (!pfnProgress(0.25 + 0.75 * (nYSize - iStripLine) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -89,6 +360,19 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[SCANLINE]/EXACT
+
+(GDAL >= 3.12) With SCANLINE, the default, the nearest target pixel is
+propagated from neighbouring pixels in two scanline passes, which may not
+always find the nearest one. With EXACT, an exact Euclidean distance
+transform (Meijster et al.) is computed by strips of lines, whose cost does
+not depend on MAXDIST.
+
+  NUM_THREADS=n|ALL_CPUS
+
+(GDAL >= 3.12) Number of threads used to process the lines of a strip with
+ALGORITHM=EXACT. Defaults to the GDAL_NUM_THREADS configuration option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -225,6 +509,34 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         CSLDestroy(papszValuesTokens);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm?                                                */
+    /* -------------------------------------------------------------------- */
+    bool bExact = false;
+    pszOpt = CSLFetchNameValue(papszOptions, "ALGORITHM");
+    if (pszOpt)
+    {
+        if (EQUAL(pszOpt, "EXACT"))
+        {
+            bExact = true;
+        }
+        else if (!EQUAL(pszOpt, "SCANLINE"))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized ALGORITHM value '%s', should be SCANLINE "
+                     "or EXACT.",
+                     pszOpt);
+            CPLFree(panTargetValues);
+            return CE_Failure;
+        }
+    }
+
+    pszOpt = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (!pszOpt)
+        pszOpt = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nNumThreads =
+        std::max(1, EQUAL(pszOpt, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszOpt));
+
     /* -------------------------------------------------------------------- */
     /*      Initialize progress counter.                                    */
     /* -------------------------------------------------------------------- */
@@ -252,8 +564,12 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     GInt32 *panSrcScanline = nullptr;
     bool bTempFileAlreadyDeleted = false;
 
-    if (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+    // The exact algorithm stores integer distances along columns in the
+    // working band.
+    if (bExact ? !(eProxType == GDT_Int32 || eProxType == GDT_Float32 ||
+                   eProxType == GDT_Float64)
+               : (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
+                  eProxType == GDT_UInt32))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
@@ -278,6 +594,16 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         hWorkProximityBand = GDALGetRasterBand(hWorkProximityDS, 1);
     }
 
+    if (bExact)
+    {
+        eErr = GDALComputeProximityExact(
+            hSrcBand, hWorkProximityBand, hProximityBand, nXSize, nYSize,
+            dfMaxDist, dfDistMult, pdfSrcNoData, fNoDataValue, bFixedBufVal,
+            dfFixedBufVal, nTargetValues, panTargetValues, nNumThreads,
+            pfnProgress, pProgressArg);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate buffer for two scanlines of distances as floats        */
     /*      (the current and last line).                                    */
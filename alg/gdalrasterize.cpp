@@ -15,23 +15,29 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 
+#include <atomic>
 #include <climits>
+#include <cmath>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
 #include <limits>
+#include <mutex>
 #include <vector>
 #include <algorithm>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -537,67 +543,24 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
     }
 }
 
-/************************************************************************
- *                       gv_rasterize_one_shape()
- *
- * @param pabyChunkBuf buffer to which values will be burned
- * @param nXOff chunk column offset from left edge of raster
- * @param nYOff chunk scanline offset from top of raster
- * @param nXSize number of columns in chunk
- * @param nYSize number of rows in chunk
- * @param nBands number of bands in chunk
- * @param eType data type of pabyChunkBuf
- * @param nPixelSpace number of bytes between adjacent pixels in chunk
- *                    (0 to calculate automatically)
- * @param nLineSpace number of bytes between adjacent scanlines in chunk
- *                   (0 to calculate automatically)
- * @param nBandSpace number of bytes between adjacent bands in chunk
- *                   (0 to calculate automatically)
- * @param bAllTouched burn value to all touched pixels?
- * @param poShape geometry to rasterize, in original coordinates
- * @param eBurnValueType type of value to be burned (must be Float64 or Int64)
- * @param padfBurnValues array of nBands values to burn (Float64), or nullptr
- * @param panBurnValues array of nBands values to burn (Int64), or nullptr
- * @param eBurnValueSrc whether to burn values from padfBurnValues /
- *                      panBurnValues, or from the Z or M values of poShape
- * @param eMergeAlg whether the burn value should replace or be added to the
- *                  existing values
- * @param pfnTransformer transformer from CRS of geometry to pixel/line
- *                       coordinates of raster
- * @param pTransformArg arguments to pass to pfnTransformer
- ************************************************************************/
-static void gv_rasterize_one_shape(
-    unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
-    int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
-    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
+/************************************************************************/
+/*                        gv_rasterize_points()                         */
+/*                                                                      */
+/*      Burns a shape whose rings have been collected by                */
+/*      GDALCollectRingsFromGeometry(), and whose points are in the     */
+/*      pixel/line coordinates of the chunk.                            */
+/************************************************************************/
+
+static void gv_rasterize_points(
+    unsigned char *pabyChunkBuf, int nXSize, int nYSize, int nBands,
+    GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, int bAllTouched, OGRwkbGeometryType eGeomType,
+    std::vector<double> &aPointX, std::vector<double> &aPointY,
+    std::vector<double> &aPointVariant, const std::vector<int> &aPartSize,
     GDALDataType eBurnValueType, const double *padfBurnValues,
     const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
-    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
-    void *pTransformArg)
-
+    GDALRasterMergeAlg eMergeAlg)
 {
-    if (poShape == nullptr || poShape->IsEmpty())
-        return;
-    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
-
-    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
-         eGeomType == wkbGeometryCollection) &&
-        eMergeAlg == GRMA_Replace)
-    {
-        // Speed optimization: in replace mode, we can rasterize each part of
-        // a geometry collection separately.
-        const auto poGC = poShape->toGeometryCollection();
-        for (const auto poPart : *poGC)
-        {
-            gv_rasterize_one_shape(
-                pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
-                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
-                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
-                eMergeAlg, pfnTransformer, pTransformArg);
-        }
-        return;
-    }
-
     if (nPixelSpace == 0)
     {
         nPixelSpace = GDALGetDataTypeSizeBytes(eType);
@@ -634,43 +597,6 @@ static void gv_rasterize_one_shape(
     sInfo.bFillSetVisitedPoints = false;
     sInfo.poSetVisitedPoints = nullptr;
 
-    /* -------------------------------------------------------------------- */
-    /*      Transform polygon geometries into a set of rings and a part     */
-    /*      size list.                                                      */
-    /* -------------------------------------------------------------------- */
-    std::vector<double>
-        aPointX;  // coordinate X values from all rings/components
-    std::vector<double>
-        aPointY;  // coordinate Y values from all rings/components
-    std::vector<double> aPointVariant;  // coordinate Z values
-    std::vector<int> aPartSize;  // number of X/Y/(Z) values associated with
-                                 // each ring/component
-
-    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
-                                 aPartSize, eBurnValueSrc);
-
-    /* -------------------------------------------------------------------- */
-    /*      Transform points if needed.                                     */
-    /* -------------------------------------------------------------------- */
-    if (pfnTransformer != nullptr)
-    {
-        int *panSuccess =
-            static_cast<int *>(CPLCalloc(sizeof(int), aPointX.size()));
-
-        // TODO: We need to add all appropriate error checking at some point.
-        pfnTransformer(pTransformArg, FALSE, static_cast<int>(aPointX.size()),
-                       aPointX.data(), aPointY.data(), nullptr, panSuccess);
-        CPLFree(panSuccess);
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Shift to account for the buffer offset of this buffer.          */
-    /* -------------------------------------------------------------------- */
-    for (unsigned int i = 0; i < aPointX.size(); i++)
-        aPointX[i] -= nXOff;
-    for (unsigned int i = 0; i < aPointY.size(); i++)
-        aPointY[i] -= nYOff;
-
     /* -------------------------------------------------------------------- */
     /*      Perform the rasterization.                                      */
     /*      According to the C++ Standard/23.2.4, elements of a vector are  */
@@ -764,6 +690,111 @@ static void gv_rasterize_one_shape(
     delete sInfo.poSetVisitedPoints;
 }
 
+/************************************************************************
+ *                       gv_rasterize_one_shape()
+ *
+ * @param pabyChunkBuf buffer to which values will be burned
+ * @param nXOff chunk column offset from left edge of raster
+ * @param nYOff chunk scanline offset from top of raster
+ * @param nXSize number of columns in chunk
+ * @param nYSize number of rows in chunk
+ * @param nBands number of bands in chunk
+ * @param eType data type of pabyChunkBuf
+ * @param nPixelSpace number of bytes between adjacent pixels in chunk
+ *                    (0 to calculate automatically)
+ * @param nLineSpace number of bytes between adjacent scanlines in chunk
+ *                   (0 to calculate automatically)
+ * @param nBandSpace number of bytes between adjacent bands in chunk
+ *                   (0 to calculate automatically)
+ * @param bAllTouched burn value to all touched pixels?
+ * @param poShape geometry to rasterize, in original coordinates
+ * @param eBurnValueType type of value to be burned (must be Float64 or Int64)
+ * @param padfBurnValues array of nBands values to burn (Float64), or nullptr
+ * @param panBurnValues array of nBands values to burn (Int64), or nullptr
+ * @param eBurnValueSrc whether to burn values from padfBurnValues /
+ *                      panBurnValues, or from the Z or M values of poShape
+ * @param eMergeAlg whether the burn value should replace or be added to the
+ *                  existing values
+ * @param pfnTransformer transformer from CRS of geometry to pixel/line
+ *                       coordinates of raster
+ * @param pTransformArg arguments to pass to pfnTransformer
+ ************************************************************************/
+static void gv_rasterize_one_shape(
+    unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
+    GDALDataType eBurnValueType, const double *padfBurnValues,
+    const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg)
+
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        // Speed optimization: in replace mode, we can rasterize each part of
+        // a geometry collection separately.
+        const auto poGC = poShape->toGeometryCollection();
+        for (const auto poPart : *poGC)
+        {
+            gv_rasterize_one_shape(
+                pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
+                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
+                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
+                eMergeAlg, pfnTransformer, pTransformArg);
+        }
+        return;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform polygon geometries into a set of rings and a part     */
+    /*      size list.                                                      */
+    /* -------------------------------------------------------------------- */
+    std::vector<double>
+        aPointX;  // coordinate X values from all rings/components
+    std::vector<double>
+        aPointY;  // coordinate Y values from all rings/components
+    std::vector<double> aPointVariant;  // coordinate Z values
+    std::vector<int> aPartSize;  // number of X/Y/(Z) values associated with
+                                 // each ring/component
+
+    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
+                                 aPartSize, eBurnValueSrc);
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform points if needed.                                     */
+    /* -------------------------------------------------------------------- */
+    if (pfnTransformer != nullptr)
+    {
+        int *panSuccess =
+            static_cast<int *>(CPLCalloc(sizeof(int), aPointX.size()));
+
+        // TODO: We need to add all appropriate error checking at some point.
+        pfnTransformer(pTransformArg, FALSE, static_cast<int>(aPointX.size()),
+                       aPointX.data(), aPointY.data(), nullptr, panSuccess);
+        CPLFree(panSuccess);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Shift to account for the buffer offset of this buffer.          */
+    /* -------------------------------------------------------------------- */
+    for (unsigned int i = 0; i < aPointX.size(); i++)
+        aPointX[i] -= nXOff;
+    for (unsigned int i = 0; i < aPointY.size(); i++)
+        aPointY[i] -= nYOff;
+
+    gv_rasterize_points(pabyChunkBuf, nXSize, nYSize, nBands, eType,
+                        nPixelSpace, nLineSpace, nBandSpace, bAllTouched,
+                        eGeomType, aPointX, aPointY, aPointVariant, aPartSize,
+                        eBurnValueType, padfBurnValues, panBurnValues,
+                        eBurnValueSrc, eMergeAlg);
+}
+
 /************************************************************************/
 /*                        GDALRasterizeOptions()                        */
 /*                                                                      */
@@ -1461,6 +1492,455 @@ static CPLErr GDALRasterizeGeometriesInternal(
     return eErr;
 }
 
+/************************************************************************/
+/*                GDALRasterizeCreateLayerTransformer()                 */
+/************************************************************************/
+
+/** Create a transformer from the CRS of the layer to the pixel/line
+ * coordinates of the dataset. Note that each layer can be georeferenced
+ * separately.
+ */
+static void *GDALRasterizeCreateLayerTransformer(GDALDataset *poDS,
+                                                 OGRLayer *poLayer)
+{
+    char *pszProjection = nullptr;
+
+    OGRSpatialReference *poSRS = poLayer->GetSpatialRef();
+    if (!poSRS)
+    {
+        if (poDS->GetSpatialRef() != nullptr ||
+            poDS->GetGCPSpatialRef() != nullptr ||
+            poDS->GetMetadata("RPC") != nullptr)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Failed to fetch spatial reference on layer %s "
+                     "to build transformer, assuming matching coordinate "
+                     "systems.",
+                     poLayer->GetLayerDefn()->GetName());
+        }
+    }
+    else
+    {
+        poSRS->exportToWkt(&pszProjection);
+    }
+
+    char **papszTransformerOptions = nullptr;
+    if (pszProjection != nullptr)
+        papszTransformerOptions = CSLSetNameValue(papszTransformerOptions,
+                                                  "SRC_SRS", pszProjection);
+    GDALGeoTransform gt;
+    if (poDS->GetGeoTransform(gt) != CE_None && poDS->GetGCPCount() == 0 &&
+        poDS->GetMetadata("RPC") == nullptr)
+    {
+        papszTransformerOptions = CSLSetNameValue(
+            papszTransformerOptions, "DST_METHOD", "NO_GEOTRANSFORM");
+    }
+
+    void *pTransformArg = GDALCreateGenImgProjTransformer2(
+        nullptr, GDALDataset::ToHandle(poDS), papszTransformerOptions);
+
+    CPLFree(pszProjection);
+    CSLDestroy(papszTransformerOptions);
+    return pTransformArg;
+}
+
+namespace
+{
+/** Geometry prepared for GDALRasterizeLayersTiled(): its rings in pixel/line
+ * coordinates of the raster, and the values to burn.
+ */
+struct GDALRasterizePreparedShape
+{
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    std::vector<double> adfX{};
+    std::vector<double> adfY{};
+    std::vector<double> adfVariant{};
+    std::vector<int> anPartSize{};
+    std::vector<double> adfBurnValues{};
+    double dfMinX = std::numeric_limits<double>::infinity();
+    double dfMinY = std::numeric_limits<double>::infinity();
+    double dfMaxX = -std::numeric_limits<double>::infinity();
+    double dfMaxY = -std::numeric_limits<double>::infinity();
+};
+}  // namespace
+
+/************************************************************************/
+/*                     GDALRasterizePrepareShape()                      */
+/************************************************************************/
+
+/** Collect the rings of poShape, transformed into pixel/line coordinates,
+ * into aoShapes, splitting it the same way as gv_rasterize_one_shape().
+ */
+static void GDALRasterizePrepareShape(
+    const OGRGeometry *poShape, const double *padfBurnValues, int nBands,
+    GDALBurnValueSrc eBurnValueSrc, GDALRasterMergeAlg eMergeAlg,
+    GDALTransformerFunc pfnTransformer, void *pTransformArg,
+    std::vector<GDALRasterizePreparedShape> &aoShapes)
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        for (const auto poPart : *(poShape->toGeometryCollection()))
+        {
+            GDALRasterizePrepareShape(poPart, padfBurnValues, nBands,
+                                      eBurnValueSrc, eMergeAlg, pfnTransformer,
+                                      pTransformArg, aoShapes);
+        }
+        return;
+    }
+
+    GDALRasterizePreparedShape oShape;
+    oShape.eGeomType = eGeomType;
+    GDALCollectRingsFromGeometry(poShape, oShape.adfX, oShape.adfY,
+                                 oShape.adfVariant, oShape.anPartSize,
+                                 eBurnValueSrc);
+    if (oShape.adfX.empty())
+        return;
+
+    std::vector<int> anSuccess(oShape.adfX.size());
+    pfnTransformer(pTransformArg, FALSE, static_cast<int>(oShape.adfX.size()),
+                   oShape.adfX.data(), oShape.adfY.data(), nullptr,
+                   anSuccess.data());
+
+    for (size_t i = 0; i < oShape.adfX.size(); ++i)
+    {
+        const double dfX = oShape.adfX[i];
+        const double dfY = oShape.adfY[i];
+        if (!std::isnan(dfX) && !std::isnan(dfY))
+        {
+            oShape.dfMinX = std::min(oShape.dfMinX, dfX);
+            oShape.dfMinY = std::min(oShape.dfMinY, dfY);
+            oShape.dfMaxX = std::max(oShape.dfMaxX, dfX);
+            oShape.dfMaxY = std::max(oShape.dfMaxY, dfY);
+        }
+    }
+    if (!(oShape.dfMinX <= oShape.dfMaxX && oShape.dfMinY <= oShape.dfMaxY))
+        return;
+
+    oShape.adfBurnValues.assign(padfBurnValues, padfBurnValues + nBands);
+    aoShapes.push_back(std::move(oShape));
+}
+
+/************************************************************************/
+/*                      GDALRasterizeLayersTiled()                      */
+/************************************************************************/
+
+/** Multi-threaded implementation of GDALRasterizeLayers().
+ *
+ * Features are read and transformed once, and the resulting shapes are
+ * assigned to the block-aligned tiles of the raster their bounding box
+ * intersects. Tiles are then rasterized in parallel, each burning its
+ * shapes in the order of the layers and features, so that the result is
+ * the same as with the single-threaded implementation.
+ */
+static CPLErr GDALRasterizeLayersTiled(
+    GDALDataset *poDS, int nBandCount, const int *panBandList, int nLayerCount,
+    OGRLayerH *pahLayers, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg, const double *padfLayerBurnValues,
+    CSLConstList papszOptions, int bAllTouched,
+    GDALBurnValueSrc eBurnValueSource, GDALRasterMergeAlg eMergeAlg,
+    int nNumThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    GDALRasterBand *poBand = poDS->GetRasterBand(panBandList[0]);
+    const GDALDataType eType = poBand->GetRasterDataType();
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+
+    pfnProgress(0.0, nullptr, pProgressArg);
+
+    /* -------------------------------------------------------------------- */
+    /*      Collect the shapes of all layers, in pixel/line coordinates.    */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALRasterizePreparedShape> aoShapes;
+    const char *pszBurnAttribute = CSLFetchNameValue(papszOptions, "ATTRIBUTE");
+    std::vector<double> adfAttrValues(nBandCount);
+
+    for (int iLayer = 0; iLayer < nLayerCount; iLayer++)
+    {
+        OGRLayer *poLayer = OGRLayer::FromHandle(pahLayers[iLayer]);
+        if (!poLayer)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Layer element number %d is NULL, skipping.", iLayer);
+            continue;
+        }
+        if (poLayer->GetFeatureCount(FALSE) == 0)
+            continue;
+
+        int iBurnField = -1;
+        const double *padfBurnValues = nullptr;
+        if (pszBurnAttribute)
+        {
+            iBurnField =
+                poLayer->GetLayerDefn()->GetFieldIndex(pszBurnAttribute);
+            if (iBurnField == -1)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Failed to find field %s on layer %s, skipping.",
+                         pszBurnAttribute, poLayer->GetLayerDefn()->GetName());
+                continue;
+            }
+            padfBurnValues = adfAttrValues.data();
+        }
+        else
+        {
+            padfBurnValues = padfLayerBurnValues + iLayer * nBandCount;
+        }
+
+        GDALTransformerFunc pfnLayerTransformer = pfnTransformer;
+        void *pLayerTransformArg = pTransformArg;
+        if (pfnTransformer == nullptr)
+        {
+            pLayerTransformArg =
+                GDALRasterizeCreateLayerTransformer(poDS, poLayer);
+            if (pLayerTransformArg == nullptr)
+                return CE_Failure;
+            pfnLayerTransformer = GDALGenImgProjTransform;
+        }
+
+        poLayer->ResetReading();
+        for (auto &poFeat : poLayer)
+        {
+            if (pszBurnAttribute)
+            {
+                std::fill(adfAttrValues.begin(), adfAttrValues.end(),
+                          poFeat->GetFieldAsDouble(iBurnField));
+            }
+            GDALRasterizePrepareShape(poFeat->GetGeometryRef(), padfBurnValues,
+                                      nBandCount, eBurnValueSource, eMergeAlg,
+                                      pfnLayerTransformer, pLayerTransformArg,
+                                      aoShapes);
+        }
+        poLayer->ResetReading();
+
+        if (pfnTransformer == nullptr)
+            GDALDestroyTransformer(pLayerTransformArg);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Establish tiles aligned on blocks, of about 1024x1024 pixels,   */
+    /*      or made of whole lines for stripped rasters.                    */
+    /* -------------------------------------------------------------------- */
+    constexpr int TILE_SIZE = 1024;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockXSize = std::max(1, nBlockXSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    int nTileXSize = nXSize;
+    if (nBlockXSize < nXSize)
+    {
+        nTileXSize = std::min(
+            nXSize, DIV_ROUND_UP(TILE_SIZE, nBlockXSize) * nBlockXSize);
+    }
+    const int nLines = std::max(1, TILE_SIZE * TILE_SIZE / nTileXSize);
+    const int nTileYSize =
+        static_cast<int>(std::min<GIntBig>(
+            nYSize, static_cast<GIntBig>(DIV_ROUND_UP(nLines, nBlockYSize)) *
+                        nBlockYSize));
+    const int nTilesX = DIV_ROUND_UP(nXSize, nTileXSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nTileYSize);
+
+    std::vector<std::vector<size_t>> aanTileShapes;
+    try
+    {
+        aanTileShapes.resize(static_cast<size_t>(nTilesX) * nTilesY);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating tile index");
+        return CE_Failure;
+    }
+
+    // Shapes are assigned to tiles in order, with a margin of one pixel
+    // around their bounding box.
+    for (size_t iShape = 0; iShape < aoShapes.size(); ++iShape)
+    {
+        const auto &oShape = aoShapes[iShape];
+        if (oShape.dfMaxX < -1 || oShape.dfMinX > nXSize + 1 ||
+            oShape.dfMaxY < -1 || oShape.dfMinY > nYSize + 1)
+            continue;
+        const int nMinX = static_cast<int>(
+            std::clamp(std::floor(oShape.dfMinX) - 1, 0.0, nXSize - 1.0));
+        const int nMaxX = static_cast<int>(
+            std::clamp(std::floor(oShape.dfMaxX) + 1, 0.0, nXSize - 1.0));
+        const int nMinY = static_cast<int>(
+            std::clamp(std::floor(oShape.dfMinY) - 1, 0.0, nYSize - 1.0));
+        const int nMaxY = static_cast<int>(
+            std::clamp(std::floor(oShape.dfMaxY) + 1, 0.0, nYSize - 1.0));
+        for (int iTileY = nMinY / nTileYSize; iTileY <= nMaxY / nTileYSize;
+             ++iTileY)
+        {
+            for (int iTileX = nMinX / nTileXSize;
+                 iTileX <= nMaxX / nTileXSize; ++iTileX)
+            {
+                aanTileShapes[static_cast<size_t>(iTileY) * nTilesX + iTileX]
+                    .push_back(iShape);
+            }
+        }
+    }
+
+    std::vector<int> anTiles;
+    for (size_t iTile = 0; iTile < aanTileShapes.size(); ++iTile)
+    {
+        if (!aanTileShapes[iTile].empty())
+            anTiles.push_back(static_cast<int>(iTile));
+    }
+    const int nTiles = static_cast<int>(anTiles.size());
+
+    /* -------------------------------------------------------------------- */
+    /*      Rasterize the tiles.                                            */
+    /* -------------------------------------------------------------------- */
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, std::max(1, nTiles)));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("GDAL",
+             "Rasterizer operating on %d tiles of %dx%d pixels with %d "
+             "threads.",
+             nTiles, nTileXSize, nTileYSize, poQueue ? nThreads : 1);
+
+    std::mutex oIOMutex;
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nTilesDone = 0;
+    int nJobsDone = 0;
+    std::atomic<int> nNextTile{0};
+    std::atomic<bool> bSuccess{true};
+    std::atomic<bool> bStop{false};
+    CPLErrorAccumulator oErrorAccumulator;
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eType);
+
+    const auto Job = [&]()
+    {
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            std::vector<GByte> abyBuffer;
+            std::vector<double> adfX;
+            std::vector<double> adfY;
+            std::vector<double> adfVariant;
+            while (!bStop)
+            {
+                const int iJob = nNextTile++;
+                if (iJob >= nTiles)
+                    break;
+                const int iTile = anTiles[iJob];
+                const int nXOff = (iTile % nTilesX) * nTileXSize;
+                const int nYOff = (iTile / nTilesX) * nTileYSize;
+                const int nReqXSize = std::min(nTileXSize, nXSize - nXOff);
+                const int nReqYSize = std::min(nTileYSize, nYSize - nYOff);
+                const size_t nBufferSize = static_cast<size_t>(nReqXSize) *
+                                           nReqYSize * nBandCount * nDTSize;
+                bool bOK = true;
+                try
+                {
+                    abyBuffer.resize(nBufferSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory allocating %s bytes",
+                             std::to_string(nBufferSize).c_str());
+                    bOK = false;
+                }
+                if (bOK)
+                {
+                    std::lock_guard oLock(oIOMutex);
+                    bOK = poDS->RasterIO(GF_Read, nXOff, nYOff, nReqXSize,
+                                         nReqYSize, abyBuffer.data(),
+                                         nReqXSize, nReqYSize, eType,
+                                         nBandCount, panBandList, 0, 0, 0,
+                                         nullptr) == CE_None;
+                }
+                if (bOK)
+                {
+                    for (const size_t iShape : aanTileShapes[iTile])
+                    {
+                        const auto &oShape = aoShapes[iShape];
+                        adfX.resize(oShape.adfX.size());
+                        adfY.resize(oShape.adfY.size());
+                        for (size_t i = 0; i < adfX.size(); ++i)
+                        {
+                            adfX[i] = oShape.adfX[i] - nXOff;
+                            adfY[i] = oShape.adfY[i] - nYOff;
+                        }
+                        // Copied, since it may be modified
+                        adfVariant = oShape.adfVariant;
+                        gv_rasterize_points(
+                            abyBuffer.data(), nReqXSize, nReqYSize,
+                            nBandCount, eType, 0, 0, 0, bAllTouched,
+                            oShape.eGeomType, adfX, adfY, adfVariant,
+                            oShape.anPartSize, GDT_Float64,
+                            oShape.adfBurnValues.data(), nullptr,
+                            eBurnValueSource, eMergeAlg);
+                    }
+
+                    std::lock_guard oLock(oIOMutex);
+                    bOK = poDS->RasterIO(GF_Write, nXOff, nYOff, nReqXSize,
+                                         nReqYSize, abyBuffer.data(),
+                                         nReqXSize, nReqYSize, eType,
+                                         nBandCount, panBandList, 0, 0, 0,
+                                         nullptr) == CE_None;
+                }
+                if (!bOK)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+                std::lock_guard oLock(oMutex);
+                ++nTilesDone;
+                oCV.notify_one();
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        ++nJobsDone;
+        oCV.notify_one();
+    };
+
+    const int nJobs = poQueue ? nThreads : 1;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue || !poQueue->SubmitJob(Job))
+            Job();
+    }
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nJobsDone < nJobs)
+        {
+            oCV.wait(oLock);
+            const double dfProgress =
+                nTiles ? static_cast<double>(nTilesDone) / nTiles : 1.0;
+            oLock.unlock();
+            if (!bStop && !pfnProgress(dfProgress, "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bSuccess = false;
+                bStop = true;
+            }
+            oLock.lock();
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    if (!bSuccess)
+        return CE_Failure;
+    pfnProgress(1.0, "", pProgressArg);
+    return CE_None;
+}
+
 /************************************************************************/
 /*                        GDALRasterizeLayers()                         */
 /************************************************************************/
@@ -1516,6 +1996,11 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.12) Number of worker threads, or ALL_CPUS.
+ * When set, features are read and transformed only once, and kept in memory,
+ * instead of being read again for each chunk. The raster is then processed by
+ * tiles aligned on its blocks, that are rasterized in parallel. CHUNKYSIZE is
+ * ignored in that mode.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1561,6 +2046,19 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
         return CE_Failure;
     }
 
+    if (const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS"))
+    {
+        const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : atoi(pszNumThreads);
+        return GDALRasterizeLayersTiled(
+            poDS, nBandCount, panBandList, nLayerCount, pahLayers,
+            pfnTransformer, pTransformArg, padfLayerBurnValues, papszOptions,
+            bAllTouched, eBurnValueSource, eMergeAlg, std::max(1, nNumThreads),
+            pfnProgress, pProgressArg);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Establish a chunksize to operate on.  The larger the chunk      */
     /*      size the less times we need to make a pass through all the      */
@@ -1672,47 +2170,9 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
 
         if (pfnTransformer == nullptr)
         {
-            char *pszProjection = nullptr;
             bNeedToFreeTransformer = true;
-
-            OGRSpatialReference *poSRS = poLayer->GetSpatialRef();
-            if (!poSRS)
-            {
-                if (poDS->GetSpatialRef() != nullptr ||
-                    poDS->GetGCPSpatialRef() != nullptr ||
-                    poDS->GetMetadata("RPC") != nullptr)
-                {
-                    CPLError(
-                        CE_Warning, CPLE_AppDefined,
-                        "Failed to fetch spatial reference on layer %s "
-                        "to build transformer, assuming matching coordinate "
-                        "systems.",
-                        poLayer->GetLayerDefn()->GetName());
-                }
-            }
-            else
-            {
-                poSRS->exportToWkt(&pszProjection);
-            }
-
-            char **papszTransformerOptions = nullptr;
-            if (pszProjection != nullptr)
-                papszTransformerOptions = CSLSetNameValue(
-                    papszTransformerOptions, "SRC_SRS", pszProjection);
-            GDALGeoTransform gt;
-            if (poDS->GetGeoTransform(gt) != CE_None &&
-                poDS->GetGCPCount() == 0 && poDS->GetMetadata("RPC") == nullptr)
-            {
-                papszTransformerOptions = CSLSetNameValue(
-                    papszTransformerOptions, "DST_METHOD", "NO_GEOTRANSFORM");
-            }
-
-            pTransformArg = GDALCreateGenImgProjTransformer2(
-                nullptr, hDS, papszTransformerOptions);
+            pTransformArg = GDALRasterizeCreateLayerTransformer(poDS, poLayer);
             pfnTransformer = GDALGenImgProjTransform;
-
-            CPLFree(pszProjection);
-            CSLDestroy(papszTransformerOptions);
             if (pTransformArg == nullptr)
             {
                 CPLFree(pabyChunkBuf);
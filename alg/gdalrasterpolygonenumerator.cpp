@@ -14,11 +14,18 @@
 #include "cpl_port.h"
 #include "gdal_alg_priv.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <limits>
+#include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /*! @cond Doxygen_Suppress */
 
@@ -316,6 +323,300 @@ bool GDALRasterPolygonEnumeratorT<DataType, EqualityTest>::ProcessLine(
     return true;
 }
 
+/************************************************************************/
+/*                           GetStripHeight()                           */
+/************************************************************************/
+
+/** Return the height of the strips to use with EnumerateByStrips(), such
+ * that there are a few strips per thread. With a single thread, the whole
+ * raster is a single strip, which gives the same polygon ids as a regular
+ * enumeration.
+ */
+template <class DataType, class EqualityTest>
+int GDALRasterPolygonEnumeratorT<DataType, EqualityTest>::GetStripHeight(
+    int nYSize, int nNumThreads)
+{
+    if (nNumThreads <= 1)
+        return std::max(1, nYSize);
+    constexpr int STRIPS_PER_THREAD = 4;
+    constexpr int MIN_STRIP_HEIGHT = 64;
+    const GIntBig nStrips =
+        static_cast<GIntBig>(nNumThreads) * STRIPS_PER_THREAD;
+    return std::max(MIN_STRIP_HEIGHT,
+                    static_cast<int>(DIV_ROUND_UP(nYSize, nStrips)));
+}
+
+/************************************************************************/
+/*                         EnumerateByStrips()                          */
+/************************************************************************/
+
+/** Build the polygon map of the whole raster, processing strips of
+ * nStripHeight lines in parallel.
+ *
+ * Each strip is enumerated independently, as if its first line was the
+ * first line of the raster. The polygons of the strips are then appended in
+ * order to this enumerator, and polygons touching each other across strip
+ * boundaries are merged. So the ids are the ones assigned by a regular
+ * enumeration that restarts (with a null last line) at the first line of
+ * each strip, which is how later passes must replay the enumeration.
+ *
+ * pfnReadLine() is called under a mutex, and must fill panLineVal with the
+ * values of line iY, with GP_NODATA_MARKER for masked pixels.
+ *
+ * If panPolySizes is not null, it is filled with the number of pixels of
+ * each polygon fragment (not merged), capped to INT_MAX.
+ *
+ * CompleteMerges() must be called afterwards.
+ */
+template <class DataType, class EqualityTest>
+bool GDALRasterPolygonEnumeratorT<DataType, EqualityTest>::EnumerateByStrips(
+    int nXSize, int nYSize, int nStripHeight, int nNumThreads,
+    const std::function<bool(int iY, DataType *panLineVal)> &pfnReadLine,
+    std::vector<int> *panPolySizes, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    Clear();
+    if (panPolySizes)
+        panPolySizes->clear();
+    if (nXSize <= 0 || nYSize <= 0)
+        return true;
+
+    struct Strip
+    {
+        std::unique_ptr<GDALRasterPolygonEnumeratorT> poEnum{};
+        std::vector<int> anPolySizes{};
+        std::vector<DataType> anFirstLineVal{};
+        std::vector<GInt32> anFirstLineId{};
+        std::vector<DataType> anLastLineVal{};
+        std::vector<GInt32> anLastLineId{};
+    };
+
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripHeight);
+    std::vector<Strip> asStrips;
+    try
+    {
+        asStrips.resize(nStrips);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nStrips));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("GDALRasterPolygonEnumerator",
+             "Enumerating %d strips of %d lines with %d threads", nStrips,
+             nStripHeight, poQueue ? nThreads : 1);
+
+    std::mutex oReadMutex;
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nLinesDone = 0;
+    int nJobsDone = 0;
+    std::atomic<int> nNextStrip{0};
+    std::atomic<bool> bSuccess{true};
+    std::atomic<bool> bStop{false};
+    CPLErrorAccumulator oErrorAccumulator;
+
+    const auto Job = [&]()
+    {
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            std::vector<DataType> anLastLineVal;
+            std::vector<DataType> anThisLineVal;
+            std::vector<GInt32> anLastLineId;
+            std::vector<GInt32> anThisLineId;
+            while (!bStop)
+            {
+                const int iStrip = nNextStrip++;
+                if (iStrip >= nStrips)
+                    break;
+                Strip &sStrip = asStrips[iStrip];
+                const int nYStart = iStrip * nStripHeight;
+                const int nYEnd = std::min(nYSize, nYStart + nStripHeight);
+                bool bOK = true;
+                try
+                {
+                    sStrip.poEnum = std::make_unique<
+                        GDALRasterPolygonEnumeratorT>(nConnectedness);
+                    anLastLineVal.resize(nXSize);
+                    anThisLineVal.resize(nXSize);
+                    anLastLineId.resize(nXSize);
+                    anThisLineId.resize(nXSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+                    bOK = false;
+                }
+
+                for (int iY = nYStart; bOK && iY < nYEnd && !bStop; ++iY)
+                {
+                    {
+                        std::lock_guard oLock(oReadMutex);
+                        bOK = pfnReadLine(iY, anThisLineVal.data());
+                    }
+                    bOK = bOK && sStrip.poEnum->ProcessLine(
+                                     iY == nYStart ? nullptr
+                                                   : anLastLineVal.data(),
+                                     anThisLineVal.data(),
+                                     iY == nYStart ? nullptr
+                                                   : anLastLineId.data(),
+                                     anThisLineId.data(), nXSize);
+                    if (!bOK)
+                        break;
+
+                    if (panPolySizes)
+                    {
+                        auto &anSizes = sStrip.anPolySizes;
+                        if (sStrip.poEnum->nNextPolygonId >
+                            static_cast<int>(anSizes.size()))
+                            anSizes.resize(sStrip.poEnum->nNextPolygonId);
+                        for (int iX = 0; iX < nXSize; iX++)
+                        {
+                            const int iPoly = anThisLineId[iX];
+                            if (iPoly >= 0 &&
+                                anSizes[iPoly] <
+                                    std::numeric_limits<int>::max())
+                                anSizes[iPoly] += 1;
+                        }
+                    }
+
+                    if (iY == nYStart)
+                    {
+                        sStrip.anFirstLineVal = anThisLineVal;
+                        sStrip.anFirstLineId = anThisLineId;
+                    }
+                    if (iY == nYEnd - 1)
+                    {
+                        sStrip.anLastLineVal = anThisLineVal;
+                        sStrip.anLastLineId = anThisLineId;
+                    }
+                    std::swap(anLastLineVal, anThisLineVal);
+                    std::swap(anLastLineId, anThisLineId);
+
+                    std::lock_guard oLock(oMutex);
+                    ++nLinesDone;
+                    oCV.notify_one();
+                }
+                if (!bOK)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        ++nJobsDone;
+        oCV.notify_one();
+    };
+
+    const int nJobs = poQueue ? nThreads : 1;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue || !poQueue->SubmitJob(Job))
+            Job();
+    }
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nJobsDone < nJobs)
+        {
+            oCV.wait(oLock);
+            const double dfProgress = static_cast<double>(nLinesDone) / nYSize;
+            oLock.unlock();
+            if (!bStop && pfnProgress &&
+                !pfnProgress(dfProgress, "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bSuccess = false;
+                bStop = true;
+            }
+            oLock.lock();
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    if (!bSuccess)
+        return false;
+
+    /* -------------------------------------------------------------------- */
+    /*      Append the polygons of each strip.                              */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anStripOffset(nStrips);
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        Strip &sStrip = asStrips[iStrip];
+        const int nOffset = nNextPolygonId;
+        anStripOffset[iStrip] = nOffset;
+        const auto &oStripEnum = *(sStrip.poEnum);
+        for (int iPoly = 0; iPoly < oStripEnum.nNextPolygonId; ++iPoly)
+        {
+            if (NewPolygon(oStripEnum.panPolyValue[iPoly]) < 0)
+                return false;
+            panPolyIdMap[nOffset + iPoly] =
+                nOffset + oStripEnum.panPolyIdMap[iPoly];
+        }
+        if (panPolySizes)
+        {
+            try
+            {
+                panPolySizes->insert(panPolySizes->end(),
+                                     sStrip.anPolySizes.begin(),
+                                     sStrip.anPolySizes.end());
+                panPolySizes->resize(nNextPolygonId);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+                return false;
+            }
+        }
+        sStrip.poEnum.reset();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Merge polygons across strip boundaries.                         */
+    /* -------------------------------------------------------------------- */
+    EqualityTest eq;
+    for (int iStrip = 1; iStrip < nStrips; ++iStrip)
+    {
+        const Strip &sAbove = asStrips[iStrip - 1];
+        const Strip &sBelow = asStrips[iStrip];
+        const int nOffsetAbove = anStripOffset[iStrip - 1];
+        const int nOffsetBelow = anStripOffset[iStrip];
+        for (int i = 0; i < nXSize; i++)
+        {
+            if (sBelow.anFirstLineId[i] < 0)
+                continue;
+            const int nIdBelow = nOffsetBelow + sBelow.anFirstLineId[i];
+            const DataType nVal = sBelow.anFirstLineVal[i];
+            for (int j = std::max(0, i - 1); j <= std::min(nXSize - 1, i + 1);
+                 j++)
+            {
+                if ((j != i && nConnectedness != 8) ||
+                    sAbove.anLastLineId[j] < 0 ||
+                    !eq.operator()(sAbove.anLastLineVal[j], nVal))
+                    continue;
+                const int nIdAbove = nOffsetAbove + sAbove.anLastLineId[j];
+                if (panPolyIdMap[nIdAbove] != panPolyIdMap[nIdBelow])
+                    MergePolygon(nIdAbove, nIdBelow);
+            }
+        }
+    }
+
+    return true;
+}
+
 template class GDALRasterPolygonEnumeratorT<std::int64_t, IntEqualityTest>;
 
 template class GDALRasterPolygonEnumeratorT<float, FloatEqualityTest>;
@@ -17,13 +17,16 @@
 #include <cstring>
 
 #include <algorithm>
+#include <memory>
 #include <set>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
@@ -166,8 +169,12 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.12): number of
+ * threads used to enumerate the polygons during the first pass, by strips of
+ * lines. The result is the same as with a single thread.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -179,7 +186,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
                                    int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -235,65 +242,37 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     GDALRasterPolygonEnumerator oFirstEnum(nConnectedness);
     std::vector<int> anPolySizes;
 
-    CPLErr eErr = CE_None;
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
-    {
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, GDT_Int64, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-        if (eErr != CE_None)
-            break;
-
-        if (iY == 0)
-            eErr = oFirstEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                          panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        else
-            eErr = oFirstEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                          panLastLineId, panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Accumulate polygon sizes. */
-        /* --------------------------------------------------------------------
-         */
-        if (oFirstEnum.nNextPolygonId > static_cast<int>(anPolySizes.size()))
-            anPolySizes.resize(oFirstEnum.nNextPolygonId);
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszNumThreads);
+    // Later passes restart the enumeration at the first line of each strip,
+    // to get the same polygon ids as the first pass.
+    const int nStripHeight =
+        GDALRasterPolygonEnumerator::GetStripHeight(nYSize, nNumThreads);
 
-        for (int iX = 0; iX < nXSize; iX++)
+    {
+        std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)>
+            pScaledProgress(GDALCreateScaledProgress(0.0, 0.25, pfnProgress,
+                                                     pProgressArg),
+                            GDALDestroyScaledProgress);
+        const auto ReadLine = [hSrcBand, hMaskBand, nXSize,
+                               pabyMaskLine](int iY, std::int64_t *panLineVal)
         {
-            const int iPoly = panThisLineId[iX];
-
-            if (iPoly >= 0 && anPolySizes[iPoly] < MY_MAX_INT)
-                anPolySizes[iPoly] += 1;
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      swap this/last lines. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(panLastLineVal, panThisLineVal);
-        std::swap(panLastLineId, panThisLineId);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Report progress, and support interrupts. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(0.25 * ((iY + 1) / static_cast<double>(nYSize)), "",
-                         pProgressArg))
+            CPLErr eErrRead =
+                GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panLineVal,
+                             nXSize, 1, GDT_Int64, 0, 0);
+            if (eErrRead == CE_None && hMaskBand != nullptr)
+                eErrRead = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                                           panLineVal);
+            return eErrRead == CE_None;
+        };
+        if (!oFirstEnum.EnumerateByStrips(
+                nXSize, nYSize, nStripHeight, nNumThreads, ReadLine,
+                &anPolySizes, GDALScaledProgress, pScaledProgress.get()))
         {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
+            return CE_Failure;
         }
     }
 
@@ -302,8 +281,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /*      points to the final id it should use, not an intermediate       */
     /*      value.                                                          */
     /* -------------------------------------------------------------------- */
-    if (eErr == CE_None)
-        oFirstEnum.CompleteMerges();
+    oFirstEnum.CompleteMerges();
 
     /* -------------------------------------------------------------------- */
     /*      Check if there are polygons                                     */
@@ -350,6 +328,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /* -------------------------------------------------------------------- */
     GDALRasterPolygonEnumerator oSecondEnum(nConnectedness);
 
+    CPLErr eErr = CE_None;
     std::vector<int> anBigNeighbour;
     try
     {
@@ -389,7 +368,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
         /*      the same thing done in the first pass above). */
         /* --------------------------------------------------------------------
          */
-        if (iY == 0)
+        if ((iY % nStripHeight) == 0)
             eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
                                            panThisLineId, nXSize)
                        ? CE_None
@@ -577,7 +556,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
         /*      the same thing done in the first pass above). */
         /* --------------------------------------------------------------------
          */
-        if (iY == 0)
+        if ((iY % nStripHeight) == 0)
             oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
                                     panThisLineId, nXSize);
         else
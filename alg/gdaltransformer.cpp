@@ -26,11 +26,17 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_list.h"
+#include "cpl_mem_cache.h"
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
@@ -1925,6 +1931,11 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "backmap. The default is NO, that is to use in-memory arrays, "
            "unless the number of pixels of the geolocation array is greater "
            "than 16 megapixels.' default='NO'/>"
+           "<Option name='GEOLOC_BACKMAP_FILENAME' type='string' "
+           "description='"
+           "Name of a GeoTIFF file where the backmap is saved once computed, "
+           "and from which it is loaded when it matches the geolocation "
+           "array and transformer options.'/>"
            "<Option name='GEOLOC_ARRAY' alias='SRC_GEOLOC_ARRAY' type='string' "
            "description='"
            "Name of a GDAL dataset containing a geolocation array and "
@@ -1961,7 +1972,8 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "  <Value>NO</Value>"
            "</Option>"
            "<Option name='NUM_THREADS' type='string' "
-           "description='Number of threads to use'/>"
+           "description='Number of threads to use, including for the "
+           "computation of the backmap of geolocation arrays'/>"
            "</OptionList>";
 }
 
@@ -2140,6 +2152,17 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> GEOLOC_BACKMAP_FILENAME=filename.
+ * (GDAL &gt;= 3.12) Name of a GeoTIFF file where the backmap is saved once
+ * computed. When the file already exists and was computed from the same
+ * geolocation array and transformer options, the backmap is loaded from it
+ * instead of being computed again.
+ * </li>
+ * <li> NUM_THREADS=number_of_threads or ALL_CPUS.
+ * (GDAL &gt;= 3.12) Number of threads used to compute the backmap of
+ * geolocation arrays, when it is stored in memory. Defaults to the value of
+ * the GDAL_NUM_THREADS configuration option.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -3990,6 +4013,9 @@ GDALCreateApproxTransformer2(GDALTransformerFunc pfnBaseTransformer,
     psATInfo->dfMaxErrorForward = dfMaxErrorForward;
     psATInfo->dfMaxErrorReverse = dfMaxErrorReverse;
     psATInfo->bOwnSubtransformer = FALSE;
+    psATInfo->bUseCache =
+        atoi(CPLGetConfigOption("GDAL_APPROX_TRANSFORMER_CACHE_SIZE", "0")) >
+        0;
 
     memcpy(psATInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
@@ -4058,6 +4084,9 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+
+    std::lock_guard<std::mutex> oLock(psInfo->oCacheKeyMutex);
+    psInfo->bCacheKeyComputed = false;
 }
 
 /************************************************************************/
@@ -4312,6 +4341,87 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                      GDALApproxTransformCache                        */
+/************************************************************************/
+
+namespace
+{
+struct GDALApproxTransformCacheEntry
+{
+    // Input x, y and z values, to check that a hit is a genuine one.
+    std::vector<double> adfInput{};
+    // Transformed x, y and z values.
+    std::vector<double> adfOutput{};
+    std::vector<int> anSuccess{};
+};
+
+using GDALApproxTransformCache =
+    lru11::Cache<std::string,
+                 std::shared_ptr<const GDALApproxTransformCacheEntry>,
+                 std::mutex>;
+}  // namespace
+
+static GDALApproxTransformCache &GDALGetApproxTransformCache()
+{
+    static GDALApproxTransformCache oCache(static_cast<size_t>(std::max(
+        1, atoi(CPLGetConfigOption("GDAL_APPROX_TRANSFORMER_CACHE_SIZE",
+                                   "0")))));
+    return oCache;
+}
+
+/************************************************************************/
+/*                   GDALApproxTransformGetCacheKeyId()                 */
+/************************************************************************/
+
+// Returns an identifier shared by all approximate transformers whose
+// serialization is identical, or -1 if the transformer cannot be serialized.
+static int GDALApproxTransformGetCacheKeyId(GDALApproxTransformInfo *psATInfo)
+{
+    std::lock_guard<std::mutex> oLock(psATInfo->oCacheKeyMutex);
+    if (psATInfo->bCacheKeyComputed)
+        return psATInfo->nCacheKeyId;
+    psATInfo->bCacheKeyComputed = true;
+    psATInfo->nCacheKeyId = -1;
+
+    std::string osKey;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        CPLXMLNode *psTree = GDALSerializeApproxTransformer(psATInfo);
+        const CPLXMLNode *psBase =
+            psTree ? CPLGetXMLNode(psTree, "BaseTransformer") : nullptr;
+        if (psBase && psBase->psChild)
+        {
+            char *pszXML = CPLSerializeXMLTree(psTree);
+            if (pszXML)
+                osKey = pszXML;
+            CPLFree(pszXML);
+        }
+        CPLDestroyXMLNode(psTree);
+    }
+    if (osKey.empty())
+    {
+        CPLDebug("GDAL", "ApproxTransformer - base transformer cannot be "
+                         "serialized; cache disabled.");
+        return -1;
+    }
+    // Not part of the serialization, but alters the result.
+    osKey += "CHECK_WITH_INVERT_PROJ=";
+    osKey += CPLGetConfigOption("CHECK_WITH_INVERT_PROJ", "");
+
+    static std::mutex oMutex;
+    static std::map<std::string, int> oMapKeyToId;
+    std::lock_guard<std::mutex> oMapLock(oMutex);
+    auto oIter = oMapKeyToId.find(osKey);
+    if (oIter == oMapKeyToId.end())
+    {
+        const int nId = static_cast<int>(oMapKeyToId.size());
+        oIter = oMapKeyToId.emplace(std::move(osKey), nId).first;
+    }
+    psATInfo->nCacheKeyId = oIter->second;
+    return psATInfo->nCacheKeyId;
+}
+
 /************************************************************************/
 /*                        GDALApproxTransform()                         */
 /************************************************************************/
@@ -4336,6 +4446,8 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
     double z2[3] = {};
     int anSuccess2[3] = {};
     int bSuccess;
+    std::string osRowCacheKey;
+    std::shared_ptr<GDALApproxTransformCacheEntry> poNewCacheEntry;
 
     const int nMiddle = (nPoints - 1) / 2;
 
@@ -4355,6 +4467,58 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
         goto end;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Look for the result of an identical previous call, coming from  */
+    /*      this transformer or any other one with the same definition.     */
+    /* -------------------------------------------------------------------- */
+    if (psATInfo->bUseCache)
+    {
+        const int nKeyId = GDALApproxTransformGetCacheKeyId(psATInfo);
+        if (nKeyId >= 0)
+        {
+            const auto AppendToKey = [&osRowCacheKey](const auto &val)
+            {
+                osRowCacheKey.append(reinterpret_cast<const char *>(&val),
+                                     sizeof(val));
+            };
+            AppendToKey(nKeyId);
+            AppendToKey(bDstToSrc);
+            AppendToKey(nPoints);
+            AppendToKey(x[0]);
+            AppendToKey(x[nPoints - 1]);
+            AppendToKey(y[0]);
+            AppendToKey(z[0]);
+
+            const size_t nSize = static_cast<size_t>(nPoints);
+            std::shared_ptr<const GDALApproxTransformCacheEntry> poEntry;
+            if (GDALGetApproxTransformCache().tryGet(osRowCacheKey, poEntry) &&
+                memcmp(poEntry->adfInput.data(), x, nSize * sizeof(double)) ==
+                    0 &&
+                memcmp(poEntry->adfInput.data() + nSize, y,
+                       nSize * sizeof(double)) == 0 &&
+                memcmp(poEntry->adfInput.data() + 2 * nSize, z,
+                       nSize * sizeof(double)) == 0)
+            {
+                memcpy(x, poEntry->adfOutput.data(), nSize * sizeof(double));
+                memcpy(y, poEntry->adfOutput.data() + nSize,
+                       nSize * sizeof(double));
+                memcpy(z, poEntry->adfOutput.data() + 2 * nSize,
+                       nSize * sizeof(double));
+                memcpy(panSuccess, poEntry->anSuccess.data(),
+                       nSize * sizeof(int));
+                return TRUE;
+            }
+
+            poNewCacheEntry = std::make_shared<GDALApproxTransformCacheEntry>();
+            poNewCacheEntry->adfInput.insert(poNewCacheEntry->adfInput.end(),
+                                             x, x + nSize);
+            poNewCacheEntry->adfInput.insert(poNewCacheEntry->adfInput.end(),
+                                             y, y + nSize);
+            poNewCacheEntry->adfInput.insert(poNewCacheEntry->adfInput.end(),
+                                             z, z + nSize);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Transform first, last and middle point.                         */
     /* -------------------------------------------------------------------- */
@@ -4380,6 +4544,20 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
     bRet = GDALApproxTransformInternal(pCBData, bDstToSrc, nPoints, x, y, z,
                                        panSuccess, x2, y2, z2);
 
+    if (bRet && poNewCacheEntry)
+    {
+        const size_t nSize = static_cast<size_t>(nPoints);
+        poNewCacheEntry->adfOutput.insert(poNewCacheEntry->adfOutput.end(), x,
+                                          x + nSize);
+        poNewCacheEntry->adfOutput.insert(poNewCacheEntry->adfOutput.end(), y,
+                                          y + nSize);
+        poNewCacheEntry->adfOutput.insert(poNewCacheEntry->adfOutput.end(), z,
+                                          z + nSize);
+        poNewCacheEntry->anSuccess.assign(panSuccess, panSuccess + nSize);
+        GDALGetApproxTransformCache().insert(osRowCacheKey,
+                                             std::move(poNewCacheEntry));
+    }
+
 end:
 #ifdef DEBUG_APPROX_TRANSFORMER
     for (int i = 0; i < nPoints; i++)
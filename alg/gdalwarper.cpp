@@ -1163,6 +1163,20 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='NUM_CONCURRENT_CHUNKS' type='int' description='"
+           "Number of chunks processed at the same time by "
+           "ChunkAndWarpMulti() (gdalwarp -multi). Values greater than 2 "
+           "let several chunks read source data concurrently, when the "
+           "source dataset can be re-opened by each thread. The warp memory "
+           "limit is shared between those chunks.' default='2'/>"
+           "<Option name='SRC_WINDOW_CACHE' type='boolean' description='"
+           "Whether the source data of the last processed chunk should be "
+           "kept, so that the part of the source window of the next chunk "
+           "that overlaps it is not read again.' default='YES'/>"
+           "<Option name='KERNEL_ENGINE' type='string' description='"
+           "AUTO to use the first registered warp kernel engine that can "
+           "handle the warp, CPU to always use the built-in implementation, "
+           "or the name of a registered engine.' default='AUTO'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1399,6 +1413,30 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CONCURRENT_CHUNKS: (GDAL >= 3.12) Number of chunks processed at the
+ * same time by GDALWarpOperation::ChunkAndWarpMulti(). Defaults to 2: one
+ * chunk does its I/O while the other one is warped. With a greater
+ * value, several chunks read source data concurrently, from per-thread
+ * instances of the source dataset. This is only possible if the source
+ * dataset is opened in read-only mode and can be re-opened; otherwise 2 is
+ * used. The dfWarpMemoryLimit is shared between the concurrent chunks.
+ * Ignored when STREAMABLE_OUTPUT is set.</li>
+ *
+ * <li>SRC_WINDOW_CACHE: (GDAL >= 3.12) YES (default) or NO. Adjacent chunks
+ * generally have overlapping source windows. When enabled, the source data
+ * of the last processed chunk is kept, and only the part of the source
+ * window of the next chunk that does not overlap it is read. Not applied
+ * when a pre- or post- warp chunk processor is set, or when the source and
+ * target datasets are the same.</li>
+ *
+ * <li>KERNEL_ENGINE: (GDAL >= 3.12) AUTO (default), CPU or the name of an
+ * engine registered with GDALRegisterWarpKernelEngine(), such as a GPU
+ * implementation provided by a plugin. With AUTO, the first registered
+ * engine that can handle the warp of a chunk is used. The built-in CPU
+ * implementation is used when no engine is registered, or when the
+ * engine cannot handle the requested data type, resampling method or
+ * masks.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
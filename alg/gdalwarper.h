@@ -330,6 +330,7 @@ CPL_C_END
 
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -486,6 +487,43 @@ void *GWKThreadsCreate(char **papszWarpOptions,
 void GWKThreadsEnd(void *psThreadDataIn);
 /*! @endcond */
 
+/************************************************************************/
+/*                         GDALWarpKernelEngine                         */
+/************************************************************************/
+
+/** Interface of an alternate implementation of GDALWarpKernel::PerformWarp(),
+ * for example running on a GPU.
+ *
+ * Engines are registered with GDALRegisterWarpKernelEngine(). Before
+ * running its CPU code paths, GDALWarpKernel::PerformWarp() offers the chunk
+ * to the registered engines, according to the KERNEL_ENGINE warp option.
+ *
+ * @since GDAL 3.12
+ */
+class CPL_DLL GDALWarpKernelEngine
+{
+  public:
+    virtual ~GDALWarpKernelEngine();
+
+    /** Name of the engine, as used by the KERNEL_ENGINE warp option. */
+    virtual const char *GetName() const = 0;
+
+    /** Returns whether the engine can process the warp described by the
+     * kernel (data type, resampling method, masks, ...). Called once the
+     * kernel has computed its scale factors and filter radii. When false is
+     * returned, the CPU implementation is used. */
+    virtual bool CanHandle(const GDALWarpKernel &oWK) const = 0;
+
+    /** Performs the warp described by the kernel, with the same contract
+     * as GDALWarpKernel::PerformWarp(). Only called if CanHandle() returned
+     * true. */
+    virtual CPLErr PerformWarp(GDALWarpKernel &oWK) = 0;
+};
+
+void CPL_DLL
+GDALRegisterWarpKernelEngine(std::shared_ptr<GDALWarpKernelEngine> poEngine);
+void CPL_DLL GDALDeregisterWarpKernelEngine(const char *pszName);
+
 /************************************************************************/
 /*                         GDALWarpOperation()                          */
 /*                                                                      */
@@ -544,6 +582,10 @@ class CPL_DLL GDALWarpOperation final
     CPLMutex *hIOMutex = nullptr;
     CPLMutex *hWarpMutex = nullptr;
 
+    // Set by ChunkAndWarpMulti() when several chunks read the source dataset
+    // concurrently. hIOMutex then only protects access to the destination.
+    bool m_bConcurrentChunks = false;
+
     int nChunkListCount = 0;
     int nChunkListMax = 0;
     GDALWarpChunk *pasChunkList = nullptr;
@@ -564,6 +606,9 @@ class CPL_DLL GDALWarpOperation final
                                     int nDstYSize);
     void CollectChunkList(int nDstXOff, int nDstYOff, int nDstXSize,
                           int nDstYSize);
+    CPLErr ChunkAndWarpConcurrent(int nDstXOff, int nDstYOff, int nDstXSize,
+                                  int nDstYSize, GDALDatasetH hSrcDS,
+                                  int nConcurrentChunks);
     void ReportTiming(const char *);
 
   public:
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <new>
 #include <utility>
@@ -485,6 +486,13 @@ static CPLErr GWKRun(GDALWarpKernel *poWK, const char *pszFuncName,
     if (nThreads <= 0)
         nThreads = 1;
 
+    const GDALThreadReservation oThreadReservation(nThreads);
+    if (nThreads > 1 && oThreadReservation.GetThreadCount() == 1)
+    {
+        return GWKGenericMonoThread(poWK, pfnFunc);
+    }
+    nThreads = oThreadReservation.GetThreadCount();
+
     CPLDebug("WARP", "Using %d threads", nThreads);
 
     auto &jobs = *psThreadData->threadJobs;
@@ -999,6 +1007,122 @@ GDALWarpKernel::~GDALWarpKernel()
 {
 }
 
+/************************************************************************/
+/*                        GDALWarpKernelEngine                          */
+/************************************************************************/
+
+GDALWarpKernelEngine::~GDALWarpKernelEngine() = default;
+
+static std::mutex gMutexWarpKernelEngines;
+
+static std::vector<std::shared_ptr<GDALWarpKernelEngine>> &
+GetWarpKernelEngines()
+{
+    static std::vector<std::shared_ptr<GDALWarpKernelEngine>> gaoEngines;
+    return gaoEngines;
+}
+
+/************************************************************************/
+/*                    GDALRegisterWarpKernelEngine()                    */
+/************************************************************************/
+
+/**
+ * Register an alternate warp kernel engine.
+ *
+ * An engine registered with the same name as an already registered one
+ * replaces it. Engines are tried in their order of registration when the
+ * KERNEL_ENGINE warp option is AUTO, which is its default value.
+ *
+ * @param poEngine the engine.
+ * @since GDAL 3.12
+ */
+void GDALRegisterWarpKernelEngine(
+    std::shared_ptr<GDALWarpKernelEngine> poEngine)
+{
+    std::lock_guard<std::mutex> oLock(gMutexWarpKernelEngines);
+    auto &aoEngines = GetWarpKernelEngines();
+    for (auto &poExisting : aoEngines)
+    {
+        if (EQUAL(poExisting->GetName(), poEngine->GetName()))
+        {
+            poExisting = std::move(poEngine);
+            return;
+        }
+    }
+    aoEngines.push_back(std::move(poEngine));
+}
+
+/************************************************************************/
+/*                   GDALDeregisterWarpKernelEngine()                   */
+/************************************************************************/
+
+/**
+ * Deregister a warp kernel engine registered with
+ * GDALRegisterWarpKernelEngine().
+ *
+ * Warps already running with that engine are not affected.
+ *
+ * @param pszName name of the engine.
+ * @since GDAL 3.12
+ */
+void GDALDeregisterWarpKernelEngine(const char *pszName)
+{
+    std::lock_guard<std::mutex> oLock(gMutexWarpKernelEngines);
+    auto &aoEngines = GetWarpKernelEngines();
+    aoEngines.erase(
+        std::remove_if(aoEngines.begin(), aoEngines.end(),
+                       [pszName](const std::shared_ptr<GDALWarpKernelEngine>
+                                     &poEngine)
+                       { return EQUAL(poEngine->GetName(), pszName); }),
+        aoEngines.end());
+}
+
+/************************************************************************/
+/*                       GWKFindKernelEngine()                          */
+/************************************************************************/
+
+// Returns the engine to use for this kernel, or nullptr for the CPU paths.
+static std::shared_ptr<GDALWarpKernelEngine>
+GWKFindKernelEngine(const GDALWarpKernel *poWK)
+{
+    const char *pszEngine =
+        CSLFetchNameValueDef(poWK->papszWarpOptions, "KERNEL_ENGINE", "AUTO");
+    if (EQUAL(pszEngine, "CPU"))
+        return nullptr;
+    const bool bAuto = EQUAL(pszEngine, "AUTO");
+
+    std::vector<std::shared_ptr<GDALWarpKernelEngine>> aoEngines;
+    {
+        std::lock_guard<std::mutex> oLock(gMutexWarpKernelEngines);
+        aoEngines = GetWarpKernelEngines();
+    }
+
+    bool bFound = false;
+    for (const auto &poEngine : aoEngines)
+    {
+        if (!bAuto && !EQUAL(poEngine->GetName(), pszEngine))
+            continue;
+        bFound = true;
+        if (poEngine->CanHandle(*poWK))
+            return poEngine;
+        if (!bAuto)
+        {
+            CPLDebug("WARP",
+                     "Warp kernel engine %s cannot handle this warp. "
+                     "Using CPU implementation",
+                     pszEngine);
+        }
+    }
+    if (!bAuto && !bFound)
+    {
+        CPLDebug("WARP",
+                 "Warp kernel engine %s is not registered. "
+                 "Using CPU implementation",
+                 pszEngine);
+    }
+    return nullptr;
+}
+
 /************************************************************************/
 /*                            PerformWarp()                             */
 /************************************************************************/
@@ -1195,6 +1319,16 @@ CPLErr GDALWarpKernel::PerformWarp()
     dfMultFactorVerticalShift = CPLAtof(CSLFetchNameValueDef(
         papszWarpOptions, "MULT_FACTOR_VERTICAL_SHIFT", "1.0"));
 
+    /* -------------------------------------------------------------------- */
+    /*      Give a chance to alternate engines.                             */
+    /* -------------------------------------------------------------------- */
+    if (auto poEngine = GWKFindKernelEngine(this))
+    {
+        CPLDebugOnly("WARP", "Using warp kernel engine %s",
+                     poEngine->GetName());
+        return poEngine->PerformWarp(*this);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Set up resampling functions.                                    */
     /* -------------------------------------------------------------------- */
@@ -4357,22 +4491,82 @@ static bool GWKResampleOptimizedLanczos(const GDALWarpKernel *poWK, int iBand,
         // Iterate over pixels in row.
         if (padfRowDensity != nullptr)
         {
-            for (int i = iMin; i <= iMax; ++i)
+#if defined(USE_SSE2)
+            if (bIsNonComplex)
             {
-                // Skip sampling if pixel has zero density.
-                if (padfRowDensity[i - iMin] < SRC_DENSITY_THRESHOLD)
-                    continue;
+                // Vectorized version of the below general case, processing 2
+                // columns at a time. Pixels below the density threshold are
+                // masked out rather than skipped, so that their value (which
+                // might be NaN for nodata) does not contribute.
+                const auto v_weight1 = XMMReg2Double::Set1(dfWeight1);
+                const auto v_threshold =
+                    XMMReg2Double::Set1(double(SRC_DENSITY_THRESHOLD));
+                const auto v_zero = XMMReg2Double::Zero();
+                const auto v_one = XMMReg2Double::Set1(1.0);
+                auto v_accReal = XMMReg2Double::Zero();
+                auto v_accDensity = XMMReg2Double::Zero();
+                auto v_accWeight = XMMReg2Double::Zero();
+                auto v_countValid = XMMReg2Double::Zero();
+                int i = iMin;
+                for (; i < iMax; i += 2)
+                {
+                    const auto v_density =
+                        XMMReg2Double::Load2Val(padfRowDensity + (i - iMin));
+                    const auto v_invalid =
+                        XMMReg2Double::Greater(v_threshold, v_density);
+                    const auto v_weight2 =
+                        v_weight1 *
+                        XMMReg2Double::Load2Val(padfWeightsXShifted + i);
+                    const auto v_real =
+                        XMMReg2Double::Load2Val(padfRowReal + (i - iMin));
+                    v_accReal += XMMReg2Double::Ternary(v_invalid, v_zero,
+                                                        v_real * v_weight2);
+                    v_accDensity += XMMReg2Double::Ternary(
+                        v_invalid, v_zero, v_density * v_weight2);
+                    v_accWeight +=
+                        XMMReg2Double::Ternary(v_invalid, v_zero, v_weight2);
+                    v_countValid +=
+                        XMMReg2Double::Ternary(v_invalid, v_zero, v_one);
+                }
+                dfAccumulatorReal += v_accReal.GetHorizSum();
+                dfAccumulatorDensity += v_accDensity.GetHorizSum();
+                dfAccumulatorWeight += v_accWeight.GetHorizSum();
+                nCountValid += static_cast<int>(v_countValid.GetHorizSum());
+                if (i == iMax &&
+                    !(padfRowDensity[i - iMin] < SRC_DENSITY_THRESHOLD))
+                {
+                    // Process last column if there's an odd number of them.
+                    nCountValid++;
+                    const double dfWeight2 =
+                        dfWeight1 * padfWeightsXShifted[i];
+                    dfAccumulatorReal += padfRowReal[i - iMin] * dfWeight2;
+                    dfAccumulatorDensity +=
+                        padfRowDensity[i - iMin] * dfWeight2;
+                    dfAccumulatorWeight += dfWeight2;
+                }
+            }
+            else
+#endif
+            {
+                for (int i = iMin; i <= iMax; ++i)
+                {
+                    // Skip sampling if pixel has zero density.
+                    if (padfRowDensity[i - iMin] < SRC_DENSITY_THRESHOLD)
+                        continue;
 
-                nCountValid++;
+                    nCountValid++;
 
-                //  Use a cached set of weights for this row.
-                const double dfWeight2 = dfWeight1 * padfWeightsXShifted[i];
+                    //  Use a cached set of weights for this row.
+                    const double dfWeight2 =
+                        dfWeight1 * padfWeightsXShifted[i];
 
-                // Accumulate!
-                dfAccumulatorReal += padfRowReal[i - iMin] * dfWeight2;
-                dfAccumulatorImag += padfRowImag[i - iMin] * dfWeight2;
-                dfAccumulatorDensity += padfRowDensity[i - iMin] * dfWeight2;
-                dfAccumulatorWeight += dfWeight2;
+                    // Accumulate!
+                    dfAccumulatorReal += padfRowReal[i - iMin] * dfWeight2;
+                    dfAccumulatorImag += padfRowImag[i - iMin] * dfWeight2;
+                    dfAccumulatorDensity +=
+                        padfRowDensity[i - iMin] * dfWeight2;
+                    dfAccumulatorWeight += dfWeight2;
+                }
             }
         }
         else if (bIsNonComplex)
@@ -6492,6 +6686,111 @@ static CPLErr GWKNearestFloat(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKNearestFloat", GWKNearestThread<float>);
 }
 
+/************************************************************************/
+/*                    GWKAverageOrModeForEachValue()                    */
+/************************************************************************/
+
+namespace
+{
+// Source window of a target pixel in GWKAverageOrModeThread()
+struct GWKAverageOrModeWindow
+{
+    int iSrcXMin;
+    int iSrcXMax;
+    int iSrcYMin;
+    int iSrcYMax;
+    double dfXMin;
+    double dfXMax;
+    double dfYMin;
+    double dfYMax;
+};
+}  // namespace
+
+template <class T, class F>
+static void GWKAverageOrModeForEachValueT(const GDALWarpKernel *poWK,
+                                          int iBand,
+                                          const GWKAverageOrModeWindow &sWin,
+                                          F &&f)
+{
+    const T *const pSrc =
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+    GUInt32 *const panUnifiedSrcValid = poWK->panUnifiedSrcValid;
+    GUInt32 *const panBandSrcValid =
+        poWK->papanBandSrcValid ? poWK->papanBandSrcValid[iBand] : nullptr;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int iSrcXMin = sWin.iSrcXMin;
+    const int iSrcXMax = sWin.iSrcXMax;
+
+    for (int iSrcY = sWin.iSrcYMin; iSrcY < sWin.iSrcYMax; iSrcY++)
+    {
+        // Same weights as COMPUTE_WEIGHT_Y() and COMPUTE_WEIGHT() in
+        // GWKAverageOrModeThread()
+        const double dfWeightY =
+            (iSrcY == sWin.iSrcYMin)
+                ? ((sWin.iSrcYMin + 1 == sWin.iSrcYMax)
+                       ? 1.0
+                       : 1 - (sWin.dfYMin - sWin.iSrcYMin))
+            : (iSrcY + 1 == sWin.iSrcYMax) ? 1 - (sWin.iSrcYMax - sWin.dfYMax)
+                                           : 1.0;
+        const double dfWeightFirst =
+            (iSrcXMin + 1 == iSrcXMax)
+                ? dfWeightY
+                : dfWeightY * (1 - (sWin.dfXMin - iSrcXMin));
+        const double dfWeightLast =
+            dfWeightY * (1 - (iSrcXMax - sWin.dfXMax));
+
+        const GPtrDiff_t iLineOffset =
+            static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+        for (int iSrcX = iSrcXMin; iSrcX < iSrcXMax; iSrcX++)
+        {
+            const GPtrDiff_t iSrcOffset = iLineOffset + iSrcX;
+            if ((panUnifiedSrcValid &&
+                 !CPLMaskGet(panUnifiedSrcValid, iSrcOffset)) ||
+                (panBandSrcValid && !CPLMaskGet(panBandSrcValid, iSrcOffset)))
+            {
+                continue;
+            }
+            f(static_cast<double>(pSrc[iSrcOffset]),
+              iSrcX == iSrcXMin       ? dfWeightFirst
+              : iSrcX + 1 == iSrcXMax ? dfWeightLast
+                                      : dfWeightY);
+        }
+    }
+}
+
+// Calls f(dfValue, dfWeight) for each valid source pixel of the window,
+// in the same order as the generic code of GWKAverageOrModeThread(), but
+// without the per-pixel data type dispatch of GWKGetPixelValue().
+// Returns false if the working data type has no specialization, or if
+// there is a source density, in which case nothing is done.
+template <class F>
+static bool GWKAverageOrModeForEachValue(const GDALWarpKernel *poWK,
+                                         int iBand,
+                                         const GWKAverageOrModeWindow &sWin,
+                                         F &&f)
+{
+    if (poWK->pafUnifiedSrcDensity)
+        return false;
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_Byte:
+            GWKAverageOrModeForEachValueT<GByte>(poWK, iBand, sWin, f);
+            return true;
+        case GDT_Int16:
+            GWKAverageOrModeForEachValueT<GInt16>(poWK, iBand, sWin, f);
+            return true;
+        case GDT_UInt16:
+            GWKAverageOrModeForEachValueT<GUInt16>(poWK, iBand, sWin, f);
+            return true;
+        case GDT_Float32:
+            GWKAverageOrModeForEachValueT<float>(poWK, iBand, sWin, f);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           GWKAverageOrMode()                         */
 /*                                                                      */
@@ -6534,6 +6833,9 @@ static void GWKAverageOrModeThread(void *pData)
     int nBinsOffset = 0;
     const GWKTieStrategy eTieStrategy = poWK->eTieStrategy;
 
+    // Only used with GWKAOM_Imode.
+    std::vector<int> anModeUsedBins;
+
     // Only used with nAlgo = 6.
     float quant = 0.5;
 
@@ -6580,8 +6882,8 @@ static void GWKAverageOrModeThread(void *pData)
             {
                 nBins = 65536;
             }
-            pafCounts =
-                static_cast<float *>(VSI_MALLOC_VERBOSE(nBins * sizeof(float)));
+            pafCounts = static_cast<float *>(
+                VSI_CALLOC_VERBOSE(nBins, sizeof(float)));
             if (pafCounts == nullptr)
                 return;
         }
@@ -6835,6 +7137,11 @@ static void GWKAverageOrModeThread(void *pData)
             if (iSrcYMin == iSrcYMax && iSrcYMax < nSrcYSize)
                 iSrcYMax++;
 
+            const GWKAverageOrModeWindow sWindow{iSrcXMin, iSrcXMax,
+                                                 iSrcYMin, iSrcYMax,
+                                                 dfXMin,   dfXMax,
+                                                 dfYMin,   dfYMax};
+
 #define COMPUTE_WEIGHT_Y(iSrcY)                                                \
     ((iSrcY == iSrcYMin)                                                       \
          ? ((iSrcYMin + 1 == iSrcYMax) ? 1.0 : 1 - (dfYMin - iSrcYMin))        \
@@ -7018,48 +7325,70 @@ static void GWKAverageOrModeThread(void *pData)
                 {
                     double dfTotalWeight = 0.0;
 
-                    // This code adapted from GDALDownsampleChunk32R_AverageT()
-                    // in gcore/overview.cpp.
-                    for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
+                    // Weighted incremental algorithm mean
+                    // Cf https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Weighted_incremental_algorithm
+                    const auto Accumulate =
+                        [&dfTotalWeight, &dfValueReal](double dfVal,
+                                                       double dfWeight)
                     {
-                        const double dfWeightY = COMPUTE_WEIGHT_Y(iSrcY);
-                        iSrcOffset = iSrcXMin +
-                                     static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
-                        for (int iSrcX = iSrcXMin; iSrcX < iSrcXMax;
-                             iSrcX++, iSrcOffset++)
+                        if (dfWeight > 0)
                         {
-                            if (bWrapOverX)
-                                iSrcOffset =
-                                    (iSrcX % nSrcXSize) +
-                                    static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                            dfTotalWeight += dfWeight;
+                            dfValueReal += (dfWeight / dfTotalWeight) *
+                                           (dfVal - dfValueReal);
+                        }
+                    };
 
-                            if (poWK->panUnifiedSrcValid != nullptr &&
-                                !CPLMaskGet(poWK->panUnifiedSrcValid,
-                                            iSrcOffset))
+                    if (bIsComplex || bWrapOverX ||
+                        !GWKAverageOrModeForEachValue(poWK, iBand, sWindow,
+                                                      Accumulate))
+                    {
+                        // This code adapted from
+                        // GDALDownsampleChunk32R_AverageT() in
+                        // gcore/overview.cpp.
+                        for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
+                        {
+                            const double dfWeightY = COMPUTE_WEIGHT_Y(iSrcY);
+                            iSrcOffset =
+                                iSrcXMin +
+                                static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                            for (int iSrcX = iSrcXMin; iSrcX < iSrcXMax;
+                                 iSrcX++, iSrcOffset++)
                             {
-                                continue;
-                            }
+                                if (bWrapOverX)
+                                    iSrcOffset =
+                                        (iSrcX % nSrcXSize) +
+                                        static_cast<GPtrDiff_t>(iSrcY) *
+                                            nSrcXSize;
 
-                            if (GWKGetPixelValue(
-                                    poWK, iBand, iSrcOffset, &dfBandDensity,
-                                    &dfValueRealTmp, &dfValueImagTmp) &&
-                                dfBandDensity > BAND_DENSITY_THRESHOLD)
-                            {
-                                const double dfWeight =
-                                    COMPUTE_WEIGHT(iSrcX, dfWeightY);
-                                if (dfWeight > 0)
+                                if (poWK->panUnifiedSrcValid != nullptr &&
+                                    !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                                iSrcOffset))
                                 {
-                                    // Weighted incremental algorithm mean
-                                    // Cf https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Weighted_incremental_algorithm
-                                    dfTotalWeight += dfWeight;
-                                    dfValueReal +=
-                                        (dfWeight / dfTotalWeight) *
-                                        (dfValueRealTmp - dfValueReal);
-                                    if (bIsComplex)
+                                    continue;
+                                }
+
+                                if (GWKGetPixelValue(
+                                        poWK, iBand, iSrcOffset, &dfBandDensity,
+                                        &dfValueRealTmp, &dfValueImagTmp) &&
+                                    dfBandDensity > BAND_DENSITY_THRESHOLD)
+                                {
+                                    const double dfWeight =
+                                        COMPUTE_WEIGHT(iSrcX, dfWeightY);
+                                    if (dfWeight > 0)
                                     {
-                                        dfValueImag +=
+                                        // Weighted incremental algorithm mean
+                                        // Cf https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Weighted_incremental_algorithm
+                                        dfTotalWeight += dfWeight;
+                                        dfValueReal +=
                                             (dfWeight / dfTotalWeight) *
-                                            (dfValueImagTmp - dfValueImag);
+                                            (dfValueRealTmp - dfValueReal);
+                                        if (bIsComplex)
+                                        {
+                                            dfValueImag +=
+                                                (dfWeight / dfTotalWeight) *
+                                                (dfValueImagTmp - dfValueImag);
+                                        }
                                     }
                                 }
                             }
@@ -7354,70 +7683,89 @@ static void GWKAverageOrModeThread(void *pData)
                         int nMode = -1;
                         bool bHasSourceValues = false;
 
-                        memset(pafCounts, 0, nBins * sizeof(float));
+                        // Only the bins that have been incremented are reset
+                        // afterwards, instead of the whole array, which is
+                        // costly for 16-bit data types.
+                        anModeUsedBins.clear();
 
-                        for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
+                        const auto Accumulate =
+                            [&](double dfVal, double dfWeight)
                         {
-                            const double dfWeightY = COMPUTE_WEIGHT_Y(iSrcY);
-                            iSrcOffset =
-                                iSrcXMin +
-                                static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
-                            for (int iSrcX = iSrcXMin; iSrcX < iSrcXMax;
-                                 iSrcX++, iSrcOffset++)
+                            bHasSourceValues = true;
+                            const int nVal = static_cast<int>(dfVal);
+                            const int iBin = nVal + nBinsOffset;
+                            if (pafCounts[iBin] == 0)
+                                anModeUsedBins.push_back(iBin);
+
+                            // Sum the density.
+                            pafCounts[iBin] += static_cast<float>(dfWeight);
+                            // Is it the most common value so far?
+                            bool bUpdateMode = pafCounts[iBin] > fMaxCount;
+                            if (!bUpdateMode && pafCounts[iBin] == fMaxCount)
                             {
-                                if (bWrapOverX)
-                                    iSrcOffset =
-                                        (iSrcX % nSrcXSize) +
-                                        static_cast<GPtrDiff_t>(iSrcY) *
-                                            nSrcXSize;
-
-                                if (poWK->panUnifiedSrcValid != nullptr &&
-                                    !CPLMaskGet(poWK->panUnifiedSrcValid,
-                                                iSrcOffset))
-                                    continue;
-
-                                if (GWKGetPixelValue(
-                                        poWK, iBand, iSrcOffset, &dfBandDensity,
-                                        &dfValueRealTmp, &dfValueImagTmp) &&
-                                    dfBandDensity > BAND_DENSITY_THRESHOLD)
+                                switch (eTieStrategy)
                                 {
-                                    bHasSourceValues = true;
-                                    const int nVal =
-                                        static_cast<int>(dfValueRealTmp);
-                                    const int iBin = nVal + nBinsOffset;
-                                    const double dfWeight =
-                                        COMPUTE_WEIGHT(iSrcX, dfWeightY);
+                                    case GWKTS_First:
+                                        break;
+                                    case GWKTS_Min:
+                                        bUpdateMode = nVal < nMode;
+                                        break;
+                                    case GWKTS_Max:
+                                        bUpdateMode = nVal > nMode;
+                                        break;
+                                }
+                            }
+                            if (bUpdateMode)
+                            {
+                                nMode = nVal;
+                                fMaxCount = pafCounts[iBin];
+                            }
+                        };
 
-                                    // Sum the density.
-                                    pafCounts[iBin] +=
-                                        static_cast<float>(dfWeight);
-                                    // Is it the most common value so far?
-                                    bool bUpdateMode =
-                                        pafCounts[iBin] > fMaxCount;
-                                    if (!bUpdateMode &&
-                                        pafCounts[iBin] == fMaxCount)
-                                    {
-                                        switch (eTieStrategy)
-                                        {
-                                            case GWKTS_First:
-                                                break;
-                                            case GWKTS_Min:
-                                                bUpdateMode = nVal < nMode;
-                                                break;
-                                            case GWKTS_Max:
-                                                bUpdateMode = nVal > nMode;
-                                                break;
-                                        }
-                                    }
-                                    if (bUpdateMode)
+                        if (bWrapOverX ||
+                            !GWKAverageOrModeForEachValue(poWK, iBand, sWindow,
+                                                          Accumulate))
+                        {
+                            for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax;
+                                 iSrcY++)
+                            {
+                                const double dfWeightY =
+                                    COMPUTE_WEIGHT_Y(iSrcY);
+                                iSrcOffset =
+                                    iSrcXMin +
+                                    static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                                for (int iSrcX = iSrcXMin; iSrcX < iSrcXMax;
+                                     iSrcX++, iSrcOffset++)
+                                {
+                                    if (bWrapOverX)
+                                        iSrcOffset =
+                                            (iSrcX % nSrcXSize) +
+                                            static_cast<GPtrDiff_t>(iSrcY) *
+                                                nSrcXSize;
+
+                                    if (poWK->panUnifiedSrcValid != nullptr &&
+                                        !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                                    iSrcOffset))
+                                        continue;
+
+                                    if (GWKGetPixelValue(poWK, iBand,
+                                                         iSrcOffset,
+                                                         &dfBandDensity,
+                                                         &dfValueRealTmp,
+                                                         &dfValueImagTmp) &&
+                                        dfBandDensity > BAND_DENSITY_THRESHOLD)
                                     {
-                                        nMode = nVal;
-                                        fMaxCount = pafCounts[iBin];
+                                        Accumulate(
+                                            dfValueRealTmp,
+                                            COMPUTE_WEIGHT(iSrcX, dfWeightY));
                                     }
                                 }
                             }
                         }
 
+                        for (const int iBin : anModeUsedBins)
+                            pafCounts[iBin] = 0;
+
                         if (bHasSourceValues)
                         {
                             dfValueReal = nMode;
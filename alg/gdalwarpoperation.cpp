@@ -22,10 +22,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -34,6 +36,7 @@
 #include "cpl_mask.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
@@ -54,6 +57,22 @@ struct GDALWarpPrivateData
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+
+    // Source buffer of the last warped chunk, kept so that its intersection
+    // with the source window of the next chunk is not read again.
+    std::mutex oSrcWindowMutex{};
+    std::unique_ptr<GByte, VSIFreeReleaser> pabySrcWindow{};
+    GDALDataType eSrcWindowDataType = GDT_Unknown;
+    int nSrcWindowBandCount = 0;
+    GSpacing nSrcWindowBandSpace = 0;
+    int nSrcWindowXOff = 0;
+    int nSrcWindowYOff = 0;
+    int nSrcWindowXSize = 0;
+    int nSrcWindowYSize = 0;
+
+    // Index of the cutline edges, built once for all chunks.
+    std::once_flag oCutlineIndexOnce{};
+    std::unique_ptr<GDALCutlineSegmentIndex> poCutlineIndex{};
 };
 
 static std::mutex gMutex{};
@@ -1194,6 +1213,42 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
+    /* -------------------------------------------------------------------- */
+    /*      Process more than 2 chunks at a time if asked, and if the       */
+    /*      source dataset can be read from several threads.                */
+    /* -------------------------------------------------------------------- */
+    const int nConcurrentChunks = atoi(CSLFetchNameValueDef(
+        psOptions->papszWarpOptions, "NUM_CONCURRENT_CHUNKS", "2"));
+    if (nConcurrentChunks > 2)
+    {
+        if (CPLFetchBool(psOptions->papszWarpOptions, "STREAMABLE_OUTPUT",
+                         false))
+        {
+            CPLDebug("WARP", "NUM_CONCURRENT_CHUNKS ignored because of "
+                             "STREAMABLE_OUTPUT=YES");
+        }
+        else
+        {
+            GDALDatasetH hThreadSafeSrcDS = nullptr;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                hThreadSafeSrcDS = GDALGetThreadSafeDataset(
+                    psOptions->hSrcDS, GDAL_OF_RASTER, nullptr);
+            }
+            if (hThreadSafeSrcDS)
+            {
+                const CPLErr eErr = ChunkAndWarpConcurrent(
+                    nDstXOff, nDstYOff, nDstXSize, nDstYSize, hThreadSafeSrcDS,
+                    nConcurrentChunks);
+                GDALReleaseDataset(hThreadSafeSrcDS);
+                return eErr;
+            }
+            CPLDebug("WARP",
+                     "Source dataset cannot be read from several threads. "
+                     "Processing only 2 chunks at a time");
+        }
+    }
+
     CPLCond *hCond = CPLCreateCond();
     CPLMutex *hCondMutex = CPLCreateMutex();
     CPLReleaseMutex(hCondMutex);
@@ -1325,6 +1380,127 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     return eErr;
 }
 
+/************************************************************************/
+/*                       ChunkAndWarpConcurrent()                       */
+/************************************************************************/
+
+namespace
+{
+struct ConcurrentChunksState
+{
+    GDALWarpOperation *poOperation = nullptr;
+    const GDALWarpChunk *pasChunkList = nullptr;
+    int nChunkListCount = 0;
+    std::vector<double> adfProgressBase{};
+    double dfTotalPixels = 0;
+    std::atomic<int> nNextChunk{0};
+    std::atomic<bool> bError{false};
+    CPLErrorAccumulator oErrorAccumulator{};
+};
+}  // namespace
+
+static void ConcurrentChunksThreadMain(void *pThreadData)
+{
+    auto psState = static_cast<ConcurrentChunksState *>(pThreadData);
+
+    auto oAccumulator = psState->oErrorAccumulator.InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    while (!psState->bError)
+    {
+        const int iChunk = psState->nNextChunk++;
+        if (iChunk >= psState->nChunkListCount)
+            break;
+
+        const GDALWarpChunk *pasThisChunk = psState->pasChunkList + iChunk;
+        const double dfChunkPixels =
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+
+        CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                 psState->nChunkListCount);
+        const CPLErr eErr = psState->poOperation->WarpRegion(
+            pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
+            pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
+            pasThisChunk->ssx, pasThisChunk->ssy, pasThisChunk->sExtraSx,
+            pasThisChunk->sExtraSy, psState->adfProgressBase[iChunk],
+            dfChunkPixels / psState->dfTotalPixels);
+        CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                 psState->nChunkListCount);
+
+        if (eErr != CE_None)
+            psState->bError = true;
+    }
+}
+
+/** Implementation of ChunkAndWarpMulti() where nConcurrentChunks chunks are
+ * processed at a time, each one by its own thread. Sources are read
+ * concurrently from hSrcDS, which must be thread-safe, and the destination is
+ * accessed under hIOMutex. Warping itself is serialized by hWarpMutex. The
+ * warp memory limit is shared between the concurrent chunks.
+ */
+CPLErr GDALWarpOperation::ChunkAndWarpConcurrent(int nDstXOff, int nDstYOff,
+                                                 int nDstXSize, int nDstYSize,
+                                                 GDALDatasetH hSrcDS,
+                                                 int nConcurrentChunks)
+{
+    const double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit / nConcurrentChunks;
+    CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit;
+
+    ConcurrentChunksState sState;
+    sState.poOperation = this;
+    sState.pasChunkList = pasChunkList;
+    sState.nChunkListCount = pasChunkList ? nChunkListCount : 0;
+    sState.dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+    double dfPixelsProcessed = 0.0;
+    for (int iChunk = 0; iChunk < sState.nChunkListCount; iChunk++)
+    {
+        sState.adfProgressBase.push_back(dfPixelsProcessed /
+                                         sState.dfTotalPixels);
+        const GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        dfPixelsProcessed +=
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+    }
+
+    GDALDatasetH hSrcDSBackup = psOptions->hSrcDS;
+    psOptions->hSrcDS = hSrcDS;
+    m_bConcurrentChunks = true;
+
+    // The current thread processes chunks too.
+    const int nThreads =
+        std::min(nConcurrentChunks, sState.nChunkListCount) - 1;
+    std::vector<CPLJoinableThread *> ahThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        CPLJoinableThread *hThread =
+            CPLCreateJoinableThread(ConcurrentChunksThreadMain, &sState);
+        if (hThread == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "CPLCreateJoinableThread() failed in "
+                     "ChunkAndWarpMulti()");
+            sState.bError = true;
+            break;
+        }
+        ahThreads.push_back(hThread);
+    }
+    ConcurrentChunksThreadMain(&sState);
+    for (CPLJoinableThread *hThread : ahThreads)
+        CPLJoinThread(hThread);
+
+    m_bConcurrentChunks = false;
+    psOptions->hSrcDS = hSrcDSBackup;
+
+    WipeChunkList();
+
+    sState.oErrorAccumulator.ReplayErrors();
+
+    psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
+
+    return sState.bError ? CE_Failure : CE_None;
+}
+
 /************************************************************************/
 /*                         GDALChunkAndWarpMulti()                      */
 /************************************************************************/
@@ -1724,6 +1900,7 @@ CPLErr GDALWarpOperation::WarpRegion(
     GDALDataset *poDstDS = GDALDataset::FromHandle(psOptions->hDstDS);
     if (!bDstBufferInitialized)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentChunks ? hIOMutex : nullptr);
         CPLErr eErr = CE_None;
         if (psOptions->nBandCount == 1)
         {
@@ -1768,6 +1945,7 @@ CPLErr GDALWarpOperation::WarpRegion(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentChunks ? hIOMutex : nullptr);
         if (psOptions->nBandCount == 1)
         {
             // Particular case to simplify the stack a bit.
@@ -1827,6 +2005,152 @@ CPLErr GDALWarpRegion(GDALWarpOperationH hOperation, int nDstXOff, int nDstYOff,
                      nSrcYOff, nSrcXSize, nSrcYSize);
 }
 
+/************************************************************************/
+/*                      GDALWarpGetCutlineIndex()                       */
+/************************************************************************/
+
+// Returns the index of the edges of the cutline, to rasterize it on each
+// chunk without visiting all its vertices, or nullptr if it cannot be used.
+static const GDALCutlineSegmentIndex *
+GDALWarpGetCutlineIndex(const GDALWarpOptions *psOptions,
+                        GDALWarpPrivateData *psPrivate)
+{
+    if (CPLFetchBool(psOptions->papszWarpOptions, "CUTLINE_ALL_TOUCHED",
+                     false))
+        return nullptr;
+    std::call_once(psPrivate->oCutlineIndexOnce,
+                   [psOptions, psPrivate]()
+                   {
+                       psPrivate->poCutlineIndex =
+                           GDALCutlineSegmentIndex::Create(
+                               static_cast<OGRGeometryH>(psOptions->hCutline),
+                               GDALGetRasterYSize(psOptions->hSrcDS));
+                   });
+    return psPrivate->poCutlineIndex.get();
+}
+
+/************************************************************************/
+/*                       GDALWarpReadSrcWindow()                        */
+/************************************************************************/
+
+// Reads the source window of a chunk into pabySrc, whose bands are spaced by
+// nBandSpace bytes. If psPrivate is not null, the intersection with the
+// source window of the previous chunk is copied from its buffer, and only
+// the rest of the window is read from the source dataset.
+static CPLErr GDALWarpReadSrcWindow(const GDALWarpOptions *psOptions,
+                                    GDALWarpPrivateData *psPrivate,
+                                    GByte *pabySrc, GSpacing nBandSpace,
+                                    int nSrcXOff, int nSrcYOff, int nSrcXSize,
+                                    int nSrcYSize)
+{
+    const GDALDataType eDT = psOptions->eWorkingDataType;
+    const int nWordSize = GDALGetDataTypeSizeBytes(eDT);
+    const GSpacing nLineSpace = static_cast<GSpacing>(nWordSize) * nSrcXSize;
+    GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
+
+    const auto ReadRect = [psOptions, poSrcDS, pabySrc, eDT, nWordSize,
+                           nLineSpace, nBandSpace, nSrcXOff,
+                           nSrcYOff](int nXOff, int nYOff, int nXSize,
+                                     int nYSize)
+    {
+        if (nXSize <= 0 || nYSize <= 0)
+            return CE_None;
+        GByte *pabyDst = pabySrc + (nYOff - nSrcYOff) * nLineSpace +
+                         static_cast<GSpacing>(nXOff - nSrcXOff) * nWordSize;
+        if (psOptions->nBandCount == 1)
+        {
+            // Particular case to simplify the stack a bit.
+            return poSrcDS->GetRasterBand(psOptions->panSrcBands[0])
+                ->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, pabyDst,
+                           nXSize, nYSize, eDT, nWordSize, nLineSpace,
+                           nullptr);
+        }
+        return poSrcDS->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                                 pabyDst, nXSize, nYSize, eDT,
+                                 psOptions->nBandCount, psOptions->panSrcBands,
+                                 nWordSize, nLineSpace, nBandSpace, nullptr);
+    };
+
+    if (psPrivate == nullptr)
+        return ReadRect(nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize);
+
+    int nX0 = 0;
+    int nY0 = 0;
+    int nX1 = 0;
+    int nY1 = 0;
+    {
+        std::lock_guard oLock(psPrivate->oSrcWindowMutex);
+        if (!psPrivate->pabySrcWindow ||
+            psPrivate->eSrcWindowDataType != eDT ||
+            psPrivate->nSrcWindowBandCount != psOptions->nBandCount)
+        {
+            return ReadRect(nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize);
+        }
+        const int nPrevXOff = psPrivate->nSrcWindowXOff;
+        const int nPrevYOff = psPrivate->nSrcWindowYOff;
+        nX0 = std::max(nSrcXOff, nPrevXOff);
+        nY0 = std::max(nSrcYOff, nPrevYOff);
+        nX1 = std::min(nSrcXOff + nSrcXSize,
+                       nPrevXOff + psPrivate->nSrcWindowXSize);
+        nY1 = std::min(nSrcYOff + nSrcYSize,
+                       nPrevYOff + psPrivate->nSrcWindowYSize);
+        if (nX0 >= nX1 || nY0 >= nY1)
+            return ReadRect(nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize);
+
+        const GSpacing nPrevLineSpace =
+            static_cast<GSpacing>(nWordSize) * psPrivate->nSrcWindowXSize;
+        const size_t nRowSize = static_cast<size_t>(nX1 - nX0) * nWordSize;
+        for (int iBand = 0; iBand < psOptions->nBandCount; ++iBand)
+        {
+            const GByte *pabyPrevBand = psPrivate->pabySrcWindow.get() +
+                                        iBand * psPrivate->nSrcWindowBandSpace;
+            GByte *pabyBand = pabySrc + iBand * nBandSpace;
+            for (int iY = nY0; iY < nY1; ++iY)
+            {
+                memcpy(pabyBand + (iY - nSrcYOff) * nLineSpace +
+                           static_cast<GSpacing>(nX0 - nSrcXOff) * nWordSize,
+                       pabyPrevBand + (iY - nPrevYOff) * nPrevLineSpace +
+                           static_cast<GSpacing>(nX0 - nPrevXOff) * nWordSize,
+                       nRowSize);
+            }
+        }
+    }
+
+    // Read the rows above and below the intersection, and the columns at
+    // its left and right.
+    CPLErr eErr = ReadRect(nSrcXOff, nSrcYOff, nSrcXSize, nY0 - nSrcYOff);
+    if (eErr == CE_None)
+        eErr = ReadRect(nSrcXOff, nY1, nSrcXSize, nSrcYOff + nSrcYSize - nY1);
+    if (eErr == CE_None)
+        eErr = ReadRect(nSrcXOff, nY0, nX0 - nSrcXOff, nY1 - nY0);
+    if (eErr == CE_None)
+        eErr = ReadRect(nX1, nY0, nSrcXOff + nSrcXSize - nX1, nY1 - nY0);
+    return eErr;
+}
+
+/************************************************************************/
+/*                       GDALWarpStoreSrcWindow()                       */
+/************************************************************************/
+
+// Takes ownership of the source buffer of a chunk, for the next call to
+// GDALWarpReadSrcWindow(), and frees the previous one.
+static void GDALWarpStoreSrcWindow(const GDALWarpOptions *psOptions,
+                                   GDALWarpPrivateData *psPrivate,
+                                   GByte *pabySrc, GSpacing nBandSpace,
+                                   int nSrcXOff, int nSrcYOff, int nSrcXSize,
+                                   int nSrcYSize)
+{
+    std::lock_guard oLock(psPrivate->oSrcWindowMutex);
+    psPrivate->pabySrcWindow.reset(pabySrc);
+    psPrivate->eSrcWindowDataType = psOptions->eWorkingDataType;
+    psPrivate->nSrcWindowBandCount = psOptions->nBandCount;
+    psPrivate->nSrcWindowBandSpace = nBandSpace;
+    psPrivate->nSrcWindowXOff = nSrcXOff;
+    psPrivate->nSrcWindowYOff = nSrcYOff;
+    psPrivate->nSrcWindowXSize = nSrcXSize;
+    psPrivate->nSrcWindowYSize = nSrcYSize;
+}
+
 /************************************************************************/
 /*                            WarpRegionToBuffer()                      */
 /************************************************************************/
@@ -1910,6 +2234,9 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
 
 {
+    CPLTraceScope oTraceScope("GDALWarpOperation::WarpRegionToBuffer");
+    CPLTraceCounterAdd(CPL_TRACE_COUNTER_WARP_CHUNKS, 1);
+
     const int nWordSize = GDALGetDataTypeSizeBytes(psOptions->eWorkingDataType);
 
     CPLAssert(eBufDataType == psOptions->eWorkingDataType);
@@ -2014,29 +2341,26 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
                  WARP_EXTRA_ELTS) *
                 i;
 
+    // Adjacent chunks generally have overlapping source windows, so the
+    // source buffer of the last chunk is kept to avoid re-reading the
+    // overlap. This is not done if the source buffer can be modified by a
+    // chunk processor, or if the source dataset is also the destination.
+    GDALWarpPrivateData *psPrivate =
+        CPLFetchBool(psOptions->papszWarpOptions, "SRC_WINDOW_CACHE", true) &&
+                psOptions->pfnPreWarpChunkProcessor == nullptr &&
+                psOptions->pfnPostWarpChunkProcessor == nullptr &&
+                psOptions->hSrcDS != psOptions->hDstDS
+            ? GetWarpPrivateData(this)
+            : nullptr;
+    const GSpacing nSrcBandSpace =
+        nWordSize *
+        (static_cast<GSpacing>(nSrcXSize) * nSrcYSize + WARP_EXTRA_ELTS);
+
     if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0)
     {
-        GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
-        if (psOptions->nBandCount == 1)
-        {
-            // Particular case to simplify the stack a bit.
-            eErr = poSrcDS->GetRasterBand(psOptions->panSrcBands[0])
-                       ->RasterIO(GF_Read, nSrcXOff, nSrcYOff, nSrcXSize,
-                                  nSrcYSize, oWK.papabySrcImage[0], nSrcXSize,
-                                  nSrcYSize, psOptions->eWorkingDataType, 0, 0,
-                                  nullptr);
-        }
-        else
-        {
-            eErr = poSrcDS->RasterIO(
-                GF_Read, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
-                oWK.papabySrcImage[0], nSrcXSize, nSrcYSize,
-                psOptions->eWorkingDataType, psOptions->nBandCount,
-                psOptions->panSrcBands, 0, 0,
-                nWordSize * (static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize +
-                             WARP_EXTRA_ELTS),
-                nullptr);
-        }
+        eErr = GDALWarpReadSrcWindow(psOptions, psPrivate,
+                                     oWK.papabySrcImage[0], nSrcBandSpace,
+                                     nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize);
     }
 
     ReportTiming("Input buffer read");
@@ -2121,11 +2445,11 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         int nValidityFlag = 0;
         if (eErr == CE_None)
-            eErr = GDALWarpCutlineMaskerEx(
-                psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
+            eErr = GDALWarpCutlineMaskerWithIndex(
+                psOptions,
+                GDALWarpGetCutlineIndex(psOptions, GetWarpPrivateData(this)),
                 oWK.nSrcXOff, oWK.nSrcYOff, oWK.nSrcXSize, oWK.nSrcYSize,
-                oWK.papabySrcImage, TRUE, oWK.pafUnifiedSrcDensity,
-                &nValidityFlag);
+                oWK.pafUnifiedSrcDensity, &nValidityFlag);
         if (nValidityFlag == GCMVF_CHUNK_FULLY_WITHIN_CUTLINE &&
             bUnifiedSrcDensityJustCreated)
         {
@@ -2145,10 +2469,14 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         eErr = CreateKernelMask(&oWK, 0 /* not used */, "DstDensity");
 
         if (eErr == CE_None)
+        {
+            CPLMutexHolderOptionalLockD(m_bConcurrentChunks ? hIOMutex
+                                                            : nullptr);
             eErr = GDALWarpDstAlphaMasker(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
                 oWK.papabyDstImage, TRUE, oWK.pafDstDensity);
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -2359,7 +2687,8 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hIOMutex);
+        if (!m_bConcurrentChunks)
+            CPLReleaseMutex(hIOMutex);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2397,7 +2726,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     if (hIOMutex != nullptr)
     {
         CPLReleaseMutex(hWarpMutex);
-        if (!CPLAcquireMutex(hIOMutex, 600.0))
+        if (!m_bConcurrentChunks && !CPLAcquireMutex(hIOMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire IOMutex in WarpRegion().");
@@ -2410,6 +2739,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None && psOptions->nDstAlphaBand > 0)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentChunks ? hIOMutex : nullptr);
         eErr = GDALWarpDstAlphaMasker(
             psOptions, -psOptions->nBandCount, psOptions->eWorkingDataType,
             oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
@@ -2419,7 +2749,16 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     /*      Cleanup.                                                        */
     /* -------------------------------------------------------------------- */
-    CPLFree(oWK.papabySrcImage[0]);
+    if (eErr == CE_None && psPrivate && nSrcXSize > 0 && nSrcYSize > 0)
+    {
+        GDALWarpStoreSrcWindow(psOptions, psPrivate, oWK.papabySrcImage[0],
+                               nSrcBandSpace, nSrcXOff, nSrcYOff, nSrcXSize,
+                               nSrcYSize);
+    }
+    else
+    {
+        CPLFree(oWK.papabySrcImage[0]);
+    }
     CPLFree(oWK.papabySrcImage);
     CPLFree(oWK.papabyDstImage);
 
@@ -54,6 +54,15 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start the generation at line lineIdx, previousLine being the values of
+    // line lineIdx - 1. This is used to process a horizontal band of the
+    // raster.
+    void setStartLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        std::copy(previousLine, previousLine + width_, previousLine_.begin());
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -31,6 +31,7 @@
 #include "ogr_core.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -174,47 +175,39 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oFirstEnum(
         nConnectedness);
 
-    CPLErr eErr = CE_None;
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszNumThreads);
+    // The second pass restarts the enumeration at the first line of each
+    // strip, to get the same polygon ids as the first pass.
+    const int nStripHeight =
+        GDALRasterPolygonEnumeratorT<DataType, EqualityTest>::GetStripHeight(
+            nYSize, nNumThreads);
 
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
+    CPLErr eErr = CE_None;
     {
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, eDT, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-
-        if (eErr != CE_None)
-            break;
-
-        if (iY == 0)
-            eErr = oFirstEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                          panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        else
-            eErr = oFirstEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                          panLastLineId, panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-
-        if (eErr != CE_None)
-            break;
-
-        // Swap lines.
-        std::swap(panLastLineVal, panThisLineVal);
-        std::swap(panLastLineId, panThisLineId);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Report progress, and support interrupts. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(0.10 * ((iY + 1) / static_cast<double>(nYSize)), "",
-                         pProgressArg))
+        std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)>
+            pScaledProgress(GDALCreateScaledProgress(0.0, 0.10, pfnProgress,
+                                                     pProgressArg),
+                            GDALDestroyScaledProgress);
+        const auto ReadLine = [hSrcBand, hMaskBand, nXSize, pabyMaskLine,
+                               eDT](int iY, DataType *panLineVal)
+        {
+            CPLErr eErrRead =
+                GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panLineVal,
+                             nXSize, 1, eDT, 0, 0);
+            if (eErrRead == CE_None && hMaskBand != nullptr)
+                eErrRead = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                                           panLineVal);
+            return eErrRead == CE_None;
+        };
+        if (!oFirstEnum.EnumerateByStrips(nXSize, nYSize, nStripHeight,
+                                          nNumThreads, ReadLine, nullptr,
+                                          GDALScaledProgress,
+                                          pScaledProgress.get()))
         {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
         }
     }
@@ -289,7 +282,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
                 panThisLineId[iX] =
                     decltype(oPolygonizer)::THE_OUTER_POLYGON_ID;
         }
-        else if (iY == 0)
+        else if ((iY % nStripHeight) == 0)
         {
             eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
                                            panThisLineId, nXSize)
@@ -489,6 +482,10 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.12): number of
+ * threads used to enumerate the polygons during the first pass, by strips of
+ * lines. Polygons are the same, but they may be written in a different order
+ * than with a single thread.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -563,6 +560,10 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.12): number of
+ * threads used to enumerate the polygons during the first pass, by strips of
+ * lines. Polygons are the same, but they may be written in a different order
+ * than with a single thread.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -15,20 +15,28 @@
 #include "cpl_port.h"
 #include "gdal_alg.h"
 
+#include <climits>
 #include <cmath>
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -344,6 +352,269 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                        GDALFillNodataTiled()                         */
+/************************************************************************/
+
+/** Multi-threaded implementation of GDALFillNodata() for a bounded search
+ * distance.
+ *
+ * A pixel is only interpolated from pixels within nMaxSearchDist, and each
+ * smoothing iteration extends that neighborhood by one pixel. So the raster
+ * can be processed by independent tiles, extended by a halo of
+ * nMaxSearchDist + nSmoothingIterations pixels, with the same result as the
+ * whole raster. As tiles are written to hTargetBand while other tiles are
+ * still reading their halo, the input values and mask are first copied to
+ * work files.
+ */
+static CPLErr GDALFillNodataTiled(GDALRasterBandH hTargetBand,
+                                  GDALRasterBandH hMaskBand,
+                                  double dfMaxSearchDist,
+                                  int nSmoothingIterations,
+                                  CSLConstList papszOptions, int nNumThreads,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+    const GDALDataType eDT = GDALGetRasterDataType(hTargetBand);
+    const int nHalo = static_cast<int>(std::min<double>(
+        INT_MAX / 8,
+        std::floor(dfMaxSearchDist) + std::max(0, nSmoothingIterations)));
+    const int nTileSize = std::max(1024, 4 * nHalo);
+    const int nTilesX = DIV_ROUND_UP(nXSize, nTileSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nTileSize);
+    const int nTiles = nTilesX * nTilesY;
+
+    GDALDriver *poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    const char *pszTmpFileDriver =
+        CSLFetchNameValueDef(papszOptions, "TEMP_FILE_DRIVER", "GTiff");
+    GDALDriver *poTmpDriver =
+        GetGDALDriverManager()->GetDriverByName(pszTmpFileDriver);
+    if (poMEMDriver == nullptr || poTmpDriver == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "MEM and TEMP_FILE_DRIVER=%s drivers must be registered",
+                 pszTmpFileDriver);
+        return CE_Failure;
+    }
+
+    if (hMaskBand == nullptr)
+        hMaskBand = GDALGetMaskBand(hTargetBand);
+
+    if (!pfnProgress(0.0, "Filling...", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Copy the input values and mask.                                 */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosWorkFileOptions;
+    if (EQUAL(pszTmpFileDriver, "GTiff"))
+    {
+        aosWorkFileOptions.SetNameValue("TILED", "YES");
+        aosWorkFileOptions.SetNameValue("COMPRESS", "LZW");
+        aosWorkFileOptions.SetNameValue("BIGTIFF", "IF_SAFER");
+    }
+    const CPLString osTmpFile = CPLGenerateTempFilenameSafe("");
+
+    std::unique_ptr<GDALDataset> poSrcDS(
+        poTmpDriver->Create((osTmpFile + "fill_src_work.tif").c_str(), nXSize,
+                            nYSize, 1, eDT, aosWorkFileOptions.List()));
+    std::unique_ptr<GDALDataset> poSrcMaskDS(poTmpDriver->Create(
+        (osTmpFile + "fill_srcmask_work.tif").c_str(), nXSize, nYSize, 1,
+        GDT_Byte, aosWorkFileOptions.List()));
+    if (poSrcDS == nullptr || poSrcMaskDS == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not create work files. Check driver capabilities.");
+        return CE_Failure;
+    }
+    poSrcDS->MarkSuppressOnClose();
+    poSrcMaskDS->MarkSuppressOnClose();
+
+    constexpr double COPY_RATIO = 0.1;
+    std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)> pScaledProgress(
+        GDALCreateScaledProgress(0.0, COPY_RATIO / 2, pfnProgress,
+                                 pProgressArg),
+        GDALDestroyScaledProgress);
+    if (GDALRasterBandCopyWholeRaster(
+            hTargetBand, GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(1)),
+            nullptr, GDALScaledProgress, pScaledProgress.get()) != CE_None)
+        return CE_Failure;
+    pScaledProgress.reset(GDALCreateScaledProgress(
+        COPY_RATIO / 2, COPY_RATIO, pfnProgress, pProgressArg));
+    if (GDALRasterBandCopyWholeRaster(
+            hMaskBand, GDALRasterBand::ToHandle(poSrcMaskDS->GetRasterBand(1)),
+            nullptr, GDALScaledProgress, pScaledProgress.get()) != CE_None)
+        return CE_Failure;
+
+    /* -------------------------------------------------------------------- */
+    /*      Process tiles.                                                  */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosTileOptions(CSLDuplicate(papszOptions));
+    aosTileOptions.SetNameValue("NUM_THREADS", nullptr);
+    aosTileOptions.SetNameValue("TEMP_FILE_DRIVER", "MEM");
+
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nTiles));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("GDAL",
+             "Filling nodata by %d tiles of %dx%d pixels with a halo of %d "
+             "pixels, with %d threads",
+             nTiles, nTileSize, nTileSize, nHalo, poQueue ? nThreads : 1);
+
+    GDALRasterBand *poTargetBand = GDALRasterBand::FromHandle(hTargetBand);
+    GDALRasterBand *poSrcBand = poSrcDS->GetRasterBand(1);
+    GDALRasterBand *poSrcMaskBand = poSrcMaskDS->GetRasterBand(1);
+    std::mutex oIOMutex;
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nTilesDone = 0;
+    int nJobsDone = 0;
+    std::atomic<int> nNextTile{0};
+    std::atomic<bool> bSuccess{true};
+    std::atomic<bool> bStop{false};
+    CPLErrorAccumulator oErrorAccumulator;
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDT);
+
+    const auto Job = [&]()
+    {
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            while (!bStop)
+            {
+                const int iTile = nNextTile++;
+                if (iTile >= nTiles)
+                    break;
+                const int nXOff = (iTile % nTilesX) * nTileSize;
+                const int nYOff = (iTile / nTilesX) * nTileSize;
+                const int nReqXSize = std::min(nTileSize, nXSize - nXOff);
+                const int nReqYSize = std::min(nTileSize, nYSize - nYOff);
+                const int nWinXOff = std::max(0, nXOff - nHalo);
+                const int nWinYOff = std::max(0, nYOff - nHalo);
+                const int nWinXSize =
+                    std::min(nXSize, nXOff + nReqXSize + nHalo) - nWinXOff;
+                const int nWinYSize =
+                    std::min(nYSize, nYOff + nReqYSize + nHalo) - nWinYOff;
+
+                std::unique_ptr<GDALDataset> poWinDS(poMEMDriver->Create(
+                    "", nWinXSize, nWinYSize, 1, eDT, nullptr));
+                std::unique_ptr<GDALDataset> poWinMaskDS(poMEMDriver->Create(
+                    "", nWinXSize, nWinYSize, 1, GDT_Byte, nullptr));
+                bool bOK = poWinDS && poWinMaskDS;
+                std::vector<GByte> abyBuffer;
+                if (bOK)
+                {
+                    try
+                    {
+                        abyBuffer.resize(static_cast<size_t>(nWinXSize) *
+                                         nWinYSize * nDTSize);
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Out of memory allocating tile buffer");
+                        bOK = false;
+                    }
+                }
+                if (bOK)
+                {
+                    std::lock_guard oLock(oIOMutex);
+                    bOK = poSrcBand->RasterIO(
+                              GF_Read, nWinXOff, nWinYOff, nWinXSize,
+                              nWinYSize, abyBuffer.data(), nWinXSize,
+                              nWinYSize, eDT, 0, 0, nullptr) == CE_None &&
+                          poWinDS->GetRasterBand(1)->RasterIO(
+                              GF_Write, 0, 0, nWinXSize, nWinYSize,
+                              abyBuffer.data(), nWinXSize, nWinYSize, eDT, 0,
+                              0, nullptr) == CE_None &&
+                          poSrcMaskBand->RasterIO(
+                              GF_Read, nWinXOff, nWinYOff, nWinXSize,
+                              nWinYSize, abyBuffer.data(), nWinXSize,
+                              nWinYSize, GDT_Byte, 0, 0, nullptr) == CE_None &&
+                          poWinMaskDS->GetRasterBand(1)->RasterIO(
+                              GF_Write, 0, 0, nWinXSize, nWinYSize,
+                              abyBuffer.data(), nWinXSize, nWinYSize, GDT_Byte,
+                              0, 0, nullptr) == CE_None;
+                }
+                bOK = bOK &&
+                      GDALFillNodata(
+                          GDALRasterBand::ToHandle(poWinDS->GetRasterBand(1)),
+                          GDALRasterBand::ToHandle(
+                              poWinMaskDS->GetRasterBand(1)),
+                          dfMaxSearchDist, 0, nSmoothingIterations,
+                          aosTileOptions.List(), nullptr, nullptr) == CE_None;
+                bOK = bOK &&
+                      poWinDS->GetRasterBand(1)->RasterIO(
+                          GF_Read, nXOff - nWinXOff, nYOff - nWinYOff,
+                          nReqXSize, nReqYSize, abyBuffer.data(), nReqXSize,
+                          nReqYSize, eDT, 0, 0, nullptr) == CE_None;
+                if (bOK)
+                {
+                    std::lock_guard oLock(oIOMutex);
+                    bOK = poTargetBand->RasterIO(
+                              GF_Write, nXOff, nYOff, nReqXSize, nReqYSize,
+                              abyBuffer.data(), nReqXSize, nReqYSize, eDT, 0,
+                              0, nullptr) == CE_None;
+                }
+                if (!bOK)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+                std::lock_guard oLock(oMutex);
+                ++nTilesDone;
+                oCV.notify_one();
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        ++nJobsDone;
+        oCV.notify_one();
+    };
+
+    const int nJobs = poQueue ? nThreads : 1;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue || !poQueue->SubmitJob(Job))
+            Job();
+    }
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nJobsDone < nJobs)
+        {
+            oCV.wait(oLock);
+            const double dfProgress =
+                COPY_RATIO +
+                (1 - COPY_RATIO) * static_cast<double>(nTilesDone) / nTiles;
+            oLock.unlock();
+            if (!bStop && !pfnProgress(dfProgress, "Filling...", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bSuccess = false;
+                bStop = true;
+            }
+            oLock.lock();
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    if (!bSuccess)
+        return CE_Failure;
+    pfnProgress(1.0, "Filling...", pProgressArg);
+    return CE_None;
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -384,6 +655,11 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.12). When set, and
+ * dfMaxSearchDist is not zero, the raster is processed by tiles, extended by a
+ * halo of dfMaxSearchDist + nSmoothingIterations pixels, that are filled in
+ * parallel. The result is the same as when processing the whole raster, but
+ * the input values and mask are first copied into work files.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -405,6 +681,22 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     const int nXSize = GDALGetRasterBandXSize(hTargetBand);
     const int nYSize = GDALGetRasterBandYSize(hTargetBand);
 
+    if (const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS"))
+    {
+        const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : atoi(pszNumThreads);
+        if (nNumThreads > 1 && dfMaxSearchDist > 0 &&
+            dfMaxSearchDist < std::max(nXSize, nYSize))
+        {
+            return GDALFillNodataTiled(
+                hTargetBand, hMaskBand, dfMaxSearchDist, nSmoothingIterations,
+                papszOptions, nNumThreads,
+                pfnProgress ? pfnProgress : GDALDummyProgress, pProgressArg);
+        }
+    }
+
     if (dfMaxSearchDist == 0.0)
         dfMaxSearchDist = std::max(nXSize, nYSize) + 1;
 
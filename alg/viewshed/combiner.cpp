@@ -4,8 +4,9 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "memdataset.h"
+
 #include "combiner.h"
-#include "util.h"
 
 namespace gdal
 {
@@ -15,35 +16,53 @@ namespace viewshed
 /// Read viewshed executor output and sum it up in our owned memory raster.
 void Combiner::run()
 {
-    DatasetPtr pTempDataset;
+    Cumulative::Result result;
 
-    while (m_inputQueue.pop(pTempDataset))
+    while (m_inputQueue.pop(result))
     {
-        if (!m_dataset)
-            m_dataset = std::move(pTempDataset);
-        else
-            sum(std::move(pTempDataset));
+        sum(std::move(result));
     }
     // Queue remaining summed rasters.
     queueOutputBuffer();
 }
 
 /// Add the values of the source dataset to those of the owned dataset.
-/// @param src  Source dataset.
-void Combiner::sum(DatasetPtr src)
+/// @param src  Observer result, covering a window of the output extent.
+void Combiner::sum(Cumulative::Result src)
 {
     if (!m_dataset)
     {
-        m_dataset = std::move(src);
-        return;
+        if (src.extent == m_extent)
+            m_dataset = std::move(src.dataset);
+        else
+        {
+            m_dataset.reset(MEMDataset::Create("", m_extent.xSize(),
+                                               m_extent.ySize(), 1, GDT_Byte,
+                                               nullptr));
+            if (!m_dataset)
+            {
+                m_inputQueue.stop();
+                return;
+            }
+        }
     }
-    size_t size = bandSize(*m_dataset->GetRasterBand(1));
 
-    uint8_t *dstP =
-        static_cast<uint8_t *>(m_dataset->GetInternalHandle("MEMORY1"));
-    uint8_t *srcP = static_cast<uint8_t *>(src->GetInternalHandle("MEMORY1"));
-    for (size_t i = 0; i < size; ++i)
-        *dstP++ += *srcP++;
+    if (src.dataset)
+    {
+        uint8_t *dstP =
+            static_cast<uint8_t *>(m_dataset->GetInternalHandle("MEMORY1"));
+        const uint8_t *srcP = static_cast<const uint8_t *>(
+            src.dataset->GetInternalHandle("MEMORY1"));
+        const int xSize = src.extent.xSize();
+        for (int y = src.extent.yStart; y < src.extent.yStop; ++y)
+        {
+            uint8_t *dstLine = dstP +
+                               static_cast<size_t>(y) * m_extent.xSize() +
+                               src.extent.xStart;
+            for (int x = 0; x < xSize; ++x)
+                *dstLine++ += *srcP++;
+        }
+    }
     // If we've seen 255 inputs, queue our raster for output and rollup since we might overflow
     // otherwise.
     if (++m_count == 255)
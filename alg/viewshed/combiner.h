@@ -22,11 +22,13 @@ class Combiner
 {
   public:
     /// Constructor
-    /// @param inputQueue  Reference to input queue of datasets
+    /// @param inputQueue  Reference to input queue of observer results
     /// @param outputQueue  Reference to output queue of datasets
-    Combiner(Cumulative::DatasetQueue &inputQueue,
-             Cumulative::DatasetQueue &outputQueue)
-        : m_inputQueue(inputQueue), m_outputQueue(outputQueue)
+    /// @param extent  Extent of the output datasets
+    Combiner(Cumulative::ResultQueue &inputQueue,
+             Cumulative::DatasetQueue &outputQueue, const Window &extent)
+        : m_inputQueue(inputQueue), m_outputQueue(outputQueue),
+          m_extent(extent)
     {
     }
 
@@ -34,7 +36,8 @@ class Combiner
     /// @param src  Source Combiner.
     // cppcheck-suppress missingMemberCopy
     Combiner(const Combiner &src)
-        : m_inputQueue(src.m_inputQueue), m_outputQueue(src.m_outputQueue)
+        : m_inputQueue(src.m_inputQueue), m_outputQueue(src.m_outputQueue),
+          m_extent(src.m_extent)
     {
     }
 
@@ -42,12 +45,13 @@ class Combiner
     void run();
 
   private:
-    Cumulative::DatasetQueue &m_inputQueue;
+    Cumulative::ResultQueue &m_inputQueue;
     Cumulative::DatasetQueue &m_outputQueue;
+    const Window m_extent;
     DatasetPtr m_dataset{};
     size_t m_count{0};
 
-    void sum(DatasetPtr srcDs);
+    void sum(Cumulative::Result src);
 };
 
 }  // namespace viewshed
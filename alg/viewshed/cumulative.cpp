@@ -9,6 +9,7 @@
 #include <thread>
 
 #include "cpl_worker_thread_pool.h"
+#include "gdal_priv_templates.hpp"
 #include "memdataset.h"
 
 #include "combiner.h"
@@ -33,7 +34,8 @@ Cumulative::Cumulative(const Options &opts) : m_opts(opts)
 ///
 Cumulative::~Cumulative() = default;
 
-/// Compute the cumulative viewshed of a raster band.
+/// Compute the cumulative viewshed of a raster band, from observers placed
+/// on a regular grid.
 ///
 /// @param srcFilename  Source filename.
 /// @param pfnProgress  Pointer to the progress function. Can be null.
@@ -42,17 +44,81 @@ Cumulative::~Cumulative() = default;
 bool Cumulative::run(const std::string &srcFilename,
                      GDALProgressFunc pfnProgress, void *pProgressArg)
 {
-    // In cumulative mode, we run the executors in normal mode and want "1" where things
-    // are visible.
-    m_opts.outputMode = OutputMode::Normal;
-    m_opts.visibleVal = 1;
+    DatasetPtr srcDS = openSource(srcFilename);
+    if (!srcDS)
+        return false;
+
+    // Make a bunch of observer locations based on the spacing and stick them on a queue
+    // to be handled by viewshed executors.
+    for (int x = 0; x < m_extent.xStop; x += m_opts.observerSpacing)
+        for (int y = 0; y < m_extent.yStop; y += m_opts.observerSpacing)
+            if (!addObserver(x, y, m_opts.observer.z))
+                return false;
+    m_observerQueue.done();
 
+    return process(srcFilename, *srcDS->GetRasterBand(1), pfnProgress,
+                   pProgressArg);
+}
+
+/// Compute the cumulative viewshed of a raster band, from a list of
+/// observers.
+///
+/// Observers are processed concurrently, sharing a single in-memory copy of
+/// the DEM when it fits in memory. When a maximum distance is set, the
+/// viewshed of each observer is only computed in the window of the cells
+/// within range.
+///
+/// @param srcFilename  Source filename.
+/// @param observers  Observer locations, in georeferenced coordinates. The Z
+///     value is the height of the observer above the DEM surface.
+/// @param pfnProgress  Pointer to the progress function. Can be null.
+/// @param pProgressArg  Argument passed to the progress function
+/// @return  True on success, false otherwise.
+bool Cumulative::run(const std::string &srcFilename,
+                     const std::vector<Point> &observers,
+                     GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    DatasetPtr srcDS = openSource(srcFilename);
+    if (!srcDS)
+        return false;
+    if (!m_hasInvGT)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
+        return false;
+    }
+
+    for (const Point &observer : observers)
+    {
+        double dfX, dfY;
+        m_invGT.Apply(observer.x, observer.y, &dfX, &dfY);
+        if (!GDALIsValueInRange<int>(dfX) || !GDALIsValueInRange<int>(dfY))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Observer (%f,%f) out of range", observer.x, observer.y);
+            return false;
+        }
+        if (!addObserver(static_cast<int>(dfX), static_cast<int>(dfY),
+                         observer.z))
+            return false;
+    }
+    m_observerQueue.done();
+
+    return process(srcFilename, *srcDS->GetRasterBand(1), pfnProgress,
+                   pProgressArg);
+}
+
+/// Open the source dataset and set the output extent from it.
+///
+/// @param srcFilename  Source filename.
+/// @return  The source dataset, or null on error.
+DatasetPtr Cumulative::openSource(const std::string &srcFilename)
+{
     DatasetPtr srcDS(
         GDALDataset::FromHandle(GDALOpen(srcFilename.c_str(), GA_ReadOnly)));
     if (!srcDS)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Unable open source file.");
-        return false;
+        return nullptr;
     }
 
     GDALRasterBand *pSrcBand = srcDS->GetRasterBand(1);
@@ -61,20 +127,67 @@ bool Cumulative::run(const std::string &srcFilename,
     m_extent.xStop = GDALGetRasterBandXSize(pSrcBand);
     m_extent.yStop = GDALGetRasterBandYSize(pSrcBand);
 
-    // Make a bunch of observer locations based on the spacing and stick them on a queue
-    // to be handled by viewshed executors.
-    for (int x = 0; x < m_extent.xStop; x += m_opts.observerSpacing)
-        for (int y = 0; y < m_extent.yStop; y += m_opts.observerSpacing)
-            m_observerQueue.push({x, y});
-    m_observerQueue.done();
+    GDALGeoTransform gt;
+    m_hasInvGT = srcDS->GetGeoTransform(gt) == CE_None &&
+                 gt.GetInverse(m_invGT);
+    return srcDS;
+}
+
+/// Queue an observer for processing.
+///
+/// @param x  X coordinate of the observer, in pixels.
+/// @param y  Y coordinate of the observer, in pixels.
+/// @param z  Height of the observer.
+/// @return  True on success, false otherwise.
+bool Cumulative::addObserver(int x, int y, double z)
+{
+    Window extent = m_extent;
+    if (m_opts.maxDistance > 0)
+    {
+        if (!m_hasInvGT)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot invert geotransform");
+            return false;
+        }
+        extent = maxDistanceWindow(m_extent, x, y, m_opts.maxDistance,
+                                   m_invGT);
+        // Nothing in range: the observer doesn't contribute.
+        if (extent.xSize() <= 0 || extent.ySize() <= 0)
+            return true;
+    }
+    m_observerQueue.push({x, y, z, extent});
+    m_lineCount += extent.ySize();
+    return true;
+}
+
+/// Run the executors on the queued observers and write the output.
+///
+/// @param srcFilename  Source filename.
+/// @param srcBand  Source band.
+/// @param pfnProgress  Pointer to the progress function. Can be null.
+/// @param pProgressArg  Argument passed to the progress function
+/// @return  True on success, false otherwise.
+bool Cumulative::process(const std::string &srcFilename,
+                         GDALRasterBand &srcBand, GDALProgressFunc pfnProgress,
+                         void *pProgressArg)
+{
+    // In cumulative mode, we run the executors in normal mode and want "1" where things
+    // are visible.
+    m_opts.outputMode = OutputMode::Normal;
+    m_opts.visibleVal = 1;
+    m_opts.invisibleVal = 0;
+    m_opts.outOfRangeVal = 0;
+
+    if (!loadDEM(srcBand))
+        return false;
 
     // Run executors.
     const int numThreads = m_opts.numJobs;
     std::atomic<bool> err = false;
     std::atomic<int> running = numThreads;
     std::atomic<bool> hasFoundNoData = false;
-    Progress progress(pfnProgress, pProgressArg,
-                      m_observerQueue.size() * m_extent.ySize());
+    Progress progress(pfnProgress, pProgressArg, m_lineCount);
     CPLWorkerThreadPool executorPool(numThreads);
     for (int i = 0; i < numThreads; ++i)
         executorPool.SubmitJob(
@@ -85,8 +198,8 @@ bool Cumulative::run(const std::string &srcFilename,
 
     // Run combiners that create 8-bit sums of executor jobs.
     CPLWorkerThreadPool combinerPool(numThreads);
-    std::vector<Combiner> combiners(numThreads,
-                                    Combiner(m_datasetQueue, m_rollupQueue));
+    std::vector<Combiner> combiners(
+        numThreads, Combiner(m_datasetQueue, m_rollupQueue, m_extent));
     for (Combiner &c : combiners)
         combinerPool.SubmitJob([&c] { c.run(); });
 
@@ -96,7 +209,11 @@ bool Cumulative::run(const std::string &srcFilename,
     // When the combiner jobs are done, all the data is in the rollup queue.
     combinerPool.WaitCompletion();
     if (m_datasetQueue.isStopped())
+    {
+        m_rollupQueue.done();
+        sum.join();
         return false;
+    }
     m_rollupQueue.done();
 
     // Wait for finalBuf to be fully filled.
@@ -114,7 +231,7 @@ bool Cumulative::run(const std::string &srcFilename,
 
     // Scale the data so that we can write an 8-bit raster output.
     scaleOutput();
-    if (!writeOutput(createOutputDataset(*pSrcBand, m_opts, m_extent)))
+    if (!writeOutput(createOutputDataset(srcBand, m_opts, m_extent)))
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Unable to write to output file.");
@@ -125,6 +242,64 @@ bool Cumulative::run(const std::string &srcFilename,
     return true;
 }
 
+/// Load the DEM in memory, so that the executors don't need to read it from
+/// the source file for each observer. Nothing is done if it would use more
+/// than half of the usable RAM.
+///
+/// @param srcBand  Source band.
+/// @return  False if reading the DEM failed, true otherwise.
+bool Cumulative::loadDEM(GDALRasterBand &srcBand)
+{
+    m_demType = srcBand.GetRasterDataType();
+    const size_t dataSize = GDALGetDataTypeSizeBytes(m_demType);
+    const GIntBig usableRAM = CPLGetUsablePhysicalRAM();
+    if (usableRAM <= 0 ||
+        m_extent.size() > static_cast<GUIntBig>(usableRAM) / 2 / dataSize)
+    {
+        CPLDebug("VIEWSHED", "DEM too large to be loaded in memory");
+        return true;
+    }
+    m_demData.reset(
+        static_cast<GByte *>(VSIMalloc2(m_extent.size(), dataSize)));
+    if (!m_demData)
+    {
+        CPLDebug("VIEWSHED", "Cannot allocate memory for the DEM");
+        return true;
+    }
+    if (srcBand.RasterIO(GF_Read, 0, 0, m_extent.xSize(), m_extent.ySize(),
+                         m_demData.get(), m_extent.xSize(), m_extent.ySize(),
+                         m_demType, 0, 0, nullptr) != CE_None)
+        return false;
+
+    srcBand.GetDataset()->GetGeoTransform(m_demGT);
+    int hasNoData = false;
+    m_demNoData = srcBand.GetNoDataValue(&hasNoData);
+    m_demHasNoData = hasNoData;
+    return true;
+}
+
+/// Open the source dataset of an executor: a dataset over the in-memory copy
+/// of the DEM if available, the source file otherwise.
+///
+/// @param srcFilename  Source filename.
+/// @return  The dataset, or null on error.
+DatasetPtr Cumulative::openExecutorSource(const std::string &srcFilename)
+{
+    if (!m_demData)
+        return DatasetPtr(GDALDataset::Open(srcFilename.c_str(), GA_ReadOnly));
+
+    std::unique_ptr<MEMDataset> memDS(MEMDataset::Create(
+        "", m_extent.xSize(), m_extent.ySize(), 0, GDT_Byte, nullptr));
+    if (!memDS)
+        return nullptr;
+    memDS->SetGeoTransform(m_demGT);
+    memDS->AddMEMBand(MEMCreateRasterBandEx(memDS.get(), 1, m_demData.get(),
+                                            m_demType, 0, 0, FALSE));
+    if (m_demHasNoData)
+        memDS->GetRasterBand(1)->SetNoDataValue(m_demNoData);
+    return memDS;
+}
+
 /// Run an executor (single viewshed)
 /// @param srcFilename  Source filename
 /// @param progress  Progress supporting support.
@@ -135,31 +310,37 @@ void Cumulative::runExecutor(const std::string &srcFilename, Progress &progress,
                              std::atomic<bool> &err, std::atomic<int> &running,
                              std::atomic<bool> &hasFoundNoData)
 {
-    DatasetPtr srcDs(GDALDataset::Open(srcFilename.c_str(), GA_ReadOnly));
+    DatasetPtr srcDs = openExecutorSource(srcFilename);
     if (!srcDs)
     {
         err = true;
     }
     else
     {
+        // Observers may have different heights.
+        Options opts = m_opts;
         Location loc;
         while (!err && m_observerQueue.pop(loc))
         {
-            DatasetPtr dstDs(MEMDataset::Create(
-                "", m_extent.xSize(), m_extent.ySize(), 1, GDT_Byte, nullptr));
+            DatasetPtr dstDs(MEMDataset::Create("", loc.extent.xSize(),
+                                                loc.extent.ySize(), 1,
+                                                GDT_Byte, nullptr));
             if (!dstDs)
             {
                 err = true;
             }
             else
             {
+                Window curExtent = loc.extent;
+                curExtent.shiftX(-loc.extent.xStart);
+                opts.observer.z = loc.z;
                 ViewshedExecutor executor(
                     *srcDs->GetRasterBand(1), *dstDs->GetRasterBand(1), loc.x,
-                    loc.y, m_extent, m_extent, m_opts, progress,
+                    loc.y, loc.extent, curExtent, opts, progress,
                     /* emitWarningIfNoData = */ false);
                 err = !executor.run();
                 if (!err)
-                    m_datasetQueue.push(std::move(dstDs));
+                    m_datasetQueue.push({std::move(dstDs), loc.extent});
                 if (executor.hasFoundNoData())
                 {
                     hasFoundNoData = true;
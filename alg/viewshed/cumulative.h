@@ -10,6 +10,8 @@
 #include <atomic>
 #include <vector>
 
+#include "cpl_vsi.h"
+
 #include "notifyqueue.h"
 #include "progress.h"
 #include "viewshed_types.h"
@@ -34,6 +36,10 @@ class Cumulative
     CPL_DLL bool run(const std::string &srcFilename,
                      GDALProgressFunc pfnProgress = GDALDummyProgress,
                      void *pProgressArg = nullptr);
+    CPL_DLL bool run(const std::string &srcFilename,
+                     const std::vector<Point> &observers,
+                     GDALProgressFunc pfnProgress = GDALDummyProgress,
+                     void *pProgressArg = nullptr);
 
   private:
     friend class Combiner;  // Provides access to the queue types.
@@ -42,19 +48,45 @@ class Cumulative
     {
         int x;
         int y;
+        double z;       // Height of the observer.
+        Window extent;  // Cells that may be visible from the observer.
+    };
+
+    /// Output of the viewshed of an observer.
+    struct Result
+    {
+        DatasetPtr dataset{};
+        Window extent{};
     };
 
     using Buf32 = std::vector<uint32_t>;
     using ObserverQueue = NotifyQueue<Location>;
+    using ResultQueue = NotifyQueue<Result>;
     using DatasetQueue = NotifyQueue<DatasetPtr>;
 
     Window m_extent{};
     Options m_opts;
+    GDALGeoTransform m_invGT{};
+    bool m_hasInvGT{false};
+    size_t m_lineCount{0};
     ObserverQueue m_observerQueue{};
-    DatasetQueue m_datasetQueue{};
+    ResultQueue m_datasetQueue{};
     DatasetQueue m_rollupQueue{};
     Buf32 m_finalBuf{};
 
+    // Copy of the DEM shared by the executors, if it fits in memory.
+    std::unique_ptr<GByte, VSIFreeReleaser> m_demData{};
+    GDALDataType m_demType{GDT_Unknown};
+    GDALGeoTransform m_demGT{};
+    bool m_demHasNoData{false};
+    double m_demNoData{0};
+
+    DatasetPtr openSource(const std::string &srcFilename);
+    bool addObserver(int x, int y, double z);
+    bool process(const std::string &srcFilename, GDALRasterBand &srcBand,
+                 GDALProgressFunc pfnProgress, void *pProgressArg);
+    bool loadDEM(GDALRasterBand &srcBand);
+    DatasetPtr openExecutorSource(const std::string &srcFilename);
     void runExecutor(const std::string &srcFilename, Progress &progress,
                      std::atomic<bool> &err, std::atomic<int> &running,
                      std::atomic<bool> &hasFoundNoData);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
@@ -191,6 +192,50 @@ size_t bandSize(GDALRasterBand &band)
     return static_cast<size_t>(band.GetXSize()) * band.GetYSize();
 }
 
+/// Restrict a window to the cells that may be within a maximum distance of
+/// an observer.
+///
+/// @param  extent  Window to restrict.
+/// @param  nX  X coordinate of the observer.
+/// @param  nY  Y coordinate of the observer.
+/// @param  maxDistance  Maximum distance from the observer, in SRS units.
+/// @param  invGT  Inverse geotransform of the raster.
+/// @return  The restricted window, empty if it doesn't intersect `extent`.
+Window maxDistanceWindow(const Window &extent, int nX, int nY,
+                         double maxDistance, const GDALGeoTransform &invGT)
+{
+    constexpr double EPSILON = 1e-8;
+
+    //ABELL - This assumes that the transformation is only a scaling. Should be fixed.
+    //  Find the distance in the direction of the transformed unit vector in the X and Y
+    //  directions and use those factors to determine the limiting values in the raster space.
+    int nXStart =
+        static_cast<int>(std::floor(nX - invGT[1] * maxDistance + EPSILON));
+    int nXStop = static_cast<int>(
+        std::ceil(nX + invGT[1] * maxDistance - EPSILON) + 1);
+    //ABELL - These seem to be wrong. The transform of 1 is no transform, so not
+    //  sure why we're adding one in the first case. Really, the transformed distance
+    // should add EPSILON. Not sure what the change should be for a negative transform,
+    // which is what I think is being handled with the 1/0 addition/subtraction.
+    int nYStart = static_cast<int>(std::floor(
+                      nY - std::fabs(invGT[5]) * maxDistance + EPSILON)) -
+                  (invGT[5] > 0 ? 1 : 0);
+    int nYStop = static_cast<int>(
+        std::ceil(nY + std::fabs(invGT[5]) * maxDistance - EPSILON) +
+        (invGT[5] < 0 ? 1 : 0));
+
+    if (nXStart >= extent.xStop || nXStop < extent.xStart ||
+        nYStart >= extent.yStop || nYStop < extent.yStart)
+        return Window();
+
+    Window win;
+    win.xStart = std::max(nXStart, extent.xStart);
+    win.xStop = std::min(nXStop, extent.xStop);
+    win.yStart = std::max(nYStart, extent.yStart);
+    win.yStop = std::min(nYStop, extent.yStop);
+    return win;
+}
+
 /// Create the output dataset.
 ///
 /// @param  srcBand  Source raster band.
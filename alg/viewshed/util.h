@@ -23,6 +23,8 @@ int vIntersect(double angle, int nX, int nY, int x);
 int vIntersect(double angle, int nX, int nY, const Window &win);
 bool rayBetween(double start, double end, double test);
 size_t bandSize(GDALRasterBand &band);
+Window maxDistanceWindow(const Window &extent, int nX, int nY,
+                         double maxDistance, const GDALGeoTransform &invGT);
 
 DatasetPtr createOutputDataset(GDALRasterBand &srcBand, const Options &opts,
                                const Window &extent);
@@ -309,43 +309,9 @@ bool Viewshed::calcExtents(int nX, int nY, const GDALGeoTransform &invGT)
                  "NOTE: The observer location falls outside of the DEM area");
     }
 
-    constexpr double EPSILON = 1e-8;
     if (oOpts.maxDistance > 0)
-    {
-        //ABELL - This assumes that the transformation is only a scaling. Should be fixed.
-        //  Find the distance in the direction of the transformed unit vector in the X and Y
-        //  directions and use those factors to determine the limiting values in the raster space.
-        int nXStart = static_cast<int>(
-            std::floor(nX - invGT[1] * oOpts.maxDistance + EPSILON));
-        int nXStop = static_cast<int>(
-            std::ceil(nX + invGT[1] * oOpts.maxDistance - EPSILON) + 1);
-        //ABELL - These seem to be wrong. The transform of 1 is no transform, so not
-        //  sure why we're adding one in the first case. Really, the transformed distance
-        // should add EPSILON. Not sure what the change should be for a negative transform,
-        // which is what I think is being handled with the 1/0 addition/subtraction.
-        int nYStart =
-            static_cast<int>(std::floor(
-                nY - std::fabs(invGT[5]) * oOpts.maxDistance + EPSILON)) -
-            (invGT[5] > 0 ? 1 : 0);
-        int nYStop = static_cast<int>(
-            std::ceil(nY + std::fabs(invGT[5]) * oOpts.maxDistance - EPSILON) +
-            (invGT[5] < 0 ? 1 : 0));
-
-        // If the limits are invalid, set the window size to zero to trigger the error below.
-        if (nXStart >= oOutExtent.xStop || nXStop < 0 ||
-            nYStart >= oOutExtent.yStop || nYStop < 0)
-        {
-            oOutExtent = Window();
-        }
-        else
-        {
-            oOutExtent.xStart = std::max(nXStart, 0);
-            oOutExtent.xStop = std::min(nXStop, oOutExtent.xStop);
-
-            oOutExtent.yStart = std::max(nYStart, 0);
-            oOutExtent.yStop = std::min(nYStop, oOutExtent.yStop);
-        }
-    }
+        oOutExtent =
+            maxDistanceWindow(oOutExtent, nX, nY, oOpts.maxDistance, invGT);
 
     if (oOutExtent.xSize() == 0 || oOutExtent.ySize() == 0)
     {
@@ -19,15 +19,20 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
@@ -107,6 +112,10 @@ struct GDALFootprintOptions
     bool bAbsolutePath = false;
 
     std::string osSrcNoData{};
+
+    /*! Number of threads used to read the source mask, or ALL_CPUS. Empty
+     * to use GDAL_NUM_THREADS */
+    std::string osNumThreads{};
 };
 
 static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
@@ -249,6 +258,22 @@ static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
         .store_into(psOptions->osDestLayerName)
         .help(_("Name of the target layer."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                    CPLGetValueType(s.c_str()) != CPL_VALUE_INTEGER)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of threads used to read the source mask, or "
+                "ALL_CPUS."));
+
     if (psOptionsForBinary)
     {
         argParser->add_argument("-overwrite")
@@ -818,30 +843,25 @@ static double GetMinDistanceBetweenTwoPoints(const OGRGeometry *poGeom)
 }
 
 /************************************************************************/
-/*                       GDALFootprintProcess()                         */
+/*                     GDALFootprintMaskBandHolder                      */
 /************************************************************************/
 
-static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
-                                 const GDALFootprintOptions *psOptions)
+/** Band on which GDALPolygonize() is run, and the temporary bands it may
+ * reference */
+struct GDALFootprintMaskBandHolder
 {
-    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
-    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
-    if (!psOptions->oOutputSRS.IsEmpty())
-        poDstSRS = &(psOptions->oOutputSRS);
-    if (poDstSRS)
-    {
-        auto poSrcSRS = poSrcDS->GetSpatialRef();
-        if (!poSrcSRS)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Output layer has CRS, but input is not georeferenced");
-            return false;
-        }
-        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
-        if (!poCT_SRS)
-            return false;
-    }
+    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands{};
+    std::unique_ptr<GDALRasterBand> poMaskForRasterize{};
+};
 
+/************************************************************************/
+/*                     GDALFootprintBuildMaskBand()                     */
+/************************************************************************/
+
+static bool GDALFootprintBuildMaskBand(GDALDataset *poSrcDS,
+                                       const GDALFootprintOptions *psOptions,
+                                       GDALFootprintMaskBandHolder &oHolder)
+{
     std::vector<int> anBands = psOptions->anBands;
     const int nBandCount = poSrcDS->GetRasterCount();
     if (anBands.empty())
@@ -870,7 +890,6 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         }
     }
     bool bGlobalMask = true;
-    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
     for (size_t i = 0; i < anBands.size(); ++i)
     {
         const int nBand = anBands[i];
@@ -884,11 +903,12 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         if (!adfSrcNoData.empty())
         {
             bGlobalMask = false;
-            apoTmpNoDataMaskBands.emplace_back(
+            oHolder.apoTmpNoDataMaskBands.emplace_back(
                 std::make_unique<GDALNoDataMaskBand>(
                     poBand, adfSrcNoData.size() == 1 ? adfSrcNoData[0]
                                                      : adfSrcNoData[i]));
-            apoSrcMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
+            apoSrcMaskBands.push_back(
+                oHolder.apoTmpNoDataMaskBands.back().get());
         }
         else
         {
@@ -975,11 +995,296 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         }
     }
 
+    if (bGlobalMask || anBands.size() == 1)
+    {
+        oHolder.poMaskForRasterize =
+            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
+    }
+    else
+    {
+        oHolder.poMaskForRasterize =
+            std::make_unique<GDALFootprintCombinedMaskBand>(
+                apoSrcMaskBands, psOptions->bCombineBandsUnion);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALFootprintParallelMaskBand                     */
+/************************************************************************/
+
+// Band returning the values of the band built by GDALFootprintBuildMaskBand()
+// on a thread-safe version of the source dataset, whose strips are read
+// ahead by worker threads. Reading and decoding the source pixels is what
+// dominates the computation of the footprint of large rasters, whereas the
+// tracing of polygons by GDALPolygonize() is comparatively cheap, so
+// parallelizing the former gives the speedup while the result is unchanged.
+class GDALFootprintParallelMaskBand final : public GDALRasterBand
+{
+  public:
+    static std::unique_ptr<GDALRasterBand>
+    Create(GDALDataset *poSrcDS, const GDALFootprintOptions *psOptions,
+           GDALRasterBand *poMaskBand, int nNumThreads);
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) override;
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    struct Strip
+    {
+        std::vector<GByte> abyData{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        bool bOK = false;
+        bool bDone = false;
+    };
+
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> m_poTSDS;
+    const GDALFootprintOptions *const m_psOptions;
+    const int m_nStripHeight;
+    const int m_nMaxStripsAhead;
+    const CPLStringList m_aosThreadLocalConfigOptions;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<int, std::shared_ptr<Strip>> m_oMapStrips{};
+    std::shared_ptr<Strip> m_poCurStrip{};
+    int m_nCurStrip = -1;
+    // Must be declared last, so that pending jobs are completed before
+    // the above members are destroyed
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool;
+
+    GDALFootprintParallelMaskBand(
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS,
+        const GDALFootprintOptions *psOptions, int nXSize, int nYSize,
+        int nStripHeight, int nMaxStripsAhead,
+        std::unique_ptr<CPLWorkerThreadPool> poPool)
+        : m_poTSDS(std::move(poTSDS)), m_psOptions(psOptions),
+          m_nStripHeight(nStripHeight), m_nMaxStripsAhead(nMaxStripsAhead),
+          m_aosThreadLocalConfigOptions(CPLGetThreadLocalConfigOptions()),
+          m_poPool(std::move(poPool))
+    {
+        nRasterXSize = nXSize;
+        nRasterYSize = nYSize;
+        eDataType = GDT_Byte;
+        nBlockXSize = nXSize;
+        nBlockYSize = 1;
+    }
+
+    void ReadStrip(int iStrip, Strip &oStrip) const;
+    const Strip *GetStrip(int iStrip);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALFootprintParallelMaskBand)
+};
+
+/* static */ std::unique_ptr<GDALRasterBand>
+GDALFootprintParallelMaskBand::Create(GDALDataset *poSrcDS,
+                                      const GDALFootprintOptions *psOptions,
+                                      GDALRasterBand *poMaskBand,
+                                      int nNumThreads)
+{
+    const int nXSize = poMaskBand->GetXSize();
+    const int nYSize = poMaskBand->GetYSize();
+
+    // Strips are a whole number of blocks high, and at least 1 MB large, so
+    // that each job amortizes its setup.
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poMaskBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    const int nMinLines =
+        static_cast<int>(std::min<GIntBig>(nYSize, 1 + (1024 * 1024) / nXSize));
+    const int nStripHeight = static_cast<int>(std::min<GIntBig>(
+        nYSize,
+        static_cast<GIntBig>(DIV_ROUND_UP(nMinLines, nBlockYSize)) *
+            nBlockYSize));
+    if (nStripHeight >= nYSize)
+        return nullptr;
+
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poTSDS.reset(GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER));
+    }
+    if (!poTSDS)
+    {
+        CPLDebug("GDAL_FOOTPRINT",
+                 "Cannot get a thread-safe version of %s. Using a single "
+                 "thread",
+                 poSrcDS->GetDescription());
+        return nullptr;
+    }
+
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripHeight);
+    auto poPool = std::make_unique<CPLWorkerThreadPool>();
+    if (!poPool->Setup(std::min(nNumThreads, nStrips), nullptr, nullptr))
+        return nullptr;
+
+    // Bound the memory used by strips read ahead to about 256 MB, while
+    // keeping all threads busy.
+    const GIntBig nStripSize = static_cast<GIntBig>(nXSize) * nStripHeight;
+    const int nThreads = poPool->GetThreadCount();
+    const int nMaxStripsAhead = static_cast<int>(std::max<GIntBig>(
+        nThreads,
+        std::min<GIntBig>(2 * nThreads, (256 * 1024 * 1024) / nStripSize)));
+
+    return std::unique_ptr<GDALRasterBand>(new GDALFootprintParallelMaskBand(
+        std::move(poTSDS), psOptions, nXSize, nYSize, nStripHeight,
+        nMaxStripsAhead, std::move(poPool)));
+}
+
+void GDALFootprintParallelMaskBand::ReadStrip(int iStrip, Strip &oStrip) const
+{
+    // Each job builds its own mask band, as the temporary bands it may
+    // reference are not thread-safe.
+    GDALFootprintMaskBandHolder oHolder;
+    if (!GDALFootprintBuildMaskBand(m_poTSDS.get(), m_psOptions, oHolder))
+        return;
+
+    const int nYOff = iStrip * m_nStripHeight;
+    const int nLines = std::min(m_nStripHeight, nRasterYSize - nYOff);
+    try
+    {
+        oStrip.abyData.resize(static_cast<size_t>(nRasterXSize) * nLines);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate strip of footprint mask");
+        return;
+    }
+    oStrip.bOK = oHolder.poMaskForRasterize->RasterIO(
+                     GF_Read, 0, nYOff, nRasterXSize, nLines,
+                     oStrip.abyData.data(), nRasterXSize, nLines, GDT_Byte, 1,
+                     nRasterXSize, nullptr) == CE_None;
+}
+
+const GDALFootprintParallelMaskBand::Strip *
+GDALFootprintParallelMaskBand::GetStrip(int iStrip)
+{
+    if (iStrip == m_nCurStrip)
+        return m_poCurStrip->bOK ? m_poCurStrip.get() : nullptr;
+
+    // GDALPolygonize() reads lines in increasing order, so strips before the
+    // requested one are no longer needed.
+    m_oMapStrips.erase(m_oMapStrips.begin(), m_oMapStrips.lower_bound(iStrip));
+
+    const int nStrips = DIV_ROUND_UP(nRasterYSize, m_nStripHeight);
+    for (int i = iStrip; i < nStrips && i <= iStrip + m_nMaxStripsAhead; ++i)
+    {
+        if (m_oMapStrips.find(i) != m_oMapStrips.end())
+            continue;
+        auto poStrip = std::make_shared<Strip>();
+        m_oMapStrips[i] = poStrip;
+        m_poPool->SubmitJob(
+            [this, i, poStrip]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    m_aosThreadLocalConfigOptions.List());
+                {
+                    auto oAccumulator =
+                        poStrip->oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    ReadStrip(i, *poStrip);
+                }
+                CPLSetThreadLocalConfigOptions(nullptr);
+                std::lock_guard oLock(m_oMutex);
+                poStrip->bDone = true;
+                m_oCV.notify_all();
+            });
+    }
+
+    m_poCurStrip = m_oMapStrips[iStrip];
+    m_nCurStrip = iStrip;
+    {
+        std::unique_lock oLock(m_oMutex);
+        m_oCV.wait(oLock, [this] { return m_poCurStrip->bDone; });
+    }
+    // Emit errors and warnings from the calling thread
+    m_poCurStrip->oErrorAccumulator.ReplayErrors();
+    return m_poCurStrip->bOK ? m_poCurStrip.get() : nullptr;
+}
+
+CPLErr GDALFootprintParallelMaskBand::IReadBlock(int /* nBlockXOff */,
+                                                 int nBlockYOff, void *pData)
+{
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    return IRasterIO(GF_Read, 0, nBlockYOff, nRasterXSize, 1, pData,
+                     nRasterXSize, 1, GDT_Byte, 1, nRasterXSize, &sExtraArg);
+}
+
+CPLErr GDALFootprintParallelMaskBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        (eBufType == GDT_Byte || eBufType == GDT_Int64) &&
+        nPixelSpace == GDALGetDataTypeSizeBytes(eBufType))
+    {
+        // Requests of GDALPolygonize(), as the mask and the value band
+        GByte *pabyDst = static_cast<GByte *>(pData);
+        for (int iY = 0; iY < nYSize; ++iY, pabyDst += nLineSpace)
+        {
+            const int nLine = nYOff + iY;
+            const Strip *poStrip = GetStrip(nLine / m_nStripHeight);
+            if (!poStrip)
+                return CE_Failure;
+            const GByte *pabySrc =
+                poStrip->abyData.data() +
+                static_cast<size_t>(nLine % m_nStripHeight) * nRasterXSize +
+                nXOff;
+            GDALCopyWords(pabySrc, GDT_Byte, 1, pabyDst, eBufType,
+                          static_cast<int>(nPixelSpace), nXSize);
+        }
+        return CE_None;
+    }
+
+    return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                       GDALFootprintProcess()                         */
+/************************************************************************/
+
+static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
+                                 const GDALFootprintOptions *psOptions)
+{
+    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
+    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
+    if (!psOptions->oOutputSRS.IsEmpty())
+        poDstSRS = &(psOptions->oOutputSRS);
+    if (poDstSRS)
+    {
+        auto poSrcSRS = poSrcDS->GetSpatialRef();
+        if (!poSrcSRS)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Output layer has CRS, but input is not georeferenced");
+            return false;
+        }
+        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
+        if (!poCT_SRS)
+            return false;
+    }
+
+    GDALFootprintMaskBandHolder oHolder;
+    if (!GDALFootprintBuildMaskBand(poSrcDS, psOptions, oHolder))
+        return false;
+
     std::unique_ptr<OGRCoordinateTransformation> poCT_GT;
     GDALGeoTransform gt;
     if (psOptions->bOutCSGeoref && poSrcDS->GetGeoTransform(gt) == CE_None)
     {
-        auto poMaskBand = apoSrcMaskBands[0];
+        auto poMaskBand = oHolder.poMaskForRasterize.get();
         gt.Rescale(double(poSrcDS->GetRasterXSize()) / poMaskBand->GetXSize(),
                    double(poSrcDS->GetRasterYSize()) / poMaskBand->GetYSize());
         poCT_GT = std::make_unique<GeoTransformCoordinateTransformation>(gt);
@@ -995,7 +1300,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
     {
         // Transform from overview pixel coordinates to full resolution
         // pixel coordinates
-        auto poMaskBand = apoSrcMaskBands[0];
+        auto poMaskBand = oHolder.poMaskForRasterize.get();
         gt[1] = double(poSrcDS->GetRasterXSize()) / poMaskBand->GetXSize();
         gt[2] = 0;
         gt[4] = 0;
@@ -1003,19 +1308,23 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         poCT_GT = std::make_unique<GeoTransformCoordinateTransformation>(gt);
     }
 
-    std::unique_ptr<GDALRasterBand> poMaskForRasterize;
-    if (bGlobalMask || anBands.size() == 1)
-    {
-        poMaskForRasterize =
-            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
-    }
-    else
+    std::unique_ptr<GDALRasterBand> poParallelMaskBand;
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : std::clamp(atoi(pszNumThreads), 1, 1024);
+    if (nNumThreads > 1)
     {
-        poMaskForRasterize = std::make_unique<GDALFootprintCombinedMaskBand>(
-            apoSrcMaskBands, psOptions->bCombineBandsUnion);
+        poParallelMaskBand = GDALFootprintParallelMaskBand::Create(
+            poSrcDS, psOptions, oHolder.poMaskForRasterize.get(), nNumThreads);
     }
 
-    auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
+    auto hBand = GDALRasterBand::ToHandle(
+        poParallelMaskBand ? poParallelMaskBand.get()
+                           : oHolder.poMaskForRasterize.get());
     auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
     const CPLErr eErr =
         GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
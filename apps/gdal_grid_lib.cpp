@@ -29,6 +29,7 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
@@ -294,6 +295,447 @@ void GDALGridGeometryVisitor::visit(const OGRPoint *p)
                        dfMultiplyBurnValue);
 }
 
+struct GDALGridContextReleaser
+{
+    void operator()(GDALGridContext *psContext)
+    {
+        GDALGridContextFree(psContext);
+    }
+};
+
+/************************************************************************/
+/*                          ComputeGridExtent()                         */
+/************************************************************************/
+
+static bool ComputeGridExtent(OGRLayer *poSrcLayer, bool &bIsXExtentSet,
+                              bool &bIsYExtentSet, double &dfXMin,
+                              double &dfXMax, double &dfYMin, double &dfYMax)
+{
+    if (!bIsXExtentSet || !bIsYExtentSet)
+    {
+        OGREnvelope sEnvelope;
+        if (poSrcLayer->GetExtent(&sEnvelope, TRUE) == OGRERR_FAILURE)
+        {
+            return false;
+        }
+
+        if (!bIsXExtentSet)
+        {
+            dfXMin = sEnvelope.MinX;
+            dfXMax = sEnvelope.MaxX;
+            bIsXExtentSet = true;
+        }
+
+        if (!bIsYExtentSet)
+        {
+            dfYMin = sEnvelope.MinY;
+            dfYMax = sEnvelope.MaxY;
+            bIsYExtentSet = true;
+        }
+    }
+
+    // Produce north-up images
+    if (dfYMin < dfYMax)
+        std::swap(dfYMin, dfYMax);
+
+    return true;
+}
+
+/************************************************************************/
+/*                        ComputeWorkBufferSize()                       */
+/************************************************************************/
+
+static bool ComputeWorkBufferSize(GDALRasterBand *poBand, GDALDataType eType,
+                                  int nXSize, int nYSize, int &nBlockXSize,
+                                  int &nBlockYSize)
+{
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
+
+    // Try to grow the work buffer up to 16 MB if it is smaller
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    if (nXSize == 0 || nYSize == 0 || nBlockXSize == 0 || nBlockYSize == 0)
+        return false;
+
+    const int nDesiredBufferSize = 16 * 1024 * 1024;
+    if (nBlockXSize < nXSize && nBlockYSize < nYSize &&
+        nBlockXSize < nDesiredBufferSize / (nBlockYSize * nDataTypeSize))
+    {
+        const int nNewBlockXSize =
+            nDesiredBufferSize / (nBlockYSize * nDataTypeSize);
+        nBlockXSize = (nNewBlockXSize / nBlockXSize) * nBlockXSize;
+        if (nBlockXSize > nXSize)
+            nBlockXSize = nXSize;
+    }
+    else if (nBlockXSize == nXSize && nBlockYSize < nYSize &&
+             nBlockYSize < nDesiredBufferSize / (nXSize * nDataTypeSize))
+    {
+        const int nNewBlockYSize =
+            nDesiredBufferSize / (nXSize * nDataTypeSize);
+        nBlockYSize = (nNewBlockYSize / nBlockYSize) * nBlockYSize;
+        if (nBlockYSize > nYSize)
+            nBlockYSize = nYSize;
+    }
+    CPLDebug("GDAL_GRID", "Work buffer: %d * %d", nBlockXSize, nBlockYSize);
+    return true;
+}
+
+/************************************************************************/
+/*                           GetSearchRadius()                          */
+/************************************************************************/
+
+// Returns the radius of the circle enclosing the search area of a grid node,
+// or 0 if the value of a node may depend on points at any distance.
+static double GetSearchRadius(GDALGridAlgorithm eAlgorithm,
+                              const void *pOptions)
+{
+    switch (eAlgorithm)
+    {
+        case GGA_InverseDistanceToAPower:
+        {
+            const auto poOptions =
+                static_cast<const GDALGridInverseDistanceToAPowerOptions *>(
+                    pOptions);
+            return std::max(poOptions->dfRadius1, poOptions->dfRadius2);
+        }
+        case GGA_InverseDistanceToAPowerNearestNeighbor:
+        {
+            const auto poOptions = static_cast<
+                const GDALGridInverseDistanceToAPowerNearestNeighborOptions *>(
+                pOptions);
+            return poOptions->dfRadius;
+        }
+        case GGA_MovingAverage:
+        {
+            const auto poOptions =
+                static_cast<const GDALGridMovingAverageOptions *>(pOptions);
+            return std::max(poOptions->dfRadius1, poOptions->dfRadius2);
+        }
+        case GGA_NearestNeighbor:
+        {
+            const auto poOptions =
+                static_cast<const GDALGridNearestNeighborOptions *>(pOptions);
+            return std::max(poOptions->dfRadius1, poOptions->dfRadius2);
+        }
+        case GGA_MetricMinimum:
+        case GGA_MetricMaximum:
+        case GGA_MetricRange:
+        case GGA_MetricCount:
+        case GGA_MetricAverageDistance:
+        case GGA_MetricAverageDistancePts:
+        {
+            const auto poOptions =
+                static_cast<const GDALGridDataMetricsOptions *>(pOptions);
+            return std::max(poOptions->dfRadius1, poOptions->dfRadius2);
+        }
+        case GGA_Linear:
+            // The triangulation depends on all points
+            break;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                         ProcessLayerTiled()                          */
+/*                                                                      */
+/*      Dispatch the points of a layer to the blocks of the output      */
+/*      grid whose nodes they may influence, in a temporary file, and   */
+/*      then grid each block from its own points only.                  */
+/************************************************************************/
+
+static CPLErr ProcessLayerTiled(
+    OGRLayer *poSrcLayer, GDALDataset *poDstDS,
+    GDALGridGeometryVisitor &oVisitor, int nXSize, int nYSize, int nBand,
+    bool &bIsXExtentSet, bool &bIsYExtentSet, double &dfXMin, double &dfXMax,
+    double &dfYMin, double &dfYMax, GDALDataType eType,
+    GDALGridAlgorithm eAlgorithm, void *pOptions, double dfSearchRadius,
+    bool bQuiet, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    if (!ComputeGridExtent(poSrcLayer, bIsXExtentSet, bIsYExtentSet, dfXMin,
+                           dfXMax, dfYMin, dfYMax))
+    {
+        return CE_Failure;
+    }
+
+    const double dfDeltaX = (dfXMax - dfXMin) / nXSize;
+    const double dfDeltaY = (dfYMax - dfYMin) / nYSize;
+
+    GDALRasterBand *poBand = poDstDS->GetRasterBand(nBand);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
+    if (!ComputeWorkBufferSize(poBand, eType, nXSize, nYSize, nBlockXSize,
+                               nBlockYSize))
+        return CE_Failure;
+    const int nTilesX = DIV_ROUND_UP(nXSize, nBlockXSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nBlockYSize);
+
+    /* -------------------------------------------------------------------- */
+    /*      Dispatch the points to the blocks, including those within the   */
+    /*      search radius of their nodes.                                   */
+    /* -------------------------------------------------------------------- */
+    const std::string osTmpFilename =
+        CPLGenerateTempFilenameSafe("gdal_grid_points") + ".bin";
+    struct TmpFileRemover
+    {
+        const std::string &osFilename;
+
+        ~TmpFileRemover()
+        {
+            VSIUnlink(osFilename.c_str());
+        }
+    } oTmpFileRemover{osTmpFilename};
+    VSIVirtualHandleUniquePtr fpTmp(VSIFOpenL(osTmpFilename.c_str(), "wb+"));
+    if (!fpTmp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osTmpFilename.c_str());
+        return CE_Failure;
+    }
+
+    struct Chunk
+    {
+        vsi_l_offset nOffset;
+        size_t nPoints;
+    };
+
+    const size_t nTiles = static_cast<size_t>(nTilesX) * nTilesY;
+    std::vector<std::vector<Chunk>> aaoTileChunks(nTiles);
+    // X, Y and Z values of the points of each block not yet written
+    std::vector<std::vector<double>> aadfTileXYZ(nTiles);
+    size_t nBufferedPoints = 0;
+    GUIntBig nTotalPoints = 0;
+    constexpr size_t MAX_BUFFERED_POINTS = 4 * 1024 * 1024;
+
+    const auto FlushBuffers = [&]()
+    {
+        for (size_t iTile = 0; iTile < nTiles; ++iTile)
+        {
+            auto &adfXYZ = aadfTileXYZ[iTile];
+            if (adfXYZ.empty())
+                continue;
+            aaoTileChunks[iTile].push_back(
+                Chunk{fpTmp->Tell(), adfXYZ.size() / 3});
+            if (fpTmp->Write(adfXYZ.data(), sizeof(double), adfXYZ.size()) !=
+                adfXYZ.size())
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot write %s",
+                         osTmpFilename.c_str());
+                return false;
+            }
+            std::vector<double>().swap(adfXYZ);
+        }
+        nBufferedPoints = 0;
+        return true;
+    };
+
+    const auto DispatchPoints = [&]()
+    {
+        for (size_t i = 0; i < oVisitor.adfX.size(); ++i)
+        {
+            const double dfX = oVisitor.adfX[i];
+            const double dfY = oVisitor.adfY[i];
+            ++nTotalPoints;
+
+            const double dfMinCol = (dfX - dfSearchRadius - dfXMin) / dfDeltaX;
+            const double dfMaxCol = (dfX + dfSearchRadius - dfXMin) / dfDeltaX;
+            const double dfRow1 = (dfY - dfSearchRadius - dfYMin) / dfDeltaY;
+            const double dfRow2 = (dfY + dfSearchRadius - dfYMin) / dfDeltaY;
+            const double dfMinRow = std::min(dfRow1, dfRow2);
+            const double dfMaxRow = std::max(dfRow1, dfRow2);
+            if (!(dfMaxCol >= 0 && dfMinCol < nXSize && dfMaxRow >= 0 &&
+                  dfMinRow < nYSize))
+                continue;
+
+            const int nMinTileX =
+                static_cast<int>(std::max(0.0, std::floor(dfMinCol))) /
+                nBlockXSize;
+            const int nMaxTileX =
+                static_cast<int>(std::min(nXSize - 1.0, std::floor(dfMaxCol))) /
+                nBlockXSize;
+            const int nMinTileY =
+                static_cast<int>(std::max(0.0, std::floor(dfMinRow))) /
+                nBlockYSize;
+            const int nMaxTileY =
+                static_cast<int>(std::min(nYSize - 1.0, std::floor(dfMaxRow))) /
+                nBlockYSize;
+            for (int iTileY = nMinTileY; iTileY <= nMaxTileY; ++iTileY)
+            {
+                for (int iTileX = nMinTileX; iTileX <= nMaxTileX; ++iTileX)
+                {
+                    auto &adfXYZ =
+                        aadfTileXYZ[static_cast<size_t>(iTileY) * nTilesX +
+                                    iTileX];
+                    adfXYZ.push_back(dfX);
+                    adfXYZ.push_back(dfY);
+                    adfXYZ.push_back(oVisitor.adfZ[i]);
+                    ++nBufferedPoints;
+                }
+            }
+        }
+        oVisitor.adfX.clear();
+        oVisitor.adfY.clear();
+        oVisitor.adfZ.clear();
+        return nBufferedPoints < MAX_BUFFERED_POINTS || FlushBuffers();
+    };
+
+    const int iBurnField = oVisitor.iBurnField;
+    for (auto &&poFeat : poSrcLayer)
+    {
+        const OGRGeometry *poGeom = poFeat->GetGeometryRef();
+        if (poGeom)
+        {
+            if (iBurnField >= 0)
+            {
+                if (!poFeat->IsFieldSetAndNotNull(iBurnField))
+                {
+                    continue;
+                }
+                oVisitor.dfBurnValue = poFeat->GetFieldAsDouble(iBurnField);
+            }
+
+            poGeom->accept(&oVisitor);
+            if (oVisitor.adfX.size() >= 65536 && !DispatchPoints())
+                return CE_Failure;
+        }
+    }
+    if (!DispatchPoints() || !FlushBuffers())
+        return CE_Failure;
+
+    if (nTotalPoints == 0)
+    {
+        printf("No point geometry found on layer %s, skipping.\n",
+               poSrcLayer->GetName());
+        return CE_None;
+    }
+
+    if (!bQuiet)
+    {
+        printf("Grid data type is \"%s\"\n", GDALGetDataTypeName(eType));
+        printf("Grid size = (%d %d).\n", nXSize, nYSize);
+        CPLprintf("Corner coordinates = (%f %f)-(%f %f).\n", dfXMin, dfYMin,
+                  dfXMax, dfYMax);
+        CPLprintf("Grid cell size = (%f %f).\n", dfDeltaX, dfDeltaY);
+        printf("Source point count = " CPL_FRMT_GUIB ".\n", nTotalPoints);
+        PrintAlgorithmAndOptions(eAlgorithm, pOptions);
+        printf("\n");
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Grid each block.                                                */
+    /* -------------------------------------------------------------------- */
+
+    // Make each block use the same search method as with all the points.
+    std::unique_ptr<CPLConfigOptionSetter> poThresholdSetter;
+    const GUIntBig nPointCountThreshold = static_cast<GUIntBig>(std::max(
+        0, atoi(CPLGetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD", "100"))));
+    if (nTotalPoints > nPointCountThreshold)
+    {
+        poThresholdSetter = std::make_unique<CPLConfigOptionSetter>(
+            "GDAL_GRID_POINT_COUNT_THRESHOLD", "0", false);
+    }
+
+    std::unique_ptr<void, VSIFreeReleaser> pData(
+        VSIMalloc3(nBlockXSize, nBlockYSize, nDataTypeSize));
+    if (!pData)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate work buffer");
+        return CE_Failure;
+    }
+
+    std::vector<double> adfXYZ;
+    CPLErr eErr = CE_None;
+    for (int iTileY = 0; iTileY < nTilesY && eErr == CE_None; ++iTileY)
+    {
+        for (int iTileX = 0; iTileX < nTilesX && eErr == CE_None; ++iTileX)
+        {
+            const size_t iTile = static_cast<size_t>(iTileY) * nTilesX + iTileX;
+            std::unique_ptr<void, GDALScaledProgressReleaser> pScaledProgress(
+                GDALCreateScaledProgress(
+                    static_cast<double>(iTile) / nTiles,
+                    static_cast<double>(iTile + 1) / nTiles, pfnProgress,
+                    pProgressData));
+
+            const int nXOffset = iTileX * nBlockXSize;
+            const int nYOffset = iTileY * nBlockYSize;
+            const int nXRequest = std::min(nBlockXSize, nXSize - nXOffset);
+            const int nYRequest = std::min(nBlockYSize, nYSize - nYOffset);
+
+            size_t nPoints = 0;
+            for (const auto &oChunk : aaoTileChunks[iTile])
+                nPoints += oChunk.nPoints;
+            try
+            {
+                adfXYZ.resize(nPoints * 3);
+                oVisitor.adfX.resize(nPoints);
+                oVisitor.adfY.resize(nPoints);
+                oVisitor.adfZ.resize(nPoints);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate point arrays");
+                return CE_Failure;
+            }
+            size_t iPoint = 0;
+            for (const auto &oChunk : aaoTileChunks[iTile])
+            {
+                if (fpTmp->Seek(oChunk.nOffset, SEEK_SET) != 0 ||
+                    fpTmp->Read(adfXYZ.data() + iPoint * 3, sizeof(double),
+                                oChunk.nPoints * 3) != oChunk.nPoints * 3)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                             osTmpFilename.c_str());
+                    return CE_Failure;
+                }
+                iPoint += oChunk.nPoints;
+            }
+            for (size_t i = 0; i < nPoints; ++i)
+            {
+                oVisitor.adfX[i] = adfXYZ[3 * i];
+                oVisitor.adfY[i] = adfXYZ[3 * i + 1];
+                oVisitor.adfZ[i] = adfXYZ[3 * i + 2];
+            }
+
+            if (nPoints == 0)
+            {
+                // Use a single point out of reach of the nodes of the
+                // block, to get the value the algorithm gives to nodes with
+                // no point in their search area.
+                oVisitor.adfX.assign(1, dfXMin + dfDeltaX * nXOffset -
+                                            4 * dfSearchRadius);
+                oVisitor.adfY.assign(1, dfYMin + dfDeltaY * nYOffset);
+                oVisitor.adfZ.assign(1, 0.0);
+                nPoints = 1;
+            }
+
+            std::unique_ptr<GDALGridContext, GDALGridContextReleaser>
+                psContext(GDALGridContextCreate(
+                    eAlgorithm, pOptions, static_cast<GUInt32>(nPoints),
+                    oVisitor.adfX.data(), oVisitor.adfY.data(),
+                    oVisitor.adfZ.data(), TRUE));
+            if (!psContext)
+                return CE_Failure;
+
+            eErr = GDALGridContextProcess(
+                psContext.get(), dfXMin + dfDeltaX * nXOffset,
+                dfXMin + dfDeltaX * (nXOffset + nXRequest),
+                dfYMin + dfDeltaY * nYOffset,
+                dfYMin + dfDeltaY * (nYOffset + nYRequest), nXRequest,
+                nYRequest, eType, pData.get(), GDALScaledProgress,
+                pScaledProgress.get());
+
+            if (eErr == CE_None)
+                eErr = poBand->RasterIO(GF_Write, nXOffset, nYOffset, nXRequest,
+                                        nYRequest, pData.get(), nXRequest,
+                                        nYRequest, eType, 0, 0, nullptr);
+        }
+    }
+    if (eErr == CE_None && pfnProgress)
+        pfnProgress(1.0, "", pProgressData);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                            ProcessLayer()                            */
 /*                                                                      */
@@ -340,6 +782,22 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
     oVisitor.dfIncreaseBurnValue = dfIncreaseBurnValue;
     oVisitor.dfMultiplyBurnValue = dfMultiplyBurnValue;
 
+    if (CPLTestBool(CPLGetConfigOption("GDAL_GRID_TILED", "NO")))
+    {
+        const double dfSearchRadius = GetSearchRadius(eAlgorithm, pOptions);
+        if (dfSearchRadius > 0)
+        {
+            return ProcessLayerTiled(
+                poSrcLayer, poDstDS, oVisitor, nXSize, nYSize, nBand,
+                bIsXExtentSet, bIsYExtentSet, dfXMin, dfXMax, dfYMin, dfYMax,
+                eType, eAlgorithm, pOptions, dfSearchRadius, bQuiet,
+                pfnProgress, pProgressData);
+        }
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "GDAL_GRID_TILED=YES ignored: it requires an algorithm "
+                 "with a search radius other than linear");
+    }
+
     for (auto &&poFeat : poSrcLayer)
     {
         const OGRGeometry *poGeom = poFeat->GetGeometryRef();
@@ -368,33 +826,12 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
     /* -------------------------------------------------------------------- */
     /*      Compute grid geometry.                                          */
     /* -------------------------------------------------------------------- */
-    if (!bIsXExtentSet || !bIsYExtentSet)
+    if (!ComputeGridExtent(poSrcLayer, bIsXExtentSet, bIsYExtentSet, dfXMin,
+                           dfXMax, dfYMin, dfYMax))
     {
-        OGREnvelope sEnvelope;
-        if (poSrcLayer->GetExtent(&sEnvelope, TRUE) == OGRERR_FAILURE)
-        {
-            return CE_Failure;
-        }
-
-        if (!bIsXExtentSet)
-        {
-            dfXMin = sEnvelope.MinX;
-            dfXMax = sEnvelope.MaxX;
-            bIsXExtentSet = true;
-        }
-
-        if (!bIsYExtentSet)
-        {
-            dfYMin = sEnvelope.MinY;
-            dfYMax = sEnvelope.MaxY;
-            bIsYExtentSet = true;
-        }
+        return CE_Failure;
     }
 
-    // Produce north-up images
-    if (dfYMin < dfYMax)
-        std::swap(dfYMin, dfYMax);
-
     /* -------------------------------------------------------------------- */
     /*      Perform gridding.                                               */
     /* -------------------------------------------------------------------- */
@@ -420,33 +857,10 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
     int nBlockXSize = 0;
     int nBlockYSize = 0;
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
-
-    // Try to grow the work buffer up to 16 MB if it is smaller
-    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-    if (nXSize == 0 || nYSize == 0 || nBlockXSize == 0 || nBlockYSize == 0)
+    if (!ComputeWorkBufferSize(poBand, eType, nXSize, nYSize, nBlockXSize,
+                               nBlockYSize))
         return CE_Failure;
 
-    const int nDesiredBufferSize = 16 * 1024 * 1024;
-    if (nBlockXSize < nXSize && nBlockYSize < nYSize &&
-        nBlockXSize < nDesiredBufferSize / (nBlockYSize * nDataTypeSize))
-    {
-        const int nNewBlockXSize =
-            nDesiredBufferSize / (nBlockYSize * nDataTypeSize);
-        nBlockXSize = (nNewBlockXSize / nBlockXSize) * nBlockXSize;
-        if (nBlockXSize > nXSize)
-            nBlockXSize = nXSize;
-    }
-    else if (nBlockXSize == nXSize && nBlockYSize < nYSize &&
-             nBlockYSize < nDesiredBufferSize / (nXSize * nDataTypeSize))
-    {
-        const int nNewBlockYSize =
-            nDesiredBufferSize / (nXSize * nDataTypeSize);
-        nBlockYSize = (nNewBlockYSize / nBlockYSize) * nBlockYSize;
-        if (nBlockYSize > nYSize)
-            nBlockYSize = nYSize;
-    }
-    CPLDebug("GDAL_GRID", "Work buffer: %d * %d", nBlockXSize, nBlockYSize);
-
     std::unique_ptr<void, VSIFreeReleaser> pData(
         VSIMalloc3(nBlockXSize, nBlockYSize, nDataTypeSize));
     if (!pData)
@@ -460,14 +874,6 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
         static_cast<double>(DIV_ROUND_UP(nXSize, nBlockXSize)) *
         DIV_ROUND_UP(nYSize, nBlockYSize);
 
-    struct GDALGridContextReleaser
-    {
-        void operator()(GDALGridContext *psContext)
-        {
-            GDALGridContextFree(psContext);
-        }
-    };
-
     std::unique_ptr<GDALGridContext, GDALGridContextReleaser> psContext(
         GDALGridContextCreate(eAlgorithm, pOptions,
                               static_cast<int>(oVisitor.adfX.size()),
@@ -33,6 +33,8 @@ class GDALRasterAspectAlgorithm /* non final */
 
     explicit GDALRasterAspectAlgorithm(bool standaloneStep = false);
 
+    bool CanHandleNextStep(GDALPipelineStepAlgorithm *) const override;
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -41,6 +43,8 @@ class GDALRasterAspectAlgorithm /* non final */
     std::string m_gradientAlg = "Horn";
     bool m_zeroForFlat = false;
     bool m_noEdges = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -15,13 +15,18 @@
 #include "../frmts/vrt/gdal_vrt.h"
 #include "../frmts/vrt/vrtdataset.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_vsi_virtual.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 
 //! @cond Doxygen_Suppress
@@ -845,6 +850,227 @@ static std::unique_ptr<GDALDataset> GDALCalcCreateVRTDerived(
     return ds;
 }
 
+/************************************************************************/
+/*                      GDALCalcCreateByBlocks()                        */
+/************************************************************************/
+
+/** Creates the output dataset with the Create() method of its driver, and
+ * fills it by evaluating the VRT by windows aligned on the output blocks,
+ * iterated in the native block order of the output.
+ *
+ * Windows are evaluated by several threads, each of them using its own
+ * instance of the VRT, re-opened from its XML definition, and written to the
+ * output dataset as soon as they are computed.
+ *
+ * @param bTried set to false if the output cannot be created that way, in
+ *               which case the caller must fall back to CreateCopy().
+ */
+static std::unique_ptr<GDALDataset>
+GDALCalcCreateByBlocks(VRTDataset *poVRTDS, const std::string &osFilename,
+                       const std::string &osFormat,
+                       const std::vector<std::string> &aosCreationOptions,
+                       int nNumThreads, GDALProgressFunc pfnProgress,
+                       void *pProgressData, bool &bTried)
+{
+    bTried = false;
+
+    const int nBands = poVRTDS->GetRasterCount();
+    if (nNumThreads <= 1 || nBands == 0)
+        return nullptr;
+
+    std::string osDriverName(osFormat);
+    if (osDriverName.empty())
+    {
+        const CPLStringList aosFormats(GDALGetOutputDriversForDatasetName(
+            osFilename.c_str(), GDAL_OF_RASTER, /* bSingleMatch = */ true,
+            /* bWarn = */ false));
+        if (aosFormats.size() != 1)
+            return nullptr;
+        osDriverName = aosFormats[0];
+    }
+    // The VRT output must contain the expressions, not their results.
+    if (EQUAL(osDriverName.c_str(), "VRT"))
+        return nullptr;
+    auto poDriver =
+        GetGDALDriverManager()->GetDriverByName(osDriverName.c_str());
+    if (!poDriver || !poDriver->GetMetadataItem(GDAL_DCAP_RASTER) ||
+        !poDriver->GetMetadataItem(GDAL_DCAP_CREATE))
+    {
+        return nullptr;
+    }
+
+    const GDALDataType eDT = poVRTDS->GetRasterBand(1)->GetRasterDataType();
+    for (int i = 2; i <= nBands; ++i)
+    {
+        if (poVRTDS->GetRasterBand(i)->GetRasterDataType() != eDT)
+            return nullptr;
+    }
+
+    CPLXMLTreeCloser poXML(poVRTDS->SerializeToXML(""));
+    if (!poXML)
+        return nullptr;
+    const CPLString osXML(
+        CPLCharUniquePtr(CPLSerializeXMLTree(poXML.get())).get());
+
+    bTried = true;
+
+    const int nXSize = poVRTDS->GetRasterXSize();
+    const int nYSize = poVRTDS->GetRasterYSize();
+    std::unique_ptr<GDALDataset> poDstDS(
+        poDriver->Create(osFilename.c_str(), nXSize, nYSize, nBands, eDT,
+                         CPLStringList(aosCreationOptions).List()));
+    if (!poDstDS)
+        return nullptr;
+
+    GDALGeoTransform gt;
+    if (poVRTDS->GetGeoTransform(gt) == CE_None)
+        poDstDS->SetGeoTransform(gt);
+    if (const auto poSRS = poVRTDS->GetSpatialRef())
+        poDstDS->SetSpatialRef(poSRS);
+    for (int i = 1; i <= nBands; ++i)
+    {
+        GDALCopyNoDataValue(poDstDS->GetRasterBand(i),
+                            poVRTDS->GetRasterBand(i));
+    }
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poDstDS->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    // Group strips (or tiles spanning the whole width) that are too small to
+    // amortize the cost of evaluating a window.
+    constexpr int MIN_PIXELS_PER_WINDOW = 256 * 256;
+    if (nBlockXSize >= nXSize)
+    {
+        nBlockXSize = nXSize;
+        nBlockYSize *= std::max(1, MIN_PIXELS_PER_WINDOW /
+                                       std::max(1, nXSize * nBlockYSize));
+        nBlockYSize = std::min(nBlockYSize, nYSize);
+    }
+    const int nXWindows = DIV_ROUND_UP(nXSize, nBlockXSize);
+    const int nYWindows = DIV_ROUND_UP(nYSize, nBlockYSize);
+    const int nWindows = nXWindows * nYWindows;
+
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nWindows));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
+    CPLDebug("GDAL", "Computing %d windows of %dx%d pixels with %d threads",
+             nWindows, nBlockXSize, nBlockYSize, poQueue ? nThreads : 1);
+
+    std::mutex oWriteMutex;
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nWindowsDone = 0;
+    int nJobsDone = 0;
+    std::atomic<int> nNextWindow{0};
+    std::atomic<bool> bSuccess{true};
+    std::atomic<bool> bStop{false};
+    CPLErrorAccumulator oErrorAccumulator;
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    GDALDataset *const poDstDSRaw = poDstDS.get();
+
+    const auto Job = [&]()
+    {
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            // Opened by the thread that uses it, so that the sources of the
+            // VRT are not shared with other threads.
+            auto poThreadVRTDS = VRTDataset::OpenXML(osXML.c_str());
+            std::vector<GByte> abyBuffer;
+            while (poThreadVRTDS && !bStop)
+            {
+                const int iWindow = nNextWindow++;
+                if (iWindow >= nWindows)
+                    break;
+                const int nXOff = (iWindow % nXWindows) * nBlockXSize;
+                const int nYOff = (iWindow / nXWindows) * nBlockYSize;
+                const int nReqXSize = std::min(nBlockXSize, nXSize - nXOff);
+                const int nReqYSize = std::min(nBlockYSize, nYSize - nYOff);
+                const size_t nBufferSize = static_cast<size_t>(nReqXSize) *
+                                           nReqYSize * nBands * nDTSize;
+                bool bOK = true;
+                try
+                {
+                    abyBuffer.resize(nBufferSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory allocating %s bytes",
+                             std::to_string(nBufferSize).c_str());
+                    bOK = false;
+                }
+                bOK = bOK &&
+                      poThreadVRTDS->RasterIO(
+                          GF_Read, nXOff, nYOff, nReqXSize, nReqYSize,
+                          abyBuffer.data(), nReqXSize, nReqYSize, eDT, nBands,
+                          nullptr, 0, 0, 0, nullptr) == CE_None;
+                if (bOK)
+                {
+                    std::lock_guard oLock(oWriteMutex);
+                    bOK = poDstDSRaw->RasterIO(
+                              GF_Write, nXOff, nYOff, nReqXSize, nReqYSize,
+                              abyBuffer.data(), nReqXSize, nReqYSize, eDT,
+                              nBands, nullptr, 0, 0, 0, nullptr) == CE_None;
+                }
+                if (!bOK)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+                std::lock_guard oLock(oMutex);
+                ++nWindowsDone;
+                oCV.notify_one();
+            }
+            if (!poThreadVRTDS)
+            {
+                bSuccess = false;
+                bStop = true;
+            }
+        }
+        std::lock_guard oLock(oMutex);
+        ++nJobsDone;
+        oCV.notify_one();
+    };
+
+    const int nJobs = poQueue ? nThreads : 1;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue || !poQueue->SubmitJob(Job))
+            Job();
+    }
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nJobsDone < nJobs)
+        {
+            oCV.wait(oLock);
+            const double dfProgress =
+                static_cast<double>(nWindowsDone) / nWindows;
+            oLock.unlock();
+            if (!bStop && !pfnProgress(dfProgress, "", pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bSuccess = false;
+                bStop = true;
+            }
+            oLock.lock();
+        }
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+    if (!bSuccess)
+        return nullptr;
+    pfnProgress(1.0, "", pProgressData);
+    return poDstDS;
+}
+
 /************************************************************************/
 /*          GDALRasterCalcAlgorithm::GDALRasterCalcAlgorithm()          */
 /************************************************************************/
@@ -863,6 +1089,7 @@ GDALRasterCalcAlgorithm::GDALRasterCalcAlgorithm(bool standaloneStep) noexcept
     {
         AddProgressArg();
         AddRasterOutputArgs(false);
+        AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
     }
 
     AddOutputDataTypeArg(&m_type);
@@ -1118,6 +1345,20 @@ bool GDALRasterCalcAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         return true;
     }
 
+    GDALProgressFunc pfnProgress =
+        ctxt.m_pfnProgress ? ctxt.m_pfnProgress : GDALDummyProgress;
+    bool bTried = false;
+    auto poBlockOutDS = GDALCalcCreateByBlocks(
+        cpl::down_cast<VRTDataset *>(vrt.get()), m_outputDataset.GetName(),
+        m_format, m_creationOptions, m_numThreads, pfnProgress,
+        ctxt.m_pProgressData, bTried);
+    if (bTried)
+    {
+        const bool bOK = poBlockOutDS != nullptr;
+        m_outputDataset.Set(std::move(poBlockOutDS));
+        return bOK;
+    }
+
     CPLStringList translateArgs;
     if (!m_format.empty())
     {
@@ -48,6 +48,8 @@ class GDALRasterCalcAlgorithm : public GDALRasterPipelineStepAlgorithm
     bool m_noCheckExtent{false};
     bool m_noCheckExpression{false};
     bool m_propagateNoData{false};
+    int m_numThreads{0};
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
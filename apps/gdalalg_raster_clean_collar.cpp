@@ -101,6 +101,7 @@ GDALRasterCleanCollarAlgorithm::GDALRasterCleanCollarAlgorithm()
     AddArg("algorithm", 0, _("Algorithm to apply"), &m_algorithm)
         .SetChoices("floodfill", "twopasses")
         .SetDefault(m_algorithm);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -249,6 +250,9 @@ bool GDALRasterCleanCollarAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     aosOptions.push_back("-alg");
     aosOptions.push_back(m_algorithm.c_str());
 
+    aosOptions.push_back("-num_threads");
+    aosOptions.push_back(CPLSPrintf("%d", m_numThreads));
+
     std::unique_ptr<GDALNearblackOptions, decltype(&GDALNearblackOptionsFree)>
         psOptions{GDALNearblackOptionsNew(aosOptions.List(), nullptr),
                   GDALNearblackOptionsFree};
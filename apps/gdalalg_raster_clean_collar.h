@@ -50,6 +50,8 @@ class GDALRasterCleanCollarAlgorithm final : public GDALAlgorithm
     bool m_addAlpha = false;
     bool m_addMask = false;
     std::string m_algorithm = "floodfill";
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 //! @endcond
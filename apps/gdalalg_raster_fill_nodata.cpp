@@ -18,6 +18,7 @@
 #include "commonutils.h"
 
 #include <algorithm>
+#include <climits>
 
 //! @cond Doxygen_Suppress
 
@@ -67,6 +68,18 @@ GDALRasterFillNodataAlgorithm::GDALRasterFillNodataAlgorithm(
         .SetChoices("invdist", "nearest");
 }
 
+/************************************************************************/
+/*      GDALRasterFillNodataAlgorithm::IsNativelyStreamingCompatible()  */
+/************************************************************************/
+
+bool GDALRasterFillNodataAlgorithm::IsNativelyStreamingCompatible() const
+{
+    // A pixel is only interpolated from pixels within the maximum distance,
+    // and smoothing iterations extend that neighborhood by one pixel each.
+    // A maximum distance of 0 means an unbounded search.
+    return m_maxDistance > 0;
+}
+
 /************************************************************************/
 /*                 GDALRasterFillNodataAlgorithm::RunStep()             */
 /************************************************************************/
@@ -77,14 +90,6 @@ bool GDALRasterFillNodataAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     auto pProgressData = ctxt.m_pProgressData;
 
     auto poSrcDS = m_inputDataset[0].GetDatasetRef();
-    std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)> pScaledData(
-        GDALCreateScaledProgress(0.0, 0.5, pfnProgress, pProgressData),
-        GDALDestroyScaledProgress);
-    auto poTmpDS = CreateTemporaryCopy(
-        this, poSrcDS, m_band, true, pScaledData ? GDALScaledProgress : nullptr,
-        pScaledData.get());
-    if (!poTmpDS)
-        return false;
 
     GDALRasterBand *maskBand{nullptr};
     if (m_maskDataset.GetDatasetRef())
@@ -97,10 +102,6 @@ bool GDALRasterFillNodataAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         }
     }
 
-    // Get the output band
-    GDALRasterBand *dstBand{poTmpDS->GetRasterBand(1)};
-    CPLAssert(dstBand);
-
     // Prepare options to pass to GDALFillNodata
     CPLStringList aosFillOptions;
 
@@ -110,6 +111,52 @@ bool GDALRasterFillNodataAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosFillOptions.AddNameValue("INTERPOLATION",
                                     "INV_DIST");  // default strategy
 
+    if (IsNativelyStreamingCompatible())
+    {
+        if (maskBand && (maskBand->GetXSize() != poSrcDS->GetRasterXSize() ||
+                         maskBand->GetYSize() != poSrcDS->GetRasterYSize()))
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "Mask dataset has not the same dimensions as the "
+                        "input dataset.");
+            return false;
+        }
+
+        // Each window is small: use in-memory work datasets
+        aosFillOptions.SetNameValue("TEMP_FILE_DRIVER", "MEM");
+        const double dfMaxDistance = m_maxDistance;
+        const int nSmoothingIterations = m_smoothingIterations;
+        const int nHalo = static_cast<int>(std::min<int64_t>(
+            INT_MAX, static_cast<int64_t>(m_maxDistance) +
+                         std::max(0, m_smoothingIterations)));
+        auto poOutDS = CreateHaloWindowedDataset(
+            poSrcDS, m_band, maskBand, nHalo,
+            [dfMaxDistance, nSmoothingIterations,
+             aosFillOptions](GDALRasterBand *poWindowBand,
+                             GDALRasterBand *poWindowMaskBand) mutable
+            {
+                return GDALFillNodata(poWindowBand, poWindowMaskBand,
+                                      dfMaxDistance, 0, nSmoothingIterations,
+                                      aosFillOptions.List(), nullptr,
+                                      nullptr) == CE_None;
+            });
+        m_outputDataset.Set(std::move(poOutDS));
+        return true;
+    }
+
+    std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)> pScaledData(
+        GDALCreateScaledProgress(0.0, 0.5, pfnProgress, pProgressData),
+        GDALDestroyScaledProgress);
+    auto poTmpDS = CreateTemporaryCopy(
+        this, poSrcDS, m_band, true, pScaledData ? GDALScaledProgress : nullptr,
+        pScaledData.get());
+    if (!poTmpDS)
+        return false;
+
+    // Get the output band
+    GDALRasterBand *dstBand{poTmpDS->GetRasterBand(1)};
+    CPLAssert(dstBand);
+
     pScaledData.reset(
         GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData));
     const auto retVal = GDALFillNodata(
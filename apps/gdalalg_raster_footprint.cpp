@@ -137,6 +137,7 @@ GDALRasterFootprintAlgorithm::GDALRasterFootprintAlgorithm(bool standaloneStep)
            &m_noLocation)
         .SetMutualExclusionGroup("location");
     AddAbsolutePathArg(&m_writeAbsolutePaths);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 
     AddValidationAction(
         [this]
@@ -291,6 +292,9 @@ bool GDALRasterFootprintAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     if (m_splitMultiPolygons)
         aosOptions.push_back("-split_polys");
 
+    aosOptions.push_back("-num_threads");
+    aosOptions.push_back(CPLSPrintf("%d", m_numThreads));
+
     if (m_convexHull)
         aosOptions.push_back("-convex_hull");
 
@@ -67,6 +67,8 @@ class GDALRasterFootprintAlgorithm /* non final */
     std::string m_locationField = "location";
     bool m_noLocation = false;
     bool m_writeAbsolutePaths = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -105,6 +105,9 @@ void GDALRasterIndexAlgorithm::AddCommonOptions()
                                 { return ParseAndValidateKeyValue(arg); });
         arg.AddHiddenAlias("mo");
     }
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs used to open the input datasets (or "
+                       "ALL_CPUS)"));
 }
 
 /************************************************************************/
@@ -154,6 +157,8 @@ bool GDALRasterIndexAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         aosOptions.push_back("-max_pixel_size");
         aosOptions.push_back(CPLSPrintf("%.17g", m_maxPixelSize));
     }
+    aosOptions.push_back("-num_threads");
+    aosOptions.push_back(CPLSPrintf("%d", m_numThreads));
 
     if (!m_outputLayerName.empty())
     {
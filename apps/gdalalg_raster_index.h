@@ -61,6 +61,8 @@ class CPL_DLL GDALRasterIndexAlgorithm /* non final */
     std::string m_sourceCrsName{};
     std::string m_sourceCrsFormat = "auto";
     std::vector<std::string> m_metadata{};
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 //! @endcond
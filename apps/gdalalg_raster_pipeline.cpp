@@ -47,6 +47,7 @@
 #include "cpl_vsi.h"
 #include "gdal_priv.h"
 #include "gdal_utils.h"
+#include "memdataset.h"
 
 #include <algorithm>
 #include <array>
@@ -802,4 +803,291 @@ GDALRasterPipelineNonNativelyStreamingAlgorithm::CreateTemporaryCopy(
     return poOutDS;
 }
 
+namespace
+{
+
+using HaloWindowProcessingFunc =
+    std::function<bool(GDALRasterBand *, GDALRasterBand *)>;
+
+/************************************************************************/
+/*                        GDALHaloWindowedDataset                       */
+/************************************************************************/
+
+/** Single-band dataset whose blocks are computed on demand, by applying a
+ * processing function on a window of a source band, extended on each side
+ * by a halo large enough for the result within the window not to depend
+ * on pixels outside of it.
+ */
+class GDALHaloWindowedDataset final : public GDALDataset
+{
+  public:
+    GDALHaloWindowedDataset(GDALDataset *poSrcDS, int nSrcBand,
+                            GDALRasterBand *poAuxBand, int nHalo,
+                            HaloWindowProcessingFunc processFunc);
+
+    CPLErr GetGeoTransform(GDALGeoTransform &gt) const override
+    {
+        return m_poSrcDS->GetGeoTransform(gt);
+    }
+
+    const OGRSpatialReference *GetSpatialRef() const override
+    {
+        return m_poSrcDS->GetSpatialRef();
+    }
+
+  private:
+    friend class GDALHaloWindowedBand;
+
+    GDALDataset *const m_poSrcDS;
+    GDALRasterBand *const m_poSrcBand;
+    GDALRasterBand *const m_poAuxBand;
+    const int m_nHalo;
+    const HaloWindowProcessingFunc m_processFunc;
+    std::vector<GByte> m_abyBuffer{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALHaloWindowedDataset)
+};
+
+/************************************************************************/
+/*                         GDALHaloWindowedBand                         */
+/************************************************************************/
+
+class GDALHaloWindowedBand final : public GDALRasterBand
+{
+  public:
+    GDALHaloWindowedBand(GDALHaloWindowedDataset *poDSIn, int nBlockSize)
+        : m_poSrcBand(poDSIn->m_poSrcBand)
+    {
+        poDS = poDSIn;
+        nBand = 1;
+        nRasterXSize = poDSIn->GetRasterXSize();
+        nRasterYSize = poDSIn->GetRasterYSize();
+        nBlockXSize = std::min(nBlockSize, nRasterXSize);
+        nBlockYSize = std::min(nBlockSize, nRasterYSize);
+        eDataType = m_poSrcBand->GetRasterDataType();
+    }
+
+    double GetNoDataValue(int *pbSuccess) override
+    {
+        return m_poSrcBand->GetNoDataValue(pbSuccess);
+    }
+
+    int64_t GetNoDataValueAsInt64(int *pbSuccess) override
+    {
+        return m_poSrcBand->GetNoDataValueAsInt64(pbSuccess);
+    }
+
+    uint64_t GetNoDataValueAsUInt64(int *pbSuccess) override
+    {
+        return m_poSrcBand->GetNoDataValueAsUInt64(pbSuccess);
+    }
+
+    GDALColorInterp GetColorInterpretation() override
+    {
+        return m_poSrcBand->GetColorInterpretation();
+    }
+
+    GDALColorTable *GetColorTable() override
+    {
+        return m_poSrcBand->GetColorTable();
+    }
+
+    double GetOffset(int *pbSuccess) override
+    {
+        return m_poSrcBand->GetOffset(pbSuccess);
+    }
+
+    double GetScale(int *pbSuccess) override
+    {
+        return m_poSrcBand->GetScale(pbSuccess);
+    }
+
+    const char *GetUnitType() override
+    {
+        return m_poSrcBand->GetUnitType();
+    }
+
+    int GetMaskFlags() override
+    {
+        return HasPerDatasetSourceMask() ? GMF_PER_DATASET
+                                         : GDALRasterBand::GetMaskFlags();
+    }
+
+    GDALRasterBand *GetMaskBand() override
+    {
+        return HasPerDatasetSourceMask() ? m_poSrcBand->GetMaskBand()
+                                         : GDALRasterBand::GetMaskBand();
+    }
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) override;
+
+  private:
+    GDALRasterBand *const m_poSrcBand;
+
+    //! Whether the source band has a mask that is not derived from its
+    //! nodata value.
+    bool HasPerDatasetSourceMask()
+    {
+        const int nMaskFlags = m_poSrcBand->GetMaskFlags();
+        return (nMaskFlags & GMF_PER_DATASET) != 0 &&
+               (nMaskFlags & GMF_NODATA) == 0;
+    }
+
+    bool CopyWindow(GDALRasterBand *poSrcBand, int nXOff, int nYOff,
+                    int nXSize, int nYSize, GDALRasterBand *poDstBand);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALHaloWindowedBand)
+};
+
+/************************************************************************/
+/*            GDALHaloWindowedDataset::GDALHaloWindowedDataset()        */
+/************************************************************************/
+
+GDALHaloWindowedDataset::GDALHaloWindowedDataset(
+    GDALDataset *poSrcDS, int nSrcBand, GDALRasterBand *poAuxBand, int nHalo,
+    HaloWindowProcessingFunc processFunc)
+    : m_poSrcDS(poSrcDS), m_poSrcBand(poSrcDS->GetRasterBand(nSrcBand)),
+      m_poAuxBand(poAuxBand), m_nHalo(nHalo),
+      m_processFunc(std::move(processFunc))
+{
+    nRasterXSize = poSrcDS->GetRasterXSize();
+    nRasterYSize = poSrcDS->GetRasterYSize();
+    SetMetadata(poSrcDS->GetMetadata());
+
+    // Blocks are made large compared to the halo, so that pixels of the halo
+    // are not processed many times.
+    constexpr int MIN_BLOCK_SIZE = 1024;
+    const int nBlockSize = std::max(
+        MIN_BLOCK_SIZE, static_cast<int>(std::min<int64_t>(
+                            INT_MAX, static_cast<int64_t>(nHalo) * 4)));
+    SetBand(1, std::make_unique<GDALHaloWindowedBand>(this, nBlockSize));
+}
+
+/************************************************************************/
+/*                  GDALHaloWindowedBand::CopyWindow()                  */
+/************************************************************************/
+
+bool GDALHaloWindowedBand::CopyWindow(GDALRasterBand *poSrcBand, int nXOff,
+                                      int nYOff, int nXSize, int nYSize,
+                                      GDALRasterBand *poDstBand)
+{
+    auto &abyBuffer = cpl::down_cast<GDALHaloWindowedDataset *>(poDS)
+                          ->m_abyBuffer;
+    const GDALDataType eDT = poDstBand->GetRasterDataType();
+    const size_t nBufferSize = static_cast<size_t>(nXSize) * nYSize *
+                               GDALGetDataTypeSizeBytes(eDT);
+    try
+    {
+        abyBuffer.resize(nBufferSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+    return poSrcBand->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                               abyBuffer.data(), nXSize, nYSize, eDT, 0, 0,
+                               nullptr) == CE_None &&
+           poDstBand->RasterIO(GF_Write, 0, 0, nXSize, nYSize,
+                               abyBuffer.data(), nXSize, nYSize, eDT, 0, 0,
+                               nullptr) == CE_None;
+}
+
+/************************************************************************/
+/*                  GDALHaloWindowedBand::IReadBlock()                  */
+/************************************************************************/
+
+CPLErr GDALHaloWindowedBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                        void *pData)
+{
+    auto poGDS = cpl::down_cast<GDALHaloWindowedDataset *>(poDS);
+
+    int nReqXSize = 0;
+    int nReqYSize = 0;
+    GetActualBlockSize(nBlockXOff, nBlockYOff, &nReqXSize, &nReqYSize);
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+
+    // Window of the block, extended by the halo and clamped to the raster
+    const int nHalo = poGDS->m_nHalo;
+    const int nWinXOff = std::max(0, nXOff - nHalo);
+    const int nWinYOff = std::max(0, nYOff - nHalo);
+    const int nWinXSize =
+        static_cast<int>(std::min<int64_t>(
+            nRasterXSize, static_cast<int64_t>(nXOff) + nReqXSize + nHalo)) -
+        nWinXOff;
+    const int nWinYSize =
+        static_cast<int>(std::min<int64_t>(
+            nRasterYSize, static_cast<int64_t>(nYOff) + nReqYSize + nHalo)) -
+        nWinYOff;
+
+    auto poWinDS = std::unique_ptr<GDALDataset>(MEMDataset::Create(
+        "", nWinXSize, nWinYSize, 1, eDataType, nullptr));
+    if (!poWinDS)
+        return CE_Failure;
+    auto poWinBand = poWinDS->GetRasterBand(1);
+    GDALCopyNoDataValue(poWinBand, m_poSrcBand);
+    if (!CopyWindow(m_poSrcBand, nWinXOff, nWinYOff, nWinXSize, nWinYSize,
+                    poWinBand))
+        return CE_Failure;
+
+    if (HasPerDatasetSourceMask())
+    {
+        if (poWinBand->CreateMaskBand(GMF_PER_DATASET) != CE_None ||
+            !CopyWindow(m_poSrcBand->GetMaskBand(), nWinXOff, nWinYOff,
+                        nWinXSize, nWinYSize, poWinBand->GetMaskBand()))
+            return CE_Failure;
+    }
+
+    std::unique_ptr<GDALDataset> poWinAuxDS;
+    GDALRasterBand *poWinAuxBand = nullptr;
+    if (poGDS->m_poAuxBand)
+    {
+        poWinAuxDS.reset(MEMDataset::Create(
+            "", nWinXSize, nWinYSize, 1,
+            poGDS->m_poAuxBand->GetRasterDataType(), nullptr));
+        if (!poWinAuxDS)
+            return CE_Failure;
+        poWinAuxBand = poWinAuxDS->GetRasterBand(1);
+        if (!CopyWindow(poGDS->m_poAuxBand, nWinXOff, nWinYOff, nWinXSize,
+                        nWinYSize, poWinAuxBand))
+            return CE_Failure;
+    }
+
+    if (!poGDS->m_processFunc(poWinBand, poWinAuxBand))
+        return CE_Failure;
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    return poWinBand->RasterIO(GF_Read, nXOff - nWinXOff, nYOff - nWinYOff,
+                               nReqXSize, nReqYSize, pData, nReqXSize,
+                               nReqYSize, eDataType, nDTSize,
+                               static_cast<GSpacing>(nDTSize) * nBlockXSize,
+                               nullptr);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     CreateHaloWindowedDataset()                      */
+/************************************************************************/
+
+/** Return a single-band dataset computed lazily, block by block, by applying
+ * processFunc() on windows of band nSrcBand of poSrcDS extended by nHalo
+ * pixels on each side. This allows to stream steps whose output at a given
+ * pixel only depends on input pixels within nHalo pixels.
+ *
+ * poSrcDS and poAuxBand must remain valid during the lifetime of the
+ * returned dataset.
+ */
+std::unique_ptr<GDALDataset>
+GDALRasterPipelineNonNativelyStreamingAlgorithm::CreateHaloWindowedDataset(
+    GDALDataset *poSrcDS, int nSrcBand, GDALRasterBand *poAuxBand, int nHalo,
+    HaloWindowProcessingFunc processFunc)
+{
+    return std::make_unique<GDALHaloWindowedDataset>(
+        poSrcDS, nSrcBand, poAuxBand, nHalo, std::move(processFunc));
+}
+
 //! @endcond
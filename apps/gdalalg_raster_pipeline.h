@@ -16,6 +16,8 @@
 #include "gdalalgorithm.h"
 #include "gdalalg_abstract_pipeline.h"
 
+#include <functional>
+
 //! @cond Doxygen_Suppress
 
 /************************************************************************/
@@ -79,6 +81,17 @@ class GDALRasterPipelineNonNativelyStreamingAlgorithm /* non-final */
     CreateTemporaryCopy(GDALAlgorithm *poAlg, GDALDataset *poSrcDS,
                         int nSingleBand, bool bTiledIfPossible,
                         GDALProgressFunc pfnProgress, void *pProgressData);
+
+    /** Function processing in place poWindowBand, a band of an in-memory
+     * dataset holding a window of the input band extended by a halo.
+     * poWindowAuxBand is the corresponding window of the auxiliary band
+     * passed to CreateHaloWindowedDataset(), or nullptr. */
+    using HaloWindowProcessingFunc = std::function<bool(
+        GDALRasterBand *poWindowBand, GDALRasterBand *poWindowAuxBand)>;
+
+    static std::unique_ptr<GDALDataset> CreateHaloWindowedDataset(
+        GDALDataset *poSrcDS, int nSrcBand, GDALRasterBand *poAuxBand,
+        int nHalo, HaloWindowProcessingFunc processFunc);
 };
 
 /************************************************************************/
@@ -77,6 +77,8 @@ GDALRasterPixelInfoAlgorithm::GDALRasterPixelInfoAlgorithm()
         .SetChoices("nearest", "bilinear", "cubic", "cubicspline")
         .SetHiddenChoices("near");
 
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+
     AddValidationAction(
         [this]
         {
@@ -263,146 +265,153 @@ bool GDALRasterPixelInfoAlgorithm::RunImpl(GDALProgressFunc, void *)
     CPLJSONArray oFeatures;
     oCollection.Add("features", oFeatures);
 
-    char szLine[1024];
-    int nLine = 0;
-    size_t iVal = 0;
-    do
+    // Bands (or overview bands) to query, and the values interpolated for
+    // the current batch of points
+    struct QueriedBand
     {
-        double x = 0, y = 0;
-        std::string osExtraContent;
-        if (iVal + 1 < m_pos.size())
+        int nBand = 0;
+        GDALRasterBandH hBand = nullptr;
+        bool bIsOverview = false;
+        std::vector<double> adfReal{};
+        std::vector<double> adfImag{};
+        std::vector<int> abSuccess{};
+    };
+
+    std::vector<QueriedBand> aoBands;
+    for (int nBand : m_band)
+    {
+        QueriedBand oBand;
+        oBand.nBand = nBand;
+        oBand.hBand = GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(nBand));
+        if (m_overview >= 0 && oBand.hBand != nullptr)
         {
-            x = m_pos[iVal++];
-            y = m_pos[iVal++];
+            GDALRasterBandH hOvrBand = GDALGetOverview(oBand.hBand, m_overview);
+            if (hOvrBand == nullptr)
+            {
+                ReportError(CE_Failure, CPLE_AppDefined,
+                            "Cannot get overview %d of band %d", m_overview,
+                            nBand);
+                return false;
+            }
+            oBand.hBand = hOvrBand;
+            oBand.bIsOverview = true;
         }
-        else
+        aoBands.push_back(std::move(oBand));
+    }
+
+    struct Point
+    {
+        double xOri = 0;
+        double yOri = 0;
+        double dfPixel = 0;
+        double dfLine = 0;
+        std::string osExtraContent{};
+    };
+
+    // Points are processed by batches, so that each area of the raster is
+    // read only once by InterpolateAtPoints() whatever the order of the
+    // points. When reading from an interactive terminal, each point is
+    // processed as soon as it is entered.
+    const size_t nMaxBatchSize =
+        m_pos.empty() && CPLIsInteractive(stdin) ? 1 : 100 * 1000;
+    std::vector<Point> aoPoints;
+    std::vector<double> adfPixelToQuery;
+    std::vector<double> adfLineToQuery;
+    const CPLStringList aosInterpolateOptions(
+        CSLSetNameValue(nullptr, "NUM_THREADS",
+                        CPLSPrintf("%d", m_numThreads)));
+
+    const auto ProcessPoints = [&]()
+    {
+        const size_t nPoints = aoPoints.size();
+        if (nPoints == 0)
+            return;
+
+        adfPixelToQuery.resize(nPoints);
+        adfLineToQuery.resize(nPoints);
+        for (auto &oBand : aoBands)
         {
-            if (CPLIsInteractive(stdin))
+            const int nBandXSize = GDALGetRasterBandXSize(oBand.hBand);
+            const int nBandYSize = GDALGetRasterBandYSize(oBand.hBand);
+            for (size_t i = 0; i < nPoints; ++i)
             {
-                if (m_posCrs != "pixel")
+                adfPixelToQuery[i] = aoPoints[i].dfPixel;
+                adfLineToQuery[i] = aoPoints[i].dfLine;
+                if (oBand.bIsOverview)
                 {
-                    fprintf(stderr, "Enter X Y values separated by space, and "
-                                    "press Return.\n");
-                }
-                else
-                {
-                    fprintf(stderr,
-                            "Enter pixel line values separated by space, "
-                            "and press Return.\n");
+                    adfPixelToQuery[i] = aoPoints[i].dfPixel /
+                                         poSrcDS->GetRasterXSize() *
+                                         nBandXSize;
+                    adfLineToQuery[i] = aoPoints[i].dfLine /
+                                        poSrcDS->GetRasterYSize() * nBandYSize;
                 }
             }
+            oBand.adfReal.resize(nPoints);
+            oBand.adfImag.resize(nPoints);
+            oBand.abSuccess.resize(nPoints);
+            CPL_IGNORE_RET_VAL(GDALRasterInterpolateAtPoints(
+                oBand.hBand, nPoints, adfPixelToQuery.data(),
+                adfLineToQuery.data(), eInterpolation, oBand.adfReal.data(),
+                oBand.adfImag.data(), oBand.abSuccess.data(),
+                aosInterpolateOptions.List()));
+        }
 
-            if (fgets(szLine, sizeof(szLine) - 1, stdin) && szLine[0] != '\n')
+        for (size_t iPoint = 0; iPoint < nPoints; ++iPoint)
+        {
+            const Point &oPoint = aoPoints[iPoint];
+            const double dfPixel = oPoint.dfPixel;
+            const double dfLine = oPoint.dfLine;
+            const int iPixel = static_cast<int>(
+                std::clamp(std::floor(dfPixel), static_cast<double>(INT_MIN),
+                           static_cast<double>(INT_MAX)));
+            const int iLine = static_cast<int>(
+                std::clamp(std::floor(dfLine), static_cast<double>(INT_MIN),
+                           static_cast<double>(INT_MAX)));
+
+            std::string line;
+            CPLJSONObject oFeature;
+            CPLJSONObject oProperties;
+            if (m_format == "csv")
             {
-                const CPLStringList aosTokens(CSLTokenizeString(szLine));
-                const int nCount = aosTokens.size();
-
-                ++nLine;
-                if (nCount < 2)
-                {
-                    fprintf(stderr, "Not enough values at line %d\n", nLine);
-                    return false;
-                }
-                else
-                {
-                    x = CPLAtof(aosTokens[0]);
-                    y = CPLAtof(aosTokens[1]);
-
-                    for (int i = 2; i < nCount; ++i)
-                    {
-                        if (!osExtraContent.empty())
-                            osExtraContent += ' ';
-                        osExtraContent += aosTokens[i];
-                    }
-                    while (!osExtraContent.empty() &&
-                           isspace(static_cast<int>(osExtraContent.back())))
-                    {
-                        osExtraContent.pop_back();
-                    }
-                }
+                line = CPLSPrintf("%.17g,%.17g", oPoint.xOri, oPoint.yOri);
+                line += ",\"";
+                line +=
+                    CPLString(oPoint.osExtraContent).replaceAll('"', "\"\"");
+                line += '"';
+                line += CPLSPrintf(",%.17g,%.17g", dfPixel, dfLine);
             }
             else
             {
-                break;
+                oFeature.Add("type", "Feature");
+                oFeature.Add("properties", oProperties);
+                {
+                    CPLJSONArray oArray;
+                    oArray.Add(oPoint.xOri);
+                    oArray.Add(oPoint.yOri);
+                    oProperties.Add("input_coordinate", oArray);
+                }
+                if (!oPoint.osExtraContent.empty())
+                    oProperties.Add("extra_content", oPoint.osExtraContent);
+                oProperties.Add("column", dfPixel);
+                oProperties.Add("line", dfLine);
             }
-        }
-
-        const double xOri = x;
-        const double yOri = y;
-        double dfPixel{0}, dfLine{0};
 
-        if (poCT)
-        {
-            if (!poCT->Transform(1, &x, &y, nullptr))
-                return false;
-        }
+            CPLJSONArray oBands;
 
-        if (m_posCrs != "pixel")
-        {
-            invGT.Apply(x, y, &dfPixel, &dfLine);
-        }
-        else
-        {
-            dfPixel = x;
-            dfLine = y;
-        }
-        const int iPixel = static_cast<int>(
-            std::clamp(std::floor(dfPixel), static_cast<double>(INT_MIN),
-                       static_cast<double>(INT_MAX)));
-        const int iLine = static_cast<int>(
-            std::clamp(std::floor(dfLine), static_cast<double>(INT_MIN),
-                       static_cast<double>(INT_MAX)));
-
-        std::string line;
-        CPLJSONObject oFeature;
-        CPLJSONObject oProperties;
-        if (m_format == "csv")
-        {
-            line = CPLSPrintf("%.17g,%.17g", xOri, yOri);
-            line += ",\"";
-            line += CPLString(osExtraContent).replaceAll('"', "\"\"");
-            line += '"';
-            line += CPLSPrintf(",%.17g,%.17g", dfPixel, dfLine);
-        }
-        else
-        {
-            oFeature.Add("type", "Feature");
-            oFeature.Add("properties", oProperties);
+            for (const auto &oQueriedBand : aoBands)
             {
-                CPLJSONArray oArray;
-                oArray.Add(xOri);
-                oArray.Add(yOri);
-                oProperties.Add("input_coordinate", oArray);
-            }
-            if (!osExtraContent.empty())
-                oProperties.Add("extra_content", osExtraContent);
-            oProperties.Add("column", dfPixel);
-            oProperties.Add("line", dfLine);
-        }
+                CPLJSONObject oBand;
+                oBand.Add("band_number", oQueriedBand.nBand);
 
-        CPLJSONArray oBands;
-
-        for (int nBand : m_band)
-        {
-            CPLJSONObject oBand;
-            oBand.Add("band_number", nBand);
-
-            auto hBand =
-                GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(nBand));
+                const auto hBand = oQueriedBand.hBand;
 
-            int iPixelToQuery = iPixel;
-            int iLineToQuery = iLine;
+                int iPixelToQuery = iPixel;
+                int iLineToQuery = iLine;
 
-            double dfPixelToQuery = dfPixel;
-            double dfLineToQuery = dfLine;
-
-            if (m_overview >= 0 && hBand != nullptr)
-            {
-                GDALRasterBandH hOvrBand = GDALGetOverview(hBand, m_overview);
-                if (hOvrBand != nullptr)
+                if (oQueriedBand.bIsOverview)
                 {
-                    int nOvrXSize = GDALGetRasterBandXSize(hOvrBand);
-                    int nOvrYSize = GDALGetRasterBandYSize(hOvrBand);
+                    const int nOvrXSize = GDALGetRasterBandXSize(hBand);
+                    const int nOvrYSize = GDALGetRasterBandYSize(hBand);
                     iPixelToQuery = static_cast<int>(
                         0.5 +
                         1.0 * iPixel / poSrcDS->GetRasterXSize() * nOvrXSize);
@@ -413,162 +422,249 @@ bool GDALRasterPixelInfoAlgorithm::RunImpl(GDALProgressFunc, void *)
                         iPixelToQuery = nOvrXSize - 1;
                     if (iLineToQuery >= nOvrYSize)
                         iLineToQuery = nOvrYSize - 1;
-                    dfPixelToQuery =
-                        dfPixel / poSrcDS->GetRasterXSize() * nOvrXSize;
-                    dfLineToQuery =
-                        dfLine / poSrcDS->GetRasterYSize() * nOvrYSize;
-                }
-                else
-                {
-                    ReportError(CE_Failure, CPLE_AppDefined,
-                                "Cannot get overview %d of band %d", m_overview,
-                                nBand);
-                    return false;
                 }
-                hBand = hOvrBand;
-            }
 
-            double adfPixel[2] = {0, 0};
-            const bool bIsComplex = CPL_TO_BOOL(
-                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
-            int bIgnored;
-            const double dfOffset = GDALGetRasterOffset(hBand, &bIgnored);
-            const double dfScale = GDALGetRasterScale(hBand, &bIgnored);
-            if (GDALRasterInterpolateAtPoint(
-                    hBand, dfPixelToQuery, dfLineToQuery, eInterpolation,
-                    &adfPixel[0], &adfPixel[1]) == CE_None)
-            {
-                if (!bIsComplex)
+                const double adfPixel[2] = {oQueriedBand.adfReal[iPoint],
+                                            oQueriedBand.adfImag[iPoint]};
+                const bool bIsComplex = CPL_TO_BOOL(
+                    GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
+                int bIgnored;
+                const double dfOffset = GDALGetRasterOffset(hBand, &bIgnored);
+                const double dfScale = GDALGetRasterScale(hBand, &bIgnored);
+                if (oQueriedBand.abSuccess[iPoint])
                 {
-                    const double dfUnscaledVal =
-                        adfPixel[0] * dfScale + dfOffset;
-                    if (m_format == "csv")
+                    if (!bIsComplex)
                     {
-                        line += CPLSPrintf(",%.17g", adfPixel[0]);
-                        line += CPLSPrintf(",%.17g", dfUnscaledVal);
+                        const double dfUnscaledVal =
+                            adfPixel[0] * dfScale + dfOffset;
+                        if (m_format == "csv")
+                        {
+                            line += CPLSPrintf(",%.17g", adfPixel[0]);
+                            line += CPLSPrintf(",%.17g", dfUnscaledVal);
+                        }
+                        else
+                        {
+                            if (GDALDataTypeIsInteger(
+                                    GDALGetRasterDataType(hBand)))
+                            {
+                                oBand.Add("raw_value",
+                                          static_cast<GInt64>(adfPixel[0]));
+                            }
+                            else
+                            {
+                                oBand.Add("raw_value", adfPixel[0]);
+                            }
+
+                            oBand.Add("unscaled_value", dfUnscaledVal);
+                        }
                     }
                     else
                     {
-                        if (GDALDataTypeIsInteger(GDALGetRasterDataType(hBand)))
+                        if (m_format == "csv")
                         {
-                            oBand.Add("raw_value",
-                                      static_cast<GInt64>(adfPixel[0]));
+                            line += CPLSPrintf(",%.17g,%.17g", adfPixel[0],
+                                               adfPixel[1]);
                         }
                         else
                         {
-                            oBand.Add("raw_value", adfPixel[0]);
+                            CPLJSONObject oValue;
+                            oValue.Add("real", adfPixel[0]);
+                            oValue.Add("imaginary", adfPixel[1]);
+                            oBand.Add("value", oValue);
                         }
-
-                        oBand.Add("unscaled_value", dfUnscaledVal);
                     }
                 }
-                else
+                else if (m_format == "csv")
                 {
-                    if (m_format == "csv")
+                    line += ",,";
+                }
+
+                // Request location info for this location (just a few
+                // drivers, like the VRT driver actually supports this).
+                CPLString osItem;
+                osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
+
+                if (const char *pszLI =
+                        GDALGetMetadataItem(hBand, osItem, "LocationInfo"))
+                {
+                    CPLXMLTreeCloser oTree(CPLParseXMLString(pszLI));
+
+                    if (oTree && oTree->psChild != nullptr &&
+                        oTree->eType == CXT_Element &&
+                        EQUAL(oTree->pszValue, "LocationInfo"))
                     {
-                        line += CPLSPrintf(",%.17g,%.17g", adfPixel[0],
-                                           adfPixel[1]);
+                        CPLJSONArray oFiles;
+
+                        for (const CPLXMLNode *psNode = oTree->psChild;
+                             psNode != nullptr; psNode = psNode->psNext)
+                        {
+                            if (psNode->eType == CXT_Element &&
+                                EQUAL(psNode->pszValue, "File") &&
+                                psNode->psChild != nullptr)
+                            {
+                                char *pszUnescaped =
+                                    CPLUnescapeString(psNode->psChild->pszValue,
+                                                      nullptr, CPLES_XML);
+                                oFiles.Add(pszUnescaped);
+                                CPLFree(pszUnescaped);
+                            }
+                        }
+
+                        oBand.Add("files", oFiles);
                     }
                     else
                     {
-                        CPLJSONObject oValue;
-                        oValue.Add("real", adfPixel[0]);
-                        oValue.Add("imaginary", adfPixel[1]);
-                        oBand.Add("value", oValue);
+                        oBand.Add("location_info", pszLI);
                     }
                 }
+
+                oBands.Add(oBand);
             }
-            else if (m_format == "csv")
+
+            if (m_format == "csv")
             {
-                line += ",,";
+                PrintLine(line);
             }
-
-            // Request location info for this location (just a few drivers,
-            // like the VRT driver actually supports this).
-            CPLString osItem;
-            osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
-
-            if (const char *pszLI =
-                    GDALGetMetadataItem(hBand, osItem, "LocationInfo"))
+            else
             {
-                CPLXMLTreeCloser oTree(CPLParseXMLString(pszLI));
+                oProperties.Add("bands", oBands);
 
-                if (oTree && oTree->psChild != nullptr &&
-                    oTree->eType == CXT_Element &&
-                    EQUAL(oTree->pszValue, "LocationInfo"))
+                if (canOutputGeoJSONGeom)
                 {
-                    CPLJSONArray oFiles;
+                    double x = dfPixel;
+                    double y = dfLine;
 
-                    for (const CPLXMLNode *psNode = oTree->psChild;
-                         psNode != nullptr; psNode = psNode->psNext)
-                    {
-                        if (psNode->eType == CXT_Element &&
-                            EQUAL(psNode->pszValue, "File") &&
-                            psNode->psChild != nullptr)
-                        {
-                            char *pszUnescaped = CPLUnescapeString(
-                                psNode->psChild->pszValue, nullptr, CPLES_XML);
-                            oFiles.Add(pszUnescaped);
-                            CPLFree(pszUnescaped);
-                        }
-                    }
+                    gt.Apply(x, y, &x, &y);
 
-                    oBand.Add("files", oFiles);
+                    if (poCTToWGS84)
+                        poCTToWGS84->Transform(1, &x, &y);
+
+                    CPLJSONObject oGeometry;
+                    oFeature.Add("geometry", oGeometry);
+                    oGeometry.Add("type", "Point");
+                    CPLJSONArray oCoordinates;
+                    oCoordinates.Add(x);
+                    oCoordinates.Add(y);
+                    oGeometry.Add("coordinates", oCoordinates);
                 }
                 else
                 {
-                    oBand.Add("location_info", pszLI);
+                    oFeature.AddNull("geometry");
                 }
-            }
 
-            oBands.Add(oBand);
+                if (isInteractive)
+                {
+                    CPLJSONDocument oDoc;
+                    oDoc.SetRoot(oFeature);
+                    printf("%s\n", oDoc.SaveAsString().c_str());
+                }
+                else
+                {
+                    oFeatures.Add(oFeature);
+                }
+            }
         }
 
-        if (m_format == "csv")
+        aoPoints.clear();
+    };
+
+    char szLine[1024];
+    int nLine = 0;
+    size_t iVal = 0;
+    do
+    {
+        double x = 0, y = 0;
+        std::string osExtraContent;
+        if (iVal + 1 < m_pos.size())
         {
-            PrintLine(line);
+            x = m_pos[iVal++];
+            y = m_pos[iVal++];
         }
         else
         {
-            oProperties.Add("bands", oBands);
-
-            if (canOutputGeoJSONGeom)
+            if (CPLIsInteractive(stdin))
             {
-                x = dfPixel;
-                y = dfLine;
+                if (m_posCrs != "pixel")
+                {
+                    fprintf(stderr, "Enter X Y values separated by space, and "
+                                    "press Return.\n");
+                }
+                else
+                {
+                    fprintf(stderr,
+                            "Enter pixel line values separated by space, "
+                            "and press Return.\n");
+                }
+            }
 
-                gt.Apply(x, y, &x, &y);
+            if (fgets(szLine, sizeof(szLine) - 1, stdin) && szLine[0] != '\n')
+            {
+                const CPLStringList aosTokens(CSLTokenizeString(szLine));
+                const int nCount = aosTokens.size();
 
-                if (poCTToWGS84)
-                    poCTToWGS84->Transform(1, &x, &y);
+                ++nLine;
+                if (nCount < 2)
+                {
+                    ProcessPoints();
+                    fprintf(stderr, "Not enough values at line %d\n", nLine);
+                    return false;
+                }
+                else
+                {
+                    x = CPLAtof(aosTokens[0]);
+                    y = CPLAtof(aosTokens[1]);
 
-                CPLJSONObject oGeometry;
-                oFeature.Add("geometry", oGeometry);
-                oGeometry.Add("type", "Point");
-                CPLJSONArray oCoordinates;
-                oCoordinates.Add(x);
-                oCoordinates.Add(y);
-                oGeometry.Add("coordinates", oCoordinates);
+                    for (int i = 2; i < nCount; ++i)
+                    {
+                        if (!osExtraContent.empty())
+                            osExtraContent += ' ';
+                        osExtraContent += aosTokens[i];
+                    }
+                    while (!osExtraContent.empty() &&
+                           isspace(static_cast<int>(osExtraContent.back())))
+                    {
+                        osExtraContent.pop_back();
+                    }
+                }
             }
             else
             {
-                oFeature.AddNull("geometry");
+                break;
             }
+        }
 
-            if (isInteractive)
-            {
-                CPLJSONDocument oDoc;
-                oDoc.SetRoot(oFeature);
-                printf("%s\n", oDoc.SaveAsString().c_str());
-            }
-            else
+        Point oPoint;
+        oPoint.xOri = x;
+        oPoint.yOri = y;
+
+        if (poCT)
+        {
+            if (!poCT->Transform(1, &x, &y, nullptr))
             {
-                oFeatures.Add(oFeature);
+                ProcessPoints();
+                return false;
             }
         }
 
+        if (m_posCrs != "pixel")
+        {
+            invGT.Apply(x, y, &oPoint.dfPixel, &oPoint.dfLine);
+        }
+        else
+        {
+            oPoint.dfPixel = x;
+            oPoint.dfLine = y;
+        }
+        oPoint.osExtraContent = std::move(osExtraContent);
+        aoPoints.push_back(std::move(oPoint));
+
+        if (aoPoints.size() >= nMaxBatchSize)
+            ProcessPoints();
+
     } while (m_pos.empty() || iVal + 1 < m_pos.size());
 
+    ProcessPoints();
+
     if (m_format != "csv" && !isInteractive)
     {
         CPLJSONDocument oDoc;
@@ -45,6 +45,8 @@ class GDALRasterPixelInfoAlgorithm final : public GDALAlgorithm
     std::vector<double> m_pos{};
     std::string m_posCrs{};
     std::string m_resampling = "nearest";
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 
     void PrintLine(const std::string &str);
 };
@@ -55,6 +55,13 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            _("Specify a nodata value to use for pixels that are beyond the "
              "maximum distance"),
            &m_noDataValue);
+    AddArg("algorithm", 0,
+           _("Algorithm: propagation of nearest targets along scanlines, or "
+             "exact Euclidean distance transform"),
+           &m_algorithm)
+        .SetChoices("scanline", "exact")
+        .SetDefault(m_algorithm);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -113,6 +120,10 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         dstBand->SetNoDataValue(m_noDataValue);
     }
 
+    proximityOptions.SetNameValue("ALGORITHM", m_algorithm.c_str());
+    proximityOptions.SetNameValue("NUM_THREADS",
+                                  CPLSPrintf("%d", m_numThreads));
+
     // Always set this to YES. Note that this was NOT the
     // default behavior in the python implementation of the utility.
     proximityOptions.AddString("USE_INPUT_NODATA=YES");
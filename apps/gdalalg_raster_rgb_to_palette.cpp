@@ -38,6 +38,7 @@ GDALRasterRGBToPaletteAlgorithm::GDALRasterRGBToPaletteAlgorithm(
         .SetMinValueIncluded(2)
         .SetMaxValueIncluded(256);
     AddArg("color-map", 0, _("Color map filename"), &m_colorMap);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -124,6 +125,10 @@ bool GDALRasterRGBToPaletteAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
 
     GDALColorTable oCT;
 
+    // Used by GDALComputeMedianCutPCT() and GDALDitherRGB2PCT()
+    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS",
+                                  CPLSPrintf("%d", m_numThreads), false);
+
     bool bOK = true;
     double dfLastProgress = 0;
     std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)> pScaledData(
@@ -38,6 +38,8 @@ class GDALRasterRGBToPaletteAlgorithm /* non final */
 
     int m_colorCount = 256;
     std::string m_colorMap{};
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -11,6 +11,7 @@
  ****************************************************************************/
 
 #include "gdalalg_raster_slope.h"
+#include "gdalalg_raster_write.h"
 
 #include "gdal_priv.h"
 #include "gdal_utils.h"
@@ -51,13 +52,25 @@ GDALRasterSlopeAlgorithm::GDALRasterSlopeAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+}
+
+/************************************************************************/
+/*             GDALRasterSlopeAlgorithm::CanHandleNextStep()          */
+/************************************************************************/
+
+bool GDALRasterSlopeAlgorithm::CanHandleNextStep(
+    GDALPipelineStepAlgorithm *poNextStep) const
+{
+    return poNextStep->GetName() == GDALRasterWriteAlgorithm::NAME &&
+           poNextStep->GetOutputFormat() != "stream";
 }
 
 /************************************************************************/
 /*                GDALRasterSlopeAlgorithm::RunStep()                   */
 /************************************************************************/
 
-bool GDALRasterSlopeAlgorithm::RunStep(GDALPipelineStepRunContext &)
+bool GDALRasterSlopeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
 {
     const auto poSrcDS = m_inputDataset[0].GetDatasetRef();
     CPLAssert(poSrcDS);
@@ -65,8 +78,31 @@ bool GDALRasterSlopeAlgorithm::RunStep(GDALPipelineStepRunContext &)
     CPLAssert(!m_outputDataset.GetDatasetRef());
 
     CPLStringList aosOptions;
-    aosOptions.AddString("-of");
-    aosOptions.AddString("stream");
+    std::string outputFilename;
+    if (ctxt.m_poNextUsableStep)
+    {
+        CPLAssert(CanHandleNextStep(ctxt.m_poNextUsableStep));
+        outputFilename = ctxt.m_poNextUsableStep->GetOutputDataset().GetName();
+        const auto &format = ctxt.m_poNextUsableStep->GetOutputFormat();
+        if (!format.empty())
+        {
+            aosOptions.AddString("-of");
+            aosOptions.AddString(format.c_str());
+        }
+
+        for (const std::string &co :
+             ctxt.m_poNextUsableStep->GetCreationOptions())
+        {
+            aosOptions.AddString("-co");
+            aosOptions.AddString(co.c_str());
+        }
+    }
+    else
+    {
+        aosOptions.AddString("-of");
+        aosOptions.AddString("stream");
+    }
+
     aosOptions.AddString("-b");
     aosOptions.AddString(CPLSPrintf("%d", m_band));
     if (!std::isnan(m_xscale))
@@ -86,21 +122,32 @@ bool GDALRasterSlopeAlgorithm::RunStep(GDALPipelineStepRunContext &)
 
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
-
-    auto poOutDS = std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
-        GDALDEMProcessing("", GDALDataset::ToHandle(poSrcDS), "slope", nullptr,
-                          psOptions, nullptr)));
-    GDALDEMProcessingOptionsFree(psOptions);
-    const bool bRet = poOutDS != nullptr;
-    if (poOutDS)
+    bool bOK = false;
+    if (psOptions)
     {
-        m_outputDataset.Set(std::move(poOutDS));
+        if (ctxt.m_poNextUsableStep)
+        {
+            GDALDEMProcessingOptionsSetProgress(psOptions, ctxt.m_pfnProgress,
+                                                ctxt.m_pProgressData);
+        }
+        auto poOutDS = std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
+            GDALDEMProcessing(outputFilename.c_str(),
+                              GDALDataset::ToHandle(poSrcDS), "slope", nullptr,
+                              psOptions, nullptr)));
+        GDALDEMProcessingOptionsFree(psOptions);
+        bOK = poOutDS != nullptr;
+        if (poOutDS)
+        {
+            m_outputDataset.Set(std::move(poOutDS));
+        }
     }
 
-    return bRet;
+    return bOK;
 }
 
 GDALRasterSlopeAlgorithmStandalone::~GDALRasterSlopeAlgorithmStandalone() =
@@ -216,6 +216,13 @@ GDALRasterTileAlgorithm::GDALRasterTileAlgorithm()
     AddArg("parallel-method", 0, _("Parallelization method (thread / spawn)"),
            &m_parallelMethod)
         .SetChoices("thread", "spawn");
+    AddArg("metatile-size", 0,
+           _("Number of tiles along each axis warped at once at max zoom "
+             "level"),
+           &m_metatileSize)
+        .SetDefault(m_metatileSize)
+        .SetMinValueIncluded(1)
+        .SetMaxValueIncluded(64);
 
     constexpr const char *ADVANCED_RESAMPLING_CATEGORY = "Advanced Resampling";
     auto &excludedValuesArg =
@@ -413,10 +420,97 @@ static int GetFileY(int iY, const gdal::TileMatrixSet::TileMatrix &tileMatrix,
     return convention == "xyz" ? iY : tileMatrix.mMatrixHeight - 1 - iY;
 }
 
+/************************************************************************/
+/*                          GetTileFilename()                           */
+/************************************************************************/
+
+static std::string
+GetTileFilename(const std::string &outputDirectory, int nZoomLevel, int iX,
+                int iY, const gdal::TileMatrixSet::TileMatrix &tileMatrix,
+                const std::string &convention, const char *pszExtension)
+{
+    const std::string osDirZ = CPLFormFilenameSafe(
+        outputDirectory.c_str(), CPLSPrintf("%d", nZoomLevel), nullptr);
+    const std::string osDirX =
+        CPLFormFilenameSafe(osDirZ.c_str(), CPLSPrintf("%d", iX), nullptr);
+    const int iFileY = GetFileY(iY, tileMatrix, convention);
+    return CPLFormFilenameSafe(osDirX.c_str(), CPLSPrintf("%d", iFileY),
+                               pszExtension);
+}
+
+/************************************************************************/
+/*                           MetaTileBuffer                             */
+/************************************************************************/
+
+// Result of warping a rectangle of several tiles at max zoom level at once.
+// Pixels are band-interleaved, with the dimensions of the whole rectangle.
+struct MetaTileBuffer
+{
+    const GByte *pabyData = nullptr;
+    int iXStart = 0;
+    int iYStart = 0;
+    int nXTiles = 0;
+    int nYTiles = 0;
+};
+
+/************************************************************************/
+/*                            WarpMetaTile()                            */
+/************************************************************************/
+
+// Warp the tiles [iXStart, iXEndIncluded] x [iYStart, iYEndIncluded] into
+// metaTileBuffer, unless bResume is set and all of them already exist.
+// Returns false in case of error. bSkip is set to true when all tiles exist.
+static bool
+WarpMetaTile(GDALWarpOperation &oWO, GDALDataType eWorkingDataType,
+             const gdal::TileMatrixSet::TileMatrix &tileMatrix,
+             const std::string &outputDirectory, int nZoomLevel,
+             const std::string &convention, const char *pszExtension,
+             int iXStart, int iXEndIncluded, int iYStart, int iYEndIncluded,
+             int nMinTileX, int nMinTileY, bool bResume,
+             std::vector<GByte> &metaTileBuffer, MetaTileBuffer &sMetaTile,
+             bool &bSkip)
+{
+    bSkip = false;
+    if (bResume)
+    {
+        bSkip = true;
+        for (int iY = iYStart; bSkip && iY <= iYEndIncluded; ++iY)
+        {
+            for (int iX = iXStart; bSkip && iX <= iXEndIncluded; ++iX)
+            {
+                VSIStatBufL sStat;
+                bSkip = VSIStatL(GetTileFilename(outputDirectory, nZoomLevel,
+                                                 iX, iY, tileMatrix, convention,
+                                                 pszExtension)
+                                     .c_str(),
+                                 &sStat) == 0;
+            }
+        }
+        if (bSkip)
+            return true;
+    }
+
+    sMetaTile.pabyData = metaTileBuffer.data();
+    sMetaTile.iXStart = iXStart;
+    sMetaTile.iYStart = iYStart;
+    sMetaTile.nXTiles = iXEndIncluded - iXStart + 1;
+    sMetaTile.nYTiles = iYEndIncluded - iYStart + 1;
+
+    memset(metaTileBuffer.data(), 0, metaTileBuffer.size());
+    return oWO.WarpRegionToBuffer(
+               (iXStart - nMinTileX) * tileMatrix.mTileWidth,
+               (iYStart - nMinTileY) * tileMatrix.mTileHeight,
+               sMetaTile.nXTiles * tileMatrix.mTileWidth,
+               sMetaTile.nYTiles * tileMatrix.mTileHeight,
+               metaTileBuffer.data(), eWorkingDataType) == CE_None;
+}
+
 /************************************************************************/
 /*                          GenerateTile()                              */
 /************************************************************************/
 
+// If psMetaTile is not null, the tile content is extracted from it, instead
+// of being warped.
 static bool GenerateTile(
     GDALDataset *poSrcDS, GDALDriver *m_poDstDriver, const char *pszExtension,
     CSLConstList creationOptions, GDALWarpOperation &oWO,
@@ -426,15 +520,16 @@ static bool GenerateTile(
     int nZoomLevel, int iX, int iY, const std::string &convention,
     int nMinTileX, int nMinTileY, bool bSkipBlank, bool bUserAskedForAlpha,
     bool bAuxXML, bool bResume, const std::vector<std::string> &metadata,
-    const GDALColorTable *poColorTable, std::vector<GByte> &dstBuffer)
+    const GDALColorTable *poColorTable, std::vector<GByte> &dstBuffer,
+    const MetaTileBuffer *psMetaTile = nullptr)
 {
     const std::string osDirZ = CPLFormFilenameSafe(
         outputDirectory.c_str(), CPLSPrintf("%d", nZoomLevel), nullptr);
     const std::string osDirX =
         CPLFormFilenameSafe(osDirZ.c_str(), CPLSPrintf("%d", iX), nullptr);
-    const int iFileY = GetFileY(iY, tileMatrix, convention);
-    const std::string osFilename = CPLFormFilenameSafe(
-        osDirX.c_str(), CPLSPrintf("%d", iFileY), pszExtension);
+    const std::string osFilename =
+        GetTileFilename(outputDirectory, nZoomLevel, iX, iY, tileMatrix,
+                        convention, pszExtension);
 
     if (bResume)
     {
@@ -443,14 +538,41 @@ static bool GenerateTile(
             return true;
     }
 
-    const int nDstXOff = (iX - nMinTileX) * tileMatrix.mTileWidth;
-    const int nDstYOff = (iY - nMinTileY) * tileMatrix.mTileHeight;
-    memset(dstBuffer.data(), 0, dstBuffer.size());
-    const CPLErr eErr = oWO.WarpRegionToBuffer(
-        nDstXOff, nDstYOff, tileMatrix.mTileWidth, tileMatrix.mTileHeight,
-        dstBuffer.data(), eWorkingDataType);
-    if (eErr != CE_None)
-        return false;
+    if (psMetaTile)
+    {
+        const size_t nDTSize = GDALGetDataTypeSizeBytes(eWorkingDataType);
+        const size_t nTileLineSize = tileMatrix.mTileWidth * nDTSize;
+        const size_t nMetaLineSize = nTileLineSize * psMetaTile->nXTiles;
+        const size_t nMetaBandSize =
+            nMetaLineSize * psMetaTile->nYTiles * tileMatrix.mTileHeight;
+        const size_t nTileBandSize = nTileLineSize * tileMatrix.mTileHeight;
+        const GByte *pabySrc =
+            psMetaTile->pabyData +
+            static_cast<size_t>(iY - psMetaTile->iYStart) *
+                tileMatrix.mTileHeight * nMetaLineSize +
+            (iX - psMetaTile->iXStart) * nTileLineSize;
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            for (int iLine = 0; iLine < tileMatrix.mTileHeight; ++iLine)
+            {
+                memcpy(dstBuffer.data() + iBand * nTileBandSize +
+                           iLine * nTileLineSize,
+                       pabySrc + iBand * nMetaBandSize + iLine * nMetaLineSize,
+                       nTileLineSize);
+            }
+        }
+    }
+    else
+    {
+        const int nDstXOff = (iX - nMinTileX) * tileMatrix.mTileWidth;
+        const int nDstYOff = (iY - nMinTileY) * tileMatrix.mTileHeight;
+        memset(dstBuffer.data(), 0, dstBuffer.size());
+        const CPLErr eErr = oWO.WarpRegionToBuffer(
+            nDstXOff, nDstYOff, tileMatrix.mTileWidth, tileMatrix.mTileHeight,
+            dstBuffer.data(), eWorkingDataType);
+        if (eErr != CE_None)
+            return false;
+    }
 
     const bool bDstHasAlpha =
         nBands > poSrcDS->GetRasterCount() ||
@@ -902,38 +1024,41 @@ class FakeMaxZoomRasterBand : public GDALRasterBand
 #endif
 
     CPLErr IRasterIO(GDALRWFlag eRWFlag, [[maybe_unused]] int nXOff,
-                     [[maybe_unused]] int nYOff, [[maybe_unused]] int nXSize,
-                     [[maybe_unused]] int nYSize, void *pData,
-                     [[maybe_unused]] int nBufXSize,
+                     [[maybe_unused]] int nYOff, int nXSize, int nYSize,
+                     void *pData, [[maybe_unused]] int nBufXSize,
                      [[maybe_unused]] int nBufYSize, GDALDataType eBufType,
                      GSpacing nPixelSpace, [[maybe_unused]] GSpacing nLineSpace,
                      GDALRasterIOExtraArg *) override
     {
         // For sake of implementation simplicity, check various assumptions of
-        // how GDALAlphaMask code does I/O
+        // how GDALAlphaMask code does I/O: the request covers the whole
+        // region (single tile or metatile) being warped.
         CPLAssert((nXOff % nBlockXSize) == 0);
         CPLAssert((nYOff % nBlockYSize) == 0);
         CPLAssert(nXSize == nBufXSize);
-        CPLAssert(nXSize == nBlockXSize);
+        CPLAssert((nXSize % nBlockXSize) == 0);
         CPLAssert(nYSize == nBufYSize);
-        CPLAssert(nYSize == nBlockYSize);
-        CPLAssert(nLineSpace == nBlockXSize * nPixelSpace);
+        CPLAssert((nYSize % nBlockYSize) == 0);
+        CPLAssert(nLineSpace == nXSize * nPixelSpace);
         CPLAssert(
             nBand ==
             poDS->GetRasterCount());  // only alpha band is accessed this way
+        const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
         if (eRWFlag == GF_Read)
         {
             double dfZero = 0;
             GDALCopyWords64(&dfZero, GDT_Float64, 0, pData, eBufType,
-                            static_cast<int>(nPixelSpace),
-                            static_cast<size_t>(nBlockXSize) * nBlockYSize);
+                            static_cast<int>(nPixelSpace), nPixels);
         }
         else
         {
+            // The destination buffer is band-interleaved, with the size of
+            // the region
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
             GDALCopyWords64(pData, eBufType, static_cast<int>(nPixelSpace),
-                            m_pDstBuffer, eDataType,
-                            GDALGetDataTypeSizeBytes(eDataType),
-                            static_cast<size_t>(nBlockXSize) * nBlockYSize);
+                            static_cast<GByte *>(m_pDstBuffer) +
+                                (nBand - 1) * nPixels * nDTSize,
+                            eDataType, nDTSize, nPixels);
         }
         return CE_None;
     }
@@ -945,8 +1070,8 @@ class FakeMaxZoomRasterBand : public GDALRasterBand
 
 // This class is used to create a fake output dataset for GDALWarpOperation.
 // In particular we need to implement GDALRasterBand::IRasterIO(GF_Write, ...)
-// to catch writes (of one single tile) to the alpha band and redirect them
-// to the dstBuffer passed to FakeMaxZoomDataset constructor.
+// to catch writes (of one single tile or metatile) to the alpha band and
+// redirect them to the dstBuffer passed to FakeMaxZoomDataset constructor.
 
 class FakeMaxZoomDataset : public GDALDataset
 {
@@ -969,12 +1094,9 @@ class FakeMaxZoomDataset : public GDALDataset
         nRasterYSize = nHeight;
         for (int i = 1; i <= nBandsIn; ++i)
         {
-            SetBand(i,
-                    new FakeMaxZoomRasterBand(
-                        i, nWidth, nHeight, nBlockXSize, nBlockYSize, eDT,
-                        dstBuffer.data() + static_cast<size_t>(i - 1) *
-                                               nBlockXSize * nBlockYSize *
-                                               GDALGetDataTypeSizeBytes(eDT)));
+            SetBand(i, new FakeMaxZoomRasterBand(i, nWidth, nHeight,
+                                                 nBlockXSize, nBlockYSize, eDT,
+                                                 dstBuffer.data()));
         }
     }
 
@@ -2032,6 +2154,8 @@ struct PerThreadMaxZoomResources
 
     std::unique_ptr<GDALDataset, GDALDatasetReleaser> poSrcDS{};
     std::vector<GByte> dstBuffer{};
+    // Only used when several tiles are warped at once
+    std::vector<GByte> metaTileBuffer{};
     std::unique_ptr<FakeMaxZoomDataset> poFakeMaxZoomDS{};
     std::unique_ptr<void, decltype(&GDALDestroyTransformer)> poTransformer{
         nullptr, GDALDestroyTransformer};
@@ -2051,10 +2175,11 @@ class PerThreadMaxZoomResourceManager final
                                     const GDALWarpOptions *psWO,
                                     void *pTransformerArg,
                                     const FakeMaxZoomDataset &oFakeMaxZoomDS,
-                                    size_t nBufferSize)
+                                    size_t nBufferSize,
+                                    size_t nMetaTileBufferSize)
         : m_poSrcDS(poSrcDS), m_psWOSource(psWO),
           m_pTransformerArg(pTransformerArg), m_oFakeMaxZoomDS(oFakeMaxZoomDS),
-          m_nBufferSize(nBufferSize)
+          m_nBufferSize(nBufferSize), m_nMetaTileBufferSize(nMetaTileBufferSize)
     {
     }
 
@@ -2070,6 +2195,7 @@ class PerThreadMaxZoomResourceManager final
         try
         {
             ret->dstBuffer.resize(m_nBufferSize);
+            ret->metaTileBuffer.resize(m_nMetaTileBufferSize);
         }
         catch (const std::exception &)
         {
@@ -2078,7 +2204,8 @@ class PerThreadMaxZoomResourceManager final
             return nullptr;
         }
 
-        ret->poFakeMaxZoomDS = m_oFakeMaxZoomDS.Clone(ret->dstBuffer);
+        ret->poFakeMaxZoomDS = m_oFakeMaxZoomDS.Clone(
+            m_nMetaTileBufferSize ? ret->metaTileBuffer : ret->dstBuffer);
 
         ret->poTransformer.reset(GDALCloneTransformer(m_pTransformerArg));
         if (!ret->poTransformer)
@@ -2108,6 +2235,7 @@ class PerThreadMaxZoomResourceManager final
     void *const m_pTransformerArg;
     const FakeMaxZoomDataset &m_oFakeMaxZoomDS;
     const size_t m_nBufferSize;
+    const size_t m_nMetaTileBufferSize;
 
     CPL_DISALLOW_COPY_ASSIGN(PerThreadMaxZoomResourceManager)
 };
@@ -3476,11 +3604,42 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         return false;
     }
 
+    // Warping several tiles at once saves the per-warp overhead (source
+    // window computation, source reading and transformation of edge pixels
+    // of each tile). Bound the size of the per-thread buffer.
+    int nMetaTileSize = std::min(
+        m_metatileSize, std::max(nMaxTileX - nMinTileX, nMaxTileY - nMinTileY) +
+                            1);
+    while (nMetaTileSize > 1 &&
+           dstBufferSize * nMetaTileSize * nMetaTileSize >
+               (nUsableRAM ? nUsableRAM : static_cast<uint64_t>(INT_MAX)) /
+                   std::max(1, m_numThreads))
+    {
+        --nMetaTileSize;
+    }
+    std::vector<GByte> metaTileBuffer;
+    if (nMetaTileSize > 1)
+    {
+        CPLDebug("gdal_raster_tile", "Using metatiles of %dx%d tiles",
+                 nMetaTileSize, nMetaTileSize);
+        try
+        {
+            metaTileBuffer.resize(static_cast<size_t>(
+                dstBufferSize * nMetaTileSize * nMetaTileSize));
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory allocating metatile buffer");
+            return false;
+        }
+    }
+
     FakeMaxZoomDataset oFakeMaxZoomDS(
         (nMaxTileX - nMinTileX + 1) * tileMatrix.mTileWidth,
         (nMaxTileY - nMinTileY + 1) * tileMatrix.mTileHeight, nDstBands,
         tileMatrix.mTileWidth, tileMatrix.mTileHeight, psWO->eWorkingDataType,
-        dstGT, oSRS_TMS, dstBuffer);
+        dstGT, oSRS_TMS, nMetaTileSize > 1 ? metaTileBuffer : dstBuffer);
     CPL_IGNORE_RET_VAL(oFakeMaxZoomDS.GetSpatialRef());
 
     psWO->hSrcDS = GDALDataset::ToHandle(m_poSrcDS);
@@ -3727,7 +3886,7 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
 
         PerThreadMaxZoomResourceManager oResourceManager(
             m_poSrcDS, psWO.get(), hTransformArg.get(), oFakeMaxZoomDS,
-            dstBuffer.size());
+            dstBuffer.size(), metaTileBuffer.size());
 
         const CPLStringList aosCreationOptions(
             GetUpdatedCreationOptions(tileMatrix));
@@ -3803,54 +3962,104 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
                                 pszExtension, &aosCreationOptions, &psWO,
                                 &tileMatrix, nDstBands, iXStart, iXEndIncluded,
                                 iYStart, iYEndIncluded, nMinTileX, nMinTileY,
-                                &poColorTable, bUserAskedForAlpha]()
+                                &poColorTable, bUserAskedForAlpha,
+                                nMetaTileSize]()
                     {
                         CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
 
                         auto resources = oResourceManager.AcquireResources();
-                        if (resources)
+                        if (!resources)
                         {
-                            for (int iY = iYStart; iY <= iYEndIncluded; ++iY)
+                            oResourceManager.SetError();
+                            bFailure = true;
+                            --nQueuedJobs;
+                            return;
+                        }
+
+                        for (int iYMeta = iYStart; iYMeta <= iYEndIncluded;
+                             iYMeta += nMetaTileSize)
+                        {
+                            const int iYMetaEndIncluded = std::min(
+                                iYMeta + nMetaTileSize - 1, iYEndIncluded);
+                            for (int iXMeta = iXStart; iXMeta <= iXEndIncluded;
+                                 iXMeta += nMetaTileSize)
                             {
-                                for (int iX = iXStart; iX <= iXEndIncluded;
-                                     ++iX)
+                                const int iXMetaEndIncluded = std::min(
+                                    iXMeta + nMetaTileSize - 1, iXEndIncluded);
+
+                                MetaTileBuffer sMetaTile;
+                                const MetaTileBuffer *psMetaTile = nullptr;
+                                if (nMetaTileSize > 1)
                                 {
-                                    if (!GenerateTile(
-                                            resources->poSrcDS.get(),
-                                            m_poDstDriver, pszExtension,
-                                            aosCreationOptions.List(),
+                                    bool bSkip = false;
+                                    if (!WarpMetaTile(
                                             *(resources->poWO.get()),
-                                            *(resources->poFakeMaxZoomDS
-                                                  ->GetSpatialRef()),
                                             psWO->eWorkingDataType, tileMatrix,
-                                            m_outputDirectory, nDstBands,
-                                            psWO->padfDstNoDataReal
-                                                ? &(psWO->padfDstNoDataReal[0])
-                                                : nullptr,
-                                            m_maxZoomLevel, iX, iY,
-                                            m_convention, nMinTileX, nMinTileY,
-                                            m_skipBlank, bUserAskedForAlpha,
-                                            m_auxXML, m_resume, m_metadata,
-                                            poColorTable.get(),
-                                            resources->dstBuffer))
+                                            m_outputDirectory, m_maxZoomLevel,
+                                            m_convention, pszExtension, iXMeta,
+                                            iXMetaEndIncluded, iYMeta,
+                                            iYMetaEndIncluded, nMinTileX,
+                                            nMinTileY, m_resume,
+                                            resources->metaTileBuffer,
+                                            sMetaTile, bSkip))
                                     {
                                         oResourceManager.SetError();
                                         bFailure = true;
                                         --nQueuedJobs;
                                         return;
                                     }
-                                    ++nCurTile;
-                                    oThreadPool.WakeUpWaitEvent();
+                                    if (bSkip)
+                                    {
+                                        nCurTile +=
+                                            (iYMetaEndIncluded - iYMeta + 1) *
+                                            (iXMetaEndIncluded - iXMeta + 1);
+                                        oThreadPool.WakeUpWaitEvent();
+                                        continue;
+                                    }
+                                    psMetaTile = &sMetaTile;
+                                }
+
+                                for (int iY = iYMeta; iY <= iYMetaEndIncluded;
+                                     ++iY)
+                                {
+                                    for (int iX = iXMeta;
+                                         iX <= iXMetaEndIncluded; ++iX)
+                                    {
+                                        if (!GenerateTile(
+                                                resources->poSrcDS.get(),
+                                                m_poDstDriver, pszExtension,
+                                                aosCreationOptions.List(),
+                                                *(resources->poWO.get()),
+                                                *(resources->poFakeMaxZoomDS
+                                                      ->GetSpatialRef()),
+                                                psWO->eWorkingDataType,
+                                                tileMatrix, m_outputDirectory,
+                                                nDstBands,
+                                                psWO->padfDstNoDataReal
+                                                    ? &(psWO->padfDstNoDataReal
+                                                            [0])
+                                                    : nullptr,
+                                                m_maxZoomLevel, iX, iY,
+                                                m_convention, nMinTileX,
+                                                nMinTileY, m_skipBlank,
+                                                bUserAskedForAlpha, m_auxXML,
+                                                m_resume, m_metadata,
+                                                poColorTable.get(),
+                                                resources->dstBuffer,
+                                                psMetaTile))
+                                        {
+                                            oResourceManager.SetError();
+                                            bFailure = true;
+                                            --nQueuedJobs;
+                                            return;
+                                        }
+                                        ++nCurTile;
+                                        oThreadPool.WakeUpWaitEvent();
+                                    }
                                 }
                             }
-                            oResourceManager.ReleaseResources(
-                                std::move(resources));
-                        }
-                        else
-                        {
-                            oResourceManager.SetError();
-                            bFailure = true;
                         }
+                        oResourceManager.ReleaseResources(std::move(resources));
 
                         --nQueuedJobs;
                     };
@@ -3887,21 +4096,13 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         else
         {
             // Branch for single-thread max zoom level tile generation
-            for (int iY = nMinTileY; bRet && iY <= nMaxTileY; ++iY)
+            const auto ReportTilesDone =
+                [this, &nCurTile, nTotalTiles, pfnProgress, pProgressData,
+                 bEmitSpuriousCharsOnStdout](int nTiles)
             {
-                for (int iX = nMinTileX; bRet && iX <= nMaxTileX; ++iX)
+                bool bContinue = true;
+                for (int i = 0; i < nTiles && bContinue; ++i)
                 {
-                    bRet = GenerateTile(
-                        m_poSrcDS, m_poDstDriver, pszExtension,
-                        aosCreationOptions.List(), oWO, oSRS_TMS,
-                        psWO->eWorkingDataType, tileMatrix, m_outputDirectory,
-                        nDstBands,
-                        psWO->padfDstNoDataReal ? &(psWO->padfDstNoDataReal[0])
-                                                : nullptr,
-                        m_maxZoomLevel, iX, iY, m_convention, nMinTileX,
-                        nMinTileY, m_skipBlank, bUserAskedForAlpha, m_auxXML,
-                        m_resume, m_metadata, poColorTable.get(), dstBuffer);
-
                     if (m_progressForked)
                     {
                         if (bEmitSpuriousCharsOnStdout)
@@ -3913,13 +4114,72 @@ bool GDALRasterTileAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
                     else
                     {
                         ++nCurTile;
-                        bRet &=
+                        bContinue =
                             (!pfnProgress ||
                              pfnProgress(static_cast<double>(nCurTile) /
                                              static_cast<double>(nTotalTiles),
                                          "", pProgressData));
                     }
                 }
+                return bContinue;
+            };
+
+            for (int iYMeta = nMinTileY; bRet && iYMeta <= nMaxTileY;
+                 iYMeta += nMetaTileSize)
+            {
+                const int iYMetaEndIncluded =
+                    std::min(iYMeta + nMetaTileSize - 1, nMaxTileY);
+                for (int iXMeta = nMinTileX; bRet && iXMeta <= nMaxTileX;
+                     iXMeta += nMetaTileSize)
+                {
+                    const int iXMetaEndIncluded =
+                        std::min(iXMeta + nMetaTileSize - 1, nMaxTileX);
+
+                    MetaTileBuffer sMetaTile;
+                    const MetaTileBuffer *psMetaTile = nullptr;
+                    if (nMetaTileSize > 1)
+                    {
+                        bool bSkip = false;
+                        bRet = WarpMetaTile(
+                            oWO, psWO->eWorkingDataType, tileMatrix,
+                            m_outputDirectory, m_maxZoomLevel, m_convention,
+                            pszExtension, iXMeta, iXMetaEndIncluded, iYMeta,
+                            iYMetaEndIncluded, nMinTileX, nMinTileY, m_resume,
+                            metaTileBuffer, sMetaTile, bSkip);
+                        if (bRet && bSkip)
+                        {
+                            bRet = ReportTilesDone(
+                                (iYMetaEndIncluded - iYMeta + 1) *
+                                (iXMetaEndIncluded - iXMeta + 1));
+                            continue;
+                        }
+                        psMetaTile = &sMetaTile;
+                    }
+
+                    for (int iY = iYMeta; bRet && iY <= iYMetaEndIncluded;
+                         ++iY)
+                    {
+                        for (int iX = iXMeta; bRet && iX <= iXMetaEndIncluded;
+                             ++iX)
+                        {
+                            bRet = GenerateTile(
+                                m_poSrcDS, m_poDstDriver, pszExtension,
+                                aosCreationOptions.List(), oWO, oSRS_TMS,
+                                psWO->eWorkingDataType, tileMatrix,
+                                m_outputDirectory, nDstBands,
+                                psWO->padfDstNoDataReal
+                                    ? &(psWO->padfDstNoDataReal[0])
+                                    : nullptr,
+                                m_maxZoomLevel, iX, iY, m_convention,
+                                nMinTileX, nMinTileY, m_skipBlank,
+                                bUserAskedForAlpha, m_auxXML, m_resume,
+                                m_metadata, poColorTable.get(), dstBuffer,
+                                psMetaTile);
+
+                            bRet = ReportTilesDone(1) && bRet;
+                        }
+                    }
+                }
             }
         }
 
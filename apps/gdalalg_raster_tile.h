@@ -78,6 +78,7 @@ class GDALRasterTileAlgorithm final : public GDALAlgorithm
     bool m_dummy = false;
     int m_numThreads = 0;
     std::string m_parallelMethod{};
+    int m_metatileSize = 1;
 
     std::string m_excludedValues{};
     double m_excludedValuesPctThreshold = 50;
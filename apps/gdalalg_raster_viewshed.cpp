@@ -198,9 +198,9 @@ bool GDALRasterViewshedAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     if (m_opts.outputMode == gdal::viewshed::OutputMode::Cumulative)
     {
         static const std::vector<std::string> badArgs{
-            "visible-value", "invisible-value", "max-distance",
-            "min-distance",  "start-angle",     "end-angle",
-            "low-pitch",     "high-pitch",      "position"};
+            "visible-value", "invisible-value", "min-distance",
+            "start-angle",   "end-angle",       "low-pitch",
+            "high-pitch",    "position"};
 
         for (const auto &arg : badArgs)
             if (GetArg(arg)->IsExplicitlySet())
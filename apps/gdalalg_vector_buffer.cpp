@@ -83,6 +83,7 @@ class GDALVectorBufferAlgorithmLayer final
             "QUADRANT_SEGMENTS", CPLSPrintf("%d", opts.m_quadrantSegments));
         m_aosBufferOptions.SetNameValue("SINGLE_SIDED",
                                         m_opts.m_side != "both" ? "YES" : "NO");
+        EnableParallelTranslation();
     }
 
   protected:
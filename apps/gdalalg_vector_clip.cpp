@@ -73,6 +73,8 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
                                  std::unique_ptr<OGRGeometry> poClipGeom)
         : GDALVectorPipelineOutputLayer(oSrcLayer),
           m_poClipGeom(std::move(poClipGeom)),
+          m_poClipGeomPrepared(OGRCreatePreparedGeometry(
+              OGRGeometry::ToHandle(m_poClipGeom.get()))),
           m_eSrcLayerGeomType(oSrcLayer.GetGeomType()),
           m_eFlattenSrcLayerGeomType(wkbFlatten(m_eSrcLayerGeomType)),
           m_bSrcLayerGeomTypeIsCollection(OGR_GT_IsSubClassOf(
@@ -103,7 +105,20 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
         auto poGeom = poSrcFeature->GetGeometryRef();
         if (poGeom)
         {
-            poIntersection.reset(poGeom->Intersection(m_poClipGeom.get()));
+            // Features fully inside the clipping geometry are kept as they
+            // are, which avoids a costly overlay operation.
+            if (m_poClipGeomPrepared && !poGeom->hasCurveGeometry())
+            {
+                CPLErrorReset();
+                if (OGRPreparedGeometryContains(m_poClipGeomPrepared.get(),
+                                                OGRGeometry::ToHandle(poGeom)) &&
+                    CPLGetLastErrorType() == CE_None)
+                {
+                    poIntersection.reset(poGeom->clone());
+                }
+            }
+            if (!poIntersection)
+                poIntersection.reset(poGeom->Intersection(m_poClipGeom.get()));
         }
         if (!poIntersection)
             return;
@@ -168,6 +183,7 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
 
   private:
     std::unique_ptr<OGRGeometry> const m_poClipGeom{};
+    OGRPreparedGeometryUniquePtr const m_poClipGeomPrepared{};
     const OGRwkbGeometryType m_eSrcLayerGeomType;
     const OGRwkbGeometryType m_eFlattenSrcLayerGeomType;
     const bool m_bSrcLayerGeomTypeIsCollection;
@@ -67,6 +67,7 @@ class GDALVectorMakeValidAlgorithmLayer final
             m_aosMakeValidOptions.SetNameValue(
                 "KEEP_COLLAPSED", m_opts.m_keepLowerDim ? "YES" : "NO");
         }
+        EnableParallelTranslation();
     }
 
   protected:
@@ -33,7 +33,10 @@
 #include "../frmts/mem/memdataset.h"
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cassert>
@@ -642,6 +645,17 @@ OGRFeature *GDALVectorPipelineOutputLayer::GetNextRawFeature()
     }
     m_pendingFeatures.clear();
     m_idxInPendingFeatures = 0;
+    while (m_nTranslationThreads > 1)
+    {
+        if (!TranslateNextBatchInParallel())
+            return nullptr;
+        if (!m_pendingFeatures.empty())
+        {
+            OGRFeature *poFeature = m_pendingFeatures[0].release();
+            m_idxInPendingFeatures = 1;
+            return poFeature;
+        }
+    }
     while (true)
     {
         auto poSrcFeature =
@@ -657,6 +671,104 @@ OGRFeature *GDALVectorPipelineOutputLayer::GetNextRawFeature()
     return poFeature;
 }
 
+/************************************************************************/
+/*      GDALVectorPipelineOutputLayer::EnableParallelTranslation()      */
+/************************************************************************/
+
+void GDALVectorPipelineOutputLayer::EnableParallelTranslation()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(1, std::min(2 * nThreads, atoi(pszNumThreads)));
+    m_nTranslationThreads = nThreads;
+}
+
+/************************************************************************/
+/*     GDALVectorPipelineOutputLayer::TranslateNextBatchInParallel()    */
+/************************************************************************/
+
+/** Read a batch of source features, and translate them with worker threads,
+ * each of them processing a contiguous range of the batch. Output features
+ * are appended to m_pendingFeatures in the order of the source features.
+ *
+ * @return false if the end of the source layer has been reached.
+ */
+bool GDALVectorPipelineOutputLayer::TranslateNextBatchInParallel()
+{
+    constexpr int FEATURES_PER_JOB = 64;
+    const size_t nBatchSize =
+        static_cast<size_t>(m_nTranslationThreads) * 4 * FEATURES_PER_JOB;
+
+    std::vector<std::unique_ptr<OGRFeature>> apoSrcFeatures;
+    apoSrcFeatures.reserve(nBatchSize);
+    while (apoSrcFeatures.size() < nBatchSize)
+    {
+        auto poSrcFeature =
+            std::unique_ptr<OGRFeature>(m_srcLayer.GetNextFeature());
+        if (!poSrcFeature)
+            break;
+        apoSrcFeatures.push_back(std::move(poSrcFeature));
+    }
+    if (apoSrcFeatures.empty())
+        return false;
+
+    const size_t nJobs =
+        (apoSrcFeatures.size() + FEATURES_PER_JOB - 1) / FEATURES_PER_JOB;
+    std::vector<std::vector<std::unique_ptr<OGRFeature>>> aapoOutFeatures(
+        nJobs);
+    CPLErrorAccumulator oErrorAccumulator;
+    const auto TranslateRange =
+        [this, &apoSrcFeatures, &aapoOutFeatures, &oErrorAccumulator](size_t i)
+    {
+        auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+        const size_t nStart = i * FEATURES_PER_JOB;
+        const size_t nEnd =
+            std::min(apoSrcFeatures.size(), nStart + FEATURES_PER_JOB);
+        for (size_t j = nStart; j < nEnd; ++j)
+            TranslateFeature(std::move(apoSrcFeatures[j]), aapoOutFeatures[i]);
+    };
+
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    if (nJobs > 1)
+    {
+        poThreadReservation = std::make_unique<GDALThreadReservation>(
+            static_cast<int>(std::min<size_t>(m_nTranslationThreads, nJobs)));
+        const int nThreads = poThreadReservation->GetThreadCount();
+        if (nThreads > 1)
+            poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    }
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (size_t i = 0; i < nJobs; ++i)
+        {
+            if (!poJobQueue->SubmitJob([&TranslateRange, i]()
+                                       { TranslateRange(i); }))
+            {
+                TranslateRange(i);
+            }
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (size_t i = 0; i < nJobs; ++i)
+            TranslateRange(i);
+    }
+    oErrorAccumulator.ReplayErrors();
+
+    for (auto &apoOutFeatures : aapoOutFeatures)
+    {
+        for (auto &poOutFeature : apoOutFeatures)
+            m_pendingFeatures.push_back(std::move(poOutFeature));
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 GDALVectorPipelineOutputDataset                      */
 /************************************************************************/
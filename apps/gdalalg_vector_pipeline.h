@@ -122,6 +122,14 @@ class GDALVectorPipelineOutputLayer /* non final */
 
     OGRLayer &m_srcLayer;
 
+    /** Allow source features to be translated in parallel, by batches,
+     * using up to GDAL_NUM_THREADS threads. The order of output features is
+     * the same as with sequential processing.
+     * Must only be called by subclasses whose TranslateFeature() method is
+     * thread-safe.
+     */
+    void EnableParallelTranslation();
+
   public:
     void ResetReading() override;
     OGRFeature *GetNextRawFeature();
@@ -129,6 +137,9 @@ class GDALVectorPipelineOutputLayer /* non final */
   private:
     std::vector<std::unique_ptr<OGRFeature>> m_pendingFeatures{};
     size_t m_idxInPendingFeatures = 0;
+    int m_nTranslationThreads = 1;
+
+    bool TranslateNextBatchInParallel();
 };
 
 /************************************************************************/
@@ -60,6 +60,7 @@ class GDALVectorSimplifyAlgorithmLayer final
         : GDALVectorGeomOneToOneAlgorithmLayer<GDALVectorSimplifyAlgorithm>(
               oSrcLayer, opts)
     {
+        EnableParallelTranslation();
     }
 };
 
@@ -54,6 +54,26 @@ GDALVSICopyAlgorithm::GDALVSICopyAlgorithm()
            &m_recursive);
 
     AddArg("skip-errors", 0, _("Skip errors"), &m_skip);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of parallel requests to download a network "
+                       "file (or ALL_CPUS)"));
+    AddArg("chunk-size", 0, _("Size of each request of parallel downloads"),
+           &m_chunkSize)
+        .SetMetaVar("<value in bytes or with K/M/G suffix>")
+        .AddValidationAction(
+            [this]()
+            {
+                GIntBig nVal = 0;
+                if (CPLParseMemorySize(m_chunkSize.c_str(), &nVal, nullptr) !=
+                        CE_None ||
+                    nVal <= 0)
+                {
+                    ReportError(CE_Failure, CPLE_IllegalArg,
+                                "Invalid value for 'chunk-size' argument");
+                    return false;
+                }
+                return true;
+            });
     AddProgressArg();
 }
 
@@ -189,8 +209,13 @@ bool GDALVSICopyAlgorithm::CopySingle(const std::string &src,
         const std::string filename = CPLGetFilename(src.c_str());
         dst = CPLFormFilenameSafe(dst.c_str(), filename.c_str(), nullptr);
     }
-    return VSICopyFile(src.c_str(), dst.c_str(), nullptr, size, nullptr,
-                       pfnProgress, pProgressData) == 0 ||
+    CPLStringList aosOptions;
+    if (m_numThreads > 1)
+        aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
+    if (!m_chunkSize.empty())
+        aosOptions.SetNameValue("CHUNK_SIZE", m_chunkSize.c_str());
+    return VSICopyFile(src.c_str(), dst.c_str(), nullptr, size,
+                       aosOptions.List(), pfnProgress, pProgressData) == 0 ||
            m_skip;
 }
 
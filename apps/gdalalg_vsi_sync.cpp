@@ -12,10 +12,13 @@
 
 #include "gdalalg_vsi_sync.h"
 
+#include "cpl_conv.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
 
+#include <climits>
+
 //! @cond Doxygen_Suppress
 
 #ifndef _
@@ -55,6 +58,26 @@ GDALVSISyncAlgorithm::GDALVSISyncAlgorithm()
         .SetChoices("timestamp", "ETag", "overwrite");
 
     AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+
+    AddArg("chunk-size", 0,
+           _("Size of the parts in which large files are split to be "
+             "downloaded or uploaded in parallel"),
+           &m_chunkSize)
+        .SetMetaVar("<value in bytes or with K/M/G suffix>")
+        .AddValidationAction(
+            [this]()
+            {
+                GIntBig nVal = 0;
+                if (CPLParseMemorySize(m_chunkSize.c_str(), &nVal, nullptr) !=
+                        CE_None ||
+                    nVal <= 0 || nVal > INT_MAX)
+                {
+                    ReportError(CE_Failure, CPLE_IllegalArg,
+                                "Invalid value for 'chunk-size' argument");
+                    return false;
+                }
+                return true;
+            });
 }
 
 /************************************************************************/
@@ -68,6 +91,13 @@ bool GDALVSISyncAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     aosOptions.SetNameValue("RECURSIVE", m_recursive ? "YES" : "NO");
     aosOptions.SetNameValue("STRATEGY", m_strategy.c_str());
     aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
+    if (!m_chunkSize.empty())
+    {
+        GIntBig nChunkSize = 0;
+        CPLParseMemorySize(m_chunkSize.c_str(), &nChunkSize, nullptr);
+        aosOptions.SetNameValue("CHUNK_SIZE",
+                                CPLSPrintf(CPL_FRMT_GIB, nChunkSize));
+    }
 
     if (!VSISync(m_source.c_str(), m_destination.c_str(), aosOptions.List(),
                  pfnProgress, pProgressData, nullptr))
@@ -38,6 +38,7 @@ class GDALVSISyncAlgorithm final : public GDALAlgorithm
     bool m_recursive = false;
     std::string m_strategy = "timestamp";
     int m_numThreads = 0;
+    std::string m_chunkSize{};
 
     // Work variables
     std::string m_numThreadsStr{};
@@ -26,7 +26,10 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -34,11 +37,14 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_json.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_vrt.h"
 #include "gdal_priv.h"
@@ -90,6 +96,11 @@ struct DatasetProperty
     int nMaskBlockXSize = 0;
     int nMaskBlockYSize = 0;
     std::vector<int> anOverviewFactors{};
+    // Properties of the source bands, for -trust_source_properties
+    std::vector<int> anOverviewCount{};
+    std::vector<int> anMaskFlags{};
+    std::vector<bool> abSrcHasNoData{};
+    std::vector<double> adfSrcNoDataValues{};
 };
 
 struct BandProperty
@@ -104,6 +115,44 @@ struct BandProperty
     bool bHasScale = false;
     double dfScale = 0;
 };
+
+/** Raw properties of a source band, as reported by the source dataset */
+struct SourceBandInfo
+{
+    GDALDataType eDataType = GDT_Unknown;
+    GDALColorInterp eColorInterp = GCI_Undefined;
+    std::unique_ptr<GDALColorTable> poColorTable{};  // for palette bands only
+    bool bHasNoData = false;
+    double dfNoDataValue = 0;
+    bool bHasOffset = false;
+    double dfOffset = 0;
+    bool bHasScale = false;
+    double dfScale = 1;
+    int nMaskFlags = GMF_ALL_VALID;
+    int nOverviewCount = 0;
+};
+
+/** Properties of a source dataset needed by VRTBuilder::AnalyseRaster().
+ *
+ * They do not depend on the state of the builder, so they can be collected
+ * from worker threads, or read from a metadata cache file.
+ */
+struct SourceInfo
+{
+    CPLStringList aosSubdatasets{};  // only set if the dataset has no band
+    bool bHasProjection = false;
+    std::string osProjection{};
+    bool bHasGeoTransform = false;
+    GDALGeoTransform gt{};
+    int nRasterXSize = 0;
+    int nRasterYSize = 0;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    int nMaskBlockXSize = 0;
+    int nMaskBlockYSize = 0;
+    std::vector<int> anOverviewFactors{};
+    std::vector<SourceBandInfo> aoBands{};
+};
 }  // namespace gdal::GDALBuildVRT
 
 using namespace gdal::GDALBuildVRT;
@@ -192,6 +241,514 @@ static int GetSrcDstWin(DatasetProperty *psDP, double we_res, double ns_res,
            *pdfDstYSize > 0;
 }
 
+/************************************************************************/
+/*                         CollectSourceInfo()                          */
+/************************************************************************/
+
+static std::unique_ptr<SourceInfo> CollectSourceInfo(GDALDataset *poDS)
+{
+    auto poInfo = std::make_unique<SourceInfo>();
+    const int nBands = poDS->GetRasterCount();
+    if (nBands == 0)
+    {
+        poInfo->aosSubdatasets = CPLStringList(
+            static_cast<CSLConstList>(poDS->GetMetadata("SUBDATASETS")));
+    }
+
+    const char *pszProjection = poDS->GetProjectionRef();
+    poInfo->bHasProjection = pszProjection != nullptr;
+    if (pszProjection)
+        poInfo->osProjection = pszProjection;
+    poInfo->bHasGeoTransform = poDS->GetGeoTransform(poInfo->gt) == CE_None;
+    poInfo->nRasterXSize = poDS->GetRasterXSize();
+    poInfo->nRasterYSize = poDS->GetRasterYSize();
+    if (nBands == 0)
+        return poInfo;
+
+    GDALRasterBand *poFirstBand = poDS->GetRasterBand(1);
+    poFirstBand->GetBlockSize(&poInfo->nBlockXSize, &poInfo->nBlockYSize);
+    poFirstBand->GetMaskBand()->GetBlockSize(&poInfo->nMaskBlockXSize,
+                                             &poInfo->nMaskBlockYSize);
+
+    // Collect overview factors. We only handle power-of-two situations for now
+    const int nOverviews = poFirstBand->GetOverviewCount();
+    int nExpectedOvFactor = 2;
+    for (int j = 0; j < nOverviews; j++)
+    {
+        GDALRasterBand *poOverview = poFirstBand->GetOverview(j);
+        if (!poOverview)
+            continue;
+        if (poOverview->GetXSize() < 128 && poOverview->GetYSize() < 128)
+        {
+            break;
+        }
+
+        const int nOvFactor = GDALComputeOvFactor(
+            poOverview->GetXSize(), poFirstBand->GetXSize(),
+            poOverview->GetYSize(), poFirstBand->GetYSize());
+
+        if (nOvFactor != nExpectedOvFactor)
+            break;
+
+        poInfo->anOverviewFactors.push_back(nOvFactor);
+        nExpectedOvFactor *= 2;
+    }
+
+    poInfo->aoBands.resize(nBands);
+    for (int j = 0; j < nBands; j++)
+    {
+        GDALRasterBand *poBand = poDS->GetRasterBand(j + 1);
+        auto &oBand = poInfo->aoBands[j];
+        oBand.eDataType = poBand->GetRasterDataType();
+        oBand.eColorInterp = poBand->GetColorInterpretation();
+        if (oBand.eColorInterp == GCI_PaletteIndex)
+        {
+            if (const auto poColorTable = poBand->GetColorTable())
+                oBand.poColorTable.reset(poColorTable->Clone());
+        }
+        int bHasNoData = false;
+        oBand.dfNoDataValue = poBand->GetNoDataValue(&bHasNoData);
+        oBand.bHasNoData = bHasNoData != 0;
+        int bHasOffset = false;
+        oBand.dfOffset = poBand->GetOffset(&bHasOffset);
+        oBand.bHasOffset = bHasOffset != 0;
+        int bHasScale = false;
+        oBand.dfScale = poBand->GetScale(&bHasScale);
+        oBand.bHasScale = bHasScale != 0;
+        oBand.nMaskFlags = poBand->GetMaskFlags();
+        oBand.nOverviewCount = poBand->GetOverviewCount();
+    }
+    return poInfo;
+}
+
+/************************************************************************/
+/*                         SourceInfoToJSON()                           */
+/************************************************************************/
+
+// Floating-point values are serialized as strings, so that nan and infinity
+// nodata values round-trip.
+static std::string DoubleToString(double dfVal)
+{
+    if (std::isnan(dfVal))
+        return "nan";
+    return CPLSPrintf("%.17g", dfVal);
+}
+
+static CPLJSONObject SourceInfoToJSON(const SourceInfo &oInfo)
+{
+    CPLJSONObject oJSON;
+    if (!oInfo.aosSubdatasets.empty())
+    {
+        CPLJSONArray oSubdatasets;
+        for (const char *pszItem : oInfo.aosSubdatasets)
+            oSubdatasets.Add(pszItem);
+        oJSON.Add("subdatasets", oSubdatasets);
+    }
+    if (oInfo.bHasProjection)
+        oJSON.Add("srs", oInfo.osProjection);
+    if (oInfo.bHasGeoTransform)
+    {
+        CPLJSONArray oGT;
+        for (int i = 0; i < 6; ++i)
+            oGT.Add(DoubleToString(oInfo.gt[i]));
+        oJSON.Add("geotransform", oGT);
+    }
+    oJSON.Add("width", oInfo.nRasterXSize);
+    oJSON.Add("height", oInfo.nRasterYSize);
+    oJSON.Add("block_width", oInfo.nBlockXSize);
+    oJSON.Add("block_height", oInfo.nBlockYSize);
+    oJSON.Add("mask_block_width", oInfo.nMaskBlockXSize);
+    oJSON.Add("mask_block_height", oInfo.nMaskBlockYSize);
+    CPLJSONArray oOverviewFactors;
+    for (int nFactor : oInfo.anOverviewFactors)
+        oOverviewFactors.Add(nFactor);
+    oJSON.Add("overview_factors", oOverviewFactors);
+
+    CPLJSONArray oBands;
+    for (const auto &oBand : oInfo.aoBands)
+    {
+        CPLJSONObject oJSONBand;
+        oJSONBand.Add("type", GDALGetDataTypeName(oBand.eDataType));
+        oJSONBand.Add("color_interp",
+                      GDALGetColorInterpretationName(oBand.eColorInterp));
+        if (oBand.poColorTable)
+        {
+            CPLJSONArray oEntries;
+            for (int i = 0; i < oBand.poColorTable->GetColorEntryCount(); ++i)
+            {
+                const GDALColorEntry *psEntry =
+                    oBand.poColorTable->GetColorEntry(i);
+                CPLJSONArray oEntry;
+                oEntry.Add(psEntry->c1);
+                oEntry.Add(psEntry->c2);
+                oEntry.Add(psEntry->c3);
+                oEntry.Add(psEntry->c4);
+                oEntries.Add(oEntry);
+            }
+            oJSONBand.Add("color_table", oEntries);
+        }
+        if (oBand.bHasNoData)
+            oJSONBand.Add("nodata", DoubleToString(oBand.dfNoDataValue));
+        if (oBand.bHasOffset)
+            oJSONBand.Add("offset", DoubleToString(oBand.dfOffset));
+        if (oBand.bHasScale)
+            oJSONBand.Add("scale", DoubleToString(oBand.dfScale));
+        oJSONBand.Add("mask_flags", oBand.nMaskFlags);
+        oJSONBand.Add("overview_count", oBand.nOverviewCount);
+        oBands.Add(oJSONBand);
+    }
+    oJSON.Add("bands", oBands);
+    return oJSON;
+}
+
+/************************************************************************/
+/*                        SourceInfoFromJSON()                          */
+/************************************************************************/
+
+static std::unique_ptr<SourceInfo>
+SourceInfoFromJSON(const CPLJSONObject &oJSON)
+{
+    auto poInfo = std::make_unique<SourceInfo>();
+    for (const auto &oItem : oJSON.GetArray("subdatasets"))
+        poInfo->aosSubdatasets.AddString(oItem.ToString().c_str());
+    const auto oSRS = oJSON.GetObj("srs");
+    if (oSRS.IsValid())
+    {
+        poInfo->bHasProjection = true;
+        poInfo->osProjection = oSRS.ToString();
+    }
+    const auto oGT = oJSON.GetArray("geotransform");
+    if (oGT.IsValid())
+    {
+        if (oGT.Size() != 6)
+            return nullptr;
+        poInfo->bHasGeoTransform = true;
+        for (int i = 0; i < 6; ++i)
+            poInfo->gt[i] = CPLAtof(oGT[i].ToString().c_str());
+    }
+    poInfo->nRasterXSize = oJSON.GetInteger("width");
+    poInfo->nRasterYSize = oJSON.GetInteger("height");
+    poInfo->nBlockXSize = oJSON.GetInteger("block_width");
+    poInfo->nBlockYSize = oJSON.GetInteger("block_height");
+    poInfo->nMaskBlockXSize = oJSON.GetInteger("mask_block_width");
+    poInfo->nMaskBlockYSize = oJSON.GetInteger("mask_block_height");
+    for (const auto &oItem : oJSON.GetArray("overview_factors"))
+        poInfo->anOverviewFactors.push_back(oItem.ToInteger());
+
+    for (const auto &oJSONBand : oJSON.GetArray("bands"))
+    {
+        SourceBandInfo oBand;
+        oBand.eDataType =
+            GDALGetDataTypeByName(oJSONBand.GetString("type").c_str());
+        if (oBand.eDataType == GDT_Unknown)
+            return nullptr;
+        oBand.eColorInterp = GDALGetColorInterpretationByName(
+            oJSONBand.GetString("color_interp").c_str());
+        const auto oEntries = oJSONBand.GetArray("color_table");
+        if (oEntries.IsValid())
+        {
+            oBand.poColorTable = std::make_unique<GDALColorTable>();
+            int i = 0;
+            for (const auto &oJSONEntry : oEntries)
+            {
+                const CPLJSONArray oEntry(oJSONEntry);
+                if (oEntry.Size() != 4)
+                    return nullptr;
+                GDALColorEntry sEntry;
+                sEntry.c1 = static_cast<short>(oEntry[0].ToInteger());
+                sEntry.c2 = static_cast<short>(oEntry[1].ToInteger());
+                sEntry.c3 = static_cast<short>(oEntry[2].ToInteger());
+                sEntry.c4 = static_cast<short>(oEntry[3].ToInteger());
+                oBand.poColorTable->SetColorEntry(i, &sEntry);
+                ++i;
+            }
+        }
+        const auto ReadDouble =
+            [&oJSONBand](const char *pszKey, bool &bHasValue, double &dfValue)
+        {
+            const auto oValue = oJSONBand.GetObj(pszKey);
+            bHasValue = oValue.IsValid();
+            if (bHasValue)
+                dfValue = CPLAtof(oValue.ToString().c_str());
+        };
+        ReadDouble("nodata", oBand.bHasNoData, oBand.dfNoDataValue);
+        ReadDouble("offset", oBand.bHasOffset, oBand.dfOffset);
+        ReadDouble("scale", oBand.bHasScale, oBand.dfScale);
+        oBand.nMaskFlags = oJSONBand.GetInteger("mask_flags", GMF_ALL_VALID);
+        oBand.nOverviewCount = oJSONBand.GetInteger("overview_count");
+        poInfo->aoBands.push_back(std::move(oBand));
+    }
+    return poInfo;
+}
+
+/************************************************************************/
+/*                           MetadataCache                              */
+/************************************************************************/
+
+/** Cache file of the properties of the sources, so that rebuilding a VRT
+ * after adding a few sources only opens the new ones.
+ *
+ * Entries are invalidated when the size or modification time of the source
+ * file changes.
+ */
+class MetadataCache
+{
+  public:
+    struct Entry
+    {
+        GIntBig nSize = 0;
+        GIntBig nMTime = 0;
+        std::shared_ptr<const SourceInfo> poInfo{};
+    };
+
+    MetadataCache(const std::string &osFilename, CSLConstList papszOpenOptions)
+        : m_osFilename(osFilename), m_aosOpenOptions(papszOpenOptions)
+    {
+    }
+
+    void Load();
+    bool Save() const;
+
+    /** Returns the cached properties of a source, or nullptr.
+     * May be called from several threads (after Load())
+     */
+    std::shared_ptr<const SourceInfo> Lookup(const std::string &osSource,
+                                             const VSIStatBufL &sStat) const
+    {
+        const auto oIter = m_oMapEntries.find(osSource);
+        if (oIter != m_oMapEntries.end() &&
+            oIter->second.nSize == static_cast<GIntBig>(sStat.st_size) &&
+            oIter->second.nMTime == static_cast<GIntBig>(sStat.st_mtime))
+        {
+            return oIter->second.poInfo;
+        }
+        return nullptr;
+    }
+
+    /** Records the properties of a source. Not thread-safe. */
+    void Store(const std::string &osSource, Entry &&oEntry)
+    {
+        m_oMapNewEntries[osSource] = std::move(oEntry);
+    }
+
+  private:
+    static constexpr int VERSION = 1;
+
+    const std::string m_osFilename;
+    const CPLStringList m_aosOpenOptions;
+    std::map<std::string, Entry> m_oMapEntries{};     // loaded
+    std::map<std::string, Entry> m_oMapNewEntries{};  // to be saved
+
+    CPL_DISALLOW_COPY_ASSIGN(MetadataCache)
+};
+
+void MetadataCache::Load()
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(m_osFilename.c_str(), &sStat) != 0)
+        return;
+
+    CPLJSONDocument oDoc;
+    if (!oDoc.Load(m_osFilename))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Cannot read metadata cache %s. Ignoring it",
+                 m_osFilename.c_str());
+        return;
+    }
+    const auto oRoot = oDoc.GetRoot();
+    if (oRoot.GetInteger("gdalbuildvrt_metadata_cache_version") != VERSION)
+    {
+        CPLDebug("BuildVRT", "Ignoring %s: unhandled version",
+                 m_osFilename.c_str());
+        return;
+    }
+    CPLStringList aosOpenOptions;
+    for (const auto &oItem : oRoot.GetArray("open_options"))
+        aosOpenOptions.AddString(oItem.ToString().c_str());
+    bool bSameOpenOptions =
+        aosOpenOptions.size() == m_aosOpenOptions.size();
+    for (int i = 0; bSameOpenOptions && i < aosOpenOptions.size(); ++i)
+        bSameOpenOptions = strcmp(aosOpenOptions[i], m_aosOpenOptions[i]) == 0;
+    if (!bSameOpenOptions)
+    {
+        CPLDebug("BuildVRT", "Ignoring %s: different open options",
+                 m_osFilename.c_str());
+        return;
+    }
+    for (const auto &oJSONEntry : oRoot.GetArray("sources"))
+    {
+        Entry oEntry;
+        oEntry.nSize = oJSONEntry.GetLong("size", -1);
+        oEntry.nMTime = oJSONEntry.GetLong("mtime", -1);
+        oEntry.poInfo = SourceInfoFromJSON(oJSONEntry.GetObj("properties"));
+        if (oEntry.poInfo)
+        {
+            m_oMapEntries[oJSONEntry.GetString("filename")] =
+                std::move(oEntry);
+        }
+    }
+}
+
+bool MetadataCache::Save() const
+{
+    CPLJSONDocument oDoc;
+    auto oRoot = oDoc.GetRoot();
+    oRoot.Add("gdalbuildvrt_metadata_cache_version", VERSION);
+    CPLJSONArray oOpenOptions;
+    for (const char *pszItem : m_aosOpenOptions)
+        oOpenOptions.Add(pszItem);
+    oRoot.Add("open_options", oOpenOptions);
+    CPLJSONArray oSources;
+    for (const auto &[osSource, oEntry] : m_oMapNewEntries)
+    {
+        CPLJSONObject oJSONEntry;
+        oJSONEntry.Add("filename", osSource);
+        oJSONEntry.Add("size", static_cast<GInt64>(oEntry.nSize));
+        oJSONEntry.Add("mtime", static_cast<GInt64>(oEntry.nMTime));
+        oJSONEntry.Add("properties", SourceInfoToJSON(*(oEntry.poInfo)));
+        oSources.Add(oJSONEntry);
+    }
+    oRoot.Add("sources", oSources);
+    return oDoc.Save(m_osFilename);
+}
+
+/************************************************************************/
+/*                          SourceInfoFetcher                           */
+/************************************************************************/
+
+/** Opens sources and collects their properties, possibly ahead of their use
+ * from a pool of worker threads. Opening remote datasets is mostly latency
+ * bound, hence the benefit of doing it concurrently even with more threads
+ * than CPU cores.
+ */
+class SourceInfoFetcher
+{
+  public:
+    struct Result
+    {
+        std::shared_ptr<const SourceInfo> poInfo{};  // nullptr if not opened
+        bool bHasStat = false;
+        VSIStatBufL sStat{};
+    };
+
+    SourceInfoFetcher(int nThreads, CSLConstList papszOpenOptions,
+                      const MetadataCache *poCache)
+        : m_aosOpenOptions(papszOpenOptions), m_poCache(poCache),
+          m_aosThreadLocalConfigOptions(CPLGetThreadLocalConfigOptions())
+    {
+        if (nThreads > 1)
+        {
+            m_poPool = std::make_unique<CPLWorkerThreadPool>();
+            if (!m_poPool->Setup(nThreads, nullptr, nullptr))
+                m_poPool.reset();
+        }
+    }
+
+    /** Returns the properties of the source of index i.
+     *
+     * Must be called with increasing values of i. papszFilenames and
+     * nFilenames may grow between calls.
+     */
+    Result Get(int i, const char *const *papszFilenames, int nFilenames);
+
+  private:
+    struct Job
+    {
+        std::string osFilename{};
+        Result oResult{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        bool bDone = false;
+    };
+
+    const CPLStringList m_aosOpenOptions;
+    const MetadataCache *const m_poCache;
+    const CPLStringList m_aosThreadLocalConfigOptions;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<int, std::shared_ptr<Job>> m_oMapJobs{};
+    int m_nNextJob = 0;
+    // Must be declared last, so that pending jobs are completed before
+    // the above members are destroyed
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    void Run(Job &oJob) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(SourceInfoFetcher)
+};
+
+void SourceInfoFetcher::Run(Job &oJob) const
+{
+    auto &oResult = oJob.oResult;
+    if (m_poCache)
+    {
+        oResult.bHasStat =
+            VSIStatL(oJob.osFilename.c_str(), &oResult.sStat) == 0;
+        if (oResult.bHasStat)
+        {
+            oResult.poInfo = m_poCache->Lookup(oJob.osFilename, oResult.sStat);
+            if (oResult.poInfo)
+                return;
+        }
+    }
+    auto poDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::Open(oJob.osFilename.c_str(), GDAL_OF_RASTER, nullptr,
+                          m_aosOpenOptions.List(), nullptr));
+    if (poDS)
+        oResult.poInfo = CollectSourceInfo(poDS.get());
+}
+
+SourceInfoFetcher::Result
+SourceInfoFetcher::Get(int i, const char *const *papszFilenames, int nFilenames)
+{
+    if (!m_poPool)
+    {
+        Job oJob;
+        oJob.osFilename = papszFilenames[i];
+        Run(oJob);
+        return std::move(oJob.oResult);
+    }
+
+    // Keep a bounded number of sources ahead of the one requested
+    const int nMaxAhead = 4 * m_poPool->GetThreadCount();
+    m_nNextJob = std::max(m_nNextJob, i);
+    for (; m_nNextJob < nFilenames && m_nNextJob <= i + nMaxAhead; ++m_nNextJob)
+    {
+        auto poJob = std::make_shared<Job>();
+        poJob->osFilename = papszFilenames[m_nNextJob];
+        m_oMapJobs[m_nNextJob] = poJob;
+        m_poPool->SubmitJob(
+            [this, poJob]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    m_aosThreadLocalConfigOptions.List());
+                {
+                    auto oAccumulator =
+                        poJob->oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    Run(*poJob);
+                }
+                CPLSetThreadLocalConfigOptions(nullptr);
+                std::lock_guard oLock(m_oMutex);
+                poJob->bDone = true;
+                m_oCV.notify_all();
+            });
+    }
+
+    const auto oIter = m_oMapJobs.find(i);
+    CPLAssert(oIter != m_oMapJobs.end());
+    auto poJob = oIter->second;
+    m_oMapJobs.erase(oIter);
+    {
+        std::unique_lock oLock(m_oMutex);
+        m_oCV.wait(oLock, [&poJob] { return poJob->bDone; });
+    }
+    // Emit errors and warnings from the calling thread, in the order of
+    // the sources
+    poJob->oErrorAccumulator.ReplayErrors();
+    return std::move(poJob->oResult);
+}
+
 /************************************************************************/
 /*                            VRTBuilder                                */
 /************************************************************************/
@@ -237,6 +794,7 @@ class VRTBuilder
     std::string osPixelFunction{};
     const CPLStringList aosPixelFunctionArgs;
     const bool bWriteAbsolutePath;
+    const bool bTrustSourceProperties;
 
     /* Internal variables */
     char *pszProjectionRef = nullptr;
@@ -256,7 +814,7 @@ class VRTBuilder
     int bHasRunBuild = 0;
     int bHasDatasetMask = 0;
 
-    std::string AnalyseRaster(GDALDatasetH hDS,
+    std::string AnalyseRaster(const SourceInfo &oInfo, const char *dsFileName,
                               DatasetProperty *psDatasetProperties);
 
     void CreateVRTSeparate(VRTDataset *poVTDS);
@@ -280,7 +838,7 @@ class VRTBuilder
                const CPLStringList &aosPixelFunctionArgs,
                const char *const *papszOpenOptionsIn,
                const CPLStringList &aosCreateOptionsIn,
-               bool bWriteAbsolutePathIn);
+               bool bWriteAbsolutePathIn, bool bTrustSourcePropertiesIn);
 
     ~VRTBuilder();
 
@@ -288,6 +846,8 @@ class VRTBuilder
                                        void *pProgressData);
 
     std::string m_osProgramName{};
+    int m_nNumThreads = 1;
+    std::string m_osMetadataCacheFilename{};
 };
 
 /************************************************************************/
@@ -308,10 +868,12 @@ VRTBuilder::VRTBuilder(
     const char *pszResamplingIn, const char *pszPixelFunctionIn,
     const CPLStringList &aosPixelFunctionArgsIn,
     const char *const *papszOpenOptionsIn,
-    const CPLStringList &aosCreateOptionsIn, bool bWriteAbsolutePathIn)
+    const CPLStringList &aosCreateOptionsIn, bool bWriteAbsolutePathIn,
+    bool bTrustSourcePropertiesIn)
     : bStrict(bStrictIn), aosCreateOptions(aosCreateOptionsIn),
       aosPixelFunctionArgs(aosPixelFunctionArgsIn),
-      bWriteAbsolutePath(bWriteAbsolutePathIn)
+      bWriteAbsolutePath(bWriteAbsolutePathIn),
+      bTrustSourceProperties(bTrustSourcePropertiesIn)
 {
     pszOutputFilename = CPLStrdup(pszOutputFilenameIn);
     nInputFiles = nInputFilesIn;
@@ -464,13 +1026,12 @@ static void checkNoDataValues(const std::vector<BandProperty> &asProperties)
     }
 }
 
-std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
+std::string VRTBuilder::AnalyseRaster(const SourceInfo &oInfo,
+                                      const char *dsFileName,
                                       DatasetProperty *psDatasetProperties)
 {
-    GDALDataset *poDS = GDALDataset::FromHandle(hDS);
-    const char *dsFileName = poDS->GetDescription();
-    char **papszMetadata = poDS->GetMetadata("SUBDATASETS");
-    if (CSLCount(papszMetadata) > 0 && poDS->GetRasterCount() == 0)
+    CSLConstList papszMetadata = oInfo.aosSubdatasets.List();
+    if (CSLCount(papszMetadata) > 0 && oInfo.aoBands.empty())
     {
         ppszInputFilenames = static_cast<char **>(CPLRealloc(
             ppszInputFilenames,
@@ -516,9 +1077,11 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
         return "SILENTLY_IGNORE";
     }
 
-    const char *proj = poDS->GetProjectionRef();
+    const char *proj =
+        oInfo.bHasProjection ? oInfo.osProjection.c_str() : nullptr;
     auto &gt = psDatasetProperties->gt;
-    int bGotGeoTransform = poDS->GetGeoTransform(gt) == CE_None;
+    gt = oInfo.gt;
+    const int bGotGeoTransform = oInfo.bHasGeoTransform;
     if (bSeparate)
     {
         std::string osProgramName(m_osProgramName);
@@ -551,8 +1114,8 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
             return osProgramName + " cannot stack ungeoreferenced and "
                                    "georeferenced images.";
         }
-        else if (!bHasGeoTransform && (nRasterXSize != poDS->GetRasterXSize() ||
-                                       nRasterYSize != poDS->GetRasterYSize()))
+        else if (!bHasGeoTransform && (nRasterXSize != oInfo.nRasterXSize ||
+                                       nRasterYSize != oInfo.nRasterYSize))
         {
             return osProgramName + " cannot stack ungeoreferenced images "
                                    "that have not the same dimensions.";
@@ -582,31 +1145,30 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
         }
     }
 
-    psDatasetProperties->nRasterXSize = poDS->GetRasterXSize();
-    psDatasetProperties->nRasterYSize = poDS->GetRasterYSize();
+    psDatasetProperties->nRasterXSize = oInfo.nRasterXSize;
+    psDatasetProperties->nRasterYSize = oInfo.nRasterYSize;
     if (bFirst && bSeparate && !bGotGeoTransform)
     {
-        nRasterXSize = poDS->GetRasterXSize();
-        nRasterYSize = poDS->GetRasterYSize();
+        nRasterXSize = oInfo.nRasterXSize;
+        nRasterYSize = oInfo.nRasterYSize;
     }
 
     double ds_minX = gt[GEOTRSFRM_TOPLEFT_X];
     double ds_maxY = gt[GEOTRSFRM_TOPLEFT_Y];
-    double ds_maxX = ds_minX + GDALGetRasterXSize(hDS) * gt[GEOTRSFRM_WE_RES];
-    double ds_minY = ds_maxY + GDALGetRasterYSize(hDS) * gt[GEOTRSFRM_NS_RES];
+    double ds_maxX = ds_minX + oInfo.nRasterXSize * gt[GEOTRSFRM_WE_RES];
+    double ds_minY = ds_maxY + oInfo.nRasterYSize * gt[GEOTRSFRM_NS_RES];
 
-    int _nBands = GDALGetRasterCount(hDS);
+    int _nBands = static_cast<int>(oInfo.aoBands.size());
     if (_nBands == 0)
     {
         return "Dataset has no bands";
     }
     if (bNoDataFromMask &&
-        poDS->GetRasterBand(_nBands)->GetColorInterpretation() == GCI_AlphaBand)
+        oInfo.aoBands[_nBands - 1].eColorInterp == GCI_AlphaBand)
         _nBands--;
 
-    GDALRasterBand *poFirstBand = poDS->GetRasterBand(1);
-    poFirstBand->GetBlockSize(&psDatasetProperties->nBlockXSize,
-                              &psDatasetProperties->nBlockYSize);
+    psDatasetProperties->nBlockXSize = oInfo.nBlockXSize;
+    psDatasetProperties->nBlockYSize = oInfo.nBlockYSize;
 
     /* For the -separate case */
     psDatasetProperties->aeBandType.resize(_nBands);
@@ -622,47 +1184,29 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
 
     psDatasetProperties->abHasMaskBand.resize(_nBands);
 
+    psDatasetProperties->anOverviewCount.resize(_nBands);
+    psDatasetProperties->anMaskFlags.resize(_nBands);
+    psDatasetProperties->abSrcHasNoData.resize(_nBands);
+    psDatasetProperties->adfSrcNoDataValues.resize(_nBands);
+
     psDatasetProperties->bHasDatasetMask =
-        poFirstBand->GetMaskFlags() == GMF_PER_DATASET;
+        oInfo.aoBands[0].nMaskFlags == GMF_PER_DATASET;
     if (psDatasetProperties->bHasDatasetMask)
         bHasDatasetMask = TRUE;
-    poFirstBand->GetMaskBand()->GetBlockSize(
-        &psDatasetProperties->nMaskBlockXSize,
-        &psDatasetProperties->nMaskBlockYSize);
+    psDatasetProperties->nMaskBlockXSize = oInfo.nMaskBlockXSize;
+    psDatasetProperties->nMaskBlockYSize = oInfo.nMaskBlockYSize;
 
     psDatasetProperties->bLastBandIsAlpha = false;
-    if (poDS->GetRasterBand(_nBands)->GetColorInterpretation() == GCI_AlphaBand)
+    if (oInfo.aoBands[_nBands - 1].eColorInterp == GCI_AlphaBand)
         psDatasetProperties->bLastBandIsAlpha = true;
 
-    // Collect overview factors. We only handle power-of-two situations for now
-    const int nOverviews = poFirstBand->GetOverviewCount();
-    int nExpectedOvFactor = 2;
-    for (int j = 0; j < nOverviews; j++)
-    {
-        GDALRasterBand *poOverview = poFirstBand->GetOverview(j);
-        if (!poOverview)
-            continue;
-        if (poOverview->GetXSize() < 128 && poOverview->GetYSize() < 128)
-        {
-            break;
-        }
-
-        const int nOvFactor = GDALComputeOvFactor(
-            poOverview->GetXSize(), poFirstBand->GetXSize(),
-            poOverview->GetYSize(), poFirstBand->GetYSize());
-
-        if (nOvFactor != nExpectedOvFactor)
-            break;
-
-        psDatasetProperties->anOverviewFactors.push_back(nOvFactor);
-        nExpectedOvFactor *= 2;
-    }
+    psDatasetProperties->anOverviewFactors = oInfo.anOverviewFactors;
 
     for (int j = 0; j < _nBands; j++)
     {
-        GDALRasterBand *poBand = poDS->GetRasterBand(j + 1);
+        const auto &oBand = oInfo.aoBands[j];
 
-        psDatasetProperties->aeBandType[j] = poBand->GetRasterDataType();
+        psDatasetProperties->aeBandType[j] = oBand.eDataType;
 
         if (!bSeparate && nSrcNoDataCount > 0)
         {
@@ -675,26 +1219,30 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
         }
         else
         {
-            int bHasNoData = false;
-            psDatasetProperties->adfNoDataValues[j] =
-                poBand->GetNoDataValue(&bHasNoData);
-            psDatasetProperties->abHasNoData[j] = bHasNoData != 0;
+            psDatasetProperties->adfNoDataValues[j] = oBand.dfNoDataValue;
+            psDatasetProperties->abHasNoData[j] = oBand.bHasNoData;
         }
 
-        int bHasOffset = false;
-        psDatasetProperties->adfOffset[j] = poBand->GetOffset(&bHasOffset);
+        psDatasetProperties->adfOffset[j] = oBand.dfOffset;
         psDatasetProperties->abHasOffset[j] =
-            bHasOffset != 0 && psDatasetProperties->adfOffset[j] != 0.0;
+            oBand.bHasOffset && oBand.dfOffset != 0.0;
 
-        int bHasScale = false;
-        psDatasetProperties->adfScale[j] = poBand->GetScale(&bHasScale);
+        psDatasetProperties->adfScale[j] = oBand.dfScale;
         psDatasetProperties->abHasScale[j] =
-            bHasScale != 0 && psDatasetProperties->adfScale[j] != 1.0;
+            oBand.bHasScale && oBand.dfScale != 1.0;
 
-        const int nMaskFlags = poBand->GetMaskFlags();
+        const int nMaskFlags = oBand.nMaskFlags;
         psDatasetProperties->abHasMaskBand[j] =
             (nMaskFlags != GMF_ALL_VALID && nMaskFlags != GMF_NODATA) ||
-            poBand->GetColorInterpretation() == GCI_AlphaBand;
+            oBand.eColorInterp == GCI_AlphaBand;
+
+        if (bTrustSourceProperties)
+        {
+            psDatasetProperties->anOverviewCount[j] = oBand.nOverviewCount;
+            psDatasetProperties->anMaskFlags[j] = nMaskFlags;
+            psDatasetProperties->adfSrcNoDataValues[j] = oBand.dfNoDataValue;
+            psDatasetProperties->abSrcHasNoData[j] = oBand.bHasNoData;
+        }
     }
 
     if (bSeparate)
@@ -757,17 +1305,15 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
                 {
                     return CPLSPrintf("Invalid band number: %d", nSelBand);
                 }
-                GDALRasterBand *poBand = poDS->GetRasterBand(nSelBand);
-                asBandProperties[j].colorInterpretation =
-                    poBand->GetColorInterpretation();
-                asBandProperties[j].dataType = poBand->GetRasterDataType();
+                const auto &oBand = oInfo.aoBands[nSelBand - 1];
+                asBandProperties[j].colorInterpretation = oBand.eColorInterp;
+                asBandProperties[j].dataType = oBand.eDataType;
                 if (asBandProperties[j].colorInterpretation == GCI_PaletteIndex)
                 {
-                    auto colorTable = poBand->GetColorTable();
-                    if (colorTable)
+                    if (oBand.poColorTable)
                     {
                         asBandProperties[j].colorTable.reset(
-                            colorTable->Clone());
+                            oBand.poColorTable->Clone());
                     }
                 }
                 else
@@ -784,21 +1330,17 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
                 }
                 else
                 {
-                    int bHasNoData = false;
-                    asBandProperties[j].noDataValue =
-                        poBand->GetNoDataValue(&bHasNoData);
-                    asBandProperties[j].bHasNoData = bHasNoData != 0;
+                    asBandProperties[j].noDataValue = oBand.dfNoDataValue;
+                    asBandProperties[j].bHasNoData = oBand.bHasNoData;
                 }
 
-                int bHasOffset = false;
-                asBandProperties[j].dfOffset = poBand->GetOffset(&bHasOffset);
+                asBandProperties[j].dfOffset = oBand.dfOffset;
                 asBandProperties[j].bHasOffset =
-                    bHasOffset != 0 && asBandProperties[j].dfOffset != 0.0;
+                    oBand.bHasOffset && oBand.dfOffset != 0.0;
 
-                int bHasScale = false;
-                asBandProperties[j].dfScale = poBand->GetScale(&bHasScale);
+                asBandProperties[j].dfScale = oBand.dfScale;
                 asBandProperties[j].bHasScale =
-                    bHasScale != 0 && asBandProperties[j].dfScale != 1.0;
+                    oBand.bHasScale && oBand.dfScale != 1.0;
             }
         }
     }
@@ -848,9 +1390,9 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
             {
                 const int nSelBand = panSelectedBandList[j];
                 CPLAssert(nSelBand >= 1 && nSelBand <= _nBands);
-                GDALRasterBand *poBand = poDS->GetRasterBand(nSelBand);
+                const auto &oBand = oInfo.aoBands[nSelBand - 1];
                 if (asBandProperties[j].colorInterpretation !=
-                    poBand->GetColorInterpretation())
+                    oBand.eColorInterp)
                 {
                     return m_osProgramName +
                            CPLSPrintf(
@@ -860,21 +1402,20 @@ std::string VRTBuilder::AnalyseRaster(GDALDatasetH hDS,
                                GDALGetColorInterpretationName(
                                    asBandProperties[j].colorInterpretation),
                                GDALGetColorInterpretationName(
-                                   poBand->GetColorInterpretation()));
+                                   oBand.eColorInterp));
                 }
-                if (asBandProperties[j].dataType != poBand->GetRasterDataType())
+                if (asBandProperties[j].dataType != oBand.eDataType)
                 {
                     return m_osProgramName +
                            CPLSPrintf(" does not support heterogeneous "
                                       "band data type: expected %s, got %s.",
                                       GDALGetDataTypeName(
                                           asBandProperties[j].dataType),
-                                      GDALGetDataTypeName(
-                                          poBand->GetRasterDataType()));
+                                      GDALGetDataTypeName(oBand.eDataType));
                 }
                 if (asBandProperties[j].colorTable)
                 {
-                    const GDALColorTable *colorTable = poBand->GetColorTable();
+                    const GDALColorTable *colorTable = oBand.poColorTable.get();
                     int nRefColorEntryCount =
                         asBandProperties[j].colorTable->GetColorEntryCount();
                     if (colorTable == nullptr ||
@@ -1073,6 +1614,37 @@ static void WriteAbsolutePath(VRTSimpleSource *poSource, const char *dsFileName)
     }
 }
 
+/************************************************************************/
+/*                        SetSourceProperties()                         */
+/************************************************************************/
+
+/** Records the properties of a source band, so that it does not need to be
+ * opened until its pixels are read from the VRT.
+ *
+ * @param iSrcBand 0-based index of the band in the source dataset.
+ */
+static void SetSourceProperties(VRTSimpleSource *poSource,
+                                GDALRasterBand *poSrcBand,
+                                const DatasetProperty *psDatasetProperties,
+                                int iSrcBand)
+{
+    if (iSrcBand < 0 ||
+        iSrcBand >= static_cast<int>(psDatasetProperties->anMaskFlags.size()))
+        return;
+
+    VRTSimpleSource::SourceProperties oProps;
+    oProps.nRasterXSize = psDatasetProperties->nRasterXSize;
+    oProps.nRasterYSize = psDatasetProperties->nRasterYSize;
+    // poSrcBand is a proxy band, so this does not open the source dataset
+    oProps.eDataType = poSrcBand->GetRasterDataType();
+    poSrcBand->GetBlockSize(&oProps.nBlockXSize, &oProps.nBlockYSize);
+    oProps.nOverviewCount = psDatasetProperties->anOverviewCount[iSrcBand];
+    oProps.nMaskFlags = psDatasetProperties->anMaskFlags[iSrcBand];
+    oProps.bHasNoData = psDatasetProperties->abSrcHasNoData[iSrcBand];
+    oProps.dfNoDataValue = psDatasetProperties->adfSrcNoDataValues[iSrcBand];
+    poSource->SetSourceProperties(oProps);
+}
+
 /************************************************************************/
 /*                         CreateVRTSeparate()                          */
 /************************************************************************/
@@ -1226,6 +1798,15 @@ void VRTBuilder::CreateVRTSeparate(VRTDataset *poVRTDS)
             if (bWriteAbsolutePath)
                 WriteAbsolutePath(poSimpleSource, dsFileName);
 
+            if (bTrustSourceProperties && bDropRef)
+            {
+                SetSourceProperties(
+                    poSimpleSource,
+                    GDALRasterBand::FromHandle(
+                        GDALGetRasterBand(hSourceDS, nSrcBandIdx + 1)),
+                    psDatasetProperties, nSrcBandIdx);
+            }
+
             if (psDatasetProperties->abHasOffset[nSrcBandIdx])
                 poVRTBand->SetOffset(
                     psDatasetProperties->adfOffset[nSrcBandIdx]);
@@ -1468,6 +2049,12 @@ void VRTBuilder::CreateVRTNonSeparate(VRTDataset *poVRTDS)
             if (bWriteAbsolutePath)
                 WriteAbsolutePath(poSimpleSource, dsFileName);
 
+            if (bTrustSourceProperties && bDropRef)
+            {
+                SetSourceProperties(poSimpleSource, poSrcBand,
+                                    psDatasetProperties, nSelBand - 1);
+            }
+
             poVRTBand->AddSource(poSimpleSource);
         }
 
@@ -1664,6 +2251,22 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    std::unique_ptr<MetadataCache> poCache;
+    if (!m_osMetadataCacheFilename.empty() && !pahSrcDS)
+    {
+        poCache = std::make_unique<MetadataCache>(m_osMetadataCacheFilename,
+                                                  papszOpenOptions);
+        poCache->Load();
+    }
+
+    std::unique_ptr<SourceInfoFetcher> poFetcher;
+    if (!pahSrcDS)
+    {
+        poFetcher = std::make_unique<SourceInfoFetcher>(
+            std::min(m_nNumThreads, nInputFiles), papszOpenOptions,
+            poCache.get());
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1674,23 +2277,36 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        std::shared_ptr<const SourceInfo> poInfo;
+        if (pahSrcDS)
+        {
+            poInfo = CollectSourceInfo(GDALDataset::FromHandle(pahSrcDS[i]));
+        }
+        else
+        {
+            auto oResult = poFetcher->Get(i, ppszInputFilenames, nInputFiles);
+            poInfo = oResult.poInfo;
+            if (poCache && poInfo && oResult.bHasStat)
+            {
+                MetadataCache::Entry oEntry;
+                oEntry.nSize = static_cast<GIntBig>(oResult.sStat.st_size);
+                oEntry.nMTime = static_cast<GIntBig>(oResult.sStat.st_mtime);
+                oEntry.poInfo = poInfo;
+                poCache->Store(dsFileName, std::move(oEntry));
+            }
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
-        if (hDS)
+        if (poInfo)
         {
-            const auto osErrorMsg = AnalyseRaster(hDS, &asDatasetProperties[i]);
+            const auto osErrorMsg =
+                AnalyseRaster(*poInfo, dsFileName, &asDatasetProperties[i]);
             if (osErrorMsg.empty())
             {
                 asDatasetProperties[i].isFileOK = TRUE;
                 bFoundValid = true;
                 bFirst = FALSE;
             }
-            if (pahSrcDS == nullptr)
-                GDALClose(hDS);
             if (!osErrorMsg.empty() && osErrorMsg != "SILENTLY_IGNORE")
             {
                 if (bStrict)
@@ -1722,6 +2338,14 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    poFetcher.reset();
+    if (poCache && !poCache->Save())
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Cannot write metadata cache %s",
+                 m_osMetadataCacheFilename.c_str());
+    }
+
     if (!bFoundValid)
         return nullptr;
 
@@ -1891,6 +2515,9 @@ struct GDALBuildVRTOptions
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
     bool bWriteAbsolutePath = false;
+    bool bTrustSourceProperties = false;
+    std::string osNumThreads{};
+    std::string osMetadataCacheFilename{};
     std::string osPixelFunction{};
     CPLStringList aosPixelFunctionArgs{};
 
@@ -2047,8 +2674,19 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.osPixelFunction.empty() ? nullptr
                                          : sOptions.osPixelFunction.c_str(),
         sOptions.aosPixelFunctionArgs, sOptions.aosOpenOptions.List(),
-        sOptions.aosCreateOptions, sOptions.bWriteAbsolutePath);
+        sOptions.aosCreateOptions, sOptions.bWriteAbsolutePath,
+        sOptions.bTrustSourceProperties);
     oBuilder.m_osProgramName = sOptions.osProgramName;
+    oBuilder.m_osMetadataCacheFilename = sOptions.osMetadataCacheFilename;
+    {
+        const char *pszNumThreads =
+            sOptions.osNumThreads.empty()
+                ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+                : sOptions.osNumThreads.c_str();
+        oBuilder.m_nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                     ? CPLGetNumCPUs()
+                                     : std::clamp(atoi(pszNumThreads), 1, 1024);
+    }
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData).release());
@@ -2337,6 +2975,32 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
         .help(_("Write the absolute path of the raster files in the tile index "
                 "file."));
 
+    argParser->add_argument("-trust_source_properties")
+        .flag()
+        .store_into(psOptions->bTrustSourceProperties)
+        .help(_("Record the properties of the sources, so that they are only "
+                "opened when their pixels are read."));
+
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                    CPLGetValueType(s.c_str()) != CPL_VALUE_INTEGER)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of threads used to open the sources, or ALL_CPUS."));
+
+    argParser->add_argument("-metadata_cache")
+        .metavar("<filename>")
+        .store_into(psOptions->osMetadataCacheFilename)
+        .help(_("File where the properties of the sources are cached."));
+
     argParser->add_argument("-ignore_srcmaskband")
         .flag()
         .action([psOptions](const std::string &)
@@ -96,10 +96,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <vector>
 
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -107,6 +112,7 @@
 #include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -175,6 +181,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};
 };
 
 /************************************************************************/
@@ -321,7 +328,7 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
     std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+    int nNumThreads, GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -338,19 +345,6 @@ static CPLErr GDALGeneric3x3Processing(
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
-
     GDALDataType eReadDT;
     int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
@@ -397,372 +391,496 @@ static CPLErr GDALGeneric3x3Processing(
     if (!bDstHasNoData)
         fDstNoDataValue = 0.0;
 
-    int nLine1Off = 0;
-    int nLine2Off = nXSize;
-    int nLine3Off = 2 * nXSize;
-
-    // Move a 3x3 pafWindow over each cell
-    // (where the cell in question is #4)
-    //
-    //      0 1 2
-    //      3 4 5
-    //      6 7 8
-
-    /* Preload the first 2 lines */
-
-    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData)};
-
-    for (int i = 0; i < 2 && i < nYSize; i++)
+    // Compute the output lines in [nYStart, nYEnd[, reading one extra source
+    // line above and below them. pfnLineDone() is called after each
+    // computed line, and processing is stopped if it returns false.
+    // When poIOMutex is not null, it is locked around each RasterIO() call,
+    // so that several strips can be processed concurrently.
+    const auto ProcessLines =
+        [&](int nYStart, int nYEnd, std::mutex *poIOMutex,
+            const std::function<bool(int)> &pfnLineDone)
     {
-        if (GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
-                         pafThreeLineWin + i * nXSize, nXSize, 1, eReadDT, 0,
-                         0) != CE_None)
+        // 1 line destination buffer.
+        std::unique_ptr<float, VSIFreeReleaser> pafOutputBufHolder(
+            static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize)));
+        // 3 line rotating source buffer.
+        std::unique_ptr<T, VSIFreeReleaser> pafThreeLineWinHolder(
+            static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize)));
+        float *const pafOutputBuf = pafOutputBufHolder.get();
+        T *const pafThreeLineWin = pafThreeLineWinHolder.get();
+        if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
         {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
             return CE_Failure;
         }
-        if (bSrcHasNoData)
-        {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
 
-    CPLErr eErr = CE_None;
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
-    {
-        for (int j = 0; j < nXSize; j++)
+        const auto ReadLine = [hSrcBand, nXSize, eReadDT, poIOMutex](int iLine,
+                                                                    T *pBuf)
         {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-    }
-    else
-    {
-        // Exclude the edges
-        for (int j = 0; j < nXSize; j++)
-        {
-            pafOutputBuf[j] = fDstNoDataValue;
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+            std::unique_lock<std::mutex> oLock;
+            if (poIOMutex)
+                oLock = std::unique_lock<std::mutex>(*poIOMutex);
+            return GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1, pBuf,
+                                nXSize, 1, eReadDT, 0, 0);
+        };
 
-        if (eErr == CE_None && nYSize > 1)
+        const auto WriteLine = [hDstBand, nXSize, pafOutputBuf,
+                                poIOMutex](int iLine)
         {
-            eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
+            std::unique_lock<std::mutex> oLock;
+            if (poIOMutex)
+                oLock = std::unique_lock<std::mutex>(*poIOMutex);
+            return GDALRasterIO(hDstBand, GF_Write, 0, iLine, nXSize, 1,
                                 pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
-        }
-    }
-    if (eErr != CE_None)
-    {
-        CPLFree(pafOutputBuf);
-        CPLFree(pafThreeLineWin);
+        };
 
-        return eErr;
-    }
+        int nLine1Off = 0;
+        int nLine2Off = nXSize;
+        int nLine3Off = 2 * nXSize;
 
-    int i = 1;  // Used after for.
-    for (; i < nYSize - 1; i++)
-    {
-        /* Read third line of the line buffer */
-        eErr =
-            GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
-                         pafThreeLineWin + nLine3Off, nXSize, 1, eReadDT, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+        // Move a 3x3 pafWindow over each cell
+        // (where the cell in question is #4)
+        //
+        //      0 1 2
+        //      3 4 5
+        //      6 7 8
 
-            return eErr;
-        }
+        /* Preload the first 2 lines */
 
-        // In case none of the 3 lines have nodata values, then no need to
-        // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (bSrcHasNoData)
+        bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
+                                        CPL_TO_BOOL(bSrcHasNoData),
+                                        CPL_TO_BOOL(bSrcHasNoData)};
+
+        const int nFirstLoadedLine = nYStart == 0 ? 0 : nYStart - 1;
+        for (int i = 0; i < 2 && nFirstLoadedLine + i < nYSize; i++)
         {
-            if constexpr (std::numeric_limits<T>::is_integer)
+            if (ReadLine(nFirstLoadedLine + i, pafThreeLineWin + i * nXSize) !=
+                CE_None)
             {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
+                return CE_Failure;
+            }
+            if (bSrcHasNoData)
+            {
+                abLineHasNoDataValue[i] = false;
+                if constexpr (std::numeric_limits<T>::is_integer)
                 {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
+                    for (int iX = 0; iX < nXSize; iX++)
                     {
-                        bLastLineHasNoDataValue = true;
-                        break;
+                        if (pafThreeLineWin[i * nXSize + iX] ==
+                            fSrcNoDataValue)
+                        {
+                            abLineHasNoDataValue[i] = true;
+                            break;
+                        }
                     }
                 }
-                if (!bLastLineHasNoDataValue)
+                else
                 {
-                    for (; iX < nXSize; iX++)
+                    for (int iX = 0; iX < nXSize; iX++)
                     {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
+                        if (pafThreeLineWin[i * nXSize + iX] ==
+                                fSrcNoDataValue ||
+                            std::isnan(pafThreeLineWin[i * nXSize + iX]))
                         {
-                            bLastLineHasNoDataValue = true;
+                            abLineHasNoDataValue[i] = true;
+                            break;
                         }
                     }
                 }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
+            }
+        }
 
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
+        CPLErr eErr = CE_None;
+        if (nYStart == 0)
+        {
+            if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+            {
+                for (int j = 0; j < nXSize; j++)
+                {
+                    int jmin = (j == 0) ? j : j - 1;
+                    int jmax = (j == nXSize - 1) ? j : j + 1;
+
+                    T afWin[9] = {INTERPOL(pafThreeLineWin[jmin],
+                                           pafThreeLineWin[nXSize + jmin],
+                                           bSrcHasNoData, fSrcNoDataValue),
+                                  INTERPOL(pafThreeLineWin[j],
+                                           pafThreeLineWin[nXSize + j],
+                                           bSrcHasNoData, fSrcNoDataValue),
+                                  INTERPOL(pafThreeLineWin[jmax],
+                                           pafThreeLineWin[nXSize + jmax],
+                                           bSrcHasNoData, fSrcNoDataValue),
+                                  pafThreeLineWin[jmin],
+                                  pafThreeLineWin[j],
+                                  pafThreeLineWin[jmax],
+                                  pafThreeLineWin[nXSize + jmin],
+                                  pafThreeLineWin[nXSize + j],
+                                  pafThreeLineWin[nXSize + jmax]};
+                    pafOutputBuf[j] =
+                        ComputeVal(CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue,
+                                   bIsSrcNoDataNan, afWin, fDstNoDataValue,
+                                   pfnAlg, pData.get(), bComputeAtEdges);
+                }
             }
             else
             {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
+                // Exclude the edges
+                for (int j = 0; j < nXSize; j++)
+                {
+                    pafOutputBuf[j] = fDstNoDataValue;
+                }
+            }
+            eErr = WriteLine(0);
+            if (eErr != CE_None)
+                return eErr;
+        }
+
+        int i = std::max(nYStart, 1);  // Used after for.
+        for (; i < std::min(nYEnd, nYSize - 1); i++)
+        {
+            /* Read third line of the line buffer */
+            eErr = ReadLine(i + 1, pafThreeLineWin + nLine3Off);
+            if (eErr != CE_None)
+            {
+                return eErr;
+            }
+
+            // In case none of the 3 lines have nodata values, then no need to
+            // check it in ComputeVal()
+            bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+            if (bSrcHasNoData)
+            {
+                if constexpr (std::numeric_limits<T>::is_integer)
                 {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
+                    bool bLastLineHasNoDataValue = false;
+                    int iX = 0;
+                    for (; iX + 3 < nXSize; iX += 4)
                     {
-                        bLastLineHasNoDataValue = true;
-                        break;
+                        if (pafThreeLineWin[nLine3Off + iX] ==
+                                fSrcNoDataValue ||
+                            pafThreeLineWin[nLine3Off + iX + 1] ==
+                                fSrcNoDataValue ||
+                            pafThreeLineWin[nLine3Off + iX + 2] ==
+                                fSrcNoDataValue ||
+                            pafThreeLineWin[nLine3Off + iX + 3] ==
+                                fSrcNoDataValue)
+                        {
+                            bLastLineHasNoDataValue = true;
+                            break;
+                        }
+                    }
+                    if (!bLastLineHasNoDataValue)
+                    {
+                        for (; iX < nXSize; iX++)
+                        {
+                            if (pafThreeLineWin[nLine3Off + iX] ==
+                                fSrcNoDataValue)
+                            {
+                                bLastLineHasNoDataValue = true;
+                            }
+                        }
                     }
+                    abLineHasNoDataValue[nLine3Off / nXSize] =
+                        bLastLineHasNoDataValue;
+
+                    bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                                abLineHasNoDataValue[1] ||
+                                                abLineHasNoDataValue[2];
                 }
-                if (!bLastLineHasNoDataValue)
+                else
                 {
-                    for (; iX < nXSize; iX++)
+                    bool bLastLineHasNoDataValue = false;
+                    int iX = 0;
+                    for (; iX + 3 < nXSize; iX += 4)
                     {
                         if (pafThreeLineWin[nLine3Off + iX] ==
                                 fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
+                            std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
+                            pafThreeLineWin[nLine3Off + iX + 1] ==
+                                fSrcNoDataValue ||
+                            std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
+                            pafThreeLineWin[nLine3Off + iX + 2] ==
+                                fSrcNoDataValue ||
+                            std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
+                            pafThreeLineWin[nLine3Off + iX + 3] ==
+                                fSrcNoDataValue ||
+                            std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
                         {
                             bLastLineHasNoDataValue = true;
+                            break;
+                        }
+                    }
+                    if (!bLastLineHasNoDataValue)
+                    {
+                        for (; iX < nXSize; iX++)
+                        {
+                            if (pafThreeLineWin[nLine3Off + iX] ==
+                                    fSrcNoDataValue ||
+                                std::isnan(pafThreeLineWin[nLine3Off + iX]))
+                            {
+                                bLastLineHasNoDataValue = true;
+                            }
                         }
                     }
+                    abLineHasNoDataValue[nLine3Off / nXSize] =
+                        bLastLineHasNoDataValue;
+
+                    bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                                abLineHasNoDataValue[1] ||
+                                                abLineHasNoDataValue[2];
                 }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
+            }
 
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
+            if (bComputeAtEdges && nXSize >= 2)
+            {
+                int j = 0;
+                T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
+                                       pafThreeLineWin[nLine1Off + j + 1],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafThreeLineWin[nLine1Off + j],
+                              pafThreeLineWin[nLine1Off + j + 1],
+                              INTERPOL(pafThreeLineWin[nLine2Off + j],
+                                       pafThreeLineWin[nLine2Off + j + 1],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafThreeLineWin[nLine2Off + j],
+                              pafThreeLineWin[nLine2Off + j + 1],
+                              INTERPOL(pafThreeLineWin[nLine3Off + j],
+                                       pafThreeLineWin[nLine3Off + j + 1],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafThreeLineWin[nLine3Off + j],
+                              pafThreeLineWin[nLine3Off + j + 1]};
+
+                pafOutputBuf[j] =
+                    ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                               bIsSrcNoDataNan, afWin, fDstNoDataValue, pfnAlg,
+                               pData.get(), bComputeAtEdges);
+            }
+            else
+            {
+                // Exclude the edges
+                pafOutputBuf[0] = fDstNoDataValue;
             }
-        }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
+            int j = 1;
+            if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+            {
+                j = pfnAlg_multisample(pafThreeLineWin + nLine1Off,
+                                       pafThreeLineWin + nLine2Off,
+                                       pafThreeLineWin + nLine3Off, nXSize,
+                                       pData.get(), pafOutputBuf);
+            }
 
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
-        }
+            for (; j < nXSize - 1; j++)
+            {
+                T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                              pafThreeLineWin[nLine1Off + j],
+                              pafThreeLineWin[nLine1Off + j + 1],
+                              pafThreeLineWin[nLine2Off + j - 1],
+                              pafThreeLineWin[nLine2Off + j],
+                              pafThreeLineWin[nLine2Off + j + 1],
+                              pafThreeLineWin[nLine3Off + j - 1],
+                              pafThreeLineWin[nLine3Off + j],
+                              pafThreeLineWin[nLine3Off + j + 1]};
+
+                pafOutputBuf[j] =
+                    ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                               bIsSrcNoDataNan, afWin, fDstNoDataValue, pfnAlg,
+                               pData.get(), bComputeAtEdges);
+            }
 
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
+            if (bComputeAtEdges && nXSize >= 2)
+            {
+                j = nXSize - 1;
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+                T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                              pafThreeLineWin[nLine1Off + j],
+                              INTERPOL(pafThreeLineWin[nLine1Off + j],
+                                       pafThreeLineWin[nLine1Off + j - 1],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafThreeLineWin[nLine2Off + j - 1],
+                              pafThreeLineWin[nLine2Off + j],
+                              INTERPOL(pafThreeLineWin[nLine2Off + j],
+                                       pafThreeLineWin[nLine2Off + j - 1],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafThreeLineWin[nLine3Off + j - 1],
+                              pafThreeLineWin[nLine3Off + j],
+                              INTERPOL(pafThreeLineWin[nLine3Off + j],
+                                       pafThreeLineWin[nLine3Off + j - 1],
+                                       bSrcHasNoData, fSrcNoDataValue)};
 
-        /* -----------------------------------------
-         * Write Line to Raster
-         */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+                pafOutputBuf[j] =
+                    ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                               bIsSrcNoDataNan, afWin, fDstNoDataValue, pfnAlg,
+                               pData.get(), bComputeAtEdges);
+            }
+            else
+            {
+                // Exclude the edges
+                if (nXSize > 1)
+                    pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+            }
 
-            return eErr;
-        }
+            /* -----------------------------------------
+             * Write Line to Raster
+             */
+            eErr = WriteLine(i);
+            if (eErr != CE_None)
+            {
+                return eErr;
+            }
 
-        if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
+            if (!pfnLineDone(i))
+            {
+                return CE_Failure;
+            }
 
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+            const int nTemp = nLine1Off;
+            nLine1Off = nLine2Off;
+            nLine2Off = nLine3Off;
+            nLine3Off = nTemp;
+        }
 
-            return eErr;
+        if (nYEnd == nYSize && nYSize >= 2)
+        {
+            if (bComputeAtEdges && nXSize >= 2)
+            {
+                for (int j = 0; j < nXSize; j++)
+                {
+                    int jmin = (j == 0) ? j : j - 1;
+                    int jmax = (j == nXSize - 1) ? j : j + 1;
+
+                    T afWin[9] = {
+                        pafThreeLineWin[nLine1Off + jmin],
+                        pafThreeLineWin[nLine1Off + j],
+                        pafThreeLineWin[nLine1Off + jmax],
+                        pafThreeLineWin[nLine2Off + jmin],
+                        pafThreeLineWin[nLine2Off + j],
+                        pafThreeLineWin[nLine2Off + jmax],
+                        INTERPOL(pafThreeLineWin[nLine2Off + jmin],
+                                 pafThreeLineWin[nLine1Off + jmin],
+                                 bSrcHasNoData, fSrcNoDataValue),
+                        INTERPOL(pafThreeLineWin[nLine2Off + j],
+                                 pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        INTERPOL(pafThreeLineWin[nLine2Off + jmax],
+                                 pafThreeLineWin[nLine1Off + jmax],
+                                 bSrcHasNoData, fSrcNoDataValue),
+                    };
+
+                    pafOutputBuf[j] =
+                        ComputeVal(CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue,
+                                   bIsSrcNoDataNan, afWin, fDstNoDataValue,
+                                   pfnAlg, pData.get(), bComputeAtEdges);
+                }
+            }
+            else
+            {
+                // Exclude the edges
+                for (int j = 0; j < nXSize; j++)
+                {
+                    pafOutputBuf[j] = fDstNoDataValue;
+                }
+            }
+            eErr = WriteLine(nYSize - 1);
         }
 
-        const int nTemp = nLine1Off;
-        nLine1Off = nLine2Off;
-        nLine2Off = nLine3Off;
-        nLine3Off = nTemp;
+        return eErr;
+    };
+
+    // Strips are made of at least 32 lines, so that the extra source lines
+    // read around each of them remain a small overhead, and there are
+    // several strips per thread to balance the load between threads.
+    constexpr int MIN_LINES_PER_STRIP = 32;
+    const GDALThreadReservation oThreadReservation(
+        std::min(nNumThreads, nYSize / MIN_LINES_PER_STRIP));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!psThreadPool)
+    {
+        CPLErr eErr = ProcessLines(
+            0, nYSize, nullptr,
+            [nYSize, pfnProgress, pProgressData](int i)
+            {
+                if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr,
+                                 pProgressData))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                    return false;
+                }
+                return true;
+            });
+        if (eErr == CE_None)
+            pfnProgress(1.0, nullptr, pProgressData);
+        return eErr;
     }
 
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    const int nLinesPerStrip =
+        std::max(MIN_LINES_PER_STRIP,
+                 static_cast<int>(DIV_ROUND_UP(nYSize, 4 * nThreads)));
+    const int nStrips = static_cast<int>(DIV_ROUND_UP(nYSize, nLinesPerStrip));
+    CPLDebugOnly("GDALDEM", "Processing %d strips using %d threads", nStrips,
+                 nThreads);
+
+    auto poQueue = psThreadPool->CreateJobQueue();
+    std::mutex oIOMutex;
+    std::atomic<int> nLinesDone{0};
+    std::atomic<bool> bStop{false};
+    std::vector<CPLErrorAccumulator> aoErrorAccumulators(nStrips);
+    std::vector<CPLErr> aeErrors(nStrips, CE_None);
+    const auto LineDone = [&nLinesDone, &bStop](int)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-        if (eErr != CE_None)
+        ++nLinesDone;
+        return !bStop;
+    };
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        const auto Job = [iStrip, nLinesPerStrip, nYSize, &ProcessLines,
+                          &oIOMutex, &aoErrorAccumulators, &aeErrors, &bStop,
+                          &LineDone]()
         {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+            if (bStop)
+                return;
+            auto oAccumulator =
+                aoErrorAccumulators[iStrip].InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            const int nYStart = iStrip * nLinesPerStrip;
+            const int nYEnd = std::min(nYSize, nYStart + nLinesPerStrip);
+            aeErrors[iStrip] =
+                ProcessLines(nYStart, nYEnd, &oIOMutex, LineDone);
+            if (aeErrors[iStrip] != CE_None)
+                bStop = true;
+        };
+        if (!poQueue->SubmitJob(Job))
+            Job();
+    }
 
-            return eErr;
+    bool bUserInterrupted = false;
+    while (poQueue->WaitEvent())
+    {
+        if (!bStop && !pfnProgress(static_cast<double>(nLinesDone) / nYSize,
+                                   nullptr, pProgressData))
+        {
+            bUserInterrupted = true;
+            bStop = true;
         }
     }
+    poQueue->WaitCompletion();
 
-    pfnProgress(1.0, nullptr, pProgressData);
-    eErr = CE_None;
-
-    CPLFree(pafOutputBuf);
-    CPLFree(pafThreeLineWin);
+    CPLErr eErr = CE_None;
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        aoErrorAccumulators[iStrip].ReplayErrors();
+        if (aeErrors[iStrip] != CE_None)
+            eErr = aeErrors[iStrip];
+    }
+    if (bUserInterrupted)
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        eErr = CE_Failure;
+    }
+    else if (eErr == CE_None)
+    {
+        pfnProgress(1.0, nullptr, pProgressData);
+    }
 
     return eErr;
 }
@@ -3071,6 +3189,21 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value>")
+            .action(
+                [psOptions](const std::string &s)
+                {
+                    if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                        CPLGetValueType(s.c_str()) != CPL_VALUE_INTEGER)
+                    {
+                        throw std::invalid_argument(CPLSPrintf(
+                            "Invalid value for -num_threads: %s.", s.c_str()));
+                    }
+                    psOptions->osNumThreads = s;
+                })
+            .help(_("Number of threads to use, or ALL_CPUS."));
+
         if (psOptionsForBinary)
         {
             subParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -3497,6 +3630,21 @@ std::string GDALDEMAppGetParserUsage(const std::string &osProcessingMode)
     }
 }
 
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+static int GetNumThreads(const GDALDEMProcessingOptions *psOptions)
+{
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszNumThreads), 1, 1024);
+}
+
 /************************************************************************/
 /*                            GDALDEMProcessing()                       */
 /************************************************************************/
@@ -4145,15 +4293,15 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges,
+                GetNumThreads(psOptions), pfnProgress, pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges,
+                GetNumThreads(psOptions), pfnProgress, pProgressData);
         }
     }
 
@@ -13,8 +13,10 @@
 
 #include "cpl_port.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
 #include "gdal_utils_priv.h"
@@ -28,7 +30,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <set>
 
 typedef enum
@@ -84,6 +90,7 @@ struct GDALTileIndexOptions
     double dfMaxPixelSize = std::numeric_limits<double>::quiet_NaN();
     std::vector<GDALTileIndexRasterMetadata> aoFetchMD{};
     std::set<std::string> oSetFilenameFilters{};
+    std::string osNumThreads{};
     GDALProgressFunc pfnProgress = nullptr;
     void *pProgressData = nullptr;
 };
@@ -136,6 +143,21 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .help(_("Maximum pixel size in term of geospatial extent per pixel "
                 "(resolution) that a raster should have to be selected."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                    CPLGetValueType(s.c_str()) != CPL_VALUE_INTEGER)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of threads used to open the rasters, or ALL_CPUS."));
+
     argParser->add_output_format_argument(psOptions->osFormat);
 
     argParser->add_argument("-tileindex")
@@ -417,6 +439,130 @@ struct GDALTileIndexTileIterator
     }
 };
 
+/************************************************************************/
+/*                        GDALTileIndexSourceOpener                     */
+/************************************************************************/
+
+// Opens the rasters returned by a candidate provider, possibly ahead of
+// their consumption by worker threads, so that the latency of opening
+// (typically on network file systems) overlaps. Rasters are returned, and
+// the errors emitted while opening them are reported, in the order of the
+// candidates, so that the output does not depend on the number of threads.
+class GDALTileIndexSourceOpener
+{
+  public:
+    struct Candidate
+    {
+        std::string osSrcFilename{};
+        std::string osFileNameToWrite{};
+    };
+
+    using CandidateProvider = std::function<bool(Candidate &)>;
+
+    GDALTileIndexSourceOpener(int nThreads, CandidateProvider pfnProvider)
+        : m_pfnProvider(std::move(pfnProvider)),
+          m_aosThreadLocalConfigOptions(CPLGetThreadLocalConfigOptions())
+    {
+        if (nThreads > 1)
+        {
+            m_poPool = std::make_unique<CPLWorkerThreadPool>();
+            if (!m_poPool->Setup(nThreads, nullptr, nullptr))
+                m_poPool.reset();
+        }
+    }
+
+    /** Returns false when there is no more candidate. Otherwise fills
+     * oCandidate, and poDS with the opened raster, or nullptr if it could
+     * not be opened.
+     */
+    bool Next(Candidate &oCandidate, std::unique_ptr<GDALDataset> &poDS);
+
+  private:
+    struct Job
+    {
+        Candidate oCandidate{};
+        std::unique_ptr<GDALDataset> poDS{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        bool bDone = false;
+    };
+
+    CandidateProvider m_pfnProvider;
+    const CPLStringList m_aosThreadLocalConfigOptions;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::shared_ptr<Job>> m_aoJobs{};
+    bool m_bProviderExhausted = false;
+    // Must be declared last, so that pending jobs are completed before
+    // the above members are destroyed
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    static std::unique_ptr<GDALDataset> Open(const std::string &osFilename)
+    {
+        return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            osFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+            nullptr, nullptr, nullptr));
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALTileIndexSourceOpener)
+};
+
+bool GDALTileIndexSourceOpener::Next(Candidate &oCandidate,
+                                     std::unique_ptr<GDALDataset> &poDS)
+{
+    if (!m_poPool)
+    {
+        if (!m_pfnProvider(oCandidate))
+            return false;
+        poDS = Open(oCandidate.osSrcFilename);
+        return true;
+    }
+
+    // Keep a bounded number of rasters being opened ahead of the one
+    // requested
+    const size_t nMaxAhead = 4 * m_poPool->GetThreadCount();
+    while (!m_bProviderExhausted && m_aoJobs.size() < nMaxAhead)
+    {
+        auto poJob = std::make_shared<Job>();
+        if (!m_pfnProvider(poJob->oCandidate))
+        {
+            m_bProviderExhausted = true;
+            break;
+        }
+        m_aoJobs.push_back(poJob);
+        m_poPool->SubmitJob(
+            [this, poJob]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    m_aosThreadLocalConfigOptions.List());
+                {
+                    auto oAccumulator =
+                        poJob->oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    poJob->poDS = Open(poJob->oCandidate.osSrcFilename);
+                }
+                CPLSetThreadLocalConfigOptions(nullptr);
+                std::lock_guard oLock(m_oMutex);
+                poJob->bDone = true;
+                m_oCV.notify_all();
+            });
+    }
+
+    if (m_aoJobs.empty())
+        return false;
+
+    auto poJob = std::move(m_aoJobs.front());
+    m_aoJobs.pop_front();
+    {
+        std::unique_lock oLock(m_oMutex);
+        m_oCV.wait(oLock, [&poJob] { return poJob->bDone; });
+    }
+    // Emit errors and warnings from the calling thread
+    poJob->oErrorAccumulator.ReplayErrors();
+    oCandidate = std::move(poJob->oCandidate);
+    poDS = std::move(poJob->poDS);
+    return true;
+}
+
 /************************************************************************/
 /*                           GDALTileIndex()                            */
 /************************************************************************/
@@ -954,46 +1100,109 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         psOptions->bMaskBand || !psOptions->aosMetadata.empty() ||
         !psOptions->osGTIFilename.empty();
 
-    /* -------------------------------------------------------------------- */
-    /*      loop over GDAL files, processing.                               */
-    /* -------------------------------------------------------------------- */
-    int iCur = 0;
-    int nTotal = nSrcCount + 1;
-    while (true)
+    const auto GetNextCandidate =
+        [&oGDALTileIndexTileIterator, &osCurrentPath,
+         &oSetExistingFiles](GDALTileIndexSourceOpener::Candidate &oCandidate)
     {
-        const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
-        if (osSrcFilename.empty())
-            break;
+        while (true)
+        {
+            std::string osSrcFilename = oGDALTileIndexTileIterator.next();
+            if (osSrcFilename.empty())
+                return false;
 
-        std::string osFileNameToWrite;
-        VSIStatBuf sStatBuf;
+            std::string osFileNameToWrite;
+            VSIStatBuf sStatBuf;
 
-        // Make sure it is a file before building absolute path name.
-        if (!osCurrentPath.empty() &&
-            CPLIsFilenameRelative(osSrcFilename.c_str()) &&
-            VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+            // Make sure it is a file before building absolute path name.
+            if (!osCurrentPath.empty() &&
+                CPLIsFilenameRelative(osSrcFilename.c_str()) &&
+                VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+            {
+                osFileNameToWrite = CPLProjectRelativeFilenameSafe(
+                    osCurrentPath.c_str(), osSrcFilename.c_str());
+            }
+            else
+            {
+                osFileNameToWrite = osSrcFilename;
+            }
+
+            // Checks that file is not already in tileindex.
+            if (oSetExistingFiles.find(osFileNameToWrite) !=
+                oSetExistingFiles.end())
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "File %s is already in tileindex. Skipping it.",
+                         osFileNameToWrite.c_str());
+                continue;
+            }
+
+            oCandidate.osSrcFilename = std::move(osSrcFilename);
+            oCandidate.osFileNameToWrite = std::move(osFileNameToWrite);
+            return true;
+        }
+    };
+
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : std::clamp(atoi(pszNumThreads), 1, 1024);
+    GDALTileIndexSourceOpener oOpener(nNumThreads, GetNextCandidate);
+
+    // Group feature insertions in transactions, which is much faster than
+    // committing each feature for drivers such as GPKG.
+    constexpr int FEATURES_PER_TRANSACTION = 100000;
+    struct TransactionGuard
+    {
+        GDALDataset *const poDS;
+        bool bActive = false;
+
+        explicit TransactionGuard(GDALDataset *poDSIn) : poDS(poDSIn)
         {
-            osFileNameToWrite = CPLProjectRelativeFilenameSafe(
-                osCurrentPath.c_str(), osSrcFilename.c_str());
         }
-        else
+
+        ~TransactionGuard()
         {
-            osFileNameToWrite = osSrcFilename.c_str();
+            Commit();
         }
 
-        // Checks that file is not already in tileindex.
-        if (oSetExistingFiles.find(osFileNameToWrite) !=
-            oSetExistingFiles.end())
+        void Start()
         {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "File %s is already in tileindex. Skipping it.",
-                     osFileNameToWrite.c_str());
-            continue;
+            bActive = poDS->TestCapability(ODsCTransactions) &&
+                      poDS->StartTransaction() == OGRERR_NONE;
         }
 
-        auto poSrcDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-            osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-            nullptr, nullptr, nullptr));
+        bool Commit()
+        {
+            if (!bActive)
+                return true;
+            bActive = false;
+            return poDS->CommitTransaction() == OGRERR_NONE;
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(TransactionGuard)
+    };
+
+    TransactionGuard oTransaction(poTileIndexDS);
+    oTransaction.Start();
+    int nFeaturesInTransaction = 0;
+
+    /* -------------------------------------------------------------------- */
+    /*      loop over GDAL files, processing.                               */
+    /* -------------------------------------------------------------------- */
+    int iCur = 0;
+    int nTotal = nSrcCount + 1;
+    while (true)
+    {
+        GDALTileIndexSourceOpener::Candidate oCandidate;
+        std::unique_ptr<GDALDataset> poSrcDS;
+        if (!oOpener.Next(oCandidate, poSrcDS))
+            break;
+        const std::string &osSrcFilename = oCandidate.osSrcFilename;
+        const std::string &osFileNameToWrite = oCandidate.osFileNameToWrite;
+
         if (poSrcDS == nullptr)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
@@ -1248,6 +1457,15 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
             return nullptr;
         }
 
+        if (oTransaction.bActive &&
+            ++nFeaturesInTransaction == FEATURES_PER_TRANSACTION)
+        {
+            nFeaturesInTransaction = 0;
+            if (!oTransaction.Commit())
+                return nullptr;
+            oTransaction.Start();
+        }
+
         ++iCur;
         if (psOptions->pfnProgress &&
             !psOptions->pfnProgress(static_cast<double>(iCur) / nTotal, "",
@@ -1258,6 +1476,9 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         if (iCur >= nSrcCount)
             ++nTotal;
     }
+    if (!oTransaction.Commit())
+        return nullptr;
+
     if (psOptions->pfnProgress)
         psOptions->pfnProgress(1.0, "", psOptions->pProgressData);
 
@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -31,9 +32,13 @@
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #include "nearblack_lib.h"
 
+static bool IsNonBlack(const GByte *pabyPixel, int nSrcBands, int nNearDist,
+                       const Colors &oColors);
+
 static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
                         int nSrcBands, int nDstBands, int nNearDist,
                         int nMaxNonBlack, const Colors &oColors,
@@ -352,12 +357,36 @@ GDALDatasetH CPL_DLL GDALNearblack(const char *pszDest, GDALDatasetH hDstDS,
     return hDstDS;
 }
 
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+static int GetNumThreads(const GDALNearblackOptions *psOptions)
+{
+    const char *pszNumThreads =
+        psOptions->osNumThreads.empty()
+            ? CPLGetConfigOption("GDAL_NUM_THREADS", "1")
+            : psOptions->osNumThreads.c_str();
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszNumThreads), 1, 1024);
+}
+
 /************************************************************************/
 /*                   GDALNearblackTwoPassesAlgorithm()                  */
 /*                                                                      */
 /* Do a top-to-bottom pass, followed by a bottom-to-top one.            */
 /************************************************************************/
 
+// Each pass carries from one line to the next one the count of non-black
+// pixels met so far in each column (panLastLineCounts). That count only
+// depends on whether pixels are non-black, and saturates at nMaxNonBlack + 1,
+// so the contribution of a strip of lines can be computed independently of
+// the previous strips. When multithreading, lines are read by chunks that are
+// split into strips: the counts of each strip are computed in parallel,
+// accumulated from the top (or bottom) of the chunk, and then the strips are
+// processed in parallel, with a result identical to sequential processing.
+
 bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
                                      GDALDatasetH hSrcDataset,
                                      GDALDatasetH hDstDS,
@@ -372,168 +401,305 @@ bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
     const int nNearDist = psOptions->nNearDist;
     const bool bSetAlpha = psOptions->bSetAlpha;
 
+    // Strips are made of at least 32 lines, so that the overhead of
+    // dispatching them to worker threads remains small.
+    constexpr int MIN_LINES_PER_STRIP = 32;
+    const GDALThreadReservation oThreadReservation(
+        std::min(GetNumThreads(psOptions), nYSize / MIN_LINES_PER_STRIP));
+    int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *psThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!psThreadPool)
+        nThreads = 1;
+
     /* -------------------------------------------------------------------- */
-    /*      Allocate a line buffer.                                         */
+    /*      Allocate buffers for a chunk of lines.                          */
     /* -------------------------------------------------------------------- */
 
-    std::vector<GByte> abyLine(static_cast<size_t>(nXSize) * nDstBands);
-    GByte *pabyLine = abyLine.data();
-
-    std::vector<GByte> abyMask;
-    GByte *pabyMask = nullptr;
-    if (bSetMask)
+    // Process one line at a time when single-threaded, and otherwise chunks
+    // of about 64 MB, with at least one strip per thread.
+    const size_t nLineSize = static_cast<size_t>(nXSize) * nDstBands;
+    int nChunkLines = 1;
+    if (nThreads > 1)
     {
-        abyMask.resize(nXSize);
-        pabyMask = abyMask.data();
+        constexpr size_t CHUNK_SIZE = 64 * 1024 * 1024;
+        nChunkLines = static_cast<int>(std::min<size_t>(
+            nYSize,
+            std::max<size_t>(
+                static_cast<size_t>(nThreads) * MIN_LINES_PER_STRIP,
+                CHUNK_SIZE / (nLineSize + (bSetMask ? nXSize : 0)))));
     }
 
-    std::vector<int> anLastLineCounts(nXSize);
-    int *panLastLineCounts = anLastLineCounts.data();
+    std::vector<GByte> abyChunk;
+    std::vector<GByte> abyMaskChunk;
+    // Count of non-black pixels of each column, at the start of each strip
+    std::vector<std::vector<int>> aanStripStartCounts;
+    // Count of non-black pixels of each column, within each strip
+    std::vector<std::vector<int>> aanStripCounts;
+    try
+    {
+        abyChunk.resize(nLineSize * nChunkLines);
+        if (bSetMask)
+            abyMaskChunk.resize(static_cast<size_t>(nXSize) * nChunkLines);
+        aanStripStartCounts.resize(nThreads, std::vector<int>(nXSize));
+        aanStripCounts.resize(nThreads - 1, std::vector<int>(nXSize));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers: %s", e.what());
+        return false;
+    }
 
-    /* -------------------------------------------------------------------- */
-    /*      Processing data one line at a time.                             */
-    /* -------------------------------------------------------------------- */
-    int iLine;
+    auto poQueue = psThreadPool ? psThreadPool->CreateJobQueue() : nullptr;
 
-    for (iLine = 0; iLine < nYSize; iLine++)
+    // Run job(iStrip) for each strip, in parallel when possible
+    const auto RunForEachStrip =
+        [&poQueue](int nStrips, const std::function<void(int)> &job)
     {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hSrcDataset, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1,
-            GDT_Byte, nBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
+        for (int iStrip = 0; iStrip < nStrips; ++iStrip)
         {
-            return false;
+            if (!poQueue ||
+                !poQueue->SubmitJob([&job, iStrip]() { job(iStrip); }))
+            {
+                job(iStrip);
+            }
         }
+        if (poQueue)
+            poQueue->WaitCompletion();
+    };
 
-        if (bSetAlpha)
+    /* -------------------------------------------------------------------- */
+    /*      Process from the top down, and then from the bottom back up.    */
+    /* -------------------------------------------------------------------- */
+    for (const bool bBottomUp : {false, true})
+    {
+        std::fill(aanStripStartCounts[0].begin(), aanStripStartCounts[0].end(),
+                  0);
+
+        // iChunkStart, as other line indices named iLineFromTopOrBottom,
+        // count lines in the order they are processed by the current pass.
+        for (int iChunkStart = 0; iChunkStart < nYSize;
+             iChunkStart += nChunkLines)
         {
-            for (int iCol = 0; iCol < nXSize; iCol++)
+            const int nLines = std::min(nChunkLines, nYSize - iChunkStart);
+            const int nYOff =
+                bBottomUp ? nYSize - iChunkStart - nLines : iChunkStart;
+
+            // Return the index in the chunk of a line
+            const auto GetChunkLineIdx =
+                [bBottomUp, nYSize, nYOff](int iLineFromTopOrBottom)
+            {
+                return static_cast<size_t>(
+                    (bBottomUp ? nYSize - 1 - iLineFromTopOrBottom
+                               : iLineFromTopOrBottom) -
+                    nYOff);
+            };
+
+            if (!bBottomUp)
+            {
+                if (GDALDatasetRasterIOEx(
+                        hSrcDataset, GF_Read, 0, nYOff, nXSize, nLines,
+                        abyChunk.data(), nXSize, nLines, GDT_Byte, nBands,
+                        nullptr, nDstBands, nLineSize, 1, nullptr) != CE_None)
+                {
+                    return false;
+                }
+
+                if (bSetAlpha)
+                {
+                    for (size_t i = nDstBands - 1; i < nLineSize * nLines;
+                         i += nDstBands)
+                    {
+                        abyChunk[i] = 255;
+                    }
+                }
+
+                if (bSetMask)
+                {
+                    std::fill(abyMaskChunk.begin(), abyMaskChunk.end(), 255);
+                }
+            }
+            else
             {
-                pabyLine[iCol * nDstBands + nDstBands - 1] = 255;
+                if (GDALDatasetRasterIOEx(
+                        hDstDS, GF_Read, 0, nYOff, nXSize, nLines,
+                        abyChunk.data(), nXSize, nLines, GDT_Byte, nDstBands,
+                        nullptr, nDstBands, nLineSize, 1, nullptr) != CE_None)
+                {
+                    return false;
+                }
+
+                /***** read the mask band lines back in *****/
+
+                if (bSetMask &&
+                    GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize, nLines,
+                                 abyMaskChunk.data(), nXSize, nLines, GDT_Byte,
+                                 0, 0) != CE_None)
+                {
+                    return false;
+                }
             }
-        }
 
-        if (bSetMask)
-        {
-            for (int iCol = 0; iCol < nXSize; iCol++)
+            const int nMaxStrips = std::min(
+                nThreads, DIV_ROUND_UP(nLines, MIN_LINES_PER_STRIP));
+            const int nLinesPerStrip = DIV_ROUND_UP(nLines, nMaxStrips);
+            const int nStrips = DIV_ROUND_UP(nLines, nLinesPerStrip);
+
+            // Count the non-black pixels of each strip but the last one
+            RunForEachStrip(
+                nStrips - 1,
+                [&, iChunkStart](int iStrip)
+                {
+                    std::vector<int> &anCounts = aanStripCounts[iStrip];
+                    std::fill(anCounts.begin(), anCounts.end(), 0);
+                    const int iStart = iChunkStart + iStrip * nLinesPerStrip;
+                    for (int iLine = iStart; iLine < iStart + nLinesPerStrip;
+                         ++iLine)
+                    {
+                        const GByte *pabyLine =
+                            abyChunk.data() +
+                            nLineSize * GetChunkLineIdx(iLine);
+                        for (int i = 0; i < nXSize; i++)
+                        {
+                            // Same logic as the vertical check of ProcessLine()
+                            if (anCounts[i] <= nMaxNonBlack &&
+                                IsNonBlack(pabyLine + i * nDstBands, nBands,
+                                           nNearDist, oColors))
+                            {
+                                anCounts[i]++;
+                                if (iLine == 0 && nMaxNonBlack > 0)
+                                    anCounts[i] = nMaxNonBlack + 1;
+                            }
+                        }
+                    }
+                });
+
+            // Accumulate them to get the counts at the start of each strip
+            for (int iStrip = 1; iStrip < nStrips; ++iStrip)
             {
-                pabyMask[iCol] = 255;
+                const std::vector<int> &anPrevStart =
+                    aanStripStartCounts[iStrip - 1];
+                const std::vector<int> &anPrevCounts =
+                    aanStripCounts[iStrip - 1];
+                std::vector<int> &anStart = aanStripStartCounts[iStrip];
+                for (int i = 0; i < nXSize; i++)
+                {
+                    anStart[i] = std::min(anPrevStart[i] + anPrevCounts[i],
+                                          nMaxNonBlack + 1);
+                }
             }
-        }
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, oColors, panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    true,   // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, oColors, panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+            // Process the strips
+            RunForEachStrip(
+                nStrips,
+                [&, iChunkStart](int iStrip)
+                {
+                    int *panLastLineCounts = aanStripStartCounts[iStrip].data();
+                    const int iStart = iChunkStart + iStrip * nLinesPerStrip;
+                    const int iEnd =
+                        std::min(iStart + nLinesPerStrip, iChunkStart + nLines);
+                    for (int iLine = iStart; iLine < iEnd; ++iLine)
+                    {
+                        const size_t nIdx = GetChunkLineIdx(iLine);
+                        GByte *pabyLine = abyChunk.data() + nLineSize * nIdx;
+                        GByte *pabyMask =
+                            bSetMask ? abyMaskChunk.data() + nXSize * nIdx
+                                     : nullptr;
+
+                        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands,
+                                    nDstBands, nNearDist, nMaxNonBlack,
+                                    oColors, panLastLineCounts,
+                                    true,  // bDoHorizontalCheck
+                                    true,  // bDoVerticalCheck
+                                    bBottomUp, iLine);
+                        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands,
+                                    nDstBands, nNearDist, nMaxNonBlack,
+                                    oColors, panLastLineCounts,
+                                    true,   // bDoHorizontalCheck
+                                    false,  // bDoVerticalCheck
+                                    bBottomUp, iLine);
+                    }
+                });
+
+            // The counts at the end of the last strip are the ones at the
+            // start of the next chunk
+            if (nStrips > 1)
+                std::swap(aanStripStartCounts[0],
+                          aanStripStartCounts[nStrips - 1]);
+
+            if (GDALDatasetRasterIOEx(
+                    hDstDS, GF_Write, 0, nYOff, nXSize, nLines, abyChunk.data(),
+                    nXSize, nLines, GDT_Byte, nDstBands, nullptr, nDstBands,
+                    nLineSize, 1, nullptr) != CE_None)
+            {
+                return false;
+            }
 
-        /***** write out the mask band line *****/
+            /***** write out the mask band lines *****/
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            if (bSetMask &&
+                GDALRasterIO(hMaskBand, GF_Write, 0, nYOff, nXSize, nLines,
+                             abyMaskChunk.data(), nXSize, nLines, GDT_Byte, 0,
+                             0) != CE_None)
             {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "ERROR writing out line to mask band.");
+                if (!bBottomUp)
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "ERROR writing out line to mask band.");
+                }
                 return false;
             }
-        }
 
-        if (!(psOptions->pfnProgress(
-                0.5 * ((iLine + 1) / static_cast<double>(nYSize)), nullptr,
-                psOptions->pProgressData)))
-        {
-            return false;
+            if (!(psOptions->pfnProgress(
+                    (bBottomUp ? 0.5 : 0.0) +
+                        0.5 * ((iChunkStart + nLines) /
+                               static_cast<double>(nYSize)),
+                    nullptr, psOptions->pProgressData)))
+            {
+                return false;
+            }
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Now process from the bottom back up                            .*/
-    /* -------------------------------------------------------------------- */
-    memset(panLastLineCounts, 0, sizeof(int) * nXSize);
+    return true;
+}
 
-    for (iLine = nYSize - 1; hDstDS != nullptr && iLine >= 0; iLine--)
-    {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hDstDS, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1, GDT_Byte,
-            nDstBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+/************************************************************************/
+/*                             IsNonBlack()                             */
+/************************************************************************/
 
-        /***** read the mask band line back in *****/
+// Returns whether the pixel is not near any of the colors
+static bool IsNonBlack(const GByte *pabyPixel, int nSrcBands, int nNearDist,
+                       const Colors &oColors)
+{
+    bool bIsNonBlack = false;
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                return false;
-            }
-        }
+    /***** loop over the colors *****/
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, oColors, panLastLineCounts,
-                    true,  // bDoHorizontalCheck
-                    true,  // bDoVerticalCheck
-                    true,  // bBottomUp
-                    nYSize - 1 - iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, oColors, panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    true,   // bBottomUp
-                    nYSize - 1 - iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+    for (const Color &oColor : oColors)
+    {
+        bIsNonBlack = false;
 
-        /***** write out the mask band line *****/
+        /***** loop over the bands *****/
 
-        if (bSetMask)
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
         {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            const int nPix = pabyPixel[iBand];
+
+            if (oColor[iBand] - nPix > nNearDist ||
+                nPix > nNearDist + oColor[iBand])
             {
-                return false;
+                bIsNonBlack = true;
+                break;
             }
         }
 
-        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iLine) /
-                                               static_cast<double>(nYSize),
-                                     nullptr, psOptions->pProgressData)))
-        {
-            return false;
-        }
+        if (!bIsNonBlack)
+            break;
     }
 
-    return true;
+    return bIsNonBlack;
 }
 
 /************************************************************************/
@@ -571,37 +737,8 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
 
             /***** is the pixel valid data? ****/
 
-            bool bIsNonBlack = false;
-
-            /***** loop over the colors *****/
-
-            for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                 iColor++)
-            {
-
-                const Color &oColor = oColors[iColor];
-
-                bIsNonBlack = false;
-
-                /***** loop over the bands *****/
-
-                for (int iBand = 0; iBand < nSrcBands; iBand++)
-                {
-                    const int nPix = pabyLine[i * nDstBands + iBand];
-
-                    if (oColor[iBand] - nPix > nNearDist ||
-                        nPix > nNearDist + oColor[iBand])
-                    {
-                        bIsNonBlack = true;
-                        break;
-                    }
-                }
-
-                if (!bIsNonBlack)
-                    break;
-            }
-
-            if (bIsNonBlack)
+            if (IsNonBlack(pabyLine + i * nDstBands, nSrcBands, nNearDist,
+                           oColors))
             {
                 panLastLineCounts[i]++;
 
@@ -658,35 +795,8 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
             {
                 /***** is the pixel valid data? ****/
 
-                bool bIsNonBlack = false;
-
-                /***** loop over the colors *****/
-
-                for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                     iColor++)
-                {
-
-                    const Color &oColor = oColors[iColor];
-
-                    bIsNonBlack = false;
-
-                    /***** loop over the bands *****/
-
-                    for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    {
-                        const int nPix = pabyLine[i * nDstBands + iBand];
-
-                        if (oColor[iBand] - nPix > nNearDist ||
-                            nPix > nNearDist + oColor[iBand])
-                        {
-                            bIsNonBlack = true;
-                            break;
-                        }
-                    }
-
-                    if (bIsNonBlack == false)
-                        break;
-                }
+                const bool bIsNonBlack = IsNonBlack(
+                    pabyLine + i * nDstBands, nSrcBands, nNearDist, oColors);
 
                 if (bIsNonBlack)
                 {
@@ -882,6 +992,21 @@ GDALNearblackOptionsGetParser(GDALNearblackOptions *psOptions,
                 { psOptions->bFloodFill = EQUAL(s.c_str(), "floodfill"); })
         .help(_("Selects the algorithm to apply."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                    CPLGetValueType(s.c_str()) != CPL_VALUE_INTEGER)
+                {
+                    throw std::invalid_argument(CPLSPrintf(
+                        "Invalid value for -num_threads: %s.", s.c_str()));
+                }
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of threads to use, or ALL_CPUS."));
+
     if (psOptionsForBinary)
     {
         argParser->add_argument("input_file")
@@ -44,6 +44,9 @@ struct GDALNearblackOptions
 
     bool bFloodFill = false;
 
+    /*! number of threads, or ALL_CPUS. Defaults to GDAL_NUM_THREADS */
+    std::string osNumThreads{};
+
     Colors oColors{};
 
     CPLStringList aosCreationOptions{};
@@ -47,6 +47,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -519,6 +520,29 @@ struct TargetLayerInfo
                 m_dfTopZ = 0;
             }
         }
+
+        void UpdateExtremePoints(const OGRGeometry *poGeom)
+        {
+            struct Visitor : public OGRDefaultConstGeometryVisitor
+            {
+                ReprojectionInfo &m_info;
+
+                explicit Visitor(ReprojectionInfo &info) : m_info(info)
+                {
+                }
+
+                using OGRDefaultConstGeometryVisitor::visit;
+
+                void visit(const OGRPoint *point) override
+                {
+                    m_info.UpdateExtremePoints(point->getX(), point->getY(),
+                                               point->getZ());
+                }
+            };
+
+            Visitor oVisit(*this);
+            poGeom->accept(&oVisit);
+        }
     };
 
     std::vector<ReprojectionInfo> m_aoReprojectionInfo{};
@@ -4198,11 +4222,12 @@ static int GetArrowGeomFieldIndex(const struct ArrowSchema *psLayerSchema,
 static CPLStringList
 BuildGetArrowStreamOptions(OGRLayer *poSrcLayer, OGRLayer *poDstLayer,
                            const GDALVectorTranslateOptions *psOptions,
-                           bool bPreserveFID)
+                           bool bPreserveFID, bool bNativeGeomEncoding)
 {
     CPLStringList aosOptionsGetArrowStream;
     aosOptionsGetArrowStream.SetNameValue("SILENCE_GET_SCHEMA_ERROR", "YES");
-    aosOptionsGetArrowStream.SetNameValue("GEOMETRY_ENCODING", "WKB");
+    if (!bNativeGeomEncoding)
+        aosOptionsGetArrowStream.SetNameValue("GEOMETRY_ENCODING", "WKB");
     if (!bPreserveFID)
         aosOptionsGetArrowStream.SetNameValue("INCLUDE_FID", "NO");
     if (psOptions->nLimit >= 0)
@@ -4309,9 +4334,62 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
             }
         }
 
-        const CPLStringList aosGetArrowStreamOptions(BuildGetArrowStreamOptions(
-            poSrcLayer, poDstLayer, psOptions, bPreserveFID));
-        if (poSrcLayer->GetArrowStream(streamSrc.get(),
+        // When the output layer has a fast WriteArrowBatch() implementation,
+        // first try to get geometries in their native encoding (typically
+        // GeoArrow), so that they do not need to be converted to WKB and
+        // back. If the output layer reports it cannot write them as they are,
+        // fallback to requesting WKB.
+        bool bNativeGeomEncoding =
+            !psOptions->bTransform &&
+            poSrcLayer->GetLayerDefn()->GetGeomFieldCount() == 1 &&
+            poDstLayer->TestCapability(OLCFastWriteArrowBatch);
+        CPLStringList aosGetArrowStreamOptions(BuildGetArrowStreamOptions(
+            poSrcLayer, poDstLayer, psOptions, bPreserveFID,
+            bNativeGeomEncoding));
+        CPLStringList aosIsArrowSchemaSupportedOptions;
+        if (bNativeGeomEncoding && poSrcLayer->GetGeometryColumn()[0])
+        {
+            aosIsArrowSchemaSupportedOptions.SetNameValue(
+                "GEOMETRY_NAME", poSrcLayer->GetGeometryColumn());
+        }
+        if (bNativeGeomEncoding &&
+            poSrcLayer->GetArrowStream(streamSrc.get(),
+                                       aosGetArrowStreamOptions.List()))
+        {
+            struct ArrowSchema schemaSrc;
+            if (streamSrc.get_schema(&schemaSrc) == 0)
+            {
+                std::string osErrorMsg;
+                if (!poDstLayer->IsArrowSchemaSupported(
+                        &schemaSrc, aosIsArrowSchemaSupportedOptions.List(),
+                        osErrorMsg))
+                {
+                    CPLDebug("OGR2OGR",
+                             "Cannot use native geometry encoding: %s",
+                             osErrorMsg.c_str());
+                    bNativeGeomEncoding = false;
+                }
+                schemaSrc.release(&schemaSrc);
+            }
+            else
+            {
+                bNativeGeomEncoding = false;
+            }
+            if (!bNativeGeomEncoding)
+            {
+                streamSrc.clear();
+                aosGetArrowStreamOptions = BuildGetArrowStreamOptions(
+                    poSrcLayer, poDstLayer, psOptions, bPreserveFID, false);
+                aosIsArrowSchemaSupportedOptions.Clear();
+            }
+        }
+        else
+        {
+            bNativeGeomEncoding = false;
+        }
+
+        if (bNativeGeomEncoding ||
+            poSrcLayer->GetArrowStream(streamSrc.get(),
                                        aosGetArrowStreamOptions.List()))
         {
             struct ArrowSchema schemaSrc;
@@ -4327,8 +4405,9 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
                 }
 
                 std::string osErrorMsg;
-                if (poDstLayer->IsArrowSchemaSupported(&schemaSrc, nullptr,
-                                                       osErrorMsg))
+                if (poDstLayer->IsArrowSchemaSupported(
+                        &schemaSrc, aosIsArrowSchemaSupportedOptions.List(),
+                        osErrorMsg))
                 {
                     const OGRFeatureDefn *poSrcFDefn =
                         poSrcLayer->GetLayerDefn();
@@ -6111,6 +6190,45 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
     return true;
 }
 
+/************************************************************************/
+/*                      GetNumReprojectionThreads()                     */
+/************************************************************************/
+
+static int GetNumReprojectionThreads()
+{
+    const int nNumCPUs = CPLGetNumCPUs();
+    if (nNumCPUs <= 1)
+    {
+        return 1;
+    }
+    else
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            if (EQUAL(pszNumThreads, "ALL_CPUS"))
+                return CPLGetNumCPUs();
+            return std::min(atoi(pszNumThreads), 1024);
+        }
+        else
+        {
+            return std::max(2, nNumCPUs / 2);
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GetMinFeaturesForThreadedReproj()                  */
+/************************************************************************/
+
+static int GetMinFeaturesForThreadedReproj()
+{
+    // Somewhat arbitrary threshold (config option only/mostly for autotest purposes)
+    return atoi(CPLGetConfigOption("OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ",
+                                   "10000"));
+}
+
 /************************************************************************/
 /*                 LayerTranslator::TranslateArrow()                    */
 /************************************************************************/
@@ -6136,6 +6254,26 @@ bool LayerTranslator::TranslateArrow(
         return false;
     }
 
+    // If the geometry column is not binary, we have requested its native
+    // encoding, and the output layer must be told which column it is.
+    const char *pszSrcGeomColumn = psInfo->m_poSrcLayer->GetGeometryColumn();
+    if (pszSrcGeomColumn[0] &&
+        psInfo->m_poSrcLayer->GetLayerDefn()->GetGeomFieldCount() == 1)
+    {
+        for (int64_t i = 0; i < schema.n_children; ++i)
+        {
+            const auto psChild = schema.children[i];
+            if (strcmp(psChild->name, pszSrcGeomColumn) == 0 &&
+                strcmp(psChild->format, "z") != 0 &&
+                strcmp(psChild->format, "Z") != 0)
+            {
+                aosOptionsWriteArrowBatch.SetNameValue("GEOMETRY_NAME",
+                                                       pszSrcGeomColumn);
+                break;
+            }
+        }
+    }
+
     int iArrowGeomFieldIndex = -1;
     if (m_bTransform)
     {
@@ -6154,33 +6292,9 @@ bool LayerTranslator::TranslateArrow(
     GIntBig nCount = 0;
     bool bGoOn = true;
     std::vector<GByte> abyModifiedWKB;
-    const int nNumReprojectionThreads = []()
-    {
-        const int nNumCPUs = CPLGetNumCPUs();
-        if (nNumCPUs <= 1)
-        {
-            return 1;
-        }
-        else
-        {
-            const char *pszNumThreads =
-                CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-            if (pszNumThreads)
-            {
-                if (EQUAL(pszNumThreads, "ALL_CPUS"))
-                    return CPLGetNumCPUs();
-                return std::min(atoi(pszNumThreads), 1024);
-            }
-            else
-            {
-                return std::max(2, nNumCPUs / 2);
-            }
-        }
-    }();
-
-    // Somewhat arbitrary threshold (config option only/mostly for autotest purposes)
-    const int MIN_FEATURES_FOR_THREADED_REPROJ = atoi(CPLGetConfigOption(
-        "OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ", "10000"));
+    const int nNumReprojectionThreads = GetNumReprojectionThreads();
+    const int MIN_FEATURES_FOR_THREADED_REPROJ =
+        GetMinFeaturesForThreadedReproj();
 
     while (bGoOn)
     {
@@ -6383,16 +6497,20 @@ bool LayerTranslator::TranslateArrow(
                 }
             };
 
-            if (nArrayLength >= MIN_FEATURES_FOR_THREADED_REPROJ &&
-                nNumReprojectionThreads >= 2)
+            // The source layer may also be read with several threads
+            const GDALThreadReservation oThreadReservation(
+                nArrayLength >= MIN_FEATURES_FOR_THREADED_REPROJ
+                    ? nNumReprojectionThreads
+                    : 1);
+            const int nThreads = oThreadReservation.GetThreadCount();
+            if (nThreads >= 2)
             {
                 std::vector<std::future<void>> oTasks;
-                for (int iThread = 0; iThread < nNumReprojectionThreads;
-                     ++iThread)
+                for (int iThread = 0; iThread < nThreads; ++iThread)
                 {
                     oTasks.emplace_back(std::async(std::launch::async,
                                                    oReprojectionLambda, iThread,
-                                                   nNumReprojectionThreads));
+                                                   nThreads));
                 }
                 for (auto &oTask : oTasks)
                 {
@@ -6449,6 +6567,188 @@ bool LayerTranslator::TranslateArrow(
     return bRet;
 }
 
+/************************************************************************/
+/*                     FeatureReprojectionPipeline                      */
+/************************************************************************/
+
+// Reads batches of features from the source layer and reprojects their
+// (single) geometry in worker threads, while the caller processes and writes
+// the features of the previous batch. Reading from the source layer is done
+// in the calling thread, so that the source and target datasets are never
+// accessed concurrently, and features are returned in their reading order.
+// Geometries whose reprojection requires special care (curves that may
+// become invalid) or has failed are left untouched, for the caller to
+// reproject them itself.
+class FeatureReprojectionPipeline
+{
+    struct Batch
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        // Not a std::vector<bool>, as elements are set from several threads
+        std::vector<GByte> abyReprojected{};
+        std::unique_ptr<GDALThreadReservation> poThreadReservation{};
+        std::vector<std::future<void>> aoTasks{};
+
+        void Wait()
+        {
+            for (auto &oTask : aoTasks)
+                oTask.wait();
+            aoTasks.clear();
+            poThreadReservation.reset();
+        }
+    };
+
+    OGRLayer *const m_poSrcLayer;
+    TargetLayerInfo::ReprojectionInfo &m_oReprojInfo;
+    const int m_nMaxThreads;
+    const size_t m_nBatchSize;
+    GIntBig m_nRemainingFeatures;
+    bool m_bStarted = false;
+    bool m_bEOF = false;
+    bool m_bReadError = false;
+    Batch m_oCurBatch{};
+    Batch m_oNextBatch{};
+    size_t m_iCurFeature = 0;
+
+    void ReadBatch(Batch &oBatch);
+
+    CPL_DISALLOW_COPY_ASSIGN(FeatureReprojectionPipeline)
+
+  public:
+    FeatureReprojectionPipeline(OGRLayer *poSrcLayer,
+                                TargetLayerInfo::ReprojectionInfo &oReprojInfo,
+                                int nMaxThreads, size_t nBatchSize,
+                                GIntBig nMaxFeatures)
+        : m_poSrcLayer(poSrcLayer), m_oReprojInfo(oReprojInfo),
+          m_nMaxThreads(nMaxThreads), m_nBatchSize(nBatchSize),
+          m_nRemainingFeatures(nMaxFeatures)
+    {
+    }
+
+    ~FeatureReprojectionPipeline()
+    {
+        m_oCurBatch.Wait();
+        m_oNextBatch.Wait();
+    }
+
+    std::unique_ptr<OGRFeature> GetNextFeature(bool &bReprojected);
+
+    /** Whether the source layer emitted a CE_Failure when reaching its end */
+    bool HadReadError() const
+    {
+        return m_bReadError;
+    }
+};
+
+/************************************************************************/
+/*                FeatureReprojectionPipeline::ReadBatch()              */
+/************************************************************************/
+
+void FeatureReprojectionPipeline::ReadBatch(Batch &oBatch)
+{
+    oBatch.apoFeatures.clear();
+    while (!m_bEOF && m_nRemainingFeatures != 0 &&
+           oBatch.apoFeatures.size() < m_nBatchSize)
+    {
+        CPLErrorReset();
+        std::unique_ptr<OGRFeature> poFeature(m_poSrcLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            m_bEOF = true;
+            m_bReadError = CPLGetLastErrorType() == CE_Failure;
+            break;
+        }
+        // Done in this thread, as m_oReprojInfo is not thread-safe
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && m_oReprojInfo.m_bWarnAboutDifferentCoordinateOperations)
+            m_oReprojInfo.UpdateExtremePoints(poGeom);
+        oBatch.apoFeatures.push_back(std::move(poFeature));
+        if (m_nRemainingFeatures > 0)
+            --m_nRemainingFeatures;
+    }
+    oBatch.abyReprojected.assign(oBatch.apoFeatures.size(), FALSE);
+    if (oBatch.apoFeatures.empty())
+        return;
+
+    oBatch.poThreadReservation =
+        std::make_unique<GDALThreadReservation>(m_nMaxThreads);
+    const int nThreads =
+        std::max(1, oBatch.poThreadReservation->GetThreadCount());
+    const size_t nFeatures = oBatch.apoFeatures.size();
+
+    const auto oReprojectionLambda =
+        [this, &oBatch, nFeatures](int iThread, int nThreadCount)
+    {
+        // Failures are reported by the caller when it retries the
+        // reprojection
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        auto poThisCT =
+            std::unique_ptr<OGRCoordinateTransformation>(
+                m_oReprojInfo.m_poCT->Clone());
+        if (!poThisCT)
+            return;
+        OGRGeometryFactory::TransformWithOptionsCache oCache;
+        char **papszTransformOptions =
+            m_oReprojInfo.m_aosTransformOptions.List();
+        const size_t iStart = nFeatures * iThread / nThreadCount;
+        const size_t iEnd = nFeatures * (iThread + 1) / nThreadCount;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            OGRFeature *poFeature = oBatch.apoFeatures[i].get();
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (!poGeom || (m_oReprojInfo.m_bCanInvalidateValidity &&
+                            poGeom->hasCurveGeometry(TRUE)))
+            {
+                continue;
+            }
+            auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                OGRGeometryFactory::transformWithOptions(
+                    poGeom, poThisCT.get(), papszTransformOptions, oCache));
+            if (poReprojectedGeom)
+            {
+                poFeature->SetGeometryDirectly(poReprojectedGeom.release());
+                oBatch.abyReprojected[i] = TRUE;
+            }
+        }
+    };
+
+    for (int iThread = 0; iThread < nThreads; ++iThread)
+    {
+        oBatch.aoTasks.emplace_back(std::async(
+            std::launch::async, oReprojectionLambda, iThread, nThreads));
+    }
+}
+
+/************************************************************************/
+/*             FeatureReprojectionPipeline::GetNextFeature()            */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+FeatureReprojectionPipeline::GetNextFeature(bool &bReprojected)
+{
+    bReprojected = false;
+    if (m_iCurFeature == m_oCurBatch.apoFeatures.size())
+    {
+        if (!m_bStarted)
+        {
+            m_bStarted = true;
+            ReadBatch(m_oNextBatch);
+        }
+        m_oNextBatch.Wait();
+        std::swap(m_oCurBatch, m_oNextBatch);
+        m_iCurFeature = 0;
+
+        // Start reprojecting the following batch while the caller
+        // processes this one.
+        ReadBatch(m_oNextBatch);
+
+        if (m_oCurBatch.apoFeatures.empty())
+            return nullptr;
+    }
+    bReprojected = m_oCurBatch.abyReprojected[m_iCurFeature] != 0;
+    return std::move(m_oCurBatch.apoFeatures[m_iCurFeature++]);
+}
+
 /************************************************************************/
 /*                     LayerTranslator::Translate()                     */
 /************************************************************************/
@@ -6530,6 +6830,47 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
+    // When the only geometry processing on the source geometry before
+    // reprojection is the reprojection itself, reproject geometries of
+    // batches of features in worker threads, ahead of their writing.
+    std::unique_ptr<FeatureReprojectionPipeline> poReprojectionPipeline;
+    if (bSetupCTOK && poFeatureIn == nullptr &&
+        psOptions->nFIDToFetch == OGRNullFID && nSrcGeomFieldCount == 1 &&
+        nDstGeomFieldCount == 1 && iRequestedSrcGeomField < 0 &&
+        !bExplodeCollections && iSrcZField == -1 &&
+        m_nCoordDim == COORD_DIM_UNCHANGED && m_eGeomOp == GEOMOP_NONE &&
+        m_poClipSrcOri == nullptr && m_poSrcDS != m_poODS &&
+        psInfo->m_aoReprojectionInfo[0].m_poCT != nullptr)
+    {
+        const int nNumReprojectionThreads = GetNumReprojectionThreads();
+        const int nMinFeatures = GetMinFeaturesForThreadedReproj();
+        GIntBig nExpectedFeatures = nCountLayerFeatures;
+        if (nExpectedFeatures <= 0)
+        {
+            nExpectedFeatures =
+                poSrcLayer->TestCapability(OLCFastFeatureCount)
+                    ? poSrcLayer->GetFeatureCount(/* bForce = */ FALSE)
+                    : -1;
+        }
+        if (m_nLimit >= 0 && (nExpectedFeatures < 0 ||
+                              nExpectedFeatures > m_nLimit))
+            nExpectedFeatures = m_nLimit;
+        if (nNumReprojectionThreads >= 2 &&
+            (nExpectedFeatures < 0 || nExpectedFeatures >= nMinFeatures))
+        {
+            CPLDebug("OGR2OGR",
+                     "Using up to %d threads for reprojection of layer %s",
+                     nNumReprojectionThreads, poSrcLayer->GetName());
+            poReprojectionPipeline =
+                std::make_unique<FeatureReprojectionPipeline>(
+                    poSrcLayer, psInfo->m_aoReprojectionInfo[0],
+                    nNumReprojectionThreads,
+                    static_cast<size_t>(std::max(1, nMinFeatures)),
+                    m_nLimit >= 0 ? m_nLimit - psInfo->m_nFeaturesRead : -1);
+        }
+    }
+    bool bGeomReprojectedByPipeline = false;
+
     while (true)
     {
         if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
@@ -6541,12 +6882,17 @@ bool LayerTranslator::Translate(
             poFeature.reset(poFeatureIn);
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else if (poReprojectionPipeline)
+            poFeature = poReprojectionPipeline->GetNextFeature(
+                bGeomReprojectedByPipeline);
         else
             poFeature.reset(poSrcLayer->GetNextFeature());
 
         if (poFeature == nullptr)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (CPLGetLastErrorType() == CE_Failure ||
+                (poReprojectionPipeline &&
+                 poReprojectionPipeline->HadReadError()))
             {
                 bRet = false;
             }
@@ -6974,7 +7320,11 @@ bool LayerTranslator::Translate(
                     psInfo->m_aoReprojectionInfo[iGeom]
                         .m_bCanInvalidateValidity;
 
-                if (poCT != nullptr || papszTransformOptions != nullptr)
+                if (bGeomReprojectedByPipeline)
+                {
+                    // Already done by FeatureReprojectionPipeline
+                }
+                else if (poCT != nullptr || papszTransformOptions != nullptr)
                 {
                     // If we need to change the geometry type to linear, and
                     // we have a geometry with curves, then convert it to
@@ -7010,28 +7360,8 @@ bool LayerTranslator::Translate(
                     if (psInfo->m_aoReprojectionInfo[iGeom]
                             .m_bWarnAboutDifferentCoordinateOperations)
                     {
-                        struct Visitor : public OGRDefaultConstGeometryVisitor
-                        {
-                            TargetLayerInfo::ReprojectionInfo &m_info;
-
-                            explicit Visitor(
-                                TargetLayerInfo::ReprojectionInfo &info)
-                                : m_info(info)
-                            {
-                            }
-
-                            using OGRDefaultConstGeometryVisitor::visit;
-
-                            void visit(const OGRPoint *point) override
-                            {
-                                m_info.UpdateExtremePoints(point->getX(),
-                                                           point->getY(),
-                                                           point->getZ());
-                            }
-                        };
-
-                        Visitor oVisit(psInfo->m_aoReprojectionInfo[iGeom]);
-                        poDstGeometry->accept(&oVisit);
+                        psInfo->m_aoReprojectionInfo[iGeom].UpdateExtremePoints(
+                            poDstGeometry.get());
                     }
 
                     for (int iIter = 0; iIter < 2; ++iIter)
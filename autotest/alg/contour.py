@@ -607,3 +607,57 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test that generating contours with several threads gives the same lines
+
+
+def test_contour_num_threads():
+
+    import math
+
+    width = 50
+    height = 600
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float64
+    )
+    src_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        struct.pack(
+            "d" * (width * height),
+            *[
+                100 * math.sin(x / 7.0) * math.cos(y / 11.0)
+                for y in range(height)
+                for x in range(width)
+            ],
+        ),
+    )
+
+    def contour(options):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("ELEV", ogr.OFTReal))
+        assert (
+            gdal.ContourGenerateEx(
+                src_ds.GetRasterBand(1),
+                lyr,
+                options=["LEVEL_INTERVAL=10", "ELEV_FIELD=0"] + options,
+            )
+            == gdal.CE_None
+        )
+        ret = {}
+        for f in lyr:
+            count, length = ret.get(f["ELEV"], (0, 0))
+            ret[f["ELEV"]] = (count + 1, length + f.GetGeometryRef().Length())
+        return ret
+
+    ref = contour([])
+    got = contour(["NUM_THREADS=4"])
+    assert got.keys() == ref.keys()
+    for elev in ref:
+        assert got[elev][0] == ref[elev][0]
+        assert got[elev][1] == pytest.approx(ref[elev][1], rel=1e-10)
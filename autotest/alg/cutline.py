@@ -104,3 +104,38 @@ def test_cutline_4():
 
 
 ###############################################################################
+
+
+###############################################################################
+# Test that the cutline mask does not depend on the chunking of the warp
+
+
+def test_cutline_many_chunks():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 80)
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    src_ds.GetRasterBand(1).Fill(1)
+
+    # Multipolygon with a hole, horizontal edges on pixel centers, and a
+    # part outside of the raster
+    cutline = (
+        "MULTIPOLYGON (((2 -2,90.5 -2,60 -70.5,10 -50,2 -2),"
+        "(20 -20,40 -20,40 -40.5,20 -20)),"
+        "((80 -60.5,95 -60.5,95 -75,80 -75,80 -60.5)),"
+        "((200 -10,210 -10,210 -20,200 -10)))"
+    )
+
+    def warp(warp_memory_limit):
+        return gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            cutlineWKT=cutline,
+            warpMemoryLimit=warp_memory_limit,
+        )
+
+    ref_ds = warp(1e8)
+    ref_data = ref_ds.GetRasterBand(1).ReadRaster()
+    assert ref_data.count(b"\x00") > 0
+    assert ref_data.count(b"\x01") > 0
+    assert warp(1000).GetRasterBand(1).ReadRaster() == ref_data
@@ -81,3 +81,31 @@ def test_dither_1():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize("num_threads", ["2", "ALL_CPUS"])
+def test_dither_num_threads(num_threads):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/rgbsmall.tif", format="MEM", width=300, height=200
+    )
+    r_band = src_ds.GetRasterBand(1)
+    g_band = src_ds.GetRasterBand(2)
+    b_band = src_ds.GetRasterBand(3)
+
+    def run():
+        ct = gdal.ColorTable()
+        gdal.ComputeMedianCutPCT(r_band, g_band, b_band, 16, ct)
+        dst_ds = gdal.GetDriverByName("MEM").Create("", 300, 200)
+        gdal.DitherRGB2PCT(r_band, g_band, b_band, dst_ds.GetRasterBand(1), ct)
+        return [ct.GetColorEntry(i) for i in range(ct.GetCount())], dst_ds.ReadRaster()
+
+    ref_ct, ref_data = run()
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ct, data = run()
+    assert ct == ref_ct
+    assert data == ref_data
@@ -386,3 +386,51 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that NUM_THREADS gives the same result as processing the whole raster
+
+
+@pytest.mark.parametrize("smoothing_iterations", [0, 2])
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+def test_fillnodata_num_threads(smoothing_iterations, interpolation):
+
+    xsize = 2500
+    ysize = 1500
+
+    def create():
+        ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_Float32)
+        ds.GetRasterBand(1).SetNoDataValue(0)
+        ds.GetRasterBand(1).Fill(1)
+        for y in range(0, ysize, 97):
+            line = array.array("f", [(x * 7 + y) % 251 for x in range(xsize)])
+            ds.GetRasterBand(1).WriteRaster(0, y, xsize, 1, line)
+        # Holes crossing tile boundaries.
+        for x, y, w, h in [
+            (1000, 1000, 60, 50),
+            (10, 1020, 2480, 10),
+            (2040, 5, 30, 1490),
+        ]:
+            ds.GetRasterBand(1).WriteRaster(x, y, w, h, array.array("f", [0] * (w * h)))
+        return ds
+
+    options = ["INTERPOLATION=" + interpolation, "TEMP_FILE_DRIVER=MEM"]
+    ref_ds = create()
+    gdal.FillNodata(
+        ref_ds.GetRasterBand(1),
+        None,
+        maxSearchDist=20,
+        smoothingIterations=smoothing_iterations,
+        options=options,
+    )
+
+    ds = create()
+    gdal.FillNodata(
+        ds.GetRasterBand(1),
+        None,
+        maxSearchDist=20,
+        smoothingIterations=smoothing_iterations,
+        options=options + ["NUM_THREADS=4"],
+    )
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
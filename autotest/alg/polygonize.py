@@ -427,3 +427,42 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that the multi-threaded enumeration gives the same polygons
+
+
+@pytest.mark.parametrize("connectedness", ["4", "8"])
+def test_polygonize_num_threads(connectedness):
+
+    import random
+
+    rnd = random.Random(1)
+    width = 60
+    height = 400
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(rnd.randint(0, 2) for _ in range(width * height)),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    def polygonize(options):
+        mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        assert (
+            gdal.Polygonize(
+                src_band, None, mem_layer, 0, ["8CONNECTED=" + connectedness] + options
+            )
+            == 0
+        )
+        return sorted(
+            (f.GetField("DN"), f.GetGeometryRef().ExportToWkt()) for f in mem_layer
+        )
+
+    assert polygonize(["NUM_THREADS=4"]) == polygonize([])
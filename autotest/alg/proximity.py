@@ -11,6 +11,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import random
+import struct
 
 import pytest
 
@@ -109,3 +111,71 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test ALGORITHM=EXACT against a brute force computation
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+@pytest.mark.parametrize("dt", [gdal.GDT_Float32, gdal.GDT_Int16])
+def test_proximity_exact(num_threads, dt):
+
+    random.seed(0)
+    xsize = 61
+    ysize = 47
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    values = [
+        (2 if random.random() < 0.01 else 1 if random.random() < 0.1 else 0)
+        for _ in range(xsize * ysize)
+    ]
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, xsize, ysize, bytes(values), buf_type=gdal.GDT_Byte
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(1)
+
+    targets = [(i % xsize, i // xsize) for i, v in enumerate(values) if v == 2]
+    assert targets
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, dt)
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=[
+                "ALGORITHM=EXACT",
+                "VALUES=2",
+                "MAXDIST=10",
+                "NODATA=-1",
+                "USE_INPUT_NODATA=YES",
+            ],
+        )
+    got = struct.unpack(
+        "f" * (xsize * ysize),
+        dst_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32),
+    )
+
+    for y in range(ysize):
+        for x in range(xsize):
+            dist = min(((x - tx) ** 2 + (y - ty) ** 2) ** 0.5 for (tx, ty) in targets)
+            if values[y * xsize + x] == 1 and dist > 0:
+                expected = -1
+            elif dist > 10:
+                expected = -1
+            else:
+                expected = dist
+            if dt == gdal.GDT_Int16:
+                expected = round(expected)
+            assert got[y * xsize + x] == pytest.approx(expected, abs=1e-5), (x, y)
+
+
+def test_proximity_exact_invalid_algorithm():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="Unrecognized ALGORITHM value"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=invalid"],
+        )
@@ -1039,3 +1039,62 @@ def test_rasterize_bugfix_gh12129():
 
     # 121 on s390x
     assert target_ds.GetRasterBand(1).Checksum() in (120, 121)
+
+
+###############################################################################
+# Test that the multi-threaded tiled mode gives the same result as the
+# default one
+
+
+@pytest.mark.parametrize("tiled", [False, True])
+@pytest.mark.parametrize(
+    "options", [[], ["ALL_TOUCHED=YES"], ["MERGE_ALG=ADD"], ["ATTRIBUTE=val"]]
+)
+def test_rasterize_num_threads(tmp_vsimem, tiled, options):
+
+    ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ogr_ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    # Geometries are in pixel coordinates
+    wkts = [
+        "POLYGON ((10.3 10.7,2900.2 50.1,1500.6 2400.4,10.3 10.7))",
+        "POLYGON ((1000.5 1000.5,1100.5 1000.5,1100.5 1100.5,1000.5 1100.5,1000.5 1000.5),(1020.5 1020.5,1050.5 1020.5,1050.5 1050.5,1020.5 1020.5))",
+        "MULTIPOLYGON (((2000.1 100.2,2500.3 100.2,2500.3 2300.4,2000.1 100.2)),((100.1 2000.2,200.3 2000.2,200.3 2400.4,100.1 2000.2)))",
+        "LINESTRING (0.5 0.5,2999.5 2499.5,0.5 2499.5)",
+        "MULTIPOINT ((5.5 5.5),(1023.5 1023.5),(2047.2 1500.1))",
+        "POLYGON ((-1000 -1000,4000 -1000,4000 -500,-1000 -1000))",
+    ]
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        f["val"] = i + 1
+        lyr.CreateFeature(f)
+
+    def rasterize(filename, extra_options):
+        if tiled:
+            ds = gdal.GetDriverByName("GTiff").Create(
+                filename,
+                3000,
+                2500,
+                2,
+                options=["TILED=YES", "BLOCKXSIZE=256", "BLOCKYSIZE=256"],
+            )
+        else:
+            ds = gdal.GetDriverByName("MEM").Create("", 3000, 2500, 2)
+        ds.SetGeoTransform([0, 1, 0, 0, 0, 1])
+        assert (
+            gdal.RasterizeLayer(
+                ds,
+                [1, 2],
+                lyr,
+                burn_values=[] if "ATTRIBUTE=val" in options else [10, 20],
+                options=options + extra_options,
+            )
+            == gdal.CE_None
+        )
+        return [ds.GetRasterBand(i + 1).Checksum() for i in range(2)]
+
+    ref = rasterize(tmp_vsimem / "ref.tif", ["CHUNKYSIZE=100"])
+    assert ref != [0, 0]
+    assert rasterize(tmp_vsimem / "test.tif", ["NUM_THREADS=4"]) == ref
+    assert rasterize(tmp_vsimem / "test1.tif", ["NUM_THREADS=1"]) == ref
@@ -341,3 +341,45 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that the multi-threaded enumeration gives the same result
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_sieve_num_threads(connectedness):
+
+    import random
+
+    rnd = random.Random(1)
+    width = 100
+    height = 500
+    drv = gdal.GetDriverByName("MEM")
+    src_ds = drv.Create("", width, height, gdal.GDT_Byte)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(rnd.randint(0, 3) for _ in range(width * height)),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    ref_ds = drv.Create("", width, height, gdal.GDT_Byte)
+    gdal.SieveFilter(src_band, None, ref_ds.GetRasterBand(1), 5, connectedness)
+
+    dst_ds = drv.Create("", width, height, gdal.GDT_Byte)
+    assert (
+        gdal.SieveFilter(
+            src_band,
+            None,
+            dst_ds.GetRasterBand(1),
+            5,
+            connectedness,
+            options=["NUM_THREADS=4"],
+        )
+        == 0
+    )
+
+    assert dst_ds.ReadRaster() == ref_ds.ReadRaster()
@@ -1757,6 +1757,39 @@ def test_warp_mode_ties(tie_strategy, dtype):
         assert result == 1
 
 
+###############################################################################
+# Test mode and average on several target pixels, with and without nodata, to
+# check that the counts of a target pixel do not leak into the next one
+
+
+@pytest.mark.parametrize(
+    "dtype", (gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_Float32)
+)
+@pytest.mark.parametrize("nodata", (None, 7))
+def test_warp_mode_average_several_pixels(dtype, nodata):
+
+    gdaltest.importorskip_gdal_array()
+    numpy = pytest.importorskip("numpy")
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 4, 2, 1, dtype)
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    src_ds.GetRasterBand(1).WriteArray(numpy.array([[3, 3, 7, 7], [3, 5, 7, 1]]))
+    if nodata is not None:
+        src_ds.GetRasterBand(1).SetNoDataValue(nodata)
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="mode", xRes=2, yRes=2)
+    got = out_ds.GetRasterBand(1).ReadAsArray()[0].tolist()
+    assert got == ([3, 1] if nodata is not None else [3, 7])
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="average", xRes=2, yRes=2)
+    got = out_ds.GetRasterBand(1).ReadAsArray()[0].tolist()
+    if dtype == gdal.GDT_Float32:
+        assert got == pytest.approx([3.5, 1 if nodata is not None else 5.5])
+    else:
+        # 3.5 and 5.5 rounded to the nearest integer
+        assert got == [4, 1 if nodata is not None else 6]
+
+
 ###############################################################################
 # Test bugfix for #6526
 
@@ -2037,6 +2070,42 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
             gdal.Warp("", ds, format="MEM", multithread=True)
 
 
+###############################################################################
+# Test that reusing the source window of the previous chunk does not change
+# the result
+
+
+@pytest.mark.parametrize("multithread", [False, True])
+def test_warp_src_window_cache(multithread):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    src_ds = gdal.Translate("", src_ds, format="MEM", width=200, height=200)
+    src_ds.AddBand(gdal.GDT_Float32)
+    src_ds.GetRasterBand(2).WriteRaster(
+        0,
+        0,
+        200,
+        200,
+        src_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32),
+    )
+
+    checksums = []
+    for cache in ("YES", "NO"):
+        ds = gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            dstSRS="EPSG:4326",
+            resampleAlg=gdal.GRA_Cubic,
+            warpMemoryLimit=10000,
+            multithread=multithread,
+            warpOptions=["SRC_WINDOW_CACHE=" + cache],
+        )
+        checksums.append([ds.GetRasterBand(i + 1).Checksum() for i in range(2)])
+    assert checksums[0] == checksums[1]
+    assert checksums[0][0] != 0
+
+
 ###############################################################################
 
 
@@ -11,6 +11,8 @@
  ****************************************************************************/
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include "gdal_unit_test.h"
 
@@ -19,6 +21,7 @@
 #include "gdal_alg.h"
 #include "gdalwarper.h"
 #include "gdal_priv.h"
+#include "ogr_spatialref.h"
 
 #include "gtest_include.h"
 
@@ -300,6 +303,154 @@ TEST_F(test_alg, GDALAutoCreateWarpedVRT_alpha_band)
     GDALClose(hWarpedVRT);
 }
 
+// Test GDAL_APPROX_TRANSFORMER_CACHE_SIZE
+TEST_F(test_alg, GDALApproxTransform_cache)
+{
+    OGRSpatialReference oSrcSRS;
+    oSrcSRS.importFromEPSG(4326);
+    oSrcSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    char *pszSrcWKT = nullptr;
+    oSrcSRS.exportToWkt(&pszSrcWKT);
+    OGRSpatialReference oDstSRS;
+    oDstSRS.importFromEPSG(32631);
+    char *pszDstWKT = nullptr;
+    oDstSRS.exportToWkt(&pszDstWKT);
+    const double adfSrcGT[6] = {0, 0.01, 0, 50, 0, -0.01};
+    const double adfDstGT[6] = {200000, 100, 0, 5600000, 0, -100};
+
+    constexpr int N = 256;
+    const auto Transform = [&](const double *padfDstGT, std::vector<double> &x,
+                               std::vector<double> &y)
+    {
+        void *hGenImgProj = GDALCreateGenImgProjTransformer3(
+            pszSrcWKT, adfSrcGT, pszDstWKT, padfDstGT);
+        ASSERT_TRUE(hGenImgProj != nullptr);
+        void *hApprox = GDALCreateApproxTransformer(GDALGenImgProjTransform,
+                                                    hGenImgProj, 0.125);
+        GDALApproxTransformerOwnsSubtransformer(hApprox, TRUE);
+        x.resize(N);
+        y.resize(N);
+        std::vector<double> z(N);
+        std::vector<int> anSuccess(N);
+        for (int i = 0; i < N; ++i)
+        {
+            x[i] = i + 0.5;
+            y[i] = 10.5;
+        }
+        EXPECT_TRUE(GDALApproxTransform(hApprox, TRUE, N, x.data(), y.data(),
+                                        z.data(), anSuccess.data()));
+        GDALDestroyApproxTransformer(hApprox);
+    };
+
+    std::vector<double> xRef, yRef;
+    Transform(adfDstGT, xRef, yRef);
+
+    {
+        CPLConfigOptionSetter oSetter("GDAL_APPROX_TRANSFORMER_CACHE_SIZE",
+                                      "10", false);
+        // First call populates the cache, second one uses it.
+        for (int iter = 0; iter < 2; ++iter)
+        {
+            std::vector<double> x, y;
+            Transform(adfDstGT, x, y);
+            EXPECT_EQ(x, xRef);
+            EXPECT_EQ(y, yRef);
+        }
+
+        // A different target grid must not hit the previous entry.
+        double adfOtherDstGT[6];
+        memcpy(adfOtherDstGT, adfDstGT, sizeof(adfOtherDstGT));
+        adfOtherDstGT[0] += 1000;
+        std::vector<double> x, y;
+        Transform(adfOtherDstGT, x, y);
+        EXPECT_NE(x, xRef);
+    }
+
+    CPLFree(pszSrcWKT);
+    CPLFree(pszDstWKT);
+}
+
+// Test GDALRegisterWarpKernelEngine()
+TEST_F(test_alg, GDALWarpKernelEngine)
+{
+    class DummyEngine final : public GDALWarpKernelEngine
+    {
+      public:
+        int m_nCalls = 0;
+
+        const char *GetName() const override
+        {
+            return "DUMMY";
+        }
+
+        bool CanHandle(const GDALWarpKernel &oWK) const override
+        {
+            return oWK.eWorkingDataType == GDT_Byte &&
+                   oWK.eResample == GRA_NearestNeighbour;
+        }
+
+        CPLErr PerformWarp(GDALWarpKernel &oWK) override
+        {
+            ++m_nCalls;
+            for (int iBand = 0; iBand < oWK.nBands; ++iBand)
+            {
+                memset(oWK.papabyDstImage[iBand], 42,
+                       static_cast<size_t>(oWK.nDstXSize) * oWK.nDstYSize);
+            }
+            return CE_None;
+        }
+    };
+
+    auto poEngine = std::make_shared<DummyEngine>();
+    GDALRegisterWarpKernelEngine(poEngine);
+
+    const auto Warp =
+        [](GDALResampleAlg eResampleAlg, const char *pszEngine) -> int
+    {
+        auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+        GDALDatasetUniquePtr poSrcDS(
+            poDriver->Create("", 4, 4, 1, GDT_Byte, nullptr));
+        GDALDatasetUniquePtr poDstDS(
+            poDriver->Create("", 4, 4, 1, GDT_Byte, nullptr));
+        double adfGeoTransform[6] = {10, 1, 0, 20, 0, -1};
+        poSrcDS->SetGeoTransform(adfGeoTransform);
+        poDstDS->SetGeoTransform(adfGeoTransform);
+        poSrcDS->GetRasterBand(1)->Fill(1);
+
+        GDALWarpOptions *psOptions = GDALCreateWarpOptions();
+        if (pszEngine)
+            psOptions->papszWarpOptions = CSLSetNameValue(
+                psOptions->papszWarpOptions, "KERNEL_ENGINE", pszEngine);
+        CPL_IGNORE_RET_VAL(GDALReprojectImage(
+            GDALDataset::ToHandle(poSrcDS.get()), nullptr,
+            GDALDataset::ToHandle(poDstDS.get()), nullptr, eResampleAlg, 0, 0,
+            nullptr, nullptr, psOptions));
+        GDALDestroyWarpOptions(psOptions);
+
+        GByte nVal = 0;
+        CPL_IGNORE_RET_VAL(poDstDS->GetRasterBand(1)->RasterIO(
+            GF_Read, 0, 0, 1, 1, &nVal, 1, 1, GDT_Byte, 0, 0, nullptr));
+        return nVal;
+    };
+
+    EXPECT_EQ(Warp(GRA_NearestNeighbour, nullptr), 42);
+    EXPECT_EQ(poEngine->m_nCalls, 1);
+    EXPECT_EQ(Warp(GRA_NearestNeighbour, "DUMMY"), 42);
+    EXPECT_EQ(poEngine->m_nCalls, 2);
+
+    // Engine cannot handle bilinear: CPU fallback
+    EXPECT_EQ(Warp(GRA_Bilinear, nullptr), 1);
+    EXPECT_EQ(poEngine->m_nCalls, 2);
+
+    EXPECT_EQ(Warp(GRA_NearestNeighbour, "CPU"), 1);
+    EXPECT_EQ(Warp(GRA_NearestNeighbour, "UNKNOWN"), 1);
+    EXPECT_EQ(poEngine->m_nCalls, 2);
+
+    GDALDeregisterWarpKernelEngine("DUMMY");
+    EXPECT_EQ(Warp(GRA_NearestNeighbour, nullptr), 1);
+    EXPECT_EQ(poEngine->m_nCalls, 2);
+}
+
 // Test GDALIsLineOfSightVisible() with single point dataset
 TEST_F(test_alg, GDALIsLineOfSightVisible_single_point_dataset)
 {
@@ -30,6 +30,7 @@
 #include "cpl_string.h"
 #include "cpl_safemaths.hpp"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_json.h"
 #include "cpl_json_streaming_parser.h"
 #include "cpl_json_streaming_writer.h"
@@ -37,6 +38,7 @@
 #include "cpl_http.h"
 #include "cpl_auto_close.h"
 #include "cpl_minixml.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
 #include "cpl_spawn.h"
 #include "cpl_worker_thread_pool.h"
@@ -48,6 +50,7 @@
 #include <limits>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "gtest_include.h"
 
@@ -1232,6 +1235,35 @@ TEST_F(test_cpl, CPLString_replaceAll)
     ASSERT_EQ(osTest, "fooBarBarfoo");
 }
 
+/************************************************************************/
+/*                        VSIAdviseHugePages()                          */
+/************************************************************************/
+TEST_F(test_cpl, VSIAdviseHugePages)
+{
+    VSIAdviseHugePages(nullptr, 0);
+
+    // Below the minimum size: no-op
+    std::vector<GByte> abySmall(4096);
+    VSIAdviseHugePages(abySmall.data(), abySmall.size());
+
+    if (!CPLTestBool(CPLGetConfigOption("SKIP_MEM_INTENSIVE_TEST", "NO")))
+    {
+        // Buffer that is not aligned on the huge page size
+        constexpr size_t nSize = 40 * 1024 * 1024 + 1;
+        GByte *ptr = static_cast<GByte *>(VSICalloc(1, nSize));
+        if (ptr)
+        {
+            VSIAdviseHugePages(ptr + 1, nSize - 1);
+            ptr[1] = 1;
+            ptr[nSize - 1] = 2;
+            EXPECT_EQ(ptr[0], 0);
+            EXPECT_EQ(ptr[1], 1);
+            EXPECT_EQ(ptr[nSize - 1], 2);
+            VSIFree(ptr);
+        }
+    }
+}
+
 /************************************************************************/
 /*                        VSIMallocAligned()                            */
 /************************************************************************/
@@ -1295,6 +1327,66 @@ TEST_F(test_cpl, CPLGetConfigOptions)
     CSLDestroy(options);
 }
 
+/************************************************************************/
+/*              CPLGetConfigOption() from several threads               */
+/************************************************************************/
+TEST_F(test_cpl, CPLGetConfigOption_multithreaded)
+{
+    char **papszOldOptions = CPLGetConfigOptions();
+
+    // Keys are case insensitive, and the first occurrence wins
+    const char *const apszOptions[] = {"FOOFOO=BAR", "foofoo=BAZ",
+                                       "BARBAR:BAZ", nullptr};
+    CPLSetConfigOptions(apszOptions);
+    EXPECT_STREQ(CPLGetConfigOption("fooFOO", nullptr), "BAR");
+    EXPECT_STREQ(CPLGetConfigOption("BARBAR", nullptr), "BAZ");
+
+    // A value remains valid while options of other keys are modified
+    const char *pszVal = CPLGetConfigOption("FOOFOO", nullptr);
+    CPLSetConfigOption("BARBAR", "OTHER");
+    EXPECT_STREQ(CPLGetConfigOption("BARBAR", nullptr), "OTHER");
+    EXPECT_STREQ(pszVal, "BAR");
+    CPLSetConfigOption("BARBAR", nullptr);
+    EXPECT_EQ(CPLGetConfigOption("BARBAR", nullptr), nullptr);
+
+    // A thread-local value overrides the global one
+    CPLSetThreadLocalConfigOption("FOOFOO", "TL");
+    EXPECT_STREQ(CPLGetConfigOption("FOOFOO", nullptr), "TL");
+    EXPECT_STREQ(CPLGetGlobalConfigOption("FOOFOO", nullptr), "BAR");
+    CPLSetThreadLocalConfigOption("FOOFOO", nullptr);
+
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bError{false};
+    std::vector<std::thread> aoThreads;
+    for (int i = 0; i < 4; ++i)
+    {
+        aoThreads.emplace_back(
+            [&bStop, &bError]()
+            {
+                while (!bStop)
+                {
+                    const char *pszFoo = CPLGetConfigOption("FOOFOO", nullptr);
+                    if (!pszFoo || strcmp(pszFoo, "BAR") != 0)
+                        bError = true;
+                    const char *pszCounter =
+                        CPLGetConfigOption("COUNTER", "0");
+                    if (atoi(pszCounter) < 0)
+                        bError = true;
+                }
+            });
+    }
+    for (int i = 0; i < 1000; ++i)
+        CPLSetConfigOption("COUNTER", CPLSPrintf("%d", i));
+    bStop = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_FALSE(bError);
+    EXPECT_STREQ(CPLGetConfigOption("COUNTER", nullptr), "999");
+
+    CPLSetConfigOptions(papszOldOptions);
+    CSLDestroy(papszOldOptions);
+}
+
 /************************************************************************/
 /*  CPLGetThreadLocalConfigOptions() / CPLSetThreadLocalConfigOptions() */
 /************************************************************************/
@@ -2943,6 +3035,60 @@ TEST_F(test_cpl, CPLJSONDocument)
         ASSERT_TRUE(oDocument.LoadMemory(CPLString("{ \"/foo\" : \"bar\" }")));
         ASSERT_EQ(oDocument.GetRoot().GetString("/foo"), std::string("bar"));
     }
+    {
+        // Test loading while skipping members
+        const char *pszJSON =
+            "{\"type\": \"FeatureCollection\", \"features\": ["
+            "{\"id\": 1, \"geometry\": {\"coordinates\": [[1.5, 2], [3, "
+            "4]]}, \"properties\": {\"a\": \"x\", \"geometry\": true, "
+            "\"b\": [1, null, 12345678901234, -2.5e3, false]}}, "
+            "{\"geometry\": null, \"id\": 2}], \"geometry\": \"kept\"}";
+        const std::vector<std::string> aosSkipped{"features/geometry"};
+        const auto CheckDoc = [](const CPLJSONDocument &oDoc)
+        {
+            const auto oRoot = oDoc.GetRoot();
+            EXPECT_EQ(oRoot.GetString("type"), "FeatureCollection");
+            EXPECT_EQ(oRoot.GetString("geometry"), "kept");
+            const auto oFeatures = oRoot.GetArray("features");
+            ASSERT_EQ(oFeatures.Size(), 2);
+            EXPECT_EQ(oFeatures[0].GetInteger("id"), 1);
+            EXPECT_FALSE(oFeatures[0].GetObj("geometry").IsValid());
+            EXPECT_EQ(oFeatures[0].GetString("properties/a"), "x");
+            EXPECT_TRUE(oFeatures[0].GetBool("properties/geometry"));
+            const auto oB = oFeatures[0].GetArray("properties/b");
+            ASSERT_EQ(oB.Size(), 5);
+            EXPECT_EQ(oB[0].ToInteger(), 1);
+            EXPECT_EQ(oB[1].GetType(), CPLJSONObject::Type::Null);
+            EXPECT_EQ(oB[2].ToLong(), 12345678901234);
+            EXPECT_EQ(oB[3].ToDouble(), -2.5e3);
+            EXPECT_EQ(oB[4].GetType(), CPLJSONObject::Type::Boolean);
+            EXPECT_EQ(oFeatures[1].GetInteger("id"), 2);
+            EXPECT_FALSE(oFeatures[1].GetObj("geometry").IsValid());
+        };
+
+        CPLJSONDocument oDocument;
+        ASSERT_TRUE(
+            oDocument.LoadMemory(reinterpret_cast<const GByte *>(pszJSON),
+                                 strlen(pszJSON), aosSkipped));
+        CheckDoc(oDocument);
+
+        const char *pszFilename = "/vsimem/test_skipped_members.json";
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        ASSERT_NE(fp, nullptr);
+        VSIFWriteL(pszJSON, 1, strlen(pszJSON), fp);
+        VSIFCloseL(fp);
+        CPLJSONDocument oDocument2;
+        EXPECT_TRUE(oDocument2.Load(pszFilename, aosSkipped));
+        VSIUnlink(pszFilename);
+        CheckDoc(oDocument2);
+
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        CPLJSONDocument oDocument3;
+        EXPECT_FALSE(oDocument3.LoadMemory(
+            reinterpret_cast<const GByte *>(pszJSON), 20, aosSkipped));
+        EXPECT_FALSE(oDocument3.Load("/vsimem/i_do_not_exist.json",
+                                     aosSkipped));
+    }
 }
 
 // Test CPLRecodeIconv() with re-allocation
@@ -4130,6 +4276,55 @@ TEST_F(test_cpl, builtin_compressors_zlib_high_compression_rate)
     CPLFree(out_buffer2);
 }
 
+// Test that compression contexts reused between calls do not keep options
+// from a previous call
+TEST_F(test_cpl, builtin_compressors_context_reuse)
+{
+    for (const char *id : {"zlib", "gzip", "zstd"})
+    {
+        const auto pCompressor = CPLGetCompressor(id);
+        const auto pDecompressor = CPLGetDecompressor(id);
+        if (pCompressor == nullptr || pDecompressor == nullptr)
+            continue;
+
+        std::vector<GByte> abyInput(10000);
+        for (size_t i = 0; i < abyInput.size(); ++i)
+            abyInput[i] = static_cast<GByte>((i * i) % 251);
+
+        const auto Compress = [&](const char *const *options)
+        {
+            void *out_buffer = nullptr;
+            size_t out_size = 0;
+            EXPECT_TRUE(pCompressor->pfnFunc(abyInput.data(), abyInput.size(),
+                                             &out_buffer, &out_size, options,
+                                             pCompressor->user_data));
+            std::vector<GByte> ret(static_cast<GByte *>(out_buffer),
+                                   static_cast<GByte *>(out_buffer) + out_size);
+            CPLFree(out_buffer);
+            return ret;
+        };
+
+        const char *const level1[] = {"LEVEL=1", nullptr};
+        const char *const level9[] = {"LEVEL=9", "CHECKSUM=YES", nullptr};
+        const auto first = Compress(level1);
+        const auto other = Compress(level9);
+        EXPECT_EQ(Compress(level1), first) << id;
+        EXPECT_EQ(Compress(level9), other) << id;
+
+        for (const auto *compressed : {&first, &other})
+        {
+            void *out_buffer = nullptr;
+            size_t out_size = 0;
+            ASSERT_TRUE(pDecompressor->pfnFunc(
+                compressed->data(), compressed->size(), &out_buffer,
+                &out_size, nullptr, pDecompressor->user_data));
+            ASSERT_EQ(out_size, abyInput.size());
+            EXPECT_TRUE(memcmp(out_buffer, abyInput.data(), out_size) == 0);
+            CPLFree(out_buffer);
+        }
+    }
+}
+
 template <class T> struct TesterDelta
 {
     static void test(const char *dtypeOption)
@@ -4292,6 +4487,76 @@ TEST_F(test_cpl, CPLQuadTree)
     CPLQuadTreeDestroy(hTree);
 }
 
+// Test CPLPackedRTree against a brute force search
+TEST_F(test_cpl, CPLPackedRTree)
+{
+    unsigned next = 0;
+    constexpr int MAX_RAND_VAL = 32767;
+    const auto DummyRand = [&]()
+    {
+        next = next * 1103515245 + 12345;
+        return ((unsigned)(next / 65536) % (MAX_RAND_VAL + 1));
+    };
+
+    const auto GenerateRandomRect = [&](CPLRectObj &rect, double dfMaxSize)
+    {
+        rect.minx = double(DummyRand()) / MAX_RAND_VAL;
+        rect.miny = double(DummyRand()) / MAX_RAND_VAL;
+        rect.maxx = rect.minx + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+        rect.maxy = rect.miny + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+    };
+
+    {
+        CPLPackedRTree oEmptyTree;
+        oEmptyTree.Build();
+        CPLRectObj rect = {0, 0, 1, 1};
+        EXPECT_FALSE(oEmptyTree.HasMatch(rect));
+    }
+
+    for (int nNodeSize : {2, 16, 64})
+    {
+        for (int nFeatures : {1, 16, 17, 1000})
+        {
+            CPLPackedRTree oTree(nNodeSize);
+            std::vector<CPLRectObj> aoRects(nFeatures);
+            for (int i = 0; i < nFeatures; i++)
+            {
+                GenerateRandomRect(aoRects[i], 0.05);
+                void *hFeature =
+                    reinterpret_cast<void *>(static_cast<uintptr_t>(i));
+                oTree.Insert(hFeature, aoRects[i]);
+            }
+            oTree.Build();
+            ASSERT_EQ(oTree.GetFeatureCount(), static_cast<size_t>(nFeatures));
+
+            std::vector<void *> apFeatures;
+            for (int iQuery = 0; iQuery < 100; ++iQuery)
+            {
+                CPLRectObj aoi;
+                GenerateRandomRect(aoi, 0.2);
+                std::vector<uintptr_t> anExpected;
+                for (int i = 0; i < nFeatures; i++)
+                {
+                    if (aoRects[i].minx <= aoi.maxx &&
+                        aoRects[i].maxx >= aoi.minx &&
+                        aoRects[i].miny <= aoi.maxy &&
+                        aoRects[i].maxy >= aoi.miny)
+                    {
+                        anExpected.push_back(i);
+                    }
+                }
+                oTree.Search(aoi, apFeatures);
+                std::vector<uintptr_t> anGot;
+                for (void *pFeature : apFeatures)
+                    anGot.push_back(reinterpret_cast<uintptr_t>(pFeature));
+                std::sort(anGot.begin(), anGot.end());
+                EXPECT_EQ(anGot, anExpected);
+                EXPECT_EQ(oTree.HasMatch(aoi), !anExpected.empty());
+            }
+        }
+    }
+}
+
 // Test bUnlinkAndSize on VSIGetMemFileBuffer
 TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
 {
@@ -4755,6 +5020,7 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
         Context *psCtxt;
         int iJob;
         GIntBig nThreadLambda = 0;
+        bool bDone = false;
 
         Data(Context *psCtxtIn, int iJobIn) : psCtxt(psCtxtIn), iJob(iJobIn)
         {
@@ -4792,31 +5058,42 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
             // CPL_FRMT_GIB "\n", iJob, nCounter, nThreadLambda2);
             if (iJob == 100 + 0)
             {
-                ASSERT_TRUE(nThreadLambda2 != psData2->nThreadLambda);
-                // make sure that job 0 run in the other thread
-                // takes sufficiently long that job 2 has been submitted
-                // before it completes
+                // make sure that job 0 takes sufficiently long that job 2
+                // has been submitted before it completes.
+                // It is queued asynchronously, as the other thread is idle.
+                // But it is queued in the deque of the submitting thread, so
+                // it is either stolen by the other thread, or run by the
+                // submitting thread itself when waiting for the job queue.
+                // Consequently we cannot check on which thread it runs, but
+                // only that it has run when the job queue is destroyed.
                 psData2->psCtxt->waitYouCanLeave();
             }
             else if (iJob == 100 + 1 || iJob == 100 + 2)
             {
+                // No thread is idle: run synchronously
                 ASSERT_TRUE(nThreadLambda2 == psData2->nThreadLambda);
             }
+            psData2->bDone = true;
         };
-        auto poQueue = psData->psCtxt->oThreadPool.CreateJobQueue();
         Data d0(*psData);
         d0.iJob = 100 + d0.iJob * 3 + 0;
         Data d1(*psData);
         d1.iJob = 100 + d1.iJob * 3 + 1;
         Data d2(*psData);
         d2.iJob = 100 + d2.iJob * 3 + 2;
-        poQueue->SubmitJob(lambda2, &d0);
-        poQueue->SubmitJob(lambda2, &d1);
-        poQueue->SubmitJob(lambda2, &d2);
-        if (psData->iJob == 0)
         {
-            psData->psCtxt->notifyYouCanLeave();
+            auto poQueue = psData->psCtxt->oThreadPool.CreateJobQueue();
+            poQueue->SubmitJob(lambda2, &d0);
+            poQueue->SubmitJob(lambda2, &d1);
+            poQueue->SubmitJob(lambda2, &d2);
+            if (psData->iJob == 0)
+            {
+                psData->psCtxt->notifyYouCanLeave();
+            }
         }
+        ASSERT_TRUE(d0.bDone);
+        ASSERT_TRUE(d1.bDone);
+        ASSERT_TRUE(d2.bDone);
     };
     {
         auto poQueue = ctxt.oThreadPool.CreateJobQueue();
@@ -4833,6 +5110,90 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test jobs submitting jobs to a job queue, and waiting for them on their
+// own condition variable instead of CPLJobQueue::WaitCompletion()
+TEST_F(test_cpl, CPLWorkerThreadPool_nested_job_queue_condition_variable)
+{
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(2, nullptr, nullptr));
+
+    std::atomic<int> nCounter{0};
+    const auto outerJob = [&nCounter, &oPool]()
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        int nDone = 0;
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < 3; ++i)
+        {
+            poQueue->SubmitJob(
+                [&nCounter, &mutex, &cv, &nDone]()
+                {
+                    nCounter++;
+                    std::lock_guard<std::mutex> oLock(mutex);
+                    nDone++;
+                    cv.notify_one();
+                });
+        }
+        {
+            std::unique_lock<std::mutex> oLock(mutex);
+            cv.wait(oLock, [&nDone] { return nDone == 3; });
+        }
+        poQueue->WaitCompletion();
+    };
+
+    auto poQueue = oPool.CreateJobQueue();
+    for (int i = 0; i < 8; ++i)
+        poQueue->SubmitJob(outerJob);
+    poQueue->WaitCompletion();
+    EXPECT_EQ(nCounter, 8 * 3);
+}
+
+// Test CPLJobQueue::WaitCompletion() from jobs submitting jobs
+TEST_F(test_cpl, CPLWorkerThreadPool_nested_job_queues)
+{
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(2, nullptr, nullptr));
+
+    std::atomic<int> nCounter{0};
+    const auto innerJob = [&nCounter, &oPool]()
+    {
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < 5; ++i)
+            poQueue->SubmitJob([&nCounter]() { nCounter++; });
+        poQueue->WaitCompletion();
+    };
+    const auto outerJob = [&innerJob, &oPool]()
+    {
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < 50; ++i)
+            poQueue->SubmitJob(innerJob);
+        while (poQueue->WaitEvent())
+        {
+        }
+    };
+
+    auto poQueue = oPool.CreateJobQueue();
+    for (int i = 0; i < 4; ++i)
+        poQueue->SubmitJob(outerJob);
+    poQueue->WaitCompletion();
+    EXPECT_EQ(nCounter, 4 * 50 * 5);
+
+    // Direct submissions to the pool from a job
+    nCounter = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        oPool.SubmitJob(
+            [&nCounter, &oPool]()
+            {
+                for (int j = 0; j < 10; ++j)
+                    oPool.SubmitJob([&nCounter]() { nCounter++; });
+            });
+    }
+    oPool.WaitCompletion();
+    EXPECT_EQ(nCounter, 4 * 10);
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -4890,6 +5251,64 @@ TEST_F(test_cpl, file_system_pread)
     VSIUnlink("temp_test_64.bin");
 }
 
+// Test /vsimem/ GetReadOnlyPointer() implementation
+TEST_F(test_cpl, vsimem_GetReadOnlyPointer)
+{
+    char szContent[] = "abcd";
+    VSILFILE *fp = VSIFileFromMemBuffer(
+        "", reinterpret_cast<GByte *>(szContent), 4, FALSE);
+    VSIVirtualHandle *poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(1, 2), szContent + 1);
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(0, 4), szContent);
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(4, 0), szContent + 4);
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(1, 4), nullptr);
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(5, 0), nullptr);
+    EXPECT_EQ(poHandle->Tell(), 0U);
+    VSIFCloseL(fp);
+}
+
+// Test regular file system GetReadOnlyPointer() implementation
+TEST_F(test_cpl, file_system_GetReadOnlyPointer)
+{
+    const std::string osFilename = CPLGenerateTempFilenameSafe(nullptr);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (fp == nullptr)
+        return;
+    VSIFWriteL("abcd", 1, 4, fp);
+    auto poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+    // Not available on writable handles
+    EXPECT_EQ(poHandle->GetReadOnlyPointer(0, 4), nullptr);
+    VSIFCloseL(fp);
+
+    fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+    const char *pszData =
+        static_cast<const char *>(poHandle->GetReadOnlyPointer(1, 3));
+    if (pszData)
+    {
+        EXPECT_EQ(std::string(pszData, 3), "bcd");
+        EXPECT_EQ(poHandle->GetReadOnlyPointer(2, 3), nullptr);
+
+        // Append to the file: the new content becomes available, and the
+        // previous pointer remains valid.
+        VSILFILE *fpAppend = VSIFOpenL(osFilename.c_str(), "ab");
+        ASSERT_NE(fpAppend, nullptr);
+        VSIFWriteL("ef", 1, 2, fpAppend);
+        VSIFCloseL(fpAppend);
+        const char *pszData2 =
+            static_cast<const char *>(poHandle->GetReadOnlyPointer(2, 4));
+        ASSERT_NE(pszData2, nullptr);
+        EXPECT_EQ(std::string(pszData2, 4), "cdef");
+        EXPECT_EQ(std::string(pszData, 3), "bcd");
+    }
+    char szBuffer[5] = {0};
+    EXPECT_EQ(VSIFReadL(szBuffer, 1, 4, fp), 4U);
+    EXPECT_EQ(std::string(szBuffer), "abcd");
+    VSIFCloseL(fp);
+    VSIUnlink(osFilename.c_str());
+}
+
 // Test CPLMask implementation
 TEST_F(test_cpl, CPLMask)
 {
@@ -4997,6 +5416,82 @@ TEST_F(test_cpl, ThreadSafeQueue)
     ASSERT_TRUE(queue.empty());
 }
 
+// Test cpl::LockFreeBoundedQueue
+TEST_F(test_cpl, LockFreeBoundedQueue)
+{
+    {
+        cpl::LockFreeBoundedQueue<int> queue(3);
+        ASSERT_EQ(queue.capacity(), 4U);
+        ASSERT_EQ(queue.size_approx(), 0U);
+        int val = 0;
+        ASSERT_FALSE(queue.try_pop(val));
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(queue.try_push(i));
+        }
+        ASSERT_FALSE(queue.try_push(4));
+        ASSERT_EQ(queue.size_approx(), 4U);
+        ASSERT_TRUE(queue.try_pop(val));
+        ASSERT_EQ(val, 0);
+        ASSERT_TRUE(queue.try_push(4));
+        for (int i = 1; i <= 4; ++i)
+        {
+            ASSERT_EQ(queue.pop(), i);
+        }
+        ASSERT_FALSE(queue.try_pop(val));
+    }
+
+    {
+        cpl::LockFreeBoundedQueue<std::string> queue(2);
+        std::string s("foo");
+        ASSERT_TRUE(queue.try_push(std::move(s)));
+        queue.push(std::string("bar"));
+        ASSERT_EQ(queue.pop(), "foo");
+        ASSERT_EQ(queue.pop(), "bar");
+    }
+
+    // Several producers and consumers
+    {
+        constexpr int PRODUCERS = 4;
+        constexpr int CONSUMERS = 4;
+        constexpr int VALUES_PER_PRODUCER = 10000;
+        cpl::LockFreeBoundedQueue<int> queue(64);
+        std::atomic<int64_t> nSum{0};
+        std::atomic<int> nCount{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < PRODUCERS; ++i)
+        {
+            threads.emplace_back(
+                [&queue]()
+                {
+                    for (int j = 1; j <= VALUES_PER_PRODUCER; ++j)
+                        queue.push(j);
+                });
+        }
+        for (int i = 0; i < CONSUMERS; ++i)
+        {
+            threads.emplace_back(
+                [&queue, &nSum, &nCount]()
+                {
+                    constexpr int VALUES_PER_CONSUMER =
+                        PRODUCERS * VALUES_PER_PRODUCER / CONSUMERS;
+                    for (int j = 0; j < VALUES_PER_CONSUMER; ++j)
+                    {
+                        nSum += queue.pop();
+                        ++nCount;
+                    }
+                });
+        }
+        for (auto &t : threads)
+            t.join();
+        EXPECT_EQ(nCount.load(), PRODUCERS * VALUES_PER_PRODUCER);
+        EXPECT_EQ(nSum.load(), static_cast<int64_t>(PRODUCERS) *
+                                   VALUES_PER_PRODUCER *
+                                   (VALUES_PER_PRODUCER + 1) / 2);
+        EXPECT_EQ(queue.size_approx(), 0U);
+    }
+}
+
 TEST_F(test_cpl, CPLGetExecPath)
 {
     std::vector<char> achBuffer(1024, 'x');
@@ -5967,4 +6462,163 @@ TEST_F(test_cpl, CPLGetRemainingFileDescriptorCount)
 #endif
 }
 
+TEST_F(test_cpl, CPLTrace)
+{
+    const char *pszFilename = "/vsimem/test_cpl_trace.bin";
+    {
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        ASSERT_NE(fp, nullptr);
+        EXPECT_EQ(VSIFWriteL("0123456789", 1, 10, fp), 10U);
+        VSIFCloseL(fp);
+    }
+
+    const auto ReadFile = [pszFilename]()
+    {
+        VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+        ASSERT_NE(fp, nullptr);
+        char abyBuffer[10];
+        EXPECT_EQ(VSIFReadL(abyBuffer, 1, 4, fp), 4U);
+        EXPECT_EQ(VSIFReadL(abyBuffer, 1, 10, fp), 6U);
+        VSIFCloseL(fp);
+    };
+
+    // Disabled: nothing recorded
+    {
+        CPLConfigOptionSetter oSetter("CPL_TRACE_ENABLED", "NO", false);
+        CPLTraceReset();
+        EXPECT_FALSE(CPLTraceIsEnabled());
+        ReadFile();
+        EXPECT_EQ(CPLTraceGetCounter(CPL_TRACE_COUNTER_VSI_READ_CALLS), 0);
+    }
+
+    {
+        CPLConfigOptionSetter oSetter("CPL_TRACE_ENABLED", "YES", false);
+        CPLTraceReset();
+        EXPECT_TRUE(CPLTraceIsEnabled());
+        ReadFile();
+        {
+            CPLTraceScope oTraceScope("my_span");
+        }
+        EXPECT_EQ(CPLTraceGetCounter(CPL_TRACE_COUNTER_VSI_READ_CALLS), 2);
+        EXPECT_EQ(CPLTraceGetCounter(CPL_TRACE_COUNTER_VSI_BYTES_READ), 10);
+        EXPECT_EQ(CPLTraceGetCounter(CPL_TRACE_COUNTER_COUNT), 0);
+
+        char *pszCounters = CPLTraceGetCountersAsSerializedJSON(nullptr);
+        ASSERT_NE(pszCounters, nullptr);
+        CPLJSONDocument oCountersDoc;
+        ASSERT_TRUE(oCountersDoc.LoadMemory(pszCounters));
+        CPLFree(pszCounters);
+        EXPECT_EQ(oCountersDoc.GetRoot().GetLong("vsi_bytes_read"), 10);
+
+        char *pszTrace = CPLTraceGetEventsAsChromeTraceJSON(nullptr);
+        ASSERT_NE(pszTrace, nullptr);
+        CPLJSONDocument oTraceDoc;
+        ASSERT_TRUE(oTraceDoc.LoadMemory(pszTrace));
+        CPLFree(pszTrace);
+        const auto oEvents = oTraceDoc.GetRoot().GetArray("traceEvents");
+        ASSERT_EQ(oEvents.Size(), 3);
+        EXPECT_EQ(oEvents[0].GetString("name"), "VSIFReadL");
+        EXPECT_EQ(oEvents[0].GetString("ph"), "X");
+        EXPECT_EQ(oEvents[2].GetString("name"), "my_span");
+        EXPECT_GE(oEvents[2].GetLong("dur"), 0);
+        EXPECT_EQ(
+            oTraceDoc.GetRoot().GetObj("otherData").GetLong("vsi_read_calls"),
+            2);
+    }
+
+    // Maximum number of events reached
+    {
+        CPLConfigOptionSetter oSetter("CPL_TRACE_ENABLED", "YES", false);
+        CPLConfigOptionSetter oSetterMax("CPL_TRACE_MAX_EVENTS", "1", false);
+        CPLTraceReset();
+        ReadFile();
+        EXPECT_EQ(CPLTraceGetCounter(CPL_TRACE_COUNTER_VSI_READ_CALLS), 2);
+        char *pszCounters = CPLTraceGetCountersAsSerializedJSON(nullptr);
+        CPLJSONDocument oCountersDoc;
+        ASSERT_TRUE(oCountersDoc.LoadMemory(pszCounters));
+        CPLFree(pszCounters);
+        EXPECT_EQ(oCountersDoc.GetRoot().GetLong("dropped_events"), 1);
+    }
+
+    CPLTraceReset();
+    VSIUnlink(pszFilename);
+}
+
+#ifdef __linux
+// Test that CPLGetNumCPUs() takes into account the CPU quota of the cgroup
+TEST_F(test_cpl, CPLGetNumCPUs_cgroup)
+{
+    const int nCPUsNoLimit = []()
+    {
+        CPLConfigOptionSetter oSetter("CPL_DEBUG_CGROUP_ROOT",
+                                      "/i_do/not/exist", false);
+        return CPLGetNumCPUs();
+    }();
+    if (nCPUsNoLimit < 3)
+    {
+        GTEST_SKIP() << "Test requires at least 3 CPUs";
+    }
+
+    const std::string osRoot = CPLGenerateTempFilenameSafe("cgroup");
+    const auto WriteFile =
+        [&osRoot](const std::string &osFilename, const char *pszContent)
+    {
+        const std::string osFullFilename = osRoot + osFilename;
+        ASSERT_EQ(
+            VSIMkdirRecursive(CPLGetPathSafe(osFullFilename.c_str()).c_str(),
+                              0755),
+            0);
+        VSILFILE *fp = VSIFOpenL(osFullFilename.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        VSIFWriteL(pszContent, 1, strlen(pszContent), fp);
+        VSIFCloseL(fp);
+    };
+    const auto GetNumCPUs = [&osRoot]()
+    {
+        CPLConfigOptionSetter oSetter("CPL_DEBUG_CGROUP_ROOT", osRoot.c_str(),
+                                      false);
+        return CPLGetNumCPUs();
+    };
+
+    // cgroup v1, with the quota of a Docker container set on the controller
+    // root
+    WriteFile("/proc/self/cgroup",
+              "12:memory:/docker/abcd\n4:cpuacct,cpu:/docker/abcd\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/abcd/cpu.cfs_quota_us", "-1\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/abcd/cpu.cfs_period_us", "100000\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/cpu.cfs_quota_us", "-1\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/cpu.cfs_period_us", "100000\n");
+    WriteFile("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "150000\n");
+    WriteFile("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "100000\n");
+    EXPECT_EQ(GetNumCPUs(), 2);
+
+    // cgroup v1, with a nested quota
+    WriteFile("/proc/self/cgroup", "4:cpu,cpuacct:/docker/abcd\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/abcd/cpu.cfs_quota_us", "50000\n");
+    EXPECT_EQ(GetNumCPUs(), 1);
+
+    // cgroup v1, without quota
+    WriteFile("/proc/self/cgroup", "4:cpu:/docker/abcd\n");
+    WriteFile("/sys/fs/cgroup/cpu/docker/abcd/cpu.cfs_quota_us", "-1\n");
+    WriteFile("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "-1\n");
+    EXPECT_EQ(GetNumCPUs(), nCPUsNoLimit);
+
+    // cgroup v2, without quota
+    WriteFile("/proc/self/cgroup", "0::/user.slice/app\n");
+    WriteFile("/sys/fs/cgroup/user.slice/app/cpu.max", "max 100000\n");
+    WriteFile("/sys/fs/cgroup/user.slice/cpu.max", "max 100000\n");
+    EXPECT_EQ(GetNumCPUs(), nCPUsNoLimit);
+
+    // cgroup v2, with a quota on the parent
+    WriteFile("/sys/fs/cgroup/user.slice/cpu.max", "200000 100000\n");
+    EXPECT_EQ(GetNumCPUs(), 2);
+
+    // cgroup v2, with a more restrictive quota on the child
+    WriteFile("/sys/fs/cgroup/user.slice/app/cpu.max", "100000 100000\n");
+    EXPECT_EQ(GetNumCPUs(), 1);
+
+    VSIRmdirRecursive(osRoot.c_str());
+}
+#endif
+
 }  // namespace
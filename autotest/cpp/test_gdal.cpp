@@ -20,11 +20,18 @@
 #include "tilematrixset.hpp"
 #include "gdalcachedpixelaccessor.h"
 #include "memdataset.h"
+#include "gdal_thread_pool.h"
+#include "gdal_proxy.h"
+#include "ogr_recordbatch.h"
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <future>
 #include <limits>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "test_data.h"
 
@@ -1741,6 +1748,74 @@ TEST_F(test_gdal, GDALExtendedDataType)
                   "{5000001568, 5000000512, 5000000000}, {31, 256, 2000}\n");
     }
 
+    // Test ProcessPerChunkMultiThreaded()
+    {
+        myArray ar(GDT_UInt16, {3000, 1000, 2000}, {32, 256, 128});
+        std::vector<GUInt64> array_start_idx{1500, 256, 0};
+        std::vector<GUInt64> count{99, 512, 2000};
+        const auto cs = ar.GetProcessingChunkSize(40 * 1000 * 1000);
+
+        std::vector<ChunkDef> chunkDefs;
+        EXPECT_TRUE(ar.ProcessPerChunk(array_start_idx.data(), count.data(),
+                                       cs.data(), TmpStruct::func, &chunkDefs));
+
+        struct TmpStructMT
+        {
+            std::mutex mutex{};
+            std::vector<ChunkDef> chunkDefs{};
+            GUInt64 nFailAtChunk = 0;
+
+            static bool func(GDALAbstractMDArray *p_ar,
+                             const GUInt64 *chunk_array_start_idx,
+                             const size_t *chunk_count, GUInt64 iCurChunk,
+                             GUInt64 nChunkCount, void *user_data)
+            {
+                auto self = static_cast<TmpStructMT *>(user_data);
+                if (iCurChunk == self->nFailAtChunk)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined, "failed");
+                    return false;
+                }
+                std::lock_guard oLock(self->mutex);
+                self->chunkDefs.resize(static_cast<size_t>(nChunkCount));
+                auto &chunkDef =
+                    self->chunkDefs[static_cast<size_t>(iCurChunk - 1)];
+                chunkDef.array_start_idx.assign(
+                    chunk_array_start_idx,
+                    chunk_array_start_idx + p_ar->GetDimensionCount());
+                chunkDef.count.assign(chunk_count,
+                                      chunk_count + p_ar->GetDimensionCount());
+                return true;
+            }
+        };
+
+        {
+            TmpStructMT oMT;
+            EXPECT_TRUE(ar.ProcessPerChunkMultiThreaded(
+                array_start_idx.data(), count.data(), cs.data(),
+                TmpStructMT::func, &oMT, 4));
+            ASSERT_EQ(oMT.chunkDefs.size(), chunkDefs.size());
+            for (size_t i = 0; i < chunkDefs.size(); ++i)
+            {
+                EXPECT_EQ(oMT.chunkDefs[i].array_start_idx,
+                          chunkDefs[i].array_start_idx);
+                EXPECT_EQ(oMT.chunkDefs[i].count, chunkDefs[i].count);
+            }
+        }
+
+        {
+            TmpStructMT oMT;
+            oMT.nFailAtChunk = 2;
+            CPLErrorReset();
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            EXPECT_FALSE(ar.ProcessPerChunkMultiThreaded(
+                array_start_idx.data(), count.data(), cs.data(),
+                TmpStructMT::func, &oMT, 4));
+            CPLPopErrorHandler();
+            EXPECT_STREQ(CPLGetLastErrorMsg(), "failed");
+        }
+    }
+
     {
         // Test with 0 in GetBlockSize()
         myArray ar(GDT_UInt16, {500, 1000, 2000}, {0, 0, 128});
@@ -3821,6 +3896,154 @@ TEST_F(test_gdal, GDALDeinterleave4ComponentsUInt16)
     VSIFree(panDest3);
 }
 
+// Test GDALDeinterleave with many components, for all element sizes
+TEST_F(test_gdal, GDALDeinterleaveManyComponents)
+{
+    for (GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32, GDT_Float64})
+    {
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        for (int nComponents : {2, 5, 224})
+        {
+            for (size_t nIters : {1, 17, 1000})
+            {
+                std::vector<double> adfSrc(nIters * nComponents);
+                for (size_t i = 0; i < adfSrc.size(); ++i)
+                    adfSrc[i] = static_cast<double>(i % 251);
+                std::vector<GByte> abySrc(adfSrc.size() * nDTSize);
+                GDALCopyWords64(adfSrc.data(), GDT_Float64, sizeof(double),
+                                abySrc.data(), eDT, nDTSize, adfSrc.size());
+
+                std::vector<std::vector<GByte>> aabyDst(nComponents);
+                std::vector<void *> apDst;
+                for (auto &abyDst : aabyDst)
+                {
+                    abyDst.resize(nIters * nDTSize);
+                    apDst.push_back(abyDst.data());
+                }
+                GDALDeinterleave(abySrc.data(), eDT, nComponents, apDst.data(),
+                                 eDT, nIters);
+
+                for (int iComp = 0; iComp < nComponents; ++iComp)
+                {
+                    std::vector<double> adfDst(nIters);
+                    GDALCopyWords64(apDst[iComp], eDT, nDTSize, adfDst.data(),
+                                    GDT_Float64, sizeof(double), nIters);
+                    for (size_t i = 0; i < nIters; ++i)
+                    {
+                        ASSERT_EQ(adfDst[i], adfSrc[i * nComponents + iComp])
+                            << GDALGetDataTypeName(eDT) << " " << nComponents
+                            << " " << nIters;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test GDALRasterBandGetWindowAsArrowTensor()
+TEST_F(test_gdal, GDALRasterBandGetWindowAsArrowTensor)
+{
+    const auto CheckTensor = [](const ArrowSchema &sSchema,
+                                const ArrowArray &sArray, int nXSize,
+                                int nYSize)
+    {
+        EXPECT_STREQ(sSchema.format,
+                     CPLSPrintf("+w:%d", nXSize * nYSize));
+        ASSERT_EQ(sSchema.n_children, 1);
+        EXPECT_STREQ(sSchema.children[0]->format, "C");
+        ASSERT_NE(sSchema.metadata, nullptr);
+        const std::string osMetadata(sSchema.metadata + sizeof(int32_t),
+                                     200);
+        EXPECT_NE(osMetadata.find("arrow.fixed_shape_tensor"),
+                  std::string::npos);
+        EXPECT_EQ(sArray.length, 1);
+        ASSERT_EQ(sArray.n_children, 1);
+        EXPECT_EQ(sArray.children[0]->length, nXSize * nYSize);
+    };
+
+    // Zero-copy from MEM memory
+    {
+        GDALDatasetUniquePtr poDS(
+            MEMDataset::Create("", 10, 5, 1, GDT_Byte, nullptr));
+        GByte *pabyData =
+            static_cast<GByte *>(poDS->GetInternalHandle("MEMORY1"));
+        for (int i = 0; i < 10 * 5; ++i)
+            pabyData[i] = static_cast<GByte>(i);
+        const char *const apszOptions[] = {"ALLOW_COPY=NO", nullptr};
+        ArrowSchema sSchema;
+        ArrowArray sArray;
+        ASSERT_TRUE(GDALRasterBandGetWindowAsArrowTensor(
+            GDALRasterBand::ToHandle(poDS->GetRasterBand(1)), 0, 1, 10, 3,
+            &sSchema, &sArray, apszOptions));
+        CheckTensor(sSchema, sArray, 10, 3);
+        EXPECT_EQ(sArray.children[0]->buffers[1], pabyData + 10);
+        sArray.release(&sArray);
+        sSchema.release(&sSchema);
+
+        // Lines not contiguous
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(GDALRasterBandGetWindowAsArrowTensor(
+            GDALRasterBand::ToHandle(poDS->GetRasterBand(1)), 1, 1, 5, 3,
+            &sSchema, &sArray, apszOptions));
+    }
+
+    auto hDrv = GDALGetDriverByName("GTiff");
+    if (!hDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    GDALDatasetUniquePtr poDS(
+        GDALDataset::Open(GCORE_DATA_DIR "byte.tif", GDAL_OF_RASTER));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+    std::vector<GByte> abyExpected(20 * 20);
+    ASSERT_EQ(poBand->RasterIO(GF_Read, 0, 0, 20, 20, abyExpected.data(), 20,
+                               20, GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    // Zero-copy from a block of the block cache
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    {
+        const char *const apszOptions[] = {"ALLOW_COPY=NO", nullptr};
+        ArrowSchema sSchema;
+        ArrowArray sArray;
+        ASSERT_TRUE(GDALRasterBandGetWindowAsArrowTensor(
+            GDALRasterBand::ToHandle(poBand), 0, 0, nBlockXSize, 1, &sSchema,
+            &sArray, apszOptions));
+        CheckTensor(sSchema, sArray, nBlockXSize, 1);
+        EXPECT_EQ(memcmp(sArray.children[0]->buffers[1], abyExpected.data(),
+                         nBlockXSize),
+                  0);
+        sArray.release(&sArray);
+        sSchema.release(&sSchema);
+    }
+
+    // Copy
+    {
+        ArrowSchema sSchema;
+        ArrowArray sArray;
+        ASSERT_TRUE(GDALRasterBandGetWindowAsArrowTensor(
+            GDALRasterBand::ToHandle(poBand), 1, 2, 3, 4, &sSchema, &sArray,
+            nullptr));
+        CheckTensor(sSchema, sArray, 3, 4);
+        const GByte *pabyData =
+            static_cast<const GByte *>(sArray.children[0]->buffers[1]);
+        for (int j = 0; j < 4; ++j)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                EXPECT_EQ(pabyData[j * 3 + i],
+                          abyExpected[(j + 2) * 20 + (i + 1)]);
+            }
+        }
+        sArray.release(&sArray);
+        sSchema.release(&sSchema);
+    }
+}
+
 // Test GDALDataset::ReportError()
 TEST_F(test_gdal, GDALDatasetReportError)
 {
@@ -6042,4 +6265,999 @@ TEST_F(test_gdal, GDALRasterBand_window_iterator)
     EXPECT_EQ(windows[8].nYSize, 600 - 512);
 }
 
+// Test GDALRasterBand::SetBlockCacheStreamingHint()
+TEST_F(test_gdal, GDALRasterBand_SetBlockCacheStreamingHint)
+{
+    class MyBand final : public GDALRasterBand
+    {
+      public:
+        explicit MyBand(int nSize)
+        {
+            nRasterXSize = nSize;
+            nRasterYSize = nSize;
+            nBlockXSize = 64;
+            nBlockYSize = 64;
+            eDataType = GDT_Byte;
+        }
+
+        CPLErr IReadBlock(int, int, void *pData) override
+        {
+            memset(pData, 1, 64 * 64);
+            return CE_None;
+        }
+    };
+
+    class MyDataset final : public GDALDataset
+    {
+      public:
+        explicit MyDataset(int nSize)
+        {
+            nRasterXSize = nSize;
+            nRasterYSize = nSize;
+            SetBand(1, std::make_unique<MyBand>(nSize));
+        }
+    };
+
+    // Room for about 32 blocks
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(32 * (64 * 64 + 2 * sizeof(GDALRasterBlock)));
+
+    MyDataset oHotDS(256);
+    MyDataset oStreamedDS(1024);
+    std::vector<GByte> abyBuffer(1024 * 1024);
+    GDALRasterBand *poHotBand = oHotDS.GetRasterBand(1);
+    EXPECT_EQ(poHotBand->RasterIO(GF_Read, 0, 0, 256, 256, abyBuffer.data(),
+                                  256, 256, GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    GDALRasterBand *poStreamedBand = oStreamedDS.GetRasterBand(1);
+    EXPECT_FALSE(poStreamedBand->GetBlockCacheStreamingHint());
+    GDALSetRasterBlockCacheStreamingHint(
+        GDALRasterBand::ToHandle(poStreamedBand), true);
+    EXPECT_TRUE(poStreamedBand->GetBlockCacheStreamingHint());
+    EXPECT_EQ(poStreamedBand->RasterIO(GF_Read, 0, 0, 1024, 1024,
+                                       abyBuffer.data(), 1024, 1024, GDT_Byte,
+                                       0, 0, nullptr),
+              CE_None);
+
+    // Reading the streamed band must not have evicted the blocks of the
+    // hot band.
+    for (int iY = 0; iY < 4; ++iY)
+    {
+        for (int iX = 0; iX < 4; ++iX)
+        {
+            GDALRasterBlock *poBlock = poHotBand->TryGetLockedBlockRef(iX, iY);
+            EXPECT_NE(poBlock, nullptr) << iX << " " << iY;
+            if (poBlock)
+                poBlock->DropLock();
+        }
+    }
+
+    oHotDS.FlushCache(false);
+    oStreamedDS.FlushCache(false);
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDALDataset::SetBlockCacheMax() and GetBlockCacheStatistics()
+TEST_F(test_gdal, GDALDataset_SetBlockCacheMax)
+{
+    class MyBand final : public GDALRasterBand
+    {
+      public:
+        explicit MyBand(int nSize)
+        {
+            nRasterXSize = nSize;
+            nRasterYSize = nSize;
+            nBlockXSize = 64;
+            nBlockYSize = 64;
+            eDataType = GDT_Byte;
+        }
+
+        CPLErr IReadBlock(int, int, void *pData) override
+        {
+            memset(pData, 1, 64 * 64);
+            return CE_None;
+        }
+    };
+
+    class MyDataset final : public GDALDataset
+    {
+      public:
+        explicit MyDataset(int nSize)
+        {
+            nRasterXSize = nSize;
+            nRasterYSize = nSize;
+            SetBand(1, std::make_unique<MyBand>(nSize));
+        }
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(100 * 1024 * 1024);
+
+    GDALBlockCacheStatistics sGlobalStatsBefore;
+    GDALGetCacheStatistics(&sGlobalStatsBefore);
+
+    {
+        CPLConfigOptionSetter oSetter("GDAL_DATASET_CACHEMAX", "1MB", false);
+        MyDataset oDS(64);
+        EXPECT_EQ(oDS.GetBlockCacheMax(), 1024 * 1024);
+    }
+
+    {
+        MyDataset oDS(64);
+        // The configuration option is only read when the quota is needed
+        CPLConfigOptionSetter oSetter("GDAL_DATASET_CACHEMAX", "2MB", false);
+        EXPECT_EQ(oDS.GetBlockCacheMax(), 2 * 1024 * 1024);
+    }
+
+    MyDataset oOtherDS(256);
+    MyDataset oDS(1024);
+    EXPECT_EQ(oDS.GetBlockCacheMax(), 0);
+    // Room for about 8 blocks
+    const GIntBig nQuota = 8 * (64 * 64 + 2 * sizeof(GDALRasterBlock));
+    GDALDatasetSetCacheMax(GDALDataset::ToHandle(&oDS), nQuota);
+    EXPECT_EQ(GDALDatasetGetCacheMax(GDALDataset::ToHandle(&oDS)), nQuota);
+
+    std::vector<GByte> abyBuffer(1024 * 1024);
+    EXPECT_EQ(oOtherDS.GetRasterBand(1)->RasterIO(GF_Read, 0, 0, 256, 256,
+                                                  abyBuffer.data(), 256, 256,
+                                                  GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    EXPECT_EQ(oDS.GetRasterBand(1)->RasterIO(GF_Read, 0, 0, 1024, 1024,
+                                             abyBuffer.data(), 1024, 1024,
+                                             GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    GDALBlockCacheStatistics sStats;
+    GDALDatasetGetCacheStatistics(GDALDataset::ToHandle(&oDS), &sStats);
+    EXPECT_EQ(sStats.nHits, 0U);
+    EXPECT_EQ(sStats.nMisses, 16U * 16U);
+    EXPECT_GE(sStats.nEvictions, 16U * 16U - 8U);
+    EXPECT_EQ(sStats.nDirtyFlushes, 0U);
+    EXPECT_GT(sStats.nCacheUsed, 0);
+    EXPECT_LE(sStats.nCacheUsed, nQuota);
+
+    // The quota of oDS must not have caused eviction of blocks of oOtherDS
+    EXPECT_EQ(oOtherDS.GetRasterBand(1)->RasterIO(GF_Read, 0, 0, 256, 256,
+                                                  abyBuffer.data(), 256, 256,
+                                                  GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    oOtherDS.GetBlockCacheStatistics(&sStats);
+    EXPECT_EQ(sStats.nHits, 4U * 4U);
+    EXPECT_EQ(sStats.nMisses, 4U * 4U);
+    EXPECT_EQ(sStats.nEvictions, 0U);
+
+    GDALBlockCacheStatistics sGlobalStats;
+    GDALGetCacheStatistics(&sGlobalStats);
+    EXPECT_GE(sGlobalStats.nHits, sGlobalStatsBefore.nHits + 4 * 4);
+    EXPECT_GE(sGlobalStats.nMisses,
+              sGlobalStatsBefore.nMisses + 4 * 4 + 16 * 16);
+    EXPECT_GE(sGlobalStats.nCacheUsed, sStats.nCacheUsed);
+
+    oOtherDS.FlushCache(false);
+    oDS.FlushCache(false);
+    oDS.GetBlockCacheStatistics(&sStats);
+    EXPECT_EQ(sStats.nCacheUsed, 0);
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDAL_CACHE_DIRTY_RATIO
+TEST_F(test_gdal, GDAL_CACHE_DIRTY_RATIO)
+{
+    class MyBand final : public GDALRasterBand
+    {
+      public:
+        int m_nWrittenBlocks = 0;
+        bool m_bAllWrittenBlocksValid = true;
+
+        MyBand()
+        {
+            nRasterXSize = 1024;
+            nRasterYSize = 1024;
+            nBlockXSize = 64;
+            nBlockYSize = 64;
+            eDataType = GDT_Byte;
+        }
+
+        CPLErr IReadBlock(int, int, void *pData) override
+        {
+            memset(pData, 0, 64 * 64);
+            return CE_None;
+        }
+
+        CPLErr IWriteBlock(int, int, void *pData) override
+        {
+            ++m_nWrittenBlocks;
+            const GByte *pabyData = static_cast<const GByte *>(pData);
+            for (int i = 0; i < 64 * 64; ++i)
+            {
+                if (pabyData[i] != 1)
+                    m_bAllWrittenBlocksValid = false;
+            }
+            return CE_None;
+        }
+    };
+
+    class MyDataset final : public GDALDataset
+    {
+      public:
+        MyDataset()
+        {
+            nRasterXSize = 1024;
+            nRasterYSize = 1024;
+            SetBand(1, std::make_unique<MyBand>());
+        }
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(4 * 1024 * 1024);
+
+    std::vector<GByte> abyBuffer(1024 * 1024, 1);
+    for (const char *pszRatio : {"", "0.1"})
+    {
+        CPLConfigOptionSetter oSetter("GDAL_CACHE_DIRTY_RATIO",
+                                      pszRatio[0] ? pszRatio : nullptr, false);
+        MyDataset oDS;
+        auto poBand = cpl::down_cast<MyBand *>(oDS.GetRasterBand(1));
+        EXPECT_EQ(poBand->RasterIO(GF_Write, 0, 0, 1024, 1024,
+                                   abyBuffer.data(), 1024, 1024, GDT_Byte, 0,
+                                   0, nullptr),
+                  CE_None);
+
+        // The whole dataset fits in the cache, so nothing is evicted
+        GDALBlockCacheStatistics sStats;
+        oDS.GetBlockCacheStatistics(&sStats);
+        EXPECT_EQ(sStats.nEvictions, 0U);
+        if (pszRatio[0])
+        {
+            // Dirty blocks above 10% of the cache (about 100 blocks) have
+            // been written back
+            EXPECT_GT(poBand->m_nWrittenBlocks, 0);
+            EXPECT_LT(poBand->m_nWrittenBlocks, 16 * 16);
+        }
+        else
+        {
+            EXPECT_EQ(poBand->m_nWrittenBlocks, 0);
+        }
+        EXPECT_EQ(sStats.nDirtyFlushes,
+                  static_cast<GUIntBig>(poBand->m_nWrittenBlocks));
+
+        // Written back blocks are still in the cache, but clean, so
+        // FlushCache() writes each block exactly once.
+        EXPECT_EQ(oDS.FlushCache(false), CE_None);
+        EXPECT_EQ(poBand->m_nWrittenBlocks, 16 * 16);
+        EXPECT_TRUE(poBand->m_bAllWrittenBlocksValid);
+    }
+
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+// Test GDALReserveThreads()
+TEST_F(test_gdal, GDALReserveThreads)
+{
+    CPLConfigOptionSetter oSetter("GDAL_MAX_THREADS", "4", false);
+    EXPECT_EQ(GDALGetThreadBudget(), 4);
+    EXPECT_EQ(GDALReserveThreads(1), 1);
+    {
+        GDALThreadReservation oReservation(3);
+        EXPECT_EQ(oReservation.GetThreadCount(), 3);
+        {
+            // Only one thread left: not worth reserving it
+            GDALThreadReservation oNested(8);
+            EXPECT_EQ(oNested.GetThreadCount(), 1);
+        }
+    }
+    {
+        GDALThreadReservation oReservation(8);
+        EXPECT_EQ(oReservation.GetThreadCount(), 4);
+    }
+    const int nThreads = GDALReserveThreads(2);
+    EXPECT_EQ(nThreads, 2);
+    EXPECT_EQ(GDALReserveThreads(2), 2);
+    EXPECT_EQ(GDALReserveThreads(2), 1);
+    GDALReleaseThreads(nThreads);
+    GDALReleaseThreads(nThreads);
+    EXPECT_EQ(GDALReserveThreads(4), 4);
+    GDALReleaseThreads(4);
+}
+
+// Test multithreaded GDALDataset::BlockBasedRasterIO()
+TEST_F(test_gdal, BlockBasedRasterIO_multithreaded)
+{
+    if (!GDALGetDriverByName("GTiff"))
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *tmpFilename = "/vsimem/test_block_based_rasterio_mt.tif";
+    {
+        auto poDrv = GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
+        const char *const apszOptions[] = {"INTERLEAVE=PIXEL",
+                                           "BLOCKYSIZE=3", nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(
+            poDrv->Create(tmpFilename, 17, 31, 3, GDT_UInt16,
+                          const_cast<char **>(apszOptions)));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GUInt16> anData(17 * 31 * 3);
+        for (size_t i = 0; i < anData.size(); ++i)
+            anData[i] = static_cast<GUInt16>(i);
+        ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, 17, 31, anData.data(), 17, 31,
+                                 GDT_UInt16, 3, nullptr, 0, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(tmpFilename));
+    ASSERT_TRUE(poDS != nullptr);
+    std::vector<GUInt16> anRef(15 * 26 * 3);
+    ASSERT_EQ(poDS->RasterIO(GF_Read, 1, 2, 15, 26, anRef.data(), 15, 26,
+                             GDT_UInt16, 3, nullptr, 3 * sizeof(GUInt16),
+                             0, sizeof(GUInt16), nullptr),
+              CE_None);
+    poDS->FlushCache(false);
+
+    {
+        CPLConfigOptionSetter oSetter("GDAL_RASTERIO_NUM_THREADS", "4", false);
+        std::vector<GUInt16> anData(15 * 26 * 3);
+        ASSERT_EQ(poDS->RasterIO(GF_Read, 1, 2, 15, 26, anData.data(), 15, 26,
+                                 GDT_UInt16, 3, nullptr, 3 * sizeof(GUInt16),
+                                 0, sizeof(GUInt16), nullptr),
+                  CE_None);
+        EXPECT_EQ(anData, anRef);
+    }
+
+    poDS.reset();
+    VSIUnlink(tmpFilename);
+}
+
+// Test GDAL_RASTERIO_DIRECT_DECODE
+TEST_F(test_gdal, RasterIO_direct_decode)
+{
+    if (!GDALGetDriverByName("GTiff"))
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *tmpFilename = "/vsimem/test_rasterio_direct_decode.tif";
+    std::vector<GUInt16> anData(40 * 50);
+    for (size_t i = 0; i < anData.size(); ++i)
+        anData[i] = static_cast<GUInt16>(i);
+    {
+        auto poDrv = GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
+        const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                           "BLOCKYSIZE=16", "COMPRESS=LZW",
+                                           nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(
+            poDrv->Create(tmpFilename, 40, 50, 1, GDT_UInt16,
+                          const_cast<char **>(apszOptions)));
+        ASSERT_TRUE(poDS != nullptr);
+        ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(
+                      GF_Write, 0, 0, 40, 50, anData.data(), 40, 50,
+                      GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    CPLConfigOptionSetter oSetter("GDAL_RASTERIO_DIRECT_DECODE", "YES", false);
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(tmpFilename, GDAL_OF_UPDATE));
+    ASSERT_TRUE(poDS != nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+
+    // Modify a block in the block cache, without flushing it
+    {
+        GUInt16 nVal = 65535;
+        ASSERT_EQ(poBand->RasterIO(GF_Write, 17, 33, 1, 1, &nVal, 1, 1,
+                                   GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+        anData[33 * 40 + 17] = nVal;
+    }
+
+    std::vector<GUInt16> anBuf(16 * 32);
+    ASSERT_EQ(poBand->RasterIO(GF_Read, 16, 16, 16, 32, anBuf.data(), 16, 32,
+                               GDT_UInt16, 0, 0, nullptr),
+              CE_None);
+    for (int j = 0; j < 32; ++j)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(anBuf[j * 16 + i], anData[(16 + j) * 40 + 16 + i]);
+        }
+    }
+    // Only the modified block is in the block cache
+    EXPECT_TRUE(poBand->TryGetLockedBlockRef(1, 1) == nullptr);
+    GDALRasterBlock *poBlock = poBand->TryGetLockedBlockRef(1, 2);
+    EXPECT_TRUE(poBlock != nullptr);
+    if (poBlock)
+        poBlock->DropLock();
+
+    poDS.reset();
+    VSIUnlink(tmpFilename);
+}
+
+// Test GDALRasterBand::PrefetchBlocks()
+TEST_F(test_gdal, GDALRasterBand_PrefetchBlocks)
+{
+    if (!GDALGetDriverByName("GTiff"))
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    GDALDatasetUniquePtr poSrcDS(
+        GDALDataset::Open(GCORE_DATA_DIR "byte.tif"));
+    ASSERT_TRUE(poSrcDS != nullptr);
+    std::vector<GByte> abyRef(20 * 20);
+    ASSERT_EQ(poSrcDS->GetRasterBand(1)->RasterIO(GF_Read, 0, 0, 20, 20,
+                                                  abyRef.data(), 20, 20,
+                                                  GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    const char *tmpFilename = "/vsimem/test_prefetch_blocks.tif";
+    auto poDrv = GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
+    const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                       "BLOCKYSIZE=16", nullptr};
+    GDALDatasetUniquePtr(
+        poDrv->CreateCopy(tmpFilename, poSrcDS.get(), false,
+                          const_cast<char **>(apszOptions), nullptr, nullptr));
+
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(tmpFilename));
+        ASSERT_TRUE(poDS != nullptr);
+        GDALRasterBand *poBand = poDS->GetRasterBand(1);
+
+        {
+            CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+            EXPECT_EQ(poBand->PrefetchBlocks(0, 0, 21, 20).get(), CE_Failure);
+        }
+
+        ASSERT_EQ(poBand->PrefetchBlocks(0, 0, 20, 20).get(), CE_None);
+        std::vector<GByte> abyBuffer(20 * 20);
+        ASSERT_EQ(poBand->RasterIO(GF_Read, 0, 0, 20, 20, abyBuffer.data(), 20,
+                                   20, GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(abyBuffer, abyRef);
+
+        // Blocks already in the cache are not scheduled again
+        EXPECT_EQ(poBand->PrefetchBlocks(0, 0, 20, 20).get(), CE_None);
+
+        // Prefetched blocks are discarded by FlushCache()
+        poBand->FlushCache(false);
+        EXPECT_EQ(GDALRasterPrefetchBlocks(GDALRasterBand::ToHandle(poBand), 0,
+                                           0, 20, 20),
+                  CE_None);
+        poBand->FlushCache(false);
+        EXPECT_EQ(poBand->TryGetLockedBlockRef(0, 0), nullptr);
+
+        // Datasets destroyed with prefetching in progress
+        poBand->PrefetchBlocks(0, 0, 20, 20);
+    }
+
+    // Datasets that cannot be re-opened are read synchronously
+    {
+        GDALDatasetUniquePtr poDS(
+            MEMDataset::Create("", 20, 20, 1, GDT_Byte, nullptr));
+        GDALRasterBand *poBand = poDS->GetRasterBand(1);
+        auto oFuture = poBand->PrefetchBlocks(0, 0, 20, 20);
+        ASSERT_EQ(oFuture.wait_for(std::chrono::seconds(0)),
+                  std::future_status::ready);
+        EXPECT_EQ(oFuture.get(), CE_None);
+    }
+
+    VSIUnlink(tmpFilename);
+}
+
+// Test GDALDataset::ComputeStatistics()
+TEST_F(test_gdal, GDALDataset_ComputeStatistics)
+{
+    constexpr int nXSize = 300;
+    constexpr int nYSize = 200;
+    const GDALDataType aeTypes[] = {GDT_Byte, GDT_UInt16, GDT_Float32};
+    auto poDS = std::unique_ptr<GDALDataset>(
+        MEMDataset::Create("", nXSize, nYSize, 0, GDT_Byte, nullptr));
+    for (const auto eDT : aeTypes)
+        poDS->AddBand(eDT, nullptr);
+    std::vector<double> adfValues(static_cast<size_t>(nXSize) * nYSize);
+    for (size_t i = 0; i < adfValues.size(); ++i)
+        adfValues[i] = static_cast<double>((i * 37 + i / 7) % 251);
+    for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+    {
+        ASSERT_EQ(poDS->GetRasterBand(i)->RasterIO(
+                      GF_Write, 0, 0, nXSize, nYSize, adfValues.data(), nXSize,
+                      nYSize, GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+    }
+    poDS->GetRasterBand(1)->SetNoDataValue(0);
+    poDS->GetRasterBand(3)->SetNoDataValue(10);
+    const int anOverviews[] = {2, 4};
+    ASSERT_EQ(poDS->BuildOverviews("AVERAGE", 2, anOverviews, 0, nullptr,
+                                   nullptr, nullptr, nullptr),
+              CE_None);
+
+    const char *const apszOptions[] = {"HISTOGRAM=YES", "CHECKSUM=YES",
+                                       "NUM_THREADS=4", nullptr};
+    ASSERT_EQ(GDALDatasetComputeStatistics(GDALDataset::ToHandle(poDS.get()),
+                                           0, nullptr, apszOptions, nullptr,
+                                           nullptr),
+              CE_None);
+
+    for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+    {
+        auto poBand = poDS->GetRasterBand(i);
+        std::vector<GDALRasterBand *> apoBands{poBand};
+        for (int iOvr = 0; iOvr < poBand->GetOverviewCount(); ++iOvr)
+            apoBands.push_back(poBand->GetOverview(iOvr));
+        for (auto *poLevelBand : apoBands)
+        {
+            double dfMin = 0, dfMax = 0, dfMean = 0, dfStdDev = 0;
+            ASSERT_EQ(poLevelBand->GetStatistics(FALSE, FALSE, &dfMin, &dfMax,
+                                                 &dfMean, &dfStdDev),
+                      CE_None);
+            const std::string osValidPercent =
+                poLevelBand->GetMetadataItem("STATISTICS_VALID_PERCENT");
+            const char *pszChecksum =
+                poLevelBand->GetMetadataItem("STATISTICS_CHECKSUM");
+            ASSERT_NE(pszChecksum, nullptr);
+            EXPECT_EQ(atoi(pszChecksum),
+                      GDALChecksumImage(GDALRasterBand::ToHandle(poLevelBand),
+                                        0, 0, poLevelBand->GetXSize(),
+                                        poLevelBand->GetYSize()));
+
+            double dfRefMin = 0, dfRefMax = 0, dfRefMean = 0, dfRefStdDev = 0;
+            ASSERT_EQ(poLevelBand->ComputeStatistics(FALSE, &dfRefMin,
+                                                     &dfRefMax, &dfRefMean,
+                                                     &dfRefStdDev, nullptr,
+                                                     nullptr),
+                      CE_None);
+            EXPECT_EQ(dfMin, dfRefMin);
+            EXPECT_EQ(dfMax, dfRefMax);
+            EXPECT_NEAR(dfMean, dfRefMean, 1e-8);
+            EXPECT_NEAR(dfStdDev, dfRefStdDev, 1e-8);
+            EXPECT_STREQ(osValidPercent.c_str(),
+                         poLevelBand->GetMetadataItem(
+                             "STATISTICS_VALID_PERCENT"));
+        }
+
+        if (poBand->GetRasterDataType() == GDT_Byte)
+        {
+            double dfHistMin = 0, dfHistMax = 0;
+            int nBuckets = 0;
+            GUIntBig *panHistogram = nullptr;
+            ASSERT_EQ(poBand->GetDefaultHistogram(&dfHistMin, &dfHistMax,
+                                                  &nBuckets, &panHistogram,
+                                                  FALSE, nullptr, nullptr),
+                      CE_None);
+            ASSERT_EQ(nBuckets, 256);
+            std::vector<GUIntBig> anRefHistogram(256);
+            ASSERT_EQ(poBand->GetHistogram(-0.5, 255.5, 256,
+                                           anRefHistogram.data(), TRUE, FALSE,
+                                           nullptr, nullptr),
+                      CE_None);
+            EXPECT_EQ(std::vector<GUIntBig>(panHistogram, panHistogram + 256),
+                      anRefHistogram);
+            CPLFree(panHistogram);
+        }
+    }
+
+    // Invalid band number
+    {
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        const int nBand = 4;
+        EXPECT_EQ(poDS->ComputeStatistics(1, &nBand, nullptr, nullptr, nullptr),
+                  CE_Failure);
+    }
+}
+
+// Test GDALDataset::ComputeHistograms() and GDALRasterBand::GetHistogram()
+TEST_F(test_gdal, GDALDataset_ComputeHistograms)
+{
+    // Large enough for the lookup table of UInt16 values to be used
+    constexpr int nXSize = 600;
+    constexpr int nYSize = 500;
+    std::vector<double> adfValues(static_cast<size_t>(nXSize) * nYSize);
+    for (size_t i = 0; i < adfValues.size(); ++i)
+        adfValues[i] = static_cast<double>((i * 37 + i / 7) % 251) / 3;
+
+    constexpr double dfMin = -0.5;
+    constexpr double dfMax = 60;
+    constexpr int nBuckets = 50;
+
+    const auto ComputeReference = [](GDALRasterBand *poBand,
+                                     bool bIncludeOutOfRange)
+    {
+        std::vector<double> adfBandValues(static_cast<size_t>(nXSize) *
+                                          nYSize);
+        EXPECT_EQ(poBand->RasterIO(GF_Read, 0, 0, nXSize, nYSize,
+                                   adfBandValues.data(), nXSize, nYSize,
+                                   GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+        int bHasNoData = false;
+        const double dfNoData = poBand->GetNoDataValue(&bHasNoData);
+        std::vector<GUIntBig> anHistogram(nBuckets);
+        for (const double dfValue : adfBandValues)
+        {
+            if (bHasNoData && dfValue == dfNoData)
+                continue;
+            int iBucket = static_cast<int>(
+                std::floor((dfValue - dfMin) * (nBuckets / (dfMax - dfMin))));
+            if (iBucket < 0 || iBucket >= nBuckets)
+            {
+                if (!bIncludeOutOfRange)
+                    continue;
+                iBucket = std::clamp(iBucket, 0, nBuckets - 1);
+            }
+            ++anHistogram[iBucket];
+        }
+        return anHistogram;
+    };
+
+    // Bands of different types, and a pixel-interleaved dataset
+    const char *const apszPixelInterleaved[] = {"INTERLEAVE=PIXEL", nullptr};
+    for (const bool bPixelInterleaved : {false, true})
+    {
+        std::unique_ptr<GDALDataset> poDS;
+        if (bPixelInterleaved)
+        {
+            poDS.reset(MEMDataset::Create("", nXSize, nYSize, 3, GDT_Byte,
+                                          const_cast<char **>(
+                                              apszPixelInterleaved)));
+        }
+        else
+        {
+            poDS.reset(
+                MEMDataset::Create("", nXSize, nYSize, 0, GDT_Byte, nullptr));
+            for (const auto eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+                poDS->AddBand(eDT, nullptr);
+        }
+        for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+        {
+            ASSERT_EQ(poDS->GetRasterBand(i)->RasterIO(
+                          GF_Write, 0, 0, nXSize, nYSize, adfValues.data(),
+                          nXSize, nYSize, GDT_Float64, 0, 0, nullptr),
+                      CE_None);
+        }
+        poDS->GetRasterBand(1)->SetNoDataValue(0);
+        poDS->GetRasterBand(3)->SetNoDataValue(10);
+
+        const int nBands = poDS->GetRasterCount();
+        for (const int bIncludeOutOfRange : {FALSE, TRUE})
+        {
+            std::vector<GUIntBig> anHistograms(
+                static_cast<size_t>(nBands) * nBuckets);
+            const char *const apszOptions[] = {"NUM_THREADS=4", nullptr};
+            ASSERT_EQ(GDALDatasetComputeHistograms(
+                          GDALDataset::ToHandle(poDS.get()), 0, nullptr,
+                          dfMin, dfMax, nBuckets, anHistograms.data(),
+                          bIncludeOutOfRange, apszOptions, nullptr, nullptr),
+                      CE_None);
+
+            for (int i = 1; i <= nBands; ++i)
+            {
+                auto poBand = poDS->GetRasterBand(i);
+                const auto anRefHistogram =
+                    ComputeReference(poBand, CPL_TO_BOOL(bIncludeOutOfRange));
+                EXPECT_EQ(std::vector<GUIntBig>(
+                              anHistograms.begin() + (i - 1) * nBuckets,
+                              anHistograms.begin() + i * nBuckets),
+                          anRefHistogram)
+                    << i;
+
+                for (const char *pszThreads : {"1", "4"})
+                {
+                    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS",
+                                                  pszThreads, false);
+                    std::vector<GUIntBig> anHistogram(nBuckets);
+                    ASSERT_EQ(poBand->GetHistogram(
+                                  dfMin, dfMax, nBuckets, anHistogram.data(),
+                                  bIncludeOutOfRange, FALSE, nullptr,
+                                  nullptr),
+                              CE_None);
+                    EXPECT_EQ(anHistogram, anRefHistogram) << i;
+                }
+            }
+        }
+
+        // Invalid band number
+        {
+            CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+            const int nBand = nBands + 1;
+            std::vector<GUIntBig> anHistogram(nBuckets);
+            EXPECT_EQ(poDS->ComputeHistograms(1, &nBand, dfMin, dfMax,
+                                              nBuckets, anHistogram.data(),
+                                              FALSE, nullptr, nullptr,
+                                              nullptr),
+                      CE_Failure);
+        }
+    }
+}
+
+// Test that GDALRasterBand::ComputeStatistics() and ComputeRasterMinMax()
+// give the same results whatever the value of GDAL_NUM_THREADS
+TEST_F(test_gdal, GDALRasterBand_ComputeStatistics_multithreaded)
+{
+    auto poDrv = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDrv)
+    {
+        GTEST_SKIP() << "MEM driver missing";
+    }
+    constexpr int nXSize = 253;
+    constexpr int nYSize = 301;
+    const GDALDataType aeTypes[] = {GDT_Byte, GDT_UInt16, GDT_Int16,
+                                    GDT_Float32, GDT_Float64};
+    std::unique_ptr<GDALDataset> poDS(
+        poDrv->Create("", nXSize, nYSize, 0, GDT_Byte, nullptr));
+    ASSERT_NE(poDS, nullptr);
+    std::vector<double> adfValues(static_cast<size_t>(nXSize) * nYSize);
+    for (size_t i = 0; i < adfValues.size(); ++i)
+        adfValues[i] = static_cast<double>((i * 37 + i / 7) % 251) / 3;
+    for (const auto eType : aeTypes)
+    {
+        ASSERT_EQ(poDS->AddBand(eType, nullptr), CE_None);
+        auto poBand = poDS->GetRasterBand(poDS->GetRasterCount());
+        ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, nXSize, nYSize,
+                                   adfValues.data(), nXSize, nYSize,
+                                   GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+        if (eType != GDT_Float64)
+            poBand->SetNoDataValue(10);
+    }
+    // Float64 band with a mask band
+    {
+        auto poBand = poDS->GetRasterBand(poDS->GetRasterCount());
+        ASSERT_EQ(poBand->CreateMaskBand(0), CE_None);
+        std::vector<GByte> abyMask(adfValues.size());
+        for (size_t i = 0; i < abyMask.size(); ++i)
+            abyMask[i] = (i % 13) == 0 ? 0 : 255;
+        ASSERT_EQ(poBand->GetMaskBand()->RasterIO(
+                      GF_Write, 0, 0, nXSize, nYSize, abyMask.data(), nXSize,
+                      nYSize, GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+    {
+        auto poBand = poDS->GetRasterBand(i);
+        for (const int bApproxOK : {FALSE, TRUE})
+        {
+            double adfRefStats[4] = {0, 0, 0, 0};
+            double adfRefMinMax[2] = {0, 0};
+            std::string osRefValidPercent;
+            for (const char *pszThreads : {"1", "4"})
+            {
+                CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", pszThreads,
+                                              false);
+                double adfStats[4] = {0, 0, 0, 0};
+                ASSERT_EQ(poBand->ComputeStatistics(
+                              bApproxOK, &adfStats[0], &adfStats[1],
+                              &adfStats[2], &adfStats[3], nullptr, nullptr),
+                          CE_None);
+                double adfMinMax[2] = {0, 0};
+                ASSERT_EQ(poBand->ComputeRasterMinMax(bApproxOK, adfMinMax),
+                          CE_None);
+                const char *pszValidPercent =
+                    poBand->GetMetadataItem("STATISTICS_VALID_PERCENT");
+                ASSERT_NE(pszValidPercent, nullptr);
+                if (EQUAL(pszThreads, "1"))
+                {
+                    std::copy(std::begin(adfStats), std::end(adfStats),
+                              adfRefStats);
+                    std::copy(std::begin(adfMinMax), std::end(adfMinMax),
+                              adfRefMinMax);
+                    osRefValidPercent = pszValidPercent;
+                }
+                else
+                {
+                    // Results must be bit-identical
+                    for (int j = 0; j < 4; ++j)
+                        EXPECT_EQ(adfStats[j], adfRefStats[j]) << i << j;
+                    EXPECT_EQ(adfMinMax[0], adfRefMinMax[0]) << i;
+                    EXPECT_EQ(adfMinMax[1], adfRefMinMax[1]) << i;
+                    EXPECT_STREQ(pszValidPercent, osRefValidPercent.c_str());
+                }
+            }
+            if (!bApproxOK)
+            {
+                EXPECT_EQ(adfRefMinMax[0], adfRefStats[0]) << i;
+                EXPECT_EQ(adfRefMinMax[1], adfRefStats[1]) << i;
+            }
+        }
+    }
+}
+
+// Test that GDALOpenEx() skips drivers whose GDAL_DMD_OPEN_SIGNATURES do not
+// match the file header
+TEST_F(test_gdal, GDALOpenEx_open_signatures)
+{
+    static int nIdentifyCalls = 0;
+    nIdentifyCalls = 0;
+
+    GDALDriver *poDriver = new GDALDriver();
+    poDriver->SetDescription("TestOpenSignatures");
+    poDriver->SetMetadataItem(GDAL_DCAP_RASTER, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES, "41424344 4:4546");
+    poDriver->pfnIdentify = [](GDALOpenInfo *) -> int
+    {
+        ++nIdentifyCalls;
+        return FALSE;
+    };
+    poDriver->pfnOpen = [](GDALOpenInfo *) -> GDALDataset *
+    { return nullptr; };
+    GetGDALDriverManager()->RegisterDriver(poDriver);
+
+    const char *const apszAllowedDrivers[] = {"TestOpenSignatures", nullptr};
+    const auto TestOpen = [&apszAllowedDrivers](const char *pszContent)
+    {
+        const char *pszFilename = "/vsimem/test_open_signatures.bin";
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        ASSERT_NE(fp, nullptr);
+        VSIFWriteL(pszContent, 1, strlen(pszContent), fp);
+        VSIFCloseL(fp);
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALOpenEx(pszFilename, GDAL_OF_RASTER, apszAllowedDrivers,
+                             nullptr, nullptr),
+                  nullptr);
+        VSIUnlink(pszFilename);
+    };
+
+    TestOpen("ABCDxxxx");
+    EXPECT_EQ(nIdentifyCalls, 1);
+    TestOpen("xxxxEFxx");
+    EXPECT_EQ(nIdentifyCalls, 2);
+    TestOpen("xxxxxxxx");
+    EXPECT_EQ(nIdentifyCalls, 2);
+    // Too short to match the second signature
+    TestOpen("xxxxE");
+    EXPECT_EQ(nIdentifyCalls, 2);
+    // No header: the driver is probed
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALOpenEx("/vsimem/i_do_not_exist.bin", GDAL_OF_RASTER,
+                             apszAllowedDrivers, nullptr, nullptr),
+                  nullptr);
+    }
+    EXPECT_EQ(nIdentifyCalls, 3);
+
+    GetGDALDriverManager()->DeregisterDriver(poDriver);
+    delete poDriver;
+}
+
+// Test GDALRasterBand::InterpolateAtPoints()
+TEST_F(test_gdal, GDALRasterBand_InterpolateAtPoints)
+{
+    GDALDatasetUniquePtr poDS(
+        GDALDataset::Open(GCORE_DATA_DIR "byte.tif", GDAL_OF_RASTER));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+
+    // Points in a random order, some of them outside of the raster
+    constexpr size_t N = 5000;
+    std::vector<double> adfPixel(N);
+    std::vector<double> adfLine(N);
+    unsigned nSeed = 0;
+    const auto Random = [&nSeed]()
+    {
+        nSeed = nSeed * 1103515245U + 12345U;
+        return static_cast<double>((nSeed >> 8) % 24000) / 1000.0 - 2;
+    };
+    for (size_t i = 0; i < N; ++i)
+    {
+        adfPixel[i] = Random();
+        adfLine[i] = Random();
+    }
+
+    for (const auto eInterpolation :
+         {GRIORA_NearestNeighbour, GRIORA_Bilinear, GRIORA_Cubic})
+    {
+        std::vector<double> adfExpected(N);
+        std::vector<int> abExpectedSuccess(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            abExpectedSuccess[i] =
+                poBand->InterpolateAtPoint(adfPixel[i], adfLine[i],
+                                           eInterpolation,
+                                           &adfExpected[i]) == CE_None;
+        }
+
+        for (const char *pszThreads : {"1", "4"})
+        {
+            const CPLStringList aosOptions(
+                CSLSetNameValue(nullptr, "NUM_THREADS", pszThreads));
+            std::vector<double> adfReal(N);
+            std::vector<int> abSuccess(N);
+            EXPECT_EQ(GDALRasterInterpolateAtPoints(
+                          GDALRasterBand::ToHandle(poBand), N,
+                          adfPixel.data(), adfLine.data(), eInterpolation,
+                          adfReal.data(), nullptr, abSuccess.data(),
+                          aosOptions.List()),
+                      CE_Failure);
+            for (size_t i = 0; i < N; ++i)
+            {
+                EXPECT_EQ(abSuccess[i], abExpectedSuccess[i]);
+                if (abSuccess[i])
+                    EXPECT_EQ(adfReal[i], adfExpected[i]);
+                else
+                    EXPECT_TRUE(std::isnan(adfReal[i]));
+            }
+        }
+    }
+
+    // All points within the raster
+    const double dfPixel = 5.5;
+    const double dfLine = 10.5;
+    double dfReal = 0;
+    EXPECT_EQ(poBand->InterpolateAtPoints(1, &dfPixel, &dfLine,
+                                          GRIORA_NearestNeighbour, &dfReal),
+              CE_None);
+    EXPECT_EQ(dfReal, 132);
+
+    // Invalid interpolation method
+    CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+    EXPECT_EQ(poBand->InterpolateAtPoints(1, &dfPixel, &dfLine,
+                                          GRIORA_Average, &dfReal),
+              CE_Failure);
+}
+
+// Test using GDALProxyPoolDataset objects from several threads, with more
+// proxied datasets than the size of the pool
+TEST_F(test_gdal, GDALProxyPoolDataset_multithreaded)
+{
+    auto poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    constexpr int N_FILES = 12;
+    constexpr int N_THREADS = 4;
+    {
+        GDALDatasetUniquePtr poSrcDS(
+            GDALDataset::Open(GCORE_DATA_DIR "byte.tif", GDAL_OF_RASTER));
+        ASSERT_NE(poSrcDS, nullptr);
+        for (int i = 0; i < N_FILES; ++i)
+        {
+            GDALDatasetUniquePtr poDS(poGTiffDrv->CreateCopy(
+                CPLSPrintf("/vsimem/proxypool_%d.tif", i), poSrcDS.get(),
+                false, nullptr, nullptr, nullptr));
+            ASSERT_NE(poDS, nullptr);
+        }
+    }
+
+    CPLConfigOptionSetter oSetter("GDAL_MAX_DATASET_POOL_SIZE", "8", false);
+    std::atomic<bool> bError{false};
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < N_THREADS; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [iThread, &bError]()
+            {
+                const std::string osOwner = CPLSPrintf("thread_%d", iThread);
+                std::vector<std::unique_ptr<GDALProxyPoolDataset>> apoDS;
+                for (int i = 0; i < N_FILES; ++i)
+                {
+                    apoDS.emplace_back(GDALProxyPoolDataset::Create(
+                        CPLSPrintf("/vsimem/proxypool_%d.tif", i), nullptr,
+                        GA_ReadOnly, TRUE, osOwner.c_str()));
+                    if (!apoDS.back())
+                    {
+                        bError = true;
+                        return;
+                    }
+                }
+                for (int iIter = 0; iIter < 200; ++iIter)
+                {
+                    auto poBand = apoDS[(iIter * 7 + iThread) % N_FILES]
+                                      ->GetRasterBand(1);
+                    if (GDALChecksumImage(GDALRasterBand::ToHandle(poBand), 0,
+                                          0, 20, 20) != 4672)
+                    {
+                        bError = true;
+                    }
+                }
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_FALSE(bError);
+
+    for (int i = 0; i < N_FILES; ++i)
+        VSIUnlink(CPLSPrintf("/vsimem/proxypool_%d.tif", i));
+}
+
 }  // namespace
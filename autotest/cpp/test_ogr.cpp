@@ -12,7 +12,9 @@
 
 #include "gdal_unit_test.h"
 
+#include "cpl_json_streaming_writer.h"
 #include "ogr_p.h"
+#include "ogrgeojsonwriter.h"
 #include "ogrsf_frmts.h"
 #include "../../ogr/ogrsf_frmts/osm/gpb.h"
 #include "ogr_recordbatch.h"
@@ -4614,4 +4616,92 @@ TEST_F(test_ogr, OGRPolygon_two_vertex_constructor)
     CPLFree(outWKT);
 }
 
+// Test the streaming version of OGRGeoJSONWriteGeometry()
+TEST_F(test_ogr, OGRGeoJSONWriteGeometry_streaming)
+{
+    const auto RemoveSpaces = [](const std::string &s)
+    {
+        std::string ret;
+        for (char ch : s)
+        {
+            if (ch != ' ' && ch != '\n')
+                ret += ch;
+        }
+        return ret;
+    };
+
+    for (const char *pszWKT :
+         {"POINT (1 2)", "POINT Z (1 2 3)", "POINT EMPTY",
+          "LINESTRING (1.5 2.25,3.123456789012345 -4)", "LINESTRING EMPTY",
+          "POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.1,0.9 0.8,0.2 0.8,0.2 0.1))",
+          "POLYGON Z ((0 0 10,0 1 20,1 1 30,0 0 10))", "MULTIPOINT (1 2,3 4)",
+          "MULTILINESTRING ((1 2,3 4),(5 6,7 8))",
+          "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 10,10 11,11 11,10 10)))",
+          "GEOMETRYCOLLECTION (POINT (1e-10 1e60),"
+          "GEOMETRYCOLLECTION (LINESTRING (1 2,3 4)))"})
+    {
+        for (const char *pszPrecision : {"-1", "3"})
+        {
+            for (const char *pszSigFigures : {"-1", "5"})
+            {
+                auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(pszWKT);
+                ASSERT_EQ(eErr, OGRERR_NONE);
+
+                CPLStringList aosOptions;
+                aosOptions.SetNameValue("COORDINATE_PRECISION", pszPrecision);
+                aosOptions.SetNameValue("SIGNIFICANT_FIGURES", pszSigFigures);
+                char *pszExpected = poGeom->exportToJson(aosOptions.List());
+                const std::string osExpected =
+                    pszExpected ? pszExpected : "null";
+                CPLFree(pszExpected);
+
+                OGRGeoJSONWriteOptions oOptions;
+                oOptions.nXYCoordPrecision = atoi(pszPrecision);
+                oOptions.nZCoordPrecision = atoi(pszPrecision);
+                oOptions.nSignificantFigures = atoi(pszSigFigures);
+
+                CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+                oWriter.SetPrettyFormatting(false);
+                EXPECT_TRUE(
+                    OGRGeoJSONWriteGeometry(oWriter, poGeom.get(), oOptions));
+                EXPECT_STREQ(RemoveSpaces(oWriter.GetString()).c_str(),
+                             RemoveSpaces(osExpected).c_str())
+                    << pszWKT;
+            }
+        }
+    }
+
+    {
+        auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(
+            "POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.1,0.9 0.8,0.2 0.8,0.2 0.1))");
+        ASSERT_EQ(eErr, OGRERR_NONE);
+        OGRGeoJSONWriteOptions oOptions;
+        oOptions.bPolygonRightHandRule = true;
+        CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+        oWriter.SetPrettyFormatting(false);
+        EXPECT_TRUE(OGRGeoJSONWriteGeometry(oWriter, poGeom.get(), oOptions));
+        EXPECT_STREQ(oWriter.GetString().c_str(),
+                     "{\"type\":\"Polygon\",\"coordinates\":"
+                     "[[[0.0,0.0],[1.0,1.0],[0.0,1.0],[0.0,0.0]],"
+                     "[[0.2,0.1],[0.2,0.8],[0.9,0.8],[0.2,0.1]]]}");
+    }
+
+    {
+        OGRLineString oLS;
+        oLS.addPoint(1, std::numeric_limits<double>::quiet_NaN());
+        CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(
+            OGRGeoJSONWriteGeometry(oWriter, &oLS, OGRGeoJSONWriteOptions()));
+    }
+
+    {
+        OGRCircularString oCS;
+        CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_FALSE(
+            OGRGeoJSONWriteGeometry(oWriter, &oCS, OGRGeoJSONWriteOptions()));
+    }
+}
+
 }  // namespace
@@ -258,6 +258,65 @@ TEST_P(OrganizePolygonsTest, CrossingCCWPolygons)
     ASSERT_TRUE(result->Equals(expected.get()));
 }
 
+TEST_P(OrganizePolygonsTest, ManyPolygonsWithHoles)
+{
+    // Enough rings to trigger the spatial index based code path
+    constexpr int N = 40;
+    std::vector<OGRGeometry *> polygons;
+    for (int j = 0; j < N; ++j)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            const double x = i * 10;
+            const double y = j * 10;
+            auto poOuter = new OGRPolygon();
+            poOuter->addRingDirectly(new OGRLinearRing());
+            auto poRing = poOuter->getExteriorRing();
+            poRing->addPoint(x, y);
+            poRing->addPoint(x, y + 9);
+            poRing->addPoint(x + 9, y + 9);
+            poRing->addPoint(x + 9, y);
+            poRing->addPoint(x, y);
+            polygons.push_back(poOuter);
+
+            auto poInner = new OGRPolygon();
+            poInner->addRingDirectly(new OGRLinearRing());
+            poRing = poInner->getExteriorRing();
+            poRing->addPoint(x + 1, y + 1);
+            poRing->addPoint(x + 2, y + 1);
+            poRing->addPoint(x + 2, y + 2);
+            poRing->addPoint(x + 1, y + 2);
+            poRing->addPoint(x + 1, y + 1);
+            polygons.push_back(poInner);
+        }
+    }
+
+    const auto &method = GetParam();
+    CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+    auto result = organizePolygons(polygons, method);
+
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->getGeometryType(), wkbMultiPolygon);
+    const auto poMP = result->toMultiPolygon();
+    if (method == "SKIP")
+    {
+        ASSERT_EQ(poMP->getNumGeometries(), 2 * N * N);
+    }
+    else
+    {
+        ASSERT_EQ(poMP->getNumGeometries(), N * N);
+        for (const auto *poPoly : *poMP)
+        {
+            ASSERT_EQ(poPoly->getNumInteriorRings(), 1);
+            OGREnvelope sOuter, sInner;
+            poPoly->getExteriorRing()->getEnvelope(&sOuter);
+            poPoly->getInteriorRing(0)->getEnvelope(&sInner);
+            EXPECT_EQ(sInner.MinX, sOuter.MinX + 1);
+            EXPECT_EQ(sInner.MinY, sOuter.MinY + 1);
+        }
+    }
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -13,6 +13,7 @@
 #include "gdal_unit_test.h"
 
 #include "cpl_string.h"
+#include "ogr_feature.h"
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
 
@@ -625,4 +626,53 @@ TEST_F(test_osr, exportToPanorama)
         EXPECT_NEAR(adfParams[6], 0, EPS);           //false_northing
     }
 }
+
+// Test GetCachedFromUserInput() and IsSameCached()
+TEST_F(test_osr, GetCachedFromUserInput)
+{
+    auto poSRS1 = OGRSpatialReference::GetCachedFromUserInput("EPSG:4326");
+    ASSERT_NE(poSRS1, nullptr);
+    EXPECT_STREQ(poSRS1->GetAuthorityCode(nullptr), "4326");
+    EXPECT_EQ(poSRS1->GetAxisMappingStrategy(), OAMS_AUTHORITY_COMPLIANT);
+    EXPECT_EQ(OGRSpatialReference::GetCachedFromUserInput("EPSG:4326"),
+              poSRS1);
+
+    auto poSRS2 = OGRSpatialReference::GetCachedFromUserInput(
+        "EPSG:4326", OAMS_TRADITIONAL_GIS_ORDER);
+    ASSERT_NE(poSRS2, nullptr);
+    EXPECT_NE(poSRS2, poSRS1);
+    EXPECT_EQ(poSRS2->GetAxisMappingStrategy(), OAMS_TRADITIONAL_GIS_ORDER);
+
+    auto poSRS3 = OGRSpatialReference::GetCachedFromUserInput("EPSG:32631");
+    ASSERT_NE(poSRS3, nullptr);
+
+    auto poSRS4 = OGRSpatialReference::GetCachedFromUserInput("WGS84");
+    ASSERT_NE(poSRS4, nullptr);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_TRUE(OGRSpatialReference::IsSameCached(poSRS1, poSRS1));
+        EXPECT_TRUE(OGRSpatialReference::IsSameCached(poSRS1, poSRS4));
+        EXPECT_TRUE(OGRSpatialReference::IsSameCached(poSRS4, poSRS1));
+        // Different data axis to SRS axis mapping
+        EXPECT_FALSE(OGRSpatialReference::IsSameCached(poSRS1, poSRS2));
+        EXPECT_FALSE(OGRSpatialReference::IsSameCached(poSRS1, poSRS3));
+        EXPECT_FALSE(OGRSpatialReference::IsSameCached(poSRS3, poSRS1));
+        EXPECT_FALSE(OGRSpatialReference::IsSameCached(poSRS1, nullptr));
+    }
+
+    // The cached instance can be attached to objects that reference it
+    {
+        OGRGeomFieldDefn oFieldDefn("geom", wkbPoint);
+        oFieldDefn.SetSpatialRef(poSRS3.get());
+        EXPECT_EQ(oFieldDefn.GetSpatialRef(), poSRS3.get());
+    }
+    EXPECT_STREQ(poSRS3->GetAuthorityCode(nullptr), "32631");
+
+    {
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_EQ(OGRSpatialReference::GetCachedFromUserInput("invalid"),
+                  nullptr);
+    }
+}
 }  // namespace
@@ -19,6 +19,7 @@
 
 #include "gtest_include.h"
 
+#include "viewshed/cumulative.h"
 #include "viewshed/viewshed.h"
 
 namespace gdal
@@ -749,5 +750,92 @@ TEST(Viewshed, oor_below)
     }
 }
 
+// Cumulative viewshed of a list of observers, with a max distance, must be
+// the sum of the viewsheds of the observers.
+TEST(Viewshed, cumulative_observers)
+{
+    const int xlen = 20;
+    const int ylen = 15;
+    const char *srcFilename = "/vsimem/test_viewshed_cumulative_src.tif";
+    const char *dstFilename = "/vsimem/test_viewshed_cumulative_dst.tif";
+
+    std::array<int8_t, xlen * ylen> in;
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<int8_t>((i * 7) % 11);
+    {
+        DatasetPtr ds(GetGDALDriverManager()->GetDriverByName("GTiff")->Create(
+            srcFilename, xlen, ylen, 1, GDT_Int8, nullptr));
+        ASSERT_TRUE(ds);
+        ds->SetGeoTransform(GDALGeoTransform());
+        ASSERT_EQ(ds->GetRasterBand(1)->RasterIO(
+                      GF_Write, 0, 0, xlen, ylen, in.data(), xlen, ylen,
+                      GDT_Int8, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    const std::vector<Point> observers{
+        {3.5, 4.5, 2}, {12.5, 8.5, 5}, {17.5, 1.5, 1}, {5.5, 12.5, 3}};
+
+    Options opts = stdOptions(0, 0);
+    opts.maxDistance = 4;
+    opts.visibleVal = 1;
+    opts.numJobs = 2;
+
+    // Expected result, from the viewsheds of each observer.
+    std::array<uint32_t, xlen * ylen> expected{};
+    {
+        DatasetPtr srcDS(GDALDataset::Open(srcFilename));
+        ASSERT_TRUE(srcDS);
+        for (const Point &observer : observers)
+        {
+            Options singleOpts = opts;
+            singleOpts.observer = observer;
+            Viewshed v(singleOpts);
+            ASSERT_TRUE(v.run(srcDS->GetRasterBand(1)));
+            DatasetPtr ds = v.output();
+            GDALGeoTransform gt;
+            ds->GetGeoTransform(gt);
+            const int xStart = static_cast<int>(gt[0]);
+            const int yStart = static_cast<int>(gt[3]);
+            const int xSize = ds->GetRasterXSize();
+            const int ySize = ds->GetRasterYSize();
+            std::vector<uint8_t> out(static_cast<size_t>(xSize) * ySize);
+            ASSERT_EQ(ds->GetRasterBand(1)->RasterIO(
+                          GF_Read, 0, 0, xSize, ySize, out.data(), xSize,
+                          ySize, GDT_Byte, 0, 0, nullptr),
+                      CE_None);
+            for (int y = 0; y < ySize; ++y)
+                for (int x = 0; x < xSize; ++x)
+                    expected[(yStart + y) * xlen + xStart + x] +=
+                        out[y * xSize + x];
+        }
+    }
+    const uint32_t maxVal =
+        *std::max_element(expected.begin(), expected.end());
+    ASSERT_GT(maxVal, 0U);
+    const double factor = 255.0 / maxVal;
+    for (uint32_t &val : expected)
+        val = static_cast<uint32_t>(std::floor(factor * val));
+
+    opts.outputFormat = "GTiff";
+    opts.outputFilename = dstFilename;
+    Cumulative cumulative(opts);
+    ASSERT_TRUE(cumulative.run(srcFilename, observers));
+
+    DatasetPtr dstDS(GDALDataset::Open(dstFilename));
+    ASSERT_TRUE(dstDS);
+    std::array<uint32_t, xlen * ylen> out;
+    ASSERT_EQ(dstDS->GetRasterBand(1)->RasterIO(GF_Read, 0, 0, xlen, ylen,
+                                                out.data(), xlen, ylen,
+                                                GDT_UInt32, 0, 0, nullptr),
+              CE_None);
+    dstDS.reset();
+    for (size_t i = 0; i < out.size(); ++i)
+        EXPECT_EQ(out[i], expected[i]) << i;
+
+    VSIUnlink(srcFilename);
+    VSIUnlink(dstFilename);
+}
+
 }  // namespace viewshed
 }  // namespace gdal
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -1301,6 +1302,56 @@ INSTANTIATE_TEST_SUITE_P(
                GDALGetDataTypeName(eOut);
     });
 
+template <class T> static void CheckPackedFloat16(GDALDataType eType)
+{
+    // Packed conversions may use a SIMD code path: check that they match
+    // word-by-word conversions, including for values that are not exactly
+    // representable, subnormal, out of range or NaN.
+    const int N = 256 + 7;
+    std::vector<T> arrayIn(N);
+    for (int i = 0; i < N; i++)
+    {
+        arrayIn[i] = static_cast<T>((i - N / 2) * 1.37);
+    }
+    arrayIn[0] = static_cast<T>(1e-6);
+    arrayIn[1] = static_cast<T>(-1e-7);
+    arrayIn[2] = static_cast<T>(65504);
+    arrayIn[3] = static_cast<T>(1e6);
+    arrayIn[4] = static_cast<T>(-1e6);
+    arrayIn[5] = std::numeric_limits<T>::quiet_NaN();
+    arrayIn[6] = std::numeric_limits<T>::infinity();
+    arrayIn[7] = static_cast<T>(1.0 / 3);
+
+    std::vector<GFloat16> arrayHalf(N);
+    GDALCopyWords(arrayIn.data(), eType, sizeof(T), arrayHalf.data(),
+                  GDT_Float16, sizeof(GFloat16), N);
+    std::vector<T> arrayBack(N);
+    GDALCopyWords(arrayHalf.data(), GDT_Float16, sizeof(GFloat16),
+                  arrayBack.data(), eType, sizeof(T), N);
+    for (int i = 0; i < N; i++)
+    {
+        GFloat16 expectedHalf;
+        GDALCopyWords(&arrayIn[i], eType, 0, &expectedHalf, GDT_Float16, 0, 1);
+        T expectedBack;
+        GDALCopyWords(&expectedHalf, GDT_Float16, 0, &expectedBack, eType, 0,
+                      1);
+        if (std::isnan(expectedBack))
+        {
+            EXPECT_TRUE(std::isnan(arrayBack[i])) << i;
+        }
+        else
+        {
+            EXPECT_EQ(arrayBack[i], expectedBack) << i;
+        }
+    }
+}
+
+TEST_F(TestCopyWords, Float16Packed)
+{
+    CheckPackedFloat16<float>(GDT_Float32);
+    CheckPackedFloat16<double>(GDT_Float64);
+}
+
 TEST_F(TestCopyWords, ByteToByte)
 {
     for (int k = 0; k < 2; k++)
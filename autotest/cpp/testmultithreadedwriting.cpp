@@ -15,6 +15,9 @@
 
 #include "gtest_include.h"
 
+#include <thread>
+#include <vector>
+
 namespace
 {
 
@@ -95,4 +98,78 @@ TEST(testmultithreadedwriting, test)
     GDALDestroyDriverManager();
 }
 
+TEST(testmultithreadedwriting, gtiff_concurrent_block_writes)
+{
+    GDALAllRegister();
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (poDriver == nullptr)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    constexpr int SIZE = 256;
+    constexpr int BLOCK_SIZE = 32;
+    const char *const apszOptions[] = {"TILED=YES",
+                                       "BLOCKXSIZE=32",
+                                       "BLOCKYSIZE=32",
+                                       "COMPRESS=DEFLATE",
+                                       "INTERLEAVE=BAND",
+                                       "CONCURRENT_BLOCK_WRITES=YES",
+                                       nullptr};
+    const char *pszFilename = "/vsimem/test_concurrent_block_writes.tif";
+    auto poDS = std::unique_ptr<GDALDataset>(
+        poDriver->Create(pszFilename, SIZE, SIZE, 2, GDT_UInt16,
+                         const_cast<char **>(apszOptions)));
+    ASSERT_NE(poDS, nullptr);
+
+    constexpr int nBlocksPerRow = SIZE / BLOCK_SIZE;
+    constexpr int nThreads = 4;
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < nThreads; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [&poDS, iThread]()
+            {
+                std::vector<GUInt16> anBlock(BLOCK_SIZE * BLOCK_SIZE);
+                for (int iBlock = iThread;
+                     iBlock < 2 * nBlocksPerRow * nBlocksPerRow;
+                     iBlock += nThreads)
+                {
+                    const int iBand = iBlock / (nBlocksPerRow * nBlocksPerRow);
+                    const int nBlockX = iBlock % nBlocksPerRow;
+                    const int nBlockY =
+                        (iBlock / nBlocksPerRow) % nBlocksPerRow;
+                    for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; ++i)
+                        anBlock[i] = static_cast<GUInt16>(iBlock + i);
+                    EXPECT_EQ(poDS->GetRasterBand(iBand + 1)->WriteBlock(
+                                  nBlockX, nBlockY, anBlock.data()),
+                              CE_None);
+                }
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_EQ(poDS->Close(), CE_None);
+    poDS.reset();
+
+    poDS.reset(GDALDataset::Open(pszFilename));
+    ASSERT_NE(poDS, nullptr);
+    std::vector<GUInt16> anBlock(BLOCK_SIZE * BLOCK_SIZE);
+    for (int iBlock = 0; iBlock < 2 * nBlocksPerRow * nBlocksPerRow; ++iBlock)
+    {
+        const int iBand = iBlock / (nBlocksPerRow * nBlocksPerRow);
+        const int nBlockX = iBlock % nBlocksPerRow;
+        const int nBlockY = (iBlock / nBlocksPerRow) % nBlocksPerRow;
+        ASSERT_EQ(poDS->GetRasterBand(iBand + 1)->ReadBlock(nBlockX, nBlockY,
+                                                            anBlock.data()),
+                  CE_None);
+        for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; ++i)
+        {
+            ASSERT_EQ(anBlock[i], static_cast<GUInt16>(iBlock + i));
+        }
+    }
+    poDS.reset();
+    VSIUnlink(pszFilename);
+}
+
 }  // namespace
@@ -819,3 +819,34 @@ def test_band_arithmetic_logical_not():
 
     assert gdal.logical_not(true_band).ComputeRasterMinMax(False)[0] == False
     assert gdal.logical_not(false_band).ComputeRasterMinMax(False)[0] == True
+
+
+def test_band_arithmetic_fused_operations(tmp_vsimem):
+
+    ds = gdal.GetDriverByName("MEM").Create("", 3, 1, 3)
+    R = ds.GetRasterBand(1)
+    R.SetNoDataValue(0)
+    R.WriteRaster(0, 0, 3, 1, b"\x01\x02\x00")
+    G = ds.GetRasterBand(2)
+    G.SetNoDataValue(0)
+    G.WriteRaster(0, 0, 3, 1, b"\x03\x05\x07")
+    B = ds.GetRasterBand(3)
+    B.SetNoDataValue(0)
+    B.WriteRaster(0, 0, 3, 1, b"\x04\x08\x0c")
+
+    res = (R * 2 + G * 3) * 0.5 - B / 4 + 1
+    assert res.DataType == gdal.GDT_Float64
+    assert res.GetNoDataValue() == 0
+    assert struct.unpack("d" * 3, res.ReadRaster()) == (
+        (1 * 2 + 3 * 3) * 0.5 - 4 / 4 + 1,
+        (2 * 2 + 5 * 3) * 0.5 - 8 / 4 + 1,
+        0,
+    )
+
+    # The chain of operations is evaluated by a single expression on the
+    # source bands
+    gdal.GetDriverByName("VRT").CreateCopy(tmp_vsimem / "out.vrt", res)
+    xml = gdal.VSIFile(tmp_vsimem / "out.vrt", "rb").read().decode("utf-8")
+    assert xml.count("<PixelFunctionType>") == 1
+    assert "<PixelFunctionType>expression</PixelFunctionType>" in xml
+    assert xml.count("<ComplexSource") == 3
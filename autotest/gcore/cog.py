@@ -1936,6 +1936,48 @@ def test_cog_mask_band_overviews(tmp_vsimem):
     assert ds.GetRasterBand(1).GetOverview(1).IsMaskBand()
 
 
+###############################################################################
+
+
+def test_cog_tmp_overviews_in_memory(tmp_path):
+
+    ref_filename = str(tmp_path / "ref.tif")
+    gdal.Translate(
+        ref_filename,
+        "data/stefan_full_rgba.tif",
+        options="-co OVERVIEW_COUNT=3 -of COG -outsize 1024 0 -b 1 -b 2 -b 3 -mask 4",
+    )
+
+    filename = str(tmp_path / "out.tif")
+    with gdal.config_options(
+        {
+            "COG_TMP_OVERVIEWS_MAX_IN_MEMORY_SIZE": "100MB",
+            "COG_DELETE_TEMP_FILES": "NO",
+        }
+    ):
+        gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            options="-co OVERVIEW_COUNT=3 -of COG -outsize 1024 0 -b 1 -b 2 -b 3 -mask 4",
+        )
+    assert gdal.VSIStatL(filename + ".ovr.tmp") is None
+    assert gdal.VSIStatL(filename + ".msk.ovr.tmp") is None
+
+    ds = gdal.Open(filename)
+    ref_ds = gdal.Open(ref_filename)
+    assert ds.GetRasterBand(1).GetOverviewCount() == 3
+    for i in range(3):
+        for j in range(3):
+            assert (
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                == ref_ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            )
+        assert (
+            ds.GetRasterBand(1).GetMaskBand().GetOverview(i).Checksum()
+            == ref_ds.GetRasterBand(1).GetMaskBand().GetOverview(i).Checksum()
+        )
+
+
 ###############################################################################
 # Verify that we can generate an output that is byte-identical to the expected golden file.
 
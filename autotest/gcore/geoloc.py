@@ -126,6 +126,60 @@ def test_geoloc_fill_line(use_temp_datasets):
         assert warped_ds.GetRasterBand(1).Checksum() == 20177
 
 
+###############################################################################
+# Test multithreaded backmap computation and GEOLOC_BACKMAP_FILENAME
+
+
+def test_geoloc_backmap_threads_and_cache(tmp_path):
+
+    ds = gdal.GetDriverByName("MEM").Create("", 200, 372)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": "../alg/data/geoloc/longitude_including_pole.tif",
+        "X_BAND": "1",
+        "Y_DATASET": "../alg/data/geoloc/latitude_including_pole.tif",
+        "Y_BAND": "1",
+        "SRS": 'GEOGCS["WGS 84",DATUM["WGS_1984",SPHEROID["WGS 84",6378137,298.257223563,AUTHORITY["EPSG","7030"]],AUTHORITY["EPSG","6326"]],PRIMEM["Greenwich",0,AUTHORITY["EPSG","8901"]],UNIT["degree",0.0174532925199433,AUTHORITY["EPSG","9122"]],AXIS["Latitude",NORTH],AXIS["Longitude",EAST],AUTHORITY["EPSG","4326"]]',
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+    ds.GetRasterBand(1).Fill(1)
+
+    backmap_filename = str(tmp_path / "backmap.tif")
+    options = ["NUM_THREADS=4", "GEOLOC_BACKMAP_FILENAME=" + backmap_filename]
+
+    warped_ds = gdal.Warp("", ds, format="MEM", transformerOptions=options)
+    assert warped_ds.GetRasterBand(1).Checksum() == 20177
+
+    with gdal.Open(backmap_filename) as backmap_ds:
+        assert backmap_ds.RasterCount == 2
+        assert backmap_ds.GetMetadataItem("GEOLOC_BACKMAP_SIGNATURE")
+
+    # Same result when the backmap is loaded from the file
+    warped_ds = gdal.Warp("", ds, format="MEM", transformerOptions=options)
+    assert warped_ds.GetRasterBand(1).Checksum() == 20177
+
+    # Check that the file is actually used
+    with gdal.Open(backmap_filename, gdal.GA_Update) as backmap_ds:
+        backmap_ds.GetRasterBand(1).Fill(-10)
+        backmap_ds.GetRasterBand(2).Fill(-10)
+    warped_ds = gdal.Warp("", ds, format="MEM", transformerOptions=options)
+    assert warped_ds.GetRasterBand(1).Checksum() == 0
+
+    # A change of parameters invalidates the file
+    warped_ds = gdal.Warp(
+        "",
+        ds,
+        format="MEM",
+        transformerOptions=options + ["GEOLOC_BACKMAP_OVERSAMPLE_FACTOR=1.2"],
+    )
+    assert warped_ds.GetRasterBand(1).Checksum() != 0
+    warped_ds = gdal.Warp("", ds, format="MEM", transformerOptions=options)
+    assert warped_ds.GetRasterBand(1).Checksum() == 20177
+
+
 ###############################################################################
 # Test warping from rectified to referenced-by-geoloc
 
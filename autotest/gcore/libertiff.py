@@ -867,3 +867,62 @@ def test_libertiff_corrupted_lzw():
     ds = libertiff_open("data/gtiff/lzw_corrupted.tif")
     with pytest.raises(Exception):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test the ReadMultiRange() based prefetching of striles, combined with
+# the different predictor configurations
+
+
+@pytest.mark.parametrize(
+    "datatype,nbands,interleave,predictor",
+    [
+        (gdal.GDT_Byte, 1, "PIXEL", 2),
+        (gdal.GDT_Byte, 3, "PIXEL", 2),
+        (gdal.GDT_Byte, 4, "PIXEL", 2),
+        (gdal.GDT_Byte, 5, "PIXEL", 2),
+        (gdal.GDT_Byte, 3, "BAND", 2),
+        (gdal.GDT_UInt16, 1, "PIXEL", 2),
+        (gdal.GDT_UInt16, 2, "PIXEL", 2),
+        (gdal.GDT_UInt16, 4, "PIXEL", 2),
+        (gdal.GDT_Int32, 2, "PIXEL", 2),
+        (gdal.GDT_UInt64, 1, "PIXEL", 2),
+        (gdal.GDT_Float32, 1, "PIXEL", 3),
+        (gdal.GDT_Float64, 2, "PIXEL", 3),
+    ],
+)
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_libertiff_read_multi_range_and_predictor(
+    tmp_vsimem, datatype, nbands, interleave, predictor, num_threads
+):
+
+    filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 67, 45, nbands, datatype)
+    for i in range(nbands):
+        src_ds.GetRasterBand(i + 1).Fill(0)
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            67,
+            45,
+            bytes((x * (i + 3) + (x // 67) * 7) % 251 for x in range(67 * 45)),
+            buf_type=gdal.GDT_Byte,
+        )
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename,
+        src_ds,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=DEFLATE",
+            f"PREDICTOR={predictor}",
+            f"INTERLEAVE={interleave}",
+        ],
+    )
+
+    open_options = [f"NUM_THREADS={num_threads}"] if num_threads else []
+    with gdal.config_option("LIBERTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "YES"):
+        ds = libertiff_open(filename, open_options=open_options)
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    assert ds.ReadRaster(3, 5, 50, 30) == src_ds.ReadRaster(3, 5, 50, 30)
@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import math
 import os
 import struct
 
@@ -1012,6 +1013,46 @@ def test_mask_setting_nodata(dt, GDAL_SIMUL_MEM_ALLOC_FAILURE_NODATA_MASK_BAND):
         test()
 
 
+###############################################################################
+# Test nodata masks of floating point bands, with and without caching of
+# the mask blocks
+
+
+@pytest.mark.require_driver("GTiff")
+@pytest.mark.parametrize("dt", [gdal.GDT_Float32, gdal.GDT_Float64])
+@pytest.mark.parametrize("nodata", [float("nan"), 1.5])
+@pytest.mark.parametrize("cache", ["NO", "YES"])
+def test_mask_nodata_float(tmp_vsimem, dt, nodata, cache):
+
+    filename = str(tmp_vsimem / "test_mask_nodata_float.tif")
+    values = [float("nan"), 1.5, 0, 1.6, -1.5, float("inf")] * 50
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename, 30, 10, 1, dt, options=["TILED=YES", "BLOCKXSIZE=16"]
+    )
+    ds.GetRasterBand(1).SetNoDataValue(nodata)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, 30, 10, struct.pack("d" * 300, *values), buf_type=gdal.GDT_Float64
+    )
+    ds = None
+
+    def expected(v):
+        if math.isnan(nodata):
+            return 0 if math.isnan(v) else 255
+        return 0 if v == nodata else 255
+
+    with gdal.config_option("GDAL_NODATA_MASK_BAND_CACHE", cache):
+        ds = gdal.Open(filename)
+        mask = ds.GetRasterBand(1).GetMaskBand()
+        for _ in range(2):
+            assert mask.ReadRaster() == bytes(expected(v) for v in values)
+        got = mask.ReadRaster(1, 2, 20, 3, buf_pixel_space=2, buf_line_space=40)
+        assert got[::2] == bytes(
+            expected(values[y * 30 + x]) for y in range(2, 5) for x in range(1, 21)
+        )
+        got = mask.ReadRaster(buf_type=gdal.GDT_UInt16)
+        assert struct.unpack("H" * 300, got) == tuple(expected(v) for v in values)
+
+
 ###############################################################################
 
 
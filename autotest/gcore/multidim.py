@@ -1666,3 +1666,83 @@ def test_multidim_GetMeshGrid():
         assert np.all(xv == ret[0].ReadAsArray())
         assert np.all(yv == ret[1].ReadAsArray())
         assert np.all(zv == np.array(ret[2].Read()).reshape(zv.shape))
+
+
+###############################################################################
+# Test GetResampled() on a synthetic EMIT-like product using a geometry lookup
+# table (GLT), large enough for its output to be computed by several threads
+
+
+def test_multidim_getresampled_glt_multithreaded():
+
+    drv = gdal.GetDriverByName("MEM")
+    mem_ds = drv.CreateMultiDimensional("myds")
+    rg = mem_ds.GetRootGroup()
+
+    downtrack = rg.CreateDimension("downtrack", None, None, 100)
+    crosstrack = rg.CreateDimension("crosstrack", None, None, 80)
+    bands = rg.CreateDimension("bands", None, None, 64)
+    ar = rg.CreateMDArray(
+        "reflectance",
+        [downtrack, crosstrack, bands],
+        gdal.ExtendedDataType.Create(gdal.GDT_Float32),
+    )
+    ar.SetNoDataValueDouble(-9999)
+    ar.Write(array.array("f", range(100 * 80 * 64)).tobytes())
+
+    rg.CreateAttribute(
+        "geotransform", [6], gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+    ).Write([2.0, 0.01, 0, 49.0, 0, -0.01])
+
+    location = rg.CreateGroup("location")
+    ortho_y = location.CreateDimension("ortho_y", None, None, 200)
+    ortho_x = location.CreateDimension("ortho_x", None, None, 160)
+
+    # GLT indices are 1-based, 0 meaning no source pixel
+    def is_valid(y, x):
+        return (y * 160 + x) % 7 != 0
+
+    glt_x = location.CreateMDArray(
+        "glt_x", [ortho_y, ortho_x], gdal.ExtendedDataType.Create(gdal.GDT_Int32)
+    )
+    glt_x.Write(
+        array.array(
+            "i",
+            [
+                x // 2 + 1 if is_valid(y, x) else 0
+                for y in range(200)
+                for x in range(160)
+            ],
+        ).tobytes()
+    )
+    glt_y = location.CreateMDArray(
+        "glt_y", [ortho_y, ortho_x], gdal.ExtendedDataType.Create(gdal.GDT_Int32)
+    )
+    glt_y.Write(
+        array.array(
+            "i",
+            [
+                y // 2 + 1 if is_valid(y, x) else 0
+                for y in range(200)
+                for x in range(160)
+            ],
+        ).tobytes()
+    )
+
+    resampled_ar = ar.GetResampled([None] * 3, gdal.GRIORA_NearestNeighbour, None)
+    assert resampled_ar is not None
+    assert [dim.GetSize() for dim in resampled_ar.GetDimensions()] == [200, 160, 64]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref_data = resampled_ar.Read()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert resampled_ar.Read() == ref_data
+
+    y = 123
+    expected = array.array("f")
+    for x in range(160):
+        if is_valid(y, x):
+            expected.extend(((y // 2) * 80 + x // 2) * 64 + b for b in range(64))
+        else:
+            expected.extend([-9999] * 64)
+    assert ref_data[y * 160 * 64 * 4 : (y + 1) * 160 * 64 * 4] == expected.tobytes()
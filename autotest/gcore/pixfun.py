@@ -1488,3 +1488,73 @@ def test_pixfun_max_no_nodata():
 
 
 ###############################################################################
+# Test the line-wise, possibly multi-threaded, evaluation of arithmetic pixel
+# functions on the different source data types
+
+
+@pytest.mark.parametrize(
+    "src_type", [gdal.GDT_Byte, gdal.GDT_Int16, gdal.GDT_UInt32, gdal.GDT_Float32]
+)
+@pytest.mark.parametrize(
+    "pixfn,args",
+    [
+        ("diff", ""),
+        ("mul", 'k="0.5"'),
+        ("scale", 'scale="2.5" offset="-3"'),
+        ("norm_diff", ""),
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_pixfun_linewise(tmp_vsimem, src_type, pixfn, args, num_threads):
+
+    nx = 400
+    ny = 300
+    nsources = 1 if pixfn == "scale" else 2
+    rng = numpy.random.default_rng(0)
+    arrays = []
+    for i in range(nsources):
+        ar = rng.integers(0, 200, size=(ny, nx))
+        ar[i::11, ::3] = 7
+        arrays.append(ar)
+        with gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / f"src{i}.tif", nx, ny, 1, src_type
+        ) as ds:
+            ds.GetRasterBand(1).WriteArray(ar)
+
+    sources = "".join(
+        f"""<SimpleSource>
+              <SourceFilename>{tmp_vsimem / f"src{i}.tif"}</SourceFilename>
+              <SourceBand>1</SourceBand>
+            </SimpleSource>"""
+        for i in range(nsources)
+    )
+    xml = f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>7</NoDataValue>
+        <PixelFunctionType>{pixfn}</PixelFunctionType>
+        <PixelFunctionArguments {args} propagateNoData="true" />
+        {sources}
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdaltest.config_option("VRT_NUM_THREADS", num_threads):
+        with gdal.Open(xml) as ds:
+            got = ds.ReadAsArray()
+
+    a = arrays[0].astype(numpy.float64)
+    nodata = a == 7
+    if pixfn == "scale":
+        expected = a * 2.5 - 3
+    else:
+        b = arrays[1].astype(numpy.float64)
+        nodata |= b == 7
+        if pixfn == "diff":
+            expected = a - b
+        elif pixfn == "mul":
+            expected = 0.5 * a * b
+        else:
+            with numpy.errstate(divide="ignore", invalid="ignore"):
+                expected = numpy.where(a + b == 0, numpy.inf, (a - b) / (a + b))
+    expected[nodata] = 7
+
+    numpy.testing.assert_array_equal(got, expected)
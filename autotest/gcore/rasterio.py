@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import array
 import math
 import struct
 import sys
@@ -3686,3 +3687,70 @@ def test_rasterio_gdt_unknown():
         # Caught at the SWIG level
         with pytest.raises(Exception, match="Illegal value for data type"):
             ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() reading the source with several threads
+
+
+@pytest.mark.require_driver("GTiff")
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_rasterio_copy_whole_raster_multithreaded(tmp_vsimem, interleave):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 200, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 100, 200, bytes((x + i) % 256 for x in range(100 * 200))
+        )
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        src_filename, src_ds, options=["INTERLEAVE=" + interleave, "TILED=YES"]
+    )
+    expected = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    src_ds = gdal.Open(src_filename)
+    # Force several swaths
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": str(100 * 16 * 3), "GDAL_NUM_THREADS": "4"}
+    ):
+        out_ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            tmp_vsimem / "out.tif",
+            src_ds,
+            options=["INTERLEAVE=" + interleave, "COMPRESS=LZW"],
+        )
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected
+
+
+###############################################################################
+# Test resampled RasterIO() run with several threads
+
+
+@pytest.mark.parametrize(
+    "resample_alg",
+    [gdal.GRIORA_Bilinear, gdal.GRIORA_Cubic, gdal.GRIORA_Average],
+)
+@pytest.mark.parametrize("nodata", [None, 0])
+def test_rasterio_resampled_multithreaded(resample_alg, nodata):
+
+    ds = gdal.GetDriverByName("MEM").Create("", 2000, 1500, 1, gdal.GDT_UInt16)
+    ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        2000,
+        1500,
+        array.array("H", [(x * 7) % 65536 for x in range(2000 * 1500)]).tobytes(),
+    )
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+
+    def read():
+        return ds.GetRasterBand(1).ReadRaster(
+            buf_xsize=333,
+            buf_ysize=250,
+            buf_type=gdal.GDT_Float32,
+            resample_alg=resample_alg,
+        )
+
+    expected = read()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert read() == expected
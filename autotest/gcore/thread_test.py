@@ -358,6 +358,32 @@ def test_thread_safe_open_options(tmp_path):
         launch_threads(get_band, expected_cs)
 
 
+def test_thread_safe_thread_local_config_options():
+    """Checks that the thread-local config options of the calling thread are
+    preserved, whether there were thread-local config options at opening
+    time or not"""
+
+    with gdal.config_option("GDAL_TEST_TS_OPEN", "YES", thread_local=True):
+        ds_with_tl = gdal.OpenEx(
+            "data/byte.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE
+        )
+    ds_without_tl = gdal.OpenEx("data/byte.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+
+    for ds in (ds_with_tl, ds_without_tl):
+        assert ds.GetRasterBand(1).Checksum() == 4672
+        assert gdal.GetThreadLocalConfigOption("GDAL_TEST_TS_OPEN") is None
+        with gdal.config_option("GDAL_TEST_TS_CALL", "YES", thread_local=True):
+            assert ds.GetRasterBand(1).Checksum() == 4672
+            assert gdal.GetThreadLocalConfigOption("GDAL_TEST_TS_CALL") == "YES"
+            assert gdal.GetThreadLocalConfigOption("GDAL_TEST_TS_OPEN") is None
+        assert gdal.GetThreadLocalConfigOption("GDAL_TEST_TS_CALL") is None
+
+        def get_band():
+            return ds.GetRasterBand(1)
+
+        launch_threads(get_band, 4672)
+
+
 @pytest.mark.require_driver("HDF5")
 @pytest.mark.require_driver("netCDF")
 def test_thread_safe_reuse_same_driver_as_prototype():
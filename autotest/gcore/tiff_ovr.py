@@ -739,6 +739,35 @@ def test_tiff_ovr_mode_multiband(multiband, read_only):
     gdal.GetDriverByName("GTiff").Delete("/vsimem/test.tif")
 
 
+###############################################################################
+# Check mode resampling on UInt16 with nodata
+
+
+def test_tiff_ovr_mode_uint16_nodata(tmp_vsimem):
+    numpy = pytest.importorskip("numpy")
+    pytest.importorskip("osgeo.gdal_array")
+
+    filename = str(tmp_vsimem / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(filename, 4, 4, 1, gdal.GDT_UInt16)
+    ds.GetRasterBand(1).SetNoDataValue(0)
+    ds.GetRasterBand(1).WriteArray(
+        numpy.array(
+            [
+                [1000, 1000, 5, 6],
+                [1000, 65535, 0, 0],
+                [7, 7, 0, 0],
+                [8, 8, 0, 0],
+            ],
+            dtype=numpy.uint16,
+        )
+    )
+    ds.BuildOverviews("MODE", [2])
+    assert ds.GetRasterBand(1).GetOverview(0).ReadAsArray().tolist() == [
+        [1000, 5],
+        [7, 0],
+    ]
+
+
 ###############################################################################
 # Check that we can create overviews on a newly create file (#2621)
 
@@ -2389,6 +2418,48 @@ def test_tiff_ovr_multithreading_multiband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test GDAL_OVR_STREAMING=YES
+
+
+@pytest.mark.parametrize("resampling", ["NEAREST", "AVERAGE", "CUBIC"])
+@pytest.mark.parametrize("nodata", [None, 0])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_tiff_ovr_streaming(tmp_vsimem, resampling, nodata, num_threads):
+
+    def get_checksums(streaming):
+        filename = str(tmp_vsimem / f"test_{streaming}.tif")
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            bandList=[1, 2, 3],
+            noData=nodata,
+            creationOptions=[
+                "COMPRESS=LZW",
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+            ],
+        )
+        with gdaltest.config_options(
+            {
+                "GDAL_OVR_STREAMING": streaming,
+                "GDAL_NUM_THREADS": num_threads,
+                "GDAL_OVR_CHUNK_MAX_SIZE": "100",
+            }
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        ds = None
+        ds = gdal.Open(filename)
+        return [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(3)
+            for j in range(4)
+        ]
+
+    assert get_checksums("YES") == get_checksums("NO")
+
+
 ###############################################################################
 
 
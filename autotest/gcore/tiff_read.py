@@ -1204,6 +1204,85 @@ def test_tiff_read_vsicurl_multirange():
         gdal.VSICurlClearCache()
 
 
+###############################################################################
+# Test GDAL_HTTP_MERGE_RANGES_MAX_GAP with multi-range requests
+
+
+@pytest.mark.require_curl()
+def test_tiff_read_vsicurl_multirange_max_gap():
+
+    webserver_process = None
+    webserver_port = 0
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    with open("../gdrivers/data/utm.tif", "rb") as f:
+        content = f.read()
+
+    class Handler(webserver.BaseMockedHttpHandler):
+        def __init__(self):
+            self.ranges = []
+
+        def final_check(self):
+            pass
+
+        def process(self, method, request):
+            request.protocol_version = "HTTP/1.1"
+            if method == "HEAD":
+                request.send_response(200)
+                request.send_header("Content-Length", len(content))
+                request.end_headers()
+                return
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(content) - 1)
+            self.ranges.append((start, end))
+            request.send_response(206)
+            request.send_header("Content-type", "application/octet-stream")
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(content))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    def read(max_gap):
+        gdal.VSICurlClearCache()
+        handler = Handler()
+        with webserver.install_http_handler(handler), gdaltest.config_options(
+            {
+                "GTIFF_DIRECT_IO": "YES",
+                "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                "GDAL_HTTP_MERGE_RANGES_MAX_GAP": max_gap,
+            }
+        ):
+            ds = gdal.Open("/vsicurl/http://127.0.0.1:%d/utm.tif" % webserver_port)
+            assert ds is not None, "could not open dataset"
+            subsampled_data = ds.ReadRaster(0, 0, 512, 32, 128, 4)
+            ds = None
+        return subsampled_data, len(handler.ranges)
+
+    try:
+        data_no_gap, count_no_gap = read("0")
+        data_gap, count_gap = read("1MB")
+        assert data_gap == data_no_gap
+        assert count_gap < count_no_gap
+
+        ds = gdal.GetDriverByName("MEM").Create("", 128, 4)
+        ds.WriteRaster(0, 0, 128, 4, data_gap)
+        assert ds.GetRasterBand(1).Checksum() == 6429
+
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+
 ###############################################################################
 # Test reading a TIFF made of a single-strip that is more than 2GB (#5403)
 
@@ -5638,3 +5717,72 @@ def test_tiff_read_multithreaded_read_missing_tilebytecounts_and_offsets():
         match="missing_tilebytecounts_and_offsets.tif: Error while getting location of block 0",
     ):
         ds.ReadRaster()
+
+
+###############################################################################
+# Test GDAL_DECODED_TILE_CACHE_SIZE
+
+
+@pytest.mark.parametrize("driver_name", ["GTiff", "LIBERTIFF"])
+def test_tiff_read_decoded_tile_cache(tmp_vsimem, driver_name):
+
+    if gdal.GetDriverByName(driver_name) is None:
+        pytest.skip(f"{driver_name} driver not available")
+
+    filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.Open("data/byte.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        options="-co TILED=YES -co BLOCKXSIZE=16 -co BLOCKYSIZE=16 -co COMPRESS=DEFLATE",
+    )
+    with gdal.Open(filename, gdal.GA_Update) as ds:
+        ds.BuildOverviews("NEAR", [2])
+    expected_cs = src_ds.GetRasterBand(1).Checksum()
+    with gdal.Open(filename) as ds:
+        expected_ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+
+    with gdal.config_option("GDAL_DECODED_TILE_CACHE_SIZE", "1MB"):
+        # First handle populates the cache, second one reads from it
+        for _ in range(2):
+            with gdal.OpenEx(filename, allowed_drivers=[driver_name]) as ds:
+                assert ds.GetRasterBand(1).Checksum() == expected_cs
+                assert ds.GetRasterBand(1).GetOverview(0).Checksum() == (
+                    expected_ovr_cs
+                )
+
+        # Rewrite the file with different content: cached tiles must not
+        # be returned
+        gdal.Translate(
+            filename,
+            src_ds,
+            options="-scale 0 255 255 0 -co TILED=YES -co BLOCKXSIZE=16 -co BLOCKYSIZE=16 -co COMPRESS=DEFLATE -co PREDICTOR=2",
+        )
+        with gdal.Open("data/byte.tif") as ref_ds:
+            ref_ds = gdal.Translate(
+                "", ref_ds, format="MEM", scaleParams=[[0, 255, 255, 0]]
+            )
+            expected_cs = ref_ds.GetRasterBand(1).Checksum()
+        with gdal.OpenEx(filename, allowed_drivers=[driver_name]) as ds:
+            assert ds.GetRasterBand(1).Checksum() == expected_cs
+
+
+###############################################################################
+# Test reading a local file with concurrent reads in ReadMultiRange()
+
+
+def test_tiff_read_local_read_multi_range_num_threads(tmp_path):
+
+    filename = str(tmp_path / "test.tif")
+    src_ds = gdal.Translate("", "data/byte.tif", format="MEM", width=400, height=400)
+    gdal.Translate(
+        filename,
+        src_ds,
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    expected_data = src_ds.ReadRaster()
+
+    with gdaltest.config_option("CPL_VSIL_LOCAL_READ_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == expected_data
+        assert ds.ReadRaster(10, 20, 100, 200) == src_ds.ReadRaster(10, 20, 100, 200)
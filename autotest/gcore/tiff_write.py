@@ -5682,6 +5682,53 @@ def test_tiff_write_126():
     gdaltest.tiff_drv.Delete("/vsimem/tiff_write_126.tif")
 
 
+###############################################################################
+# Test that implicit JPEG-in-TIFF overviews are used for average resampling,
+# and for the levels missing before the first explicit overview
+
+
+@pytest.mark.skipif(
+    not gdaltest.vrt_has_open_support(),
+    reason="VRT driver open missing",
+)
+@pytest.mark.require_creation_option("GTiff", "JPEG")
+@pytest.mark.require_driver("JPEG")
+def test_tiff_write_implicit_jpeg_overviews_average_and_missing_levels(
+    tmp_vsimem,
+):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world_400pct.vrt")
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(
+        filename, src_ds, options="-co COMPRESS=JPEG -co PHOTOMETRIC=YCBCR"
+    )
+
+    with gdal.Open(filename) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 0
+        ovr_0_data = ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+        assert (
+            ds.GetRasterBand(1).ReadRaster(
+                0, 0, 1600, 800, 800, 400, resample_alg=gdal.GRIORA_Average
+            )
+            == ovr_0_data
+        )
+
+    # Only build an explicit overview at factor 8
+    with gdal.Open(filename, gdal.GA_Update) as ds:
+        ds.BuildOverviews("AVERAGE", [8])
+
+    with gdal.Open(filename) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 1
+        assert ds.GetRasterBand(1).GetOverview(0).XSize == 200
+        for resample_alg in (gdal.GRIORA_NearestNeighbour, gdal.GRIORA_Average):
+            assert (
+                ds.GetRasterBand(1).ReadRaster(
+                    0, 0, 1600, 800, 800, 400, resample_alg=resample_alg
+                )
+                == ovr_0_data
+            )
+
+
 ###############################################################################
 # Test setting/unsetting metadata in update mode (#5628)
 
@@ -8706,6 +8753,40 @@ def test_tiff_write_180_lerc_separate():
     assert cs == [30111, 32302, 40026]
 
 
+###############################################################################
+# Test lossless LERC round-trip of values needing all possible bit widths
+
+
+@pytest.mark.require_creation_option("GTiff", "LERC")
+@pytest.mark.parametrize("nbits", range(1, 32))
+def test_tiff_write_lerc_bit_widths(tmp_vsimem, nbits):
+
+    filename = str(tmp_vsimem / "test_tiff_write_lerc_bit_widths.tif")
+    xsize = 61
+    ysize = 37
+    max_val = (1 << nbits) - 1
+    values = array.array(
+        "I", [(i * 2654435761) % (max_val + 1) for i in range(xsize * ysize)]
+    )
+    values[0] = max_val
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        xsize,
+        ysize,
+        1,
+        gdal.GDT_UInt32,
+        options=["COMPRESS=LERC", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+    )
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, xsize, ysize, values.tobytes(), buf_type=gdal.GDT_UInt32
+    )
+    ds = None
+
+    ds = gdal.Open(filename)
+    got = array.array("I", ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_UInt32))
+    assert got == values
+
+
 ###############################################################################
 # Test MAX_Z_ERROR_OVERVIEW effect while creating overviews
 # on a newly created dataset
@@ -9763,6 +9844,33 @@ def test_tiff_write_jpegxl_uint16_single_band():
     ut.testCreateCopy()
 
 
+###############################################################################
+# Test JXL compression of many tiles, with encoders reused between tiles
+
+
+@pytest.mark.require_creation_option("GTiff", "JXL")
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_tiff_write_jpegxl_many_tiles(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        creationOptions=[
+            "COMPRESS=JXL",
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "NUM_THREADS=" + num_threads,
+        ],
+    )
+    with gdal.Open(filename) as ds:
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+
+
 ###############################################################################
 # Test JXL_ALPHA_DISTANCE option
 
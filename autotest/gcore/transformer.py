@@ -15,6 +15,7 @@
 
 
 import math
+import struct
 
 import gdaltest
 import pytest
@@ -1318,6 +1319,57 @@ def test_transformer_gcp_antimeridian_unwrap():
     )
 
 
+###############################################################################
+# Test that multithreaded warping with a RPC_DEM, where the DEM blocks are
+# shared between the per-thread clones of the transformer, gives the same
+# result as single-threaded warping
+
+
+def test_transformer_rpc_dem_multithreaded_warp(tmp_vsimem):
+
+    rpc_ds = gdal.Open("data/rpc.vrt")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 200, 200)
+    src_ds.SetMetadata(rpc_ds.GetMetadata("RPC"), "RPC")
+    src_ds.GetRasterBand(1).Fill(1)
+
+    dem_filename = str(tmp_vsimem / "dem.tif")
+    dem_ds = gdal.GetDriverByName("GTiff").Create(
+        dem_filename, 500, 500, 1, gdal.GDT_Float32
+    )
+    dem_ds.SetGeoTransform([125.5, 0.001, 0, 40.0, 0, -0.001])
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    dem_ds.SetSpatialRef(srs)
+    dem_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        500,
+        500,
+        struct.pack(
+            "<250000f", *[(i + j) % 300 for j in range(500) for i in range(500)]
+        ),
+    )
+    dem_ds = None
+
+    def warp(num_threads):
+        return gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            transformerOptions=[f"RPC_DEM={dem_filename}"],
+            warpOptions=[f"NUM_THREADS={num_threads}"],
+            multithread=num_threads > 1,
+        )
+
+    ref_ds = warp(1)
+    out_ds = warp(4)
+    assert out_ds.RasterXSize == ref_ds.RasterXSize
+    assert out_ds.RasterYSize == ref_ds.RasterYSize
+    assert out_ds.GetGeoTransform() == ref_ds.GetGeoTransform()
+    assert out_ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+    assert ref_ds.GetRasterBand(1).Checksum() != 0
+
+
 ###############################################################################
 # Test passing an unknown transformer option.
 
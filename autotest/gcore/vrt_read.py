@@ -2816,6 +2816,43 @@ def test_vrt_read_multi_threaded_disabled_since_overlapping_sources():
     )
 
 
+###############################################################################
+# Test multi-threaded reading with overlapping sources, which are composited
+# in their order of declaration
+
+
+@pytest.mark.parametrize("dataset_level", [True, False])
+def test_vrt_read_multi_threaded_overlapping_sources(dataset_level):
+
+    tiles = []
+    for j in range(2):
+        for i in range(2):
+            ds = gdal.GetDriverByName("MEM").Create(f"tile_{i}_{j}", 600, 600)
+            ds.SetGeoTransform([i * 500, 1, 0, -j * 500, 0, -1])
+            ds.GetRasterBand(1).Fill(1 + j * 2 + i)
+            tiles.append(ds)
+    vrt_ds = gdal.BuildVRT("", tiles)
+    assert vrt_ds.RasterXSize == 1100
+
+    obj = vrt_ds if dataset_level else vrt_ds.GetRasterBand(1)
+    with gdal.config_option("VRT_NUM_THREADS", "0"):
+        expected = obj.ReadRaster()
+    assert (
+        vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == "0"
+    )
+
+    assert obj.ReadRaster() == expected
+    assert vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == (
+        "1" if gdal.GetNumCPUs() >= 2 else "0"
+    )
+
+    # Last source wins
+    band = vrt_ds.GetRasterBand(1)
+    assert band.ReadRaster(550, 550, 1, 1) == b"\x04"
+    assert band.ReadRaster(550, 10, 1, 1) == b"\x02"
+    assert band.ReadRaster(10, 550, 1, 1) == b"\x03"
+
+
 ###############################################################################
 # Test propagation of errors from threads to main thread in multi-threaded reading
 
@@ -3024,3 +3061,67 @@ def test_vrt_read_CheckCompatibleForDatasetIO():
     assert (
         another_vrt.GetMetadataItem("CheckCompatibleForDatasetIO()", "__DEBUG__") == "1"
     )
+
+
+###############################################################################
+# Test reading a mosaic with many sources, which uses a spatial index of the
+# sources
+
+
+def test_vrt_read_many_sources(tmp_vsimem):
+
+    tile_size = 10
+    tiles_per_dim = 12
+    size = tile_size * tiles_per_dim
+
+    sources = []
+    for j in range(tiles_per_dim):
+        for i in range(tiles_per_dim):
+            value = 1 + j * tiles_per_dim + i
+            filename = str(tmp_vsimem / f"tile_{i}_{j}.tif")
+            ds = gdal.GetDriverByName("GTiff").Create(
+                filename, tile_size, tile_size
+            )
+            ds.GetRasterBand(1).Fill(value)
+            ds.Close()
+            sources.append((filename, i * tile_size, j * tile_size, tile_size))
+    # Last source overlaps others and must win
+    filename = str(tmp_vsimem / "overlap.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(filename, 20, 20)
+    ds.GetRasterBand(1).Fill(255)
+    ds.Close()
+    sources.append((filename, 5, 5, 20))
+
+    xml = f'<VRTDataset rasterXSize="{size}" rasterYSize="{size}">'
+    xml += '<VRTRasterBand dataType="Byte" band="1">'
+    for filename, xoff, yoff, srcsize in sources:
+        xml += f"""<SimpleSource>
+            <SourceFilename>{filename}</SourceFilename>
+            <SourceBand>1</SourceBand>
+            <SrcRect xOff="0" yOff="0" xSize="{srcsize}" ySize="{srcsize}"/>
+            <DstRect xOff="{xoff}" yOff="{yoff}" xSize="{srcsize}" ySize="{srcsize}"/>
+        </SimpleSource>"""
+    xml += "</VRTRasterBand></VRTDataset>"
+
+    def expected_value(x, y):
+        if 5 <= x < 25 and 5 <= y < 25:
+            return 255
+        return 1 + (y // tile_size) * tiles_per_dim + (x // tile_size)
+
+    ds = gdal.Open(xml)
+    band = ds.GetRasterBand(1)
+    for xoff, yoff, xsize, ysize in [
+        (0, 0, size, size),
+        (3, 4, 1, 1),
+        (9, 9, 2, 2),
+        (24, 24, 2, 2),
+        (size - 15, size - 7, 15, 7),
+    ]:
+        data = band.ReadRaster(xoff, yoff, xsize, ysize)
+        assert data == bytes(
+            expected_value(x, y)
+            for y in range(yoff, yoff + ysize)
+            for x in range(xoff, xoff + xsize)
+        ), (xoff, yoff, xsize, ysize)
+
+    assert band.ComputeRasterMinMax(False) == (1, 255)
@@ -11,6 +11,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
+import re
 import sys
 import time
 
@@ -811,6 +813,60 @@ def test_vsicurl_test_retry(server):
             gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test VSINetworkStatsBeginScope() / VSINetworkStatsEndScope()
+
+
+def test_vsicurl_network_stats_scope(server):
+
+    gdal.VSICurlClearCache()
+
+    # No open scope
+    with gdal.quiet_errors():
+        assert gdal.NetworkStatsEndScope() is None
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/test_stats_scope/", 404)
+    handler.add("HEAD", "/test_stats_scope/test.txt", 200, {"Content-Length": "3"})
+    handler.add("GET", "/test_stats_scope/test.txt", 502)
+    handler.add("GET", "/test_stats_scope/test.txt", 200, {}, "foo")
+    with webserver.install_http_handler(handler):
+        gdal.NetworkStatsBeginScope()
+        f = gdal.VSIFOpenL(
+            "/vsicurl?max_retry=1&retry_delay=0.01&url=http://localhost:%d/test_stats_scope/test.txt"
+            % server.port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            with gdal.quiet_errors():
+                assert gdal.VSIFReadL(1, 3, f) == b"foo"
+
+            # Nested scope: the second read is served from the cache
+            gdal.NetworkStatsBeginScope()
+            gdal.VSIFSeekL(f, 0, 0)
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+            j = json.loads(gdal.NetworkStatsEndScope())
+            assert j["methods"] == {}
+            assert j["retries"] == 0
+            assert j["cache"] == {"hits": 1, "misses": 0, "hit_ratio": 1.0}
+            assert j["latency"]["count"] == 0
+        finally:
+            gdal.VSIFCloseL(f)
+        j = json.loads(gdal.NetworkStatsEndScope())
+
+    assert j["methods"]["HEAD"]["count"] == 1
+    assert j["methods"]["GET"]["count"] >= 1
+    assert j["methods"]["GET"]["downloaded_bytes"] >= 3
+    assert j["retries"] == 1
+    assert j["cache"]["hits"] == 1
+    assert j["cache"]["misses"] == 1
+    assert j["latency"]["count"] >= 1
+    assert j["latency"]["max_ms"] >= j["latency"]["mean_ms"]
+    assert sum(x["count"] for x in j["latency"]["histogram"]) == j["latency"]["count"]
+    assert j["latency"]["histogram"][-1]["upper_bound_ms"] is None
+
+
 ###############################################################################
 
 
@@ -1525,6 +1581,174 @@ def test_vsicurl_cache_control_not_set(server):
         assert data == "foo"
 
 
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_vsimem):
+
+    cache_dir = str(tmp_vsimem / "cache")
+    url = "/vsicurl/http://localhost:%d/test_disk_cache.bin" % server.port
+
+    def read(etag, expected_get_content=None):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/", 404)
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": etag},
+        )
+        if expected_get_content:
+            handler.add("GET", "/test_disk_cache.bin", 200, {}, expected_get_content)
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f is not None
+            try:
+                return gdal.VSIFReadL(1, 3, f).decode("ascii")
+            finally:
+                gdal.VSIFCloseL(f)
+
+    with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", cache_dir):
+        assert read('"etag1"', "foo") == "foo"
+        assert gdal.ReadDirRecursive(cache_dir)
+
+        # Served from the on-disk cache
+        assert read('"etag1"') == "foo"
+
+        # File modified on server side: new ETag
+        assert read('"etag2"', "bar") == "bar"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test VSICopyFile() with parallel ranged downloads
+
+
+def test_vsicurl_copy_file_parallel_download(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    content = "".join(chr(ord("a") + i) * 1000 for i in range(3)) + "d" * 500
+
+    def method(request):
+        res = re.search(r"bytes=(\d+)\-(\d+)", request.headers["Range"])
+        start = int(res.group(1))
+        end = min(int(res.group(2)) + 1, len(content))
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end - 1, len(content))
+        )
+        request.send_header("Content-Length", end - start)
+        request.end_headers()
+        request.wfile.write(content[start:end].encode("ascii"))
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD", "/test_parallel.bin", 200, {"Content-Length": "%d" % len(content)}
+    )
+    # Requests may be received in any order
+    for i in range(4):
+        handler.add("GET", "/test_parallel.bin", custom_method=method)
+    with webserver.install_http_handler(handler):
+        assert (
+            gdal.CopyFile(
+                "/vsicurl/http://localhost:%d/test_parallel.bin" % server.port,
+                str(tmp_path / "out.bin"),
+                options=["NUM_THREADS=2", "CHUNK_SIZE=1000"],
+            )
+            == 0
+        )
+    assert open(tmp_path / "out.bin", "rb").read() == content.encode("ascii")
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_READAHEAD
+
+
+def test_vsicurl_readahead(server):
+
+    gdal.VSICurlClearCache()
+
+    chunk_size = 16384
+    content = "".join(chr(ord("a") + i) * chunk_size for i in range(4))
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD", "/test_readahead.bin", 200, {"Content-Length": "%d" % len(content)}
+    )
+    handler.add(
+        "GET",
+        "/test_readahead.bin",
+        206,
+        {"Content-Range": "bytes 0-%d/%d" % (chunk_size - 1, len(content))},
+        content[0:chunk_size],
+        expected_headers={"Range": "bytes=0-%d" % (chunk_size - 1)},
+    )
+    # Issued in the background after the second sequential read
+    handler.add(
+        "GET",
+        "/test_readahead.bin",
+        206,
+        {
+            "Content-Range": "bytes %d-%d/%d"
+            % (chunk_size, 2 * chunk_size - 1, len(content))
+        },
+        content[chunk_size : 2 * chunk_size],
+        expected_headers={"Range": "bytes=%d-%d" % (chunk_size, 2 * chunk_size - 1)},
+    )
+    with webserver.install_http_handler(handler), gdal.config_option(
+        "CPL_VSIL_CURL_READAHEAD", "YES"
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_readahead.bin" % server.port, "rb"
+        )
+        assert f is not None
+        try:
+            assert gdal.VSIFReadL(1, 10, f) == b"a" * 10
+            assert gdal.VSIFReadL(1, 10, f) == b"a" * 10
+            gdal.VSIFSeekL(f, chunk_size, 0)
+            assert gdal.VSIFReadL(1, 10, f) == b"b" * 10
+        finally:
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test GDAL_HTTP_SHARE_CONNECTIONS
+
+
+def test_vsicurl_share_connections(server):
+
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add("HEAD", "/test_share.bin", 200, {"Content-Length": "3"})
+    handler.add("GET", "/test_share.bin", 200, {}, "foo")
+    with webserver.install_http_handler(handler), gdal.config_option(
+        "GDAL_HTTP_SHARE_CONNECTIONS", "YES"
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_share.bin" % server.port, "rb"
+        )
+        assert f is not None
+        try:
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+        finally:
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
 ###############################################################################
 
 
@@ -914,6 +914,84 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test /vsigzip/ with a .gzidx index built by gdal.GZipBuildIndex()
+
+
+def test_vsigzip_index(tmp_path):
+
+    import gzip
+    import random
+
+    rnd = random.Random(0)
+    data = bytes(rnd.choice(b"abcdefghij") for _ in range(3 * 1024 * 1024))
+    gz_filename = str(tmp_path / "test.gz")
+    # Two gzip members, to test that access points are found in both
+    with open(gz_filename, "wb") as f:
+        f.write(gzip.compress(data[0 : 1024 * 1024]))
+        f.write(gzip.compress(data[1024 * 1024 :]))
+
+    with gdal.quiet_errors():
+        assert gdal.GZipBuildIndex("/i_do/not/exist.gz") != 0
+
+    pct_values = []
+
+    def my_progress(pct, message, user_data):
+        pct_values.append(pct)
+        return True
+
+    assert (
+        gdal.GZipBuildIndex(
+            "/vsigzip/" + gz_filename, options=["SPAN=64K"], callback=my_progress
+        )
+        == 0
+    )
+    assert pct_values[-1] == 1.0
+    assert gdal.VSIStatL(gz_filename + ".gzidx") is not None
+
+    assert gdal.VSIStatL("/vsigzip/" + gz_filename).size == len(data)
+
+    f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+    assert f
+    try:
+        for offset, size in [
+            (len(data) - 1000, 1000),
+            (10, 100),
+            (1024 * 1024 - 50, 100),
+            (2 * 1024 * 1024 + 12345, 5000),
+        ]:
+            assert gdal.VSIFSeekL(f, offset, 0) == 0
+            assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+
+        # Large read decompressed with several threads
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            assert gdal.VSIFSeekL(f, 1000, 0) == 0
+            assert gdal.VSIFReadL(1, len(data), f) == data[1000:]
+            assert gdal.VSIFEofL(f)
+    finally:
+        gdal.VSIFCloseL(f)
+
+    with gdaltest.config_option("CPL_VSIL_GZIP_USE_INDEX", "NO"):
+        f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+        assert f
+        offset = 2 * 1024 * 1024
+        assert gdal.VSIFSeekL(f, offset, 0) == 0
+        assert gdal.VSIFReadL(1, 100, f) == data[offset : offset + 100]
+        gdal.VSIFCloseL(f)
+
+    # Index of another file: it must be ignored
+    data = data[::-1][1000:]
+    other_gz_filename = str(tmp_path / "other.gz")
+    with open(other_gz_filename, "wb") as f:
+        f.write(gzip.compress(data))
+    gdal.CopyFile(gz_filename + ".gzidx", other_gz_filename + ".gzidx")
+    f = gdal.VSIFOpenL("/vsigzip/" + other_gz_filename, "rb")
+    assert f
+    assert gdal.VSIFSeekL(f, 100000, 0) == 0
+    assert gdal.VSIFReadL(1, 1000, f) == data[100000:101000]
+    gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -1843,6 +1843,167 @@ def test_vsis3_opendir(aws_test_config, webserver_port):
     )
 
 
+###############################################################################
+# Test recursive OpenDir() listing sub-directories concurrently
+
+
+def test_vsis3_opendir_num_threads(aws_test_config, webserver_port):
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "GET",
+        "/vsis3_opendir_num_threads/?delimiter=%2F",
+        200,
+        {"Content-type": "application/xml"},
+        """<?xml version="1.0" encoding="UTF-8"?>
+            <ListBucketResult>
+                <Prefix/>
+                <Marker/>
+                <Contents>
+                    <Key>test.txt</Key>
+                    <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                    <Size>40</Size>
+                </Contents>
+                <CommonPrefixes>
+                    <Prefix>subdir1/</Prefix>
+                </CommonPrefixes>
+                <CommonPrefixes>
+                    <Prefix>subdir2/</Prefix>
+                </CommonPrefixes>
+            </ListBucketResult>
+        """,
+    )
+    handler.add(
+        "GET",
+        "/vsis3_opendir_num_threads/?prefix=subdir1%2F",
+        200,
+        {"Content-type": "application/xml"},
+        """<?xml version="1.0" encoding="UTF-8"?>
+            <ListBucketResult>
+                <Prefix>subdir1/</Prefix>
+                <Marker/>
+                <Contents>
+                    <Key>subdir1/a.txt</Key>
+                    <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                    <Size>1</Size>
+                </Contents>
+            </ListBucketResult>
+        """,
+    )
+    handler.add(
+        "GET",
+        "/vsis3_opendir_num_threads/?prefix=subdir2%2F",
+        200,
+        {"Content-type": "application/xml"},
+        """<?xml version="1.0" encoding="UTF-8"?>
+            <ListBucketResult>
+                <Prefix>subdir2/</Prefix>
+                <Marker/>
+                <Contents>
+                    <Key>subdir2/b.txt</Key>
+                    <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                    <Size>2</Size>
+                </Contents>
+                <Contents>
+                    <Key>subdir2/c/d.txt</Key>
+                    <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                    <Size>3</Size>
+                </Contents>
+            </ListBucketResult>
+        """,
+    )
+    with webserver.install_http_handler(handler):
+        d = gdal.OpenDir("/vsis3/vsis3_opendir_num_threads", -1, ["NUM_THREADS=2"])
+    assert d is not None
+
+    entries = []
+    while True:
+        entry = gdal.GetNextDirEntry(d)
+        if entry is None:
+            break
+        entries.append((entry.name, entry.size))
+    gdal.CloseDir(d)
+
+    assert entries == [
+        ("test.txt", 40),
+        ("subdir1", 0),
+        ("subdir1/a.txt", 1),
+        ("subdir2", 0),
+        ("subdir2/b.txt", 2),
+        ("subdir2/c/d.txt", 3),
+    ]
+
+
+###############################################################################
+# Test caching of directory listings in CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsis3_opendir_disk_cache(aws_test_config, webserver_port, tmp_vsimem):
+
+    def list_dir(expect_request, options=[]):
+        handler = webserver.SequentialHandler()
+        if expect_request:
+            handler.add(
+                "GET",
+                "/vsis3_opendir_disk_cache/?delimiter=%2F",
+                200,
+                {"Content-type": "application/xml"},
+                """<?xml version="1.0" encoding="UTF-8"?>
+                    <ListBucketResult>
+                        <Prefix/>
+                        <Marker/>
+                        <Contents>
+                            <Key>test.txt</Key>
+                            <LastModified>1970-01-01T00:00:01.000Z</LastModified>
+                            <Size>40</Size>
+                            <ETag>"etag"</ETag>
+                        </Contents>
+                        <CommonPrefixes>
+                            <Prefix>subdir/</Prefix>
+                        </CommonPrefixes>
+                    </ListBucketResult>
+                """,
+            )
+        with webserver.install_http_handler(handler):
+            d = gdal.OpenDir("/vsis3/vsis3_opendir_disk_cache", 0, options)
+        assert d is not None
+        entries = []
+        while True:
+            entry = gdal.GetNextDirEntry(d)
+            if entry is None:
+                break
+            entries.append(
+                (entry.name, entry.mode, entry.size, entry.mtime, entry.extra or {})
+            )
+        gdal.CloseDir(d)
+        return entries
+
+    expected = [
+        ("test.txt", 32768, 40, 1, {"ETag": "etag"}),
+        ("subdir", 16384, 0, 0, {}),
+    ]
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_vsimem / "cache"),
+            "CPL_VSIL_CURL_DISK_CACHE_DIR_LIST_TTL": "3600",
+        }
+    ):
+        assert list_dir(expect_request=True) == expected
+
+        # Served from the on-disk cache
+        gdal.VSICurlClearCache()
+        assert list_dir(expect_request=False) == expected
+
+        # Listings done to modify a directory bypass the cache
+        assert list_dir(expect_request=True, options=["CACHE_ENTRIES=NO"]) == expected
+
+    # Directory listings are not cached by default
+    with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", str(tmp_vsimem / "cache2")):
+        assert list_dir(expect_request=True) == expected
+        assert list_dir(expect_request=True) == expected
+
+
 ###############################################################################
 # Test OpenDir(['SYNTHETIZE_MISSING_DIRECTORIES=YES']) with a fake AWS server
 
@@ -3135,6 +3296,75 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test uploading parts in parallel
+
+
+def test_vsis3_write_multipart_parallel(aws_test_config, webserver_port):
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE": "1", "CPL_VSIL_MULTIPART_UPLOAD_NUM_THREADS": "2"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(webserver.SequentialHandler()):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.bin", "wb")
+    assert f is not None
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploads",
+        200,
+        {"Content-type": "application/xml"},
+        b"""<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    for i in range(1, 4):
+        handler.add(
+            "PUT",
+            "/s3_fake_bucket4/large_file.bin?partNumber=%d&uploadId=my_id" % i,
+            200,
+            {"ETag": '"etag%d"' % i, "Content-Length": "0"},
+            b"",
+            expected_headers={"Content-Length": "1048576"},
+        )
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/large_file.bin?partNumber=4&uploadId=my_id",
+        200,
+        {"ETag": '"etag4"', "Content-Length": "0"},
+        b"",
+        expected_headers={"Content-Length": "1"},
+    )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+<Part>
+<PartNumber>4</PartNumber><ETag>"etag4"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    size = 3 * 1024 * 1024 + 1
+    gdal.ErrorReset()
+    with webserver.install_http_handler(handler):
+        assert gdal.VSIFWriteL("a" * size, 1, size, f) == size
+        assert gdal.VSIFCloseL(f) == 0
+    assert gdal.GetLastErrorMsg() == ""
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
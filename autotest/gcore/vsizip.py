@@ -13,6 +13,7 @@
 ###############################################################################
 
 import random
+import sys
 
 import gdaltest
 import pytest
@@ -994,3 +995,50 @@ def test_vsizip_vsicurl_error():
         | gdal.VSI_STAT_SET_ERROR_FLAG,
     )
     assert "server certificate verification failed" in gdal.VSIGetLastErrorMsg()
+
+
+###############################################################################
+# Test CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR
+
+
+def test_vsizip_archive_index_cache_dir(tmp_path):
+
+    zip_filename = str(tmp_path / "test.zip")
+    cache_dir = str(tmp_path / "cache")
+
+    hZIP = gdal.VSIFOpenL("/vsizip/" + zip_filename, "wb")
+    for name in ("subdir/a file.txt", "b.txt"):
+        f = gdal.VSIFOpenL("/vsizip/" + zip_filename + "/" + name, "wb")
+        gdal.VSIFWriteL(name, 1, len(name), f)
+        gdal.VSIFCloseL(f)
+    gdal.VSIFCloseL(hZIP)
+
+    with gdaltest.config_option("CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", cache_dir):
+        assert set(gdal.ReadDir("/vsizip/" + zip_filename)) == {"subdir", "b.txt"}
+
+    idx_files = gdal.ReadDir(cache_dir)
+    assert len(idx_files) == 1
+    assert idx_files[0].endswith(".idx")
+    f = gdal.VSIFOpenL(cache_dir + "/" + idx_files[0], "rb")
+    lines = gdal.VSIFReadL(1, 10000, f).decode("utf-8").split("\n")
+    gdal.VSIFCloseL(f)
+    assert lines[0] == "GDAL_VSIARCHIVE_INDEX 1 3"
+    assert lines[1] == zip_filename
+    assert lines[2].startswith("1 0 ") and lines[2].endswith(" - subdir")
+    assert lines[3].endswith(" subdir/a file.txt")
+
+    # Check that another process reuses the listing
+    python_exe = sys.executable
+    cmd = (
+        f'"{python_exe}" -c "'
+        + "from osgeo import gdal; "
+        + "gdal.SetConfigOption('CPL_DEBUG', 'VSIArchive'); "
+        + f"gdal.SetConfigOption('CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR', '{cache_dir}'); "
+        + f"f = gdal.VSIFOpenL('/vsizip/{zip_filename}/subdir/a file.txt', 'rb'); "
+        + "print(gdal.VSIFReadL(1, 100, f).decode('utf-8')); "
+        + "gdal.VSIFCloseL(f)"
+        + '"'
+    )
+    out, err = gdaltest.runexternal_out_and_err(cmd, encoding="UTF-8")
+    assert out.strip() == "subdir/a file.txt"
+    assert "read from" in err
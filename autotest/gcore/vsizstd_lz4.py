@@ -0,0 +1,209 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Test /vsizstd/ and /vsilz4/
+# Author:   Even Rouault <even dot rouault at spatialys.com>
+#
+###############################################################################
+# Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import random
+import struct
+
+import gdaltest
+import pytest
+
+from osgeo import gdal
+
+
+@pytest.fixture(params=["/vsizstd/", "/vsilz4/"])
+def prefix(request):
+    if request.param not in gdal.GetFileSystemsPrefixes():
+        pytest.skip(f"{request.param} not available")
+    return request.param
+
+
+def get_test_data(size):
+    rnd = random.Random(0)
+    return bytes(rnd.choice(b"abcdefghij,\n") for _ in range(size))
+
+
+def write_file(filename, data, chunk_size="16K", num_threads=None):
+    prefix = filename[0 : filename.find("/", 1) + 1]
+    if "zstd" in prefix:
+        option = "CPL_VSIL_ZSTD_CHUNK_SIZE"
+    else:
+        option = "CPL_VSIL_LZ4_CHUNK_SIZE"
+    with gdaltest.config_options(
+        {option: chunk_size, "GDAL_NUM_THREADS": num_threads}
+    ):
+        f = gdal.VSIFOpenL(filename, "wb")
+        assert f
+        try:
+            # Write in pieces not aligned on the chunk size
+            for i in range(0, len(data), 10000):
+                piece = data[i : i + 10000]
+                assert gdal.VSIFWriteL(piece, 1, len(piece), f) == len(piece)
+        finally:
+            assert gdal.VSIFCloseL(f) == 0
+
+
+def check_random_reads(filename, data):
+    f = gdal.VSIFOpenL(filename, "rb")
+    assert f
+    try:
+        assert gdal.VSIFReadL(1, 100, f) == data[0:100]
+        for offset, size in [
+            (len(data) - 1000, 1000),
+            (10, 100),
+            (50000, 50000),
+            (16384 - 10, 20),
+            (len(data) - 10, 100),
+        ]:
+            assert gdal.VSIFSeekL(f, offset, 0) == 0
+            assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+        assert gdal.VSIFEofL(f)
+
+        assert gdal.VSIFSeekL(f, 0, 2) == 0
+        assert gdal.VSIFTellL(f) == len(data)
+        assert gdal.VSIFReadL(1, 1, f) == b""
+
+        assert gdal.VSIFSeekL(f, 0, 0) == 0
+        assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+    finally:
+        gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test writing and reading back a file with a seek table
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_vsizstd_lz4_write_read(tmp_vsimem, prefix, num_threads):
+
+    data = get_test_data(300 * 1000)
+    filename = f"{prefix}{tmp_vsimem}/test.bin"
+    write_file(filename, data, num_threads=num_threads)
+
+    assert gdal.VSIStatL(filename).size == len(data)
+    check_random_reads(filename, data)
+
+    # Check the seek table at the end of the file
+    raw = gdal.VSIFile(f"{tmp_vsimem}/test.bin", "rb").read()
+    num_frames, descriptor, magic = struct.unpack("<IBI", raw[-9:])
+    assert magic == 0x8F92EAB1
+    assert descriptor == 0
+    assert num_frames == (len(data) + 16383) // 16384
+    table_size = 8 + 8 * num_frames + 9
+    assert struct.unpack("<II", raw[-table_size : -table_size + 8]) == (
+        0x184D2A5E,
+        table_size - 8,
+    )
+    entries = struct.unpack("<" + "I" * (2 * num_frames), raw[-table_size + 8 : -9])
+    assert sum(entries[0::2]) == len(raw) - table_size
+    assert sum(entries[1::2]) == len(data)
+
+
+###############################################################################
+# Test reading a file without seek table
+
+
+def test_vsizstd_lz4_read_without_seek_table(tmp_vsimem, prefix):
+
+    data = get_test_data(300 * 1000)
+    write_file(f"{prefix}{tmp_vsimem}/tmp.bin", data)
+
+    # Remove the seek table
+    raw = gdal.VSIFile(f"{tmp_vsimem}/tmp.bin", "rb").read()
+    num_frames = struct.unpack("<I", raw[-9:-5])[0]
+    raw = raw[0 : -(8 + 8 * num_frames + 9)]
+    filename = f"{tmp_vsimem}/test.bin"
+    gdal.FileFromMemBuffer(filename, raw)
+
+    assert gdal.VSIStatL(prefix + filename).size == len(data)
+    check_random_reads(prefix + filename, data)
+
+
+###############################################################################
+# Test reading a file made of a single frame, without seek table
+
+
+def test_vsizstd_lz4_read_single_frame(tmp_vsimem, prefix):
+
+    data = get_test_data(100 * 1000)
+    write_file(f"{prefix}{tmp_vsimem}/tmp.bin", data, chunk_size="1M")
+
+    raw = gdal.VSIFile(f"{tmp_vsimem}/tmp.bin", "rb").read()
+    raw = raw[0 : -(8 + 8 + 9)]
+    filename = f"{tmp_vsimem}/test.bin"
+    gdal.FileFromMemBuffer(filename, raw)
+
+    f = gdal.VSIFOpenL(prefix + filename, "rb")
+    assert f
+    try:
+        assert gdal.VSIFSeekL(f, 50000, 0) == 0
+        assert gdal.VSIFReadL(1, 100, f) == data[50000:50100]
+        assert gdal.VSIFSeekL(f, 100, 0) == 0
+        assert gdal.VSIFReadL(1, 100, f) == data[100:200]
+    finally:
+        gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test an empty file
+
+
+def test_vsizstd_lz4_empty(tmp_vsimem, prefix):
+
+    filename = f"{prefix}{tmp_vsimem}/test.bin"
+    write_file(filename, b"")
+    assert gdal.VSIStatL(filename).size == 0
+    f = gdal.VSIFOpenL(filename, "rb")
+    assert f
+    assert gdal.VSIFReadL(1, 1, f) == b""
+    assert gdal.VSIFEofL(f)
+    gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test error cases
+
+
+@gdaltest.disable_exceptions()
+def test_vsizstd_lz4_errors(tmp_vsimem, prefix):
+
+    with gdal.quiet_errors():
+        assert gdal.VSIFOpenL(f"{prefix}{tmp_vsimem}/i_do_not_exist", "rb") is None
+        assert gdal.VSIFOpenL(f"{prefix}{tmp_vsimem}/test.bin", "wb+") is None
+
+    f = gdal.VSIFOpenL(f"{prefix}{tmp_vsimem}/test.bin", "wb")
+    assert f
+    with gdal.quiet_errors():
+        assert gdal.VSIFSeekL(f, 1, 0) != 0
+    gdal.VSIFCloseL(f)
+
+    # Not a compressed file
+    gdal.FileFromMemBuffer(f"{tmp_vsimem}/invalid.bin", b"x" * 1000)
+    f = gdal.VSIFOpenL(f"{prefix}{tmp_vsimem}/invalid.bin", "rb")
+    assert f
+    with gdal.quiet_errors():
+        assert gdal.VSIFReadL(1, 1, f) == b""
+    assert gdal.VSIFErrorL(f)
+    gdal.VSIFCloseL(f)
+
+    # Truncated file
+    data = get_test_data(100 * 1000)
+    write_file(f"{prefix}{tmp_vsimem}/tmp.bin", data, chunk_size="1M")
+    raw = gdal.VSIFile(f"{tmp_vsimem}/tmp.bin", "rb").read()
+    gdal.FileFromMemBuffer(f"{tmp_vsimem}/truncated.bin", raw[0 : len(raw) // 2])
+    f = gdal.VSIFOpenL(f"{prefix}{tmp_vsimem}/truncated.bin", "rb")
+    assert f
+    with gdal.quiet_errors():
+        assert len(gdal.VSIFReadL(1, len(data), f)) < len(data)
+    assert gdal.VSIFErrorL(f)
+    gdal.VSIFCloseL(f)
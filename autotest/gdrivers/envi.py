@@ -15,6 +15,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import array
 import os
 import struct
 
@@ -988,6 +989,66 @@ def test_envi_read_direct_access_update_scenario():
     gdal.GetDriverByName("ENVI").Delete(filename)
 
 
+###############################################################################
+# Test multithreaded and memory mapped direct I/O of all interleavings
+
+
+@pytest.fixture(scope="module")
+def direct_io_src_ds():
+
+    # Large enough so that several threads are used
+    width = 1100
+    height = 1000
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 3, gdal.GDT_UInt16
+    )
+    for i in range(3):
+        data = array.array(
+            "H", ((j * 7 + i * 13) % 65521 for j in range(width * height))
+        )
+        src_ds.GetRasterBand(i + 1).WriteRaster(0, 0, width, height, data.tobytes())
+    return src_ds
+
+
+@pytest.mark.parametrize("interleave", ["BSQ", "BIL", "BIP"])
+@pytest.mark.parametrize("byte_order", ["LITTLE_ENDIAN", "BIG_ENDIAN"])
+@pytest.mark.parametrize("vsimem", [True, False])
+def test_envi_read_direct_io_multithreaded(
+    tmp_path, tmp_vsimem, direct_io_src_ds, interleave, byte_order, vsimem
+):
+
+    src_ds = direct_io_src_ds
+    width = src_ds.RasterXSize
+    height = src_ds.RasterYSize
+
+    filename = str((tmp_vsimem if vsimem else tmp_path) / "test.bin")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="ENVI",
+        creationOptions=["INTERLEAVE=" + interleave, "@BYTE_ORDER=" + byte_order],
+    )
+
+    with gdal.config_options({"GDAL_NUM_THREADS": "4", "GDAL_ONE_BIG_READ": "YES"}):
+        ds = gdal.Open(filename)
+        for i in range(3):
+            band = ds.GetRasterBand(i + 1)
+            src_band = src_ds.GetRasterBand(i + 1)
+            assert band.ReadRaster() == src_band.ReadRaster()
+            assert band.ReadRaster(
+                1, 2, width - 3, height - 4, buf_type=gdal.GDT_Float32
+            ) == src_band.ReadRaster(
+                1, 2, width - 3, height - 4, buf_type=gdal.GDT_Float32
+            )
+            assert band.ReadRaster(
+                0, 0, width, height, width // 2, height // 3
+            ) == src_band.ReadRaster(0, 0, width, height, width // 2, height // 3)
+        assert ds.ReadRaster(
+            buf_pixel_space=2 * 3, buf_band_space=2
+        ) == src_ds.ReadRaster(buf_pixel_space=2 * 3, buf_band_space=2)
+        ds = None
+
+
 ###############################################################################
 # Test setting different nodata values
 
@@ -4407,3 +4407,49 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test that encoding tiles in worker threads gives the same result as in a
+# single thread
+
+
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG", "PNG8", "WEBP"])
+def test_gpkg_write_multithreaded_tile_encoding(tmp_vsimem, tile_format):
+
+    if tile_format == "WEBP":
+        gdaltest.importorskip_gdal_driver("WEBP")
+
+    src_ds = gdal.Translate(
+        "", "data/small_world.tif", format="MEM", width=1000, height=500
+    )
+
+    def create(filename, num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdaltest.gpkg_dr.CreateCopy(
+                filename,
+                src_ds,
+                options=[
+                    "TILE_FORMAT=" + tile_format,
+                    "BLOCKSIZE=64",
+                    "RASTER_TABLE=small_world",
+                ],
+            )
+            ds.BuildOverviews("AVERAGE", [2, 4])
+            ds = None
+        ds = gdal.Open(filename)
+        checksums = [ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+        checksums += [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(3)
+            for j in range(2)
+        ]
+        with ds.ExecuteSQL(
+            "SELECT zoom_level, COUNT(*) FROM small_world GROUP BY zoom_level"
+        ) as sql_lyr:
+            counts = [(f.GetField(0), f.GetField(1)) for f in sql_lyr]
+        return checksums, counts
+
+    ref = create(str(tmp_vsimem / "st.gpkg"), "1")
+    got = create(str(tmp_vsimem / "mt.gpkg"), "4")
+    assert got == ref
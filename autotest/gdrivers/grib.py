@@ -2278,6 +2278,64 @@ def test_grib_grib2_sidecar_vsisubfile():
     )
 
 
+###############################################################################
+# Test writing a sidecar file with CREATE_IDX=YES
+
+
+def test_grib_grib2_create_idx(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "gfs.grib2")
+    with open("data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", "rb") as f:
+        gdal.FileFromMemBuffer(filename, f.read())
+
+    ds_ref = gdal.OpenEx(filename, open_options=["CREATE_IDX=YES"])
+    assert ds_ref.RasterCount == 6
+
+    f = gdal.VSIFOpenL(filename + ".idx", "rb")
+    assert f
+    lines = gdal.VSIFReadL(1, 10000, f).decode("ascii").split("\n")
+    gdal.VSIFCloseL(f)
+    assert len(lines) == 7 and lines[6] == ""
+    assert lines[0].startswith("1:0:d=2021091806:REFD:")
+    assert lines[0].endswith(":10 hour fcst:")
+    assert lines[5].startswith("6:26795:d=2021091806:VGRD:")
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == 6
+    assert ds.GetRasterBand(3).GetDescription().startswith("REFC:")
+    for i in range(1, ds.RasterCount + 1):
+        assert (
+            ds.GetRasterBand(i).Checksum() == ds_ref.GetRasterBand(i).Checksum()
+        )
+        assert ds.GetRasterBand(i).GetMetadataItem(
+            "GRIB_ELEMENT"
+        ) == ds_ref.GetRasterBand(i).GetMetadataItem("GRIB_ELEMENT")
+
+
+def test_grib_grib2_create_idx_subgrids(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "subgrids.grib2")
+    with open("data/grib/subgrids.grib2", "rb") as f:
+        gdal.FileFromMemBuffer(filename, f.read())
+
+    ds_ref = gdal.OpenEx(filename, open_options=["CREATE_IDX=YES"])
+
+    f = gdal.VSIFOpenL(filename + ".idx", "rb")
+    assert f
+    lines = gdal.VSIFReadL(1, 10000, f).decode("ascii").split("\n")
+    gdal.VSIFCloseL(f)
+    assert lines[0].startswith("1.1:0:d=2020092600:UGRD:")
+    assert lines[0].endswith(":anl:")
+    assert lines[1].startswith("1.2:0:d=2020092600:VGRD:")
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == ds_ref.RasterCount
+    for i in range(1, ds.RasterCount + 1):
+        assert (
+            ds.GetRasterBand(i).Checksum() == ds_ref.GetRasterBand(i).Checksum()
+        )
+
+
 # Test reading a (broken) mix of GRIBv2/GRIBv1 bands
 
 
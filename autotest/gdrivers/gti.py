@@ -2948,6 +2948,55 @@ def test_gti_read_multi_threaded_disabled_because_truncated_source(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test parallel opening of sources, and reuse of spatial query results, for
+# requests that do not use the multi-threaded RasterIO() code path
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_gti_read_prefetch_sources(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=256, format="MEM"
+    )
+    tiles_ds = []
+    for j in range(4):
+        for i in range(4):
+            tile_filename = str(tmp_vsimem / f"{i}_{j}.tif")
+            gdal.Translate(tile_filename, src_ds, srcWin=[i * 64, j * 32, 64, 32])
+            tiles_ds.append(gdal.Open(tile_filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles_ds)
+    del index_ds
+
+    vrt_ds = gdal.OpenEx(index_filename, open_options=["NUM_THREADS=" + num_threads])
+    assert vrt_ds.ReadRaster(1, 2, 250, 120) == src_ds.ReadRaster(1, 2, 250, 120)
+    assert (
+        vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == "0"
+    )
+
+    # Alternate between windows, to exercise the cache of spatial queries
+    for _ in range(2):
+        for band_idx in range(3):
+            assert vrt_ds.GetRasterBand(band_idx + 1).ReadRaster(
+                10, 10, 100, 50
+            ) == src_ds.GetRasterBand(band_idx + 1).ReadRaster(10, 10, 100, 50)
+            assert vrt_ds.GetRasterBand(band_idx + 1).ReadRaster(
+                100, 60, 100, 50
+            ) == src_ds.GetRasterBand(band_idx + 1).ReadRaster(100, 60, 100, 50)
+
+    # Errors of sources that cannot be opened are reported
+    del tiles_ds
+    vrt_ds = None
+    gdal.Unlink(str(tmp_vsimem / "1_1.tif"))
+    vrt_ds = gdal.OpenEx(index_filename, open_options=["NUM_THREADS=" + num_threads])
+    with gdal.quiet_errors():
+        gdal.ErrorReset()
+        vrt_ds.ReadRaster(1, 2, 250, 120)
+        assert "1_1.tif" in gdal.GetLastErrorMsg()
+
+
 ###############################################################################
 
 
@@ -1631,3 +1631,28 @@ def test_hdf5_open_larger_than_INT_MAX_pixels():
 
     with pytest.raises(Exception, match="At least one dimension size exceeds INT_MAX"):
         gdal.Open('HDF5:"data/bag/larger_than_INT_MAX_pixels.bag"://BAG_root/elevation')
+
+
+###############################################################################
+# Test that reading chunks without libhdf5 returns the same data as libhdf5
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        'HDF5:"data/hdf5/deflate.h5"://Band1',
+        "data/netcdf/trmm-nc4z.nc",
+        "data/netcdf/byte_hdf5_starting_at_offset_1024.nc",
+        'HDF5:"data/hdf5/dummy_HDFEOS_swath_chunked.h5"://HDFEOS/SWATHS/MySwath/Data_Fields/MyDataField',
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_hdf5_direct_chunk_read(filename, num_threads):
+    def read():
+        ds = gdal.OpenEx(filename, allowed_drivers=["HDF5"])
+        return [ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)]
+
+    with gdal.config_option("GDAL_HDF5_DIRECT_CHUNK_READ", "NO"):
+        expected = read()
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        assert read() == expected
@@ -405,6 +405,27 @@ def test_heif_tiled():
     ).all()
 
 
+def test_heif_tiled_multithreaded():
+    if not _has_tiling_support():
+        pytest.skip("no tiling support")
+    if not _has_uncompressed_decoding_support():
+        pytest.skip("no HEVC decoding support")
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ds = gdal.Open("data/heif/uncompressed_comp_RGB_tiled.heif")
+        expected = ds.ReadRaster()
+        expected_window = ds.ReadRaster(3, 4, 20, 12)
+        expected_band2 = ds.GetRasterBand(2).ReadRaster(3, 4, 20, 12)
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open("data/heif/uncompressed_comp_RGB_tiled.heif")
+        assert ds.ReadRaster() == expected
+        ds = gdal.Open("data/heif/uncompressed_comp_RGB_tiled.heif")
+        assert ds.GetRasterBand(2).ReadRaster(3, 4, 20, 12) == expected_band2
+        # Blocks of the other bands have been filled at the same time
+        assert ds.ReadRaster(3, 4, 20, 12) == expected_window
+
+
 def test_heif_subdatasets(tmp_path):
     if not _has_hevc_decoding_support():
         pytest.skip("no HEVC decoding support")
@@ -3743,6 +3743,39 @@ def test_jp2openjpeg_generate_TLM():
     gdaltest.jp2openjpeg_drv.Delete(filename)
 
 
+###############################################################################
+# Test multi-threaded reading of tiles, prefetched with the tile-part index
+# built from TLM marker segments or from the SOT marker segments
+
+
+@pytest.mark.parametrize("tlm", [False, True])
+def test_jp2openjpeg_multithreaded_read_tile_part_index(tmp_vsimem, tlm):
+
+    options = ["REVERSIBLE=YES", "QUALITY=100", "BLOCKXSIZE=64", "BLOCKYSIZE=64"]
+    if tlm:
+        if "TLM" not in gdaltest.jp2openjpeg_drv.GetMetadataItem(
+            "DMD_CREATIONOPTIONLIST"
+        ):
+            pytest.skip("TLM creation option not supported")
+        options.append("TLM=YES")
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=200, height=150
+    )
+    filename = str(tmp_vsimem / "out.jp2")
+    gdaltest.jp2openjpeg_drv.CreateCopy(filename, src_ds, options=options)
+    expected = src_ds.ReadRaster()
+
+    for i in range(2):
+        with gdal.config_option("GDAL_NUM_THREADS", "4"):
+            ds = gdal.Open(filename)
+            assert ds.ReadRaster() == expected
+            assert ds.GetRasterBand(2).ReadRaster(
+                10, 70, 150, 70
+            ) == src_ds.GetRasterBand(2).ReadRaster(10, 70, 150, 70)
+            ds = None
+
+
 ###############################################################################
 # Test STRICT=NO open option
 
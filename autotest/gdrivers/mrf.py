@@ -666,6 +666,43 @@ def test_mrf_setspatialref():
     gdal.GetDriverByName("MRF").Delete(filename)
 
 
+###############################################################################
+# Test multi-threaded decoding of the tiles of a RasterIO request
+
+
+@pytest.mark.parametrize("compression", ["DEFLATE", "ZSTD", "PNG", "LERC"])
+@pytest.mark.parametrize("interleave", ["BAND", "PIXEL_BUFFER"])
+def test_mrf_multithreaded_read(tmp_vsimem, compression, interleave):
+
+    if compression not in gdal.GetDriverByName("MRF").GetMetadataItem(
+        "DMD_CREATIONOPTIONLIST"
+    ):
+        pytest.skip(f"{compression} not available")
+
+    src_ds = gdal.Translate(
+        "", "data/byte.tif", format="MEM", width=200, height=160, bandList=[1, 1]
+    )
+    filename = str(tmp_vsimem / "out.mrf")
+    options = [f"COMPRESS={compression}", "BLOCKSIZE=32", "INTERLEAVE=BAND"]
+    gdal.GetDriverByName("MRF").CreateCopy(filename, src_ds, options=options)
+
+    def read():
+        ds = gdal.Open(filename)
+        if interleave == "BAND":
+            return [ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)]
+        return ds.ReadRaster(buf_pixel_space=2, buf_band_space=1)
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref = read()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert read() == ref
+    assert ref == (
+        [src_ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)]
+        if interleave == "BAND"
+        else src_ds.ReadRaster(buf_pixel_space=2, buf_band_space=1)
+    )
+
+
 def test_mrf_cleanup():
 
     files = (
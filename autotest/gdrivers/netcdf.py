@@ -6775,3 +6775,64 @@ def test_netcdf_read_rotated_pole_without_geogcrs_def():
     assert [x for x in ds.GetGeoTransform()] == pytest.approx(
         [144.0, 0.1, 0.0, -27.9, 0.0, -0.1]
     )
+
+
+###############################################################################
+# Test that the direct reader of classic files returns the same data as
+# libnetcdf
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/netcdf/byte.nc",
+        "data/netcdf/int16-nogeo.nc",
+        "data/netcdf/netcdf-4d.nc",
+        "data/netcdf/foo_5dimensional.nc",
+        "data/netcdf/extra_dim_unlimited.nc",
+        "data/netcdf/trmm-nc2.nc",
+    ],
+)
+def test_netcdf_classic_direct_read(filename):
+    def get_checksums():
+        ds = gdal.Open(filename)
+        return [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+
+    with gdal.config_option("GDAL_NETCDF_CLASSIC_DIRECT_READ", "NO"):
+        expected = get_checksums()
+    assert get_checksums() == expected
+
+
+###############################################################################
+# Test the direct reader of classic files on several record variables, whose
+# data is interleaved and padded
+
+
+def test_netcdf_classic_direct_read_record_vars(tmp_path):
+
+    filename = str(tmp_path / "test.nc")
+    drv = gdal.GetDriverByName("netCDF")
+    ds = drv.CreateMultiDimensional(filename, [], ["FORMAT=NC"])
+    rg = ds.GetRootGroup()
+    dim_t = rg.CreateDimension("t", None, None, 2, ["UNLIMITED=YES"])
+    dim_y = rg.CreateDimension("y", None, None, 3)
+    dim_x = rg.CreateDimension("x", None, None, 3)
+    for name, dt, fmt in [
+        ("a", gdal.GDT_Byte, "B"),
+        ("b", gdal.GDT_Int16, "h"),
+        ("c", gdal.GDT_Float64, "d"),
+    ]:
+        var = rg.CreateMDArray(
+            name, [dim_t, dim_y, dim_x], gdal.ExtendedDataType.Create(dt)
+        )
+        values = [i * (ord(name) - ord("a") + 1) for i in range(18)]
+        assert var.Write(struct.pack(fmt * 18, *values)) == gdal.CE_None
+    ds = None
+
+    for name in ("a", "b", "c"):
+        subds_name = f'NETCDF:"{filename}":{name}'
+        with gdal.config_option("GDAL_NETCDF_CLASSIC_DIRECT_READ", "NO"):
+            ds = gdal.Open(subds_name)
+            expected = [ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)]
+        ds = gdal.Open(subds_name)
+        assert [ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)] == expected
@@ -305,6 +305,66 @@ def test_stacit_post_paging(tmp_vsimem, webserver_port):
     )
 
 
+###############################################################################
+# Test fetching in advance pages of a GET paging by page number, and caching
+
+
+@pytest.mark.require_curl
+def test_stacit_get_paging_prefetch(tmp_vsimem, webserver_port):
+
+    url = f"http://localhost:{webserver_port}/get_paging_prefetch"
+    initial_doc = {
+        "type": "FeatureCollection",
+        "stac_version": "1.0.0-beta.2",
+        "stac_extensions": [],
+        "features": json.loads(open("data/stacit/test.json", "rb").read())["features"],
+        "links": [{"rel": "next", "href": f"{url}?limit=1&page=2"}],
+    }
+
+    filename = str(tmp_vsimem / "tmp.json")
+    gdal.FileFromMemBuffer(filename, json.dumps(initial_doc))
+
+    page_2_doc = {
+        "type": "FeatureCollection",
+        "features": json.loads(open("data/stacit/test_page2.json", "rb").read())[
+            "features"
+        ],
+        "links": [{"rel": "next", "href": f"{url}?limit=1&page=3"}],
+    }
+    page_3_doc = {"type": "FeatureCollection", "features": [], "links": []}
+
+    # Pages 4 and 5 do not exist, and their failure must be ignored
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "GET",
+        "/get_paging_prefetch?limit=1&page=2",
+        200,
+        {"Content-type": "application/json"},
+        json.dumps(page_2_doc),
+    )
+    handler.add(
+        "GET",
+        "/get_paging_prefetch?limit=1&page=3",
+        200,
+        {"Content-type": "application/json"},
+        json.dumps(page_3_doc),
+    )
+    handler.add("GET", "/get_paging_prefetch?limit=1&page=4", 404)
+    handler.add("GET", "/get_paging_prefetch?limit=1&page=5", 404)
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(filename, open_options=["MAX_CONNECTIONS=3"])
+    assert ds is not None
+    assert ds.RasterXSize == 40
+    assert ds.RasterYSize == 20
+
+    # Pages are now served from the cache
+    with webserver.install_http_handler(webserver.SequentialHandler()):
+        ds = gdal.OpenEx(filename, open_options=["MAX_CONNECTIONS=3"])
+    assert ds is not None
+    assert ds.RasterXSize == 40
+    assert ds.RasterYSize == 20
+
+
 ###############################################################################
 # Test force opening a STACIT file
 
@@ -125,6 +125,55 @@ def test_tiledb_write_rgb(tmp_path, mode):
     new_ds = None
 
 
+@pytest.mark.parametrize("mode", ["BAND", "PIXEL", "ATTRIBUTES"])
+def test_tiledb_read_multiband_single_query(tmp_path, mode):
+
+    src_ds = gdal.Open("../gcore/data/rgbsmall.tif")
+
+    dsname = str(tmp_path / "tiledb_rgb")
+    gdal.GetDriverByName("TileDB").CreateCopy(
+        dsname, src_ds, options=["INTERLEAVE=" + mode]
+    )
+
+    ds = gdal.Open(dsname)
+
+    # Windowed read of all bands, band subsets and band reordering, with
+    # and without data type conversion and in pixel-interleaved layout
+    for band_list in ([1, 2, 3], [3, 1], [1, 3], [2]):
+        for buf_type in (gdal.GDT_Byte, gdal.GDT_Float32):
+            for interleave in ("BAND", "PIXEL"):
+                kwargs = {}
+                if interleave == "PIXEL":
+                    dt_size = gdal.GetDataTypeSize(buf_type) // 8
+                    kwargs["buf_pixel_space"] = dt_size * len(band_list)
+                    kwargs["buf_line_space"] = 30 * dt_size * len(band_list)
+                    kwargs["buf_band_space"] = dt_size
+                got = ds.ReadRaster(
+                    3,
+                    5,
+                    30,
+                    20,
+                    buf_type=buf_type,
+                    band_list=band_list,
+                    **kwargs,
+                )
+                expected = src_ds.ReadRaster(
+                    3,
+                    5,
+                    30,
+                    20,
+                    buf_type=buf_type,
+                    band_list=band_list,
+                    **kwargs,
+                )
+                assert got == expected, (band_list, buf_type, interleave)
+
+    # Single band read with data type conversion
+    assert ds.GetRasterBand(2).ReadRaster(
+        3, 5, 30, 20, buf_type=gdal.GDT_Int16
+    ) == src_ds.GetRasterBand(2).ReadRaster(3, 5, 30, 20, buf_type=gdal.GDT_Int16)
+
+
 @pytest.mark.parametrize("mode", ["BAND", "PIXEL"])
 def test_tiledb_write_attributes(tmp_path, tmp_vsimem, mode):
     gdaltest.tiledb_drv = gdal.GetDriverByName("TileDB")
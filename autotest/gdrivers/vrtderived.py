@@ -1375,6 +1375,71 @@ def test_vrt_pixelfn_expression_coordinates_no_geotransform():
         gdal.Open(xml).ReadRaster()
 
 
+###############################################################################
+# Test that arithmetic expressions, that are evaluated on whole lines at once
+# and possibly in several threads, give the same result as the per-pixel
+# evaluation
+
+
+@pytest.mark.parametrize("dialect", ("exprtk", "muparser"))
+@pytest.mark.parametrize("num_threads", ("1", "4"))
+@pytest.mark.parametrize(
+    "expression",
+    [
+        "(B1 - B2) / (B1 + B2)",
+        "-B1 * 2.5 + sqrt(abs(B2 - NODATA)) / 3",
+    ],
+)
+def test_vrt_pixelfn_expression_vectorized(
+    tmp_vsimem, dialect, num_threads, expression
+):
+
+    if not gdaltest.gdal_has_vrt_expression_dialect(dialect):
+        pytest.skip(f"Expression dialect {dialect} is not available")
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    nx = 500
+    ny = 400
+    rng = np.random.default_rng(0)
+    for i in range(2):
+        data = rng.integers(0, 1000, size=(ny, nx), dtype=np.int16)
+        data[i :: 7, i :: 5] = -1
+        with gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / f"src{i}.tif", nx, ny, 1, gdal.GDT_Int16
+        ) as ds:
+            ds.GetRasterBand(1).WriteArray(data)
+
+    xml = f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+      <VRTRasterBand dataType="Float32" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>-1</NoDataValue>
+        <PixelFunctionType>expression</PixelFunctionType>
+        <PixelFunctionArguments expression="{expression}" dialect="{dialect}"
+                                propagateNoData="true" />
+        <SimpleSource>
+          <SourceFilename>{tmp_vsimem / "src0.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <SimpleSource>
+          <SourceFilename>{tmp_vsimem / "src1.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdaltest.config_option("VRT_VECTORIZED_EXPRESSION", "NO"):
+        with gdal.Open(xml) as ds:
+            expected = ds.ReadAsArray()
+
+    with gdaltest.config_option("VRT_NUM_THREADS", num_threads):
+        with gdal.Open(xml) as ds:
+            got = ds.ReadAsArray()
+
+    assert (expected == -1).any()
+    np.testing.assert_array_equal(got, expected)
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
@@ -2440,3 +2440,92 @@ def test_vrtpansharpen_slightly_different_extent(tmp_vsimem):
         for i in range(vrt_ds.RasterCount)
     ]
     assert mm == [(20.0, 20.0), (40.0, 40.0)]
+
+
+###############################################################################
+# Test the vectorized weighted Brovey kernels (nodata, floating-point types)
+# against a reference implementation, with multispectral bands at the
+# resolution of the panchromatic band.
+
+
+def _pansharpen_reference(pan, spectral, weights, out_bands, nodata, dt):
+    is_integer = dt != gdal.GDT_Float32
+    res = [[] for _ in out_bands]
+    for j in range(len(pan)):
+        vals = [band[j] for band in spectral]
+        if nodata is not None and (nodata in vals or pan[j] == nodata):
+            for i in range(len(out_bands)):
+                res[i].append(nodata)
+            continue
+        pseudo = sum(w * v for w, v in zip(weights, vals))
+        factor = pan[j] / pseudo if pseudo != 0 else 0
+        for i, b in enumerate(out_bands):
+            v = vals[b] * factor
+            if is_integer:
+                v = int(min(max(v + 0.5, 0), 255))
+                if v == nodata:
+                    v = nodata + 1
+            res[i].append(v)
+    return res
+
+
+@pytest.mark.parametrize(
+    "dt,nodata,nbands,nout",
+    [
+        (gdal.GDT_Byte, 0, 3, 3),
+        (gdal.GDT_Byte, 0, 4, 4),
+        (gdal.GDT_Float32, None, 4, 3),
+        (gdal.GDT_Float32, None, 3, 3),
+    ],
+)
+def test_vrtpansharpen_vectorized_kernels(dt, nodata, nbands, nout):
+
+    pan = [20, 1, 30, 0, 255, 10, 3, 8, 30, 25, 16]
+    spectral = [
+        [10, 1, 0, 50, 200, 5, 100, 7, 40, 100, 60],
+        [20, 100, 50, 50, 250, 5, 1, 8, 60, 90, 40],
+        [30, 1, 50, 50, 200, 5, 100, 9, 80, 80, 20],
+        [40, 2, 1, 50, 100, 5, 50, 10, 20, 70, 10],
+    ][:nbands]
+    weights = [0.25, 0.5, 0.25, 0.125][:nbands]
+    width = len(pan)
+
+    fmt = "B" if dt == gdal.GDT_Byte else "f"
+    pan_ds = gdal.GetDriverByName("MEM").Create("", width, 1, 1, dt)
+    pan_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    pan_ds.WriteRaster(0, 0, width, 1, struct.pack(fmt * width, *pan))
+    ms_ds = gdal.GetDriverByName("MEM").Create("", width, 1, nbands, dt)
+    ms_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    for i in range(nbands):
+        ms_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, width, 1, struct.pack(fmt * width, *spectral[i])
+        )
+
+    spectral_xml = "".join(
+        '<SpectralBand dstBand="%d"/>' % (i + 1) if i < nout else "<SpectralBand/>"
+        for i in range(nbands)
+    )
+    nodata_xml = "" if nodata is None else "<NoData>%d</NoData>" % nodata
+    vrt_ds = gdal.CreatePansharpenedVRT(
+        f"""<VRTDataset subClass="VRTPansharpenedDataset">
+        <PansharpeningOptions>
+            <AlgorithmOptions>
+                <Weights>{",".join(str(w) for w in weights)}</Weights>
+            </AlgorithmOptions>
+            {nodata_xml}
+            {spectral_xml}
+        </PansharpeningOptions>
+    </VRTDataset>""",
+        pan_ds.GetRasterBand(1),
+        [ms_ds.GetRasterBand(i + 1) for i in range(nbands)],
+    )
+    assert vrt_ds.RasterCount == nout
+
+    expected = _pansharpen_reference(
+        pan, spectral, weights, list(range(nout)), nodata, dt
+    )
+    for i in range(nout):
+        got = struct.unpack(
+            fmt * width, vrt_ds.GetRasterBand(i + 1).ReadRaster(0, 0, width, 1)
+        )
+        assert list(got) == pytest.approx(expected[i], rel=1e-6), i
@@ -1355,3 +1355,71 @@ def test_wms_iiif_fake_errors(tmp_vsimem, webserver_port):
         ):
             with webserver.install_http_handler(handler):
                 gdal.Open(f"IIIF:http://localhost:{webserver_port}/my_image")
+
+
+###############################################################################
+# Test the memory and write-behind file cache types
+
+
+def _wms_tms_cache_xml(webserver_port, cache):
+    return f"""<GDAL_WMS>
+    <Service name="TMS">
+        <ServerUrl>http://localhost:{webserver_port}/${{z}}/${{x}}/${{y}}.png</ServerUrl>
+    </Service>
+    <DataWindow>
+        <UpperLeftX>-20037508.34</UpperLeftX>
+        <UpperLeftY>20037508.34</UpperLeftY>
+        <LowerRightX>20037508.34</LowerRightX>
+        <LowerRightY>-20037508.34</LowerRightY>
+        <TileLevel>0</TileLevel>
+        <TileCountX>1</TileCountX>
+        <TileCountY>1</TileCountY>
+        <YOrigin>top</YOrigin>
+    </DataWindow>
+    <Projection>EPSG:3857</Projection>
+    <BlockSizeX>256</BlockSizeX>
+    <BlockSizeY>256</BlockSizeY>
+    <BandsCount>3</BandsCount>
+    {cache}
+</GDAL_WMS>"""
+
+
+@pytest.mark.require_curl
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize(
+    "cache",
+    [
+        "<Cache><Type>memory</Type></Cache>",
+        "<Cache><Path>{path}</Path><WriteBehind>true</WriteBehind></Cache>",
+    ],
+)
+@gdaltest.enable_exceptions()
+def test_wms_cache_types(tmp_vsimem, webserver_port, cache):
+
+    cache = cache.format(path=tmp_vsimem / "cache")
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 256, 256, 3)
+    src_ds.GetRasterBand(1).Fill(127)
+    src_ds.GetRasterBand(2).Fill(127)
+    src_ds.GetRasterBand(3).Fill(127)
+    gdal.Translate(tmp_vsimem / "tmp.png", src_ds)
+    with gdal.VSIFile(tmp_vsimem / "tmp.png", "rb") as f:
+        data = f.read()
+
+    xml = _wms_tms_cache_xml(webserver_port, cache)
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/0/0/0.png", 200, {"Content-type": "image/png"}, data)
+    with webserver.install_http_handler(handler):
+        ds = gdal.Open(xml)
+        assert ds.ReadRaster() == b"\x7F" * (256 * 256 * 3)
+        ds.Close()
+
+    # Served from the cache: no HTTP request expected
+    with webserver.install_http_handler(webserver.SequentialHandler()):
+        ds = gdal.Open(xml)
+        assert ds.ReadRaster() == b"\x7F" * (256 * 256 * 3)
+        ds.Close()
+
+    if "WriteBehind" in cache:
+        assert len(gdal.ReadDirRecursive(tmp_vsimem / "cache")) > 0
@@ -3725,6 +3725,61 @@ def test_zarr_pam_spatial_ref(tmp_vsimem):
     check_unset_crs()
 
 
+def test_zarr_pam_regular_spacing(tmp_vsimem):
+
+    filename = tmp_vsimem / "test.zarr"
+
+    with gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename) as ds:
+        rg = ds.GetRootGroup()
+        dim_time = rg.CreateDimension("time", None, None, 4)
+        dim_y = rg.CreateDimension("y", None, None, 2)
+        dim_x = rg.CreateDimension("x", None, None, 3)
+        for dim, values, dt in [
+            (dim_time, [0, 6, 12, 18], gdal.GDT_Int64),
+            (dim_y, [10.5, 9.5], gdal.GDT_Float64),
+            (dim_x, [1.5, 2.5, 3.5], gdal.GDT_Float64),
+        ]:
+            var = rg.CreateMDArray(
+                dim.GetName(), [dim], gdal.ExtendedDataType.Create(dt)
+            )
+            assert var.Write(values) == gdal.CE_None
+            dim.SetIndexingVariable(var)
+        rg.CreateMDArray(
+            "test",
+            [dim_time, dim_y, dim_x],
+            gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        )
+
+    def check(expected_time_values):
+        with gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER) as ds:
+            ar = ds.GetRootGroup().OpenMDArray("test")
+            classic_ds = ar.AsClassicDataset(2, 1)
+            assert classic_ds.GetGeoTransform() == (1, 1, 0, 11, 0, -1)
+            assert [
+                classic_ds.GetRasterBand(i + 1).GetMetadataItem("DIM_time_VALUE")
+                for i in range(classic_ds.RasterCount)
+            ] == expected_time_values
+
+    # Default: nothing cached
+    check(["0", "6", "12", "18"])
+    assert gdal.VSIStatL(filename / "pam.aux.xml") is None
+
+    with gdal.config_option("GDAL_MULTIDIM_CACHE_REGULAR_SPACING", "YES"):
+        check(["0", "6", "12", "18"])
+    content = gdal.VSIFile(filename / "pam.aux.xml", "rb").read().decode("utf-8")
+    assert '<Array name="/time">' in content
+    assert 'regular="1" start="0" increment="6" exact="1"' in content
+
+    # Check that the cached values are used instead of the array content
+    gdal.FileFromMemBuffer(
+        filename / "pam.aux.xml",
+        content.replace('start="0" increment="6"', 'start="1" increment="2"'),
+    )
+    with gdal.config_option("GDAL_MULTIDIM_CACHE_REGULAR_SPACING", "YES"):
+        check(["1", "3", "5", "7"])
+    check(["0", "6", "12", "18"])
+
+
 def test_zarr_read_too_large_tile_size(tmp_vsimem):
 
     j = {
@@ -4070,6 +4125,125 @@ def test_zarr_advise_read(tmp_path, compression, format):
     read()
 
 
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+def test_zarr_read_parallel_decoding(tmp_vsimem, format):
+
+    filename = tmp_vsimem / "test.zarr"
+
+    dim0_size = 50
+    dim1_size = 70
+    data = array.array("H", [(i * 7) % 65536 for i in range(dim0_size * dim1_size)])
+
+    with gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    ) as ds:
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+        dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["COMPRESS=GZIP", "BLOCKSIZE=10,20"],
+        )
+        assert ar.Write(data) == gdal.CE_None
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        with gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER) as ds:
+            ar = ds.GetRootGroup().OpenMDArray("test")
+            assert ar.Read() == data
+            assert ar.Read(
+                array_start_idx=[dim0_size - 1, dim1_size - 1],
+                count=[dim0_size, dim1_size],
+                array_step=[-1, -1],
+            ) == array.array("H", reversed(data))
+            got = ar.Read(array_start_idx=[5, 7], count=[20, 30], array_step=[2, 2])
+            assert got == array.array(
+                "H",
+                [
+                    data[(5 + 2 * y) * dim1_size + 7 + 2 * x]
+                    for y in range(20)
+                    for x in range(30)
+                ],
+            )
+
+        # Unflushed modified tiles must be taken into account
+        with gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE) as ds:
+            ar = ds.GetRootGroup().OpenMDArray("test")
+            assert (
+                ar.Write(
+                    array.array("H", [65535]), array_start_idx=[15, 25], count=[1, 1]
+                )
+                == gdal.CE_None
+            )
+            data[15 * dim1_size + 25] = 65535
+            assert ar.Read() == data
+
+
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+@pytest.mark.parametrize("dim_separator", [".", "/"])
+def test_zarr_write_parallel_encoding(tmp_vsimem, format, dim_separator):
+
+    dim0_size = 50
+    dim1_size = 70
+    data = array.array("H", [(i * 7) % 65536 for i in range(dim0_size * dim1_size)])
+
+    def create(filename):
+        with gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=" + format]
+        ) as ds:
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+            dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+            ar = rg.CreateMDArray(
+                "test",
+                [dim0, dim1],
+                gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+                [
+                    "COMPRESS=GZIP",
+                    "BLOCKSIZE=10,20",
+                    "DIM_SEPARATOR=" + dim_separator,
+                ],
+            )
+            assert ar.Write(data) == gdal.CE_None
+            # Partial tiles go through the same code path
+            assert (
+                ar.Write(
+                    array.array("H", [1] * (3 * 25)),
+                    array_start_idx=[12, 15],
+                    count=[3, 25],
+                )
+                == gdal.CE_None
+            )
+
+    create(tmp_vsimem / "ref.zarr")
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        create(tmp_vsimem / "test.zarr")
+
+    expected_data = array.array("H", data)
+    for y in range(12, 15):
+        for x in range(15, 40):
+            expected_data[y * dim1_size + x] = 1
+
+    with gdal.OpenEx(tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.Read() == expected_data
+
+    # Same set of tiles as when written sequentially
+    def list_tiles(dirname):
+        return sorted(
+            f
+            for f in gdal.ReadDirRecursive(dirname)
+            if not f.endswith("/")
+            and not os.path.basename(f).startswith(".")
+            and os.path.basename(f) != "zarr.json"
+        )
+
+    ref_tiles = list_tiles(tmp_vsimem / "ref.zarr" / "test")
+    assert len(ref_tiles) == 5 * 4
+    assert list_tiles(tmp_vsimem / "test.zarr" / "test") == ref_tiles
+
+
 def test_zarr_read_invalid_nczarr_dim(tmp_vsimem):
 
     gdal.Mkdir(tmp_vsimem / "test.zarr", 0)
@@ -5743,3 +5917,175 @@ def test_zarr_read_imagecodecs_tiff_errors(dirname):
     with pytest.raises(Exception):
         with gdal.Open(dirname) as ds:
             ds.ReadRaster()
+
+
+###############################################################################
+# Test Zarr V3 sharding_indexed codec
+
+
+def _crc32c(data):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x82F63B78 if crc & 1 else crc >> 1
+    return crc ^ 0xFFFFFFFF
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("corrupted_crc", [False, True])
+def test_zarr_read_sharding_v3(tmp_vsimem, corrupted_crc):
+
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [4, 4],
+        "data_type": "uint8",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [4, 4]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 255,
+        "codecs": [
+            {
+                "name": "sharding_indexed",
+                "configuration": {
+                    "chunk_shape": [2, 2],
+                    "codecs": [{"name": "bytes"}],
+                    "index_codecs": [
+                        {"name": "bytes", "configuration": {"endian": "little"}},
+                        {"name": "crc32c"},
+                    ],
+                    "index_location": "start",
+                },
+            }
+        ],
+    }
+    gdal.Mkdir(tmp_vsimem / "test.zarr", 0)
+    gdal.FileFromMemBuffer(tmp_vsimem / "test.zarr/zarr.json", json.dumps(j))
+
+    # Top-right inner chunk is missing
+    chunks = [
+        bytes([0, 1, 2, 3]),
+        None,
+        bytes([10, 11, 12, 13]),
+        bytes([20, 21, 22, 23]),
+    ]
+    index_size = 4 * 16 + 4
+    index = b""
+    offset = index_size
+    for chunk in chunks:
+        if chunk is None:
+            index += struct.pack("<QQ", (1 << 64) - 1, (1 << 64) - 1)
+        else:
+            index += struct.pack("<QQ", offset, len(chunk))
+            offset += len(chunk)
+    crc = _crc32c(index) ^ (1 if corrupted_crc else 0)
+    shard = index + struct.pack("<I", crc) + b"".join(c for c in chunks if c)
+    gdal.FileFromMemBuffer(tmp_vsimem / "test.zarr/c/0/0", shard)
+
+    expected = array.array(
+        "B", [0, 1, 255, 255, 2, 3, 255, 255, 10, 11, 20, 21, 12, 13, 22, 23]
+    )
+
+    if corrupted_crc:
+        with pytest.raises(Exception, match="checksum mismatch"):
+            with gdal.OpenEx(
+                tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER
+            ) as ds:
+                ds.GetRootGroup().OpenMDArray("test").Read()
+        return
+
+    # Read-only mode: blocks are the inner chunks
+    with gdal.Open(tmp_vsimem / "test.zarr") as ds:
+        assert ds.GetRasterBand(1).GetBlockSize() == [2, 2]
+        assert ds.ReadRaster() == expected.tobytes()
+
+    with gdal.OpenEx(tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.AdviseRead(options=["NUM_THREADS=2"]) == gdal.CE_None
+        assert ar.Read() == expected
+        assert ar.Read(array_start_idx=[1, 1], count=[2, 2]) == array.array(
+            "B", [3, 255, 11, 20]
+        )
+
+    # Update mode: blocks are the shards
+    with gdal.Open(tmp_vsimem / "test.zarr", gdal.GA_Update) as ds:
+        assert ds.GetRasterBand(1).GetBlockSize() == [4, 4]
+        assert ds.ReadRaster() == expected.tobytes()
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("compress", ["NONE", "GZIP"])
+def test_zarr_create_sharding_v3(tmp_vsimem, compress):
+
+    dim0_size = 20
+    dim1_size = 30
+    data = array.array("H", [i for i in range(dim0_size * dim1_size)])
+
+    with gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        tmp_vsimem / "test.zarr", options=["FORMAT=ZARR_V3"]
+    ) as ds:
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+        dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["BLOCKSIZE=10,16", "SHARD_INNER_BLOCKSIZE=5,4", "COMPRESS=" + compress],
+        )
+        assert ar.Write(data) == gdal.CE_None
+
+    f = gdal.VSIFOpenL(tmp_vsimem / "test.zarr/test/zarr.json", "rb")
+    assert f
+    data_json = gdal.VSIFReadL(1, 10000, f)
+    gdal.VSIFCloseL(f)
+    j = json.loads(data_json)
+    assert j["chunk_grid"]["configuration"]["chunk_shape"] == [10, 16]
+    assert len(j["codecs"]) == 1
+    assert j["codecs"][0]["name"] == "sharding_indexed"
+    config = j["codecs"][0]["configuration"]
+    assert config["chunk_shape"] == [5, 4]
+    assert config["codecs"][0]["name"] == "bytes"
+    assert len(config["codecs"]) == (1 if compress == "NONE" else 2)
+    assert config["index_location"] == "end"
+
+    # 2 x 2 shards
+    assert gdal.VSIStatL(tmp_vsimem / "test.zarr/test/c/1/1")
+    assert gdal.VSIStatL(tmp_vsimem / "test.zarr/test/c/2/0") is None
+
+    with gdal.OpenEx(tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.GetBlockSize() == [5, 4]
+        assert ar.Read() == data
+        assert ar.AdviseRead(options=["NUM_THREADS=4"]) == gdal.CE_None
+        assert ar.Read() == data
+
+    with gdal.OpenEx(
+        tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE
+    ) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.GetBlockSize() == [10, 16]
+        assert (
+            ar.Write(
+                array.array("H", [65535]), array_start_idx=[12, 17], count=[1, 1]
+            )
+            == gdal.CE_None
+        )
+
+    data[12 * dim1_size + 17] = 65535
+    with gdal.OpenEx(tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.Read() == data
+
+    with pytest.raises(Exception, match="SHARD_INNER_BLOCKSIZE"):
+        with gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            tmp_vsimem / "test2.zarr", options=["FORMAT=ZARR_V3"]
+        ) as ds:
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+            rg.CreateMDArray(
+                "test",
+                [dim0],
+                gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+                ["BLOCKSIZE=10", "SHARD_INNER_BLOCKSIZE=3"],
+            )
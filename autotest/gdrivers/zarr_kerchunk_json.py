@@ -785,3 +785,55 @@ def test_vsikerchunk_json_ref_create_copy(tmp_vsimem):
     rg = ds.GetRootGroup()
     ar = rg.OpenMDArray("x")
     assert ar.Read() == b"\x01"
+
+
+###############################################################################
+# Test "gdal driver zarr kerchunk-create"
+
+
+@pytest.mark.require_driver("HDF5")
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/hdf5/deflate.h5",
+        "data/hdf5/u8be.h5",
+        "data/netcdf/trmm-nc4z.nc",
+        "data/netcdf/byte_hdf5_starting_at_offset_1024.nc",
+    ],
+)
+@pytest.mark.parametrize("output_format", ["JSON", "PARQUET"])
+def test_zarr_kerchunk_create(tmp_path, filename, output_format):
+
+    if output_format == "PARQUET" and gdal.GetDriverByName("PARQUET") is None:
+        pytest.skip("PARQUET driver not available")
+
+    out_filename = str(
+        tmp_path / ("out.json" if output_format == "JSON" else "out.parq")
+    )
+    alg = gdal.GetGlobalAlgorithmRegistry()["driver"]["zarr"]["kerchunk-create"]
+    alg["input"] = filename
+    alg["output"] = out_filename
+    assert alg.Run()
+    assert alg.Finalize()
+
+    with pytest.raises(Exception, match="already exists"):
+        alg = gdal.GetGlobalAlgorithmRegistry()["driver"]["zarr"]["kerchunk-create"]
+        alg["input"] = filename
+        alg["output"] = out_filename
+        alg.Run()
+
+    src_ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER, allowed_drivers=["HDF5"])
+    src_rg = src_ds.GetRootGroup()
+    dst_ds = gdal.OpenEx(f'ZARR:"{out_filename}"', gdal.OF_MULTIDIM_RASTER)
+    dst_rg = dst_ds.GetRootGroup()
+    array_names = src_rg.GetMDArrayFullNamesRecursive()
+    assert array_names
+    for name in array_names:
+        src_ar = src_rg.OpenMDArrayFromFullname(name)
+        dst_ar = dst_rg.OpenMDArrayFromFullname(name)
+        assert dst_ar, name
+        assert [dim.GetSize() for dim in dst_ar.GetDimensions()] == [
+            dim.GetSize() for dim in src_ar.GetDimensions()
+        ]
+        assert dst_ar.GetDataType() == src_ar.GetDataType()
+        assert dst_ar.Read() == src_ar.Read(), name
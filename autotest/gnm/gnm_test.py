@@ -165,6 +165,36 @@ def test_gnm_graph_kshortest():
     dn = None
 
 
+###############################################################################
+# Check that changes of the block state are taken into account by the
+# shortest path searches run after a first one
+
+
+def test_gnm_graph_dijkstra_block_state():
+
+    ds = gdal.OpenEx("tmp/test_gnm", gdal.OF_UPDATE)
+    dn = gnm.CastToGenericNetwork(ds)
+    assert dn is not None, "cast to GNMGenericNetwork failed"
+
+    def get_path_gfids():
+        lyr = dn.GetPath(61, 50, gnm.GATDijkstraShortestPath)
+        assert lyr is not None, "failed to get path"
+        gfids = [f["gnm_fid"] for f in lyr]
+        dn.ReleaseResultSet(lyr)
+        return gfids
+
+    path = get_path_gfids()
+    assert len(path) > 2
+
+    assert dn.ChangeBlockState(path[len(path) // 2], True) == gdal.CE_None
+    assert get_path_gfids() != path
+
+    assert dn.ChangeAllBlockState(False) == gdal.CE_None
+    assert get_path_gfids() == path
+
+    dn = None
+
+
 ###############################################################################
 # ConnectedComponents
 
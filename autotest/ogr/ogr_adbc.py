@@ -260,6 +260,32 @@ def test_ogr_adbc_duckdb_parquet():
         assert lyr.GetFeatureCount() == 3
 
 
+###############################################################################
+# Test NUM_THREADS open option. Falls back to non-partitioned execution if the
+# ADBC driver does not support it
+
+
+@pytest.mark.skipif(
+    not _has_duckdb_driver(),
+    reason="duckdb driver missing",
+)
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_ogr_adbc_duckdb_parquet_num_threads(num_threads):
+
+    with gdal.OpenEx(
+        "data/parquet/partitioned_flat/part.0.parquet",
+        gdal.OF_VECTOR,
+        allowed_drivers=["ADBC"],
+        open_options=["NUM_THREADS=" + num_threads],
+    ) as ds:
+        lyr = ds.GetLayer(0)
+        assert len([f for f in lyr]) == 3
+        lyr.ResetReading()
+        assert len([f for f in lyr]) == 3
+        with ds.ExecuteSQL("SELECT * FROM part.0") as sql_lyr:
+            assert len([f for f in sql_lyr]) == 3
+
+
 ###############################################################################
 
 
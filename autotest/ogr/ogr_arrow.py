@@ -16,6 +16,7 @@ import json
 import math
 
 import gdaltest
+import ogrtest
 import pytest
 
 from osgeo import gdal, ogr, osr
@@ -381,6 +382,27 @@ def test_ogr_arrow_write_compression(compression):
     gdal.Unlink(outfilename)
 
 
+###############################################################################
+# Test NUM_THREADS layer creation option
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_ogr_arrow_write_num_threads(tmp_vsimem, num_threads):
+
+    outfilename = str(tmp_vsimem / "out.feather")
+    gdal.VectorTranslate(
+        outfilename,
+        "data/poly.shp",
+        format="Arrow",
+        layerCreationOptions=["BATCH_SIZE=3", "NUM_THREADS=" + num_threads],
+    )
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    src_ds = ogr.Open("data/poly.shp")
+    ogrtest.compare_layers(src_ds.GetLayer(0), lyr)
+
+
 ###############################################################################
 # Read invalid file .arrow
 
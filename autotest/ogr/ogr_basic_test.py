@@ -1237,3 +1237,45 @@ def test_driver_open_throw_2():
 
         with pytest.raises(RuntimeError, match="not recognized"):
             drv.Open("data/poly.shp")
+
+
+###############################################################################
+# Test spatial filtering of points against a polygon filter with a hole
+
+
+@pytest.mark.parametrize("driver_name", ["MEM", "GPKG"])
+def test_ogr_basic_spatial_filter_points_in_polygon(tmp_vsimem, driver_name):
+
+    drv = gdal.GetDriverByName(driver_name)
+    if drv is None:
+        pytest.skip(f"{driver_name} driver not available")
+
+    ds = drv.CreateVector(tmp_vsimem / "test.gpkg")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("name"))
+    for name, wkt in [
+        ("inside", "POINT (1 1)"),
+        ("in_hole", "POINT (5 5)"),
+        ("on_exterior_ring", "POINT (0 5)"),
+        ("on_hole_boundary", "POINT (4 5)"),
+        ("outside_in_bbox", "POINT (15 5)"),
+        ("inside_second_part", "POINT (21 1)"),
+        ("outside", "POINT (100 100)"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["name"] = name
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+
+    lyr.SetSpatialFilter(
+        ogr.CreateGeometryFromWkt(
+            "MULTIPOLYGON (((0 0,0 10,10 10,10 0,0 0),(4 4,4 6,6 6,6 4,4 4)),"
+            "((20 0,20 2,22 2,22 0,20 0)))"
+        )
+    )
+    assert [f["name"] for f in lyr] == [
+        "inside",
+        "on_exterior_ring",
+        "on_hole_boundary",
+        "inside_second_part",
+    ]
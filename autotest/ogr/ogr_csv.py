@@ -3567,6 +3567,134 @@ def test_ogr_csv_do_not_write_header(tmp_vsimem):
         assert lyr.GetFeatureCount() == 10
 
 
+###############################################################################
+# Test CREATE SPATIAL INDEX / DROP SPATIAL INDEX
+
+
+def test_ogr_csv_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "WKT,i,comment\n"
+    for i in range(1000):
+        wkt = "" if i == 10 else "POINT (%d %d)" % (i % 100, i // 100)
+        # Records spanning several lines
+        comment = '"multi\nline"' if i % 7 == 0 else "x"
+        content += '"%s",%d,%s\n' % (wkt, i, comment)
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_results(lyr):
+        lyr.SetSpatialFilterRect(10, 2, 11, 3)
+        ret = [(f.GetFID(), f["i"], f["comment"]) for f in lyr]
+        lyr.SetSpatialFilter(None)
+        return ret
+
+    expected = [
+        (i + 1, str(i), "multi\nline" if i % 7 == 0 else "x")
+        for i in (210, 211, 310, 311)
+    ]
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_results(lyr) == expected
+
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+        assert gdal.VSIStatL(filename + ".ogrsidx") is not None
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_results(lyr) == expected
+        assert lyr.GetFeatureCount() == 1000
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_results(lyr) == expected
+        assert filename + ".ogrsidx" in ds.GetFileList()
+
+        lyr.SetSpatialFilterRect(-1, -1, 1000, 1000)
+        assert [f["i"] for f in lyr] == [str(i) for i in range(1000) if i != 10]
+
+        lyr.SetIgnoredFields(["comment"])
+        assert get_results(lyr) == [(fid, i, None) for fid, i, _ in expected]
+
+    with ogr.Open(filename, update=1) as ds:
+        with pytest.raises(Exception, match="read-only"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+
+    # Modify the file: the index must be ignored
+    gdal.FileFromMemBuffer(filename, content + '"POINT (10.5 2.5)",1000,x\n')
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_results(lyr) == expected + [(1001, "1000", "x")]
+
+        ds.ExecuteSQL("DROP SPATIAL INDEX ON test")
+        assert gdal.VSIStatL(filename + ".ogrsidx") is None
+
+
+###############################################################################
+# Test multithreaded reading
+
+
+def test_ogr_csv_multithreaded_reading(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "WKT,i,r,comment\n"
+    for i in range(5000):
+        wkt = "" if i == 10 else "POINT (%d %d)" % (i % 100, i // 100)
+        # Records spanning several lines
+        comment = '"multi\nline, ""quoted"""' if i % 7 == 0 else "x"
+        # Values not matching the field type
+        r = "bad" if i == 4321 else "%d.5" % i
+        content += '"%s",%d,%s,%s\n' % (wkt, i, r, comment)
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_results(lyr):
+        return [
+            (
+                f.GetFID(),
+                f["i"],
+                f["r"],
+                f["comment"],
+                f.GetGeometryRef().ExportToWkt() if f.GetGeometryRef() else None,
+            )
+            for f in lyr
+        ]
+
+    def open_ds():
+        return gdal.OpenEx(
+            filename,
+            open_options=["AUTODETECT_TYPE=YES", "AUTODETECT_SIZE_LIMIT=1000"],
+        )
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        with open_ds() as ds:
+            with gdal.quiet_errors():
+                expected = get_results(ds.GetLayer(0))
+    assert len(expected) == 5000
+    assert expected[7] == (8, 7, 7.5, 'multi\nline, "quoted"', "POINT (7 0)")
+    assert expected[4321][2] is None
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "OGR_CSV_MULTITHREADING_MIN_FILE_SIZE": "0"}
+    ):
+        with open_ds() as ds:
+            lyr = ds.GetLayer(0)
+            with gdal.quiet_errors():
+                assert get_results(lyr) == expected
+
+                lyr.ResetReading()
+                for _ in range(2500):
+                    lyr.GetNextFeature()
+                assert lyr.GetFeature(10)["i"] == 9
+                assert lyr.GetNextFeature().GetFID() == 11
+                assert get_results(lyr) == expected
+
+                lyr.ResetReading()
+                lyr.GetNextFeature()
+                lyr.SetIgnoredFields(["comment"])
+                assert [f["comment"] for f in lyr] == [None] * 4999
+
+
 ###############################################################################
 
 
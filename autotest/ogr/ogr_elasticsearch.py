@@ -3471,3 +3471,72 @@ def test_ogr_elasticsearch_upsert_feature(es_url, handle_get, handle_post):
     assert gdal.GetLastErrorMsg() == ""
 
     ds = None
+
+
+###############################################################################
+# Test BULK_CONCURRENCY
+
+
+@pytest.mark.parametrize("bulk_concurrency", [1, 2, 3])
+def test_ogr_elasticsearch_bulk_concurrency(
+    es_url, handle_get, handle_post, bulk_concurrency
+):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"6.8.0"}}""")
+
+    ds = ogrtest.elasticsearch_drv.CreateDataSource(f"{es_url}/fakeelasticsearch")
+    assert ds is not None
+
+    handle_get(
+        "/fakeelasticsearch/test_bulk",
+        "{}",
+    )
+
+    handle_post(
+        "/fakeelasticsearch/test_bulk/_mapping/FeatureCollection",
+        post_body='{ "FeatureCollection": { "properties": {} }}',
+        contents="{}",
+    )
+
+    # A tiny BULK_SIZE so that each feature triggers a _bulk request
+    lyr = ds.CreateLayer(
+        "test_bulk",
+        srs=ogrtest.srs_wgs84,
+        options=[
+            'MAPPING={ "FeatureCollection": { "properties": {} }}',
+            "BULK_SIZE=1",
+            f"BULK_CONCURRENCY={bulk_concurrency}",
+        ],
+    )
+    assert lyr is not None
+
+    for i in range(1, 5):
+        # The request for the last feature will fail
+        if i < 4:
+            handle_post(
+                """/fakeelasticsearch/_bulk""",
+                post_body=f"""{{"index" :{{"_index":"test_bulk", "_type":"FeatureCollection","_id":"id{i}"}}}}
+{{ "ogc_fid": {i}, "properties": {{ }} }}
+
+""",
+                contents="{}",
+            )
+
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(i)
+        f["_id"] = f"id{i}"
+        with gdal.quiet_errors():
+            ret = lyr.CreateFeature(f)
+        if i < 4 or bulk_concurrency == 1:
+            assert ret == (ogr.OGRERR_NONE if i < 4 else ogr.OGRERR_FAILURE)
+
+    gdal.ErrorReset()
+    with gdal.quiet_errors():
+        ret = lyr.SyncToDisk()
+    if bulk_concurrency == 1:
+        assert ret == ogr.OGRERR_NONE
+    else:
+        assert ret != ogr.OGRERR_NONE
+        assert gdal.GetLastErrorMsg() != ""
+
+    ds = None
@@ -1167,6 +1167,74 @@ def test_ogr_flatgeobuf_arrow_stream_empty_file():
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that WKB geometries returned by GetArrowStream() are the ones of
+# GetNextFeature()
+
+
+@pytest.mark.parametrize(
+    "wkts",
+    [
+        ["POINT (1 2)", "POINT Z (1 2 3)", "POINT M (1 2 4)", "POINT ZM (1 2 3 4)"],
+        ["MULTIPOINT ((1 2),(3 4))", "MULTIPOINT Z ((1 2 3),(4 5 6))"],
+        ["LINESTRING (1 2,3 4,5 6)", "LINESTRING ZM (1 2 3 4,5 6 7 8)"],
+        [
+            "MULTILINESTRING ((1 2,3 4),(5 6,7 8,9 10))",
+            "MULTILINESTRING ((1 2,3 4))",
+            "MULTILINESTRING M ((1 2 3,4 5 6),(7 8 9,10 11 12))",
+        ],
+        [
+            "POLYGON ((0 0,0 10,10 10,0 0))",
+            "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))",
+            "POLYGON Z ((0 0 1,0 10 2,10 10 3,0 0 1))",
+        ],
+        [
+            "MULTIPOLYGON (((0 0,0 10,10 10,0 0)),((20 20,20 30,30 30,20 20),(21 21,21 22,22 22,21 21)))",
+            "MULTIPOLYGON Z (((0 0 1,0 10 2,10 10 3,0 0 1)))",
+        ],
+        ["CIRCULARSTRING (0 0,1 1,2 0)", "GEOMETRYCOLLECTION (POINT (1 2))"],
+    ],
+)
+@pytest.mark.parametrize("spatial_filter", [False, True])
+def test_ogr_flatgeobuf_arrow_stream_numpy_geometries(
+    tmp_vsimem, wkts, spatial_filter
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    for i, wkt in enumerate(wkts):
+        g = ogr.CreateGeometryFromWkt(wkt)
+        with ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer("test", geom_type=g.GetGeometryType())
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetGeometry(g)
+            lyr.CreateFeature(f)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            lyr.CreateFeature(f)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetGeometry(g)
+            lyr.CreateFeature(f)
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            if spatial_filter:
+                lyr.SetSpatialFilterRect(0.5, 0.5, 1.5, 2.5)
+            expected = [
+                f.GetGeometryRef().ExportToIsoWkb() if f.GetGeometryRef() else None
+                for f in lyr
+            ]
+
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            got = []
+            for batch in stream:
+                got += [
+                    bytes(wkb) if wkb is not None else None
+                    for wkb in batch["wkb_geometry"]
+                ]
+            assert got == expected, (wkt, i)
+
+
 def test_ogr_flatgeobuf_issue_7401():
     # Verify null geom handling without spatial index
     ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource("/vsimem/test.fgb")
@@ -1650,3 +1718,48 @@ def test_ogr_flatgeobuf_write_empty_file_no_spatial_index(tmp_vsimem):
         assert lyr.GetFeatureCount() == 0
         assert lyr.GetExtent(can_return_null=True) is None
         assert lyr.GetSpatialRef().GetAuthorityCode(None) == "32631"
+
+
+###############################################################################
+# Test that the spatial index built by several threads is the same as with a
+# single one
+
+
+def test_ogr_flatgeobuf_write_spatial_index_multithreaded(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.csv")
+    nfeatures = 120000
+    gdal.FileFromMemBuffer(
+        src_filename,
+        "x,y\n"
+        + "".join(
+            f"{(i * 7919) % 1000},{(i * 104729) % 997}\n" for i in range(nfeatures)
+        ),
+    )
+
+    def write(num_threads):
+        out_filename = str(tmp_vsimem / f"out_{num_threads}.fgb")
+        src_ds = gdal.OpenEx(
+            src_filename, open_options=["X_POSSIBLE_NAMES=x", "Y_POSSIBLE_NAMES=y"]
+        )
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            gdal.VectorTranslate(out_filename, src_ds, format="FlatGeobuf")
+        with gdal.VSIFile(out_filename, "rb") as f:
+            return out_filename, f.read()
+
+    _, ref = write("1")
+    out_filename, got = write("4")
+    assert got == ref
+
+    with ogr.Open(out_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == nfeatures
+        lyr.SetSpatialFilterRect(10.5, 20.5, 60.5, 70.5)
+        got_count = sum(1 for _ in lyr)
+    expected_count = sum(
+        1
+        for i in range(nfeatures)
+        if 10.5 <= (i * 7919) % 1000 <= 60.5 and 20.5 <= (i * 104729) % 997 <= 70.5
+    )
+    assert expected_count > 0
+    assert got_count == expected_count
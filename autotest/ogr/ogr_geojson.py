@@ -5947,3 +5947,121 @@ def test_ogr_geojson_sqlite_dialect_id_property():
             f = sql_lyr.GetNextFeature()
             assert f["id"] == 5
             assert f["foo"] == "bar"
+
+
+###############################################################################
+# Test reading the features of a FeatureCollection with several threads
+
+
+def test_ogr_geojson_multithreaded_reading(tmp_vsimem):
+
+    features = []
+    for i in range(5000):
+        features.append(
+            {
+                "type": "Feature",
+                # Duplicated id
+                "id": 5 if i == 3000 else i,
+                "properties": {
+                    "str": 'with "}]{' if i % 7 == 0 else str(i),
+                    "i": i,
+                },
+                "geometry": (
+                    None
+                    if i % 11 == 0
+                    else {"type": "Point", "coordinates": [i, -i]}
+                ),
+            }
+        )
+        if i == 1234:
+            # Not a Feature: ignored
+            features.append({"type": "Dummy"})
+    j = {
+        "type": "FeatureCollection",
+        "name": "test",
+        "features": features,
+        "foo": {"features": [{"type": "Feature"}]},
+    }
+    filename = tmp_vsimem / "test.geojson"
+    gdal.FileFromMemBuffer(filename, json.dumps(j))
+
+    def read(num_threads):
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "OGR_GEOJSON_MULTITHREADING_MIN_FILE_SIZE": "0",
+            }
+        ):
+            with ogr.Open(filename) as ds:
+                lyr = ds.GetLayer(0)
+                assert lyr.GetFeatureCount() == 5000
+                for _ in range(2):
+                    with gdal.quiet_errors():
+                        ret = [
+                            (f.GetFID(), f["str"], f["i"], f.GetGeometryRef())
+                            for f in lyr
+                        ]
+                    lyr.ResetReading()
+                f = lyr.GetFeature(4999)
+                assert f["i"] == 4999
+                return [
+                    (fid, s, i, g.ExportToWkt() if g else None)
+                    for (fid, s, i, g) in ret
+                ]
+
+    ref = read("1")
+    assert len(ref) == 5000
+    assert ref[1] == (1, "1", 1, "POINT (1 -1)")
+    assert ref[7] == (7, 'with "}]{', 7, "POINT (7 -7)")
+    assert ref[11][3] is None
+    assert len(set(x[0] for x in ref)) == 5000
+    assert read("4") == ref
+
+
+###############################################################################
+# Test that features encoded by several threads are written in order
+
+
+def test_ogr_geojson_multithreaded_writing(tmp_vsimem):
+    def write(num_threads):
+        filename = str(tmp_vsimem / f"test_{num_threads}.geojson")
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "OGR_GEOJSON_WRITE_MULTITHREADING_MIN_FEATURES": "10",
+            }
+        ):
+            with ogr.GetDriverByName("GeoJSON").CreateDataSource(filename) as ds:
+                lyr = ds.CreateLayer(
+                    "test",
+                    options=[
+                        "ID_GENERATE=YES",
+                        'FOREIGN_MEMBERS_FEATURE={"foo":"bar"}',
+                    ],
+                )
+                lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+                lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+                for i in range(2500):
+                    f = ogr.Feature(lyr.GetLayerDefn())
+                    f["str"] = str(i)
+                    f["i"] = i
+                    if i % 11 != 0:
+                        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {-i})"))
+                    assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+                    if i == 1500:
+                        assert lyr.SyncToDisk() == ogr.OGRERR_NONE
+                assert lyr.GetExtent() == (1, 2499, -2499, -1)
+        with gdal.VSIFile(filename, "rb") as f:
+            return filename, f.read()
+
+    _, ref = write("1")
+    filename, got = write("4")
+    assert got == ref
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 2500
+        f = lyr.GetFeature(2000)
+        assert f["str"] == "2000"
+        assert f["i"] == 2000
+        assert f.GetGeometryRef().ExportToWkt() == "POINT (2000 -2000)"
@@ -522,3 +522,74 @@ def test_ogr_geojsonseq_WRITE_BBOX(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"bbox": [ 2.0, 49.0, 3.0, 50.0 ]' in data
+
+
+###############################################################################
+# Test CREATE SPATIAL INDEX / DROP SPATIAL INDEX
+
+
+@pytest.mark.parametrize("rs", [False, True])
+@pytest.mark.parametrize("chunk_size", [None, "100"])
+def test_ogr_geojsonseq_spatial_index(tmp_vsimem, rs, chunk_size):
+
+    filename = str(tmp_vsimem / ("test.geojsons" if rs else "test.geojsonl"))
+    sep = "\x1e" if rs else ""
+    content = ""
+    for i in range(1000):
+        if i == 10:
+            geom = "null"
+        else:
+            geom = '{"type":"Point","coordinates":[%d,%d]}' % (i % 100, i // 100)
+        content += sep
+        content += '{"type":"Feature","properties":{"i":%d},"geometry":%s}\n' % (
+            i,
+            geom,
+        )
+        if i == 500:
+            content += "\n"
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_results(lyr):
+        lyr.SetSpatialFilterRect(10, 2, 11, 3)
+        ret = [(f.GetFID(), f["i"]) for f in lyr]
+        lyr.SetSpatialFilter(None)
+        return ret
+
+    expected = [(i, i) for i in (210, 211, 310, 311)]
+
+    with gdaltest.config_option("OGR_GEOJSONSEQ_CHUNK_SIZE", chunk_size):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+            assert get_results(lyr) == expected
+
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON " + lyr.GetName())
+            assert gdal.VSIStatL(filename + ".ogrsidx") is not None
+            assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+            assert get_results(lyr) == expected
+            assert lyr.GetFeatureCount() == 1000
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+            assert get_results(lyr) == expected
+            lyr.SetSpatialFilterRect(-1, -1, 1000, 1000)
+            assert [f["i"] for f in lyr] == [i for i in range(1000) if i != 10]
+            lyr.SetSpatialFilterRect(1000, 1000, 1001, 1001)
+            assert lyr.GetNextFeature() is None
+
+        # Modify the file: the index must be ignored
+        with ogr.Open(filename, update=1) as ds:
+            lyr = ds.GetLayer(0)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = 1000
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (10.5 2.5)"))
+            lyr.CreateFeature(f)
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+            assert get_results(lyr) == expected + [(1000, 1000)]
+
+            ds.ExecuteSQL("DROP SPATIAL INDEX ON " + lyr.GetName())
+            assert gdal.VSIStatL(filename + ".ogrsidx") is None
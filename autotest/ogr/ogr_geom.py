@@ -708,6 +708,35 @@ def test_ogr_geom_transform():
     ), geom.ExportToWkt()
 
 
+###############################################################################
+# Test Transform() with partial reprojection on a curve with M values
+
+
+@gdaltest.disable_exceptions()
+def test_ogr_geom_transform_partial_reprojection_m():
+
+    sr = osr.SpatialReference()
+    sr.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    sr.ImportFromEPSG(4326)
+
+    sr2 = osr.SpatialReference()
+    sr2.ImportFromEPSG(3857)
+
+    ct = osr.CoordinateTransformation(sr, sr2)
+
+    geom = ogr.CreateGeometryFromWkt("LINESTRING M (0 0 10,0 90 20,1 0 30)")
+    with gdal.quiet_errors():
+        assert geom.Transform(ct) != 0
+    assert geom.GetPointCount() == 3
+
+    with gdaltest.config_option("OGR_ENABLE_PARTIAL_REPROJECTION", "YES"):
+        assert geom.Transform(ct) == 0
+    assert geom.GetPointCount() == 2
+    assert geom.GetX(1) == pytest.approx(111319.49, abs=1e-2)
+    assert geom.GetM(0) == 10
+    assert geom.GetM(1) == 30
+
+
 ###############################################################################
 # Test Transform() from a geographic CRS to WGS 84 (https://github.com/OSGeo/gdal/issues/5660)
 
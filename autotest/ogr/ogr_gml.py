@@ -5025,3 +5025,47 @@ def test_ogr_gml_write_error(tmp_vsimem):
     with pytest.raises(Exception, match="Could not write line"):
         lyr.CreateFeature(f)
     ds.Close()
+
+
+###############################################################################
+# Test that building geometries in worker threads gives the same result as
+# the sequential code path
+
+
+def test_ogr_gml_read_multithreaded(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.gml")
+    ds = ogr.GetDriverByName("GML").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPolygon)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 100 != 50:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON(({i} 0,{i} 1,{i + 1} 1,{i + 1} 0,{i} 0))"
+                )
+            )
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    def read_features():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        ret = []
+        for f in lyr:
+            g = f.GetGeometryRef()
+            ret.append((f["id"], g.ExportToWkt() if g else None))
+        lyr.ResetReading()
+        assert lyr.GetNextFeature()["id"] == 0
+        lyr.SetSpatialFilterRect(1000.5, 0, 1001.5, 1)
+        assert [f["id"] for f in lyr] == [1000, 1001]
+        return ret
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        expected = read_features()
+    assert len(expected) == 2000
+    assert expected[50] == (50, None)
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert read_features() == expected
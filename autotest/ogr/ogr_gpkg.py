@@ -5544,6 +5544,52 @@ def test_ogr_gpkg_nolock(tmp_path):
     assert ds
 
 
+###############################################################################
+# Test MMAP_SIZE open option
+
+
+@pytest.mark.parametrize("in_vsimem", [False, True])
+def test_ogr_gpkg_mmap_size(tmp_path, tmp_vsimem, in_vsimem):
+
+    filename = str((tmp_vsimem if in_vsimem else tmp_path) / "test.gpkg")
+
+    ds = gdaltest.gpkg_dr.CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.StartTransaction()
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "value %d" % i + "x" * (i % 100)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    ds = None
+
+    def get_features(ds):
+        lyr = ds.GetLayer(0)
+        return [(f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    with ogr.Open(filename) as ds:
+        expected = get_features(ds)
+
+    with gdal.quiet_errors():
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["MMAP_SIZE=-1"])
+    assert ds
+    ds = None
+
+    # Several datasets on the same file
+    ds1 = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["MMAP_SIZE=100000000"])
+    ds2 = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["MMAP_SIZE=100000000"])
+    with ds1.ExecuteSQL("PRAGMA mmap_size") as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        # May be capped to 0 if SQLite has been built without mmap support
+        assert f.GetField(0) in (0, 100000000)
+    assert get_features(ds1) == expected
+    assert get_features(ds2) == expected
+    ds1 = None
+    ds2 = None
+
+
 ###############################################################################
 # Run test_ogrsf
 
@@ -11151,3 +11197,183 @@ def test_ogr_gpkg_append_to_layer_feature_count_int64_max(tmp_vsimem):
             assert not f.IsFieldSetAndNotNull("feature_count")
         lyr = ds.GetLayer(0)
         assert lyr.GetFeatureCount() == 2
+
+
+###############################################################################
+# Test Layer.FillNextFeature()
+
+
+def test_ogr_gpkg_fill_next_feature(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    gdal.VectorTranslate(filename, "data/poly.shp")
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        expected = {f.GetFID(): f for f in lyr}
+
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for filter in (None, "EAS_ID > 170"):
+            lyr.SetAttributeFilter(filter)
+            lyr.ResetReading()
+            got = []
+            while lyr.FillNextFeature(f):
+                got.append(f.Clone())
+            assert len(got) == lyr.GetFeatureCount()
+            for got_f in got:
+                assert got_f.Equal(expected[got_f.GetFID()])
+
+        with ds.ExecuteSQL("SELECT * FROM poly") as sql_lyr:
+            f = ogr.Feature(sql_lyr.GetLayerDefn())
+            count = 0
+            while sql_lyr.FillNextFeature(f):
+                ref_f = expected[f.GetFID()]
+                assert f.GetField("EAS_ID") == ref_f.GetField("EAS_ID")
+                assert f.GetGeometryRef().Equals(ref_f.GetGeometryRef())
+                count += 1
+            assert count == len(expected)
+
+
+###############################################################################
+# Test WriteArrowBatch() with geometries encoded by worker threads
+
+
+def test_ogr_gpkg_write_arrow_batch_multithreaded(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.gpkg")
+    with ogr.GetDriverByName("GPKG").CreateDataSource(src_filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+        lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+        lyr.StartTransaction()
+        for i in range(5000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = i
+            f["s"] = "foo%d" % i
+            if i == 10:
+                pass
+            elif i == 11:
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT EMPTY"))
+            elif i == 4321:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt("CIRCULARSTRING (0 0,1 1,2 0)")
+                )
+            elif i % 2 == 0:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        "POINT (%d %d)" % (i % 100, i // 100)
+                    )
+                )
+            else:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        "LINESTRING Z (%d %d 1,%d %d 2)"
+                        % (i % 100, i // 100, i % 100 + 1, i // 100 + 1)
+                    )
+                )
+            lyr.CreateFeature(f)
+        lyr.CommitTransaction()
+
+    def get_results(filename):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            ret = [
+                (
+                    f.GetFID(),
+                    f["i"],
+                    f["s"],
+                    f.GetGeometryRef().ExportToIsoWkt()
+                    if f.GetGeometryRef()
+                    else None,
+                )
+                for f in lyr
+            ]
+            lyr.SetSpatialFilterRect(10, 2, 11, 3)
+            filtered = [f.GetFID() for f in lyr]
+            with ds.ExecuteSQL(
+                "SELECT extension_name FROM gpkg_extensions "
+                "WHERE table_name = 'test'"
+            ) as sql_lyr:
+                extensions = sorted(f.GetField(0) for f in sql_lyr)
+            return ret, filtered, lyr.GetExtent(), extensions
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        gdal.VectorTranslate(tmp_vsimem / "expected.gpkg", src_filename)
+    expected = get_results(tmp_vsimem / "expected.gpkg")
+    assert len(expected[0]) == 5000
+    assert expected[0][10][3] is None
+    assert 211 in expected[1]
+    assert "gpkg_geom_CIRCULARSTRING" in expected[3]
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "OGR2OGR_USE_ARROW_API": "YES"}
+    ):
+        gdal.VectorTranslate(tmp_vsimem / "out.gpkg", src_filename)
+    assert get_results(tmp_vsimem / "out.gpkg") == expected
+
+
+###############################################################################
+# Test evaluating a spatial filter in worker threads with GetArrowStream()
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_ogr_gpkg_arrow_stream_spatial_filter_multithreaded(tmp_vsimem, num_threads):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.StartTransaction()
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = f"str{i}"
+        f["int"] = i
+        x = (i * 37) % 100
+        y = i // 50
+        if i != 1234:
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({x} {y})"))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    ds = None
+
+    # Triangle, so that many RTree candidates are rejected by the exact test
+    filter_wkt = "POLYGON((-0.5 -0.5,90.5 -0.5,-0.5 90.5,-0.5 -0.5))"
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilter(ogr.CreateGeometryFromWkt(filter_wkt))
+    expected_fids = sorted(f.GetFID() for f in lyr)
+    assert len(expected_fids) > 0
+
+    for ignored_fields in ([], ["str"]):
+        lyr.SetIgnoredFields(ignored_fields)
+        with gdaltest.config_option("OGR_GPKG_NUM_THREADS", str(num_threads)):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            batches = [batch for batch in stream]
+        assert all(len(batch["fid"]) > 0 for batch in batches)
+        got_fids = []
+        for batch in batches:
+            assert ("str" in batch) == (ignored_fields == [])
+            for j, fid in enumerate(batch["fid"]):
+                got_fids.append(fid)
+                i = fid - 1
+                assert batch["int"][j] == i
+                if ignored_fields == []:
+                    assert batch["str"][j] == f"str{i}".encode("ascii")
+                geom = ogr.CreateGeometryFromWkb(batch["geom"][j])
+                assert geom.ExportToIsoWkt() == f"POINT ({(i * 37) % 100} {i // 50})"
+        assert sorted(got_fids) == expected_fids
+    lyr.SetIgnoredFields([])
+
+    # Spatial filter that rejects the only candidate of the RTree, POINT (1 1)
+    if ogrtest.have_geos():
+        lyr.SetSpatialFilter(
+            ogr.CreateGeometryFromWkt("POLYGON((0.6 0.6,1.3 0.6,0.6 1.3,0.6 0.6))")
+        )
+        with gdaltest.config_option("OGR_GPKG_NUM_THREADS", str(num_threads)):
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            assert len([batch for batch in stream]) == 0
@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,43 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test a join on integer fields, resolved with a hash table
+
+
+@pytest.mark.parametrize("hash_join", ["YES", "NO"])
+def test_ogr_join_integer_key_hash_join(hash_join):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+    lyr1.CreateField(ogr.FieldDefn("a"))
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("key", ogr.OFTInteger64))
+    lyr2.CreateField(ogr.FieldDefn("b"))
+    for key, a in [(3, "a1"), (None, "a2"), (1, "a3"), (5, "a4"), (3, "a5")]:
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        if key is not None:
+            f["key"] = key
+        f["a"] = a
+        lyr1.CreateFeature(f)
+    for key, b in [(1, "b1"), (None, "b2"), (3, "b3"), (3, "b4"), (4, "b5")]:
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        if key is not None:
+            f["key"] = key
+        f["b"] = b
+        lyr2.CreateFeature(f)
+
+    with gdaltest.config_option("OGR_GENSQL_HASH_JOIN", hash_join):
+        with ds.ExecuteSQL(
+            "SELECT a, b FROM lyr1 LEFT JOIN lyr2 ON lyr2.key = lyr1.key"
+        ) as sql_lyr:
+            assert [(f["a"], f["b"]) for f in sql_lyr] == [
+                ("a1", "b3"),
+                ("a2", None),
+                ("a3", "b1"),
+                ("a4", None),
+                ("a5", "b3"),
+            ]
@@ -3017,3 +3017,188 @@ def test_ogr_mem_extent():
             0.01796630538796444,
         )
     )
+
+
+###############################################################################
+# Test spatial filtering with the in-memory spatial index, and its maintenance
+# when features are modified
+
+
+@pytest.mark.parametrize("use_map", [False, True])
+def test_ogr_mem_spatial_index(use_map):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateGeomField(ogr.GeomFieldDefn("geom2", ogr.wkbPoint))
+    # A large FID gap makes the layer store its features in a map
+    fid_offset = 1000000 if use_map else 0
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(i + (fid_offset if i >= 500 else 0))
+        f.SetGeomField(0, ogr.CreateGeometryFromWkt(f"POINT({i % 100} {i // 100})"))
+        f.SetGeomField(1, ogr.CreateGeometryFromWkt(f"POINT({i} 0)"))
+        lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    def get_fids(iGeomField, minx, miny, maxx, maxy):
+        res = {}
+        for use_index in ("YES", "NO"):
+            with gdal.config_option("OGR_MEM_SPATIAL_INDEX", use_index):
+                lyr.SetSpatialFilterRect(iGeomField, minx, miny, maxx, maxy)
+                res[use_index] = [f.GetFID() for f in lyr]
+                lyr.SetSpatialFilter(None)
+        assert res["YES"] == res["NO"]
+        return res["YES"]
+
+    assert get_fids(0, 9.5, 1.5, 10.5, 2.5) == [210]
+    assert get_fids(0, 98.5, 8.5, 100, 10) == [fid_offset + 999]
+    assert get_fids(1, 9.5, -1, 10.5, 1) == [10]
+    assert len(get_fids(0, 0, 0, 1000, 1000)) == 1000
+
+    # Modify the geometry of a feature with SetFeature()
+    f = lyr.GetFeature(210)
+    f.SetGeomField(0, ogr.CreateGeometryFromWkt("POINT(1000 1000)"))
+    assert lyr.SetFeature(f) == ogr.OGRERR_NONE
+    assert get_fids(0, 9.5, 1.5, 10.5, 2.5) == []
+    assert get_fids(0, 999, 999, 1001, 1001) == [210]
+
+    # with UpdateFeature()
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetFID(211)
+    f.SetGeomField(0, ogr.CreateGeometryFromWkt("POINT(1000 1000)"))
+    assert lyr.UpdateFeature(f, [], [0], False) == ogr.OGRERR_NONE
+    assert get_fids(0, 999, 999, 1001, 1001) == [210, 211]
+
+    # Delete a feature
+    assert lyr.DeleteFeature(210) == ogr.OGRERR_NONE
+    assert get_fids(0, 999, 999, 1001, 1001) == [211]
+
+    # Add a feature
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeomField(0, ogr.CreateGeometryFromWkt("POINT(1000 1000)"))
+    lyr.CreateFeature(f)
+    assert get_fids(0, 999, 999, 1001, 1001) == [211, f.GetFID()]
+
+    # Combined with an attribute filter and GetFeatureCount()
+    lyr.SetAttributeFilter("FID > 211")
+    lyr.SetSpatialFilterRect(0, 999, 999, 1001, 1001)
+    assert lyr.GetFeatureCount() == 1
+    lyr.SetSpatialFilter(None)
+    lyr.SetAttributeFilter(None)
+
+
+###############################################################################
+# Test attribute filtering with in-memory attribute indexes created with
+# CREATE INDEX, and their maintenance when features are modified
+
+
+@pytest.mark.parametrize("use_map", [False, True])
+def test_ogr_mem_attribute_index(use_map):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    # A large FID gap makes the layer store its features in a map
+    fid_offset = 1000000 if use_map else 0
+    for i in range(200):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(i + (fid_offset if i >= 100 else 0))
+        if i % 10 != 0:
+            f["int"] = i % 50
+            f["int64"] = (i % 50) * 10000000000
+            f["real"] = (i % 50) / 2
+            f["str"] = ("A" if i % 2 else "a") + "%02d" % (i % 50)
+        lyr.CreateFeature(f)
+
+    queries = [
+        "int = 5",
+        "int IN (5, 7, 5, 100)",
+        "int < 3",
+        "int <= 3",
+        "int > 47",
+        "int >= 47.5",
+        "int < 2.5",
+        "int BETWEEN 10 AND 12",
+        "int BETWEEN 12 AND 10",
+        "int > 5 AND int < 8",
+        "int < 2 OR int > 48",
+        "int64 >= 490000000000",
+        "int64 < 1e10",
+        "real > 24",
+        "real BETWEEN 1 AND 2",
+        "real = 1.5",
+        "str = 'A05'",
+        "str < 'a03'",
+        "str >= 'A48'",
+        "str BETWEEN 'a10' AND 'A11'",
+        "str IN ('a02', 'A04')",
+        "int > 45 AND str < 'a48'",
+    ]
+
+    def get_fids():
+        res = []
+        for query in queries:
+            lyr.SetAttributeFilter(query)
+            res.append([f.GetFID() for f in lyr])
+        lyr.SetAttributeFilter(None)
+        return res
+
+    ref = get_fids()
+    assert ref[0] == [5, 55, 105 + fid_offset, 155 + fid_offset]
+
+    for field in ("int", "int64", "real", "str"):
+        ds.ExecuteSQL(f"CREATE INDEX ON test USING {field}")
+    with pytest.raises(Exception, match="already have an index"):
+        ds.ExecuteSQL("CREATE INDEX ON test USING int")
+    assert get_fids() == ref
+
+    # Modify a feature with SetFeature()
+    f = lyr.GetFeature(5)
+    f["int"] = 1000
+    f["str"] = "zzz"
+    assert lyr.SetFeature(f) == ogr.OGRERR_NONE
+    lyr.SetAttributeFilter("int = 1000")
+    assert [f.GetFID() for f in lyr] == [5]
+    lyr.SetAttributeFilter("str > 'z'")
+    assert [f.GetFID() for f in lyr] == [5]
+
+    # with UpdateFeature()
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetFID(6)
+    f["int"] = 1000
+    assert lyr.UpdateFeature(f, [0], [], False) == ogr.OGRERR_NONE
+    lyr.SetAttributeFilter("int >= 1000")
+    assert [f.GetFID() for f in lyr] == [5, 6]
+
+    # Delete a feature
+    assert lyr.DeleteFeature(5) == ogr.OGRERR_NONE
+    lyr.SetAttributeFilter("int >= 1000")
+    assert [f.GetFID() for f in lyr] == [6]
+    assert lyr.GetFeatureCount() == 1
+
+    # Combined with a spatial filter
+    new_f = ogr.Feature(lyr.GetLayerDefn())
+    new_f["int"] = 1000
+    new_f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(1 2)"))
+    lyr.CreateFeature(new_f)
+    lyr.SetSpatialFilterRect(0, 0, 10, 10)
+    assert [f.GetFID() for f in lyr] == [new_f.GetFID()]
+    lyr.SetSpatialFilter(None)
+    lyr.SetAttributeFilter(None)
+
+    ds.ExecuteSQL("DROP INDEX ON test USING int")
+    lyr.SetAttributeFilter("int >= 1000")
+    assert lyr.GetFeatureCount() == 2
+
+    # Deleting a field drops the indexes
+    assert lyr.DeleteField(0) == ogr.OGRERR_NONE
+    lyr.SetAttributeFilter("str > 'z'")
+    assert lyr.GetFeatureCount() == 0
+    lyr.SetAttributeFilter(None)
+    ds.ExecuteSQL("CREATE INDEX ON test USING str")
+    lyr.SetAttributeFilter("str = 'a11'")
+    assert lyr.GetFeatureCount() == 4
@@ -1796,3 +1796,55 @@ def test_ogr_mvt_write_custom_tiling_scheme_WorldCRS84Quad(tmp_vsimem, TILING_SC
         ogrtest.check_feature_geometry(
             out_f, "MULTIPOINT ((120.0146484375 39.990234375))"
         )
+
+
+###############################################################################
+# Test that encoding tiles in worker threads gives the same result as the
+# single-threaded code path
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+def test_ogr_mvt_write_multithreaded_encoding(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    for layer_name in ("layer_a", "layer_b"):
+        lyr = src_ds.CreateLayer(layer_name)
+        lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+        lyr.CreateField(ogr.FieldDefn("realfield", ogr.OFTReal))
+        for i in range(1000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["strfield"] = "val%d" % (i % 7)
+            f["realfield"] = i * 0.5
+            x = -10000000 + (i % 40) * 500000
+            y = -5000000 + (i // 40) * 400000
+            if i % 3 == 0:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({x} {y})"))
+            else:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        f"LINESTRING({x} {y},{x + 300000 + i} {y + 200000})"
+                    )
+                )
+            lyr.CreateFeature(f)
+
+    def generate(num_threads):
+        out_filename = f"{tmp_vsimem}/out_{num_threads}"
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            gdal.VectorTranslate(
+                out_filename,
+                src_ds,
+                format="MVT",
+                datasetCreationOptions=["MAXZOOM=3", "COMPRESS=NO", "MAX_FEATURES=20"],
+            )
+        files = {}
+        for filename in gdal.ReadDirRecursive(out_filename):
+            if not filename.endswith("/"):
+                with gdal.VSIFile(f"{out_filename}/{filename}", "rb") as fp:
+                    files[filename] = fp.read()
+        return files
+
+    ref = generate("1")
+    assert "metadata.json" in ref
+    assert "3/2/3.pbf" in ref
+    assert generate("4") == ref
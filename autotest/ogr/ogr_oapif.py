@@ -388,6 +388,65 @@ def test_ogr_oapif_fc_links_next_geojson():
 ###############################################################################
 
 
+def test_ogr_oapif_prefetch_pages():
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/oapif/collections",
+        200,
+        {"Content-Type": "application/json"},
+        '{ "collections" : [ { "name": "foo" }] }',
+    )
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            "OAPIF:http://localhost:%d/oapif" % gdaltest.webserver_port,
+            gdal.OF_VECTOR,
+            open_options=["PREFETCH_PAGES=2"],
+        )
+    lyr = ds.GetLayer(0)
+
+    def page(val, next_href=None):
+        links = (
+            '"links": [ { "rel": "next", "type": "application/geo+json", '
+            '"href": "%s" } ],' % next_href
+            if next_href
+            else ""
+        )
+        return (
+            '{ "type": "FeatureCollection", %s "features": [ { "type": "Feature", '
+            '"properties": { "foo": "%s" } } ] }' % (links, val)
+        )
+
+    handler = webserver.SequentialHandler()
+    _add_dummy_root_and_api_pages(handler)
+    handler.add(
+        "GET",
+        "/oapif/collections/foo/items?limit=20",
+        200,
+        {"Content-Type": "application/geo+json"},
+        page("bar"),
+    )
+    # The second and third pages are downloaded in a background thread
+    for path, val, next_href in [
+        ("/oapif/collections/foo/items?limit=1000", "bar", "/oapif/foo_next"),
+        ("/oapif/foo_next", "baz", "/oapif/foo_next2"),
+        ("/oapif/foo_next2", "baz2", None),
+    ]:
+        handler.add(
+            "GET",
+            path,
+            200,
+            {"Content-Type": "application/geo+json"},
+            page(val, next_href),
+        )
+    with webserver.install_http_handler(handler):
+        assert [f["foo"] for f in lyr] == ["bar", "baz", "baz2"]
+
+
+###############################################################################
+
+
 def test_ogr_oapif_id_is_integer():
 
     handler = webserver.SequentialHandler()
@@ -2967,3 +2967,69 @@ def test_ogr_openfilegdb_vsizip_random_zip_name_and_no_gdb_subdir():
 
     with ogr.Open("/vsizip/data/filegdb/testopenfilegdb.zip") as ds:
         assert ds.GetLayerCount() == 37
+
+
+###############################################################################
+# Test the specialized implementation of GetArrowStream()
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+        "data/filegdb/testdatetimeutc.gdb",
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream(filename):
+    pytest.importorskip("pyarrow")
+
+    def get_rows(lyr, options=[]):
+        stream = lyr.GetArrowStreamAsPyArrow(options)
+        rows = []
+        num_batches = 0
+        for batch in stream:
+            rows += batch.to_pylist()
+            num_batches += 1
+        return rows, num_batches
+
+    with ogr.Open(filename) as ds:
+        for lyr in ds:
+            # Reference result from the generic implementation
+            lyr.SetAttributeFilter("1 = 1")
+            expected_rows, _ = get_rows(lyr)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH",
+                    "__DEBUG__",
+                )
+                == "NO"
+            )
+            lyr.SetAttributeFilter(None)
+
+            rows, _ = get_rows(lyr)
+            # Time fields and fields with a domain are not handled by the
+            # specialized implementation
+            has_unhandled_field = any(
+                fld_defn.GetType() == ogr.OFTTime or fld_defn.GetDomainName()
+                for fld_defn in lyr.schema
+            )
+            assert lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH",
+                "__DEBUG__",
+            ) == ("NO" if has_unhandled_field else "YES"), lyr.GetName()
+            assert rows == expected_rows, lyr.GetName()
+
+            if len(expected_rows) > 1:
+                rows, num_batches = get_rows(lyr, ["MAX_FEATURES_IN_BATCH=1"])
+                assert num_batches == len(expected_rows)
+                assert rows == expected_rows, lyr.GetName()
+
+                with gdal.config_option("OGR_ARROW_MEM_LIMIT", "1"):
+                    rows, num_batches = get_rows(lyr)
+                assert rows == expected_rows, lyr.GetName()
+
+            rows, _ = get_rows(lyr, ["INCLUDE_FID=NO"])
+            for row in expected_rows:
+                del row[lyr.GetFIDColumn() or "OGC_FID"]
+            assert rows == expected_rows, lyr.GetName()
@@ -1748,6 +1748,58 @@ def test_ogr_openfilegdb_write_attribute_index(tmp_vsimem):
     ds = None
 
 
+###############################################################################
+# Test AND / OR trees and IN lists evaluated through several attribute indexes
+
+
+def test_ogr_openfilegdb_write_attribute_index_and_or(tmp_vsimem):
+
+    dirname = tmp_vsimem / "out.gdb"
+
+    ds = ogr.GetDriverByName("OpenFileGDB").CreateDataSource(dirname)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("a", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("b", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("c", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["a"] = i % 100
+        f["b"] = (i * 7) % 1000 / 10.0
+        if i % 5 != 0:
+            f["c"] = i % 3
+        lyr.CreateFeature(f)
+    # Create holes in the table
+    for fid in range(1, 1000, 17):
+        lyr.DeleteFeature(fid)
+    ds.ExecuteSQL("CREATE INDEX idx_a ON test(a)")
+    ds.ExecuteSQL("CREATE INDEX idx_b ON test(b)")
+    ds.ExecuteSQL("CREATE INDEX idx_c ON test(c)")
+    ds = None
+
+    ds = ogr.Open(dirname)
+    lyr = ds.GetLayer(0)
+
+    def get_fids(filter):
+        lyr.SetAttributeFilter(filter)
+        fids = [f.GetFID() for f in lyr]
+        assert lyr.GetFeatureCount() == len(fids)
+        return fids
+
+    for filter in [
+        "a >= 10 AND a < 20 AND b > 30",
+        "a < 10 OR b > 90",
+        "(a = 5 OR a = 50) AND NOT (b < 50)",
+        "a IN (1, 3, 5, 7, 11, 13, 17, 19, 23)",
+        "a IN (1, 3, 5) OR c IN (1, 2)",
+        "a BETWEEN 10 AND 12 OR c IS NULL",
+        "a <> 5 AND b < 10",
+        "a > 1000 OR b > 1000",
+    ]:
+        fids = get_fids(filter)
+        with gdaltest.config_option("OPENFILEGDB_USE_INDEX", "NO"):
+            assert fids == get_fids(filter), filter
+
+
 ###############################################################################
 
 
@@ -937,3 +937,51 @@ def test_ogr_osmconf_ini():
             config.read_file(open(osmconf_ini_filename))
             assert "general" in config
             assert "closed_ways_are_polygons" in config["general"]
+
+
+###############################################################################
+# Test that resolving the nodes of ways in worker threads gives the same
+# result as the single-threaded code path
+
+
+@pytest.mark.parametrize("compress_nodes", ["NO", "YES"])
+def test_ogr_osm_ways_multithreaded(tmp_vsimem, compress_nodes):
+
+    if not ogrtest.osm_drv_parse_osm:
+        pytest.skip("Expat support missing")
+
+    nodes_per_way = 10
+    num_ways = 12000
+    content = ['<osm version="0.6" generator="test">']
+    for i in range(num_ways * nodes_per_way):
+        lon = -180 + (i % 36000) / 100.0
+        lat = -80 + (i // 36000) / 10.0
+        content.append(f'<node id="{i + 1}" lat="{lat}" lon="{lon}"/>')
+    for i in range(num_ways):
+        content.append(f'<way id="{i + 1}"><tag k="highway" v="road"/>')
+        for j in range(nodes_per_way):
+            # Reference a missing node in a few ways
+            node_id = i * nodes_per_way + j + 1
+            if i % 1000 == 999 and j == 5:
+                node_id += 10 * num_ways * nodes_per_way
+            content.append(f'<nd ref="{node_id}"/>')
+        content.append("</way>")
+    content.append("</osm>")
+    filename = f"{tmp_vsimem}/test.osm"
+    gdal.FileFromMemBuffer(filename, "\n".join(content))
+
+    def get_lines(num_threads):
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "OSM_COMPRESS_NODES": compress_nodes,
+            }
+        ):
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayerByName("lines")
+            return [(f["osm_id"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    ref = get_lines("1")
+    assert len(ref) == num_ways
+    assert ref[0][1].startswith("LINESTRING (-180 -80,-179.99 -80,")
+    assert get_lines("4") == ref
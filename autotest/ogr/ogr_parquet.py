@@ -842,6 +842,30 @@ def test_ogr_parquet_compression_level(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test NUM_THREADS layer creation option
+
+
+def test_ogr_parquet_write_num_threads(tmp_vsimem):
+
+    gdal.VectorTranslate(
+        tmp_vsimem / "out1.parquet",
+        "data/poly.shp",
+        layerCreationOptions=["ROW_GROUP_SIZE=3", "NUM_THREADS=1"],
+    )
+    gdal.VectorTranslate(
+        tmp_vsimem / "out4.parquet",
+        "data/poly.shp",
+        layerCreationOptions=["ROW_GROUP_SIZE=3", "NUM_THREADS=4"],
+    )
+
+    ds1 = ogr.Open(str(tmp_vsimem / "out1.parquet"))
+    ds4 = ogr.Open(str(tmp_vsimem / "out4.parquet"))
+    lyr4 = ds4.GetLayer(0)
+    assert lyr4.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "4"
+    ogrtest.compare_layers(ds1.GetLayer(0), lyr4)
+
+
 ###############################################################################
 # Test coordinate epoch support
 
@@ -1662,6 +1686,58 @@ def test_ogr_parquet_is_null():
         gdal.Unlink(outfilename)
 
 
+###############################################################################
+# Test IN lists, and reading row groups concurrently
+
+
+@pytest.mark.parametrize("concurrent_row_groups", ["1", "4"])
+def test_ogr_parquet_in_list_and_concurrent_row_groups(
+    tmp_vsimem, concurrent_row_groups
+):
+
+    outfilename = str(tmp_vsimem / "out.parquet")
+    with ogr.GetDriverByName("Parquet").CreateDataSource(outfilename) as ds:
+        lyr = ds.CreateLayer(
+            "test", geom_type=ogr.wkbNone, options=["ROW_GROUP_SIZE=10"]
+        )
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(1000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = i
+            f["real"] = i + 0.5
+            f["str"] = "%04d" % i
+            lyr.CreateFeature(f)
+
+    with gdaltest.config_options(
+        {
+            "OGR_PARQUET_USE_THREADS": "YES",
+            "OGR_PARQUET_CONCURRENT_ROW_GROUPS": concurrent_row_groups,
+        }
+    ):
+        ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+
+    assert [f["int"] for f in lyr] == list(range(1000))
+    assert [f["int"] for f in lyr] == list(range(1000))
+
+    for filter, expected in [
+        ("int IN (517, 5, 17)", [5, 17, 517]),
+        ("int IN (5, 17) AND int >= 10", [17]),
+        ("real IN (5.5, 17.5)", [5, 17]),
+        ("str IN ('0123', '0999')", [123, 999]),
+        (
+            "int NOT IN (5, 17) AND int < 20",
+            [i for i in range(20) if i not in (5, 17)],
+        ),
+        ("int IN (5, 17) OR int = 999", [5, 17, 999]),
+    ]:
+        with ogrtest.attribute_filter(lyr, filter):
+            assert [f["int"] for f in lyr] == expected, filter
+            assert lyr.GetFeatureCount() == len(expected), filter
+
+
 ###############################################################################
 # Test reading a flat partitioned dataset
 
@@ -2383,6 +2459,53 @@ def test_ogr_parquet_arrow_stream_numpy_fast_attribute_filter(filter):
         assert fc != 0
 
 
+###############################################################################
+# Test that the evaluation of attribute filters directly on Arrow columns
+# gives the same result as the generic evaluator
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "uint8 > 2 AND int8 <= 0",
+        "2 < uint8",
+        "int16 BETWEEN -10000 AND 10000",
+        "uint16 IN (10001, 2, 10003)",
+        "int32 <> -1000000000 AND uint32 >= 1000000001",
+        "int64 IN (-100000000000, 1)",
+        "float32 < 3 AND float64 > 1.5",
+        "float64 BETWEEN 1 AND 3",
+        "int8 = 0.0",
+        "int8 IS NULL AND NOT (float64 IS NULL)",
+        "int8 IS NOT NULL AND int8 < 100",
+        "uint8 = 2 OR int8 = 0",
+    ],
+)
+def test_ogr_parquet_arrow_stream_numpy_columnar_attribute_filter(filter):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open("data/parquet/test.parquet")
+    lyr = ds.GetLayer(0)
+    ignored_fields = ["decimal128", "decimal256", "time64_ns"]
+    lyr_defn = lyr.GetLayerDefn()
+    for i in range(lyr_defn.GetFieldCount()):
+        fld_defn = lyr_defn.GetFieldDefn(i)
+        if fld_defn.GetName().startswith("map_"):
+            ignored_fields.append(fld_defn.GetNameRef())
+    lyr.SetIgnoredFields(ignored_fields)
+
+    def get_values():
+        lyr.SetAttributeFilter(filter)
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+        return [v for batch in stream for v in batch["int16"]]
+
+    with gdal.config_option("OGR_SQL_COMPILE_WHERE", "NO"):
+        expected = get_values()
+    assert get_values() == expected
+    assert len(expected) == lyr.GetFeatureCount()
+
+
 ###############################################################################
 
 
@@ -3936,6 +4059,76 @@ def test_ogr_parquet_geoarrow(
         assert lyr.GetFeatureCount() != 0
 
 
+###############################################################################
+# Check that ogr2ogr copies GeoArrow struct encoded geometries without
+# converting them through WKB, and falls back to WKB otherwise
+
+
+@pytest.mark.parametrize(
+    "wkt",
+    [
+        "POINT (1 2)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,1 9,9 9,9 1,1 1))",
+        "MULTIPOLYGON (((0 1,2 3,10 20,0 1)),((100 110,100 120,120 120,100 110)))",
+    ],
+)
+@pytest.mark.parametrize("dst_encoding", ["GEOARROW", "GEOARROW_INTERLEAVED", "WKB"])
+@gdaltest.enable_exceptions()
+def test_ogr_parquet_geoarrow_ogr2ogr(tmp_vsimem, wkt, dst_encoding):
+
+    geom = ogr.CreateGeometryFromWkt(wkt)
+
+    src_filename = str(tmp_vsimem / "src.parquet")
+    with ogr.GetDriverByName("Parquet").CreateDataSource(src_filename) as ds:
+        lyr = ds.CreateLayer(
+            "test",
+            geom_type=geom.GetGeometryType(),
+            options=["GEOMETRY_ENCODING=GEOARROW", "GEOMETRY_NAME=geom"],
+        )
+        lyr.CreateField(ogr.FieldDefn("foo"))
+        for g in [geom, None, ogr.Geometry(geom.GetGeometryType()), geom]:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["foo"] = "bar"
+            f.SetGeometry(g)
+            lyr.CreateFeature(f)
+
+    dst_filename = str(tmp_vsimem / "dst.parquet")
+    gdal.VectorTranslate(
+        dst_filename,
+        src_filename,
+        layerCreationOptions=[
+            "GEOMETRY_ENCODING=" + dst_encoding,
+            "WRITE_COVERING_BBOX=YES",
+        ],
+    )
+
+    _validate(dst_filename)
+
+    with ogr.Open(dst_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetGeomType() == geom.GetGeometryType()
+        assert lyr.GetGeometryColumn() == "geometry"
+        assert lyr.GetExtent() == geom.GetEnvelope()
+        assert lyr.GetFeatureCount() == 4
+
+        f = lyr.GetNextFeature()
+        assert f["foo"] == "bar"
+        ogrtest.check_feature_geometry(f, geom)
+        f = lyr.GetNextFeature()
+        assert f.GetGeometryRef() is None
+        f = lyr.GetNextFeature()
+        assert f.GetGeometryRef().IsEmpty()
+        f = lyr.GetNextFeature()
+        ogrtest.check_feature_geometry(f, geom)
+
+        minx, maxx, miny, maxy = geom.GetEnvelope()
+        lyr.SetSpatialFilterRect(minx - 1, miny - 1, maxx + 1, maxy + 1)
+        assert lyr.GetFeatureCount() == 2
+        lyr.SetSpatialFilterRect(maxx + 1, miny, maxx + 2, maxy)
+        assert lyr.GetFeatureCount() == 0
+
+
 ###############################################################################
 # Check GeoArrow fixed size list / interleaved encoding
 
@@ -6352,3 +6352,77 @@ def test_ogr_pg_gdal_vector_pipeline(pg_ds):
         },
     ) as alg:
         assert alg.Output().GetLayerCount() == 1
+
+
+###############################################################################
+# Test COPY in binary format, compared to the text format
+
+
+@pytest.mark.parametrize("copy_binary", ("YES", "NO"))
+def test_ogr_pg_copy_binary(pg_ds, copy_binary):
+
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    lyr = pg_ds.CreateLayer(
+        "test_copy_binary",
+        geom_type=ogr.wkbPoint,
+        srs=srs,
+        options=["OVERWRITE=YES"],
+    )
+    fld_defn = ogr.FieldDefn("int16", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    fld_defn = ogr.FieldDefn("float32", ogr.OFTReal)
+    fld_defn.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    fld_defn = ogr.FieldDefn("numeric", ogr.OFTReal)
+    fld_defn.SetWidth(12)
+    fld_defn.SetPrecision(3)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("str3", ogr.OFTString)
+    fld_defn.SetWidth(3)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("bin", ogr.OFTBinary))
+
+    values = [
+        [-32768, 1, -123456789, -1234567890123, 1.5, -1.25e-300, -123.456, "é\t\\"],
+        [32767, 0, 0, 0, 0, float("inf"), 0.0005, ""],
+        [1, 1, 1, 1, 1, 1, 12345678.9, "foo"],
+    ]
+    with gdal.config_options(
+        {"PG_USE_COPY": "YES", "PG_USE_COPY_BINARY": copy_binary}
+    ):
+        for i, row in enumerate(values):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            for j, val in enumerate(row):
+                f.SetField(j, val)
+            f["str3"] = "abcdef"
+            f.SetFieldBinaryFromHexString("bin", "0001FF")
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {-i})"))
+            assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+        f = ogr.Feature(lyr.GetLayerDefn())
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+
+    lyr = reconnect(pg_ds).GetLayerByName("test_copy_binary")
+    assert lyr.GetFeatureCount() == 4
+    lyr.SetAttributeFilter("int16 IS NOT NULL")
+    for i, f in enumerate(lyr):
+        assert [f.GetField(j) for j in range(7)] == pytest.approx(values[i][0:7])
+        assert f["str"] == values[i][7]
+        assert f["str3"] == "abc"
+        assert f.GetFieldAsBinary("bin") == b"\x00\x01\xff"
+        assert f.GetGeometryRef().ExportToWkt() == f"POINT ({i} {-i})"
+        assert f.GetGeometryRef().GetSpatialReference().GetAuthorityCode(None) == (
+            "4326"
+        )
+    lyr.SetAttributeFilter("int16 IS NULL")
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+    assert not f.IsFieldSetAndNotNull("real")
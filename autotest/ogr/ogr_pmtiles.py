@@ -13,13 +13,14 @@
 
 import json
 import os
+import struct
 
 import gdaltest
 import ogrtest
 import pytest
 import test_cli_utilities
 
-from osgeo import gdal, ogr
+from osgeo import gdal, ogr, osr
 
 pytestmark = pytest.mark.require_driver("PMTiles")
 
@@ -614,3 +615,95 @@ def test_ogr_pmtiles_read_with_many_directories():
     )
     lyr = ds.GetLayer(0)
     assert lyr.GetFeatureCount() != 0
+
+
+###############################################################################
+
+
+@pytest.mark.require_driver("MBTiles")
+@pytest.mark.require_driver("PNG")
+def test_ogr_pmtiles_raster_write_read(tmp_vsimem):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world.tif")
+    out_filename = str(tmp_vsimem / "out.pmtiles")
+    ds = gdal.GetDriverByName("PMTiles").CreateCopy(out_filename, src_ds)
+    assert ds.RasterCount == 4
+    assert ds.GetSpatialRef().GetAuthorityCode(None) == "3857"
+    assert ds.GetRasterBand(1).GetBlockSize() == [256, 256]
+    assert ds.RasterXSize % 256 == 0
+    assert ds.RasterYSize % 256 == 0
+    assert ds.GetMetadataItem("format") == "png"
+    zoom_level = int(ds.GetMetadataItem("ZOOM_LEVEL"))
+    assert ds.GetRasterBand(1).GetOverviewCount() == zoom_level
+    assert ds.GetRasterBand(1).GetColorInterpretation() == gdal.GCI_RedBand
+    assert ds.GetRasterBand(4).GetColorInterpretation() == gdal.GCI_AlphaBand
+    assert ds.GetRasterBand(4).Checksum() != 0
+    ovr = ds.GetRasterBand(1).GetOverview(0)
+    assert ovr.XSize == ds.RasterXSize // 2
+    assert ovr.Checksum() != 0
+    ds = None
+
+    # Compare multi-tile dataset-level reads with band per band reads
+    ds = gdal.Open(out_filename)
+    assert ds.GetDriver().GetDescription() == "PMTiles"
+    all_bands = ds.ReadRaster()
+    ds = None
+    ds = gdal.Open(out_filename)
+    assert all_bands == b"".join(
+        ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+    )
+
+    with pytest.raises(Exception, match="Invalid zoom level"):
+        gdal.OpenEx(out_filename, open_options=["ZOOM_LEVEL=30"])
+
+    ds = gdal.OpenEx(out_filename, open_options=[f"ZOOM_LEVEL={zoom_level - 1}"])
+    assert ds.RasterXSize == ovr.XSize
+    assert ds.GetRasterBand(1).GetOverviewCount() == zoom_level - 1
+
+    with pytest.raises(Exception, match="Tile type PNG not handled"):
+        gdal.OpenEx(out_filename, gdal.OF_VECTOR)
+
+
+###############################################################################
+
+
+@pytest.mark.require_driver("MBTiles")
+@pytest.mark.require_driver("PNG")
+def test_ogr_pmtiles_raster_write_deduplication(tmp_vsimem):
+
+    MAX_GM = 20037508.342789244
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024, 3)
+    src_ds.SetGeoTransform(
+        [-MAX_GM, 2 * MAX_GM / 1024, 0, MAX_GM, 0, -2 * MAX_GM / 1024]
+    )
+    src_ds.SetSpatialRef(osr.SpatialReference(epsg=3857))
+    for i, val in enumerate((255, 128, 0)):
+        src_ds.GetRasterBand(i + 1).Fill(val)
+
+    out_filename = str(tmp_vsimem / "out.pmtiles")
+    ds = gdal.GetDriverByName("PMTiles").CreateCopy(
+        out_filename, src_ds, options=["RESAMPLING=NEAREST"]
+    )
+    assert ds.GetMetadataItem("ZOOM_LEVEL") == "2"
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    assert struct.unpack("B" * 4, ds.ReadRaster(1000, 1000, 1, 1)) == (
+        255,
+        128,
+        0,
+        255,
+    )
+    assert ds.GetRasterBand(2).ComputeRasterMinMax() == (128, 128)
+    ds = None
+
+    f = gdal.VSIFOpenL(f"/vsipmtiles/{out_filename}/pmtiles_header.json", "rb")
+    assert f
+    try:
+        data = gdal.VSIFReadL(1, 10000, f)
+    finally:
+        gdal.VSIFCloseL(f)
+    got = json.loads(data)
+    assert got["tile_type_str"] == "PNG"
+    assert got["tile_compression_str"] == "none"
+    assert got["clustered"]
+    assert got["addressed_tiles_count"] == 16 + 4 + 1
+    assert got["tile_contents_count"] < got["addressed_tiles_count"]
@@ -6035,7 +6035,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     )
     assert len(batches) == 0
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[0:-1])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6044,7 +6044,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
@@ -6132,6 +6132,151 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Test the optimized code path of GetArrowStream() reading DBF columns
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["MAX_FEATURES_IN_BATCH=3"],
+    ],
+)
+def test_ogr_shape_arrow_stream_dbf_optim(tmp_vsimem, options):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_dbf_optim.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer(
+        "test",
+        geom_type=ogr.wkbPoint,
+        options=["AUTO_REPACK=NO", "ENCODING=ISO-8859-1"],
+    )
+    fld_defn = ogr.FieldDefn("str", ogr.OFTString)
+    fld_defn.SetWidth(254)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("int64", ogr.OFTInteger64)
+    fld_defn.SetWidth(18)
+    lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("real", ogr.OFTReal)
+    fld_defn.SetWidth(24)
+    fld_defn.SetPrecision(10)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    values = [
+        ["  foo ", 1, 1234567890123, 1.5, "2024/01/31", True],
+        [None, None, None, None, None, None],
+        ["\xe9t\xe9", -99999999, -1, -0.125, "1900/12/01", False],
+        ["bar", 123, 0, 1e10, "2000/02/29", True],
+        ["deleted", 5, 5, 5, "2000/01/01", True],
+        ["x" * 254, 999999999, 999999999999999999, 3.14159, None, None],
+        ["baz", 0, 42, 0, "1970/01/01", False],
+    ]
+    for vals in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, v in enumerate(vals):
+            if v is not None:
+                f.SetField(i, v)
+        lyr.CreateFeature(f)
+    lyr.DeleteFeature(4)
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+
+    def get_columns():
+        stream = lyr.GetArrowStreamAsNumPy(options=options)
+        batches = [batch for batch in stream]
+        columns = {}
+        for batch in batches:
+            for k in batch:
+                columns.setdefault(k, []).extend(
+                    [str(x) for x in batch[k].tolist()]
+                )
+        return len(batches), columns
+
+    # Optimized code path
+    num_batches, optimized = get_columns()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    assert num_batches == (2 if options else 1)
+    assert optimized["OGC_FID"] == ["0", "1", "2", "3", "5", "6"]
+    assert optimized["str"][0] == "b'foo'"
+    assert optimized["str"][1] == "None"
+    assert optimized["str"][2] == str("\xe9t\xe9".encode("UTF-8"))
+    assert optimized["int"][2] == "-99999999"
+    assert optimized["int64"][4] == "999999999999999999"
+    assert optimized["date"][4] == "None"
+
+    # Regular code path
+    lyr.SetAttributeFilter("1 = 1")
+    _, regular = get_columns()
+    lyr.SetAttributeFilter(None)
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
+    assert optimized == regular
+
+    # Subset of columns
+    lyr.SetIgnoredFields(["OGR_GEOMETRY", "str", "date"])
+    _, subset = get_columns()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    assert set(subset.keys()) == set(["OGC_FID", "int", "int64", "real", "bool"])
+    for k in subset:
+        assert subset[k] == regular[k]
+
+    # Without FID column
+    stream = lyr.GetArrowStreamAsNumPy(options=options + ["INCLUDE_FID=NO"])
+    batches = [batch for batch in stream]
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    assert "OGC_FID" not in batches[0]
+    assert [x for batch in batches for x in batch["int"].tolist()] == [
+        int(x) if x != "None" else None for x in regular["int"]
+    ]
+
+    # Strings exceeding the memory limit of a batch are returned in the
+    # next batch
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+    with gdal.config_option("OGR_ARROW_MEM_LIMIT", "1000"):
+        stream = lyr.GetArrowStreamAsNumPy(options=options)
+        batches = [batch for batch in stream]
+    assert len(batches) > 1
+    assert [x for batch in batches for x in batch["OGC_FID"].tolist()] == [
+        0,
+        1,
+        2,
+        3,
+        5,
+        6,
+    ]
+
+
 ###############################################################################
 # Test DBF Logical field type
 
@@ -6218,3 +6363,116 @@ def test_ogr_shape_write_check_golden_file(tmp_path, src_directory):
         assert (
             open(src_filename, "rb").read() == open(out_filename, "rb").read()
         ), filename
+
+
+###############################################################################
+# Test Layer.FillNextFeature()
+
+
+def test_ogr_shape_fill_next_feature():
+
+    with ogr.Open("data/poly.shp") as ds:
+        lyr = ds.GetLayer(0)
+        expected = [f for f in lyr]
+
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for filter in (None, "EAS_ID > 170"):
+            lyr.SetAttributeFilter(filter)
+            lyr.ResetReading()
+            got = []
+            while lyr.FillNextFeature(f):
+                got.append(f.Clone())
+            assert len(got) == lyr.GetFeatureCount()
+            for got_f in got:
+                assert got_f.Equal(expected[got_f.GetFID()])
+
+        # Feature with a different definition
+        lyr.SetAttributeFilter(None)
+        lyr.ResetReading()
+        f = ogr.Feature(ogr.FeatureDefn())
+        assert lyr.FillNextFeature(f)
+        assert f.Equal(expected[0])
+
+
+###############################################################################
+# Test the packed R-tree sidecar spatial index
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_shape_sidecar_spatial_index(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i == 500:
+            # Null shape
+            pass
+        elif i == 501:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("LINESTRING EMPTY"))
+        else:
+            x = i % 100
+            y = i // 100
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(f"LINESTRING({x} {y},{x + 0.5} {y + 0.5})")
+            )
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename, update=1)
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilterRect(10.25, 2.25, 20.25, 5.25)
+    expected_fids = [f.GetFID() for f in lyr]
+    assert len(expected_fids) == 11 * 4
+    lyr.SetSpatialFilter(None)
+
+    with gdaltest.config_options(
+        {
+            "SHAPE_SPATIAL_INDEX_FORMAT": "OGRSIDX",
+            "GDAL_NUM_THREADS": num_threads,
+        }
+    ):
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+    assert gdal.VSIStatL(filename + ".ogrsidx") is not None
+    assert gdal.VSIStatL(str(tmp_vsimem / "test.qix")) is None
+    assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+    assert (filename + ".ogrsidx") in [
+        x.replace("\\", "/") for x in ds.GetFileList()
+    ]
+    lyr.SetSpatialFilterRect(10.25, 2.25, 20.25, 5.25)
+    debug_msgs = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+        my_handler
+    ):
+        got_fids = [f.GetFID() for f in lyr]
+    assert got_fids == expected_fids
+    assert any("Used spatial index, got 44 matches" in msg for msg in debug_msgs)
+    lyr.SetSpatialFilterRect(1000, 1000, 1001, 1001)
+    assert lyr.GetFeatureCount() == 0
+    lyr.SetAttributeFilter("id >= 412")
+    lyr.SetSpatialFilterRect(10.25, 2.25, 20.25, 5.25)
+    assert [f.GetFID() for f in lyr] == [fid for fid in expected_fids if fid >= 412]
+    ds = None
+
+    # Adding a feature drops the index
+    ds = ogr.Open(filename, update=1)
+    lyr = ds.GetLayer(0)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("LINESTRING(0 0,1 1)"))
+    lyr.CreateFeature(f)
+    assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+    ds = None
+    assert gdal.VSIStatL(filename + ".ogrsidx") is None
@@ -1650,3 +1650,72 @@ def test_ogr_rfc28_in_date_filter():
 
     lyr.SetAttributeFilter("date_slash IN ('2020-12-31', '2020-12-31')")
     _ogr_in_date_filter_check([])
+
+
+###############################################################################
+# Test that the compiled evaluation of attribute filters gives the same
+# results as the generic evaluator
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "i = 1",
+        "i <> 1",
+        "i < 2 AND r >= 1.5",
+        "i > 1 OR s = 'foo'",
+        "NOT (i = 2)",
+        "i IS NULL",
+        "NOT (r IS NULL) AND i64 > 1",
+        "i BETWEEN 1 AND 2",
+        "r BETWEEN 1 AND 2.5",
+        "i IN (5, 1, 3)",
+        "i64 IN (1, 10000000000)",
+        "i IN (1, i64)",
+        "r IN (1.5, 3)",
+        "s IN ('FOO', 'baz')",
+        "s >= 'bar'",
+        "s = 'FOO' OR s IS NULL",
+        "i = 1.0",
+        "r > i",
+        "fid = 1",
+        "i = 1 AND (r = 2.5 OR NOT s = 'bar')",
+        "(i = 1 OR r = 2.5) AND NOT (s = 'bar' AND i64 < 3)",
+        "s LIKE 'f%'",
+    ],
+)
+def test_ogr_rfc28_compiled_where(where):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("i64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    for values in [
+        [1, 10000000000, 1.5, "foo"],
+        [2, 2, 2.5, "bar"],
+        [None, 1, None, "baz"],
+        [3, None, 3, None],
+        [None, None, None, None],
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, v in enumerate(values):
+            if v is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, v)
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        assert lyr.SetAttributeFilter(where) == ogr.OGRERR_NONE
+        return [f.GetFID() for f in lyr]
+
+    with gdal.config_option("OGR_SQL_COMPILE_WHERE", "NO"):
+        expected = get_fids()
+    assert get_fids() == expected
+    with gdal.config_option("OGR_SQL_COMPILE_WHERE", "NO"):
+        lyr.SetAttributeFilter("NOT (" + where + ")")
+        expected = [f.GetFID() for f in lyr]
+    lyr.SetAttributeFilter("NOT (" + where + ")")
+    assert [f.GetFID() for f in lyr] == expected
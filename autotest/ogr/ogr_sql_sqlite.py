@@ -2493,3 +2493,71 @@ def test_ogr_sql_sqlite_execute_sql_error_on_spatial_filter_shp_layer(tmp_vsimem
         Exception, match="Cannot set spatial filter: no geometry field present in layer"
     ):
         ds.ExecuteSQL("SELECT 1 FROM test", spatialFilter=geom, dialect="SQLITE")
+
+
+###############################################################################
+# Test LIMIT/OFFSET pushdown, joins and geometry columns requested several times
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("driver", ["MEM", "CSV"])
+def test_ogr_sql_sqlite_limit_offset_join(tmp_vsimem, driver):
+
+    if driver == "MEM":
+        ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+        lyr.CreateGeomField(ogr.GeomFieldDefn("geom1", ogr.wkbPoint))
+        lyr.CreateGeomField(ogr.GeomFieldDefn("geom2", ogr.wkbPoint))
+    else:
+        ds = ogr.GetDriverByName("CSV").CreateDataSource(str(tmp_vsimem / "out"))
+        lyr = ds.CreateLayer("test", options=["GEOMETRY=AS_WKT"])
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = i
+        f.SetGeomField(0, ogr.CreateGeometryFromWkt(f"POINT ({i} 0)"))
+        if driver == "MEM":
+            f.SetGeomField(1, ogr.CreateGeometryFromWkt(f"POINT (0 {i})"))
+        lyr.CreateFeature(f)
+
+    def get_vals(sql):
+        with ds.ExecuteSQL(sql, dialect="SQLite") as sql_lyr:
+            return [f["val"] for f in sql_lyr]
+
+    assert get_vals("SELECT val FROM test LIMIT 3") == [0, 1, 2]
+    assert get_vals("SELECT val FROM test LIMIT 3 OFFSET 5") == [5, 6, 7]
+    assert get_vals("SELECT val FROM test LIMIT 3 OFFSET 8") == [8, 9]
+    assert get_vals("SELECT val FROM test LIMIT 3 OFFSET 20") == []
+    assert get_vals("SELECT val FROM test LIMIT 0") == []
+    assert get_vals("SELECT val FROM test LIMIT -1 OFFSET 7") == [7, 8, 9]
+    assert get_vals("SELECT val FROM test WHERE val >= 4 LIMIT 2 OFFSET 1") == [
+        5,
+        6,
+    ]
+    assert get_vals("SELECT val FROM test WHERE val % 2 = 0 LIMIT 2 OFFSET 1") == [
+        2,
+        4,
+    ]
+    assert get_vals("SELECT COUNT(*) AS val FROM (SELECT * FROM test LIMIT 4)") == [
+        4
+    ]
+
+    assert get_vals(
+        "SELECT a.val AS val FROM test a JOIN test b ON a.val = b.val + 1 "
+        "WHERE b.val < 5 ORDER BY a.val"
+    ) == [1, 2, 3, 4, 5]
+
+    if driver == "MEM":
+        with ds.ExecuteSQL(
+            "SELECT val, geom2, geom1, geom2 AS geom3 FROM test LIMIT 2 OFFSET 3",
+            dialect="SQLite",
+        ) as sql_lyr:
+            f = sql_lyr.GetNextFeature()
+            assert f["val"] == 3
+            assert f.GetGeomFieldRef(0).ExportToWkt() == "POINT (0 3)"
+            assert f.GetGeomFieldRef(1).ExportToWkt() == "POINT (3 0)"
+            assert f.GetGeomFieldRef(2).ExportToWkt() == "POINT (0 3)"
+            f = sql_lyr.GetNextFeature()
+            assert f["val"] == 4
+            assert f.GetGeomFieldRef(0).ExportToWkt() == "POINT (0 4)"
+            assert sql_lyr.GetNextFeature() is None
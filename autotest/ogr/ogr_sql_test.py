@@ -2234,3 +2234,42 @@ def test_ogr_sql_union_layer_feature_count_add_overflow():
             "select * from test union all select * from test2", dialect="OGRSQL"
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == 0
+
+
+###############################################################################
+# Test ORDER BY ... LIMIT ... [OFFSET ...], which only retains the first
+# records
+
+
+@pytest.mark.parametrize(
+    "limit,offset", [(1, 0), (1, 5), (3, 0), (7, 4), (20, 95), (200, 0)]
+)
+@pytest.mark.parametrize("order", ["ASC", "DESC"])
+def test_ogr_sql_order_by_limit_offset(limit, offset, order):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    values = [(i * 37) % 11 if i % 13 else None for i in range(100)]
+    for i, val in enumerate(values):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if val is not None:
+            f["val"] = val
+        f["str"] = str(i)
+        lyr.CreateFeature(f)
+
+    # Like the Python one, the OGR SQL sort is stable. Nulls are the smallest
+    # values.
+    sign = 1 if order == "ASC" else -1
+    expected = sorted(
+        enumerate(values),
+        key=lambda x: (sign * (x[1] is not None), sign * (x[1] or 0)),
+    )
+    expected = [str(i) for i, _ in expected][offset : offset + limit]
+
+    with ds.ExecuteSQL(
+        f"SELECT str FROM test ORDER BY val {order} LIMIT {limit} OFFSET {offset}"
+    ) as sql_lyr:
+        assert [f["str"] for f in sql_lyr] == expected
+        assert sql_lyr.GetFeatureCount() == len(expected)
@@ -3374,6 +3374,39 @@ def test_ogr_sqlite_prelude_statements(require_spatialite):
     ds.ReleaseResultSet(sql_lyr)
 
 
+###############################################################################
+# Test MMAP_SIZE open option, on a /vsimem/ file whose pages are then directly
+# read from the memory buffer
+
+
+def test_ogr_sqlite_mmap_size(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_ogr_sqlite_mmap_size.db")
+    ds = ogr.GetDriverByName("SQLite").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.StartTransaction()
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "value %d" % i + "x" * (i % 100)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    ds = None
+
+    def get_features(ds):
+        lyr = ds.GetLayer(0)
+        return [(f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    with ogr.Open(filename) as ds:
+        expected = get_features(ds)
+
+    with gdal.OpenEx(
+        filename, gdal.OF_VECTOR, open_options=["MMAP_SIZE=100000000"]
+    ) as ds:
+        assert get_features(ds) == expected
+
+
 ###############################################################################
 # Test INTEGER_OR_TEXT affinity
 
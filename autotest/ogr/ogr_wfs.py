@@ -62,6 +62,12 @@ def with_and_without_streaming(request):
         yield
 
 
+@pytest.fixture(params=[None, "2"], ids=["without-prefetch", "with-prefetch"])
+def with_and_without_prefetch(request):
+    with gdaltest.config_option("OGR_WFS_PREFETCH_PAGES", request.param):
+        yield
+
+
 ###############################################################################
 # Test reading a MapServer WFS server
 
@@ -3715,7 +3721,9 @@ xsi:schemaLocation="http://ns1 /vsimem/wfs_endpoint?SERVICE=WFS&amp;VERSION=2.0.
 
 
 @pytest.mark.parametrize("numberMatched", ["unknown", "4"])
-def test_ogr_wfs_vsimem_wfs200_paging(with_and_without_streaming, numberMatched):
+def test_ogr_wfs_vsimem_wfs200_paging(
+    with_and_without_streaming, with_and_without_prefetch, numberMatched
+):
 
     with gdaltest.tempfile(
         "/vsimem/wfs200_endpoint_paging?SERVICE=WFS&REQUEST=GetCapabilities",
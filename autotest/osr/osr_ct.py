@@ -293,6 +293,44 @@ def test_osr_ct_8():
                 pytest.fail("Failed to transform from Pseudo Mercator to LL")
 
 
+###############################################################################
+# Test WGS84 -> WebMercator optimized transform against PROJ
+
+
+@pytest.mark.parametrize("traditional_gis_order", [True, False])
+def test_osr_ct_wgs84_to_webmercator(traditional_gis_order):
+
+    src_srs = osr.SpatialReference()
+    src_srs.ImportFromEPSG(4326)
+    if traditional_gis_order:
+        src_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(3857)
+
+    ct = osr.CoordinateTransformation(src_srs, dst_srs)
+
+    options = osr.CoordinateTransformationOptions()
+    assert options.SetOperation(
+        "+proj=pipeline +step +proj=axisswap +order=2,1 "
+        "+step +proj=unitconvert +xy_in=deg +xy_out=rad "
+        "+step +proj=webmerc +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +ellps=WGS84"
+    )
+    ct_proj = osr.CoordinateTransformation(src_srs, dst_srs, options)
+
+    pnts = [(2, 49), (3, 49), (-179.5, -85), (185, 10), (0, 0)]
+    if not traditional_gis_order:
+        pnts = [(y, x) for x, y in pnts]
+    for got, expected in zip(ct.TransformPoints(pnts), ct_proj.TransformPoints(pnts)):
+        assert got == pytest.approx(expected, abs=1e-6)
+
+    pole = (0, 90) if traditional_gis_order else (90, 0)
+    with osr.ExceptionMgr(useExceptions=False):
+        x, _, _, _, error_code = ct.TransformPointWithErrorCode(*pole, 0, 0)
+    assert math.isinf(x)
+    assert error_code != 0
+
+
 ###############################################################################
 # Test coordinate transformation where only one CRS has a towgs84 clause (#1156)
 
@@ -936,3 +974,29 @@ def test_osr_ct_fix_9732():
     x, y, _ = ct.TransformPoint(2300000, 2000000, 0)
     assert x == pytest.approx(2301000)
     assert y == pytest.approx(2000000)
+
+
+###############################################################################
+# Test transforming a large array of points with several threads
+
+
+def test_osr_ct_num_threads():
+
+    s = osr.SpatialReference()
+    s.SetFromUserInput("WGS84")
+    s.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    t = osr.SpatialReference()
+    t.ImportFromEPSG(32631)
+
+    points = [(2 + i * 1e-5, 49, 0) for i in range(200000)]
+
+    with gdaltest.config_option("OGR_CT_NUM_THREADS", "1"):
+        ct = osr.CoordinateTransformation(s, t)
+        expected = ct.TransformPoints(points)
+
+    with gdaltest.config_option("OGR_CT_NUM_THREADS", "4"):
+        ct = osr.CoordinateTransformation(s, t)
+        got = ct.TransformPoints(points)
+
+    assert got == expected
+    assert got[0][0] == pytest.approx(426857, abs=1)
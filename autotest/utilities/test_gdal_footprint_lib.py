@@ -739,3 +739,65 @@ def test_gdal_footprint_lib_writeAbsolutePath():
     lyr = out_ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert os.path.isabs(f["location"])
+
+
+###############################################################################
+# Test numThreads
+
+
+@pytest.mark.parametrize("srcNodata", [None, 0])
+def test_gdal_footprint_lib_num_threads(tmp_path, srcNodata):
+
+    filename = str(tmp_path / "test_gdal_footprint_lib_num_threads.tif")
+    width = 100
+    height = 20000
+    # Big enough for the mask to be read as several strips
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        filename, width, height, 2, options=["TILED=YES", "BLOCKYSIZE=16"]
+    )
+    src_ds.SetGeoTransform([2, 0.5, 0, 49, 0, -0.5])
+    for iband, period in ((1, 7), (2, 11)):
+        band = src_ds.GetRasterBand(iband)
+        if srcNodata is None:
+            band.SetNoDataValue(0)
+        band.WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            bytes(
+                0 if (x // period + y // 13) % 3 == 0 else 255
+                for y in range(height)
+                for x in range(width)
+            ),
+        )
+    src_ds = None
+
+    def compute(numThreads):
+        out_ds = gdal.Footprint(
+            "",
+            filename,
+            format="MEM",
+            srcNodata=srcNodata,
+            combineBands="intersection",
+            maxPoints="unlimited",
+            numThreads=numThreads,
+        )
+        lyr = out_ds.GetLayer(0)
+        return [f.GetGeometryRef().ExportToIsoWkt() for f in lyr]
+
+    ref = compute(1)
+    assert len(ref) == 1
+    assert ref[0].startswith("MULTIPOLYGON")
+    assert compute(4) == ref
+    assert compute("ALL_CPUS") == ref
+
+
+###############################################################################
+# Test invalid -num_threads
+
+
+def test_gdal_footprint_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.Footprint("", "../gcore/data/byte.tif", options="-of MEM -num_threads foo")
@@ -1120,3 +1120,58 @@ def test_gdal_grid_lib_errors():
             algorithm="invdist",
             SQLStatement="invalid",
         )
+
+
+###############################################################################
+# Test GDAL_GRID_TILED=YES
+
+
+@pytest.mark.parametrize(
+    "alg",
+    [
+        "invdist:radius1=0.03:radius2=0.03:nodata=-1",
+        "invdistnn:radius=0.03:nodata=-1",
+        "average:radius1=0.03:radius2=0.02:angle=30:nodata=-1",
+        "maximum:radius1=0.03:radius2=0.03:nodata=-1",
+        "count:radius1=0.03:radius2=0.03:min_points=1:nodata=-1",
+    ],
+)
+def test_gdal_grid_lib_tiled(tmp_vsimem, n43_shp, alg):
+
+    def grid(filename):
+        return gdal.Grid(
+            filename,
+            n43_shp.GetDescription(),
+            format="GTiff",
+            creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+            outputBounds=[-80.1, 42.9, -78.9, 44.1],
+            width=100,
+            height=90,
+            outputType=gdal.GDT_Float64,
+            algorithm=alg,
+        )
+
+    ref_ds = grid(tmp_vsimem / "ref.tif")
+    with gdal.config_option("GDAL_GRID_TILED", "YES"):
+        ds = grid(tmp_vsimem / "tiled.tif")
+
+    ref = struct.unpack("d" * (100 * 90), ref_ds.ReadRaster())
+    got = struct.unpack("d" * (100 * 90), ds.ReadRaster())
+    assert got == pytest.approx(ref, rel=1e-12)
+    assert -1 in ref
+
+
+def test_gdal_grid_lib_tiled_unsupported_algorithm(tmp_vsimem, n43_shp):
+
+    with gdal.config_option("GDAL_GRID_TILED", "YES"), gdaltest.error_raised(
+        gdal.CE_Warning, "GDAL_GRID_TILED=YES ignored"
+    ):
+        ds = gdal.Grid(
+            "",
+            n43_shp.GetDescription(),
+            format="MEM",
+            width=10,
+            height=10,
+            algorithm="invdist",
+        )
+    assert ds.GetRasterBand(1).Checksum() != 0
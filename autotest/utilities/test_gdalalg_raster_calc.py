@@ -212,6 +212,45 @@ def test_gdalalg_raster_calc_creation_options(calc, tmp_vsimem):
         assert dst.GetMetadata("IMAGE_STRUCTURE")["COMPRESSION"] == "LZW"
 
 
+@pytest.mark.parametrize(
+    "creation_options",
+    [[], ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=DEFLATE"]],
+)
+def test_gdalalg_raster_calc_num_threads(calc, tmp_vsimem, creation_options):
+
+    src_ds = gdal.Translate(
+        tmp_vsimem / "src.tif", "../gcore/data/rgbsmall.tif", width=100, height=300
+    )
+    src_ds.Close()
+
+    def run(num_threads):
+        outfile = tmp_vsimem / f"out_{num_threads}.tif"
+        alg = gdal.GetGlobalAlgorithmRegistry()["raster"]["calc"]
+        alg["input"] = [f"A={tmp_vsimem}/src.tif"]
+        alg["output"] = outfile
+        alg["creation-option"] = creation_options
+        alg["calc"] = ["A[1] * 2 + A[2]", "A[3] - A[1]"]
+        alg["output-data-type"] = "Int16"
+        alg["nodata"] = -1
+        alg["num-threads"] = num_threads
+        assert alg.Run()
+        assert alg.Finalize()
+        return outfile
+
+    ref_filename = run(1)
+    filename = run(4)
+
+    with gdal.Open(ref_filename) as ref_ds, gdal.Open(filename) as ds:
+        assert ds.RasterCount == 2
+        assert ds.GetGeoTransform() == ref_ds.GetGeoTransform()
+        assert ds.GetSpatialRef().IsSame(ref_ds.GetSpatialRef())
+        assert ds.GetRasterBand(1).GetNoDataValue() == -1
+        assert ds.GetRasterBand(1).GetBlockSize() == ref_ds.GetRasterBand(
+            1
+        ).GetBlockSize()
+        assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
 def test_gdalalg_raster_calc_output_format(calc, tmp_vsimem):
 
     infile = "../gcore/data/byte.tif"
@@ -11,6 +11,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import os
+
 import gdaltest
 import pytest
 
@@ -189,3 +191,102 @@ def test_gdalalg_raster_fill_nodata_mask_does_not_exist(tmp_vsimem):
     alg["mask"] = "/i/do_not/exist"
     with pytest.raises(Exception):
         alg.Run()
+
+
+###############################################################################
+# Test that the streamed (block by block) computation gives the same result
+# as processing the whole raster at once
+
+
+@pytest.mark.parametrize(
+    "strategy,smoothing_iterations,with_mask",
+    [("invdist", 0, False), ("nearest", 0, False), ("invdist", 2, True)],
+)
+def test_gdalalg_raster_fill_nodata_streamed(
+    tmp_vsimem, strategy, smoothing_iterations, with_mask
+):
+
+    np = pytest.importorskip("numpy")
+
+    width = 2500
+    height = 1300
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    rng = np.random.default_rng(0)
+    ar = rng.integers(1, 255, size=(height, width), dtype=np.uint8)
+    # Create some holes, including at block boundaries
+    for _ in range(200):
+        x = int(rng.integers(0, width - 30))
+        y = int(rng.integers(0, height - 30))
+        ar[y : y + int(rng.integers(1, 30)), x : x + int(rng.integers(1, 30))] = 0
+    ar[1000:1050, :] = 0
+    ar[:, 1010:1040] = 0
+    src_ds.GetRasterBand(1).WriteArray(ar)
+
+    mask_ds = None
+    if with_mask:
+        mask_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+        mask_ds.GetRasterBand(1).WriteArray((ar != 0).astype(np.uint8))
+        mask_ds.GetRasterBand(1).WriteRaster(0, 0, 100, 100, b"\x00" * (100 * 100))
+
+    max_distance = 20
+
+    expected_ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+    interpolation = "NEAREST" if strategy == "nearest" else "INV_DIST"
+    assert (
+        gdal.FillNodata(
+            expected_ds.GetRasterBand(1),
+            mask_ds.GetRasterBand(1) if mask_ds else None,
+            max_distance,
+            smoothing_iterations,
+            options=["INTERPOLATION=" + interpolation],
+        )
+        == gdal.CE_None
+    )
+
+    alg = get_alg()
+    alg["input"] = src_ds
+    alg["output"] = tmp_vsimem / "out.tif"
+    alg["max-distance"] = max_distance
+    alg["smoothing-iterations"] = smoothing_iterations
+    alg["strategy"] = strategy
+    if mask_ds:
+        alg["mask"] = mask_ds
+    assert alg.Run()
+    assert alg.Finalize()
+
+    with gdal.Open(tmp_vsimem / "out.tif") as ds:
+        assert ds.GetRasterBand(1).GetNoDataValue() == 0
+        np.testing.assert_array_equal(
+            ds.GetRasterBand(1).ReadAsArray(),
+            expected_ds.GetRasterBand(1).ReadAsArray(),
+        )
+
+
+@pytest.mark.require_driver("GDALG")
+def test_gdalalg_raster_fill_nodata_pipeline_is_streamed(tmp_vsimem):
+
+    src_filename = os.path.join(os.getcwd(), "../gcore/data/nodata_byte.tif")
+
+    # No warning about a non natively streaming step
+    with gdal.quiet_errors():
+        gdal.ErrorReset()
+        gdal.Run(
+            "raster",
+            "pipeline",
+            pipeline=f"read {src_filename} ! fill-nodata ! write {tmp_vsimem}/out.gdalg.json",
+        )
+        assert gdal.GetLastErrorMsg() == ""
+
+    with gdal.Open(tmp_vsimem / "out.gdalg.json") as ds:
+        assert ds.GetRasterBand(1).ReadRaster(1, 1, 1, 1) == b"\x7d"
+
+
+def test_gdalalg_raster_fill_nodata_mask_wrong_dimensions(tmp_vsimem):
+
+    alg = get_alg()
+    alg["input"] = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    alg["output"] = tmp_vsimem / "out.tif"
+    alg["mask"] = "../gcore/data/byte.tif"
+    with pytest.raises(Exception, match="has not the same dimensions"):
+        alg.Run()
@@ -511,3 +511,29 @@ def test_gdalalg_raster_pixel_info_from_command_line_csv(gdal_path):
         ret
         == 'input_x,input_y,extra_input,column,line,band_1_raw_value,band_1_unscaled_value\n5.5,10.5,"foo bar",5.5,10.5,132,132\n'
     )
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_gdalalg_raster_pixel_info_from_command_line_many_points(
+    gdal_path, num_threads
+):
+
+    # Points in an order that does not follow the raster layout
+    points = [(19 - (i * 7) % 20 + 0.5, (i * 13) % 20 + 0.5) for i in range(5000)]
+    points.append((100, 100))
+    ret = gdaltest.runexternal(
+        f"{gdal_path} raster pixel-info --of=csv -j {num_threads} ../gcore/data/byte.tif",
+        strin="\n".join(f"{x} {y} {i}" for i, (x, y) in enumerate(points)),
+    ).replace("\r\n", "\n")
+    lines = ret.split("\n")
+    assert lines[0].startswith("input_x,input_y,extra_input")
+    assert lines[-1] == ""
+    lines = lines[1:-1]
+    assert len(lines) == len(points)
+
+    with gdal.Open("../gcore/data/byte.tif") as ds:
+        band = ds.GetRasterBand(1)
+        for i, (x, y) in enumerate(points[0:-1]):
+            val = band.InterpolateAtPoint(x, y, gdal.GRIORA_NearestNeighbour)
+            assert lines[i] == f'{x},{y},"{i}",{x},{y},{int(val)},{int(val)}'
+    assert lines[-1] == '100,100,"5000",100,100,,'
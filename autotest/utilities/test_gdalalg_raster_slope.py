@@ -47,6 +47,21 @@ def test_gdalalg_raster_slope(options, checksum):
     assert out_ds.GetRasterBand(1).Checksum() == checksum
 
 
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_gdalalg_raster_slope_num_threads(tmp_vsimem, num_threads):
+
+    out_filename = tmp_vsimem / "out.tif"
+
+    alg = get_alg()
+    alg["input"] = "../gdrivers/data/n43.tif"
+    alg["output"] = out_filename
+    alg["num-threads"] = num_threads
+    assert alg.Run()
+    assert alg.Finalize()
+    with gdal.Open(out_filename) as ds:
+        assert ds.GetRasterBand(1).Checksum() == 5604
+
+
 def test_gdalalg_raster_slope_band():
 
     src_ds = gdal.Translate(
@@ -676,6 +676,43 @@ def test_gdalalg_raster_tile_multithread(tmp_vsimem):
     assert len(gdal.ReadDirRecursive(tmp_vsimem)) == 107
 
 
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_gdalalg_raster_tile_metatile(tmp_vsimem, num_threads):
+
+    def run(output, metatile_size):
+        alg = get_alg()
+        alg["input"] = "../gdrivers/data/small_world.tif"
+        alg["output"] = output
+        alg["min-zoom"] = 0
+        alg["max-zoom"] = 2
+        alg["webviewer"] = "none"
+        alg["num-threads"] = num_threads
+        alg["parallel-method"] = "thread"
+        alg["metatile-size"] = metatile_size
+        with gdaltest.config_option("GDAL_THRESHOLD_MIN_TILES_PER_JOB", "1"):
+            assert alg.Run()
+        return sorted(gdal.ReadDirRecursive(str(output)))
+
+    ref_files = run(tmp_vsimem / "ref", 1)
+    files = run(tmp_vsimem / "metatile", 3)
+    assert files == ref_files
+
+    for filename in files:
+        if not filename.endswith(".png"):
+            continue
+        ref_ds = gdal.Open(tmp_vsimem / "ref" / filename)
+        ds = gdal.Open(tmp_vsimem / "metatile" / filename)
+        assert ds.RasterCount == ref_ds.RasterCount
+        for i in range(ds.RasterCount):
+            # Warping a larger region may cause minor differences due to
+            # the approximate transformer
+            assert ds.GetRasterBand(i + 1).ComputeStatistics(False)[
+                2
+            ] == pytest.approx(
+                ref_ds.GetRasterBand(i + 1).ComputeStatistics(False)[2], abs=0.5
+            ), filename
+
+
 def test_gdalalg_raster_tile_multithread_spawn_auto(tmp_vsimem):
 
     alg = get_alg()
@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -106,3 +107,38 @@ def test_gdalalg_vector_buffer(input_wkt, options, output_wkt):
     )
     out_f = out_lyr.GetNextFeature()
     assert out_f.GetGeometryRef() is None
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalalg_vector_buffer_many_features(num_threads):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("the_layer")
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1500):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 7:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} 0)"))
+        src_lyr.CreateFeature(f)
+
+    alg = get_alg()
+    alg["input"] = src_ds
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    alg["distance"] = 1
+    alg["quadrant-segments"] = 1
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        assert alg.Run()
+
+        out_lyr = alg["output"].GetDataset().GetLayer(0)
+        count = 0
+        for i, f in enumerate(out_lyr):
+            assert f["id"] == i
+            if i % 7:
+                assert f.GetGeometryRef().GetEnvelope() == (i - 1, i + 1, -1, 1)
+            else:
+                assert f.GetGeometryRef() is None
+            count += 1
+        assert count == 1500
@@ -400,6 +400,51 @@ def test_gdalalg_vector_clip_geom_not_rectangle():
     assert out_lyr.GetNextFeature() is None
 
 
+def test_gdalalg_vector_clip_geom_fully_contained():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("test")
+
+    # Fully inside the clipping geometry: kept as it is
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt("POLYGON ((0.3 0.3,0.7 0.3,0.7 0.7,0.3 0.3))")
+    )
+    src_lyr.CreateFeature(f)
+
+    # Partly inside
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON ((0.5 0.5,0.5 2,2 2,0.5 0.5))"))
+    src_lyr.CreateFeature(f)
+
+    clip = get_clip_alg()
+    clip["input"] = src_ds
+
+    assert clip.ParseCommandLineArguments(
+        [
+            "--bbox",
+            "0,0,1,1",
+            "--of",
+            "MEM",
+            "--output",
+            "memory_ds",
+        ]
+    )
+    assert clip.Run()
+
+    out_ds = clip["output"].GetDataset()
+    out_lyr = out_ds.GetLayer(0)
+    out_f = out_lyr.GetNextFeature()
+    assert (
+        out_f.GetGeometryRef().ExportToWkt()
+        == "POLYGON ((0.3 0.3,0.7 0.3,0.7 0.7,0.3 0.3))"
+    )
+    out_f = out_lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(out_f, "POLYGON ((0.5 0.5,0.5 1,1 1,0.5 0.5))")
+
+    assert out_lyr.GetNextFeature() is None
+
+
 def test_gdalalg_vector_clip_intersection_incompatible_geometry_type():
 
     src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
@@ -54,6 +54,24 @@ def test_gdalalg_vsi_copy_single_progress(tmp_vsimem):
     assert gdal.VSIStatL(tmp_vsimem / "byte.tif").size == 736
 
 
+def test_gdalalg_vsi_copy_single_num_threads_chunk_size(tmp_vsimem):
+
+    alg = get_alg()
+    alg["source"] = "../gcore/data/byte.tif"
+    alg["destination"] = tmp_vsimem
+    alg["num-threads"] = 2
+    alg["chunk-size"] = "100"
+    assert alg.Run()
+    assert gdal.VSIStatL(tmp_vsimem / "byte.tif").size == 736
+
+
+def test_gdalalg_vsi_copy_invalid_chunk_size():
+
+    alg = get_alg()
+    with pytest.raises(Exception, match="Invalid value for 'chunk-size' argument"):
+        alg["chunk-size"] = "invalid"
+
+
 def test_gdalalg_vsi_copy_single_source_does_not_exist():
 
     alg = get_alg()
@@ -12,6 +12,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
+import math
 import os
 import pathlib
 import struct
@@ -1025,6 +1027,149 @@ def test_gdalbuildvrt_write_absolute_path_from_relative_path(tmp_path, separate)
         os.chdir(old_curdir)
 
 
+###############################################################################
+# Test -trust_source_properties
+
+
+@pytest.mark.parametrize("separate", [True, False])
+def test_gdalbuildvrt_trust_source_properties(tmp_vsimem, separate):
+
+    src_filename = tmp_vsimem / "byte.tif"
+    gdal.Translate(src_filename, "../gcore/data/byte.tif", options="-a_nodata 1")
+    vrt_filename = tmp_vsimem / "out.vrt"
+    gdal.BuildVRT(
+        vrt_filename, [src_filename], trustSourceProperties=True, separate=separate
+    )
+    with gdal.VSIFile(vrt_filename, "rb") as f:
+        content = f.read().decode("utf-8")
+    assert (
+        '<SourceProperties RasterXSize="20" RasterYSize="20" DataType="Byte" '
+        'BlockXSize="20" BlockYSize="20" OverviewCount="0" MaskFlags="8" '
+        'NoData="1" />' in content
+    )
+
+    # Check that the source is not opened when only querying the properties
+    # of the VRT
+    gdal.Rename(src_filename, tmp_vsimem / "renamed.tif")
+    with gdal.Open(vrt_filename) as ds:
+        band = ds.GetRasterBand(1)
+        assert band.DataType == gdal.GDT_Byte
+        assert band.GetOverviewCount() == 0
+        xml = ds.GetMetadata("xml:VRT")[0]
+        assert 'OverviewCount="0" MaskFlags="8" NoData="1"' in xml
+        with pytest.raises(Exception):
+            band.Checksum()
+    gdal.Rename(tmp_vsimem / "renamed.tif", src_filename)
+
+    with gdal.Open(vrt_filename) as ds:
+        assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test -num_threads
+
+
+def test_gdalbuildvrt_num_threads(tmp_vsimem):
+
+    src_filenames = []
+    for i in range(20):
+        src_filename = str(tmp_vsimem / f"tile{i}.tif")
+        gdal.Translate(
+            src_filename,
+            "../gcore/data/byte.tif",
+            options=f"-a_ullr {440720 + 1200 * i} 3751320 {441920 + 1200 * i} 3750120",
+        )
+        src_filenames.append(src_filename)
+    src_filenames.insert(5, str(tmp_vsimem / "non_existing.tif"))
+
+    vrt_contents = []
+    for num_threads in (1, 4):
+        gdal.ErrorReset()
+        with gdal.quiet_errors():
+            ds = gdal.BuildVRT("", src_filenames, numThreads=num_threads)
+        assert "non_existing.tif" in gdal.GetLastErrorMsg()
+        assert ds.RasterXSize == 20 * 20
+        vrt_contents.append(ds.GetMetadata("xml:VRT")[0])
+        ds = None
+    assert vrt_contents[0] == vrt_contents[1]
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.BuildVRT("", src_filenames, options="-num_threads foo")
+
+
+###############################################################################
+# Test -metadata_cache
+
+
+def test_gdalbuildvrt_metadata_cache(tmp_vsimem):
+
+    src1 = str(tmp_vsimem / "src1.tif")
+    gdal.Translate(src1, "../gcore/data/byte.tif", options="-a_nodata nan -ot Float32")
+    src2 = str(tmp_vsimem / "src2.tif")
+    gdal.Translate(
+        src2,
+        "../gcore/data/byte.tif",
+        options="-a_nodata nan -ot Float32 -a_ullr 441920 3751320 443120 3750120",
+    )
+    cache_filename = str(tmp_vsimem / "cache.json")
+
+    ds = gdal.BuildVRT("", [src1], metadataCache=cache_filename)
+    ref_xml = ds.GetMetadata("xml:VRT")[0]
+    ds = None
+
+    with gdal.VSIFile(cache_filename, "rb") as f:
+        cache = json.loads(f.read())
+    assert cache["gdalbuildvrt_metadata_cache_version"] == 1
+    assert len(cache["sources"]) == 1
+    assert cache["sources"][0]["filename"] == src1
+    props = cache["sources"][0]["properties"]
+    assert props["width"] == 20
+    assert props["bands"][0]["type"] == "Float32"
+    assert props["bands"][0]["nodata"] == "nan"
+
+    # Same result when using the cache
+    ds = gdal.BuildVRT("", [src1], metadataCache=cache_filename)
+    assert ds.GetMetadata("xml:VRT")[0] == ref_xml
+    assert math.isnan(ds.GetRasterBand(1).GetNoDataValue())
+    ds = None
+
+    # Check that the cache is actually used: alter it
+    cache["sources"][0]["properties"]["bands"][0]["nodata"] = "1"
+    with gdal.VSIFile(cache_filename, "wb") as f:
+        f.write(json.dumps(cache).encode("utf-8"))
+    ds = gdal.BuildVRT("", [src1, src2], metadataCache=cache_filename)
+    assert ds.RasterXSize == 40
+    assert ds.GetRasterBand(1).GetNoDataValue() == 1
+    ds = None
+
+    with gdal.VSIFile(cache_filename, "rb") as f:
+        cache = json.loads(f.read())
+    assert [x["filename"] for x in cache["sources"]] == [src1, src2]
+
+    # Cache entries are ignored when the file is modified
+    gdal.Translate(src1, "../gcore/data/byte.tif", options="-a_nodata 0")
+    ds = gdal.BuildVRT("", [src1], metadataCache=cache_filename)
+    assert ds.GetRasterBand(1).DataType == gdal.GDT_Byte
+    assert ds.GetRasterBand(1).GetNoDataValue() == 0
+    ds = None
+
+    # and when open options are different
+    with gdal.VSIFile(cache_filename, "rb") as f:
+        cache = json.loads(f.read())
+    cache["sources"][0]["properties"]["bands"][0]["nodata"] = "1"
+    with gdal.VSIFile(cache_filename, "wb") as f:
+        f.write(json.dumps(cache).encode("utf-8"))
+    ds = gdal.BuildVRT("", [src1], metadataCache=cache_filename)
+    assert ds.GetRasterBand(1).GetNoDataValue() == 1
+    ds = gdal.BuildVRT(
+        "",
+        [src1],
+        options=["-oo", "NUM_THREADS=1"],
+        metadataCache=cache_filename,
+    )
+    assert ds.GetRasterBand(1).GetNoDataValue() == 0
+
+
 ###############################################################################
 
 
@@ -894,6 +894,60 @@ def test_gdaldem_lib_nodata():
         pytest.fail("Bad checksum")
 
 
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize(
+    "processing", ["hillshade", "slope", "aspect", "TRI", "TPI", "roughness"]
+)
+@pytest.mark.parametrize("compute_edges", [False, True])
+@pytest.mark.parametrize("data_type", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_num_threads(processing, compute_edges, data_type):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=data_type
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    # Add nodata values in several strips
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 30, 5, 5, b"\0" * (25 * 2), buf_type=gdal.GDT_Int16
+    )
+    src_ds.GetRasterBand(1).WriteRaster(
+        50, 64, 5, 2, b"\0" * (10 * 2), buf_type=gdal.GDT_Int16
+    )
+
+    ref_ds = gdal.DEMProcessing(
+        "",
+        src_ds,
+        processing,
+        format="MEM",
+        computeEdges=compute_edges,
+        numThreads=1,
+    )
+    ds = gdal.DEMProcessing(
+        "",
+        src_ds,
+        processing,
+        format="MEM",
+        computeEdges=compute_edges,
+        numThreads=4,
+    )
+    assert ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+
+
+def test_gdaldem_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.DEMProcessing(
+            "",
+            "../gdrivers/data/n43.tif",
+            "slope",
+            format="MEM",
+            numThreads="invalid",
+        )
+
+
 ###############################################################################
 # Test option argument handling
 
@@ -1074,3 +1074,28 @@ def test_gdalinfo_open_vector(gdalinfo_path):
     )
 
     assert "Did you intend to call ogrinfo" in err
+
+
+###############################################################################
+# Test writing a Chrome trace file with the CPL_TRACE_FILE configuration option
+
+
+def test_gdalinfo_cpl_trace_file(gdalinfo_path, tmp_path):
+
+    trace_filename = str(tmp_path / "trace.json")
+    gdaltest.runexternal(
+        gdalinfo_path
+        + " -checksum --config CPL_TRACE_FILE "
+        + trace_filename
+        + " ../gcore/data/byte.tif"
+    )
+
+    with open(trace_filename, "rb") as f:
+        j = json.load(f)
+    assert "traceEvents" in j
+    names = set(evt["name"] for evt in j["traceEvents"])
+    assert "GDALRasterBand::RasterIO" in names
+    for evt in j["traceEvents"]:
+        assert evt["ph"] == "X"
+        assert evt["dur"] >= 0
+    assert j["otherData"]["blocks_read"] > 0
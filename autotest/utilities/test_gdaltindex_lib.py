@@ -458,3 +458,71 @@ def test_gdaltindex_lib_ot(tmp_path, four_tiles):
     ds = ogr.Open(index_filename)
     lyr = ds.GetLayer(0)
     assert lyr.GetMetadataItem("DATA_TYPE") == "UInt16"
+
+
+###############################################################################
+# Test -num_threads
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("num_threads", [1, 4, "ALL_CPUS"])
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles, num_threads):
+
+    index_filename = str(tmp_path / "test_gdaltindex_lib_num_threads.gpkg")
+
+    # Rasters without georeferencing, that are skipped with a warning
+    no_gt = [str(tmp_path / f"no_gt{i}.tif") for i in (1, 2)]
+    for filename in no_gt:
+        gdal.GetDriverByName("GTiff").Create(filename, 1, 1)
+
+    sources = [
+        four_tiles[3],
+        no_gt[0],
+        four_tiles[0],
+        four_tiles[2],
+        no_gt[1],
+        four_tiles[1],
+    ]
+
+    warnings = []
+
+    def my_handler(err_type, err_no, err_msg):
+        if err_type == gdal.CE_Warning:
+            warnings.append(err_msg)
+
+    with gdaltest.error_handler(my_handler):
+        gdal.TileIndex(
+            index_filename,
+            sources,
+            numThreads=num_threads,
+            fetchMD=("foo", "foo_field", "String"),
+        )
+
+    skipped = [msg for msg in warnings if "skipping" in msg]
+    assert len(skipped) == 2
+    assert "no_gt1.tif" in skipped[0]
+    assert "no_gt2.tif" in skipped[1]
+
+    ds = ogr.Open(index_filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 4
+    assert [f["location"] for f in lyr] == [
+        four_tiles[3],
+        four_tiles[0],
+        four_tiles[2],
+        four_tiles[1],
+    ]
+    lyr.SetAttributeFilter("foo_field = 'bar'")
+    assert lyr.GetFeatureCount() == 1
+
+
+###############################################################################
+# Test invalid -num_threads
+
+
+def test_gdaltindex_lib_num_threads_invalid(tmp_path, four_tiles):
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.TileIndex(
+            str(tmp_path / "out.shp"), four_tiles[0], options="-num_threads foo"
+        )
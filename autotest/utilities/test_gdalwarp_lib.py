@@ -4587,3 +4587,25 @@ def test_gdalwarp_te_srs_check_extent():
     assert out_ds.GetGeoTransform() == pytest.approx(
         (166021, 37108, 0.0, 0.0, 0.0, -36622), abs=1000
     )
+
+
+###############################################################################
+# Test NUM_CONCURRENT_CHUNKS warping option
+
+
+@pytest.mark.parametrize("num_concurrent_chunks", [2, 4])
+def test_gdalwarp_lib_num_concurrent_chunks(num_concurrent_chunks):
+
+    # Nearest neighbour and exact transformer, so that the output does not
+    # depend on the chunk sizes
+    options = "-t_srs EPSG:4326 -ts 500 500 -et 0 -f MEM -wm 1"
+
+    ref_ds = gdal.Warp("", "../gcore/data/byte.tif", options=options)
+
+    ds = gdal.Warp(
+        "",
+        "../gcore/data/byte.tif",
+        options=options
+        + f" -multi -wo NUM_CONCURRENT_CHUNKS={num_concurrent_chunks}",
+    )
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
@@ -555,3 +555,57 @@ def test_nearblack_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize("alg", ["twopasses", "floodfill"])
+@pytest.mark.parametrize("maxNonBlack", [0, 2])
+def test_nearblack_lib_num_threads(alg, maxNonBlack):
+
+    width = 60
+    height = 500
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 3)
+    data = array.array("B")
+    seed = 1
+    for j in range(height):
+        # Collar of varying width, with noise
+        collar = (j * 7) % 23
+        for i in range(width):
+            seed = (seed * 1103515245 + 12345) % (1 << 31)
+            if i < collar or j < 5 or j >= height - (i % 9):
+                data.append((seed >> 16) % 20)
+            else:
+                data.append(100 + (seed >> 16) % 100)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(0, 0, width, height, data.tobytes())
+
+    ref_ds = gdal.Nearblack(
+        "",
+        src_ds,
+        format="MEM",
+        maxNonBlack=maxNonBlack,
+        setAlpha=True,
+        alg=alg,
+        numThreads=1,
+    )
+    ds = gdal.Nearblack(
+        "",
+        src_ds,
+        format="MEM",
+        maxNonBlack=maxNonBlack,
+        setAlpha=True,
+        alg=alg,
+        numThreads=4,
+    )
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+def test_nearblack_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.Nearblack(
+            "", "../gdrivers/data/rgbsmall.tif", format="MEM", numThreads="invalid"
+        )
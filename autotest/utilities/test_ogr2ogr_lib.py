@@ -2924,6 +2924,82 @@ def test_ogr2ogr_lib_reproject_arrow(tmp_vsimem, source_driver, force_reproj_thr
             ogrtest.check_feature_geometry(f, "POINT(3 36.14471809881776)")
 
 
+###############################################################################
+# Test multithreaded reprojection in the non-Arrow code path
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("limit", [None, 5])
+def test_ogr2ogr_lib_reproject_feature_pipeline(limit):
+
+    srcDS = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    srcLayer.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f["id"] = i
+        if i == 3:
+            pass
+        elif i == 6:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "CIRCULARSTRING(500000 4500000,500100 4500100,500200 4500000)"
+                )
+            )
+        else:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(f"POINT({500000 + i * 1000} 4500000)")
+            )
+        srcLayer.CreateFeature(f)
+
+    def translate(config_options):
+        got_msg = []
+
+        def my_handler(errorClass, errno, msg):
+            got_msg.append(msg)
+            return
+
+        with gdaltest.error_handler(my_handler), gdaltest.config_options(
+            config_options
+        ):
+            ds = gdal.VectorTranslate(
+                "", srcDS, format="MEM", dstSRS="EPSG:4326", limit=limit
+            )
+        return ds, got_msg
+
+    ref_ds, got_msg = translate(
+        {"CPL_DEBUG": "ON", "OGR2OGR_USE_ARROW_API": "NO", "GDAL_NUM_THREADS": "1"}
+    )
+    assert not any("threads for reprojection" in msg for msg in got_msg)
+
+    ds, got_msg = translate(
+        {
+            "CPL_DEBUG": "ON",
+            "OGR2OGR_USE_ARROW_API": "NO",
+            "GDAL_NUM_THREADS": "4",
+            "OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ": "3",
+        }
+    )
+    assert "OGR2OGR: Using up to 4 threads for reprojection of layer test" in got_msg
+
+    ref_lyr = ref_ds.GetLayer(0)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == (limit if limit else 10)
+    assert lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+    for ref_f, f in zip(ref_lyr, lyr):
+        assert f["id"] == ref_f["id"]
+        ref_geom = ref_f.GetGeometryRef()
+        if ref_geom is None:
+            assert f.GetGeometryRef() is None
+        else:
+            assert f.GetGeometryRef().GetSpatialReference().IsSame(
+                ref_geom.GetSpatialReference()
+            )
+            ogrtest.check_feature_geometry(f, ref_geom)
+
+
 ###############################################################################
 # Test -t_srs in Arrow code path in a situation where it cannot be triggered
 # currently (source CRS is crossing anti-meridian)
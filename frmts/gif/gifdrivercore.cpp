@@ -40,6 +40,8 @@ void BIGGIFDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/gif.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "gif");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/gif");
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "474946383761 474946383961");
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
 
     poDriver->pfnIdentify = GIFDriverIdentify;
@@ -59,6 +61,8 @@ void GIFDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/gif.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "gif");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/gif");
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "474946383761 474946383961");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST,
@@ -29,6 +29,7 @@
 #endif
 
 #include <algorithm>
+#include <limits>
 #include <mutex>
 #include <set>
 #include <string>
@@ -57,8 +58,6 @@ CPL_C_END
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
-static CPLMutex *hGRIBMutex = nullptr;
-
 /************************************************************************/
 /*                         ConvertUnitInText()                          */
 /************************************************************************/
@@ -1112,6 +1111,57 @@ double GRIBRasterBand::GetNoDataValue(int *pbSuccess)
     return m_dfNoData;
 }
 
+/************************************************************************/
+/*                         IngestGRIB2Message()                         */
+/*                                                                      */
+/*      Read a whole GRIB2 message, whose length is given by its        */
+/*      section 0, with a single read, and return an in-memory file     */
+/*      wrapping it. This turns decoding into one ranged request on     */
+/*      network file systems, and lets it proceed without further       */
+/*      access to fp. Returns nullptr if the message is not GRIB2 or    */
+/*      cannot be fully read, in which case the caller decodes directly */
+/*      from fp.                                                        */
+/************************************************************************/
+
+static VSILFILE *IngestGRIB2Message(VSILFILE *fp, vsi_l_offset start)
+{
+    constexpr int SECT0_SIZE = 16;
+    GByte abySect0[SECT0_SIZE];
+    if (VSIFSeekL(fp, start, SEEK_SET) != 0 ||
+        VSIFReadL(abySect0, 1, SECT0_SIZE, fp) != SECT0_SIZE ||
+        memcmp(abySect0, "GRIB", 4) != 0 || abySect0[7] != 2)
+    {
+        return nullptr;
+    }
+
+    uint64_t nMsgLen = 0;
+    for (int i = 8; i < SECT0_SIZE; ++i)
+        nMsgLen = (nMsgLen << 8) | abySect0[i];
+    // Section 0 followed by at least the "7777" end section.
+    if (nMsgLen < SECT0_SIZE + 4 ||
+        nMsgLen > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+    {
+        return nullptr;
+    }
+
+    GByte *pabyMsg =
+        static_cast<GByte *>(VSIMalloc(static_cast<size_t>(nMsgLen)));
+    if (pabyMsg == nullptr)
+        return nullptr;
+    memcpy(pabyMsg, abySect0, SECT0_SIZE);
+    const size_t nToRead = static_cast<size_t>(nMsgLen) - SECT0_SIZE;
+    if (VSIFReadL(pabyMsg + SECT0_SIZE, 1, nToRead, fp) != nToRead)
+    {
+        VSIFree(pabyMsg);
+        return nullptr;
+    }
+
+    VSILFILE *memfp = VSIFileFromMemBuffer(nullptr, pabyMsg, nMsgLen, TRUE);
+    if (memfp == nullptr)
+        VSIFree(pabyMsg);
+    return memfp;
+}
+
 /************************************************************************/
 /*                            ReadGribData()                            */
 /************************************************************************/
@@ -1150,15 +1200,21 @@ void GRIBRasterBand::ReadGribData(VSILFILE *fp, vsi_l_offset start, int subgNum,
         f_unit = 0;  // Do not normalize units to metric.
 
     start = FindTrueStart(fp, start);
+    // Decode GRIB2 messages from memory, so that the decoder does not seek
+    // around in fp.
+    VSILFILE *memfp = IngestGRIB2Message(fp, start);
+    VSILFILE *fpMsg = memfp ? memfp : fp;
     // Read GRIB message from file position "start".
-    VSIFSeekL(fp, start, SEEK_SET);
+    VSIFSeekL(fpMsg, memfp ? 0 : start, SEEK_SET);
     uInt4 grib_DataLen = 0;  // Size of Grib_Data.
     *metaData = new grib_MetaData();
     MetaInit(*metaData);
     const int simpWWA = 0;  // seem to be unused in degrib
-    ReadGrib2Record(fp, f_unit, data, &grib_DataLen, *metaData, &is, subgNum,
-                    majEarth, minEarth, f_SimpleVer, simpWWA, &f_endMsg, &lwlf,
-                    &uprt);
+    ReadGrib2Record(fpMsg, f_unit, data, &grib_DataLen, *metaData, &is,
+                    subgNum, majEarth, minEarth, f_SimpleVer, simpWWA,
+                    &f_endMsg, &lwlf, &uprt);
+    if (memfp)
+        VSIFCloseL(memfp);
 
     // No intention to show errors, just swallow it and free the memory.
     char *errMsg = errSprintf(nullptr);
@@ -1337,6 +1393,81 @@ InventoryWrapperSidecar::~InventoryWrapperSidecar()
     VSIFree(inv_);
 }
 
+/************************************************************************/
+/*                           WriteSidecarIdx()                          */
+/*                                                                      */
+/*      Persist an inventory built by scanning the GRIB file as a       */
+/*      wgrib2-like index, that InventoryWrapperSidecar can read back:  */
+/*      "msgNum[.subgNum]:start:d=YYYYMMDDHH:element:level:forecast:"   */
+/************************************************************************/
+
+static void WriteSidecarIdx(const std::string &osSideCarFilename,
+                            const gdal::grib::InventoryWrapper &oInv)
+{
+    const auto SanitizeToken = [](const char *pszToken)
+    {
+        std::string osToken(pszToken ? pszToken : "");
+        std::replace(osToken.begin(), osToken.end(), ':', ' ');
+        std::replace(osToken.begin(), osToken.end(), '\n', ' ');
+        return osToken;
+    };
+
+    std::string osContent;
+    int nMsgNum = 0;
+    for (int i = 0; i < static_cast<int>(oInv.length()); ++i)
+    {
+        const inventoryType *psInv = oInv.get(i);
+        const inventoryType *psPrevInv = oInv.get(i - 1);
+        const inventoryType *psNextInv = oInv.get(i + 1);
+        const bool bSameAsPrev = psPrevInv && psPrevInv->start == psInv->start;
+        const bool bSameAsNext = psNextInv && psNextInv->start == psInv->start;
+        if (!bSameAsPrev)
+            ++nMsgNum;
+
+        std::string osNum(CPLSPrintf("%d", nMsgNum));
+        if (bSameAsPrev || bSameAsNext)
+            osNum += CPLSPrintf(".%d", psInv->subgNum + 1);
+
+        struct tm brokenDown;
+        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(psInv->refTime), &brokenDown);
+
+        std::string osForecast;
+        const int nForeSec = static_cast<int>(psInv->foreSec);
+        if (nForeSec == 0)
+            osForecast = "anl";
+        else if ((nForeSec % 3600) == 0)
+            osForecast = CPLSPrintf("%d hour fcst", nForeSec / 3600);
+        else
+            osForecast = CPLSPrintf("%d min fcst", nForeSec / 60);
+
+        osContent += CPLSPrintf(
+            "%s:" CPL_FRMT_GUIB ":d=%04d%02d%02d%02d:%s:%s:%s:\n",
+            osNum.c_str(), static_cast<GUIntBig>(psInv->start),
+            brokenDown.tm_year + 1900, brokenDown.tm_mon + 1,
+            brokenDown.tm_mday, brokenDown.tm_hour,
+            SanitizeToken(psInv->element).c_str(),
+            SanitizeToken(psInv->longFstLevel).c_str(), osForecast.c_str());
+    }
+
+    VSILFILE *fpSideCar = VSIFOpenL(osSideCarFilename.c_str(), "wb");
+    if (fpSideCar == nullptr)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot create %s",
+                 osSideCarFilename.c_str());
+        return;
+    }
+    bool bOK =
+        VSIFWriteL(osContent.data(), 1, osContent.size(), fpSideCar) ==
+        osContent.size();
+    bOK = VSIFCloseL(fpSideCar) == 0 && bOK;
+    if (!bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Error while writing %s",
+                 osSideCarFilename.c_str());
+        VSIUnlink(osSideCarFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              GRIBDataset                             */
@@ -1434,6 +1565,20 @@ GRIBDataset::Inventory(GDALOpenInfo *poOpenInfo)
                  poOpenInfo->pszFilename);
         // Contains an GRIB2 message inventory of the file.
         pInventories = std::make_unique<InventoryWrapperGrib>(fp);
+
+        // Persist the inventory, so that next opens do not need to scan
+        // the whole file.
+        VSIStatBufL sStat;
+        if (pInventories->result() > 0 && pInventories->length() > 0 &&
+            nStartOffset == 0 && nSize < 0 &&
+            CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                             "CREATE_IDX", "NO")) &&
+            VSIStatL(osSideCarFilename.c_str(), &sStat) != 0)
+        {
+            CPLDebug("GRIB", "Writing inventories to sidecar file %s",
+                     osSideCarFilename.c_str());
+            WriteSidecarIdx(osSideCarFilename, *pInventories);
+        }
     }
 
     return pInventories;
@@ -1461,10 +1606,6 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
     uInt4 gribLen = 0;
     int version = 0;
 
-    // grib is not thread safe, make sure not to cause problems
-    // for other thread safe formats
-    CPLMutexHolderD(&hGRIBMutex);
-
     VSILFILE *memfp = VSIFileFromMemBuffer(nullptr, poOpenInfo->pabyHeader,
                                            poOpenInfo->nHeaderBytes, FALSE);
     if (memfp == nullptr ||
@@ -1521,11 +1662,7 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
                  "%s is a grib file, "
                  "but no raster dataset was successfully identified.",
                  poOpenInfo->pszFilename);
-        // Release hGRIBMutex otherwise we'll deadlock with GDALDataset own
-        // hGRIBMutex.
-        CPLReleaseMutex(hGRIBMutex);
         delete poDS;
-        CPLAcquireMutex(hGRIBMutex, 1000.0);
         return nullptr;
     }
 
@@ -1552,11 +1689,7 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
                          "%s is a grib file, "
                          "but no raster dataset was successfully identified.",
                          poOpenInfo->pszFilename);
-                // Release hGRIBMutex otherwise we'll deadlock with GDALDataset
-                // own hGRIBMutex.
-                CPLReleaseMutex(hGRIBMutex);
                 delete poDS;
-                CPLAcquireMutex(hGRIBMutex, 1000.0);
                 if (metaData != nullptr)
                 {
                     MetaFree(metaData);
@@ -1586,14 +1719,10 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
     // Initialize any PAM information.
     poDS->SetDescription(poOpenInfo->pszFilename);
 
-    // Release hGRIBMutex otherwise we'll deadlock with GDALDataset own
-    // hGRIBMutex.
-    CPLReleaseMutex(hGRIBMutex);
     poDS->TryLoadXML(poOpenInfo->GetSiblingFiles());
 
     // Check for external overviews.
     poDS->oOvManager.Initialize(poDS, poOpenInfo);
-    CPLAcquireMutex(hGRIBMutex, 1000.0);
 
     return poDS;
 }
@@ -2394,9 +2523,7 @@ GDALDataset *GRIBDataset::OpenMultiDim(GDALOpenInfo *poOpenInfo)
                     delete metaData;
                 }
                 poDS->fp = nullptr;
-                CPLReleaseMutex(hGRIBMutex);
                 delete poDS;
-                CPLAcquireMutex(hGRIBMutex, 1000.0);
                 return nullptr;
             }
             psInv->GribVersion = metaData->GribVersion;
@@ -2449,11 +2576,7 @@ GDALDataset *GRIBDataset::OpenMultiDim(GDALOpenInfo *poOpenInfo)
 
     poDS->SetDescription(poOpenInfo->pszFilename);
 
-    // Release hGRIBMutex otherwise we'll deadlock with GDALDataset own
-    // hGRIBMutex.
-    CPLReleaseMutex(hGRIBMutex);
     poDS->TryLoadXML();
-    CPLAcquireMutex(hGRIBMutex, 1000.0);
 
     return poDS;
 }
@@ -2869,12 +2992,7 @@ void GRIBDataset::SetGribMetaData(grib_MetaData *meta)
 
 static void GDALDeregister_GRIB(GDALDriver *)
 {
-    if (hGRIBMutex != nullptr)
-    {
-        MetanameCleanup();
-        CPLDestroyMutex(hGRIBMutex);
-        hGRIBMutex = nullptr;
-    }
+    MetanameCleanup();
 }
 
 /************************************************************************/
@@ -54,6 +54,10 @@ void GRIBDriverSetCommonMetadata(GDALDriver *poDriver)
                               "    <Option name='USE_IDX' type='boolean' "
                               "description='Load metadata from "
                               "wgrib2 index file if available' default='YES'/>"
+                              "    <Option name='CREATE_IDX' type='boolean' "
+                              "description='Whether to write a wgrib2-like "
+                              "index file after scanning a GRIB file that has "
+                              "none' default='NO'/>"
                               "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/grib.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "grb grb2 grib2");
@@ -232,6 +232,14 @@ class GDALTileIndexDataset final : public GDALPamDataset
     lru11::Cache<std::string, std::shared_ptr<GDALDataset>> m_oMapSharedSources{
         500};
 
+    //! Cache from the georeferenced window of a pixel request to the
+    //! features of m_poLayer intersecting it. Avoids re-running the spatial
+    //! query when the same windows are requested again, e.g. when reading
+    //! block by block each band of a pixel-interleaved dataset.
+    lru11::Cache<std::string,
+                 std::shared_ptr<const std::vector<std::unique_ptr<OGRFeature>>>>
+        m_oMapQueryResults{64};
+
     //! Mask band (e.g. for JPEG compressed + mask band)
     std::unique_ptr<GDALTileIndexBand> m_poMaskBand{};
 
@@ -346,6 +354,11 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Sort sources according to m_nSortFieldIndex.
     void SortSourceDesc();
 
+    //! Open in parallel the sources of m_aoSourceDesc[] that are not yet in
+    //! m_oMapSharedSources and are likely to be rendered.
+    void PrefetchSources(double dfMinX, double dfMinY, double dfMaxX,
+                         double dfMaxY);
+
     //! Whether the output buffer needs to be nodata initialized, or if
     //! sources are fully covering it.
     bool NeedInitBuffer(int nBandCount, const int *panBandMap) const;
@@ -1085,14 +1098,17 @@ bool GDALTileIndexDataset::Open(GDALOpenInfo *poOpenInfo)
     m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     if (pszSRS)
     {
-        if (m_oSRS.SetFromUserInput(
-                pszSRS,
-                OGRSpatialReference::SET_FROM_USER_INPUT_LIMITATIONS_get()) !=
-            OGRERR_NONE)
+        // Use the process-wide cache, as many GTI datasets with the same
+        // SRS may be opened, typically when they are nested.
+        const auto poSRS = OGRSpatialReference::GetCachedFromUserInput(
+            pszSRS, OAMS_TRADITIONAL_GIS_ORDER,
+            OGRSpatialReference::SET_FROM_USER_INPUT_LIMITATIONS_get());
+        if (!poSRS)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Invalid %s", MD_SRS);
             return false;
         }
+        m_oSRS = *poSRS;
     }
     else if (const auto poSRS = m_poLayer->GetSpatialRef())
     {
@@ -2647,6 +2663,7 @@ CPLErr GDALTileIndexDataset::FlushCache(bool bAtClosing)
     // change the content of a source and would want the GTI dataset to see
     // the refreshed content.
     m_oMapSharedSources.clear();
+    m_oMapQueryResults.clear();
     m_dfLastMinXFilter = std::numeric_limits<double>::quiet_NaN();
     m_dfLastMinYFilter = std::numeric_limits<double>::quiet_NaN();
     m_dfLastMaxXFilter = std::numeric_limits<double>::quiet_NaN();
@@ -3421,6 +3438,8 @@ bool GDALTileIndexDataset::GetSourceDesc(const std::string &osTileName,
                 aosOptions.AddString(m_osResampling.c_str());
             }
 
+            if (pMutex)
+                pMutex->lock();
             if (m_osWKT.empty())
             {
                 char *pszWKT = nullptr;
@@ -3431,6 +3450,8 @@ bool GDALTileIndexDataset::GetSourceDesc(const std::string &osTileName,
                     m_osWKT = pszWKT;
                 CPLFree(pszWKT);
             }
+            if (pMutex)
+                pMutex->unlock();
             if (m_osWKT.empty())
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -3635,32 +3656,65 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     m_dfLastMaxYFilter = dfMaxY;
     m_bLastMustUseMultiThreading = false;
 
-    m_poLayer->SetSpatialFilterRect(dfMinX, dfMinY, dfMaxX, dfMaxY);
-    m_poLayer->ResetReading();
-
     m_aoSourceDesc.clear();
-    while (true)
+
+    const std::string osQueryKey(CPLSPrintf("%.17g,%.17g,%.17g,%.17g", dfMinX,
+                                            dfMinY, dfMaxX, dfMaxY));
+    std::shared_ptr<const std::vector<std::unique_ptr<OGRFeature>>>
+        poQueryResult;
+    if (m_oMapQueryResults.tryGet(osQueryKey, poQueryResult))
     {
-        auto poFeature =
-            std::unique_ptr<OGRFeature>(m_poLayer->GetNextFeature());
-        if (!poFeature)
-            break;
-        if (!poFeature->IsFieldSetAndNotNull(m_nLocationFieldIndex))
+        for (const auto &poFeature : *poQueryResult)
         {
-            continue;
+            SourceDesc oSourceDesc;
+            oSourceDesc.poFeature.reset(poFeature->Clone());
+            m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
         }
+    }
+    else
+    {
+        m_poLayer->SetSpatialFilterRect(dfMinX, dfMinY, dfMaxX, dfMaxY);
+        m_poLayer->ResetReading();
 
-        SourceDesc oSourceDesc;
-        oSourceDesc.poFeature = std::move(poFeature);
-        m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
+        while (true)
+        {
+            auto poFeature =
+                std::unique_ptr<OGRFeature>(m_poLayer->GetNextFeature());
+            if (!poFeature)
+                break;
+            if (!poFeature->IsFieldSetAndNotNull(m_nLocationFieldIndex))
+            {
+                continue;
+            }
+
+            SourceDesc oSourceDesc;
+            oSourceDesc.poFeature = std::move(poFeature);
+            m_aoSourceDesc.emplace_back(std::move(oSourceDesc));
+
+            if (m_aoSourceDesc.size() > 10 * 1000 * 1000)
+            {
+                // Safety belt...
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "More than 10 million contributing sources to a "
+                         "single RasterIO() request is not supported");
+                return false;
+            }
+        }
 
-        if (m_aoSourceDesc.size() > 10 * 1000 * 1000)
+        // Do not retain the results of requests involving many sources, that
+        // are not likely to be repeated, and would take a lot of memory.
+        constexpr size_t MAX_CACHED_FEATURES_PER_QUERY = 1000;
+        if (m_aoSourceDesc.size() <= MAX_CACHED_FEATURES_PER_QUERY)
         {
-            // Safety belt...
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "More than 10 million contributing sources to a "
-                     "single RasterIO() request is not supported");
-            return false;
+            auto poNewQueryResult =
+                std::make_shared<std::vector<std::unique_ptr<OGRFeature>>>();
+            poNewQueryResult->reserve(m_aoSourceDesc.size());
+            for (const auto &oSourceDesc : m_aoSourceDesc)
+            {
+                poNewQueryResult->emplace_back(
+                    oSourceDesc.poFeature->Clone());
+            }
+            m_oMapQueryResults.insert(osQueryKey, std::move(poNewQueryResult));
         }
     }
 
@@ -3756,6 +3810,7 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     if (m_aoSourceDesc.size() > 1)
     {
         SortSourceDesc();
+        PrefetchSources(dfMinX, dfMinY, dfMaxX, dfMaxY);
     }
 
     // Try to find the last (most prioritary) fully opaque source covering
@@ -3964,6 +4019,108 @@ void GDALTileIndexDataset::SortSourceDesc()
         });
 }
 
+/************************************************************************/
+/*                          PrefetchSources()                           */
+/************************************************************************/
+
+void GDALTileIndexDataset::PrefetchSources(double dfMinX, double dfMinY,
+                                           double dfMaxX, double dfMaxY)
+{
+    // Opening sources is generally dominated by I/O latency (typically for
+    // cloud-hosted files), so open in parallel those that CollectSources()
+    // will have to open sequentially afterwards. We walk the sources in
+    // the same order as CollectSources(), and stop at the first one whose
+    // footprint covers the whole area of interest, as it is likely to
+    // hide the ones below it.
+    std::vector<std::string> aosTileNames;
+    std::set<std::string> oSetTileNames;
+    for (size_t i = m_aoSourceDesc.size(); i > 0;)
+    {
+        --i;
+        const auto &poFeature = m_aoSourceDesc[i].poFeature;
+        std::string osTileName(GetAbsoluteFileName(
+            poFeature->GetFieldAsString(m_nLocationFieldIndex),
+            GetDescription()));
+        if (!m_oMapSharedSources.contains(osTileName) &&
+            oSetTileNames.insert(osTileName).second)
+        {
+            aosTileNames.push_back(std::move(osTileName));
+        }
+
+        const auto poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            if (sEnvelope.MinX <= dfMinX && sEnvelope.MinY <= dfMinY &&
+                sEnvelope.MaxX >= dfMaxX && sEnvelope.MaxY >= dfMaxY)
+            {
+                break;
+            }
+        }
+    }
+
+    if (aosTileNames.size() <= 1)
+        return;
+    // Prefetched sources must not be evicted from m_oMapSharedSources
+    // before CollectSources() uses them.
+    if (aosTileNames.size() + m_aoSourceDesc.size() >
+        m_oMapSharedSources.getMaxSize())
+        return;
+
+    if (m_nNumThreads < 0)
+        m_nNumThreads = GetNumThreads();
+    GDALThreadReservation oReservation(
+        std::min(static_cast<int>(aosTileNames.size()), m_nNumThreads));
+    const int nThreads = oReservation.GetThreadCount();
+    if (nThreads <= 1)
+        return;
+
+    CPLWorkerThreadPool *psThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!psThreadPool)
+        return;
+    auto poQueue = psThreadPool->CreateJobQueue();
+    CPLDebugOnly("GTI", "Opening %d sources using %d threads",
+                 static_cast<int>(aosTileNames.size()), nThreads);
+
+    std::mutex oMutex;
+    // Errors of the sources that could not be opened are not replayed, as
+    // they will be emitted again when CollectSources() retries opening them.
+    std::vector<CPLErrorAccumulator> aoErrorAccumulators(aosTileNames.size());
+    std::vector<char> abOpened(aosTileNames.size(), false);
+    // Datasets opened by the worker threads are attached to the current
+    // thread, as if they had been opened by CollectSources().
+    const GIntBig nResponsiblePID = GDALGetResponsiblePIDForCurrentThread();
+    for (size_t i = 0; i < aosTileNames.size(); ++i)
+    {
+        const auto Job = [this, i, &aosTileNames, &aoErrorAccumulators,
+                          &abOpened, &oMutex, nResponsiblePID]()
+        {
+            const GIntBig nOldResponsiblePID =
+                GDALGetResponsiblePIDForCurrentThread();
+            GDALSetResponsiblePIDForCurrentThread(nResponsiblePID);
+            {
+                auto oAccumulator =
+                    aoErrorAccumulators[i].InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                SourceDesc oSourceDesc;
+                abOpened[i] =
+                    GetSourceDesc(aosTileNames[i], oSourceDesc, &oMutex);
+            }
+            GDALSetResponsiblePIDForCurrentThread(nOldResponsiblePID);
+        };
+        if (!poQueue->SubmitJob(Job))
+            Job();
+    }
+    poQueue->WaitCompletion();
+
+    for (size_t i = 0; i < aosTileNames.size(); ++i)
+    {
+        if (abOpened[i])
+            aoErrorAccumulators[i].ReplayErrors();
+    }
+}
+
 /************************************************************************/
 /*                   CompositeSrcWithMaskIntoDest()                     */
 /************************************************************************/
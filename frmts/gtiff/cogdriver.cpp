@@ -1106,6 +1106,53 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
     }
 
+    // Generate the temporary overviews in a /vsimem/ file, instead of a
+    // temporary file on disk, when their uncompressed size is below the
+    // threshold.
+    bool bTmpOverviewsInMemory = false;
+    if (bGenerateMskOvr || bGenerateOvr)
+    {
+        GIntBig nMaxInMemorySize = 0;
+        const char *pszMaxInMemorySize =
+            CPLGetConfigOption("COG_TMP_OVERVIEWS_MAX_IN_MEMORY_SIZE", "0");
+        if (CPLParseMemorySize(pszMaxInMemorySize, &nMaxInMemorySize,
+                               nullptr) != CE_None)
+        {
+            return nullptr;
+        }
+        if (nMaxInMemorySize > 0)
+        {
+            const int nDTSize = GDALGetDataTypeSizeBytes(
+                poFirstBand->GetRasterDataType());
+            double dfOvrSize = 0;
+            for (const auto &[nOvrXSize, nOvrYSize] : asOverviewDims)
+            {
+                const double dfPixels = double(nOvrXSize) * nOvrYSize;
+                if (bGenerateOvr)
+                    dfOvrSize += dfPixels * nBands * nDTSize;
+                if (bGenerateMskOvr)
+                    dfOvrSize += dfPixels;
+            }
+            bTmpOverviewsInMemory =
+                dfOvrSize <= static_cast<double>(nMaxInMemorySize);
+            if (bTmpOverviewsInMemory)
+                CPLDebug("COG", "Temporary overviews generated in memory");
+        }
+    }
+    const auto GetTmpOverviewFilename = [pszFilename, bTmpOverviewsInMemory](
+                                            const char *pszExt) -> CPLString
+    {
+        if (bTmpOverviewsInMemory)
+        {
+            CPLString osTmpFilename(VSIMemGenerateHiddenFilename(
+                CPLGetFilename(pszFilename)));
+            osTmpFilename += '.';
+            osTmpFilename += pszExt;
+            return osTmpFilename;
+        }
+        return GetTmpFilename(pszFilename, pszExt);
+    };
+
     CPLStringList aosOverviewOptions;
     aosOverviewOptions.SetNameValue(
         "COMPRESS",
@@ -1119,7 +1166,7 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetTmpOverviewFilename("msk.ovr.tmp");
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1149,7 +1196,7 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpOverviewFilename("ovr.tmp");
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
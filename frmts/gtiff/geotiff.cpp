@@ -27,6 +27,7 @@
 #include "xtiffio.h"
 #include <cctype>
 #include <cmath>
+#include <mutex>
 
 // Needed to expose WEBP_LOSSLESS option
 #ifdef WEBP_SUPPORT
@@ -929,6 +930,7 @@ static void GDALDeregister_GTiff(GDALDriver *)
     if (pJXLCodecDNG17)
         TIFFUnRegisterCODEC(pJXLCodecDNG17);
     pJXLCodecDNG17 = nullptr;
+    TIFFJXLCleanupEncoderCache();
 #endif
 }
 
@@ -1207,16 +1209,13 @@ static GDALSubdatasetInfo *GTiffDriverGetSubdatasetInfo(const char *pszFileName)
 }
 
 /************************************************************************/
-/*                          GDALRegister_GTiff()                        */
+/*                          GDALGTiffDriver                             */
 /************************************************************************/
 
-void GDALRegister_GTiff()
-
+class GDALGTiffDriver final : public GDALDriver
 {
-    if (GDALGetDriverByName("GTiff") != nullptr)
-        return;
-
-    CPLString osOptions;
+    std::mutex m_oMutex{};
+    bool m_bInitialized = false;
 
     bool bHasLZW = false;
     bool bHasDEFLATE = false;
@@ -1225,11 +1224,53 @@ void GDALRegister_GTiff()
     bool bHasJPEG = false;
     bool bHasWebP = false;
     bool bHasLERC = false;
-    CPLString osCompressValues(GTiffGetCompressValues(
-        bHasLZW, bHasDEFLATE, bHasLZMA, bHasZSTD, bHasJPEG, bHasWebP, bHasLERC,
-        false /* bForCOG */));
+    std::string osCompressValues{};
+
+    void InitializeCreationOptionList();
+
+  public:
+    GDALGTiffDriver();
+
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
+    char **GetMetadata(const char *pszDomain) override
+    {
+        std::lock_guard oLock(m_oMutex);
+        InitializeCreationOptionList();
+        return GDALDriver::GetMetadata(pszDomain);
+    }
+};
+
+GDALGTiffDriver::GDALGTiffDriver()
+{
+    // Same as in GDALCOGDriver: the list of codecs must be collected at
+    // registration time to be robust to bugs of TIFFGetConfiguredCODECs() in
+    // released libtiff versions. Only the building of the (large) creation
+    // option list is deferred until it is actually needed.
+    osCompressValues = GTiffGetCompressValues(bHasLZW, bHasDEFLATE, bHasLZMA,
+                                              bHasZSTD, bHasJPEG, bHasWebP,
+                                              bHasLERC, false /* bForCOG */);
+}
+
+const char *GDALGTiffDriver::GetMetadataItem(const char *pszName,
+                                             const char *pszDomain)
+{
+    std::lock_guard oLock(m_oMutex);
+    if (EQUAL(pszName, GDAL_DMD_CREATIONOPTIONLIST))
+    {
+        InitializeCreationOptionList();
+    }
+    return GDALDriver::GetMetadataItem(pszName, pszDomain);
+}
+
+void GDALGTiffDriver::InitializeCreationOptionList()
+{
+    if (m_bInitialized)
+        return;
+    m_bInitialized = true;
 
-    GDALDriver *poDriver = new GDALDriver();
+    CPLString osOptions;
 
     /* -------------------------------------------------------------------- */
     /*      Build full creation option list.                                */
@@ -1369,6 +1410,9 @@ void GDALRegister_GTiff()
         "   </Option>"
         "   <Option name='SPARSE_OK' type='boolean' description='Should empty "
         "blocks be omitted on disk?' default='FALSE'/>"
+        "   <Option name='CONCURRENT_BLOCK_WRITES' type='boolean' "
+        "description='Whether GDALRasterBand::WriteBlock() can be called "
+        "from several threads on distinct blocks' default='FALSE'/>"
         "   <Option name='ALPHA' type='string-select' description='Mark first "
         "extrasample as being alpha'>"
         "       <Value>NON-PREMULTIPLIED</Value>"
@@ -1451,6 +1495,21 @@ void GDALRegister_GTiff()
         "   </Option>"
         "</CreationOptionList>";
 
+    SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osOptions);
+}
+
+/************************************************************************/
+/*                          GDALRegister_GTiff()                        */
+/************************************************************************/
+
+void GDALRegister_GTiff()
+
+{
+    if (GDALGetDriverByName("GTiff") != nullptr)
+        return;
+
+    GDALDriver *poDriver = new GDALGTiffDriver();
+
     /* -------------------------------------------------------------------- */
     /*      Set the driver details.                                         */
     /* -------------------------------------------------------------------- */
@@ -1461,10 +1520,14 @@ void GDALRegister_GTiff()
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/tiff");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "tif");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "tif tiff");
+    // Classic TIFF and BigTIFF, in any byte order combination accepted by
+    // GTiffDataset::Identify()
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "49492A00 4D4D002A 49492B00 4D4D002B "
+                              "4949002A 4D4D2A00 4949002B 4D4D2B00");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES,
                               "Byte Int8 UInt16 Int16 UInt32 Int32 Float32 "
                               "Float64 CInt16 CInt32 CFloat32 CFloat64");
-    poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osOptions);
     poDriver->SetMetadataItem(
         GDAL_DMD_OPENOPTIONLIST,
         "<OpenOptionList>"
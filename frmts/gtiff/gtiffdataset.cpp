@@ -441,13 +441,13 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
         int bTried = FALSE;
-        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+        if (IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
             ++m_nJPEGOverviewVisibilityCounter;
         const CPLErr eErr = TryOverviewRasterIO(
             eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
             eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
             nBandSpace, psExtraArg, &bTried);
-        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+        if (IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
             --m_nJPEGOverviewVisibilityCounter;
         if (bTried)
             return eErr;
@@ -669,13 +669,13 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+    if (IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
         ++m_nJPEGOverviewVisibilityCounter;
     const CPLErr eErr = GDALPamDataset::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
         psExtraArg);
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+    if (IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
         m_nJPEGOverviewVisibilityCounter--;
 
     if (pBufferedData)
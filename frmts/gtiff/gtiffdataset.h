@@ -18,6 +18,7 @@
 
 #include <mutex>
 #include <queue>
+#include <string>
 
 #include "cpl_mem_cache.h"
 #include "cpl_worker_thread_pool.h"  // CPLJobQueue, CPLWorkerThreadPool
@@ -148,6 +149,19 @@ class GTiffDataset final : public GDALPamDataset
     std::unique_ptr<CPLJobQueue> m_poCompressQueue{};
     std::mutex m_oCompressThreadPoolMutex{};
 
+    // Used when CONCURRENT_BLOCK_WRITES=YES
+    std::mutex m_oConcurrentBlockWritesMutex{};
+    bool m_bConcurrentBlockWrites = false;
+    bool m_bConcurrentBlockWritesReady = false;
+    uint16_t m_nConcurrentBlockWritesPredictor = 0;
+    uint16_t m_nConcurrentBlockWritesExtraSampleCount = 0;
+    uint16_t *m_panConcurrentBlockWritesExtraSamples = nullptr;
+
+    // Prefix of the keys in the process-wide decoded tile cache
+    // (GDAL_DECODED_TILE_CACHE_SIZE), or empty if not used.
+    std::string m_osDecodedTileCacheKey{};
+    bool m_bDecodedTileCacheChecked = false;
+
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
         m_oCacheStrileToOffsetByteCount{1024};
 
@@ -310,6 +324,9 @@ class GTiffDataset final : public GDALPamDataset
     void ScanDirectories();
     bool ReadStrile(int nBlockId, void *pOutputBuffer,
                     GPtrDiff_t nBlockReqSize);
+    bool ReadStrileFromFile(int nBlockId, void *pOutputBuffer,
+                            GPtrDiff_t nBlockReqSize,
+                            bool *pbCacheable = nullptr);
     CPLErr LoadBlockBuf(int nBlockId, bool bReadFromDisk = true);
     CPLErr FlushBlockBuf();
 
@@ -326,6 +343,15 @@ class GTiffDataset final : public GDALPamDataset
     void ReloadDirectory(bool bReopenHandle = false);
 
     int GetJPEGOverviewCount();
+    int GetJPEGOverviewCountFinerThan(int nXSize);
+
+    // libjpeg DCT scaling is a good approximation of averaging, so implicit
+    // JPEG overviews are suitable for nearest and average resampling.
+    static bool IsJPEGOverviewResampling(GDALRIOResampleAlg eResampleAlg)
+    {
+        return eResampleAlg == GRIORA_NearestNeighbour ||
+               eResampleAlg == GRIORA_Average;
+    }
 
     bool IsBlockAvailable(int nBlockId, vsi_l_offset *pnOffset,
                           vsi_l_offset *pnSize, bool *pbErrOccurred);
@@ -375,6 +401,7 @@ class GTiffDataset final : public GDALPamDataset
                              GPtrDiff_t nCompressedBufferSize);
     bool SubmitCompressionJob(int nStripOrTile, GByte *pabyData, GPtrDiff_t cc,
                               int nHeight);
+    CPLErr WriteBlockConcurrently(int nBlockId, const void *pImage);
 
     int GuessJPEGQuality(bool &bOutHasQuantizationTable,
                          bool &bOutHasHuffmanTable);
@@ -36,6 +36,7 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
 #include "fetchbufferdirectio.h"
+#include "gdal_decoded_tile_cache.h"
 #include "gdal_mdreader.h"    // MD_DOMAIN_RPC
 #include "geovalues.h"        // RasterPixelIsPoint
 #include "gt_wkt_srs_priv.h"  // GDALGTIFKeyGetSHORT()
@@ -120,6 +121,25 @@ int GTiffDataset::GetJPEGOverviewCount()
     return m_nJPEGOverviewCount;
 }
 
+/************************************************************************/
+/*                   GetJPEGOverviewCountFinerThan()                    */
+/************************************************************************/
+
+// Return the number of implicit JPEG overviews whose width is strictly
+// greater than nXSize, i.e. the ones that can be used before an explicit
+// overview of that width (which typically misses the 2x and/or 4x levels).
+int GTiffDataset::GetJPEGOverviewCountFinerThan(int nXSize)
+{
+    const int nJPEGOverviewCount = GetJPEGOverviewCount();
+    int nCount = 0;
+    while (nCount < nJPEGOverviewCount &&
+           m_papoJPEGOverviewDS[nCount]->GetRasterXSize() > nXSize)
+    {
+        ++nCount;
+    }
+    return nCount;
+}
+
 /************************************************************************/
 /*                       GetCompressionFormats()                        */
 /************************************************************************/
@@ -3197,6 +3217,52 @@ int GTiffDataset::DirectIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
 
 bool GTiffDataset::ReadStrile(int nBlockId, void *pOutputBuffer,
                               GPtrDiff_t nBlockReqSize)
+{
+    if (!m_bDecodedTileCacheChecked)
+    {
+        m_bDecodedTileCacheChecked = true;
+        if (eAccess == GA_ReadOnly && GDALDecodedTileCacheIsEnabled())
+        {
+            m_osDecodedTileCacheKey =
+                GDALDecodedTileCacheGetFileKey(m_pszFilename);
+            if (!m_osDecodedTileCacheKey.empty())
+            {
+                int nJpegColorMode = 0;
+                if (m_nCompression == COMPRESSION_JPEG)
+                    TIFFGetField(m_hTIFF, TIFFTAG_JPEGCOLORMODE,
+                                 &nJpegColorMode);
+                m_osDecodedTileCacheKey += CPLSPrintf(
+                    "|GTiff|" CPL_FRMT_GUIB "|%d",
+                    static_cast<GUIntBig>(m_nDirOffset), nJpegColorMode);
+            }
+        }
+    }
+
+    if (m_osDecodedTileCacheKey.empty())
+        return ReadStrileFromFile(nBlockId, pOutputBuffer, nBlockReqSize);
+
+    const std::string osKey(m_osDecodedTileCacheKey +
+                            CPLSPrintf("|%d", nBlockId));
+    const size_t nSize = static_cast<size_t>(nBlockReqSize);
+    if (GDALDecodedTileCacheGet(osKey, pOutputBuffer, nSize))
+        return true;
+
+    bool bCacheable = false;
+    if (!ReadStrileFromFile(nBlockId, pOutputBuffer, nBlockReqSize,
+                            &bCacheable))
+        return false;
+    if (bCacheable)
+        GDALDecodedTileCachePut(osKey, pOutputBuffer, nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                         ReadStrileFromFile()                         */
+/************************************************************************/
+
+bool GTiffDataset::ReadStrileFromFile(int nBlockId, void *pOutputBuffer,
+                                      GPtrDiff_t nBlockReqSize,
+                                      bool *pbCacheable)
 {
     // Optimization by which we can save some libtiff buffer copy
     std::pair<vsi_l_offset, vsi_l_offset> oPair;
@@ -3224,6 +3290,8 @@ bool GTiffDataset::ReadStrile(int nBlockId, void *pOutputBuffer,
                                    static_cast<size_t>(oPair.second),
                                    pOutputBuffer, nBlockReqSize))
         {
+            if (pbCacheable)
+                *pbCacheable = true;
             return true;
         }
     }
@@ -3253,25 +3321,37 @@ bool GTiffDataset::ReadStrile(int nBlockId, void *pOutputBuffer,
     if (TIFFIsTiled(m_hTIFF))
     {
         if (TIFFReadEncodedTile(m_hTIFF, nBlockId, pOutputBuffer,
-                                nBlockReqSize) == -1 &&
-            !m_bIgnoreReadErrors)
+                                nBlockReqSize) == -1)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "TIFFReadEncodedTile() failed.");
-            GTIFFGetThreadLocalLibtiffError() = 0;
-            return false;
+            if (!m_bIgnoreReadErrors)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "TIFFReadEncodedTile() failed.");
+                GTIFFGetThreadLocalLibtiffError() = 0;
+                return false;
+            }
+        }
+        else if (pbCacheable)
+        {
+            *pbCacheable = true;
         }
     }
     else
     {
         if (TIFFReadEncodedStrip(m_hTIFF, nBlockId, pOutputBuffer,
-                                 nBlockReqSize) == -1 &&
-            !m_bIgnoreReadErrors)
+                                 nBlockReqSize) == -1)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "TIFFReadEncodedStrip() failed.");
-            GTIFFGetThreadLocalLibtiffError() = 0;
-            return false;
+            if (!m_bIgnoreReadErrors)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "TIFFReadEncodedStrip() failed.");
+                GTIFFGetThreadLocalLibtiffError() = 0;
+                return false;
+            }
+        }
+        else if (pbCacheable)
+        {
+            *pbCacheable = true;
         }
     }
     GTIFFGetThreadLocalLibtiffError() = 0;
@@ -1432,6 +1432,90 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     return bOK;
 }
 
+/************************************************************************/
+/*                      WriteBlockConcurrently()                        */
+/************************************************************************/
+
+// Used when CONCURRENT_BLOCK_WRITES=YES. The block is compressed in the
+// calling thread, and only the final write of the compressed data to the
+// file is serialized.
+CPLErr GTiffDataset::WriteBlockConcurrently(int nBlockId, const void *pImage)
+{
+    {
+        std::lock_guard oLock(m_oConcurrentBlockWritesMutex);
+        if (!m_bConcurrentBlockWritesReady)
+        {
+            Crystalize();
+            if (GTIFFSupportsPredictor(m_nCompression))
+            {
+                TIFFGetField(m_hTIFF, TIFFTAG_PREDICTOR,
+                             &m_nConcurrentBlockWritesPredictor);
+            }
+            TIFFGetField(m_hTIFF, TIFFTAG_EXTRASAMPLES,
+                         &m_nConcurrentBlockWritesExtraSampleCount,
+                         &m_panConcurrentBlockWritesExtraSamples);
+            m_bConcurrentBlockWritesReady = true;
+        }
+        if (m_bWriteError)
+            return CE_Failure;
+    }
+
+    const int iColumn = (nBlockId % m_nBlocksPerBand) % m_nBlocksPerRow;
+    const int iRow = (nBlockId % m_nBlocksPerBand) / m_nBlocksPerRow;
+    const int nActualBlockWidth = (iColumn == m_nBlocksPerRow - 1)
+                                      ? nRasterXSize - iColumn * m_nBlockXSize
+                                      : m_nBlockXSize;
+    const int nActualBlockHeight = (iRow == m_nBlocksPerColumn - 1)
+                                       ? nRasterYSize - iRow * m_nBlockYSize
+                                       : m_nBlockYSize;
+
+    // Blocks are assumed to be written only once, so there is no need to
+    // check if the block already exists in the file.
+    if (!m_bWriteEmptyTiles && IsFirstPixelEqualToNoData(pImage) &&
+        HasOnlyNoData(pImage, nActualBlockWidth, nActualBlockHeight,
+                      m_nBlockXSize, 1))
+    {
+        return CE_None;
+    }
+
+    const GPtrDiff_t cc = static_cast<GPtrDiff_t>(m_nBlockXSize) *
+                          m_nBlockYSize * (m_nBitsPerSample / 8);
+
+    GTiffCompressionJob sJob;
+    memset(&sJob, 0, sizeof(sJob));
+    sJob.poDS = this;
+    sJob.bTIFFIsBigEndian = CPL_TO_BOOL(TIFFIsBigEndian(m_hTIFF));
+    // Copy the user buffer, since libtiff might byte-swap it or apply the
+    // predictor in place.
+    sJob.pabyBuffer = static_cast<GByte *>(VSI_MALLOC_VERBOSE(cc));
+    if (!sJob.pabyBuffer)
+        return CE_Failure;
+    memcpy(sJob.pabyBuffer, pImage, cc);
+    sJob.nBufferSize = cc;
+    sJob.nHeight = m_nBlockYSize;
+    sJob.nStripOrTile = nBlockId;
+    sJob.nPredictor = m_nConcurrentBlockWritesPredictor;
+    sJob.pExtraSamples = m_panConcurrentBlockWritesExtraSamples;
+    sJob.nExtraSampleCount = m_nConcurrentBlockWritesExtraSampleCount;
+    sJob.pszTmpFilename = CPLStrdup(VSIMemGenerateHiddenFilename("temp.tif"));
+
+    ThreadCompressionFunc(&sJob);
+
+    bool bOK = sJob.nCompressedBufferSize > 0;
+    if (bOK)
+    {
+        std::lock_guard oLock(m_oConcurrentBlockWritesMutex);
+        WriteRawStripOrTile(sJob.nStripOrTile, sJob.pabyCompressedBuffer,
+                            sJob.nCompressedBufferSize);
+        bOK = !m_bWriteError;
+    }
+
+    CPLFree(sJob.pabyBuffer);
+    VSIUnlink(sJob.pszTmpFilename);
+    CPLFree(sJob.pszTmpFilename);
+    return bOK ? CE_None : CE_Failure;
+}
+
 /************************************************************************/
 /*                          DiscardLsb()                                */
 /************************************************************************/
@@ -6815,6 +6899,39 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
 
     poDS->GetDiscardLsbOption(papszParamList);
 
+    if (CPLFetchBool(papszParamList, "CONCURRENT_BLOCK_WRITES", false))
+    {
+        const auto nBPS = poDS->m_nBitsPerSample;
+        if (!TIFFIsTiled(l_hTIFF) ||
+            (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG && l_nBands != 1) ||
+            bStreaming || poDS->m_panMaskOffsetLsb ||
+            !(nBPS == 8 || nBPS == 16 || nBPS == 32 || nBPS == 64 ||
+              nBPS == 128) ||
+            poDS->m_nCompression == COMPRESSION_JPEG ||
+            poDS->m_nCompression == COMPRESSION_LERC)
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
+                        "CONCURRENT_BLOCK_WRITES=YES is only supported for "
+                        "tiled files, with a single band or INTERLEAVE=BAND, "
+                        "without JPEG or LERC compression, DISCARD_LSB or "
+                        "streaming output");
+            delete poDS;
+            return nullptr;
+        }
+        poDS->m_bConcurrentBlockWrites = true;
+        // Avoid GDALRasterBand::WriteBlock() initializing the block
+        // information lazily from several threads
+        for (int iBand = 0; iBand < l_nBands; ++iBand)
+        {
+            cpl::down_cast<GTiffRasterBand *>(poDS->papoBands[iBand])
+                ->InitBlockInfo();
+        }
+        // Blocks are written directly from GDALRasterBand::WriteBlock()
+        // without going through the block cache, so the dataset mutex is not
+        // needed.
+        poDS->DisableReadWriteMutex();
+    }
+
     if (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG && l_nBands != 1)
         poDS->SetMetadataItem("INTERLEAVE", "PIXEL", "IMAGE_STRUCTURE");
     else
@@ -8694,10 +8811,21 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
 #endif
         eErr == CE_None)
     {
-        const char *papszCopyWholeRasterOptions[3] = {nullptr, nullptr,
-                                                      nullptr};
+        const char *papszCopyWholeRasterOptions[4] = {nullptr, nullptr,
+                                                      nullptr, nullptr};
         int iNextOption = 0;
         papszCopyWholeRasterOptions[iNextOption++] = "SKIP_HOLES=YES";
+        // Also use the worker threads to read the source dataset
+        const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS");
+        std::string osNumThreadsOption;
+        if (pszNumThreads)
+        {
+            osNumThreadsOption = "NUM_THREADS=";
+            osNumThreadsOption += pszNumThreads;
+            papszCopyWholeRasterOptions[iNextOption++] =
+                osNumThreadsOption.c_str();
+        }
         if (l_nCompression != COMPRESSION_NONE)
         {
             papszCopyWholeRasterOptions[iNextOption++] = "COMPRESSED=YES";
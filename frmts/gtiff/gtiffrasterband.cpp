@@ -236,12 +236,14 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
         int bTried = FALSE;
-        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+        const bool bJPEGOverviewVisible =
+            GTiffDataset::IsJPEGOverviewResampling(psExtraArg->eResampleAlg);
+        if (bJPEGOverviewVisible)
             ++m_poGDS->m_nJPEGOverviewVisibilityCounter;
         const CPLErr eErr = TryOverviewRasterIO(
             eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
             eBufType, nPixelSpace, nLineSpace, psExtraArg, &bTried);
-        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+        if (bJPEGOverviewVisible)
             --m_poGDS->m_nJPEGOverviewVisibilityCounter;
         if (bTried)
             return eErr;
@@ -468,12 +470,12 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_None;
     }
 
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+    if (GTiffDataset::IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
         ++m_poGDS->m_nJPEGOverviewVisibilityCounter;
     const CPLErr eErr = GDALPamRasterBand::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nPixelSpace, nLineSpace, psExtraArg);
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+    if (GTiffDataset::IsJPEGOverviewResampling(psExtraArg->eResampleAlg))
         --m_poGDS->m_nJPEGOverviewVisibilityCounter;
 
     m_poGDS->m_bLoadingOtherBands = false;
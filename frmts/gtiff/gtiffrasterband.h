@@ -55,6 +55,8 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                                              GIntBig *pnLineSpace,
                                              char **papszOptions);
 
+    int GetImplicitJPEGOverviewCount();
+
   protected:
     GTiffDataset *m_poGDS = nullptr;
     GDALMultiDomainMetadata m_oGTiffMDMD{};
@@ -1396,12 +1396,12 @@ int GTiffRasterBand::GetOverviewCount()
 
     if (m_poGDS->m_nOverviewCount > 0)
     {
-        return m_poGDS->m_nOverviewCount;
+        return GetImplicitJPEGOverviewCount() + m_poGDS->m_nOverviewCount;
     }
 
     const int nOverviewCount = GDALRasterBand::GetOverviewCount();
     if (nOverviewCount > 0)
-        return nOverviewCount;
+        return GetImplicitJPEGOverviewCount() + nOverviewCount;
 
     // Implicit JPEG overviews are normally hidden, except when doing
     // IRasterIO() operations.
@@ -1411,6 +1411,30 @@ int GTiffRasterBand::GetOverviewCount()
     return 0;
 }
 
+/************************************************************************/
+/*                    GetImplicitJPEGOverviewCount()                    */
+/************************************************************************/
+
+// Number of implicit JPEG overviews exposed in front of the explicit ones,
+// when the latter are present, but start at a coarser level than the
+// implicit ones (e.g. overviews built with -minsize or only at 8x).
+// Like when there are no explicit overviews, this is only done during
+// IRasterIO() operations.
+int GTiffRasterBand::GetImplicitJPEGOverviewCount()
+{
+    if (!m_poGDS->m_nJPEGOverviewVisibilityCounter)
+        return 0;
+
+    const GDALRasterBand *poFirstOvrBand =
+        m_poGDS->m_nOverviewCount > 0
+            ? m_poGDS->m_papoOverviewDS[0]->GetRasterBand(nBand)
+            : GDALRasterBand::GetOverview(0);
+    if (poFirstOvrBand == nullptr)
+        return 0;
+
+    return m_poGDS->GetJPEGOverviewCountFinerThan(poFirstOvrBand->GetXSize());
+}
+
 /************************************************************************/
 /*                            GetOverview()                             */
 /************************************************************************/
@@ -1422,6 +1446,11 @@ GDALRasterBand *GTiffRasterBand::GetOverview(int i)
 
     if (m_poGDS->m_nOverviewCount > 0)
     {
+        const int nImplicitCount = GetImplicitJPEGOverviewCount();
+        if (i >= 0 && i < nImplicitCount)
+            return m_poGDS->m_papoJPEGOverviewDS[i]->GetRasterBand(nBand);
+        i -= nImplicitCount;
+
         // Do we have internal overviews?
         if (i < 0 || i >= m_poGDS->m_nOverviewCount)
             return nullptr;
@@ -1429,9 +1458,13 @@ GDALRasterBand *GTiffRasterBand::GetOverview(int i)
         return m_poGDS->m_papoOverviewDS[i]->GetRasterBand(nBand);
     }
 
-    GDALRasterBand *const poOvrBand = GDALRasterBand::GetOverview(i);
-    if (poOvrBand != nullptr)
-        return poOvrBand;
+    if (GDALRasterBand::GetOverviewCount() > 0)
+    {
+        const int nImplicitCount = GetImplicitJPEGOverviewCount();
+        if (i >= 0 && i < nImplicitCount)
+            return m_poGDS->m_papoJPEGOverviewDS[i]->GetRasterBand(nBand);
+        return GDALRasterBand::GetOverview(i - nImplicitCount);
+    }
 
     // For consistency with GetOverviewCount(), we should also test
     // m_nJPEGOverviewVisibilityCounter, but it is also convenient to be able
@@ -41,6 +41,10 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
 {
+    if (m_poGDS->m_bConcurrentBlockWrites)
+        return m_poGDS->WriteBlockConcurrently(
+            ComputeBlockId(nBlockXOff, nBlockYOff), pImage);
+
     m_poGDS->Crystalize();
 
     if (m_poGDS->m_bDebugDontWriteBlocks)
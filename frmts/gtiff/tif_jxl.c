@@ -25,6 +25,8 @@
 #include "tiffiop.h"
 #include "tif_jxl.h"
 
+#include "cpl_multiproc.h"
+
 #include <jxl/decode.h>
 #include <jxl/encode.h>
 
@@ -56,6 +58,7 @@ typedef struct
     unsigned int uncompressed_offset;
 
     JxlDecoder *decoder;
+    JxlEncoder *encoder; /* kept between strips/tiles, see JXLResetEncoder() */
 
     TIFFVGetMethod vgetparent; /* super-class method */
     TIFFVSetMethod vsetparent; /* super-class method */
@@ -68,6 +71,78 @@ typedef struct
 static int JXLEncode(TIFF *tif, uint8_t *bp, tmsize_t cc, uint16_t s);
 static int JXLDecode(TIFF *tif, uint8_t *op, tmsize_t occ, uint16_t s);
 
+#ifdef HAVE_JxlEncoderReset
+/*
+ * Cache of idle encoders, shared by all TIFF handles. GTiff multi-threaded
+ * compression uses a temporary TIFF handle for each strip/tile, so without it
+ * a new JxlEncoder would be created for each of them, which dominates the
+ * encoding time of small tiles.
+ */
+#define JXL_MAX_CACHED_ENCODERS 64
+static CPLMutex *hJXLEncoderCacheMutex = NULL;
+static JxlEncoder *apsJXLEncoderCache[JXL_MAX_CACHED_ENCODERS];
+static int nJXLEncoderCacheSize = 0;
+#endif
+
+static JxlEncoder *JXLAcquireEncoder(void)
+{
+#ifdef HAVE_JxlEncoderReset
+    JxlEncoder *enc = NULL;
+    if (CPLCreateOrAcquireMutex(&hJXLEncoderCacheMutex, 1000.0))
+    {
+        if (nJXLEncoderCacheSize > 0)
+            enc = apsJXLEncoderCache[--nJXLEncoderCacheSize];
+        CPLReleaseMutex(hJXLEncoderCacheMutex);
+    }
+    if (enc)
+        return enc;
+#endif
+    return JxlEncoderCreate(NULL);
+}
+
+static void JXLReleaseEncoder(JxlEncoder *enc)
+{
+#ifdef HAVE_JxlEncoderReset
+    if (CPLCreateOrAcquireMutex(&hJXLEncoderCacheMutex, 1000.0))
+    {
+        if (nJXLEncoderCacheSize < JXL_MAX_CACHED_ENCODERS)
+        {
+            apsJXLEncoderCache[nJXLEncoderCacheSize++] = enc;
+            enc = NULL;
+        }
+        CPLReleaseMutex(hJXLEncoderCacheMutex);
+    }
+#endif
+    if (enc)
+        JxlEncoderDestroy(enc);
+}
+
+/*
+ * Make the encoder of the state ready for the next strip/tile. All settings
+ * are reset as if the encoder had just been created.
+ */
+static void JXLResetEncoder(JXLState *sp)
+{
+#ifdef HAVE_JxlEncoderReset
+    JxlEncoderReset(sp->encoder);
+#else
+    JxlEncoderDestroy(sp->encoder);
+    sp->encoder = NULL;
+#endif
+}
+
+void TIFFJXLCleanupEncoderCache(void)
+{
+#ifdef HAVE_JxlEncoderReset
+    for (int i = 0; i < nJXLEncoderCacheSize; ++i)
+        JxlEncoderDestroy(apsJXLEncoderCache[i]);
+    nJXLEncoderCacheSize = 0;
+    if (hJXLEncoderCacheMutex)
+        CPLDestroyMutex(hJXLEncoderCacheMutex);
+    hJXLEncoderCacheMutex = NULL;
+#endif
+}
+
 static int GetJXLDataType(TIFF *tif)
 {
     TIFFDirectory *td = &tif->tif_dir;
@@ -782,12 +857,16 @@ static int JXLPostEncode(TIFF *tif)
         return 0;
     }
 
-    JxlEncoder *enc = JxlEncoderCreate(NULL);
-    if (enc == NULL)
+    if (sp->encoder == NULL)
     {
-        TIFFErrorExtR(tif, module, "JxlEncoderCreate() failed");
-        return 0;
+        sp->encoder = JXLAcquireEncoder();
+        if (sp->encoder == NULL)
+        {
+            TIFFErrorExtR(tif, module, "JxlEncoderCreate() failed");
+            return 0;
+        }
     }
+    JxlEncoder *enc = sp->encoder;
     JxlEncoderUseContainer(enc, JXL_FALSE);
 
 #ifdef HAVE_JxlEncoderFrameSettingsCreate
@@ -798,7 +877,7 @@ static int JXLPostEncode(TIFF *tif)
     if (opts == NULL)
     {
         TIFFErrorExtR(tif, module, "JxlEncoderFrameSettingsCreate() failed");
-        JxlEncoderDestroy(enc);
+        JXLResetEncoder(sp);
         return 0;
     }
 
@@ -942,7 +1021,7 @@ static int JXLPostEncode(TIFF *tif)
 #endif
         {
             TIFFErrorExtR(tif, module, "JxlEncoderSetFrameDistance() failed");
-            JxlEncoderDestroy(enc);
+            JXLResetEncoder(sp);
             return 0;
         }
     }
@@ -954,14 +1033,14 @@ static int JXLPostEncode(TIFF *tif)
 #endif
     {
         TIFFErrorExtR(tif, module, "JxlEncoderFrameSettingsSetOption() failed");
-        JxlEncoderDestroy(enc);
+        JXLResetEncoder(sp);
         return 0;
     }
 
     if (JXL_ENC_SUCCESS != JxlEncoderSetBasicInfo(enc, &basic_info))
     {
         TIFFErrorExtR(tif, module, "JxlEncoderSetBasicInfo() failed");
-        JxlEncoderDestroy(enc);
+        JXLResetEncoder(sp);
         return 0;
     }
 
@@ -972,7 +1051,7 @@ static int JXLPostEncode(TIFF *tif)
     if (JXL_ENC_SUCCESS != JxlEncoderSetColorEncoding(enc, &color_encoding))
     {
         TIFFErrorExtR(tif, module, "JxlEncoderSetColorEncoding() failed");
-        JxlEncoderDestroy(enc);
+        JXLResetEncoder(sp);
         return 0;
     }
 
@@ -1030,7 +1109,7 @@ static int JXLPostEncode(TIFF *tif)
                 TIFFErrorExtR(tif, module,
                               "JxlEncoderSetExtraChannelInfo(%d) failed",
                               iChannel);
-                JxlEncoderDestroy(enc);
+                JXLResetEncoder(sp);
                 _TIFFfreeExt(tif, main_buffer);
                 return 0;
             }
@@ -1045,7 +1124,7 @@ static int JXLPostEncode(TIFF *tif)
                         tif, module,
                         "JxlEncoderSetExtraChannelDistance(%d) failed",
                         iChannel);
-                    JxlEncoderDestroy(enc);
+                    JXLResetEncoder(sp);
                     _TIFFfreeExt(tif, main_buffer);
                     return 0;
                 }
@@ -1060,7 +1139,7 @@ static int JXLPostEncode(TIFF *tif)
                         tif, module,
                         "JxlEncoderSetExtraChannelDistance(%d) failed",
                         iChannel);
-                    JxlEncoderDestroy(enc);
+                    JXLResetEncoder(sp);
                     _TIFFfreeExt(tif, main_buffer);
                     return 0;
                 }
@@ -1080,7 +1159,7 @@ static int JXLPostEncode(TIFF *tif)
     if (retCode != JXL_ENC_SUCCESS)
     {
         TIFFErrorExtR(tif, module, "JxlEncoderAddImageFrame() failed");
-        JxlEncoderDestroy(enc);
+        JXLResetEncoder(sp);
         return 0;
     }
 
@@ -1119,7 +1198,7 @@ static int JXLPostEncode(TIFF *tif)
                 TIFFErrorExtR(tif, module,
                               "JxlEncoderSetExtraChannelBuffer() failed");
                 _TIFFfreeExt(tif, extra_channel_buffer);
-                JxlEncoderDestroy(enc);
+                JXLResetEncoder(sp);
                 return 0;
             }
         }
@@ -1138,20 +1217,20 @@ static int JXLPostEncode(TIFF *tif)
         if (process_result == JXL_ENC_ERROR)
         {
             TIFFErrorExtR(tif, module, "JxlEncoderProcessOutput() failed");
-            JxlEncoderDestroy(enc);
+            JXLResetEncoder(sp);
             return 0;
         }
         tif->tif_rawcc = tif->tif_rawdatasize - len;
         if (!TIFFFlushData1(tif))
         {
-            JxlEncoderDestroy(enc);
+            JXLResetEncoder(sp);
             return 0;
         }
         if (process_result != JXL_ENC_NEED_MORE_OUTPUT)
             break;
     }
 
-    JxlEncoderDestroy(enc);
+    JXLResetEncoder(sp);
     return 1;
 }
 
@@ -1168,6 +1247,8 @@ static void JXLCleanup(TIFF *tif)
 
     if (sp->decoder)
         JxlDecoderDestroy(sp->decoder);
+    if (sp->encoder)
+        JXLReleaseEncoder(sp->encoder);
 
     _TIFFfreeExt(tif, sp);
     tif->tif_data = NULL;
@@ -1334,6 +1415,7 @@ int TIFFInitJXL(TIFF *tif, int scheme)
 
     /* Default values for codec-specific fields */
     sp->decoder = NULL;
+    sp->encoder = NULL;
 
     sp->state = 0;
     sp->lossless = TRUE;
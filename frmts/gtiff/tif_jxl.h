@@ -60,6 +60,7 @@ extern "C"
 {
 #endif
     int TIFFInitJXL(TIFF *tif, int scheme);
+    void TIFFJXLCleanupEncoderCache(void);
 
 #if defined(__cplusplus)
 }
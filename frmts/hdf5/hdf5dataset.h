@@ -76,6 +76,18 @@ hid_t GDAL_HDF5Open(const std::string &osFilename);
 #endif
 #endif
 
+#if defined(H5_VERSION_GE)
+#if H5_VERSION_GE(1, 14, 1)
+#define HAVE_H5DCHUNK_ITER
+#endif
+#if H5_VERSION_GE(1, 10, 5)
+#define HAVE_H5DGET_CHUNK_INFO
+#endif
+#endif
+
+// Id of the Zstandard filter registered by the HDF Group
+constexpr H5Z_filter_t H5Z_FILTER_ZSTD = 32015;
+
 // Release 1.6.3 or 1.6.4 changed the type of count in some API functions.
 
 #if H5_VERS_MAJOR == 1 && H5_VERS_MINOR <= 6 &&                                \
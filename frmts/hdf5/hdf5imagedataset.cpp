@@ -24,8 +24,13 @@
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
+#include "cpl_compressor.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
 #include <algorithm>
 #include <limits>
+#include <memory>
 
 class HDF5ImageDataset final : public HDF5Dataset
 {
@@ -101,6 +106,54 @@ class HDF5ImageDataset final : public HDF5Dataset
     // [m_iCurrentBandChunk * m_nBandChunkSize, (m_iCurrentBandChunk+1) * m_nBandChunkSize[
     std::vector<GByte> m_abyBandChunk{};
 
+    struct DirectChunkLocation
+    {
+        vsi_l_offset nOffset = 0;
+        size_t nSize = 0;  //! 0 if the chunk is not allocated
+        unsigned nFilterMask = 0;
+    };
+
+    //! Whether blocks are read by decoding chunks without going through
+    // libhdf5, and thus without taking the HDF5 global lock.
+    bool m_bDirectChunkRead = false;
+    //! Whether building m_asDirectChunkLocations has been attempted
+    bool m_bDirectChunkIndexBuilt = false;
+    std::string m_osDirectChunkFilename{};
+    VSILFILE *m_fpDirectChunk = nullptr;
+    //! File offset of HDF5 address 0, that is the size of the user block
+    vsi_l_offset m_nDirectChunkBaseAddress = 0;
+    int m_nDirectChunkCountX = 0;
+    int m_nDirectChunkCountY = 0;
+    int m_nDirectChunkDTSize = 0;
+    bool m_bDirectChunkSwap = false;
+    //! Filters of the pipeline, in the order they are applied on writing
+    std::vector<H5Z_filter_t> m_anDirectChunkFilters{};
+    std::vector<GByte> m_abyDirectChunkFillValue{};
+    std::vector<DirectChunkLocation> m_asDirectChunkLocations{};
+    std::vector<GByte> m_abyDirectChunkRaw{};
+
+    void InitDirectChunkRead(hid_t hListId, const std::string &osFilename,
+                             GDALDataType eDT);
+    bool BuildDirectChunkIndex();
+    bool EnsureDirectChunkIndex();
+    const DirectChunkLocation &GetDirectChunkLocation(int nBand,
+                                                      int nBlockXOff,
+                                                      int nBlockYOff) const;
+    size_t GetDirectChunkSize() const;
+    void FillDirectChunk(void *pImage) const;
+    bool DecodeDirectChunk(const GByte *pabySrc, size_t nSrcSize,
+                           unsigned nFilterMask, void *pImage) const;
+    bool ReadDirectChunk(int nBand, int nBlockXOff, int nBlockYOff,
+                         void *pImage);
+
+#ifdef HAVE_H5DCHUNK_ITER
+    static int DirectChunkIterCbk(const hsize_t *panOffset,
+                                  unsigned nFilterMask, haddr_t nAddr,
+                                  hsize_t nSize, void *pUserData);
+#endif
+    bool RegisterDirectChunk(const hsize_t *panOffset, unsigned nFilterMask,
+                             haddr_t nAddr, hsize_t nSize);
+
     CPLErr CreateODIMH5Projection();
 
     CPL_DISALLOW_COPY_ASSIGN(HDF5ImageDataset)
@@ -221,6 +274,8 @@ HDF5ImageDataset::~HDF5ImageDataset()
         H5Sclose(dataspace_id);
     if (native > 0)
         H5Tclose(native);
+    if (m_fpDirectChunk)
+        VSIFCloseL(m_fpDirectChunk);
 
     CPLFree(dims);
     CPLFree(maxdims);
@@ -243,6 +298,8 @@ class HDF5ImageRasterBand final : public GDALPamRasterBand
     double m_dfScale = 1.0;
     int m_nIRasterIORecCounter = 0;
 
+    void PrefetchDirectChunks(int nXOff, int nYOff, int nXSize, int nYSize);
+
   public:
     HDF5ImageRasterBand(HDF5ImageDataset *, int, GDALDataType);
     virtual ~HDF5ImageRasterBand();
@@ -350,6 +407,572 @@ double HDF5ImageRasterBand::GetScale(int *pbSuccess)
     return GDALPamRasterBand::GetScale(pbSuccess);
 }
 
+/************************************************************************/
+/*                        InitDirectChunkRead()                         */
+/************************************************************************/
+
+// Checks whether chunks can be read and decoded without libhdf5: that
+// requires a chunk to be a block, a data type needing at most byte
+// swapping and supported filters.
+void HDF5ImageDataset::InitDirectChunkRead(hid_t hListId,
+                                           const std::string &osFilename,
+                                           GDALDataType eDT)
+{
+#ifdef HAVE_H5DGET_CHUNK_INFO
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_HDF5_DIRECT_CHUNK_READ", "YES")))
+        return;
+
+    if (H5Pget_layout(hListId) != H5D_CHUNKED)
+        return;
+    const bool bIsBandInterleavedData =
+        ndims == 3 && m_nOtherDimIndex == 0 && GetYIndex() == 1 &&
+        GetXIndex() == 2;
+    if (!(ndims == 2 || bIsBandInterleavedData))
+        return;
+    hsize_t anChunkDims[3] = {0, 0, 0};
+    if (H5Pget_chunk(hListId, 3, anChunkDims) != ndims ||
+        (ndims == 3 && anChunkDims[0] != 1) ||
+        anChunkDims[GetYIndex()] != static_cast<hsize_t>(m_nBlockYSize) ||
+        anChunkDims[GetXIndex()] != static_cast<hsize_t>(m_nBlockXSize))
+        return;
+#ifdef HDF5_HAVE_FLOAT16
+    if (m_bConvertFromFloat16)
+        return;
+#endif
+
+    // Data type
+    const auto eClass = H5Tget_class(native);
+    if (eClass != H5T_INTEGER && eClass != H5T_FLOAT)
+        return;
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const hid_t hFileType = H5Dget_type(dataset_id);
+    const size_t nFileTypeSize = H5Tget_size(hFileType);
+    const auto eOrder = H5Tget_order(hFileType);
+    H5Tclose(hFileType);
+    if (nFileTypeSize != static_cast<size_t>(nDTSize) ||
+        H5Tget_size(native) != nFileTypeSize)
+        return;
+    if (nDTSize > 1)
+    {
+        if (eOrder != H5T_ORDER_LE && eOrder != H5T_ORDER_BE)
+            return;
+        m_bDirectChunkSwap = (eOrder == H5T_ORDER_LE) != CPL_IS_LSB;
+    }
+
+    // Filters
+    const int nFilters = H5Pget_nfilters(hListId);
+    for (int i = 0; i < nFilters; ++i)
+    {
+        unsigned int nFlags = 0;
+        unsigned int anValues[8] = {0};
+        size_t nValues = CPL_ARRAYSIZE(anValues);
+        char szName[64 + 1] = {0};
+        const auto eFilter = H5Pget_filter(hListId, i, &nFlags, &nValues,
+                                           anValues, 64, szName);
+        if (eFilter == H5Z_FILTER_DEFLATE)
+        {
+            if (!CPLGetDecompressor("zlib"))
+                return;
+        }
+        else if (eFilter == H5Z_FILTER_ZSTD)
+        {
+            if (!CPLGetDecompressor("zstd"))
+                return;
+        }
+        else if (eFilter == H5Z_FILTER_SHUFFLE)
+        {
+            if (nValues >= 1 && anValues[0] != static_cast<unsigned>(nDTSize))
+                return;
+        }
+        else
+        {
+            CPLDebug("HDF5", "Filter %d not supported for direct chunk reads",
+                     static_cast<int>(eFilter));
+            return;
+        }
+        m_anDirectChunkFilters.push_back(eFilter);
+    }
+    // Bits of the filter mask of chunks
+    if (nFilters > 32)
+        return;
+
+    // Value of unallocated chunks
+    H5D_fill_value_t eFillValueStatus = H5D_FILL_VALUE_UNDEFINED;
+    if (H5Pfill_value_defined(hListId, &eFillValueStatus) >= 0 &&
+        eFillValueStatus == H5D_FILL_VALUE_USER_DEFINED)
+    {
+        m_abyDirectChunkFillValue.resize(nDTSize);
+        if (H5Pget_fill_value(hListId, native,
+                              m_abyDirectChunkFillValue.data()) < 0)
+            return;
+    }
+
+    // HDF5 addresses are relative to the end of the user block, if any.
+    const hid_t hFileCreateList = H5Fget_create_plist(m_hHDF5);
+    if (hFileCreateList < 0)
+        return;
+    hsize_t nUserBlockSize = 0;
+    const herr_t status = H5Pget_userblock(hFileCreateList, &nUserBlockSize);
+    H5Pclose(hFileCreateList);
+    if (status < 0)
+        return;
+
+    m_nDirectChunkBaseAddress = static_cast<vsi_l_offset>(nUserBlockSize);
+    m_nDirectChunkDTSize = nDTSize;
+    m_nDirectChunkCountX =
+        DIV_ROUND_UP(GetRasterXSize(), std::max(1, m_nBlockXSize));
+    m_nDirectChunkCountY =
+        DIV_ROUND_UP(GetRasterYSize(), std::max(1, m_nBlockYSize));
+    m_osDirectChunkFilename = osFilename;
+    m_bDirectChunkRead = true;
+#else
+    CPL_IGNORE_RET_VAL(hListId);
+    CPL_IGNORE_RET_VAL(osFilename);
+    CPL_IGNORE_RET_VAL(eDT);
+#endif
+}
+
+/************************************************************************/
+/*                         RegisterDirectChunk()                        */
+/************************************************************************/
+
+bool HDF5ImageDataset::RegisterDirectChunk(const hsize_t *panOffset,
+                                           unsigned nFilterMask, haddr_t nAddr,
+                                           hsize_t nSize)
+{
+    if (nAddr == HADDR_UNDEF || nSize == 0)
+        return true;
+    const hsize_t nBlockXOff = panOffset[GetXIndex()] / m_nBlockXSize;
+    const hsize_t nBlockYOff = panOffset[GetYIndex()] / m_nBlockYSize;
+    const hsize_t nBandIdx = ndims == 3 ? panOffset[0] : 0;
+    if (nBlockXOff >= static_cast<hsize_t>(m_nDirectChunkCountX) ||
+        nBlockYOff >= static_cast<hsize_t>(m_nDirectChunkCountY) ||
+        nBandIdx >= static_cast<hsize_t>(nBands) ||
+        nSize > std::numeric_limits<size_t>::max() ||
+        nAddr > std::numeric_limits<vsi_l_offset>::max() -
+                    m_nDirectChunkBaseAddress)
+    {
+        return false;
+    }
+    auto &sLoc = m_asDirectChunkLocations
+        [(static_cast<size_t>(nBandIdx) * m_nDirectChunkCountY + nBlockYOff) *
+             m_nDirectChunkCountX +
+         nBlockXOff];
+    sLoc.nOffset = m_nDirectChunkBaseAddress + nAddr;
+    sLoc.nSize = static_cast<size_t>(nSize);
+    sLoc.nFilterMask = nFilterMask;
+    return true;
+}
+
+#ifdef HAVE_H5DCHUNK_ITER
+
+/************************************************************************/
+/*                         DirectChunkIterCbk()                         */
+/************************************************************************/
+
+int HDF5ImageDataset::DirectChunkIterCbk(const hsize_t *panOffset,
+                                         unsigned nFilterMask, haddr_t nAddr,
+                                         hsize_t nSize, void *pUserData)
+{
+    auto poDS = static_cast<HDF5ImageDataset *>(pUserData);
+    return poDS->RegisterDirectChunk(panOffset, nFilterMask, nAddr, nSize)
+               ? H5_ITER_CONT
+               : H5_ITER_ERROR;
+}
+
+#endif
+
+/************************************************************************/
+/*                        BuildDirectChunkIndex()                       */
+/************************************************************************/
+
+// Collects the location of all chunks from the chunk index of the dataset.
+// Must be called with the HDF5 global lock held.
+bool HDF5ImageDataset::BuildDirectChunkIndex()
+{
+#ifdef HAVE_H5DGET_CHUNK_INFO
+    const uint64_t nChunkCount = static_cast<uint64_t>(ndims == 3 ? nBands
+                                                                  : 1) *
+                                 m_nDirectChunkCountY * m_nDirectChunkCountX;
+    // A few hundreds of megabytes at most
+    constexpr uint64_t MAX_CHUNK_COUNT = 10 * 1000 * 1000;
+    if (nChunkCount > MAX_CHUNK_COUNT)
+        return false;
+
+    m_fpDirectChunk = VSIFOpenL(m_osDirectChunkFilename.c_str(), "rb");
+    if (!m_fpDirectChunk)
+        return false;
+
+    try
+    {
+        m_asDirectChunkLocations.resize(static_cast<size_t>(nChunkCount));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+#ifdef HAVE_H5DCHUNK_ITER
+    return H5Dchunk_iter(dataset_id, H5P_DEFAULT, DirectChunkIterCbk, this) >=
+           0;
+#else
+    // Query chunks one at a time with older libhdf5. Iterating with
+    // H5Dget_chunk_info() would be quadratic for some chunk index types.
+    hsize_t anOffset[3] = {0, 0, 0};
+    for (int iBand = 0; iBand < (ndims == 3 ? nBands : 1); ++iBand)
+    {
+        if (ndims == 3)
+            anOffset[0] = iBand;
+        for (int iY = 0; iY < m_nDirectChunkCountY; ++iY)
+        {
+            anOffset[GetYIndex()] = static_cast<hsize_t>(iY) * m_nBlockYSize;
+            for (int iX = 0; iX < m_nDirectChunkCountX; ++iX)
+            {
+                anOffset[GetXIndex()] =
+                    static_cast<hsize_t>(iX) * m_nBlockXSize;
+                unsigned nFilterMask = 0;
+                haddr_t nAddr = HADDR_UNDEF;
+                hsize_t nSize = 0;
+                if (H5Dget_chunk_info_by_coord(dataset_id, anOffset,
+                                               &nFilterMask, &nAddr,
+                                               &nSize) < 0 ||
+                    !RegisterDirectChunk(anOffset, nFilterMask, nAddr, nSize))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+#endif
+#else
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                       EnsureDirectChunkIndex()                       */
+/************************************************************************/
+
+bool HDF5ImageDataset::EnsureDirectChunkIndex()
+{
+    if (!m_bDirectChunkIndexBuilt)
+    {
+        m_bDirectChunkIndexBuilt = true;
+
+        HDF5_GLOBAL_LOCK();
+        if (!BuildDirectChunkIndex())
+        {
+            CPLDebug("HDF5", "Cannot build chunk index of %s. "
+                             "Reading through libhdf5",
+                     GetDescription());
+            m_bDirectChunkRead = false;
+            m_asDirectChunkLocations.clear();
+        }
+    }
+    return m_bDirectChunkRead;
+}
+
+/************************************************************************/
+/*                       GetDirectChunkLocation()                       */
+/************************************************************************/
+
+const HDF5ImageDataset::DirectChunkLocation &
+HDF5ImageDataset::GetDirectChunkLocation(int nBandIn, int nBlockXOff,
+                                         int nBlockYOff) const
+{
+    const int iBand = ndims == 3 ? nBandIn - 1 : 0;
+    return m_asDirectChunkLocations
+        [(static_cast<size_t>(iBand) * m_nDirectChunkCountY + nBlockYOff) *
+             m_nDirectChunkCountX +
+         nBlockXOff];
+}
+
+/************************************************************************/
+/*                         GetDirectChunkSize()                         */
+/************************************************************************/
+
+size_t HDF5ImageDataset::GetDirectChunkSize() const
+{
+    return static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize *
+           m_nDirectChunkDTSize;
+}
+
+/************************************************************************/
+/*                          FillDirectChunk()                           */
+/************************************************************************/
+
+// Sets the content of an unallocated chunk, like libhdf5 does.
+void HDF5ImageDataset::FillDirectChunk(void *pImage) const
+{
+    const size_t nValues = static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize;
+    if (m_abyDirectChunkFillValue.empty())
+    {
+        memset(pImage, 0, nValues * m_nDirectChunkDTSize);
+    }
+    else
+    {
+        const auto eDT = GetRasterBand(1)->GetRasterDataType();
+        GDALCopyWords64(m_abyDirectChunkFillValue.data(), eDT, 0, pImage, eDT,
+                        m_nDirectChunkDTSize, nValues);
+    }
+}
+
+/************************************************************************/
+/*                         DecodeDirectChunk()                          */
+/************************************************************************/
+
+// Applies the filter pipeline in reverse order to a raw chunk. This method
+// is thread-safe.
+bool HDF5ImageDataset::DecodeDirectChunk(const GByte *pabySrc, size_t nSrcSize,
+                                         unsigned nFilterMask,
+                                         void *pImage) const
+{
+    const size_t nChunkSize = GetDirectChunkSize();
+    std::vector<GByte> aabyTmp[2];
+    int iTmp = 0;
+    for (int i = static_cast<int>(m_anDirectChunkFilters.size()) - 1; i >= 0;
+         --i)
+    {
+        // The bit of the filter is set if it was skipped for that chunk.
+        if ((nFilterMask >> i) & 1)
+            continue;
+
+        auto &abyOut = aabyTmp[iTmp];
+        iTmp = 1 - iTmp;
+        try
+        {
+            abyOut.resize(m_anDirectChunkFilters[i] == H5Z_FILTER_SHUFFLE
+                              ? nSrcSize
+                              : nChunkSize);
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+
+        if (m_anDirectChunkFilters[i] == H5Z_FILTER_SHUFFLE)
+        {
+            // Values are stored as all their first bytes, then all their
+            // second bytes, etc. Trailing bytes are left untouched.
+            const int nEltSize = m_nDirectChunkDTSize;
+            const size_t nElts = nSrcSize / nEltSize;
+            for (int j = 0; j < nEltSize; ++j)
+            {
+                for (size_t k = 0; k < nElts; ++k)
+                    abyOut[k * nEltSize + j] = pabySrc[j * nElts + k];
+            }
+            memcpy(abyOut.data() + nElts * nEltSize,
+                   pabySrc + nElts * nEltSize, nSrcSize - nElts * nEltSize);
+        }
+        else
+        {
+            const CPLCompressor *psDecompressor = CPLGetDecompressor(
+                m_anDirectChunkFilters[i] == H5Z_FILTER_DEFLATE ? "zlib"
+                                                                : "zstd");
+            void *pOutBuffer = abyOut.data();
+            size_t nOutSize = abyOut.size();
+            if (!psDecompressor ||
+                !psDecompressor->pfnFunc(pabySrc, nSrcSize, &pOutBuffer,
+                                         &nOutSize, nullptr,
+                                         psDecompressor->user_data))
+            {
+                return false;
+            }
+            abyOut.resize(nOutSize);
+        }
+        pabySrc = abyOut.data();
+        nSrcSize = abyOut.size();
+    }
+
+    if (nSrcSize != nChunkSize)
+        return false;
+    memcpy(pImage, pabySrc, nChunkSize);
+    if (m_bDirectChunkSwap)
+    {
+        GDALSwapWordsEx(pImage, m_nDirectChunkDTSize,
+                        nChunkSize / m_nDirectChunkDTSize,
+                        m_nDirectChunkDTSize);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ReadDirectChunk()                           */
+/************************************************************************/
+
+bool HDF5ImageDataset::ReadDirectChunk(int nBandIn, int nBlockXOff,
+                                       int nBlockYOff, void *pImage)
+{
+    const auto &sLoc = GetDirectChunkLocation(nBandIn, nBlockXOff, nBlockYOff);
+    if (sLoc.nSize == 0)
+    {
+        FillDirectChunk(pImage);
+        return true;
+    }
+
+    try
+    {
+        m_abyDirectChunkRaw.resize(sLoc.nSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate %" PRIu64 " bytes for chunk",
+                 static_cast<uint64_t>(sLoc.nSize));
+        return false;
+    }
+    if (VSIFSeekL(m_fpDirectChunk, sLoc.nOffset, SEEK_SET) != 0 ||
+        VSIFReadL(m_abyDirectChunkRaw.data(), 1, sLoc.nSize,
+                  m_fpDirectChunk) != sLoc.nSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read chunk of %" PRIu64 " bytes at offset %" PRIu64,
+                 static_cast<uint64_t>(sLoc.nSize),
+                 static_cast<uint64_t>(sLoc.nOffset));
+        return false;
+    }
+    if (!DecodeDirectChunk(m_abyDirectChunkRaw.data(), sLoc.nSize,
+                           sLoc.nFilterMask, pImage))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot decode chunk at offset %" PRIu64,
+                 static_cast<uint64_t>(sLoc.nOffset));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        PrefetchDirectChunks()                        */
+/************************************************************************/
+
+// Decodes in parallel, with GDAL_NUM_THREADS threads, the chunks of the
+// blocks intersecting the request that are not yet in the block cache.
+// Failures are silently ignored, as they will be reported by IReadBlock().
+void HDF5ImageRasterBand::PrefetchDirectChunks(int nXOff, int nYOff,
+                                               int nXSize, int nYSize)
+{
+    HDF5ImageDataset *poGDS = static_cast<HDF5ImageDataset *>(poDS);
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    if (nThreads <= 1)
+        return;
+    nThreads = std::min(nThreads, 1024);
+
+    std::vector<std::pair<int, int>> anBlocks;
+    for (int nBlockYOff = nYOff / nBlockYSize;
+         nBlockYOff <= (nYOff + nYSize - 1) / nBlockYSize; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nXOff / nBlockXSize;
+             nBlockXOff <= (nXOff + nXSize - 1) / nBlockXSize; ++nBlockXOff)
+        {
+            GDALRasterBlock *poBlock =
+                TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+                poBlock->DropLock();
+            else
+                anBlocks.emplace_back(nBlockXOff, nBlockYOff);
+        }
+    }
+    if (anBlocks.size() < 2)
+        return;
+
+    // Blocks are decoded in temporary buffers before being copied into the
+    // block cache, so use at most a quarter of its remaining size.
+    const size_t nChunkSize = poGDS->GetDirectChunkSize();
+    const uint64_t nCacheSize = static_cast<uint64_t>(
+        std::max<GIntBig>(0, GDALGetCacheMax64() - GDALGetCacheUsed64()) / 4);
+    if (anBlocks.size() > nCacheSize / std::max<size_t>(1, nChunkSize) ||
+        !poGDS->EnsureDirectChunkIndex())
+    {
+        return;
+    }
+
+    // Read raw chunks in a single batch
+    const size_t nBlocks = anBlocks.size();
+    std::vector<std::vector<GByte>> aabyRaw(nBlocks);
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    try
+    {
+        for (size_t i = 0; i < nBlocks; ++i)
+        {
+            const auto &sLoc = poGDS->GetDirectChunkLocation(
+                nBand, anBlocks[i].first, anBlocks[i].second);
+            if (sLoc.nSize == 0)
+                continue;
+            aabyRaw[i].resize(sLoc.nSize);
+            apData.push_back(aabyRaw[i].data());
+            anOffsets.push_back(sLoc.nOffset);
+            anSizes.push_back(sLoc.nSize);
+        }
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    if (!apData.empty() &&
+        VSIFReadMultiRangeL(static_cast<int>(apData.size()), apData.data(),
+                            anOffsets.data(), anSizes.data(),
+                            poGDS->m_fpDirectChunk) != 0)
+    {
+        return;
+    }
+
+    std::vector<GByte> abyDecoded;
+    try
+    {
+        abyDecoded.resize(nBlocks * nChunkSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    std::unique_ptr<bool[]> abOK(new bool[nBlocks]());
+
+    auto poPool = GDALGetGlobalThreadPool(nThreads);
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        const auto &sLoc = poGDS->GetDirectChunkLocation(
+            nBand, anBlocks[i].first, anBlocks[i].second);
+        void *pDst = abyDecoded.data() + i * nChunkSize;
+        if (sLoc.nSize == 0)
+        {
+            poGDS->FillDirectChunk(pDst);
+            abOK[i] = true;
+            continue;
+        }
+        const auto Decode = [poGDS, &aabyRaw, &abOK, &sLoc, pDst, i]()
+        {
+            abOK[i] = poGDS->DecodeDirectChunk(
+                aabyRaw[i].data(), aabyRaw[i].size(), sLoc.nFilterMask, pDst);
+        };
+        if (!poQueue || !poQueue->SubmitJob(Decode))
+            Decode();
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        if (!abOK[i])
+            continue;
+        GDALRasterBlock *poBlock =
+            GetLockedBlockRef(anBlocks[i].first, anBlocks[i].second,
+                              /* bJustInitialize = */ TRUE);
+        if (!poBlock)
+            break;
+        memcpy(poBlock->GetDataRef(), abyDecoded.data() + i * nChunkSize,
+               nChunkSize);
+        poBlock->DropLock();
+    }
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -388,6 +1011,13 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
+    if (poGDS->m_bDirectChunkRead && poGDS->EnsureDirectChunkIndex())
+    {
+        return poGDS->ReadDirectChunk(nBand, nBlockXOff, nBlockYOff, pImage)
+                   ? CE_None
+                   : CE_Failure;
+    }
+
     HDF5_GLOBAL_LOCK();
 
     hsize_t count[3] = {0, 0, 0};
@@ -508,6 +1138,17 @@ CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
 #endif
 
+    // Direct chunk reads are done by IReadBlock(), without the HDF5 lock
+    // that the optimizations below would take.
+    if (poGDS->m_bDirectChunkRead)
+    {
+        if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+            PrefetchDirectChunks(nXOff, nYOff, nXSize, nYSize);
+        return GDALPamRasterBand::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+
     const bool bIsBandInterleavedData =
         poGDS->ndims == 3 && poGDS->m_nOtherDimIndex == 0 &&
         poGDS->GetYIndex() == 1 && poGDS->GetXIndex() == 2;
@@ -797,6 +1438,23 @@ CPLErr HDF5ImageDataset::IRasterIO(
     }
 #endif
 
+    if (m_bDirectChunkRead)
+    {
+        if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+        {
+            for (int i = 0; i < nBandCount; ++i)
+            {
+                cpl::down_cast<HDF5ImageRasterBand *>(
+                    GetRasterBand(panBandMap[i]))
+                    ->PrefetchDirectChunks(nXOff, nYOff, nXSize, nYSize);
+            }
+        }
+        return HDF5Dataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                      pData, nBufXSize, nBufYSize, eBufType,
+                                      nBandCount, panBandMap, nPixelSpace,
+                                      nLineSpace, nBandSpace, psExtraArg);
+    }
+
     const auto IsConsecutiveBands = [](const int *panVals, int nCount)
     {
         for (int i = 1; i < nCount; ++i)
@@ -1315,6 +1973,8 @@ GDALDataset *HDF5ImageDataset::Open(GDALOpenInfo *poOpenInfo)
             }
         }
 
+        poDS->InitDirectChunkRead(listid, osFilename, eGDALDataType);
+
         H5Pclose(listid);
     }
 
@@ -365,6 +365,9 @@ class HDF5Array final : public GDALMDArray
 
     CSLConstList GetStructuralInfo() const override;
 
+    bool GetRawBlockInfo(const uint64_t *panBlockCoordinates,
+                         GDALMDArrayRawBlockInfo &info) const override;
+
     const void *GetRawNoDataValue() const override
     {
         return m_abyNoData.empty() ? nullptr : m_abyNoData.data();
@@ -1907,6 +1910,177 @@ CSLConstList HDF5Array::GetStructuralInfo() const
     return m_aosStructuralInfo.List();
 }
 
+/************************************************************************/
+/*                          GetRawBlockInfo()                           */
+/************************************************************************/
+
+bool HDF5Array::GetRawBlockInfo(const uint64_t *panBlockCoordinates,
+                                GDALMDArrayRawBlockInfo &info) const
+{
+    info = GDALMDArrayRawBlockInfo();
+
+    if (m_dt.GetClass() != GEDTC_NUMERIC || m_bHasNonNativeDataType)
+        return false;
+
+    HDF5_GLOBAL_LOCK();
+
+    const size_t nDimCount = GetDimensionCount();
+    if (H5Sget_simple_extent_ndims(m_hDataSpace) !=
+        static_cast<int>(nDimCount))
+        return false;
+
+    // Values must be stored with the size of the exposed data type, that
+    // is with at most a change of byte order.
+    const auto eClass = H5Tget_class(m_hNativeDT);
+    if (eClass != H5T_INTEGER && eClass != H5T_FLOAT)
+        return false;
+    const hid_t hFileType = H5Dget_type(m_hArray);
+    const size_t nFileTypeSize = H5Tget_size(hFileType);
+    const auto eOrder = H5Tget_order(hFileType);
+    H5Tclose(hFileType);
+    if (nFileTypeSize != m_dt.GetSize())
+        return false;
+    if (nFileTypeSize > 1)
+    {
+        if (eOrder == H5T_ORDER_LE)
+            info.aosInfo.SetNameValue("ENDIANNESS", "LITTLE");
+        else if (eOrder == H5T_ORDER_BE)
+            info.aosInfo.SetNameValue("ENDIANNESS", "BIG");
+        else
+            return false;
+    }
+
+    // HDF5 addresses are relative to the end of the user block, if any.
+    hsize_t nUserBlockSize = 0;
+    const hid_t hFileCreateList = H5Fget_create_plist(m_poShared->GetHDF5());
+    if (hFileCreateList < 0)
+        return false;
+    const herr_t status = H5Pget_userblock(hFileCreateList, &nUserBlockSize);
+    H5Pclose(hFileCreateList);
+    if (status < 0)
+        return false;
+
+    const hid_t nListId = H5Dget_create_plist(m_hArray);
+    if (nListId < 0)
+        return false;
+
+    bool bRet = false;
+    haddr_t nAddr = HADDR_UNDEF;
+    hsize_t nSize = 0;
+    const auto eLayout = H5Pget_layout(nListId);
+    if (eLayout == H5D_CONTIGUOUS)
+    {
+        bRet = true;
+        for (size_t i = 0; i < nDimCount; ++i)
+        {
+            if (panBlockCoordinates[i] != 0)
+                bRet = false;
+        }
+        // No address for data in external files
+        if (bRet && H5Pget_external_count(nListId) == 0)
+        {
+            nAddr = H5Dget_offset(m_hArray);
+            nSize = H5Dget_storage_size(m_hArray);
+        }
+        else
+        {
+            bRet = false;
+        }
+    }
+#ifdef HAVE_H5DGET_CHUNK_INFO
+    else if (eLayout == H5D_CHUNKED)
+    {
+        bRet = true;
+        std::string osFilters;
+        const int nFilters = H5Pget_nfilters(nListId);
+        for (int i = 0; bRet && i < nFilters; ++i)
+        {
+            unsigned int nFlags = 0;
+            unsigned int anValues[8] = {0};
+            size_t nValues = CPL_ARRAYSIZE(anValues);
+            char szName[64 + 1] = {0};
+            const auto eFilter = H5Pget_filter(nListId, i, &nFlags, &nValues,
+                                               anValues, 64, szName);
+            if (!osFilters.empty())
+                osFilters += ',';
+            if (eFilter == H5Z_FILTER_DEFLATE)
+            {
+                osFilters += "DEFLATE";
+            }
+            else if (eFilter == H5Z_FILTER_ZSTD)
+            {
+                osFilters += "ZSTD";
+            }
+            else if (eFilter == H5Z_FILTER_SHUFFLE)
+            {
+                osFilters += "SHUFFLE";
+            }
+            else
+            {
+                CPLDebug("HDF5", "%s: filter %s has no raw block equivalent",
+                         GetFullName().c_str(), szName);
+                bRet = false;
+            }
+        }
+        if (!osFilters.empty())
+            info.aosInfo.SetNameValue("FILTERS", osFilters.c_str());
+
+        std::vector<hsize_t> anChunkDims(nDimCount);
+        std::vector<hsize_t> anOffset(nDimCount);
+        if (bRet && nDimCount > 0 &&
+            H5Pget_chunk(nListId, static_cast<int>(nDimCount),
+                         anChunkDims.data()) != static_cast<int>(nDimCount))
+        {
+            bRet = false;
+        }
+        for (size_t i = 0; bRet && i < nDimCount; ++i)
+        {
+            if (panBlockCoordinates[i] >=
+                DIV_ROUND_UP(m_dims[i]->GetSize(), anChunkDims[i]))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid block coordinate (%" PRIu64
+                         ") for dimension %d",
+                         panBlockCoordinates[i], static_cast<int>(i));
+                bRet = false;
+            }
+            else
+            {
+                anOffset[i] = panBlockCoordinates[i] * anChunkDims[i];
+            }
+        }
+        unsigned nFilterMask = 0;
+        if (bRet && H5Dget_chunk_info_by_coord(m_hArray, anOffset.data(),
+                                               &nFilterMask, &nAddr,
+                                               &nSize) < 0)
+        {
+            bRet = false;
+        }
+        // Chunks for which some filters were skipped at writing time
+        // cannot be described by the FILTERS item.
+        if (bRet && nFilterMask != 0 && nAddr != HADDR_UNDEF)
+        {
+            CPLDebug("HDF5", "%s: unhandled filter mask for chunk",
+                     GetFullName().c_str());
+            bRet = false;
+        }
+    }
+#endif
+    H5Pclose(nListId);
+
+    if (bRet && nAddr != HADDR_UNDEF && nSize != 0)
+    {
+        info.osFilename = GetFilename();
+        info.nOffset = static_cast<uint64_t>(nUserBlockSize + nAddr);
+        info.nSize = static_cast<uint64_t>(nSize);
+    }
+    else if (!bRet)
+    {
+        info = GDALMDArrayRawBlockInfo();
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                           CopyBuffer()                               */
 /************************************************************************/
@@ -12,8 +12,11 @@
 #include "heifdataset.h"
 
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 
 extern "C" void CPL_DLL GDALRegister_HEIF();
@@ -26,6 +29,13 @@ class GDALHEIFRasterBand final : public GDALPamRasterBand
 {
   protected:
     CPLErr IReadBlock(int, int, void *) override;
+#ifdef LIBHEIF_SUPPORTS_TILES
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+#endif
 
   public:
     GDALHEIFRasterBand(GDALHEIFDataset *poDSIn, int nBandIn);
@@ -208,42 +218,16 @@ GDALHEIFDataset::RequestRangeCbk(uint64_t start_pos, uint64_t end_pos,
 #endif  // HAS_CUSTOM_FILE_READER
 
 /************************************************************************/
-/*                              Init()                                  */
+/*                           ReadContext()                              */
 /************************************************************************/
 
-bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
+// Reads the file structure into m_hCtxt. With a custom file reader,
+// ownership of fpL is transferred to the dataset.
+bool GDALHEIFDataset::ReadContext(
+    [[maybe_unused]] const std::string &osFilename,
+    [[maybe_unused]] VSILFILE *fpL)
 {
-    CPLString osFilename(poOpenInfo->pszFilename);
-#ifdef HAS_CUSTOM_FILE_READER
-    VSILFILE *fpL;
-#endif
-    int iPart = 0;
-    if (STARTS_WITH_CI(poOpenInfo->pszFilename, "HEIF:"))
-    {
-        const char *pszPartPos = poOpenInfo->pszFilename + strlen("HEIF:");
-        const char *pszNextColumn = strchr(pszPartPos, ':');
-        if (pszNextColumn == nullptr)
-            return false;
-        iPart = atoi(pszPartPos);
-        if (iPart <= 0)
-            return false;
-        osFilename = pszNextColumn + 1;
-#ifdef HAS_CUSTOM_FILE_READER
-        fpL = VSIFOpenL(osFilename, "rb");
-        if (fpL == nullptr)
-            return false;
-#endif
-    }
-    else
-    {
-#ifdef HAS_CUSTOM_FILE_READER
-        fpL = poOpenInfo->fpL;
-        poOpenInfo->fpL = nullptr;
-#endif
-    }
-
 #ifdef HAS_CUSTOM_FILE_READER
-
 #if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 19, 0)
     m_oReader.reader_api_version = 2;
 #else
@@ -281,6 +265,52 @@ bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
     }
 #endif
 
+    return true;
+}
+
+/************************************************************************/
+/*                              Init()                                  */
+/************************************************************************/
+
+bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
+{
+    CPLString osFilename(poOpenInfo->pszFilename);
+#ifdef HAS_CUSTOM_FILE_READER
+    VSILFILE *fpL;
+#endif
+    int iPart = 0;
+    if (STARTS_WITH_CI(poOpenInfo->pszFilename, "HEIF:"))
+    {
+        const char *pszPartPos = poOpenInfo->pszFilename + strlen("HEIF:");
+        const char *pszNextColumn = strchr(pszPartPos, ':');
+        if (pszNextColumn == nullptr)
+            return false;
+        iPart = atoi(pszPartPos);
+        if (iPart <= 0)
+            return false;
+        osFilename = pszNextColumn + 1;
+#ifdef HAS_CUSTOM_FILE_READER
+        fpL = VSIFOpenL(osFilename, "rb");
+        if (fpL == nullptr)
+            return false;
+#endif
+    }
+    else
+    {
+#ifdef HAS_CUSTOM_FILE_READER
+        fpL = poOpenInfo->fpL;
+        poOpenInfo->fpL = nullptr;
+#endif
+    }
+
+#ifdef HAS_CUSTOM_FILE_READER
+    if (!ReadContext(osFilename, fpL))
+        return false;
+#else
+    if (!ReadContext(osFilename, nullptr))
+        return false;
+#endif
+
     const int nSubdatasets =
         heif_context_get_number_of_top_level_images(m_hCtxt);
     if (iPart == 0)
@@ -315,7 +345,8 @@ bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
                                                  nSubdatasets);
     const auto itemId = idArray[iPart];
 
-    err = heif_context_get_image_handle(m_hCtxt, itemId, &m_hImageHandle);
+    auto err =
+        heif_context_get_image_handle(m_hCtxt, itemId, &m_hImageHandle);
     if (err.code != heif_error_Ok)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "%s",
@@ -324,6 +355,9 @@ bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
     }
 
 #ifdef LIBHEIF_SUPPORTS_TILES
+    m_osFilename = osFilename;
+    m_nItemId = itemId;
+
     err = heif_image_handle_get_image_tiling(m_hImageHandle, true, &m_tiling);
     if (err.code != heif_error_Ok)
     {
@@ -832,80 +866,356 @@ GDALHEIFRasterBand::GDALHEIFRasterBand(GDALHEIFDataset *poDSIn, int nBandIn)
 /*                            IReadBlock()                              */
 /************************************************************************/
 #ifdef LIBHEIF_SUPPORTS_TILES
-CPLErr GDALHEIFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
-                                      void *pImage)
+
+/************************************************************************/
+/*                          HEIFDecodeTile()                            */
+/************************************************************************/
+
+// Decodes a tile into pabyTile, as nTileWidth x nTileHeight pixels with
+// interleaved band values of type eDT.
+static bool HEIFDecodeTile(heif_image_handle *hImageHandle, int nBlockXOff,
+                           int nBlockYOff, int nBands, GDALDataType eDT,
+                           int nTileWidth, int nTileHeight, GByte *pabyTile,
+                           std::string &osErrorMsg)
 {
-    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
-    if (poGDS->m_bFailureDecoding)
-        return CE_Failure;
-    const int nBands = poGDS->GetRasterCount();
     heif_image *hImage = nullptr;
     struct heif_decoding_options *decode_options =
         heif_decoding_options_alloc();
 
     auto err = heif_image_handle_decode_image_tile(
-        poGDS->m_hImageHandle, &hImage, heif_colorspace_RGB,
+        hImageHandle, &hImage, heif_colorspace_RGB,
         nBands == 3
-            ? (eDataType == GDT_UInt16 ?
+            ? (eDT == GDT_UInt16 ?
 #if CPL_IS_LSB
-                                       heif_chroma_interleaved_RRGGBB_LE
+                                 heif_chroma_interleaved_RRGGBB_LE
 #else
-                                       heif_chroma_interleaved_RRGGBB_BE
+                                 heif_chroma_interleaved_RRGGBB_BE
 #endif
-                                       : heif_chroma_interleaved_RGB)
-            : (eDataType == GDT_UInt16 ?
+                                 : heif_chroma_interleaved_RGB)
+            : (eDT == GDT_UInt16 ?
 #if CPL_IS_LSB
-                                       heif_chroma_interleaved_RRGGBBAA_LE
+                                 heif_chroma_interleaved_RRGGBBAA_LE
 #else
-                                       heif_chroma_interleaved_RRGGBBAA_BE
+                                 heif_chroma_interleaved_RRGGBBAA_BE
 #endif
-                                       : heif_chroma_interleaved_RGBA),
+                                 : heif_chroma_interleaved_RGBA),
         decode_options, nBlockXOff, nBlockYOff);
+    heif_decoding_options_free(decode_options);
 
     if (err.code != heif_error_Ok)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                 err.message ? err.message : "Cannot decode image");
-        poGDS->m_bFailureDecoding = true;
-        heif_decoding_options_free(decode_options);
-        return CE_Failure;
+        osErrorMsg = err.message ? err.message : "Cannot decode image";
+        return false;
     }
-    heif_decoding_options_free(decode_options);
+
     int nStride = 0;
     const uint8_t *pSrcData = heif_image_get_plane_readonly(
         hImage, heif_channel_interleaved, &nStride);
-    if (eDataType == GDT_Byte)
+    const int nWidth = std::min(
+        nTileWidth, heif_image_get_width(hImage, heif_channel_interleaved));
+    const int nHeight = std::min(
+        nTileHeight, heif_image_get_height(hImage, heif_channel_interleaved));
+    const size_t nPixelSize =
+        static_cast<size_t>(nBands) * GDALGetDataTypeSizeBytes(eDT);
+    const size_t nLineSize = nPixelSize * nTileWidth;
+    if (nWidth < nTileWidth || nHeight < nTileHeight)
+        memset(pabyTile, 0, nLineSize * nTileHeight);
+    for (int y = 0; y < nHeight; y++)
     {
-        for (int y = 0; y < nBlockYSize; y++)
+        memcpy(pabyTile + y * nLineSize,
+               pSrcData + static_cast<size_t>(y) * nStride,
+               nPixelSize * nWidth);
+    }
+    heif_image_release(hImage);
+    return true;
+}
+
+/************************************************************************/
+/*                             StoreTile()                              */
+/************************************************************************/
+
+// Stores a tile decoded by HEIFDecodeTile() into pCallingImage for band
+// nCallingBand (if not 0), and into the block cache for the other bands.
+void GDALHEIFDataset::StoreTile(int nBlockXOff, int nBlockYOff,
+                                const GByte *pabyTile, int nCallingBand,
+                                void *pCallingImage)
+{
+    const GDALDataType eDT = GetRasterBand(1)->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const size_t nPixels =
+        static_cast<size_t>(m_tiling.tile_width) * m_tiling.tile_height;
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        void *pDst = pCallingImage;
+        GDALRasterBlock *poBlock = nullptr;
+        if (iBand != nCallingBand)
         {
-            for (int x = 0; x < nBlockXSize; x++)
+            auto poBand = GetRasterBand(iBand);
+            poBlock = poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
             {
-                const size_t srcIndex = static_cast<size_t>(y) * nStride +
-                                        static_cast<size_t>(x) * nBands +
-                                        nBand - 1;
-                const size_t outIndex =
-                    static_cast<size_t>(y) * nBlockXSize + x;
-                (static_cast<GByte *>(pImage))[outIndex] = pSrcData[srcIndex];
+                poBlock->DropLock();
+                continue;
             }
+            poBlock = poBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+            if (!poBlock)
+                continue;
+            pDst = poBlock->GetDataRef();
         }
+        GDALCopyWords64(pabyTile + (iBand - 1) * nDTSize, eDT,
+                        nBands * nDTSize, pDst, eDT, nDTSize, nPixels);
+        if (poBlock)
+            poBlock->DropLock();
     }
-    else
+}
+
+/************************************************************************/
+/*                       AcquireDecoderContext()                        */
+/************************************************************************/
+
+// Returns an idle decoder context, or opens a new one, that a worker thread
+// can use independently of other threads.
+std::unique_ptr<GDALHEIFDataset> GDALHEIFDataset::AcquireDecoderContext()
+{
     {
-        for (int y = 0; y < nBlockYSize; y++)
+        std::lock_guard oLock(m_oDecoderContextsMutex);
+        if (!m_apoDecoderContexts.empty())
         {
-            for (int x = 0; x < nBlockXSize; x++)
+            auto poCtxt = std::move(m_apoDecoderContexts.back());
+            m_apoDecoderContexts.pop_back();
+            return poCtxt;
+        }
+    }
+
+    auto poCtxt = std::make_unique<GDALHEIFDataset>();
+    VSILFILE *fpL = nullptr;
+#ifdef HAS_CUSTOM_FILE_READER
+    fpL = VSIFOpenL(m_osFilename.c_str(), "rb");
+    if (fpL == nullptr)
+        return nullptr;
+#endif
+    if (!poCtxt->ReadContext(m_osFilename, fpL))
+        return nullptr;
+    if (heif_context_get_image_handle(poCtxt->m_hCtxt, m_nItemId,
+                                      &poCtxt->m_hImageHandle)
+            .code != heif_error_Ok)
+    {
+        return nullptr;
+    }
+    return poCtxt;
+}
+
+/************************************************************************/
+/*                       ReleaseDecoderContext()                        */
+/************************************************************************/
+
+void GDALHEIFDataset::ReleaseDecoderContext(
+    std::unique_ptr<GDALHEIFDataset> &&poCtxt)
+{
+    std::lock_guard oLock(m_oDecoderContextsMutex);
+    m_apoDecoderContexts.push_back(std::move(poCtxt));
+}
+
+/************************************************************************/
+/*                           PreloadTiles()                             */
+/************************************************************************/
+
+// Decodes concurrently the tiles intersecting the window that are not yet
+// in the block cache, with one decoder context per worker thread, and puts
+// them in the block cache. Tiles that cannot be decoded are left to
+// IReadBlock(), which reports errors.
+void GDALHEIFDataset::PreloadTiles(int nXOff, int nYOff, int nXSize,
+                                   int nYSize)
+{
+    if (m_bFailureDecoding || m_bIsThumbnail || m_osFilename.empty() ||
+        m_tiling.num_columns * m_tiling.num_rows <= 1)
+    {
+        return;
+    }
+
+    const int nTileWidth = static_cast<int>(m_tiling.tile_width);
+    const int nTileHeight = static_cast<int>(m_tiling.tile_height);
+    GDALRasterBand *poFirstBand = GetRasterBand(1);
+    std::vector<std::pair<int, int>> anTiles;
+    for (int nBlockYOff = nYOff / nTileHeight;
+         nBlockYOff <= (nYOff + nYSize - 1) / nTileHeight; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nXOff / nTileWidth;
+             nBlockXOff <= (nXOff + nXSize - 1) / nTileWidth; ++nBlockXOff)
+        {
+            GDALRasterBlock *poBlock =
+                poFirstBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
             {
-                const size_t srcIndex = static_cast<size_t>(y) * (nStride / 2) +
-                                        static_cast<size_t>(x) * nBands +
-                                        nBand - 1;
-                const size_t outIndex =
-                    static_cast<size_t>(y) * nBlockXSize + x;
-                (static_cast<GUInt16 *>(pImage))[outIndex] =
-                    (reinterpret_cast<const GUInt16 *>(pSrcData))[srcIndex];
+                poBlock->DropLock();
+                continue;
             }
+            anTiles.emplace_back(nBlockXOff, nBlockYOff);
         }
     }
-    heif_image_release(hImage);
+    if (anTiles.size() < 2)
+        return;
+
+    // Decoding tiles that would be evicted from the block cache before
+    // being used is pointless.
+    const GDALDataType eDT = poFirstBand->GetRasterDataType();
+    const size_t nTileSize = static_cast<size_t>(nTileWidth) * nTileHeight *
+                             nBands * GDALGetDataTypeSizeBytes(eDT);
+    if (static_cast<GIntBig>(nTileSize * anTiles.size()) > GDALGetCacheMax64())
+        return;
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    const int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    const GDALThreadReservation oThreadReservation(std::clamp(
+        std::min(nThreads, static_cast<int>(anTiles.size())), 1, 1024));
+    const int nReservedThreads = oThreadReservation.GetThreadCount();
+    if (nReservedThreads <= 1)
+        return;
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nReservedThreads);
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+        return;
+
+    CPLDebug("HEIF", "Decoding %d tiles with %d threads",
+             static_cast<int>(anTiles.size()), nReservedThreads);
+
+    // Decode by batches to limit the memory used by tiles not yet stored
+    // in the block cache.
+    const size_t nBatchSize = 2 * static_cast<size_t>(nReservedThreads);
+    std::vector<std::vector<GByte>> aabyTiles(nBatchSize);
+    std::vector<char> abSuccess(nBatchSize);
+    std::atomic<bool> bStop{false};
+    for (size_t iStart = 0; iStart < anTiles.size() && !bStop;
+         iStart += nBatchSize)
+    {
+        const size_t nCount = std::min(nBatchSize, anTiles.size() - iStart);
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            abSuccess[i] = false;
+            poQueue->SubmitJob(
+                [this, &anTiles, &aabyTiles, &abSuccess, &bStop, iStart, i,
+                 nTileSize, nTileWidth, nTileHeight, eDT]()
+                {
+                    if (bStop)
+                        return;
+                    auto poCtxt = AcquireDecoderContext();
+                    if (!poCtxt)
+                    {
+                        bStop = true;
+                        return;
+                    }
+                    std::string osErrorMsg;
+                    try
+                    {
+                        aabyTiles[i].resize(nTileSize);
+                        abSuccess[i] = HEIFDecodeTile(
+                            poCtxt->m_hImageHandle, anTiles[iStart + i].first,
+                            anTiles[iStart + i].second, nBands, eDT,
+                            nTileWidth, nTileHeight, aabyTiles[i].data(),
+                            osErrorMsg);
+                    }
+                    catch (const std::exception &)
+                    {
+                        bStop = true;
+                    }
+                    ReleaseDecoderContext(std::move(poCtxt));
+                });
+        }
+        poQueue->WaitCompletion();
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            if (abSuccess[i])
+            {
+                StoreTile(anTiles[iStart + i].first,
+                          anTiles[iStart + i].second, aabyTiles[i].data(), 0,
+                          nullptr);
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                  int nXSize, int nYSize, void *pData,
+                                  int nBufXSize, int nBufYSize,
+                                  GDALDataType eBufType, int nBandCount,
+                                  BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                                  GSpacing nLineSpace, GSpacing nBandSpace,
+                                  GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read &&
+        ((nBufXSize >= nXSize && nBufYSize >= nYSize) || m_apoOvrDS.empty()))
+    {
+        PreloadTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                     int nXSize, int nYSize, void *pData,
+                                     int nBufXSize, int nBufYSize,
+                                     GDALDataType eBufType,
+                                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                                     GDALRasterIOExtraArg *psExtraArg)
+{
+    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
+    if (eRWFlag == GF_Read && ((nBufXSize >= nXSize && nBufYSize >= nYSize) ||
+                               poGDS->m_apoOvrDS.empty()))
+    {
+        poGDS->PreloadTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                            IReadBlock()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                      void *pImage)
+{
+    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
+    if (poGDS->m_bFailureDecoding)
+        return CE_Failure;
+    const int nBands = poGDS->GetRasterCount();
+    std::vector<GByte> abyTile;
+    try
+    {
+        abyTile.resize(static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                       nBands * GDALGetDataTypeSizeBytes(eDataType));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return CE_Failure;
+    }
+
+    std::string osErrorMsg;
+    if (!HEIFDecodeTile(poGDS->m_hImageHandle, nBlockXOff, nBlockYOff, nBands,
+                        eDataType, nBlockXSize, nBlockYSize, abyTile.data(),
+                        osErrorMsg))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        poGDS->m_bFailureDecoding = true;
+        return CE_Failure;
+    }
+
+    // Decoding gives all bands, so fill the blocks of the other bands too
+    poGDS->StoreTile(nBlockXOff, nBlockYOff, abyTile.data(), nBand, pImage);
     return CE_None;
 }
 #else
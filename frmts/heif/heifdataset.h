@@ -19,6 +19,9 @@
 
 #include "heifdrivercore.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 #include <geoheif.h>
 
@@ -41,6 +44,20 @@ class GDALHEIFDataset final : public GDALPamDataset
 
 #ifdef LIBHEIF_SUPPORTS_TILES
     heif_image_tiling m_tiling{};
+
+    // File name and image item, to open decoder contexts for worker threads
+    std::string m_osFilename{};
+    heif_item_id m_nItemId = 0;
+
+    // Idle decoder contexts, each with its own file handle
+    std::mutex m_oDecoderContextsMutex{};
+    std::vector<std::unique_ptr<GDALHEIFDataset>> m_apoDecoderContexts{};
+
+    std::unique_ptr<GDALHEIFDataset> AcquireDecoderContext();
+    void ReleaseDecoderContext(std::unique_ptr<GDALHEIFDataset> &&poCtxt);
+    void StoreTile(int nBlockXOff, int nBlockYOff, const GByte *pabyTile,
+                   int nCallingBand, void *pCallingImage);
+    void PreloadTiles(int nXOff, int nYOff, int nXSize, int nYSize);
 #endif
 
 #if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 19, 0)
@@ -66,6 +83,7 @@ class GDALHEIFDataset final : public GDALPamDataset
 #endif
 #endif
 
+    bool ReadContext(const std::string &osFilename, VSILFILE *fpL);
     bool Init(GDALOpenInfo *poOpenInfo);
     void ReadMetadata();
     void OpenThumbnails();
@@ -83,6 +101,15 @@ class GDALHEIFDataset final : public GDALPamDataset
     ~GDALHEIFDataset();
 
     static GDALDataset *OpenHEIF(GDALOpenInfo *poOpenInfo);
+
+#ifdef LIBHEIF_SUPPORTS_TILES
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+#endif
 #if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 12, 0)
     static GDALDataset *OpenAVIF(GDALOpenInfo *poOpenInfo);
 #endif
@@ -27,6 +27,7 @@
 
 #include "gdal_pam.h"
 #include "gdal_mdreader.h"
+#include "gdal_decoded_tile_cache.h"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_thread_pool.h"
 #include "memdataset.h"
@@ -78,6 +79,15 @@ struct LIBERTIFFDatasetFileReader final : public LIBERTIFF_NS::FileReader
         m_bPReadAllowed = true;
     }
 
+    bool readMultiRange(int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets,
+                        const size_t *panSizes) const
+    {
+        std::lock_guard oLock(m_oMutex);
+        return m_fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes) ==
+               0;
+    }
+
     CPL_DISALLOW_COPY_ASSIGN(LIBERTIFFDatasetFileReader)
 };
 
@@ -182,6 +192,12 @@ class LIBERTIFFDataset final : public GDALPamDataset
     std::vector<uint16_t> m_extraSamples{};
     CPLWorkerThreadPool *m_poThreadPool = nullptr;
 
+    // Prefix of the keys in the process-wide decoded tile cache
+    // (GDAL_DECODED_TILE_CACHE_SIZE), or empty if not used.
+    std::string m_osDecodedTileCacheKey{};
+
+    bool m_bHasOptimizedReadMultiRange = false;
+
     struct ThreadLocalState
     {
       private:
@@ -233,10 +249,24 @@ class LIBERTIFFDataset final : public GDALPamDataset
     void ReadGeoTransform();
     void ReadRPCTag();
 
+    // Map from strile offset to its (already read) content and size
+    using PrefetchedStriles =
+        std::map<uint64_t, std::pair<const GByte *, size_t>>;
+
+    uint64_t GetStrileIdx(int nBlockXOff, int nBlockYOff,
+                          int iBandTIFF) const;
+    bool GetStrileLocation(uint64_t curStrileIdx, uint64_t &offset,
+                           uint64_t &size, bool bEmitErrors) const;
+    void PrefetchStriles(int iXBlockMin, int iYBlockMin, int iXBlockMax,
+                         int iYBlockMax, int nBandCount,
+                         BANDMAP_TYPE panBandMap, std::vector<GByte> &abyBuffer,
+                         PrefetchedStriles &oPrefetched) const;
+
     bool ReadBlock(GByte *pabyBlockData, int nBlockXOff, int nBlockYOff,
                    int nBandCount, BANDMAP_TYPE panBandMap,
                    GDALDataType eBufType, GSpacing nPixelSpace,
-                   GSpacing nLineSpace, GSpacing nBandSpace) const;
+                   GSpacing nLineSpace, GSpacing nBandSpace,
+                   const PrefetchedStriles *poPrefetched = nullptr) const;
 
     CPL_DISALLOW_COPY_ASSIGN(LIBERTIFFDataset)
 };
@@ -884,6 +914,22 @@ CPLErr LIBERTIFFDataset::IRasterIO(
     }
     std::atomic<bool> bSuccess(true);
 
+    // When the file system has an efficient ReadMultiRange() implementation
+    // (typically network file systems), fetch all the striles of the request
+    // at once, before decoding them.
+    std::vector<GByte> abyPrefetched;
+    PrefetchedStriles oPrefetched;
+    if (m_bHasOptimizedReadMultiRange &&
+        static_cast<int64_t>(iYBlockMax - iYBlockMin) *
+                (iXBlockMax - iXBlockMin) * (bIsSeparate ? nBandCount : 1) >
+            1)
+    {
+        PrefetchStriles(iXBlockMin, iYBlockMin, iXBlockMax, iYBlockMax,
+                        nBandCount, panBandMap, abyPrefetched, oPrefetched);
+    }
+    const PrefetchedStriles *poPrefetched =
+        oPrefetched.empty() ? nullptr : &oPrefetched;
+
     for (int iYBlock = iYBlockMin, iY = 0; iYBlock < iYBlockMax && bSuccess;
          ++iYBlock, ++iY)
     {
@@ -897,7 +943,8 @@ CPLErr LIBERTIFFDataset::IRasterIO(
                     const auto lambda = [this, &bSuccess, iBand, panBandMap,
                                          pData, iY, nLineSpace, nBlockYSize, iX,
                                          nPixelSpace, nBlockXSize, nBandSpace,
-                                         iXBlock, iYBlock, eBufType]()
+                                         iXBlock, iYBlock, eBufType,
+                                         poPrefetched]()
                     {
                         int anBand[] = {panBandMap[iBand]};
                         if (!ReadBlock(static_cast<GByte *>(pData) +
@@ -905,7 +952,8 @@ CPLErr LIBERTIFFDataset::IRasterIO(
                                            iX * nPixelSpace * nBlockXSize +
                                            iBand * nBandSpace,
                                        iXBlock, iYBlock, 1, anBand, eBufType,
-                                       nPixelSpace, nLineSpace, nBandSpace))
+                                       nPixelSpace, nLineSpace, nBandSpace,
+                                       poPrefetched))
                         {
                             bSuccess = false;
                         }
@@ -925,14 +973,14 @@ CPLErr LIBERTIFFDataset::IRasterIO(
                 const auto lambda = [this, &bSuccess, nBandCount, panBandMap,
                                      pData, iY, nLineSpace, nBlockYSize, iX,
                                      nPixelSpace, nBlockXSize, nBandSpace,
-                                     iXBlock, iYBlock, eBufType]()
+                                     iXBlock, iYBlock, eBufType, poPrefetched]()
                 {
                     if (!ReadBlock(static_cast<GByte *>(pData) +
                                        iY * nLineSpace * nBlockYSize +
                                        iX * nPixelSpace * nBlockXSize,
                                    iXBlock, iYBlock, nBandCount, panBandMap,
                                    eBufType, nPixelSpace, nLineSpace,
-                                   nBandSpace))
+                                   nBandSpace, poPrefetched))
                     {
                         bSuccess = false;
                     }
@@ -1045,6 +1093,74 @@ HorizPredictorDecode4Components(void *bufferIn, size_t nPixelCount)
     }
 }
 
+#if defined(__x86_64__) || defined(_M_X64)
+
+template <class T> static inline __m128i AddSSE2(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(T) == 1)
+        return _mm_add_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm_add_epi16(a, b);
+    else if constexpr (sizeof(T) == 4)
+        return _mm_add_epi32(a, b);
+    else
+        return _mm_add_epi64(a, b);
+}
+
+// Computes the prefix sum of the lanes of x, for lanes that are
+// SHIFT bytes apart (SHIFT being the size in bytes of a pixel)
+template <class T, int SHIFT> static inline __m128i PrefixSumSSE2(__m128i x)
+{
+    x = AddSSE2<T>(x, _mm_slli_si128(x, SHIFT));
+    if constexpr (2 * SHIFT < 16)
+        return PrefixSumSSE2<T, 2 * SHIFT>(x);
+    else
+        return x;
+}
+
+// Replicates the last SHIFT bytes of x over the whole register
+template <int SHIFT> static inline __m128i BroadcastLastPixelSSE2(__m128i x)
+{
+    __m128i res = _mm_srli_si128(x, 16 - SHIFT);
+    if constexpr (SHIFT < 2)
+        res = _mm_or_si128(res, _mm_slli_si128(res, 1));
+    if constexpr (SHIFT < 4)
+        res = _mm_or_si128(res, _mm_slli_si128(res, 2));
+    if constexpr (SHIFT < 8)
+        res = _mm_or_si128(res, _mm_slli_si128(res, 4));
+    return _mm_or_si128(res, _mm_slli_si128(res, 8));
+}
+
+// Undo the horizontal predictor, processing 16 bytes at a time, for pixels
+// whose size in bytes (PIXEL_SIZE) is a divisor of 16.
+template <class T, int PIXEL_SIZE>
+CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW static void
+HorizPredictorDecodeSSE2(void *bufferIn, size_t nPixelCount)
+{
+    static_assert(PIXEL_SIZE >= static_cast<int>(sizeof(T)) &&
+                  (16 % PIXEL_SIZE) == 0);
+    constexpr int COMPONENTS = PIXEL_SIZE / static_cast<int>(sizeof(T));
+    constexpr size_t VALUES_PER_REG = 16 / sizeof(T);
+    T *buffer = static_cast<T *>(bufferIn);
+    const size_t nValueCount = nPixelCount * COMPONENTS;
+    __m128i carry = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + VALUES_PER_REG <= nValueCount; i += VALUES_PER_REG)
+    {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        x = AddSSE2<T>(PrefixSumSSE2<T, PIXEL_SIZE>(x), carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), x);
+        carry = BroadcastLastPixelSSE2<PIXEL_SIZE>(x);
+    }
+    for (i = std::max<size_t>(i, COMPONENTS); i < nValueCount; ++i)
+    {
+        buffer[i] = static_cast<T>(buffer[i] + buffer[i - COMPONENTS]);
+    }
+}
+
+#endif
+
 template <class T>
 CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW static void
 HorizPredictorDecode(void *bufferIn, size_t nPixelCount,
@@ -1053,6 +1169,39 @@ HorizPredictorDecode(void *bufferIn, size_t nPixelCount,
     static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
                   std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>);
 
+#if defined(__x86_64__) || defined(_M_X64)
+    constexpr int T_SIZE = static_cast<int>(sizeof(T));
+    if (nComponentsPerPixel == 1)
+    {
+        HorizPredictorDecodeSSE2<T, T_SIZE>(bufferIn, nPixelCount);
+        return;
+    }
+    if constexpr (T_SIZE <= 4)
+    {
+        if (nComponentsPerPixel == 2)
+        {
+            HorizPredictorDecodeSSE2<T, 2 * T_SIZE>(bufferIn, nPixelCount);
+            return;
+        }
+    }
+    if constexpr (T_SIZE <= 2)
+    {
+        if (nComponentsPerPixel == 4)
+        {
+            HorizPredictorDecodeSSE2<T, 4 * T_SIZE>(bufferIn, nPixelCount);
+            return;
+        }
+    }
+    if constexpr (T_SIZE == 1)
+    {
+        if (nComponentsPerPixel == 8)
+        {
+            HorizPredictorDecodeSSE2<T, 8>(bufferIn, nPixelCount);
+            return;
+        }
+    }
+#endif
+
     if (nComponentsPerPixel == 1)
     {
         // cppcheck-suppress duplicateBranch
@@ -1213,6 +1362,171 @@ FloatingPointHorizPredictorDecode(std::vector<uint8_t> &tmpBuffer,
     return true;
 }
 
+/************************************************************************/
+/*                           GetStrileIdx()                             */
+/************************************************************************/
+
+uint64_t LIBERTIFFDataset::GetStrileIdx(int nBlockXOff, int nBlockYOff,
+                                        int iBandTIFF) const
+{
+    if (m_image->isTiled())
+    {
+        bool ok = true;
+        return m_image->tileCoordinateToIdx(nBlockXOff, nBlockYOff, iBandTIFF,
+                                            ok);
+    }
+    else if (m_image->planarConfiguration() ==
+             LIBERTIFF_NS::PlanarConfiguration::Separate)
+    {
+        return nBlockYOff + DIV_ROUND_UP(m_image->height(),
+                                         m_image->rowsPerStripSanitized()) *
+                                static_cast<uint64_t>(iBandTIFF);
+    }
+    else
+    {
+        return nBlockYOff;
+    }
+}
+
+/************************************************************************/
+/*                         GetStrileLocation()                          */
+/************************************************************************/
+
+bool LIBERTIFFDataset::GetStrileLocation(uint64_t curStrileIdx,
+                                         uint64_t &offset, uint64_t &size,
+                                         bool bEmitErrors) const
+{
+    bool ok = true;
+    offset = curStrileIdx < m_tileOffsets.size()
+                 ? m_tileOffsets[static_cast<size_t>(curStrileIdx)]
+             : curStrileIdx < m_tileOffsets64.size()
+                 ? m_tileOffsets64[static_cast<size_t>(curStrileIdx)]
+                 : m_image->strileOffset(curStrileIdx, ok);
+    if (!ok)
+    {
+        if (bEmitErrors)
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile offset");
+        return false;
+    }
+    size = curStrileIdx < m_tileByteCounts.size()
+               ? m_tileByteCounts[static_cast<size_t>(curStrileIdx)]
+               : m_image->strileByteCount(curStrileIdx, ok);
+    if (!ok)
+    {
+        if (bEmitErrors)
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile size");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          PrefetchStriles()                           */
+/************************************************************************/
+
+/** Read in a single ReadMultiRange() call the striles intersecting
+ * the [iXBlockMin, iXBlockMax[ x [iYBlockMin, iYBlockMax[ window.
+ *
+ * On success, oPrefetched is filled with pointers into abyBuffer.
+ */
+void LIBERTIFFDataset::PrefetchStriles(int iXBlockMin, int iYBlockMin,
+                                       int iXBlockMax, int iYBlockMax,
+                                       int nBandCount, BANDMAP_TYPE panBandMap,
+                                       std::vector<GByte> &abyBuffer,
+                                       PrefetchedStriles &oPrefetched) const
+{
+    if (!m_fileReader)
+        return;
+
+    const bool bSeparate = m_image->planarConfiguration() ==
+                           LIBERTIFF_NS::PlanarConfiguration::Separate;
+    // Same config option as in the GTiff driver
+    const uint64_t nMaxTotalSize = std::min<uint64_t>(
+        std::strtoull(
+            CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE", "10485760"),
+            nullptr, 10),
+        std::numeric_limits<size_t>::max());
+
+    std::vector<std::pair<uint64_t, size_t>> aOffsetSize;
+    uint64_t nTotalSize = 0;
+    bool bGoOn = true;
+    for (int iBand = 0; bGoOn && iBand < (bSeparate ? nBandCount : 1); ++iBand)
+    {
+        const int iBandTIFF = bSeparate ? panBandMap[iBand] - 1 : 0;
+        for (int iYBlock = iYBlockMin; bGoOn && iYBlock < iYBlockMax; ++iYBlock)
+        {
+            for (int iXBlock = iXBlockMin; bGoOn && iXBlock < iXBlockMax;
+                 ++iXBlock)
+            {
+                const uint64_t curStrileIdx =
+                    GetStrileIdx(iXBlock, iYBlock, iBandTIFF);
+                uint64_t offset = 0;
+                uint64_t size = 0;
+                if (!GetStrileLocation(curStrileIdx, offset, size,
+                                       /* bEmitErrors = */ false) ||
+                    size == 0)
+                {
+                    continue;
+                }
+                if (size > nMaxTotalSize - nTotalSize)
+                {
+                    bGoOn = false;
+                }
+                else
+                {
+                    aOffsetSize.emplace_back(offset, static_cast<size_t>(size));
+                    nTotalSize += size;
+                }
+            }
+        }
+    }
+    if (aOffsetSize.size() < 2)
+        return;
+
+    std::sort(aOffsetSize.begin(), aOffsetSize.end());
+    aOffsetSize.erase(std::unique(aOffsetSize.begin(), aOffsetSize.end()),
+                      aOffsetSize.end());
+
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nTotalSize));
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+
+    // Merge contiguous ranges
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    size_t nPos = 0;
+    for (const auto &[offset, size] : aOffsetSize)
+    {
+        GByte *pabyData = abyBuffer.data() + nPos;
+        if (!anOffsets.empty() && anOffsets.back() + anSizes.back() == offset)
+        {
+            anSizes.back() += size;
+        }
+        else
+        {
+            apData.push_back(pabyData);
+            anOffsets.push_back(offset);
+            anSizes.push_back(size);
+        }
+        oPrefetched[offset] = std::pair(pabyData, size);
+        nPos += size;
+    }
+
+    if (!m_fileReader->readMultiRange(static_cast<int>(apData.size()),
+                                      apData.data(), anOffsets.data(),
+                                      anSizes.data()))
+    {
+        CPLDebug("LIBERTIFF", "ReadMultiRange() failed");
+        oPrefetched.clear();
+    }
+}
+
 /************************************************************************/
 /*                           ReadBlock()                                */
 /************************************************************************/
@@ -1221,7 +1535,8 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                                  int nBlockYOff, int nBandCount,
                                  BANDMAP_TYPE panBandMap, GDALDataType eBufType,
                                  GSpacing nPixelSpace, GSpacing nLineSpace,
-                                 GSpacing nBandSpace) const
+                                 GSpacing nBandSpace,
+                                 const PrefetchedStriles *poPrefetched) const
 {
     uint64_t offset = 0;
     size_t size = 0;
@@ -1231,43 +1546,14 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
     ThreadLocalState &tlsState = GetTLSState();
 
     const int iBandTIFFFirst = bSeparate ? panBandMap[0] - 1 : 0;
-    uint64_t curStrileIdx;
-    if (m_image->isTiled())
-    {
-        bool ok = true;
-        curStrileIdx = m_image->tileCoordinateToIdx(nBlockXOff, nBlockYOff,
-                                                    iBandTIFFFirst, ok);
-    }
-    else
-    {
-        if (bSeparate)
-            curStrileIdx =
-                nBlockYOff + DIV_ROUND_UP(m_image->height(),
-                                          m_image->rowsPerStripSanitized()) *
-                                 static_cast<uint64_t>(iBandTIFFFirst);
-        else
-            curStrileIdx = nBlockYOff;
-    }
+    const uint64_t curStrileIdx =
+        GetStrileIdx(nBlockXOff, nBlockYOff, iBandTIFFFirst);
     if (curStrileIdx != tlsState.m_curStrileIdx)
     {
-        bool ok = true;
-        offset = curStrileIdx < m_tileOffsets.size()
-                     ? m_tileOffsets[static_cast<size_t>(curStrileIdx)]
-                 : curStrileIdx < m_tileOffsets64.size()
-                     ? m_tileOffsets64[static_cast<size_t>(curStrileIdx)]
-                     : m_image->strileOffset(curStrileIdx, ok);
-        if (!ok)
+        uint64_t size64 = 0;
+        if (!GetStrileLocation(curStrileIdx, offset, size64,
+                               /* bEmitErrors = */ true))
         {
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile offset");
-            return false;
-        }
-        const uint64_t size64 =
-            curStrileIdx < m_tileByteCounts.size()
-                ? m_tileByteCounts[static_cast<size_t>(curStrileIdx)]
-                : m_image->strileByteCount(curStrileIdx, ok);
-        if (!ok)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot read strile size");
             return false;
         }
 
@@ -1291,6 +1577,24 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
         }
     }
 
+    // Read the raw strile, possibly from the data prefetched by IRasterIO()
+    const auto ReadRawStrile =
+        [this, poPrefetched, &offset, &size](GByte *pabyDst)
+    {
+        if (poPrefetched)
+        {
+            const auto oIter = poPrefetched->find(offset);
+            if (oIter != poPrefetched->end() && oIter->second.second == size)
+            {
+                memcpy(pabyDst, oIter->second.first, size);
+                return true;
+            }
+        }
+        bool ok = true;
+        m_image->readContext()->read(offset, size, pabyDst, ok);
+        return ok;
+    };
+
     const GDALDataType eNativeDT = papoBands[0]->GetRasterDataType();
     int nBlockXSize, nBlockYSize;
     papoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
@@ -1368,7 +1672,25 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
             }
         }
 
-        if (m_image->compression() != LIBERTIFF_NS::Compression::None)
+        std::string osDecodedTileCacheKey;
+        bool bFromDecodedTileCache = false;
+        if (!m_osDecodedTileCacheKey.empty() &&
+            m_image->compression() != LIBERTIFF_NS::Compression::None)
+        {
+            osDecodedTileCacheKey =
+                m_osDecodedTileCacheKey +
+                CPLSPrintf("|" CPL_FRMT_GUIB,
+                           static_cast<GUIntBig>(curStrileIdx));
+            bFromDecodedTileCache = GDALDecodedTileCacheGet(
+                osDecodedTileCacheKey, abyDecompressedStrile.data(),
+                nActualUncompressedSize);
+        }
+
+        if (bFromDecodedTileCache)
+        {
+            // Nothing to do
+        }
+        else if (m_image->compression() != LIBERTIFF_NS::Compression::None)
         {
             std::vector<GByte> &abyCompressedStrile =
                 tlsState.m_compressedBuffer;
@@ -1393,10 +1715,7 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                 }
             }
 
-            bool ok = true;
-            m_image->readContext()->read(offset, size,
-                                         abyCompressedStrile.data(), ok);
-            if (!ok)
+            if (!ReadRawStrile(abyCompressedStrile.data()))
             {
                 CPLError(CE_Failure, CPLE_FileIO,
                          "Cannot read strile from disk");
@@ -1590,6 +1909,13 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                 }
                 CPLAssert(output_data == abyDecompressedStrile.data());
             }
+
+            if (!osDecodedTileCacheKey.empty())
+            {
+                GDALDecodedTileCachePut(osDecodedTileCacheKey,
+                                        abyDecompressedStrile.data(),
+                                        nActualUncompressedSize);
+            }
         }
         else
         {
@@ -1600,10 +1926,7 @@ bool LIBERTIFFDataset::ReadBlock(GByte *pabyBlockData, int nBlockXOff,
                 return false;
             }
 
-            bool ok = true;
-            m_image->readContext()->read(offset, size,
-                                         abyDecompressedStrile.data(), ok);
-            if (!ok)
+            if (!ReadRawStrile(abyDecompressedStrile.data()))
             {
                 CPLError(CE_Failure, CPLE_FileIO,
                          "Cannot read strile from disk");
@@ -2401,6 +2724,7 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
 {
     SetDescription(poOpenInfo->pszFilename);
 
+    const char *pszFilename = poOpenInfo->pszFilename;
     int iSelectedSubDS = -1;
     if (STARTS_WITH_CI(poOpenInfo->pszFilename, "GTIFF_DIR:"))
     {
@@ -2417,7 +2741,8 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
             CPLError(CE_Failure, CPLE_AppDefined, "Invalid subdataset syntax");
             return false;
         }
-        m_poFile.reset(VSIFOpenL(pszNextColon + 1, "rb"));
+        pszFilename = pszNextColon + 1;
+        m_poFile.reset(VSIFOpenL(pszFilename, "rb"));
         if (!m_poFile)
         {
             CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
@@ -2619,6 +2944,55 @@ bool LIBERTIFFDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
+    m_bHasOptimizedReadMultiRange =
+        VSIHasOptimizedReadMultiRange(pszFilename) ||
+        // Config option for debug and testing purposes only
+        CPLTestBool(CPLGetConfigOption(
+            "LIBERTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "NO"));
+    {
+        const auto SetFromParent = [this](LIBERTIFFDataset *poDS)
+        {
+            poDS->m_fileReader = m_fileReader;
+            poDS->m_bHasOptimizedReadMultiRange = m_bHasOptimizedReadMultiRange;
+        };
+        if (m_poMaskDS)
+            SetFromParent(m_poMaskDS.get());
+        for (auto &poOvrDS : m_apoOvrDSOwned)
+        {
+            SetFromParent(poOvrDS.get());
+            if (poOvrDS->m_poMaskDS)
+                SetFromParent(poOvrDS->m_poMaskDS.get());
+        }
+    }
+
+    if (GDALDecodedTileCacheIsEnabled())
+    {
+        const std::string osFileKey =
+            GDALDecodedTileCacheGetFileKey(pszFilename);
+        if (!osFileKey.empty())
+        {
+            const auto SetDecodedTileCacheKey =
+                [&osFileKey](LIBERTIFFDataset *poDS)
+            {
+                poDS->m_osDecodedTileCacheKey =
+                    osFileKey +
+                    CPLSPrintf("|LIBERTIFF|" CPL_FRMT_GUIB,
+                               static_cast<GUIntBig>(poDS->m_image->offset()));
+                if (poDS->m_poMaskDS)
+                {
+                    poDS->m_poMaskDS->m_osDecodedTileCacheKey =
+                        osFileKey +
+                        CPLSPrintf("|LIBERTIFF|" CPL_FRMT_GUIB,
+                                   static_cast<GUIntBig>(
+                                       poDS->m_poMaskDS->m_image->offset()));
+                }
+            };
+            SetDecodedTileCacheKey(this);
+            for (auto &poOvrDS : m_apoOvrDSOwned)
+                SetDecodedTileCacheKey(poOvrDS.get());
+        }
+    }
+
     static const struct
     {
         LIBERTIFF_NS::TagCodeType code;
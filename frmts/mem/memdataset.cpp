@@ -486,6 +486,8 @@ CPLErr MEMRasterBand::CreateMaskBand(int nFlagsIn)
         static_cast<GByte *>(VSI_CALLOC_VERBOSE(nRasterXSize, nRasterYSize));
     if (pabyMaskData == nullptr)
         return CE_Failure;
+    VSIAdviseHugePages(pabyMaskData,
+                       static_cast<size_t>(nRasterXSize) * nRasterYSize);
 
     nMaskFlags = nFlagsIn;
     auto poMemMaskBand = std::unique_ptr<MEMRasterBand>(
@@ -731,6 +733,8 @@ CPLErr MEMDataset::AddBand(GDALDataType eType, char **papszOptions)
         {
             return CE_Failure;
         }
+        VSIAdviseHugePages(pData,
+                           static_cast<size_t>(nTmp) * GetRasterYSize());
 
         SetBand(nBandId,
                 new MEMRasterBand(this, nBandId, pData, eType, nPixelSize,
@@ -1368,6 +1372,8 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
         {
             return nullptr;
         }
+        // Large rasters benefit from huge pages, as they reduce TLB misses
+        VSIAdviseHugePages(pabyData, nGlobalSize);
 
         if (bPixelInterleaved)
         {
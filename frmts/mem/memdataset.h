@@ -17,9 +17,11 @@
 #include "gdal_priv.h"
 #include "gdal_rat.h"
 #include "ogrsf_frmts.h"
+#include "cpl_quad_tree.h"
 
 #include <map>
 #include <memory>
+#include <vector>
 
 CPL_C_START
 /* Caution: if changing this prototype, also change in
@@ -211,6 +213,18 @@ class CPL_DLL MEMRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     {
         return (pabyData);
     }
+
+    /** Return the spacing in bytes between two pixels of GetData() */
+    GSpacing GetPixelOffset() const
+    {
+        return nPixelOffset;
+    }
+
+    /** Return the spacing in bytes between two lines of GetData() */
+    GSpacing GetLineOffset() const
+    {
+        return nLineOffset;
+    }
 };
 
 /************************************************************************/
@@ -249,10 +263,32 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     GDALDataset *m_poDS{};
 
+    // Spatial index of the envelopes of the geometries of the
+    // m_iSpatialIndexGeomField field, with FIDs stored as feature handles.
+    // Lazily built when a spatial filter is used, and then maintained when
+    // features are modified.
+    CPLQuadTree *m_hSpatialIndex = nullptr;
+    int m_iSpatialIndexGeomField = -1;
+
+    // FIDs, in increasing order, of the features whose envelope intersects
+    // the spatial filter, when the spatial index is used by GetNextFeature().
+    std::vector<GIntBig> m_anFilteredFIDs{};
+    size_t m_iNextFilteredFID = 0;
+    bool m_bFilteredFIDsComputed = false;
+    bool m_bUseFilteredFIDs = false;
+
     // Only use it in the lifetime of a function where the list of features
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
 
+    bool BuildSpatialIndex();
+    void DestroySpatialIndex();
+    void AddToSpatialIndex(const OGRFeature *poFeature);
+    void RemoveFromSpatialIndex(const OGRFeature *poFeature);
+    bool ComputeSpatialFilterFIDs(std::vector<GIntBig> &anFIDs);
+    void ComputeFilteredFIDs();
+    void InitializeAttributeIndex();
+
   protected:
     OGRFeature *GetFeatureRef(GIntBig nFeatureId);
 
@@ -267,6 +303,9 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
     OGRFeature *GetNextFeature() override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
 
+    OGRErr ISetSpatialFilter(int iGeomField,
+                             const OGRGeometry *poGeom) override;
+
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -15,8 +15,11 @@
 #include "memdataset.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <new>
 #include <utility>
@@ -25,6 +28,7 @@
 #include "cpl_error.h"
 #include "cpl_vsi.h"
 #include "ogr_api.h"
+#include "ogr_attrind.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -69,6 +73,8 @@ OGRMemLayer::OGRMemLayer(const char *pszName,
 
     m_oMapFeaturesIter = m_oMapFeatures.begin();
     m_poFeatureDefn->Seal(/* bSealFields = */ true);
+
+    InitializeAttributeIndex();
 }
 
 OGRMemLayer::OGRMemLayer(const OGRFeatureDefn &oFeatureDefn)
@@ -80,6 +86,22 @@ OGRMemLayer::OGRMemLayer(const OGRFeatureDefn &oFeatureDefn)
 
     m_oMapFeaturesIter = m_oMapFeatures.begin();
     m_poFeatureDefn->Seal(/* bSealFields = */ true);
+
+    InitializeAttributeIndex();
+}
+
+/************************************************************************/
+/*                      InitializeAttributeIndex()                      */
+/************************************************************************/
+
+// Attach an empty in-memory attribute index, so that CREATE INDEX can be
+// used on the layer. This also drops any existing index, which must be done
+// when fields are deleted or reordered, as indexes are keyed by field index.
+void OGRMemLayer::InitializeAttributeIndex()
+{
+    delete m_poAttrIndex;
+    m_poAttrIndex = OGRCreateMemoryLayerIndex();
+    m_poAttrIndex->Initialize(nullptr, this);
 }
 
 /************************************************************************/
@@ -95,6 +117,8 @@ OGRMemLayer::~OGRMemLayer()
                  m_nFeaturesRead, m_poFeatureDefn->GetName());
     }
 
+    DestroySpatialIndex();
+
     if (m_papoFeatures != nullptr)
     {
         for (GIntBig i = 0; i < m_nMaxFeatureCount; i++)
@@ -118,6 +142,254 @@ void OGRMemLayer::ResetReading()
 {
     m_iNextReadFID = 0;
     m_oMapFeaturesIter = m_oMapFeatures.begin();
+    m_bFilteredFIDsComputed = false;
+    m_bUseFilteredFIDs = false;
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRMemLayer::ISetSpatialFilter(int iGeomField,
+                                      const OGRGeometry *poGeom)
+{
+    const OGRErr eErr = OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
+    m_bFilteredFIDsComputed = false;
+    m_bUseFilteredFIDs = false;
+    return eErr;
+}
+
+/************************************************************************/
+/*                       GetSpatialIndexBounds()                        */
+/************************************************************************/
+
+static bool GetSpatialIndexBounds(const OGRFeature *poFeature, int iGeomField,
+                                  CPLRectObj &sBounds)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+    // Features with null or empty geometries never match a spatial filter
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    sBounds.minx = sEnvelope.MinX;
+    sBounds.miny = sEnvelope.MinY;
+    sBounds.maxx = sEnvelope.MaxX;
+    sBounds.maxy = sEnvelope.MaxY;
+    return true;
+}
+
+/************************************************************************/
+/*                         BuildSpatialIndex()                          */
+/************************************************************************/
+
+bool OGRMemLayer::BuildSpatialIndex()
+{
+    DestroySpatialIndex();
+
+    std::vector<std::pair<GIntBig, CPLRectObj>> aoEntries;
+    OGREnvelope sGlobalEnvelope;
+    try
+    {
+        auto poIter =
+            std::unique_ptr<IOGRMemLayerFeatureIterator>(GetIterator());
+        while (const OGRFeature *poFeature = poIter->Next())
+        {
+            CPLRectObj sBounds;
+            if (!GetSpatialIndexBounds(poFeature, m_iGeomFieldFilter,
+                                       sBounds))
+                continue;
+            // FIDs are stored as void* in the quad tree
+            if (static_cast<GUIntBig>(poFeature->GetFID()) >
+                std::numeric_limits<uintptr_t>::max())
+                return false;
+            sGlobalEnvelope.Merge(sBounds.minx, sBounds.miny);
+            sGlobalEnvelope.Merge(sBounds.maxx, sBounds.maxy);
+            aoEntries.emplace_back(poFeature->GetFID(), sBounds);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Warning, CPLE_OutOfMemory,
+                 "Cannot allocate memory for the spatial index");
+        return false;
+    }
+
+    CPLRectObj sGlobalBounds = {0, 0, 0, 0};
+    if (sGlobalEnvelope.IsInit())
+    {
+        sGlobalBounds.minx = sGlobalEnvelope.MinX;
+        sGlobalBounds.miny = sGlobalEnvelope.MinY;
+        sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+        sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    }
+    m_hSpatialIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(
+        m_hSpatialIndex,
+        CPLQuadTreeGetAdvisedMaxDepth(static_cast<int>(
+            std::min<size_t>(INT_MAX, std::max<size_t>(1, aoEntries.size())))));
+    for (const auto &oEntry : aoEntries)
+    {
+        CPLQuadTreeInsertWithBounds(
+            m_hSpatialIndex,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(oEntry.first)),
+            &oEntry.second);
+    }
+    m_iSpatialIndexGeomField = m_iGeomFieldFilter;
+    return true;
+}
+
+/************************************************************************/
+/*                        DestroySpatialIndex()                         */
+/************************************************************************/
+
+void OGRMemLayer::DestroySpatialIndex()
+{
+    if (m_hSpatialIndex)
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+    m_hSpatialIndex = nullptr;
+    m_iSpatialIndexGeomField = -1;
+}
+
+/************************************************************************/
+/*                         AddToSpatialIndex()                          */
+/************************************************************************/
+
+void OGRMemLayer::AddToSpatialIndex(const OGRFeature *poFeature)
+{
+    CPLRectObj sBounds;
+    if (m_hSpatialIndex == nullptr ||
+        !GetSpatialIndexBounds(poFeature, m_iSpatialIndexGeomField, sBounds))
+        return;
+    if (static_cast<GUIntBig>(poFeature->GetFID()) >
+        std::numeric_limits<uintptr_t>::max())
+    {
+        DestroySpatialIndex();
+        return;
+    }
+    CPLQuadTreeInsertWithBounds(
+        m_hSpatialIndex,
+        reinterpret_cast<void *>(static_cast<uintptr_t>(poFeature->GetFID())),
+        &sBounds);
+}
+
+/************************************************************************/
+/*                       RemoveFromSpatialIndex()                       */
+/************************************************************************/
+
+void OGRMemLayer::RemoveFromSpatialIndex(const OGRFeature *poFeature)
+{
+    CPLRectObj sBounds;
+    if (m_hSpatialIndex == nullptr ||
+        !GetSpatialIndexBounds(poFeature, m_iSpatialIndexGeomField, sBounds))
+        return;
+    CPLQuadTreeRemove(
+        m_hSpatialIndex,
+        reinterpret_cast<void *>(static_cast<uintptr_t>(poFeature->GetFID())),
+        &sBounds);
+}
+
+/************************************************************************/
+/*                      ComputeSpatialFilterFIDs()                      */
+/************************************************************************/
+
+// Use the spatial index, if the layer is large enough, to find the sorted
+// FIDs of the candidate features for the current spatial filter.
+bool OGRMemLayer::ComputeSpatialFilterFIDs(std::vector<GIntBig> &anFIDs)
+{
+    constexpr GIntBig MIN_FEATURES_FOR_SPATIAL_INDEX = 100;
+
+    if (m_nFeatureCount < MIN_FEATURES_FOR_SPATIAL_INDEX ||
+        !CPLTestBool(CPLGetConfigOption("OGR_MEM_SPATIAL_INDEX", "YES")))
+        return false;
+
+    if ((m_hSpatialIndex == nullptr ||
+         m_iSpatialIndexGeomField != m_iGeomFieldFilter) &&
+        !BuildSpatialIndex())
+        return false;
+
+    CPLRectObj sAOI;
+    sAOI.minx = m_sFilterEnvelope.MinX;
+    sAOI.miny = m_sFilterEnvelope.MinY;
+    sAOI.maxx = m_sFilterEnvelope.MaxX;
+    sAOI.maxy = m_sFilterEnvelope.MaxY;
+    int nCount = 0;
+    void **pahFIDs = CPLQuadTreeSearch(m_hSpatialIndex, &sAOI, &nCount);
+    try
+    {
+        anFIDs.reserve(nCount);
+        for (int i = 0; i < nCount; ++i)
+        {
+            anFIDs.push_back(static_cast<GIntBig>(
+                reinterpret_cast<uintptr_t>(pahFIDs[i])));
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLFree(pahFIDs);
+        anFIDs.clear();
+        return false;
+    }
+    CPLFree(pahFIDs);
+    // Return features in the same order as without spatial index
+    std::sort(anFIDs.begin(), anFIDs.end());
+    return true;
+}
+
+/************************************************************************/
+/*                        ComputeFilteredFIDs()                         */
+/************************************************************************/
+
+// Use the attribute indexes and the spatial index to find the FIDs of the
+// candidate features for the current filters. Candidates are still
+// evaluated against the filters by GetNextFeature().
+void OGRMemLayer::ComputeFilteredFIDs()
+{
+    m_bFilteredFIDsComputed = true;
+    m_bUseFilteredFIDs = false;
+    m_anFilteredFIDs.clear();
+    m_iNextFilteredFID = 0;
+
+    std::vector<GIntBig> anSpatialFIDs;
+    const bool bHasSpatialFIDs =
+        m_poFilterGeom != nullptr && ComputeSpatialFilterFIDs(anSpatialFIDs);
+
+    GIntBig *panAttrFIDs =
+        m_poAttrQuery != nullptr
+            ? m_poAttrQuery->EvaluateAgainstIndices(this, nullptr)
+            : nullptr;
+    if (panAttrFIDs == nullptr)
+    {
+        if (bHasSpatialFIDs)
+        {
+            m_anFilteredFIDs = std::move(anSpatialFIDs);
+            m_bUseFilteredFIDs = true;
+        }
+        return;
+    }
+
+    size_t nAttrFIDCount = 0;
+    while (panAttrFIDs[nAttrFIDCount] != OGRNullFID)
+        ++nAttrFIDCount;
+    try
+    {
+        if (bHasSpatialFIDs)
+        {
+            std::set_intersection(panAttrFIDs, panAttrFIDs + nAttrFIDCount,
+                                  anSpatialFIDs.begin(), anSpatialFIDs.end(),
+                                  std::back_inserter(m_anFilteredFIDs));
+        }
+        else
+        {
+            m_anFilteredFIDs.assign(panAttrFIDs, panAttrFIDs + nAttrFIDCount);
+        }
+        m_bUseFilteredFIDs = true;
+    }
+    catch (const std::bad_alloc &)
+    {
+        m_anFilteredFIDs.clear();
+    }
+    CPLFree(panAttrFIDs);
 }
 
 /************************************************************************/
@@ -127,10 +399,22 @@ void OGRMemLayer::ResetReading()
 OGRFeature *OGRMemLayer::GetNextFeature()
 
 {
+    if ((m_poFilterGeom != nullptr || m_poAttrQuery != nullptr) &&
+        !m_bFilteredFIDsComputed)
+        ComputeFilteredFIDs();
+
     while (true)
     {
         OGRFeature *poFeature = nullptr;
-        if (m_papoFeatures)
+        if (m_bUseFilteredFIDs)
+        {
+            if (m_iNextFilteredFID >= m_anFilteredFIDs.size())
+                return nullptr;
+            poFeature = GetFeatureRef(m_anFilteredFIDs[m_iNextFilteredFID++]);
+            if (poFeature == nullptr)
+                continue;
+        }
+        else if (m_papoFeatures)
         {
             if (m_iNextReadFID >= m_nMaxFeatureCount)
                 return nullptr;
@@ -361,6 +645,8 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
 
         if (m_papoFeatures[nFID] != nullptr)
         {
+            RemoveFromSpatialIndex(m_papoFeatures[nFID]);
+            m_poAttrIndex->RemoveFromIndex(m_papoFeatures[nFID]);
             delete m_papoFeatures[nFID];
             m_papoFeatures[nFID] = nullptr;
         }
@@ -370,21 +656,30 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         }
 
         m_papoFeatures[nFID] = poFeatureCloned.release();
+        AddToSpatialIndex(m_papoFeatures[nFID]);
+        m_poAttrIndex->AddToIndex(m_papoFeatures[nFID]);
     }
     else
     {
         FeatureIterator oIter = m_oMapFeatures.find(nFID);
         if (oIter != m_oMapFeatures.end())
         {
+            RemoveFromSpatialIndex(oIter->second.get());
+            m_poAttrIndex->RemoveFromIndex(oIter->second.get());
             oIter->second = std::move(poFeatureCloned);
+            AddToSpatialIndex(oIter->second.get());
+            m_poAttrIndex->AddToIndex(oIter->second.get());
         }
         else
         {
             try
             {
+                OGRFeature *poNewFeature = poFeatureCloned.get();
                 m_oMapFeatures[nFID] = std::move(poFeatureCloned);
                 m_oMapFeaturesIter = m_oMapFeatures.end();
                 m_nFeatureCount++;
+                AddToSpatialIndex(poNewFeature);
+                m_poAttrIndex->AddToIndex(poNewFeature);
             }
             catch (const std::bad_alloc &)
             {
@@ -477,18 +772,26 @@ OGRErr OGRMemLayer::IUpdateFeature(OGRFeature *poFeature,
     if (!poFeatureRef)
         return OGRERR_NON_EXISTING_FEATURE;
 
+    if (nUpdatedFieldsCount > 0)
+        m_poAttrIndex->RemoveFromIndex(poFeatureRef);
     for (int i = 0; i < nUpdatedFieldsCount; ++i)
     {
         poFeatureRef->SetField(
             panUpdatedFieldsIdx[i],
             poFeature->GetRawFieldRef(panUpdatedFieldsIdx[i]));
     }
+    if (nUpdatedFieldsCount > 0)
+        m_poAttrIndex->AddToIndex(poFeatureRef);
+    if (nUpdatedGeomFieldsCount > 0)
+        RemoveFromSpatialIndex(poFeatureRef);
     for (int i = 0; i < nUpdatedGeomFieldsCount; ++i)
     {
         poFeatureRef->SetGeomFieldDirectly(
             panUpdatedGeomFieldsIdx[i],
             poFeature->StealGeometry(panUpdatedGeomFieldsIdx[i]));
     }
+    if (nUpdatedGeomFieldsCount > 0)
+        AddToSpatialIndex(poFeatureRef);
     if (bUpdateStyleString)
     {
         poFeatureRef->SetStyleString(poFeature->GetStyleString());
@@ -520,6 +823,8 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromSpatialIndex(m_papoFeatures[nFID]);
+        m_poAttrIndex->RemoveFromIndex(m_papoFeatures[nFID]);
         delete m_papoFeatures[nFID];
         m_papoFeatures[nFID] = nullptr;
     }
@@ -530,6 +835,8 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromSpatialIndex(oIter->second.get());
+        m_poAttrIndex->RemoveFromIndex(oIter->second.get());
         m_oMapFeatures.erase(oIter);
     }
 
@@ -683,6 +990,8 @@ OGRErr OGRMemLayer::DeleteField(int iField)
         }
     }
 
+    InitializeAttributeIndex();
+
     m_bUpdated = true;
 
     return whileUnsealing(m_poFeatureDefn)->DeleteFieldDefn(iField);
@@ -713,6 +1022,8 @@ OGRErr OGRMemLayer::ReorderFields(int *panMap)
         poFeature->RemapFields(nullptr, panMap);
     }
 
+    InitializeAttributeIndex();
+
     m_bUpdated = true;
 
     return whileUnsealing(m_poFeatureDefn)->ReorderFieldDefns(panMap);
@@ -741,6 +1052,9 @@ OGRErr OGRMemLayer::AlterFieldDefn(int iField, OGRFieldDefn *poNewFieldDefn,
         (poFieldDefn->GetType() != poNewFieldDefn->GetType() ||
          poFieldDefn->GetSubType() != poNewFieldDefn->GetSubType()))
     {
+        if (m_poAttrIndex->GetFieldIndex(iField))
+            m_poAttrIndex->DropIndex(iField);
+
         if ((poNewFieldDefn->GetType() == OFTDate ||
              poNewFieldDefn->GetType() == OFTTime ||
              poNewFieldDefn->GetType() == OFTDateTime) &&
@@ -650,6 +650,12 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual ~MRFRasterBand();
     virtual CPLErr IReadBlock(int xblk, int yblk, void *buffer) override;
     virtual CPLErr IWriteBlock(int xblk, int yblk, void *buffer) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *) override;
+
+    // Read ahead and decode the blocks of a window, possibly in parallel
+    void PrefetchBlocks(int nXOff, int nYOff, int nXSize, int nYSize);
 
     // Check that the respective block has data, without reading it
     virtual bool TestBlock(int xblk, int yblk);
@@ -760,6 +766,10 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) = 0;
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) = 0;
 
+    // Undo the deflate or zstd packing and decompress a tile into a page
+    CPLErr DecodeTile(buf_mgr &page, void *data, size_t size,
+                      bool bSharedState);
+
     // Read the index record itself, can be overwritten
     //    virtual CPLErr ReadTileIdx(const ILSize &, ILIdx &, GIntBig bias = 0);
 
@@ -209,6 +209,16 @@ CPLErr MRFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    // Pixel interleaved buffers are filled from the block cache without
+    // calling the band IRasterIO, so prefetch the blocks of all bands here
+    if (eRWFlag == GF_Read && (nBufXSize >= nXSize || nBufYSize >= nYSize ||
+                               GetRasterBand(1)->GetOverviewCount() == 0))
+    {
+        for (int i = 0; i < nBandCount; i++)
+            static_cast<MRFRasterBand *>(GetRasterBand(panBandMap[i]))
+                ->PrefetchBlocks(nXOff, nYOff, nXSize, nYSize);
+    }
+
     //
     // Call the parent implementation, which splits it into bands and calls
     // their IRasterIO
@@ -53,13 +53,16 @@
  ****************************************************************************/
 
 #include "marfa.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
 
 #include <vector>
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <zlib.h>
 #if defined(ZSTD_SUPPORT)
 #include <zstd.h>
@@ -1090,11 +1093,51 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
 
     /* initialize padding bytes */
     memset(((char *)data) + static_cast<size_t>(tinfo.size), 0, PADDING_BYTES);
-    buf_mgr src = {(char *)data, static_cast<size_t>(tinfo.size)};
-    buf_mgr dst;
 
     auto start_time = steady_clock::now();
 
+    // After unpacking, the size has to be pageSizeBytes
+    // If pages are interleaved, use the dataset page buffer instead
+    buf_mgr dst;
+    dst.buffer = reinterpret_cast<char *>(
+        (1 == cstride) ? buffer : poMRFDS->GetPBuffer());
+    dst.size = img.pageSizeBytes;
+
+    CPLErr ret = DecodeTile(dst, data, static_cast<size_t>(tinfo.size), true);
+
+    poMRFDS->read_timer +=
+        duration_cast<nanoseconds>(steady_clock::now() - start_time);
+
+    if (poMRFDS->no_errors && ret != CE_None)
+    {
+        // Set each page buffer to the correct no data value, then proceed
+        return (1 == cstride) ? FillBlock(buffer)
+                              : FillBlock(xblk, yblk, buffer);
+    }
+
+    // If pages are separate or we had errors, we're done
+    if (1 == cstride || CE_None != ret)
+        return ret;
+
+    // De-interleave page from dataset buffer and return
+    return ReadInterleavedBlock(xblk, yblk, buffer);
+}
+
+/**
+ *\brief Decode a tile read from the data file into a page buffer
+ *
+ * data holds size bytes followed by PADDING_BYTES initialized bytes, it is
+ * freed by this function.  page.size has to be the page size in bytes.
+ * When bSharedState is false, the dataset ZSTD context is not used, so tiles
+ * can be decoded from multiple threads at the same time
+ */
+
+CPLErr MRFRasterBand::DecodeTile(buf_mgr &page, void *data, size_t size,
+                                 bool bSharedState)
+{
+    buf_mgr src = {static_cast<char *>(data), size};
+    buf_mgr dst;
+
     // We got the data, do we need to decompress it before decoding?
     if (dodeflate)
     {
@@ -1121,7 +1164,7 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
         {  // Got it unpacked, update the pointers
             CPLFree(data);
             data = dst.buffer;
-            tinfo.size = dst.size;
+            size = dst.size;
         }
         else
         {  // assume the page was not gzipped, warn only
@@ -1135,7 +1178,12 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
     // undo ZSTD
     else if (dozstd)
     {
-        auto ctx = poMRFDS->getzsd();
+        // The dataset context cannot be used from several threads
+        std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> localCtx(
+            nullptr, ZSTD_freeDCtx);
+        if (!bSharedState)
+            localCtx.reset(ZSTD_createDCtx());
+        auto ctx = bSharedState ? poMRFDS->getzsd() : localCtx.get();
         if (!ctx)
         {
             CPLFree(data);
@@ -1174,7 +1222,7 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
         {
             CPLFree(data);  // The compressed data
             data = dst.buffer;
-            tinfo.size = raw_size;
+            size = raw_size;
             // Might need to undo the rank sort
             size_t ranks = 0;
             if (img.comp == IL_NONE || img.comp == IL_ZSTD)
@@ -1183,7 +1231,7 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
             if (ranks)
             {
                 src.buffer = static_cast<char *>(data);
-                src.size = static_cast<size_t>(tinfo.size);
+                src.size = size;
                 derank(src, ranks);
             }
         }
@@ -1191,44 +1239,229 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
 #endif
 
     src.buffer = static_cast<char *>(data);
-    src.size = static_cast<size_t>(tinfo.size);
-
-    // After unpacking, the size has to be pageSizeBytes
-    // If pages are interleaved, use the dataset page buffer instead
-    dst.buffer = reinterpret_cast<char *>(
-        (1 == cstride) ? buffer : poMRFDS->GetPBuffer());
-    dst.size = img.pageSizeBytes;
+    src.size = size;
 
     if (poMRFDS->no_errors)
         CPLPushErrorHandler(CPLQuietErrorHandler);
-    CPLErr ret = Decompress(dst, src);
-
-    poMRFDS->read_timer +=
-        duration_cast<nanoseconds>(steady_clock::now() - start_time);
+    CPLErr ret = Decompress(page, src);
+    if (poMRFDS->no_errors)
+        CPLPopErrorHandler();
 
-    dst.size =
-        img.pageSizeBytes;  // In case the decompress failed, force it back
+    // In case the decompress failed, force it back
+    page.size = img.pageSizeBytes;
 
     // Swap whatever we decompressed if we need to
     if (is_Endianness_Dependent(img.dt, img.comp) && (img.nbo != NET_ORDER))
-        swab_buff(dst, img);
+        swab_buff(page, img);
 
     CPLFree(data);
-    if (poMRFDS->no_errors)
+    return ret;
+}
+
+/**
+ *\brief Read ahead the blocks intersecting a read window
+ *
+ * The index records and the tiles are read with a few multi-range requests,
+ * which matters for MRFs on object storage, and the tiles are decompressed
+ * using the GDAL worker thread pool when GDAL_NUM_THREADS is set.  The
+ * decoded blocks are placed in the block cache.  Failures are ignored,
+ * IReadBlock() then deals with the corresponding blocks and reports errors
+ */
+
+void MRFRasterBand::PrefetchBlocks(int nXOff, int nYOff, int nXSize,
+                                   int nYSize)
+{
+    // Only for read-only MRFs with band separate pages, no caching or cloning
+    if (img.pagesize.c != 1 || poMRFDS->eAccess != GA_ReadOnly ||
+        !poMRFDS->source.empty() || poMRFDS->IsSingleTile())
+        return;
+
+    const int nXBlk0 = nXOff / nBlockXSize;
+    const int nXBlk1 = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nYBlk0 = nYOff / nBlockYSize;
+    const int nYBlk1 = (nYOff + nYSize - 1) / nBlockYSize;
+    const int nXBlocks = nXBlk1 - nXBlk0 + 1;
+    const int nYBlocks = nYBlk1 - nYBlk0 + 1;
+    const GIntBig nBlocks = static_cast<GIntBig>(nXBlocks) * nYBlocks;
+    if (nBlocks < 2)
+        return;
+
+    // Do not let the prefetched blocks evict each other from the block cache
+    if (nBlocks * img.pageSizeBytes > GDALGetCacheMax64() / 4)
+        return;
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    nThreads = std::min(nThreads, 1024);
+    // Nothing to gain for local files read from a single thread
+    if (nThreads <= 1 && VSIIsLocal(poMRFDS->current.datfname))
+        return;
+
+    VSILFILE *l_ifp = IdxFP();
+    VSILFILE *l_dfp = DataFP();
+    if (l_ifp == nullptr || l_dfp == nullptr)
+        return;
+
+    // The index records of a row of blocks are in a single range, interleaved
+    // with the records of the other bands
+    const size_t nRecStride = static_cast<size_t>(img.pagecount.c);
+    const size_t nRowRecords = (nXBlocks - 1) * nRecStride + 1;
+    std::vector<ILIdx> aIdx;
+    std::vector<void *> apIdxData;
+    std::vector<vsi_l_offset> anIdxOffsets;
+    std::vector<size_t> anIdxSizes;
+    try
     {
-        CPLPopErrorHandler();
-        if (ret != CE_None)  // Set each page buffer to the correct no data
-                             // value, then proceed
-            return (1 == cstride) ? FillBlock(buffer)
-                                  : FillBlock(xblk, yblk, buffer);
+        aIdx.resize(nYBlocks * nRowRecords);
+        for (int i = 0; i < nYBlocks; ++i)
+        {
+            const ILSize req(nXBlk0, nYBlk0 + i, 0, nBand - 1, m_l);
+            apIdxData.push_back(&aIdx[i * nRowRecords]);
+            anIdxOffsets.push_back(IdxOffset(req, img));
+            anIdxSizes.push_back(nRowRecords * sizeof(ILIdx));
+        }
+    }
+    catch (const std::exception &)
+    {
+        return;
     }
+    if (VSIFReadMultiRangeL(nYBlocks, apIdxData.data(), anIdxOffsets.data(),
+                            anIdxSizes.data(), l_ifp) != 0)
+        return;
 
-    // If pages are separate or we had errors, we're done
-    if (1 == cstride || CE_None != ret)
-        return ret;
+    struct Tile
+    {
+        int nXBlk = 0;
+        int nYBlk = 0;
+        void *pData = nullptr;
+        size_t nSize = 0;
+        std::vector<GByte> abyPage{};
+        bool bOK = false;
+    };
+
+    std::vector<Tile> asTiles;
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    const auto FreeTiles = [&asTiles]()
+    {
+        for (auto &sTile : asTiles)
+            CPLFree(sTile.pData);
+    };
+    try
+    {
+        for (int i = 0; i < nYBlocks; ++i)
+        {
+            for (int j = 0; j < nXBlocks; ++j)
+            {
+                const ILIdx &tinfo = aIdx[i * nRowRecords + j * nRecStride];
+                const GIntBig nSize = net64(tinfo.size);
+                // Missing or invalid tiles are left to IReadBlock()
+                if (nSize <= 0 ||
+                    nSize > static_cast<GIntBig>(poMRFDS->pbsize) * 2)
+                    continue;
+
+                if (GDALRasterBlock *poBlock =
+                        TryGetLockedBlockRef(nXBlk0 + j, nYBlk0 + i))
+                {
+                    poBlock->DropLock();
+                    continue;
+                }
 
-    // De-interleave page from dataset buffer and return
-    return ReadInterleavedBlock(xblk, yblk, buffer);
+                Tile sTile;
+                sTile.nXBlk = nXBlk0 + j;
+                sTile.nYBlk = nYBlk0 + i;
+                sTile.nSize = static_cast<size_t>(nSize);
+                sTile.pData = VSIMalloc(sTile.nSize + PADDING_BYTES);
+                if (sTile.pData == nullptr)
+                {
+                    FreeTiles();
+                    return;
+                }
+                memset(static_cast<char *>(sTile.pData) + sTile.nSize, 0,
+                       PADDING_BYTES);
+                sTile.abyPage.resize(img.pageSizeBytes);
+                apData.push_back(sTile.pData);
+                anOffsets.push_back(
+                    static_cast<vsi_l_offset>(net64(tinfo.offset)));
+                anSizes.push_back(sTile.nSize);
+                asTiles.push_back(std::move(sTile));
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        FreeTiles();
+        return;
+    }
+
+    if (asTiles.empty() ||
+        VSIFReadMultiRangeL(static_cast<int>(asTiles.size()), apData.data(),
+                            anOffsets.data(), anSizes.data(), l_dfp) != 0)
+    {
+        FreeTiles();
+        return;
+    }
+
+    const auto DecodeJob = [this](Tile &sTile)
+    {
+        // Errors are reported when IReadBlock() processes the block
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        buf_mgr page = {reinterpret_cast<char *>(sTile.abyPage.data()),
+                        sTile.abyPage.size()};
+        // DecodeTile() frees the tile data
+        sTile.bOK = CE_None == DecodeTile(page, sTile.pData, sTile.nSize,
+                                          /* bSharedState = */ false);
+        sTile.pData = nullptr;
+    };
+
+    nThreads = std::min(nThreads, static_cast<int>(asTiles.size()));
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    for (auto &sTile : asTiles)
+    {
+        if (!poQueue || !poQueue->SubmitJob([&DecodeJob, &sTile]()
+                                            { DecodeJob(sTile); }))
+            DecodeJob(sTile);
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    for (auto &sTile : asTiles)
+    {
+        if (!sTile.bOK)
+            continue;
+        GDALRasterBlock *poBlock =
+            GetLockedBlockRef(sTile.nXBlk, sTile.nYBlk, TRUE);
+        if (poBlock == nullptr)
+            continue;
+        memcpy(poBlock->GetDataRef(), sTile.abyPage.data(),
+               sTile.abyPage.size());
+        poBlock->DropLock();
+    }
+}
+
+/**
+ *\brief Read requests covering multiple blocks prefetch them first
+ */
+
+CPLErr MRFRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                int nXSize, int nYSize, void *pData,
+                                int nBufXSize, int nBufYSize,
+                                GDALDataType eBufType, GSpacing nPixelSpace,
+                                GSpacing nLineSpace,
+                                GDALRasterIOExtraArg *psExtraArg)
+{
+    // Subsampled reads might be served by an overview
+    if (eRWFlag == GF_Read &&
+        (nBufXSize >= nXSize || nBufYSize >= nYSize || GetOverviewCount() == 0))
+        PrefetchBlocks(nXOff, nYOff, nXSize, nYSize);
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
 }
 
 /**
@@ -0,0 +1,367 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reader of variables of netCDF classic format files
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "netcdfclassicreader.h"
+
+#include "cpl_error.h"
+#include "gdal.h"
+
+#include <cstring>
+#include <limits>
+
+// Tags of the lists of the header, as in the netCDF classic format spec.
+constexpr uint32_t NC_DIMENSION_TAG = 0x0A;
+constexpr uint32_t NC_VARIABLE_TAG = 0x0B;
+constexpr uint32_t NC_ATTRIBUTE_TAG = 0x0C;
+
+/************************************************************************/
+/*                           GetEltSize()                               */
+/************************************************************************/
+
+static int GetEltSize(nc_type eType)
+{
+    switch (eType)
+    {
+        case NC_BYTE:
+        case NC_CHAR:
+        case NC_UBYTE:
+            return 1;
+        case NC_SHORT:
+        case NC_USHORT:
+            return 2;
+        case NC_INT:
+        case NC_FLOAT:
+        case NC_UINT:
+            return 4;
+        case NC_DOUBLE:
+        case NC_INT64:
+        case NC_UINT64:
+            return 8;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                         ~netCDFClassicReader()                       */
+/************************************************************************/
+
+netCDFClassicReader::~netCDFClassicReader()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                               Open()                                 */
+/************************************************************************/
+
+std::unique_ptr<netCDFClassicReader>
+netCDFClassicReader::Open(const char *pszFilename)
+{
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    if (!fp)
+        return nullptr;
+
+    std::unique_ptr<netCDFClassicReader> poReader(new netCDFClassicReader());
+    poReader->m_fp = fp;
+    if (!poReader->ParseHeader())
+    {
+        CPLDebug("GDAL_netCDF",
+                 "Header of %s not handled by the direct classic reader",
+                 pszFilename);
+        return nullptr;
+    }
+    return poReader;
+}
+
+/************************************************************************/
+/*                            ParseHeader()                             */
+/************************************************************************/
+
+bool netCDFClassicReader::ParseHeader()
+{
+    if (VSIFSeekL(m_fp, 0, SEEK_END) != 0)
+        return false;
+    const vsi_l_offset nFileSize = VSIFTellL(m_fp);
+    if (VSIFSeekL(m_fp, 0, SEEK_SET) != 0)
+        return false;
+
+    GByte abyMagic[4] = {};
+    if (VSIFReadL(abyMagic, sizeof(abyMagic), 1, m_fp) != 1 ||
+        memcmp(abyMagic, "CDF", 3) != 0)
+        return false;
+    const int nVersion = abyMagic[3];
+    if (nVersion != 1 && nVersion != 2 && nVersion != 5)
+        return false;
+    // CDF-5 uses 64-bit counts, and CDF-2 and CDF-5 64-bit offsets.
+    const bool b64BitCounts = nVersion == 5;
+    const bool b64BitOffsets = nVersion != 1;
+
+    bool bError = false;
+    const auto ReadUInt32 = [this, &bError]()
+    {
+        uint32_t nVal = 0;
+        if (VSIFReadL(&nVal, sizeof(nVal), 1, m_fp) != 1)
+            bError = true;
+        CPL_MSBPTR32(&nVal);
+        return nVal;
+    };
+    const auto ReadUInt64 = [this, &bError]()
+    {
+        uint64_t nVal = 0;
+        if (VSIFReadL(&nVal, sizeof(nVal), 1, m_fp) != 1)
+            bError = true;
+        CPL_MSBPTR64(&nVal);
+        return nVal;
+    };
+    const auto ReadNonNeg = [&]() -> uint64_t
+    { return b64BitCounts ? ReadUInt64() : ReadUInt32(); };
+    const auto RoundUp4 = [](uint64_t n) { return (n + 3) / 4 * 4; };
+    const auto Skip = [this, nFileSize](uint64_t nBytes)
+    {
+        const vsi_l_offset nPos = VSIFTellL(m_fp);
+        return nBytes <= nFileSize - nPos &&
+               VSIFSeekL(m_fp, nPos + nBytes, SEEK_SET) == 0;
+    };
+    const auto SkipName = [&]()
+    {
+        const uint64_t nLen = ReadNonNeg();
+        return !bError && nLen <= NC_MAX_NAME && Skip(RoundUp4(nLen));
+    };
+    const auto ReadListHeader = [&](uint32_t nExpectedTag, uint64_t &nCount)
+    {
+        const uint32_t nTag = ReadUInt32();
+        nCount = ReadNonNeg();
+        if (bError || nCount > nFileSize)
+            return false;
+        // ABSENT lists are made of two zeros.
+        return nTag == nExpectedTag || (nTag == 0 && nCount == 0);
+    };
+    const auto SkipAttList = [&]()
+    {
+        uint64_t nAtts = 0;
+        if (!ReadListHeader(NC_ATTRIBUTE_TAG, nAtts))
+            return false;
+        for (uint64_t i = 0; i < nAtts; ++i)
+        {
+            if (!SkipName())
+                return false;
+            const int nEltSize = GetEltSize(static_cast<nc_type>(ReadUInt32()));
+            const uint64_t nElts = ReadNonNeg();
+            if (bError || nEltSize == 0 || nElts > nFileSize / nEltSize ||
+                !Skip(RoundUp4(nElts * nEltSize)))
+                return false;
+        }
+        return true;
+    };
+
+    const uint64_t nNumRecs = ReadNonNeg();
+    // Files being written in streaming mode have no valid record count.
+    if (bError || nNumRecs == (b64BitCounts ? ~static_cast<uint64_t>(0)
+                                            : 0xFFFFFFFFU) ||
+        nNumRecs > std::numeric_limits<size_t>::max())
+        return false;
+    m_nNumRecs = static_cast<size_t>(nNumRecs);
+
+    // Dimensions
+    uint64_t nDims = 0;
+    if (!ReadListHeader(NC_DIMENSION_TAG, nDims))
+        return false;
+    std::vector<size_t> anDimLen;
+    int nRecDimId = -1;
+    for (uint64_t i = 0; i < nDims; ++i)
+    {
+        if (!SkipName())
+            return false;
+        const uint64_t nLen = ReadNonNeg();
+        if (bError || nLen > std::numeric_limits<size_t>::max())
+            return false;
+        if (nLen == 0)
+        {
+            // Only one unlimited dimension is allowed.
+            if (nRecDimId >= 0)
+                return false;
+            nRecDimId = static_cast<int>(i);
+        }
+        anDimLen.push_back(static_cast<size_t>(nLen));
+    }
+
+    // Global attributes
+    if (!SkipAttList())
+        return false;
+
+    // Variables
+    uint64_t nVars = 0;
+    if (!ReadListHeader(NC_VARIABLE_TAG, nVars))
+        return false;
+    for (uint64_t i = 0; i < nVars; ++i)
+    {
+        Var oVar;
+        if (!SkipName())
+            return false;
+        const uint64_t nVarDims = ReadNonNeg();
+        if (bError || nVarDims > NC_MAX_VAR_DIMS)
+            return false;
+        for (uint64_t j = 0; j < nVarDims; ++j)
+        {
+            const uint64_t nDimId = ReadNonNeg();
+            if (bError || nDimId >= anDimLen.size())
+                return false;
+            if (static_cast<int>(nDimId) == nRecDimId)
+            {
+                // The unlimited dimension must be the slowest varying one.
+                if (j != 0)
+                    return false;
+                oVar.bIsRecord = true;
+            }
+            oVar.anDimLen.push_back(anDimLen[static_cast<size_t>(nDimId)]);
+        }
+        if (!SkipAttList())
+            return false;
+        oVar.eType = static_cast<nc_type>(ReadUInt32());
+        oVar.nEltSize = GetEltSize(oVar.eType);
+        // vsize is not reliable for large variables: recomputed below.
+        CPL_IGNORE_RET_VAL(ReadNonNeg());
+        oVar.nBegin = b64BitOffsets ? ReadUInt64() : ReadUInt32();
+        if (bError || oVar.nEltSize == 0)
+            return false;
+        m_asVars.push_back(std::move(oVar));
+    }
+
+    // Compute the size of a record, which interleaves the data of all
+    // record variables.
+    uint64_t nFirstRecVarSize = 0;
+    uint64_t nFirstRecVarLen = 0;
+    bool bHasRecVar = false;
+    for (const auto &oVar : m_asVars)
+    {
+        if (!oVar.bIsRecord)
+            continue;
+        uint64_t nSize = oVar.nEltSize;
+        for (size_t j = 1; j < oVar.anDimLen.size(); ++j)
+        {
+            if (oVar.anDimLen[j] != 0 &&
+                nSize > nFileSize / oVar.anDimLen[j])
+                return false;
+            nSize *= oVar.anDimLen[j];
+        }
+        if (!bHasRecVar)
+        {
+            bHasRecVar = true;
+            nFirstRecVarSize = nSize;
+            nFirstRecVarLen = RoundUp4(nSize);
+        }
+        m_nRecSize += RoundUp4(nSize);
+    }
+    // As in libnetcdf, the data of a single record variable is not padded.
+    if (bHasRecVar && m_nRecSize == nFirstRecVarLen)
+        m_nRecSize = nFirstRecVarSize;
+
+    return true;
+}
+
+/************************************************************************/
+/*                              ReadVara()                              */
+/************************************************************************/
+
+/** Read the hyperslab of a variable defined by panStart and panCount, with
+ * the semantics of nc_get_vara() when the memory type is the type of the
+ * variable.
+ *
+ * @return NC_NOERR in case of success, or a netCDF error code.
+ */
+int netCDFClassicReader::ReadVara(int nVarId, const size_t *panStart,
+                                  const size_t *panCount, void *pBuffer)
+{
+    if (nVarId < 0 || nVarId >= GetVarCount())
+        return NC_ENOTVAR;
+    const Var &oVar = m_asVars[nVarId];
+    const int nDims = static_cast<int>(oVar.anDimLen.size());
+    const int nFirstDim = oVar.bIsRecord ? 1 : 0;
+
+    size_t nTotal = 1;
+    for (int i = 0; i < nDims; ++i)
+    {
+        const size_t nLen = i < nFirstDim ? m_nNumRecs : oVar.anDimLen[i];
+        if (panStart[i] > nLen)
+            return NC_EINVALCOORDS;
+        if (panCount[i] > nLen - panStart[i])
+            return NC_EEDGE;
+        nTotal *= panCount[i];
+    }
+    if (nTotal == 0)
+        return NC_NOERR;
+
+    // Strides, in number of elements, of the dimensions within a variable
+    // or a record.
+    std::vector<vsi_l_offset> anStride(nDims);
+    vsi_l_offset nStride = 1;
+    for (int i = nDims - 1; i >= nFirstDim; --i)
+    {
+        anStride[i] = nStride;
+        nStride *= oVar.anDimLen[i];
+    }
+
+    // Dimensions iInner and following ones are read by contiguous runs.
+    int iInner = nDims;
+    size_t nRun = 1;
+    while (iInner > nFirstDim)
+    {
+        --iInner;
+        nRun *= panCount[iInner];
+        if (panStart[iInner] != 0 || panCount[iInner] != oVar.anDimLen[iInner])
+            break;
+    }
+    const size_t nRunBytes = nRun * oVar.nEltSize;
+
+    std::vector<size_t> anIdx(panStart, panStart + iInner);
+    GByte *pabyDst = static_cast<GByte *>(pBuffer);
+    while (true)
+    {
+        vsi_l_offset nOffset = oVar.nBegin;
+        for (int i = 0; i < nDims; ++i)
+        {
+            const size_t nIdx = i < iInner ? anIdx[i] : panStart[i];
+            if (i < nFirstDim)
+                nOffset += nIdx * m_nRecSize;
+            else
+                nOffset += nIdx * anStride[i] * oVar.nEltSize;
+        }
+        if (VSIFSeekL(m_fp, nOffset, SEEK_SET) != 0)
+            return NC_EIO;
+        const size_t nRead = VSIFReadL(pabyDst, 1, nRunBytes, m_fp);
+        // Like libnetcdf, return zeros for data beyond the end of file,
+        // which may happen on files created without pre-filling.
+        if (nRead < nRunBytes)
+            memset(pabyDst + nRead, 0, nRunBytes - nRead);
+        pabyDst += nRunBytes;
+
+        int i = iInner - 1;
+        for (; i >= 0; --i)
+        {
+            if (++anIdx[i] < panStart[i] + panCount[i])
+                break;
+            anIdx[i] = panStart[i];
+        }
+        if (i < 0)
+            break;
+    }
+
+#if CPL_IS_LSB
+    if (oVar.nEltSize > 1)
+        GDALSwapWordsEx(pBuffer, oVar.nEltSize, nTotal, oVar.nEltSize);
+#endif
+
+    return NC_NOERR;
+}
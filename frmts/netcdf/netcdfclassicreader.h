@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reader of variables of netCDF classic format files
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef NETCDFCLASSICREADER_H_INCLUDED
+#define NETCDFCLASSICREADER_H_INCLUDED
+
+#include "cpl_vsi.h"
+#include "netcdf.h"
+
+#include <memory>
+#include <vector>
+
+/************************************************************************/
+/*                        netCDFClassicReader                           */
+/************************************************************************/
+
+/** Reader of the variables of a netCDF classic (CDF-1), 64-bit offset
+ * (CDF-2) or 64-bit data (CDF-5) file that does not go through libnetcdf.
+ *
+ * libnetcdf is not thread-safe, and all its calls must be serialized through
+ * the driver global mutex. Data of classic files is stored uncompressed at
+ * offsets that can be computed from the header, so this reader only needs
+ * its own file handle and can be used without holding that mutex.
+ */
+class netCDFClassicReader
+{
+  public:
+    ~netCDFClassicReader();
+
+    static std::unique_ptr<netCDFClassicReader> Open(const char *pszFilename);
+
+    int GetVarCount() const
+    {
+        return static_cast<int>(m_asVars.size());
+    }
+
+    nc_type GetVarType(int nVarId) const
+    {
+        return m_asVars[nVarId].eType;
+    }
+
+    int GetVarDimCount(int nVarId) const
+    {
+        return static_cast<int>(m_asVars[nVarId].anDimLen.size());
+    }
+
+    int ReadVara(int nVarId, const size_t *panStart, const size_t *panCount,
+                 void *pBuffer);
+
+  private:
+    struct Var
+    {
+        nc_type eType = NC_NAT;
+        int nEltSize = 0;
+        bool bIsRecord = false;
+        // Length of each dimension. For record variables, the first one
+        // is ignored and the number of records is used instead.
+        std::vector<size_t> anDimLen{};
+        vsi_l_offset nBegin = 0;
+    };
+
+    VSILFILE *m_fp = nullptr;
+    size_t m_nNumRecs = 0;
+    vsi_l_offset m_nRecSize = 0;
+    std::vector<Var> m_asVars{};
+
+    netCDFClassicReader() = default;
+    netCDFClassicReader(const netCDFClassicReader &) = delete;
+    netCDFClassicReader &operator=(const netCDFClassicReader &) = delete;
+
+    bool ParseHeader();
+};
+
+#endif  // NETCDFCLASSICREADER_H_INCLUDED
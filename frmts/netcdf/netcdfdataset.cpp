@@ -225,6 +225,7 @@ class netCDFRasterBand final : public GDALPamRasterBand
                       size_t nTmpBlockYSize, bool bCheckIsNan = false);
     void SetBlockSize();
 
+    bool CanUseClassicReader() const;
     bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
 
     void SetNoDataValueNoUpdate(double dfNoData);
@@ -2268,6 +2269,49 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
     }
 }
 
+/************************************************************************/
+/*                        CanUseClassicReader()                         */
+/************************************************************************/
+
+// Returns whether the variable can be read with the direct classic format
+// reader, that is whether libnetcdf would read it without type conversion.
+bool netCDFRasterBand::CanUseClassicReader() const
+{
+    const auto poGDS = static_cast<const netCDFDataset *>(poDS);
+    const auto poReader = poGDS->m_poClassicReader.get();
+    if (!poReader || cdfid != poGDS->cdfid || nZId < 0 ||
+        nZId >= poReader->GetVarCount() ||
+        poReader->GetVarType(nZId) != nc_datatype)
+        return false;
+
+    switch (nc_datatype)
+    {
+        case NC_BYTE:
+            return eDataType == GDT_Byte || eDataType == GDT_Int8;
+        case NC_UBYTE:
+            return eDataType == GDT_Byte;
+        case NC_SHORT:
+            return eDataType == GDT_Int16 || eDataType == GDT_UInt16;
+        case NC_USHORT:
+            return eDataType == GDT_UInt16;
+        case NC_INT:
+            return eDataType == GDT_Int32;
+        case NC_UINT:
+            return eDataType == GDT_UInt32;
+        case NC_INT64:
+            return eDataType == GDT_Int64;
+        case NC_UINT64:
+            return eDataType == GDT_UInt64;
+        case NC_FLOAT:
+            return eDataType == GDT_Float32;
+        case NC_DOUBLE:
+            return eDataType == GDT_Float64;
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                         FetchNetcdfChunk()                           */
 /************************************************************************/
@@ -2297,8 +2341,14 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
              edge[nBandXPos], nYChunkSize, ((netCDFDataset *)poDS)->bBottomUp);
 #endif
 
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+    const bool bClassicRead = CanUseClassicReader();
+
     int nd = 0;
-    nc_inq_varndims(cdfid, nZId, &nd);
+    if (bClassicRead)
+        nd = poGDS->m_poClassicReader->GetVarDimCount(nZId);
+    else
+        nc_inq_varndims(cdfid, nZId, &nd);
     if (nd == 3)
     {
         start[panBandZPos[0]] = nLevel;  // z
@@ -2339,7 +2389,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
 
     // Make sure we are in data mode.
-    static_cast<netCDFDataset *>(poDS)->SetDefineMode(false);
+    poGDS->SetDefineMode(false);
 
     // If this block is not a full block in the x axis, we need to
     // re-arrange the data because partial blocks are not arranged the
@@ -2354,22 +2404,33 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
                     GDALGetDataTypeSizeBytes(eDataType));
     }
 
+    // Read through the direct classic format reader when possible, and
+    // through libnetcdf otherwise.
+    const auto GetVara = [this, poGDS, bClassicRead, &start, &edge,
+                          pImageNC](auto pfnGetVara, auto *pTypedImageNC)
+    {
+        if (bClassicRead)
+            return poGDS->m_poClassicReader->ReadVara(nZId, start, edge,
+                                                      pImageNC);
+        return pfnGetVara(cdfid, nZId, start, edge, pTypedImageNC);
+    };
+
     // Read data according to type.
     int status;
     if (eDataType == GDT_Byte)
     {
         if (bSignedData)
         {
-            status = nc_get_vara_schar(cdfid, nZId, start, edge,
-                                       static_cast<signed char *>(pImageNC));
+            status = GetVara(nc_get_vara_schar,
+                             static_cast<signed char *>(pImageNC));
             if (status == NC_NOERR)
                 CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
                                        nYChunkSize, false);
         }
         else
         {
-            status = nc_get_vara_uchar(cdfid, nZId, start, edge,
-                                       static_cast<unsigned char *>(pImageNC));
+            status = GetVara(nc_get_vara_uchar,
+                             static_cast<unsigned char *>(pImageNC));
             if (status == NC_NOERR)
                 CheckData<unsigned char>(pImage, pImageNC, edge[nBandXPos],
                                          nYChunkSize, false);
@@ -2377,16 +2438,15 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Int8)
     {
-        status = nc_get_vara_schar(cdfid, nZId, start, edge,
-                                   static_cast<signed char *>(pImageNC));
+        status = GetVara(nc_get_vara_schar,
+                         static_cast<signed char *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
                                    nYChunkSize, false);
     }
     else if (nc_datatype == NC_SHORT)
     {
-        status = nc_get_vara_short(cdfid, nZId, start, edge,
-                                   static_cast<short *>(pImageNC));
+        status = GetVara(nc_get_vara_short, static_cast<short *>(pImageNC));
         if (status == NC_NOERR)
         {
             if (eDataType == GDT_Int16)
@@ -2404,14 +2464,12 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     else if (eDataType == GDT_Int32)
     {
 #if SIZEOF_UNSIGNED_LONG == 4
-        status = nc_get_vara_long(cdfid, nZId, start, edge,
-                                  static_cast<long *>(pImageNC));
+        status = GetVara(nc_get_vara_long, static_cast<long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<long>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                             false);
 #else
-        status = nc_get_vara_int(cdfid, nZId, start, edge,
-                                 static_cast<int *>(pImageNC));
+        status = GetVara(nc_get_vara_int, static_cast<int *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                            false);
@@ -2419,77 +2477,74 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Float32)
     {
-        status = nc_get_vara_float(cdfid, nZId, start, edge,
-                                   static_cast<float *>(pImageNC));
+        status = GetVara(nc_get_vara_float, static_cast<float *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                              true);
     }
     else if (eDataType == GDT_Float64)
     {
-        status = nc_get_vara_double(cdfid, nZId, start, edge,
-                                    static_cast<double *>(pImageNC));
+        status = GetVara(nc_get_vara_double, static_cast<double *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                               true);
     }
     else if (eDataType == GDT_UInt16)
     {
-        status = nc_get_vara_ushort(cdfid, nZId, start, edge,
-                                    static_cast<unsigned short *>(pImageNC));
+        status = GetVara(nc_get_vara_ushort,
+                         static_cast<unsigned short *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos],
                                       nYChunkSize, false);
     }
     else if (eDataType == GDT_UInt32)
     {
-        status = nc_get_vara_uint(cdfid, nZId, start, edge,
-                                  static_cast<unsigned int *>(pImageNC));
+        status = GetVara(nc_get_vara_uint,
+                         static_cast<unsigned int *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos],
                                     nYChunkSize, false);
     }
     else if (eDataType == GDT_Int64)
     {
-        status = nc_get_vara_longlong(cdfid, nZId, start, edge,
-                                      static_cast<long long *>(pImageNC));
+        status = GetVara(nc_get_vara_longlong,
+                         static_cast<long long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos],
                                     nYChunkSize, false);
     }
     else if (eDataType == GDT_UInt64)
     {
-        status =
-            nc_get_vara_ulonglong(cdfid, nZId, start, edge,
-                                  static_cast<unsigned long long *>(pImageNC));
+        status = GetVara(nc_get_vara_ulonglong,
+                         static_cast<unsigned long long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos],
                                      nYChunkSize, false);
     }
     else if (eDataType == GDT_CInt16)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = GetVara(nc_get_vara, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                 false);
     }
     else if (eDataType == GDT_CInt32)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = GetVara(nc_get_vara, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                               false);
     }
     else if (eDataType == GDT_CFloat32)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = GetVara(nc_get_vara, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                 false);
     }
     else if (eDataType == GDT_CFloat64)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = GetVara(nc_get_vara, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                  false);
@@ -2516,7 +2571,12 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    // The direct classic format reader does not use libnetcdf, which is not
+    // thread-safe, so parallel reads of different files do not need to be
+    // serialized in that case.
+    std::unique_ptr<CPLMutexHolder> poMutexHolder;
+    if (!CanUseClassicReader())
+        poMutexHolder = std::make_unique<CPLMutexHolder>(&hNCMutex);
 
     // Locate X, Y and Z position in the array.
 
@@ -8361,6 +8421,19 @@ GDALDataset *netCDFDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
+    // Raster data of classic format files opened in read-only mode is read
+    // with netCDFClassicReader, which does not need to hold hNCMutex.
+    if (poOpenInfo->eAccess == GA_ReadOnly && status == NC_NOERR &&
+        nTmpFormat != NC_FORMAT_NETCDF4 &&
+        nTmpFormat != NC_FORMAT_NETCDF4_CLASSIC &&
+        !STARTS_WITH(poDS->osFilename, "http://") &&
+        !STARTS_WITH(poDS->osFilename, "https://") &&
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_NETCDF_CLASSIC_DIRECT_READ", "YES")))
+    {
+        poDS->m_poClassicReader = netCDFClassicReader::Open(poDS->osFilename);
+    }
+
     // Does the request variable exist?
     if (bTreatAsSubdataset)
     {
@@ -29,6 +29,7 @@
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "netcdf.h"
+#include "netcdfclassicreader.h"
 #include "netcdfformatenum.h"
 #include "netcdfsg.h"
 #include "netcdfsgwriterutil.h"
@@ -360,6 +361,9 @@ class netCDFDataset final : public GDALPamDataset
     cpl_uffd_context *pCtx = nullptr;
 #endif
     VSILFILE *fpVSIMEM = nullptr;
+    // Set on read-only classic format files, to read raster data without
+    // going through libnetcdf.
+    std::unique_ptr<netCDFClassicReader> m_poClassicReader{};
     int nSubDatasets;
     char **papszSubDatasets;
     char **papszMetadata;
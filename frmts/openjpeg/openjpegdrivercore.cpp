@@ -69,6 +69,8 @@ void OPENJPEGDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC,
                               "drivers/raster/jp2openjpeg.html");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/jp2");
+    // Codestream (SOC + SIZ markers) or JP2 signature box
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES, "FF4FFF51 4:6A502020");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "jp2");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "jp2 j2k");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES,
@@ -14,11 +14,15 @@
  ****************************************************************************/
 
 #include <cassert>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "cpl_atomic_ops.h"
+#include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
 #include "gdal_frmts.h"
 #include "gdaljp2abstractdataset.h"
@@ -180,6 +184,7 @@ template <typename CODEC, typename BASE> struct JP2JobStruct
     int nBandCount = 0;
     const int *panBandMap = nullptr;
     volatile bool bSuccess = false;
+    std::shared_ptr<const std::vector<JP2PrefetchedRange>> poPrefetched{};
 };
 
 /************************************************************************/
@@ -192,6 +197,378 @@ VSILFILE *JP2OPJLikeDataset<CODEC, BASE>::GetFileHandle()
     return this->fp_;
 }
 
+/************************************************************************/
+/*                       JP2BuildTilePartIndex()                        */
+/************************************************************************/
+
+/* Locate the tile-parts of each tile of the codestream, from the TLM marker */
+/* segments of the main header when present, or otherwise by walking through */
+/* the SOT marker segments. */
+static std::shared_ptr<const JP2TilePartIndex>
+JP2BuildTilePartIndex(VSILFILE *fp, vsi_l_offset nStart, vsi_l_offset nLength,
+                      int nTiles)
+{
+    const vsi_l_offset nEnd = nStart + nLength;
+    GByte abyMarker[4] = {0, 0, 0, 0};
+    if (VSIFSeekL(fp, nStart, SEEK_SET) != 0 ||
+        VSIFReadL(abyMarker, 2, 1, fp) != 1 || abyMarker[0] != 0xFF ||
+        abyMarker[1] != 0x4F /* SOC */)
+        return nullptr;
+
+    // Pairs of (tile index, tile-part length) from TLM marker segments
+    std::vector<std::pair<int, GUInt32>> aoTLM;
+    vsi_l_offset nPos = nStart + 2;
+    while (true)
+    {
+        if (nPos + 4 > nEnd || VSIFSeekL(fp, nPos, SEEK_SET) != 0 ||
+            VSIFReadL(abyMarker, 4, 1, fp) != 1 || abyMarker[0] != 0xFF)
+            return nullptr;
+        if (abyMarker[1] == 0x90 /* SOT */)
+            break;
+        const int nSegLength = (abyMarker[2] << 8) | abyMarker[3];
+        if (nSegLength < 2)
+            return nullptr;
+        if (abyMarker[1] == 0x55 /* TLM */ && nSegLength > 4)
+        {
+            std::vector<GByte> abySeg(nSegLength - 2);
+            if (VSIFReadL(abySeg.data(), abySeg.size(), 1, fp) != 1)
+                return nullptr;
+            const int nST = (abySeg[1] >> 4) & 3;
+            const int nSP = (abySeg[1] & 0x40) ? 4 : 2;
+            if (nST == 3)
+                return nullptr;
+            const size_t nEntrySize = nST + nSP;
+            for (size_t i = 2; i + nEntrySize <= abySeg.size();
+                 i += nEntrySize)
+            {
+                // Without tile index, there is one tile-part per tile
+                int nTile = static_cast<int>(aoTLM.size());
+                if (nST == 1)
+                    nTile = abySeg[i];
+                else if (nST == 2)
+                    nTile = (abySeg[i] << 8) | abySeg[i + 1];
+                GUInt32 nTPLength = 0;
+                for (int j = 0; j < nSP; ++j)
+                    nTPLength = (nTPLength << 8) | abySeg[i + nST + j];
+                aoTLM.emplace_back(nTile, nTPLength);
+            }
+        }
+        nPos += 2 + nSegLength;
+    }
+
+    auto poIndex = std::make_shared<JP2TilePartIndex>();
+    poIndex->nMainHeaderSize = nPos - nStart;
+    poIndex->aoTileParts.resize(nTiles);
+    const auto AddTilePart = [&poIndex, nTiles, nEnd, &nPos](int nTile,
+                                                           vsi_l_offset nSize)
+    {
+        // 14 is the size of the SOT marker segment and of the SOD marker
+        if (nTile >= nTiles || nSize < 14 || nSize > nEnd - nPos)
+            return false;
+        poIndex->aoTileParts[nTile].emplace_back(nPos, nSize);
+        nPos += nSize;
+        return true;
+    };
+
+    if (!aoTLM.empty())
+    {
+        for (const auto &[nTile, nTPLength] : aoTLM)
+        {
+            if (!AddTilePart(nTile, nTPLength))
+                return nullptr;
+        }
+        return poIndex;
+    }
+
+    // This is what OpenJPEG does anyway to find a tile in the absence of TLM
+    size_t nTileParts = 0;
+    while (nPos + 12 <= nEnd)
+    {
+        GByte abySOT[12];
+        if (VSIFSeekL(fp, nPos, SEEK_SET) != 0 ||
+            VSIFReadL(abySOT, sizeof(abySOT), 1, fp) != 1)
+            return nullptr;
+        if (abySOT[0] == 0xFF && abySOT[1] == 0xD9 /* EOC */)
+            break;
+        if (abySOT[0] != 0xFF || abySOT[1] != 0x90 /* SOT */ ||
+            ++nTileParts > static_cast<size_t>(nTiles) * 255)
+            return nullptr;
+        const int nTile = (abySOT[4] << 8) | abySOT[5];
+        vsi_l_offset nTPLength = (static_cast<GUInt32>(abySOT[6]) << 24) |
+                                 (abySOT[7] << 16) | (abySOT[8] << 8) |
+                                 abySOT[9];
+        // A zero length means that the tile-part extends to the EOC marker
+        if (nTPLength == 0)
+            nTPLength = nEnd - nPos;
+        if (!AddTilePart(nTile, nTPLength))
+            return nullptr;
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                        JP2GetTilePartIndex()                         */
+/************************************************************************/
+
+/* Tile-part indices are shared by all the datasets opened on the same file, */
+/* so that re-opening a remote file does not require scanning it again. */
+static std::shared_ptr<const JP2TilePartIndex>
+JP2GetTilePartIndex(VSILFILE *fp, const std::string &osFilename,
+                    vsi_l_offset nStart, vsi_l_offset nLength, int nTiles)
+{
+    static std::mutex oMutex;
+    static lru11::Cache<std::string, std::shared_ptr<const JP2TilePartIndex>>
+        oCache;
+
+    const std::string osKey = CPLSPrintf(
+        "%s:" CPL_FRMT_GUIB ":" CPL_FRMT_GUIB ":%d", osFilename.c_str(),
+        static_cast<GUIntBig>(nStart), static_cast<GUIntBig>(nLength), nTiles);
+    std::shared_ptr<const JP2TilePartIndex> poIndex;
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (oCache.tryGet(osKey, poIndex))
+            return poIndex;
+    }
+
+    const auto nCurPos = VSIFTellL(fp);
+    poIndex = JP2BuildTilePartIndex(fp, nStart, nLength, nTiles);
+    VSIFSeekL(fp, nCurPos, SEEK_SET);
+
+    std::lock_guard<std::mutex> oLock(oMutex);
+    oCache.insert(osKey, poIndex);
+    return poIndex;
+}
+
+/************************************************************************/
+/*                       JP2PrefetchedFileHandle                        */
+/************************************************************************/
+
+/* File handle serving reads from ranges fetched in advance, and falling */
+/* back to the underlying file for the rest. As the ranges are read from the */
+/* file itself, a stale tile-part index only affects performance. */
+class JP2PrefetchedFileHandle final : public VSIVirtualHandle
+{
+    VSIVirtualHandleUniquePtr m_poBase;
+    std::shared_ptr<const std::vector<JP2PrefetchedRange>> m_poRanges;
+    vsi_l_offset m_nOffset = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(JP2PrefetchedFileHandle)
+
+  public:
+    JP2PrefetchedFileHandle(
+        VSILFILE *fp,
+        std::shared_ptr<const std::vector<JP2PrefetchedRange>> poRanges)
+        : m_poBase(fp), m_poRanges(std::move(poRanges))
+    {
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override
+    {
+        m_bEOF = false;
+        if (nWhence == SEEK_SET)
+            m_nOffset = nOffset;
+        else if (nWhence == SEEK_CUR)
+            m_nOffset += nOffset;
+        else
+        {
+            if (m_poBase->Seek(nOffset, nWhence) != 0)
+                return -1;
+            m_nOffset = m_poBase->Tell();
+        }
+        return 0;
+    }
+
+    vsi_l_offset Tell() override
+    {
+        return m_nOffset;
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override
+    {
+        if (nSize == 0)
+            return 0;
+        GByte *pabyDst = static_cast<GByte *>(pBuffer);
+        const size_t nTotal = nSize * nCount;
+        size_t nRemaining = nTotal;
+        const auto &aoRanges = *m_poRanges;
+        while (nRemaining > 0)
+        {
+            auto oIter = std::upper_bound(
+                aoRanges.begin(), aoRanges.end(), m_nOffset,
+                [](vsi_l_offset nOffset, const JP2PrefetchedRange &oRange)
+                { return nOffset < oRange.nOffset; });
+            if (oIter == aoRanges.begin())
+                break;
+            --oIter;
+            const vsi_l_offset nEndOfRange =
+                oIter->nOffset + oIter->abyData.size();
+            if (m_nOffset >= nEndOfRange)
+                break;
+            const size_t nToCopy = static_cast<size_t>(std::min<vsi_l_offset>(
+                nRemaining, nEndOfRange - m_nOffset));
+            memcpy(pabyDst,
+                   oIter->abyData.data() + (m_nOffset - oIter->nOffset),
+                   nToCopy);
+            pabyDst += nToCopy;
+            m_nOffset += nToCopy;
+            nRemaining -= nToCopy;
+        }
+        if (nRemaining > 0)
+        {
+            size_t nRead = 0;
+            if (m_poBase->Seek(m_nOffset, SEEK_SET) == 0)
+                nRead = m_poBase->Read(pabyDst, 1, nRemaining);
+            m_nOffset += nRead;
+            nRemaining -= nRead;
+            if (nRemaining > 0)
+            {
+                m_bEOF = m_poBase->Eof() != 0;
+                m_bError = m_poBase->Error() != 0;
+            }
+        }
+        return (nTotal - nRemaining) / nSize;
+    }
+
+    size_t Write(const void *, size_t, size_t) override
+    {
+        return 0;
+    }
+
+    void ClearErr() override
+    {
+        m_poBase->ClearErr();
+        m_bEOF = false;
+        m_bError = false;
+    }
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Error() override
+    {
+        return m_bError;
+    }
+
+    int Close() override
+    {
+        m_poBase.reset();
+        return 0;
+    }
+};
+
+/************************************************************************/
+/*                         GetTilePartIndex()                           */
+/************************************************************************/
+
+template <typename CODEC, typename BASE>
+const JP2TilePartIndex *JP2OPJLikeDataset<CODEC, BASE>::GetTilePartIndex()
+{
+    if (!m_bTilePartIndexTried)
+    {
+        m_bTilePartIndexTried = true;
+        auto poBand = cpl::down_cast<JP2OPJLikeRasterBand<CODEC, BASE> *>(
+            GetRasterBand(1));
+        m_poTilePartIndex = JP2GetTilePartIndex(
+            this->fp_, this->m_osFilename, this->nCodeStreamStart,
+            this->nCodeStreamLength,
+            poBand->nBlocksPerRow * poBand->nBlocksPerColumn);
+    }
+    return m_poTilePartIndex.get();
+}
+
+/************************************************************************/
+/*                         PrefetchTileParts()                          */
+/************************************************************************/
+
+/* Read the main header and the tile-parts of the specified tiles with a */
+/* single multi-range request. */
+template <typename CODEC, typename BASE>
+std::shared_ptr<const std::vector<JP2PrefetchedRange>>
+JP2OPJLikeDataset<CODEC, BASE>::PrefetchTileParts(
+    const std::vector<std::pair<int, int>> &aoBlocks, int nBlocksPerRow)
+{
+    const JP2TilePartIndex *poIndex = GetTilePartIndex();
+    if (!poIndex)
+        return nullptr;
+
+    std::vector<std::pair<vsi_l_offset, vsi_l_offset>> aoRanges;
+    aoRanges.emplace_back(this->nCodeStreamStart, poIndex->nMainHeaderSize);
+    vsi_l_offset nTotalSize = poIndex->nMainHeaderSize;
+    for (const auto &oBlock : aoBlocks)
+    {
+        const size_t nTile =
+            static_cast<size_t>(oBlock.first + oBlock.second * nBlocksPerRow);
+        if (nTile >= poIndex->aoTileParts.size())
+            return nullptr;
+        for (const auto &oTilePart : poIndex->aoTileParts[nTile])
+        {
+            aoRanges.push_back(oTilePart);
+            nTotalSize += oTilePart.second;
+        }
+    }
+    if (nTotalSize >
+        std::min<GUIntBig>(GDALGetCacheMax64() / 4, static_cast<size_t>(-1)))
+        return nullptr;
+
+    // Coalesce contiguous ranges
+    std::sort(aoRanges.begin(), aoRanges.end());
+    auto poPrefetched = std::make_shared<std::vector<JP2PrefetchedRange>>();
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    try
+    {
+        for (const auto &oRange : aoRanges)
+        {
+            if (!poPrefetched->empty() &&
+                oRange.first <= poPrefetched->back().nOffset +
+                                    poPrefetched->back().abyData.size())
+            {
+                auto &oLast = poPrefetched->back();
+                const vsi_l_offset nEnd = std::max<vsi_l_offset>(
+                    oLast.nOffset + oLast.abyData.size(),
+                    oRange.first + oRange.second);
+                oLast.abyData.resize(
+                    static_cast<size_t>(nEnd - oLast.nOffset));
+            }
+            else
+            {
+                JP2PrefetchedRange oNewRange;
+                oNewRange.nOffset = oRange.first;
+                oNewRange.abyData.resize(static_cast<size_t>(oRange.second));
+                poPrefetched->push_back(std::move(oNewRange));
+            }
+        }
+        for (auto &oRange : *poPrefetched)
+        {
+            apData.push_back(oRange.abyData.data());
+            anOffsets.push_back(oRange.nOffset);
+            anSizes.push_back(oRange.abyData.size());
+        }
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+
+    CPLDebug(CODEC::debugId(),
+             "Prefetching " CPL_FRMT_GUIB " bytes in %d range(s)",
+             static_cast<GUIntBig>(nTotalSize),
+             static_cast<int>(apData.size()));
+    const auto nCurPos = VSIFTellL(this->fp_);
+    const int nRet =
+        VSIFReadMultiRangeL(static_cast<int>(apData.size()), apData.data(),
+                            anOffsets.data(), anSizes.data(), this->fp_);
+    VSIFSeekL(this->fp_, nCurPos, SEEK_SET);
+    if (nRet != 0)
+        return nullptr;
+    return poPrefetched;
+}
+
 /************************************************************************/
 /*                   ReadBlockInThread()                                */
 /************************************************************************/
@@ -216,6 +593,8 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
         // VSIFree(pDummy);
         return;
     }
+    if (poJob->poPrefetched)
+        fp = new JP2PrefetchedFileHandle(fp, poJob->poPrefetched);
 
     while ((nPair = CPLAtomicInc(&(poJob->nCurPair))) < nPairs &&
            poJob->bSuccess)
@@ -339,6 +718,8 @@ int JP2OPJLikeDataset<CODEC, BASE>::PreloadBlocks(
                 }
             }
             oJob.bSuccess = true;
+            oJob.poPrefetched =
+                PrefetchTileParts(oJob.oPairs, poBand->nBlocksPerRow);
 
             /* Flushes all dirty blocks from cache to disk to avoid them */
             /* to be flushed randomly, and simultaneously, from our worker
@@ -15,6 +15,10 @@
 
 #pragma once
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "cpl_atomic_ops.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
@@ -106,6 +110,22 @@ struct JP2DatasetBase
     virtual ~JP2DatasetBase();
 };
 
+/* Location of the tile-parts of a codestream */
+struct JP2TilePartIndex
+{
+    /* Size of the main header, from the SOC marker to the first SOT marker */
+    vsi_l_offset nMainHeaderSize = 0;
+    /* Absolute offset and size of the tile-parts of each tile */
+    std::vector<std::vector<std::pair<vsi_l_offset, vsi_l_offset>>>
+        aoTileParts{};
+};
+
+struct JP2PrefetchedRange
+{
+    vsi_l_offset nOffset = 0;
+    std::vector<GByte> abyData{};
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                           JP2OPJLikeDataset                          */
@@ -118,6 +138,8 @@ class JP2OPJLikeDataset final : public GDALJP2AbstractDataset, public BASE
 {
     friend class JP2OPJLikeRasterBand<CODEC, BASE>;
     JP2OPJLikeDataset **papoOverviewDS = nullptr;
+    std::shared_ptr<const JP2TilePartIndex> m_poTilePartIndex{};
+    bool m_bTilePartIndexTried = false;
 
     JP2OPJLikeDataset(const JP2OPJLikeDataset &) = delete;
     JP2OPJLikeDataset &operator=(const JP2OPJLikeDataset &) = delete;
@@ -182,6 +204,12 @@ class JP2OPJLikeDataset final : public GDALJP2AbstractDataset, public BASE
                       const int *panBandMap);
 
     static void ReadBlockInThread(void *userdata);
+
+    const JP2TilePartIndex *GetTilePartIndex();
+
+    std::shared_ptr<const std::vector<JP2PrefetchedRange>>
+    PrefetchTileParts(const std::vector<std::pair<int, int>> &aoBlocks,
+                      int nBlocksPerRow);
 };
 
 /************************************************************************/
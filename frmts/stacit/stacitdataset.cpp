@@ -12,12 +12,15 @@
 
 #include "cpl_json.h"
 #include "cpl_http.h"
+#include "cpl_mem_cache.h"
 #include "vrtdataset.h"
 #include "ogr_spatialref.h"
 
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace
@@ -423,6 +426,107 @@ static void ParseAsset(const CPLJSONObject &jAsset,
     assets.assets.emplace_back(std::move(item));
 }
 
+/************************************************************************/
+/*                           GetPageCache()                             */
+/************************************************************************/
+
+// Process-wide cache of the pages of STAC API searches, with the members
+// unused by the driver stripped, so that re-opening a search, typically to
+// open one of its subdatasets, does not fetch it again.
+static lru11::Cache<std::string, std::shared_ptr<const std::string>,
+                    std::mutex> &
+GetPageCache()
+{
+    static lru11::Cache<std::string, std::shared_ptr<const std::string>,
+                        std::mutex>
+        oCache(std::max(
+            1, atoi(CPLGetConfigOption("STACIT_CACHE_MAX_PAGES", "1000"))));
+    return oCache;
+}
+
+/************************************************************************/
+/*                       GetFollowingPageURLs()                         */
+/************************************************************************/
+
+// If osNextURL only differs from osCurURL by the value of an integer query
+// parameter (e.g. page=, offset= or startIndex=), return the URLs of the
+// nCount pages following osNextURL, assuming a constant increment.
+// This is only a guess: pages fetched from those URLs must only be used if
+// they match the next link of the page that precedes them.
+static std::vector<std::string>
+GetFollowingPageURLs(const std::string &osCurURL, const std::string &osNextURL,
+                     int nCount)
+{
+    std::vector<std::string> aosRet;
+    const auto nCurQueryPos = osCurURL.find('?');
+    const auto nNextQueryPos = osNextURL.find('?');
+    if (nCurQueryPos == std::string::npos ||
+        nNextQueryPos == std::string::npos ||
+        osCurURL.compare(0, nCurQueryPos, osNextURL, 0, nNextQueryPos) != 0)
+    {
+        return aosRet;
+    }
+
+    const CPLStringList aosCurParams(CSLTokenizeString2(
+        osCurURL.c_str() + nCurQueryPos + 1, "&", CSLT_ALLOWEMPTYTOKENS));
+    const CPLStringList aosNextParams(CSLTokenizeString2(
+        osNextURL.c_str() + nNextQueryPos + 1, "&", CSLT_ALLOWEMPTYTOKENS));
+    if (aosCurParams.size() != aosNextParams.size())
+        return aosRet;
+
+    int iParam = -1;
+    GIntBig nNextValue = 0;
+    GIntBig nIncrement = 0;
+    for (int i = 0; i < aosCurParams.size(); ++i)
+    {
+        if (strcmp(aosCurParams[i], aosNextParams[i]) == 0)
+            continue;
+        const char *pszCurEqual = strchr(aosCurParams[i], '=');
+        const char *pszNextEqual = strchr(aosNextParams[i], '=');
+        if (iParam >= 0 || !pszCurEqual || !pszNextEqual ||
+            pszCurEqual - aosCurParams[i] != pszNextEqual - aosNextParams[i] ||
+            !EQUALN(aosCurParams[i], aosNextParams[i],
+                    static_cast<int>(pszCurEqual - aosCurParams[i])) ||
+            CPLGetValueType(pszCurEqual + 1) != CPL_VALUE_INTEGER ||
+            CPLGetValueType(pszNextEqual + 1) != CPL_VALUE_INTEGER)
+        {
+            return aosRet;
+        }
+        iParam = i;
+        nNextValue = CPLAtoGIntBig(pszNextEqual + 1);
+        nIncrement = nNextValue - CPLAtoGIntBig(pszCurEqual + 1);
+        if (nIncrement <= 0)
+            return aosRet;
+    }
+    if (iParam < 0)
+        return aosRet;
+
+    const std::string osParamName(
+        aosNextParams[iParam],
+        strchr(aosNextParams[iParam], '=') - aosNextParams[iParam]);
+    for (int i = 1; i <= nCount; ++i)
+    {
+        std::string osURL(osNextURL, 0, nNextQueryPos + 1);
+        for (int j = 0; j < aosNextParams.size(); ++j)
+        {
+            if (j > 0)
+                osURL += '&';
+            if (j == iParam)
+            {
+                osURL += osParamName;
+                osURL += '=';
+                osURL += std::to_string(nNextValue + i * nIncrement);
+            }
+            else
+            {
+                osURL += aosNextParams[j];
+            }
+        }
+        aosRet.push_back(std::move(osURL));
+    }
+    return aosRet;
+}
+
 /************************************************************************/
 /*                           SetupDataset()                             */
 /************************************************************************/
@@ -792,6 +896,70 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
     CPLJSONObject oBody;
     bool bMerge = false;
     int nLoops = 0;
+    // Geometries and links of items are not used, and can make up most of
+    // the size of large search results.
+    const std::vector<std::string> aosSkippedMembers{"features/geometry",
+                                                     "features/links"};
+    const bool bUseCache =
+        atoi(CPLGetConfigOption("STACIT_CACHE_MAX_PAGES", "1000")) > 0;
+    const int nMaxConnections = std::max(
+        1, atoi(CSLFetchNameValueDef(
+               poOpenInfo->papszOpenOptions, "MAX_CONNECTIONS",
+               CPLGetConfigOption("GDAL_MAX_CONNECTIONS", "4"))));
+    // Pages fetched in advance, indexed by their request key
+    std::map<std::string, std::string> oMapPrefetchedPages;
+
+    const auto GetHTTPOptions =
+        [](const std::string &osRequestMethod,
+           const CPLJSONObject &oRequestHeaders,
+           const CPLJSONObject &oRequestBody, bool bRequestMerge)
+    {
+        // Cf https://github.com/radiantearth/stac-api-spec/tree/release/v1.0.0/item-search#pagination
+        CPLStringList aosOptions;
+        if (oRequestBody.IsValid() &&
+            oRequestBody.GetType() == CPLJSONObject::Type::Object)
+        {
+            if (bRequestMerge)
+                CPLDebug("STACIT", "Ignoring 'merge' attribute from next link");
+            const std::string osPostContent =
+                oRequestBody.Format(CPLJSONObject::PrettyFormat::Pretty);
+            aosOptions.SetNameValue("POSTFIELDS", osPostContent.c_str());
+        }
+        aosOptions.SetNameValue("CUSTOMREQUEST", osRequestMethod.c_str());
+        CPLString osHeaders;
+        if (!oRequestHeaders.IsValid() ||
+            oRequestHeaders.GetType() != CPLJSONObject::Type::Object ||
+            oRequestHeaders["Content-Type"].ToString().empty())
+        {
+            osHeaders = "Content-Type: application/json";
+        }
+        if (oRequestHeaders.IsValid() &&
+            oRequestHeaders.GetType() == CPLJSONObject::Type::Object)
+        {
+            for (const auto &obj : oRequestHeaders.GetChildren())
+            {
+                osHeaders += "\r\n";
+                osHeaders += obj.GetName();
+                osHeaders += ": ";
+                osHeaders += obj.ToString();
+            }
+        }
+        aosOptions.SetNameValue("HEADERS", osHeaders.c_str());
+        return aosOptions;
+    };
+
+    const auto GetRequestKey =
+        [](const std::string &osURL, const CPLStringList &aosOptions)
+    {
+        std::string osKey(osURL);
+        for (const char *pszOption : aosOptions)
+        {
+            osKey += '\n';
+            osKey += pszOption;
+        }
+        return osKey;
+    };
+
     do
     {
         ++nLoops;
@@ -805,57 +973,57 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
         if (STARTS_WITH(osCurFilename, "http://") ||
             STARTS_WITH(osCurFilename, "https://"))
         {
-            // Cf // Cf https://github.com/radiantearth/stac-api-spec/tree/release/v1.0.0/item-search#pagination
-            CPLStringList aosOptions;
-            if (oBody.IsValid() &&
-                oBody.GetType() == CPLJSONObject::Type::Object)
+            const CPLStringList aosOptions(
+                GetHTTPOptions(osMethod, oHeaders, oBody, bMerge));
+            const std::string osKey = GetRequestKey(osCurFilename, aosOptions);
+            std::shared_ptr<const std::string> poCachedPage;
+            const auto oIterPrefetched = oMapPrefetchedPages.find(osKey);
+            if (bUseCache && GetPageCache().tryGet(osKey, poCachedPage))
             {
-                if (bMerge)
-                    CPLDebug("STACIT",
-                             "Ignoring 'merge' attribute from next link");
-                const std::string osPostContent =
-                    oBody.Format(CPLJSONObject::PrettyFormat::Pretty);
-                aosOptions.SetNameValue("POSTFIELDS", osPostContent.c_str());
+                if (!oDoc.LoadMemory(*poCachedPage))
+                    return false;
             }
-            aosOptions.SetNameValue("CUSTOMREQUEST", osMethod.c_str());
-            CPLString osHeaders;
-            if (!oHeaders.IsValid() ||
-                oHeaders.GetType() != CPLJSONObject::Type::Object ||
-                oHeaders["Content-Type"].ToString().empty())
+            else if (oIterPrefetched != oMapPrefetchedPages.end())
             {
-                osHeaders = "Content-Type: application/json";
+                const bool bOK = oDoc.LoadMemory(
+                    reinterpret_cast<const GByte *>(
+                        oIterPrefetched->second.data()),
+                    oIterPrefetched->second.size(), aosSkippedMembers);
+                oMapPrefetchedPages.erase(oIterPrefetched);
+                if (!bOK)
+                    return false;
             }
-            if (oHeaders.IsValid() &&
-                oHeaders.GetType() == CPLJSONObject::Type::Object)
+            else
             {
-                for (const auto &obj : oHeaders.GetChildren())
+                CPLHTTPResult *psResult =
+                    CPLHTTPFetch(osCurFilename.c_str(), aosOptions.List());
+                if (!psResult)
+                    return false;
+                if (!psResult->pabyData)
                 {
-                    osHeaders += "\r\n";
-                    osHeaders += obj.GetName();
-                    osHeaders += ": ";
-                    osHeaders += obj.ToString();
+                    CPLHTTPDestroyResult(psResult);
+                    return false;
                 }
+                const bool bOK =
+                    oDoc.LoadMemory(psResult->pabyData,
+                                    static_cast<size_t>(psResult->nDataLen),
+                                    aosSkippedMembers);
+                // CPLDebug("STACIT", "Response: %s", reinterpret_cast<const char*>(psResult->pabyData));
+                CPLHTTPDestroyResult(psResult);
+                if (!bOK)
+                    return false;
             }
-            aosOptions.SetNameValue("HEADERS", osHeaders.c_str());
-            CPLHTTPResult *psResult =
-                CPLHTTPFetch(osCurFilename.c_str(), aosOptions.List());
-            if (!psResult)
-                return false;
-            if (!psResult->pabyData)
+            if (bUseCache && !poCachedPage)
             {
-                CPLHTTPDestroyResult(psResult);
-                return false;
+                GetPageCache().insert(
+                    osKey, std::make_shared<const std::string>(
+                               oDoc.GetRoot().Format(
+                                   CPLJSONObject::PrettyFormat::Plain)));
             }
-            const bool bOK = oDoc.LoadMemory(
-                reinterpret_cast<const char *>(psResult->pabyData));
-            // CPLDebug("STACIT", "Response: %s", reinterpret_cast<const char*>(psResult->pabyData));
-            CPLHTTPDestroyResult(psResult);
-            if (!bOK)
-                return false;
         }
         else
         {
-            if (!oDoc.Load(osCurFilename))
+            if (!oDoc.Load(osCurFilename, aosSkippedMembers))
                 return false;
         }
         const auto oRoot = oDoc.GetRoot();
@@ -987,6 +1155,65 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
              (oBody.IsValid() &&
               oBody.GetType() == CPLJSONObject::Type::Object)))
         {
+            // Next links of APIs paging with an integer offset or page
+            // number can be predicted. In that case, fetch several pages at
+            // once.
+            const bool bIsHTTP =
+                STARTS_WITH(osNewFilename.c_str(), "http://") ||
+                STARTS_WITH(osNewFilename.c_str(), "https://");
+            const CPLStringList aosOptions(
+                GetHTTPOptions(osMethod, oHeaders, oBody, false));
+            const std::string osNewKey =
+                GetRequestKey(osNewFilename, aosOptions);
+            if (bIsHTTP && nMaxConnections > 1 && osMethod == "GET" &&
+                !oBody.IsValid() && oFeatures.Size() > 0 &&
+                !cpl::contains(oMapPrefetchedPages, osNewKey) &&
+                !(bUseCache && GetPageCache().contains(osNewKey)))
+            {
+                int nPagesToFetch = nMaxConnections;
+                if (nMaxItems > 0)
+                {
+                    const GIntBig nRemainingPages =
+                        (nMaxItems - nItemIter + oFeatures.Size() - 1) /
+                        oFeatures.Size();
+                    nPagesToFetch = static_cast<int>(std::min<GIntBig>(
+                        nPagesToFetch, nRemainingPages));
+                }
+                auto aosURLs = GetFollowingPageURLs(
+                    osCurFilename, osNewFilename, nPagesToFetch - 1);
+                if (!aosURLs.empty())
+                {
+                    aosURLs.insert(aosURLs.begin(), osNewFilename);
+                    const CPLStringList aosURLList(aosURLs);
+                    const int nURLs = aosURLList.size();
+                    CPLDebug("STACIT", "Fetching %d pages from %s", nURLs,
+                             osNewFilename.c_str());
+                    CPLHTTPResult **papsResults = CPLHTTPMultiFetch(
+                        aosURLList.List(), nURLs, nMaxConnections,
+                        aosOptions.List());
+                    if (papsResults)
+                    {
+                        for (int i = 0; i < nURLs; ++i)
+                        {
+                            // Failures of guessed pages (typically past the
+                            // last one) are not errors. The next page, if
+                            // not fetched, will be fetched again normally.
+                            const auto psResult = papsResults[i];
+                            if (psResult && psResult->nStatus == 0 &&
+                                psResult->pszErrBuf == nullptr &&
+                                psResult->pabyData)
+                            {
+                                oMapPrefetchedPages[GetRequestKey(
+                                    aosURLs[i], aosOptions)]
+                                    .assign(reinterpret_cast<const char *>(
+                                                psResult->pabyData),
+                                            psResult->nDataLen);
+                            }
+                        }
+                        CPLHTTPDestroyMultiResult(papsResults, nURLs);
+                    }
+                }
+            }
             osCurFilename = osNewFilename;
         }
         else
@@ -1058,6 +1285,9 @@ void GDALRegister_STACIT()
         "description='Name of asset to filter items'/>"
         "   <Option name='CRS' type='string' "
         "description='Name of CRS to filter items'/>"
+        "   <Option name='MAX_CONNECTIONS' type='int' default='4' "
+        "description='Maximum number of pages of a STAC API search fetched "
+        "simultaneously'/>"
         "   <Option name='RESOLUTION' type='string-select' default='AVERAGE' "
         "description='Strategy to use to determine dataset resolution'>"
         "       <Value>AVERAGE</Value>"
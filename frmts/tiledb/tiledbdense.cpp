@@ -391,6 +391,19 @@ CPLErr TileDBRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
+    // Other buffer data types or layouts: still read the whole window at
+    // once, rather than block by block.
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+    {
+        CPLErr eErr = CE_None;
+        if (poGDS->ReadInSingleQuery(nXOff, nYOff, nXSize, nYSize, pData,
+                                     eBufType, 1, &nBand, nPixelSpace,
+                                     nLineSpace, 0, eErr))
+        {
+            return eErr;
+        }
+    }
+
     return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
                                         pData, nBufXSize, nBufYSize, eBufType,
                                         nPixelSpace, nLineSpace, psExtraArg);
@@ -805,12 +818,193 @@ CPLErr TileDBRasterDataset::IRasterIO(
         }
     }
 
+    // Read all requested bands, whatever the buffer layout, with a single
+    // query, so that TileDB can process the tiles in parallel.
+    if (eRWFlag == GF_Read && nBandCount > 1 && nXSize == nBufXSize &&
+        nYSize == nBufYSize)
+    {
+        CPLErr eErr = CE_None;
+        if (ReadInSingleQuery(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                              nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                              nBandSpace, eErr))
+        {
+            return eErr;
+        }
+    }
+
     return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
                                      pData, nBufXSize, nBufYSize, eBufType,
                                      nBandCount, panBandMap, nPixelSpace,
                                      nLineSpace, nBandSpace, psExtraArg);
 }
 
+/************************************************************************/
+/*                         ReadInSingleQuery()                          */
+/************************************************************************/
+
+// Reads a non-resampled window of several bands with a single TileDB query
+// into temporary buffers in the native layout of the array, and copies them
+// into the user buffer.
+// Returns false if the request cannot be handled that way, in which case
+// eErr is not set.
+bool TileDBRasterDataset::ReadInSingleQuery(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
+    CPLErr &eErr)
+{
+    const int nMinBand = *std::min_element(panBandMap, panBandMap + nBandCount);
+    const int nMaxBand = *std::max_element(panBandMap, panBandMap + nBandCount);
+    const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+
+    try
+    {
+        tiledb::Context *ctx = m_ctx.get();
+        const auto &oArray = GetArray(false, ctx);
+        const auto nDims = oArray.schema().domain().ndim();
+
+        std::vector<uint64_t> oaSubarray = {
+            static_cast<uint64_t>(nYOff),
+            static_cast<uint64_t>(nYOff) + nYSize - 1,
+            static_cast<uint64_t>(nXOff),
+            static_cast<uint64_t>(nXOff) + nXSize - 1};
+
+        auto poQuery = std::make_unique<tiledb::Query>(*ctx, oArray);
+        tiledb::Subarray subarray(*ctx, oArray);
+
+        if (eIndexMode == ATTRIBUTES)
+        {
+            // One buffer per attribute, each band being read at most once
+            std::vector<int> anBands(panBandMap, panBandMap + nBandCount);
+            std::sort(anBands.begin(), anBands.end());
+            if (nDims != 2 ||
+                std::adjacent_find(anBands.begin(), anBands.end()) !=
+                    anBands.end())
+            {
+                return false;
+            }
+
+            subarray.set_subarray(oaSubarray);
+            poQuery->set_subarray(subarray);
+
+            std::vector<std::vector<GByte>> aabyBuffers(nBandCount);
+            for (int i = 0; i < nBandCount; ++i)
+            {
+                auto poBand = cpl::down_cast<TileDBRasterBand *>(
+                    GetRasterBand(panBandMap[i]));
+                const GDALDataType eDT = poBand->GetRasterDataType();
+                aabyBuffers[i].resize(nPixels * GDALGetDataTypeSizeBytes(eDT));
+                if (SetBuffer(poQuery.get(), eDT, poBand->osAttrName,
+                              aabyBuffers[i].data(), nPixels) != CE_None)
+                {
+                    return false;
+                }
+            }
+
+            eErr = poQuery->submit() == tiledb::Query::Status::FAILED
+                       ? CE_Failure
+                       : CE_None;
+
+            for (int i = 0; eErr == CE_None && i < nBandCount; ++i)
+            {
+                const GDALDataType eDT =
+                    GetRasterBand(panBandMap[i])->GetRasterDataType();
+                const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+                for (int iY = 0; iY < nYSize; ++iY)
+                {
+                    GDALCopyWords64(
+                        aabyBuffers[i].data() +
+                            static_cast<size_t>(iY) * nXSize * nDTSize,
+                        eDT, nDTSize,
+                        static_cast<GByte *>(pData) + i * nBandSpace +
+                            iY * nLineSpace,
+                        eBufType, static_cast<int>(nPixelSpace), nXSize);
+                }
+            }
+            return true;
+        }
+
+        // BAND and PIXEL interleaving: read the range of bands spanning the
+        // requested ones, provided that does not involve too many other ones.
+        const int nBandRange = nMaxBand - nMinBand + 1;
+        if (nDims != 3 || eDataType == GDT_Unknown ||
+            nBandRange > 2 * nBandCount)
+        {
+            return false;
+        }
+
+        const uint64_t nFirstBandIdx = nBandStart + nMinBand - 1;
+        oaSubarray.insert(oaSubarray.begin(),
+                          {nFirstBandIdx, nFirstBandIdx + nBandRange - 1});
+        if (eIndexMode == PIXEL)
+            std::rotate(oaSubarray.begin(), oaSubarray.begin() + 2,
+                        oaSubarray.end());
+        subarray.set_subarray(oaSubarray);
+        poQuery->set_subarray(subarray);
+
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+        std::vector<GByte> abyBuffer(nPixels * nBandRange * nDTSize);
+        const auto &osAttrName =
+            cpl::down_cast<TileDBRasterBand *>(GetRasterBand(nMinBand))
+                ->osAttrName;
+        if (SetBuffer(poQuery.get(), eDataType, osAttrName, abyBuffer.data(),
+                      nPixels * nBandRange) != CE_None)
+        {
+            return false;
+        }
+
+        if (bStats)
+            tiledb::Stats::enable();
+
+        eErr = poQuery->submit() == tiledb::Query::Status::FAILED ? CE_Failure
+                                                                  : CE_None;
+
+        if (bStats)
+        {
+            tiledb::Stats::dump(stdout);
+            tiledb::Stats::disable();
+        }
+
+        if (eErr != CE_None)
+            return true;
+
+        // Strides of the native buffer
+        const size_t nSrcPixelSpace =
+            eIndexMode == PIXEL ? static_cast<size_t>(nBandRange) * nDTSize
+                                : nDTSize;
+        const size_t nSrcLineSpace = nSrcPixelSpace * nXSize;
+        const size_t nSrcBandSpace =
+            eIndexMode == PIXEL ? nDTSize : nPixels * nDTSize;
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            const GByte *pabySrc =
+                abyBuffer.data() + (panBandMap[i] - nMinBand) * nSrcBandSpace;
+            for (int iY = 0; iY < nYSize; ++iY)
+            {
+                GDALCopyWords64(pabySrc + iY * nSrcLineSpace, eDataType,
+                                static_cast<int>(nSrcPixelSpace),
+                                static_cast<GByte *>(pData) + i * nBandSpace +
+                                    iY * nLineSpace,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nXSize);
+            }
+        }
+        return true;
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+    catch (const tiledb::TileDBError &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "TileDB: TileDBRasterDataset::ReadInSingleQuery() failed: %s",
+                 e.what());
+        eErr = CE_Failure;
+        return true;
+    }
+}
+
 /************************************************************************/
 /*                             AddDimensions()                          */
 /************************************************************************/
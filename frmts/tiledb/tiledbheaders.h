@@ -243,6 +243,11 @@ class TileDBRasterDataset final : public TileDBDataset
     CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
                      GDALDataType, int, BANDMAP_TYPE, GSpacing, GSpacing,
                      GSpacing, GDALRasterIOExtraArg *psExtraArg) override;
+    bool ReadInSingleQuery(int nXOff, int nYOff, int nXSize, int nYSize,
+                           void *pData, GDALDataType eBufType, int nBandCount,
+                           const int *panBandMap, GSpacing nPixelSpace,
+                           GSpacing nLineSpace, GSpacing nBandSpace,
+                           CPLErr &eErr);
     CPLErr CreateAttribute(GDALDataType eType, const CPLString &osAttrName,
                            const int nSubRasterCount, bool bHasFillValue,
                            double dfFillValue);
@@ -14,6 +14,7 @@
 #include <array>
 #include <cmath>
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 #include "vrtdataset.h"
 #include "vrtexpression.h"
 #include "vrtreclassifier.h"
@@ -134,6 +135,173 @@ static CPLErr FetchDoubleArg(CSLConstList papszArgs, const char *pszName,
     return CE_None;
 }
 
+/************************************************************************/
+/*                       ProcessLinesInParallel()                       */
+/************************************************************************/
+
+// Calls processLines(iStartLine, iEndLine) on ranges of lines covering
+// [0, nYSize). Large requests are split over threads of the global thread
+// pool, whose number is given by VRT_NUM_THREADS / GDAL_NUM_THREADS.
+// processLines() must only write the lines it is given.
+template <class Func>
+static void ProcessLinesInParallel(int nXSize, int nYSize,
+                                   const Func &processLines)
+{
+    // Only split the work if each thread gets enough pixels to amortize
+    // the cost of scheduling.
+    constexpr int MIN_PIXELS_PER_JOB = 65536;
+    const int nLinesPerJob = std::max(1, MIN_PIXELS_PER_JOB / nXSize);
+    const int nJobs = DIV_ROUND_UP(nYSize, nLinesPerJob);
+
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    if (nJobs > 1)
+    {
+        const int nMaxThreads = VRTDataset::GetNumThreads(nullptr);
+        if (nMaxThreads > 1)
+        {
+            poThreadReservation = std::make_unique<GDALThreadReservation>(
+                std::min(nMaxThreads, nJobs));
+            const int nThreads = poThreadReservation->GetThreadCount();
+            if (nThreads > 1)
+                poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        }
+    }
+
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const int iStartLine = iJob * nLinesPerJob;
+            const int iEndLine = std::min(nYSize, iStartLine + nLinesPerJob);
+            if (!poJobQueue->SubmitJob([&processLines, iStartLine, iEndLine]()
+                                       { processLines(iStartLine, iEndLine); }))
+            {
+                processLines(iStartLine, iEndLine);
+            }
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        processLines(0, nYSize);
+    }
+}
+
+/************************************************************************/
+/*                         LinewisePixelFunc()                          */
+/************************************************************************/
+
+// Evaluates a pixel function on sources of a non-complex type one line at a
+// time: kernel(papSrc, nXSize, padfOut) is given pointers to the values of
+// each source for the line, in their native data type, and computes the
+// nXSize output values, that are then converted to the output buffer type
+// with a single GDALCopyWords() call.
+template <class T, class Kernel>
+static void LinewisePixelFunc(void **papoSources, int nSources, void *pData,
+                              int nXSize, int nYSize, GDALDataType eBufType,
+                              int nPixelSpace, int nLineSpace,
+                              const Kernel &kernel)
+{
+    ProcessLinesInParallel(
+        nXSize, nYSize,
+        [&](int iStartLine, int iEndLine)
+        {
+            std::vector<const T *> apSrc(nSources);
+            std::vector<double> adfLine(nXSize);
+            for (int iLine = iStartLine; iLine < iEndLine; ++iLine)
+            {
+                const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+                for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                    apSrc[iSrc] =
+                        static_cast<const T *>(papoSources[iSrc]) + nLineOffset;
+
+                kernel(apSrc.data(), nXSize, adfLine.data());
+
+                GDALCopyWords(adfLine.data(), GDT_Float64, sizeof(double),
+                              static_cast<GByte *>(pData) +
+                                  static_cast<GSpacing>(nLineSpace) * iLine,
+                              eBufType, nPixelSpace, nXSize);
+            }
+        });
+}
+
+template <class Kernel>
+static void LinewisePixelFunc(void **papoSources, int nSources, void *pData,
+                              int nXSize, int nYSize, GDALDataType eSrcType,
+                              GDALDataType eBufType, int nPixelSpace,
+                              int nLineSpace, const Kernel &kernel)
+{
+    switch (eSrcType)
+    {
+        case GDT_Byte:
+            LinewisePixelFunc<GByte>(papoSources, nSources, pData, nXSize,
+                                     nYSize, eBufType, nPixelSpace,
+                                     nLineSpace, kernel);
+            break;
+        case GDT_Int8:
+            LinewisePixelFunc<GInt8>(papoSources, nSources, pData, nXSize,
+                                     nYSize, eBufType, nPixelSpace,
+                                     nLineSpace, kernel);
+            break;
+        case GDT_UInt16:
+            LinewisePixelFunc<GUInt16>(papoSources, nSources, pData, nXSize,
+                                       nYSize, eBufType, nPixelSpace,
+                                       nLineSpace, kernel);
+            break;
+        case GDT_Int16:
+            LinewisePixelFunc<GInt16>(papoSources, nSources, pData, nXSize,
+                                      nYSize, eBufType, nPixelSpace,
+                                      nLineSpace, kernel);
+            break;
+        case GDT_UInt32:
+            LinewisePixelFunc<GUInt32>(papoSources, nSources, pData, nXSize,
+                                       nYSize, eBufType, nPixelSpace,
+                                       nLineSpace, kernel);
+            break;
+        case GDT_Int32:
+            LinewisePixelFunc<GInt32>(papoSources, nSources, pData, nXSize,
+                                      nYSize, eBufType, nPixelSpace,
+                                      nLineSpace, kernel);
+            break;
+        case GDT_UInt64:
+            LinewisePixelFunc<uint64_t>(papoSources, nSources, pData, nXSize,
+                                        nYSize, eBufType, nPixelSpace,
+                                        nLineSpace, kernel);
+            break;
+        case GDT_Int64:
+            LinewisePixelFunc<int64_t>(papoSources, nSources, pData, nXSize,
+                                       nYSize, eBufType, nPixelSpace,
+                                       nLineSpace, kernel);
+            break;
+        case GDT_Float16:
+            LinewisePixelFunc<GFloat16>(papoSources, nSources, pData, nXSize,
+                                        nYSize, eBufType, nPixelSpace,
+                                        nLineSpace, kernel);
+            break;
+        case GDT_Float32:
+            LinewisePixelFunc<float>(papoSources, nSources, pData, nXSize,
+                                     nYSize, eBufType, nPixelSpace,
+                                     nLineSpace, kernel);
+            break;
+        case GDT_Float64:
+            LinewisePixelFunc<double>(papoSources, nSources, pData, nXSize,
+                                      nYSize, eBufType, nPixelSpace,
+                                      nLineSpace, kernel);
+            break;
+        case GDT_Unknown:
+        case GDT_CInt16:
+        case GDT_CInt32:
+        case GDT_CFloat16:
+        case GDT_CFloat32:
+        case GDT_CFloat64:
+        case GDT_TypeCount:
+            CPLAssert(false);
+            break;
+    }
+}
+
 static CPLErr RealPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -1270,27 +1438,33 @@ static CPLErr DiffPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        LinewisePixelFunc(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [bHasNoData, dfNoData](const auto *const *papSrc, int nCount,
+                                   double *padfOut)
             {
-                const double dfA = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfB = GetSrcVal(papoSources[1], eSrcType, ii);
-
-                const double dfPixVal =
-                    bHasNoData &&
-                            (IsNoData(dfA, dfNoData) || IsNoData(dfB, dfNoData))
-                        ? dfNoData
-                        : dfA - dfB;
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                const auto *const pA = papSrc[0];
+                const auto *const pB = papSrc[1];
+                if (bHasNoData)
+                {
+                    for (int i = 0; i < nCount; ++i)
+                    {
+                        const double dfA = static_cast<double>(pA[i]);
+                        const double dfB = static_cast<double>(pB[i]);
+                        padfOut[i] = IsNoData(dfA, dfNoData) ||
+                                             IsNoData(dfB, dfNoData)
+                                         ? dfNoData
+                                         : dfA - dfB;
+                    }
+                }
+                else
+                {
+                    for (int i = 0; i < nCount; ++i)
+                        padfOut[i] = static_cast<double>(pA[i]) -
+                                     static_cast<double>(pB[i]);
+                }
+            });
     }
 
     /* ---- Return success ---- */
@@ -1374,39 +1548,51 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        LinewisePixelFunc(
+            papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+            nPixelSpace, nLineSpace,
+            [nSources, dfK, bHasNoData, dfNoData,
+             bPropagateNoData](const auto *const *papSrc, int nCount,
+                               double *padfOut)
             {
-                double dfPixVal = dfK;  // Not complex.
+                if (!bHasNoData)
+                {
+                    std::fill(padfOut, padfOut + nCount, dfK);
+                    for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                    {
+                        const auto *const pSrc = papSrc[iSrc];
+                        for (int i = 0; i < nCount; ++i)
+                            padfOut[i] *= static_cast<double>(pSrc[i]);
+                    }
+                    return;
+                }
 
-                for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                for (int i = 0; i < nCount; ++i)
                 {
-                    const double dfVal =
-                        GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                    double dfPixVal = dfK;  // Not complex.
 
-                    if (bHasNoData && IsNoData(dfVal, dfNoData))
+                    for (int iSrc = 0; iSrc < nSources; ++iSrc)
                     {
-                        if (bPropagateNoData)
+                        const double dfVal =
+                            static_cast<double>(papSrc[iSrc][i]);
+
+                        if (IsNoData(dfVal, dfNoData))
                         {
-                            dfPixVal = dfNoData;
-                            break;
+                            if (bPropagateNoData)
+                            {
+                                dfPixVal = dfNoData;
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            dfPixVal *= dfVal;
                         }
                     }
-                    else
-                    {
-                        dfPixVal *= dfVal;
-                    }
-                }
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                    padfOut[i] = dfPixVal;
+                }
+            });
     }
 
     /* ---- Return success ---- */
@@ -2253,24 +2439,30 @@ static CPLErr ScalePixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    LinewisePixelFunc(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [bHasNoData, dfNoData, dfScale,
+         dfOffset](const auto *const *papSrc, int nCount, double *padfOut)
         {
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : dfVal * dfScale + dfOffset;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+            const auto *const pSrc = papSrc[0];
+            if (bHasNoData)
+            {
+                for (int i = 0; i < nCount; ++i)
+                {
+                    const double dfVal = static_cast<double>(pSrc[i]);
+                    padfOut[i] = IsNoData(dfVal, dfNoData)
+                                     ? dfNoData
+                                     : dfVal * dfScale + dfOffset;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < nCount; ++i)
+                    padfOut[i] =
+                        static_cast<double>(pSrc[i]) * dfScale + dfOffset;
+            }
+        });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2303,40 +2495,41 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    LinewisePixelFunc(
+        papoSources, nSources, pData, nXSize, nYSize, eSrcType, eBufType,
+        nPixelSpace, nLineSpace,
+        [bHasNoData, dfNoData](const auto *const *papSrc, int nCount,
+                               double *padfOut)
         {
-            const double dfLeftVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfRightVal = GetSrcVal(papoSources[1], eSrcType, ii);
+            const auto *const pLeft = papSrc[0];
+            const auto *const pRight = papSrc[1];
+            for (int i = 0; i < nCount; ++i)
+            {
+                const double dfLeftVal = static_cast<double>(pLeft[i]);
+                const double dfRightVal = static_cast<double>(pRight[i]);
 
-            double dfPixVal = dfNoData;
+                double dfPixVal = dfNoData;
 
-            if (!bHasNoData || (!IsNoData(dfLeftVal, dfNoData) &&
-                                !IsNoData(dfRightVal, dfNoData)))
-            {
-                const double dfDenom = (dfLeftVal + dfRightVal);
-                // coverity[divide_by_zero]
-                dfPixVal =
-                    dfDenom == 0
-                        ? std::numeric_limits<double>::infinity()
-                        : (dfLeftVal - dfRightVal) /
+                if (!bHasNoData || (!IsNoData(dfLeftVal, dfNoData) &&
+                                    !IsNoData(dfRightVal, dfNoData)))
+                {
+                    const double dfDenom = (dfLeftVal + dfRightVal);
+                    // coverity[divide_by_zero]
+                    dfPixVal =
+                        dfDenom == 0
+                            ? std::numeric_limits<double>::infinity()
+                            : (dfLeftVal - dfRightVal) /
 #ifdef __COVERITY__
-                              (dfDenom + std::numeric_limits<double>::min())
+                                  (dfDenom + std::numeric_limits<double>::min())
 #else
-                              dfDenom
+                                  dfDenom
 #endif
-                    ;
-            }
+                        ;
+                }
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+                padfOut[i] = dfPixVal;
+            }
+        });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2810,6 +3003,70 @@ static const char pszExprPixelFuncMetadata[] =
     "   <Argument type='builtin' value='geotransform' />"
     "</PixelFunctionArgumentsList>";
 
+/************************************************************************/
+/*                      ExprPixelFuncVectorized()                       */
+/************************************************************************/
+
+// Evaluates an expression compiled as a VectorizedMathExpression, one line
+// at a time.
+static void ExprPixelFuncVectorized(
+    const gdal::VectorizedMathExpression &oExpression, void **papoSources,
+    int nSources, void *pData, int nXSize, int nYSize, GDALDataType eSrcType,
+    GDALDataType eBufType, int nPixelSpace, int nLineSpace, bool bHasNoData,
+    double dfNoData, bool bPropagateNoData)
+{
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+
+    ProcessLinesInParallel(
+        nXSize, nYSize,
+        [&](int iStartLine, int iEndLine)
+        {
+            std::vector<double> adfSrcValues(static_cast<size_t>(nSources) *
+                                             nXSize);
+            std::vector<const double *> apadfSrcValues(nSources);
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                apadfSrcValues[iSrc] =
+                    adfSrcValues.data() + static_cast<size_t>(iSrc) * nXSize;
+            std::vector<double> adfResults(nXSize);
+
+            for (int iLine = iStartLine; iLine < iEndLine; ++iLine)
+            {
+                const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+                for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                {
+                    GDALCopyWords(
+                        static_cast<const GByte *>(papoSources[iSrc]) +
+                            nLineOffset * nSrcTypeSize,
+                        eSrcType, nSrcTypeSize,
+                        adfSrcValues.data() +
+                            static_cast<size_t>(iSrc) * nXSize,
+                        GDT_Float64, sizeof(double), nXSize);
+                }
+
+                oExpression.Evaluate(apadfSrcValues.data(), nXSize,
+                                     adfResults.data());
+
+                if (bHasNoData && bPropagateNoData)
+                {
+                    for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                    {
+                        const double *padfSrc = apadfSrcValues[iSrc];
+                        for (int iCol = 0; iCol < nXSize; ++iCol)
+                        {
+                            if (IsNoData(padfSrc[iCol], dfNoData))
+                                adfResults[iCol] = dfNoData;
+                        }
+                    }
+                }
+
+                GDALCopyWords(adfResults.data(), GDT_Float64, sizeof(double),
+                              static_cast<GByte *>(pData) +
+                                  static_cast<GSpacing>(nLineSpace) * iLine,
+                              eBufType, nPixelSpace, nXSize);
+            }
+        });
+}
+
 static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -2860,6 +3117,34 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         pszDialect = "muparser";
     }
 
+    // Expressions only made of arithmetic operations are evaluated on whole
+    // lines at once, which is much faster than evaluating them pixel by
+    // pixel. They have the same meaning in both dialects, and do not require
+    // the dialect library to be available.
+    if ((EQUAL(pszDialect, "muparser") || EQUAL(pszDialect, "exprtk")) &&
+        !strstr(pszExpression, "_CENTER_X_") &&
+        !strstr(pszExpression, "_CENTER_Y_") &&
+        CPLTestBool(CPLGetConfigOption("VRT_VECTORIZED_EXPRESSION", "YES")))
+    {
+        std::vector<std::string> aosVariables;
+        for (const char *pszName : aosSourceNames)
+            aosVariables.push_back(pszName);
+        std::vector<std::pair<std::string, double>> aoConstants;
+        if (bHasNoData)
+            aoConstants.emplace_back("NODATA", dfNoData);
+        const auto poVectorizedExpression =
+            gdal::VectorizedMathExpression::Create(pszExpression, aosVariables,
+                                                   aoConstants);
+        if (poVectorizedExpression)
+        {
+            ExprPixelFuncVectorized(*poVectorizedExpression, papoSources,
+                                    nSources, pData, nXSize, nYSize, eSrcType,
+                                    eBufType, nPixelSpace, nLineSpace,
+                                    bHasNoData, dfNoData, bPropagateNoData);
+            return CE_None;
+        }
+    }
+
     auto poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
 
     // cppcheck-suppress knownConditionTrueFalse
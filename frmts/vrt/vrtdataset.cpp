@@ -2605,6 +2605,7 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
 
         int nContributingSources = 0;
+        std::vector<std::vector<int>> aanWaves;
         int nMaxThreads = 0;
         constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
         if ((static_cast<int64_t>(nBufXSize) * nBufYSize >=
@@ -2612,7 +2613,7 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
              static_cast<int64_t>(nXSize) * nYSize >=
                  MINIMUM_PIXEL_COUNT_FOR_THREADED_IO) &&
             poBand->CanMultiThreadRasterIO(dfXOff, dfYOff, dfXSize, dfYSize,
-                                           nContributingSources) &&
+                                           nContributingSources, aanWaves) &&
             nContributingSources > 1 &&
             (nMaxThreads = VRTDataset::GetNumThreads(this)) > 1)
         {
@@ -2633,15 +2634,9 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
             auto oQueue = psThreadPool->CreateJobQueue();
             std::atomic<int> nCompletedJobs = 0;
-            for (int iSource = 0; iSource < poBand->nSources; iSource++)
+            for (const auto &anWave : aanWaves)
             {
-                auto poSource = poBand->papoSources[iSource];
-                if (!poSource->IsSimpleSource())
-                    continue;
-                auto poSimpleSource =
-                    cpl::down_cast<VRTSimpleSource *>(poSource);
-                if (poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
-                                                        dfYSize))
+                for (const int iSource : anWave)
                 {
                     auto psJob = new VRTDatasetRasterIOJob();
                     psJob->pbSuccess = &bSuccess;
@@ -2662,7 +2657,8 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     psJob->nLineSpace = nLineSpace;
                     psJob->nBandSpace = nBandSpace;
                     psJob->psExtraArg = psExtraArg;
-                    psJob->poSource = poSimpleSource;
+                    psJob->poSource = cpl::down_cast<VRTSimpleSource *>(
+                        poBand->papoSources[iSource]);
 
                     if (!oQueue->SubmitJob(VRTDatasetRasterIOJob::Func, psJob))
                     {
@@ -2671,18 +2667,23 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                         break;
                     }
                 }
-            }
 
-            while (oQueue->WaitEvent())
-            {
-                // Quite rough progress callback. We could do better by counting
-                // the number of contributing pixels.
-                if (psExtraArg->pfnProgress)
+                // Wait for the completion of the wave before starting the
+                // next one, whose sources overlap it.
+                while (oQueue->WaitEvent())
                 {
-                    psExtraArg->pfnProgress(double(nCompletedJobs.load()) /
-                                                nContributingSources,
-                                            "", psExtraArg->pProgressData);
+                    // Quite rough progress callback. We could do better by
+                    // counting the number of contributing pixels.
+                    if (psExtraArg->pfnProgress)
+                    {
+                        psExtraArg->pfnProgress(
+                            double(nCompletedJobs.load()) /
+                                nContributingSources,
+                            "", psExtraArg->pProgressData);
+                    }
                 }
+                if (!bSuccess)
+                    break;
             }
 
             errorAccumulator.ReplayErrors();
@@ -2804,6 +2805,12 @@ static bool CheckBandForOverview(GDALRasterBand *poBand,
     {
         return false;
     }
+    // Avoid opening sources that are known to have no overviews
+    if (poBand->GetBand() != 0 && poSource->GetSourceProperties() &&
+        poSource->GetSourceProperties()->nOverviewCount == 0)
+    {
+        return false;
+    }
     GDALRasterBand *poSrcBand = poBand->GetBand() == 0
                                     ? poSource->GetMaskBandMainBand()
                                     : poSource->GetRasterBand();
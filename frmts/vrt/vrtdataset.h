@@ -18,6 +18,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
@@ -30,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 CPLErr GDALRegisterDefaultPixelFunc();
@@ -94,6 +96,8 @@ class VRTOverviewInfo
 /************************************************************************/
 
 /** Map of shared datasets */
+class CPLPackedRTree;
+
 class CPL_DLL VRTMapSharedResources
 {
   public:
@@ -943,6 +947,25 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const;
 
+    // Cached results of
+    // IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(),
+    // indexed by bAllowMaxValAdjustment. -1 means not computed yet.
+    mutable int m_anIsMosaicOfNonOverlappingSources[2] = {-1, -1};
+
+    // Spatial index of the destination window of sources, built when there
+    // are many of them. The source count and array for which it has been
+    // built are recorded, as nSources and papoSources are public members.
+    mutable std::unique_ptr<CPLPackedRTree> m_poSourceIndex{};
+    mutable bool m_bSourceIndexBuilt = false;
+    mutable int m_nCachedSourceCount = 0;
+    mutable const VRTSource *const *m_papoCachedSources = nullptr;
+
+    void ResetSourceCaches() const;
+    void ResetSourceCachesIfStale() const;
+    bool GetSourcesIntersectingWindow(double dfXOff, double dfYOff,
+                                      double dfXSize, double dfYSize,
+                                      std::vector<int> &anSourceIndices) const;
+
     CPL_DISALLOW_COPY_ASSIGN(VRTSourcedRasterBand)
 
   protected:
@@ -952,6 +975,8 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     int nSources = 0;
     VRTSource **papoSources = nullptr;
 
+    void InvalidateSourceIndex();
+
     VRTSourcedRasterBand(GDALDataset *poDS, int nBand);
     VRTSourcedRasterBand(GDALDataType eType, int nXSize, int nYSize);
     VRTSourcedRasterBand(GDALDataset *poDS, int nBand, GDALDataType eType,
@@ -1057,8 +1082,8 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
         int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg) const;
 
     bool CanMultiThreadRasterIO(double dfXOff, double dfYOff, double dfXSize,
-                                double dfYSize,
-                                int &nContributingSources) const;
+                                double dfYSize, int &nContributingSources,
+                                std::vector<std::vector<int>> &aanWaves) const;
 
     virtual CPLErr IReadBlock(int, int, void *) override;
 
@@ -1359,6 +1384,27 @@ class CPL_DLL VRTSimpleSource CPL_NON_FINAL : public VRTSource
     bool m_bSrcDSNameFromVRT =
         false;  // whereas content in m_osSrcDSName is a <VRTDataset> XML node
 
+  public:
+    /** Properties of the source band recorded in the <SourceProperties>
+     * element. When they are complete, they are trusted, and the source
+     * dataset is only opened when its pixels are needed.
+     */
+    struct SourceProperties
+    {
+        int nRasterXSize = 0;
+        int nRasterYSize = 0;
+        GDALDataType eDataType = GDT_Unknown;
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        int nOverviewCount = 0;
+        int nMaskFlags = GMF_ALL_VALID;
+        bool bHasNoData = false;
+        double dfNoDataValue = 0;
+    };
+
+  private:
+    std::optional<SourceProperties> m_oSourceProperties{};
+
     void OpenSource() const;
 
   protected:
@@ -1525,6 +1571,24 @@ class CPL_DLL VRTSimpleSource CPL_NON_FINAL : public VRTSource
     {
         m_nMaxValue = nVal;
     }
+
+    /** Records the properties of the source band, to be serialized in
+     * <SourceProperties>. Must be called after SetSrcBand().
+     */
+    void SetSourceProperties(const SourceProperties &oProps)
+    {
+        m_oSourceProperties = oProps;
+    }
+
+    /** Returns the trusted properties of the source band, if any */
+    const std::optional<SourceProperties> &GetSourceProperties() const
+    {
+        return m_oSourceProperties;
+    }
+
+    int GetSrcBandOverviewCount() const;
+    int GetSrcBandMaskFlags() const;
+    double GetSrcBandNoDataValue(int *pbHasNoData) const;
 };
 
 /************************************************************************/
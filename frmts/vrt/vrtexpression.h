@@ -14,7 +14,10 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace gdal
@@ -101,6 +104,79 @@ class MathExpression
 
 /*! @cond Doxygen_Suppress */
 
+/**
+ * Class to evaluate an expression on arrays of values at once.
+ *
+ * Only the subset of syntax that has the same meaning in the muparser and
+ * exprtk dialects is accepted: numeric literals, variables, the binary +, -,
+ * * and / operators, unary minus, parentheses, and the sqrt, abs, exp,
+ * log10, sin, cos and tan functions. Expressions are compiled to a sequence
+ * of operations on blocks of values, whose loops can be vectorized by the
+ * compiler, instead of being interpreted for each value.
+ *
+ * Once created, an instance can be used from several threads at once.
+ */
+class VectorizedMathExpression
+{
+  public:
+    /**
+     * Compile an expression.
+     * @param pszExpression The body of the expression, e.g. "(B1 - B2) / B1"
+     * @param aosVariables Names of the variables, in the order their values
+     *                     are passed to Evaluate()
+     * @param aoConstants Names and values of constants
+     * @return the compiled expression, or nullptr if the expression uses
+     *         syntax that is not supported. No error is emitted in that case.
+     */
+    static std::unique_ptr<VectorizedMathExpression>
+    Create(const char *pszExpression,
+           const std::vector<std::string> &aosVariables,
+           const std::vector<std::pair<std::string, double>> &aoConstants);
+
+    /**
+     * Evaluate the expression on nValues values.
+     * @param papadfVariables Array of pointers to the nValues values of each
+     *                        variable
+     * @param nValues Number of values
+     * @param padfResults Array of nValues values where to store the results
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nValues,
+                  double *padfResults) const;
+
+  private:
+    enum class Op
+    {
+        PUSH_CONSTANT,
+        PUSH_VARIABLE,
+        NEGATE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        SQRT,
+        ABS,
+        EXP,
+        LOG10,
+        SIN,
+        COS,
+        TAN,
+    };
+
+    struct Instruction
+    {
+        Op eOp;
+        int nVariable;
+        double dfConstant;
+    };
+
+    std::vector<Instruction> m_aoProgram{};
+    int m_nMaxStackDepth = 0;
+
+    class Parser;
+
+    VectorizedMathExpression() = default;
+};
+
 #if GDAL_VRT_ENABLE_EXPRTK
 
 /**
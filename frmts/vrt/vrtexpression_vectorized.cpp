@@ -0,0 +1,372 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedMathExpression
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+/************************************************************************/
+/*                 VectorizedMathExpression::Parser                     */
+/************************************************************************/
+
+/** Recursive descent parser emitting the program of a
+ * VectorizedMathExpression in reverse Polish notation.
+ */
+class VectorizedMathExpression::Parser
+{
+  public:
+    Parser(const char *pszExpression,
+           const std::vector<std::string> &aosVariables,
+           const std::vector<std::pair<std::string, double>> &aoConstants,
+           VectorizedMathExpression &oExpr)
+        : m_pszCur(pszExpression), m_aosVariables(aosVariables),
+          m_aoConstants(aoConstants), m_oExpr(oExpr)
+    {
+    }
+
+    bool Parse()
+    {
+        if (!ParseExpression())
+            return false;
+        SkipSpaces();
+        return *m_pszCur == '\0';
+    }
+
+  private:
+    static constexpr int MAX_DEPTH = 64;
+
+    const char *m_pszCur;
+    const std::vector<std::string> &m_aosVariables;
+    const std::vector<std::pair<std::string, double>> &m_aoConstants;
+    VectorizedMathExpression &m_oExpr;
+    int m_nRecursionDepth = 0;
+    int m_nStackDepth = 0;
+
+    void SkipSpaces()
+    {
+        while (*m_pszCur == ' ' || *m_pszCur == '\t' || *m_pszCur == '\n' ||
+               *m_pszCur == '\r')
+            ++m_pszCur;
+    }
+
+    bool Emit(Op eOp, int nVariable = -1, double dfConstant = 0)
+    {
+        if (eOp == Op::PUSH_CONSTANT || eOp == Op::PUSH_VARIABLE)
+        {
+            ++m_nStackDepth;
+            if (m_nStackDepth > MAX_DEPTH)
+                return false;
+            m_oExpr.m_nMaxStackDepth =
+                std::max(m_oExpr.m_nMaxStackDepth, m_nStackDepth);
+        }
+        else if (eOp == Op::ADD || eOp == Op::SUBTRACT ||
+                 eOp == Op::MULTIPLY || eOp == Op::DIVIDE)
+        {
+            --m_nStackDepth;
+        }
+        m_oExpr.m_aoProgram.push_back(Instruction{eOp, nVariable, dfConstant});
+        return true;
+    }
+
+    // expression := term (('+' | '-') term)*
+    bool ParseExpression()
+    {
+        if (++m_nRecursionDepth > MAX_DEPTH)
+            return false;
+        if (!ParseTerm())
+            return false;
+        while (true)
+        {
+            SkipSpaces();
+            const char chOp = *m_pszCur;
+            if (chOp != '+' && chOp != '-')
+                break;
+            ++m_pszCur;
+            if (!ParseTerm() ||
+                !Emit(chOp == '+' ? Op::ADD : Op::SUBTRACT))
+                return false;
+        }
+        --m_nRecursionDepth;
+        return true;
+    }
+
+    // term := factor (('*' | '/') factor)*
+    bool ParseTerm()
+    {
+        if (!ParseFactor())
+            return false;
+        while (true)
+        {
+            SkipSpaces();
+            const char chOp = *m_pszCur;
+            if (chOp != '*' && chOp != '/')
+                break;
+            ++m_pszCur;
+            if (!ParseFactor() ||
+                !Emit(chOp == '*' ? Op::MULTIPLY : Op::DIVIDE))
+                return false;
+        }
+        return true;
+    }
+
+    // factor := ['-'] primary
+    bool ParseFactor()
+    {
+        SkipSpaces();
+        if (*m_pszCur == '-')
+        {
+            ++m_pszCur;
+            SkipSpaces();
+            // Stacked signs are not accepted the same way by all dialects
+            if (*m_pszCur == '-' || *m_pszCur == '+')
+                return false;
+            return ParsePrimary() && Emit(Op::NEGATE);
+        }
+        return ParsePrimary();
+    }
+
+    // primary := number | variable | function '(' expression ')' |
+    //            '(' expression ')'
+    bool ParsePrimary()
+    {
+        SkipSpaces();
+        const char ch = *m_pszCur;
+        if (ch == '(')
+        {
+            ++m_pszCur;
+            if (!ParseExpression())
+                return false;
+            SkipSpaces();
+            if (*m_pszCur != ')')
+                return false;
+            ++m_pszCur;
+            return true;
+        }
+
+        if ((ch >= '0' && ch <= '9') || ch == '.')
+        {
+            // Reject hexadecimal numbers, whose support differs between
+            // dialects.
+            if (ch == '0' && (m_pszCur[1] == 'x' || m_pszCur[1] == 'X'))
+                return false;
+            char *pszEnd = nullptr;
+            const double dfVal = CPLStrtod(m_pszCur, &pszEnd);
+            if (pszEnd == m_pszCur)
+                return false;
+            m_pszCur = pszEnd;
+            return Emit(Op::PUSH_CONSTANT, -1, dfVal);
+        }
+
+        if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+              ch == '_'))
+            return false;
+
+        const char *pszStart = m_pszCur;
+        while ((*m_pszCur >= 'A' && *m_pszCur <= 'Z') ||
+               (*m_pszCur >= 'a' && *m_pszCur <= 'z') ||
+               (*m_pszCur >= '0' && *m_pszCur <= '9') || *m_pszCur == '_')
+            ++m_pszCur;
+        const std::string osName(pszStart, m_pszCur - pszStart);
+
+        SkipSpaces();
+        if (*m_pszCur == '(')
+        {
+            static const struct
+            {
+                const char *pszName;
+                Op eOp;
+            } asFunctions[] = {
+                {"sqrt", Op::SQRT}, {"abs", Op::ABS}, {"exp", Op::EXP},
+                {"log10", Op::LOG10}, {"sin", Op::SIN}, {"cos", Op::COS},
+                {"tan", Op::TAN},
+            };
+            for (const auto &sFunction : asFunctions)
+            {
+                if (osName == sFunction.pszName)
+                {
+                    ++m_pszCur;
+                    if (!ParseExpression())
+                        return false;
+                    SkipSpaces();
+                    if (*m_pszCur != ')')
+                        return false;
+                    ++m_pszCur;
+                    return Emit(sFunction.eOp);
+                }
+            }
+            return false;
+        }
+
+        // Names are matched case sensitively: exprtk is case insensitive,
+        // but muparser is not, so let the general evaluator deal with names
+        // that do not match exactly.
+        for (size_t i = 0; i < m_aosVariables.size(); ++i)
+        {
+            if (m_aosVariables[i] == osName)
+                return Emit(Op::PUSH_VARIABLE, static_cast<int>(i));
+        }
+        for (const auto &[osConstantName, dfConstant] : m_aoConstants)
+        {
+            if (osConstantName == osName)
+                return Emit(Op::PUSH_CONSTANT, -1, dfConstant);
+        }
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                 VectorizedMathExpression::Create()                   */
+/************************************************************************/
+
+std::unique_ptr<VectorizedMathExpression> VectorizedMathExpression::Create(
+    const char *pszExpression, const std::vector<std::string> &aosVariables,
+    const std::vector<std::pair<std::string, double>> &aoConstants)
+{
+    // Leave names that are not plain identifiers to the general evaluator,
+    // which validates or substitutes them.
+    for (const auto &osVariable : aosVariables)
+    {
+        if (osVariable.empty() ||
+            (osVariable[0] >= '0' && osVariable[0] <= '9'))
+            return nullptr;
+        for (const char ch : osVariable)
+        {
+            if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+                  (ch >= '0' && ch <= '9') || ch == '_'))
+                return nullptr;
+        }
+    }
+
+    std::unique_ptr<VectorizedMathExpression> poExpr(
+        new VectorizedMathExpression());
+    Parser oParser(pszExpression, aosVariables, aoConstants, *poExpr);
+    if (!oParser.Parse() || poExpr->m_aoProgram.empty())
+        return nullptr;
+    return poExpr;
+}
+
+/************************************************************************/
+/*                VectorizedMathExpression::Evaluate()                  */
+/************************************************************************/
+
+void VectorizedMathExpression::Evaluate(const double *const *papadfVariables,
+                                        size_t nValues,
+                                        double *padfResults) const
+{
+    // Values are processed by blocks small enough for the evaluation stack
+    // to stay in the CPU cache.
+    static constexpr size_t BLOCK_SIZE = 256;
+    std::vector<double> adfStack(static_cast<size_t>(m_nMaxStackDepth) *
+                                 BLOCK_SIZE);
+
+    for (size_t iStart = 0; iStart < nValues; iStart += BLOCK_SIZE)
+    {
+        const size_t n = std::min(BLOCK_SIZE, nValues - iStart);
+        double *padfTop = adfStack.data() - BLOCK_SIZE;
+
+        const auto ApplyUnary = [&padfTop, n](auto &&func)
+        {
+            double *const padfX = padfTop;
+            for (size_t i = 0; i < n; ++i)
+                padfX[i] = func(padfX[i]);
+        };
+
+        const auto ApplyBinary = [&padfTop, n](auto &&func)
+        {
+            double *const padfX = padfTop - BLOCK_SIZE;
+            const double *const padfY = padfTop;
+            for (size_t i = 0; i < n; ++i)
+                padfX[i] = func(padfX[i], padfY[i]);
+            padfTop = padfX;
+        };
+
+        for (const auto &sInstr : m_aoProgram)
+        {
+            switch (sInstr.eOp)
+            {
+                case Op::PUSH_CONSTANT:
+                    padfTop += BLOCK_SIZE;
+                    std::fill(padfTop, padfTop + n, sInstr.dfConstant);
+                    break;
+
+                case Op::PUSH_VARIABLE:
+                    padfTop += BLOCK_SIZE;
+                    memcpy(padfTop, papadfVariables[sInstr.nVariable] + iStart,
+                           n * sizeof(double));
+                    break;
+
+                case Op::NEGATE:
+                    ApplyUnary([](double x) { return -x; });
+                    break;
+
+                case Op::ADD:
+                    ApplyBinary([](double x, double y) { return x + y; });
+                    break;
+
+                case Op::SUBTRACT:
+                    ApplyBinary([](double x, double y) { return x - y; });
+                    break;
+
+                case Op::MULTIPLY:
+                    ApplyBinary([](double x, double y) { return x * y; });
+                    break;
+
+                case Op::DIVIDE:
+                    ApplyBinary([](double x, double y) { return x / y; });
+                    break;
+
+                case Op::SQRT:
+                    ApplyUnary([](double x) { return std::sqrt(x); });
+                    break;
+
+                case Op::ABS:
+                    ApplyUnary([](double x) { return std::fabs(x); });
+                    break;
+
+                case Op::EXP:
+                    ApplyUnary([](double x) { return std::exp(x); });
+                    break;
+
+                case Op::LOG10:
+                    ApplyUnary([](double x) { return std::log10(x); });
+                    break;
+
+                case Op::SIN:
+                    ApplyUnary([](double x) { return std::sin(x); });
+                    break;
+
+                case Op::COS:
+                    ApplyUnary([](double x) { return std::cos(x); });
+                    break;
+
+                case Op::TAN:
+                    ApplyUnary([](double x) { return std::tan(x); });
+                    break;
+            }
+        }
+
+        memcpy(padfResults + iStart, adfStack.data(), n * sizeof(double));
+    }
+}
+
+/*! @endcond */
+
+}  // namespace gdal
@@ -24,6 +24,7 @@
 #include <cstring>
 #include <limits>
 #include <mutex>
+#include <map>
 #include <set>
 #include <string>
 
@@ -32,6 +33,7 @@
 #include "cpl_error_internal.h"
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_progress.h"
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
@@ -114,6 +116,139 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
 
 {
     VRTSourcedRasterBand::CloseDependentDatasets();
+    ResetSourceCaches();
+}
+
+/************************************************************************/
+/*                         ResetSourceCaches()                          */
+/************************************************************************/
+
+void VRTSourcedRasterBand::ResetSourceCaches() const
+{
+    m_poSourceIndex.reset();
+    m_bSourceIndexBuilt = false;
+    m_anIsMosaicOfNonOverlappingSources[0] = -1;
+    m_anIsMosaicOfNonOverlappingSources[1] = -1;
+    m_nCachedSourceCount = nSources;
+    m_papoCachedSources = papoSources;
+}
+
+/************************************************************************/
+/*                      ResetSourceCachesIfStale()                      */
+/************************************************************************/
+
+/** Reset the caches derived from the sources if they have been built for
+ * another set of sources. */
+void VRTSourcedRasterBand::ResetSourceCachesIfStale() const
+{
+    if (m_nCachedSourceCount != nSources || m_papoCachedSources != papoSources)
+        ResetSourceCaches();
+}
+
+/************************************************************************/
+/*                       InvalidateSourceIndex()                        */
+/************************************************************************/
+
+/** Invalidate the caches derived from the sources.
+ *
+ * Must be called when a source is modified or replaced in papoSources.
+ * This is automatically done by the methods of this class that add or
+ * remove sources.
+ */
+void VRTSourcedRasterBand::InvalidateSourceIndex()
+{
+    ResetSourceCaches();
+}
+
+/************************************************************************/
+/*                    GetSourcesIntersectingWindow()                    */
+/************************************************************************/
+
+/** Return the indices, in increasing order, of the sources whose destination
+ * window intersects the passed window.
+ *
+ * This uses a spatial index of the destination windows of the sources, built
+ * the first time it is needed, when there are many sources, and that all of
+ * them are simple sources with a destination window.
+ *
+ * @return false if no spatial index is available, in which case all sources
+ * must be considered.
+ */
+bool VRTSourcedRasterBand::GetSourcesIntersectingWindow(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anSourceIndices) const
+{
+    constexpr int MIN_SOURCE_COUNT_FOR_INDEX = 64;
+    if (nSources < MIN_SOURCE_COUNT_FOR_INDEX)
+        return false;
+
+    ResetSourceCachesIfStale();
+    if (!m_bSourceIndexBuilt)
+    {
+        m_bSourceIndexBuilt = true;
+
+        for (int i = 0; i < nSources; ++i)
+        {
+            if (!papoSources[i]->IsSimpleSource())
+                return false;
+            const auto poSimpleSource =
+                cpl::down_cast<const VRTSimpleSource *>(papoSources[i]);
+            if (!poSimpleSource->IsDstWinSet())
+                return false;
+            double dfDstXOff, dfDstYOff, dfDstXSize, dfDstYSize;
+            poSimpleSource->GetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize,
+                                         dfDstYSize);
+            if (!std::isfinite(dfDstXOff) || !std::isfinite(dfDstYOff) ||
+                !std::isfinite(dfDstXSize) || !std::isfinite(dfDstYSize))
+                return false;
+        }
+
+        m_poSourceIndex = std::make_unique<CPLPackedRTree>();
+        m_poSourceIndex->Reserve(nSources);
+        for (int i = 0; i < nSources; ++i)
+        {
+            double dfDstXOff, dfDstYOff, dfDstXSize, dfDstYSize;
+            cpl::down_cast<const VRTSimpleSource *>(papoSources[i])
+                ->GetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize, dfDstYSize);
+            CPLRectObj sBounds;
+            sBounds.minx = dfDstXOff;
+            sBounds.miny = dfDstYOff;
+            sBounds.maxx = dfDstXOff + dfDstXSize;
+            sBounds.maxy = dfDstYOff + dfDstYSize;
+            m_poSourceIndex->Insert(
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i)), sBounds);
+        }
+        m_poSourceIndex->Build();
+        CPLDebugOnly("VRT", "Built spatial index of %d sources", nSources);
+    }
+    if (!m_poSourceIndex)
+        return false;
+
+    CPLRectObj sAoI;
+    sAoI.minx = dfXOff;
+    sAoI.miny = dfYOff;
+    sAoI.maxx = dfXOff + dfXSize;
+    sAoI.maxy = dfYOff + dfYSize;
+    anSourceIndices.clear();
+    m_poSourceIndex->Visit(
+        sAoI,
+        [this, &anSourceIndices, dfXOff, dfYOff, dfXSize,
+         dfYSize](void *pFeature)
+        {
+            const int iSource =
+                static_cast<int>(reinterpret_cast<uintptr_t>(pFeature));
+            // The index also returns sources that only touch the window
+            if (cpl::down_cast<const VRTSimpleSource *>(papoSources[iSource])
+                    ->DstWindowIntersects(dfXOff, dfYOff, dfXSize, dfYSize))
+            {
+                anSourceIndices.push_back(iSource);
+            }
+            return true;
+        });
+
+    // Sources must be composited in their order of declaration
+    std::sort(anSourceIndices.begin(), anSourceIndices.end());
+    return true;
 }
 
 /************************************************************************/
@@ -239,7 +374,7 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
                 {
                     int bSrcHasNoData = FALSE;
                     const double dfSrcNoData =
-                        poBand->GetNoDataValue(&bSrcHasNoData);
+                        poSource->GetSrcBandNoDataValue(&bSrcHasNoData);
                     if (!bSrcHasNoData || dfSrcNoData != m_dfNoDataValue)
                     {
                         return false;
@@ -247,7 +382,7 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
                 }
                 if (bIsDownsampling)
                 {
-                    if (poBand->GetOverviewCount() != 0)
+                    if (poSource->GetSrcBandOverviewCount() != 0)
                     {
                         bSourceHasOverviews = true;
                     }
@@ -267,19 +402,49 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
 /*                      CanMultiThreadRasterIO()                        */
 /************************************************************************/
 
+/** Determine if the sources contributing to the passed window can be
+ * processed by worker threads.
+ *
+ * Contributing sources are distributed into successive "waves": sources of
+ * a same wave do not overlap each other and do not share the same source
+ * dataset (so that a GDALDataset* is never used from several threads), and a
+ * source is in a later wave than all the previous sources it overlaps or
+ * shares its dataset with. Processing the waves one after the other, with the
+ * sources of a wave processed in parallel, gives thus the same result as
+ * processing the sources sequentially in their declaration order.
+ *
+ * @param aanWaves Set to the indices of the contributing sources of each wave.
+ * @return true if all sources are simple sources, and that at least one wave
+ * has several sources.
+ */
 bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     double dfXOff, double dfYOff, double dfXSize, double dfYSize,
-    int &nContributingSources) const
+    int &nContributingSources, std::vector<std::vector<int>> &aanWaves) const
 {
-    int iLastSource = 0;
-    CPLRectObj sSourceBounds;
-    CPLQuadTree *hQuadTree = nullptr;
+    nContributingSources = 0;
+    aanWaves.clear();
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = dfXOff;
+    sGlobalBounds.miny = dfYOff;
+    sGlobalBounds.maxx = dfXOff + dfXSize;
+    sGlobalBounds.maxy = dfYOff + dfYSize;
+    CPLQuadTree *hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+
+    // Wave of each contributing source inserted in hQuadTree
+    std::vector<int> anSourceWave(nSources, -1);
+    // Last wave of the sources using a given dataset name
+    std::map<std::string, int> oMapDSNameToLastWave;
     bool bRet = true;
-    std::set<std::string> oSetDSName;
 
-    nContributingSources = 0;
-    for (int iSource = 0; iSource < nSources; iSource++)
+    std::vector<int> anSourceIndices;
+    const bool bUseSourceIndex = GetSourcesIntersectingWindow(
+        dfXOff, dfYOff, dfXSize, dfYSize, anSourceIndices);
+    const int nIterSources =
+        bUseSourceIndex ? static_cast<int>(anSourceIndices.size()) : nSources;
+    for (int iIter = 0; iIter < nIterSources; iIter++)
     {
+        const int iSource = bUseSourceIndex ? anSourceIndices[iIter] : iIter;
         const auto poSource = papoSources[iSource];
         if (!poSource->IsSimpleSource())
         {
@@ -287,80 +452,59 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
             break;
         }
         const auto poSimpleSource = cpl::down_cast<VRTSimpleSource *>(poSource);
-        if (poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
-                                                dfYSize))
+        if (!poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
+                                                 dfYSize))
         {
-            // Only build hQuadTree if there are 2 or more sources
-            if (nContributingSources == 1)
-            {
-                std::string &oFirstSrcDSName =
-                    cpl::down_cast<VRTSimpleSource *>(papoSources[iLastSource])
-                        ->m_osSrcDSName;
-                oSetDSName.insert(oFirstSrcDSName);
-
-                CPLRectObj sGlobalBounds;
-                sGlobalBounds.minx = dfXOff;
-                sGlobalBounds.miny = dfYOff;
-                sGlobalBounds.maxx = dfXOff + dfXSize;
-                sGlobalBounds.maxy = dfYOff + dfYSize;
-                hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
-
-                CPLQuadTreeInsertWithBounds(
-                    hQuadTree,
-                    reinterpret_cast<void *>(
-                        static_cast<uintptr_t>(iLastSource)),
-                    &sSourceBounds);
-            }
-
-            // Check there are not several sources with the same name, to avoid
-            // the same GDALDataset* to be used from multiple threads. We may
-            // be a bit too pessimistic, for example if working with unnamed
-            // Memory datasets, but that would involve comparing
-            // poSource->GetRasterBandNoOpen()->GetDataset()
-            if (oSetDSName.find(poSimpleSource->m_osSrcDSName) !=
-                oSetDSName.end())
-            {
-                bRet = false;
-                break;
-            }
-            oSetDSName.insert(poSimpleSource->m_osSrcDSName);
-
-            double dfSourceXOff;
-            double dfSourceYOff;
-            double dfSourceXSize;
-            double dfSourceYSize;
-            poSimpleSource->GetDstWindow(dfSourceXOff, dfSourceYOff,
-                                         dfSourceXSize, dfSourceYSize);
-            constexpr double EPSILON = 1e-1;
-            sSourceBounds.minx = dfSourceXOff + EPSILON;
-            sSourceBounds.miny = dfSourceYOff + EPSILON;
-            sSourceBounds.maxx = dfSourceXOff + dfSourceXSize - EPSILON;
-            sSourceBounds.maxy = dfSourceYOff + dfSourceYSize - EPSILON;
-            iLastSource = iSource;
-
-            if (hQuadTree)
-            {
-                // Check that the new source doesn't overlap an existing one.
-                if (CPLQuadTreeHasMatch(hQuadTree, &sSourceBounds))
-                {
-                    bRet = false;
-                    break;
-                }
+            continue;
+        }
 
-                CPLQuadTreeInsertWithBounds(
-                    hQuadTree,
-                    reinterpret_cast<void *>(static_cast<uintptr_t>(iSource)),
-                    &sSourceBounds);
-            }
+        double dfSourceXOff;
+        double dfSourceYOff;
+        double dfSourceXSize;
+        double dfSourceYSize;
+        poSimpleSource->GetDstWindow(dfSourceXOff, dfSourceYOff, dfSourceXSize,
+                                     dfSourceYSize);
+        constexpr double EPSILON = 1e-1;
+        CPLRectObj sSourceBounds;
+        sSourceBounds.minx = dfSourceXOff + EPSILON;
+        sSourceBounds.miny = dfSourceYOff + EPSILON;
+        sSourceBounds.maxx = dfSourceXOff + dfSourceXSize - EPSILON;
+        sSourceBounds.maxy = dfSourceYOff + dfSourceYSize - EPSILON;
+
+        int iWave = 0;
+        const auto oIterDSName =
+            oMapDSNameToLastWave.find(poSimpleSource->m_osSrcDSName);
+        if (oIterDSName != oMapDSNameToLastWave.end())
+            iWave = oIterDSName->second + 1;
+
+        int nOverlapping = 0;
+        void **pahOverlapping =
+            CPLQuadTreeSearch(hQuadTree, &sSourceBounds, &nOverlapping);
+        for (int i = 0; i < nOverlapping; ++i)
+        {
+            const int iOther = static_cast<int>(
+                reinterpret_cast<uintptr_t>(pahOverlapping[i]));
+            iWave = std::max(iWave, anSourceWave[iOther] + 1);
+        }
+        CPLFree(pahOverlapping);
+
+        anSourceWave[iSource] = iWave;
+        oMapDSNameToLastWave[poSimpleSource->m_osSrcDSName] = iWave;
+        if (static_cast<size_t>(iWave) >= aanWaves.size())
+            aanWaves.resize(iWave + 1);
+        aanWaves[iWave].push_back(iSource);
+        CPLQuadTreeInsertWithBounds(
+            hQuadTree,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(iSource)),
+            &sSourceBounds);
 
-            ++nContributingSources;
-        }
+        ++nContributingSources;
     }
 
-    if (hQuadTree)
-        CPLQuadTreeDestroy(hQuadTree);
+    CPLQuadTreeDestroy(hQuadTree);
 
-    return bRet;
+    // No parallelism is possible if each wave has a single source
+    return bRet && aanWaves.size() < static_cast<size_t>(nContributingSources);
 }
 
 /************************************************************************/
@@ -626,6 +770,7 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         l_poDS->m_bMultiThreadedRasterIOLastUsed = false;
 
     int nContributingSources = 0;
+    std::vector<std::vector<int>> aanWaves;
     int nMaxThreads = 0;
     constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
     if (l_poDS &&
@@ -634,7 +779,7 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
          static_cast<int64_t>(nXSize) * nYSize >=
              MINIMUM_PIXEL_COUNT_FOR_THREADED_IO) &&
         CanMultiThreadRasterIO(dfXOff, dfYOff, dfXSize, dfYSize,
-                               nContributingSources) &&
+                               nContributingSources, aanWaves) &&
         nContributingSources > 1 &&
         (nMaxThreads = VRTDataset::GetNumThreads(l_poDS)) > 1)
     {
@@ -670,14 +815,9 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
 
         auto oQueue = psThreadPool->CreateJobQueue();
         std::atomic<int> nCompletedJobs = 0;
-        for (int iSource = 0; iSource < nSources; iSource++)
+        for (const auto &anWave : aanWaves)
         {
-            auto poSource = papoSources[iSource];
-            if (!poSource->IsSimpleSource())
-                continue;
-            auto poSimpleSource = cpl::down_cast<VRTSimpleSource *>(poSource);
-            if (poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
-                                                    dfYSize))
+            for (const int iSource : anWave)
             {
                 auto psJob = new VRTSourcedRasterBandRasterIOJob();
                 psJob->pbSuccess = &bSuccess;
@@ -696,7 +836,8 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
                 psJob->nPixelSpace = nPixelSpace;
                 psJob->nLineSpace = nLineSpace;
                 psJob->psExtraArg = psExtraArg;
-                psJob->poSource = poSimpleSource;
+                psJob->poSource =
+                    cpl::down_cast<VRTSimpleSource *>(papoSources[iSource]);
 
                 if (!oQueue->SubmitJob(VRTSourcedRasterBandRasterIOJob::Func,
                                        psJob))
@@ -706,18 +847,22 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
                     break;
                 }
             }
-        }
 
-        while (oQueue->WaitEvent())
-        {
-            // Quite rough progress callback. We could do better by counting
-            // the number of contributing pixels.
-            if (psExtraArg->pfnProgress)
+            // Wait for the completion of the wave before starting the next
+            // one, whose sources overlap it.
+            while (oQueue->WaitEvent())
             {
-                psExtraArg->pfnProgress(double(nCompletedJobs.load()) /
-                                            nContributingSources,
-                                        "", psExtraArg->pProgressData);
+                // Quite rough progress callback. We could do better by
+                // counting the number of contributing pixels.
+                if (psExtraArg->pfnProgress)
+                {
+                    psExtraArg->pfnProgress(double(nCompletedJobs.load()) /
+                                                nContributingSources,
+                                            "", psExtraArg->pProgressData);
+                }
             }
+            if (!bSuccess)
+                break;
         }
 
         errorAccumulator.ReplayErrors();
@@ -729,11 +874,19 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
         VRTSource::WorkingState oWorkingState;
-        for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
-        {
+        std::vector<int> anSourceIndices;
+        const bool bUseSourceIndex = GetSourcesIntersectingWindow(
+            dfXOff, dfYOff, dfXSize, dfYSize, anSourceIndices);
+        const int nIterSources = bUseSourceIndex
+                                     ? static_cast<int>(anSourceIndices.size())
+                                     : nSources;
+        for (int iIter = 0; eErr == CE_None && iIter < nIterSources; iIter++)
+        {
+            const int iSource =
+                bUseSourceIndex ? anSourceIndices[iIter] : iIter;
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
+                1.0 * iIter / nIterSources, 1.0 * (iIter + 1) / nIterSources,
                 pfnProgressGlobal, pProgressDataGlobal);
             if (psExtraArg->pProgressData == nullptr)
                 psExtraArg->pfnProgress = nullptr;
@@ -1207,6 +1360,12 @@ bool VRTSourcedRasterBand::
     IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const
 {
+    ResetSourceCachesIfStale();
+    int &nCachedRet =
+        m_anIsMosaicOfNonOverlappingSources[bAllowMaxValAdjustment ? 1 : 0];
+    if (nCachedRet >= 0)
+        return nCachedRet != 0;
+
     bool bRet = true;
     CPLRectObj sGlobalBounds;
     sGlobalBounds.minx = 0;
@@ -1306,6 +1465,7 @@ bool VRTSourcedRasterBand::
     }
     CPLQuadTreeDestroy(hQuadTree);
 
+    nCachedRet = bRet ? 1 : 0;
     return bRet;
 }
 
@@ -3008,6 +3168,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem(const char *pszName,
             {
                 delete papoSources[iSource];
                 papoSources[iSource] = poSource;
+                InvalidateSourceIndex();
                 static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
                 return CE_None;
             }
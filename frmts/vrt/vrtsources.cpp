@@ -85,6 +85,7 @@ VRTSimpleSource::VRTSimpleSource(const VRTSimpleSource *poSrcSource,
       m_aosOpenOptionsOri(poSrcSource->m_aosOpenOptionsOri),
       m_aosOpenOptions(poSrcSource->m_aosOpenOptions),
       m_bSrcDSNameFromVRT(poSrcSource->m_bSrcDSNameFromVRT),
+      m_oSourceProperties(poSrcSource->m_oSourceProperties),
       m_nBand(poSrcSource->m_nBand),
       m_bGetMaskBand(poSrcSource->m_bGetMaskBand),
       m_dfSrcXOff(poSrcSource->m_dfSrcXOff),
@@ -569,6 +570,36 @@ CPLXMLNode *VRTSimpleSource::SerializeToXML(const char *pszVRTPath)
         CPLSetXMLValue(psSrc, "SourceProperties.#BlockYSize",
                        CPLSPrintf("%d", nBlockYSize));
     }
+    else if (m_oSourceProperties)
+    {
+        CPLSetXMLValue(psSrc, "SourceProperties.#RasterXSize",
+                       CPLSPrintf("%d", m_oSourceProperties->nRasterXSize));
+        CPLSetXMLValue(psSrc, "SourceProperties.#RasterYSize",
+                       CPLSPrintf("%d", m_oSourceProperties->nRasterYSize));
+        CPLSetXMLValue(psSrc, "SourceProperties.#DataType",
+                       GDALGetDataTypeName(m_oSourceProperties->eDataType));
+        CPLSetXMLValue(psSrc, "SourceProperties.#BlockXSize",
+                       CPLSPrintf("%d", m_oSourceProperties->nBlockXSize));
+        CPLSetXMLValue(psSrc, "SourceProperties.#BlockYSize",
+                       CPLSPrintf("%d", m_oSourceProperties->nBlockYSize));
+    }
+    if (m_oSourceProperties)
+    {
+        // Those properties make the source properties complete enough to be
+        // trusted when re-opening. See XMLInit()
+        CPLSetXMLValue(psSrc, "SourceProperties.#OverviewCount",
+                       CPLSPrintf("%d", m_oSourceProperties->nOverviewCount));
+        CPLSetXMLValue(psSrc, "SourceProperties.#MaskFlags",
+                       CPLSPrintf("%d", m_oSourceProperties->nMaskFlags));
+        if (m_oSourceProperties->bHasNoData)
+        {
+            CPLSetXMLValue(psSrc, "SourceProperties.#NoData",
+                           VRTSerializeNoData(
+                               m_oSourceProperties->dfNoDataValue,
+                               m_oSourceProperties->eDataType, 18)
+                               .c_str());
+        }
+    }
 
     if (IsSrcWinSet())
     {
@@ -686,6 +717,50 @@ CPLErr VRTSimpleSource::XMLInit(const CPLXMLNode *psSrc, const char *pszVRTPath,
         return CE_Failure;
     }
 
+    // Source properties are only trusted if they have been written with
+    // OverviewCount and MaskFlags (cf gdalbuildvrt -trust_source_properties)
+    m_oSourceProperties.reset();
+    const CPLXMLNode *psSourceProperties =
+        CPLGetXMLNode(psSrc, "SourceProperties");
+    if (psSourceProperties && !m_bGetMaskBand && !m_bSrcDSNameFromVRT &&
+        CPLGetXMLValue(psSourceProperties, "OverviewCount", nullptr) &&
+        CPLGetXMLValue(psSourceProperties, "MaskFlags", nullptr))
+    {
+        SourceProperties oProps;
+        oProps.nRasterXSize =
+            atoi(CPLGetXMLValue(psSourceProperties, "RasterXSize", "0"));
+        oProps.nRasterYSize =
+            atoi(CPLGetXMLValue(psSourceProperties, "RasterYSize", "0"));
+        oProps.eDataType = GDALGetDataTypeByName(
+            CPLGetXMLValue(psSourceProperties, "DataType", ""));
+        oProps.nBlockXSize =
+            atoi(CPLGetXMLValue(psSourceProperties, "BlockXSize", "0"));
+        oProps.nBlockYSize =
+            atoi(CPLGetXMLValue(psSourceProperties, "BlockYSize", "0"));
+        oProps.nOverviewCount =
+            atoi(CPLGetXMLValue(psSourceProperties, "OverviewCount", "-1"));
+        oProps.nMaskFlags =
+            atoi(CPLGetXMLValue(psSourceProperties, "MaskFlags", "-1"));
+        if (const char *pszNoData =
+                CPLGetXMLValue(psSourceProperties, "NoData", nullptr))
+        {
+            oProps.bHasNoData = true;
+            oProps.dfNoDataValue = CPLAtofM(pszNoData);
+        }
+        if (oProps.nRasterXSize > 0 && oProps.nRasterYSize > 0 &&
+            oProps.eDataType != GDT_Unknown && oProps.nBlockXSize > 0 &&
+            oProps.nBlockYSize > 0 && oProps.nOverviewCount >= 0 &&
+            oProps.nMaskFlags >= 0)
+        {
+            m_oSourceProperties = oProps;
+        }
+        else
+        {
+            CPLDebug("VRT", "Ignoring invalid SourceProperties for %s",
+                     m_osSrcDSName.c_str());
+        }
+    }
+
     m_aosOpenOptions = GDALDeserializeOpenOptionsFromXML(psSrc);
     m_aosOpenOptionsOri = m_aosOpenOptions;
     if (strstr(m_osSrcDSName.c_str(), "<VRTDataset") != nullptr)
@@ -834,6 +909,10 @@ void VRTSimpleSource::OpenSource() const
             osKeyMapSharedSources += "||";
             osKeyMapSharedSources += m_aosOpenOptions[i];
         }
+        // Proxy datasets built from trusted source properties only have
+        // the bands used by the sources, so do not mix them with others.
+        if (m_oSourceProperties)
+            osKeyMapSharedSources += "||TRUSTED_SOURCE_PROPERTIES";
 
         proxyDS = cpl::down_cast<GDALProxyPoolDataset *>(
             m_poMapSharedSources->Get(osKeyMapSharedSources));
@@ -846,17 +925,37 @@ void VRTSimpleSource::OpenSource() const
             bShared = m_nExplicitSharedStatus;
 
         const CPLString osUniqueHandle(CPLSPrintf("%p", m_poMapSharedSources));
-        proxyDS = GDALProxyPoolDataset::Create(
-            m_osSrcDSName, m_aosOpenOptions.List(), GA_ReadOnly, bShared,
-            osUniqueHandle.c_str());
-        if (proxyDS == nullptr)
-            return;
+        if (m_oSourceProperties)
+        {
+            // Defer opening the source dataset until its pixels are needed
+            proxyDS = new GDALProxyPoolDataset(
+                m_osSrcDSName, m_oSourceProperties->nRasterXSize,
+                m_oSourceProperties->nRasterYSize, GA_ReadOnly, bShared,
+                nullptr, nullptr, osUniqueHandle.c_str());
+            proxyDS->SetOpenOptions(m_aosOpenOptions.List());
+        }
+        else
+        {
+            proxyDS = GDALProxyPoolDataset::Create(
+                m_osSrcDSName, m_aosOpenOptions.List(), GA_ReadOnly, bShared,
+                osUniqueHandle.c_str());
+            if (proxyDS == nullptr)
+                return;
+        }
     }
     else
     {
         proxyDS->Reference();
     }
 
+    if (m_oSourceProperties && (m_nBand > proxyDS->GetRasterCount() ||
+                                proxyDS->GetRasterBand(m_nBand) == nullptr))
+    {
+        proxyDS->AddSrcBand(m_nBand, m_oSourceProperties->eDataType,
+                            m_oSourceProperties->nBlockXSize,
+                            m_oSourceProperties->nBlockYSize);
+    }
+
     if (m_bGetMaskBand)
     {
         GDALProxyPoolRasterBand *poMaskBand =
@@ -904,6 +1003,61 @@ GDALRasterBand *VRTSimpleSource::GetRasterBand() const
     return m_poRasterBand;
 }
 
+/************************************************************************/
+/*                      GetSrcBandOverviewCount()                       */
+/************************************************************************/
+
+/** Returns the number of overviews of the source band, without opening it
+ * if it has trusted source properties.
+ */
+int VRTSimpleSource::GetSrcBandOverviewCount() const
+{
+    if (m_oSourceProperties)
+        return m_oSourceProperties->nOverviewCount;
+    auto poBand = GetRasterBand();
+    return poBand ? poBand->GetOverviewCount() : 0;
+}
+
+/************************************************************************/
+/*                        GetSrcBandMaskFlags()                         */
+/************************************************************************/
+
+/** Returns the mask flags of the source band, without opening it if it has
+ * trusted source properties.
+ */
+int VRTSimpleSource::GetSrcBandMaskFlags() const
+{
+    if (m_oSourceProperties)
+        return m_oSourceProperties->nMaskFlags;
+    auto poBand = GetRasterBand();
+    return poBand ? poBand->GetMaskFlags() : GMF_ALL_VALID;
+}
+
+/************************************************************************/
+/*                       GetSrcBandNoDataValue()                        */
+/************************************************************************/
+
+/** Returns the nodata value of the source band, without opening it if it
+ * has trusted source properties.
+ */
+double VRTSimpleSource::GetSrcBandNoDataValue(int *pbHasNoData) const
+{
+    if (m_oSourceProperties)
+    {
+        if (pbHasNoData)
+            *pbHasNoData = m_oSourceProperties->bHasNoData;
+        return m_oSourceProperties->dfNoDataValue;
+    }
+    auto poBand = GetRasterBand();
+    if (!poBand)
+    {
+        if (pbHasNoData)
+            *pbHasNoData = false;
+        return 0;
+    }
+    return poBand->GetNoDataValue(pbHasNoData);
+}
+
 /************************************************************************/
 /*                        GetMaskBandMainBand()                         */
 /************************************************************************/
@@ -3416,9 +3570,9 @@ CPLErr VRTComplexSource::RasterIOInternal(
     double dfNoDataValue = GetAdjustedNoDataValue();
 
     if ((m_nProcessingFlags & PROCESSING_FLAG_USE_MASK_BAND) != 0 &&
-        poSourceBand->GetMaskFlags() == GMF_NODATA)
+        GetSrcBandMaskFlags() == GMF_NODATA)
     {
-        dfNoDataValue = poSourceBand->GetNoDataValue(&bNoDataSet);
+        dfNoDataValue = GetSrcBandNoDataValue(&bNoDataSet);
     }
 
     const bool bNoDataSetIsNan = bNoDataSet && std::isnan(dfNoDataValue);
@@ -3491,7 +3645,7 @@ CPLErr VRTComplexSource::RasterIOInternal(
         // Allocate and read mask band if needed
         if (!bNoDataSet &&
             (m_nProcessingFlags & PROCESSING_FLAG_USE_MASK_BAND) != 0 &&
-            (poSourceBand->GetMaskFlags() != GMF_ALL_VALID ||
+            (GetSrcBandMaskFlags() != GMF_ALL_VALID ||
              poSourceBand->GetColorInterpretation() == GCI_AlphaBand ||
              GetMaskBandMainBand() != nullptr))
         {
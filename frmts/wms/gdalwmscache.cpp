@@ -14,14 +14,57 @@
  ****************************************************************************/
 
 #include "cpl_md5.h"
+#include "gdal_thread_pool.h"
 #include "wmsdriver.h"
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
     pCache->Clean();
 }
 
+typedef std::shared_ptr<const std::vector<GByte>> GDALWMSCacheBlob;
+
+// Read a (temporary) downloaded file into memory
+static GDALWMSCacheBlob IngestFile(const CPLString &osFileName)
+{
+    GByte *pabyData = nullptr;
+    vsi_l_offset nSize = 0;
+    if (!VSIIngestFile(nullptr, osFileName, &pabyData, &nSize, -1))
+        return nullptr;
+    auto poBlob = std::make_shared<std::vector<GByte>>(pabyData,
+                                                       pabyData + nSize);
+    VSIFree(pabyData);
+    return poBlob;
+}
+
+// Open a dataset from a copy of a cached blob, through a hidden /vsimem/
+// file that is unlinked as soon as the dataset is opened.
+static GDALDataset *OpenBlob(const GDALWMSCacheBlob &poBlob,
+                             char **papszOpenOptions)
+{
+    GByte *pabyData = static_cast<GByte *>(VSI_MALLOC_VERBOSE(
+        std::max<size_t>(1, poBlob->size())));
+    if (pabyData == nullptr)
+        return nullptr;
+    if (!poBlob->empty())
+        memcpy(pabyData, poBlob->data(), poBlob->size());
+    const std::string osFilename(VSIMemGenerateHiddenFilename("wmscache"));
+    VSIFCloseL(VSIFileFromMemBuffer(osFilename.c_str(), pabyData,
+                                    poBlob->size(), TRUE));
+    GDALDataset *poDS = GDALDataset::FromHandle(GDALOpenEx(
+        osFilename.c_str(),
+        GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR, nullptr,
+        papszOpenOptions, nullptr));
+    VSIUnlink(osFilename.c_str());
+    return poDS;
+}
+
 //------------------------------------------------------------------------------
 // GDALWMSFileCache
 //------------------------------------------------------------------------------
@@ -64,6 +107,22 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
             CPLDebug("WMS", "Clean Thread Run Timeout is %d sec",
                      m_nCleanThreadRunTimeout);
         }
+
+        // Write-behind: tiles are kept in memory and written to disk by a
+        // worker thread, so that the download loop does not wait for the
+        // file system.
+        if (CPLTestBool(CPLGetXMLValue(pConfig, "WriteBehind", "false")))
+        {
+            auto poThreadPool = GDALGetGlobalThreadPool(1);
+            if (poThreadPool)
+                m_poWriteQueue = poThreadPool->CreateJobQueue();
+        }
+    }
+
+    ~GDALWMSFileCache() override
+    {
+        // Wait for pending writes
+        m_poWriteQueue.reset();
     }
 
     virtual int GetCleanThreadRunTimeout() override;
@@ -73,6 +132,22 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     {
         // Warns if it fails to write, but returns success
         CPLString soFilePath = GetFilePath(pszKey);
+        if (m_poWriteQueue)
+        {
+            auto poBlob = IngestFile(osFileName);
+            if (poBlob)
+            {
+                {
+                    std::lock_guard<std::mutex> oLock(m_oPendingMutex);
+                    m_oPendingWrites[soFilePath] = poBlob;
+                }
+                const auto WriteJob = [this, soFilePath, poBlob]()
+                { WritePending(soFilePath, poBlob); };
+                if (!m_poWriteQueue->SubmitJob(WriteJob))
+                    WriteJob();
+                return CE_None;
+            }
+        }
         MakeDirs(CPLGetDirnameSafe(soFilePath).c_str());
         if (CPLCopyFile(soFilePath, osFileName) == CE_None)
             return CE_None;
@@ -85,6 +160,8 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     virtual enum GDALWMSCacheItemStatus
     GetItemStatus(const char *pszKey) const override
     {
+        if (GetPendingWrite(pszKey))
+            return CACHE_ITEM_OK;
         VSIStatBufL sStatBuf;
         if (VSIStatL(GetFilePath(pszKey), &sStatBuf) == 0)
         {
@@ -97,6 +174,8 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     virtual GDALDataset *GetDataset(const char *pszKey,
                                     char **papszOpenOptions) const override
     {
+        if (auto poBlob = GetPendingWrite(pszKey))
+            return OpenBlob(poBlob, papszOpenOptions);
         return GDALDataset::FromHandle(GDALOpenEx(
             GetFilePath(pszKey),
             GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR, nullptr,
@@ -152,6 +231,46 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     }
 
   private:
+    GDALWMSCacheBlob GetPendingWrite(const char *pszKey) const
+    {
+        if (!m_poWriteQueue)
+            return nullptr;
+        std::lock_guard<std::mutex> oLock(m_oPendingMutex);
+        const auto oIter = m_oPendingWrites.find(GetFilePath(pszKey));
+        return oIter != m_oPendingWrites.end() ? oIter->second : nullptr;
+    }
+
+    void WritePending(const CPLString &soFilePath,
+                      const GDALWMSCacheBlob &poBlob)
+    {
+        MakeDirs(CPLGetDirnameSafe(soFilePath).c_str());
+        // Write to a temporary file and rename it, so that a concurrent
+        // reader never sees a partially written tile.
+        const CPLString osTmpPath(soFilePath + ".tmp");
+        VSILFILE *fp = VSIFOpenL(osTmpPath, "wb");
+        bool bOK = fp != nullptr;
+        if (fp)
+        {
+            bOK = VSIFWriteL(poBlob->data(), 1, poBlob->size(), fp) ==
+                  poBlob->size();
+            bOK = VSIFCloseL(fp) == 0 && bOK;
+            bOK = bOK && VSIRename(osTmpPath, soFilePath) == 0;
+            if (!bOK)
+                VSIUnlink(osTmpPath);
+        }
+        if (!bOK)
+        {
+            CPLError(CE_Warning, CPLE_FileIO, "Error writing to WMS cache %s",
+                     m_soPath.c_str());
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oPendingMutex);
+        const auto oIter = m_oPendingWrites.find(soFilePath);
+        // Only forget it if it was not replaced by a more recent insertion
+        if (oIter != m_oPendingWrites.end() && oIter->second == poBlob)
+            m_oPendingWrites.erase(oIter);
+    }
+
     CPLString GetFilePath(const char *pszKey) const
     {
         CPLString soHash(CPLMD5String(pszKey));
@@ -196,6 +315,12 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     int m_nExpires;
     long m_nMaxSize;
     int m_nCleanThreadRunTimeout;
+
+    mutable std::mutex m_oPendingMutex{};
+    std::map<CPLString, GDALWMSCacheBlob> m_oPendingWrites{};
+    // Must be declared last, so that pending jobs are completed before
+    // the above members are destroyed.
+    std::unique_ptr<CPLJobQueue> m_poWriteQueue{};
 };
 
 int GDALWMSFileCache::GetCleanThreadRunTimeout()
@@ -203,6 +328,158 @@ int GDALWMSFileCache::GetCleanThreadRunTimeout()
     return m_nCleanThreadRunTimeout;
 }
 
+//------------------------------------------------------------------------------
+// GDALWMSMemoryCache
+//------------------------------------------------------------------------------
+
+// Least-recently-used store of tiles, shared by all datasets of the process
+// that use a memory cache. Its capacity is the largest MaxSize requested.
+class GDALWMSMemoryCacheStore
+{
+  public:
+    static GDALWMSMemoryCacheStore &Get()
+    {
+        static GDALWMSMemoryCacheStore oStore;
+        return oStore;
+    }
+
+    void SetMinCapacity(size_t nMaxSize)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_nMaxSize = std::max(m_nMaxSize, nMaxSize);
+    }
+
+    void Insert(const std::string &osKey, const GDALWMSCacheBlob &poBlob)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        RemoveLocked(osKey);
+        m_oList.emplace_front(osKey, Entry{poBlob, time(nullptr)});
+        m_oMap[osKey] = m_oList.begin();
+        m_nSize += poBlob->size();
+        while (m_nSize > m_nMaxSize && m_oList.size() > 1)
+            RemoveLocked(m_oList.back().first);
+    }
+
+    GDALWMSCacheBlob Find(const std::string &osKey, time_t *pnTime)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMap.find(osKey);
+        if (oIter == m_oMap.end())
+            return nullptr;
+        // Move to front
+        m_oList.splice(m_oList.begin(), m_oList, oIter->second);
+        if (pnTime)
+            *pnTime = oIter->second->second.nTime;
+        return oIter->second->second.poBlob;
+    }
+
+    void RemoveOlderThan(const std::string &osPrefix, time_t nTime)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        for (auto oIter = m_oList.begin(); oIter != m_oList.end();)
+        {
+            const auto oCur = oIter++;
+            if (oCur->second.nTime < nTime &&
+                oCur->first.compare(0, osPrefix.size(), osPrefix) == 0)
+            {
+                RemoveLocked(oCur->first);
+            }
+        }
+    }
+
+  private:
+    struct Entry
+    {
+        GDALWMSCacheBlob poBlob;
+        time_t nTime;
+    };
+
+    std::mutex m_oMutex{};
+    std::list<std::pair<std::string, Entry>> m_oList{};
+    std::unordered_map<std::string,
+                       std::list<std::pair<std::string, Entry>>::iterator>
+        m_oMap{};
+    size_t m_nSize = 0;
+    size_t m_nMaxSize = 0;
+
+    GDALWMSMemoryCacheStore() = default;
+
+    void RemoveLocked(const std::string &osKey)
+    {
+        const auto oIter = m_oMap.find(osKey);
+        if (oIter != m_oMap.end())
+        {
+            m_nSize -= oIter->second->second.poBlob->size();
+            m_oList.erase(oIter->second);
+            m_oMap.erase(oIter);
+        }
+    }
+};
+
+class GDALWMSMemoryCache : public GDALWMSCacheImpl
+{
+  public:
+    GDALWMSMemoryCache(const CPLString &soPath, CPLXMLNode *pConfig)
+        : GDALWMSCacheImpl(soPath, pConfig),
+          m_nExpires(atoi(CPLGetXMLValue(pConfig, "Expires", "604800"))),
+          m_nCleanThreadRunTimeout(
+              atoi(CPLGetXMLValue(pConfig, "CleanTimeout", "120")))
+    {
+        GDALWMSMemoryCacheStore::Get().SetMinCapacity(static_cast<size_t>(
+            std::max<GIntBig>(0, CPLAtoGIntBig(CPLGetXMLValue(
+                                     pConfig, "MaxSize", "67108864")))));
+    }
+
+    virtual int GetCleanThreadRunTimeout() override
+    {
+        return m_nCleanThreadRunTimeout;
+    }
+
+    virtual CPLErr Insert(const char *pszKey,
+                          const CPLString &osFileName) override
+    {
+        auto poBlob = IngestFile(osFileName);
+        if (poBlob)
+            GDALWMSMemoryCacheStore::Get().Insert(GetKey(pszKey), poBlob);
+        return CE_None;
+    }
+
+    virtual enum GDALWMSCacheItemStatus
+    GetItemStatus(const char *pszKey) const override
+    {
+        time_t nTime = 0;
+        if (!GDALWMSMemoryCacheStore::Get().Find(GetKey(pszKey), &nTime))
+            return CACHE_ITEM_NOT_FOUND;
+        return time(nullptr) - nTime < m_nExpires ? CACHE_ITEM_OK
+                                                  : CACHE_ITEM_EXPIRED;
+    }
+
+    virtual GDALDataset *GetDataset(const char *pszKey,
+                                    char **papszOpenOptions) const override
+    {
+        auto poBlob =
+            GDALWMSMemoryCacheStore::Get().Find(GetKey(pszKey), nullptr);
+        return poBlob ? OpenBlob(poBlob, papszOpenOptions) : nullptr;
+    }
+
+    virtual void Clean() override
+    {
+        GDALWMSMemoryCacheStore::Get().RemoveOlderThan(
+            m_soPath + '\n', time(nullptr) - m_nExpires);
+    }
+
+  private:
+    // Keys are prefixed with the cache path, so that datasets sharing the
+    // same path (by default, the same server URL) share the same tiles.
+    std::string GetKey(const char *pszKey) const
+    {
+        return std::string(m_soPath).append(1, '\n').append(pszKey);
+    }
+
+    int m_nExpires;
+    int m_nCleanThreadRunTimeout;
+};
+
 //------------------------------------------------------------------------------
 // GDALWMSCache
 //------------------------------------------------------------------------------
@@ -297,12 +574,20 @@ CPLErr GDALWMSCache::Initialize(const char *pszUrl, CPLXMLNode *pConfig)
     }
     CPLDebug("WMS", "Using %s for cache", m_osCachePath.c_str());
 
-    // TODO: Add sqlite db cache type
     const char *pszType = CPLGetXMLValue(pConfig, "Type", "file");
     if (EQUAL(pszType, "file"))
     {
         m_poCache = new GDALWMSFileCache(m_osCachePath, pConfig);
     }
+    else if (EQUAL(pszType, "memory"))
+    {
+        m_poCache = new GDALWMSMemoryCache(m_osCachePath, pConfig);
+    }
+    else
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Unsupported cache type '%s'. Cache disabled", pszType);
+    }
 
     return CE_None;
 }
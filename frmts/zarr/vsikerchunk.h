@@ -15,6 +15,7 @@
 
 #include "cpl_progress.h"
 
+#include <cstddef>
 #include <string>
 
 // "Public" API
@@ -36,6 +37,13 @@ bool VSIKerchunkConvertJSONToParquet(const char *pszSrcJSONFilename,
                                      GDALProgressFunc pfnProgress,
                                      void *pProgressData);
 
+class GDALDataset;
+bool VSIKerchunkCreateReferences(GDALDataset *poSrcDS,
+                                 const char *pszDstFilename, bool bParquet,
+                                 size_t nMaxInlineSize,
+                                 GDALProgressFunc pfnProgress,
+                                 void *pProgressData);
+
 // Private API
 void VSIInstallKerchunkJSONRefFileSystem();
 void VSIInstallKerchunkParquetRefFileSystem();
@@ -0,0 +1,733 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Zarr driver. Generation of Kerchunk references from a
+ *           multidimensional dataset
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vsikerchunk.h"
+#include "zarr.h"
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_json_streaming_writer.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+
+#include "gdal_priv.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/************************************************************************/
+/*                        KerchunkRefsWriter                            */
+/************************************************************************/
+
+class KerchunkRefsWriter
+{
+  public:
+    KerchunkRefsWriter(VSIVirtualHandle *poFile, size_t nMaxInlineSize)
+        : m_poFile(poFile), m_oWriter(SerializeFunc, this),
+          m_nMaxInlineSize(nMaxInlineSize)
+    {
+        m_oWriter.SetPrettyFormatting(false);
+    }
+
+    bool Write(const std::shared_ptr<GDALGroup> &poRootGroup,
+               GDALProgressFunc pfnProgress, void *pProgressData);
+
+  private:
+    VSIVirtualHandle *m_poFile = nullptr;
+    CPLJSonStreamingWriter m_oWriter;
+    const size_t m_nMaxInlineSize;
+    bool m_bWriteError = false;
+
+    KerchunkRefsWriter(const KerchunkRefsWriter &) = delete;
+    KerchunkRefsWriter &operator=(const KerchunkRefsWriter &) = delete;
+
+    static void SerializeFunc(const char *pszTxt, void *pUserData)
+    {
+        auto self = static_cast<KerchunkRefsWriter *>(pUserData);
+        const size_t nLen = strlen(pszTxt);
+        if (self->m_poFile->Write(pszTxt, 1, nLen) != nLen)
+            self->m_bWriteError = true;
+    }
+
+    void CollectGroups(
+        const std::shared_ptr<GDALGroup> &poGroup, const std::string &osKey,
+        std::vector<std::pair<std::string, std::shared_ptr<GDALGroup>>>
+            &aoGroups);
+
+    bool WriteArray(const std::string &osKey,
+                    const std::shared_ptr<GDALMDArray> &poArray,
+                    GDALProgressFunc pfnProgress, void *pProgressData);
+
+    void WriteInlineContent(const std::string &osKey, const std::string &osStr)
+    {
+        m_oWriter.AddObjKey(osKey);
+        m_oWriter.Add(osStr);
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                   KerchunkURIFromFilename()                          */
+/************************************************************************/
+
+/* Returns the fsspec URI of a GDAL filename, which is the reverse of
+ * VSIKerchunkMorphURIToVSIPath(). */
+static std::string KerchunkURIFromFilename(const std::string &osFilename)
+{
+    static const struct
+    {
+        const char *pszVSIPrefix;
+        const char *pszFSSpecPrefix;
+    } substitutions[] = {
+        {"/vsis3/", "s3://"},
+        {"/vsigs/", "gs://"},
+        {"/vsicurl/http://", "http://"},
+        {"/vsicurl/https://", "https://"},
+    };
+
+    for (const auto &substitution : substitutions)
+    {
+        if (STARTS_WITH(osFilename.c_str(), substitution.pszVSIPrefix))
+        {
+            return std::string(substitution.pszFSSpecPrefix)
+                .append(osFilename.c_str() + strlen(substitution.pszVSIPrefix));
+        }
+    }
+
+    // References must not depend on the current directory of the process
+    // that reads them.
+    if (CPLIsFilenameRelative(osFilename.c_str()))
+    {
+        char *pszCurDir = CPLGetCurrentDir();
+        if (pszCurDir)
+        {
+            std::string osRet =
+                CPLFormFilenameSafe(pszCurDir, osFilename.c_str(), nullptr);
+            CPLFree(pszCurDir);
+            return osRet;
+        }
+    }
+
+    return osFilename;
+}
+
+/************************************************************************/
+/*                         KerchunkGetDType()                           */
+/************************************************************************/
+
+static std::string KerchunkGetDType(GDALDataType eDT, bool bBigEndian)
+{
+    const char *pszType = nullptr;
+    switch (eDT)
+    {
+        case GDT_Byte:
+            return "|u1";
+        case GDT_Int8:
+            return "|i1";
+        case GDT_UInt16:
+            pszType = "u2";
+            break;
+        case GDT_Int16:
+            pszType = "i2";
+            break;
+        case GDT_UInt32:
+            pszType = "u4";
+            break;
+        case GDT_Int32:
+            pszType = "i4";
+            break;
+        case GDT_UInt64:
+            pszType = "u8";
+            break;
+        case GDT_Int64:
+            pszType = "i8";
+            break;
+        case GDT_Float16:
+            pszType = "f2";
+            break;
+        case GDT_Float32:
+            pszType = "f4";
+            break;
+        case GDT_Float64:
+            pszType = "f8";
+            break;
+        case GDT_CFloat16:
+            pszType = "c4";
+            break;
+        case GDT_CFloat32:
+            pszType = "c8";
+            break;
+        case GDT_CFloat64:
+            pszType = "c16";
+            break;
+        case GDT_Unknown:
+        case GDT_CInt16:
+        case GDT_CInt32:
+        case GDT_TypeCount:
+            break;
+    }
+    if (!pszType)
+        return std::string();
+    return std::string(bBigEndian ? ">" : "<").append(pszType);
+}
+
+/************************************************************************/
+/*                      KerchunkSetFillValue()                          */
+/************************************************************************/
+
+static void KerchunkSetFillValue(CPLJSONObject &oZArray,
+                                 const GDALMDArray *poArray)
+{
+    const auto eDT = poArray->GetDataType().GetNumericDataType();
+    bool bHasNoData = false;
+    if (eDT == GDT_Int64)
+    {
+        const auto nNoData = poArray->GetNoDataValueAsInt64(&bHasNoData);
+        if (bHasNoData)
+        {
+            oZArray.Add("fill_value", static_cast<GInt64>(nNoData));
+            return;
+        }
+    }
+    else if (eDT == GDT_UInt64)
+    {
+        const auto nNoData = poArray->GetNoDataValueAsUInt64(&bHasNoData);
+        if (bHasNoData)
+        {
+            oZArray.Add("fill_value", static_cast<uint64_t>(nNoData));
+            return;
+        }
+    }
+    else if (!GDALDataTypeIsComplex(eDT))
+    {
+        const double dfNoData = poArray->GetNoDataValueAsDouble(&bHasNoData);
+        if (bHasNoData)
+        {
+            if (std::isnan(dfNoData))
+                oZArray.Add("fill_value", "NaN");
+            else if (std::isinf(dfNoData))
+                oZArray.Add("fill_value",
+                            dfNoData > 0 ? "Infinity" : "-Infinity");
+            else if (GDALDataTypeIsInteger(eDT))
+                oZArray.Add("fill_value", static_cast<GInt64>(dfNoData));
+            else
+                oZArray.Add("fill_value", dfNoData);
+            return;
+        }
+    }
+    oZArray.AddNull("fill_value");
+}
+
+/************************************************************************/
+/*                      KerchunkSetCodecs()                             */
+/************************************************************************/
+
+/* Translates the FILTERS item of GDALMDArrayRawBlockInfo::aosInfo into
+ * Zarr V2 "filters" and "compressor" members. */
+static bool KerchunkSetCodecs(CPLJSONObject &oZArray, const char *pszFilters,
+                              int nDTSize)
+{
+    const CPLStringList aosFilters(
+        CSLTokenizeString2(pszFilters ? pszFilters : "", ",", 0));
+
+    const auto GetCodec =
+        [nDTSize](const char *pszFilter, CPLJSONObject &oCodec)
+    {
+        if (EQUAL(pszFilter, "SHUFFLE"))
+        {
+            oCodec.Add("id", "shuffle");
+            oCodec.Add("elementsize", nDTSize);
+        }
+        else if (EQUAL(pszFilter, "DEFLATE"))
+        {
+            oCodec.Add("id", "zlib");
+        }
+        else if (EQUAL(pszFilter, "ZSTD"))
+        {
+            oCodec.Add("id", "zstd");
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_NotSupported, "Unhandled filter %s",
+                     pszFilter);
+            return false;
+        }
+        return true;
+    };
+
+    // The last filter applied at encoding time becomes the compressor, if
+    // it is a compression method. The other ones are Zarr filters, applied
+    // in the same order.
+    int nFilterCount = aosFilters.size();
+    if (nFilterCount > 0 && !EQUAL(aosFilters[nFilterCount - 1], "SHUFFLE"))
+    {
+        --nFilterCount;
+        CPLJSONObject oCompressor;
+        if (!GetCodec(aosFilters[nFilterCount], oCompressor))
+            return false;
+        oZArray.Add("compressor", oCompressor);
+    }
+    else
+    {
+        oZArray.AddNull("compressor");
+    }
+
+    if (nFilterCount == 0)
+    {
+        oZArray.AddNull("filters");
+    }
+    else
+    {
+        CPLJSONArray oFilters;
+        for (int i = 0; i < nFilterCount; ++i)
+        {
+            CPLJSONObject oFilter;
+            if (!GetCodec(aosFilters[i], oFilter))
+                return false;
+            oFilters.Add(oFilter);
+        }
+        oZArray.Add("filters", oFilters);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    KerchunkSerializeAttributes()                     */
+/************************************************************************/
+
+static CPLJSONObject KerchunkSerializeAttributes(
+    const std::vector<std::shared_ptr<GDALAttribute>> &apoAttrs,
+    const std::string &osParentName, bool bContainerIsGroup)
+{
+    ZarrAttributeGroup oAttrGroup(osParentName, bContainerIsGroup);
+    for (const auto &poSrcAttr : apoAttrs)
+    {
+        const auto &osName = poSrcAttr->GetName();
+        const auto &oDT = poSrcAttr->GetDataType();
+        // _FillValue is conveyed by the fill_value member of .zarray
+        if (osName == "_FillValue" || osName == "_ARRAY_DIMENSIONS")
+            continue;
+        if ((oDT.GetClass() != GEDTC_NUMERIC &&
+             oDT.GetClass() != GEDTC_STRING) ||
+            poSrcAttr->GetDimensionCount() > 1)
+        {
+            CPLDebug("ZARR", "Attribute %s of %s not handled", osName.c_str(),
+                     osParentName.c_str());
+            continue;
+        }
+        auto poDstAttr = oAttrGroup.CreateAttribute(
+            osName, poSrcAttr->GetDimensionsSize(), oDT);
+        if (!poDstAttr)
+            continue;
+        const auto oRawResult = poSrcAttr->ReadAsRaw();
+        if (oRawResult.data())
+            poDstAttr->Write(oRawResult.data(), oRawResult.size());
+    }
+    return oAttrGroup.Serialize();
+}
+
+/************************************************************************/
+/*                 KerchunkRefsWriter::CollectGroups()                  */
+/************************************************************************/
+
+void KerchunkRefsWriter::CollectGroups(
+    const std::shared_ptr<GDALGroup> &poGroup, const std::string &osKey,
+    std::vector<std::pair<std::string, std::shared_ptr<GDALGroup>>> &aoGroups)
+{
+    aoGroups.emplace_back(osKey, poGroup);
+    for (const auto &osName : poGroup->GetGroupNames())
+    {
+        auto poSubGroup = poGroup->OpenGroup(osName);
+        if (poSubGroup)
+        {
+            CollectGroups(poSubGroup,
+                          osKey.empty() ? osName : osKey + '/' + osName,
+                          aoGroups);
+        }
+    }
+}
+
+/************************************************************************/
+/*                   KerchunkRefsWriter::WriteArray()                   */
+/************************************************************************/
+
+bool KerchunkRefsWriter::WriteArray(const std::string &osKey,
+                                    const std::shared_ptr<GDALMDArray> &poArray,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressData)
+{
+    const auto &oDT = poArray->GetDataType();
+    const auto eDT = oDT.GetClass() == GEDTC_NUMERIC
+                         ? oDT.GetNumericDataType()
+                         : GDT_Unknown;
+    if (KerchunkGetDType(eDT, false).empty())
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Array %s has a data type not handled. Skipping it",
+                 poArray->GetFullName().c_str());
+        return true;
+    }
+
+    const auto &apoDims = poArray->GetDimensions();
+    const size_t nDimCount = apoDims.size();
+    std::vector<GUInt64> anBlockSize = poArray->GetBlockSize();
+    uint64_t nBlockCount = 1;
+    bool bHasZeroBlockSize = false;
+    for (size_t i = 0; i < nDimCount; ++i)
+    {
+        if (anBlockSize[i] == 0)
+            bHasZeroBlockSize = true;
+    }
+    std::vector<uint64_t> anBlockCount(nDimCount);
+    for (size_t i = 0; i < nDimCount; ++i)
+    {
+        const auto nDimSize = apoDims[i]->GetSize();
+        // The whole array is a single block.
+        if (bHasZeroBlockSize)
+            anBlockSize[i] = std::max<GUInt64>(1, nDimSize);
+        anBlockCount[i] = DIV_ROUND_UP(nDimSize, anBlockSize[i]);
+        if (anBlockCount[i] != 0 &&
+            nBlockCount >
+                std::numeric_limits<uint64_t>::max() / anBlockCount[i])
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Too many blocks in %s",
+                     poArray->GetFullName().c_str());
+            return false;
+        }
+        nBlockCount *= anBlockCount[i];
+    }
+
+    // Fetch the encoding from the first block
+    std::vector<uint64_t> anBlockCoords(nDimCount);
+    GDALMDArrayRawBlockInfo oFirstInfo;
+    const bool bHasRawBlocks =
+        poArray->GetRawBlockInfo(anBlockCoords.data(), oFirstInfo);
+
+    std::string osInlineData;
+    if (!bHasRawBlocks)
+    {
+        // Arrays not backed by raw blocks in a file, like indexing
+        // variables synthesized by the driver, are embedded if small enough.
+        const uint64_t nTotalSize =
+            poArray->GetTotalElementsCount() * oDT.GetSize();
+        if (nTotalSize > m_nMaxInlineSize)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Location of blocks of array %s cannot be determined, "
+                     "and it is too large to be embedded. Skipping it",
+                     poArray->GetFullName().c_str());
+            return true;
+        }
+        for (size_t i = 0; i < nDimCount; ++i)
+            anBlockSize[i] = std::max<GUInt64>(1, apoDims[i]->GetSize());
+        if (nTotalSize > 0)
+        {
+            std::vector<GByte> abyData(static_cast<size_t>(nTotalSize));
+            const std::vector<GUInt64> anStartIdx(nDimCount);
+            std::vector<size_t> anCount(nDimCount);
+            for (size_t i = 0; i < nDimCount; ++i)
+                anCount[i] = static_cast<size_t>(apoDims[i]->GetSize());
+            if (!poArray->Read(anStartIdx.data(), anCount.data(), nullptr,
+                               nullptr, oDT, abyData.data()))
+            {
+                return false;
+            }
+            char *pszBase64 = CPLBase64Encode(static_cast<int>(abyData.size()),
+                                              abyData.data());
+            osInlineData = std::string("base64:").append(pszBase64);
+            CPLFree(pszBase64);
+        }
+    }
+
+    CPLJSONObject oZArray;
+    {
+        CPLJSONArray oChunks;
+        CPLJSONArray oShape;
+        for (size_t i = 0; i < nDimCount; ++i)
+        {
+            oChunks.Add(static_cast<uint64_t>(anBlockSize[i]));
+            oShape.Add(static_cast<uint64_t>(apoDims[i]->GetSize()));
+        }
+        oZArray.Add("chunks", oChunks);
+        const char *pszFilters =
+            bHasRawBlocks ? oFirstInfo.aosInfo.FetchNameValue("FILTERS")
+                          : nullptr;
+        if (!KerchunkSetCodecs(oZArray, pszFilters,
+                               GDALGetDataTypeSizeBytes(eDT)))
+        {
+            CPLError(CE_Warning, CPLE_NotSupported, "Skipping array %s",
+                     poArray->GetFullName().c_str());
+            return true;
+        }
+        const bool bBigEndian =
+            bHasRawBlocks ? EQUAL(oFirstInfo.aosInfo.FetchNameValueDef(
+                                      "ENDIANNESS", "LITTLE"),
+                                  "BIG")
+                          : !CPL_IS_LSB;
+        oZArray.Add("dtype", KerchunkGetDType(eDT, bBigEndian));
+        KerchunkSetFillValue(oZArray, poArray.get());
+        oZArray.Add("order", "C");
+        oZArray.Add("shape", oShape);
+        oZArray.Add("zarr_format", 2);
+    }
+    WriteInlineContent(osKey + "/.zarray",
+                       oZArray.Format(CPLJSONObject::PrettyFormat::Plain));
+
+    CPLJSONObject oZAttrs = KerchunkSerializeAttributes(
+        poArray->GetAttributes(), poArray->GetFullName(), false);
+    {
+        CPLJSONArray oArrayDims;
+        for (const auto &poDim : apoDims)
+            oArrayDims.Add(poDim->GetName());
+        oZAttrs.Add("_ARRAY_DIMENSIONS", oArrayDims);
+    }
+    WriteInlineContent(osKey + "/.zattrs",
+                       oZAttrs.Format(CPLJSONObject::PrettyFormat::Plain));
+
+    const auto GetChunkKey = [&osKey, nDimCount, &anBlockCoords]()
+    {
+        std::string osChunkKey(osKey);
+        osChunkKey += '/';
+        if (nDimCount == 0)
+            osChunkKey += '0';
+        for (size_t i = 0; i < nDimCount; ++i)
+        {
+            if (i > 0)
+                osChunkKey += '.';
+            osChunkKey += std::to_string(anBlockCoords[i]);
+        }
+        return osChunkKey;
+    };
+
+    if (!bHasRawBlocks)
+    {
+        if (!osInlineData.empty())
+            WriteInlineContent(GetChunkKey(), osInlineData);
+        return !m_bWriteError;
+    }
+
+    // Output all allocated blocks, iterating in row-major order
+    const char *pszFirstFilters = oFirstInfo.aosInfo.FetchNameValue("FILTERS");
+    for (uint64_t iBlock = 0; iBlock < nBlockCount; ++iBlock)
+    {
+        GDALMDArrayRawBlockInfo oInfo;
+        if (iBlock == 0)
+            oInfo = oFirstInfo;
+        else if (!poArray->GetRawBlockInfo(anBlockCoords.data(), oInfo))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot get location of block %s",
+                     GetChunkKey().c_str());
+            return false;
+        }
+        const char *pszFilters = oInfo.aosInfo.FetchNameValue("FILTERS");
+        if ((pszFilters == nullptr) != (pszFirstFilters == nullptr) ||
+            (pszFilters && strcmp(pszFilters, pszFirstFilters) != 0))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Block %s is not encoded as the first one",
+                     GetChunkKey().c_str());
+            return false;
+        }
+
+        if (!oInfo.osFilename.empty() && oInfo.nSize > 0)
+        {
+            m_oWriter.AddObjKey(GetChunkKey());
+            m_oWriter.StartArray();
+            m_oWriter.Add(KerchunkURIFromFilename(oInfo.osFilename));
+            m_oWriter.Add(oInfo.nOffset);
+            m_oWriter.Add(oInfo.nSize);
+            m_oWriter.EndArray();
+        }
+        if (m_bWriteError)
+            return false;
+
+        for (size_t i = nDimCount; i > 0;)
+        {
+            --i;
+            if (++anBlockCoords[i] < anBlockCount[i])
+                break;
+            anBlockCoords[i] = 0;
+        }
+
+        if (pfnProgress && ((iBlock + 1) % 1000) == 0 &&
+            !pfnProgress(static_cast<double>(iBlock + 1) /
+                             static_cast<double>(nBlockCount),
+                         "", pProgressData))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      KerchunkRefsWriter::Write()                     */
+/************************************************************************/
+
+bool KerchunkRefsWriter::Write(const std::shared_ptr<GDALGroup> &poRootGroup,
+                               GDALProgressFunc pfnProgress,
+                               void *pProgressData)
+{
+    std::vector<std::pair<std::string, std::shared_ptr<GDALGroup>>> aoGroups;
+    CollectGroups(poRootGroup, std::string(), aoGroups);
+
+    std::vector<std::pair<std::string, std::shared_ptr<GDALMDArray>>>
+        aoArrays;
+    for (const auto &[osKey, poGroup] : aoGroups)
+    {
+        for (const auto &osName : poGroup->GetMDArrayNames())
+        {
+            auto poArray = poGroup->OpenMDArray(osName);
+            if (poArray)
+            {
+                aoArrays.emplace_back(
+                    osKey.empty() ? osName : osKey + '/' + osName,
+                    std::move(poArray));
+            }
+        }
+    }
+
+    m_oWriter.StartObj();
+    m_oWriter.AddObjKey("version");
+    m_oWriter.Add(1);
+    m_oWriter.AddObjKey("refs");
+    m_oWriter.StartObj();
+
+    for (const auto &[osKey, poGroup] : aoGroups)
+    {
+        const std::string osPrefix(osKey.empty() ? osKey : osKey + '/');
+        WriteInlineContent(osPrefix + ".zgroup", "{\"zarr_format\":2}");
+        const CPLJSONObject oZAttrs = KerchunkSerializeAttributes(
+            poGroup->GetAttributes(), poGroup->GetFullName(), true);
+        if (!oZAttrs.GetChildren().empty())
+        {
+            WriteInlineContent(
+                osPrefix + ".zattrs",
+                oZAttrs.Format(CPLJSONObject::PrettyFormat::Plain));
+        }
+    }
+
+    for (size_t i = 0; i < aoArrays.size(); ++i)
+    {
+        void *pScaledProgressData = GDALCreateScaledProgress(
+            static_cast<double>(i) / static_cast<double>(aoArrays.size()),
+            static_cast<double>(i + 1) / static_cast<double>(aoArrays.size()),
+            pfnProgress, pProgressData);
+        const bool bOK =
+            WriteArray(aoArrays[i].first, aoArrays[i].second,
+                       pScaledProgressData ? GDALScaledProgress : nullptr,
+                       pScaledProgressData);
+        GDALDestroyScaledProgress(pScaledProgressData);
+        if (!bOK)
+            return false;
+    }
+
+    m_oWriter.EndObj();
+    m_oWriter.EndObj();
+
+    return !m_bWriteError;
+}
+
+/************************************************************************/
+/*                   VSIKerchunkCreateReferences()                      */
+/************************************************************************/
+
+/** Generate Kerchunk references to the blocks of the arrays of a
+ * multidimensional dataset.
+ *
+ * The location of blocks is retrieved with GDALMDArray::GetRawBlockInfo().
+ *
+ * @param poSrcDS Source multidimensional dataset.
+ * @param pszDstFilename Output file (JSON format) or directory (Parquet
+ *                       format).
+ * @param bParquet Whether to output a Parquet reference store.
+ * @param nMaxInlineSize Maximum size in bytes of arrays whose blocks cannot
+ *                       be located and that are embedded in the references.
+ */
+bool VSIKerchunkCreateReferences(GDALDataset *poSrcDS,
+                                 const char *pszDstFilename, bool bParquet,
+                                 size_t nMaxInlineSize,
+                                 GDALProgressFunc pfnProgress,
+                                 void *pProgressData)
+{
+    auto poRootGroup = poSrcDS->GetRootGroup();
+    if (!poRootGroup)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s is not a multidimensional dataset",
+                 poSrcDS->GetDescription());
+        return false;
+    }
+
+    if (bParquet && GDALGetDriverByName("PARQUET") == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Generation of a Parquet reference store is not possible "
+                 "because the PARQUET driver is not available.");
+        return false;
+    }
+
+    // Parquet references are generated from temporary JSON references
+    const std::string osJSONFilename(
+        bParquet ? VSIMemGenerateHiddenFilename("kerchunk.json")
+                 : pszDstFilename);
+    auto poFile = std::unique_ptr<VSIVirtualHandle>(
+        VSIFOpenL(osJSONFilename.c_str(), "wb"));
+    if (!poFile)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osJSONFilename.c_str());
+        return false;
+    }
+
+    void *pScaledProgressData = GDALCreateScaledProgress(
+        0.0, bParquet ? 0.5 : 1.0, pfnProgress, pProgressData);
+    bool bRet;
+    {
+        KerchunkRefsWriter oWriter(poFile.get(), nMaxInlineSize);
+        bRet = oWriter.Write(poRootGroup,
+                             pScaledProgressData ? GDALScaledProgress : nullptr,
+                             pScaledProgressData);
+    }
+    GDALDestroyScaledProgress(pScaledProgressData);
+    bRet = (poFile->Close() == 0) && bRet;
+    poFile.reset();
+
+    if (bRet && bParquet)
+    {
+        pScaledProgressData =
+            GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData);
+        bRet = VSIKerchunkConvertJSONToParquet(
+            osJSONFilename.c_str(), pszDstFilename,
+            pScaledProgressData ? GDALScaledProgress : nullptr,
+            pScaledProgressData);
+        GDALDestroyScaledProgress(pScaledProgressData);
+    }
+    if (bParquet || !bRet)
+        VSIUnlink(osJSONFilename.c_str());
+
+    if (bRet && pfnProgress)
+        pfnProgress(1.0, "", pProgressData);
+
+    return bRet;
+}
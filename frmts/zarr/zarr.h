@@ -15,11 +15,13 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -801,6 +803,11 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    // Set during IWrite() when complete tiles may be encoded and written by
+    // worker threads.
+    struct TileWriteContext;
+    mutable std::unique_ptr<TileWriteContext> m_poTileWriteContext{};
+
     static uint64_t
     ComputeTileCount(const std::string &osName,
                      const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -832,6 +839,21 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     virtual bool FlushDirtyTile() const = 0;
 
+    bool CanSubmitTileWriteJob() const;
+
+    bool SubmitTileWriteJob(std::function<bool()> &&oFunc) const;
+
+    void StartTileWriteJobs(const GUInt64 *arrayStartIdx, const size_t *count,
+                            const GInt64 *arrayStep);
+
+    bool FinishTileWriteJobs();
+
+    bool IWriteInternal(const GUInt64 *arrayStartIdx, const size_t *count,
+                        const GInt64 *arrayStep,
+                        const GPtrDiff_t *bufferStride,
+                        const GDALExtendedDataType &bufferDataType,
+                        const void *pSrcBuffer);
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     void NotifyChildrenOfRenaming() override;
@@ -857,6 +879,9 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     bool IsEmptyTile(const ZarrByteVectorQuickResize &abyTile) const;
 
+    bool PrefetchTiles(const GUInt64 *arrayStartIdx, const size_t *count,
+                       const GInt64 *arrayStep, bool &bPrefetched) const;
+
     bool IAdviseReadCommon(const GUInt64 *arrayStartIdx, const size_t *count,
                            CSLConstList papszOptions,
                            std::vector<uint64_t> &anIndicesCur,
@@ -1102,6 +1127,12 @@ class ZarrV2Array final : public ZarrArray
                            ZarrByteVectorQuickResize &abyTmpRawTileData,
                            ZarrByteVectorQuickResize &abyDecodedTileData) const;
 
+    bool EncodeAndWriteTile(const std::string &osFilename,
+                            ZarrByteVectorQuickResize &abyRawTileData,
+                            ZarrByteVectorQuickResize &abyTmpRawTileData,
+                            const ZarrByteVectorQuickResize &abyDecodedTileData)
+        const;
+
     // Disable copy constructor and assignment operator
     ZarrV2Array(const ZarrV2Array &) = delete;
     ZarrV2Array &operator=(const ZarrV2Array &) = delete;
@@ -1159,6 +1190,8 @@ struct ZarrArrayMetadata
 {
     DtypeElt oElt{};
     std::vector<size_t> anBlockSizes{};
+    // Fill value in the native representation of oElt, or empty if unknown
+    std::vector<GByte> abyFillValue{};
 
     size_t GetEltCount() const
     {
@@ -1429,6 +1462,128 @@ class ZarrV3CodecTranspose final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                           ZarrV3CodecCRC32C                          */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/crc32c/v1.0.html
+class ZarrV3CodecCRC32C final : public ZarrV3Codec
+{
+  public:
+    static constexpr const char *NAME = "crc32c";
+
+    ZarrV3CodecCRC32C();
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+};
+
+class ZarrV3CodecSequence;
+
+/************************************************************************/
+/*                      ZarrV3CodecShardingIndexed                      */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html
+class ZarrV3CodecShardingIndexed final : public ZarrV3Codec
+{
+    // Shape of the inner chunks
+    std::vector<size_t> m_anInnerBlockSize{};
+    // Number of inner chunks along each dimension of a shard
+    std::vector<size_t> m_anInnerChunkCount{};
+    size_t m_nInnerChunkCount = 0;
+    std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
+    std::unique_ptr<ZarrV3CodecSequence> m_poIndexCodecs{};
+    size_t m_nIndexSize = 0;
+    bool m_bIndexAtEnd = true;
+
+  public:
+    static constexpr const char *NAME = "sharding_indexed";
+
+    // Offset and size of an inner chunk absent from a shard
+    static constexpr uint64_t EMPTY_CHUNK = ~static_cast<uint64_t>(0);
+
+    ZarrV3CodecShardingIndexed();
+    ~ZarrV3CodecShardingIndexed() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::ARRAY;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject
+    GetConfiguration(const std::vector<GUInt64> &anInnerBlockSize,
+                     const CPLJSONArray &oCodecs);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    const std::vector<size_t> &GetInnerBlockSize() const
+    {
+        return m_anInnerBlockSize;
+    }
+
+    const std::vector<size_t> &GetInnerChunkCount() const
+    {
+        return m_anInnerChunkCount;
+    }
+
+    const ZarrV3CodecSequence &GetInnerCodecs() const
+    {
+        return *m_poCodecs;
+    }
+
+    // Size in bytes of the encoded shard index
+    size_t GetIndexSize() const
+    {
+        return m_nIndexSize;
+    }
+
+    bool IsIndexAtEnd() const
+    {
+        return m_bIndexAtEnd;
+    }
+
+    // Decodes the shard index in abyIndex, which must be GetIndexSize() long,
+    // into pairs of (offset, size) for each inner chunk.
+    // Not thread safe.
+    bool DecodeIndex(ZarrByteVectorQuickResize &abyIndex,
+                     std::vector<uint64_t> &anIndex) const;
+};
+
 /************************************************************************/
 /*                          ZarrV3CodecSequence                         */
 /************************************************************************/
@@ -1460,6 +1615,9 @@ class ZarrV3CodecSequence
 
     bool Encode(ZarrByteVectorQuickResize &abyBuffer);
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
+
+    // Returns the sharding codec if it is the only codec of the sequence
+    const ZarrV3CodecShardingIndexed *GetShardingCodec() const;
 };
 
 /************************************************************************/
@@ -1471,6 +1629,15 @@ class ZarrV3Array final : public ZarrArray
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
 
+    // When shards are read partially, blocks of the array are the inner
+    // chunks of the sharding_indexed codec, and m_poCodecs is the codec
+    // sequence of inner chunks.
+    std::unique_ptr<ZarrV3CodecSequence> m_poShardCodecs{};
+    const ZarrV3CodecShardingIndexed *m_poShardingCodec = nullptr;
+    std::vector<GUInt64> m_anShardBlockSize{};
+    mutable lru11::Cache<uint64_t, std::shared_ptr<std::vector<uint64_t>>>
+        m_oShardIndexCache{};
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1492,6 +1659,24 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    bool EncodeAndWriteTile(const std::string &osFilename,
+                            ZarrV3CodecSequence *poCodecs,
+                            ZarrByteVectorQuickResize &abyRawTileData) const;
+
+    void GetShardIndices(const uint64_t *tileIndices,
+                         std::vector<uint64_t> &anShardIndices,
+                         size_t &nInnerChunkIdx) const;
+
+    std::shared_ptr<std::vector<uint64_t>>
+    GetShardIndex(VSILFILE *fp, const std::string &osFilename,
+                  const uint64_t *shardIndices, bool bUseMutex) const;
+
+    void DecodeSourceElts(const ZarrByteVectorQuickResize &abyRawTileData,
+                          ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    bool IAdviseReadSharded(const std::vector<uint64_t> &anReqTilesIndices,
+                            size_t nReqTiles, int nThreadsMax) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1513,6 +1698,9 @@ class ZarrV3Array final : public ZarrArray
         m_poCodecs = std::move(poCodecs);
     }
 
+    void SetShardCodecs(std::unique_ptr<ZarrV3CodecSequence> &&poShardCodecs,
+                        const std::vector<GUInt64> &anShardBlockSize);
+
     void Flush() override;
 
   protected:
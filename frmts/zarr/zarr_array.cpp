@@ -13,11 +13,15 @@
 #include "zarr.h"
 #include "ucs4_utf8.hpp"
 
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "netcdf_cf_constants.h"  // for CF_UNITS, etc
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
@@ -148,6 +152,18 @@ inline char *UCS4ToUTF8(const uint8_t *ucs4Ptr, size_t nSize, bool needByteSwap)
     return nTotalTileCount;
 }
 
+/************************************************************************/
+/*                     ZarrArray::TileWriteContext                      */
+/************************************************************************/
+
+struct ZarrArray::TileWriteContext
+{
+    CPLJobQueuePtr poJobQueue{};
+    int nMaxPendingJobs = 0;
+    std::atomic<bool> bSuccess{true};
+    CPLErrorAccumulator oErrorAccumulator{};
+};
+
 /************************************************************************/
 /*                         ZarrArray::ZarrArray()                       */
 /************************************************************************/
@@ -998,6 +1014,79 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                      ZarrArray::PrefetchTiles()                      */
+/************************************************************************/
+
+// If GDAL_NUM_THREADS allows it, fetches and decodes in parallel the tiles
+// intersecting the area of a IRead() request, using IAdviseRead(), so that
+// IRead() finds them in m_oMapTileIndexToCachedTile.
+// arrayStep[] values are assumed to be positive.
+bool ZarrArray::PrefetchTiles(const GUInt64 *arrayStartIdx, const size_t *count,
+                              const GInt64 *arrayStep,
+                              bool &bPrefetched) const
+{
+    bPrefetched = false;
+
+    // Do not interfere with tiles cached by an explicit AdviseRead(), and
+    // do not read from storage a tile whose modified content is not flushed.
+    if (!m_oMapTileIndexToCachedTile.empty() || m_bDirtyTile)
+        return true;
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    if (nThreads <= 1)
+        return true;
+    nThreads = std::min(nThreads, 1024);
+
+    const size_t nDims = m_aoDims.size();
+    std::vector<GUInt64> anStartIdx(nDims);
+    std::vector<size_t> anCount(nDims);
+    uint64_t nTiles = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        // Subsampling requests skipping whole tiles are not worth it
+        if (static_cast<GUInt64>(arrayStep[i]) > m_anBlockSize[i])
+            return true;
+        anStartIdx[i] = arrayStartIdx[i];
+        anCount[i] = (count[i] - 1) * static_cast<size_t>(arrayStep[i]) + 1;
+        nTiles *= (anStartIdx[i] + anCount[i] - 1) / m_anBlockSize[i] -
+                  anStartIdx[i] / m_anBlockSize[i] + 1;
+    }
+    if (nTiles < 2)
+        return true;
+
+    // Use at most half of the remaining block cache size, as AdviseRead()
+    // does by default, and silently fallback to sequential decoding otherwise
+    const uint64_t nCacheSize = std::min(
+        static_cast<uint64_t>(
+            std::max<GIntBig>(0, GDALGetCacheMax64() - GDALGetCacheUsed64()) /
+            2),
+        static_cast<uint64_t>(std::numeric_limits<size_t>::max() / 2));
+    if (nTiles > nCacheSize / std::max(m_nTileSize, nDims))
+    {
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "IRead(): not enough cache to decode " CPL_FRMT_GUIB
+                 " tiles in parallel",
+                 static_cast<GUIntBig>(nTiles));
+        return true;
+    }
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", nThreads));
+    aosOptions.SetNameValue(
+        "CACHE_SIZE",
+        CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(nCacheSize)));
+    if (!IAdviseRead(anStartIdx.data(), anCount.data(), aosOptions.List()))
+    {
+        m_oMapTileIndexToCachedTile.clear();
+        return false;
+    }
+    bPrefetched = true;
+    return true;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -1070,6 +1159,23 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
         bufferStride = bufferStrideMod.data();
     }
 
+    // Decode the intersecting tiles in parallel if possible. The tile cache
+    // is only kept for the duration of this request.
+    bool bPrefetched = false;
+    if (!PrefetchTiles(arrayStartIdx, count, arrayStep, bPrefetched))
+        return false;
+    struct CachedTilesCleaner
+    {
+        const ZarrArray *m_poArray;
+        const bool m_bClean;
+
+        ~CachedTilesCleaner()
+        {
+            if (m_bClean)
+                m_poArray->m_oMapTileIndexToCachedTile.clear();
+        }
+    } oCachedTilesCleaner{this, bPrefetched};
+
     std::vector<uint64_t> indicesOuterLoop(nDims + 1);
     std::vector<GByte *> dstPtrStackOuterLoop(nDims + 1);
 
@@ -1495,6 +1601,108 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                   ZarrArray::StartTileWriteJobs()                    */
+/************************************************************************/
+
+// If GDAL_NUM_THREADS allows it, and the IWrite() request covers several
+// tiles, set up a job queue so that FlushDirtyTile() can hand over complete
+// tiles to worker threads for encoding, compression and writing.
+void ZarrArray::StartTileWriteJobs(const GUInt64 *arrayStartIdx,
+                                   const size_t *count,
+                                   const GInt64 *arrayStep)
+{
+    CPLAssert(!m_poTileWriteContext);
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    if (nThreads <= 1)
+        return;
+    nThreads = std::min(nThreads, 1024);
+
+    uint64_t nTiles = 1;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        // Only contiguous requests can fill whole tiles
+        if (arrayStep[i] != 1 && count[i] > 1)
+            return;
+        nTiles *= (arrayStartIdx[i] + count[i] - 1) / m_anBlockSize[i] -
+                  arrayStartIdx[i] / m_anBlockSize[i] + 1;
+    }
+    if (nTiles < 2)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return;
+
+    auto poContext = std::make_unique<TileWriteContext>();
+    poContext->poJobQueue = poThreadPool->CreateJobQueue();
+    // Each pending job owns a copy of a tile, so this bounds memory usage
+    poContext->nMaxPendingJobs =
+        static_cast<int>(std::min<uint64_t>(nThreads, nTiles));
+    m_poTileWriteContext = std::move(poContext);
+}
+
+/************************************************************************/
+/*                  ZarrArray::CanSubmitTileWriteJob()                  */
+/************************************************************************/
+
+// Tiles whose decoded representation holds dynamically allocated strings
+// are always written synchronously.
+bool ZarrArray::CanSubmitTileWriteJob() const
+{
+    return m_poTileWriteContext != nullptr && m_abyDecodedTileData.empty();
+}
+
+/************************************************************************/
+/*                   ZarrArray::SubmitTileWriteJob()                    */
+/************************************************************************/
+
+// oFunc must only access ZarrArray members that are not modified during
+// IWrite(), and own the tile buffer it encodes.
+bool ZarrArray::SubmitTileWriteJob(std::function<bool()> &&oFunc) const
+{
+    TileWriteContext *poContext = m_poTileWriteContext.get();
+    CPLAssert(poContext);
+
+    poContext->poJobQueue->WaitCompletion(poContext->nMaxPendingJobs - 1);
+    if (!poContext->bSuccess)
+        return false;
+
+    if (!poContext->poJobQueue->SubmitJob(
+            [poContext, oFunc]()
+            {
+                if (!poContext->bSuccess)
+                    return;
+                auto oAccumulator =
+                    poContext->oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                if (!oFunc())
+                    poContext->bSuccess = false;
+            }))
+    {
+        return oFunc();
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   ZarrArray::FinishTileWriteJobs()                   */
+/************************************************************************/
+
+bool ZarrArray::FinishTileWriteJobs()
+{
+    if (!m_poTileWriteContext)
+        return true;
+    m_poTileWriteContext->poJobQueue->WaitCompletion();
+    m_poTileWriteContext->oErrorAccumulator.ReplayErrors();
+    const bool bRet = m_poTileWriteContext->bSuccess;
+    m_poTileWriteContext.reset();
+    return bRet;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IWrite()                        */
 /************************************************************************/
@@ -1512,6 +1720,23 @@ bool ZarrArray::IWrite(const GUInt64 *arrayStartIdx, const size_t *count,
 
     m_oMapTileIndexToCachedTile.clear();
 
+    StartTileWriteJobs(arrayStartIdx, count, arrayStep);
+    const bool bRet = IWriteInternal(arrayStartIdx, count, arrayStep,
+                                     bufferStride, bufferDataType, pSrcBuffer);
+    const bool bJobsOK = FinishTileWriteJobs();
+    return bRet && bJobsOK;
+}
+
+/************************************************************************/
+/*                       ZarrArray::IWriteInternal()                    */
+/************************************************************************/
+
+bool ZarrArray::IWriteInternal(const GUInt64 *arrayStartIdx,
+                               const size_t *count, const GInt64 *arrayStep,
+                               const GPtrDiff_t *bufferStride,
+                               const GDALExtendedDataType &bufferDataType,
+                               const void *pSrcBuffer)
+{
     // Need to be kept in top-level scope
     std::vector<GUInt64> arrayStartIdxMod;
     std::vector<GInt64> arrayStepMod;
@@ -817,8 +817,6 @@ bool ZarrV2Array::FlushDirtyTile() const
 
     std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
 
-    const size_t nSourceSize =
-        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
     const auto &abyTile =
         m_abyDecodedTileData.empty() ? m_abyRawTileData : m_abyDecodedTileData;
 
@@ -837,12 +835,60 @@ bool ZarrV2Array::FlushDirtyTile() const
         return true;
     }
 
-    if (!m_abyDecodedTileData.empty())
+    if (CanSubmitTileWriteJob())
+    {
+        // Hand over the tile content to a worker thread, and give the
+        // array new working buffers for the next tile.
+        auto poRawTileData = std::make_shared<ZarrByteVectorQuickResize>();
+        auto poTmpRawTileData = std::make_shared<ZarrByteVectorQuickResize>();
+        std::swap(*poRawTileData, m_abyRawTileData);
+        std::swap(*poTmpRawTileData, m_abyTmpRawTileData);
+        m_bCachedTiledValid = false;
+        if (!AllocateWorkingBuffers(m_abyRawTileData, m_abyTmpRawTileData,
+                                    m_abyDecodedTileData))
+        {
+            return false;
+        }
+        return SubmitTileWriteJob(
+            [this, osFilename, poRawTileData, poTmpRawTileData]()
+            {
+                const ZarrByteVectorQuickResize abyNoDecodedTileData;
+                return EncodeAndWriteTile(osFilename, *poRawTileData,
+                                          *poTmpRawTileData,
+                                          abyNoDecodedTileData);
+            });
+    }
+
+    return EncodeAndWriteTile(osFilename, m_abyRawTileData, m_abyTmpRawTileData,
+                              m_abyDecodedTileData);
+}
+
+/************************************************************************/
+/*                  ZarrV2Array::EncodeAndWriteTile()                   */
+/************************************************************************/
+
+bool ZarrV2Array::EncodeAndWriteTile(
+    const std::string &osFilename, ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyTmpRawTileData,
+    const ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called concurrently from several threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyTmpRawTileData cannot_use_here
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+
+    if (!abyDecodedTileData.empty())
     {
         const size_t nDTSize = m_oType.GetSize();
-        const size_t nValues = m_abyDecodedTileData.size() / nDTSize;
-        GByte *pDst = &m_abyRawTileData[0];
-        const GByte *pSrc = m_abyDecodedTileData.data();
+        const size_t nValues = abyDecodedTileData.size() / nDTSize;
+        GByte *pDst = &abyRawTileData[0];
+        const GByte *pSrc = abyDecodedTileData.data();
         for (size_t i = 0; i < nValues;
              i++, pDst += nSourceSize, pSrc += nDTSize)
         {
@@ -852,11 +898,11 @@ bool ZarrV2Array::FlushDirtyTile() const
 
     if (m_bFortranOrder && !m_aoDims.empty())
     {
-        BlockTranspose(m_abyRawTileData, m_abyTmpRawTileData, false);
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        BlockTranspose(abyRawTileData, abyTmpRawTileData, false);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
+    size_t nRawDataSize = abyRawTileData.size();
     for (const auto &oFilter : m_oFiltersArray)
     {
         const auto osFilterId = oFilter["id"].ToString();
@@ -878,10 +924,10 @@ bool ZarrV2Array::FlushDirtyTile() const
             aosOptions.SetNameValue(obj.GetName().c_str(),
                                     obj.ToString().c_str());
         }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
         if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
                 aosOptions.List(), psFilterCompressor->user_data))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -891,7 +937,7 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
 
         nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
     if (m_osDimSeparator == "/")
@@ -900,7 +946,9 @@ bool ZarrV2Array::FlushDirtyTile() const
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            // Another thread may have created it in the meantime
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0 &&
+                VSIStatL(osDir.c_str(), &sStat) != 0)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
@@ -930,7 +978,7 @@ bool ZarrV2Array::FlushDirtyTile() const
     bool bRet = true;
     if (m_psCompressor == nullptr)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+        if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
             nRawDataSize)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -976,7 +1024,7 @@ bool ZarrV2Array::FlushDirtyTile() const
             }
 
             if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
+                    abyRawTileData.data(), nRawDataSize, &out_buffer,
                     &out_size, aosOptions.List(), m_psCompressor->user_data))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -998,6 +1046,9 @@ bool ZarrV2Array::FlushDirtyTile() const
     VSIFCloseL(fp);
 
     return bRet;
+#undef m_abyTmpRawTileData
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
 }
 
 /************************************************************************/
@@ -16,6 +16,7 @@
 #include "zarr.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
@@ -145,7 +146,8 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         CPLJSONObject oConfiguration;
         oChunkGrid.Add("configuration", oConfiguration);
         CPLJSONArray oChunks;
-        for (const auto nBlockSize : m_anBlockSize)
+        for (const auto nBlockSize :
+             m_poShardCodecs ? m_anShardBlockSize : m_anBlockSize)
         {
             oChunks.Add(static_cast<GInt64>(nBlockSize));
         }
@@ -205,7 +207,11 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         }
     }
 
-    if (m_poCodecs)
+    if (m_poShardCodecs)
+    {
+        oRoot.Add("codecs", m_poShardCodecs->GetJSon());
+    }
+    else if (m_poCodecs)
     {
         oRoot.Add("codecs", m_poCodecs->GetJSon());
     }
@@ -241,6 +247,107 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
     oDoc.Save(m_osFilename);
 }
 
+/************************************************************************/
+/*                     ZarrV3Array::SetShardCodecs()                    */
+/************************************************************************/
+
+void ZarrV3Array::SetShardCodecs(
+    std::unique_ptr<ZarrV3CodecSequence> &&poShardCodecs,
+    const std::vector<GUInt64> &anShardBlockSize)
+{
+    m_poShardCodecs = std::move(poShardCodecs);
+    m_poShardingCodec = m_poShardCodecs->GetShardingCodec();
+    CPLAssert(m_poShardingCodec);
+    m_anShardBlockSize = anShardBlockSize;
+    m_poCodecs = m_poShardingCodec->GetInnerCodecs().Clone();
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::GetShardIndices()                    */
+/************************************************************************/
+
+// Computes the indices of the shard containing the inner chunk of indices
+// tileIndices[], and the index of the inner chunk within the shard.
+void ZarrV3Array::GetShardIndices(const uint64_t *tileIndices,
+                                  std::vector<uint64_t> &anShardIndices,
+                                  size_t &nInnerChunkIdx) const
+{
+    const auto &anInnerChunkCount = m_poShardingCodec->GetInnerChunkCount();
+    anShardIndices.resize(m_aoDims.size());
+    nInnerChunkIdx = 0;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        anShardIndices[i] = tileIndices[i] / anInnerChunkCount[i];
+        nInnerChunkIdx = nInnerChunkIdx * anInnerChunkCount[i] +
+                         static_cast<size_t>(tileIndices[i] %
+                                             anInnerChunkCount[i]);
+    }
+}
+
+/************************************************************************/
+/*                     ZarrV3Array::GetShardIndex()                     */
+/************************************************************************/
+
+// Returns the (offset, size) pairs of the inner chunks of a shard, reading
+// them from fp if they are not already cached.
+std::shared_ptr<std::vector<uint64_t>>
+ZarrV3Array::GetShardIndex(VSILFILE *fp, const std::string &osFilename,
+                           const uint64_t *shardIndices, bool bUseMutex) const
+{
+    uint64_t nShardIdx = 0;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        nShardIdx = nShardIdx * cpl::div_round_up(m_aoDims[i]->GetSize(),
+                                                  m_anShardBlockSize[i]) +
+                    shardIndices[i];
+    }
+
+    std::shared_ptr<std::vector<uint64_t>> panIndex;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        if (m_oShardIndexCache.tryGet(nShardIdx, panIndex))
+            return panIndex;
+    }
+
+    const size_t nIndexSize = m_poShardingCodec->GetIndexSize();
+    vsi_l_offset nIndexOffset = 0;
+    if (m_poShardingCodec->IsIndexAtEnd())
+    {
+        VSIFSeekL(fp, 0, SEEK_END);
+        const auto nFileSize = VSIFTellL(fp);
+        if (nFileSize < nIndexSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Shard %s is too small to contain its index",
+                     osFilename.c_str());
+            return nullptr;
+        }
+        nIndexOffset = nFileSize - nIndexSize;
+    }
+
+    ZarrByteVectorQuickResize abyIndex;
+    abyIndex.resize(nIndexSize);
+    if (VSIFSeekL(fp, nIndexOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyIndex.data(), 1, nIndexSize, fp) != nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not read index of shard %s", osFilename.c_str());
+        return nullptr;
+    }
+
+    panIndex = std::make_shared<std::vector<uint64_t>>();
+    std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+    if (bUseMutex)
+        oLock.lock();
+    // DecodeIndex() is not thread safe
+    if (!m_poShardingCodec->DecodeIndex(abyIndex, *panIndex))
+        return nullptr;
+    m_oShardIndexCache.insert(nShardIdx, panIndex);
+    return panIndex;
+}
+
 /************************************************************************/
 /*                  ZarrV3Array::NeedDecodedBuffer()                    */
 /************************************************************************/
@@ -382,17 +489,28 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
-    std::string osFilename = BuildTileFilename(tileIndices);
+    std::vector<uint64_t> anShardIndices;
+    size_t nInnerChunkIdx = 0;
+    if (m_poShardingCodec)
+        GetShardIndices(tileIndices, anShardIndices, nInnerChunkIdx);
+
+    std::string osFilename = BuildTileFilename(
+        m_poShardingCodec ? anShardIndices.data() : tileIndices);
 
     // For network file systems, get the streaming version of the filename,
-    // as we don't need arbitrary seeking in the file
-    osFilename = VSIFileManager::GetHandler(osFilename.c_str())
-                     ->GetStreamingFilename(osFilename);
+    // as we don't need arbitrary seeking in the file (unless it is a shard)
+    if (!m_poShardingCodec)
+    {
+        osFilename = VSIFileManager::GetHandler(osFilename.c_str())
+                         ->GetStreamingFilename(osFilename);
+    }
 
     // First if we have a tile presence cache, check tile presence from it
     if (bUseMutex)
         m_oMutex.lock();
-    auto poTilePresenceArray = OpenTilePresenceCache(false);
+    std::shared_ptr<GDALMDArray> poTilePresenceArray;
+    if (!m_poShardingCodec)
+        poTilePresenceArray = OpenTilePresenceCache(false);
     if (poTilePresenceArray)
     {
         std::vector<GUInt64> anTileIdx(m_aoDims.size());
@@ -465,7 +583,76 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bool bRet = true;
     size_t nRawDataSize = abyRawTileData.size();
-    if (poCodecs == nullptr)
+    if (m_poShardingCodec)
+    {
+        // Only read the inner chunk from the shard
+        const auto panIndex =
+            GetShardIndex(fp, osFilename, anShardIndices.data(), bUseMutex);
+        if (!panIndex)
+        {
+            bRet = false;
+        }
+        else
+        {
+            const uint64_t nOffset = (*panIndex)[2 * nInnerChunkIdx];
+            const uint64_t nSize = (*panIndex)[2 * nInnerChunkIdx + 1];
+            if (nOffset == ZarrV3CodecShardingIndexed::EMPTY_CHUNK &&
+                nSize == ZarrV3CodecShardingIndexed::EMPTY_CHUNK)
+            {
+                VSIFCloseL(fp);
+                CPLDebugOnly(ZARR_DEBUG_KEY,
+                             "Inner chunk %u of shard %s missing (=nodata)",
+                             static_cast<unsigned>(nInnerChunkIdx),
+                             osFilename.c_str());
+                bMissingTileOut = true;
+                return true;
+            }
+            if (nSize >
+                static_cast<uint64_t>(std::numeric_limits<int>::max()))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too large inner chunk in shard %s",
+                         osFilename.c_str());
+                bRet = false;
+            }
+            else
+            {
+                try
+                {
+                    abyRawTileData.resize(static_cast<size_t>(nSize));
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate memory for inner chunk of "
+                             "shard %s",
+                             osFilename.c_str());
+                    bRet = false;
+                }
+
+                if (bRet && (VSIFSeekL(fp, nOffset, SEEK_SET) != 0 ||
+                             VSIFReadL(abyRawTileData.data(), 1,
+                                       abyRawTileData.size(),
+                                       fp) != abyRawTileData.size()))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Could not read inner chunk of shard %s "
+                             "correctly",
+                             osFilename.c_str());
+                    bRet = false;
+                }
+                else if (bRet && !poCodecs->Decode(abyRawTileData))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Decompression of inner chunk of shard %s "
+                             "failed",
+                             osFilename.c_str());
+                    bRet = false;
+                }
+            }
+        }
+    }
+    else if (poCodecs == nullptr)
     {
         nRawDataSize = VSIFReadL(&abyRawTileData[0], 1, nRawDataSize, fp);
     }
@@ -531,20 +718,7 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
     }
 
     if (!abyDecodedTileData.empty())
-    {
-        const size_t nSourceSize =
-            m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
-        const auto nDTSize = m_oType.GetSize();
-        const size_t nValues = abyDecodedTileData.size() / nDTSize;
-        CPLAssert(nValues == m_nTileSize / nSourceSize);
-        const GByte *pSrc = abyRawTileData.data();
-        GByte *pDst = &abyDecodedTileData[0];
-        for (size_t i = 0; i < nValues;
-             i++, pSrc += nSourceSize, pDst += nDTSize)
-        {
-            DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
-        }
-    }
+        DecodeSourceElts(abyRawTileData, abyDecodedTileData);
 
     return true;
 
@@ -553,6 +727,27 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 #undef m_poCodecs
 }
 
+/************************************************************************/
+/*                   ZarrV3Array::DecodeSourceElts()                    */
+/************************************************************************/
+
+void ZarrV3Array::DecodeSourceElts(
+    const ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+    const auto nDTSize = m_oType.GetSize();
+    const size_t nValues = abyDecodedTileData.size() / nDTSize;
+    CPLAssert(nValues == m_nTileSize / nSourceSize);
+    const GByte *pSrc = abyRawTileData.data();
+    GByte *pDst = &abyDecodedTileData[0];
+    for (size_t i = 0; i < nValues; i++, pSrc += nSourceSize, pDst += nDTSize)
+    {
+        DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
+    }
+}
+
 /************************************************************************/
 /*                      ZarrV3Array::IAdviseRead()                      */
 /************************************************************************/
@@ -574,6 +769,9 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
         return true;
     }
 
+    if (m_poShardingCodec)
+        return IAdviseReadSharded(anReqTilesIndices, nReqTiles, nThreadsMax);
+
     const int nThreads =
         static_cast<int>(std::min(static_cast<size_t>(nThreadsMax), nReqTiles));
 
@@ -722,6 +920,228 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     return bGlobalStatus;
 }
 
+/************************************************************************/
+/*                   ZarrV3Array::IAdviseReadSharded()                  */
+/************************************************************************/
+
+// Requested inner chunks are grouped by shard, so that each shard is opened
+// once and the inner chunks needed from it are fetched with a single
+// VSIFReadMultiRangeL() call, which network file systems can merge into a
+// few range requests.
+bool ZarrV3Array::IAdviseReadSharded(
+    const std::vector<uint64_t> &anReqTilesIndices, size_t nReqTiles,
+    int nThreadsMax) const
+{
+    const size_t nDims = m_aoDims.size();
+
+    // Map shard indices to pairs of (request index, inner chunk index)
+    std::map<std::vector<uint64_t>, std::vector<std::pair<size_t, size_t>>>
+        oMapShardToInnerChunks;
+    {
+        std::vector<uint64_t> anShardIndices;
+        for (size_t iReq = 0; iReq < nReqTiles; ++iReq)
+        {
+            size_t nInnerChunkIdx = 0;
+            GetShardIndices(anReqTilesIndices.data() + iReq * nDims,
+                            anShardIndices, nInnerChunkIdx);
+            oMapShardToInnerChunks[anShardIndices].emplace_back(
+                iReq, nInnerChunkIdx);
+        }
+    }
+    std::vector<const decltype(oMapShardToInnerChunks)::value_type *>
+        apoShards;
+    for (const auto &oShard : oMapShardToInnerChunks)
+        apoShards.push_back(&oShard);
+
+    const int nThreads = static_cast<int>(
+        std::min(static_cast<size_t>(nThreadsMax), apoShards.size()));
+    CPLWorkerThreadPool *wtp = GDALGetGlobalThreadPool(nThreads);
+    if (wtp == nullptr)
+        return false;
+
+    // Cloning is not thread safe, so do it here
+    std::vector<std::unique_ptr<ZarrV3CodecSequence>> apoCodecs;
+    for (int i = 0; i < nThreads; ++i)
+        apoCodecs.emplace_back(m_poCodecs->Clone());
+
+    size_t nDecodedSize = 0;
+    if (NeedDecodedBuffer())
+    {
+        nDecodedSize = m_oType.GetSize();
+        for (const auto &nBlockSize : m_anBlockSize)
+            nDecodedSize *= static_cast<size_t>(nBlockSize);
+    }
+
+    std::atomic<bool> bGlobalStatus{true};
+
+    const auto JobFunc = [this, &apoShards, &apoCodecs, &anReqTilesIndices,
+                          &bGlobalStatus, nThreads, nDims,
+                          nDecodedSize](int iThread)
+    {
+        ZarrV3CodecSequence *poCodecs = apoCodecs[iThread].get();
+        const size_t nFirst = iThread * apoShards.size() / nThreads;
+        const size_t nLast = (iThread + 1) * apoShards.size() / nThreads;
+
+        // Avoid issuing ReadDir() since only a few files are opened
+        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN",
+                                           "YES", true);
+
+        for (size_t iShard = nFirst; iShard < nLast && bGlobalStatus;
+             ++iShard)
+        {
+            const auto &anShardIndices = apoShards[iShard]->first;
+            const auto &aoInnerChunks = apoShards[iShard]->second;
+            const std::string osFilename =
+                BuildTileFilename(anShardIndices.data());
+
+            std::vector<CachedTile> aoCachedTiles(aoInnerChunks.size());
+
+            const char *const apszOpenOptions[] = {
+                "IGNORE_FILENAME_RESTRICTIONS=YES", nullptr};
+            const auto nErrorBefore = CPLGetErrorCounter();
+            VSILFILE *fp =
+                VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+            if (fp == nullptr && nErrorBefore != CPLGetErrorCounter())
+            {
+                bGlobalStatus = false;
+                break;
+            }
+
+            if (fp)
+            {
+                const auto panIndex =
+                    GetShardIndex(fp, osFilename, anShardIndices.data(),
+                                  /* bUseMutex = */ true);
+                if (!panIndex)
+                {
+                    VSIFCloseL(fp);
+                    bGlobalStatus = false;
+                    break;
+                }
+
+                std::vector<size_t> anRangeToChunk;
+                std::vector<void *> apData;
+                std::vector<vsi_l_offset> anOffsets;
+                std::vector<size_t> anSizes;
+                for (size_t i = 0; i < aoInnerChunks.size(); ++i)
+                {
+                    const size_t nInnerChunkIdx = aoInnerChunks[i].second;
+                    const uint64_t nOffset = (*panIndex)[2 * nInnerChunkIdx];
+                    const uint64_t nSize = (*panIndex)[2 * nInnerChunkIdx + 1];
+                    if (nOffset == ZarrV3CodecShardingIndexed::EMPTY_CHUNK &&
+                        nSize == ZarrV3CodecShardingIndexed::EMPTY_CHUNK)
+                    {
+                        continue;
+                    }
+                    if (nSize > static_cast<uint64_t>(
+                                    std::numeric_limits<int>::max()))
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Too large inner chunk in shard %s",
+                                 osFilename.c_str());
+                        bGlobalStatus = false;
+                        break;
+                    }
+                    try
+                    {
+                        aoCachedTiles[i].abyDecoded.resize(
+                            static_cast<size_t>(nSize));
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Cannot allocate memory for inner chunk of "
+                                 "shard %s",
+                                 osFilename.c_str());
+                        bGlobalStatus = false;
+                        break;
+                    }
+                    anRangeToChunk.push_back(i);
+                    apData.push_back(aoCachedTiles[i].abyDecoded.data());
+                    anOffsets.push_back(nOffset);
+                    anSizes.push_back(static_cast<size_t>(nSize));
+                }
+
+                if (bGlobalStatus && !anOffsets.empty() &&
+                    VSIFReadMultiRangeL(static_cast<int>(anOffsets.size()),
+                                        apData.data(), anOffsets.data(),
+                                        anSizes.data(), fp) != 0)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Could not read inner chunks of shard %s "
+                             "correctly",
+                             osFilename.c_str());
+                    bGlobalStatus = false;
+                }
+                VSIFCloseL(fp);
+                if (!bGlobalStatus)
+                    break;
+
+                for (const size_t i : anRangeToChunk)
+                {
+                    auto &abyRawTileData = aoCachedTiles[i].abyDecoded;
+                    if (!poCodecs->Decode(abyRawTileData) ||
+                        abyRawTileData.size() != m_nTileSize)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Decompression of inner chunk of shard %s "
+                                 "failed",
+                                 osFilename.c_str());
+                        bGlobalStatus = false;
+                        break;
+                    }
+                    if (nDecodedSize)
+                    {
+                        ZarrByteVectorQuickResize abyDecodedTileData;
+                        try
+                        {
+                            abyDecodedTileData.resize(nDecodedSize);
+                        }
+                        catch (const std::exception &e)
+                        {
+                            CPLError(CE_Failure, CPLE_OutOfMemory, "%s",
+                                     e.what());
+                            bGlobalStatus = false;
+                            break;
+                        }
+                        DecodeSourceElts(abyRawTileData, abyDecodedTileData);
+                        std::swap(abyRawTileData, abyDecodedTileData);
+                    }
+                }
+                if (!bGlobalStatus)
+                    break;
+            }
+
+            // Missing shards and inner chunks are cached as empty tiles
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            for (size_t i = 0; i < aoInnerChunks.size(); ++i)
+            {
+                const uint64_t *tileIndices =
+                    anReqTilesIndices.data() + aoInnerChunks[i].first * nDims;
+                uint64_t nTileIdx = 0;
+                for (size_t j = 0; j < nDims; ++j)
+                {
+                    if (j > 0)
+                        nTileIdx *= m_aoDims[j - 1]->GetSize();
+                    nTileIdx += tileIndices[j];
+                }
+                m_oMapTileIndexToCachedTile[nTileIdx] =
+                    std::move(aoCachedTiles[i]);
+            }
+        }
+    };
+
+    auto poQueue = wtp->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        if (!poQueue->SubmitJob([&JobFunc, i]() { JobFunc(i); }))
+            JobFunc(i);
+    }
+    poQueue->WaitCompletion();
+
+    return bGlobalStatus;
+}
+
 /************************************************************************/
 /*                    ZarrV3Array::FlushDirtyTile()                     */
 /************************************************************************/
@@ -754,6 +1174,29 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     }
 
+    // The sharding codec already compresses inner chunks in parallel
+    if (CanSubmitTileWriteJob() &&
+        !(m_poCodecs && m_poCodecs->GetShardingCodec()))
+    {
+        // Hand over the tile content to a worker thread, with its own copy
+        // of the codecs, and give the array a new working buffer for the
+        // next tile.
+        auto poRawTileData = std::make_shared<ZarrByteVectorQuickResize>();
+        std::swap(*poRawTileData, m_abyRawTileData);
+        m_bCachedTiledValid = false;
+        if (!AllocateWorkingBuffers(m_abyRawTileData, m_abyDecodedTileData))
+            return false;
+        std::shared_ptr<ZarrV3CodecSequence> poCodecs;
+        if (m_poCodecs)
+            poCodecs = m_poCodecs->Clone();
+        return SubmitTileWriteJob(
+            [this, osFilename, poCodecs, poRawTileData]()
+            {
+                return EncodeAndWriteTile(osFilename, poCodecs.get(),
+                                          *poRawTileData);
+            });
+    }
+
     if (!m_abyDecodedTileData.empty())
     {
         const size_t nDTSize = m_oType.GetSize();
@@ -767,12 +1210,31 @@ bool ZarrV3Array::FlushDirtyTile() const
         }
     }
 
-    const size_t nSizeBefore = m_abyRawTileData.size();
-    if (m_poCodecs)
+    return EncodeAndWriteTile(osFilename, m_poCodecs.get(), m_abyRawTileData);
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::EncodeAndWriteTile()                   */
+/************************************************************************/
+
+bool ZarrV3Array::EncodeAndWriteTile(
+    const std::string &osFilename, ZarrV3CodecSequence *poCodecs,
+    ZarrByteVectorQuickResize &abyRawTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called concurrently from several threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+#define m_poCodecs cannot_use_here
+
+    const size_t nSizeBefore = abyRawTileData.size();
+    if (poCodecs)
     {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
+        if (!poCodecs->Encode(abyRawTileData))
         {
-            m_abyRawTileData.resize(nSizeBefore);
+            abyRawTileData.resize(nSizeBefore);
             return false;
         }
     }
@@ -783,11 +1245,13 @@ bool ZarrV3Array::FlushDirtyTile() const
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            // Another thread may have created it in the meantime
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0 &&
+                VSIStatL(osDir.c_str(), &sStat) != 0)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
+                abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
@@ -798,13 +1262,13 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
+        abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+    const size_t nRawDataSize = abyRawTileData.size();
+    if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
         nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -813,9 +1277,12 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
+    abyRawTileData.resize(nSizeBefore);
 
     return bRet;
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
 }
 
 /************************************************************************/
@@ -1573,11 +2040,30 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
             oInputArrayMetadata.anBlockSizes.push_back(
                 static_cast<size_t>(nSize));
         oInputArrayMetadata.oElt = aoDtypeElts.back();
+        if (aoDtypeElts.size() == 1 &&
+            !aoDtypeElts.back().gdalTypeIsApproxOfNative &&
+            abyNoData.size() == aoDtypeElts.back().nativeSize)
+        {
+            oInputArrayMetadata.abyFillValue = abyNoData;
+        }
         poCodecs = std::make_unique<ZarrV3CodecSequence>(oInputArrayMetadata);
         if (!poCodecs->InitFromJson(oCodecs))
             return nullptr;
     }
 
+    // Unless the array is opened in update mode, shards are read partially:
+    // the blocks of the array are then the inner chunks of the shards.
+    std::vector<GUInt64> anShardBlockSize;
+    const auto poShardingCodec =
+        poCodecs ? poCodecs->GetShardingCodec() : nullptr;
+    if (poShardingCodec && !m_bUpdatable)
+    {
+        anShardBlockSize = anBlockSize;
+        const auto &anInnerBlockSize = poShardingCodec->GetInnerBlockSize();
+        for (size_t i = 0; i < anBlockSize.size(); ++i)
+            anBlockSize[i] = anInnerBlockSize[i];
+    }
+
     auto poArray =
         ZarrV3Array::Create(m_poSharedResource, GetFullName(), osArrayName,
                             aoDims, oType, aoDtypeElts, anBlockSize);
@@ -1600,7 +2086,9 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
         poArray->SetStructuralInfo(
             "COMPRESSOR", oCodecs[oCodecs.Size() - 1].ToString().c_str());
     }
-    if (poCodecs)
+    if (!anShardBlockSize.empty())
+        poArray->SetShardCodecs(std::move(poCodecs), anShardBlockSize);
+    else if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
     RegisterArray(poArray);
 
@@ -1617,7 +2105,15 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
             "CACHE_TILE_PRESENCE", "NO")))
     {
-        poArray->CacheTilePresence();
+        if (!anShardBlockSize.empty())
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "CACHE_TILE_PRESENCE is not supported on sharded arrays");
+        }
+        else
+        {
+            poArray->CacheTilePresence();
+        }
     }
 
     return poArray;
@@ -13,6 +13,11 @@
 #include "zarr.h"
 
 #include "cpl_compressor.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 
 /************************************************************************/
 /*                          ZarrV3Codec()                               */
@@ -958,6 +963,654 @@ bool ZarrV3CodecTranspose::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Transpose(abySrc, abyDst, false);
 }
 
+/************************************************************************/
+/*                          ComputeCRC32C()                             */
+/************************************************************************/
+
+// CRC-32 with the Castagnoli polynomial
+static uint32_t ComputeCRC32C(const GByte *pabyData, size_t nSize)
+{
+    static const auto anTable = []()
+    {
+        std::array<uint32_t, 256> anTableTmp{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t nVal = i;
+            for (int k = 0; k < 8; ++k)
+                nVal = (nVal & 1) ? (nVal >> 1) ^ 0x82F63B78U : (nVal >> 1);
+            anTableTmp[i] = nVal;
+        }
+        return anTableTmp;
+    }();
+
+    uint32_t nCRC = 0xFFFFFFFFU;
+    for (size_t i = 0; i < nSize; ++i)
+        nCRC = anTable[(nCRC ^ pabyData[i]) & 0xFF] ^ (nCRC >> 8);
+    return nCRC ^ 0xFFFFFFFFU;
+}
+
+/************************************************************************/
+/*                         ZarrV3CodecCRC32C()                          */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::ZarrV3CodecCRC32C() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                ZarrV3CodecCRC32C::InitFromConfiguration()            */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Codec crc32c: configuration contains a unhandled member: %s",
+                oChild.GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecCRC32C::Clone()                      */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecCRC32C::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecCRC32C>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecCRC32C::Encode()                     */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Encode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nSize = abySrc.size();
+    abyDst.resize(nSize + sizeof(uint32_t));
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    uint32_t nCRC = ComputeCRC32C(abySrc.data(), nSize);
+    CPL_LSBPTR32(&nCRC);
+    memcpy(abyDst.data() + nSize, &nCRC, sizeof(nCRC));
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecCRC32C::Decode()                     */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Decode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < sizeof(uint32_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec crc32c: input buffer too small");
+        return false;
+    }
+    const size_t nSize = abySrc.size() - sizeof(uint32_t);
+    uint32_t nExpectedCRC = 0;
+    memcpy(&nExpectedCRC, abySrc.data() + nSize, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    if (ComputeCRC32C(abySrc.data(), nSize) != nExpectedCRC)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec crc32c: checksum mismatch");
+        return false;
+    }
+    abyDst.resize(nSize);
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::ZarrV3CodecShardingIndexed() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                    ~ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::~ZarrV3CodecShardingIndexed() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecShardingIndexed::GetConfiguration(
+    const std::vector<GUInt64> &anInnerBlockSize, const CPLJSONArray &oCodecs)
+{
+    CPLJSONObject oConfig;
+    CPLJSONArray oChunkShape;
+    for (const auto nSize : anInnerBlockSize)
+        oChunkShape.Add(static_cast<GInt64>(nSize));
+    oConfig.Add("chunk_shape", oChunkShape);
+    oConfig.Add("codecs", oCodecs);
+
+    CPLJSONArray oIndexCodecs;
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecBytes::NAME);
+        oCodec.Add("configuration", ZarrV3CodecBytes::GetConfiguration(true));
+        oIndexCodecs.Add(oCodec);
+    }
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecCRC32C::NAME);
+        oIndexCodecs.Add(oCodec);
+    }
+    oConfig.Add("index_codecs", oIndexCodecs);
+    oConfig.Add("index_location", "end");
+    return oConfig;
+}
+
+/************************************************************************/
+/*            ZarrV3CodecShardingIndexed::InitFromConfiguration()       */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: configuration missing or not an "
+                 "object");
+        return false;
+    }
+
+    for (const auto &oChild : configuration.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName != "chunk_shape" && osName != "codecs" &&
+            osName != "index_codecs" && osName != "index_location")
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: configuration contains a "
+                     "unhandled member: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+
+    const auto oChunkShape = configuration.GetArray("chunk_shape");
+    const size_t nDims = oInputArrayMetadata.anBlockSizes.size();
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) != nDims)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: chunk_shape missing or not an "
+                 "array with as many elements as dimensions");
+        return false;
+    }
+
+    m_anInnerBlockSize.clear();
+    m_anInnerChunkCount.clear();
+    m_nInnerChunkCount = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const auto oSize = oChunkShape[static_cast<int>(i)];
+        const GInt64 nSize = (oSize.GetType() == CPLJSONObject::Type::Integer ||
+                              oSize.GetType() == CPLJSONObject::Type::Long)
+                                 ? oSize.ToLong()
+                                 : 0;
+        const size_t nShardSize = oInputArrayMetadata.anBlockSizes[i];
+        if (nSize <= 0 || static_cast<uint64_t>(nSize) > nShardSize ||
+            (nShardSize % static_cast<size_t>(nSize)) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] is invalid or "
+                     "not a divisor of the shard shape",
+                     static_cast<int>(i));
+            return false;
+        }
+        m_anInnerBlockSize.push_back(static_cast<size_t>(nSize));
+        m_anInnerChunkCount.push_back(nShardSize /
+                                      static_cast<size_t>(nSize));
+        m_nInnerChunkCount *= m_anInnerChunkCount.back();
+    }
+
+    ZarrArrayMetadata oInnerArrayMetadata = oInputArrayMetadata;
+    oInnerArrayMetadata.anBlockSizes = m_anInnerBlockSize;
+    m_poCodecs = std::make_unique<ZarrV3CodecSequence>(oInnerArrayMetadata);
+    if (!m_poCodecs->InitFromJson(configuration["codecs"]))
+        return false;
+
+    // The shard index is an array of uint64 of shape
+    // m_anInnerChunkCount + [2], with (offset, nbytes) pairs
+    ZarrArrayMetadata oIndexArrayMetadata;
+    oIndexArrayMetadata.oElt.nativeType = DtypeElt::NativeType::UNSIGNED_INT;
+    oIndexArrayMetadata.oElt.nativeSize = sizeof(uint64_t);
+    oIndexArrayMetadata.oElt.gdalType =
+        GDALExtendedDataType::Create(GDT_UInt64);
+    oIndexArrayMetadata.oElt.gdalSize = sizeof(uint64_t);
+    oIndexArrayMetadata.anBlockSizes = m_anInnerChunkCount;
+    oIndexArrayMetadata.anBlockSizes.push_back(2);
+    m_nIndexSize = m_nInnerChunkCount * 2 * sizeof(uint64_t);
+
+    const auto oIndexCodecs = configuration.GetArray("index_codecs");
+    if (!oIndexCodecs.IsValid())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: index_codecs missing or not an "
+                 "array");
+        return false;
+    }
+    // Only codecs that result in a fixed-size index are supported
+    for (const auto &oCodec : oIndexCodecs)
+    {
+        const auto osName = oCodec["name"].ToString();
+        if (osName == ZarrV3CodecCRC32C::NAME)
+        {
+            m_nIndexSize += sizeof(uint32_t);
+        }
+        else if (osName != ZarrV3CodecBytes::NAME)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Codec sharding_indexed: unsupported index codec: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+    m_poIndexCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oIndexArrayMetadata);
+    if (!m_poIndexCodecs->InitFromJson(oIndexCodecs))
+        return false;
+
+    const auto osIndexLocation =
+        configuration.GetString("index_location", "end");
+    if (osIndexLocation == "end")
+        m_bIndexAtEnd = true;
+    else if (osIndexLocation == "start")
+        m_bIndexAtEnd = false;
+    else
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: invalid value for index_location");
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecShardingIndexed::Clone()                 */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecShardingIndexed::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecShardingIndexed>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                      IterateInnerChunkRows()                         */
+/************************************************************************/
+
+// Calls func(nOffsetInShard, nOffsetInChunk, nRowSize), with offsets in
+// bytes, for each row (along the last dimension) of the inner chunk of
+// coordinates panChunkIdx[] of a shard.
+template <class Func>
+static void IterateInnerChunkRows(const std::vector<size_t> &anShardSize,
+                                  const std::vector<size_t> &anInnerSize,
+                                  const size_t *panChunkIdx, size_t nEltSize,
+                                  Func func)
+{
+    const size_t nDims = anShardSize.size();
+    if (nDims == 0)
+    {
+        func(0, 0, nEltSize);
+        return;
+    }
+
+    const size_t nRowSize = anInnerSize.back() * nEltSize;
+    size_t nRows = 1;
+    for (size_t i = 0; i + 1 < nDims; ++i)
+        nRows *= anInnerSize[i];
+
+    std::vector<size_t> anRowIdx(nDims, 0);
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        size_t nOffset = 0;
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            nOffset = nOffset * anShardSize[i] +
+                      panChunkIdx[i] * anInnerSize[i] + anRowIdx[i];
+        }
+        func(nOffset * nEltSize, iRow * nRowSize, nRowSize);
+
+        for (size_t i = nDims - 1; i > 0; --i)
+        {
+            if (++anRowIdx[i - 1] < anInnerSize[i - 1])
+                break;
+            anRowIdx[i - 1] = 0;
+        }
+    }
+}
+
+/************************************************************************/
+/*                         GetInnerChunkCoords()                        */
+/************************************************************************/
+
+static void GetInnerChunkCoords(const std::vector<size_t> &anInnerChunkCount,
+                                size_t nChunkIdx,
+                                std::vector<size_t> &anChunkIdx)
+{
+    for (size_t i = anInnerChunkCount.size(); i > 0; --i)
+    {
+        anChunkIdx[i - 1] = nChunkIdx % anInnerChunkCount[i - 1];
+        nChunkIdx /= anInnerChunkCount[i - 1];
+    }
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::DecodeIndex()              */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeIndex(
+    ZarrByteVectorQuickResize &abyIndex, std::vector<uint64_t> &anIndex) const
+{
+    if (!m_poIndexCodecs->Decode(abyIndex) ||
+        abyIndex.size() != m_nInnerChunkCount * 2 * sizeof(uint64_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: cannot decode shard index");
+        return false;
+    }
+    anIndex.resize(m_nInnerChunkCount * 2);
+    memcpy(anIndex.data(), abyIndex.data(), abyIndex.size());
+    return true;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Encode()                 */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Encode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    if (abySrc.size() < m_oInputArrayMetadata.GetEltCount() * nEltSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecShardingIndexed::Encode(): input buffer too "
+                 "small");
+        return false;
+    }
+
+    size_t nInnerSize = nEltSize;
+    for (const auto nSize : m_anInnerBlockSize)
+        nInnerSize *= nSize;
+    const auto &abyFillValue = m_oInputArrayMetadata.abyFillValue;
+
+    // Inner chunks are compressed in parallel, which is where most of the
+    // time is spent when writing a shard.
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                       ? CPLGetNumCPUs()
+                       : std::max(1, atoi(pszNumThreads));
+    nThreads = static_cast<int>(std::min(
+        static_cast<size_t>(std::min(nThreads, 1024)), m_nInnerChunkCount));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        nThreads = 1;
+
+    // Cloning is not thread safe, so do it here
+    std::vector<std::unique_ptr<ZarrV3CodecSequence>> apoCodecs;
+    for (int i = 0; i < nThreads; ++i)
+        apoCodecs.emplace_back(m_poCodecs->Clone());
+
+    std::vector<ZarrByteVectorQuickResize> aabyChunks(m_nInnerChunkCount);
+    std::vector<GByte> abIsEmptyChunk(m_nInnerChunkCount, FALSE);
+    std::atomic<bool> bOK{true};
+
+    const auto EncodeChunks = [this, &abySrc, &aabyChunks, &abIsEmptyChunk,
+                               &apoCodecs, &abyFillValue, &bOK, nThreads,
+                               nEltSize, nInnerSize](int iThread)
+    {
+        ZarrV3CodecSequence *poCodecs = apoCodecs[iThread].get();
+        std::vector<size_t> anChunkIdx(m_anInnerBlockSize.size());
+        const size_t nFirst = iThread * m_nInnerChunkCount / nThreads;
+        const size_t nLast = (iThread + 1) * m_nInnerChunkCount / nThreads;
+        for (size_t iChunk = nFirst; iChunk < nLast && bOK; ++iChunk)
+        {
+            auto &abyChunk = aabyChunks[iChunk];
+            abyChunk.resize(nInnerSize);
+            GetInnerChunkCoords(m_anInnerChunkCount, iChunk, anChunkIdx);
+            IterateInnerChunkRows(
+                m_oInputArrayMetadata.anBlockSizes, m_anInnerBlockSize,
+                anChunkIdx.data(), nEltSize,
+                [&abySrc, &abyChunk](size_t nOffsetInShard,
+                                     size_t nOffsetInChunk, size_t nRowSize)
+                {
+                    memcpy(abyChunk.data() + nOffsetInChunk,
+                           abySrc.data() + nOffsetInShard, nRowSize);
+                });
+
+            // Inner chunks only made of the fill value are not written
+            if (abyFillValue.size() == nEltSize)
+            {
+                bool bIsEmpty = true;
+                for (size_t i = 0; i < nInnerSize; i += nEltSize)
+                {
+                    if (memcmp(abyChunk.data() + i, abyFillValue.data(),
+                               nEltSize) != 0)
+                    {
+                        bIsEmpty = false;
+                        break;
+                    }
+                }
+                if (bIsEmpty)
+                {
+                    abIsEmptyChunk[iChunk] = TRUE;
+                    continue;
+                }
+            }
+
+            if (!poCodecs->Encode(abyChunk))
+                bOK = false;
+        }
+    };
+
+    if (nThreads == 1)
+    {
+        EncodeChunks(0);
+    }
+    else
+    {
+        auto poQueue = poThreadPool->CreateJobQueue();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            if (!poQueue->SubmitJob([&EncodeChunks, i]() { EncodeChunks(i); }))
+                EncodeChunks(i);
+        }
+        poQueue->WaitCompletion();
+    }
+    if (!bOK)
+        return false;
+
+    std::vector<uint64_t> anIndex(m_nInnerChunkCount * 2);
+    uint64_t nOffset = m_bIndexAtEnd ? 0 : m_nIndexSize;
+    for (size_t i = 0; i < m_nInnerChunkCount; ++i)
+    {
+        if (abIsEmptyChunk[i])
+        {
+            anIndex[2 * i] = EMPTY_CHUNK;
+            anIndex[2 * i + 1] = EMPTY_CHUNK;
+        }
+        else
+        {
+            anIndex[2 * i] = nOffset;
+            anIndex[2 * i + 1] = aabyChunks[i].size();
+            nOffset += aabyChunks[i].size();
+        }
+    }
+
+    ZarrByteVectorQuickResize abyIndex;
+    abyIndex.resize(anIndex.size() * sizeof(uint64_t));
+    memcpy(abyIndex.data(), anIndex.data(), abyIndex.size());
+    if (!m_poIndexCodecs->Encode(abyIndex))
+        return false;
+    CPLAssert(abyIndex.size() == m_nIndexSize);
+
+    abyDst.resize(static_cast<size_t>(nOffset) +
+                  (m_bIndexAtEnd ? m_nIndexSize : 0));
+    GByte *pabyDst = abyDst.data();
+    if (!m_bIndexAtEnd)
+    {
+        memcpy(pabyDst, abyIndex.data(), m_nIndexSize);
+        pabyDst += m_nIndexSize;
+    }
+    for (size_t i = 0; i < m_nInnerChunkCount; ++i)
+    {
+        if (!abIsEmptyChunk[i])
+        {
+            memcpy(pabyDst, aabyChunks[i].data(), aabyChunks[i].size());
+            pabyDst += aabyChunks[i].size();
+        }
+    }
+    if (m_bIndexAtEnd)
+        memcpy(pabyDst, abyIndex.data(), m_nIndexSize);
+
+    return true;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Decode()                 */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Decode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < m_nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: shard is too small to contain "
+                 "its index");
+        return false;
+    }
+
+    ZarrByteVectorQuickResize abyIndex;
+    abyIndex.resize(m_nIndexSize);
+    memcpy(abyIndex.data(),
+           abySrc.data() + (m_bIndexAtEnd ? abySrc.size() - m_nIndexSize : 0),
+           m_nIndexSize);
+    std::vector<uint64_t> anIndex;
+    if (!DecodeIndex(abyIndex, anIndex))
+        return false;
+
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    size_t nInnerSize = nEltSize;
+    for (const auto nSize : m_anInnerBlockSize)
+        nInnerSize *= nSize;
+    const auto &abyFillValue = m_oInputArrayMetadata.abyFillValue;
+
+    abyDst.resize(m_oInputArrayMetadata.GetEltCount() * nEltSize);
+
+    ZarrByteVectorQuickResize abyChunk;
+    std::vector<size_t> anChunkIdx(m_anInnerBlockSize.size());
+    for (size_t iChunk = 0; iChunk < m_nInnerChunkCount; ++iChunk)
+    {
+        const uint64_t nOffset = anIndex[2 * iChunk];
+        const uint64_t nSize = anIndex[2 * iChunk + 1];
+        if (nOffset == EMPTY_CHUNK && nSize == EMPTY_CHUNK)
+        {
+            // Missing inner chunks are filled with the fill value
+            abyChunk.resize(nInnerSize);
+            if (abyFillValue.size() == nEltSize)
+            {
+                for (size_t i = 0; i < nInnerSize; i += nEltSize)
+                    memcpy(abyChunk.data() + i, abyFillValue.data(), nEltSize);
+            }
+            else
+            {
+                memset(abyChunk.data(), 0, nInnerSize);
+            }
+        }
+        else
+        {
+            if (nOffset > abySrc.size() || nSize > abySrc.size() - nOffset)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec sharding_indexed: invalid index entry for "
+                         "inner chunk %d",
+                         static_cast<int>(iChunk));
+                return false;
+            }
+            abyChunk.resize(static_cast<size_t>(nSize));
+            if (nSize)
+                memcpy(abyChunk.data(),
+                       abySrc.data() + static_cast<size_t>(nOffset),
+                       static_cast<size_t>(nSize));
+            if (!m_poCodecs->Decode(abyChunk) || abyChunk.size() != nInnerSize)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec sharding_indexed: decoding of inner chunk %d "
+                         "failed",
+                         static_cast<int>(iChunk));
+                return false;
+            }
+        }
+
+        GetInnerChunkCoords(m_anInnerChunkCount, iChunk, anChunkIdx);
+        IterateInnerChunkRows(
+            m_oInputArrayMetadata.anBlockSizes, m_anInnerBlockSize,
+            anChunkIdx.data(), nEltSize,
+            [&abyDst, &abyChunk](size_t nOffsetInShard, size_t nOffsetInChunk,
+                                 size_t nRowSize)
+            {
+                memcpy(abyDst.data() + nOffsetInShard,
+                       abyChunk.data() + nOffsetInChunk, nRowSize);
+            });
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                    ZarrV3CodecSequence::Clone()                      */
 /************************************************************************/
@@ -1036,6 +1689,10 @@ bool ZarrV3CodecSequence::InitFromJson(const CPLJSONObject &oCodecs)
             poCodec = std::make_unique<ZarrV3CodecBytes>();
         else if (osName == "transpose")
             poCodec = std::make_unique<ZarrV3CodecTranspose>();
+        else if (osName == "crc32c")
+            poCodec = std::make_unique<ZarrV3CodecCRC32C>();
+        else if (osName == "sharding_indexed")
+            poCodec = std::make_unique<ZarrV3CodecShardingIndexed>();
         else
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unsupported codec: %s",
@@ -1155,3 +1812,18 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     }
     return true;
 }
+
+/************************************************************************/
+/*               ZarrV3CodecSequence::GetShardingCodec()                */
+/************************************************************************/
+
+const ZarrV3CodecShardingIndexed *ZarrV3CodecSequence::GetShardingCodec() const
+{
+    if (m_apoCodecs.size() == 1 &&
+        m_apoCodecs[0]->GetName() == ZarrV3CodecShardingIndexed::NAME)
+    {
+        return cpl::down_cast<const ZarrV3CodecShardingIndexed *>(
+            m_apoCodecs[0].get());
+    }
+    return nullptr;
+}
@@ -679,6 +679,43 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
         return nullptr;
     }
 
+    const char *pszShardInnerBlockSize =
+        CSLFetchNameValue(papszOptions, "SHARD_INNER_BLOCKSIZE");
+    if (pszShardInnerBlockSize)
+    {
+        // Chunks are stored as inner chunks of shards of size BLOCKSIZE
+        const CPLStringList aosTokens(
+            CSLTokenizeString2(pszShardInnerBlockSize, ",", 0));
+        if (static_cast<size_t>(aosTokens.size()) != aoDimensions.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid number of values in SHARD_INNER_BLOCKSIZE");
+            return nullptr;
+        }
+        std::vector<GUInt64> anInnerBlockSize;
+        for (size_t i = 0; i < aoDimensions.size(); ++i)
+        {
+            const GUInt64 nSize =
+                static_cast<GUInt64>(CPLAtoGIntBig(aosTokens[i]));
+            if (nSize == 0 || (anBlockSize[i] % nSize) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Values in SHARD_INNER_BLOCKSIZE should be > 0 and "
+                         "divisors of the corresponding BLOCKSIZE values");
+                return nullptr;
+            }
+            anInnerBlockSize.push_back(nSize);
+        }
+
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecShardingIndexed::NAME);
+        oCodec.Add("configuration",
+                   ZarrV3CodecShardingIndexed::GetConfiguration(
+                       anInnerBlockSize, oCodecs));
+        oCodecs = CPLJSONArray();
+        oCodecs.Add(oCodec);
+    }
+
     if (oCodecs.Size() > 0)
     {
         // Byte swapping will be done by the codec chain
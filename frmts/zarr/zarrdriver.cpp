@@ -15,6 +15,7 @@
 #include "vsikerchunk.h"
 
 #include "cpl_minixml.h"
+#include "gdalalgorithm.h"
 
 #include <algorithm>
 #include <cassert>
@@ -26,6 +27,10 @@
 #include <blosc.h>
 #endif
 
+#ifndef _
+#define _(x) (x)
+#endif
+
 /************************************************************************/
 /*                            ZarrDataset()                             */
 /************************************************************************/
@@ -861,6 +866,17 @@ void ZarrDriver::InitMetadata()
             psBlockSizeNode, "description",
             "Comma separated list of chunk size along each dimension");
 
+        auto psShardInnerBlockSizeNode =
+            CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psShardInnerBlockSizeNode, "name",
+                                   "SHARD_INNER_BLOCKSIZE");
+        CPLAddXMLAttributeAndValue(psShardInnerBlockSizeNode, "type",
+                                   "string");
+        CPLAddXMLAttributeAndValue(
+            psShardInnerBlockSizeNode, "description",
+            "Comma separated list of inner chunk size along each dimension, "
+            "to store chunks of size BLOCKSIZE as shards (only for ZARR_V3)");
+
         auto psChunkMemoryLayout =
             CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psChunkMemoryLayout, "name",
@@ -1919,6 +1935,134 @@ GDALDataset *ZarrDataset::CreateCopy(const char *pszFilename,
     return nullptr;
 }
 
+/************************************************************************/
+/*                   ZarrKerchunkCreateAlgorithm                        */
+/************************************************************************/
+
+class ZarrKerchunkCreateAlgorithm final : public GDALAlgorithm
+{
+  public:
+    ZarrKerchunkCreateAlgorithm()
+        : GDALAlgorithm("kerchunk-create",
+                        std::string("Create Kerchunk references to the "
+                                    "arrays of a multidimensional dataset"),
+                        "/programs/gdal_driver_zarr_kerchunk_create.html")
+    {
+        AddProgressArg();
+        AddOpenOptionsArg(&m_openOptions);
+        AddInputFormatsArg(&m_inputFormats)
+            .AddMetadataItem(GAAMDI_REQUIRED_CAPABILITIES,
+                             {GDAL_DCAP_MULTIDIM_RASTER});
+        AddInputDatasetArg(&m_dataset, GDAL_OF_MULTIDIM_RASTER)
+            .SetAutoOpenDataset(false);
+        AddArg("output", 'o',
+               _("Output JSON file or Parquet reference store directory"),
+               &m_output)
+            .SetPositional()
+            .SetRequired()
+            .SetMinCharCount(1);
+        AddArg("output-format", 0,
+               _("Output format. Defaults to JSON when the output filename "
+                 "has a .json extension, PARQUET otherwise"),
+               &m_format)
+            .AddAlias("of")
+            .SetChoices("JSON", "PARQUET");
+        AddOverwriteArg(&m_overwrite);
+        AddArg("max-inline-size", 0,
+               _("Maximum size in bytes of arrays whose blocks cannot be "
+                 "referenced and that are embedded in the references"),
+               &m_maxInlineSize)
+            .SetDefault(m_maxInlineSize)
+            .SetMinValueIncluded(0);
+    }
+
+  protected:
+    bool RunImpl(GDALProgressFunc pfnProgress, void *pProgressData) override;
+
+  private:
+    GDALArgDatasetValue m_dataset{};
+    std::vector<std::string> m_openOptions{};
+    std::vector<std::string> m_inputFormats{};
+    std::string m_output{};
+    std::string m_format{};
+    bool m_overwrite = false;
+    int m_maxInlineSize = 65536;
+};
+
+bool ZarrKerchunkCreateAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
+                                          void *pProgressData)
+{
+    const CPLStringList aosOpenOptions(m_openOptions);
+    std::unique_ptr<GDALDataset> poSrcDS;
+    if (m_inputFormats.empty())
+    {
+        // netCDF-4 files are HDF5 files, and only the HDF5 driver can
+        // report the location of their chunks.
+        const char *const apszAllowedDrivers[] = {"HDF5", nullptr};
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poSrcDS.reset(GDALDataset::Open(
+            m_dataset.GetName().c_str(), GDAL_OF_MULTIDIM_RASTER,
+            apszAllowedDrivers, aosOpenOptions.List(), nullptr));
+    }
+    if (!poSrcDS)
+    {
+        const CPLStringList aosInputFormats(m_inputFormats);
+        poSrcDS.reset(GDALDataset::Open(
+            m_dataset.GetName().c_str(),
+            GDAL_OF_MULTIDIM_RASTER | GDAL_OF_VERBOSE_ERROR,
+            aosInputFormats.List(), aosOpenOptions.List(), nullptr));
+    }
+    if (!poSrcDS)
+        return false;
+
+    const bool bParquet =
+        m_format.empty()
+            ? !EQUAL(CPLGetExtensionSafe(m_output.c_str()).c_str(), "json")
+            : m_format == "PARQUET";
+
+    VSIStatBufL sStat;
+    if (VSIStatL(m_output.c_str(), &sStat) == 0)
+    {
+        if (!m_overwrite)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "%s already exists. Specify the --overwrite option to "
+                        "overwrite it.",
+                        m_output.c_str());
+            return false;
+        }
+        if ((VSI_ISDIR(sStat.st_mode)
+                 ? VSIRmdirRecursive(m_output.c_str())
+                 : VSIUnlink(m_output.c_str())) != 0)
+        {
+            ReportError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                        m_output.c_str());
+            return false;
+        }
+    }
+
+    return VSIKerchunkCreateReferences(
+        poSrcDS.get(), m_output.c_str(), bParquet,
+        static_cast<size_t>(m_maxInlineSize), pfnProgress, pProgressData);
+}
+
+/************************************************************************/
+/*                   ZarrDriverInstantiateAlgorithm()                   */
+/************************************************************************/
+
+static GDALAlgorithm *
+ZarrDriverInstantiateAlgorithm(const std::vector<std::string> &aosPath)
+{
+    if (aosPath.size() == 1 && aosPath[0] == "kerchunk-create")
+    {
+        return std::make_unique<ZarrKerchunkCreateAlgorithm>().release();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 /************************************************************************/
 /*                          GDALRegister_Zarr()                         */
 /************************************************************************/
@@ -1941,6 +2085,7 @@ void GDALRegister_Zarr()
     poDriver->pfnDelete = ZarrDatasetDelete;
     poDriver->pfnRename = ZarrDatasetRename;
     poDriver->pfnCopyFiles = ZarrDatasetCopyFiles;
+    poDriver->pfnInstantiateAlgorithm = ZarrDriverInstantiateAlgorithm;
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
 }
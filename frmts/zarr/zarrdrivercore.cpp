@@ -161,6 +161,8 @@ void ZARRDriverSetCommonMetadata(GDALDriver *poDriver)
                               "GeoTransform SRS NoData "
                               "RasterValues "
                               "DatasetMetadata BandMetadata");
+
+    poDriver->DeclareAlgorithm({"kerchunk-create"});
 }
 
 /************************************************************************/
@@ -439,6 +439,16 @@ typedef enum
  */
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
 
+/** List of (space separated) signatures that the files handled by the driver
+ * start with. Each signature is a sequence of bytes in hexadecimal, optionally
+ * prefixed with its offset in the file and a colon (e.g. "4:6a502020").
+ * GDALOpenEx() skips the driver for files whose header matches none of them,
+ * so this must only be set by drivers whose Identify() method returns FALSE
+ * for such files.
+ * @since GDAL 3.12
+ */
+#define GDAL_DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
+
 /** XML snippet with creation options. */
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 
@@ -1429,6 +1439,16 @@ OGRErr CPL_DLL GDALDatasetStartTransaction(GDALDatasetH hDS, int bForce);
 OGRErr CPL_DLL GDALDatasetCommitTransaction(GDALDatasetH hDS);
 OGRErr CPL_DLL GDALDatasetRollbackTransaction(GDALDatasetH hDS);
 void CPL_DLL GDALDatasetClearStatistics(GDALDatasetH hDS);
+CPLErr CPL_DLL GDALDatasetComputeStatistics(GDALDatasetH hDS, int nBandCount,
+                                            const int *panBandList,
+                                            CSLConstList papszOptions,
+                                            GDALProgressFunc pfnProgress,
+                                            void *pProgressData);
+CPLErr CPL_DLL GDALDatasetComputeHistograms(
+    GDALDatasetH hDS, int nBandCount, const int *panBandList, double dfMin,
+    double dfMax, int nBuckets, GUIntBig *panHistograms,
+    int bIncludeOutOfRange, CSLConstList papszOptions,
+    GDALProgressFunc pfnProgress, void *pProgressData);
 
 char CPL_DLL **GDALDatasetGetFieldDomainNames(GDALDatasetH, CSLConstList)
     CPL_WARN_UNUSED_RESULT;
@@ -1643,6 +1663,11 @@ CPLErr CPL_DLL CPL_STDCALL GDALRasterAdviseRead(GDALRasterBandH hRB,
                                                 GDALDataType eBDataType,
                                                 CSLConstList papszOptions);
 
+void CPL_DLL GDALSetRasterBlockCacheStreamingHint(GDALRasterBandH hBand,
+                                                  bool bStreaming);
+CPLErr CPL_DLL GDALRasterPrefetchBlocks(GDALRasterBandH hBand, int nXOff,
+                                        int nYOff, int nXSize, int nYSize);
+
 CPLErr CPL_DLL CPL_STDCALL GDALRasterIO(GDALRasterBandH hRBand,
                                         GDALRWFlag eRWFlag, int nDSXOff,
                                         int nDSYOff, int nDSXSize, int nDSYSize,
@@ -1796,6 +1821,12 @@ CPLErr CPL_DLL GDALRasterInterpolateAtPoint(GDALRasterBandH hBand,
                                             double *pdfRealValue,
                                             double *pdfImagValue);
 
+CPLErr CPL_DLL GDALRasterInterpolateAtPoints(
+    GDALRasterBandH hBand, size_t nPointCount, const double *padfPixel,
+    const double *padfLine, GDALRIOResampleAlg eInterpolation,
+    double *padfRealValue, double *padfImagValue, int *pabSuccess,
+    CSLConstList papszOptions);
+
 CPLErr CPL_DLL GDALRasterInterpolateAtGeolocation(
     GDALRasterBandH hBand, double dfGeolocX, double dfGeolocY,
     OGRSpatialReferenceH hSRS, GDALRIOResampleAlg eInterpolation,
@@ -2423,6 +2454,33 @@ GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
+/** Statistics of the raster block cache.
+ *
+ * Returned, for the whole block cache, by GDALGetCacheStatistics(), or for
+ * a single dataset by GDALDatasetGetCacheStatistics().
+ *
+ * @since GDAL 3.12
+ */
+typedef struct
+{
+    /** Number of block requests satisfied by the block cache. */
+    GUIntBig nHits;
+    /** Number of block requests that required reading the block. */
+    GUIntBig nMisses;
+    /** Number of blocks evicted from the cache to make room. */
+    GUIntBig nEvictions;
+    /** Number of dirty blocks written by the block cache. */
+    GUIntBig nDirtyFlushes;
+    /** Memory currently used by cached blocks, in bytes. */
+    GIntBig nCacheUsed;
+} GDALBlockCacheStatistics;
+
+void CPL_DLL GDALGetCacheStatistics(GDALBlockCacheStatistics *psStats);
+void CPL_DLL GDALDatasetGetCacheStatistics(GDALDatasetH hDS,
+                                           GDALBlockCacheStatistics *psStats);
+void CPL_DLL GDALDatasetSetCacheMax(GDALDatasetH hDS, GIntBig nBytes);
+GIntBig CPL_DLL GDALDatasetGetCacheMax(GDALDatasetH hDS);
+
 /* ==================================================================== */
 /*      GDAL virtual memory                                             */
 /* ==================================================================== */
@@ -2446,6 +2504,11 @@ GDALGetVirtualMemAuto(GDALRasterBandH hBand, GDALRWFlag eRWFlag,
                       int *pnPixelSpace, GIntBig *pnLineSpace,
                       CSLConstList papszOptions) CPL_WARN_UNUSED_RESULT;
 
+bool CPL_DLL GDALRasterBandGetWindowAsArrowTensor(
+    GDALRasterBandH hBand, int nXOff, int nYOff, int nXSize, int nYSize,
+    struct ArrowSchema *out_schema, struct ArrowArray *out_array,
+    CSLConstList papszOptions);
+
 /**! Enumeration to describe the tile organization */
 typedef enum
 {
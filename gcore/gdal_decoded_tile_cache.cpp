@@ -0,0 +1,220 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Process-wide cache of decoded tiles shared by dataset handles
+ * Author:   Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_decoded_tile_cache.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <cstring>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+/************************************************************************/
+/*                         GDALDecodedTileCache                         */
+/************************************************************************/
+
+// Least-recently-used cache bounded by the total size of its values.
+// Values are reference counted so that copying them out of the cache can
+// be done without holding the mutex.
+struct GDALDecodedTileCache
+{
+    using ValueType = std::shared_ptr<const std::vector<GByte>>;
+    using ListType = std::list<std::pair<std::string, ValueType>>;
+
+    std::mutex oMutex{};
+    ListType oList{};
+    std::unordered_map<std::string, ListType::iterator> oMap{};
+    size_t nCurSize = 0;
+
+    void EvictUntil(size_t nMaxSize)
+    {
+        while (nCurSize > nMaxSize && !oList.empty())
+        {
+            auto &oLast = oList.back();
+            nCurSize -= oLast.second->size();
+            oMap.erase(oLast.first);
+            oList.pop_back();
+        }
+    }
+};
+
+GDALDecodedTileCache &GetCache()
+{
+    static GDALDecodedTileCache oCache;
+    return oCache;
+}
+
+/************************************************************************/
+/*                            GetMaxSize()                              */
+/************************************************************************/
+
+size_t GetMaxSize()
+{
+    const char *pszVal =
+        CPLGetConfigOption("GDAL_DECODED_TILE_CACHE_SIZE", nullptr);
+    if (!pszVal || pszVal[0] == '\0')
+        return 0;
+    GIntBig nVal = 0;
+    if (CPLParseMemorySize(pszVal, &nVal, nullptr) != CE_None || nVal < 0)
+    {
+        static bool bWarned = false;
+        if (!bWarned)
+        {
+            bWarned = true;
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for GDAL_DECODED_TILE_CACHE_SIZE: %s",
+                     pszVal);
+        }
+        return 0;
+    }
+#if SIZEOF_VOIDP == 4
+    if (static_cast<GUIntBig>(nVal) > std::numeric_limits<size_t>::max())
+        return std::numeric_limits<size_t>::max();
+#endif
+    return static_cast<size_t>(nVal);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                    GDALDecodedTileCacheIsEnabled()                   */
+/************************************************************************/
+
+/** Return whether the decoded tile cache is enabled. */
+bool GDALDecodedTileCacheIsEnabled()
+{
+    return GetMaxSize() > 0;
+}
+
+/************************************************************************/
+/*                   GDALDecodedTileCacheGetFileKey()                   */
+/************************************************************************/
+
+/** Return a key identifying the current state of a file.
+ *
+ * The key includes the filename, its modification time and its size, so
+ * that tiles cached for a file are not returned once it has been modified.
+ *
+ * @return an empty string if the file cannot be stat'ed.
+ */
+std::string GDALDecodedTileCacheGetFileKey(const char *pszFilename)
+{
+    VSIStatBufL sStat;
+    if (VSIStatExL(pszFilename, &sStat,
+                   VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG |
+                       VSI_STAT_SIZE_FLAG) != 0 ||
+        VSI_ISDIR(sStat.st_mode))
+    {
+        return std::string();
+    }
+    std::string osKey(pszFilename);
+    osKey += CPLSPrintf("|" CPL_FRMT_GIB "|" CPL_FRMT_GUIB,
+                        static_cast<GIntBig>(sStat.st_mtime),
+                        static_cast<GUIntBig>(sStat.st_size));
+    return osKey;
+}
+
+/************************************************************************/
+/*                      GDALDecodedTileCacheGet()                       */
+/************************************************************************/
+
+/** Copy into pBuffer the cached value for osKey.
+ *
+ * @return true if the key was found and its value is exactly nSize bytes.
+ */
+bool GDALDecodedTileCacheGet(const std::string &osKey, void *pBuffer,
+                             size_t nSize)
+{
+    GDALDecodedTileCache::ValueType poValue;
+    {
+        auto &oCache = GetCache();
+        std::lock_guard oLock(oCache.oMutex);
+        auto oIter = oCache.oMap.find(osKey);
+        if (oIter == oCache.oMap.end())
+            return false;
+        oCache.oList.splice(oCache.oList.begin(), oCache.oList,
+                            oIter->second);
+        poValue = oIter->second->second;
+    }
+    if (poValue->size() != nSize)
+        return false;
+    memcpy(pBuffer, poValue->data(), nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                      GDALDecodedTileCachePut()                       */
+/************************************************************************/
+
+/** Insert (or replace) the value for osKey. */
+void GDALDecodedTileCachePut(const std::string &osKey, const void *pBuffer,
+                             size_t nSize)
+{
+    const size_t nMaxSize = GetMaxSize();
+    if (nSize == 0 || nSize > nMaxSize)
+        return;
+
+    std::shared_ptr<std::vector<GByte>> poValue;
+    try
+    {
+        poValue = std::make_shared<std::vector<GByte>>(
+            static_cast<const GByte *>(pBuffer),
+            static_cast<const GByte *>(pBuffer) + nSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+
+    auto &oCache = GetCache();
+    std::lock_guard oLock(oCache.oMutex);
+    auto oIter = oCache.oMap.find(osKey);
+    if (oIter != oCache.oMap.end())
+    {
+        oCache.nCurSize -= oIter->second->second->size();
+        oCache.oList.erase(oIter->second);
+        oCache.oMap.erase(oIter);
+    }
+    oCache.EvictUntil(nMaxSize - nSize);
+    oCache.oList.emplace_front(osKey, std::move(poValue));
+    oCache.oMap[osKey] = oCache.oList.begin();
+    oCache.nCurSize += nSize;
+}
+
+/************************************************************************/
+/*                     GDALDecodedTileCacheClear()                      */
+/************************************************************************/
+
+/** Remove all entries from the cache. */
+void GDALDecodedTileCacheClear()
+{
+    auto &oCache = GetCache();
+    std::lock_guard oLock(oCache.oMutex);
+    oCache.oMap.clear();
+    oCache.oList.clear();
+    oCache.nCurSize = 0;
+}
+
+//! @endcond
@@ -0,0 +1,46 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Process-wide cache of decoded tiles shared by dataset handles
+ * Author:   Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDAL_DECODED_TILE_CACHE_H
+#define GDAL_DECODED_TILE_CACHE_H
+
+#include "cpl_port.h"
+
+#include <cstddef>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+/* The cache is keyed by strings built by drivers from
+ * GDALDecodedTileCacheGetFileKey() (file identity) and an identifier of the
+ * decoded tile within the file (IFD offset, tile index, etc.). Contrary to the
+ * block cache, it is shared by all the dataset handles opened on the same
+ * file, which avoids decoding again the same tiles when a file is opened
+ * several times (one handle per thread, reopening in a loop, etc.).
+ * It is disabled unless GDAL_DECODED_TILE_CACHE_SIZE is set.
+ */
+
+bool CPL_DLL GDALDecodedTileCacheIsEnabled();
+
+std::string CPL_DLL GDALDecodedTileCacheGetFileKey(const char *pszFilename);
+
+bool CPL_DLL GDALDecodedTileCacheGet(const std::string &osKey, void *pBuffer,
+                                     size_t nSize);
+
+void CPL_DLL GDALDecodedTileCachePut(const std::string &osKey,
+                                     const void *pBuffer, size_t nSize);
+
+void CPL_DLL GDALDecodedTileCacheClear();
+
+//! @endcond
+
+#endif  // GDAL_DECODED_TILE_CACHE_H
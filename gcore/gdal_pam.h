@@ -361,7 +361,7 @@ class CPL_DLL GDALPamRasterBand : public GDALRasterBand
 /* ******************************************************************** */
 
 /** Class that serializes/deserializes metadata on multidimensional objects.
- * Currently SRS on GDALMDArray.
+ * Currently SRS, statistics and regular spacing of 1D arrays on GDALMDArray.
  */
 class CPL_DLL GDALPamMultiDim
 {
@@ -398,6 +398,16 @@ class CPL_DLL GDALPamMultiDim
     void ClearStatistics(const std::string &osArrayFullName,
                          const std::string &osContext);
 
+    bool GetRegularSpacing(const std::string &osArrayFullName,
+                           const std::string &osContext, GUInt64 nSize,
+                           bool &bRegular, double &dfStart,
+                           double &dfIncrement, bool &bExact);
+
+    void SetRegularSpacing(const std::string &osArrayFullName,
+                           const std::string &osContext, GUInt64 nSize,
+                           bool bRegular, double dfStart, double dfIncrement,
+                           bool bExact);
+
     static std::shared_ptr<GDALPamMultiDim>
     GetPAM(const std::shared_ptr<GDALMDArray> &poParent);
 };
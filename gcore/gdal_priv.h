@@ -35,6 +35,8 @@ class GDALProxyRasterBand;
 class GDALAsyncReader;
 class GDALRelationship;
 class GDALAlgorithm;
+struct GDALBlockCacheCounters;
+class GDALBlockPrefetcher;
 
 /* -------------------------------------------------------------------- */
 /*      Pull in the public declarations.  This gets the C apis, and     */
@@ -58,6 +60,7 @@ class GDALAlgorithm;
 #include <cmath>
 #include <complex>
 #include <cstdint>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -794,6 +797,12 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                       GSpacing nLineSpace, GSpacing nBandSpace,
                       GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
+    CPL_INTERNAL CPLErr MultiThreadedBlockBasedRasterIO(
+        int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+        GDALDataType eBufType, int nBandCount, const int *panBandMap,
+        GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
+        int nBlockYSize, bool &bTried);
+
     CPLErr
     RasterIOResampled(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
                       int nYSize, void *pData, int nBufXSize, int nBufYSize,
@@ -822,6 +831,7 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     virtual bool CanBeCloned(int nScopeFlags, bool bCanShareState) const;
 
     friend class GDALThreadSafeDataset;
+    friend class GDALBlockPrefetcher;
     friend class MEMDataset;
     virtual std::unique_ptr<GDALDataset> Clone(int nScopeFlags,
                                                bool bCanShareState) const;
@@ -987,7 +997,14 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                      int nLineSpace, int nBandSpace, char **papszOptions);
     virtual void EndAsyncReader(GDALAsyncReader *poARIO);
 
+    void SetBlockCacheMax(GIntBig nBytes);
+    GIntBig GetBlockCacheMax() const;
+    void GetBlockCacheStatistics(GDALBlockCacheStatistics *psStats) const;
+
     //! @cond Doxygen_Suppress
+    CPL_INTERNAL GDALBlockCacheCounters *GetBlockCacheCounters() const;
+    CPL_INTERNAL GDALBlockPrefetcher *GetBlockPrefetcher(bool bCreate);
+
     struct RawBinaryLayout
     {
         enum class Interleaving
@@ -1126,6 +1143,18 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     virtual void ClearStatistics();
 
+    CPLErr ComputeStatistics(int nBandCount, const int *panBandList,
+                             CSLConstList papszOptions,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData);
+
+    CPLErr ComputeHistograms(int nBandCount, const int *panBandList,
+                             double dfMin, double dfMax, int nBuckets,
+                             GUIntBig *panHistograms, int bIncludeOutOfRange,
+                             CSLConstList papszOptions,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData);
+
     /** Convert a GDALDataset* to a GDALDatasetH.
      * @since GDAL 2.3
      */
@@ -1481,11 +1510,20 @@ class CPL_DLL GDALRasterBlock
 
     bool bMustDetach;
 
+    // Whether the block is in the protected segment of the LRU list.
+    bool bProtected;
+
+    // Counters of the dataset the cache memory of the block is accounted to.
+    GDALBlockCacheCounters *poCounters;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
+    CPL_INTERNAL bool MayStoreCompressed() const;
+    CPL_INTERNAL void StoreCompressed() const;
+
   public:
     GDALRasterBlock(GDALRasterBand *, int, int);
     GDALRasterBlock(int nXOffIn, int nYOffIn); /* only for lookup purpose */
@@ -1603,6 +1641,15 @@ class CPL_DLL GDALRasterBlock
     /* Should only be called by GDALDestroyDriverManager() */
     //! @cond Doxygen_Suppress
     CPL_INTERNAL static void DestroyRBMutex();
+
+    /* Should only be called by GDALRasterBand */
+    CPL_INTERNAL static void RecordBlockRequest(GDALRasterBand *poBand,
+                                                bool bHit);
+    CPL_INTERNAL bool RestoreFromCompressedCache();
+    CPL_INTERNAL static void DropCompressedBlock(GDALRasterBand *poBand,
+                                                 int nXOff, int nYOff);
+    CPL_INTERNAL static void DropCompressedBlocks(GDALRasterBand *poBand);
+    CPL_INTERNAL static void DropGhostBlocks(GDALRasterBand *poBand);
     //! @endcond
 
   private:
@@ -1816,6 +1863,9 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     CPLErr eFlushBlockErr = CE_None;
     GDALAbstractBandBlockCache *poBandBlockCache = nullptr;
+    bool m_bBlockCacheStreamingHint = false;
+    // Whether PrefetchBlocks() has been called.
+    bool m_bBlocksPrefetched = false;
 
     CPL_INTERNAL void SetFlushBlockErr(CPLErr eErr);
     CPL_INTERNAL CPLErr UnreferenceBlock(GDALRasterBlock *poBlock);
@@ -2238,6 +2288,12 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                               int nBufXSize, int nBufYSize,
                               GDALDataType eBufType, char **papszOptions);
 
+    void SetBlockCacheStreamingHint(bool bStreaming);
+    bool GetBlockCacheStreamingHint() const;
+
+    std::shared_future<CPLErr> PrefetchBlocks(int nXOff, int nYOff,
+                                              int nXSize, int nYSize);
+
     virtual CPLErr GetHistogram(double dfMin, double dfMax, int nBuckets,
                                 GUIntBig *panHistogram, int bIncludeOutOfRange,
                                 int bApproxOK, GDALProgressFunc,
@@ -2281,6 +2337,14 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                                       double *pdfRealValue,
                                       double *pdfImagValue = nullptr) const;
 
+    CPLErr InterpolateAtPoints(size_t nPointCount, const double *padfPixel,
+                               const double *padfLine,
+                               GDALRIOResampleAlg eInterpolation,
+                               double *padfRealValue,
+                               double *padfImagValue = nullptr,
+                               int *pabSuccess = nullptr,
+                               CSLConstList papszOptions = nullptr) const;
+
     //! @cond Doxygen_Suppress
     class CPL_DLL WindowIterator
     {
@@ -2762,9 +2826,15 @@ class CPL_DLL GDALNoDataMaskBand : public GDALRasterBand
     int64_t m_nNoDataValueInt64 = 0;
     uint64_t m_nNoDataValueUInt64 = 0;
     GDALRasterBand *m_poParent = nullptr;
+    bool m_bCacheBlocks = false;
 
     CPL_DISALLOW_COPY_ASSIGN(GDALNoDataMaskBand)
 
+    CPLErr ComputeMask(int nXOff, int nYOff, int nXSize, int nYSize,
+                       void *pData, int nBufXSize, int nBufYSize,
+                       GDALDataType eBufType, GSpacing nPixelSpace,
+                       GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg);
+
   protected:
     CPLErr IReadBlock(int, int, void *) override;
     CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
@@ -3092,6 +3162,12 @@ class CPL_DLL GDALDriver : public GDALMajorObject
      */
     void DeclareAlgorithm(const std::vector<std::string> &aosPath);
 
+    /** Whether the header of the file may match the signatures declared
+     * with GDAL_DMD_OPEN_SIGNATURES. Returns true if the driver declares
+     * no signature, or if the header of the file is not available.
+     */
+    bool MatchesOpenSignatures(const GDALOpenInfo *poOpenInfo) const;
+
     //! @endcond
 
     /* -------------------------------------------------------------------- */
@@ -3149,6 +3225,9 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     }
 
   private:
+    // Parsed value of GDAL_DMD_OPEN_SIGNATURES, as (offset, bytes) pairs
+    std::vector<std::pair<int, std::string>> m_aoOpenSignatures{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALDriver)
 };
 
@@ -4084,6 +4163,12 @@ class CPL_DLL GDALAbstractMDArray
                                  FuncProcessPerChunkType pfnFunc,
                                  void *pUserData);
 
+    bool ProcessPerChunkMultiThreaded(const GUInt64 *arrayStartIdx,
+                                      const GUInt64 *count,
+                                      const size_t *chunkSize,
+                                      FuncProcessPerChunkType pfnFunc,
+                                      void *pUserData, int nThreads);
+
     virtual bool
     Read(const GUInt64 *arrayStartIdx,    // array of size GetDimensionCount()
          const size_t *count,             // array of size GetDimensionCount()
@@ -4294,6 +4379,42 @@ class CPL_DLL GDALAttributeNumeric final : public GDALAttribute
 
 //! @endcond
 
+/* ******************************************************************** */
+/*                       GDALMDArrayRawBlockInfo                        */
+/* ******************************************************************** */
+
+/**
+ * Location and encoding of the raw (undecoded) content of a block of a
+ * GDALMDArray, as returned by GDALMDArray::GetRawBlockInfo().
+ *
+ * @since GDAL 3.12
+ */
+class CPL_DLL GDALMDArrayRawBlockInfo
+{
+  public:
+    /** Name of the file where the block is stored. Empty if the block
+     * is not allocated, in which case it must be considered as filled with
+     * the nodata value of the array. */
+    std::string osFilename{};
+
+    /** Offset of the start of the block in osFilename. */
+    uint64_t nOffset = 0;
+
+    /** Size in bytes of the block in osFilename. */
+    uint64_t nSize = 0;
+
+    /** Encoding of the block, as KEY=VALUE strings:
+     * <ul>
+     * <li>ENDIANNESS=LITTLE or BIG: byte order of the values.
+     *     Only set for data types larger than one byte.</li>
+     * <li>FILTERS=name[,name]*: filters applied when encoding the block,
+     *     in that order. Standard names are SHUFFLE, DEFLATE and ZSTD.
+     *     Not set if the block is stored as is.</li>
+     * </ul>
+     */
+    CPLStringList aosInfo{};
+};
+
 /* ******************************************************************** */
 /*                              GDALMDArray                             */
 /* ******************************************************************** */
@@ -4418,6 +4539,9 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
 
     virtual CSLConstList GetStructuralInfo() const;
 
+    virtual bool GetRawBlockInfo(const uint64_t *panBlockCoordinates,
+                                 GDALMDArrayRawBlockInfo &info) const;
+
     virtual const std::string &GetUnit() const;
 
     virtual bool SetUnit(const std::string &osUnit);
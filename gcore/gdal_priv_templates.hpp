@@ -1250,6 +1250,30 @@ inline void GDALCopy8Words(const float *pValueIn, GUInt16 *const pValueOut)
     _mm_storeu_si128(reinterpret_cast<__m128i *>(pValueOut),
                      _mm256_castsi256_si128(ymm_i));
 }
+
+template <>
+inline void GDALCopy8Words(const float *pValueIn, GInt16 *const pValueOut)
+{
+    __m256 ymm = _mm256_loadu_ps(pValueIn);
+
+    const __m256 ymm_min = _mm256_set1_ps(-32768);
+    const __m256 ymm_max = _mm256_set1_ps(32767);
+    ymm = _mm256_min_ps(_mm256_max_ps(ymm, ymm_min), ymm_max);
+
+    const __m256 p0d5 = _mm256_set1_ps(0.5f);
+    const __m256 m0d5 = _mm256_set1_ps(-0.5f);
+    const __m256 mask = _mm256_cmp_ps(ymm, p0d5, _CMP_GE_OQ);
+    // f >= 0.5f ? f + 0.5f : f - 0.5f
+    ymm = _mm256_add_ps(ymm, _mm256_blendv_ps(m0d5, p0d5, mask));
+
+    __m256i ymm_i = _mm256_cvttps_epi32(ymm);
+
+    ymm_i = _mm256_packs_epi32(ymm_i, ymm_i);  // Pack int32 to int16
+    ymm_i = _mm256_permute4x64_epi64(ymm_i, 0 | (2 << 2));  // AVX2
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pValueOut),
+                     _mm256_castsi256_si128(ymm_i));
+}
 #else
 template <>
 inline void GDALCopy8Words(const float *pValueIn, GUInt16 *const pValueOut)
@@ -242,6 +242,7 @@ class CPL_DLL GDALProxyPoolDataset : public GDALProxyDataset
     CPLHashSet *metadataItemSet = nullptr;
 
     mutable GDALProxyPoolCacheEntry *cacheEntry = nullptr;
+    mutable GUIntBig m_nCacheEntryGeneration = 0;
     char *m_pszOwner = nullptr;
 
     GDALDataset *RefUnderlyingDataset(bool bForceOpen) const;
@@ -12,6 +12,11 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <algorithm>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -20,14 +25,110 @@
 // to hang forever once the tests have terminated.
 static CPLWorkerThreadPool *gpoCompressThreadPool = nullptr;
 
+// Number of threads reserved with GDALReserveThreads().
+// Protected by GetMutexThreadPool()
+static int gnReservedThreads = 0;
+
 static std::mutex &GetMutexThreadPool()
 {
     static std::mutex gMutexThreadPool;
     return gMutexThreadPool;
 }
 
+/************************************************************************/
+/*                        GDALGetThreadBudget()                         */
+/************************************************************************/
+
+/** Return the process-wide thread budget.
+ *
+ * This is the value of the GDAL_MAX_THREADS configuration option, which
+ * defaults to the number of CPUs. It is the maximum number of threads of the
+ * global thread pool, and the maximum number of threads that can be reserved
+ * at the same time with GDALReserveThreads().
+ *
+ * @since GDAL 3.12
+ */
+int GDALGetThreadBudget()
+{
+    const char *pszMaxThreads =
+        CPLGetConfigOption("GDAL_MAX_THREADS", "ALL_CPUS");
+    if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+        return std::max(1, CPLGetNumCPUs());
+    return std::max(1, atoi(pszMaxThreads));
+}
+
+/************************************************************************/
+/*                         GDALReserveThreads()                         */
+/************************************************************************/
+
+/** Reserve threads from the process-wide thread budget.
+ *
+ * Multithreaded operations should call this function with the number of
+ * threads they would like to use, typically from the NUM_THREADS option or
+ * the GDAL_NUM_THREADS configuration option, and use the returned number of
+ * threads instead. So when several multithreaded operations run at the same
+ * time, or are nested (for example an overview computation run by a warping
+ * job), they share the budget returned by GDALGetThreadBudget() instead of
+ * oversubscribing the CPUs. When the budget is exhausted, 1 is returned, and
+ * the operation should run in the calling thread.
+ *
+ * The reservation must be released with GDALReleaseThreads() with the
+ * returned value. GDALThreadReservation can be used to do that automatically.
+ *
+ * @param nThreads Number of threads wanted.
+ * @return the number of threads that may be used, between 1 and nThreads
+ * (or nThreads if it is lower than 1).
+ * @since GDAL 3.12
+ */
+int GDALReserveThreads(int nThreads)
+{
+    if (nThreads <= 1)
+        return nThreads;
+    const int nBudget = GDALGetThreadBudget();
+    std::lock_guard oGuard(GetMutexThreadPool());
+    const int nAvailable = std::max(0, nBudget - gnReservedThreads);
+    const int nGranted = std::min(nThreads, nAvailable);
+    if (nGranted < nThreads)
+    {
+        CPLDebug("GDAL",
+                 "%d thread(s) requested, but only %d available in the "
+                 "thread budget",
+                 nThreads, std::max(1, nGranted));
+    }
+    if (nGranted <= 1)
+        return 1;
+    gnReservedThreads += nGranted;
+    return nGranted;
+}
+
+/************************************************************************/
+/*                         GDALReleaseThreads()                         */
+/************************************************************************/
+
+/** Release threads reserved with GDALReserveThreads().
+ *
+ * @param nThreads Value returned by GDALReserveThreads().
+ * @since GDAL 3.12
+ */
+void GDALReleaseThreads(int nThreads)
+{
+    if (nThreads <= 1)
+        return;
+    std::lock_guard oGuard(GetMutexThreadPool());
+    CPLAssert(gnReservedThreads >= nThreads);
+    gnReservedThreads -= nThreads;
+}
+
+/************************************************************************/
+/*                      GDALGetGlobalThreadPool()                       */
+/************************************************************************/
+
+/** Return the global thread pool, with at least nThreads threads, but not
+ * more than the thread budget returned by GDALGetThreadBudget().
+ */
 CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
 {
+    nThreads = std::min(nThreads, GDALGetThreadBudget());
     std::lock_guard oGuard(GetMutexThreadPool());
     if (gpoCompressThreadPool == nullptr)
     {
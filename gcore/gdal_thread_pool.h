@@ -19,4 +19,51 @@ CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
 void GDALDestroyGlobalThreadPool();
 
+int CPL_DLL GDALGetThreadBudget();
+
+int CPL_DLL GDALReserveThreads(int nThreads);
+
+void CPL_DLL GDALReleaseThreads(int nThreads);
+
+/** Scoped reservation of threads from the process-wide thread budget.
+ *
+ * Multithreaded operations, including those of drivers and utilities that
+ * may run at the same time or be nested (for example ogr2ogr reprojecting
+ * features read by a multithreaded driver), should hold such a reservation
+ * while they use threads of the global thread pool, and use no more than
+ * GetThreadCount() threads.
+ *
+ * An object holding a reservation and a CPLJobQueue whose jobs use its
+ * other members must declare the job queue as its last member. The job
+ * queue is then destroyed first, and its destructor waits for pending jobs
+ * while the threads are still reserved and the data they use still alive.
+ *
+ * @see GDALReserveThreads()
+ * @since GDAL 3.12
+ */
+class GDALThreadReservation
+{
+    const int m_nThreads;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadReservation)
+
+  public:
+    /** Reserve up to nThreads threads */
+    explicit GDALThreadReservation(int nThreads)
+        : m_nThreads(GDALReserveThreads(nThreads))
+    {
+    }
+
+    ~GDALThreadReservation()
+    {
+        GDALReleaseThreads(m_nThreads);
+    }
+
+    /** Return the number of threads that may be used */
+    int GetThreadCount() const
+    {
+        return m_nThreads;
+    }
+};
+
 #endif  // GDAL_THREAD_POOL_H
@@ -29,10 +29,23 @@ class GDALComputedDataset final : public GDALDataset
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_bandDS{};
     std::vector<GDALRasterBand *> m_poBands{};
+    // Expression in terms of the "sourceN" of m_poBands evaluated by the
+    // band, if it is made of arithmetic operations that may be fused in the
+    // expression of a band using it. Empty otherwise.
+    std::string m_osExpression{};
     VRTDataset m_oVRTDS;
 
     void AddSources(GDALComputedRasterBand *poBand);
 
+    static const GDALComputedDataset *
+    GetFusableComputedDataset(const GDALRasterBand *poBand);
+
+    bool InitArithmeticExpression(GDALComputedRasterBand::Operation op,
+                                  const GDALRasterBand *firstBand,
+                                  const double *pFirstConstant,
+                                  const GDALRasterBand *secondBand,
+                                  const double *pSecondConstant);
+
     static const char *
     OperationToFunctionName(GDALComputedRasterBand::Operation op);
 
@@ -116,7 +129,7 @@ static bool IsComparisonOperator(GDALComputedRasterBand::Operation op)
 
 GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other)
     : GDALDataset(), m_op(other.m_op), m_aosOptions(other.m_aosOptions),
-      m_poBands(other.m_poBands),
+      m_poBands(other.m_poBands), m_osExpression(other.m_osExpression),
       m_oVRTDS(other.GetRasterXSize(), other.GetRasterYSize(),
                other.m_oVRTDS.GetBlockXSize(), other.m_oVRTDS.GetBlockYSize())
 {
@@ -148,6 +161,203 @@ GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other)
     AddSources(poBand);
 }
 
+/************************************************************************/
+/*                       HaveAllBandsSameNoDataValue()                  */
+/************************************************************************/
+
+static bool HaveAllBandsSameNoDataValue(GDALRasterBand **apoBands,
+                                        size_t nBands, bool &hasAtLeastOneNDV,
+                                        double &singleNDV)
+{
+    hasAtLeastOneNDV = false;
+    singleNDV = 0;
+
+    int bFirstBandHasNoData = false;
+    for (size_t i = 0; i < nBands; ++i)
+    {
+        int bHasNoData = false;
+        const double dfNoData = apoBands[i]->GetNoDataValue(&bHasNoData);
+        if (bHasNoData)
+            hasAtLeastOneNDV = true;
+        if (i == 0)
+        {
+            bFirstBandHasNoData = bHasNoData;
+            singleNDV = dfNoData;
+        }
+        else if (bHasNoData != bFirstBandHasNoData)
+        {
+            return false;
+        }
+        else if (bFirstBandHasNoData &&
+                 !((std::isnan(singleNDV) && std::isnan(dfNoData)) ||
+                   (singleNDV == dfNoData)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        RenumberSources()                             */
+/************************************************************************/
+
+// Adds nOffset to the index of each "sourceN" variable of an expression
+static std::string RenumberSources(const std::string &osExpr, int nOffset)
+{
+    std::string osRet;
+    constexpr const char *SOURCE = "source";
+    constexpr size_t SOURCE_LEN = 6;
+    for (size_t i = 0; i < osExpr.size();)
+    {
+        if (osExpr.compare(i, SOURCE_LEN, SOURCE) == 0 &&
+            i + SOURCE_LEN < osExpr.size() &&
+            isdigit(static_cast<unsigned char>(osExpr[i + SOURCE_LEN])))
+        {
+            i += SOURCE_LEN;
+            const int nIdx = atoi(osExpr.c_str() + i);
+            while (i < osExpr.size() &&
+                   isdigit(static_cast<unsigned char>(osExpr[i])))
+                ++i;
+            osRet += SOURCE;
+            osRet += std::to_string(nIdx + nOffset);
+        }
+        else
+        {
+            osRet += osExpr[i];
+            ++i;
+        }
+    }
+    return osRet;
+}
+
+/************************************************************************/
+/*            GDALComputedDataset::GetFusableComputedDataset()          */
+/************************************************************************/
+
+// Returns the computed dataset of a band whose expression can be fused in
+// the expression of a band using it. This requires its values to be stored
+// without loss, that is as Float64.
+/* static */ const GDALComputedDataset *
+GDALComputedDataset::GetFusableComputedDataset(const GDALRasterBand *poBand)
+{
+    if (!poBand || poBand->GetRasterDataType() != GDT_Float64)
+        return nullptr;
+    const auto poComputedDS = dynamic_cast<const GDALComputedDataset *>(
+        const_cast<GDALRasterBand *>(poBand)->GetDataset());
+    if (!poComputedDS || poComputedDS->m_osExpression.empty())
+        return nullptr;
+    return poComputedDS;
+}
+
+/************************************************************************/
+/*             GDALComputedDataset::InitArithmeticExpression()          */
+/************************************************************************/
+
+// Sets m_osExpression for additions, subtractions, multiplications and
+// divisions by a constant, which are evaluated with the same result by their
+// pixel function and by the expression pixel function. Division by a band is
+// excluded, as the div pixel function returns infinity for a zero
+// denominator.
+// When an operand is itself such an operation computed as Float64, its
+// expression is fused in the one of this band, expressed on the operands of
+// the operand, so that a chain of operations is evaluated at once instead of
+// through a chain of VRT derived bands. Returns true in that case, with
+// m_poBands set to the bands the expression applies to.
+bool GDALComputedDataset::InitArithmeticExpression(
+    GDALComputedRasterBand::Operation op, const GDALRasterBand *firstBand,
+    const double *pFirstConstant, const GDALRasterBand *secondBand,
+    const double *pSecondConstant)
+{
+    using Operation = GDALComputedRasterBand::Operation;
+    if (!firstBand || pFirstConstant ||
+        (op != Operation::OP_ADD && op != Operation::OP_SUBTRACT &&
+         op != Operation::OP_MULTIPLY &&
+         !(op == Operation::OP_DIVIDE && pSecondConstant)))
+    {
+        return false;
+    }
+
+    double dfConstant = 0;
+    if (pSecondConstant)
+    {
+        dfConstant = *pSecondConstant;
+        if (op == Operation::OP_SUBTRACT)
+            dfConstant = -dfConstant;
+        else if (op == Operation::OP_DIVIDE)
+            dfConstant = 1.0 / dfConstant;
+        if (!std::isfinite(dfConstant))
+            return false;
+    }
+
+    for (const bool bAllowFusion : {true, false})
+    {
+        std::vector<GDALRasterBand *> apoBands;
+        bool bFused = false;
+        const auto GetOperandExpression =
+            [&apoBands, &bFused, bAllowFusion](const GDALRasterBand *poOperand)
+        {
+            if (const auto poOperandDS =
+                    bAllowFusion ? GetFusableComputedDataset(poOperand)
+                                 : nullptr)
+            {
+                const int nOffset = static_cast<int>(apoBands.size());
+                apoBands.insert(apoBands.end(), poOperandDS->m_poBands.begin(),
+                                poOperandDS->m_poBands.end());
+                bFused = true;
+                return "(" +
+                       RenumberSources(poOperandDS->m_osExpression, nOffset) +
+                       ")";
+            }
+            apoBands.push_back(const_cast<GDALRasterBand *>(poOperand));
+            return "source" + std::to_string(apoBands.size());
+        };
+
+        std::string osExpr;
+        if (secondBand)
+        {
+            const std::string osFirst = GetOperandExpression(firstBand);
+            const std::string osSecond = GetOperandExpression(secondBand);
+            osExpr = osFirst;
+            osExpr += op == Operation::OP_ADD        ? " + "
+                      : op == Operation::OP_SUBTRACT ? " - "
+                                                     : " * ";
+            osExpr += osSecond;
+        }
+        else
+        {
+            // Same order of operands as the sum and mul pixel functions
+            osExpr = CPLSPrintf("%.17g", dfConstant);
+            osExpr += (op == Operation::OP_ADD || op == Operation::OP_SUBTRACT)
+                          ? " + "
+                          : " * ";
+            osExpr += GetOperandExpression(firstBand);
+        }
+
+        if (bFused)
+        {
+            // The nodata values of the bands must be consistent, so that
+            // nodata propagation gives the same result as with intermediate
+            // bands.
+            bool hasAtLeastOneNDV = false;
+            double singleNDV = 0;
+            bool bCanFuse = HaveAllBandsSameNoDataValue(
+                apoBands.data(), apoBands.size(), hasAtLeastOneNDV, singleNDV);
+            for (const auto *poIterBand : apoBands)
+            {
+                if (GDALDataTypeIsComplex(poIterBand->GetRasterDataType()))
+                    bCanFuse = false;
+            }
+            if (!bCanFuse)
+                continue;
+            m_poBands = std::move(apoBands);
+        }
+        m_osExpression = std::move(osExpr);
+        return bFused;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                        GDALComputedDataset()                         */
 /************************************************************************/
@@ -193,7 +403,14 @@ GDALComputedDataset::GDALComputedDataset(
     else
     {
         m_aosOptions.SetNameValue("subclass", "VRTDerivedRasterBand");
-        if (IsComparisonOperator(op))
+        if (InitArithmeticExpression(op, firstBand, pFirstConstant, secondBand,
+                                     pSecondConstant))
+        {
+            m_aosOptions.SetNameValue("PixelFunctionType", "expression");
+            m_aosOptions.SetNameValue("_PIXELFN_ARG_expression",
+                                      m_osExpression.c_str());
+        }
+        else if (IsComparisonOperator(op))
         {
             m_aosOptions.SetNameValue("PixelFunctionType", "expression");
             if (firstBand && secondBand)
@@ -316,6 +533,20 @@ GDALComputedDataset::GDALComputedDataset(
                                       CPLSPrintf("%.17g", constant));
         }
         m_aosOptions.SetNameValue("_PIXELFN_ARG_propagateNoData", "true");
+
+        if (op == GDALComputedRasterBand::Operation::OP_ADD &&
+            (std::isnan(constant) || std::isfinite(constant)))
+        {
+            // Same order of operands as the sum pixel function
+            if (!std::isnan(constant))
+                m_osExpression = CPLSPrintf("%.17g + ", constant);
+            for (size_t i = 0; i < m_poBands.size(); ++i)
+            {
+                if (i > 0)
+                    m_osExpression += " + ";
+                m_osExpression += "source" + std::to_string(i + 1);
+            }
+        }
     }
     m_oVRTDS.AddBand(eDT, m_aosOptions.List());
 
@@ -330,43 +561,6 @@ GDALComputedDataset::GDALComputedDataset(
 
 GDALComputedDataset::~GDALComputedDataset() = default;
 
-/************************************************************************/
-/*                       HaveAllBandsSameNoDataValue()                  */
-/************************************************************************/
-
-static bool HaveAllBandsSameNoDataValue(GDALRasterBand **apoBands,
-                                        size_t nBands, bool &hasAtLeastOneNDV,
-                                        double &singleNDV)
-{
-    hasAtLeastOneNDV = false;
-    singleNDV = 0;
-
-    int bFirstBandHasNoData = false;
-    for (size_t i = 0; i < nBands; ++i)
-    {
-        int bHasNoData = false;
-        const double dfNoData = apoBands[i]->GetNoDataValue(&bHasNoData);
-        if (bHasNoData)
-            hasAtLeastOneNDV = true;
-        if (i == 0)
-        {
-            bFirstBandHasNoData = bHasNoData;
-            singleNDV = dfNoData;
-        }
-        else if (bHasNoData != bFirstBandHasNoData)
-        {
-            return false;
-        }
-        else if (bFirstBandHasNoData &&
-                 !((std::isnan(singleNDV) && std::isnan(dfNoData)) ||
-                   (singleNDV == dfNoData)))
-        {
-            return false;
-        }
-    }
-    return true;
-}
-
 /************************************************************************/
 /*                  GDALComputedDataset::AddSources()                   */
 /************************************************************************/
@@ -35,9 +35,11 @@
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
 #include "gdal_alg.h"
+#include "gdalrasterblock_priv.h"
 #include "ogr_api.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -110,6 +112,12 @@ class GDALDataset::Private
 
     GDALDataset *poParentDataset = nullptr;
 
+    // Block cache statistics and quota. Not used if poParentDataset is set.
+    GDALBlockCacheCounters m_oBlockCacheCounters{};
+
+    // Created by GDALRasterBand::PrefetchBlocks()
+    std::unique_ptr<GDALBlockPrefetcher> m_poBlockPrefetcher{};
+
     bool m_bOverviewsEnabled = true;
 
     std::vector<int>
@@ -2842,6 +2850,8 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                              GDALRasterIOExtraArg *psExtraArg)
 
 {
+    CPLTraceScope oTraceScope("GDALDataset::RasterIO");
+
     GDALRasterIOExtraArg sExtraArg;
     if (psExtraArg == nullptr)
     {
@@ -3900,6 +3910,11 @@ retry:
             poDriver->GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER) == nullptr)
             continue;
 
+        // Skip drivers declaring signatures that the file header does not
+        // match, without calling their Identify() method.
+        if (!poDriver->MatchesOpenSignatures(&oOpenInfo))
+            continue;
+
         // Remove general OVERVIEW_LEVEL open options from list before passing
         // it to the driver, if it isn't a driver specific option already.
         char **papszTmpOpenOptions = nullptr;
@@ -8368,6 +8383,193 @@ OGRErr GDALDatasetRollbackTransaction(GDALDatasetH hDS)
     return GDALDataset::FromHandle(hDS)->RollbackTransaction();
 }
 
+/************************************************************************/
+/*                       GetBlockCacheCounters()                        */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/* Return the block cache counters of the dataset, or of its parent dataset */
+/* when it has been linked to it with ShareLockWithParentDataset(), so that */
+/* overview and mask datasets are accounted with their main dataset. */
+
+GDALBlockCacheCounters *GDALDataset::GetBlockCacheCounters() const
+{
+    const GDALDataset *poDS = this;
+    while (poDS->m_poPrivate && poDS->m_poPrivate->poParentDataset)
+        poDS = poDS->m_poPrivate->poParentDataset;
+    return poDS->m_poPrivate ? &(poDS->m_poPrivate->m_oBlockCacheCounters)
+                             : nullptr;
+}
+
+/************************************************************************/
+/*                         GetBlockPrefetcher()                         */
+/************************************************************************/
+
+GDALBlockPrefetcher *GDALDataset::GetBlockPrefetcher(bool bCreate)
+{
+    if (!m_poPrivate)
+        return nullptr;
+    if (!m_poPrivate->m_poBlockPrefetcher && bCreate)
+    {
+        m_poPrivate->m_poBlockPrefetcher =
+            std::make_unique<GDALBlockPrefetcher>(this);
+    }
+    return m_poPrivate->m_poBlockPrefetcher.get();
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                          SetBlockCacheMax()                          */
+/************************************************************************/
+
+/**
+ \brief Set the maximum memory the block cache may use for this dataset.
+
+ When blocks of this dataset would make its cache memory use exceed this
+ quota, the least recently used blocks of this dataset are evicted, even if
+ the global block cache (see GDALSetCacheMax64()) is not full. This prevents
+ a single dataset from evicting the blocks of all other datasets. The quota
+ is not enforced on blocks that are currently locked.
+
+ The quota applies to the dataset and to its overview and mask datasets when
+ the driver manages them as child datasets (e.g. GeoTIFF).
+
+ The initial value can be set with the GDAL_DATASET_CACHEMAX configuration
+ option, taken into account the first time a block of the dataset is added
+ to the block cache, or GetBlockCacheMax() is called, unless this method has
+ been called before.
+
+ This method is the same as the C function GDALDatasetSetCacheMax().
+
+ @param nBytes Maximum number of bytes, or 0 to remove the quota.
+ @since GDAL 3.12
+*/
+
+void GDALDataset::SetBlockCacheMax(GIntBig nBytes)
+{
+    GDALBlockCacheCounters *poCounters = GetBlockCacheCounters();
+    if (poCounters)
+        poCounters->nCacheMax = std::max<GIntBig>(0, nBytes);
+}
+
+/************************************************************************/
+/*                       GDALDatasetSetCacheMax()                       */
+/************************************************************************/
+
+/**
+ \brief Set the maximum memory the block cache may use for this dataset.
+
+ This function is the same as the C++ method GDALDataset::SetBlockCacheMax().
+
+ @param hDS Dataset handle.
+ @param nBytes Maximum number of bytes, or 0 to remove the quota.
+ @since GDAL 3.12
+*/
+
+void GDALDatasetSetCacheMax(GDALDatasetH hDS, GIntBig nBytes)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetSetCacheMax");
+
+    GDALDataset::FromHandle(hDS)->SetBlockCacheMax(nBytes);
+}
+
+/************************************************************************/
+/*                          GetBlockCacheMax()                          */
+/************************************************************************/
+
+/**
+ \brief Get the maximum memory the block cache may use for this dataset.
+
+ This method is the same as the C function GDALDatasetGetCacheMax().
+
+ @return maximum number of bytes, or 0 if there is no quota.
+ @since GDAL 3.12
+*/
+
+GIntBig GDALDataset::GetBlockCacheMax() const
+{
+    GDALBlockCacheCounters *poCounters = GetBlockCacheCounters();
+    return poCounters ? poCounters->GetCacheMax() : 0;
+}
+
+/************************************************************************/
+/*                       GDALDatasetGetCacheMax()                       */
+/************************************************************************/
+
+/**
+ \brief Get the maximum memory the block cache may use for this dataset.
+
+ This function is the same as the C++ method GDALDataset::GetBlockCacheMax().
+
+ @param hDS Dataset handle.
+ @return maximum number of bytes, or 0 if there is no quota.
+ @since GDAL 3.12
+*/
+
+GIntBig GDALDatasetGetCacheMax(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCacheMax", 0);
+
+    return GDALDataset::FromHandle(hDS)->GetBlockCacheMax();
+}
+
+/************************************************************************/
+/*                      GetBlockCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ \brief Get the block cache statistics of this dataset.
+
+ Counters are accumulated since the dataset was opened, and include its
+ overview and mask datasets when the driver manages them as child datasets.
+
+ This method is the same as the C function GDALDatasetGetCacheStatistics().
+
+ @param psStats Structure to fill. Must not be NULL.
+ @since GDAL 3.12
+*/
+
+void GDALDataset::GetBlockCacheStatistics(
+    GDALBlockCacheStatistics *psStats) const
+{
+    memset(psStats, 0, sizeof(*psStats));
+    const GDALBlockCacheCounters *poCounters = GetBlockCacheCounters();
+    if (poCounters)
+    {
+        psStats->nHits = poCounters->nHits;
+        psStats->nMisses = poCounters->nMisses;
+        psStats->nEvictions = poCounters->nEvictions;
+        psStats->nDirtyFlushes = poCounters->nDirtyFlushes;
+        psStats->nCacheUsed = poCounters->nCacheUsed;
+    }
+}
+
+/************************************************************************/
+/*                   GDALDatasetGetCacheStatistics()                    */
+/************************************************************************/
+
+/**
+ \brief Get the block cache statistics of a dataset.
+
+ This function is the same as the C++ method
+ GDALDataset::GetBlockCacheStatistics().
+
+ @param hDS Dataset handle.
+ @param psStats Structure to fill. Must not be NULL.
+ @since GDAL 3.12
+*/
+
+void GDALDatasetGetCacheStatistics(GDALDatasetH hDS,
+                                   GDALBlockCacheStatistics *psStats)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetGetCacheStatistics");
+    VALIDATE_POINTER0(psStats, "GDALDatasetGetCacheStatistics");
+
+    GDALDataset::FromHandle(hDS)->GetBlockCacheStatistics(psStats);
+}
+
 //! @cond Doxygen_Suppress
 
 /************************************************************************/
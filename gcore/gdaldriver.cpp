@@ -2749,6 +2749,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
             continue;
 
+        if (!poDriver->MatchesOpenSignatures(&oOpenInfo))
+            continue;
+
         if (poDriver->pfnIdentifyEx)
         {
             if (poDriver->pfnIdentifyEx(poDriver, &oOpenInfo) > 0)
@@ -2799,6 +2802,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
             continue;
 
+        if (!poDriver->MatchesOpenSignatures(&oOpenInfo))
+            continue;
+
         if (poDriver->pfnIdentifyEx != nullptr)
         {
             if (poDriver->pfnIdentifyEx(poDriver, &oOpenInfo) == 0)
@@ -2864,10 +2870,73 @@ CPLErr GDALDriver::SetMetadataItem(const char *pszName, const char *pszValue,
         {
             GDALMajorObject::SetMetadataItem(GDAL_DMD_EXTENSION, pszValue);
         }
+        /* Parse GDAL_DMD_OPEN_SIGNATURES once for all for GDALOpenEx() */
+        else if (EQUAL(pszName, GDAL_DMD_OPEN_SIGNATURES))
+        {
+            m_aoOpenSignatures.clear();
+            const CPLStringList aosSignatures(
+                CSLTokenizeString(pszValue ? pszValue : ""));
+            for (const char *pszSignature : aosSignatures)
+            {
+                int nOffset = 0;
+                const char *pszHex = strchr(pszSignature, ':');
+                if (pszHex)
+                {
+                    nOffset = atoi(pszSignature);
+                    ++pszHex;
+                }
+                else
+                {
+                    pszHex = pszSignature;
+                }
+                int nBytes = 0;
+                GByte *pabyBytes = CPLHexToBinary(pszHex, &nBytes);
+                if (nOffset >= 0 && nBytes > 0)
+                {
+                    m_aoOpenSignatures.emplace_back(
+                        nOffset,
+                        std::string(reinterpret_cast<const char *>(pabyBytes),
+                                    nBytes));
+                }
+                else
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Driver %s: invalid signature '%s' in %s",
+                             GetDescription(), pszSignature,
+                             GDAL_DMD_OPEN_SIGNATURES);
+                }
+                CPLFree(pabyBytes);
+            }
+        }
     }
     return GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
 }
 
+/************************************************************************/
+/*                       MatchesOpenSignatures()                        */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+bool GDALDriver::MatchesOpenSignatures(const GDALOpenInfo *poOpenInfo) const
+{
+    if (m_aoOpenSignatures.empty() || poOpenInfo->nHeaderBytes == 0)
+        return true;
+    for (const auto &[nOffset, osBytes] : m_aoOpenSignatures)
+    {
+        if (nOffset + static_cast<int>(osBytes.size()) <=
+                poOpenInfo->nHeaderBytes &&
+            memcmp(poOpenInfo->pabyHeader + nOffset, osBytes.data(),
+                   osBytes.size()) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                         InstantiateAlgorithm()                       */
 /************************************************************************/
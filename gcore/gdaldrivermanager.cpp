@@ -539,9 +539,11 @@ int GDALDriverManager::RegisterDriver(GDALDriver *poDriver, bool bHidden)
         poDriver->SetMetadataItem(GDAL_DCAP_RASTER, "YES");
     }
 
-    if (poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST) != nullptr &&
-        poDriver->pfnIdentify == nullptr &&
+    // Check the Identify callbacks first, so that drivers that build their
+    // option lists lazily do not have to materialize them at registration.
+    if (poDriver->pfnIdentify == nullptr &&
         poDriver->pfnIdentifyEx == nullptr &&
+        poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST) != nullptr &&
         !STARTS_WITH_CI(poDriver->GetDescription(), "Interlis"))
     {
         CPLDebug("GDAL",
@@ -13,6 +13,7 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <list>
 #include <queue>
@@ -28,6 +29,7 @@
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "gdal_rat.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "cpl_safemaths.hpp"
 #include "memmultidim.h"
@@ -3208,6 +3210,113 @@ end:
     return true;
 }
 
+/************************************************************************/
+/*                    ProcessPerChunkMultiThreaded()                    */
+/************************************************************************/
+
+/** \brief Call a user-provided function to operate on an array chunk by chunk,
+ * using several threads.
+ *
+ * This is the same as ProcessPerChunk(), except that chunks are processed by
+ * jobs of the global thread pool, with at most nThreads of them running at the
+ * same time. pfnFunc must thus be safe to call concurrently, and chunks are not
+ * necessarily processed in order. The iCurChunk argument passed to pfnFunc is
+ * still the rank of the chunk in the order of ProcessPerChunk(), and can be
+ * used to index per-chunk state.
+ *
+ * Errors emitted by pfnFunc are replayed in the calling thread. Once a call
+ * to pfnFunc has failed, no new chunk is processed.
+ *
+ * The number of threads is taken from the process-wide thread budget (see
+ * GDALReserveThreads()). If only one thread is available, this is equivalent
+ * to ProcessPerChunk().
+ *
+ * @param arrayStartIdx Same as in ProcessPerChunk().
+ * @param count         Same as in ProcessPerChunk().
+ * @param chunkSize     Same as in ProcessPerChunk().
+ * @param pfnFunc       User-provided function of type FuncProcessPerChunkType.
+ *                      Must NOT be nullptr.
+ * @param pUserData     Pointer to pass as the value of the pUserData argument
+ *                      of FuncProcessPerChunkType.
+ * @param nThreads      Maximum number of threads to use, typically from the
+ *                      GDAL_NUM_THREADS configuration option.
+ *
+ * @return true in case of success.
+ * @since GDAL 3.12
+ */
+bool GDALAbstractMDArray::ProcessPerChunkMultiThreaded(
+    const GUInt64 *arrayStartIdx, const GUInt64 *count, const size_t *chunkSize,
+    FuncProcessPerChunkType pfnFunc, void *pUserData, int nThreads)
+{
+    const GDALThreadReservation oThreadReservation(nThreads);
+    nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 && GetDimensionCount() > 0
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+    if (!poPool)
+    {
+        return ProcessPerChunk(arrayStartIdx, count, chunkSize, pfnFunc,
+                               pUserData);
+    }
+
+    struct Context
+    {
+        CPLJobQueue *poJobQueue = nullptr;
+        int nThreads = 0;
+        FuncProcessPerChunkType pfnFunc = nullptr;
+        void *pUserData = nullptr;
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::atomic<bool> bSuccess{true};
+
+        // Called by ProcessPerChunk() in the calling thread
+        static bool SubmitChunk(GDALAbstractMDArray *array,
+                                const GUInt64 *chunkArrayStartIdx,
+                                const size_t *chunkCount, GUInt64 iCurChunk,
+                                GUInt64 nChunkCount, void *pUserDataIn)
+        {
+            Context *ctxt = static_cast<Context *>(pUserDataIn);
+            // Limit the number of queued or running chunks to the number
+            // of threads, so that the iteration does not run ahead.
+            ctxt->poJobQueue->WaitCompletion(ctxt->nThreads - 1);
+            if (!ctxt->bSuccess)
+                return false;
+
+            const size_t nDims = array->GetDimensionCount();
+            std::vector<GUInt64> anStartIdx(chunkArrayStartIdx,
+                                            chunkArrayStartIdx + nDims);
+            std::vector<size_t> anCount(chunkCount, chunkCount + nDims);
+            return ctxt->poJobQueue->SubmitJob(
+                [ctxt, array, anStartIdx, anCount, iCurChunk, nChunkCount]()
+                {
+                    if (!ctxt->bSuccess)
+                        return;
+                    auto oAccumulator =
+                        ctxt->oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    if (!ctxt->pfnFunc(array, anStartIdx.data(),
+                                       anCount.data(), iCurChunk, nChunkCount,
+                                       ctxt->pUserData))
+                    {
+                        ctxt->bSuccess = false;
+                    }
+                });
+        }
+    };
+
+    auto poJobQueue = poPool->CreateJobQueue();
+    Context ctxt;
+    ctxt.poJobQueue = poJobQueue.get();
+    ctxt.nThreads = nThreads;
+    ctxt.pfnFunc = pfnFunc;
+    ctxt.pUserData = pUserData;
+    const bool bRet = ProcessPerChunk(arrayStartIdx, count, chunkSize,
+                                      Context::SubmitChunk, &ctxt);
+    poJobQueue->WaitCompletion();
+    ctxt.oErrorAccumulator.ReplayErrors();
+    return bRet && ctxt.bSuccess;
+}
+
 /************************************************************************/
 /*                          GDALAttribute()                             */
 /************************************************************************/
@@ -4189,6 +4298,35 @@ CSLConstList GDALMDArray::GetStructuralInfo() const
     return nullptr;
 }
 
+/************************************************************************/
+/*                          GetRawBlockInfo()                           */
+/************************************************************************/
+
+/** Return the location and encoding of the raw content of a block.
+ *
+ * This enables readers to fetch and decode the block without going through
+ * the driver, for example to generate Kerchunk references.
+ *
+ * The block is designated by its index along each dimension, that is
+ * the coordinate of its first element divided by the block size returned
+ * by GetBlockSize(). For arrays whose GetBlockSize() returns 0 values, the
+ * whole array is a single block of coordinates (0, ..., 0).
+ *
+ * The default implementation returns false.
+ *
+ * @param panBlockCoordinates Array of GetDimensionCount() values.
+ * @param[out] info Block information.
+ * @return true in case of success, false if the information is not
+ *         available.
+ * @since GDAL 3.12
+ */
+bool GDALMDArray::GetRawBlockInfo(const uint64_t * /* panBlockCoordinates */,
+                                  GDALMDArrayRawBlockInfo &info) const
+{
+    info = GDALMDArrayRawBlockInfo();
+    return false;
+}
+
 /************************************************************************/
 /*                          AdviseRead()                                */
 /************************************************************************/
@@ -4647,6 +4785,104 @@ bool GDALMDArray::IsTransposedRequest(
     return nLastIdx == nElts - 1;
 }
 
+/************************************************************************/
+/*                CopyToFinalBufferSameDataTypeBlocked()                */
+/************************************************************************/
+
+// Variant of CopyToFinalBufferSameDataType() for when the destination is not
+// contiguous along the last dimension of the row-major source buffer, but
+// along dimension iDimDstContiguous. The copy is done by square blocks over
+// those 2 dimensions, as in GDALTranspose2D(), so that both reads and writes
+// stay within a few cache lines, instead of striding through the destination
+// for each source element.
+template <size_t N>
+static void CopyToFinalBufferSameDataTypeBlocked(
+    const void *pSrcBuffer, void *pDstBuffer, size_t nDims, const size_t *count,
+    const GPtrDiff_t *bufferStride, size_t iDimDstContiguous)
+{
+    constexpr size_t BLOCK_SIZE = 32;
+
+    std::vector<size_t> anSrcStride(nDims);
+    anSrcStride[nDims - 1] = 1;
+    for (size_t i = nDims - 1; i > 0;)
+    {
+        --i;
+        anSrcStride[i] = anSrcStride[i + 1] * count[i + 1];
+    }
+
+    // Dimension A is contiguous in the destination, dimension B is
+    // contiguous in the source.
+    const size_t iDimA = iDimDstContiguous;
+    const size_t iDimB = nDims - 1;
+    const size_t nCountA = count[iDimA];
+    const size_t nCountB = count[iDimB];
+    const size_t nSrcStrideA = anSrcStride[iDimA];
+    const GPtrDiff_t nDstStrideB = bufferStride[iDimB];
+
+    size_t nOuterIters = 1;
+    for (size_t i = 0; i < iDimB; ++i)
+    {
+        if (i != iDimA)
+            nOuterIters *= count[i];
+    }
+
+    const GByte *pabySrcBuffer = static_cast<const GByte *>(pSrcBuffer);
+    GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
+    std::vector<size_t> anIdx(nDims);
+    for (size_t iOuter = 0; iOuter < nOuterIters; ++iOuter)
+    {
+        size_t nSrcOffset = 0;
+        GPtrDiff_t nDstOffset = 0;
+        for (size_t i = 0; i < iDimB; ++i)
+        {
+            if (i != iDimA)
+            {
+                nSrcOffset += anIdx[i] * anSrcStride[i];
+                nDstOffset += static_cast<GPtrDiff_t>(anIdx[i]) *
+                              bufferStride[i];
+            }
+        }
+        const GByte *pabySrcBase = pabySrcBuffer + nSrcOffset * N;
+        GByte *pabyDstBase = pabyDstBuffer + nDstOffset * N;
+
+        for (size_t a0 = 0; a0 < nCountA; a0 += BLOCK_SIZE)
+        {
+            const size_t a1 = std::min(nCountA, a0 + BLOCK_SIZE);
+            for (size_t b0 = 0; b0 < nCountB; b0 += BLOCK_SIZE)
+            {
+                const size_t b1 = std::min(nCountB, b0 + BLOCK_SIZE);
+                for (size_t b = b0; b < b1; ++b)
+                {
+                    const GByte *pabySrc =
+                        pabySrcBase + (a0 * nSrcStrideA + b) * N;
+                    GByte *pabyDst =
+                        pabyDstBase +
+                        (static_cast<GPtrDiff_t>(a0) +
+                         static_cast<GPtrDiff_t>(b) * nDstStrideB) *
+                            static_cast<GPtrDiff_t>(N);
+                    for (size_t a = a0; a < a1; ++a)
+                    {
+                        memcpy(pabyDst, pabySrc, N);
+                        pabySrc += nSrcStrideA * N;
+                        pabyDst += N;
+                    }
+                }
+            }
+        }
+
+        // Next combination of indices of the other dimensions
+        for (size_t i = iDimB; i > 0;)
+        {
+            --i;
+            if (i == iDimA)
+                continue;
+            if (++anIdx[i] < count[i])
+                break;
+            anIdx[i] = 0;
+        }
+    }
+}
+
 /************************************************************************/
 /*                   CopyToFinalBufferSameDataType()                    */
 /************************************************************************/
@@ -4656,6 +4892,19 @@ void CopyToFinalBufferSameDataType(const void *pSrcBuffer, void *pDstBuffer,
                                    size_t nDims, const size_t *count,
                                    const GPtrDiff_t *bufferStride)
 {
+    if (nDims >= 2 && bufferStride[nDims - 1] != 1 && count[nDims - 1] > 1)
+    {
+        for (size_t i = 0; i + 1 < nDims; ++i)
+        {
+            if (bufferStride[i] == 1 && count[i] > 1)
+            {
+                CopyToFinalBufferSameDataTypeBlocked<N>(
+                    pSrcBuffer, pDstBuffer, nDims, count, bufferStride, i);
+                return;
+            }
+        }
+    }
+
     std::vector<size_t> anStackCount(nDims);
     std::vector<GByte *> pabyDstBufferStack(nDims + 1);
     const GByte *pabySrcBuffer = static_cast<const GByte *>(pSrcBuffer);
@@ -4780,6 +5029,56 @@ lbl_next_depth:
         goto lbl_return_to_caller_in_loop;
 }
 
+/************************************************************************/
+/*                      GetNumThreadsForCopy()                          */
+/************************************************************************/
+
+// Number of threads to use, according to GDAL_NUM_THREADS, to rearrange
+// nElts elements in memory. Small buffers are not worth the thread overhead.
+static int GetNumThreadsForCopy(size_t nElts)
+{
+    constexpr size_t MIN_ELTS_PER_THREAD = 1024 * 1024;
+    if (nElts < 2 * MIN_ELTS_PER_THREAD)
+        return 1;
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return static_cast<int>(std::min<size_t>(
+        std::clamp(nThreads, 1, 1024), nElts / MIN_ELTS_PER_THREAD));
+}
+
+/************************************************************************/
+/*                        RunSplitInRanges()                            */
+/************************************************************************/
+
+// Call func(nStart, nCount) on ranges that partition [0, nTotal), using jobs
+// of the global thread pool if possible.
+template <class Func>
+static void RunSplitInRanges(size_t nTotal, int nThreads, const Func &func)
+{
+    const GDALThreadReservation oThreadReservation(
+        static_cast<int>(std::min<size_t>(nThreads, nTotal)));
+    nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poPool)
+    {
+        func(0, nTotal);
+        return;
+    }
+    auto poJobQueue = poPool->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        const size_t nStart = nTotal / nThreads * i;
+        const size_t nEnd =
+            i + 1 == nThreads ? nTotal : nTotal / nThreads * (i + 1);
+        poJobQueue->SubmitJob([&func, nStart, nEnd]()
+                              { func(nStart, nEnd - nStart); });
+    }
+    poJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                      TransposeLast2Dims()                            */
 /************************************************************************/
@@ -4791,26 +5090,92 @@ static bool TransposeLast2Dims(void *pDstBuffer,
 {
     const size_t nEltsLast2Dims = count[nDims - 2] * count[nDims - 1];
     const auto nDTSize = eDT.GetSize();
-    void *pTempBufferForLast2DimsTranspose =
-        VSI_MALLOC2_VERBOSE(nEltsLast2Dims, nDTSize);
-    if (pTempBufferForLast2DimsTranspose == nullptr)
-        return false;
 
-    GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
-    for (size_t i = 0; i < nEltsNonLast2Dims; ++i)
+    // Each slice is transposed independently, so split them between threads,
+    // each one with its own temporary buffer.
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        GetNumThreadsForCopy(nEltsNonLast2Dims * nEltsLast2Dims),
+        nEltsNonLast2Dims));
+    std::atomic<bool> bSuccess{true};
+    RunSplitInRanges(
+        nEltsNonLast2Dims, nThreads,
+        [&](size_t nStart, size_t nCount)
+        {
+            void *pTempBufferForLast2DimsTranspose =
+                VSI_MALLOC2_VERBOSE(nEltsLast2Dims, nDTSize);
+            if (pTempBufferForLast2DimsTranspose == nullptr)
+            {
+                bSuccess = false;
+                return;
+            }
+
+            GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer) +
+                                   nStart * nDTSize * nEltsLast2Dims;
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                GDALTranspose2D(pabyDstBuffer, eDT.GetNumericDataType(),
+                                pTempBufferForLast2DimsTranspose,
+                                eDT.GetNumericDataType(), count[nDims - 1],
+                                count[nDims - 2]);
+                memcpy(pabyDstBuffer, pTempBufferForLast2DimsTranspose,
+                       nDTSize * nEltsLast2Dims);
+                pabyDstBuffer += nDTSize * nEltsLast2Dims;
+            }
+
+            VSIFree(pTempBufferForLast2DimsTranspose);
+        });
+
+    return bSuccess;
+}
+
+/************************************************************************/
+/*                   CopyToFinalBufferMultiThreaded()                   */
+/************************************************************************/
+
+// Same as CopyToFinalBuffer(), but splits the copy along the outermost
+// dimension that has more than one element, between several threads.
+static void CopyToFinalBufferMultiThreaded(
+    const void *pSrcBuffer, const GDALExtendedDataType &eSrcDataType,
+    void *pDstBuffer, const GDALExtendedDataType &eDstDataType, size_t nDims,
+    const size_t *count, const GPtrDiff_t *bufferStride, size_t nElts)
+{
+    const int nThreads = GetNumThreadsForCopy(nElts);
+    size_t iDimSplit = 0;
+    while (iDimSplit + 1 < nDims && count[iDimSplit] == 1)
+        ++iDimSplit;
+    if (nThreads <= 1 || count[iDimSplit] == 1 ||
+        eSrcDataType.NeedsFreeDynamicMemory() ||
+        eDstDataType.NeedsFreeDynamicMemory())
     {
-        GDALTranspose2D(pabyDstBuffer, eDT.GetNumericDataType(),
-                        pTempBufferForLast2DimsTranspose,
-                        eDT.GetNumericDataType(), count[nDims - 1],
-                        count[nDims - 2]);
-        memcpy(pabyDstBuffer, pTempBufferForLast2DimsTranspose,
-               nDTSize * nEltsLast2Dims);
-        pabyDstBuffer += nDTSize * nEltsLast2Dims;
+        CopyToFinalBuffer(pSrcBuffer, eSrcDataType, pDstBuffer, eDstDataType,
+                          nDims, count, bufferStride);
+        return;
     }
 
-    VSIFree(pTempBufferForLast2DimsTranspose);
+    // Dimensions before iDimSplit have a single element, and can be ignored.
+    const size_t nSplitDims = nDims - iDimSplit;
+    size_t nSrcEltsPerIdx = 1;
+    for (size_t i = iDimSplit + 1; i < nDims; ++i)
+        nSrcEltsPerIdx *= count[i];
+    const size_t nSrcDTSize = eSrcDataType.GetSize();
+    const size_t nDstDTSize = eDstDataType.GetSize();
 
-    return true;
+    RunSplitInRanges(
+        count[iDimSplit], nThreads,
+        [&](size_t nStart, size_t nCount)
+        {
+            std::vector<size_t> anCount(count + iDimSplit, count + nDims);
+            anCount[0] = nCount;
+            CopyToFinalBuffer(
+                static_cast<const GByte *>(pSrcBuffer) +
+                    nStart * nSrcEltsPerIdx * nSrcDTSize,
+                eSrcDataType,
+                static_cast<GByte *>(pDstBuffer) +
+                    static_cast<GPtrDiff_t>(nStart) * bufferStride[iDimSplit] *
+                        static_cast<GPtrDiff_t>(nDstDTSize),
+                eDstDataType, nSplitDims, anCount.data(),
+                bufferStride + iDimSplit);
+        });
 }
 
 /************************************************************************/
@@ -4894,8 +5259,9 @@ bool GDALMDArray::ReadForTransposedRequest(
         VSIFree(pTempBuffer);
         return false;
     }
-    CopyToFinalBuffer(pTempBuffer, eDT, pDstBuffer, bufferDataType, nDims,
-                      count, bufferStride);
+    CopyToFinalBufferMultiThreaded(pTempBuffer, eDT, pDstBuffer,
+                                   bufferDataType, nDims, count, bufferStride,
+                                   nElts);
 
     if (eDT.NeedsFreeDynamicMemory())
     {
@@ -7500,24 +7866,18 @@ GDALMDArray::GetMask(CSLConstList papszOptions) const
 }
 
 /************************************************************************/
-/*                         IsRegularlySpaced()                          */
+/*                    ComputeRegularSpacing()                           */
 /************************************************************************/
 
-/** Returns whether an array is a 1D regularly spaced array.
- *
- * @param[out] dfStart     First value in the array
- * @param[out] dfIncrement Increment/spacing between consecutive values.
- * @return true if the array is regularly spaced.
- */
-bool GDALMDArray::IsRegularlySpaced(double &dfStart, double &dfIncrement) const
+// bExact is set when the values, converted to double, are exactly equal to
+// dfStart + i * dfIncrement, which allows them to be computed instead of read.
+static bool ComputeRegularSpacing(const GDALMDArray &array, double &dfStart,
+                                  double &dfIncrement, bool &bExact)
 {
     dfStart = 0;
     dfIncrement = 0;
-    if (GetDimensionCount() != 1 || GetDataType().GetClass() != GEDTC_NUMERIC)
-        return false;
-    const auto nSize = GetDimensions()[0]->GetSize();
-    if (nSize <= 1 || nSize > 10 * 1000 * 1000)
-        return false;
+    bExact = false;
+    const auto nSize = array.GetDimensions()[0]->GetSize();
 
     size_t nCount = static_cast<size_t>(nSize);
     std::vector<double> adfTmp;
@@ -7557,7 +7917,7 @@ bool GDALMDArray::IsRegularlySpaced(double &dfStart, double &dfIncrement) const
     // time, for example with Zarr datasets.
     // https://bugs.chromium.org/p/oss-fuzz/issues/detail?id=37636 and
     // https://bugs.chromium.org/p/oss-fuzz/issues/detail?id=39273
-    const auto nBlockSize = GetBlockSize()[0];
+    const auto nBlockSize = array.GetBlockSize()[0];
     if (nCount >= 5 && nBlockSize <= nCount / 2)
     {
         size_t nReducedCount =
@@ -7565,8 +7925,8 @@ bool GDALMDArray::IsRegularlySpaced(double &dfStart, double &dfIncrement) const
         while (nReducedCount < 256 && nReducedCount <= (nCount - 2) / 2)
             nReducedCount *= 2;
         anCount[0] = nReducedCount;
-        if (!Read(anStart, anCount, nullptr, nullptr,
-                  GDALExtendedDataType::Create(GDT_Float64), &adfTmp[0]))
+        if (!array.Read(anStart, anCount, nullptr, nullptr,
+                        GDALExtendedDataType::Create(GDT_Float64), &adfTmp[0]))
         {
             return false;
         }
@@ -7580,14 +7940,101 @@ bool GDALMDArray::IsRegularlySpaced(double &dfStart, double &dfIncrement) const
         anCount[0] = nCount - nReducedCount;
     }
 
-    if (!Read(anStart, anCount, nullptr, nullptr,
-              GDALExtendedDataType::Create(GDT_Float64),
-              &adfTmp[static_cast<size_t>(anStart[0])]))
+    if (!array.Read(anStart, anCount, nullptr, nullptr,
+                    GDALExtendedDataType::Create(GDT_Float64),
+                    &adfTmp[static_cast<size_t>(anStart[0])]))
     {
         return false;
     }
 
-    return IsRegularlySpacedInternal();
+    anCount[0] = nCount;
+    if (!IsRegularlySpacedInternal())
+        return false;
+
+    // Values must round-trip through double for the sequence to be usable
+    // instead of the array content.
+    if (!GDALDataTypeIsComplex(array.GetDataType().GetNumericDataType()))
+    {
+        constexpr double MAX_EXACT_INT = 9007199254740992.0;  // 2^53
+        bExact = true;
+        for (size_t i = 0; bExact && i < nCount; i++)
+        {
+            bExact = adfTmp[i] == dfStart + static_cast<double>(i) *
+                                                dfIncrement &&
+                     fabs(adfTmp[i]) < MAX_EXACT_INT;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    GetRegularSpacingWithCache()                      */
+/************************************************************************/
+
+// Same as ComputeRegularSpacing(), but if the
+// GDAL_MULTIDIM_CACHE_REGULAR_SPACING configuration option is set, the
+// result is saved in, and retrieved from, the .aux.xml side-car file.
+static bool GetRegularSpacingWithCache(const GDALMDArray &array,
+                                       double &dfStart, double &dfIncrement,
+                                       bool &bExact)
+{
+    dfStart = 0;
+    dfIncrement = 0;
+    bExact = false;
+    if (array.GetDimensionCount() != 1 ||
+        array.GetDataType().GetClass() != GEDTC_NUMERIC)
+        return false;
+    const auto nSize = array.GetDimensions()[0]->GetSize();
+    if (nSize <= 1 || nSize > 10 * 1000 * 1000)
+        return false;
+
+    const auto poPamArray = dynamic_cast<const GDALPamMDArray *>(&array);
+    std::shared_ptr<GDALPamMultiDim> poPam;
+    if (poPamArray && CPLTestBool(CPLGetConfigOption(
+                          "GDAL_MULTIDIM_CACHE_REGULAR_SPACING", "NO")))
+    {
+        poPam = poPamArray->GetPAM();
+    }
+    if (poPam)
+    {
+        bool bRegular = false;
+        if (poPam->GetRegularSpacing(array.GetFullName(), array.GetContext(),
+                                     nSize, bRegular, dfStart, dfIncrement,
+                                     bExact))
+        {
+            return bRegular;
+        }
+    }
+
+    const bool bRegular =
+        ComputeRegularSpacing(array, dfStart, dfIncrement, bExact);
+    if (poPam)
+    {
+        poPam->SetRegularSpacing(array.GetFullName(), array.GetContext(),
+                                 nSize, bRegular, dfStart, dfIncrement, bExact);
+    }
+    return bRegular;
+}
+
+/************************************************************************/
+/*                         IsRegularlySpaced()                          */
+/************************************************************************/
+
+/** Returns whether an array is a 1D regularly spaced array.
+ *
+ * Starting with GDAL 3.12, if the GDAL_MULTIDIM_CACHE_REGULAR_SPACING
+ * configuration option is set to YES, the result is cached in the .aux.xml
+ * side-car file of arrays that support it, so that later calls, including
+ * from other processes, do not need to read the array.
+ *
+ * @param[out] dfStart     First value in the array
+ * @param[out] dfIncrement Increment/spacing between consecutive values.
+ * @return true if the array is regularly spaced.
+ */
+bool GDALMDArray::IsRegularlySpaced(double &dfStart, double &dfIncrement) const
+{
+    bool bExact = false;
+    return GetRegularSpacingWithCache(*this, dfStart, dfIncrement, bExact);
 }
 
 /************************************************************************/
@@ -8681,9 +9128,21 @@ class GDALDatasetFromArray final : public GDALPamDataset
     std::shared_ptr<GDALMDArray> m_poArray;
     size_t m_iXDim;
     size_t m_iYDim;
-    GDALGeoTransform m_gt{};
-    bool m_bHasGT = false;
+    mutable GDALGeoTransform m_gt{};
+    mutable bool m_bHasGT = false;
+    mutable bool m_bGTGuessed = false;
     mutable std::shared_ptr<OGRSpatialReference> m_poSRS{};
+
+    // Indexing variable of extra dimensions whose values are an exact
+    // arithmetic sequence, and thus do not need to be read.
+    struct IndexingVarSequence
+    {
+        bool bExact = false;
+        double dfStart = 0;
+        double dfIncrement = 0;
+    };
+
+    std::vector<IndexingVarSequence> m_aoExtraDimSequences{};
     GDALMultiDomainMetadata m_oMDD{};
     std::string m_osOvrFilename{};
 
@@ -8738,6 +9197,14 @@ class GDALDatasetFromArray final : public GDALPamDataset
 
     CPLErr GetGeoTransform(GDALGeoTransform &gt) const override
     {
+        // Only guessed when requested, as this requires reading the
+        // indexing variables of the X and Y dimensions.
+        if (!m_bGTGuessed && m_poArray)
+        {
+            m_bGTGuessed = true;
+            m_bHasGT =
+                m_poArray->GuessGeoTransform(m_iXDim, m_iYDim, false, m_gt);
+        }
         gt = m_gt;
         return m_bHasGT ? CE_None : CE_Failure;
     }
@@ -8868,7 +9335,21 @@ GDALRasterBandFromArray::GDALRasterBandFromArray(
                 indexingVar->GetDimensions()[0]->GetSize() ==
                     dims[i]->GetSize())
             {
-                if (dfDelay >= 0 && time(nullptr) - nStartTime > dfDelay)
+                const auto &dt(indexingVar->GetDataType());
+                std::vector<GByte> abyTmp(dt.GetSize());
+                bool bHasValue = false;
+                const auto &oSequence = poDSIn->m_aoExtraDimSequences[j];
+                if (oSequence.bExact)
+                {
+                    const double dfVal =
+                        oSequence.dfStart +
+                        static_cast<double>(anOtherDimCoord[j]) *
+                            oSequence.dfIncrement;
+                    bHasValue = GDALExtendedDataType::CopyValue(
+                        &dfVal, GDALExtendedDataType::Create(GDT_Float64),
+                        &abyTmp[0], dt);
+                }
+                else if (dfDelay >= 0 && time(nullptr) - nStartTime > dfDelay)
                 {
                     if (!bHasWarned)
                     {
@@ -8889,30 +9370,31 @@ GDALRasterBandFromArray::GDALRasterBandFromArray(
                 else
                 {
                     size_t nCount = 1;
-                    const auto &dt(indexingVar->GetDataType());
-                    std::vector<GByte> abyTmp(dt.GetSize());
-                    if (indexingVar->Read(&(anOtherDimCoord[j]), &nCount,
-                                          nullptr, nullptr, dt, &abyTmp[0]))
+                    bHasValue =
+                        indexingVar->Read(&(anOtherDimCoord[j]), &nCount,
+                                          nullptr, nullptr, dt, &abyTmp[0]);
+                }
+
+                if (bHasValue)
+                {
+                    char *pszTmp = nullptr;
+                    GDALExtendedDataType::CopyValue(
+                        &abyTmp[0], dt, &pszTmp,
+                        GDALExtendedDataType::CreateString());
+                    if (pszTmp)
                     {
-                        char *pszTmp = nullptr;
-                        GDALExtendedDataType::CopyValue(
-                            &abyTmp[0], dt, &pszTmp,
-                            GDALExtendedDataType::CreateString());
-                        if (pszTmp)
-                        {
-                            SetMetadataItem(
-                                CPLSPrintf("DIM_%s_VALUE", dimName.c_str()),
-                                pszTmp);
-                            CPLFree(pszTmp);
-                        }
+                        SetMetadataItem(
+                            CPLSPrintf("DIM_%s_VALUE", dimName.c_str()),
+                            pszTmp);
+                        CPLFree(pszTmp);
+                    }
 
-                        const auto &unit(indexingVar->GetUnit());
-                        if (!unit.empty())
-                        {
-                            SetMetadataItem(
-                                CPLSPrintf("DIM_%s_UNIT", dimName.c_str()),
-                                unit.c_str());
-                        }
+                    const auto &unit(indexingVar->GetUnit());
+                    if (!unit.empty())
+                    {
+                        SetMetadataItem(
+                            CPLSPrintf("DIM_%s_UNIT", dimName.c_str()),
+                            unit.c_str());
                     }
                 }
             }
@@ -9895,8 +10377,6 @@ GDALDatasetFromArray *GDALDatasetFromArray::Create(
         }
     }
 
-    poDS->m_bHasGT = array->GuessGeoTransform(iXDim, iYDim, false, poDS->m_gt);
-
     const auto attrs(array->GetAttributes());
     for (const auto &attr : attrs)
     {
@@ -9922,6 +10402,38 @@ GDALDatasetFromArray *GDALDatasetFromArray::Create(
         }
     }
 
+    // Detect indexing variables of extra dimensions whose values can be
+    // computed, to avoid one read per band.
+    poDS->m_aoExtraDimSequences.resize(nNewDimCount);
+    for (size_t j = 0; j < nNewDimCount; ++j)
+    {
+        const auto &poDim = dims[anMapNewToOld[j]];
+        const auto poIndexingVar = poDim->GetIndexingVariable();
+        if (!poIndexingVar || poIndexingVar->GetDimensionCount() != 1 ||
+            poIndexingVar->GetDimensions()[0]->GetSize() != poDim->GetSize())
+        {
+            continue;
+        }
+        const auto &aoItems = aoBandParameterMetadataItems[j];
+        if (std::any_of(aoItems.begin(), aoItems.end(),
+                        [&poIndexingVar](const MetadataItem &oItem)
+                        {
+                            return oItem.poArray->GetFullName() ==
+                                   poIndexingVar->GetFullName();
+                        }))
+        {
+            continue;
+        }
+        auto &oSequence = poDS->m_aoExtraDimSequences[j];
+        if (!GetRegularSpacingWithCache(*(poIndexingVar.get()),
+                                        oSequence.dfStart,
+                                        oSequence.dfIncrement,
+                                        oSequence.bExact))
+        {
+            oSequence.bExact = false;
+        }
+    }
+
     const char *pszDelay = CSLFetchNameValueDef(
         papszOptions, "LOAD_EXTRA_DIM_METADATA_DELAY",
         CPLGetConfigOption("GDAL_LOAD_EXTRA_DIM_METADATA_DELAY", "5"));
@@ -14519,11 +15031,23 @@ struct GDALPamMultiDim::Private
         GUInt64 nValidCount = 0;
     };
 
+    struct RegularSpacing
+    {
+        bool bKnown = false;
+        GUInt64 nSize = 0;
+        bool bRegular = false;
+        double dfStart = 0;
+        double dfIncrement = 0;
+        bool bExact = false;
+    };
+
     struct ArrayInfo
     {
         std::shared_ptr<OGRSpatialReference> poSRS{};
         // cppcheck-suppress unusedStructMember
         Statistics stats{};
+        // cppcheck-suppress unusedStructMember
+        RegularSpacing spacing{};
     };
 
     typedef std::pair<std::string, std::string> NameContext;
@@ -14651,6 +15175,25 @@ void GDALPamMultiDim::Load()
                     CPLGetXMLValue(psStatistics, "ValidSampleCount", "0")));
                 d->m_oMapArray[oKey].stats = sStats;
             }
+
+            const CPLXMLNode *psSpacing =
+                CPLGetXMLNode(psIter, "RegularSpacing");
+            if (psSpacing)
+            {
+                Private::RegularSpacing sSpacing;
+                sSpacing.bKnown = true;
+                sSpacing.nSize = static_cast<GUInt64>(
+                    CPLAtoGIntBig(CPLGetXMLValue(psSpacing, "size", "0")));
+                sSpacing.bRegular = CPLTestBool(
+                    CPLGetXMLValue(psSpacing, "regular", "false"));
+                sSpacing.dfStart =
+                    CPLAtofM(CPLGetXMLValue(psSpacing, "start", "0"));
+                sSpacing.dfIncrement =
+                    CPLAtofM(CPLGetXMLValue(psSpacing, "increment", "0"));
+                sSpacing.bExact =
+                    CPLTestBool(CPLGetXMLValue(psSpacing, "exact", "false"));
+                d->m_oMapArray[oKey].spacing = sSpacing;
+            }
         }
         else
         {
@@ -14746,6 +15289,27 @@ void GDALPamMultiDim::Save()
                 psMDArray, "ValidSampleCount",
                 CPLSPrintf(CPL_FRMT_GUIB, kv.second.stats.nValidCount));
         }
+
+        const auto &spacing = kv.second.spacing;
+        if (spacing.bKnown)
+        {
+            CPLXMLNode *psSpacing =
+                CPLCreateXMLNode(psArrayNode, CXT_Element, "RegularSpacing");
+            CPLAddXMLAttributeAndValue(
+                psSpacing, "size", CPLSPrintf(CPL_FRMT_GUIB, spacing.nSize));
+            CPLAddXMLAttributeAndValue(psSpacing, "regular",
+                                       spacing.bRegular ? "1" : "0");
+            if (spacing.bRegular)
+            {
+                CPLAddXMLAttributeAndValue(
+                    psSpacing, "start", CPLSPrintf("%.17g", spacing.dfStart));
+                CPLAddXMLAttributeAndValue(
+                    psSpacing, "increment",
+                    CPLSPrintf("%.17g", spacing.dfIncrement));
+                CPLAddXMLAttributeAndValue(psSpacing, "exact",
+                                           spacing.bExact ? "1" : "0");
+            }
+        }
     }
 
     int bSaved;
@@ -14885,6 +15449,54 @@ void GDALPamMultiDim::ClearStatistics()
         kv.second.stats.bHasStats = false;
 }
 
+/************************************************************************/
+/*                          GetRegularSpacing()                         */
+/************************************************************************/
+
+bool GDALPamMultiDim::GetRegularSpacing(const std::string &osArrayFullName,
+                                        const std::string &osContext,
+                                        GUInt64 nSize, bool &bRegular,
+                                        double &dfStart, double &dfIncrement,
+                                        bool &bExact)
+{
+    Load();
+    auto oIter =
+        d->m_oMapArray.find(std::make_pair(osArrayFullName, osContext));
+    if (oIter == d->m_oMapArray.end())
+        return false;
+    const auto &spacing = oIter->second.spacing;
+    // Ignore cached information if the array has been resized since then
+    if (!spacing.bKnown || spacing.nSize != nSize)
+        return false;
+    bRegular = spacing.bRegular;
+    dfStart = spacing.dfStart;
+    dfIncrement = spacing.dfIncrement;
+    bExact = spacing.bExact;
+    return true;
+}
+
+/************************************************************************/
+/*                          SetRegularSpacing()                         */
+/************************************************************************/
+
+void GDALPamMultiDim::SetRegularSpacing(const std::string &osArrayFullName,
+                                        const std::string &osContext,
+                                        GUInt64 nSize, bool bRegular,
+                                        double dfStart, double dfIncrement,
+                                        bool bExact)
+{
+    Load();
+    d->m_bDirty = true;
+    auto &spacing =
+        d->m_oMapArray[std::make_pair(osArrayFullName, osContext)].spacing;
+    spacing.bKnown = true;
+    spacing.nSize = nSize;
+    spacing.bRegular = bRegular;
+    spacing.dfStart = bRegular ? dfStart : 0;
+    spacing.dfIncrement = bRegular ? dfIncrement : 0;
+    spacing.bExact = bRegular && bExact;
+}
+
 /************************************************************************/
 /*                             GetPAM()                                 */
 /************************************************************************/
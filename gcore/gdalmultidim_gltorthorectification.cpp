@@ -12,9 +12,11 @@
 
 #include "gdal_priv.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 
 /************************************************************************/
 /*                        GLTOrthoRectifiedArray                        */
@@ -296,138 +298,258 @@ bool GLTOrthoRectifiedArray::IRead(const GUInt64 *arrayStartIdx,
         return false;
     }
 
-    int32_t nMinX = std::numeric_limits<int32_t>::max();
-    int32_t nMaxX = std::numeric_limits<int32_t>::min();
-    const auto nXSize = m_poParent->GetDimensions()[0]->GetSize();
-    for (size_t i = 0; i < nXYValsCount; ++i)
+    const auto nXSize = m_poParent->GetDimensions()[1]->GetSize();
+    const auto nYSize = m_poParent->GetDimensions()[0]->GetSize();
+    const size_t nBandCount = m_apoDims.size() == 3 ? count[2] : 1;
+
+    // Bounding box of the valid source pixels referenced by the output rows
+    // in [iStartRow, iEndRow[
+    struct BBox
     {
-        const int64_t nX64 =
-            static_cast<int64_t>(anGLTX[i]) + m_nGLTIndexOffset;
-        if (nX64 >= 0 && static_cast<uint64_t>(nX64) < nXSize)
+        int32_t nMinX = std::numeric_limits<int32_t>::max();
+        int32_t nMaxX = std::numeric_limits<int32_t>::min();
+        int32_t nMinY = std::numeric_limits<int32_t>::max();
+        int32_t nMaxY = std::numeric_limits<int32_t>::min();
+
+        bool IsEmpty() const
         {
-            const int32_t nX = static_cast<int32_t>(nX64);
-            if (nX < nMinX)
-                nMinX = nX;
-            if (nX > nMaxX)
-                nMaxX = nX;
+            return nMinX > nMaxX || nMinY > nMaxY;
         }
-    }
 
-    int32_t nMinY = std::numeric_limits<int32_t>::max();
-    int32_t nMaxY = std::numeric_limits<int32_t>::min();
-    const auto nYSize = m_poParent->GetDimensions()[0]->GetSize();
-    for (size_t i = 0; i < nXYValsCount; ++i)
+        size_t GetPixelCount() const
+        {
+            return static_cast<size_t>(nMaxY - nMinY + 1) *
+                   static_cast<size_t>(nMaxX - nMinX + 1);
+        }
+    };
+
+    const auto ComputeBBox = [this, count, &anGLTX, &anGLTY, nXSize,
+                              nYSize](size_t iStartRow, size_t iEndRow)
     {
-        const int64_t nY64 =
-            static_cast<int64_t>(anGLTY[i]) + m_nGLTIndexOffset;
-        if (nY64 >= 0 && static_cast<uint64_t>(nY64) < nYSize)
+        BBox sBBox;
+        for (size_t i = iStartRow * count[1]; i < iEndRow * count[1]; ++i)
         {
-            const int32_t nY = static_cast<int32_t>(nY64);
-            if (nY < nMinY)
-                nMinY = nY;
-            if (nY > nMaxY)
-                nMaxY = nY;
+            const int64_t nX64 =
+                static_cast<int64_t>(anGLTX[i]) + m_nGLTIndexOffset;
+            const int64_t nY64 =
+                static_cast<int64_t>(anGLTY[i]) + m_nGLTIndexOffset;
+            if (nX64 >= 0 && static_cast<uint64_t>(nX64) < nXSize &&
+                nY64 >= 0 && static_cast<uint64_t>(nY64) < nYSize)
+            {
+                const int32_t nX = static_cast<int32_t>(nX64);
+                const int32_t nY = static_cast<int32_t>(nY64);
+                sBBox.nMinX = std::min(sBBox.nMinX, nX);
+                sBBox.nMaxX = std::max(sBBox.nMaxX, nX);
+                sBBox.nMinY = std::min(sBBox.nMinY, nY);
+                sBBox.nMaxY = std::max(sBBox.nMaxY, nY);
+            }
         }
-    }
+        return sBBox;
+    };
 
-    if (nMinX > nMaxX || nMinY > nMaxY)
+    const BBox sFullBBox = ComputeBBox(0, count[0]);
+    if (sFullBBox.IsEmpty())
     {
         FillBufferWithNodata();
         return true;
     }
 
-    GUInt64 parentArrayIdxStart[3] = {
-        static_cast<GUInt64>(nMinY), static_cast<GUInt64>(nMinX),
-        m_apoDims.size() == 3 ? arrayStartIdx[2] : 0};
-    size_t parentCount[3] = {static_cast<size_t>(nMaxY - nMinY + 1),
-                             static_cast<size_t>(nMaxX - nMinX + 1),
-                             m_apoDims.size() == 3 ? count[2] : 1};
-    GInt64 parentArrayStep[3] = {1, 1,
-                                 m_apoDims.size() == 3 ? arrayStep[2] : 0};
-
-    size_t nParentValueSize = nBufferDTSize;
-    for (int i = 0; i < 3; ++i)
+    // For swaths not aligned with the output grid, the bounding box of the
+    // whole request may be much larger than the pixels actually used, so
+    // if it is too large, process the request by chunks of rows, each one
+    // reading the bounding box of its own source pixels.
+    constexpr size_t MAX_CHUNK_BYTES = 64 * 1024 * 1024;
+    const size_t nFullBBoxValues = sFullBBox.GetPixelCount() * nBandCount;
+    size_t nChunks = 1;
+    if (nFullBBoxValues > MAX_CHUNK_BYTES / nBufferDTSize)
     {
-        if (parentCount[i] >
-            std::numeric_limits<size_t>::max() / nParentValueSize)
-        {
-            CPLError(
-                CE_Failure, CPLE_OutOfMemory,
-                "GLTOrthoRectifiedArray::IRead(): too big temporary array");
-            return false;
-        }
-        nParentValueSize *= parentCount[i];
+        nChunks = std::min<size_t>(
+            count[0],
+            DIV_ROUND_UP(nFullBBoxValues, MAX_CHUNK_BYTES / nBufferDTSize));
     }
 
-    GPtrDiff_t parentStride[3] = {
-        static_cast<GPtrDiff_t>(parentCount[1] * parentCount[2]),
-        static_cast<GPtrDiff_t>(parentCount[2]), 1};
-    std::vector<GByte> parentValues;
-    try
-    {
-        parentValues.resize(nParentValueSize);
-    }
-    catch (const std::bad_alloc &e)
-    {
-        CPLError(CE_Failure, CPLE_OutOfMemory,
-                 "GLTOrthoRectifiedArray::IRead(): %s", e.what());
-        return false;
-    }
-    if (!m_poParent->Read(parentArrayIdxStart, parentCount, parentArrayStep,
-                          parentStride, bufferDataType, parentValues.data()))
+    // Copying values to the output buffer is done by several threads, which
+    // is worth it for large numbers of bands.
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nMaxThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : std::clamp(atoi(pszNumThreads), 1, 1024);
+    CPLWorkerThreadPool *poPool = nullptr;
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    int nThreads = 1;
+    constexpr size_t MIN_VALUES_PER_THREAD = 1024 * 1024;
+    const size_t nTotalValues = nXYValsCount * nBandCount;
+    if (nMaxThreads > 1 && nTotalValues >= 2 * MIN_VALUES_PER_THREAD)
     {
-        return false;
+        poThreadReservation = std::make_unique<GDALThreadReservation>(
+            static_cast<int>(std::min<size_t>(
+                nMaxThreads, nTotalValues / MIN_VALUES_PER_THREAD)));
+        nThreads = poThreadReservation->GetThreadCount();
+        if (nThreads > 1)
+            poPool = GDALGetGlobalThreadPool(nThreads);
     }
+    auto poJobQueue = poPool ? poPool->CreateJobQueue() : nullptr;
 
-    size_t iGLTIndex = 0;
-    const size_t nXCount = parentCount[1];
-    const size_t nBandCount = m_apoDims.size() == 3 ? parentCount[2] : 1;
-    for (size_t iY = 0; iY < count[0]; ++iY)
+    std::vector<GByte> parentValues;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
     {
-        for (size_t iX = 0; iX < count[1]; ++iX, ++iGLTIndex)
+        const size_t iStartRow = count[0] / nChunks * iChunk;
+        const size_t iEndRow = iChunk + 1 == nChunks
+                                   ? count[0]
+                                   : count[0] / nChunks * (iChunk + 1);
+        const BBox sBBox =
+            nChunks == 1 ? sFullBBox : ComputeBBox(iStartRow, iEndRow);
+        if (sBBox.IsEmpty())
         {
-            const int64_t nX64 =
-                static_cast<int64_t>(anGLTX[iGLTIndex]) + m_nGLTIndexOffset;
-            const int64_t nY64 =
-                static_cast<int64_t>(anGLTY[iGLTIndex]) + m_nGLTIndexOffset;
-            GByte *pabyDstBuffer =
-                static_cast<GByte *>(pDstBuffer) +
-                (iY * bufferStride[0] + iX * bufferStride[1]) *
-                    static_cast<int>(nBufferDTSize);
-            if (nX64 >= nMinX && nX64 <= nMaxX && nY64 >= nMinY &&
-                nY64 <= nMaxY)
+            for (size_t iY = iStartRow; iY < iEndRow; ++iY)
             {
-                const int32_t iSrcX = static_cast<int32_t>(nX64) - nMinX;
-                const int32_t iSrcY = static_cast<int32_t>(nY64) - nMinY;
-                const GByte *pabySrcBuffer =
-                    parentValues.data() +
-                    (iSrcY * nXCount + iSrcX) * nBandCount * nBufferDTSize;
-                GDALCopyWords64(pabySrcBuffer, eBufferDT,
-                                static_cast<int>(nBufferDTSize), pabyDstBuffer,
-                                eBufferDT, nCopyWordsDstStride,
-                                nCopyWordsCount);
-                if (bSomeBandInvalids)
+                for (size_t iX = 0; iX < count[1]; ++iX)
+                {
+                    GByte *pabyDstBuffer =
+                        static_cast<GByte *>(pDstBuffer) +
+                        (iY * bufferStride[0] + iX * bufferStride[1]) *
+                            static_cast<int>(nBufferDTSize);
+                    GDALCopyWords64(abyNoData.data(), eBufferDT, 0,
+                                    pabyDstBuffer, eBufferDT,
+                                    nCopyWordsDstStride, nCopyWordsCount);
+                }
+            }
+            continue;
+        }
+
+        // Read the source values of all bands at once, band being the
+        // fastest varying dimension, so that the values of a pixel are
+        // contiguous.
+        GUInt64 parentArrayIdxStart[3] = {
+            static_cast<GUInt64>(sBBox.nMinY),
+            static_cast<GUInt64>(sBBox.nMinX),
+            m_apoDims.size() == 3 ? arrayStartIdx[2] : 0};
+        size_t parentCount[3] = {
+            static_cast<size_t>(sBBox.nMaxY - sBBox.nMinY + 1),
+            static_cast<size_t>(sBBox.nMaxX - sBBox.nMinX + 1), nBandCount};
+        GInt64 parentArrayStep[3] = {1, 1,
+                                     m_apoDims.size() == 3 ? arrayStep[2] : 0};
+
+        size_t nParentValueSize = nBufferDTSize;
+        for (int i = 0; i < 3; ++i)
+        {
+            if (parentCount[i] >
+                std::numeric_limits<size_t>::max() / nParentValueSize)
+            {
+                CPLError(
+                    CE_Failure, CPLE_OutOfMemory,
+                    "GLTOrthoRectifiedArray::IRead(): too big temporary array");
+                return false;
+            }
+            nParentValueSize *= parentCount[i];
+        }
+
+        GPtrDiff_t parentStride[3] = {
+            static_cast<GPtrDiff_t>(parentCount[1] * parentCount[2]),
+            static_cast<GPtrDiff_t>(parentCount[2]), 1};
+        try
+        {
+            parentValues.resize(nParentValueSize);
+        }
+        catch (const std::bad_alloc &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "GLTOrthoRectifiedArray::IRead(): %s", e.what());
+            return false;
+        }
+        if (!m_poParent->Read(parentArrayIdxStart, parentCount,
+                              parentArrayStep, parentStride, bufferDataType,
+                              parentValues.data()))
+        {
+            return false;
+        }
+
+        const auto GatherRows = [this, arrayStartIdx, count, arrayStep,
+                                 bufferStride, pDstBuffer, nBufferDTSize,
+                                 eBufferDT, nCopyWordsDstStride,
+                                 nCopyWordsCount, &abyNoData, &anGLTX, &anGLTY,
+                                 &sBBox, &parentValues, nBandCount,
+                                 bSomeBandInvalids](size_t iRowStart,
+                                                    size_t iRowEnd)
+        {
+            const size_t nXCount =
+                static_cast<size_t>(sBBox.nMaxX - sBBox.nMinX + 1);
+            size_t iGLTIndex = iRowStart * count[1];
+            for (size_t iY = iRowStart; iY < iRowEnd; ++iY)
+            {
+                for (size_t iX = 0; iX < count[1]; ++iX, ++iGLTIndex)
                 {
-                    for (size_t i = 0; i < count[2]; ++i)
+                    const int64_t nX64 =
+                        static_cast<int64_t>(anGLTX[iGLTIndex]) +
+                        m_nGLTIndexOffset;
+                    const int64_t nY64 =
+                        static_cast<int64_t>(anGLTY[iGLTIndex]) +
+                        m_nGLTIndexOffset;
+                    GByte *pabyDstBuffer =
+                        static_cast<GByte *>(pDstBuffer) +
+                        (iY * bufferStride[0] + iX * bufferStride[1]) *
+                            static_cast<int>(nBufferDTSize);
+                    if (nX64 >= sBBox.nMinX && nX64 <= sBBox.nMaxX &&
+                        nY64 >= sBBox.nMinY && nY64 <= sBBox.nMaxY)
                     {
-                        const size_t iBand = static_cast<size_t>(
-                            arrayStartIdx[2] + i * arrayStep[2]);
-                        if (!m_abyBandValidity[iBand])
+                        const size_t iSrcX =
+                            static_cast<size_t>(nX64 - sBBox.nMinX);
+                        const size_t iSrcY =
+                            static_cast<size_t>(nY64 - sBBox.nMinY);
+                        const GByte *pabySrcBuffer =
+                            parentValues.data() + (iSrcY * nXCount + iSrcX) *
+                                                      nBandCount *
+                                                      nBufferDTSize;
+                        GDALCopyWords64(pabySrcBuffer, eBufferDT,
+                                        static_cast<int>(nBufferDTSize),
+                                        pabyDstBuffer, eBufferDT,
+                                        nCopyWordsDstStride, nCopyWordsCount);
+                        if (bSomeBandInvalids)
                         {
-                            GDALCopyWords64(abyNoData.data(), eBufferDT, 0,
-                                            pabyDstBuffer +
-                                                i * nCopyWordsDstStride,
-                                            eBufferDT, 0, 1);
+                            for (size_t i = 0; i < count[2]; ++i)
+                            {
+                                const size_t iBand = static_cast<size_t>(
+                                    arrayStartIdx[2] + i * arrayStep[2]);
+                                if (!m_abyBandValidity[iBand])
+                                {
+                                    GDALCopyWords64(
+                                        abyNoData.data(), eBufferDT, 0,
+                                        pabyDstBuffer +
+                                            i * nCopyWordsDstStride,
+                                        eBufferDT, 0, 1);
+                                }
+                            }
                         }
                     }
+                    else
+                    {
+                        GDALCopyWords64(abyNoData.data(), eBufferDT, 0,
+                                        pabyDstBuffer, eBufferDT,
+                                        nCopyWordsDstStride, nCopyWordsCount);
+                    }
                 }
             }
-            else
+        };
+
+        const size_t nRows = iEndRow - iStartRow;
+        if (poJobQueue && nRows > 1)
+        {
+            const size_t nJobs = std::min<size_t>(nThreads, nRows);
+            for (size_t iJob = 0; iJob < nJobs; ++iJob)
             {
-                GDALCopyWords64(abyNoData.data(), eBufferDT, 0, pabyDstBuffer,
-                                eBufferDT, nCopyWordsDstStride,
-                                nCopyWordsCount);
+                const size_t iRowStart = iStartRow + nRows / nJobs * iJob;
+                const size_t iRowEnd = iJob + 1 == nJobs
+                                           ? iEndRow
+                                           : iStartRow + nRows / nJobs *
+                                                             (iJob + 1);
+                poJobQueue->SubmitJob([&GatherRows, iRowStart, iRowEnd]()
+                                      { GatherRows(iRowStart, iRowEnd); });
             }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            GatherRows(iStartRow, iEndRow);
         }
     }
 
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -27,12 +28,25 @@
 #include "gdal_priv_templates.hpp"
 
 //! @cond Doxygen_Suppress
+/************************************************************************/
+/*                           MustCacheBlocks()                          */
+/************************************************************************/
+
+// Computed masks are only cached when the parent band cannot be modified,
+// as cached blocks would not be invalidated by writes to the parent band.
+static bool MustCacheBlocks(GDALRasterBand *poParent)
+{
+    return poParent->GetAccess() == GA_ReadOnly &&
+           CPLTestBool(
+               CPLGetConfigOption("GDAL_NODATA_MASK_BAND_CACHE", "NO"));
+}
+
 /************************************************************************/
 /*                        GDALNoDataMaskBand()                          */
 /************************************************************************/
 
 GDALNoDataMaskBand::GDALNoDataMaskBand(GDALRasterBand *poParentIn)
-    : m_poParent(poParentIn)
+    : m_poParent(poParentIn), m_bCacheBlocks(MustCacheBlocks(poParentIn))
 {
     poDS = nullptr;
     nBand = 0;
@@ -58,7 +72,7 @@ GDALNoDataMaskBand::GDALNoDataMaskBand(GDALRasterBand *poParentIn)
 
 GDALNoDataMaskBand::GDALNoDataMaskBand(GDALRasterBand *poParentIn,
                                        double dfNoDataValue)
-    : m_poParent(poParentIn)
+    : m_poParent(poParentIn), m_bCacheBlocks(MustCacheBlocks(poParentIn))
 {
     poDS = nullptr;
     nBand = 0;
@@ -229,9 +243,9 @@ CPLErr GDALNoDataMaskBand::IReadBlock(int nXBlockOff, int nYBlockOff,
 
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-    return IRasterIO(GF_Read, nXOff, nYOff, nXSizeRequest, nYSizeRequest,
-                     pImage, nXSizeRequest, nYSizeRequest, GDT_Byte, 1,
-                     nBlockXSize, &sExtraArg);
+    return ComputeMask(nXOff, nYOff, nXSizeRequest, nYSizeRequest, pImage,
+                       nXSizeRequest, nYSizeRequest, GDT_Byte, 1, nBlockXSize,
+                       &sExtraArg);
 }
 
 /************************************************************************/
@@ -298,6 +312,99 @@ static void SetZeroOr255(GByte *pabyDest, const T *panSrc, int nBufXSize,
     }
 }
 
+/************************************************************************/
+/*                          SetZeroOr255Real()                          */
+/************************************************************************/
+
+// NaN values are the only ones that are not equal to themselves. This is
+// written without std::isnan() so that the loop is vectorized.
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetZeroOr255IfNaN(GByte *pabyDest, const T *pafSrc, size_t nBufSize)
+{
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        // cppcheck-suppress duplicateExpression
+        pabyDest[i] = (pafSrc[i] != pafSrc[i]) ? 0 : 255;
+    }
+}
+
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void
+SetZeroOr255IfEqual(GByte *pabyDest, const T *pafSrc, size_t nBufSize,
+                    T fNoData)
+{
+    using std::abs;
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        // Same as ARE_REAL_EQUAL(), but without short-circuit evaluation
+        const T fVal = pafSrc[i];
+        const bool bIsNoData =
+            (fVal == fNoData) |
+            (abs(fVal - fNoData) <
+             std::numeric_limits<float>::epsilon() * abs(fVal + fNoData) * 2);
+        pabyDest[i] = bIsNoData ? 0 : 255;
+    }
+}
+
+template <class T>
+static void SetZeroOr255Real(GByte *pabyDest, const T *pafSrc, size_t nBufSize,
+                             T fNoData)
+{
+    if (std::isnan(fNoData))
+        SetZeroOr255IfNaN(pabyDest, pafSrc, nBufSize);
+    else
+        SetZeroOr255IfEqual(pabyDest, pafSrc, nBufSize, fNoData);
+}
+
+template <class T>
+static void SetZeroOr255Real(GByte *pabyDest, const T *pafSrc, int nBufXSize,
+                             int nBufYSize, GSpacing nPixelSpace,
+                             GSpacing nLineSpace, T fNoData)
+{
+    if (nPixelSpace == 1 && nLineSpace == nBufXSize)
+    {
+        const size_t nBufSize = static_cast<size_t>(nBufXSize) * nBufYSize;
+        SetZeroOr255Real(pabyDest, pafSrc, nBufSize, fNoData);
+    }
+    else if (nPixelSpace == 1)
+    {
+        for (int iY = 0; iY < nBufYSize; iY++)
+        {
+            SetZeroOr255Real(pabyDest, pafSrc, nBufXSize, fNoData);
+            pabyDest += nLineSpace;
+            pafSrc += nBufXSize;
+        }
+    }
+    else
+    {
+        const bool bIsNoDataNan = std::isnan(fNoData);
+        size_t i = 0;
+        for (int iY = 0; iY < nBufYSize; iY++)
+        {
+            GByte *pabyLineDest = pabyDest + iY * nLineSpace;
+            for (int iX = 0; iX < nBufXSize; iX++)
+            {
+                const T fVal = pafSrc[i];
+                if (bIsNoDataNan && std::isnan(fVal))
+                    *pabyLineDest = 0;
+                else if (ARE_REAL_EQUAL(fVal, fNoData))
+                    *pabyLineDest = 0;
+                else
+                    *pabyLineDest = 255;
+                ++i;
+                pabyLineDest += nPixelSpace;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -313,6 +420,34 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     {
         return CE_Failure;
     }
+
+    // When requested with GDAL_NODATA_MASK_BAND_CACHE=YES, go through the
+    // block cache of the mask band, whose blocks are computed by IReadBlock(),
+    // so that repeated requests of the same area (warping, overviews) do not
+    // recompute the mask from the parent band.
+    if (m_bCacheBlocks)
+    {
+        return GDALRasterBand::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+
+    return ComputeMask(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                       nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                       psExtraArg);
+}
+
+/************************************************************************/
+/*                            ComputeMask()                             */
+/************************************************************************/
+
+CPLErr GDALNoDataMaskBand::ComputeMask(int nXOff, int nYOff, int nXSize,
+                                       int nYSize, void *pData, int nBufXSize,
+                                       int nBufYSize, GDALDataType eBufType,
+                                       GSpacing nPixelSpace,
+                                       GSpacing nLineSpace,
+                                       GDALRasterIOExtraArg *psExtraArg)
+{
     const auto eParentDT = m_poParent->GetRasterDataType();
     const GDALDataType eWrkDT = GetWorkDataType(eParentDT);
 
@@ -344,7 +479,7 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
 
     const auto AllocTempBufferOrFallback =
-        [this, eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+        [this, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
          nBufYSize, eBufType, nPixelSpace, nLineSpace,
          psExtraArg](int nWrkDTSize) -> std::pair<CPLErr, void *>
     {
@@ -386,7 +521,7 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             // Sets a metadata item to prevent potential infinite recursion
             GDALMajorObject::SetMetadataItem(__func__, "IN", "__INTERNAL__");
             const CPLErr eErr = GDALRasterBand::IRasterIO(
-                eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                GF_Read, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                 nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
             GDALMajorObject::SetMetadataItem(__func__, nullptr, "__INTERNAL__");
             return std::pair(eErr, nullptr);
@@ -411,7 +546,6 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             return eErr;
         }
 
-        const bool bIsNoDataNan = std::isnan(m_dfNoDataValue) != 0;
         GByte *pabyDest = static_cast<GByte *>(pData);
 
         /* --------------------------------------------------------------------
@@ -461,48 +595,16 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             {
                 const float fNoData = static_cast<float>(m_dfNoDataValue);
                 const float *pafSrc = static_cast<const float *>(pTemp);
-
-                size_t i = 0;
-                for (int iY = 0; iY < nBufYSize; iY++)
-                {
-                    GByte *pabyLineDest = pabyDest + iY * nLineSpace;
-                    for (int iX = 0; iX < nBufXSize; iX++)
-                    {
-                        const float fVal = pafSrc[i];
-                        if (bIsNoDataNan && std::isnan(fVal))
-                            *pabyLineDest = 0;
-                        else if (ARE_REAL_EQUAL(fVal, fNoData))
-                            *pabyLineDest = 0;
-                        else
-                            *pabyLineDest = 255;
-                        ++i;
-                        pabyLineDest += nPixelSpace;
-                    }
-                }
+                SetZeroOr255Real(pabyDest, pafSrc, nBufXSize, nBufYSize,
+                                 nPixelSpace, nLineSpace, fNoData);
             }
             break;
 
             case GDT_Float64:
             {
                 const double *padfSrc = static_cast<const double *>(pTemp);
-
-                size_t i = 0;
-                for (int iY = 0; iY < nBufYSize; iY++)
-                {
-                    GByte *pabyLineDest = pabyDest + iY * nLineSpace;
-                    for (int iX = 0; iX < nBufXSize; iX++)
-                    {
-                        const double dfVal = padfSrc[i];
-                        if (bIsNoDataNan && std::isnan(dfVal))
-                            *pabyLineDest = 0;
-                        else if (ARE_REAL_EQUAL(dfVal, m_dfNoDataValue))
-                            *pabyLineDest = 0;
-                        else
-                            *pabyLineDest = 255;
-                        ++i;
-                        pabyLineDest += nPixelSpace;
-                    }
-                }
+                SetZeroOr255Real(pabyDest, padfSrc, nBufXSize, nBufYSize,
+                                 nPixelSpace, nLineSpace, m_dfNoDataValue);
             }
             break;
 
@@ -537,8 +639,8 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     if (!pTemp)
         return eErr;
 
-    eErr = IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pTemp, nBufXSize,
-                     nBufYSize, GDT_Byte, 1, nBufXSize, psExtraArg);
+    eErr = ComputeMask(nXOff, nYOff, nXSize, nYSize, pTemp, nBufXSize,
+                       nBufYSize, GDT_Byte, 1, nBufXSize, psExtraArg);
     if (eErr != CE_None)
     {
         VSIFree(pTemp);
@@ -15,6 +15,7 @@
 #include "gdal_proxy.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -51,19 +52,62 @@ void GDALNullifyProxyPoolSingleton()
 
 struct _GDALProxyPoolCacheEntry
 {
-    GIntBig responsiblePID;
-    char *pszFileNameAndOpenOptions;
-    char *pszOwner;
-    GDALDataset *poDS;
-    GIntBig nRAMUsage;
+    GIntBig responsiblePID = 0;
+    char *pszFileNameAndOpenOptions = nullptr;
+    char *pszOwner = nullptr;
+    GDALDataset *poDS = nullptr;
+    GIntBig nRAMUsage = 0;
 
-    /* Ref count of the cached dataset */
-    int refCount;
+    /* Ref count of the cached dataset. -1 while the dataset is being opened */
+    /* or closed. Can be incremented without holding the pool mutex by */
+    /* GDALDatasetPool::TryRefDataset(), and decremented by UnrefDataset() */
+    std::atomic<int> refCount{0};
 
-    GDALProxyPoolCacheEntry *prev;
-    GDALProxyPoolCacheEntry *next;
+    /* Incremented each time the entry is closed or recycled for another */
+    /* dataset, so that TryRefDataset() can check that it still holds the */
+    /* dataset its caller previously got */
+    std::atomic<GUIntBig> nGeneration{0};
+
+    /* Value of nLastUseCounter when the entry was last referenced. Used */
+    /* to evict the least recently used entry */
+    std::atomic<GUIntBig> nLastUse{0};
+
+    GDALProxyPoolCacheEntry *prev = nullptr;
+    GDALProxyPoolCacheEntry *next = nullptr;
 };
 
+static std::atomic<GUIntBig> nLastUseCounter{0};
+
+/************************************************************************/
+/*                          MarkEntryAsUsed()                           */
+/************************************************************************/
+
+static void MarkEntryAsUsed(GDALProxyPoolCacheEntry *entry)
+{
+    entry->nLastUse.store(
+        nLastUseCounter.fetch_add(1, std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                        TryIncrementRefCount()                        */
+/************************************************************************/
+
+/** Atomically increment the reference count of an entry, unless its dataset
+ * is being opened or closed, or, if bExclusive, it is already referenced.
+ */
+static bool TryIncrementRefCount(GDALProxyPoolCacheEntry *entry,
+                                 bool bExclusive)
+{
+    int nRefCount = entry->refCount;
+    do
+    {
+        if (nRefCount < 0 || (bExclusive && nRefCount != 0))
+            return false;
+    } while (!entry->refCount.compare_exchange_weak(nRefCount, nRefCount + 1));
+    return true;
+}
+
 // This variable prevents a dataset that is going to be opened in
 // GDALDatasetPool::_RefDataset from increasing refCount if, during its
 // opening, it creates a GDALProxyPoolDataset.
@@ -124,6 +168,8 @@ class GDALDatasetPool
                                                char **papszOpenOptions,
                                                int bShared, bool bForceOpen,
                                                const char *pszOwner);
+    static bool TryRefDataset(GDALProxyPoolCacheEntry *cacheEntry,
+                              GUIntBig nGeneration, bool bShared);
     static void UnrefDataset(GDALProxyPoolCacheEntry *cacheEntry);
     static void CloseDatasetIfZeroRefCount(const char *pszFileName,
                                            CSLConstList papszOpenOptions,
@@ -163,7 +209,7 @@ GDALDatasetPool::~GDALDatasetPool()
             GDALSetResponsiblePIDForCurrentThread(cur->responsiblePID);
             GDALClose(cur->poDS);
         }
-        CPLFree(cur);
+        delete cur;
         cur = next;
     }
     GDALSetResponsiblePIDForCurrentThread(responsiblePID);
@@ -185,7 +231,8 @@ void GDALDatasetPool::ShowContent()
                i,
                cur->pszFileNameAndOpenOptions ? cur->pszFileNameAndOpenOptions
                                               : "(null)",
-               cur->pszOwner ? cur->pszOwner : "(null)", cur->refCount,
+               cur->pszOwner ? cur->pszOwner : "(null)",
+               cur->refCount.load(),
                (int)cur->responsiblePID);
         i++;
         cur = cur->next;
@@ -249,22 +296,34 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     const auto EvictEntryWithZeroRefCount =
         [this, responsiblePID](bool evictEntryWithOpenedDataset)
     {
-        GDALProxyPoolCacheEntry *cur = firstEntry;
         GDALProxyPoolCacheEntry *candidate = nullptr;
-        while (cur)
+        while (true)
         {
-            GDALProxyPoolCacheEntry *next = cur->next;
-
-            if (cur->refCount == 0 &&
-                (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0))
+            // Select the least recently used entry
+            GDALProxyPoolCacheEntry *cur = firstEntry;
+            candidate = nullptr;
+            while (cur)
             {
-                candidate = cur;
+                GDALProxyPoolCacheEntry *next = cur->next;
+
+                if (cur->refCount == 0 &&
+                    (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0) &&
+                    (!candidate || cur->nLastUse <= candidate->nLastUse))
+                {
+                    candidate = cur;
+                }
+
+                cur = next;
             }
+            if (candidate == nullptr)
+                return false;
 
-            cur = next;
+            // Claim it, unless TryRefDataset() took a reference meanwhile
+            int nExpected = 0;
+            if (candidate->refCount.compare_exchange_strong(nExpected, -1))
+                break;
         }
-        if (candidate == nullptr)
-            return false;
+        ++candidate->nGeneration;
 
         nRAMUsage -= candidate->nRAMUsage;
         candidate->nRAMUsage = 0;
@@ -288,6 +347,11 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         CPLFree(candidate->pszOwner);
         candidate->pszOwner = nullptr;
 
+        // When recycled, the entry remains claimed until the caller has
+        // opened its new dataset
+        if (evictEntryWithOpenedDataset)
+            candidate->refCount = 0;
+
         if (!evictEntryWithOpenedDataset && candidate != firstEntry)
         {
             /* Recycle this entry for the to-be-opened dataset and */
@@ -331,7 +395,8 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
               ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
                (cur->pszOwner != nullptr && pszOwner != nullptr &&
                 strcmp(cur->pszOwner, pszOwner) == 0))) ||
-             (!bShared && cur->refCount == 0)))
+             !bShared) &&
+            TryIncrementRefCount(cur, !bShared))
         {
             if (cur != firstEntry)
             {
@@ -351,7 +416,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
 #endif
             }
 
-            cur->refCount++;
+            MarkEntryAsUsed(cur);
             return cur;
         }
 
@@ -381,8 +446,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     else
     {
         /* Prepend */
-        cur = static_cast<GDALProxyPoolCacheEntry *>(
-            CPLCalloc(1, sizeof(GDALProxyPoolCacheEntry)));
+        cur = new GDALProxyPoolCacheEntry();
         if (lastEntry == nullptr)
             lastEntry = cur;
         cur->prev = nullptr;
@@ -401,6 +465,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     cur->responsiblePID = responsiblePID;
     cur->refCount = -1;  // to mark loading of dataset in progress
     cur->nRAMUsage = 0;
+    MarkEntryAsUsed(cur);
 
     refCountOfDisabledRefCount++;
     const int nFlag =
@@ -461,13 +526,17 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
     {
         GDALProxyPoolCacheEntry *next = cur->next;
 
+        int nExpected = 0;
         if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
             osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
             ((pszOwner == nullptr && cur->pszOwner == nullptr) ||
              (pszOwner != nullptr && cur->pszOwner != nullptr &&
               strcmp(cur->pszOwner, pszOwner) == 0)) &&
-            cur->poDS != nullptr)
+            cur->poDS != nullptr &&
+            cur->refCount.compare_exchange_strong(nExpected, -1))
         {
+            ++cur->nGeneration;
+
             /* Close by pretending we are the thread that GDALOpen'ed this */
             /* dataset */
             GDALSetResponsiblePIDForCurrentThread(cur->responsiblePID);
@@ -487,6 +556,8 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             GDALClose(poDS);
             refCountOfDisabledRefCount--;
 
+            cur->refCount = 0;
+
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
             break;
         }
@@ -617,14 +688,41 @@ GDALDatasetPool::RefDataset(const char *pszFileName, GDALAccess eAccess,
                                   bShared, bForceOpen, pszOwner);
 }
 
+/************************************************************************/
+/*                          TryRefDataset()                             */
+/************************************************************************/
+
+/** Try to take a new reference on an entry previously returned by
+ * RefDataset(), without taking the pool mutex. This succeeds if the entry
+ * still holds the same opened dataset (nGeneration being the generation of
+ * the entry when RefDataset() returned it) and, for a non-shared entry, if it
+ * is not used by anyone else.
+ */
+bool GDALDatasetPool::TryRefDataset(GDALProxyPoolCacheEntry *cacheEntry,
+                                    GUIntBig nGeneration, bool bShared)
+{
+    if (!TryIncrementRefCount(cacheEntry, !bShared))
+        return false;
+
+    // Now that we hold a reference, the entry cannot be closed or recycled
+    if (cacheEntry->nGeneration != nGeneration || cacheEntry->poDS == nullptr)
+    {
+        --cacheEntry->refCount;
+        return false;
+    }
+    MarkEntryAsUsed(cacheEntry);
+    return true;
+}
+
 /************************************************************************/
 /*                       UnrefDataset()                                 */
 /************************************************************************/
 
 void GDALDatasetPool::UnrefDataset(GDALProxyPoolCacheEntry *cacheEntry)
 {
-    CPLMutexHolderD(GDALGetphDLMutex());
-    cacheEntry->refCount--;
+    // No need for the pool mutex: other threads only close or recycle
+    // entries whose reference count they atomically switch from 0 to -1
+    --cacheEntry->refCount;
 }
 
 /************************************************************************/
@@ -920,6 +1018,16 @@ GDALDataset *GDALProxyPoolDataset::RefUnderlyingDataset(bool bForceOpen) const
     /* To make a long story short : this is necessary when warping with
      * ChunkAndWarpMulti */
     /* a VRT of GeoTIFFs that have associated .aux files */
+
+    /* Fast path: reuse the dataset previously used, if it is still opened, */
+    /* without taking the global mutex of the pool. */
+    if (cacheEntry != nullptr &&
+        GDALDatasetPool::TryRefDataset(cacheEntry, m_nCacheEntryGeneration,
+                                       GetShared()))
+    {
+        return cacheEntry->poDS;
+    }
+
     GIntBig curResponsiblePID = GDALGetResponsiblePIDForCurrentThread();
     GDALSetResponsiblePIDForCurrentThread(responsiblePID);
     cacheEntry =
@@ -928,6 +1036,8 @@ GDALDataset *GDALProxyPoolDataset::RefUnderlyingDataset(bool bForceOpen) const
     GDALSetResponsiblePIDForCurrentThread(curResponsiblePID);
     if (cacheEntry != nullptr)
     {
+        // We hold a reference, so the generation cannot change
+        m_nCacheEntryGeneration = cacheEntry->nGeneration;
         if (cacheEntry->poDS != nullptr)
             return cacheEntry->poDS;
         else
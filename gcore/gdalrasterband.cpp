@@ -24,21 +24,36 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_alg_priv.h"
 #include "gdal_rat.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "gdalrasterblock_priv.h"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
 
@@ -79,6 +94,8 @@ GDALRasterBand::~GDALRasterBand()
             poBandBlockCache->DisableDirtyBlockWriting();
     }
     GDALRasterBand::FlushCache(true);
+    if (poBandBlockCache)
+        GDALRasterBlock::DropGhostBlocks(this);
 
     delete poBandBlockCache;
 
@@ -327,6 +344,8 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                 GDALRasterIOExtraArg *psExtraArg)
 
 {
+    CPLTraceScope oTraceScope("GDALRasterBand::RasterIO");
+
     GDALRasterIOExtraArg sExtraArg;
     if (psExtraArg == nullptr)
     {
@@ -1660,7 +1679,11 @@ CPLErr GDALRasterBand::FlushCache(bool bAtClosing)
     if (poBandBlockCache == nullptr || !poBandBlockCache->IsInitOK())
         return eGlobalErr;
 
-    return poBandBlockCache->FlushCache();
+    const CPLErr eErr = poBandBlockCache->FlushCache();
+    GDALRasterBlock::DropCompressedBlocks(this);
+    if (m_bBlocksPrefetched)
+        poDS->GetBlockPrefetcher(false)->Drop(nBand);
+    return eErr;
 }
 
 /************************************************************************/
@@ -1718,7 +1741,12 @@ CPLErr GDALRasterBand::DropCache()
     if (poBandBlockCache == nullptr || !poBandBlockCache->IsInitOK())
         result = eGlobalErr;
     else
+    {
         result = poBandBlockCache->FlushCache();
+        GDALRasterBlock::DropCompressedBlocks(this);
+        if (m_bBlocksPrefetched)
+            poDS->GetBlockPrefetcher(false)->Drop(nBand);
+    }
 
     if (poBandBlockCache)
         poBandBlockCache->EnableDirtyBlockWriting();
@@ -1838,6 +1866,7 @@ CPLErr GDALRasterBand::FlushBlock(int nXBlockOff, int nYBlockOff,
         return (CE_Failure);
     }
 
+    GDALRasterBlock::DropCompressedBlock(this, nXBlockOff, nYBlockOff);
     return poBandBlockCache->FlushBlock(nXBlockOff, nYBlockOff,
                                         bWriteDirtyBlock);
 }
@@ -1942,6 +1971,8 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     /*      Try and fetch from cache.                                       */
     /* -------------------------------------------------------------------- */
     GDALRasterBlock *poBlock = TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    if (poBlock != nullptr)
+        GDALRasterBlock::RecordBlockRequest(this, true);
 
     /* -------------------------------------------------------------------- */
     /*      If we didn't find it in our memory cache, instantiate a         */
@@ -2016,11 +2047,34 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
             return nullptr;
         }
 
-        if (!bJustInitialize)
+        if (bJustInitialize)
+        {
+            // The block content will be overwritten by the caller.
+            GDALRasterBlock::DropCompressedBlock(this, nXBlockOff, nYBlockOff);
+        }
+        else if (poBlock->RestoreFromCompressedCache())
+        {
+            GDALRasterBlock::RecordBlockRequest(this, true);
+        }
+        else if (m_bBlocksPrefetched &&
+                 poDS->GetBlockPrefetcher(false)->Take(
+                     nBand, nXBlockOff, nYBlockOff, poBlock->GetDataRef(),
+                     static_cast<size_t>(poBlock->GetBlockSize())))
+        {
+            // Read by another thread.
+            GDALRasterBlock::RecordBlockRequest(this, false);
+        }
+        else
         {
+            GDALRasterBlock::RecordBlockRequest(this, false);
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
-            eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
+            {
+                CPLTraceScope oTraceScope("GDALRasterBand::IReadBlock");
+                CPLTraceCounterAdd(CPL_TRACE_COUNTER_BLOCKS_READ, 1);
+                eErr =
+                    IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
+            }
             if (bCallLeaveReadWrite)
                 LeaveReadWrite();
             if (eErr != CE_None)
@@ -4087,6 +4141,534 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+namespace
+{
+
+// Partial accumulators of the threads processing the blocks of a band, for
+// values whose merge does not depend on the order of the blocks
+template <class T> class GDALPerThreadAccumulators
+{
+    std::mutex m_oMutex{};
+    std::map<std::thread::id, T> m_oMap{};
+    const T m_oInit;
+
+  public:
+    explicit GDALPerThreadAccumulators(const T &oInit) : m_oInit(oInit)
+    {
+    }
+
+    T &Get()
+    {
+        std::lock_guard oLock(m_oMutex);
+        return m_oMap.try_emplace(std::this_thread::get_id(), m_oInit)
+            .first->second;
+    }
+
+    // Must only be called once all jobs are completed
+    const std::map<std::thread::id, T> &GetAll() const
+    {
+        return m_oMap;
+    }
+};
+
+// Adds the values of buffers of a band to a histogram. The bucket of each
+// possible Byte and UInt16 value is looked up in a table computed once, and
+// the buckets of Float32 values are computed by batches, in a loop that the
+// compiler can vectorize.
+class GDALHistogramAccumulator
+{
+    const GDALDataType m_eDataType;
+    const bool m_bSignedByte;
+    const GDALNoDataValues m_sNoDataValues;
+    const double m_dfMin;
+    const double m_dfScale;
+    const int m_nBuckets;
+    const bool m_bIncludeOutOfRange;
+
+    // Bucket of each Byte or UInt16 value, or -1 if the value is ignored
+    std::vector<int> m_anLUT{};
+
+    int GetBucket(double dfValue) const;
+
+    template <class T>
+    void AccumulateLUT(const T *pData, const GByte *pabyMask, int nXSize,
+                       int nYSize, GPtrDiff_t nLineStride,
+                       GUIntBig *panHistogram) const;
+
+    void AccumulateFloat32(const float *pafData, const GByte *pabyMask,
+                           int nXSize, int nYSize, GPtrDiff_t nLineStride,
+                           GUIntBig *panHistogram) const;
+
+    void AccumulateGeneric(const void *pData, const GByte *pabyMask,
+                           int nXSize, int nYSize, GPtrDiff_t nLineStride,
+                           GUIntBig *panHistogram) const;
+
+  public:
+    GDALHistogramAccumulator(GDALDataType eDataType, bool bSignedByte,
+                             const GDALNoDataValues &sNoDataValues,
+                             double dfMin, double dfMax, int nBuckets,
+                             bool bIncludeOutOfRange, GUIntBig nPixels);
+
+    // nLineStride is expressed in pixels, and applies to pabyMask too
+    void Accumulate(const void *pData, const GByte *pabyMask, int nXSize,
+                    int nYSize, GPtrDiff_t nLineStride,
+                    GUIntBig *panHistogram) const;
+};
+
+/************************************************************************/
+/*                      GDALHistogramAccumulator()                      */
+/************************************************************************/
+
+GDALHistogramAccumulator::GDALHistogramAccumulator(
+    GDALDataType eDataType, bool bSignedByte,
+    const GDALNoDataValues &sNoDataValues, double dfMin, double dfMax,
+    int nBuckets, bool bIncludeOutOfRange, GUIntBig nPixels)
+    : m_eDataType(eDataType), m_bSignedByte(bSignedByte),
+      m_sNoDataValues(sNoDataValues), m_dfMin(dfMin),
+      m_dfScale(nBuckets / (dfMax - dfMin)), m_nBuckets(nBuckets),
+      m_bIncludeOutOfRange(bIncludeOutOfRange)
+{
+    // Computing the table for UInt16 is only worth it if there are
+    // significantly more pixels than possible values
+    const int nLUTSize = eDataType == GDT_Byte ? 256
+                         : (eDataType == GDT_UInt16 && nPixels >= 4 * 65536)
+                             ? 65536
+                             : 0;
+    if (nLUTSize == 0)
+        return;
+    try
+    {
+        m_anLUT.resize(nLUTSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    for (int i = 0; i < nLUTSize; ++i)
+    {
+        const double dfValue =
+            m_bSignedByte ? static_cast<double>(static_cast<signed char>(i))
+                          : static_cast<double>(i);
+        if (m_sNoDataValues.bGotNoDataValue &&
+            ARE_REAL_EQUAL(dfValue, m_sNoDataValues.dfNoDataValue))
+            m_anLUT[i] = -1;
+        else
+            m_anLUT[i] = GetBucket(dfValue);
+    }
+}
+
+/************************************************************************/
+/*                             GetBucket()                              */
+/************************************************************************/
+
+// Returns the bucket of a valid value, or -1 if it is out of range and
+// out of range values are discarded.
+int GDALHistogramAccumulator::GetBucket(double dfValue) const
+{
+    // Given that dfValue and dfMin are not NaN, and dfScale > 0 and finite,
+    // the result of the multiplication cannot be NaN
+    const double dfIndex = floor((dfValue - m_dfMin) * m_dfScale);
+
+    if (dfIndex < 0)
+        return m_bIncludeOutOfRange ? 0 : -1;
+    if (dfIndex >= m_nBuckets)
+        return m_bIncludeOutOfRange ? m_nBuckets - 1 : -1;
+    return static_cast<int>(dfIndex);
+}
+
+/************************************************************************/
+/*                           AccumulateLUT()                            */
+/************************************************************************/
+
+template <class T>
+void GDALHistogramAccumulator::AccumulateLUT(const T *pData,
+                                             const GByte *pabyMask, int nXSize,
+                                             int nYSize,
+                                             GPtrDiff_t nLineStride,
+                                             GUIntBig *panHistogram) const
+{
+    const int *panLUT = m_anLUT.data();
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        const T *pLine = pData + iY * nLineStride;
+        if (pabyMask)
+        {
+            const GByte *pabyMaskLine = pabyMask + iY * nLineStride;
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                const int iBucket = panLUT[pLine[iX]];
+                if (pabyMaskLine[iX] != 0 && iBucket >= 0)
+                    ++panHistogram[iBucket];
+            }
+        }
+        else
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                const int iBucket = panLUT[pLine[iX]];
+                if (iBucket >= 0)
+                    ++panHistogram[iBucket];
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                         AccumulateFloat32()                          */
+/************************************************************************/
+
+void GDALHistogramAccumulator::AccumulateFloat32(
+    const float *pafData, const GByte *pabyMask, int nXSize, int nYSize,
+    GPtrDiff_t nLineStride, GUIntBig *panHistogram) const
+{
+    constexpr int BATCH_SIZE = 256;
+    int anIndex[BATCH_SIZE];
+    const double dfMin = m_dfMin;
+    const double dfScale = m_dfScale;
+    const double dfBuckets = static_cast<double>(m_nBuckets);
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        const float *pafLine = pafData + iY * nLineStride;
+        const GByte *pabyMaskLine =
+            pabyMask ? pabyMask + iY * nLineStride : nullptr;
+        for (int iX0 = 0; iX0 < nXSize; iX0 += BATCH_SIZE)
+        {
+            const int nCount = std::min(BATCH_SIZE, nXSize - iX0);
+            const float *pafBatch = pafLine + iX0;
+
+            // Branchless computation of floor((value - dfMin) * dfScale),
+            // clamped to [-1, nBuckets]. NaN values are mapped to -1, and
+            // are skipped below. floor() is computed as a truncation,
+            // corrected for negative values.
+            for (int i = 0; i < nCount; ++i)
+            {
+                double dfIndex =
+                    (static_cast<double>(pafBatch[i]) - dfMin) * dfScale;
+                dfIndex = dfIndex >= -1.0 ? dfIndex : -1.0;
+                dfIndex = dfIndex <= dfBuckets ? dfIndex : dfBuckets;
+                const int nTruncated = static_cast<int>(dfIndex);
+                anIndex[i] =
+                    nTruncated - (static_cast<double>(nTruncated) > dfIndex);
+            }
+
+            for (int i = 0; i < nCount; ++i)
+            {
+                const float fValue = pafBatch[i];
+                if ((pabyMaskLine && pabyMaskLine[iX0 + i] == 0) ||
+                    std::isnan(fValue) ||
+                    (m_sNoDataValues.bGotFloatNoDataValue &&
+                     ARE_REAL_EQUAL(fValue, m_sNoDataValues.fNoDataValue)))
+                    continue;
+
+                int iBucket = anIndex[i];
+                if (iBucket < 0)
+                {
+                    if (!m_bIncludeOutOfRange)
+                        continue;
+                    iBucket = 0;
+                }
+                else if (iBucket >= m_nBuckets)
+                {
+                    if (!m_bIncludeOutOfRange)
+                        continue;
+                    iBucket = m_nBuckets - 1;
+                }
+                ++panHistogram[iBucket];
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                         AccumulateGeneric()                          */
+/************************************************************************/
+
+void GDALHistogramAccumulator::AccumulateGeneric(
+    const void *pData, const GByte *pabyMask, int nXSize, int nYSize,
+    GPtrDiff_t nLineStride, GUIntBig *panHistogram) const
+{
+    const GDALDataType eDataType = m_eDataType;
+    const GDALNoDataValues &sNoDataValues = m_sNoDataValues;
+    for (int iY = 0; iY < nYSize; iY++)
+    {
+        for (int iX = 0; iX < nXSize; iX++)
+        {
+            const GPtrDiff_t iOffset = iX + iY * nLineStride;
+
+            if (pabyMask && pabyMask[iOffset] == 0)
+                continue;
+
+            double dfValue = 0.0;
+
+            switch (eDataType)
+            {
+                case GDT_Byte:
+                {
+                    if (m_bSignedByte)
+                        dfValue =
+                            static_cast<const signed char *>(pData)[iOffset];
+                    else
+                        dfValue = static_cast<const GByte *>(pData)[iOffset];
+                    break;
+                }
+                case GDT_Int8:
+                    dfValue = static_cast<const GInt8 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt16:
+                    dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_Int16:
+                    dfValue = static_cast<const GInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt32:
+                    dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_Int32:
+                    dfValue = static_cast<const GInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GUInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Int64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Float16:
+                {
+                    using namespace std;
+                    const GFloat16 hfValue =
+                        static_cast<const GFloat16 *>(pData)[iOffset];
+                    if (isnan(hfValue) ||
+                        (sNoDataValues.bGotFloat16NoDataValue &&
+                         ARE_REAL_EQUAL(hfValue,
+                                        sNoDataValues.hfNoDataValue)))
+                        continue;
+                    dfValue = hfValue;
+                    break;
+                }
+                case GDT_Float32:
+                {
+                    const float fValue =
+                        static_cast<const float *>(pData)[iOffset];
+                    if (std::isnan(fValue) ||
+                        (sNoDataValues.bGotFloatNoDataValue &&
+                         ARE_REAL_EQUAL(fValue,
+                                        sNoDataValues.fNoDataValue)))
+                        continue;
+                    dfValue = fValue;
+                    break;
+                }
+                case GDT_Float64:
+                    dfValue = static_cast<const double *>(pData)[iOffset];
+                    if (std::isnan(dfValue))
+                        continue;
+                    break;
+                case GDT_CInt16:
+                {
+                    double dfReal =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CInt32:
+                {
+                    double dfReal =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat16:
+                {
+                    double dfReal =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat32:
+                {
+                    double dfReal =
+                        static_cast<const float *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const float *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat64:
+                {
+                    double dfReal =
+                        static_cast<const double *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const double *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_Unknown:
+                case GDT_TypeCount:
+                    CPLAssert(false);
+                    return;
+            }
+
+            if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
+                sNoDataValues.bGotNoDataValue &&
+                ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
+                continue;
+
+            const int iBucket = GetBucket(dfValue);
+            if (iBucket >= 0)
+                ++panHistogram[iBucket];
+        }
+    }
+}
+
+/************************************************************************/
+/*                             Accumulate()                             */
+/************************************************************************/
+
+void GDALHistogramAccumulator::Accumulate(const void *pData,
+                                          const GByte *pabyMask, int nXSize,
+                                          int nYSize, GPtrDiff_t nLineStride,
+                                          GUIntBig *panHistogram) const
+{
+    if (!m_anLUT.empty() && m_eDataType == GDT_Byte)
+        AccumulateLUT(static_cast<const GByte *>(pData), pabyMask, nXSize,
+                      nYSize, nLineStride, panHistogram);
+    else if (!m_anLUT.empty())
+        AccumulateLUT(static_cast<const GUInt16 *>(pData), pabyMask, nXSize,
+                      nYSize, nLineStride, panHistogram);
+    else if (m_eDataType == GDT_Float32)
+        AccumulateFloat32(static_cast<const float *>(pData), pabyMask, nXSize,
+                          nYSize, nLineStride, panHistogram);
+    else
+        AccumulateGeneric(pData, pabyMask, nXSize, nYSize, nLineStride,
+                          panHistogram);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                      GDALProcessSampledBlocks()                      */
+/************************************************************************/
+
+// Iterates over one block every nSampleRate blocks of poBand. For each block,
+// makeJob(pData, nXCheck, nYCheck, pabyMask) is called from the calling
+// thread and returns the job processing the block, or an empty function to
+// stop iterating. Blocks (and the corresponding mask data) are read from the
+// calling thread, as GetLockedBlockRef() is not thread-safe, but the jobs are
+// run on the global thread pool when GDAL_NUM_THREADS is greater than 1.
+template <class MakeJob>
+static bool GDALProcessSampledBlocks(GDALRasterBand *poBand,
+                                     GDALRasterBand *poMaskBand,
+                                     GIntBig nTotalBlocks, int nSampleRate,
+                                     int nBlocksPerRow,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressData,
+                                     const char *pszProgressMessage,
+                                     MakeJob &&makeJob)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    nThreads = static_cast<int>(std::clamp<GIntBig>(
+        std::min<GIntBig>(nThreads, DIV_ROUND_UP(nTotalBlocks, nSampleRate)),
+        1, 1024));
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    bool bRet = true;
+    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+         iSampleBlock += nSampleRate)
+    {
+        // Limit the number of locked blocks waiting to be processed
+        if (poQueue)
+            poQueue->WaitCompletion(2 * nThreads);
+
+        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
+        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+        GDALRasterBlock *const poBlock =
+            poBand->GetLockedBlockRef(iXBlock, iYBlock);
+        if (poBlock == nullptr)
+        {
+            bRet = false;
+            break;
+        }
+
+        int nXCheck = 0, nYCheck = 0;
+        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+        std::shared_ptr<GByte> pabyMaskData;
+        if (poMaskBand)
+        {
+            pabyMaskData.reset(static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                                   nBlockXSize, nBlockYSize)),
+                               VSIFree);
+            if (!pabyMaskData ||
+                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
+                                     pabyMaskData.get(), nXCheck, nYCheck,
+                                     GDT_Byte, 0, nBlockXSize,
+                                     nullptr) != CE_None)
+            {
+                poBlock->DropLock();
+                bRet = false;
+                break;
+            }
+        }
+
+        const void *pData = poBlock->GetDataRef();
+        auto blockJob = makeJob(pData, nXCheck, nYCheck,
+                                static_cast<const GByte *>(pabyMaskData.get()));
+        if (!blockJob)
+        {
+            poBlock->DropLock();
+            break;
+        }
+
+        const auto job =
+            [blockJob = std::move(blockJob), poBlock, pabyMaskData]()
+        {
+            blockJob();
+            poBlock->DropLock();
+        };
+        if (!poQueue || !poQueue->SubmitJob(job))
+            job();
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(iSampleBlock) /
+                             static_cast<double>(nTotalBlocks),
+                         pszProgressMessage, pProgressData))
+        {
+            poBand->ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+            bRet = false;
+            break;
+        }
+    }
+
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4113,6 +4695,14 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
  * in generating histogram based luts for instance.  Generally bApproxOK is
  * much faster than an exactly computed histogram.
  *
+ * The blocks are read in the calling thread, but, starting with GDAL 3.12,
+ * their values are added to the histogram by GDAL_NUM_THREADS worker threads
+ * (defaults to 1).
+ *
+ * To compute the histograms of several bands of a dataset, in particular a
+ * pixel-interleaved one, GDALDataset::ComputeHistograms() reads the data a
+ * single time.
+ *
  * This method is the same as the C functions GDALGetRasterHistogram() and
  * GDALGetRasterHistogramEx().
  *
@@ -4213,6 +4803,11 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
     }
 
+    const GDALHistogramAccumulator oAccumulator(
+        eDataType, bSignedByte, sNoDataValues, dfMin, dfMax, nBuckets,
+        CPL_TO_BOOL(bIncludeOutOfRange),
+        static_cast<GUIntBig>(nRasterXSize) * nRasterYSize);
+
     if (bApproxOK && HasArbitraryOverviews())
     {
         /* --------------------------------------------------------------------
@@ -4274,174 +4869,16 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             }
         }
 
-        // This isn't the fastest way to do this, but is easier for now.
-        for (int iY = 0; iY < nYReduced; iY++)
-        {
-            for (int iX = 0; iX < nXReduced; iX++)
-            {
-                const int iOffset = iX + iY * nXReduced;
-                double dfValue = 0.0;
+        oAccumulator.Accumulate(pData, pabyMaskData, nXReduced, nYReduced,
+                                nXReduced, panHistogram);
 
-                if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                    continue;
-
-                switch (eDataType)
-                {
-                    case GDT_Byte:
-                    {
-                        if (bSignedByte)
-                            dfValue =
-                                static_cast<signed char *>(pData)[iOffset];
-                        else
-                            dfValue = static_cast<GByte *>(pData)[iOffset];
-                        break;
-                    }
-                    case GDT_Int8:
-                        dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                        break;
-                    case GDT_UInt16:
-                        dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                        break;
-                    case GDT_Int16:
-                        dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                        break;
-                    case GDT_UInt32:
-                        dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                        break;
-                    case GDT_Int32:
-                        dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                        break;
-                    case GDT_UInt64:
-                        dfValue = static_cast<double>(
-                            static_cast<GUInt64 *>(pData)[iOffset]);
-                        break;
-                    case GDT_Int64:
-                        dfValue = static_cast<double>(
-                            static_cast<GInt64 *>(pData)[iOffset]);
-                        break;
-                    case GDT_Float16:
-                    {
-                        using namespace std;
-                        const GFloat16 hfValue =
-                            static_cast<GFloat16 *>(pData)[iOffset];
-                        if (isnan(hfValue) ||
-                            (sNoDataValues.bGotFloat16NoDataValue &&
-                             ARE_REAL_EQUAL(hfValue,
-                                            sNoDataValues.hfNoDataValue)))
-                            continue;
-                        dfValue = hfValue;
-                        break;
-                    }
-                    case GDT_Float32:
-                    {
-                        const float fValue =
-                            static_cast<float *>(pData)[iOffset];
-                        if (std::isnan(fValue) ||
-                            (sNoDataValues.bGotFloatNoDataValue &&
-                             ARE_REAL_EQUAL(fValue,
-                                            sNoDataValues.fNoDataValue)))
-                            continue;
-                        dfValue = fValue;
-                        break;
-                    }
-                    case GDT_Float64:
-                        dfValue = static_cast<double *>(pData)[iOffset];
-                        if (std::isnan(dfValue))
-                            continue;
-                        break;
-                    case GDT_CInt16:
-                    {
-                        const double dfReal =
-                            static_cast<GInt16 *>(pData)[iOffset * 2];
-                        const double dfImag =
-                            static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                        if (std::isnan(dfReal) || std::isnan(dfImag))
-                            continue;
-                        dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                    }
-                    break;
-                    case GDT_CInt32:
-                    {
-                        const double dfReal =
-                            static_cast<GInt32 *>(pData)[iOffset * 2];
-                        const double dfImag =
-                            static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                        if (std::isnan(dfReal) || std::isnan(dfImag))
-                            continue;
-                        dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                    }
-                    break;
-                    case GDT_CFloat16:
-                    {
-                        const double dfReal =
-                            static_cast<GFloat16 *>(pData)[iOffset * 2];
-                        const double dfImag =
-                            static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
-                        if (std::isnan(dfReal) || std::isnan(dfImag))
-                            continue;
-                        dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        break;
-                    }
-                    case GDT_CFloat32:
-                    {
-                        const double dfReal =
-                            static_cast<float *>(pData)[iOffset * 2];
-                        const double dfImag =
-                            static_cast<float *>(pData)[iOffset * 2 + 1];
-                        if (std::isnan(dfReal) || std::isnan(dfImag))
-                            continue;
-                        dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        break;
-                    }
-                    case GDT_CFloat64:
-                    {
-                        const double dfReal =
-                            static_cast<double *>(pData)[iOffset * 2];
-                        const double dfImag =
-                            static_cast<double *>(pData)[iOffset * 2 + 1];
-                        if (std::isnan(dfReal) || std::isnan(dfImag))
-                            continue;
-                        dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        break;
-                    }
-                    case GDT_Unknown:
-                    case GDT_TypeCount:
-                        CPLAssert(false);
-                }
-
-                if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
-                    sNoDataValues.bGotNoDataValue &&
-                    ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
-                    continue;
-
-                // Given that dfValue and dfMin are not NaN, and dfScale > 0 and
-                // finite, the result of the multiplication cannot be NaN
-                const double dfIndex = floor((dfValue - dfMin) * dfScale);
-
-                if (dfIndex < 0)
-                {
-                    if (bIncludeOutOfRange)
-                        panHistogram[0]++;
-                }
-                else if (dfIndex >= nBuckets)
-                {
-                    if (bIncludeOutOfRange)
-                        ++panHistogram[nBuckets - 1];
-                }
-                else
-                {
-                    ++panHistogram[static_cast<int>(dfIndex)];
-                }
-            }
-        }
-
-        CPLFree(pData);
-        CPLFree(pabyMaskData);
-    }
-    else  // No arbitrary overviews.
-    {
-        if (!InitBlockInfo())
-            return CE_Failure;
+        CPLFree(pData);
+        CPLFree(pabyMaskData);
+    }
+    else  // No arbitrary overviews.
+    {
+        if (!InitBlockInfo())
+            return CE_Failure;
 
         /* --------------------------------------------------------------------
          */
@@ -4463,253 +4900,63 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
         /* --------------------------------------------------------------------
          */
-        /*      Read the blocks, and add to histogram. */
+        /*      Read the blocks, and add to histogram. Each thread */
+        /*      processing the blocks adds to its own histogram, and they */
+        /*      are summed at the end. */
         /* --------------------------------------------------------------------
          */
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
-            }
-
-            // this is a special case for a common situation.
-            if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
-                (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
-                nXCheck == nBlockXSize && nBuckets == 256)
-            {
-                const GPtrDiff_t nPixels =
-                    static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
-
-                for (GPtrDiff_t i = 0; i < nPixels; i++)
-                {
-                    if (pabyMaskData && pabyMaskData[i] == 0)
-                        continue;
-                    if (!(sNoDataValues.bGotNoDataValue &&
-                          (pabyData[i] ==
-                           static_cast<GByte>(sNoDataValues.dfNoDataValue))))
-                    {
-                        panHistogram[pabyData[i]]++;
-                    }
-                }
-
-                poBlock->DropLock();
-                continue;  // To next sample block.
-            }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
+        GDALPerThreadAccumulators<std::vector<GUIntBig>> oHistograms(
+            std::vector<GUIntBig>{});
+        std::atomic<bool> bOutOfMemory{false};
+        const int nLineStride = nBlockXSize;
+        const auto makeJob =
+            [&oAccumulator, &oHistograms, &bOutOfMemory, nBuckets,
+             nLineStride](const void *pData, int nXCheck, int nYCheck,
+                          const GByte *pabyMask)
+        {
+            if (bOutOfMemory)
+                return std::function<void()>();
+            return std::function<void()>(
+                [&oAccumulator, &oHistograms, &bOutOfMemory, nBuckets,
+                 nLineStride, pData, nXCheck, nYCheck, pabyMask]()
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    double dfValue = 0.0;
-
-                    switch (eDataType)
-                    {
-                        case GDT_Byte:
-                        {
-                            if (bSignedByte)
-                                dfValue =
-                                    static_cast<signed char *>(pData)[iOffset];
-                            else
-                                dfValue = static_cast<GByte *>(pData)[iOffset];
-                            break;
-                        }
-                        case GDT_Int8:
-                            dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt16:
-                            dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int16:
-                            dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt32:
-                            dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int32:
-                            dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt64:
-                            dfValue = static_cast<double>(
-                                static_cast<GUInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Int64:
-                            dfValue = static_cast<double>(
-                                static_cast<GInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Float16:
-                        {
-                            using namespace std;
-                            const GFloat16 hfValue =
-                                static_cast<GFloat16 *>(pData)[iOffset];
-                            if (isnan(hfValue) ||
-                                (sNoDataValues.bGotFloat16NoDataValue &&
-                                 ARE_REAL_EQUAL(hfValue,
-                                                sNoDataValues.hfNoDataValue)))
-                                continue;
-                            dfValue = hfValue;
-                            break;
-                        }
-                        case GDT_Float32:
-                        {
-                            const float fValue =
-                                static_cast<float *>(pData)[iOffset];
-                            if (std::isnan(fValue) ||
-                                (sNoDataValues.bGotFloatNoDataValue &&
-                                 ARE_REAL_EQUAL(fValue,
-                                                sNoDataValues.fNoDataValue)))
-                                continue;
-                            dfValue = fValue;
-                            break;
-                        }
-                        case GDT_Float64:
-                            dfValue = static_cast<double *>(pData)[iOffset];
-                            if (std::isnan(dfValue))
-                                continue;
-                            break;
-                        case GDT_CInt16:
-                        {
-                            double dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CInt32:
-                        {
-                            double dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat16:
-                        {
-                            double dfReal =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat32:
-                        {
-                            double dfReal =
-                                static_cast<float *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<float *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat64:
-                        {
-                            double dfReal =
-                                static_cast<double *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<double *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_Unknown:
-                        case GDT_TypeCount:
-                            CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
-                    }
-
-                    if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
-                        sNoDataValues.bGotNoDataValue &&
-                        ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
-                        continue;
-
-                    // Given that dfValue and dfMin are not NaN, and dfScale > 0
-                    // and finite, the result of the multiplication cannot be
-                    // NaN
-                    const double dfIndex = floor((dfValue - dfMin) * dfScale);
-
-                    if (dfIndex < 0)
-                    {
-                        if (bIncludeOutOfRange)
-                            panHistogram[0]++;
-                    }
-                    else if (dfIndex >= nBuckets)
+                    auto &anHistogram = oHistograms.Get();
+                    try
                     {
-                        if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
+                        anHistogram.resize(nBuckets);
                     }
-                    else
+                    catch (const std::exception &)
                     {
-                        ++panHistogram[static_cast<int>(dfIndex)];
+                        bOutOfMemory = true;
+                        return;
                     }
-                }
-            }
-
-            poBlock->DropLock();
+                    oAccumulator.Accumulate(pData, pabyMask, nXCheck, nYCheck,
+                                            nLineStride, anHistogram.data());
+                });
+        };
+        if (!GDALProcessSampledBlocks(
+                this, poMaskBand,
+                static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+                nSampleRate, nBlocksPerRow, pfnProgress, pProgressData,
+                "Compute Histogram", makeJob))
+        {
+            return CE_Failure;
+        }
+        if (bOutOfMemory)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in GetHistogram()");
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        for (const auto &oIter : oHistograms.GetAll())
+        {
+            const auto &anHistogram = oIter.second;
+            for (size_t i = 0; i < anHistogram.size(); ++i)
+                panHistogram[i] += anHistogram[i];
+        }
     }
 
     pfnProgress(1.0, "Compute Histogram", pProgressData);
@@ -5092,91 +5339,495 @@ CPLErr CPL_STDCALL GDALRasterAdviseRead(GDALRasterBandH hBand, int nXOff,
 }
 
 /************************************************************************/
-/*                           GetStatistics()                            */
+/*                     SetBlockCacheStreamingHint()                     */
 /************************************************************************/
 
 /**
- * \brief Fetch image statistics.
- *
- * Returns the minimum, maximum, mean and standard deviation of all
- * pixel values in this band.  If approximate statistics are sufficient,
- * the bApproxOK flag can be set to true in which case overviews, or a
- * subset of image tiles may be used in computing the statistics.
- *
- * If bForce is FALSE results will only be returned if it can be done
- * quickly (i.e. without scanning the image, typically by using pre-existing
- * STATISTICS_xxx metadata items). If bForce is FALSE and results cannot be
- * returned efficiently, the method will return CE_Warning but no warning will
- * be issued. This is a non-standard use of the CE_Warning return value
- * to indicate "nothing done".
- *
- * If bForce is TRUE, and results are quickly available without scanning the
- * image, they will be used. If bForce is TRUE and results are not quickly
- * available, GetStatistics() forwards the computation to ComputeStatistics(),
- * which will scan the image.
- *
- * To always force recomputation of statistics, use ComputeStatistics() instead
- * of this method.
- *
- * Note that file formats using PAM (Persistent Auxiliary Metadata) services
- * will generally cache statistics in the .pam file allowing fast fetch
- * after the first request.
+ * \brief Hint that the blocks of this band are read or written only once.
  *
- * This method is the same as the C function GDALGetRasterStatistics().
+ * When set, new blocks of this band are put in the probation segment of the
+ * global block cache, in first-in first-out order, and are evicted before
+ * blocks of other bands. This avoids a single pass over a large raster,
+ * for example to compute statistics or to copy it, to evict blocks that are
+ * repeatedly used by other readers. The hint does not affect blocks already
+ * in the cache.
  *
- * @param bApproxOK If TRUE statistics may be computed based on overviews
- * or a subset of all tiles.
+ * This method is the same as the C function
+ * GDALSetRasterBlockCacheStreamingHint().
  *
- * @param bForce If FALSE statistics will only be returned if it can
- * be done without rescanning the image. If TRUE, statistics computation will
- * be forced if pre-existing values are not quickly available.
+ * @param bStreaming true to enable the hint, false to disable it.
  *
- * @param pdfMin Location into which to load image minimum (may be NULL).
+ * @since GDAL 3.12
+ */
+
+void GDALRasterBand::SetBlockCacheStreamingHint(bool bStreaming)
+{
+    m_bBlockCacheStreamingHint = bStreaming;
+}
+
+/************************************************************************/
+/*                     GetBlockCacheStreamingHint()                     */
+/************************************************************************/
+
+/**
+ * \brief Return whether the blocks of this band are read or written only once.
  *
- * @param pdfMax Location into which to load image maximum (may be NULL).-
+ * @see SetBlockCacheStreamingHint()
  *
- * @param pdfMean Location into which to load image mean (may be NULL).
+ * @since GDAL 3.12
+ */
+
+bool GDALRasterBand::GetBlockCacheStreamingHint() const
+{
+    return m_bBlockCacheStreamingHint;
+}
+
+/************************************************************************/
+/*                 GDALSetRasterBlockCacheStreamingHint()               */
+/************************************************************************/
+
+/**
+ * \brief Hint that the blocks of this band are read or written only once.
  *
- * @param pdfStdDev Location into which to load image standard deviation
- * (may be NULL).
+ * @see GDALRasterBand::SetBlockCacheStreamingHint()
  *
- * @return CE_None on success, CE_Warning if no values returned,
- * CE_Failure if an error occurs.
+ * @since GDAL 3.12
  */
 
-CPLErr GDALRasterBand::GetStatistics(int bApproxOK, int bForce, double *pdfMin,
-                                     double *pdfMax, double *pdfMean,
-                                     double *pdfStdDev)
+void GDALSetRasterBlockCacheStreamingHint(GDALRasterBandH hBand,
+                                          bool bStreaming)
+{
+    VALIDATE_POINTER0(hBand, "GDALSetRasterBlockCacheStreamingHint");
+
+    GDALRasterBand::FromHandle(hBand)->SetBlockCacheStreamingHint(bStreaming);
+}
+
+/************************************************************************/
+/*                         GDALBlockPrefetcher                          */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
 
+GDALBlockPrefetcher::GDALBlockPrefetcher(GDALDataset *poDS) : m_poDS(poDS)
+{
+}
+
+GDALBlockPrefetcher::~GDALBlockPrefetcher()
 {
-    /* -------------------------------------------------------------------- */
-    /*      Do we already have metadata items for the requested values?     */
-    /* -------------------------------------------------------------------- */
-    if ((pdfMin == nullptr ||
-         GetMetadataItem("STATISTICS_MINIMUM") != nullptr) &&
-        (pdfMax == nullptr ||
-         GetMetadataItem("STATISTICS_MAXIMUM") != nullptr) &&
-        (pdfMean == nullptr || GetMetadataItem("STATISTICS_MEAN") != nullptr) &&
-        (pdfStdDev == nullptr ||
-         GetMetadataItem("STATISTICS_STDDEV") != nullptr))
     {
-        if (!(GetMetadataItem("STATISTICS_APPROXIMATE") && !bApproxOK))
+        // Pending jobs will skip blocks that are no longer referenced.
+        std::lock_guard oLock(m_oMutex);
+        m_oMap.clear();
+        m_nUsed = 0;
+    }
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                    GDALBlockPrefetcher::Submit()                     */
+/************************************************************************/
+
+// Queue the reading of the blocks of poBand listed in anBlocks, in that
+// order. Blocks exceeding the memory budget of prefetched blocks, that is a
+// quarter of the block cache size, are skipped.
+// Returns an invalid future if blocks cannot be read asynchronously.
+std::shared_future<CPLErr>
+GDALBlockPrefetcher::Submit(GDALRasterBand *poBand,
+                            std::vector<std::pair<int, int>> anBlocks)
+{
+    if (!m_poClone && !m_bCloneFailed)
+    {
+        // Done here rather than in the job, so that the job never accesses
+        // m_poDS, which may be in the process of being destroyed.
+        m_poClone = m_poDS->Clone(GDAL_OF_RASTER, /* bCanShareState = */ false);
+        m_bCloneFailed = m_poClone == nullptr;
+        if (!m_bCloneFailed)
         {
-            if (pdfMin != nullptr)
-                *pdfMin = CPLAtofM(GetMetadataItem("STATISTICS_MINIMUM"));
-            if (pdfMax != nullptr)
-                *pdfMax = CPLAtofM(GetMetadataItem("STATISTICS_MAXIMUM"));
-            if (pdfMean != nullptr)
-                *pdfMean = CPLAtofM(GetMetadataItem("STATISTICS_MEAN"));
-            if (pdfStdDev != nullptr)
-                *pdfStdDev = CPLAtofM(GetMetadataItem("STATISTICS_STDDEV"));
+            CPLWorkerThreadPool *poPool =
+                GDALGetGlobalThreadPool(CPLGetNumCPUs());
+            if (poPool)
+                m_poJobQueue = poPool->CreateJobQueue();
+            m_bCloneFailed = m_poJobQueue == nullptr;
+        }
+    }
+    if (m_bCloneFailed)
+        return std::shared_future<CPLErr>();
 
-            return CE_None;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const size_t nBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize *
+        GDALGetDataTypeSizeBytes(poBand->GetRasterDataType());
+    const size_t nMaxUsed = static_cast<size_t>(
+        std::min<GIntBig>(GDALGetCacheMax64() / 4,
+                          std::numeric_limits<size_t>::max() / 2));
+    const int nBand = poBand->GetBand();
+
+    auto poPromise = std::make_shared<std::promise<CPLErr>>();
+    std::shared_future<CPLErr> oFuture = poPromise->get_future().share();
+    {
+        std::lock_guard oLock(m_oMutex);
+        std::vector<std::pair<int, int>> anQueuedBlocks;
+        for (const auto &[nXOff, nYOff] : anBlocks)
+        {
+            if (m_nUsed + nBlockSize > nMaxUsed)
+                break;
+            auto &poEntry = m_oMap[Key(nBand, nXOff, nYOff)];
+            if (poEntry)
+                continue;  // Already queued or prefetched.
+            poEntry = std::make_shared<Entry>();
+            poEntry->nSize = nBlockSize;
+            m_nUsed += nBlockSize;
+            anQueuedBlocks.emplace_back(nXOff, nYOff);
         }
+        anBlocks = std::move(anQueuedBlocks);
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Does the driver already know the min/max?                       */
+    if (anBlocks.empty())
+    {
+        poPromise->set_value(CE_None);
+    }
+    else if (!m_poJobQueue->SubmitJob(
+                 [this, nBand, anBlocks, poPromise]()
+                 { Run(nBand, anBlocks, *poPromise); }))
+    {
+        // Entries left in the QUEUED state will be read by the caller of
+        // GetLockedBlockRef().
+        poPromise->set_value(CE_Failure);
+    }
+    return oFuture;
+}
+
+/************************************************************************/
+/*                     GDALBlockPrefetcher::Run()                       */
+/************************************************************************/
+
+void GDALBlockPrefetcher::Run(int nBand,
+                              const std::vector<std::pair<int, int>> &anBlocks,
+                              std::promise<CPLErr> &oPromise)
+{
+    std::lock_guard oCloneLock(m_oCloneMutex);
+
+    // Errors are reported again by GetLockedBlockRef() when it reads the
+    // block itself.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+    GDALRasterBand *poCloneBand = m_poClone->GetRasterBand(nBand);
+    CPLErr eErr = poCloneBand ? CE_None : CE_Failure;
+    for (const auto &[nXOff, nYOff] : anBlocks)
+    {
+        std::shared_ptr<Entry> poEntry;
+        {
+            std::lock_guard oLock(m_oMutex);
+            const auto oIter = m_oMap.find(Key(nBand, nXOff, nYOff));
+            // The entry may have been taken or dropped in the meantime.
+            if (oIter == m_oMap.end() ||
+                oIter->second->eState != State::QUEUED)
+                continue;
+            poEntry = oIter->second;
+            poEntry->eState = State::RUNNING;
+        }
+
+        bool bOK = false;
+        if (poCloneBand)
+        {
+            try
+            {
+                poEntry->abyData.resize(poEntry->nSize);
+                bOK = poCloneBand->ReadBlock(nXOff, nYOff,
+                                             poEntry->abyData.data()) ==
+                      CE_None;
+            }
+            catch (const std::bad_alloc &)
+            {
+            }
+        }
+        if (!bOK)
+            eErr = CE_Failure;
+
+        {
+            std::lock_guard oLock(m_oMutex);
+            poEntry->bOK = bOK;
+            poEntry->eState = State::DONE;
+        }
+        m_oCV.notify_all();
+    }
+
+    oPromise.set_value(eErr);
+}
+
+/************************************************************************/
+/*                     GDALBlockPrefetcher::Take()                      */
+/************************************************************************/
+
+// Remove a prefetched block, and copy its content into pData if it has been
+// successfully read. Waits for the block to be read if it is being read,
+// but not if its reading has not started yet, so that this works even if
+// all threads of the pool are busy.
+bool GDALBlockPrefetcher::Take(int nBand, int nXOff, int nYOff, void *pData,
+                               size_t nSize)
+{
+    std::unique_lock oLock(m_oMutex);
+    const auto oIter = m_oMap.find(Key(nBand, nXOff, nYOff));
+    if (oIter == m_oMap.end())
+        return false;
+    std::shared_ptr<Entry> poEntry = oIter->second;
+    m_oMap.erase(oIter);
+    m_nUsed -= poEntry->nSize;
+    if (poEntry->eState == State::QUEUED)
+        return false;
+    m_oCV.wait(oLock,
+               [&poEntry]() { return poEntry->eState == State::DONE; });
+    oLock.unlock();
+
+    if (!poEntry->bOK || poEntry->abyData.size() != nSize)
+        return false;
+    memcpy(pData, poEntry->abyData.data(), nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     GDALBlockPrefetcher::Drop()                      */
+/************************************************************************/
+
+// Remove all prefetched blocks of a band.
+void GDALBlockPrefetcher::Drop(int nBand)
+{
+    std::lock_guard oLock(m_oMutex);
+    auto oIter = m_oMap.lower_bound(Key(nBand, 0, 0));
+    while (oIter != m_oMap.end() && std::get<0>(oIter->first) == nBand)
+    {
+        m_nUsed -= oIter->second->nSize;
+        oIter = m_oMap.erase(oIter);
+    }
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                           PrefetchBlocks()                           */
+/************************************************************************/
+
+/**
+ * \brief Start reading asynchronously the blocks intersecting a window.
+ *
+ * The blocks are read by a job of the global thread pool, from another
+ * instance of the dataset, and are handed over to the block cache when they
+ * are requested by RasterIO() or GetLockedBlockRef(). This allows a caller
+ * processing a raster in scanline order to overlap the decoding of the next
+ * row of blocks with the processing of the current one.
+ *
+ * Blocks already in the block cache are skipped. The memory used by blocks
+ * not yet handed over to the block cache is limited to a quarter of the
+ * block cache size (see GDALSetCacheMax64()): blocks exceeding that budget
+ * are not prefetched.
+ *
+ * This is only done for bands of datasets opened in read-only mode that can
+ * be re-opened (typically datasets opened with GDALOpenEx() on a file). For
+ * other bands, the blocks are read synchronously into the block cache.
+ *
+ * The returned future must not be waited on from a job of the global thread
+ * pool.
+ *
+ * This method is the same as the C function GDALRasterPrefetchBlocks(),
+ * except that the C function does not return a future.
+ *
+ * @param nXOff The pixel offset to the top left corner of the window.
+ * @param nYOff The line offset to the top left corner of the window.
+ * @param nXSize The width of the window in pixels.
+ * @param nYSize The height of the window in lines.
+ *
+ * @return a future that becomes ready when all blocks have been read, with
+ * CE_None in case of success, or CE_Failure if the window is invalid or some
+ * blocks could not be read.
+ * @since GDAL 3.12
+ */
+
+std::shared_future<CPLErr> GDALRasterBand::PrefetchBlocks(int nXOff, int nYOff,
+                                                          int nXSize,
+                                                          int nYSize)
+{
+    const auto ReadyFuture = [](CPLErr eErr)
+    {
+        std::promise<CPLErr> oPromise;
+        oPromise.set_value(eErr);
+        return oPromise.get_future().share();
+    };
+
+    if (!InitBlockInfo())
+        return ReadyFuture(CE_Failure);
+
+    if (nXOff < 0 || nYOff < 0 || nXSize < 1 || nYSize < 1 ||
+        nXOff > nRasterXSize - nXSize || nYOff > nRasterYSize - nYSize)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Illegal window (%d,%d,%d,%d) in "
+                    "GDALRasterBand::PrefetchBlocks()",
+                    nXOff, nYOff, nXSize, nYSize);
+        return ReadyFuture(CE_Failure);
+    }
+
+    std::vector<std::pair<int, int>> anBlocks;
+    for (int iY = nYOff / nBlockYSize; iY <= (nYOff + nYSize - 1) / nBlockYSize;
+         ++iY)
+    {
+        for (int iX = nXOff / nBlockXSize;
+             iX <= (nXOff + nXSize - 1) / nBlockXSize; ++iX)
+        {
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+            if (poBlock)
+                poBlock->DropLock();
+            else
+                anBlocks.emplace_back(iX, iY);
+        }
+    }
+    if (anBlocks.empty())
+        return ReadyFuture(CE_None);
+
+    if (poDS && poDS->GetAccess() == GA_ReadOnly && nBand >= 1 &&
+        nBand <= poDS->GetRasterCount() && poDS->GetRasterBand(nBand) == this &&
+        poDS->CanBeCloned(GDAL_OF_RASTER, /* bCanShareState = */ false))
+    {
+        auto oFuture = poDS->GetBlockPrefetcher(true)->Submit(this, anBlocks);
+        if (oFuture.valid())
+        {
+            m_bBlocksPrefetched = true;
+            return oFuture;
+        }
+    }
+
+    // Fallback to reading the blocks synchronously into the block cache.
+    CPLErr eErr = CE_None;
+    for (const auto &[iX, iY] : anBlocks)
+    {
+        GDALRasterBlock *poBlock = GetLockedBlockRef(iX, iY);
+        if (!poBlock)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+        poBlock->DropLock();
+    }
+    return ReadyFuture(eErr);
+}
+
+/************************************************************************/
+/*                      GDALRasterPrefetchBlocks()                      */
+/************************************************************************/
+
+/**
+ * \brief Start reading asynchronously the blocks intersecting a window.
+ *
+ * Contrary to GDALRasterBand::PrefetchBlocks(), this function does not
+ * allow waiting for the blocks to be read.
+ *
+ * @see GDALRasterBand::PrefetchBlocks()
+ * @return CE_Failure if the window is invalid, CE_None otherwise.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALRasterPrefetchBlocks(GDALRasterBandH hBand, int nXOff, int nYOff,
+                                int nXSize, int nYSize)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterPrefetchBlocks", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    auto oFuture = poBand->PrefetchBlocks(nXOff, nYOff, nXSize, nYSize);
+    // Only wait if the future is already ready, that is if the window was
+    // invalid or blocks have been read synchronously.
+    if (oFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        return oFuture.get();
+    return CE_None;
+}
+
+/************************************************************************/
+/*                           GetStatistics()                            */
+/************************************************************************/
+
+/**
+ * \brief Fetch image statistics.
+ *
+ * Returns the minimum, maximum, mean and standard deviation of all
+ * pixel values in this band.  If approximate statistics are sufficient,
+ * the bApproxOK flag can be set to true in which case overviews, or a
+ * subset of image tiles may be used in computing the statistics.
+ *
+ * If bForce is FALSE results will only be returned if it can be done
+ * quickly (i.e. without scanning the image, typically by using pre-existing
+ * STATISTICS_xxx metadata items). If bForce is FALSE and results cannot be
+ * returned efficiently, the method will return CE_Warning but no warning will
+ * be issued. This is a non-standard use of the CE_Warning return value
+ * to indicate "nothing done".
+ *
+ * If bForce is TRUE, and results are quickly available without scanning the
+ * image, they will be used. If bForce is TRUE and results are not quickly
+ * available, GetStatistics() forwards the computation to ComputeStatistics(),
+ * which will scan the image.
+ *
+ * To always force recomputation of statistics, use ComputeStatistics() instead
+ * of this method.
+ *
+ * Note that file formats using PAM (Persistent Auxiliary Metadata) services
+ * will generally cache statistics in the .pam file allowing fast fetch
+ * after the first request.
+ *
+ * This method is the same as the C function GDALGetRasterStatistics().
+ *
+ * @param bApproxOK If TRUE statistics may be computed based on overviews
+ * or a subset of all tiles.
+ *
+ * @param bForce If FALSE statistics will only be returned if it can
+ * be done without rescanning the image. If TRUE, statistics computation will
+ * be forced if pre-existing values are not quickly available.
+ *
+ * @param pdfMin Location into which to load image minimum (may be NULL).
+ *
+ * @param pdfMax Location into which to load image maximum (may be NULL).-
+ *
+ * @param pdfMean Location into which to load image mean (may be NULL).
+ *
+ * @param pdfStdDev Location into which to load image standard deviation
+ * (may be NULL).
+ *
+ * @return CE_None on success, CE_Warning if no values returned,
+ * CE_Failure if an error occurs.
+ */
+
+CPLErr GDALRasterBand::GetStatistics(int bApproxOK, int bForce, double *pdfMin,
+                                     double *pdfMax, double *pdfMean,
+                                     double *pdfStdDev)
+
+{
+    /* -------------------------------------------------------------------- */
+    /*      Do we already have metadata items for the requested values?     */
+    /* -------------------------------------------------------------------- */
+    if ((pdfMin == nullptr ||
+         GetMetadataItem("STATISTICS_MINIMUM") != nullptr) &&
+        (pdfMax == nullptr ||
+         GetMetadataItem("STATISTICS_MAXIMUM") != nullptr) &&
+        (pdfMean == nullptr || GetMetadataItem("STATISTICS_MEAN") != nullptr) &&
+        (pdfStdDev == nullptr ||
+         GetMetadataItem("STATISTICS_STDDEV") != nullptr))
+    {
+        if (!(GetMetadataItem("STATISTICS_APPROXIMATE") && !bApproxOK))
+        {
+            if (pdfMin != nullptr)
+                *pdfMin = CPLAtofM(GetMetadataItem("STATISTICS_MINIMUM"));
+            if (pdfMax != nullptr)
+                *pdfMax = CPLAtofM(GetMetadataItem("STATISTICS_MAXIMUM"));
+            if (pdfMean != nullptr)
+                *pdfMean = CPLAtofM(GetMetadataItem("STATISTICS_MEAN"));
+            if (pdfStdDev != nullptr)
+                *pdfStdDev = CPLAtofM(GetMetadataItem("STATISTICS_STDDEV"));
+
+            return CE_None;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Does the driver already know the min/max?                       */
     /* -------------------------------------------------------------------- */
     if (bApproxOK && pdfMean == nullptr && pdfStdDev == nullptr)
     {
@@ -6436,6 +7087,112 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
 
 //! @endcond
 
+/************************************************************************/
+/*                        GDALChunkStatistics                           */
+/************************************************************************/
+
+namespace
+{
+
+// Statistics of a chunk of a band, or of a whole band once merged
+struct GDALChunkStatistics
+{
+    // Used for Byte and UInt16 bands without mask band
+    GUInt32 nMin = std::numeric_limits<GUInt32>::max();
+    GUInt32 nMax = 0;
+    GUIntBig nSum = 0;
+    GUIntBig nSumSquare = 0;
+
+    // Used otherwise. See ComputeStatistics() for the Welford algorithm
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+    int nChecksum = 0;
+
+    void Merge(const GDALChunkStatistics &other)
+    {
+        nMin = std::min(nMin, other.nMin);
+        nMax = std::max(nMax, other.nMax);
+        nSum += other.nSum;
+        nSumSquare += other.nSumSquare;
+
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        if (nValidCount == 0)
+        {
+            dfMean = other.dfMean;
+            dfM2 = other.dfM2;
+        }
+        else if (other.nValidCount > 0)
+        {
+            // Chan et al. formula to combine the M2 of two sets
+            const double dfCount =
+                static_cast<double>(nValidCount + other.nValidCount);
+            const double dfDelta = other.dfMean - dfMean;
+            dfMean += dfDelta * static_cast<double>(other.nValidCount) /
+                      dfCount;
+            dfM2 += other.dfM2 + dfDelta * dfDelta *
+                                     static_cast<double>(nValidCount) *
+                                     static_cast<double>(other.nValidCount) /
+                                     dfCount;
+        }
+
+        nSampleCount += other.nSampleCount;
+        nValidCount += other.nValidCount;
+        nChecksum = (nChecksum + other.nChecksum) & 0xffff;
+    }
+};
+
+// Accumulates in sStats the statistics of the valid pixels of a buffer
+static void ComputeStatisticsGeneric(const void *pData, const GByte *pabyMask,
+                                     GDALDataType eDataType, bool bSignedByte,
+                                     const GDALNoDataValues &sNoDataValues,
+                                     int nXCheck, int nYCheck, int nLineStride,
+                                     GDALChunkStatistics &sStats)
+{
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nLineStride;
+            if (pabyMask && pabyMask[iOffset] == 0)
+                continue;
+
+            bool bValid = true;
+            const double dfValue = GetPixelValue(
+                eDataType, bSignedByte, pData, iOffset, sNoDataValues, bValid);
+            if (!bValid)
+                continue;
+
+            sStats.dfMin = std::min(sStats.dfMin, dfValue);
+            sStats.dfMax = std::max(sStats.dfMax, dfValue);
+
+            sStats.nValidCount++;
+            if (sStats.dfMin == sStats.dfMax)
+            {
+                if (sStats.nValidCount == 1)
+                    sStats.dfMean = sStats.dfMin;
+            }
+            else
+            {
+                const double dfDelta = dfValue - sStats.dfMean;
+                sStats.dfMean += dfDelta / sStats.nValidCount;
+                sStats.dfM2 += dfDelta * (dfValue - sStats.dfMean);
+            }
+        }
+    }
+
+    sStats.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -6453,6 +7210,11 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.12, the statistics of the blocks are computed by
+ * GDAL_NUM_THREADS worker threads (defaults to 1), the blocks themselves
+ * being read from the calling thread. The result does not depend on the
+ * number of threads.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -6711,10 +7473,6 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                       static_cast<GUInt64>(nBlockYSize))))
         {
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (sNoDataValues.bGotNoDataValue &&
@@ -6726,57 +7484,65 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            // Sums of integers do not depend on the order in which blocks
+            // are processed, so each thread can use its own accumulators.
+            GDALChunkStatistics sInit;
+            sInit.nMin = nMaxValueType;
+            GDALPerThreadAccumulators<GDALChunkStatistics> oAccumulators(
+                sInit);
+            const int nLineStride = nBlockXSize;
+            const auto makeJob = [this, &oAccumulators, nNoDataValue,
+                                  nMaxValueType,
+                                  nLineStride](const void *pData, int nXCheck,
+                                               int nYCheck, const GByte *)
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
+                return std::function<void()>(
+                    [this, &oAccumulators, nNoDataValue, nMaxValueType,
+                     nLineStride, pData, nXCheck, nYCheck]()
+                    {
+                        auto &sStats = oAccumulators.Get();
+                        if (eDataType == GDT_Byte)
+                        {
+                            ComputeStatisticsInternal<
+                                GByte, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(nXCheck, nLineStride, nYCheck,
+                                  static_cast<const GByte *>(pData),
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  sStats.nMin, sStats.nMax, sStats.nSum,
+                                  sStats.nSumSquare, sStats.nSampleCount,
+                                  sStats.nValidCount);
+                        }
+                        else
+                        {
+                            ComputeStatisticsInternal<
+                                GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(nXCheck, nLineStride, nYCheck,
+                                  static_cast<const GUInt16 *>(pData),
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  sStats.nMin, sStats.nMax, sStats.nSum,
+                                  sStats.nSumSquare, sStats.nSampleCount,
+                                  sStats.nValidCount);
+                        }
+                    });
+            };
+            if (!GDALProcessSampledBlocks(
+                    this, nullptr,
+                    static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+                    nSampleRate, nBlocksPerRow, pfnProgress, pProgressData,
+                    "Compute Statistics", makeJob))
+            {
+                return CE_Failure;
+            }
 
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                if (eDataType == GDT_Byte)
-                {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
-                else
-                {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
-
-                poBlock->DropLock();
-
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
-                {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
-                }
-            }
+            GDALChunkStatistics sStats = sInit;
+            for (const auto &oIter : oAccumulators.GetAll())
+                sStats.Merge(oIter.second);
+            const GUInt32 nMin = sStats.nMin;
+            const GUInt32 nMax = sStats.nMax;
+            const GUIntBig nSum = sStats.nSum;
+            const GUIntBig nSumSquare = sStats.nSumSquare;
+            nSampleCount = sStats.nSampleCount;
+            nValidCount = sStats.nValidCount;
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
             {
@@ -6837,187 +7603,1082 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             if (nValidCount > 0)
                 return CE_None;
 
-            ReportError(CE_Failure, CPLE_AppDefined,
-                        "Failed to compute statistics, no valid pixels found "
-                        "in sampling.");
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "Failed to compute statistics, no valid pixels found "
+                        "in sampling.");
+            return CE_Failure;
+        }
+
+        // The Welford partial results of each block are merged in the order
+        // of the blocks, so that the result does not depend on the number of
+        // threads.
+        struct PendingBlockStatistics
+        {
+            GDALChunkStatistics sStats{};
+            std::atomic<bool> bDone{false};
+        };
+
+        std::deque<std::shared_ptr<PendingBlockStatistics>> aoPending;
+        GDALChunkStatistics sStats;
+        const int nLineStride = nBlockXSize;
+        const auto makeJob = [this, bSignedByte, &sNoDataValues, &aoPending,
+                              &sStats,
+                              nLineStride](const void *pData, int nXCheck,
+                                           int nYCheck, const GByte *pabyMask)
+        {
+            while (!aoPending.empty() && aoPending.front()->bDone)
+            {
+                sStats.Merge(aoPending.front()->sStats);
+                aoPending.pop_front();
+            }
+            auto psPending = std::make_shared<PendingBlockStatistics>();
+            aoPending.push_back(psPending);
+            return std::function<void()>(
+                [this, bSignedByte, &sNoDataValues, nLineStride, psPending,
+                 pData, nXCheck, nYCheck, pabyMask]()
+                {
+                    ComputeStatisticsGeneric(pData, pabyMask, eDataType,
+                                             bSignedByte, sNoDataValues,
+                                             nXCheck, nYCheck, nLineStride,
+                                             psPending->sStats);
+                    psPending->bDone = true;
+                });
+        };
+        if (!GDALProcessSampledBlocks(
+                this, poMaskBand,
+                static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+                nSampleRate, nBlocksPerRow, pfnProgress, pProgressData,
+                "Compute Statistics", makeJob))
+        {
+            return CE_Failure;
+        }
+        for (const auto &psPending : aoPending)
+            sStats.Merge(psPending->sStats);
+
+        dfMin = sStats.dfMin;
+        dfMax = sStats.dfMax;
+        dfMean = sStats.dfMean;
+        dfM2 = sStats.dfM2;
+        nSampleCount = sStats.nSampleCount;
+        nValidCount = sStats.nValidCount;
+    }
+
+    if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
+    {
+        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Save computed information.                                      */
+    /* -------------------------------------------------------------------- */
+    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
+
+    if (nValidCount > 0)
+    {
+        if (bApproxOK)
+        {
+            SetMetadataItem("STATISTICS_APPROXIMATE", "YES");
+        }
+        else if (GetMetadataItem("STATISTICS_APPROXIMATE"))
+        {
+            SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
+        }
+        SetStatistics(dfMin, dfMax, dfMean, dfStdDev);
+    }
+    else
+    {
+        dfMin = 0.0;
+        dfMax = 0.0;
+    }
+
+    SetValidPercent(nSampleCount, nValidCount);
+
+    /* -------------------------------------------------------------------- */
+    /*      Record results.                                                 */
+    /* -------------------------------------------------------------------- */
+    if (pdfMin != nullptr)
+        *pdfMin = dfMin;
+    if (pdfMax != nullptr)
+        *pdfMax = dfMax;
+
+    if (pdfMean != nullptr)
+        *pdfMean = dfMean;
+
+    if (pdfStdDev != nullptr)
+        *pdfStdDev = dfStdDev;
+
+    if (nValidCount > 0)
+        return CE_None;
+
+    ReportError(
+        CE_Failure, CPLE_AppDefined,
+        "Failed to compute statistics, no valid pixels found in sampling.");
+    return CE_Failure;
+}
+
+/************************************************************************/
+/*                    GDALComputeRasterStatistics()                     */
+/************************************************************************/
+
+/**
+ * \brief Compute image statistics.
+ *
+ * @see GDALRasterBand::ComputeStatistics()
+ */
+
+CPLErr CPL_STDCALL GDALComputeRasterStatistics(GDALRasterBandH hBand,
+                                               int bApproxOK, double *pdfMin,
+                                               double *pdfMax, double *pdfMean,
+                                               double *pdfStdDev,
+                                               GDALProgressFunc pfnProgress,
+                                               void *pProgressData)
+
+{
+    VALIDATE_POINTER1(hBand, "GDALComputeRasterStatistics", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+
+    return poBand->ComputeStatistics(bApproxOK, pdfMin, pdfMax, pdfMean,
+                                     pdfStdDev, pfnProgress, pProgressData);
+}
+
+/************************************************************************/
+/*                       GDALBandStatisticsState                        */
+/************************************************************************/
+
+namespace
+{
+
+// State of a band processed by GDALDataset::ComputeStatistics()
+struct GDALBandStatisticsState
+{
+    GDALRasterBand *poBand = nullptr;
+    GDALDataType eDataType = GDT_Unknown;
+    GDALNoDataValues sNoDataValues;
+    GDALRasterBand *poMaskBand = nullptr;
+    bool bSignedByte = false;
+    bool bIntegerStats = false;
+    GUInt32 nNoDataValue = 0;
+
+    // Only for unsigned Byte bands, as the bounds of their default histogram
+    // are known in advance
+    std::mutex oHistogramMutex{};
+    std::vector<GUIntBig> anHistogram{};
+
+    std::vector<GDALChunkStatistics> aoChunks{};
+
+    GDALBandStatisticsState(GDALRasterBand *poBandIn, bool bHistogram,
+                            GUIntBig nPixels)
+        : poBand(poBandIn), eDataType(poBandIn->GetRasterDataType()),
+          sNoDataValues(poBandIn, poBandIn->GetRasterDataType())
+    {
+        if (!sNoDataValues.bGotNoDataValue)
+        {
+            const int nMaskFlags = poBand->GetMaskFlags();
+            if (nMaskFlags != GMF_ALL_VALID && nMaskFlags != GMF_NODATA &&
+                poBand->GetColorInterpretation() != GCI_AlphaBand)
+            {
+                poMaskBand = poBand->GetMaskBand();
+            }
+        }
+
+        if (eDataType == GDT_Byte)
+        {
+            poBand->EnablePixelTypeSignedByteWarning(false);
+            const char *pszPixelType =
+                poBand->GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE");
+            poBand->EnablePixelTypeSignedByteWarning(true);
+            bSignedByte =
+                pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
+        }
+
+        // Same conditions as in ComputeStatistics() to make sure that
+        // nSumSquare can fit on a uint64
+        const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
+        bIntegerStats =
+            !poMaskBand &&
+            ((eDataType == GDT_Byte && !bSignedByte &&
+              nPixels < GUINTBIG_MAX / (255U * 255U)) ||
+             (eDataType == GDT_UInt16 &&
+              nPixels < GUINTBIG_MAX / (65535U * 65535U)));
+        // If no valid nodata, map to invalid value (256 for Byte)
+        nNoDataValue =
+            (sNoDataValues.bGotNoDataValue &&
+             sNoDataValues.dfNoDataValue >= 0 &&
+             sNoDataValues.dfNoDataValue <= nMaxValueType &&
+             fabs(sNoDataValues.dfNoDataValue -
+                  static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)) <
+                 1e-10)
+                ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
+                : nMaxValueType + 1;
+
+        if (bHistogram && eDataType == GDT_Byte && !bSignedByte)
+            anHistogram.resize(256);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALBandStatisticsState)
+
+    void ProcessChunk(const void *pData, const GByte *pabyMask, int nXOff,
+                      int nYOff, int nXSize, int nYSize, bool bChecksum,
+                      GDALChunkStatistics &sStats);
+};
+
+/************************************************************************/
+/*                           ProcessChunk()                             */
+/************************************************************************/
+
+void GDALBandStatisticsState::ProcessChunk(const void *pData,
+                                           const GByte *pabyMask, int nXOff,
+                                           int nYOff, int nXSize, int nYSize,
+                                           bool bChecksum,
+                                           GDALChunkStatistics &sStats)
+{
+    const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nXSize) * nYSize;
+    if (bIntegerStats && eDataType == GDT_Byte)
+    {
+        ComputeStatisticsInternal<GByte, /* COMPUTE_OTHER_STATS = */ true>::f(
+            nXSize, nXSize, nYSize, static_cast<const GByte *>(pData),
+            nNoDataValue <= 255, nNoDataValue, sStats.nMin, sStats.nMax,
+            sStats.nSum, sStats.nSumSquare, sStats.nSampleCount,
+            sStats.nValidCount);
+    }
+    else if (bIntegerStats)
+    {
+        ComputeStatisticsInternal<GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+            f(nXSize, nXSize, nYSize, static_cast<const GUInt16 *>(pData),
+              nNoDataValue <= 65535, nNoDataValue, sStats.nMin, sStats.nMax,
+              sStats.nSum, sStats.nSumSquare, sStats.nSampleCount,
+              sStats.nValidCount);
+    }
+    else
+    {
+        ComputeStatisticsGeneric(pData, pabyMask, eDataType, bSignedByte,
+                                 sNoDataValues, nXSize, nYSize, nXSize,
+                                 sStats);
+    }
+
+    if (!anHistogram.empty())
+    {
+        GUIntBig anChunkHistogram[256] = {0};
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+        for (GPtrDiff_t iOffset = 0; iOffset < nPixels; ++iOffset)
+        {
+            if (pabyMask && pabyMask[iOffset] == 0)
+                continue;
+            anChunkHistogram[pabyData[iOffset]]++;
+        }
+        if (nNoDataValue <= 255)
+            anChunkHistogram[nNoDataValue] = 0;
+
+        std::lock_guard<std::mutex> oLock(oHistogramMutex);
+        for (int i = 0; i < 256; ++i)
+            anHistogram[i] += anChunkHistogram[i];
+    }
+
+    if (bChecksum)
+    {
+        sStats.nChecksum = GDALChecksumChunk(
+            pData, eDataType, nXOff, nYOff, nXSize, nYSize,
+            static_cast<GSpacing>(nXSize) *
+                GDALGetDataTypeSizeBytes(eDataType),
+            poBand->GetXSize());
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALDataset::ComputeStatistics()                 */
+/************************************************************************/
+
+/**
+ * \brief Compute exact statistics of several bands and of their overviews.
+ *
+ * This computes, in a single read of the raster data, the same statistics as
+ * GDALRasterBand::ComputeStatistics() with bApproxOK = FALSE for the
+ * specified bands and, by default, for all their overview levels. The data
+ * is read in the calling thread, by chunks of whole blocks, so that drivers
+ * can decode the blocks of a chunk in parallel, and the statistics of the
+ * chunks are computed by worker threads.
+ *
+ * Statistics are stored on the bands with SetStatistics(), as well as the
+ * STATISTICS_VALID_PERCENT metadata item.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>OVERVIEWS=YES/NO: whether to process overview bands. Defaults to YES.
+ * Overview levels are processed only if all the bands have them.</li>
+ * <li>HISTOGRAM=YES/NO: whether to compute the default histogram of the
+ * bands and store it with SetDefaultHistogram(). For unsigned Byte bands, it
+ * is computed during the same read as the statistics. For other data types,
+ * the bounds of the default histogram depend on the statistics, so this
+ * requires a second read. Defaults to NO.</li>
+ * <li>CHECKSUM=YES/NO: whether to compute the value returned by
+ * GDALChecksumImage() for the whole band, which is stored in the
+ * STATISTICS_CHECKSUM metadata item. Defaults to NO.</li>
+ * <li>NUM_THREADS=number or ALL_CPUS: number of worker threads. Defaults to
+ * the value of the GDAL_NUM_THREADS configuration option, or ALL_CPUS.</li>
+ * </ul>
+ *
+ * This method is the same as the C function GDALDatasetComputeStatistics().
+ *
+ * @param nBandCount number of bands in panBandList, or 0 for all bands.
+ * @param panBandList list of 1-based band numbers, or nullptr for all bands.
+ * @param papszOptions NULL terminated list of options, or nullptr.
+ * @param pfnProgress a function to call to report progress, or nullptr.
+ * @param pProgressData application data to pass to the progress function.
+ *
+ * @return CE_None on success, or CE_Failure if an error occurs.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDataset::ComputeStatistics(int nBandCount, const int *panBandList,
+                                      CSLConstList papszOptions,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressData)
+{
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    std::vector<GDALRasterBand *> apoBands;
+    if (nBandCount == 0 || panBandList == nullptr)
+    {
+        for (int i = 0; i < nBands; ++i)
+            apoBands.push_back(papoBands[i]);
+    }
+    else
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (panBandList[i] < 1 || panBandList[i] > nBands)
+            {
+                ReportError(CE_Failure, CPLE_IllegalArg,
+                            "Invalid band number: %d", panBandList[i]);
+                return CE_Failure;
+            }
+            apoBands.push_back(papoBands[panBandList[i] - 1]);
+        }
+    }
+    if (apoBands.empty())
+        return CE_None;
+
+    const bool bOverviews =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "OVERVIEWS", "YES"));
+    const bool bHistogram =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "HISTOGRAM", "NO"));
+    const bool bChecksum =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "CHECKSUM", "NO"));
+    const char *pszThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"));
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    nThreads = std::clamp(nThreads, 1, 1024);
+
+    // Collect the bands of each level, which must have the same dimensions
+    std::vector<std::vector<GDALRasterBand *>> aapoLevels{apoBands};
+    if (bOverviews)
+    {
+        int nOvrCount = apoBands[0]->GetOverviewCount();
+        for (auto *poBand : apoBands)
+            nOvrCount = std::min(nOvrCount, poBand->GetOverviewCount());
+        for (int iOvr = 0; iOvr < nOvrCount; ++iOvr)
+        {
+            std::vector<GDALRasterBand *> apoOvrBands;
+            for (auto *poBand : apoBands)
+            {
+                auto poOvrBand = poBand->GetOverview(iOvr);
+                if (!poOvrBand ||
+                    poOvrBand->GetXSize() !=
+                        apoBands[0]->GetOverview(iOvr)->GetXSize() ||
+                    poOvrBand->GetYSize() !=
+                        apoBands[0]->GetOverview(iOvr)->GetYSize())
+                    break;
+                apoOvrBands.push_back(poOvrBand);
+            }
+            if (apoOvrBands.size() != apoBands.size())
+                break;
+            aapoLevels.push_back(std::move(apoOvrBands));
+        }
+    }
+    for (auto *poBand : apoBands)
+    {
+        if (poBand->GetXSize() != apoBands[0]->GetXSize() ||
+            poBand->GetYSize() != apoBands[0]->GetYSize())
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "All bands should have the same dimensions");
+            return CE_Failure;
+        }
+    }
+
+    double dfTotalPixels = 0;
+    for (const auto &apoLevelBands : aapoLevels)
+        dfTotalPixels += static_cast<double>(apoLevelBands[0]->GetXSize()) *
+                         apoLevelBands[0]->GetYSize();
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    if (!pfnProgress(0.0, "Compute Statistics", pProgressData))
+    {
+        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    double dfPixelsDone = 0;
+    for (const auto &apoLevelBands : aapoLevels)
+    {
+        const int nXSize = apoLevelBands[0]->GetXSize();
+        const int nYSize = apoLevelBands[0]->GetYSize();
+        const GUIntBig nPixels = static_cast<GUIntBig>(nXSize) * nYSize;
+
+        std::vector<std::unique_ptr<GDALBandStatisticsState>> apoStates;
+        int nMaxDTSize = 1;
+        for (auto *poBand : apoLevelBands)
+        {
+            apoStates.push_back(std::make_unique<GDALBandStatisticsState>(
+                poBand, bHistogram, nPixels));
+            nMaxDTSize = std::max(
+                nMaxDTSize,
+                GDALGetDataTypeSizeBytes(poBand->GetRasterDataType()));
+        }
+
+        // Chunks are made of whole blocks of the first band, spanning the
+        // whole width of the raster if they fit in memory
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        apoLevelBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        nBlockXSize = std::clamp(nBlockXSize, 1, nXSize);
+        nBlockYSize = std::clamp(nBlockYSize, 1, nYSize);
+        const GIntBig nMaxChunkSize =
+            std::max(static_cast<GIntBig>(10 * 1000 * 1000),
+                     GDALGetCacheMax64() / 10) /
+            (nMaxDTSize + 1);
+        const int nChunkYSize = nBlockYSize;
+        const int nChunkXSize = static_cast<int>(std::min(
+            static_cast<GIntBig>(nXSize),
+            nBlockXSize * std::max(static_cast<GIntBig>(1),
+                                   nMaxChunkSize /
+                                       (static_cast<GIntBig>(nBlockXSize) *
+                                        nChunkYSize))));
+        const int nXChunks = DIV_ROUND_UP(nXSize, nChunkXSize);
+        const int nYChunks = DIV_ROUND_UP(nYSize, nChunkYSize);
+        const size_t nChunks = static_cast<size_t>(nXChunks) * nYChunks;
+
+        try
+        {
+            for (auto &poState : apoStates)
+                poState->aoChunks.resize(nChunks);
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in ComputeStatistics()");
+            return CE_Failure;
+        }
+
+        std::atomic<bool> bError{false};
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const int nChunkXOff =
+                static_cast<int>(iChunk % nXChunks) * nChunkXSize;
+            const int nChunkYOff =
+                static_cast<int>(iChunk / nXChunks) * nChunkYSize;
+            const int nChunkActualXSize =
+                std::min(nChunkXSize, nXSize - nChunkXOff);
+            const int nChunkActualYSize =
+                std::min(nChunkYSize, nYSize - nChunkYOff);
+            const size_t nChunkPixels =
+                static_cast<size_t>(nChunkActualXSize) * nChunkActualYSize;
+
+            for (auto &poState : apoStates)
+            {
+                // Limit the number of chunks waiting to be processed
+                if (poQueue)
+                    poQueue->WaitCompletion(2 * nThreads);
+                if (bError)
+                    break;
+
+                const GDALDataType eDT = poState->eDataType;
+                // The data buffer must be aligned for the SIMD code paths of
+                // ComputeStatisticsInternal()
+                std::shared_ptr<GByte> pabyData(
+                    static_cast<GByte *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+                        nChunkPixels * GDALGetDataTypeSizeBytes(eDT))),
+                    VSIFreeAligned);
+                if (!pabyData)
+                {
+                    bError = true;
+                    break;
+                }
+                std::shared_ptr<std::vector<GByte>> pabyMask;
+                try
+                {
+                    if (poState->poMaskBand)
+                        pabyMask =
+                            std::make_shared<std::vector<GByte>>(nChunkPixels);
+                }
+                catch (const std::exception &)
+                {
+                    ReportError(CE_Failure, CPLE_OutOfMemory,
+                                "Out of memory in ComputeStatistics()");
+                    bError = true;
+                    break;
+                }
+
+                if (poState->poBand->RasterIO(
+                        GF_Read, nChunkXOff, nChunkYOff, nChunkActualXSize,
+                        nChunkActualYSize, pabyData.get(), nChunkActualXSize,
+                        nChunkActualYSize, eDT, 0, 0, nullptr) != CE_None ||
+                    (pabyMask && poState->poMaskBand->RasterIO(
+                                     GF_Read, nChunkXOff, nChunkYOff,
+                                     nChunkActualXSize, nChunkActualYSize,
+                                     pabyMask->data(), nChunkActualXSize,
+                                     nChunkActualYSize, GDT_Byte, 0, 0,
+                                     nullptr) != CE_None))
+                {
+                    bError = true;
+                    break;
+                }
+
+                auto poStatePtr = poState.get();
+                const auto job = [poStatePtr, pabyData, pabyMask, nChunkXOff,
+                                  nChunkYOff, nChunkActualXSize,
+                                  nChunkActualYSize, bChecksum, iChunk,
+                                  &bError]()
+                {
+                    auto &sStats = poStatePtr->aoChunks[iChunk];
+                    poStatePtr->ProcessChunk(
+                        pabyData.get(), pabyMask ? pabyMask->data() : nullptr,
+                        nChunkXOff, nChunkYOff, nChunkActualXSize,
+                        nChunkActualYSize, bChecksum, sStats);
+                    if (sStats.nChecksum < 0)
+                        bError = true;
+                };
+                if (!poQueue || !poQueue->SubmitJob(job))
+                    job();
+            }
+            if (bError)
+                break;
+
+            const double dfChunkPixelsDone =
+                static_cast<double>(nChunkYOff) * nXSize +
+                static_cast<double>(nChunkXOff + nChunkActualXSize) *
+                    nChunkActualYSize;
+            if (!pfnProgress((dfPixelsDone + dfChunkPixelsDone) /
+                                 dfTotalPixels,
+                             "Compute Statistics", pProgressData))
+            {
+                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                bError = true;
+                break;
+            }
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+        if (bError)
+            return CE_Failure;
+        dfPixelsDone += static_cast<double>(nPixels);
+
+        /* ---------------------------------------------------------------- */
+        /*      Save computed information.                                  */
+        /* ---------------------------------------------------------------- */
+        for (auto &poState : apoStates)
+        {
+            GDALRasterBand *poBand = poState->poBand;
+            GDALChunkStatistics sStats;
+            for (const auto &sChunkStats : poState->aoChunks)
+                sStats.Merge(sChunkStats);
+
+            double dfMin = 0;
+            double dfMax = 0;
+            double dfMean = 0;
+            double dfStdDev = 0;
+            if (sStats.nValidCount > 0 && poState->bIntegerStats)
+            {
+                dfMin = sStats.nMin;
+                dfMax = sStats.nMax;
+                dfMean = static_cast<double>(sStats.nSum) / sStats.nValidCount;
+                // See ComputeStatistics() for the use of 128 bit integers
+                const GDALUInt128 nTmpForStdDev(
+                    GDALUInt128::Mul(sStats.nSumSquare, sStats.nValidCount) -
+                    GDALUInt128::Mul(sStats.nSum, sStats.nSum));
+                dfStdDev = sqrt(static_cast<double>(nTmpForStdDev)) /
+                           sStats.nValidCount;
+            }
+            else if (sStats.nValidCount > 0)
+            {
+                dfMin = sStats.dfMin;
+                dfMax = sStats.dfMax;
+                dfMean = sStats.dfMean;
+                dfStdDev = sqrt(sStats.dfM2 / sStats.nValidCount);
+            }
+
+            if (sStats.nValidCount > 0)
+            {
+                if (poBand->GetMetadataItem("STATISTICS_APPROXIMATE"))
+                    poBand->SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
+                poBand->SetStatistics(dfMin, dfMax, dfMean, dfStdDev);
+            }
+            else
+            {
+                ReportError(CE_Warning, CPLE_AppDefined,
+                            "No valid pixels found in band %d (%dx%d)",
+                            poBand->GetBand(), poBand->GetXSize(),
+                            poBand->GetYSize());
+            }
+            poBand->SetValidPercent(sStats.nSampleCount, sStats.nValidCount);
+
+            if (bChecksum)
+            {
+                poBand->SetMetadataItem("STATISTICS_CHECKSUM",
+                                        CPLSPrintf("%d", sStats.nChecksum));
+            }
+
+            if (bHistogram)
+            {
+                // Drivers not supporting default histograms will complain
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                if (!poState->anHistogram.empty())
+                {
+                    poBand->SetDefaultHistogram(
+                        -0.5, 255.5, 256, poState->anHistogram.data());
+                }
+                else if (sStats.nValidCount > 0)
+                {
+                    double dfHistMin = 0;
+                    double dfHistMax = 0;
+                    int nBuckets = 0;
+                    GUIntBig *panHistogram = nullptr;
+                    if (poBand->GetDefaultHistogram(
+                            &dfHistMin, &dfHistMax, &nBuckets, &panHistogram,
+                            TRUE, nullptr, nullptr) == CE_None)
+                    {
+                        poBand->SetDefaultHistogram(dfHistMin, dfHistMax,
+                                                    nBuckets, panHistogram);
+                    }
+                    CPLFree(panHistogram);
+                }
+            }
+        }
+    }
+
+    if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
+    {
+        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                    GDALDatasetComputeStatistics()                    */
+/************************************************************************/
+
+/**
+ * \brief Compute exact statistics of several bands and of their overviews.
+ *
+ * @see GDALDataset::ComputeStatistics()
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDatasetComputeStatistics(GDALDatasetH hDS, int nBandCount,
+                                    const int *panBandList,
+                                    CSLConstList papszOptions,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressData)
+{
+    VALIDATE_POINTER1(hDS, __func__, CE_Failure);
+    return GDALDataset::FromHandle(hDS)->ComputeStatistics(
+        nBandCount, panBandList, papszOptions, pfnProgress, pProgressData);
+}
+
+/************************************************************************/
+/*                    GDALDataset::ComputeHistograms()                  */
+/************************************************************************/
+
+/**
+ * \brief Compute the histograms of several bands in a single pass.
+ *
+ * This computes, for each of the specified bands, the same histogram as
+ * GDALRasterBand::GetHistogram() with bApproxOK = FALSE, but reads the data
+ * of all the bands at once, by chunks of whole blocks of the first band.
+ * This avoids decoding the blocks of pixel-interleaved datasets once per
+ * band. The values of each chunk are added to the histograms by worker
+ * threads.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>NUM_THREADS=number or ALL_CPUS: number of worker threads. Defaults to
+ * the value of the GDAL_NUM_THREADS configuration option, or ALL_CPUS.</li>
+ * </ul>
+ *
+ * This method is the same as the C function GDALDatasetComputeHistograms().
+ *
+ * @param nBandCount number of bands in panBandList, or 0 for all bands.
+ * @param panBandList list of 1-based band numbers, or nullptr for all bands.
+ * @param dfMin the lower bound of the histograms.
+ * @param dfMax the upper bound of the histograms.
+ * @param nBuckets the number of buckets of each histogram.
+ * @param panHistograms array of nBuckets times the number of bands values,
+ * into which the histogram totals of each band are placed, one band after
+ * the other.
+ * @param bIncludeOutOfRange if TRUE values below the histogram range will
+ * mapped into the first bucket, and values above will be mapped into the last
+ * one, otherwise out of range values are discarded.
+ * @param papszOptions NULL terminated list of options, or nullptr.
+ * @param pfnProgress a function to call to report progress, or nullptr.
+ * @param pProgressData application data to pass to the progress function.
+ *
+ * @return CE_None on success, or CE_Failure if an error occurs.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDataset::ComputeHistograms(int nBandCount, const int *panBandList,
+                                      double dfMin, double dfMax, int nBuckets,
+                                      GUIntBig *panHistograms,
+                                      int bIncludeOutOfRange,
+                                      CSLConstList papszOptions,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressData)
+{
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    std::vector<GDALRasterBand *> apoBands;
+    if (nBandCount == 0 || panBandList == nullptr)
+    {
+        for (int i = 0; i < nBands; ++i)
+            apoBands.push_back(papoBands[i]);
+    }
+    else
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (panBandList[i] < 1 || panBandList[i] > nBands)
+            {
+                ReportError(CE_Failure, CPLE_IllegalArg,
+                            "Invalid band number: %d", panBandList[i]);
+                return CE_Failure;
+            }
+            apoBands.push_back(papoBands[panBandList[i] - 1]);
+        }
+    }
+    if (apoBands.empty())
+        return CE_None;
+
+    // Written this way to deal with NaN
+    if (!(dfMax > dfMin) || nBuckets <= 0)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "dfMax should be strictly greater than dfMin, and "
+                    "nBuckets should be strictly positive");
+        return CE_Failure;
+    }
+    const double dfScale = nBuckets / (dfMax - dfMin);
+    if (dfScale == 0 || !std::isfinite(dfScale))
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "dfMin and dfMax should be finite values such that "
+                    "nBuckets / (dfMax - dfMin) is non-zero");
+        return CE_Failure;
+    }
+
+    const int nXSize = apoBands[0]->GetXSize();
+    const int nYSize = apoBands[0]->GetYSize();
+    const GDALDataType eFirstDataType = apoBands[0]->GetRasterDataType();
+    bool bSameDataType = true;
+    for (auto *poBand : apoBands)
+    {
+        if (poBand->GetXSize() != nXSize || poBand->GetYSize() != nYSize)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "All bands should have the same dimensions");
             return CE_Failure;
         }
-
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
+        if (poBand->GetRasterDataType() != eFirstDataType)
+            bSameDataType = false;
+    }
+
+    const char *pszThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"));
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    nThreads = std::clamp(nThreads, 1, 1024);
+
+    const GUIntBig nPixels = static_cast<GUIntBig>(nXSize) * nYSize;
+    const int nBandsToProcess = static_cast<int>(apoBands.size());
+
+    // Per band state
+    std::vector<std::unique_ptr<GDALHistogramAccumulator>> apoAccumulators;
+    std::vector<std::unique_ptr<
+        GDALPerThreadAccumulators<std::vector<GUIntBig>>>>
+        apoHistograms;
+    std::vector<GDALRasterBand *> apoMaskBands;
+    size_t nDataPixelSize = 0;
+    size_t nMaskCount = 0;
+    for (auto *poBand : apoBands)
+    {
+        const GDALDataType eDataType = poBand->GetRasterDataType();
+        GDALNoDataValues sNoDataValues(poBand, eDataType);
+        GDALRasterBand *poMaskBand = nullptr;
+        if (!sNoDataValues.bGotNoDataValue)
+        {
+            const int nMaskFlags = poBand->GetMaskFlags();
+            if (nMaskFlags != GMF_ALL_VALID && nMaskFlags != GMF_NODATA &&
+                poBand->GetColorInterpretation() != GCI_AlphaBand)
             {
-                return CE_Failure;
+                poMaskBand = poBand->GetMaskBand();
             }
         }
-
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        bool bSignedByte = false;
+        if (eDataType == GDT_Byte)
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+            poBand->EnablePixelTypeSignedByteWarning(false);
+            const char *pszPixelType =
+                poBand->GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE");
+            poBand->EnablePixelTypeSignedByteWarning(true);
+            bSignedByte =
+                pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
+        }
+
+        apoAccumulators.push_back(std::make_unique<GDALHistogramAccumulator>(
+            eDataType, bSignedByte, sNoDataValues, dfMin, dfMax, nBuckets,
+            CPL_TO_BOOL(bIncludeOutOfRange), nPixels));
+        apoHistograms.push_back(
+            std::make_unique<GDALPerThreadAccumulators<std::vector<GUIntBig>>>(
+                std::vector<GUIntBig>{}));
+        apoMaskBands.push_back(poMaskBand);
+        nDataPixelSize += GDALGetDataTypeSizeBytes(eDataType);
+        if (poMaskBand)
+            ++nMaskCount;
+    }
+
+    // Chunks are made of whole blocks of the first band, spanning the
+    // whole width of the raster if they fit in memory
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    apoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockXSize = std::clamp(nBlockXSize, 1, nXSize);
+    nBlockYSize = std::clamp(nBlockYSize, 1, nYSize);
+    const GIntBig nMaxChunkSize =
+        std::max(static_cast<GIntBig>(10 * 1000 * 1000),
+                 GDALGetCacheMax64() / 10) /
+        static_cast<GIntBig>(nDataPixelSize + nMaskCount);
+    const int nChunkYSize = nBlockYSize;
+    const int nChunkXSize = static_cast<int>(std::min(
+        static_cast<GIntBig>(nXSize),
+        nBlockXSize * std::max(static_cast<GIntBig>(1),
+                               nMaxChunkSize /
+                                   (static_cast<GIntBig>(nBlockXSize) *
+                                    nChunkYSize))));
+    const int nXChunks = DIV_ROUND_UP(nXSize, nChunkXSize);
+    const int nYChunks = DIV_ROUND_UP(nYSize, nChunkYSize);
+    const size_t nChunks = static_cast<size_t>(nXChunks) * nYChunks;
+
+    std::vector<int> anBandMap;
+    for (auto *poBand : apoBands)
+        anBandMap.push_back(poBand->GetBand());
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    if (!pfnProgress(0.0, "Compute Histograms", pProgressData))
+    {
+        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
 
-            void *const pData = poBlock->GetDataRef();
+    std::atomic<bool> bOutOfMemory{false};
+    bool bError = false;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        // Limit the number of chunks waiting to be processed
+        if (poQueue)
+            poQueue->WaitCompletion(2 * nThreads);
+        if (bOutOfMemory)
+            break;
 
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+        const int nChunkXOff =
+            static_cast<int>(iChunk % nXChunks) * nChunkXSize;
+        const int nChunkYOff =
+            static_cast<int>(iChunk / nXChunks) * nChunkYSize;
+        const int nChunkActualXSize =
+            std::min(nChunkXSize, nXSize - nChunkXOff);
+        const int nChunkActualYSize =
+            std::min(nChunkYSize, nYSize - nChunkYOff);
+        const size_t nChunkPixels =
+            static_cast<size_t>(nChunkActualXSize) * nChunkActualYSize;
+
+        // Band sequential data of the chunk, followed by the masks of the
+        // bands that have one. Offsets are kept aligned for all data types.
+        std::vector<size_t> anDataOffsets;
+        std::vector<size_t> anMaskOffsets;
+        size_t nChunkSize = 0;
+        for (auto *poBand : apoBands)
+        {
+            anDataOffsets.push_back(nChunkSize);
+            nChunkSize += GDALGetDataTypeSizeBytes(
+                              poBand->GetRasterDataType()) *
+                          nChunkPixels;
+            nChunkSize = (nChunkSize + 7) & ~static_cast<size_t>(7);
+        }
+        for (auto *poMaskBand : apoMaskBands)
+        {
+            anMaskOffsets.push_back(nChunkSize);
+            if (poMaskBand)
+                nChunkSize += nChunkPixels;
+        }
+        std::shared_ptr<GByte> pabyChunk(
+            static_cast<GByte *>(VSI_MALLOC_VERBOSE(nChunkSize)), VSIFree);
+        if (!pabyChunk)
+        {
+            bError = true;
+            break;
+        }
 
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+        if (bSameDataType)
+        {
+            // Read all bands at once, so that blocks of pixel-interleaved
+            // datasets are decoded a single time
+            const int nDTSize = GDALGetDataTypeSizeBytes(eFirstDataType);
+            bError =
+                RasterIO(GF_Read, nChunkXOff, nChunkYOff, nChunkActualXSize,
+                         nChunkActualYSize, pabyChunk.get(),
+                         nChunkActualXSize, nChunkActualYSize, eFirstDataType,
+                         nBandsToProcess, anBandMap.data(), nDTSize,
+                         static_cast<GSpacing>(nDTSize) * nChunkActualXSize,
+                         nBandsToProcess > 1
+                             ? static_cast<GSpacing>(anDataOffsets[1])
+                             : 0,
+                         nullptr) != CE_None;
+        }
+        else
+        {
+            for (int iBand = 0; iBand < nBandsToProcess && !bError; ++iBand)
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
+                bError =
+                    apoBands[iBand]->RasterIO(
+                        GF_Read, nChunkXOff, nChunkYOff, nChunkActualXSize,
+                        nChunkActualYSize,
+                        pabyChunk.get() + anDataOffsets[iBand],
+                        nChunkActualXSize, nChunkActualYSize,
+                        apoBands[iBand]->GetRasterDataType(), 0, 0,
+                        nullptr) != CE_None;
             }
+        }
 
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
+        for (int iBand = 0; iBand < nBandsToProcess && !bError; ++iBand)
+        {
+            if (!apoMaskBands[iBand])
+                continue;
+            GByte *pabyMask = pabyChunk.get() + anMaskOffsets[iBand];
+            bError = apoMaskBands[iBand]->RasterIO(
+                         GF_Read, nChunkXOff, nChunkYOff, nChunkActualXSize,
+                         nChunkActualYSize, pabyMask, nChunkActualXSize,
+                         nChunkActualYSize, GDT_Byte, 0, 0,
+                         nullptr) != CE_None;
+        }
+        if (bError)
+            break;
+
+        for (int iBand = 0; iBand < nBandsToProcess; ++iBand)
+        {
+            const GByte *pabyData = pabyChunk.get() + anDataOffsets[iBand];
+            const GByte *pabyMask = apoMaskBands[iBand]
+                                        ? pabyChunk.get() + anMaskOffsets[iBand]
+                                        : nullptr;
+            auto poAccumulator = apoAccumulators[iBand].get();
+            auto poHistograms = apoHistograms[iBand].get();
+            const auto job = [poAccumulator, poHistograms, pabyChunk,
+                              pabyData, pabyMask, nChunkActualXSize,
+                              nChunkActualYSize, nBuckets, &bOutOfMemory]()
             {
-                for (int iX = 0; iX < nXCheck; iX++)
+                auto &anHistogram = poHistograms->Get();
+                try
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    bool bValid = true;
-                    double dfValue =
-                        GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                      sNoDataValues, bValid);
-
-                    if (!bValid)
-                        continue;
-
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    if (dfMin == dfMax)
-                    {
-                        if (nValidCount == 1)
-                            dfMean = dfMin;
-                    }
-                    else
-                    {
-                        const double dfDelta = dfValue - dfMean;
-                        dfMean += dfDelta / nValidCount;
-                        dfM2 += dfDelta * (dfValue - dfMean);
-                    }
+                    anHistogram.resize(nBuckets);
                 }
-            }
-
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
-
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+                catch (const std::exception &)
+                {
+                    bOutOfMemory = true;
+                    return;
+                }
+                poAccumulator->Accumulate(pabyData, pabyMask,
+                                          nChunkActualXSize, nChunkActualYSize,
+                                          nChunkActualXSize,
+                                          anHistogram.data());
+            };
+            if (!poQueue || !poQueue->SubmitJob(job))
+                job();
         }
 
-        CPLFree(pabyMaskData);
+        if (!pfnProgress(static_cast<double>(iChunk + 1) /
+                             static_cast<double>(nChunks),
+                         "Compute Histograms", pProgressData))
+        {
+            ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            bError = true;
+            break;
+        }
     }
-
-    if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
+    if (poQueue)
+        poQueue->WaitCompletion();
+    if (bOutOfMemory)
     {
-        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        ReportError(CE_Failure, CPLE_OutOfMemory,
+                    "Out of memory in ComputeHistograms()");
         return CE_Failure;
     }
+    if (bError)
+        return CE_Failure;
 
-    /* -------------------------------------------------------------------- */
-    /*      Save computed information.                                      */
-    /* -------------------------------------------------------------------- */
-    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
-
-    if (nValidCount > 0)
+    for (int iBand = 0; iBand < nBandsToProcess; ++iBand)
     {
-        if (bApproxOK)
-        {
-            SetMetadataItem("STATISTICS_APPROXIMATE", "YES");
-        }
-        else if (GetMetadataItem("STATISTICS_APPROXIMATE"))
+        GUIntBig *panHistogram =
+            panHistograms + static_cast<size_t>(iBand) * nBuckets;
+        memset(panHistogram, 0, sizeof(GUIntBig) * nBuckets);
+        for (const auto &oIter : apoHistograms[iBand]->GetAll())
         {
-            SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
+            const auto &anHistogram = oIter.second;
+            for (size_t i = 0; i < anHistogram.size(); ++i)
+                panHistogram[i] += anHistogram[i];
         }
-        SetStatistics(dfMin, dfMax, dfMean, dfStdDev);
-    }
-    else
-    {
-        dfMin = 0.0;
-        dfMax = 0.0;
     }
 
-    SetValidPercent(nSampleCount, nValidCount);
-
-    /* -------------------------------------------------------------------- */
-    /*      Record results.                                                 */
-    /* -------------------------------------------------------------------- */
-    if (pdfMin != nullptr)
-        *pdfMin = dfMin;
-    if (pdfMax != nullptr)
-        *pdfMax = dfMax;
-
-    if (pdfMean != nullptr)
-        *pdfMean = dfMean;
-
-    if (pdfStdDev != nullptr)
-        *pdfStdDev = dfStdDev;
-
-    if (nValidCount > 0)
-        return CE_None;
-
-    ReportError(
-        CE_Failure, CPLE_AppDefined,
-        "Failed to compute statistics, no valid pixels found in sampling.");
-    return CE_Failure;
+    return CE_None;
 }
 
 /************************************************************************/
-/*                    GDALComputeRasterStatistics()                     */
+/*                    GDALDatasetComputeHistograms()                    */
 /************************************************************************/
 
 /**
- * \brief Compute image statistics.
+ * rief Compute the histograms of several bands in a single pass.
  *
- * @see GDALRasterBand::ComputeStatistics()
+ * @see GDALDataset::ComputeHistograms()
+ * @since GDAL 3.12
  */
 
-CPLErr CPL_STDCALL GDALComputeRasterStatistics(GDALRasterBandH hBand,
-                                               int bApproxOK, double *pdfMin,
-                                               double *pdfMax, double *pdfMean,
-                                               double *pdfStdDev,
-                                               GDALProgressFunc pfnProgress,
-                                               void *pProgressData)
-
+CPLErr GDALDatasetComputeHistograms(GDALDatasetH hDS, int nBandCount,
+                                    const int *panBandList, double dfMin,
+                                    double dfMax, int nBuckets,
+                                    GUIntBig *panHistograms,
+                                    int bIncludeOutOfRange,
+                                    CSLConstList papszOptions,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressData)
 {
-    VALIDATE_POINTER1(hBand, "GDALComputeRasterStatistics", CE_Failure);
-
-    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
-
-    return poBand->ComputeStatistics(bApproxOK, pdfMin, pdfMax, pdfMean,
-                                     pdfStdDev, pfnProgress, pProgressData);
+    VALIDATE_POINTER1(hDS, __func__, CE_Failure);
+    VALIDATE_POINTER1(panHistograms, __func__, CE_Failure);
+    return GDALDataset::FromHandle(hDS)->ComputeHistograms(
+        nBandCount, panBandList, dfMin, dfMax, nBuckets, panHistograms,
+        bIncludeOutOfRange, papszOptions, pfnProgress, pProgressData);
 }
 
 /************************************************************************/
@@ -7276,57 +8937,39 @@ static bool ComputeMinMaxGenericIterBlocks(
     double &dfMin, double &dfMax)
 
 {
-    GByte *pabyMaskData = nullptr;
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
-    if (poMaskBand)
+    GDALPerThreadAccumulators<std::pair<double, double>> oAccumulators(
+        std::pair(dfMin, dfMax));
+    const auto makeJob = [eDataType, bSignedByte, &sNoDataValues,
+                          &oAccumulators,
+                          nBlockXSize](const void *pData, int nXCheck,
+                                       int nYCheck, const GByte *pabyMaskData)
     {
-        pabyMaskData =
-            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-        if (!pabyMaskData)
-        {
-            return false;
-        }
+        return std::function<void()>(
+            [eDataType, bSignedByte, &sNoDataValues, &oAccumulators,
+             nBlockXSize, pData, nXCheck, nYCheck, pabyMaskData]()
+            {
+                auto &oMinMax = oAccumulators.Get();
+                ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck,
+                                     nYCheck, nBlockXSize, sNoDataValues,
+                                     pabyMaskData, oMinMax.first,
+                                     oMinMax.second);
+            });
+    };
+    if (!GDALProcessSampledBlocks(poBand, poMaskBand, nTotalBlocks,
+                                  nSampleRate, nBlocksPerRow, nullptr, nullptr,
+                                  "", makeJob))
+    {
+        return false;
     }
 
-    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks;
-         iSampleBlock += nSampleRate)
+    for (const auto &oIter : oAccumulators.GetAll())
     {
-        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
-        if (poBlock == nullptr)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        void *const pData = poBlock->GetDataRef();
-
-        int nXCheck = 0, nYCheck = 0;
-        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-        if (poMaskBand &&
-            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                 pabyMaskData, nXCheck, nYCheck, GDT_Byte, 0,
-                                 nBlockXSize, nullptr) != CE_None)
-        {
-            poBlock->DropLock();
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
-                             nBlockXSize, sNoDataValues, pabyMaskData, dfMin,
-                             dfMax);
-
-        poBlock->DropLock();
+        dfMin = std::min(dfMin, oIter.second.first);
+        dfMax = std::max(dfMax, oIter.second.second);
     }
-
-    CPLFree(pabyMaskData);
     return true;
 }
 
@@ -7341,6 +8984,9 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.12, the min/max of the blocks are computed by
+ * GDAL_NUM_THREADS worker threads (defaults to 1).
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -7431,9 +9077,10 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte,
+         &sNoDataValues](const void *pData, int nXCheck, int nBufferWidth,
+                         int nYCheck, GUInt32 &nMin, GUInt32 &nMax,
+                         GInt16 &nMinInt16, GInt16 &nMaxInt16)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -7561,7 +9208,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced,
+                                  nMin, nMax, nMinInt16, nMaxInt16);
         }
         else
         {
@@ -7601,32 +9249,54 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            struct MinMaxAccumulator
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
-
-                poBlock->DropLock();
+                GUInt32 nMin;
+                GUInt32 nMax;
+                GInt16 nMinInt16;
+                GInt16 nMaxInt16;
+            };
+
+            GDALPerThreadAccumulators<MinMaxAccumulator> oAccumulators(
+                MinMaxAccumulator{nMin, nMax, nMinInt16, nMaxInt16});
+            // Set once the whole range of a Byte band has been found
+            std::atomic<bool> bFullRange{false};
+            const int nLineStride = nBlockXSize;
+            const auto makeJob =
+                [this, bSignedByte, &ComputeMinMaxForBlock, &oAccumulators,
+                 &bFullRange, nLineStride](const void *pData, int nXCheck,
+                                           int nYCheck, const GByte *)
+            {
+                if (bFullRange)
+                    return std::function<void()>();
+                return std::function<void()>(
+                    [this, bSignedByte, &ComputeMinMaxForBlock, &oAccumulators,
+                     &bFullRange, nLineStride, pData, nXCheck, nYCheck]()
+                    {
+                        auto &sAcc = oAccumulators.Get();
+                        ComputeMinMaxForBlock(pData, nXCheck, nLineStride,
+                                              nYCheck, sAcc.nMin, sAcc.nMax,
+                                              sAcc.nMinInt16, sAcc.nMaxInt16);
+                        if (eDataType == GDT_Byte && !bSignedByte &&
+                            sAcc.nMin == 0 && sAcc.nMax == 255)
+                            bFullRange = true;
+                    });
+            };
+            if (!GDALProcessSampledBlocks(
+                    this, nullptr,
+                    static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+                    nSampleRate, nBlocksPerRow, nullptr, nullptr, "",
+                    makeJob))
+            {
+                return CE_Failure;
+            }
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
-                    break;
+            for (const auto &oIter : oAccumulators.GetAll())
+            {
+                nMin = std::min(nMin, oIter.second.nMin);
+                nMax = std::max(nMax, oIter.second.nMax);
+                nMinInt16 = std::min(nMinInt16, oIter.second.nMinInt16);
+                nMaxInt16 = std::max(nMaxInt16, oIter.second.nMaxInt16);
             }
         }
         else
@@ -10107,6 +11777,174 @@ CPLErr GDALRasterInterpolateAtPoint(GDALRasterBandH hBand, double dfPixel,
                                       pdfRealValue, pdfImagValue);
 }
 
+/************************************************************************/
+/*                            InterpolateAtPoints()                     */
+/************************************************************************/
+
+/**
+ * \brief Interpolates the value between pixels using a resampling algorithm,
+ * for a set of points given by their pixel/line coordinates.
+ *
+ * This is equivalent to calling InterpolateAtPoint() for each point, but the
+ * points are processed grouped by the area of the raster they fall in, so that
+ * each area is read only once whatever the order of the input points. Results
+ * are returned in the order of the input points.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>NUM_THREADS=number or ALL_CPUS: number of worker threads. Defaults to
+ * the value of the GDAL_NUM_THREADS configuration option, or 1. Several
+ * threads are only used if the dataset of the band can be opened as a
+ * thread-safe dataset (see GDALGetThreadSafeDataset()).</li>
+ * </ul>
+ *
+ * @param nPointCount number of points.
+ * @param padfPixel array of nPointCount pixel coordinates.
+ * @param padfLine array of nPointCount line coordinates.
+ * @param eInterpolation interpolation type. Only near, bilinear, cubic and cubicspline are allowed.
+ * @param padfRealValue array of nPointCount values, set to the real part of
+ * the interpolated values, or NaN for points that cannot be interpolated.
+ * @param padfImagValue array of nPointCount values, set to the imaginary part
+ * of the interpolated values (may be null if not needed).
+ * @param pabSuccess array of nPointCount values, set to TRUE for points that
+ * have been interpolated and FALSE for the other ones (may be null if not
+ * needed).
+ * @param papszOptions NULL terminated list of options, or nullptr.
+ *
+ * @return CE_None if all points have been interpolated, or CE_Failure
+ * otherwise.
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALRasterBand::InterpolateAtPoints(
+    size_t nPointCount, const double *padfPixel, const double *padfLine,
+    GDALRIOResampleAlg eInterpolation, double *padfRealValue,
+    double *padfImagValue, int *pabSuccess, CSLConstList papszOptions) const
+{
+    if (eInterpolation != GRIORA_NearestNeighbour &&
+        eInterpolation != GRIORA_Bilinear && eInterpolation != GRIORA_Cubic &&
+        eInterpolation != GRIORA_CubicSpline)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only nearest, bilinear, cubic and cubicspline interpolation "
+                 "methods "
+                 "allowed");
+
+        return CE_Failure;
+    }
+    if (nPointCount == 0)
+        return CE_None;
+
+    const std::vector<size_t> anOrder =
+        GDALInterpolateAtPointsSortByBlock(nPointCount, padfPixel, padfLine);
+
+    const char *pszThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    // Not worth the cost of opening thread-safe datasets for a few points
+    constexpr size_t MIN_POINTS_PER_THREAD = 1000;
+    nThreads = static_cast<int>(
+        std::min(static_cast<size_t>(std::clamp(nThreads, 1, 1024)),
+                 std::max<size_t>(1, nPointCount / MIN_POINTS_PER_THREAD)));
+
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS;
+    if (nThreads > 1 && poDS && nBand >= 1 &&
+        poDS->GetRasterBand(nBand) == this)
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poTSDS.reset(GDALGetThreadSafeDataset(poDS, GDAL_OF_RASTER));
+    }
+    CPLWorkerThreadPool *poPool =
+        poTSDS ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    size_t nSuccessCount = 0;
+    if (!poQueue)
+    {
+        if (!m_poPointsCache)
+            m_poPointsCache = new GDALDoublePointsCache();
+        nSuccessCount = GDALInterpolateAtPoints(
+            const_cast<GDALRasterBand *>(this), eInterpolation,
+            m_poPointsCache->cache, anOrder.data(), nPointCount, padfPixel,
+            padfLine, padfRealValue, padfImagValue, pabSuccess);
+    }
+    else
+    {
+        // Each thread processes a contiguous range of the sorted points, with
+        // its own cache, so that an area of the raster is generally read by a
+        // single thread.
+        GDALRasterBand *poTSBand = poTSDS->GetRasterBand(nBand);
+        const CPLStringList aosThreadLocalConfigOptions(
+            CPLGetThreadLocalConfigOptions());
+        const size_t nChunkSize = DIV_ROUND_UP(nPointCount, nThreads);
+        std::vector<CPLErrorAccumulator> aoAccumulators(nThreads);
+        std::vector<size_t> anSuccessCount(nThreads);
+        for (int i = 0; i < nThreads; ++i)
+        {
+            const size_t nStart = i * nChunkSize;
+            if (nStart >= nPointCount)
+                break;
+            const size_t nCount = std::min(nChunkSize, nPointCount - nStart);
+            const auto job = [&, i, nStart, nCount]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    aosThreadLocalConfigOptions.List());
+                {
+                    auto oAccumulator =
+                        aoAccumulators[i].InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    std::unique_ptr<DoublePointsCache> cache;
+                    anSuccessCount[i] = GDALInterpolateAtPoints(
+                        poTSBand, eInterpolation, cache,
+                        anOrder.data() + nStart, nCount, padfPixel, padfLine,
+                        padfRealValue, padfImagValue, pabSuccess);
+                }
+                CPLSetThreadLocalConfigOptions(nullptr);
+            };
+            if (!poQueue->SubmitJob(job))
+                job();
+        }
+        poQueue->WaitCompletion();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            aoAccumulators[i].ReplayErrors();
+            nSuccessCount += anSuccessCount[i];
+        }
+    }
+
+    return nSuccessCount == nPointCount ? CE_None : CE_Failure;
+}
+
+/************************************************************************/
+/*                        GDALRasterInterpolateAtPoints()               */
+/************************************************************************/
+
+/**
+ * \brief Interpolates the value between pixels using a resampling algorithm,
+ * for a set of points given by their pixel/line coordinates.
+ *
+ * @see GDALRasterBand::InterpolateAtPoints()
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALRasterInterpolateAtPoints(GDALRasterBandH hBand, size_t nPointCount,
+                                     const double *padfPixel,
+                                     const double *padfLine,
+                                     GDALRIOResampleAlg eInterpolation,
+                                     double *padfRealValue,
+                                     double *padfImagValue, int *pabSuccess,
+                                     CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterInterpolateAtPoints", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->InterpolateAtPoints(nPointCount, padfPixel, padfLine,
+                                       eInterpolation, padfRealValue,
+                                       padfImagValue, pabSuccess, papszOptions);
+}
+
 /************************************************************************/
 /*                    InterpolateAtGeolocation()                        */
 /************************************************************************/
@@ -17,37 +17,394 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstring>
+#include <deque>
+#include <limits>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
+#include "cpl_compressor.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
+#include "gdalrasterblock_priv.h"
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
+// nCacheUsed and nCacheMax members are not used.
+static GDALBlockCacheCounters oGlobalCacheCounters;
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+// Size in bytes of the dirty blocks.
+static std::atomic<GIntBig> nCacheDirty{0};
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
+/************************************************************************/
+/*                      GDALRasterBlockCacheShard                       */
+/************************************************************************/
+
+// The global block cache is made of one or several shards, each with its
+// own LRU list and lock. By default, there is a single shard, which is
+// equivalent to a single global LRU list. When GDAL_RB_SHARD_COUNT is set to
+// a value greater than 1, the blocks of a given dataset are always assigned
+// to the same shard, so that threads working on different datasets do not
+// contend on the same lock.
+//
+// The list of a shard is made of two contiguous segments:
+// - a "protected" segment, from poNewest to the block just before
+//   poProbationNewest, in LRU order;
+// - a "probation" segment, from poProbationNewest to poOldest, in FIFO order.
+// Blocks are evicted from the tail, so probation blocks are evicted first.
+// With the LRU policy, only blocks of bands with the streaming hint go to the
+// probation segment. With the 2Q policy, all new blocks go to the probation
+// segment, unless they have been recently evicted from it (they are then
+// found in the ghost list), and the protected segment is limited to a
+// fraction of the cache.
+namespace
+{
+enum class GDALRasterBlockEvictionPolicy
+{
+    LRU,
+    TWO_Q,
+};
+
+struct GDALRasterBlockKey
+{
+    const GDALRasterBand *poBand;
+    int nXOff;
+    int nYOff;
+
+    bool operator==(const GDALRasterBlockKey &other) const
+    {
+        return poBand == other.poBand && nXOff == other.nXOff &&
+               nYOff == other.nYOff;
+    }
+};
+
+struct GDALRasterBlockKeyHasher
+{
+    size_t operator()(const GDALRasterBlockKey &k) const
+    {
+        return std::hash<const void *>()(k.poBand) ^
+               (std::hash<int>()(k.nXOff) << 1) ^
+               (std::hash<int>()(k.nYOff) << 2);
+    }
+};
+
+// Keys of blocks recently evicted from the probation segment ("A1out" queue
+// of the 2Q algorithm). Only keys are stored, not the block content.
+class GDALRasterBlockGhostList
+{
+    std::unordered_map<GDALRasterBlockKey, uint64_t,
+                       GDALRasterBlockKeyHasher>
+        m_oMap{};
+    std::deque<std::pair<GDALRasterBlockKey, uint64_t>> m_oQueue{};
+    // Number of entries per band, to quickly skip bands without entries.
+    std::unordered_map<const GDALRasterBand *, size_t> m_oMapBandCount{};
+    uint64_t m_nSeq = 0;
+
+    using MapType = decltype(m_oMap);
+
+    void Erase(MapType::iterator oIter)
+    {
+        const auto oIterCount = m_oMapBandCount.find(oIter->first.poBand);
+        if (oIterCount != m_oMapBandCount.end() && --oIterCount->second == 0)
+            m_oMapBandCount.erase(oIterCount);
+        m_oMap.erase(oIter);
+    }
+
+  public:
+    void Add(const GDALRasterBlockKey &oKey, size_t nMaxSize)
+    {
+        ++m_nSeq;
+        const auto oInsert = m_oMap.emplace(oKey, m_nSeq);
+        if (oInsert.second)
+            ++m_oMapBandCount[oKey.poBand];
+        else
+            oInsert.first->second = m_nSeq;
+        m_oQueue.emplace_back(oKey, m_nSeq);
+        // The queue may contain stale entries for keys that have been
+        // removed or re-added since then. Their sequence number does not
+        // match the one of the map.
+        while (m_oMap.size() > nMaxSize || m_oQueue.size() > 2 * nMaxSize)
+        {
+            const auto &oFront = m_oQueue.front();
+            const auto oIter = m_oMap.find(oFront.first);
+            if (oIter != m_oMap.end() && oIter->second == oFront.second)
+                Erase(oIter);
+            m_oQueue.pop_front();
+        }
+    }
+
+    bool Remove(const GDALRasterBlockKey &oKey)
+    {
+        const auto oIter = m_oMap.find(oKey);
+        if (oIter == m_oMap.end())
+            return false;
+        Erase(oIter);
+        return true;
+    }
+
+    // Remove all entries of a band, so that a band later allocated at the
+    // same address does not inherit them.
+    void RemoveBand(const GDALRasterBand *poBand)
+    {
+        if (m_oMapBandCount.find(poBand) == m_oMapBandCount.end())
+            return;
+        for (auto oIter = m_oMap.begin(); oIter != m_oMap.end();)
+        {
+            auto oIterNext = std::next(oIter);
+            if (oIter->first.poBand == poBand)
+                Erase(oIter);
+            oIter = oIterNext;
+        }
+    }
+};
+
+// Second tier of the block cache, enabled with GDAL_RB_COMPRESSED_CACHE_MAX.
+// Clean blocks evicted from the block cache are stored compressed, so that
+// they can be restored with a fast decompression instead of a new call to
+// IReadBlock(). Entries are evicted in the order they have been stored.
+class GDALRasterBlockCompressedCache
+{
+    struct Entry
+    {
+        GDALRasterBlockKey oKey;
+        std::vector<GByte> abyData;
+    };
+
+    std::mutex m_oMutex{};
+    std::list<Entry> m_oList{};  // Most recently stored first.
+    std::unordered_map<GDALRasterBlockKey, std::list<Entry>::iterator,
+                       GDALRasterBlockKeyHasher>
+        m_oMap{};
+    // Number of entries per band, to quickly skip bands without entries.
+    std::unordered_map<const GDALRasterBand *, size_t> m_oMapBandCount{};
+    size_t m_nUsed = 0;
+    size_t m_nMax = 0;
+    std::string m_osCodec{};
+    CPLStringList m_aosOptions{};
+
+    static size_t GetEntrySize(const Entry &oEntry)
+    {
+        return oEntry.abyData.size() + sizeof(Entry) + 4 * sizeof(void *);
+    }
+
+    // Remove an entry and return its compressed data.
+    // Must be called with m_oMutex held.
+    std::vector<GByte> Erase(std::list<Entry>::iterator oIter)
+    {
+        const auto oIterCount = m_oMapBandCount.find(oIter->oKey.poBand);
+        if (oIterCount != m_oMapBandCount.end() && --oIterCount->second == 0)
+            m_oMapBandCount.erase(oIterCount);
+        m_nUsed -= GetEntrySize(*oIter);
+        m_oMap.erase(oIter->oKey);
+        std::vector<GByte> abyData = std::move(oIter->abyData);
+        m_oList.erase(oIter);
+        return abyData;
+    }
+
+  public:
+    // Called once, before any other method.
+    void Init()
+    {
+        const char *pszMax =
+            CPLGetConfigOption("GDAL_RB_COMPRESSED_CACHE_MAX", "0");
+        GIntBig nMax = 0;
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszMax, &nMax, &bUnitSpecified) != CE_None)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Invalid value for GDAL_RB_COMPRESSED_CACHE_MAX. "
+                     "Compressed block cache disabled.");
+            return;
+        }
+        if (!bUnitSpecified && nMax < 100000)
+        {
+            // Assume MB, as for GDAL_CACHEMAX
+            nMax *= (1024 * 1024);
+        }
+        if (nMax <= 0)
+            return;
+
+        const char *pszCodec =
+            CPLGetConfigOption("GDAL_RB_COMPRESSED_CACHE_CODEC", nullptr);
+        if (pszCodec)
+        {
+            m_osCodec = CPLString(pszCodec).tolower();
+        }
+        else
+        {
+            for (const char *pszCandidate : {"lz4", "zstd", "zlib"})
+            {
+                if (CPLGetCompressor(pszCandidate))
+                {
+                    m_osCodec = pszCandidate;
+                    break;
+                }
+            }
+        }
+        if (m_osCodec.empty() || !CPLGetCompressor(m_osCodec.c_str()) ||
+            !CPLGetDecompressor(m_osCodec.c_str()))
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "No compressor available for "
+                     "GDAL_RB_COMPRESSED_CACHE_CODEC=%s. "
+                     "Compressed block cache disabled.",
+                     m_osCodec.c_str());
+            return;
+        }
+        // Favor speed over compression ratio.
+        if (m_osCodec == "zstd" || m_osCodec == "zlib")
+            m_aosOptions.SetNameValue("LEVEL", "1");
+
+        m_nMax = static_cast<size_t>(
+            std::min<GIntBig>(nMax, std::numeric_limits<size_t>::max() / 2));
+        CPLDebug("GDAL",
+                 "Compressed block cache of " CPL_FRMT_GIB " MB, using %s",
+                 static_cast<GIntBig>(m_nMax / (1024 * 1024)),
+                 m_osCodec.c_str());
+    }
+
+    bool IsEnabled() const
+    {
+        return m_nMax > 0;
+    }
+
+    // Store a copy of the data of a block being evicted
+    void Store(const GDALRasterBand *poBand, int nXOff, int nYOff,
+               const void *pData, size_t nSize)
+    {
+        const CPLCompressor *psCompressor =
+            CPLGetCompressor(m_osCodec.c_str());
+        if (!psCompressor)
+            return;
+
+        // Only keep the block if compression is effective.
+        Entry oEntry;
+        oEntry.oKey = GDALRasterBlockKey{poBand, nXOff, nYOff};
+        oEntry.abyData.resize(nSize);
+        void *pOutput = oEntry.abyData.data();
+        size_t nOutputSize = nSize;
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            if (!psCompressor->pfnFunc(pData, nSize, &pOutput, &nOutputSize,
+                                       m_aosOptions.List(),
+                                       psCompressor->user_data) ||
+                nOutputSize >= nSize)
+            {
+                return;
+            }
+        }
+        oEntry.abyData.resize(nOutputSize);
+        oEntry.abyData.shrink_to_fit();
+
+        std::lock_guard oLock(m_oMutex);
+        const auto oIter = m_oMap.find(oEntry.oKey);
+        if (oIter != m_oMap.end())
+            Erase(oIter->second);
+        m_nUsed += GetEntrySize(oEntry);
+        m_oList.push_front(std::move(oEntry));
+        m_oMap[m_oList.front().oKey] = m_oList.begin();
+        ++m_oMapBandCount[poBand];
+        while (m_nUsed > m_nMax)
+            Erase(std::prev(m_oList.end()));
+    }
+
+    // Remove the entry of a block, and decompress it into pData if found.
+    // If pData is null, the entry is only removed.
+    bool Take(const GDALRasterBand *poBand, int nXOff, int nYOff, void *pData,
+              size_t nSize)
+    {
+        std::vector<GByte> abyData;
+        {
+            std::lock_guard oLock(m_oMutex);
+            if (m_oMapBandCount.find(poBand) == m_oMapBandCount.end())
+                return false;
+            const auto oIter =
+                m_oMap.find(GDALRasterBlockKey{poBand, nXOff, nYOff});
+            if (oIter == m_oMap.end())
+                return false;
+            abyData = Erase(oIter->second);
+        }
+        if (!pData)
+            return false;
+
+        const CPLCompressor *psDecompressor =
+            CPLGetDecompressor(m_osCodec.c_str());
+        if (!psDecompressor)
+            return false;
+        size_t nOutputSize = nSize;
+        return psDecompressor->pfnFunc(abyData.data(), abyData.size(), &pData,
+                                       &nOutputSize, nullptr,
+                                       psDecompressor->user_data) &&
+               nOutputSize == nSize;
+    }
+
+    // Remove all entries of a band.
+    void RemoveBand(const GDALRasterBand *poBand)
+    {
+        std::lock_guard oLock(m_oMutex);
+        if (m_oMapBandCount.find(poBand) == m_oMapBandCount.end())
+            return;
+        for (auto oIter = m_oList.begin(); oIter != m_oList.end();)
+        {
+            auto oIterNext = std::next(oIter);
+            if (oIter->oKey.poBand == poBand)
+                Erase(oIter);
+            oIter = oIterNext;
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_oMap.clear();
+        m_oList.clear();
+        m_oMapBandCount.clear();
+        m_nUsed = 0;
+    }
+};
+
+struct GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;           // Tail.
+    GDALRasterBlock *poNewest = nullptr;           // Head.
+    GDALRasterBlock *poProbationNewest = nullptr;  // Head of probation.
+    // Only modified under hLock, but may be read without it.
+    std::atomic<GIntBig> nCacheUsed{0};
+    // Size of the blocks of the protected segment. Protected by hLock.
+    GIntBig nProtectedUsed = 0;
+    // Only used by the 2Q policy. Protected by hLock.
+    std::unique_ptr<GDALRasterBlockGhostList> poGhostList{};
+};
+}  // namespace
+
+constexpr int MAX_SHARD_COUNT = 64;
+static GDALRasterBlockCacheShard aoShards[MAX_SHARD_COUNT];
+// Set once by GetShardCount(), but may be read by threads that have not
+// gone through it, hence the atomics.
+static std::atomic<int> nShardCount{0};
+static std::atomic<GDALRasterBlockEvictionPolicy> eEvictionPolicy{
+    GDALRasterBlockEvictionPolicy::LRU};
+static GDALRasterBlockCompressedCache oCompressedCache;
+
 static CPLLockType GetLockType()
 {
     static int nLockType = -1;
@@ -75,16 +432,239 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+/************************************************************************/
+/*                           GetDirtyRatio()                            */
+/************************************************************************/
 
-#endif
+// Ratio of the cache size above which writers write back their own dirty
+// blocks, or 0 if GDAL_CACHE_DIRTY_RATIO is not set.
+// Not cached so that it can be changed at run time.
+static double GetDirtyRatio()
+{
+    const char *pszDirtyRatio =
+        CPLGetConfigOption("GDAL_CACHE_DIRTY_RATIO", nullptr);
+    if (pszDirtyRatio == nullptr)
+        return 0;
+    const double dfRatio = CPLAtof(pszDirtyRatio);
+    if (!(dfRatio > 0 && dfRatio < 1))
+    {
+        CPLDebugOnce("GDAL", "GDAL_CACHE_DIRTY_RATIO=%s ignored. "
+                             "It should be in ]0,1[",
+                     pszDirtyRatio);
+        return 0;
+    }
+    return dfRatio;
+}
+
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
+
+// Also reads the eviction policy and the settings of the compressed block
+// cache, as they cannot change once blocks have been added to the cache.
+static int GetShardCount()
+{
+    static std::once_flag flagShardCount;
+    std::call_once(
+        flagShardCount,
+        []()
+        {
+            const char *pszPolicy =
+                CPLGetConfigOption("GDAL_RB_EVICTION_POLICY", "LRU");
+            if (EQUAL(pszPolicy, "2Q"))
+                eEvictionPolicy = GDALRasterBlockEvictionPolicy::TWO_Q;
+            else if (!EQUAL(pszPolicy, "LRU"))
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "GDAL_RB_EVICTION_POLICY=%s not supported. "
+                         "Falling back to LRU",
+                         pszPolicy);
+            }
+
+            const char *pszShardCount =
+                CPLGetConfigOption("GDAL_RB_SHARD_COUNT", "1");
+            int nCount;
+            if (EQUAL(pszShardCount, "AUTO"))
+                nCount = CPLGetNumCPUs();
+            else
+                nCount = atoi(pszShardCount);
+            if (nCount < 1)
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "GDAL_RB_SHARD_COUNT=%s not supported. "
+                         "Falling back to 1",
+                         pszShardCount);
+                nCount = 1;
+            }
+            else if (nCount > MAX_SHARD_COUNT)
+            {
+                CPLDebug("GDAL", "GDAL_RB_SHARD_COUNT clamped to %d",
+                         MAX_SHARD_COUNT);
+                nCount = MAX_SHARD_COUNT;
+            }
+            nShardCount = nCount;
+
+            oCompressedCache.Init();
+        });
+    return nShardCount.load();
+}
+
+#define INITIALIZE_LOCK(poShard)                                               \
+    CPLLockHolderD(&((poShard)->hLock), GetLockType());                        \
+    CPLLockSetDebugPerf((poShard)->hLock, bDebugContention)
+#define TAKE_LOCK(poShard) CPLLockHolderOptionalLockD((poShard)->hLock)
+#define DESTROY_LOCK(poShard) CPLDestroyLock((poShard)->hLock)
+
+/************************************************************************/
+/*                           InitializeLocks()                          */
+/************************************************************************/
+
+static void InitializeLocks()
+{
+    const int nShards = GetShardCount();
+    for (int i = 0; i < nShards; ++i)
+    {
+        INITIALIZE_LOCK(&aoShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                              GetShard()                              */
+/************************************************************************/
+
+static GDALRasterBlockCacheShard *GetShard(GDALRasterBand *poBand)
+{
+    const int nShards = nShardCount.load();
+    if (nShards <= 1)
+        return &aoShards[0];
+
+    // All blocks of a dataset go to the same shard, so that the
+    // "dirty blocks of this dataset first" eviction logic of Internalize()
+    // only has to look at a single LRU list.
+    GDALDataset *poDS = poBand->GetDataset();
+    uint64_t nHash =
+        poDS ? static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poDS))
+             : static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poBand));
+    // Finalizer of MurmurHash3, to spread the (aligned) pointer bits.
+    nHash ^= nHash >> 33;
+    nHash *= 0xff51afd7ed558ccdULL;
+    nHash ^= nHash >> 33;
+    return &aoShards[nHash % static_cast<unsigned>(nShards)];
+}
+
+/************************************************************************/
+/*                          GetMostUsedShard()                          */
+/************************************************************************/
+
+// Must be called without any shard lock held. The returned value is
+// only a hint, as the usage of shards is read without taking their lock.
+static GDALRasterBlockCacheShard *GetMostUsedShard()
+{
+    GDALRasterBlockCacheShard *poRet = &aoShards[0];
+    GIntBig nMaxUsed = -1;
+    const int nShards = nShardCount.load();
+    for (int i = 0; i < nShards; ++i)
+    {
+        const GIntBig nUsed = aoShards[i].nCacheUsed.load();
+        if (nUsed > nMaxUsed)
+        {
+            nMaxUsed = nUsed;
+            poRet = &aoShards[i];
+        }
+    }
+    return poRet;
+}
+
+/************************************************************************/
+/*                         RecordEvictedBlock()                         */
+/************************************************************************/
+
+// Must be called with the lock of poShard held, before the block is
+// detached.
+static void RecordEvictedBlock(GDALRasterBlockCacheShard *poShard,
+                               GDALRasterBlock *poBlock, bool bProtected)
+{
+    if (eEvictionPolicy != GDALRasterBlockEvictionPolicy::TWO_Q ||
+        bProtected || poBlock->GetBand()->GetBlockCacheStreamingHint())
+        return;
+    if (!poShard->poGhostList)
+        poShard->poGhostList = std::make_unique<GDALRasterBlockGhostList>();
+    // Remember as many evicted blocks as half of the number of blocks that
+    // fit in the shard.
+    const GIntBig nBlockSize =
+        std::max<GIntBig>(1, poBlock->GetBlockSize());
+    const size_t nMaxSize = static_cast<size_t>(std::max<GIntBig>(
+        64, poShard->nCacheUsed.load() / nBlockSize / 2));
+    poShard->poGhostList->Add(
+        {poBlock->GetBand(), poBlock->GetXOff(), poBlock->GetYOff()},
+        nMaxSize);
+}
 
 // #define ENABLE_DEBUG
 
+/************************************************************************/
+/*                         GetDatasetCounters()                         */
+/************************************************************************/
+
+static GDALBlockCacheCounters *GetDatasetCounters(GDALRasterBand *poBand)
+{
+    GDALDataset *poDS = poBand->GetDataset();
+    return poDS ? poDS->GetBlockCacheCounters() : nullptr;
+}
+
+/************************************************************************/
+/*                 GDALBlockCacheCounters::GetCacheMax()                */
+/************************************************************************/
+
+// Return the quota of a dataset, determining it from GDAL_DATASET_CACHEMAX
+// the first time it is needed, so as not to pay the configuration option
+// lookup for each dataset object that never caches blocks.
+GIntBig GDALBlockCacheCounters::GetCacheMax()
+{
+    GIntBig nVal = nCacheMax.load();
+    if (nVal >= 0)
+        return nVal;
+
+    GIntBig nNewVal = 0;
+    const char *pszCacheMax =
+        CPLGetConfigOption("GDAL_DATASET_CACHEMAX", nullptr);
+    if (pszCacheMax)
+    {
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszCacheMax, &nNewVal, &bUnitSpecified) !=
+            CE_None)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Invalid value for GDAL_DATASET_CACHEMAX. Ignoring it.");
+            nNewVal = 0;
+        }
+        else if (!bUnitSpecified && nNewVal < 100000)
+        {
+            // Assume MB, as for GDAL_CACHEMAX
+            nNewVal *= (1024 * 1024);
+        }
+        nNewVal = std::max<GIntBig>(0, nNewVal);
+    }
+    // Do not override a value set concurrently by SetBlockCacheMax()
+    if (!nCacheMax.compare_exchange_strong(nVal, nNewVal))
+        return nVal;
+    return nNewVal;
+}
+
+/************************************************************************/
+/*                          IncrementCounter()                          */
+/************************************************************************/
+
+// Increment a counter of the global statistics, and of the dataset ones if
+// poCounters is not null.
+static void IncrementCounter(GDALBlockCacheCounters *poCounters,
+                             std::atomic<GUIntBig> GDALBlockCacheCounters::*pn)
+{
+    ++(oGlobalCacheCounters.*pn);
+    if (poCounters)
+        ++(poCounters->*pn);
+}
+
 /************************************************************************/
 /*                          GDALSetCacheMax()                           */
 /************************************************************************/
@@ -221,9 +801,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            InitializeLocks();
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -300,6 +878,32 @@ GIntBig CPL_STDCALL GDALGetCacheUsed64()
     return nCacheUsed;
 }
 
+/************************************************************************/
+/*                       GDALGetCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Get statistics of the whole block cache.
+ *
+ * Counters are accumulated since the start of the process.
+ *
+ * @param psStats Structure to fill. Must not be NULL.
+ *
+ * @see GDALDatasetGetCacheStatistics()
+ * @since GDAL 3.12
+ */
+
+void GDALGetCacheStatistics(GDALBlockCacheStatistics *psStats)
+{
+    VALIDATE_POINTER0(psStats, "GDALGetCacheStatistics");
+
+    psStats->nHits = oGlobalCacheCounters.nHits;
+    psStats->nMisses = oGlobalCacheCounters.nMisses;
+    psStats->nEvictions = oGlobalCacheCounters.nEvictions;
+    psStats->nDirtyFlushes = oGlobalCacheCounters.nDirtyFlushes;
+    psStats->nCacheUsed = nCacheUsed;
+}
+
 /************************************************************************/
 /*                        GDALFlushCacheBlock()                         */
 /*                                                                      */
@@ -377,11 +981,17 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    GDALRasterBlock *poTarget = nullptr;
 
+    // Start with the most used shard, and then try the other ones.
+    const int nShards = GetShardCount();
+    const int iFirstShard = static_cast<int>(GetMostUsedShard() - aoShards);
+    for (int iIter = 0; iIter < nShards && poTarget == nullptr; ++iIter)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRasterBlockCacheShard *poShard =
+            &aoShards[(iFirstShard + iIter) % nShards];
+        INITIALIZE_LOCK(poShard);
+        poTarget = poShard->poOldest;
 
         while (poTarget != nullptr)
         {
@@ -395,7 +1005,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -408,10 +1018,16 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 #endif
 
+        RecordEvictedBlock(poShard, poTarget, poTarget->bProtected);
+        IncrementCounter(poTarget->poCounters,
+                         &GDALBlockCacheCounters::nEvictions);
         poTarget->Detach_unlocked();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -424,6 +1040,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
     }
 #endif
 
+    bool bStoreCompressed = poTarget->MayStoreCompressed();
     if (poTarget->GetDirty())
     {
         const CPLErr eErr = poTarget->Write();
@@ -431,8 +1048,11 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         {
             // Save the error for later reporting.
             poTarget->GetBand()->SetFlushBlockErr(eErr);
+            bStoreCompressed = false;
         }
     }
+    if (bStoreCompressed)
+        poTarget->StoreCompressed();
 
     VSIFreeAligned(poTarget->pData);
     poTarget->pData = nullptr;
@@ -534,13 +1154,14 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
                                  int nYOffIn)
     : eType(poBandIn->GetRasterDataType()), bDirty(false), nLockCount(0),
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
-      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
+      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true),
+      bProtected(false), poCounters(nullptr)
 {
-    if (!hRBLock)
+    if (!aoShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -568,7 +1189,8 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
 GDALRasterBlock::GDALRasterBlock(int nXOffIn, int nYOffIn)
     : eType(GDT_Unknown), bDirty(false), nLockCount(0), nXOff(nXOffIn),
       nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr), poBand(nullptr),
-      poNext(nullptr), poPrevious(nullptr), bMustDetach(false)
+      poNext(nullptr), poPrevious(nullptr), bMustDetach(false),
+      bProtected(false), poCounters(nullptr)
 {
 }
 
@@ -586,6 +1208,8 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
 {
     CPLAssert(pData == nullptr);
     pData = nullptr;
+    if (bDirty && poBand)
+        nCacheDirty -= GetBlockSize();
     bDirty = false;
     nLockCount = 0;
 
@@ -595,6 +1219,8 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
     nXOff = nXOffIn;
     nYOff = nYOffIn;
     bMustDetach = true;
+    bProtected = false;
+    poCounters = nullptr;
 }
 
 /************************************************************************/
@@ -617,6 +1243,10 @@ GDALRasterBlock::~GDALRasterBlock()
         VSIFreeAligned(pData);
     }
 
+    // Discarded dirty block
+    if (bDirty && poBand)
+        nCacheDirty -= GetBlockSize();
+
     CPLAssert(nLockCount <= 0);
 
 #ifdef ENABLE_DEBUG
@@ -657,19 +1287,31 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(poBand));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRasterBlockCacheShard *poShard = GetShard(poBand);
+
+    if (poShard->poOldest == this)
+        poShard->poOldest = poPrevious;
+
+    if (poShard->poNewest == this)
+    {
+        poShard->poNewest = poNext;
+    }
 
-    if (poNewest == this)
+    if (poShard->poProbationNewest == this)
+        poShard->poProbationNewest = poNext;
+
+    if (bProtected)
     {
-        poNewest = poNext;
+        poShard->nProtectedUsed -=
+            static_cast<GIntBig>(GetEffectiveBlockSize(GetBlockSize()));
+        bProtected = false;
     }
 
     if (poPrevious != nullptr)
@@ -683,7 +1325,14 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const GIntBig nEffectiveSize =
+            static_cast<GIntBig>(GetEffectiveBlockSize(GetBlockSize()));
+        poShard->nCacheUsed -= nEffectiveSize;
+        nCacheUsed -= nEffectiveSize;
+        if (poCounters)
+            poCounters->nCacheUsed -= nEffectiveSize;
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -703,26 +1352,32 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int iShard = 0; iShard < nShardCount.load(); ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockCacheShard *poShard = &aoShards[iShard];
+        TAKE_LOCK(poShard);
+
+        CPLAssert((poShard->poNewest == nullptr &&
+                   poShard->poOldest == nullptr) ||
+                  (poShard->poNewest != nullptr &&
+                   poShard->poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (poShard->poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(poShard->poNewest->poPrevious == nullptr);
+            CPLAssert(poShard->poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = poShard->poNewest;
+                 poBlock != nullptr; poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(poShard->poOldest == poLast);
+        }
     }
 }
 
@@ -735,8 +1390,9 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    GDALRasterBlockCacheShard *poShard = GetShard(poBand);
+    TAKE_LOCK(poShard);
+    for (GDALRasterBlock *poBlock = poShard->poNewest; poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -785,8 +1441,15 @@ CPLErr GDALRasterBlock::Write()
 
     if (poBand->eFlushBlockErr == CE_None)
     {
+        IncrementCounter(poCounters, &GDALBlockCacheCounters::nDirtyFlushes);
+
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
-        CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
+        CPLErr eErr;
+        {
+            CPLTraceScope oTraceScope("GDALRasterBand::IWriteBlock");
+            CPLTraceCounterAdd(CPL_TRACE_COUNTER_BLOCKS_WRITTEN, 1);
+            eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
+        }
         if (bCallLeaveReadWrite)
             poBand->LeaveReadWrite();
         return eErr;
@@ -809,11 +1472,13 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockCacheShard *poShard = GetShard(poBand);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (poShard->poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(poShard);
     Touch_unlocked();
 }
 
@@ -826,15 +1491,70 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    GDALRasterBlockCacheShard *poShard = GetShard(poBand);
+    if (poShard->poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    const bool bLinked = poPrevious != nullptr || poNext != nullptr;
+    if (bLinked && !bProtected)
+    {
+        // Blocks of the probation segment are kept in FIFO order, so that
+        // repeated accesses to them during a single pass over a dataset
+        // do not promote them.
+        return;
+    }
+
+    if (!bLinked)
+    {
+        bool bProbation = poBand->m_bBlockCacheStreamingHint;
+        if (!bProbation &&
+            eEvictionPolicy == GDALRasterBlockEvictionPolicy::TWO_Q)
+        {
+            // Only blocks that have been recently evicted from the
+            // probation segment directly enter the protected segment.
+            bProbation =
+                !(poShard->poGhostList &&
+                  poShard->poGhostList->Remove({poBand, nXOff, nYOff}));
+        }
+
+        if (bProbation)
+        {
+            // Insert at the head of the probation segment.
+            bProtected = false;
+            if (poShard->poProbationNewest != nullptr)
+            {
+                poNext = poShard->poProbationNewest;
+                poPrevious = poNext->poPrevious;
+                poNext->poPrevious = this;
+            }
+            else
+            {
+                poNext = nullptr;
+                poPrevious = poShard->poOldest;
+                poShard->poOldest = this;
+            }
+            if (poPrevious != nullptr)
+                poPrevious->poNext = this;
+            else
+                poShard->poNewest = this;
+            poShard->poProbationNewest = this;
+#ifdef ENABLE_DEBUG
+            Verify();
+#endif
+            return;
+        }
+
+        bProtected = true;
+        poShard->nProtectedUsed +=
+            static_cast<GIntBig>(GetEffectiveBlockSize(GetBlockSize()));
+    }
+
+    if (poShard->poOldest == this)
+        poShard->poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -843,19 +1563,41 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = poShard->poNewest;
 
-    if (poNewest != nullptr)
+    if (poShard->poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(poShard->poNewest->poPrevious == nullptr);
+        poShard->poNewest->poPrevious = this;
     }
-    poNewest = this;
+    poShard->poNewest = this;
 
-    if (poOldest == nullptr)
+    if (poShard->poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        poShard->poOldest = this;
+    }
+
+    if (eEvictionPolicy == GDALRasterBlockEvictionPolicy::TWO_Q)
+    {
+        // Demote the least recently used protected blocks into the probation
+        // segment, so that it uses at least a quarter of the shard share.
+        // As both segments are contiguous, this just moves their boundary.
+        const GIntBig nProtectedMax = nCacheMax / nShardCount.load() / 4 * 3;
+        while (poShard->nProtectedUsed > nProtectedMax)
+        {
+            GDALRasterBlock *poLast =
+                poShard->poProbationNewest
+                    ? poShard->poProbationNewest->poPrevious
+                    : poShard->poOldest;
+            if (poLast == nullptr || poLast == this)
+                break;
+            CPLAssert(poLast->bProtected);
+            poLast->bProtected = false;
+            poShard->nProtectedUsed -= static_cast<GIntBig>(
+                GetEffectiveBlockSize(poLast->GetBlockSize()));
+            poShard->poProbationNewest = poLast;
+        }
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -884,12 +1626,21 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard mutexes. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
+    const GIntBig nEffectiveSize =
+        static_cast<GIntBig>(GetEffectiveBlockSize(nSizeInBytes));
+
+    GDALRasterBlockCacheShard *const poThisShard = GetShard(poBand);
+    poCounters = GetDatasetCounters(poBand);
+    const int nShards = nShardCount.load();
+    // Share of the cache above which a shard must evict its own blocks,
+    // instead of evicting blocks of other shards.
+    const GIntBig nShardCacheMax = nCurCacheMax / nShards;
 
     /* -------------------------------------------------------------------- */
     /*      Flush old blocks if we are nearing our memory limit.            */
@@ -897,137 +1648,144 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
-    do
+    GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
+    int nBlocksToFree = 0;
+
+    // Detach blocks of poShard, and store them into apoBlocksToFree[],
+    // until the cache is back within its limits.
+    // Must be called with the lock of poShard held.
+    const auto CollectBlocksToFree =
+        [nCurCacheMax, nShardCacheMax, poThisShard, poThisDS, &apoBlocksToFree,
+         &nBlocksToFree, &bLoopAgain](GDALRasterBlockCacheShard *poShard)
     {
-        bLoopAgain = false;
-        GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
-        int nBlocksToFree = 0;
+        // When evicting from our own shard, only do that if it uses more than
+        // its share. Otherwise blocks of more greedy shards will be evicted
+        // by the caller. For a single shard, this is equivalent to testing
+        // nCacheUsed > nCurCacheMax.
+        const auto MustEvict = [nCurCacheMax, nShardCacheMax, poThisShard,
+                                poShard]()
         {
-            TAKE_LOCK;
+            return nCacheUsed > nCurCacheMax &&
+                   (poShard != poThisShard ||
+                    poShard->nCacheUsed > nShardCacheMax);
+        };
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+        GDALRasterBlock *poTarget = poShard->poOldest;
+        while (MustEvict())
+        {
+            GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
+            // In this first pass, only discard dirty blocks of this
+            // dataset. We do this to decrease significantly the likelihood
+            // of the following weakness of the block cache design:
+            // 1. Thread 1 fills block B with ones
+            // 2. Thread 2 evicts this dirty block, while thread 1 almost
+            //    at the same time (but slightly after) tries to reacquire
+            //    this block. As it has been removed from the block cache
+            //    array/set, thread 1 now tries to read block B from disk,
+            //    so gets the old value.
+            while (poTarget != nullptr)
             {
-                GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
-                // In this first pass, only discard dirty blocks of this
-                // dataset. We do this to decrease significantly the likelihood
-                // of the following weakness of the block cache design:
-                // 1. Thread 1 fills block B with ones
-                // 2. Thread 2 evicts this dirty block, while thread 1 almost
-                //    at the same time (but slightly after) tries to reacquire
-                //    this block. As it has been removed from the block cache
-                //    array/set, thread 1 now tries to read block B from disk,
-                //    so gets the old value.
-                while (poTarget != nullptr)
+                if (!poTarget->GetDirty())
+                {
+                    if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0,
+                                                    -1))
+                        break;
+                }
+                else if (nDisableDirtyBlockFlushCounter == 0)
                 {
-                    if (!poTarget->GetDirty())
+                    if (poTarget->poBand->GetDataset() == poThisDS)
                     {
                         if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
                                                         0, -1))
                             break;
                     }
-                    else if (nDisableDirtyBlockFlushCounter == 0)
+                    else if (poDirtyBlockOtherDataset == nullptr)
                     {
-                        if (poTarget->poBand->GetDataset() == poThisDS)
-                        {
-                            if (CPLAtomicCompareAndExchange(
-                                    &(poTarget->nLockCount), 0, -1))
-                                break;
-                        }
-                        else if (poDirtyBlockOtherDataset == nullptr)
-                        {
-                            poDirtyBlockOtherDataset = poTarget;
-                        }
+                        poDirtyBlockOtherDataset = poTarget;
                     }
-                    poTarget = poTarget->poPrevious;
                 }
-                if (poTarget == nullptr && poDirtyBlockOtherDataset)
+                poTarget = poTarget->poPrevious;
+            }
+            if (poTarget == nullptr && poDirtyBlockOtherDataset)
+            {
+                if (CPLAtomicCompareAndExchange(
+                        &(poDirtyBlockOtherDataset->nLockCount), 0, -1))
                 {
-                    if (CPLAtomicCompareAndExchange(
-                            &(poDirtyBlockOtherDataset->nLockCount), 0, -1))
-                    {
-                        CPLDebug("GDAL",
-                                 "Evicting dirty block of another dataset");
-                        poTarget = poDirtyBlockOtherDataset;
-                    }
-                    else
+                    CPLDebug("GDAL", "Evicting dirty block of another dataset");
+                    poTarget = poDirtyBlockOtherDataset;
+                }
+                else
+                {
+                    poTarget = poShard->poOldest;
+                    while (poTarget != nullptr)
                     {
-                        poTarget = poOldest;
-                        while (poTarget != nullptr)
+                        if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
+                                                        0, -1))
                         {
-                            if (CPLAtomicCompareAndExchange(
-                                    &(poTarget->nLockCount), 0, -1))
-                            {
-                                CPLDebug(
-                                    "GDAL",
-                                    "Evicting dirty block of another dataset");
-                                break;
-                            }
-                            poTarget = poTarget->poPrevious;
+                            CPLDebug("GDAL",
+                                     "Evicting dirty block of another dataset");
+                            break;
                         }
+                        poTarget = poTarget->poPrevious;
                     }
                 }
+            }
 
-                if (poTarget != nullptr)
-                {
+            if (poTarget != nullptr)
+            {
 #ifndef __COVERITY__
-                    // Disabled to avoid complains about sleeping under locks,
-                    // that are only true for debug/testing code
-                    if (bSleepsForBockCacheDebug)
-                    {
-                        const double dfDelay = CPLAtof(CPLGetConfigOption(
-                            "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
-                        if (dfDelay > 0)
-                            CPLSleep(dfDelay);
-                    }
+                // Disabled to avoid complains about sleeping under locks,
+                // that are only true for debug/testing code
+                if (bSleepsForBockCacheDebug)
+                {
+                    const double dfDelay = CPLAtof(CPLGetConfigOption(
+                        "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
+                    if (dfDelay > 0)
+                        CPLSleep(dfDelay);
+                }
 #endif
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                GDALRasterBlock *_poPrevious = poTarget->poPrevious;
 
-                    poTarget->Detach_unlocked();
-                    poTarget->GetBand()->UnreferenceBlock(poTarget);
-
-                    apoBlocksToFree[nBlocksToFree++] = poTarget;
-                    if (poTarget->GetDirty())
-                    {
-                        // Only free one dirty block at a time so that
-                        // other dirty blocks of other bands with the same
-                        // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
-                        break;
-                    }
-                    if (nBlocksToFree == 64)
-                    {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
-                        break;
-                    }
+                RecordEvictedBlock(poShard, poTarget, poTarget->bProtected);
+                IncrementCounter(poTarget->poCounters,
+                                 &GDALBlockCacheCounters::nEvictions);
+                poTarget->Detach_unlocked();
+                poTarget->GetBand()->UnreferenceBlock(poTarget);
 
-                    poTarget = _poPrevious;
+                apoBlocksToFree[nBlocksToFree++] = poTarget;
+                if (poTarget->GetDirty())
+                {
+                    // Only free one dirty block at a time so that
+                    // other dirty blocks of other bands with the same
+                    // coordinates can be found with TryGetLockedBlock()
+                    bLoopAgain = MustEvict();
+                    break;
                 }
-                else
+                if (nBlocksToFree == 64)
                 {
+                    bLoopAgain = MustEvict();
                     break;
                 }
-            }
 
-            /* ------------------------------------------------------------------
-             */
-            /*      Add this block to the list. */
-            /* ------------------------------------------------------------------
-             */
-            if (!bLoopAgain)
-                Touch_unlocked();
+                poTarget = _poPrevious;
+            }
+            else
+            {
+                break;
+            }
         }
+    };
 
-        bFirstIter = false;
-
-        // Now free blocks we have detached and removed from their band.
+    // Now free blocks we have detached and removed from their band.
+    const auto FreeBlocks =
+        [&apoBlocksToFree, &nBlocksToFree, &pNewData, nSizeInBytes]()
+    {
         for (int i = 0; i < nBlocksToFree; ++i)
         {
             GDALRasterBlock *const poBlock = apoBlocksToFree[i];
 
+            bool bStoreCompressed = poBlock->MayStoreCompressed();
             if (poBlock->GetDirty())
             {
 #ifndef __COVERITY__
@@ -1048,8 +1806,11 @@ CPLErr GDALRasterBlock::Internalize()
                 {
                     // Save the error for later reporting.
                     poBlock->GetBand()->SetFlushBlockErr(eErr);
+                    bStoreCompressed = false;
                 }
             }
+            if (bStoreCompressed)
+                poBlock->StoreCompressed();
 
             // Try to recycle the data of an existing block.
             void *pDataBlock = poBlock->pData;
@@ -1066,8 +1827,160 @@ CPLErr GDALRasterBlock::Internalize()
 
             poBlock->GetBand()->AddBlockToFreeList(poBlock);
         }
+        nBlocksToFree = 0;
+    };
+
+    // When GDAL_CACHE_DIRTY_RATIO is set and dirty blocks use more than
+    // that ratio of the cache, write the oldest dirty blocks of this dataset,
+    // without evicting them, until they are back under 3/4 of that ratio.
+    // Only blocks of our own dataset are written, as other datasets may be
+    // used by other threads. This makes later evictions, including by
+    // readers of other datasets, more likely to find clean blocks.
+    const double dfDirtyRatio =
+        nCacheDirty > 0 && nDisableDirtyBlockFlushCounter == 0
+            ? GetDirtyRatio()
+            : 0.0;
+    if (dfDirtyRatio > 0 &&
+        nCacheDirty > static_cast<GIntBig>(dfDirtyRatio * nCurCacheMax))
+    {
+        const GIntBig nLowWaterMark =
+            static_cast<GIntBig>(0.75 * dfDirtyRatio * nCurCacheMax);
+        GDALRasterBlock *apoBlocksToWrite[64] = {nullptr};
+        while (nCacheDirty > nLowWaterMark)
+        {
+            int nBlocksToWrite = 0;
+            {
+                TAKE_LOCK(poThisShard);
+                for (GDALRasterBlock *poTarget = poThisShard->poOldest;
+                     poTarget != nullptr && nBlocksToWrite < 64;
+                     poTarget = poTarget->poPrevious)
+                {
+                    if (poTarget->GetDirty() &&
+                        poTarget->poBand->GetDataset() == poThisDS &&
+                        CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0,
+                                                    1))
+                    {
+                        apoBlocksToWrite[nBlocksToWrite++] = poTarget;
+                    }
+                }
+            }
+            if (nBlocksToWrite == 0)
+                break;
+
+            for (int i = 0; i < nBlocksToWrite; ++i)
+            {
+                GDALRasterBlock *const poBlock = apoBlocksToWrite[i];
+                const CPLErr eErr = poBlock->Write();
+                if (eErr != CE_None)
+                {
+                    // Save the error for later reporting.
+                    poBlock->GetBand()->SetFlushBlockErr(eErr);
+                }
+                poBlock->DropLock();
+            }
+        }
+    }
+
+    do
+    {
+        bLoopAgain = false;
+        {
+            TAKE_LOCK(poThisShard);
+
+            if (bFirstIter)
+            {
+                poThisShard->nCacheUsed += nEffectiveSize;
+                nCacheUsed += nEffectiveSize;
+                if (poCounters)
+                    poCounters->nCacheUsed += nEffectiveSize;
+            }
+            CollectBlocksToFree(poThisShard);
+
+            /* ------------------------------------------------------------------
+             */
+            /*      Add this block to the list. */
+            /* ------------------------------------------------------------------
+             */
+            if (!bLoopAgain)
+                Touch_unlocked();
+        }
+
+        bFirstIter = false;
+
+        FreeBlocks();
+
+        // If our shard is within its share, but the whole cache is not,
+        // evict blocks from the shard that uses the most memory. We never
+        // hold two shard locks at the same time.
+        if (!bLoopAgain && nShards > 1 && nCacheUsed > nCurCacheMax)
+        {
+            GDALRasterBlockCacheShard *poOtherShard = GetMostUsedShard();
+            if (poOtherShard != poThisShard)
+            {
+                {
+                    TAKE_LOCK(poOtherShard);
+                    CollectBlocksToFree(poOtherShard);
+                }
+                FreeBlocks();
+            }
+        }
     } while (bLoopAgain);
 
+    /* -------------------------------------------------------------------- */
+    /*      Evict blocks of our dataset if it exceeds its own quota.        */
+    /* -------------------------------------------------------------------- */
+    const GIntBig nDSCacheMax = poCounters ? poCounters->GetCacheMax() : 0;
+    if (nDSCacheMax > 0 && poCounters->nCacheUsed > nDSCacheMax)
+    {
+        GDALBlockCacheCounters *const poThisCounters = poCounters;
+        const auto MustEvictFromDataset = [poThisCounters, nDSCacheMax]()
+        { return poThisCounters->nCacheUsed > nDSCacheMax; };
+
+        // Blocks of overview and mask datasets may be in other shards.
+        const int iFirstShard = static_cast<int>(poThisShard - aoShards);
+        for (int iIter = 0; iIter < nShards && MustEvictFromDataset();
+             ++iIter)
+        {
+            GDALRasterBlockCacheShard *poShard =
+                &aoShards[(iFirstShard + iIter) % nShards];
+            do
+            {
+                {
+                    TAKE_LOCK(poShard);
+                    GDALRasterBlock *poTarget = poShard->poOldest;
+                    while (poTarget != nullptr && MustEvictFromDataset())
+                    {
+                        GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                        if (poTarget != this &&
+                            poTarget->poCounters == poThisCounters &&
+                            (!poTarget->GetDirty() ||
+                             nDisableDirtyBlockFlushCounter == 0) &&
+                            CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
+                                                        0, -1))
+                        {
+                            RecordEvictedBlock(poShard, poTarget,
+                                               poTarget->bProtected);
+                            IncrementCounter(
+                                poThisCounters,
+                                &GDALBlockCacheCounters::nEvictions);
+                            poTarget->Detach_unlocked();
+                            poTarget->GetBand()->UnreferenceBlock(poTarget);
+                            apoBlocksToFree[nBlocksToFree++] = poTarget;
+                            // Same as above: only free one dirty block at
+                            // a time.
+                            if (poTarget->GetDirty() || nBlocksToFree == 64)
+                                break;
+                        }
+                        poTarget = _poPrevious;
+                    }
+                }
+                if (nBlocksToFree == 0)
+                    break;
+                FreeBlocks();
+            } while (MustEvictFromDataset());
+        }
+    }
+
     if (pNewData == nullptr)
     {
         pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
@@ -1075,6 +1988,7 @@ CPLErr GDALRasterBlock::Internalize()
         {
             return (CE_Failure);
         }
+        VSIAdviseHugePages(pNewData, nSizeInBytes);
     }
 
     pData = pNewData;
@@ -1082,6 +1996,126 @@ CPLErr GDALRasterBlock::Internalize()
     return CE_None;
 }
 
+/************************************************************************/
+/*                         RecordBlockRequest()                         */
+/************************************************************************/
+
+/**
+ * Record a request for a block of a band in the block cache statistics.
+ *
+ * @param poBand the band of the requested block.
+ * @param bHit whether the block was found in the cache.
+ */
+
+void GDALRasterBlock::RecordBlockRequest(GDALRasterBand *poBand, bool bHit)
+{
+    IncrementCounter(GetDatasetCounters(poBand),
+                     bHit ? &GDALBlockCacheCounters::nHits
+                          : &GDALBlockCacheCounters::nMisses);
+    CPLTraceCounterAdd(bHit ? CPL_TRACE_COUNTER_BLOCK_CACHE_HITS
+                            : CPL_TRACE_COUNTER_BLOCK_CACHE_MISSES,
+                       1);
+}
+
+/************************************************************************/
+/*                         MayStoreCompressed()                         */
+/************************************************************************/
+
+// Whether the block, being evicted, should be stored in the compressed
+// block cache. Blocks of streamed bands are not expected to be read again.
+bool GDALRasterBlock::MayStoreCompressed() const
+{
+    return oCompressedCache.IsEnabled() && pData != nullptr &&
+           !poBand->GetBlockCacheStreamingHint();
+}
+
+/************************************************************************/
+/*                          StoreCompressed()                           */
+/************************************************************************/
+
+// Store the (clean) content of the block in the compressed block cache.
+void GDALRasterBlock::StoreCompressed() const
+{
+    oCompressedCache.Store(poBand, nXOff, nYOff, pData,
+                           static_cast<size_t>(GetBlockSize()));
+}
+
+/************************************************************************/
+/*                     RestoreFromCompressedCache()                     */
+/************************************************************************/
+
+/**
+ * Restore the content of a newly internalized block from the compressed
+ * block cache, and remove it from there.
+ *
+ * @return true if the block was found in the compressed block cache.
+ */
+
+bool GDALRasterBlock::RestoreFromCompressedCache()
+{
+    if (!oCompressedCache.IsEnabled() || pData == nullptr)
+        return false;
+    return oCompressedCache.Take(poBand, nXOff, nYOff, pData,
+                                 static_cast<size_t>(GetBlockSize()));
+}
+
+/************************************************************************/
+/*                        DropCompressedBlock()                         */
+/************************************************************************/
+
+/**
+ * Remove a block of a band from the compressed block cache.
+ *
+ * @param poBand the band of the block.
+ * @param nXOff the horizontal block offset.
+ * @param nYOff the vertical block offset.
+ */
+
+void GDALRasterBlock::DropCompressedBlock(GDALRasterBand *poBand, int nXOff,
+                                          int nYOff)
+{
+    if (oCompressedCache.IsEnabled())
+        oCompressedCache.Take(poBand, nXOff, nYOff, nullptr, 0);
+}
+
+/************************************************************************/
+/*                        DropCompressedBlocks()                        */
+/************************************************************************/
+
+/**
+ * Remove all blocks of a band from the compressed block cache.
+ *
+ * @param poBand the band.
+ */
+
+void GDALRasterBlock::DropCompressedBlocks(GDALRasterBand *poBand)
+{
+    if (oCompressedCache.IsEnabled())
+        oCompressedCache.RemoveBand(poBand);
+}
+
+/************************************************************************/
+/*                           DropGhostBlocks()                          */
+/************************************************************************/
+
+/**
+ * Forget the blocks of a band that have been evicted from the block cache.
+ *
+ * Must be called when the band is destroyed.
+ *
+ * @param poBand the band.
+ */
+
+void GDALRasterBlock::DropGhostBlocks(GDALRasterBand *poBand)
+{
+    if (eEvictionPolicy != GDALRasterBlockEvictionPolicy::TWO_Q)
+        return;
+    GDALRasterBlockCacheShard *poShard = GetShard(poBand);
+    TAKE_LOCK(poShard);
+    if (poShard->poGhostList)
+        poShard->poGhostList->RemoveBand(poBand);
+}
+
 /************************************************************************/
 /*                             MarkDirty()                              */
 /************************************************************************/
@@ -1099,7 +2133,10 @@ void GDALRasterBlock::MarkDirty()
     {
         poBand->InitRWLock();
         if (!bDirty)
+        {
             poBand->IncDirtyBlocks(1);
+            nCacheDirty += GetBlockSize();
+        }
     }
     bDirty = true;
 }
@@ -1118,7 +2155,10 @@ void GDALRasterBlock::MarkDirty()
 void GDALRasterBlock::MarkClean()
 {
     if (bDirty && poBand)
+    {
         poBand->IncDirtyBlocks(-1);
+        nCacheDirty -= GetBlockSize();
+    }
     bDirty = false;
 }
 
@@ -1129,9 +2169,15 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    const int nShards = nShardCount.load();
+    for (int i = 0; i < nShards; ++i)
+    {
+        GDALRasterBlockCacheShard *poShard = &aoShards[i];
+        if (poShard->hLock != nullptr)
+            DESTROY_LOCK(poShard);
+        poShard->hLock = nullptr;
+    }
+    oCompressedCache.Clear();
 }
 
 /*! @endcond */
@@ -1214,7 +2260,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(poBand));
 
     return FALSE;
 }
@@ -1223,14 +2269,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int iShard = 0; iShard < nShardCount; ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = aoShards[iShard].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
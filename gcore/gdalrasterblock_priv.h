@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Name:     gdalrasterblock_priv.h
+ * Project:  GDAL Core
+ * Purpose:  GDAL private header for block cache internals
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALRASTERBLOCK_PRIV_INCLUDED
+#define GDALRASTERBLOCK_PRIV_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class GDALDataset;
+class GDALRasterBand;
+
+//! @cond Doxygen_Suppress
+
+/** Block cache counters, either of the whole block cache, or of a dataset
+ * (including its overview and mask datasets that share its lock).
+ */
+struct GDALBlockCacheCounters
+{
+    std::atomic<GUIntBig> nHits{0};
+    std::atomic<GUIntBig> nMisses{0};
+    std::atomic<GUIntBig> nEvictions{0};
+    std::atomic<GUIntBig> nDirtyFlushes{0};
+    // Memory used by cached blocks. Only maintained for datasets.
+    std::atomic<GIntBig> nCacheUsed{0};
+    // Maximum memory for cached blocks of a dataset. 0 means no quota, and
+    // -1 that it has not yet been determined. Use GetCacheMax() to read it.
+    std::atomic<GIntBig> nCacheMax{-1};
+
+    GIntBig GetCacheMax();
+};
+
+/** Asynchronous reader of blocks of the bands of a dataset.
+ *
+ * Blocks are read by a job of the global thread pool, from a clone of the
+ * dataset, and kept aside until GDALRasterBand::GetLockedBlockRef() needs
+ * them. Used by GDALRasterBand::PrefetchBlocks().
+ */
+class GDALBlockPrefetcher
+{
+    enum class State
+    {
+        QUEUED,
+        RUNNING,
+        DONE,
+    };
+
+    struct Entry
+    {
+        State eState = State::QUEUED;
+        bool bOK = false;
+        size_t nSize = 0;
+        std::vector<GByte> abyData{};
+    };
+
+    using Key = std::tuple<int, int, int>;  // band number, x and y offsets
+
+    GDALDataset *const m_poDS;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<Key, std::shared_ptr<Entry>> m_oMap{};
+    size_t m_nUsed = 0;  // Protected by m_oMutex
+
+    // Created by the first Submit() call, and then only used by jobs, which
+    // are serialized by m_oCloneMutex.
+    std::mutex m_oCloneMutex{};
+    std::unique_ptr<GDALDataset> m_poClone{};
+    bool m_bCloneFailed = false;
+
+    CPLJobQueuePtr m_poJobQueue{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALBlockPrefetcher)
+
+    void Run(int nBand, const std::vector<std::pair<int, int>> &anBlocks,
+             std::promise<CPLErr> &oPromise);
+
+  public:
+    explicit GDALBlockPrefetcher(GDALDataset *poDS);
+    ~GDALBlockPrefetcher();
+
+    std::shared_future<CPLErr>
+    Submit(GDALRasterBand *poBand, std::vector<std::pair<int, int>> anBlocks);
+
+    bool Take(int nBand, int nXOff, int nYOff, void *pData, size_t nSize);
+
+    void Drop(int nBand);
+};
+
+//! @endcond
+
+#endif  // GDALRASTERBLOCK_PRIV_INCLUDED
@@ -0,0 +1,364 @@
+/**********************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Export of raster windows as Arrow fixed shape tensors
+ * Author:   Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault, <even dot rouault at spatialys dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "memdataset.h"
+#include "ogr_recordbatch.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+/************************************************************************/
+/*                         GDALTensorSchema                             */
+/************************************************************************/
+
+struct GDALTensorSchema
+{
+    std::string osFormat{};
+    std::string osMetadata{};
+    ArrowSchema sChild{};
+    ArrowSchema *apsChildren[1] = {nullptr};
+};
+
+/************************************************************************/
+/*                          GDALTensorArray                             */
+/************************************************************************/
+
+struct GDALTensorArray
+{
+    // Zero-copy from a block of the block cache, kept locked
+    GDALRasterBlock *poBlock = nullptr;
+    // Zero-copy from the memory of a MEM dataset, kept referenced
+    GDALDataset *poDS = nullptr;
+    // Copy in a buffer owned by the array
+    void *pOwnedData = nullptr;
+
+    const void *apParentBuffers[1] = {nullptr};
+    const void *apChildBuffers[2] = {nullptr, nullptr};
+    ArrowArray sChild{};
+    ArrowArray *apsChildren[1] = {nullptr};
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       GDALGetArrowFormat()                           */
+/************************************************************************/
+
+static const char *GDALGetArrowFormat(GDALDataType eDT)
+{
+    switch (eDT)
+    {
+        case GDT_Byte:
+            return "C";
+        case GDT_Int8:
+            return "c";
+        case GDT_UInt16:
+            return "S";
+        case GDT_Int16:
+            return "s";
+        case GDT_UInt32:
+            return "I";
+        case GDT_Int32:
+            return "i";
+        case GDT_UInt64:
+            return "L";
+        case GDT_Int64:
+            return "l";
+        case GDT_Float16:
+            return "e";
+        case GDT_Float32:
+            return "f";
+        case GDT_Float64:
+            return "g";
+        case GDT_CInt16:
+        case GDT_CInt32:
+        case GDT_CFloat16:
+        case GDT_CFloat32:
+        case GDT_CFloat64:
+        case GDT_Unknown:
+        case GDT_TypeCount:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                     GDALAppendArrowMetadataItem()                    */
+/************************************************************************/
+
+static void GDALAppendArrowMetadataItem(std::string &osMetadata,
+                                        const std::string &osKey,
+                                        const std::string &osValue)
+{
+    for (const std::string *posStr : {&osKey, &osValue})
+    {
+        const int32_t nSize = static_cast<int32_t>(posStr->size());
+        osMetadata.append(reinterpret_cast<const char *>(&nSize),
+                          sizeof(nSize));
+        osMetadata.append(*posStr);
+    }
+}
+
+/************************************************************************/
+/*                        Release callbacks                             */
+/************************************************************************/
+
+static void GDALTensorReleaseChildSchema(ArrowSchema *psSchema)
+{
+    psSchema->release = nullptr;
+}
+
+static void GDALTensorReleaseSchema(ArrowSchema *psSchema)
+{
+    auto psPrivate = static_cast<GDALTensorSchema *>(psSchema->private_data);
+    if (psPrivate->sChild.release)
+        psPrivate->sChild.release(&psPrivate->sChild);
+    delete psPrivate;
+    psSchema->release = nullptr;
+}
+
+static void GDALTensorReleaseChildArray(ArrowArray *psArray)
+{
+    psArray->release = nullptr;
+}
+
+static void GDALTensorReleaseArray(ArrowArray *psArray)
+{
+    auto psPrivate = static_cast<GDALTensorArray *>(psArray->private_data);
+    if (psPrivate->sChild.release)
+        psPrivate->sChild.release(&psPrivate->sChild);
+    if (psPrivate->poBlock)
+        psPrivate->poBlock->DropLock();
+    if (psPrivate->poDS)
+        psPrivate->poDS->ReleaseRef();
+    VSIFreeAligned(psPrivate->pOwnedData);
+    delete psPrivate;
+    psArray->release = nullptr;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                GDALRasterBandGetWindowAsArrowTensor()                */
+/************************************************************************/
+
+/**
+ * \brief Export a window of a raster band as an Arrow fixed shape tensor.
+ *
+ * The window is returned as an ArrowArray of length 1, of the
+ * "arrow.fixed_shape_tensor" canonical extension type, whose storage type is
+ * a fixed size list of nYSize * nXSize values of the data type of the band,
+ * in row-major order, and with shape [nYSize, nXSize].
+ *
+ * When the layout allows it, no copy of the pixel values is done:
+ * <ul>
+ * <li>for bands of the MEM driver, if the lines of the window are contiguous
+ * in memory (that is the window is a single line, or the whole width of a
+ * band with a packed layout), the array points to the memory of the band.
+ * The dataset is referenced until the array is released.</li>
+ * <li>if the window matches the width of the blocks of the band, starts at
+ * the top-left corner of a block and does not extend beyond it, the array
+ * points to the block in the block cache, which is kept locked until the
+ * array is released.</li>
+ * </ul>
+ * Otherwise, the values are read with RasterIO() into a buffer owned by the
+ * array.
+ *
+ * In all cases, the array must be released before the dataset of the band is
+ * closed, and, in the zero-copy cases, the content of the array reflects
+ * later writes to the band.
+ *
+ * Complex data types are not supported.
+ *
+ * Supported options are:
+ * <ul>
+ * <li>ALLOW_COPY=YES/NO. Whether a copy of the values may be done if the
+ * layout does not allow zero-copy. Defaults to YES. If set to NO, this
+ * function fails in that situation.</li>
+ * </ul>
+ *
+ * @param hBand Raster band.
+ * @param nXOff X offset of the window.
+ * @param nYOff Y offset of the window.
+ * @param nXSize Width of the window.
+ * @param nYSize Height of the window.
+ * @param out_schema Pointer to an ArrowSchema structure, to be released by
+ *                   the caller with out_schema->release(out_schema).
+ * @param out_array Pointer to an ArrowArray structure, to be released by
+ *                  the caller with out_array->release(out_array).
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return true in case of success.
+ * @since GDAL 3.12
+ */
+bool GDALRasterBandGetWindowAsArrowTensor(GDALRasterBandH hBand, int nXOff,
+                                          int nYOff, int nXSize, int nYSize,
+                                          struct ArrowSchema *out_schema,
+                                          struct ArrowArray *out_array,
+                                          CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hBand, __func__, false);
+    VALIDATE_POINTER1(out_schema, __func__, false);
+    VALIDATE_POINTER1(out_array, __func__, false);
+
+    memset(out_schema, 0, sizeof(*out_schema));
+    memset(out_array, 0, sizeof(*out_array));
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    const GDALDataType eDT = poBand->GetRasterDataType();
+    const char *pszFormat = GDALGetArrowFormat(eDT);
+    if (!pszFormat)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "%s: data type %s is not supported", __func__,
+                 GDALGetDataTypeName(eDT));
+        return false;
+    }
+    if (nXOff < 0 || nYOff < 0 || nXSize <= 0 || nYSize <= 0 ||
+        nXSize > poBand->GetXSize() - nXOff ||
+        nYSize > poBand->GetYSize() - nYOff)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "%s: invalid window", __func__);
+        return false;
+    }
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const size_t nValues = static_cast<size_t>(nXSize) * nYSize;
+    if (nValues > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "%s: too large window",
+                 __func__);
+        return false;
+    }
+
+    auto psPrivate = new GDALTensorArray();
+    const void *pData = nullptr;
+
+    // Zero-copy from MEM dataset memory
+    if (auto poMEMBand = dynamic_cast<MEMRasterBand *>(poBand))
+    {
+        const GSpacing nPixelOffset = poMEMBand->GetPixelOffset();
+        const GSpacing nLineOffset = poMEMBand->GetLineOffset();
+        if (nPixelOffset == static_cast<GSpacing>(nDTSize) &&
+            (nYSize == 1 ||
+             nLineOffset == static_cast<GSpacing>(nXSize * nDTSize)))
+        {
+            pData = poMEMBand->GetData() + nYOff * nLineOffset +
+                    nXOff * nPixelOffset;
+            psPrivate->poDS = poMEMBand->GetDataset();
+            if (psPrivate->poDS)
+                psPrivate->poDS->Reference();
+        }
+    }
+
+    // Zero-copy from a block of the block cache
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    if (!pData && nXSize == nBlockXSize && (nXOff % nBlockXSize) == 0 &&
+        (nYOff % nBlockYSize) == 0 && nYSize <= nBlockYSize)
+    {
+        psPrivate->poBlock = poBand->GetLockedBlockRef(nXOff / nBlockXSize,
+                                                       nYOff / nBlockYSize);
+        if (!psPrivate->poBlock)
+        {
+            delete psPrivate;
+            return false;
+        }
+        pData = psPrivate->poBlock->GetDataRef();
+    }
+
+    if (!pData)
+    {
+        if (!CPLTestBool(
+                CSLFetchNameValueDef(papszOptions, "ALLOW_COPY", "YES")))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "%s: zero-copy export is not possible for this window, "
+                     "and ALLOW_COPY=NO is specified",
+                     __func__);
+            delete psPrivate;
+            return false;
+        }
+        // 64-byte alignment as recommended by the Arrow specification
+        psPrivate->pOwnedData = VSIMallocAligned(64, nValues * nDTSize);
+        if (!psPrivate->pOwnedData)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "%s: cannot allocate " CPL_FRMT_GUIB " bytes", __func__,
+                     static_cast<GUIntBig>(nValues * nDTSize));
+        }
+        if (!psPrivate->pOwnedData ||
+            poBand->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                             psPrivate->pOwnedData, nXSize, nYSize, eDT, 0, 0,
+                             nullptr) != CE_None)
+        {
+            VSIFreeAligned(psPrivate->pOwnedData);
+            delete psPrivate;
+            return false;
+        }
+        pData = psPrivate->pOwnedData;
+    }
+
+    // Array: fixed size list of length 1, with one child of nValues values
+    psPrivate->apChildBuffers[1] = pData;
+    psPrivate->sChild.length = static_cast<int64_t>(nValues);
+    psPrivate->sChild.n_buffers = 2;
+    psPrivate->sChild.buffers = psPrivate->apChildBuffers;
+    psPrivate->sChild.release = GDALTensorReleaseChildArray;
+    psPrivate->apsChildren[0] = &psPrivate->sChild;
+
+    out_array->length = 1;
+    out_array->n_buffers = 1;
+    out_array->buffers = psPrivate->apParentBuffers;
+    out_array->n_children = 1;
+    out_array->children = psPrivate->apsChildren;
+    out_array->private_data = psPrivate;
+    out_array->release = GDALTensorReleaseArray;
+
+    // Schema
+    auto psSchemaPrivate = new GDALTensorSchema();
+    psSchemaPrivate->osFormat = CPLSPrintf("+w:%d", static_cast<int>(nValues));
+    std::string &osMetadata = psSchemaPrivate->osMetadata;
+    const int32_t nItems = 2;
+    osMetadata.append(reinterpret_cast<const char *>(&nItems), sizeof(nItems));
+    GDALAppendArrowMetadataItem(osMetadata, "ARROW:extension:name",
+                                "arrow.fixed_shape_tensor");
+    GDALAppendArrowMetadataItem(
+        osMetadata, "ARROW:extension:metadata",
+        CPLSPrintf("{\"shape\":[%d,%d]}", nYSize, nXSize));
+
+    psSchemaPrivate->sChild.format = pszFormat;
+    psSchemaPrivate->sChild.name = "item";
+    psSchemaPrivate->sChild.release = GDALTensorReleaseChildSchema;
+    psSchemaPrivate->apsChildren[0] = &psSchemaPrivate->sChild;
+
+    out_schema->format = psSchemaPrivate->osFormat.c_str();
+    out_schema->name = "";
+    out_schema->metadata = psSchemaPrivate->osMetadata.data();
+    out_schema->n_children = 1;
+    out_schema->children = psSchemaPrivate->apsChildren;
+    out_schema->private_data = psSchemaPrivate;
+    out_schema->release = GDALTensorReleaseSchema;
+
+    return true;
+}
@@ -17,7 +17,6 @@
 #include "gdal_rat.h"
 #include "gdal_priv.h"
 
-#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -57,7 +56,7 @@ class GDALThreadLocalDatasetCache
      * instance to the corresponding per-thread dataset.
      * It should be noted as this a LRU cache, entries might get evicted when
      * its capacity is reached (64 datasets), which might be undesirable.
-     * Hence it is doubled with m_oMapReferencedDS for datasets that are in
+     * Hence it is doubled with m_aoReferencedDS for datasets that are in
      * active used by a thread.
      *
      * This cache is created as a unique_ptr, and not a standard object, for
@@ -90,6 +89,8 @@ class GDALThreadLocalDatasetCache
      * access to m_oCache since the destructor of a GDALThreadSafeDataset
      * instance needs to evict entries corresponding to itself from all
      * GDALThreadLocalDatasetCache instances.
+     * m_aoReferencedDS and m_aoReferencedDSFromBand are only accessed by the
+     * thread owning this instance, and are thus not protected by it.
      */
     std::mutex m_oMutex{};
 
@@ -108,32 +109,52 @@ class GDALThreadLocalDatasetCache
         std::shared_ptr<GDALDataset> poDS;
         CPLStringList aosTLConfigOptions;
 
+        /** Whether aosTLConfigOptions must be restored. False when
+         * RefUnderlyingDataset() did not need to modify them.
+         */
+        bool bRestoreTLConfigOptions;
+
         SharedPtrDatasetThreadLocalConfigOptionsPair(
             const std::shared_ptr<GDALDataset> &poDSIn,
-            CPLStringList &&aosTLConfigOptionsIn)
-            : poDS(poDSIn), aosTLConfigOptions(std::move(aosTLConfigOptionsIn))
+            CPLStringList &&aosTLConfigOptionsIn, bool bRestoreIn)
+            : poDS(poDSIn), aosTLConfigOptions(std::move(aosTLConfigOptionsIn)),
+              bRestoreTLConfigOptions(bRestoreIn)
         {
         }
     };
 
-    /** Maps a GDALThreadSafeDataset*
+    /** Associates a GDALThreadSafeDataset*
      * instance to the corresponding per-thread dataset. Insertion into this
-     * map is done by GDALThreadLocalDatasetCache::RefUnderlyingDataset() and
+     * vector is done by GDALThreadLocalDatasetCache::RefUnderlyingDataset() and
      * removal by UnrefUnderlyingDataset(). In most all use cases, the size of
-     * this map should be 0 or 1 (not clear if it could be more, that would
+     * this vector should be 0 or 1 (not clear if it could be more, that would
      * involve RefUnderlyingDataset() being called in nested ways by the same
      * thread, but it doesn't hurt from being robust to that potential situation)
+     * A vector is used rather than a map, so that no memory allocation occurs
+     * once it has reached its working capacity.
      */
-    std::map<const GDALThreadSafeDataset *,
-             SharedPtrDatasetThreadLocalConfigOptionsPair>
-        m_oMapReferencedDS{};
+    std::vector<std::pair<const GDALThreadSafeDataset *,
+                          SharedPtrDatasetThreadLocalConfigOptionsPair>>
+        m_aoReferencedDS{};
 
-    /** Maps a GDALRasterBand* returned by GDALThreadSafeRasterBand::RefUnderlyingDataset()
+    /** Associates a GDALRasterBand* returned by GDALThreadSafeRasterBand::RefUnderlyingDataset()
      * to the (thread-local) dataset that owns it (that is a dataset returned
-     * by RefUnderlyingDataset(). The size of his map should be 0 or 1 in
+     * by RefUnderlyingDataset(). The size of his vector should be 0 or 1 in
      * most cases.
      */
-    std::map<GDALRasterBand *, GDALDataset *> m_oMapReferencedDSFromBand{};
+    std::vector<std::pair<GDALRasterBand *, GDALDataset *>>
+        m_aoReferencedDSFromBand{};
+
+    /** Returns whether m_aoReferencedDS has an entry for poTSDS */
+    bool IsReferenced(const GDALThreadSafeDataset *poTSDS) const
+    {
+        for (const auto &oEntry : m_aoReferencedDS)
+        {
+            if (oEntry.first == poTSDS)
+                return true;
+        }
+        return false;
+    }
 
     static bool IsInDestruction()
     {
@@ -713,17 +734,26 @@ int GDALThreadSafeDataset::CloseDependentDatasets()
  */
 GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
 {
-    // Back-up thread-local config options at the time we are called
-    CPLStringList aosTLConfigOptionsBackup(CPLGetThreadLocalConfigOptions());
+    // If there were thread-local config options at the time where this
+    // instance has been created, merge them with the current ones. In the
+    // common case where there were none, there is nothing to merge or to
+    // restore, which saves string list copies on each call.
+    const bool bMergeTLConfigOptions = !m_aosThreadLocalConfigOptions.empty();
+    CPLStringList aosTLConfigOptionsBackup;
+    if (bMergeTLConfigOptions)
+    {
+        // Back-up thread-local config options at the time we are called
+        aosTLConfigOptionsBackup = CPLGetThreadLocalConfigOptions();
 
-    // Now merge the thread-local config options at the time where this
-    // instance has been created with the current ones.
-    const CPLStringList aosMerged(
-        CSLMerge(CSLDuplicate(m_aosThreadLocalConfigOptions.List()),
-                 aosTLConfigOptionsBackup.List()));
+        // Now merge the thread-local config options at the time where this
+        // instance has been created with the current ones.
+        const CPLStringList aosMerged(
+            CSLMerge(CSLDuplicate(m_aosThreadLocalConfigOptions.List()),
+                     aosTLConfigOptionsBackup.List()));
 
-    // And make that merged list active
-    CPLSetThreadLocalConfigOptions(aosMerged.List());
+        // And make that merged list active
+        CPLSetThreadLocalConfigOptions(aosMerged.List());
+    }
 
     std::shared_ptr<GDALDataset> poTLSDS;
 
@@ -741,16 +771,19 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     std::unique_lock oLock(poCache->m_oMutex);
     if (poCache->m_oCache.tryGet(this, poTLSDS))
     {
+        oLock.unlock();
+
         // If so, return it, but before returning, make sure to creates a
         // "hard" reference to the thread-local dataset, in case it would
         // get evicted from poCache->m_oCache (by other threads that would
         // access lots of datasets in between)
-        CPLAssert(!cpl::contains(poCache->m_oMapReferencedDS, this));
+        CPLAssert(!poCache->IsReferenced(this));
         auto poDSRet = poTLSDS.get();
-        poCache->m_oMapReferencedDS.insert(
-            {this, GDALThreadLocalDatasetCache::
-                       SharedPtrDatasetThreadLocalConfigOptionsPair(
-                           poTLSDS, std::move(aosTLConfigOptionsBackup))});
+        poCache->m_aoReferencedDS.emplace_back(
+            this, GDALThreadLocalDatasetCache::
+                      SharedPtrDatasetThreadLocalConfigOptionsPair(
+                          poTLSDS, std::move(aosTLConfigOptionsBackup),
+                          bMergeTLConfigOptions));
         return poDSRet;
     }
 
@@ -785,21 +818,23 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     // were valid at the beginning of this method, and return in error.
     if (!poTLSDS)
     {
-        CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
+        if (bMergeTLConfigOptions)
+            CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
         return nullptr;
     }
 
     // We have managed to get a thread-local dataset. Insert it into the
-    // LRU cache and the m_oMapReferencedDS map that holds strong references.
+    // LRU cache and the m_aoReferencedDS vector that holds strong references.
     auto poDSRet = poTLSDS.get();
-    {
-        poCache->m_oCache.insert(this, poTLSDS);
-        CPLAssert(!cpl::contains(poCache->m_oMapReferencedDS, this));
-        poCache->m_oMapReferencedDS.insert(
-            {this, GDALThreadLocalDatasetCache::
-                       SharedPtrDatasetThreadLocalConfigOptionsPair(
-                           poTLSDS, std::move(aosTLConfigOptionsBackup))});
-    }
+    poCache->m_oCache.insert(this, poTLSDS);
+    oLock.unlock();
+
+    CPLAssert(!poCache->IsReferenced(this));
+    poCache->m_aoReferencedDS.emplace_back(
+        this, GDALThreadLocalDatasetCache::
+                  SharedPtrDatasetThreadLocalConfigOptionsPair(
+                      poTLSDS, std::move(aosTLConfigOptionsBackup),
+                      bMergeTLConfigOptions));
     return poDSRet;
 }
 
@@ -821,7 +856,6 @@ void GDALThreadSafeDataset::UnrefUnderlyingDataset(
 {
     GDALThreadLocalDatasetCache *poCache = tl_poCache.get();
     CPLAssert(poCache);
-    std::unique_lock oLock(poCache->m_oMutex);
     UnrefUnderlyingDataset(poUnderlyingDataset, poCache);
 }
 
@@ -836,11 +870,21 @@ void GDALThreadSafeDataset::UnrefUnderlyingDataset(
     [[maybe_unused]] GDALDataset *poUnderlyingDataset,
     GDALThreadLocalDatasetCache *poCache) const
 {
-    auto oIter = poCache->m_oMapReferencedDS.find(this);
-    CPLAssert(oIter != poCache->m_oMapReferencedDS.end());
+    auto &aoReferencedDS = poCache->m_aoReferencedDS;
+    // Search from the end, as the most recently referenced dataset is the
+    // most likely to be unreferenced.
+    auto oIter = aoReferencedDS.end();
+    while (oIter != aoReferencedDS.begin())
+    {
+        --oIter;
+        if (oIter->first == this)
+            break;
+    }
+    CPLAssert(oIter != aoReferencedDS.end() && oIter->first == this);
     CPLAssert(oIter->second.poDS.get() == poUnderlyingDataset);
-    CPLSetThreadLocalConfigOptions(oIter->second.aosTLConfigOptions.List());
-    poCache->m_oMapReferencedDS.erase(oIter);
+    if (oIter->second.bRestoreTLConfigOptions)
+        CPLSetThreadLocalConfigOptions(oIter->second.aosTLConfigOptions.List());
+    aoReferencedDS.erase(oIter);
 }
 
 /************************************************************************/
@@ -981,15 +1025,13 @@ GDALThreadSafeRasterBand::RefUnderlyingRasterBand(bool /*bForceOpen*/) const
     }
 
     // Registers the association between the thread-local band and the
-    // thread-local dataset
+    // thread-local dataset. No locking is needed as this is only accessed
+    // by the current thread.
     {
         GDALThreadLocalDatasetCache *poCache =
             GDALThreadSafeDataset::tl_poCache.get();
         CPLAssert(poCache);
-        std::unique_lock oLock(poCache->m_oMutex);
-        CPLAssert(!cpl::contains(poCache->m_oMapReferencedDSFromBand,
-                                 poTLRasterBand));
-        poCache->m_oMapReferencedDSFromBand[poTLRasterBand] = poTLDS;
+        poCache->m_aoReferencedDSFromBand.emplace_back(poTLRasterBand, poTLDS);
     }
     // CPLDebug("GDAL", "%p->RefUnderlyingRasterBand() return %p", this, poTLRasterBand);
     return poTLRasterBand;
@@ -1010,18 +1052,26 @@ void GDALThreadSafeRasterBand::UnrefUnderlyingRasterBand(
     // CPLDebug("GDAL", "%p->UnrefUnderlyingRasterBand(%p)", this, poUnderlyingRasterBand);
 
     // Unregisters the association between the thread-local band and the
-    // thread-local dataset
+    // thread-local dataset. No locking is needed as this is only accessed
+    // by the current thread.
     {
         GDALThreadLocalDatasetCache *poCache =
             GDALThreadSafeDataset::tl_poCache.get();
         CPLAssert(poCache);
-        std::unique_lock oLock(poCache->m_oMutex);
-        auto oIter =
-            poCache->m_oMapReferencedDSFromBand.find(poUnderlyingRasterBand);
-        CPLAssert(oIter != poCache->m_oMapReferencedDSFromBand.end());
+        auto &aoReferencedDSFromBand = poCache->m_aoReferencedDSFromBand;
+        auto oIter = aoReferencedDSFromBand.end();
+        while (oIter != aoReferencedDSFromBand.begin())
+        {
+            --oIter;
+            if (oIter->first == poUnderlyingRasterBand)
+                break;
+        }
+        CPLAssert(oIter != aoReferencedDSFromBand.end() &&
+                  oIter->first == poUnderlyingRasterBand);
+        GDALDataset *poTLDS = oIter->second;
+        aoReferencedDSFromBand.erase(oIter);
 
-        m_poTSDS->UnrefUnderlyingDataset(oIter->second, poCache);
-        poCache->m_oMapReferencedDSFromBand.erase(oIter);
+        m_poTSDS->UnrefUnderlyingDataset(poTLDS, poCache);
     }
 }
 
@@ -37,6 +37,7 @@
 #include "gdal_thread_pool.h"
 #include "gdalwarper.h"
 #include "gdal_vrt.h"
+#include "memdataset.h"
 #include "vrtdataset.h"
 
 #ifdef USE_NEON_OPTIMIZATIONS
@@ -2187,6 +2188,7 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
     const int nChunkRightXOff = nChunkXOff + nChunkXSize;
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     std::vector<int> anVals(256, 0);
+    std::vector<int> anValsUInt16;
 
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
@@ -2265,9 +2267,11 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 nSrcXOff2 = nChunkRightXOff;
 
             bool bRegularProcessing = false;
-            if constexpr (!std::is_same<T, GByte>::value)
+            if constexpr (!std::is_same<T, GByte>::value &&
+                          !std::is_same<T, GUInt16>::value)
                 bRegularProcessing = true;
-            else if (poColorTable && poColorTable->GetColorEntryCount() > 256)
+            else if (std::is_same<T, GByte>::value && poColorTable &&
+                     poColorTable->GetColorEntryCount() > 256)
                 bRegularProcessing = true;
 
             if (bRegularProcessing)
@@ -2369,11 +2373,6 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 int nMaxVal = 0;
                 int iMaxInd = -1;
 
-                // The cost of this zeroing might be high. Perhaps we should
-                // just use the above generic case, and go to this one if the
-                // number of source pixels is large enough
-                std::fill(anVals.begin(), anVals.end(), 0);
-
                 for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
                 {
                     const GPtrDiff_t iTotYOff =
@@ -2401,6 +2400,65 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
                 else
                     paDstScanline[iDstPixel - nDstXOff] =
                         static_cast<T>(iMaxInd);
+
+                // Reset only the histogram entries we have used, which is
+                // cheaper than zeroing the whole histogram for small
+                // downsampling factors.
+                for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                {
+                    const GPtrDiff_t iTotYOff =
+                        static_cast<GPtrDiff_t>(iY - nSrcYOff) * nChunkXSize -
+                        nChunkXOff;
+                    for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        anVals[paSrcScanline[iX + iTotYOff]] = 0;
+                }
+            }
+            else if constexpr (std::is_same<T, GUInt16>::value)
+            {
+                // Same as above with a 65536 bins histogram, typically for
+                // classification rasters. Contrary to the Byte case, the
+                // nodata mask is used, as in the generic case.
+                if (anValsUInt16.empty())
+                    anValsUInt16.resize(65536, 0);
+
+                int nMaxVal = 0;
+                int iMaxInd = -1;
+
+                for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                {
+                    const GPtrDiff_t iTotYOff =
+                        static_cast<GPtrDiff_t>(iY - nSrcYOff) * nChunkXSize -
+                        nChunkXOff;
+                    for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                    {
+                        if (pabySrcScanlineNodataMask == nullptr ||
+                            pabySrcScanlineNodataMask[iX + iTotYOff])
+                        {
+                            const int nVal =
+                                static_cast<int>(paSrcScanline[iX + iTotYOff]);
+                            if (++anValsUInt16[nVal] > nMaxVal)
+                            {
+                                iMaxInd = nVal;
+                                nMaxVal = anValsUInt16[nVal];
+                            }
+                        }
+                    }
+                }
+
+                if (iMaxInd == -1)
+                    paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
+                else
+                    paDstScanline[iDstPixel - nDstXOff] =
+                        static_cast<T>(iMaxInd);
+
+                for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                {
+                    const GPtrDiff_t iTotYOff =
+                        static_cast<GPtrDiff_t>(iY - nSrcYOff) * nChunkXSize -
+                        nChunkXOff;
+                    for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        anValsUInt16[paSrcScanline[iX + iTotYOff]] = 0;
+                }
             }
         }
     }
@@ -2692,6 +2750,32 @@ static inline void GDALResampleConvolutionVertical_2cols(
     dfRes2 = dfVal3 + dfVal4;
 }
 
+template <class T>
+static inline void GDALResampleConvolutionVerticalWithMask_2cols(
+    const T *pChunk, const GByte *pabyMask, size_t nStride,
+    const double *padfWeights, int nSrcLineCount, double &dfRes1,
+    double &dfRes2, double &dfWeightSum1, double &dfWeightSum2)
+{
+    double dfVal1 = 0.0;
+    double dfVal2 = 0.0;
+    double dfWeight1 = 0.0;
+    double dfWeight2 = 0.0;
+    size_t j = 0;
+    for (int i = 0; i < nSrcLineCount; ++i, j += nStride)
+    {
+        const double dfW1 = padfWeights[i] * pabyMask[j];
+        const double dfW2 = padfWeights[i] * pabyMask[j + 1];
+        dfVal1 += pChunk[j] * dfW1;
+        dfVal2 += pChunk[j + 1] * dfW2;
+        dfWeight1 += dfW1;
+        dfWeight2 += dfW2;
+    }
+    dfRes1 = dfVal1;
+    dfRes2 = dfVal2;
+    dfWeightSum1 = dfWeight1;
+    dfWeightSum2 = dfWeight2;
+}
+
 #ifdef USE_SSE2
 
 #ifdef __AVX__
@@ -2931,6 +3015,39 @@ inline void GDALResampleConvolutionHorizontalWithMask<GUInt16>(
         dfWeightSum);
 }
 
+/************************************************************************/
+/*         GDALResampleConvolutionVerticalWithMask_2cols<double>        */
+/************************************************************************/
+
+template <>
+inline void GDALResampleConvolutionVerticalWithMask_2cols<double>(
+    const double *pChunk, const GByte *pabyMask, size_t nStride,
+    const double *padfWeights, int nSrcLineCount, double &dfRes1,
+    double &dfRes2, double &dfWeightSum1, double &dfWeightSum2)
+{
+    // Each lane accumulates in the same order as the scalar version, so
+    // that results are identical.
+    XMMReg2Double v_acc = XMMReg2Double::Zero();
+    XMMReg2Double v_acc_weight = XMMReg2Double::Zero();
+    size_t j = 0;
+    for (int i = 0; i < nSrcLineCount; ++i, j += nStride)
+    {
+        XMMReg2Double v_weight =
+            XMMReg2Double::Load1ValHighAndLow(padfWeights + i);
+        v_weight *= XMMReg2Double::Load2Val(pabyMask + j);
+        v_acc += XMMReg2Double::Load2Val(pChunk + j) * v_weight;
+        v_acc_weight += v_weight;
+    }
+    double adfVal[2];
+    double adfWeightSum[2];
+    v_acc.Store2Val(adfVal);
+    v_acc_weight.Store2Val(adfWeightSum);
+    dfRes1 = adfVal[0];
+    dfRes2 = adfVal[1];
+    dfWeightSum1 = adfWeightSum[0];
+    dfWeightSum2 = adfWeightSum[1];
+}
+
 /************************************************************************/
 /*              GDALResampleConvolutionHorizontal_3rows_SSE2<T>         */
 /************************************************************************/
@@ -3675,8 +3792,65 @@ static CPLErr GDALResampleChunk_ConvolutionT(
         }
         else
         {
-            for (int iFilteredPixelOff = 0; iFilteredPixelOff < nDstXSize;
-                 ++iFilteredPixelOff)
+            int iFilteredPixelOff = 0;  // Used after for.
+            // Process two columns at a time, and then check the validity
+            // criterion of kernels with negative weights.
+            for (; iFilteredPixelOff < nDstXSize - 1; iFilteredPixelOff += 2)
+            {
+                const size_t j = (nSrcLineStart - nChunkYOff) *
+                                     static_cast<size_t>(nDstXSize) +
+                                 iFilteredPixelOff;
+                double adfVal[2];
+                double adfWeightSum[2];
+                GDALResampleConvolutionVerticalWithMask_2cols(
+                    padfHorizontalFiltered + j,
+                    pabyChunkNodataMaskHorizontalFiltered + j, nDstXSize,
+                    padfWeights, nSrcLineCount, adfVal[0], adfVal[1],
+                    adfWeightSum[0], adfWeightSum[1]);
+                for (int k = 0; k < 2; ++k)
+                {
+                    if (bKernelWithNegativeWeights)
+                    {
+                        int nConsecutiveValid = 0;
+                        int nMaxConsecutiveValid = 0;
+                        size_t jk = j + k;
+                        for (int i = 0; i < nSrcLineCount; ++i, jk += nDstXSize)
+                        {
+                            if (pabyChunkNodataMaskHorizontalFiltered[jk])
+                            {
+                                nConsecutiveValid++;
+                            }
+                            else if (nConsecutiveValid)
+                            {
+                                nMaxConsecutiveValid = std::max(
+                                    nMaxConsecutiveValid, nConsecutiveValid);
+                                nConsecutiveValid = 0;
+                            }
+                        }
+                        nMaxConsecutiveValid =
+                            std::max(nMaxConsecutiveValid, nConsecutiveValid);
+                        if (nMaxConsecutiveValid < nSrcLineCount / 2)
+                        {
+                            pafDstScanline[iFilteredPixelOff + k] =
+                                static_cast<Twork>(dfNoDataValue);
+                            continue;
+                        }
+                    }
+                    if (adfWeightSum[k] > 0.0)
+                    {
+                        pafDstScanline[iFilteredPixelOff + k] =
+                            replaceValIfNodata(static_cast<Twork>(
+                                adfVal[k] / adfWeightSum[k]));
+                    }
+                    else
+                    {
+                        pafDstScanline[iFilteredPixelOff + k] =
+                            static_cast<Twork>(dfNoDataValue);
+                    }
+                }
+            }
+
+            for (; iFilteredPixelOff < nDstXSize; ++iFilteredPixelOff)
             {
                 double dfVal = 0.0;
                 dfWeightSum = 0.0;
@@ -4772,9 +4946,11 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     void *pChunk = nullptr;
 
     const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const GDALThreadReservation oThreadReservation(
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads))));
+    const int nThreads = oThreadReservation.GetThreadCount();
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
     auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
@@ -5108,6 +5284,518 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     return eErr;
 }
 
+/************************************************************************/
+/*              GDALRegenerateOverviewsMultiBandStreaming()             */
+/************************************************************************/
+
+// Computes all the overview levels in a single pass over the source bands.
+// Level 0 is computed from the source bands, as in the general case. The
+// pixels of the other levels are computed from a rolling window holding the
+// last computed lines of the previous level, instead of reading them back
+// from the overview bands. Chunks are processed from the coarsest level that
+// has enough lines available in the window of its previous level.
+//
+// Returns false, without doing anything, if the configuration is not
+// supported by this mode. Otherwise returns true, and eErr is set.
+static bool GDALRegenerateOverviewsMultiBandStreaming(
+    int nBands, GDALRasterBand *const *papoSrcBands, int nOverviews,
+    GDALRasterBand *const *const *papapoOverviewBands,
+    const char *pszResampling, GDALResampleFunction pfnResampleFn,
+    int nKernelRadius, GDALDataType eDataType, GDALDataType eWrkDataType,
+    bool bIsMask, bool bUseNoDataMask, const std::vector<bool> &abHasNoData,
+    const std::vector<double> &adfNoDataValue, bool bPropagateNoData,
+    CPLJobQueue *poJobQueue, int nThreads, GIntBig nChunkMaxSize,
+    GIntBig nChunkMaxSizeForTempFile, double dfTotalPixelCount,
+    GDALProgressFunc pfnProgress, void *pProgressData, CPLErr &eErr)
+{
+    const int nWrkDataTypeSize =
+        std::max(1, GDALGetDataTypeSizeBytes(eWrkDataType));
+    const int nDTSize = std::max(1, GDALGetDataTypeSizeBytes(eDataType));
+    constexpr int PIXEL_MARGIN = 2;
+
+    struct OvrLevel
+    {
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        int nDstWidth = 0;
+        int nDstHeight = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        int nFullResYChunkQueried = 0;
+        int nNextDstYOff = 0;
+
+        // Last computed lines of this level, used as the source of the next
+        // level. Lines [nWindowYOff, nWindowYOff + nWindowLines[ are held.
+        std::unique_ptr<MEMDataset> poWindowDS{};
+        std::vector<GByte *> apabyWindow{};
+        int nWindowCapacity = 0;
+        int nWindowYOff = 0;
+        int nWindowLines = 0;
+    };
+
+    const int nToplevelSrcWidth = papoSrcBands[0]->GetXSize();
+    const int nToplevelSrcHeight = papoSrcBands[0]->GetYSize();
+
+    std::vector<OvrLevel> aoLevels(nOverviews);
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        auto &oLevel = aoLevels[iOverview];
+        auto poOvrBand = papapoOverviewBands[0][iOverview];
+        oLevel.nDstWidth = poOvrBand->GetXSize();
+        oLevel.nDstHeight = poOvrBand->GetYSize();
+        if (iOverview == 0)
+        {
+            oLevel.nSrcWidth = nToplevelSrcWidth;
+            oLevel.nSrcHeight = nToplevelSrcHeight;
+        }
+        else
+        {
+            // Same condition as the general case to use the previous level
+            // as the source.
+            oLevel.nSrcWidth = aoLevels[iOverview - 1].nDstWidth;
+            oLevel.nSrcHeight = aoLevels[iOverview - 1].nDstHeight;
+            if (oLevel.nSrcWidth <= oLevel.nDstWidth)
+                return false;
+        }
+        oLevel.dfXRatioDstToSrc =
+            static_cast<double>(oLevel.nSrcWidth) / oLevel.nDstWidth;
+        oLevel.dfYRatioDstToSrc =
+            static_cast<double>(oLevel.nSrcHeight) / oLevel.nDstHeight;
+        oLevel.nOvrFactor = std::max(
+            1, std::max(static_cast<int>(0.5 + oLevel.dfXRatioDstToSrc),
+                        static_cast<int>(0.5 + oLevel.dfYRatioDstToSrc)));
+
+        // Same chunk size computation as in the general case
+        poOvrBand->GetBlockSize(&oLevel.nDstChunkXSize, &oLevel.nDstChunkYSize);
+        const int nFullResYChunk = static_cast<int>(
+            std::min<double>(oLevel.nSrcHeight,
+                             PIXEL_MARGIN + oLevel.nDstChunkYSize *
+                                                oLevel.dfYRatioDstToSrc));
+        oLevel.nFullResYChunkQueried = static_cast<int>(std::min<int64_t>(
+            oLevel.nSrcHeight,
+            nFullResYChunk + static_cast<int64_t>(RADIUS_TO_DIAMETER) *
+                                 nKernelRadius * oLevel.nOvrFactor));
+        while (oLevel.nDstChunkXSize < oLevel.nDstWidth)
+        {
+            constexpr int INCREASE_FACTOR = 2;
+            const int nFullResXChunk = static_cast<int>(std::min<double>(
+                oLevel.nSrcWidth, PIXEL_MARGIN + INCREASE_FACTOR *
+                                                     oLevel.nDstChunkXSize *
+                                                     oLevel.dfXRatioDstToSrc));
+            const int nFullResXChunkQueried =
+                static_cast<int>(std::min<int64_t>(
+                    oLevel.nSrcWidth,
+                    nFullResXChunk + static_cast<int64_t>(RADIUS_TO_DIAMETER) *
+                                         nKernelRadius * oLevel.nOvrFactor));
+            if (nBands > nChunkMaxSize / nFullResXChunkQueried /
+                             oLevel.nFullResYChunkQueried / nWrkDataTypeSize)
+            {
+                break;
+            }
+            oLevel.nDstChunkXSize *= INCREASE_FACTOR;
+        }
+        oLevel.nDstChunkXSize =
+            std::min(oLevel.nDstChunkXSize, oLevel.nDstWidth);
+
+        const int nFullResXChunk = static_cast<int>(std::min<double>(
+            oLevel.nSrcWidth,
+            PIXEL_MARGIN + oLevel.nDstChunkXSize * oLevel.dfXRatioDstToSrc));
+        const int nFullResXChunkQueried = static_cast<int>(std::min<int64_t>(
+            oLevel.nSrcWidth,
+            nFullResXChunk + static_cast<int64_t>(RADIUS_TO_DIAMETER) *
+                                 nKernelRadius * oLevel.nOvrFactor));
+        // Cases that require a temporary dataset in the general case are
+        // not handled.
+        if (nBands > std::numeric_limits<int64_t>::max() /
+                         nFullResXChunkQueried / oLevel.nFullResYChunkQueried /
+                         nWrkDataTypeSize ||
+            static_cast<GIntBig>(nFullResXChunkQueried) *
+                    oLevel.nFullResYChunkQueried * nBands * nWrkDataTypeSize >
+                nChunkMaxSizeForTempFile)
+        {
+            return false;
+        }
+
+        // The mask of the previous level must be computable from its pixel
+        // values.
+        if (bUseNoDataMask && !bIsMask && iOverview + 1 < nOverviews)
+        {
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                const int nMaskFlags =
+                    papapoOverviewBands[iBand][iOverview]->GetMaskFlags();
+                if (nMaskFlags != GMF_ALL_VALID && nMaskFlags != GMF_NODATA)
+                    return false;
+            }
+        }
+    }
+
+    // Allocate the windows
+    for (int iOverview = 0; iOverview + 1 < nOverviews; ++iOverview)
+    {
+        auto &oLevel = aoLevels[iOverview];
+        oLevel.nWindowCapacity =
+            std::min(oLevel.nDstHeight,
+                     aoLevels[iOverview + 1].nFullResYChunkQueried +
+                         oLevel.nDstChunkYSize);
+        oLevel.poWindowDS.reset(MEMDataset::Create(
+            "", oLevel.nDstWidth, oLevel.nWindowCapacity, 0, eDataType,
+            nullptr));
+        if (!oLevel.poWindowDS)
+        {
+            eErr = CE_Failure;
+            return true;
+        }
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            GByte *pabyData = static_cast<GByte *>(
+                VSI_MALLOC3_VERBOSE(oLevel.nDstWidth, oLevel.nWindowCapacity,
+                                    nDTSize));
+            if (!pabyData)
+            {
+                eErr = CE_Failure;
+                return true;
+            }
+            oLevel.apabyWindow.push_back(pabyData);
+            oLevel.poWindowDS->AddMEMBand(MEMCreateRasterBandEx(
+                oLevel.poWindowDS.get(), iBand + 1, pabyData, eDataType, 0, 0,
+                /* bAssumeOwnership = */ true));
+            auto poOvrBand = papapoOverviewBands[iBand][iOverview];
+            if (bUseNoDataMask && !bIsMask &&
+                poOvrBand->GetMaskFlags() == GMF_NODATA)
+            {
+                oLevel.poWindowDS->GetRasterBand(iBand + 1)->SetNoDataValue(
+                    poOvrBand->GetNoDataValue());
+            }
+        }
+    }
+
+    CPLDebug("GDAL", "Regenerating %d overview levels in a single pass",
+             nOverviews);
+
+    // Computes the source lines needed for the destination lines starting at
+    // nDstYOff, in the same way as the general case.
+    const auto GetSourceLines =
+        [nKernelRadius](const OvrLevel &oLevel, int nDstYOff, int &nDstYCount,
+                        int &nChunkYOffQueried, int &nChunkYSizeQueried)
+    {
+        nDstYCount = std::min(oLevel.nDstChunkYSize,
+                              oLevel.nDstHeight - nDstYOff);
+        const int nChunkYOff =
+            static_cast<int>(nDstYOff * oLevel.dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * oLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > oLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstHeight)
+            nChunkYOff2 = oLevel.nSrcHeight;
+        const int nYCount = nChunkYOff2 - nChunkYOff;
+
+        nChunkYOffQueried = nChunkYOff - nKernelRadius * oLevel.nOvrFactor;
+        nChunkYSizeQueried =
+            nYCount + RADIUS_TO_DIAMETER * nKernelRadius * oLevel.nOvrFactor;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > oLevel.nSrcHeight)
+            nChunkYSizeQueried = oLevel.nSrcHeight - nChunkYOffQueried;
+    };
+
+    struct OvrStreamingJob
+    {
+        GDALResampleFunction pfnResampleFn = nullptr;
+        GDALOverviewResampleArgs args{};
+        std::unique_ptr<void, VSIFreeReleaser> pChunk{};
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyChunkNoDataMask{};
+        int iBand = 0;
+
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+
+        ~OvrStreamingJob()
+        {
+            CPLFree(pDstBuffer);
+        }
+    };
+
+    const auto JobResampleFunc = [](void *pData)
+    {
+        auto poJob = static_cast<OvrStreamingJob *>(pData);
+        poJob->eErr =
+            poJob->pfnResampleFn(poJob->args, poJob->pChunk.get(),
+                                 &(poJob->pDstBuffer),
+                                 &(poJob->eDstBufferDataType));
+    };
+
+    const int nMaxJobs = std::max(1, nThreads) * nBands;
+    double dfCurPixelCount = 0;
+    eErr = CE_None;
+    while (eErr == CE_None)
+    {
+        // Find the coarsest level that can make progress.
+        int iOverview = nOverviews - 1;
+        int nDstYCount = 0;
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        for (; iOverview >= 0; --iOverview)
+        {
+            const auto &oLevel = aoLevels[iOverview];
+            if (oLevel.nNextDstYOff >= oLevel.nDstHeight)
+                continue;
+            GetSourceLines(oLevel, oLevel.nNextDstYOff, nDstYCount,
+                           nChunkYOffQueried, nChunkYSizeQueried);
+            if (iOverview == 0)
+                break;
+            const auto &oSrcLevel = aoLevels[iOverview - 1];
+            if (oSrcLevel.nWindowYOff + oSrcLevel.nWindowLines >=
+                nChunkYOffQueried + nChunkYSizeQueried)
+            {
+                CPLAssert(nChunkYOffQueried >= oSrcLevel.nWindowYOff);
+                break;
+            }
+        }
+        if (iOverview < 0)
+            break;  // All levels are completed
+
+        auto &oLevel = aoLevels[iOverview];
+        const int nDstYOff = oLevel.nNextDstYOff;
+
+        // Make room in our window by discarding the lines that the next
+        // level will not need anymore.
+        if (oLevel.poWindowDS)
+        {
+            const auto &oNextLevel = aoLevels[iOverview + 1];
+            int nNeededYOff = oLevel.nDstHeight;
+            if (oNextLevel.nNextDstYOff < oNextLevel.nDstHeight)
+            {
+                int nNextDstYCount = 0;
+                int nNextChunkYSizeQueried = 0;
+                GetSourceLines(oNextLevel, oNextLevel.nNextDstYOff,
+                               nNextDstYCount, nNeededYOff,
+                               nNextChunkYSizeQueried);
+            }
+            const int nDiscarded = std::min(
+                oLevel.nWindowLines,
+                std::max(0, nNeededYOff - oLevel.nWindowYOff));
+            if (nDiscarded > 0)
+            {
+                const size_t nLineSize =
+                    static_cast<size_t>(oLevel.nDstWidth) * nDTSize;
+                for (GByte *pabyWindow : oLevel.apabyWindow)
+                {
+                    memmove(pabyWindow, pabyWindow + nDiscarded * nLineSize,
+                            (oLevel.nWindowLines - nDiscarded) * nLineSize);
+                }
+                oLevel.nWindowYOff += nDiscarded;
+                oLevel.nWindowLines -= nDiscarded;
+            }
+            if (oLevel.nWindowLines == 0)
+                oLevel.nWindowYOff = nDstYOff;
+            CPLAssert(oLevel.nWindowYOff + oLevel.nWindowLines == nDstYOff);
+            if (oLevel.nWindowLines + nDstYCount > oLevel.nWindowCapacity)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALRegenerateOverviewsMultiBand(): window of "
+                         "overview level %d is too small",
+                         iOverview);
+                eErr = CE_Failure;
+                break;
+            }
+        }
+
+        GDALDataset *poSrcWindowDS =
+            iOverview > 0 ? aoLevels[iOverview - 1].poWindowDS.get() : nullptr;
+        const int nSrcWindowYOff =
+            iOverview > 0 ? aoLevels[iOverview - 1].nWindowYOff : 0;
+
+        std::vector<std::unique_ptr<OvrStreamingJob>> apoJobs;
+        const auto FinalizeJobs = [&apoJobs, &oLevel, poJobQueue,
+                                   papapoOverviewBands, iOverview]()
+        {
+            if (poJobQueue)
+                poJobQueue->WaitCompletion();
+            CPLErr l_eErr = CE_None;
+            for (const auto &poJob : apoJobs)
+            {
+                l_eErr = poJob->eErr;
+                if (l_eErr != CE_None)
+                    break;
+                const auto &args = poJob->args;
+                const int nXCount = args.nDstXOff2 - args.nDstXOff;
+                const int nYCount = args.nDstYOff2 - args.nDstYOff;
+                l_eErr = papapoOverviewBands[poJob->iBand][iOverview]->RasterIO(
+                    GF_Write, args.nDstXOff, args.nDstYOff, nXCount, nYCount,
+                    poJob->pDstBuffer, nXCount, nYCount,
+                    poJob->eDstBufferDataType, 0, 0, nullptr);
+                if (l_eErr == CE_None && oLevel.poWindowDS)
+                {
+                    l_eErr = oLevel.poWindowDS->GetRasterBand(poJob->iBand + 1)
+                                 ->RasterIO(GF_Write, args.nDstXOff,
+                                            args.nDstYOff - oLevel.nWindowYOff,
+                                            nXCount, nYCount, poJob->pDstBuffer,
+                                            nXCount, nYCount,
+                                            poJob->eDstBufferDataType, 0, 0,
+                                            nullptr);
+                }
+                if (l_eErr != CE_None)
+                    break;
+            }
+            apoJobs.clear();
+            return l_eErr;
+        };
+
+        for (int nDstXOff = 0; nDstXOff < oLevel.nDstWidth && eErr == CE_None;
+             nDstXOff += oLevel.nDstChunkXSize)
+        {
+            const int nDstXCount =
+                std::min(oLevel.nDstChunkXSize, oLevel.nDstWidth - nDstXOff);
+            dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
+
+            const int nChunkXOff =
+                static_cast<int>(nDstXOff * oLevel.dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * oLevel.dfXRatioDstToSrc));
+            if (nChunkXOff2 > oLevel.nSrcWidth ||
+                nDstXOff + nDstXCount == oLevel.nDstWidth)
+                nChunkXOff2 = oLevel.nSrcWidth;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+
+            int nChunkXOffQueried =
+                nChunkXOff - nKernelRadius * oLevel.nOvrFactor;
+            int nChunkXSizeQueried = nXCount + RADIUS_TO_DIAMETER *
+                                                   nKernelRadius *
+                                                   oLevel.nOvrFactor;
+            if (nChunkXOffQueried < 0)
+            {
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
+            }
+            if (nChunkXSizeQueried + nChunkXOffQueried > oLevel.nSrcWidth)
+                nChunkXSizeQueried = oLevel.nSrcWidth - nChunkXOffQueried;
+
+            if (static_cast<int>(apoJobs.size()) >= nMaxJobs)
+                eErr = FinalizeJobs();
+
+            for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            {
+                auto poJob = std::make_unique<OvrStreamingJob>();
+                poJob->iBand = iBand;
+                poJob->pChunk.reset(VSI_MALLOC3_VERBOSE(
+                    nChunkXSizeQueried, nChunkYSizeQueried, nWrkDataTypeSize));
+                if (!poJob->pChunk)
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+                if (bUseNoDataMask)
+                {
+                    poJob->pabyChunkNoDataMask.reset(
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            nChunkXSizeQueried, nChunkYSizeQueried)));
+                    if (!poJob->pabyChunkNoDataMask)
+                    {
+                        eErr = CE_Failure;
+                        break;
+                    }
+                }
+
+                GDALRasterBand *poSrcBand =
+                    poSrcWindowDS ? poSrcWindowDS->GetRasterBand(iBand + 1)
+                                  : papoSrcBands[iBand];
+                const int nSrcYOff = nChunkYOffQueried - nSrcWindowYOff;
+                eErr = poSrcBand->RasterIO(
+                    GF_Read, nChunkXOffQueried, nSrcYOff, nChunkXSizeQueried,
+                    nChunkYSizeQueried, poJob->pChunk.get(), nChunkXSizeQueried,
+                    nChunkYSizeQueried, eWrkDataType, 0, 0, nullptr);
+                if (bUseNoDataMask && eErr == CE_None)
+                {
+                    auto poMaskBand = (bIsMask || poSrcBand->IsMaskBand())
+                                          ? poSrcBand
+                                          : poSrcBand->GetMaskBand();
+                    eErr = poMaskBand->RasterIO(
+                        GF_Read, nChunkXOffQueried, nSrcYOff,
+                        nChunkXSizeQueried, nChunkYSizeQueried,
+                        poJob->pabyChunkNoDataMask.get(), nChunkXSizeQueried,
+                        nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+                }
+                if (eErr != CE_None)
+                    break;
+
+                auto poDstBand = papapoOverviewBands[iBand][iOverview];
+                poJob->pfnResampleFn = pfnResampleFn;
+                poJob->args.eOvrDataType = poDstBand->GetRasterDataType();
+                poJob->args.nOvrXSize = poDstBand->GetXSize();
+                poJob->args.nOvrYSize = poDstBand->GetYSize();
+                const char *pszNBITS =
+                    poDstBand->GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
+                poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
+                poJob->args.dfXRatioDstToSrc = oLevel.dfXRatioDstToSrc;
+                poJob->args.dfYRatioDstToSrc = oLevel.dfYRatioDstToSrc;
+                poJob->args.eWrkDataType = eWrkDataType;
+                poJob->args.pabyChunkNodataMask =
+                    poJob->pabyChunkNoDataMask.get();
+                poJob->args.nChunkXOff = nChunkXOffQueried;
+                poJob->args.nChunkXSize = nChunkXSizeQueried;
+                poJob->args.nChunkYOff = nChunkYOffQueried;
+                poJob->args.nChunkYSize = nChunkYSizeQueried;
+                poJob->args.nDstXOff = nDstXOff;
+                poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
+                poJob->args.nDstYOff = nDstYOff;
+                poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
+                poJob->args.pszResampling = pszResampling;
+                poJob->args.bHasNoData = abHasNoData[iBand];
+                poJob->args.dfNoDataValue = adfNoDataValue[iBand];
+                poJob->args.eSrcDataType = eDataType;
+                poJob->args.bPropagateNoData = bPropagateNoData;
+
+                if (poJobQueue)
+                    poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                else
+                    JobResampleFunc(poJob.get());
+                apoJobs.emplace_back(std::move(poJob));
+            }
+        }
+
+        const CPLErr eFinalizeErr = FinalizeJobs();
+        if (eErr == CE_None)
+            eErr = eFinalizeErr;
+        if (eErr != CE_None)
+            break;
+
+        oLevel.nNextDstYOff += nDstYCount;
+        if (oLevel.poWindowDS)
+            oLevel.nWindowLines += nDstYCount;
+
+        if (!pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    // Flush the data to overviews.
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            if (papapoOverviewBands[iBand][iOverview]->FlushCache(false) !=
+                CE_None)
+                eErr = CE_Failure;
+        }
+    }
+
+    if (eErr == CE_None)
+        pfnProgress(1.0, nullptr, pProgressData);
+
+    return true;
+}
+
 /************************************************************************/
 /*            GDALRegenerateOverviewsMultiBand()                        */
 /************************************************************************/
@@ -5299,9 +5987,11 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         CPLTestBool(CPLGetConfigOption("GDAL_OVR_PROPAGATE_NODATA", "NO"));
 
     const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const GDALThreadReservation oThreadReservation(
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads))));
+    const int nThreads = oThreadReservation.GetThreadCount();
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
     auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
@@ -5340,6 +6030,30 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         return 100 * 1024 * 1024;
     }();
 
+    // Single pass mode, where each level is computed from the lines of the
+    // previous level still in RAM.
+    if (nOverviews >= 2 &&
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_STREAMING", "NO")) &&
+        CSLFetchNameValue(papszOptions, "XOFF") == nullptr &&
+        CSLFetchNameValue(papszOptions, "YOFF") == nullptr &&
+        CSLFetchNameValue(papszOptions, "XSIZE") == nullptr &&
+        CSLFetchNameValue(papszOptions, "YSIZE") == nullptr)
+    {
+        CPLErr eStreamingErr = CE_None;
+        if (GDALRegenerateOverviewsMultiBandStreaming(
+                nBands, papoSrcBands, nOverviews, papapoOverviewBands,
+                pszResampling, pfnResampleFn, nKernelRadius, eDataType,
+                eWrkDataType, bIsMask, bUseNoDataMask, abHasNoData,
+                adfNoDataValue, bPropagateNoData, poJobQueue.get(), nThreads,
+                nChunkMaxSize, nChunkMaxSizeForTempFile, dfTotalPixelCount,
+                pfnProgress, pProgressData, eStreamingErr))
+        {
+            return eStreamingErr;
+        }
+        CPLDebug("GDAL", "GDAL_OVR_STREAMING=YES ignored for this "
+                         "configuration");
+    }
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
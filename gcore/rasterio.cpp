@@ -25,18 +25,25 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -61,6 +68,12 @@
 #include <smmintrin.h>
 #endif
 
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(__AVX2__) &&               \
+    (defined(__x86_64) || defined(_M_X64))
+#include "rasterio_avx2.h"
+#define HAVE_AVX2_DISPATCH
+#endif
+
 #ifdef __GNUC__
 #define CPL_NOINLINE __attribute__((noinline))
 #else
@@ -254,6 +267,67 @@ CPLErr GDALRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
          (nXOff == psExtraArg->dfXOff && nYOff == psExtraArg->dfYOff &&
           nXSize == psExtraArg->dfXSize && nYSize == psExtraArg->dfYSize));
 
+    /* ==================================================================== */
+    /*      When reading whole blocks of a single block column, without     */
+    /*      data type conversion, into a buffer that has the layout of a    */
+    /*      block, blocks not already cached may be decoded by IReadBlock() */
+    /*      directly into the user buffer.                                  */
+    /* ==================================================================== */
+    if (eRWFlag == GF_Read && eBufType == eDataType &&
+        nPixelSpace == nBufDataSize &&
+        nLineSpace == nPixelSpace * nBlockXSize && nXSize == nBlockXSize &&
+        nBufXSize == nXSize && nBufYSize == nYSize && nYSize > 0 &&
+        (nXOff % nBlockXSize) == 0 && (nYOff % nBlockYSize) == 0 &&
+        (nYSize % nBlockYSize) == 0 && bUseIntegerRequestCoords &&
+        !m_bBlocksPrefetched && InitBlockInfo() &&
+        CPLTestBool(CPLGetConfigOption("GDAL_RASTERIO_DIRECT_DECODE", "NO")))
+    {
+        const int nXBlockOff = nXOff / nBlockXSize;
+        const int nYBlockStart = nYOff / nBlockYSize;
+        const int nYBlockCount = nYSize / nBlockYSize;
+        const GPtrDiff_t nBlockBytes = static_cast<GPtrDiff_t>(nLineSpace) *
+                                       nBlockYSize;
+        for (int iY = 0; iY < nYBlockCount; ++iY)
+        {
+            const int nYBlockOff = nYBlockStart + iY;
+            GByte *pabyDst = static_cast<GByte *>(pData) + iY * nBlockBytes;
+
+            // A cached block may be more recent than what is on storage.
+            poBlock = TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+            if (poBlock)
+            {
+                memcpy(pabyDst, poBlock->GetDataRef(),
+                       static_cast<size_t>(nBlockBytes));
+                poBlock->DropLock();
+                poBlock = nullptr;
+            }
+            else
+            {
+                GDALRasterBlock::RecordBlockRequest(this, false);
+                const GUInt32 nErrorCounter = CPLGetErrorCounter();
+                if (IReadBlock(nXBlockOff, nYBlockOff, pabyDst) != CE_None)
+                {
+                    ReportError(
+                        CE_Failure, CPLE_AppDefined,
+                        "IReadBlock failed at X offset %d, Y offset %d%s",
+                        nXBlockOff, nYBlockOff,
+                        (nErrorCounter != CPLGetErrorCounter())
+                            ? CPLSPrintf(": %s", CPLGetLastErrorMsg())
+                            : "");
+                    return CE_Failure;
+                }
+            }
+
+            if (psExtraArg->pfnProgress != nullptr &&
+                !psExtraArg->pfnProgress(1.0 * (iY + 1) / nYBlockCount, "",
+                                         psExtraArg->pProgressData))
+            {
+                return CE_Failure;
+            }
+        }
+        return CE_None;
+    }
+
     /* ==================================================================== */
     /*      A common case is the data requested with the destination        */
     /*      is packed, and the block width is the raster width.             */
@@ -1066,8 +1140,7 @@ CPLErr GDALRasterBand::RasterIOResampled(
         nDestYOffVirtual = static_cast<int>(dfDestYOff + 0.5);
     }
 
-    // Create a MEM dataset that wraps the output buffer.
-    GDALDataset *poMEMDS;
+    // Use a temporary buffer of the band data type if needed.
     void *pTempBuffer = nullptr;
     GSpacing nPSMem = nPixelSpace;
     GSpacing nLSMem = nLineSpace;
@@ -1085,26 +1158,27 @@ CPLErr GDALRasterBand::RasterIOResampled(
         eDTMem = eDataType;
     }
 
-    poMEMDS =
-        MEMDataset::Create("", nDestXOffVirtual + nBufXSize,
-                           nDestYOffVirtual + nBufYSize, 0, eDTMem, nullptr);
-    GByte *pabyData = static_cast<GByte *>(pDataMem) -
-                      nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
-    GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
-        poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
-    poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
-
     const char *pszNBITS = GetMetadataItem("NBITS", "IMAGE_STRUCTURE");
     const int nNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-    if (pszNBITS)
-        GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
-            "NBITS", pszNBITS, "IMAGE_STRUCTURE");
 
     CPLErr eErr = CE_None;
 
     // Do the resampling.
     if (bUseWarp)
     {
+        // Create a MEM dataset that wraps the output buffer.
+        GDALDataset *poMEMDS = MEMDataset::Create(
+            "", nDestXOffVirtual + nBufXSize, nDestYOffVirtual + nBufYSize, 0,
+            eDTMem, nullptr);
+        GByte *pabyData = static_cast<GByte *>(pDataMem) -
+                          nPSMem * nDestXOffVirtual - nLSMem * nDestYOffVirtual;
+        GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+            poMEMDS, 1, pabyData, eDTMem, nPSMem, nLSMem, false);
+        poMEMDS->SetBand(1, GDALRasterBand::FromHandle(hMEMBand));
+        if (pszNBITS)
+            GDALRasterBand::FromHandle(hMEMBand)->SetMetadataItem(
+                "NBITS", pszNBITS, "IMAGE_STRUCTURE");
+
         int bHasNoData = FALSE;
         double dfNoDataValue = GetNoDataValue(&bHasNoData);
 
@@ -1216,6 +1290,7 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
         if (hVRTDS)
             GDALClose(hVRTDS);
+        GDALClose(poMEMDS);
     }
     else
     {
@@ -1289,34 +1364,99 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk =
-            VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
-                                nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = GetMaskBand();
         int l_nMaskFlags = GetMaskFlags();
 
         bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
-        {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
-        {
-            GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
-            VSIFree(pTempBuffer);
-            return CE_Failure;
-        }
 
         const int nTotalBlocks = DIV_ROUND_UP(nBufXSize, nDstBlockXSize) *
                                  DIV_ROUND_UP(nBufYSize, nDstBlockYSize);
         int nBlocksDone = 0;
 
+        // Source chunks are read by the calling thread, as RasterIO() is not
+        // thread-safe, but they are resampled by worker threads when
+        // GDAL_NUM_THREADS is greater than 1.
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreadsWanted = std::clamp(
+            std::min(EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                   : atoi(pszThreads),
+                     nTotalBlocks),
+            1, 1024);
+        GDALThreadReservation oThreadReservation(nThreadsWanted);
+        const int nThreads = oThreadReservation.GetThreadCount();
+        CPLWorkerThreadPool *poPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+        std::atomic<bool> bJobFailed = false;
+        CPLErrorAccumulator oErrorAccumulator;
+
+        GDALColorTable *poColorTable = GetColorTable();
+        const auto Resample =
+            [this, pDataMem, nPSMem, nLSMem, eDTMem, nNBITS, nBufXSize,
+             nBufYSize, nDestXOffVirtual, nDestYOffVirtual, dfXRatioDstToSrc,
+             dfYRatioDstToSrc, dfXOff, dfYOff, nXOff, nYOff, bHasXOffVirtual,
+             bHasYOffVirtual, eWrkDataType, pszResampling, bHasNoData,
+             dfNoDataValue, poColorTable, pfnResampleFunc](
+                const void *pChunk, const GByte *pabyChunkNoDataMask,
+                int nChunkXOffQueried, int nChunkYOffQueried,
+                int nChunkXSizeQueried, int nChunkYSizeQueried, int nDstXOff,
+                int nDstYOff, int nDstXCount, int nDstYCount)
+        {
+            void *pDstBuffer = nullptr;
+            GDALDataType eDstBufferDataType = GDT_Unknown;
+            GDALOverviewResampleArgs args;
+            args.eSrcDataType = eDataType;
+            args.eOvrDataType = eDTMem;
+            args.nOvrXSize = nDestXOffVirtual + nBufXSize;
+            args.nOvrYSize = nDestYOffVirtual + nBufYSize;
+            args.nOvrNBITS = nNBITS;
+            args.dfXRatioDstToSrc = dfXRatioDstToSrc;
+            args.dfYRatioDstToSrc = dfYRatioDstToSrc;
+            args.dfSrcXDelta = dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
+            args.dfSrcYDelta = dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
+            args.eWrkDataType = eWrkDataType;
+            args.pabyChunkNodataMask = pabyChunkNoDataMask;
+            args.nChunkXOff = nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
+            args.nChunkXSize = nChunkXSizeQueried;
+            args.nChunkYOff = nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
+            args.nChunkYSize = nChunkYSizeQueried;
+            args.nDstXOff = nDstXOff + nDestXOffVirtual;
+            args.nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
+            args.nDstYOff = nDstYOff + nDestYOffVirtual;
+            args.nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
+            args.pszResampling = pszResampling;
+            args.bHasNoData = bHasNoData;
+            args.dfNoDataValue = dfNoDataValue;
+            args.poColorTable = poColorTable;
+            args.bPropagateNoData = false;
+            CPLErr eResampleErr = pfnResampleFunc(
+                args, pChunk, &pDstBuffer, &eDstBufferDataType);
+            if (eResampleErr == CE_None)
+            {
+                // Write the resampled chunk directly in the output buffer
+                const int nDstDTSize =
+                    GDALGetDataTypeSizeBytes(eDstBufferDataType);
+                for (int j = 0; j < nDstYCount; j++)
+                {
+                    GDALCopyWords64(static_cast<const GByte *>(pDstBuffer) +
+                                        static_cast<size_t>(j) * nDstXCount *
+                                            nDstDTSize,
+                                    eDstBufferDataType, nDstDTSize,
+                                    static_cast<GByte *>(pDataMem) +
+                                        nLSMem * (j + nDstYOff) +
+                                        nDstXOff * nPSMem,
+                                    eDTMem, static_cast<int>(nPSMem),
+                                    nDstXCount);
+                }
+            }
+            CPLFree(pDstBuffer);
+            return eResampleErr;
+        };
+
+        // Buffers are re-allocated only when they are still used by a job
+        std::shared_ptr<void> pChunk;
+        std::shared_ptr<GByte> pabyChunkNoDataMask;
+
         int nDstYOff;
         for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
              nDstYOff += nDstBlockYSize)
@@ -1382,11 +1522,43 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
                 CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
 
+                // Limit the number of chunks waiting to be resampled
+                if (poQueue)
+                    poQueue->WaitCompletion(2 * nThreads);
+                if (bJobFailed)
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+
+                if (!pChunk || pChunk.use_count() > 1)
+                {
+                    pChunk.reset(VSI_MALLOC3_VERBOSE(
+                                     GDALGetDataTypeSizeBytes(eWrkDataType),
+                                     nFullResXSizeQueried,
+                                     nFullResYSizeQueried),
+                                 VSIFree);
+                }
+                if (bUseNoDataMask && (!pabyChunkNoDataMask ||
+                                       pabyChunkNoDataMask.use_count() > 1))
+                {
+                    pabyChunkNoDataMask.reset(
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            nFullResXSizeQueried, nFullResYSizeQueried)),
+                        VSIFree);
+                }
+                if (!pChunk || (bUseNoDataMask && !pabyChunkNoDataMask))
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+
                 // Read the source buffers.
                 eErr = RasterIO(GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                                nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
                                 nChunkXSizeQueried, nChunkYSizeQueried,
-                                eWrkDataType, 0, 0, nullptr);
+                                pChunk.get(), nChunkXSizeQueried,
+                                nChunkYSizeQueried, eWrkDataType, 0, 0,
+                                nullptr);
 
                 bool bSkipResample = false;
                 bool bNoDataMaskFullyOpaque = false;
@@ -1395,16 +1567,17 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     eErr = poMaskBand->RasterIO(
                         GF_Read, nChunkXOffQueried, nChunkYOffQueried,
                         nChunkXSizeQueried, nChunkYSizeQueried,
-                        pabyChunkNoDataMask, nChunkXSizeQueried,
+                        pabyChunkNoDataMask.get(), nChunkXSizeQueried,
                         nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
 
                     /* Optimizations if mask if fully opaque or transparent */
                     int nPixels = nChunkXSizeQueried * nChunkYSizeQueried;
-                    GByte bVal = pabyChunkNoDataMask[0];
+                    const GByte *pabyMask = pabyChunkNoDataMask.get();
+                    GByte bVal = pabyMask[0];
                     int i = 1;
                     for (; i < nPixels; i++)
                     {
-                        if (pabyChunkNoDataMask[i] != bVal)
+                        if (pabyMask[i] != bVal)
                             break;
                     }
                     if (i == nPixels)
@@ -1432,52 +1605,43 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
                 if (!bSkipResample && eErr == CE_None)
                 {
-                    const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
-                    GDALOverviewResampleArgs args;
-                    args.eSrcDataType = eDataType;
-                    args.eOvrDataType = poMEMBand->GetRasterDataType();
-                    args.nOvrXSize = poMEMBand->GetXSize();
-                    args.nOvrYSize = poMEMBand->GetYSize();
-                    args.nOvrNBITS = nNBITS;
-                    args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    args.dfSrcXDelta =
-                        dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
-                    args.dfSrcYDelta =
-                        dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
-                    args.eWrkDataType = eWrkDataType;
-                    args.pabyChunkNodataMask =
-                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask;
-                    args.nChunkXOff =
-                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
-                    args.nChunkXSize = nChunkXSizeQueried;
-                    args.nChunkYOff =
-                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
-                    args.nChunkYSize = nChunkYSizeQueried;
-                    args.nDstXOff = nDstXOff + nDestXOffVirtual;
-                    args.nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
-                    args.nDstYOff = nDstYOff + nDestYOffVirtual;
-                    args.nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
-                    args.pszResampling = pszResampling;
-                    args.bHasNoData = bHasNoData;
-                    args.dfNoDataValue = dfNoDataValue;
-                    args.poColorTable = GetColorTable();
-                    args.bPropagateNoData = bPropagateNoData;
-                    eErr = pfnResampleFunc(args, pChunk, &pDstBuffer,
-                                           &eDstBufferDataType);
-                    if (eErr == CE_None)
+                    std::shared_ptr<GByte> pabyMaskForJob;
+                    if (!bNoDataMaskFullyOpaque)
+                        pabyMaskForJob = pabyChunkNoDataMask;
+                    if (poQueue)
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        const auto job =
+                            [&Resample, &bJobFailed, &oErrorAccumulator,
+                             pChunk, pabyMaskForJob, nChunkXOffQueried,
+                             nChunkYOffQueried, nChunkXSizeQueried,
+                             nChunkYSizeQueried, nDstXOff, nDstYOff,
+                             nDstXCount, nDstYCount]()
+                        {
+                            auto oAccumulator =
+                                oErrorAccumulator.InstallForCurrentScope();
+                            CPL_IGNORE_RET_VAL(oAccumulator);
+                            if (!bJobFailed &&
+                                Resample(pChunk.get(), pabyMaskForJob.get(),
+                                         nChunkXOffQueried, nChunkYOffQueried,
+                                         nChunkXSizeQueried,
+                                         nChunkYSizeQueried, nDstXOff,
+                                         nDstYOff, nDstXCount,
+                                         nDstYCount) != CE_None)
+                            {
+                                bJobFailed = true;
+                            }
+                        };
+                        if (!poQueue->SubmitJob(job))
+                            job();
+                    }
+                    else
+                    {
+                        eErr = Resample(pChunk.get(), pabyMaskForJob.get(),
+                                        nChunkXOffQueried, nChunkYOffQueried,
+                                        nChunkXSizeQueried, nChunkYSizeQueried,
+                                        nDstXOff, nDstYOff, nDstXCount,
+                                        nDstYCount);
                     }
-                    CPLFree(pDstBuffer);
                 }
 
                 nBlocksDone++;
@@ -1490,18 +1654,26 @@ CPLErr GDALRasterBand::RasterIOResampled(
             }
         }
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        if (poQueue)
+        {
+            bJobFailed = bJobFailed || eErr != CE_None;
+            poQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+            if (bJobFailed)
+                eErr = CE_Failure;
+        }
     }
 
     if (eBufType != eDataType)
     {
-        CPL_IGNORE_RET_VAL(poMEMDS->GetRasterBand(1)->RasterIO(
-            GF_Read, nDestXOffVirtual, nDestYOffVirtual, nBufXSize, nBufYSize,
-            pData, nBufXSize, nBufYSize, eBufType, nPixelSpace, nLineSpace,
-            nullptr));
+        for (int j = 0; j < nBufYSize; j++)
+        {
+            GDALCopyWords64(static_cast<const GByte *>(pDataMem) + j * nLSMem,
+                            eDTMem, static_cast<int>(nPSMem),
+                            static_cast<GByte *>(pData) + j * nLineSpace,
+                            eBufType, static_cast<int>(nPixelSpace), nBufXSize);
+        }
     }
-    GDALClose(poMEMDS);
     VSIFree(pTempBuffer);
 
     return eErr;
@@ -2210,12 +2382,140 @@ static void CPL_NOINLINE GDALCopyWordsT(const Tin *const CPL_RESTRICT pSrcData,
                           nWordCount);
 }
 
+#ifdef HAVE_AVX2_DISPATCH
+
+/************************************************************************/
+/*                      GDALCopyPackedWordsAVX2()                       */
+/************************************************************************/
+
+// Returns true if the packed copy could be done by the AVX2 code path,
+// which is selected at runtime.
+template <class Tin, class Tout>
+static inline bool GDALCopyPackedWordsAVX2(const Tin *, Tout *, GPtrDiff_t)
+{
+    return false;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const float *pSrcData, GByte *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const float *pSrcData, GInt16 *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const float *pSrcData, GUInt16 *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const float *pSrcData, double *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const double *pSrcData, float *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+#ifdef HAVE_F16C_AT_COMPILE_TIME
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const GFloat16 *pSrcData, float *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2() || !CPLHaveRuntimeF16C())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const GFloat16 *pSrcData, double *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2() || !CPLHaveRuntimeF16C())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const float *pSrcData, GFloat16 *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2() || !CPLHaveRuntimeF16C())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+template <>
+inline bool GDALCopyPackedWordsAVX2(const double *pSrcData, GFloat16 *pDstData,
+                                    GPtrDiff_t nWordCount)
+{
+    if (!CPLHaveRuntimeAVX2() || !CPLHaveRuntimeF16C())
+        return false;
+    GDALCopyPackedWords_AVX2(pSrcData, pDstData,
+                             static_cast<size_t>(nWordCount));
+    return true;
+}
+
+#endif  // HAVE_F16C_AT_COMPILE_TIME
+
+#endif  // HAVE_AVX2_DISPATCH
+
 template <class Tin, class Tout>
 static void inline GDALCopyWordsT_8atatime(
     const Tin *const CPL_RESTRICT pSrcData, int nSrcPixelStride,
     Tout *const CPL_RESTRICT pDstData, int nDstPixelStride,
     GPtrDiff_t nWordCount)
 {
+#ifdef HAVE_AVX2_DISPATCH
+    if (nSrcPixelStride == static_cast<int>(sizeof(Tin)) &&
+        nDstPixelStride == static_cast<int>(sizeof(Tout)) && nWordCount >= 8 &&
+        GDALCopyPackedWordsAVX2(pSrcData, pDstData, nWordCount))
+    {
+        return;
+    }
+#endif
+
     decltype(nWordCount) nDstOffset = 0;
 
     const char *const pSrcDataPtr = reinterpret_cast<const char *>(pSrcData);
@@ -3050,7 +3350,10 @@ CPL_NOINLINE void GDALCopyWordsT(const GFloat16 *const CPL_RESTRICT pSrcData,
                             nDstPixelStride, nWordCount);
 }
 
-#ifdef __F16C__
+// Without F16C at compile time, this still benefits from the runtime
+// dispatch to F16C instructions of GDALCopyWordsT_8atatime()
+#if defined(__F16C__) ||                                                       \
+    (defined(HAVE_AVX2_DISPATCH) && defined(HAVE_F16C_AT_COMPILE_TIME))
 
 template <>
 CPL_NOINLINE void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
@@ -3072,7 +3375,7 @@ CPL_NOINLINE void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
                             nDstPixelStride, nWordCount);
 }
 
-#endif  // __F16C__
+#endif  // defined(__F16C__) || ...
 
 #endif  // HAVE_SSE2
 
@@ -4436,6 +4739,134 @@ static int GDALDatasetGetBestOverviewLevel(GDALDataset *poDS, int &nXOff,
                                          psExtraArg);
 }
 
+/************************************************************************/
+/*                  MultiThreadedBlockBasedRasterIO()                   */
+/************************************************************************/
+
+// Set in jobs of MultiThreadedBlockBasedRasterIO(), so that they do not
+// split their request again.
+static thread_local bool gbInMultiThreadedBlockBasedRasterIO = false;
+
+//! @cond Doxygen_Suppress
+
+// Read a window at full resolution by splitting it into rows of blocks,
+// that are read by jobs of the global thread pool. This is opt-in through
+// the GDAL_RASTERIO_NUM_THREADS configuration option, and only done if the
+// dataset is thread-safe, or can be re-opened, in which case each job reads
+// from its own instance of the dataset.
+// bTried is set to false if the request must be processed by the caller.
+CPLErr GDALDataset::MultiThreadedBlockBasedRasterIO(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
+    int nBlockYSize, bool &bTried)
+{
+    bTried = false;
+    if (gbInMultiThreadedBlockBasedRasterIO)
+        return CE_None;
+
+    const char *pszThreads =
+        CPLGetConfigOption("GDAL_RASTERIO_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    const int nFirstBlockRow = nYOff / nBlockYSize;
+    const int nBlockRows =
+        (nYOff + nYSize - 1) / nBlockYSize - nFirstBlockRow + 1;
+    nThreads = std::min(std::min(nThreads, nBlockRows), 128);
+    if (nThreads <= 1)
+        return CE_None;
+
+    const bool bThreadSafe = IsThreadSafe(GDAL_OF_RASTER);
+    if (!bThreadSafe &&
+        (eAccess != GA_ReadOnly ||
+         !CanBeCloned(GDAL_OF_RASTER, /* bCanShareState = */ false)))
+    {
+        return CE_None;
+    }
+
+    const GDALThreadReservation oThreadReservation(nThreads);
+    nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poPool)
+        return CE_None;
+
+    // Done in this thread, as Clone() is not meant to be called concurrently
+    std::vector<std::unique_ptr<GDALDataset>> apoClones;
+    if (!bThreadSafe)
+    {
+        for (int i = 0; i < nThreads; ++i)
+        {
+            auto poClone = Clone(GDAL_OF_RASTER, /* bCanShareState = */ false);
+            if (!poClone)
+                break;
+            apoClones.push_back(std::move(poClone));
+        }
+        nThreads = static_cast<int>(apoClones.size());
+        if (nThreads <= 1)
+            return CE_None;
+    }
+
+    CPLDebug("GDAL", "BlockBasedRasterIO(): using %d threads", nThreads);
+    bTried = true;
+
+    std::atomic<int> nNextBlockRow{0};
+    std::atomic<bool> bSuccess{true};
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poPool->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        GDALDataset *poDS = bThreadSafe ? this : apoClones[i].get();
+        poJobQueue->SubmitJob(
+            [&, poDS]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                const bool bInMultiThreadedBlockBasedRasterIOBackup =
+                    gbInMultiThreadedBlockBasedRasterIO;
+                gbInMultiThreadedBlockBasedRasterIO = true;
+
+                GDALRasterIOExtraArg sExtraArg;
+                INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+                while (bSuccess)
+                {
+                    const int iBlockRow = nNextBlockRow++;
+                    if (iBlockRow >= nBlockRows)
+                        break;
+                    const GIntBig nRowStart =
+                        static_cast<GIntBig>(nFirstBlockRow + iBlockRow) *
+                        nBlockYSize;
+                    const int nChunkYOff = static_cast<int>(
+                        std::max<GIntBig>(nYOff, nRowStart));
+                    const int nChunkYSize =
+                        static_cast<int>(std::min<GIntBig>(
+                            nYOff + nYSize, nRowStart + nBlockYSize)) -
+                        nChunkYOff;
+                    if (poDS->RasterIO(GF_Read, nXOff, nChunkYOff, nXSize,
+                                       nChunkYSize,
+                                       static_cast<GByte *>(pData) +
+                                           (nChunkYOff - nYOff) * nLineSpace,
+                                       nXSize, nChunkYSize, eBufType,
+                                       nBandCount, panBandMap, nPixelSpace,
+                                       nLineSpace, nBandSpace,
+                                       &sExtraArg) != CE_None)
+                    {
+                        bSuccess = false;
+                    }
+                }
+
+                gbInMultiThreadedBlockBasedRasterIO =
+                    bInMultiThreadedBlockBasedRasterIOBackup;
+            });
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return bSuccess ? CE_None : CE_Failure;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                         BlockBasedRasterIO()                         */
 /*                                                                      */
@@ -4539,6 +4970,19 @@ CPLErr GDALDataset::BlockBasedRasterIO(
 
     if (nXSize == nBufXSize && nYSize == nBufYSize && bUseIntegerRequestCoords)
     {
+        if (eRWFlag == GF_Read &&
+            (psExtraArg->pfnProgress == nullptr ||
+             psExtraArg->pfnProgress == GDALDummyProgress))
+        {
+            bool bTried = false;
+            eErr = MultiThreadedBlockBasedRasterIO(
+                nXOff, nYOff, nXSize, nYSize, pData, eBufType, nBandCount,
+                panBandMap, nPixelSpace, nLineSpace, nBandSpace, nBlockYSize,
+                bTried);
+            if (bTried)
+                return eErr;
+        }
+
         GDALRasterIOExtraArg sDummyExtraArg;
         INIT_RASTERIO_EXTRA_ARG(sDummyExtraArg);
 
@@ -5067,6 +5511,217 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                 GDALCopyWholeRasterGetNumThreads()                   */
+/************************************************************************/
+
+static int GDALCopyWholeRasterGetNumThreads(CSLConstList papszOptions)
+{
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr));
+    if (pszNumThreads == nullptr)
+        return 1;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::clamp(nThreads, 1, 128);
+}
+
+/************************************************************************/
+/*             GDALDatasetCopyWholeRasterMultiThreaded()                */
+/************************************************************************/
+
+// Reads several swaths concurrently from a thread-safe view of the source
+// dataset, while the calling thread writes them to the destination in the
+// same order as the sequential code path.
+// Returns false, without having done anything, if the source dataset cannot
+// be read from several threads.
+static bool GDALDatasetCopyWholeRasterMultiThreaded(
+    GDALDataset *poSrcDS, GDALDataset *poDstDS, int nThreads, bool bInterleave,
+    bool bCheckHoles, int nSwathCols, int nSwathLines, GDALDataType eDT,
+    GDALProgressFunc pfnProgress, void *pProgressData, CPLErr &eErr)
+{
+    // A dataset opened in update mode may have changes not yet flushed,
+    // that clones re-opened from the same file would not see.
+    if (poSrcDS->GetAccess() != GA_ReadOnly)
+        return false;
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSSrcDS;
+    {
+        // Not being able to clone the source dataset is not an error
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poTSSrcDS.reset(GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER));
+    }
+    if (!poTSSrcDS)
+        return false;
+
+    const int nXSize = poDstDS->GetRasterXSize();
+    const int nYSize = poDstDS->GetRasterYSize();
+    const int nBandCount = poDstDS->GetRasterCount();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+
+    struct Swath
+    {
+        int nBand = 0;  // 0 means all bands (interleaved case)
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        std::vector<GByte> abyBuffer{};
+        bool bHasData = true;
+        CPLErr eErr = CE_None;
+        CPLErrorAccumulator oErrorAccumulator{};
+        bool bDone = false;
+    };
+
+    std::vector<std::unique_ptr<Swath>> apoSwaths;
+    for (int iBand = 0; iBand < (bInterleave ? 1 : nBandCount); ++iBand)
+    {
+        for (int iY = 0; iY < nYSize; iY += nSwathLines)
+        {
+            for (int iX = 0; iX < nXSize; iX += nSwathCols)
+            {
+                auto poSwath = std::make_unique<Swath>();
+                poSwath->nBand = bInterleave ? 0 : iBand + 1;
+                poSwath->nXOff = iX;
+                poSwath->nYOff = iY;
+                poSwath->nXSize = std::min(nSwathCols, nXSize - iX);
+                poSwath->nYSize = std::min(nSwathLines, nYSize - iY);
+                apoSwaths.push_back(std::move(poSwath));
+            }
+        }
+    }
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::atomic<bool> bStop = false;
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+
+    const auto ReadSwath =
+        [&poTSSrcDS, &oMutex, &oCV, &bStop, &aosThreadLocalConfigOptions,
+         nBandCount, bCheckHoles, eDT, nDTSize](Swath *poSwath)
+    {
+        CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+        if (!bStop)
+        {
+            auto oAccumulator =
+                poSwath->oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            if (bCheckHoles)
+            {
+                int nStatus = 0;
+                for (int iBand = 0; iBand < nBandCount; ++iBand)
+                {
+                    if (poSwath->nBand != 0 && poSwath->nBand != iBand + 1)
+                        continue;
+                    nStatus |= poTSSrcDS->GetRasterBand(iBand + 1)
+                                   ->GetDataCoverageStatus(
+                                       poSwath->nXOff, poSwath->nYOff,
+                                       poSwath->nXSize, poSwath->nYSize,
+                                       GDAL_DATA_COVERAGE_STATUS_DATA);
+                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+                        break;
+                }
+                poSwath->bHasData =
+                    (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+            }
+            if (poSwath->bHasData)
+            {
+                const int nSwathBandCount =
+                    poSwath->nBand == 0 ? nBandCount : 1;
+                try
+                {
+                    poSwath->abyBuffer.resize(
+                        static_cast<size_t>(poSwath->nXSize) *
+                        poSwath->nYSize * nSwathBandCount * nDTSize);
+                    poSwath->eErr = poTSSrcDS->RasterIO(
+                        GF_Read, poSwath->nXOff, poSwath->nYOff,
+                        poSwath->nXSize, poSwath->nYSize,
+                        poSwath->abyBuffer.data(), poSwath->nXSize,
+                        poSwath->nYSize, eDT, nSwathBandCount,
+                        poSwath->nBand == 0 ? nullptr : &poSwath->nBand, 0, 0,
+                        0, nullptr);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory allocating swath buffer");
+                    poSwath->eErr = CE_Failure;
+                }
+            }
+        }
+        CPLSetThreadLocalConfigOptions(nullptr);
+
+        std::lock_guard<std::mutex> oLock(oMutex);
+        poSwath->bDone = true;
+        oCV.notify_one();
+    };
+
+    CPLDebug("GDAL",
+             "GDALDatasetCopyWholeRaster(): reading swaths with %d threads",
+             nThreads);
+
+    // Limit the number of swaths held in memory
+    const size_t nMaxInFlight = static_cast<size_t>(nThreads) + 1;
+    auto poQueue = poThreadPool->CreateJobQueue();
+    size_t iNextToSubmit = 0;
+    for (size_t i = 0; i < apoSwaths.size() && eErr == CE_None; ++i)
+    {
+        while (iNextToSubmit < apoSwaths.size() &&
+               iNextToSubmit < i + nMaxInFlight)
+        {
+            Swath *poSwath = apoSwaths[iNextToSubmit++].get();
+            if (!poQueue->SubmitJob([&ReadSwath, poSwath]()
+                                    { ReadSwath(poSwath); }))
+            {
+                ReadSwath(poSwath);
+            }
+        }
+
+        Swath *poSwath = apoSwaths[i].get();
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [poSwath] { return poSwath->bDone; });
+        }
+
+        poSwath->oErrorAccumulator.ReplayErrors();
+        eErr = poSwath->eErr;
+        if (eErr == CE_None && poSwath->bHasData)
+        {
+            const int nSwathBandCount = poSwath->nBand == 0 ? nBandCount : 1;
+            eErr = poDstDS->RasterIO(
+                GF_Write, poSwath->nXOff, poSwath->nYOff, poSwath->nXSize,
+                poSwath->nYSize, poSwath->abyBuffer.data(), poSwath->nXSize,
+                poSwath->nYSize, eDT, nSwathBandCount,
+                poSwath->nBand == 0 ? nullptr : &poSwath->nBand, 0, 0, 0,
+                nullptr);
+        }
+        poSwath->abyBuffer.clear();
+        poSwath->abyBuffer.shrink_to_fit();
+
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(i + 1) /
+                             static_cast<double>(apoSwaths.size()),
+                         nullptr, pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+        }
+    }
+
+    // Skip the reading of remaining swaths in case of early exit
+    bStop = true;
+    poQueue->WaitCompletion();
+
+    return true;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -5092,6 +5747,12 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"NUM_THREADS=number_of_threads|ALL_CPUS" to read several swaths
+ * concurrently from the source dataset, when it can be read from several
+ * threads (see GDALGetThreadSafeDataset()). Writing to the destination
+ * dataset is still done by the calling thread. Defaults to the value of the
+ * GDAL_NUM_THREADS configuration option, or 1 if it is not set.
+ * (GDAL &gt;= 3.12)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -5234,6 +5895,20 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     const bool bCheckHoles =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
+    const int nThreads = GDALCopyWholeRasterGetNumThreads(papszOptions);
+    if (nThreads > 1 && (nSwathCols < nXSize || nSwathLines < nYSize ||
+                         (!bInterleave && nBandCount > 1)))
+    {
+        if (GDALDatasetCopyWholeRasterMultiThreaded(
+                poSrcDS, poDstDS, nThreads, bInterleave, bCheckHoles,
+                nSwathCols, nSwathLines, eDT, pfnProgress, pProgressData,
+                eErr))
+        {
+            CPLFree(pSwathBuf);
+            return eErr;
+        }
+    }
+
     if (!bInterleave)
     {
         GDALRasterIOExtraArg sExtraArg;
@@ -6051,6 +6726,37 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
 
 #endif
 
+/************************************************************************/
+/*                     GDALDeinterleaveBlocked()                        */
+/************************************************************************/
+
+// De-interleave values of nComponents components of the same type, by
+// blocks of pixels small enough for the source block to stay in the L1
+// cache while each of its components is extracted. Contrary to extracting
+// components one after the other from the whole buffer, the source buffer
+// is thus only read once from memory, which matters for a large number of
+// components (hyperspectral data).
+template <class T>
+static void GDALDeinterleaveBlocked(const T *CPL_RESTRICT pSrc,
+                                    int nComponents, void **ppDestBuffer,
+                                    size_t nIters)
+{
+    constexpr size_t BLOCK_SIZE_BYTES = 16 * 1024;
+    const size_t nBlockIters = std::max<size_t>(
+        16, BLOCK_SIZE_BYTES / (sizeof(T) * static_cast<size_t>(nComponents)));
+    for (size_t iStart = 0; iStart < nIters; iStart += nBlockIters)
+    {
+        const size_t iEnd = std::min(nIters, iStart + nBlockIters);
+        for (int iComp = 0; iComp < nComponents; ++iComp)
+        {
+            T *CPL_RESTRICT pDst = static_cast<T *>(ppDestBuffer[iComp]);
+            const T *CPL_RESTRICT pSrcComp = pSrc + iComp;
+            for (size_t i = iStart; i < iEnd; ++i)
+                pDst[i] = pSrcComp[i * nComponents];
+        }
+    }
+}
+
 /************************************************************************/
 /*                      GDALDeinterleave()                              */
 /************************************************************************/
@@ -6066,7 +6772,10 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
     \endverbatim
 
     The implementation is optimized for a few cases, like de-interleaving
-    of 3 or 4-components Byte buffers.
+    of 3 or 4-components Byte buffers. When the source and destination data
+    types are the same, other cases are processed by blocks of pixels, so
+    that the source buffer is read only once whatever the number of
+    components.
 
     \since GDAL 3.6
  */
@@ -6151,6 +6860,34 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
 #endif
         }
 #endif
+
+        // Values are copied as integers of the same size, which is fine
+        // as there is no conversion.
+        switch (GDALGetDataTypeSizeBytes(eSourceDT))
+        {
+            case 1:
+                GDALDeinterleaveBlocked(
+                    static_cast<const uint8_t *>(pSourceBuffer), nComponents,
+                    ppDestBuffer, nIters);
+                return;
+            case 2:
+                GDALDeinterleaveBlocked(
+                    static_cast<const uint16_t *>(pSourceBuffer), nComponents,
+                    ppDestBuffer, nIters);
+                return;
+            case 4:
+                GDALDeinterleaveBlocked(
+                    static_cast<const uint32_t *>(pSourceBuffer), nComponents,
+                    ppDestBuffer, nIters);
+                return;
+            case 8:
+                GDALDeinterleaveBlocked(
+                    static_cast<const uint64_t *>(pSourceBuffer), nComponents,
+                    ppDestBuffer, nIters);
+                return;
+            default:
+                break;
+        }
     }
 
     const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#include "rasterio_avx2.h"
+
+#include <immintrin.h>
+
+#include "gdal_priv_templates.hpp"
+
+/************************************************************************/
+/*                    GDALCopyPackedWordsAVX2T()                        */
+/************************************************************************/
+
+// This file is compiled with AVX2 enabled, so GDALCopy8Words() resolves to
+// the 256-bit specializations of gdal_priv_templates.hpp.
+template <class Tin, class Tout>
+static inline void GDALCopyPackedWordsAVX2T(const Tin *CPL_RESTRICT pSrc,
+                                            Tout *CPL_RESTRICT pDst,
+                                            size_t nWordCount)
+{
+    size_t n = 0;
+    for (; n + 16 <= nWordCount; n += 16)
+    {
+        GDALCopy8Words(pSrc + n, pDst + n);
+        GDALCopy8Words(pSrc + n + 8, pDst + n + 8);
+    }
+    for (; n + 8 <= nWordCount; n += 8)
+    {
+        GDALCopy8Words(pSrc + n, pDst + n);
+    }
+    for (; n < nWordCount; n++)
+    {
+        GDALCopyWord(pSrc[n], pDst[n]);
+    }
+}
+
+/************************************************************************/
+/*                     GDALCopyPackedWords_AVX2()                       */
+/************************************************************************/
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GByte *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GInt16 *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GUInt16 *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              double *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const double *CPL_RESTRICT pSrc,
+                              float *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+#ifdef HAVE_F16C_AT_COMPILE_TIME
+
+// This file is also compiled with F16C enabled, so the Float16 conversions
+// of GDALCopy8Words() use _mm256_cvtph_ps() and _mm256_cvtps_ph().
+
+void GDALCopyPackedWords_AVX2(const GFloat16 *CPL_RESTRICT pSrc,
+                              float *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const GFloat16 *CPL_RESTRICT pSrc,
+                              double *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GFloat16 *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+void GDALCopyPackedWords_AVX2(const double *CPL_RESTRICT pSrc,
+                              GFloat16 *CPL_RESTRICT pDst, size_t nWordCount)
+{
+    GDALCopyPackedWordsAVX2T(pSrc, pDst, nWordCount);
+}
+
+#endif  // HAVE_F16C_AT_COMPILE_TIME
+
+#endif
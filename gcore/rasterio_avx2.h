@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX2_H_INCLUDED
+#define RASTERIO_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+// Conversions between packed arrays of nWordCount values, with the same
+// rounding and clamping rules as GDALCopyWords(). Only to be called when
+// CPLHaveRuntimeAVX2() is true.
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GByte *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GInt16 *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GUInt16 *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              double *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const double *CPL_RESTRICT pSrc,
+                              float *CPL_RESTRICT pDst, size_t nWordCount);
+
+#ifdef HAVE_F16C_AT_COMPILE_TIME
+
+#include "cpl_float.h"
+
+// Float16 conversions, using the F16C instructions. Only to be called when
+// CPLHaveRuntimeAVX2() and CPLHaveRuntimeF16C() are true.
+
+void GDALCopyPackedWords_AVX2(const GFloat16 *CPL_RESTRICT pSrc,
+                              float *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const GFloat16 *CPL_RESTRICT pSrc,
+                              double *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const float *CPL_RESTRICT pSrc,
+                              GFloat16 *CPL_RESTRICT pDst, size_t nWordCount);
+
+void GDALCopyPackedWords_AVX2(const double *CPL_RESTRICT pSrc,
+                              GFloat16 *CPL_RESTRICT pDst, size_t nWordCount);
+
+#endif
+
+#endif
+
+#endif /* RASTERIO_AVX2_H_INCLUDED */
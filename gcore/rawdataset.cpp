@@ -25,6 +25,7 @@
 #include <fcntl.h>
 #endif
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <vector>
 
@@ -34,9 +35,12 @@
 #include "cpl_string.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "cpl_safemaths.hpp"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           RawRasterBand()                            */
@@ -1048,6 +1052,227 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                       GetDirectIOThreadCount()                       */
+/************************************************************************/
+
+// Number of threads that ReadLinesDirect() should use to read nBytesToRead
+// bytes spread over nLines lines, according to GDAL_NUM_THREADS. This is 1
+// if the file does not support concurrent reads with PRead().
+int RawRasterBand::GetDirectIOThreadCount(GUIntBig nBytesToRead,
+                                          int nLines) const
+{
+    if (!fpRawL->HasPRead())
+        return 1;
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    // Not worth the overhead for less than 1 MB per thread
+    constexpr GUIntBig MIN_BYTES_PER_THREAD = 1024 * 1024;
+    return static_cast<int>(std::clamp<GUIntBig>(
+        std::min<GUIntBig>({static_cast<GUIntBig>(std::max(nThreads, 1)),
+                            nBytesToRead / MIN_BYTES_PER_THREAD,
+                            static_cast<GUIntBig>(nLines)}),
+        1, 1024));
+}
+
+/************************************************************************/
+/*                          ReadLinesDirect()                           */
+/************************************************************************/
+
+// Reads nBytesPerLine bytes at each of the anLineOffsets file offsets, byte
+// swapping nValuesPerLine values every nByteSkip bytes to the CPU order.
+// Bytes beyond the end of file are read as zeroes, as in AccessBlock(), if
+// bAllowShortReads is true, and cause a failure otherwise.
+//
+// If pabyOut is not null, line i is stored at pabyOut + i * nOutLineSpace.
+// Otherwise processLine(i, pabyLine) is called with a pointer valid only
+// during the call.
+//
+// When the file can be memory mapped (local or /vsimem/ files opened in
+// read-only mode), lines are taken from the mapping, and copied only when
+// needed. Large requests are split into chunks of lines read concurrently by
+// GetDirectIOThreadCount() threads of the global thread pool, in which case
+// processLine() is called from several threads, for different lines.
+CPLErr RawRasterBand::ReadLinesDirect(
+    const std::vector<vsi_l_offset> &anLineOffsets, size_t nBytesPerLine,
+    size_t nValuesPerLine, int nByteSkip, bool bAllowShortReads,
+    GByte *pabyOut, GSpacing nOutLineSpace,
+    const std::function<void(int, const GByte *)> &processLine,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    const int nLines = static_cast<int>(anLineOffsets.size());
+    if (nLines == 0)
+        return CE_None;
+    const bool bNeedsByteOrderChange = NeedsByteOrderChange();
+
+    // Try to map the whole range of the file covered by the request
+    const auto [itMinOffset, itMaxOffset] =
+        std::minmax_element(anLineOffsets.begin(), anLineOffsets.end());
+    const vsi_l_offset nMinOffset = *itMinOffset;
+    const GByte *pabyMapped = nullptr;
+    const vsi_l_offset nRange = *itMaxOffset - nMinOffset + nBytesPerLine;
+    if (nRange == static_cast<size_t>(nRange))
+    {
+        pabyMapped = static_cast<const GByte *>(fpRawL->GetReadOnlyPointer(
+            nMinOffset, static_cast<size_t>(nRange)));
+    }
+
+    const int nThreads = GetDirectIOThreadCount(
+        static_cast<GUIntBig>(nBytesPerLine) * nLines, nLines);
+    const GDALThreadReservation oThreadReservation(nThreads);
+    const bool bConcurrent = oThreadReservation.GetThreadCount() > 1;
+
+    std::atomic<bool> bShortRead{false};
+    const auto ReadLine = [&](int iLine, GByte *pabyScratch)
+    {
+        const vsi_l_offset nOffset = anLineOffsets[iLine];
+        GByte *pabyLine =
+            pabyOut ? pabyOut + static_cast<GPtrDiff_t>(iLine) * nOutLineSpace
+                    : pabyScratch;
+        if (pabyMapped)
+        {
+            const GByte *pabySrc = pabyMapped + (nOffset - nMinOffset);
+            if (!pabyOut && !bNeedsByteOrderChange)
+            {
+                processLine(iLine, pabySrc);
+                return true;
+            }
+            memcpy(pabyLine, pabySrc, nBytesPerLine);
+        }
+        else
+        {
+            size_t nBytesRead = 0;
+            if (bConcurrent)
+                nBytesRead = fpRawL->PRead(pabyLine, nBytesPerLine, nOffset);
+            else if (Seek(nOffset, SEEK_SET) != -1)
+                nBytesRead = Read(pabyLine, 1, nBytesPerLine);
+            if (nBytesRead < nBytesPerLine)
+            {
+                if (!bAllowShortReads)
+                {
+                    bShortRead = true;
+                    return false;
+                }
+                memset(pabyLine + nBytesRead, 0, nBytesPerLine - nBytesRead);
+            }
+        }
+        if (bNeedsByteOrderChange)
+            DoByteSwap(pabyLine, nValuesPerLine, nByteSkip, true);
+        if (!pabyOut)
+            processLine(iLine, pabyLine);
+        return true;
+    };
+
+    const auto ReportShortRead = []()
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Failed to read all bytes of a line. File too short?");
+        return CE_Failure;
+    };
+
+    std::vector<GByte> abyScratch;
+    if (!bConcurrent)
+    {
+        if (!pabyOut)
+        {
+            try
+            {
+                abyScratch.resize(nBytesPerLine);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate line buffer");
+                return CE_Failure;
+            }
+        }
+        for (int iLine = 0; iLine < nLines; ++iLine)
+        {
+            if (!ReadLine(iLine, abyScratch.data()))
+                return ReportShortRead();
+            if (psExtraArg->pfnProgress != nullptr &&
+                !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nLines, "",
+                                         psExtraArg->pProgressData))
+            {
+                return CE_Failure;
+            }
+        }
+        return CE_None;
+    }
+
+    CPLDebugOnly("RAW", "Reading %d lines with %d threads", nLines,
+                 oThreadReservation.GetThreadCount());
+    CPLWorkerThreadPool *poPool =
+        GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount());
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+        return CE_Failure;
+
+    // A few jobs per thread for load balancing and progress reporting
+    const int nJobs = std::min(nLines, 4 * oThreadReservation.GetThreadCount());
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bAllocFailed{false};
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        const int iStartLine =
+            static_cast<int>(static_cast<GIntBig>(iJob) * nLines / nJobs);
+        const int iEndLine =
+            static_cast<int>(static_cast<GIntBig>(iJob + 1) * nLines / nJobs);
+        poQueue->SubmitJob(
+            [&ReadLine, &bStop, &bAllocFailed, pabyOut, nBytesPerLine,
+             iStartLine, iEndLine]()
+            {
+                std::vector<GByte> abyJobScratch;
+                if (!pabyOut)
+                {
+                    try
+                    {
+                        abyJobScratch.resize(nBytesPerLine);
+                    }
+                    catch (const std::exception &)
+                    {
+                        bAllocFailed = true;
+                        bStop = true;
+                        return;
+                    }
+                }
+                for (int iLine = iStartLine; iLine < iEndLine && !bStop;
+                     ++iLine)
+                {
+                    if (!ReadLine(iLine, abyJobScratch.data()))
+                        bStop = true;
+                }
+            });
+    }
+
+    CPLErr eErr = CE_None;
+    for (int nRemainingJobs = nJobs - 1; nRemainingJobs >= 0; --nRemainingJobs)
+    {
+        poQueue->WaitCompletion(nRemainingJobs);
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (nJobs - nRemainingJobs) / nJobs,
+                                     "", psExtraArg->pProgressData))
+        {
+            bStop = true;
+            eErr = CE_Failure;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    if (bAllocFailed)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate line buffer");
+        eErr = CE_Failure;
+    }
+    else if (bShortRead)
+    {
+        eErr = ReportShortRead();
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1126,6 +1351,32 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
             const size_t nValues = static_cast<size_t>(nXSize) * nYSize;
             const size_t nBytesToRead = nValues * nBandDataSize;
+            if (GetDirectIOThreadCount(nBytesToRead, nYSize) > 1)
+            {
+                // Split the block in lines read concurrently
+                std::vector<vsi_l_offset> anLineOffsets;
+                try
+                {
+                    anLineOffsets.resize(nYSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate line offsets");
+                    return CE_Failure;
+                }
+                for (int iLine = 0; iLine < nYSize; ++iLine)
+                {
+                    anLineOffsets[iLine] =
+                        nOffset + static_cast<vsi_l_offset>(iLine) *
+                                      static_cast<vsi_l_offset>(nLineOffset);
+                }
+                return ReadLinesDirect(
+                    anLineOffsets, static_cast<size_t>(nLineOffset), nXSize,
+                    nBandDataSize, /* bAllowShortReads = */ true,
+                    static_cast<GByte *>(pData), nLineSpace, nullptr,
+                    psExtraArg);
+            }
             AccessBlock(nOffset, nBytesToRead, pData, nValues);
         }
         // 2. Case when we need deinterleave and/or subsample data.
@@ -1137,11 +1388,18 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const size_t nBytesToRW =
                 static_cast<size_t>(nPixelOffset) * (nXSize - 1) +
                 GDALGetDataTypeSizeBytes(eDataType);
-            GByte *pabyData =
-                static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBytesToRW));
-            if (pabyData == nullptr)
-                return CE_Failure;
 
+            std::vector<vsi_l_offset> anLineOffsets;
+            try
+            {
+                anLineOffsets.resize(nBufYSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate line offsets");
+                return CE_Failure;
+            }
             for (int iLine = 0; iLine < nBufYSize; iLine++)
             {
                 const vsi_l_offset nLine =
@@ -1156,41 +1414,41 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     nOffset += nXOff * static_cast<vsi_l_offset>(nPixelOffset);
                 else
                     nOffset -= nXOff * static_cast<vsi_l_offset>(-nPixelOffset);
-                AccessBlock(nOffset, nBytesToRW, pabyData, nXSize);
-                // Copy data from disk buffer to user block buffer and
-                // subsample, if needed.
-                if (nXSize == nBufXSize && nYSize == nBufYSize)
-                {
-                    GDALCopyWords64(
-                        pabyData, eDataType, nPixelOffset,
-                        static_cast<GByte *>(pData) + iLine * nLineSpace,
-                        eBufType, static_cast<int>(nPixelSpace), nXSize);
-                }
-                else
+                anLineOffsets[iLine] = nOffset;
+            }
+
+            // Copy data from disk buffer to user block buffer and
+            // subsample, if needed.
+            return ReadLinesDirect(
+                anLineOffsets, nBytesToRW, nXSize, nPixelOffset,
+                /* bAllowShortReads = */ true, nullptr, 0,
+                [this, pData, nXSize, nYSize, nBufXSize, nBufYSize, dfSrcXInc,
+                 eBufType, nPixelSpace, nLineSpace](int iLine,
+                                                    const GByte *pabyData)
                 {
-                    for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+                    GByte *pabyDst =
+                        static_cast<GByte *>(pData) + iLine * nLineSpace;
+                    if (nXSize == nBufXSize && nYSize == nBufYSize)
                     {
-                        GDALCopyWords64(
-                            pabyData + static_cast<vsi_l_offset>(
-                                           iPixel * dfSrcXInc + EPS) *
-                                           nPixelOffset,
-                            eDataType, nPixelOffset,
-                            static_cast<GByte *>(pData) + iLine * nLineSpace +
-                                iPixel * nPixelSpace,
-                            eBufType, static_cast<int>(nPixelSpace), 1);
+                        GDALCopyWords64(pabyData, eDataType, nPixelOffset,
+                                        pabyDst, eBufType,
+                                        static_cast<int>(nPixelSpace), nXSize);
                     }
-                }
-
-                if (psExtraArg->pfnProgress != nullptr &&
-                    !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nBufYSize, "",
-                                             psExtraArg->pProgressData))
-                {
-                    CPLFree(pabyData);
-                    return CE_Failure;
-                }
-            }
-
-            CPLFree(pabyData);
+                    else
+                    {
+                        for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+                        {
+                            GDALCopyWords64(
+                                pabyData + static_cast<vsi_l_offset>(
+                                               iPixel * dfSrcXInc + EPS) *
+                                               nPixelOffset,
+                                eDataType, nPixelOffset,
+                                pabyDst + iPixel * nPixelSpace, eBufType,
+                                static_cast<int>(nPixelSpace), 1);
+                        }
+                    }
+                },
+                psExtraArg);
         }
     }
     // Write data.
@@ -1660,32 +1918,34 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             CPLDebugOnly("GDALRaw", "Direct access to BIP dataset");
             const auto eDT = poFirstBand->GetRasterDataType();
             const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
-            const bool bNeedsByteOrderChange =
-                poFirstBand->NeedsByteOrderChange();
+            const size_t nBytesPerLine =
+                static_cast<size_t>(nXSize) * static_cast<size_t>(nPixelSpace);
+
+            std::vector<vsi_l_offset> anLineOffsets;
+            try
+            {
+                anLineOffsets.resize(nYSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate line offsets");
+                return CE_Failure;
+            }
             for (int iY = 0; iY < nYSize; ++iY)
             {
-                GByte *pabyOut = static_cast<GByte *>(pData) + iY * nLineSpace;
-                VSIFSeekL(poFirstBand->fpRawL,
-                          poFirstBand->nImgOffset +
-                              static_cast<vsi_l_offset>(nYOff + iY) *
-                                  poFirstBand->nLineOffset +
-                              static_cast<vsi_l_offset>(nXOff) *
-                                  poFirstBand->nPixelOffset,
-                          SEEK_SET);
-                if (VSIFReadL(pabyOut,
-                              static_cast<size_t>(nXSize * nPixelSpace), 1,
-                              poFirstBand->fpRawL) != 1)
-                {
-                    return CE_Failure;
-                }
-                if (bNeedsByteOrderChange)
-                {
-                    poFirstBand->DoByteSwap(
-                        pabyOut, static_cast<size_t>(nXSize) * nBands, nDTSize,
-                        true);
-                }
+                anLineOffsets[iY] =
+                    poFirstBand->nImgOffset +
+                    static_cast<vsi_l_offset>(nYOff + iY) *
+                        poFirstBand->nLineOffset +
+                    static_cast<vsi_l_offset>(nXOff) *
+                        poFirstBand->nPixelOffset;
             }
-            return CE_None;
+            return poFirstBand->ReadLinesDirect(
+                anLineOffsets, nBytesPerLine,
+                static_cast<size_t>(nXSize) * nBands, nDTSize,
+                /* bAllowShortReads = */ false, static_cast<GByte *>(pData),
+                nLineSpace, nullptr, psExtraArg);
         }
         else if (bCanUseDirectIO)
         {
@@ -18,7 +18,9 @@
 #include "gdal_pam.h"
 
 #include <atomic>
+#include <functional>
 #include <utility>
+#include <vector>
 
 /************************************************************************/
 /* ==================================================================== */
@@ -135,6 +137,14 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     int CanUseDirectIO(int nXOff, int nYOff, int nXSize, int nYSize,
                        GDALDataType eBufType, GDALRasterIOExtraArg *psExtraArg);
 
+    int GetDirectIOThreadCount(GUIntBig nBytesToRead, int nLines) const;
+    CPLErr ReadLinesDirect(
+        const std::vector<vsi_l_offset> &anLineOffsets, size_t nBytesPerLine,
+        size_t nValuesPerLine, int nByteSkip, bool bAllowShortReads,
+        GByte *pabyOut, GSpacing nOutLineSpace,
+        const std::function<void(int, const GByte *)> &processLine,
+        GDALRasterIOExtraArg *psExtraArg);
+
   public:
     enum class OwnFP
     {
@@ -31,8 +31,10 @@
 #include "gnmgraph.h"
 #include "gnm_priv.h"
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <set>
+#include <tuple>
 
 //! @cond Doxygen_Suppress
 GNMGraph::GNMGraph()
@@ -51,11 +53,13 @@ void GNMGraph::AddVertex(GNMGFID nFID)
     GNMStdVertex stVertex;
     stVertex.bIsBlocked = false;
     m_mstVertices[nFID] = std::move(stVertex);
+    m_bCompactGraphValid = false;
 }
 
 void GNMGraph::DeleteVertex(GNMGFID nFID)
 {
     m_mstVertices.erase(nFID);
+    m_bCompactGraphValid = false;
 
     // remove all edges with this vertex
     std::vector<GNMGFID> aoIdsToErase;
@@ -103,6 +107,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
     stEdge.bIsBlocked = false;
 
     m_mstEdges[nConFID] = stEdge;
+    m_bCompactGraphValid = false;
 
     if (bIsBidir)
     {
@@ -118,6 +123,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
 void GNMGraph::DeleteEdge(GNMGFID nConFID)
 {
     m_mstEdges.erase(nConFID);
+    m_bCompactGraphValid = false;
 
     // remove edge from all vertices anOutEdgeFIDs
     for (auto &it : m_mstVertices)
@@ -136,6 +142,7 @@ void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
     {
         it->second.dfDirCost = dfCost;
         it->second.dfInvCost = dfInvCost;
+        UpdateCompactEdgeCost(nFID);
     }
 }
 
@@ -146,6 +153,11 @@ void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
     if (itv != m_mstVertices.end())
     {
         itv->second.bIsBlocked = bBlock;
+        if (m_bCompactGraphValid)
+        {
+            m_oCompactGraph.abVertexBlocked[GetCompactVertexIndex(nFID)] =
+                bBlock;
+        }
         return;
     }
 
@@ -154,6 +166,7 @@ void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
     if (ite != m_mstEdges.end())
     {
         ite->second.bIsBlocked = bBlock;
+        UpdateCompactEdgeCost(nFID);
     }
 }
 
@@ -179,6 +192,19 @@ void GNMGraph::ChangeAllBlockState(bool bBlock)
     {
         ite->second.bIsBlocked = bBlock;
     }
+
+    if (m_bCompactGraphValid)
+    {
+        auto &oGraph = m_oCompactGraph;
+        oGraph.abVertexBlocked.assign(oGraph.abVertexBlocked.size(), bBlock);
+        size_t iEdge = 0;
+        for (const auto &oIter : m_mstEdges)
+        {
+            oGraph.adfEdgeCost[iEdge++] =
+                bBlock ? std::numeric_limits<double>::infinity()
+                       : oIter.second.dfDirCost;
+        }
+    }
 }
 
 GNMPATH
@@ -241,7 +267,8 @@ GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
 
 GNMPATH GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID)
 {
-    return DijkstraShortestPath(nStartFID, nEndFID, m_mstEdges);
+    return CompactShortestPath(nStartFID, nEndFID,
+                               GetCompactGraph().adfEdgeCost);
 }
 
 std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
@@ -270,20 +297,21 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
 
     A.push_back(std::move(aoFirstPath));
 
-    size_t i, k, l;
+    size_t i, k;
     GNMPATH::iterator itAk, tempIt, itR;
     std::vector<GNMPATH>::iterator itA;
-    std::map<GNMGFID, double>::iterator itDel;
     GNMPATH aoRootPath, aoRootPathOther, aoSpurPath;
-    GNMGFID nSpurNode, nVertexToDel, nEdgeToDel;
+    GNMGFID nSpurNode;
     double dfSumCost;
 
-    std::map<GNMGFID, GNMStdEdge> mstEdges = m_mstEdges;
+    // Edges are "deleted" by assigning them an infinite cost in a copy of
+    // the costs of the compact graph.
+    const GNMCompactGraph &oGraph = GetCompactGraph();
+    std::vector<double> adfEdgeCost = oGraph.adfEdgeCost;
+    std::vector<int> anDeletedEdges;  // for infinity costs assignment
 
     for (k = 0; k < nK - 1; ++k)  // -1 because we have already found one
     {
-        std::map<GNMGFID, double>
-            mDeletedEdges;  // for infinity costs assignment
         itAk = A[k].begin();
 
         for (i = 0; i < A[k].size() - 1; ++i)  // avoid end node
@@ -331,10 +359,13 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     (i < aoRootPathOther.size()))
                 {
                     tempIt = itA->begin() + i + 1;
-                    mDeletedEdges.insert(std::make_pair(
-                        tempIt->second, mstEdges[tempIt->second].dfDirCost));
-                    mstEdges[tempIt->second].dfDirCost =
-                        std::numeric_limits<double>::infinity();
+                    const int iEdge = GetCompactEdgeIndex(tempIt->second);
+                    if (iEdge >= 0)
+                    {
+                        anDeletedEdges.push_back(iEdge);
+                        adfEdgeCost[iEdge] =
+                            std::numeric_limits<double>::infinity();
+                    }
                 }
             }
 
@@ -347,33 +378,33 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
             // end()-1, because we should not remove the spur node
             for (itR = aoRootPath.begin(); itR != aoRootPath.end() - 1; ++itR)
             {
-                nVertexToDel = itR->first;
-                for (l = 0;
-                     l < m_mstVertices[nVertexToDel].anOutEdgeFIDs.size(); ++l)
+                const int iVertexToDel = GetCompactVertexIndex(itR->first);
+                if (iVertexToDel < 0)
+                    continue;
+                for (size_t iArc = oGraph.anFirstArc[iVertexToDel];
+                     iArc < oGraph.anFirstArc[iVertexToDel + 1]; ++iArc)
                 {
-                    nEdgeToDel = m_mstVertices[nVertexToDel].anOutEdgeFIDs[l];
-                    mDeletedEdges.insert(std::make_pair(
-                        nEdgeToDel, mstEdges[nEdgeToDel].dfDirCost));
-                    mstEdges[nEdgeToDel].dfDirCost =
+                    const int iEdge = oGraph.anArcEdge[iArc];
+                    anDeletedEdges.push_back(iEdge);
+                    adfEdgeCost[iEdge] =
                         std::numeric_limits<double>::infinity();
                 }
             }
 
             // Find the new best path in the modified graph.
-            aoSpurPath = DijkstraShortestPath(nSpurNode, nEndFID, mstEdges);
+            aoSpurPath = CompactShortestPath(nSpurNode, nEndFID, adfEdgeCost);
 
             // Firstly, restore deleted edges in order to calculate the summary
             // cost of the path correctly later, because the costs will be
             // gathered from the initial graph.
             // We must do it here, after each edge removing, because the later
             // Dijkstra searches must consider these edges.
-            for (itDel = mDeletedEdges.begin(); itDel != mDeletedEdges.end();
-                 ++itDel)
+            for (const int iEdge : anDeletedEdges)
             {
-                mstEdges[itDel->first].dfDirCost = itDel->second;
+                adfEdgeCost[iEdge] = oGraph.adfEdgeCost[iEdge];
             }
 
-            mDeletedEdges.clear();
+            anDeletedEdges.clear();
 
             // If the part of a new best path has been found we form a full one
             // and add it to the candidates array.
@@ -392,7 +423,9 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     // infinity, because every time we assign infinity costs for
                     // edges of old paths, we anyway have the alternative edges
                     // with non-infinity costs.
-                    dfSumCost += mstEdges[itR->second].dfDirCost;
+                    const int iEdge = GetCompactEdgeIndex(itR->second);
+                    if (iEdge >= 0)
+                        dfSumCost += adfEdgeCost[iEdge];
                 }
 
                 B.insert(std::make_pair(dfSumCost, aoRootPath));
@@ -632,4 +665,170 @@ void GNMGraph::TraceTargets(std::queue<GNMGFID> &vertexQueue,
         TraceTargets(neighbours_queue, markedVertIds, connectedIds);
 }
 
+const GNMGraph::GNMCompactGraph &GNMGraph::GetCompactGraph()
+{
+    if (m_bCompactGraphValid)
+        return m_oCompactGraph;
+
+    auto &oGraph = m_oCompactGraph;
+    oGraph = GNMCompactGraph();
+    m_bCompactGraphValid = true;
+
+    // Both maps are sorted by FID, so are the arrays of FIDs, which allows
+    // binary searches in them.
+    oGraph.anVertexFIDs.reserve(m_mstVertices.size());
+    oGraph.abVertexBlocked.reserve(m_mstVertices.size());
+    for (const auto &oIter : m_mstVertices)
+    {
+        oGraph.anVertexFIDs.push_back(oIter.first);
+        oGraph.abVertexBlocked.push_back(oIter.second.bIsBlocked);
+    }
+
+    oGraph.anEdgeFIDs.reserve(m_mstEdges.size());
+    oGraph.adfEdgeCost.reserve(m_mstEdges.size());
+    for (const auto &oIter : m_mstEdges)
+    {
+        oGraph.anEdgeFIDs.push_back(oIter.first);
+        // We go in any edge from source to target so we take only
+        // direct cost (even if an edge is bi-directed).
+        oGraph.adfEdgeCost.push_back(
+            oIter.second.bIsBlocked ? std::numeric_limits<double>::infinity()
+                                    : oIter.second.dfDirCost);
+    }
+
+    oGraph.anFirstArc.reserve(m_mstVertices.size() + 1);
+    for (const auto &oIter : m_mstVertices)
+    {
+        oGraph.anFirstArc.push_back(oGraph.anArcTarget.size());
+        for (const GNMGFID nEdgeFID : oIter.second.anOutEdgeFIDs)
+        {
+            const int iEdge = GetCompactEdgeIndex(nEdgeFID);
+            if (iEdge < 0)
+                continue;
+            const int iTarget = GetCompactVertexIndex(
+                GetOppositVertex(nEdgeFID, oIter.first));
+            if (iTarget < 0)
+                continue;
+            oGraph.anArcTarget.push_back(iTarget);
+            oGraph.anArcEdge.push_back(iEdge);
+        }
+    }
+    oGraph.anFirstArc.push_back(oGraph.anArcTarget.size());
+
+    return oGraph;
+}
+
+int GNMGraph::GetCompactVertexIndex(GNMGFID nFID) const
+{
+    const auto &anFIDs = m_oCompactGraph.anVertexFIDs;
+    const auto it = std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID);
+    if (it == anFIDs.end() || *it != nFID)
+        return -1;
+    return static_cast<int>(it - anFIDs.begin());
+}
+
+int GNMGraph::GetCompactEdgeIndex(GNMGFID nFID) const
+{
+    const auto &anFIDs = m_oCompactGraph.anEdgeFIDs;
+    const auto it = std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID);
+    if (it == anFIDs.end() || *it != nFID)
+        return -1;
+    return static_cast<int>(it - anFIDs.begin());
+}
+
+void GNMGraph::UpdateCompactEdgeCost(GNMGFID nFID)
+{
+    if (!m_bCompactGraphValid)
+        return;
+    const auto it = m_mstEdges.find(nFID);
+    const int iEdge = GetCompactEdgeIndex(nFID);
+    if (it == m_mstEdges.end() || iEdge < 0)
+    {
+        m_bCompactGraphValid = false;
+        return;
+    }
+    m_oCompactGraph.adfEdgeCost[iEdge] =
+        it->second.bIsBlocked ? std::numeric_limits<double>::infinity()
+                              : it->second.dfDirCost;
+}
+
+GNMPATH GNMGraph::CompactShortestPath(
+    GNMGFID nStartFID, GNMGFID nEndFID,
+    const std::vector<double> &adfEdgeCost) const
+{
+    GNMPATH aoShortestPath;
+    if (nStartFID == nEndFID)
+    {
+        aoShortestPath.push_back(std::make_pair(nStartFID, -1));
+        return aoShortestPath;
+    }
+
+    const GNMCompactGraph &oGraph = m_oCompactGraph;
+    const int iStart = GetCompactVertexIndex(nStartFID);
+    const int iEnd = GetCompactVertexIndex(nEndFID);
+    if (iStart < 0 || iEnd < 0)
+        return aoShortestPath;
+
+    // Dijkstra algorithm, stopped as soon as the end vertex is reached.
+    // Candidates of equal costs are processed in insertion order, as the
+    // multimap based DijkstraShortestPathTree() does, so that both return
+    // the same path when there are several paths of equal costs.
+    const size_t nVertexCount = oGraph.anVertexFIDs.size();
+    const double dfInfinity = std::numeric_limits<double>::infinity();
+    std::vector<double> adfMarks(nVertexCount, dfInfinity);
+    std::vector<bool> abSeen(nVertexCount, false);
+    std::vector<size_t> anPrevArc(nVertexCount, 0);
+    std::vector<int> anPrevVertex(nVertexCount, -1);
+
+    typedef std::tuple<double, size_t, int> Candidate;  // cost, order, vertex
+    std::priority_queue<Candidate, std::vector<Candidate>,
+                        std::greater<Candidate>>
+        oToSee;
+    size_t nOrder = 0;
+    adfMarks[iStart] = 0.0;
+    oToSee.emplace(0.0, nOrder++, iStart);
+
+    while (!oToSee.empty())
+    {
+        const double dfCurrentVertMark = std::get<0>(oToSee.top());
+        const int iCurrentVert = std::get<2>(oToSee.top());
+        oToSee.pop();
+        if (abSeen[iCurrentVert])
+            continue;
+        abSeen[iCurrentVert] = true;
+        if (iCurrentVert == iEnd)
+            break;
+
+        for (size_t iArc = oGraph.anFirstArc[iCurrentVert];
+             iArc < oGraph.anFirstArc[iCurrentVert + 1]; ++iArc)
+        {
+            const int iTarget = oGraph.anArcTarget[iArc];
+            const double dfNewVertexMark =
+                dfCurrentVertMark + adfEdgeCost[oGraph.anArcEdge[iArc]];
+            if (!abSeen[iTarget] && dfNewVertexMark < adfMarks[iTarget] &&
+                !oGraph.abVertexBlocked[iTarget])
+            {
+                adfMarks[iTarget] = dfNewVertexMark;
+                anPrevArc[iTarget] = iArc;
+                anPrevVertex[iTarget] = iCurrentVert;
+                oToSee.emplace(dfNewVertexMark, nOrder++, iTarget);
+            }
+        }
+    }
+
+    if (anPrevVertex[iEnd] < 0)
+        return aoShortestPath;
+
+    // Walk back from end to start point.
+    for (int iVert = iEnd; iVert != iStart; iVert = anPrevVertex[iVert])
+    {
+        aoShortestPath.push_back(std::make_pair(
+            oGraph.anVertexFIDs[iVert],
+            oGraph.anEdgeFIDs[oGraph.anArcEdge[anPrevArc[iVert]]]));
+    }
+    aoShortestPath.push_back(std::make_pair(nStartFID, -1));
+    std::reverse(aoShortestPath.begin(), aoShortestPath.end());
+    return aoShortestPath;
+}
+
 //! @endcond
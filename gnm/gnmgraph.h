@@ -161,9 +161,10 @@ class CPL_DLL GNMGraph
     /**
      * @brief An implementation of Dijkstra shortest path algorithm.
      *
-     * Returns the best path between nStartFID and nEndFID features. Method
-     * uses @see DijkstraShortestPathTree and after that searches in
-     * the resulting tree the path from end to start point.
+     * Returns the best path between nStartFID and nEndFID features. The
+     * search runs on a compact copy of the graph, built at the first call
+     * and reused by the next ones as long as the topology of the graph does
+     * not change, and stops as soon as the end point is reached.
      *
      * @param nStartFID Start identificator
      * @param nEndFID End identificator
@@ -246,9 +247,34 @@ class CPL_DLL GNMGraph
                               std::set<GNMGFID> &markedVertIds,
                               GNMPATH &connectedIds);
 
+    /** Compact adjacency representation of the graph, in compressed sparse
+     * row form, built on demand for the path searches and dropped when the
+     * topology of the graph changes.
+     */
+    struct GNMCompactGraph
+    {
+        std::vector<GNMGFID> anVertexFIDs{};  // sorted
+        std::vector<bool> abVertexBlocked{};
+        // Out arcs of vertex i are in [anFirstArc[i], anFirstArc[i+1])
+        std::vector<size_t> anFirstArc{};
+        std::vector<int> anArcTarget{};       // index of the target vertex
+        std::vector<int> anArcEdge{};         // index of the edge
+        std::vector<GNMGFID> anEdgeFIDs{};    // sorted
+        std::vector<double> adfEdgeCost{};    // infinity if blocked
+    };
+
+    const GNMCompactGraph &GetCompactGraph();
+    int GetCompactVertexIndex(GNMGFID nFID) const;
+    int GetCompactEdgeIndex(GNMGFID nFID) const;
+    void UpdateCompactEdgeCost(GNMGFID nFID);
+    GNMPATH CompactShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
+                                const std::vector<double> &adfEdgeCost) const;
+
   protected:
     std::map<GNMGFID, GNMStdVertex> m_mstVertices{};
     std::map<GNMGFID, GNMStdEdge> m_mstEdges{};
+    GNMCompactGraph m_oCompactGraph{};
+    bool m_bCompactGraphValid = false;
     //! @endcond
 };
 
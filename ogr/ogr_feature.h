@@ -1253,6 +1253,7 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomField(int iField, std::unique_ptr<OGRGeometry>);
 
     void Reset();
+    void Swap(OGRFeature &oOther);
 
     OGRFeature *Clone() const CPL_WARN_UNUSED_RESULT;
     virtual OGRBoolean Equal(const OGRFeature *poFeature) const;
@@ -1961,6 +1962,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+struct OGRFeatureQueryProgram;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1968,6 +1970,7 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    std::unique_ptr<OGRFeatureQueryProgram> m_poProgram{};
 
     char **FieldCollector(void *, char **);
 
@@ -725,6 +725,16 @@ class CPL_DLL OGRSpatialReference
 
     static OGRSpatialReference *GetWGS84SRS();
 
+    static std::shared_ptr<const OGRSpatialReference>
+    GetCachedFromUserInput(const char *pszDefinition,
+                           OSRAxisMappingStrategy eAxisMappingStrategy =
+                               OAMS_AUTHORITY_COMPLIANT,
+                           CSLConstList papszOptions = nullptr);
+
+    static bool
+    IsSameCached(const std::shared_ptr<const OGRSpatialReference> &poSRS1,
+                 const std::shared_ptr<const OGRSpatialReference> &poSRS2);
+
     /** Convert a OGRSpatialReference* to a OGRSpatialReferenceH.
      * @since GDAL 2.3
      */
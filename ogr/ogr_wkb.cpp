@@ -123,6 +123,30 @@ bool OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize, bool &bNeedSwap,
     return false;
 }
 
+/************************************************************************/
+/*                           OGRWKBGetPoint()                           */
+/************************************************************************/
+
+/* Returns the X and Y coordinates of a WKB point, without instantiating a
+ * OGRPoint. Returns false if the geometry is not a point, or is an empty
+ * point.
+ */
+bool OGRWKBGetPoint(const GByte *pabyWkb, size_t nWKBSize, double &dfX,
+                    double &dfY)
+{
+    bool bNeedSwap;
+    uint32_t nType;
+    if (nWKBSize < 5 + 2 * sizeof(double) ||
+        !OGRWKBGetGeomType(pabyWkb, nWKBSize, bNeedSwap, nType))
+        return false;
+    if (!(nType == wkbPoint || nType == wkbPoint + 1000 ||
+          nType == wkbPoint25D || nType == wkbPointM || nType == wkbPointZM))
+        return false;
+    dfX = OGRWKBReadFloat64(pabyWkb + 5, bNeedSwap);
+    dfY = OGRWKBReadFloat64(pabyWkb + 5 + sizeof(double), bNeedSwap);
+    return !std::isnan(dfX);
+}
+
 /************************************************************************/
 /*                        OGRWKBPolygonGetArea()                        */
 /************************************************************************/
@@ -22,6 +22,8 @@
 
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
                                bool &bNeedSwap, uint32_t &nType);
+bool CPL_DLL OGRWKBGetPoint(const GByte *pabyWkb, size_t nWKBSize,
+                            double &dfX, double &dfY);
 bool OGRWKBPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
                           double &dfArea);
 bool OGRWKBMultiPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
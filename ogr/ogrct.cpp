@@ -20,12 +20,17 @@
 #include <cstring>
 #include <limits>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_mem_cache.h"
 #include "cpl_string.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
@@ -752,6 +757,7 @@ class OGRProjCT : public OGRCoordinateTransformation
     std::string m_osTargetSRS{};  // WKT, PROJ4 or AUTH:CODE
 
     bool bWebMercatorToWGS84LongLat = false;
+    bool bWGS84LongLatToWebMercator = false;
 
     size_t nErrorCount = 0;
 
@@ -764,6 +770,9 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     bool bNoTransform = false;
 
+    // Set on the clones used by TransformMultiThreaded()
+    bool m_bIsWorkerClone = false;
+
     enum class Strategy
     {
         PROJ,
@@ -840,6 +849,10 @@ class OGRProjCT : public OGRCoordinateTransformation
     int TransformWithErrorCodes(size_t nCount, double *x, double *y, double *z,
                                 double *t, int *panErrorCodes) override;
 
+    bool TransformMultiThreaded(size_t nCount, double *x, double *y,
+                                double *z, double *t, int *panErrorCodes,
+                                int &bRet);
+
     int TransformBounds(const double xmin, const double ymin, const double xmax,
                         const double ymax, double *out_xmin, double *out_ymin,
                         double *out_xmax, double *out_ymax,
@@ -1338,6 +1351,7 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       dfTargetCoordinateEpoch(other.dfTargetCoordinateEpoch),
       m_osTargetSRS(other.m_osTargetSRS),
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
+      bWGS84LongLatToWebMercator(other.bWGS84LongLatToWebMercator),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
       m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
@@ -1502,6 +1516,37 @@ void OGRProjCT::DetectWebMercatorToWGS84()
             CPLDebug("OGRCT", "Using WebMercator to WGS84 optimization");
         }
     }
+
+    // Detect WGS84 to webmercator. Only done from the EPSG codes.
+    else if (m_options.d->osCoordOperation.empty() && poSRSSource &&
+             poSRSTarget && poSRSSource->IsGeographic() &&
+             poSRSTarget->IsProjected() &&
+             ((m_eSourceFirstAxisOrient == OAO_North &&
+               poSRSSource->GetDataAxisToSRSAxisMapping() ==
+                   std::vector<int>{2, 1}) ||
+              (m_eSourceFirstAxisOrient == OAO_East &&
+               poSRSSource->GetDataAxisToSRSAxisMapping() ==
+                   std::vector<int>{1, 2})))
+    {
+        const char *pszSourceAuth = poSRSSource->GetAuthorityName(nullptr);
+        const char *pszSourceCode = poSRSSource->GetAuthorityCode(nullptr);
+        const char *pszTargetAuth = poSRSTarget->GetAuthorityName(nullptr);
+        const char *pszTargetCode = poSRSTarget->GetAuthorityCode(nullptr);
+        if (pszSourceAuth && pszSourceCode && pszTargetAuth && pszTargetCode &&
+            EQUAL(pszSourceAuth, "EPSG") && EQUAL(pszTargetAuth, "EPSG"))
+        {
+            bWGS84LongLatToWebMercator =
+                EQUAL(pszSourceCode, "4326") &&
+                (EQUAL(pszTargetCode, "3857") ||
+                 EQUAL(pszTargetCode, "3785") ||  // deprecated
+                 EQUAL(pszTargetCode, "900913"));  // deprecated
+        }
+
+        if (bWGS84LongLatToWebMercator)
+        {
+            CPLDebug("OGRCT", "Using WGS84 to WebMercator optimization");
+        }
+    }
 }
 
 /************************************************************************/
@@ -1703,7 +1748,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                  m_bReversePj ? "(reversed) " : "");
 #endif
     }
-    else if (!bWebMercatorToWGS84LongLat && poSRSSource && poSRSTarget)
+    else if (!bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+             poSRSSource && poSRSTarget)
     {
 #ifdef DEBUG_PERF
         struct CPLTimeVal tvStart;
@@ -2337,16 +2383,104 @@ int OGRProjCT::Transform(size_t nCount, double *x, double *y, double *z,
     return bRet;
 }
 
-/************************************************************************/
-/*                       TransformWithErrorCodes()                      */
-/************************************************************************/
-
 #ifndef PROJ_ERR_COORD_TRANSFM_INVALID_COORD
 #define PROJ_ERR_COORD_TRANSFM_INVALID_COORD 2049
 #define PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN 2050
 #define PROJ_ERR_COORD_TRANSFM_NO_OPERATION 2051
 #endif
 
+/************************************************************************/
+/*                       TransformMultiThreaded()                       */
+/************************************************************************/
+
+/** Splits a large batch of points across the global thread pool, when the
+ * OGR_CT_NUM_THREADS configuration option is set.  Each job uses its own
+ * clone of this transformation, as PJ objects cannot be used concurrently.
+ *
+ * Returns false if the transformation has not been done, in which case the
+ * caller must proceed on the current thread.
+ */
+bool OGRProjCT::TransformMultiThreaded(size_t nCount, double *x, double *y,
+                                       double *z, double *t,
+                                       int *panErrorCodes, int &bRet)
+{
+    constexpr size_t MIN_POINTS_PER_JOB = 65536;
+    if (m_bIsWorkerClone || nCount < 2 * MIN_POINTS_PER_JOB)
+        return false;
+
+    // When the operation is selected from the average of the coordinates,
+    // splitting the batch could change the result.
+    if ((!m_pj && !m_oTransformations.empty()) ||
+        m_recordDifferentOperationsUsed)
+        return false;
+
+    const char *pszNumThreads = CPLGetConfigOption("OGR_CT_NUM_THREADS", "1");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(1, std::min(2 * nThreads, atoi(pszNumThreads)));
+    const size_t nMaxJobs =
+        std::min(static_cast<size_t>(nThreads), nCount / MIN_POINTS_PER_JOB);
+    if (nMaxJobs <= 1)
+        return false;
+
+    GDALThreadReservation oThreadReservation(static_cast<int>(nMaxJobs));
+    const size_t nJobs =
+        static_cast<size_t>(oThreadReservation.GetThreadCount());
+    if (nJobs <= 1)
+        return false;
+    CPLWorkerThreadPool *poThreadPool =
+        GDALGetGlobalThreadPool(static_cast<int>(nJobs));
+    if (!poThreadPool)
+        return false;
+
+    std::vector<std::unique_ptr<OGRProjCT>> apoCT;
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        auto poCT = std::unique_ptr<OGRProjCT>(
+            cpl::down_cast<OGRProjCT *>(Clone()));
+        if (!poCT)
+            return false;
+        poCT->m_bIsWorkerClone = true;
+        apoCT.push_back(std::move(poCT));
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    std::vector<int> anRet(nJobs, FALSE);
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        const size_t nStart = i * nCount / nJobs;
+        const size_t nEnd = (i + 1) * nCount / nJobs;
+        const auto Job = [&apoCT, &anRet, &oErrorAccumulator, i, nStart, nEnd,
+                          x, y, z, t, panErrorCodes]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            anRet[i] = apoCT[i]->TransformWithErrorCodes(
+                nEnd - nStart, x + nStart, y + nStart, z ? z + nStart : nullptr,
+                t ? t + nStart : nullptr,
+                panErrorCodes ? panErrorCodes + nStart : nullptr);
+        };
+        if (!poJobQueue->SubmitJob(Job))
+            Job();
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    bRet = TRUE;
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        if (!anRet[i])
+            bRet = FALSE;
+        nErrorCount = std::max(nErrorCount, apoCT[i]->nErrorCount);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       TransformWithErrorCodes()                      */
+/************************************************************************/
+
 int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                                        double *z, double *t, int *panErrorCodes)
 
@@ -2367,6 +2501,12 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
         return TRUE;
     }
 
+    {
+        int bRetMT = FALSE;
+        if (TransformMultiThreaded(nCount, x, y, z, t, panErrorCodes, bRetMT))
+            return bRetMT;
+    }
+
 #ifdef DEBUG_VERBOSE
     bool bDebugCT = CPLTestBool(CPLGetConfigOption("OGR_CT_DEBUG", "NO"));
     if (bDebugCT)
@@ -2564,6 +2704,73 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
         bTransformDone = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optimized transform from WGS84 to WebMercator                   */
+    /* -------------------------------------------------------------------- */
+    else if (bWGS84LongLatToWebMercator)
+    {
+        constexpr double SPHERE_RADIUS = 6378137.0;
+        constexpr double DEG_TO_RAD = M_PI / 180.0;
+        // Same tolerance as PROJ for latitudes at the poles
+        constexpr double EPS_LAT = 1e-10;
+
+        if (m_eSourceFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        const double y0 = y[0];
+        double y0Transformed = HUGE_VAL;
+        for (size_t i = 0; i < nCount; i++)
+        {
+            double dfLong = x[i] * DEG_TO_RAD;
+            const double dfLat = y[i] * DEG_TO_RAD;
+            if (x[i] == HUGE_VAL || y[i] == HUGE_VAL ||
+                !(std::fabs(dfLat) < M_PI / 2 - EPS_LAT) ||
+                std::isnan(dfLong))
+            {
+                if (panErrorCodes)
+                {
+                    panErrorCodes[i] =
+                        std::fabs(dfLat) <= M_PI / 2
+                            ? PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN
+                            : PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+                }
+                x[i] = HUGE_VAL;
+                y[i] = HUGE_VAL;
+                bRet = FALSE;
+                continue;
+            }
+            if (panErrorCodes)
+                panErrorCodes[i] = 0;
+
+            // Longitudes are wrapped to [-180, 180], as PROJ does
+            if (std::fabs(dfLong) > M_PI + 1e-12)
+            {
+                dfLong = std::remainder(dfLong, 2 * M_PI);
+            }
+            x[i] = SPHERE_RADIUS * dfLong;
+
+            // Optimization for the case where we are provided a whole line
+            // of same latitude.
+            if (i > 0 && y[i] == y0 && y0Transformed != HUGE_VAL)
+                y[i] = y0Transformed;
+            else
+            {
+                y[i] = SPHERE_RADIUS * std::asinh(std::tan(dfLat));
+                if (i == 0)
+                    y0Transformed = y[0];
+            }
+        }
+
+        if (m_eTargetFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        bTransformDone = true;
+    }
+
     // Determine the default coordinate epoch, if not provided in the point to
     // transform.
     // For time-dependent transformations, PROJ can currently only do
@@ -3659,7 +3866,8 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 {
     PJ *new_pj = nullptr;
     // m_pj can be nullptr if using m_eStrategy != PROJ
-    if (m_pj && !bWebMercatorToWGS84LongLat && !bNoTransform)
+    if (m_pj && !bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+        !bNoTransform)
     {
         // See https://github.com/OSGeo/PROJ/pull/2582
         // This may fail before PROJ 8.0.1 if the m_pj object is a "meta"
@@ -28,6 +28,7 @@
 #include <limits>
 #include <map>
 #include <new>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -363,6 +364,30 @@ void OGRFeature::Reset()
     }
 }
 
+/************************************************************************/
+/*                                Swap()                                */
+/************************************************************************/
+
+/** Exchange the content of this feature with the one of another feature.
+ *
+ * The feature definition, FID, field values, geometries, style string, style
+ * table and native data are exchanged, without any copy.
+ *
+ * @since GDAL 3.12
+ */
+void OGRFeature::Swap(OGRFeature &oOther)
+{
+    std::swap(nFID, oOther.nFID);
+    std::swap(poDefn, oOther.poDefn);
+    std::swap(papoGeometries, oOther.papoGeometries);
+    std::swap(pauFields, oOther.pauFields);
+    std::swap(m_pszNativeData, oOther.m_pszNativeData);
+    std::swap(m_pszNativeMediaType, oOther.m_pszNativeMediaType);
+    std::swap(m_pszStyleString, oOther.m_pszStyleString);
+    std::swap(m_poStyleTable, oOther.m_poStyleTable);
+    std::swap(m_pszTmpFieldValue, oOther.m_pszTmpFieldValue);
+}
+
 /************************************************************************/
 /*                        SetFDefnUnsafe()                              */
 /************************************************************************/
@@ -17,7 +17,12 @@
 #include "ogr_swq.h"
 
 #include <cstddef>
+#include <climits>
+#include <cmath>
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -39,6 +44,95 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+/************************************************************************/
+/*                        OGRFeatureQueryProgram                        */
+/************************************************************************/
+
+// Flat program compiled from the expression tree, that evaluates a feature
+// without allocating any intermediate swq_expr_node. It only supports
+// comparisons, IN, BETWEEN, IS NULL, AND, OR and NOT on integer, real and
+// string fields and constants, and reproduces exactly the results of
+// SWQGeneralEvaluator(), including its handling of NULL values. Other
+// expressions are evaluated with swq_expr_node::Evaluate().
+struct OGRFeatureQueryProgram
+{
+    enum class ValueClass
+    {
+        INTEGER,  // also boolean
+        FLOAT,
+        STRING
+    };
+
+    enum class Opcode
+    {
+        LOAD_INTEGER,
+        LOAD_INTEGER64,
+        LOAD_FLOAT,
+        LOAD_STRING,
+        TO_FLOAT,
+        AND_SHORT_CIRCUIT,
+        AND,
+        OR,
+        NOT,
+        IS_NULL,
+        COMPARE,
+        BETWEEN,
+        IN,
+        IN_SORTED_INTEGERS,
+    };
+
+    struct Value
+    {
+        GIntBig nInt = 0;
+        double dfFloat = 0;
+        const char *pszString = "";
+        bool bNull = false;
+    };
+
+    struct Instruction
+    {
+        Opcode eOpcode = Opcode::LOAD_INTEGER;
+        swq_op eOperation = SWQ_EQ;
+        ValueClass eClass = ValueClass::INTEGER;
+        int nDst = 0;
+        std::array<int, 3> anSrc{{0, 0, 0}};
+        // Field index for LOAD_xxx, jump target for AND_SHORT_CIRCUIT
+        int nParam = 0;
+        // Range in anListRegisters (IN) or anSortedIntegers
+        // (IN_SORTED_INTEGERS)
+        size_t nListStart = 0;
+        size_t nListCount = 0;
+    };
+
+    static constexpr int MAX_REGISTERS = 128;
+
+    std::vector<std::pair<int, Value>> aoConstants{};
+    std::vector<Instruction> aoInstructions{};
+    std::vector<int> anListRegisters{};
+    std::vector<GIntBig> anSortedIntegers{};
+    int nRegisters = 0;
+    int nResult = 0;
+
+    static std::unique_ptr<OGRFeatureQueryProgram>
+    Compile(const swq_expr_node *poExpr, const OGRFeatureDefn *poDefn);
+
+    bool Evaluate(OGRFeature *poFeature, int &nResultOut) const;
+
+  private:
+    struct CompiledNode
+    {
+        int nReg = -1;
+        ValueClass eClass = ValueClass::INTEGER;
+    };
+
+    int NewRegister();
+    CompiledNode AddConstant(const Value &sValue, ValueClass eClass);
+    CompiledNode CompileNode(const swq_expr_node *poNode,
+                             const OGRFeatureDefn *poDefn, int nDepth);
+    CompiledNode CompileComparison(const swq_expr_node *poNode,
+                                   const OGRFeatureDefn *poDefn, int nDepth);
+};
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
@@ -100,6 +194,7 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
                          swq_custom_func_registrar *poCustomFuncRegistrar)
 {
     // Clear any existing expression.
+    m_poProgram.reset();
     if (pSWQExpr != nullptr)
     {
         delete static_cast<swq_expr_node *>(pSWQExpr);
@@ -226,6 +321,13 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (bCheck &&
+             CPLTestBool(CPLGetConfigOption("OGR_SQL_COMPILE_WHERE", "YES")))
+    {
+        // Config option for debug and testing purposes only
+        m_poProgram = OGRFeatureQueryProgram::Compile(
+            static_cast<swq_expr_node *>(pSWQExpr), poDefn);
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -301,6 +403,566 @@ static swq_expr_node *OGRFeatureFetcher(swq_expr_node *op, void *pFeatureIn)
     return poRetNode;
 }
 
+/************************************************************************/
+/*                 OGRFeatureQueryProgram::NewRegister()                */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::NewRegister()
+{
+    if (nRegisters == MAX_REGISTERS)
+        return -1;
+    return nRegisters++;
+}
+
+/************************************************************************/
+/*                 OGRFeatureQueryProgram::AddConstant()                */
+/************************************************************************/
+
+OGRFeatureQueryProgram::CompiledNode
+OGRFeatureQueryProgram::AddConstant(const Value &sValue, ValueClass eClass)
+{
+    CompiledNode sRet;
+    sRet.nReg = NewRegister();
+    sRet.eClass = eClass;
+    if (sRet.nReg >= 0)
+        aoConstants.emplace_back(sRet.nReg, sValue);
+    return sRet;
+}
+
+/************************************************************************/
+/*                OGRFeatureQueryProgram::CompileNode()                 */
+/************************************************************************/
+
+// Returns a node with nReg < 0 if the expression is not supported.
+OGRFeatureQueryProgram::CompiledNode
+OGRFeatureQueryProgram::CompileNode(const swq_expr_node *poNode,
+                                    const OGRFeatureDefn *poDefn, int nDepth)
+{
+    CompiledNode sUnsupported;
+
+    if (poNode->eNodeType == SNT_CONSTANT)
+    {
+        if (poNode->is_null)
+            return sUnsupported;
+        Value sValue;
+        switch (poNode->field_type)
+        {
+            case SWQ_INTEGER:
+            case SWQ_INTEGER64:
+            case SWQ_BOOLEAN:
+                sValue.nInt = poNode->int_value;
+                return AddConstant(sValue, ValueClass::INTEGER);
+            case SWQ_FLOAT:
+                sValue.dfFloat = poNode->float_value;
+                return AddConstant(sValue, ValueClass::FLOAT);
+            case SWQ_STRING:
+                if (!poNode->string_value)
+                    return sUnsupported;
+                sValue.pszString = poNode->string_value;
+                return AddConstant(sValue, ValueClass::STRING);
+            default:
+                return sUnsupported;
+        }
+    }
+
+    // swq_expr_node::Evaluate() errors out at that recursion level
+    if (nDepth >= 32)
+        return sUnsupported;
+
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        if (poNode->table_index != 0)
+            return sUnsupported;
+        const int nFieldIdx =
+            OGRFeatureFetcherFixFieldIndex(const_cast<OGRFeatureDefn *>(poDefn),
+                                           poNode->field_index);
+        const int nFieldCount = poDefn->GetFieldCount();
+        const bool bIsFID = nFieldIdx == nFieldCount + SPF_FID;
+        if (nFieldIdx < 0 || (nFieldIdx >= nFieldCount && !bIsFID))
+            return sUnsupported;
+
+        Instruction sInstr;
+        sInstr.nParam = nFieldIdx;
+        CompiledNode sRet;
+        switch (poNode->field_type)
+        {
+            case SWQ_INTEGER:
+            case SWQ_BOOLEAN:
+                sInstr.eOpcode = Opcode::LOAD_INTEGER;
+                break;
+            case SWQ_INTEGER64:
+                sInstr.eOpcode = Opcode::LOAD_INTEGER64;
+                break;
+            case SWQ_FLOAT:
+                sInstr.eOpcode = Opcode::LOAD_FLOAT;
+                sRet.eClass = ValueClass::FLOAT;
+                break;
+            case SWQ_STRING:
+                // Other field types are formatted by GetFieldAsString() in a
+                // temporary buffer, which does not survive to another call.
+                if (bIsFID ||
+                    poDefn->GetFieldDefn(nFieldIdx)->GetType() != OFTString)
+                    return sUnsupported;
+                sInstr.eOpcode = Opcode::LOAD_STRING;
+                sRet.eClass = ValueClass::STRING;
+                break;
+            default:
+                return sUnsupported;
+        }
+        sRet.nReg = sInstr.nDst = NewRegister();
+        if (sRet.nReg >= 0)
+            aoInstructions.push_back(sInstr);
+        return sRet;
+    }
+
+    if (poNode->eNodeType != SNT_OPERATION ||
+        poNode->field_type != SWQ_BOOLEAN)
+        return sUnsupported;
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            if (poNode->nSubExprCount != 2)
+                return sUnsupported;
+            const auto sA = CompileNode(poNode->papoSubExpr[0], poDefn,
+                                        nDepth + 1);
+            if (sA.nReg < 0 || sA.eClass != ValueClass::INTEGER)
+                return sUnsupported;
+            CompiledNode sRet;
+            sRet.nReg = NewRegister();
+            if (sRet.nReg < 0)
+                return sUnsupported;
+            // For AND, if the first operand is FALSE, the result is FALSE
+            // (and not NULL) whatever the second one is.
+            size_t nShortCircuitIdx = 0;
+            if (poNode->nOperation == SWQ_AND)
+            {
+                Instruction sInstr;
+                sInstr.eOpcode = Opcode::AND_SHORT_CIRCUIT;
+                sInstr.nDst = sRet.nReg;
+                sInstr.anSrc[0] = sA.nReg;
+                nShortCircuitIdx = aoInstructions.size();
+                aoInstructions.push_back(sInstr);
+            }
+            const auto sB = CompileNode(poNode->papoSubExpr[1], poDefn,
+                                        nDepth + 1);
+            if (sB.nReg < 0 || sB.eClass != ValueClass::INTEGER)
+                return sUnsupported;
+            Instruction sInstr;
+            sInstr.eOpcode =
+                poNode->nOperation == SWQ_AND ? Opcode::AND : Opcode::OR;
+            sInstr.nDst = sRet.nReg;
+            sInstr.anSrc[0] = sA.nReg;
+            sInstr.anSrc[1] = sB.nReg;
+            aoInstructions.push_back(sInstr);
+            if (poNode->nOperation == SWQ_AND)
+            {
+                aoInstructions[nShortCircuitIdx].nParam =
+                    static_cast<int>(aoInstructions.size());
+            }
+            return sRet;
+        }
+
+        case SWQ_NOT:
+        case SWQ_ISNULL:
+        {
+            if (poNode->nSubExprCount != 1)
+                return sUnsupported;
+            const auto sA = CompileNode(poNode->papoSubExpr[0], poDefn,
+                                        nDepth + 1);
+            // NOT is only handled by the integer code path
+            if (sA.nReg < 0 || (poNode->nOperation == SWQ_NOT &&
+                                sA.eClass != ValueClass::INTEGER))
+                return sUnsupported;
+            Instruction sInstr;
+            sInstr.eOpcode =
+                poNode->nOperation == SWQ_NOT ? Opcode::NOT : Opcode::IS_NULL;
+            sInstr.anSrc[0] = sA.nReg;
+            CompiledNode sRet;
+            sRet.nReg = sInstr.nDst = NewRegister();
+            if (sRet.nReg >= 0)
+                aoInstructions.push_back(sInstr);
+            return sRet;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GE:
+        case SWQ_LE:
+        case SWQ_LT:
+        case SWQ_GT:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+            return CompileComparison(poNode, poDefn, nDepth);
+
+        default:
+            break;
+    }
+    return sUnsupported;
+}
+
+/************************************************************************/
+/*             OGRFeatureQueryProgram::CompileComparison()              */
+/************************************************************************/
+
+OGRFeatureQueryProgram::CompiledNode OGRFeatureQueryProgram::CompileComparison(
+    const swq_expr_node *poNode, const OGRFeatureDefn *poDefn, int nDepth)
+{
+    CompiledNode sUnsupported;
+
+    const int nCount = poNode->nSubExprCount;
+    if ((poNode->nOperation == SWQ_BETWEEN && nCount != 3) ||
+        (poNode->nOperation == SWQ_IN && nCount < 2) ||
+        (poNode->nOperation != SWQ_BETWEEN && poNode->nOperation != SWQ_IN &&
+         nCount != 2))
+    {
+        return sUnsupported;
+    }
+
+    // Sorted list of values for IN with only integer constants
+    const bool bInConstantIntegers =
+        poNode->nOperation == SWQ_IN && nCount > 2 &&
+        std::all_of(poNode->papoSubExpr + 1, poNode->papoSubExpr + nCount,
+                    [](const swq_expr_node *poSubNode)
+                    {
+                        return poSubNode->eNodeType == SNT_CONSTANT &&
+                               !poSubNode->is_null &&
+                               (SWQ_IS_INTEGER(poSubNode->field_type) ||
+                                poSubNode->field_type == SWQ_BOOLEAN);
+                    });
+
+    std::vector<CompiledNode> asOperands;
+    for (int i = 0; i < (bInConstantIntegers ? 1 : nCount); ++i)
+    {
+        const auto sOperand =
+            CompileNode(poNode->papoSubExpr[i], poDefn, nDepth + 1);
+        if (sOperand.nReg < 0)
+            return sUnsupported;
+        asOperands.push_back(sOperand);
+    }
+
+    // Select the code path of SWQGeneralEvaluator(), which depends on the
+    // type of the first two operands, and only accept operand types that it
+    // properly handles in that path.
+    ValueClass eClass;
+    if (asOperands[0].eClass == ValueClass::FLOAT ||
+        (!bInConstantIntegers && asOperands[1].eClass == ValueClass::FLOAT))
+    {
+        eClass = ValueClass::FLOAT;
+        if (bInConstantIntegers)
+            return sUnsupported;
+        for (int i = 0; i < nCount; ++i)
+        {
+            if (asOperands[i].eClass == ValueClass::FLOAT)
+                continue;
+            // Only the first two operands are converted to floating point
+            if (i >= 2 || asOperands[i].eClass != ValueClass::INTEGER)
+                return sUnsupported;
+            Instruction sInstr;
+            sInstr.eOpcode = Opcode::TO_FLOAT;
+            sInstr.anSrc[0] = asOperands[i].nReg;
+            asOperands[i].nReg = sInstr.nDst = NewRegister();
+            if (sInstr.nDst < 0)
+                return sUnsupported;
+            aoInstructions.push_back(sInstr);
+        }
+    }
+    else
+    {
+        eClass = asOperands[0].eClass;
+        for (const auto &sOperand : asOperands)
+        {
+            if (sOperand.eClass != eClass)
+                return sUnsupported;
+        }
+        if (bInConstantIntegers && eClass != ValueClass::INTEGER)
+            return sUnsupported;
+    }
+
+    Instruction sInstr;
+    sInstr.eOperation = poNode->nOperation;
+    sInstr.eClass = eClass;
+    sInstr.anSrc[0] = asOperands[0].nReg;
+    if (bInConstantIntegers)
+    {
+        sInstr.eOpcode = Opcode::IN_SORTED_INTEGERS;
+        sInstr.nListStart = anSortedIntegers.size();
+        sInstr.nListCount = static_cast<size_t>(nCount - 1);
+        for (int i = 1; i < nCount; ++i)
+            anSortedIntegers.push_back(poNode->papoSubExpr[i]->int_value);
+        std::sort(anSortedIntegers.begin() + sInstr.nListStart,
+                  anSortedIntegers.end());
+    }
+    else if (poNode->nOperation == SWQ_IN)
+    {
+        sInstr.eOpcode = Opcode::IN;
+        sInstr.nListStart = anListRegisters.size();
+        sInstr.nListCount = static_cast<size_t>(nCount - 1);
+        for (int i = 1; i < nCount; ++i)
+            anListRegisters.push_back(asOperands[i].nReg);
+    }
+    else
+    {
+        sInstr.eOpcode = poNode->nOperation == SWQ_BETWEEN ? Opcode::BETWEEN
+                                                           : Opcode::COMPARE;
+        for (int i = 1; i < nCount; ++i)
+            sInstr.anSrc[i] = asOperands[i].nReg;
+    }
+
+    CompiledNode sRet;
+    sRet.nReg = sInstr.nDst = NewRegister();
+    if (sRet.nReg >= 0)
+        aoInstructions.push_back(sInstr);
+    return sRet;
+}
+
+/************************************************************************/
+/*                  OGRFeatureQueryProgram::Compile()                   */
+/************************************************************************/
+
+std::unique_ptr<OGRFeatureQueryProgram>
+OGRFeatureQueryProgram::Compile(const swq_expr_node *poExpr,
+                                const OGRFeatureDefn *poDefn)
+{
+    auto poProgram = std::make_unique<OGRFeatureQueryProgram>();
+    const auto sResult = poProgram->CompileNode(poExpr, poDefn, 0);
+    // OGRFeatureQuery::Evaluate() only accepts integer results
+    if (sResult.nReg < 0 || sResult.eClass != ValueClass::INTEGER)
+        return nullptr;
+    poProgram->nResult = sResult.nReg;
+    return poProgram;
+}
+
+/************************************************************************/
+/*                         SWQStringEquals()                            */
+/************************************************************************/
+
+// Same as the SWQ_EQ case of string operations in SWQGeneralEvaluator().
+// When comparing timestamps, the +00 at the end might be discarded if the
+// other member has no explicit timezone.
+static bool SWQStringEquals(const char *pszA, const char *pszB)
+{
+    const size_t nLenA = strlen(pszA);
+    const size_t nLenB = strlen(pszB);
+    if (nLenA > 3 && nLenB > 3)
+    {
+        if (strcmp(pszA + nLenA - 3, "+00") == 0 && pszB[nLenB - 3] == ':')
+            return EQUALN(pszA, pszB, nLenB);
+        if (pszA[nLenA - 3] == ':' && strcmp(pszB + nLenB - 3, "+00") == 0)
+            return EQUALN(pszA, pszB, nLenA);
+    }
+    return strcasecmp(pszA, pszB) == 0;
+}
+
+/************************************************************************/
+/*                          CompareValues()                             */
+/************************************************************************/
+
+template <class T> static bool CompareValues(swq_op eOperation, T a, T b)
+{
+    switch (eOperation)
+    {
+        case SWQ_EQ:
+            return a == b;
+        case SWQ_NE:
+            return a != b;
+        case SWQ_GT:
+            return a > b;
+        case SWQ_LT:
+            return a < b;
+        case SWQ_GE:
+            return a >= b;
+        case SWQ_LE:
+            return a <= b;
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return false;
+}
+
+static bool CompareValues(swq_op eOperation, const char *pszA,
+                          const char *pszB)
+{
+    if (eOperation == SWQ_EQ)
+        return SWQStringEquals(pszA, pszB);
+    return CompareValues(eOperation, strcasecmp(pszA, pszB), 0);
+}
+
+/************************************************************************/
+/*                 OGRFeatureQueryProgram::Evaluate()                   */
+/************************************************************************/
+
+// Returns false if the feature cannot be evaluated by the program, in which
+// case swq_expr_node::Evaluate() must be used.
+bool OGRFeatureQueryProgram::Evaluate(OGRFeature *poFeature,
+                                      int &nResultOut) const
+{
+    std::array<Value, MAX_REGISTERS> asRegs;
+    for (const auto &[nReg, sValue] : aoConstants)
+        asRegs[nReg] = sValue;
+
+    const auto Compare =
+        [](swq_op eOperation, ValueClass eClass, const Value &a, const Value &b)
+    {
+        return eClass == ValueClass::INTEGER
+                   ? CompareValues(eOperation, a.nInt, b.nInt)
+               : eClass == ValueClass::FLOAT
+                   ? CompareValues(eOperation, a.dfFloat, b.dfFloat)
+                   : CompareValues(eOperation, a.pszString, b.pszString);
+    };
+    const auto Equal = [](ValueClass eClass, const Value &a, const Value &b)
+    {
+        return eClass == ValueClass::INTEGER ? a.nInt == b.nInt
+               : eClass == ValueClass::FLOAT
+                   ? a.dfFloat == b.dfFloat
+                   : strcasecmp(a.pszString, b.pszString) == 0;
+    };
+
+    const size_t nInstructions = aoInstructions.size();
+    for (size_t iPC = 0; iPC < nInstructions; ++iPC)
+    {
+        const Instruction &sInstr = aoInstructions[iPC];
+        Value &sDst = asRegs[sInstr.nDst];
+        const Value &sA = asRegs[sInstr.anSrc[0]];
+        switch (sInstr.eOpcode)
+        {
+            case Opcode::LOAD_INTEGER:
+                sDst.nInt = poFeature->GetFieldAsInteger(sInstr.nParam);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nParam);
+                break;
+
+            case Opcode::LOAD_INTEGER64:
+                sDst.nInt = poFeature->GetFieldAsInteger64(sInstr.nParam);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nParam);
+                break;
+
+            case Opcode::LOAD_FLOAT:
+                sDst.dfFloat = poFeature->GetFieldAsDouble(sInstr.nParam);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nParam);
+                break;
+
+            case Opcode::LOAD_STRING:
+            {
+                // The field definition may have been altered since
+                // compilation.
+                const OGRFieldDefn *poFieldDefn =
+                    poFeature->GetFieldDefnRef(sInstr.nParam);
+                if (!poFieldDefn || poFieldDefn->GetType() != OFTString)
+                    return false;
+                sDst.pszString = poFeature->GetFieldAsString(sInstr.nParam);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nParam);
+                break;
+            }
+
+            case Opcode::TO_FLOAT:
+                sDst.dfFloat = static_cast<double>(sA.nInt);
+                sDst.bNull = sA.bNull;
+                break;
+
+            case Opcode::AND_SHORT_CIRCUIT:
+                if (!sA.bNull && !sA.nInt)
+                {
+                    sDst.nInt = 0;
+                    sDst.bNull = false;
+                    iPC = static_cast<size_t>(sInstr.nParam) - 1;
+                }
+                break;
+
+            case Opcode::AND:
+            {
+                const Value &sB = asRegs[sInstr.anSrc[1]];
+                sDst.nInt = sA.nInt && sB.nInt;
+                sDst.bNull = sA.bNull && sB.bNull;
+                break;
+            }
+
+            case Opcode::OR:
+            {
+                const Value &sB = asRegs[sInstr.anSrc[1]];
+                sDst.nInt = sA.nInt || sB.nInt;
+                sDst.bNull = sA.bNull || sB.bNull;
+                break;
+            }
+
+            case Opcode::NOT:
+                sDst.nInt = !sA.nInt && !sA.bNull;
+                sDst.bNull = sA.bNull;
+                break;
+
+            case Opcode::IS_NULL:
+                sDst.nInt = sA.bNull;
+                sDst.bNull = false;
+                break;
+
+            case Opcode::COMPARE:
+            case Opcode::BETWEEN:
+            {
+                const Value &sB = asRegs[sInstr.anSrc[1]];
+                const Value &sC = asRegs[sInstr.anSrc[2]];
+                sDst.nInt = 0;
+                sDst.bNull = sA.bNull || sB.bNull ||
+                             (sInstr.eOpcode == Opcode::BETWEEN && sC.bNull);
+                if (sDst.bNull)
+                    break;
+                if (sInstr.eOpcode == Opcode::BETWEEN)
+                {
+                    sDst.nInt = Compare(SWQ_GE, sInstr.eClass, sA, sB) &&
+                                Compare(SWQ_LE, sInstr.eClass, sA, sC);
+                }
+                else
+                {
+                    sDst.nInt =
+                        Compare(sInstr.eOperation, sInstr.eClass, sA, sB);
+                }
+                break;
+            }
+
+            case Opcode::IN:
+            {
+                sDst.nInt = 0;
+                sDst.bNull = sA.bNull;
+                if (sA.bNull)
+                    break;
+                bool bNullFound = false;
+                for (size_t i = 0; i < sInstr.nListCount; ++i)
+                {
+                    const Value &sItem =
+                        asRegs[anListRegisters[sInstr.nListStart + i]];
+                    if (sItem.bNull)
+                    {
+                        bNullFound = true;
+                    }
+                    else if (Equal(sInstr.eClass, sA, sItem))
+                    {
+                        sDst.nInt = 1;
+                        break;
+                    }
+                }
+                sDst.bNull = bNullFound && !sDst.nInt;
+                break;
+            }
+
+            case Opcode::IN_SORTED_INTEGERS:
+            {
+                const auto oBegin =
+                    anSortedIntegers.begin() + sInstr.nListStart;
+                sDst.nInt =
+                    !sA.bNull &&
+                    std::binary_search(oBegin, oBegin + sInstr.nListCount,
+                                       sA.nInt);
+                sDst.bNull = sA.bNull;
+                break;
+            }
+        }
+    }
+
+    nResultOut = CPL_TO_BOOL(static_cast<int>(asRegs[nResult].nInt));
+    return true;
+}
+
 /************************************************************************/
 /*                              Evaluate()                              */
 /************************************************************************/
@@ -311,6 +973,13 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    int nResult = FALSE;
+    if (m_poProgram && poFeature->GetDefnRef() == poTargetDefn &&
+        m_poProgram->Evaluate(poFeature, nResult))
+    {
+        return nResult;
+    }
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -343,6 +1012,107 @@ int OGRFeatureQuery::CanUseIndex(OGRLayer *poLayer)
     return CanUseIndex(psExpr, poLayer);
 }
 
+/************************************************************************/
+/*                      OGRIndexCanUseConstant()                        */
+/*                                                                      */
+/*      Whether a constant of a predicate can be looked up in the       */
+/*      index of a field, giving the same result as the evaluation of   */
+/*      the predicate.                                                  */
+/************************************************************************/
+
+static bool OGRIndexCanUseConstant(const OGRFieldDefn *poFieldDefn,
+                                   const swq_expr_node *poValue)
+{
+    if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null)
+        return false;
+
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        case OFTReal:
+            return poValue->field_type == SWQ_INTEGER ||
+                   poValue->field_type == SWQ_INTEGER64 ||
+                   poValue->field_type == SWQ_FLOAT;
+
+        case OFTString:
+        {
+            if (poValue->field_type != SWQ_STRING ||
+                poValue->string_value == nullptr)
+                return false;
+            // Equality tests of values looking like timestamps ignore a
+            // trailing +00 time zone. Do not attempt to emulate that.
+            const size_t nLen = strlen(poValue->string_value);
+            return !(nLen > 3 &&
+                     (poValue->string_value[nLen - 3] == ':' ||
+                      strcmp(poValue->string_value + nLen - 3, "+00") == 0));
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        OGRGetIndexForExpr()                          */
+/*                                                                      */
+/*      Return the attribute index that can be used to evaluate a       */
+/*      comparison of a column against constants, or nullptr.           */
+/************************************************************************/
+
+static OGRAttrIndex *OGRGetIndexForExpr(const swq_expr_node *psExpr,
+                                        OGRLayer *poLayer,
+                                        const OGRFieldDefn *&poFieldDefn)
+{
+    bool bRange = false;
+    switch (psExpr->nOperation)
+    {
+        case SWQ_EQ:
+        case SWQ_IN:
+            if (psExpr->nSubExprCount < 2)
+                return nullptr;
+            break;
+
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+            if (psExpr->nSubExprCount != 2)
+                return nullptr;
+            bRange = true;
+            break;
+
+        case SWQ_BETWEEN:
+            if (psExpr->nSubExprCount != 3)
+                return nullptr;
+            bRange = true;
+            break;
+
+        default:
+            return nullptr;
+    }
+
+    const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
+    if (poColumn->eNodeType != SNT_COLUMN)
+        return nullptr;
+
+    const int nIdx = OGRFeatureFetcherFixFieldIndex(poLayer->GetLayerDefn(),
+                                                    poColumn->field_index);
+    OGRAttrIndex *poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
+    if (poIndex == nullptr || (bRange && !poIndex->SupportsRangeMatches()))
+        return nullptr;
+
+    poFieldDefn = poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
+    for (int i = 1; i < psExpr->nSubExprCount; ++i)
+    {
+        if (!OGRIndexCanUseConstant(poFieldDefn, psExpr->papoSubExpr[i]))
+            return nullptr;
+    }
+
+    return poIndex;
+}
+
 int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
 {
     // Does the expression meet our requirements?
@@ -356,24 +1126,8 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
                CanUseIndex(psExpr->papoSubExpr[1], poLayer);
     }
 
-    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
-        psExpr->nSubExprCount < 2)
-        return FALSE;
-
-    swq_expr_node *poColumn = psExpr->papoSubExpr[0];
-    swq_expr_node *poValue = psExpr->papoSubExpr[1];
-
-    if (poColumn->eNodeType != SNT_COLUMN || poValue->eNodeType != SNT_CONSTANT)
-        return FALSE;
-
-    OGRAttrIndex *poIndex =
-        poLayer->GetIndex()->GetFieldIndex(OGRFeatureFetcherFixFieldIndex(
-            poLayer->GetLayerDefn(), poColumn->field_index));
-    if (poIndex == nullptr)
-        return FALSE;
-
-    // Have an index.
-    return TRUE;
+    const OGRFieldDefn *poFieldDefn = nullptr;
+    return OGRGetIndexForExpr(psExpr, poLayer, poFieldDefn) != nullptr;
 }
 
 /************************************************************************/
@@ -385,9 +1139,9 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
 /*      available indices, or an "OGRNullFID" terminated list of        */
 /*      FIDs if it can.                                                 */
 /*                                                                      */
-/*      For now we only support equality tests on a single indexed      */
-/*      attribute field.  Eventually we should make this support        */
-/*      multi-part queries with ranges.                                 */
+/*      Equality tests, IN lists and, when the index supports it,       */
+/*      range comparisons on indexed attribute fields are supported,    */
+/*      combined with AND and OR.                                       */
 /************************************************************************/
 
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(OGRLayer *poLayer,
@@ -530,6 +1284,66 @@ static GIntBig *OGRANDGIntBigArray(GIntBig panFIDList1[], GIntBig nFIDCount1,
     return panFIDList;
 }
 
+/************************************************************************/
+/*                       OGRGetIndexRangeBound()                        */
+/*                                                                      */
+/*      Convert the constant bound of a range comparison to a key of    */
+/*      the type of the indexed field. Non-integral bounds on integer   */
+/*      fields are rounded towards the inside of the range, so that     */
+/*      the lookup returns exactly the matching features.               */
+/************************************************************************/
+
+static bool OGRGetIndexRangeBound(const OGRFieldDefn *poFieldDefn,
+                                  const swq_expr_node *poValue, bool bLower,
+                                  OGRField &sKey, bool &bIncluded)
+{
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        {
+            GIntBig nValue = poValue->int_value;
+            if (poValue->field_type == SWQ_FLOAT)
+            {
+                const double dfValue = poValue->float_value;
+                const double dfRounded =
+                    bLower ? std::ceil(dfValue) : std::floor(dfValue);
+                // Reject NaN and values outside of the GIntBig range.
+                if (!(dfRounded >= -9.2e18 && dfRounded <= 9.2e18))
+                    return false;
+                if (dfRounded != dfValue)
+                    bIncluded = true;
+                nValue = static_cast<GIntBig>(dfRounded);
+            }
+            if (poFieldDefn->GetType() == OFTInteger64)
+            {
+                sKey.Integer64 = nValue;
+            }
+            else
+            {
+                if (nValue < INT_MIN || nValue > INT_MAX)
+                    return false;
+                sKey.Integer = static_cast<int>(nValue);
+            }
+            return true;
+        }
+
+        case OFTReal:
+            sKey.Real = poValue->field_type == SWQ_FLOAT
+                            ? poValue->float_value
+                            : static_cast<double>(poValue->int_value);
+            return !std::isnan(sKey.Real);
+
+        case OFTString:
+            sKey.String = poValue->string_value;
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
                                                  OGRLayer *poLayer,
                                                  GIntBig &nFIDCount)
@@ -567,27 +1381,74 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         return panFIDList;
     }
 
-    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
-        psExpr->nSubExprCount < 2)
+    const OGRFieldDefn *poFieldDefn = nullptr;
+    OGRAttrIndex *poIndex = OGRGetIndexForExpr(psExpr, poLayer, poFieldDefn);
+    if (poIndex == nullptr)
         return nullptr;
 
-    const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
-    const swq_expr_node *poValue = psExpr->papoSubExpr[1];
+    // Handle range comparisons.
+    if (psExpr->nOperation != SWQ_EQ && psExpr->nOperation != SWQ_IN)
+    {
+        OGRField sMin;
+        OGRField sMax;
+        bool bHasMin = false;
+        bool bHasMax = false;
+        bool bMinIncluded = true;
+        bool bMaxIncluded = true;
+        switch (psExpr->nOperation)
+        {
+            case SWQ_LT:
+            case SWQ_LE:
+                bMaxIncluded = psExpr->nOperation == SWQ_LE;
+                bHasMax = OGRGetIndexRangeBound(poFieldDefn,
+                                                psExpr->papoSubExpr[1], false,
+                                                sMax, bMaxIncluded);
+                if (!bHasMax)
+                    return nullptr;
+                break;
 
-    if (poColumn->eNodeType != SNT_COLUMN || poValue->eNodeType != SNT_CONSTANT)
-        return nullptr;
+            case SWQ_GT:
+            case SWQ_GE:
+                bMinIncluded = psExpr->nOperation == SWQ_GE;
+                bHasMin = OGRGetIndexRangeBound(poFieldDefn,
+                                                psExpr->papoSubExpr[1], true,
+                                                sMin, bMinIncluded);
+                if (!bHasMin)
+                    return nullptr;
+                break;
 
-    const int nIdx = OGRFeatureFetcherFixFieldIndex(poLayer->GetLayerDefn(),
-                                                    poColumn->field_index);
+            default:
+                CPLAssert(psExpr->nOperation == SWQ_BETWEEN);
+                bHasMin = OGRGetIndexRangeBound(poFieldDefn,
+                                                psExpr->papoSubExpr[1], true,
+                                                sMin, bMinIncluded);
+                bHasMax = OGRGetIndexRangeBound(poFieldDefn,
+                                                psExpr->papoSubExpr[2], false,
+                                                sMax, bMaxIncluded);
+                if (!bHasMin || !bHasMax)
+                    return nullptr;
+                break;
+        }
 
-    OGRAttrIndex *poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
-    if (poIndex == nullptr)
-        return nullptr;
+        int nLength = 0;
+        int nFIDCount32 = 0;
+        GIntBig *panFIDs = poIndex->GetRangeMatches(
+            bHasMin ? &sMin : nullptr, bMinIncluded, bHasMax ? &sMax : nullptr,
+            bMaxIncluded, nullptr, &nFIDCount32, &nLength);
+        if (panFIDs == nullptr)
+            return nullptr;
+        nFIDCount = nFIDCount32;
+        if (nFIDCount > 1)
+        {
+            // The returned FIDs are expected to be sorted.
+            std::sort(panFIDs, panFIDs + nFIDCount);
+        }
+        return panFIDs;
+    }
 
     // Have an index, now we need to query it.
     OGRField sValue;
-    const OGRFieldDefn *poFieldDefn =
-        poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
+    const swq_expr_node *poValue = psExpr->papoSubExpr[1];
 
     // Handle the case of an IN operation.
     if (psExpr->nOperation == SWQ_IN)
@@ -638,8 +1499,11 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
 
         if (nFIDCount > 1)
         {
-            // The returned FIDs are expected to be in sorted order.
+            // The returned FIDs are expected to be in sorted order, and
+            // without duplicates if the IN list has repeated values.
             std::sort(panFIDs, panFIDs + nFIDCount);
+            nFIDCount = std::unique(panFIDs, panFIDs + nFIDCount) - panFIDs;
+            panFIDs[nFIDCount] = OGRNullFID;
         }
         return panFIDs;
     }
@@ -16,6 +16,7 @@
 #define JSON_C_VER_013 (13 << 8)
 
 #include "ogrgeojsonwriter.h"
+#include "cpl_json_streaming_writer.h"
 #include "ogr_geometry.h"
 #include "ogrgeojsongeometry.h"
 #include "ogrlibjsonutils.h"
@@ -1523,6 +1524,223 @@ json_object *OGRGeoJSONWriteRingCoords(const OGRLinearRing *poLine,
     return poObjCoords;
 }
 
+/************************************************************************/
+/*                       OGRGeoJSONFormatCoord()                        */
+/************************************************************************/
+
+/** Same formatting as json_object_new_coord(), without json_object */
+static std::string OGRGeoJSONFormatCoord(double dfVal, int nDimIdx,
+                                         const OGRGeoJSONWriteOptions &oOptions)
+{
+    if (nDimIdx <= 2)
+    {
+        if (oOptions.nXYCoordPrecision >= 0 || oOptions.nSignificantFigures < 0)
+            return OGRJSonFormatDoubleWithPrecision(
+                dfVal, oOptions.nXYCoordPrecision);
+    }
+    else
+    {
+        if (oOptions.nZCoordPrecision >= 0 || oOptions.nSignificantFigures < 0)
+            return OGRJSonFormatDoubleWithPrecision(
+                dfVal, oOptions.nZCoordPrecision);
+    }
+
+    return OGRJSonFormatDoubleWithSignificantFigures(
+        dfVal, oOptions.nSignificantFigures);
+}
+
+/************************************************************************/
+/*                   OGRGeoJSONWriteCoords() (streaming)                */
+/************************************************************************/
+
+static bool OGRGeoJSONWriteCoords(CPLJSonStreamingWriter &oWriter, double dfX,
+                                  double dfY, const double *pdfZ,
+                                  const OGRGeoJSONWriteOptions &oOptions)
+{
+    if (!std::isfinite(dfX) || !std::isfinite(dfY) ||
+        (pdfZ && !std::isfinite(*pdfZ)))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Infinite or NaN coordinate encountered");
+        return false;
+    }
+    auto oCoordsContext(
+        oWriter.MakeArrayContext(/* bForceSingleLine = */ true));
+    oWriter.AddSerializedValue(OGRGeoJSONFormatCoord(dfX, 1, oOptions));
+    oWriter.AddSerializedValue(OGRGeoJSONFormatCoord(dfY, 2, oOptions));
+    if (pdfZ)
+        oWriter.AddSerializedValue(OGRGeoJSONFormatCoord(*pdfZ, 3, oOptions));
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONWriteLineCoords() (streaming)              */
+/************************************************************************/
+
+static bool OGRGeoJSONWriteLineCoords(CPLJSonStreamingWriter &oWriter,
+                                      const OGRSimpleCurve *poLine,
+                                      bool bInvertOrder,
+                                      const OGRGeoJSONWriteOptions &oOptions)
+{
+    auto oLineContext(oWriter.MakeArrayContext());
+    const int nCount = poLine->getNumPoints();
+    const bool bHasZ = wkbHasZ(poLine->getGeometryType());
+    for (int i = 0; i < nCount; ++i)
+    {
+        const int nIdx = (bInvertOrder) ? nCount - 1 - i : i;
+        const double dfZ = bHasZ ? poLine->getZ(nIdx) : 0.0;
+        if (!OGRGeoJSONWriteCoords(oWriter, poLine->getX(nIdx),
+                                   poLine->getY(nIdx), bHasZ ? &dfZ : nullptr,
+                                   oOptions))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONWritePolygon() (streaming)                 */
+/************************************************************************/
+
+static bool OGRGeoJSONWritePolygon(CPLJSonStreamingWriter &oWriter,
+                                   const OGRPolygon *poPolygon,
+                                   const OGRGeoJSONWriteOptions &oOptions)
+{
+    auto oPolygonContext(oWriter.MakeArrayContext());
+    bool bIsExteriorRing = true;
+    for (const auto *poRing : *poPolygon)
+    {
+        const bool bInvertOrder =
+            oOptions.bPolygonRightHandRule &&
+            ((bIsExteriorRing && poRing->isClockwise()) ||
+             (!bIsExteriorRing && !poRing->isClockwise()));
+        if (!OGRGeoJSONWriteLineCoords(oWriter, poRing, bInvertOrder,
+                                       oOptions))
+        {
+            return false;
+        }
+        bIsExteriorRing = false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONWriteCoordinates() (streaming)             */
+/************************************************************************/
+
+/** Writes the "coordinates" array of a non-collection geometry */
+static bool OGRGeoJSONWriteCoordinates(CPLJSonStreamingWriter &oWriter,
+                                       const OGRGeometry *poGeometry,
+                                       const OGRGeoJSONWriteOptions &oOptions)
+{
+    switch (wkbFlatten(poGeometry->getGeometryType()))
+    {
+        case wkbPoint:
+        {
+            const OGRPoint *poPoint = poGeometry->toPoint();
+            if (poPoint->Is3D())
+            {
+                const double dfZ = poPoint->getZ();
+                return OGRGeoJSONWriteCoords(oWriter, poPoint->getX(),
+                                             poPoint->getY(), &dfZ, oOptions);
+            }
+            else if (!poPoint->IsEmpty())
+            {
+                return OGRGeoJSONWriteCoords(oWriter, poPoint->getX(),
+                                             poPoint->getY(), nullptr,
+                                             oOptions);
+            }
+            return false;
+        }
+
+        case wkbLineString:
+            return OGRGeoJSONWriteLineCoords(
+                oWriter, poGeometry->toLineString(),
+                /* bInvertOrder = */ false, oOptions);
+
+        case wkbPolygon:
+            return OGRGeoJSONWritePolygon(oWriter, poGeometry->toPolygon(),
+                                          oOptions);
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        {
+            auto oPartsContext(oWriter.MakeArrayContext());
+            for (const auto *poPart : *(poGeometry->toGeometryCollection()))
+            {
+                if (!OGRGeoJSONWriteCoordinates(oWriter, poPart, oOptions))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONWriteGeometry() (streaming)                */
+/************************************************************************/
+
+/** Serializes a geometry as a GeoJSON geometry object into a streaming
+ * writer, without building an intermediate json_object tree.
+ *
+ * Coordinates are formatted as OGRGeoJSONWriteGeometry() does.
+ * An empty point is written as a null value.
+ *
+ * @return true in case of success. In case of failure (unsupported geometry
+ * type, or non-finite coordinate value), false is returned and what has been
+ * written to oWriter should be discarded by the caller.
+ */
+bool OGRGeoJSONWriteGeometry(CPLJSonStreamingWriter &oWriter,
+                             const OGRGeometry *poGeometry,
+                             const OGRGeoJSONWriteOptions &oOptions)
+{
+    const OGRwkbGeometryType eFType =
+        wkbFlatten(poGeometry->getGeometryType());
+    if (eFType == wkbPoint && poGeometry->IsEmpty())
+    {
+        oWriter.AddNull();
+        return true;
+    }
+    if (eFType < wkbPoint || eFType > wkbGeometryCollection)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "OGR geometry type unsupported as a GeoJSON geometry "
+                 "detected. Feature gets NULL geometry assigned.");
+        return false;
+    }
+
+    auto oGeomContext(oWriter.MakeObjectContext());
+    oWriter.AddObjKey("type");
+    oWriter.Add(OGRGeoJSONGetGeometryName(poGeometry));
+    if (eFType == wkbGeometryCollection)
+    {
+        oWriter.AddObjKey("geometries");
+        auto oGeometriesContext(oWriter.MakeArrayContext());
+        for (const auto *poSubGeom : *(poGeometry->toGeometryCollection()))
+        {
+            // Consistent with the json_object based writer that does not
+            // accept empty points in collections
+            if (wkbFlatten(poSubGeom->getGeometryType()) == wkbPoint &&
+                poSubGeom->IsEmpty())
+            {
+                return false;
+            }
+            if (!OGRGeoJSONWriteGeometry(oWriter, poSubGeom, oOptions))
+                return false;
+        }
+        return true;
+    }
+
+    oWriter.AddObjKey("coordinates");
+    return OGRGeoJSONWriteCoordinates(oWriter, poGeometry, oOptions);
+}
+
 /************************************************************************/
 /*             OGR_json_float_with_significant_figures_to_string()      */
 /************************************************************************/
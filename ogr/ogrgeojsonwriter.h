@@ -21,6 +21,7 @@
 #include "cpl_json_header.h"
 #include "cpl_string.h"
 
+class CPLJSonStreamingWriter;
 class OGRFeature;
 class OGRGeometry;
 class OGRPolygon;
@@ -73,6 +74,10 @@ OGRGeoJSONWriteGeometry(const OGRGeometry *poGeometry,
 json_object *OGRGeoJSONWritePolygon(const OGRPolygon *poPolygon,
                                     const OGRGeoJSONWriteOptions &oOptions);
 
+bool CPL_DLL OGRGeoJSONWriteGeometry(CPLJSonStreamingWriter &oWriter,
+                                     const OGRGeometry *poGeometry,
+                                     const OGRGeoJSONWriteOptions &oOptions);
+
 /*! @endcond */
 
 #endif /* OGR_GEOJSONWRITER_H_INCLUDED */
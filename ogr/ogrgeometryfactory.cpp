@@ -16,7 +16,10 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_quad_tree.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_geometry.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
@@ -39,7 +42,9 @@
 #include <cstddef>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <new>
 #include <utility>
 #include <vector>
@@ -1523,6 +1528,228 @@ static bool OGRGeometryFactoryCompareByIndex(const sPolyExtended &sPoly1,
     return sPoly1.nInitialIndex < sPoly2.nInitialIndex;
 }
 
+/************************************************************************/
+/*                   OGRGeometryFactoryIsInsideFast()                   */
+/************************************************************************/
+
+// Returns whether the ring of sPolyI is inside the one of sPolyJ, whose
+// envelope is assumed to contain the one of sPolyI. For speed, this only
+// tests the first point of sPolyI that is not on the boundary of sPolyJ.
+static bool OGRGeometryFactoryIsInsideFast(const sPolyExtended &sPolyI,
+                                           const sPolyExtended &sPolyJ)
+{
+    if (!sPolyI.bIsPolygon || !sPolyJ.bIsPolygon)
+        return false;
+
+    const OGRLinearRing *poLR_i = sPolyI.poExteriorRing->toLinearRing();
+    const OGRLinearRing *poLR_j = sPolyJ.poExteriorRing->toLinearRing();
+
+    // Note that isPointInRing only test strict inclusion in the ring.
+    if (!poLR_j->isPointOnRingBoundary(&sPolyI.poAPoint, FALSE))
+        return CPL_TO_BOOL(poLR_j->isPointInRing(&sPolyI.poAPoint, FALSE));
+
+    // If the point of i is on the boundary of j, we will iterate over the
+    // other points of i.
+    const int nPoints = poLR_i->getNumPoints();
+    int k = 1;  // Used after for.
+    OGRPoint previousPoint = sPolyI.poAPoint;
+    for (; k < nPoints; k++)
+    {
+        OGRPoint point;
+        poLR_i->getPoint(k, &point);
+        if (point.getX() == previousPoint.getX() &&
+            point.getY() == previousPoint.getY())
+        {
+            continue;
+        }
+        if (poLR_j->isPointOnRingBoundary(&point, FALSE))
+        {
+            // If it is on the boundary of j, iterate again.
+        }
+        else if (poLR_j->isPointInRing(&point, FALSE))
+        {
+            // If then point is strictly included in j, then i is considered
+            // inside j.
+            return true;
+        }
+        else
+        {
+            // If it is outside, then i cannot be inside j.
+            return false;
+        }
+        previousPoint = std::move(point);
+    }
+
+    if (nPoints > 2)
+    {
+        // All points of i are on the boundary of j.
+        // Take a point in the middle of a segment of i and test it against j.
+        poLR_i->getPoint(0, &previousPoint);
+        for (k = 1; k < nPoints; k++)
+        {
+            OGRPoint point;
+            poLR_i->getPoint(k, &point);
+            if (point.getX() == previousPoint.getX() &&
+                point.getY() == previousPoint.getY())
+            {
+                continue;
+            }
+            OGRPoint pointMiddle;
+            pointMiddle.setX((point.getX() + previousPoint.getX()) / 2);
+            pointMiddle.setY((point.getY() + previousPoint.getY()) / 2);
+            if (poLR_j->isPointOnRingBoundary(&pointMiddle, FALSE))
+            {
+                // If it is on the boundary of j, iterate again.
+            }
+            else if (poLR_j->isPointInRing(&pointMiddle, FALSE))
+            {
+                // If then point is strictly included in j, then i is
+                // considered inside j.
+                return true;
+            }
+            else
+            {
+                // If it is outside, then i cannot be inside j.
+                return false;
+            }
+            previousPoint = std::move(point);
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                OGRGeometryFactoryFindEnclosingIndexed()              */
+/************************************************************************/
+
+// Equivalent of the fast version of STEP 2 of organizePolygons() to find,
+// for each polygon i, the polygon j < i of smallest area that encloses it,
+// but using a spatial index over the envelopes instead of testing all the
+// polygons of larger area, and spreading the work over several threads.
+// anEnclosing[i] is set to -1 if no enclosing polygon is found.
+static void OGRGeometryFactoryFindEnclosingIndexed(
+    const std::vector<sPolyExtended> &asPolyEx, bool bOnlyCCW,
+    std::vector<int> &anEnclosing)
+{
+    const int nPolys = static_cast<int>(asPolyEx.size());
+    anEnclosing.assign(nPolys, -1);
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = std::numeric_limits<double>::infinity();
+    sGlobalBounds.miny = std::numeric_limits<double>::infinity();
+    sGlobalBounds.maxx = -std::numeric_limits<double>::infinity();
+    sGlobalBounds.maxy = -std::numeric_limits<double>::infinity();
+    for (const auto &sPolyEx : asPolyEx)
+    {
+        const auto &sEnvelope = sPolyEx.sEnvelope;
+        sGlobalBounds.minx = std::min(sGlobalBounds.minx, sEnvelope.MinX);
+        sGlobalBounds.miny = std::min(sGlobalBounds.miny, sEnvelope.MinY);
+        sGlobalBounds.maxx = std::max(sGlobalBounds.maxx, sEnvelope.MaxX);
+        sGlobalBounds.maxy = std::max(sGlobalBounds.maxy, sEnvelope.MaxY);
+    }
+
+    std::unique_ptr<CPLQuadTree, decltype(&CPLQuadTreeDestroy)> poTree(
+        CPLQuadTreeCreate(&sGlobalBounds, nullptr), CPLQuadTreeDestroy);
+    CPLQuadTreeSetMaxDepth(poTree.get(), CPLQuadTreeGetAdvisedMaxDepth(nPolys));
+    const auto GetRect = [](const OGREnvelope &sEnvelope)
+    {
+        CPLRectObj sRect;
+        sRect.minx = sEnvelope.MinX;
+        sRect.miny = sEnvelope.MinY;
+        sRect.maxx = sEnvelope.MaxX;
+        sRect.maxy = sEnvelope.MaxY;
+        return sRect;
+    };
+    for (int j = 0; j < nPolys; j++)
+    {
+        // In ONLY_CCW mode, a CCW ring can only be included in a CW one.
+        if (!bOnlyCCW || asPolyEx[j].bIsCW)
+        {
+            const CPLRectObj sRect = GetRect(asPolyEx[j].sEnvelope);
+            CPLQuadTreeInsertWithBounds(
+                poTree.get(),
+                reinterpret_cast<void *>(static_cast<uintptr_t>(j)), &sRect);
+        }
+    }
+
+    const auto FindEnclosing = [&asPolyEx, &anEnclosing, &poTree, &GetRect,
+                                bOnlyCCW, nPolys](int iStart, int iStep)
+    {
+        std::vector<int> anCandidates;
+        for (int i = iStart; i < nPolys; i += iStep)
+        {
+            if (bOnlyCCW && asPolyEx[i].bIsCW)
+                continue;
+
+            const CPLRectObj sRect = GetRect(asPolyEx[i].sEnvelope);
+            int nCount = 0;
+            void **pahFeatures =
+                CPLQuadTreeSearch(poTree.get(), &sRect, &nCount);
+            anCandidates.clear();
+            for (int iFeature = 0; iFeature < nCount; iFeature++)
+            {
+                const int j = static_cast<int>(
+                    reinterpret_cast<uintptr_t>(pahFeatures[iFeature]));
+                if (j < i &&
+                    asPolyEx[j].sEnvelope.Contains(asPolyEx[i].sEnvelope))
+                    anCandidates.push_back(j);
+            }
+            CPLFree(pahFeatures);
+
+            // Test candidates by increasing area, as the sequential
+            // algorithm does.
+            std::sort(anCandidates.begin(), anCandidates.end(),
+                      std::greater<int>());
+            for (const int j : anCandidates)
+            {
+                // In ONLY_CCW mode, a CCW ring must be inside the biggest
+                // CW ring if it is the last candidate.
+                if ((bOnlyCCW && j == 0) ||
+                    OGRGeometryFactoryIsInsideFast(asPolyEx[i], asPolyEx[j]))
+                {
+                    anEnclosing[i] = j;
+                    break;
+                }
+            }
+        }
+    };
+
+    constexpr int MIN_POLYGONS_PER_THREAD = 1000;
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(1, std::min(2 * nThreads, atoi(pszNumThreads)));
+    nThreads = std::min(nThreads, nPolys / MIN_POLYGONS_PER_THREAD);
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    if (nThreads > 1)
+    {
+        poThreadReservation = std::make_unique<GDALThreadReservation>(nThreads);
+        nThreads = poThreadReservation->GetThreadCount();
+        if (nThreads > 1)
+            poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    }
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (int iThread = 0; iThread < nThreads; iThread++)
+        {
+            const auto Job = [&FindEnclosing, iThread, nThreads]()
+            { FindEnclosing(1 + iThread, nThreads); };
+            if (!poJobQueue->SubmitJob(Job))
+            {
+                FindEnclosing(1 + iThread, nThreads);
+            }
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        FindEnclosing(1, 1);
+    }
+}
+
 constexpr int N_CRITICAL_PART_NUMBER = 100;
 
 enum OrganizePolygonMethod
@@ -1932,8 +2159,40 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
 
     int nCountTopLevel = 1;
 
+    // STEP 2, for a large number of polygons: find the enclosing polygon of
+    // each polygon using a spatial index, and then determine which ones are
+    // top-level.
+    constexpr int N_MIN_PART_NUMBER_FOR_INDEX = 1000;
+    const bool bUseIndex =
+        !bMixedUpGeometries && bUseFastVersion &&
+        static_cast<int>(asPolyEx.size()) >= N_MIN_PART_NUMBER_FOR_INDEX;
+    if (bUseIndex)
+    {
+        std::vector<int> anEnclosing;
+        OGRGeometryFactoryFindEnclosingIndexed(
+            asPolyEx, method == METHOD_ONLY_CCW, anEnclosing);
+        for (int i = 1; i < static_cast<int>(asPolyEx.size()); i++)
+        {
+            const int j = anEnclosing[i];
+            if (j >= 0 && asPolyEx[j].bIsTopLevel)
+            {
+                // We are a lake.
+                asPolyEx[i].bIsTopLevel = false;
+                asPolyEx[i].poEnclosingPolygon = asPolyEx[j].poPolygon;
+            }
+            else
+            {
+                // We are not included in anything, or included in something
+                // not toplevel (a lake), so in OGCSF we are toplevel.
+                nCountTopLevel++;
+                asPolyEx[i].bIsTopLevel = true;
+                asPolyEx[i].poEnclosingPolygon = nullptr;
+            }
+        }
+    }
+
     // STEP 2.
-    for (int i = 1; !bMixedUpGeometries && bValidTopology &&
+    for (int i = 1; !bMixedUpGeometries && !bUseIndex && bValidTopology &&
                     i < static_cast<int>(asPolyEx.size());
          i++)
     {
@@ -1969,101 +2228,10 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
                         // broken.
                         b_i_inside_j = true;
                     }
-                    else if (asPolyEx[i].bIsPolygon && asPolyEx[j].bIsPolygon &&
-                             asPolyEx[j]
-                                 .poExteriorRing->toLinearRing()
-                                 ->isPointOnRingBoundary(&asPolyEx[i].poAPoint,
-                                                         FALSE))
-                    {
-                        OGRLinearRing *poLR_i =
-                            asPolyEx[i].poExteriorRing->toLinearRing();
-                        OGRLinearRing *poLR_j =
-                            asPolyEx[j].poExteriorRing->toLinearRing();
-
-                        // If the point of i is on the boundary of j, we will
-                        // iterate over the other points of i.
-                        const int nPoints = poLR_i->getNumPoints();
-                        int k = 1;  // Used after for.
-                        OGRPoint previousPoint = asPolyEx[i].poAPoint;
-                        for (; k < nPoints; k++)
-                        {
-                            OGRPoint point;
-                            poLR_i->getPoint(k, &point);
-                            if (point.getX() == previousPoint.getX() &&
-                                point.getY() == previousPoint.getY())
-                            {
-                                continue;
-                            }
-                            if (poLR_j->isPointOnRingBoundary(&point, FALSE))
-                            {
-                                // If it is on the boundary of j, iterate again.
-                            }
-                            else if (poLR_j->isPointInRing(&point, FALSE))
-                            {
-                                // If then point is strictly included in j, then
-                                // i is considered inside j.
-                                b_i_inside_j = true;
-                                break;
-                            }
-                            else
-                            {
-                                // If it is outside, then i cannot be inside j.
-                                break;
-                            }
-                            previousPoint = std::move(point);
-                        }
-                        if (!b_i_inside_j && k == nPoints && nPoints > 2)
-                        {
-                            // All points of i are on the boundary of j.
-                            // Take a point in the middle of a segment of i and
-                            // test it against j.
-                            poLR_i->getPoint(0, &previousPoint);
-                            for (k = 1; k < nPoints; k++)
-                            {
-                                OGRPoint point;
-                                poLR_i->getPoint(k, &point);
-                                if (point.getX() == previousPoint.getX() &&
-                                    point.getY() == previousPoint.getY())
-                                {
-                                    continue;
-                                }
-                                OGRPoint pointMiddle;
-                                pointMiddle.setX(
-                                    (point.getX() + previousPoint.getX()) / 2);
-                                pointMiddle.setY(
-                                    (point.getY() + previousPoint.getY()) / 2);
-                                if (poLR_j->isPointOnRingBoundary(&pointMiddle,
-                                                                  FALSE))
-                                {
-                                    // If it is on the boundary of j, iterate
-                                    // again.
-                                }
-                                else if (poLR_j->isPointInRing(&pointMiddle,
-                                                               FALSE))
-                                {
-                                    // If then point is strictly included in j,
-                                    // then i is considered inside j.
-                                    b_i_inside_j = true;
-                                    break;
-                                }
-                                else
-                                {
-                                    // If it is outside, then i cannot be inside
-                                    // j.
-                                    break;
-                                }
-                                previousPoint = std::move(point);
-                            }
-                        }
-                    }
-                    // Note that isPointInRing only test strict inclusion in the
-                    // ring.
-                    else if (asPolyEx[i].bIsPolygon && asPolyEx[j].bIsPolygon &&
-                             asPolyEx[j]
-                                 .poExteriorRing->toLinearRing()
-                                 ->isPointInRing(&asPolyEx[i].poAPoint, FALSE))
+                    else
                     {
-                        b_i_inside_j = true;
+                        b_i_inside_j = OGRGeometryFactoryIsInsideFast(
+                            asPolyEx[i], asPolyEx[j]);
                     }
                 }
                 else if (asPolyEx[j].poPolygon->Contains(asPolyEx[i].poPolygon))
@@ -117,6 +117,29 @@ json_object *OGRGeoJSONFindMemberByName(json_object *poObj, const char *pszName)
     return static_cast<json_object *>(const_cast<void *>(entry->v));
 }
 
+/************************************************************************/
+/*                 OGRJSonFormatDoubleWithPrecision()                   */
+/************************************************************************/
+
+std::string OGRJSonFormatDoubleWithPrecision(double dfVal, int nPrecision)
+{
+    if (fabs(dfVal) > 1e50 && !std::isinf(dfVal))
+    {
+        char szBuffer[75] = {};
+        const int nLen =
+            CPLsnprintf(szBuffer, sizeof(szBuffer), "%.17g", dfVal);
+        return std::string(szBuffer, nLen);
+    }
+    else
+    {
+        OGRWktOptions opts(nPrecision < 0 ? 15 : nPrecision,
+                           /* round = */ true);
+        opts.format = OGRWktFormat::F;
+
+        return OGRFormatDouble(dfVal, opts, 1);
+    }
+}
+
 /************************************************************************/
 /*               OGR_json_double_with_precision_to_string()             */
 /************************************************************************/
@@ -134,27 +157,12 @@ static int OGR_json_double_with_precision_to_string(struct json_object *jso,
 #endif
     // Precision is stored as a uintptr_t content casted to void*
     const uintptr_t nPrecisionIn = reinterpret_cast<uintptr_t>(userData);
-    const double dfVal = json_object_get_double(jso);
-    if (fabs(dfVal) > 1e50 && !std::isinf(dfVal))
-    {
-        char szBuffer[75] = {};
-        const size_t nLen =
-            CPLsnprintf(szBuffer, sizeof(szBuffer), "%.17g", dfVal);
-        return printbuf_memappend(pb, szBuffer, static_cast<int>(nLen));
-    }
-    else
-    {
-        const bool bPrecisionIsNegative =
-            (nPrecisionIn >> (8 * sizeof(nPrecisionIn) - 1)) != 0;
-        const int nPrecision =
-            bPrecisionIsNegative ? 15 : static_cast<int>(nPrecisionIn);
-        OGRWktOptions opts(nPrecision, /* round = */ true);
-        opts.format = OGRWktFormat::F;
-
-        const std::string s = OGRFormatDouble(dfVal, opts, 1);
-
-        return printbuf_memappend(pb, s.data(), static_cast<int>(s.size()));
-    }
+    const bool bPrecisionIsNegative =
+        (nPrecisionIn >> (8 * sizeof(nPrecisionIn) - 1)) != 0;
+    const std::string s = OGRJSonFormatDoubleWithPrecision(
+        json_object_get_double(jso),
+        bPrecisionIsNegative ? -1 : static_cast<int>(nPrecisionIn));
+    return printbuf_memappend(pb, s.data(), static_cast<int>(s.size()));
 }
 
 /************************************************************************/
@@ -173,16 +181,14 @@ json_object *json_object_new_double_with_precision(double dfVal,
 }
 
 /************************************************************************/
-/*             OGR_json_double_with_significant_figures_to_string()     */
+/*            OGRJSonFormatDoubleWithSignificantFigures()               */
 /************************************************************************/
 
-static int OGR_json_double_with_significant_figures_to_string(
-    struct json_object *jso, struct printbuf *pb, int /* level */,
-    int /* flags */)
+std::string OGRJSonFormatDoubleWithSignificantFigures(double dfVal,
+                                                      int nSignificantFigures)
 {
     char szBuffer[75] = {};
     int nSize = 0;
-    const double dfVal = json_object_get_double(jso);
     if (std::isnan(dfVal))
         nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), "NaN");
     else if (std::isinf(dfVal))
@@ -195,20 +201,8 @@ static int OGR_json_double_with_significant_figures_to_string(
     else
     {
         char szFormatting[32] = {};
-        const void *userData =
-#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
-            jso->_userdata;
-#else
-            json_object_get_userdata(jso);
-#endif
-        const uintptr_t nSignificantFigures =
-            reinterpret_cast<uintptr_t>(userData);
-        const bool bSignificantFiguresIsNegative =
-            (nSignificantFigures >> (8 * sizeof(nSignificantFigures) - 1)) != 0;
         const int nInitialSignificantFigures =
-            bSignificantFiguresIsNegative
-                ? 17
-                : static_cast<int>(nSignificantFigures);
+            nSignificantFigures < 0 ? 17 : nSignificantFigures;
         CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
                     nInitialSignificantFigures);
         nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting, dfVal);
@@ -253,7 +247,31 @@ static int OGR_json_double_with_significant_figures_to_string(
         }
     }
 
-    return printbuf_memappend(pb, szBuffer, nSize);
+    return std::string(szBuffer, nSize);
+}
+
+/************************************************************************/
+/*             OGR_json_double_with_significant_figures_to_string()     */
+/************************************************************************/
+
+static int OGR_json_double_with_significant_figures_to_string(
+    struct json_object *jso, struct printbuf *pb, int /* level */,
+    int /* flags */)
+{
+    const void *userData =
+#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
+        jso->_userdata;
+#else
+        json_object_get_userdata(jso);
+#endif
+    const uintptr_t nSignificantFigures = reinterpret_cast<uintptr_t>(userData);
+    const bool bSignificantFiguresIsNegative =
+        (nSignificantFigures >> (8 * sizeof(nSignificantFigures) - 1)) != 0;
+    const std::string s = OGRJSonFormatDoubleWithSignificantFigures(
+        json_object_get_double(jso),
+        bSignificantFiguresIsNegative ? -1
+                                      : static_cast<int>(nSignificantFigures));
+    return printbuf_memappend(pb, s.data(), static_cast<int>(s.size()));
 }
 
 /************************************************************************/
@@ -12,6 +12,8 @@
 
 #include "ogr_api.h"
 
+#include <string>
+
 bool CPL_DLL OGRJSonParse(const char *pszText, json_object **ppoObj,
                           bool bVerboseError = true);
 
@@ -37,6 +39,15 @@ OGRFieldType CPL_DLL GeoJSONPropertyToFieldType(json_object *poObject,
                                                 OGRFieldSubType &eSubType,
                                                 bool bArrayAsString = false);
 
+/* Same formatting as json_object_new_double_with_precision() */
+std::string CPL_DLL OGRJSonFormatDoubleWithPrecision(double dfVal,
+                                                     int nCoordPrecision);
+
+/* Same formatting as json_object_new_double_with_significant_figures() */
+std::string CPL_DLL
+OGRJSonFormatDoubleWithSignificantFigures(double dfVal,
+                                          int nSignificantFigures);
+
 CPL_C_START
 /* %.XXXf formatting */
 json_object CPL_DLL *json_object_new_double_with_precision(double dfVal,
@@ -2545,33 +2545,37 @@ OGRErr OGRSimpleCurve::transform(OGRCoordinateTransformation *poCT)
     /*   keep only valid reprojected points if partial reprojection enabled */
     /*   or keeping intact the original geometry if only full reprojection  */
     /*   allowed.                                                           */
+    /*   The Z array is only needed if the curve has a Z dimension, as      */
+    /*   a missing Z is equivalent to a zero elevation for Transform().     */
     /* -------------------------------------------------------------------- */
+    const int nDims = padfZ ? 3 : 2;
     double *xyz = static_cast<double *>(
-        VSI_MALLOC_VERBOSE(sizeof(double) * nPointCount * 3));
+        VSI_MALLOC2_VERBOSE(sizeof(double) * nDims, nPointCount));
     int *pabSuccess =
         static_cast<int *>(VSI_CALLOC_VERBOSE(sizeof(int), nPointCount));
-    if (xyz == nullptr || pabSuccess == nullptr)
+    if ((xyz == nullptr || pabSuccess == nullptr) && nPointCount != 0)
     {
         VSIFree(xyz);
         VSIFree(pabSuccess);
         return OGRERR_NOT_ENOUGH_MEMORY;
     }
 
+    double *const padfX = xyz;
+    double *const padfY = xyz + nPointCount;
+    double *const padfZTransformed = padfZ ? xyz + nPointCount * 2 : nullptr;
     for (int i = 0; i < nPointCount; i++)
     {
-        xyz[i] = paoPoints[i].x;
-        xyz[i + nPointCount] = paoPoints[i].y;
-        if (padfZ)
-            xyz[i + nPointCount * 2] = padfZ[i];
-        else
-            xyz[i + nPointCount * 2] = 0.0;
+        padfX[i] = paoPoints[i].x;
+        padfY[i] = paoPoints[i].y;
     }
+    if (padfZTransformed && nPointCount)
+        memcpy(padfZTransformed, padfZ, sizeof(double) * nPointCount);
 
     /* -------------------------------------------------------------------- */
     /*      Transform and reapply.                                          */
     /* -------------------------------------------------------------------- */
-    poCT->Transform(nPointCount, xyz, xyz + nPointCount, xyz + nPointCount * 2,
-                    nullptr, pabSuccess);
+    poCT->Transform(nPointCount, padfX, padfY, padfZTransformed, nullptr,
+                    pabSuccess);
 
     const char *pszEnablePartialReprojection = nullptr;
 
@@ -2580,9 +2584,12 @@ OGRErr OGRSimpleCurve::transform(OGRCoordinateTransformation *poCT)
     {
         if (pabSuccess[i])
         {
-            xyz[j] = xyz[i];
-            xyz[j + nPointCount] = xyz[i + nPointCount];
-            xyz[j + 2 * nPointCount] = xyz[i + 2 * nPointCount];
+            padfX[j] = padfX[i];
+            padfY[j] = padfY[i];
+            if (padfZTransformed)
+                padfZTransformed[j] = padfZTransformed[i];
+            if (padfM)
+                padfM[j] = padfM[i];
             j++;
         }
         else
@@ -2635,8 +2642,16 @@ OGRErr OGRSimpleCurve::transform(OGRCoordinateTransformation *poCT)
         return OGRERR_FAILURE;
     }
 
-    setPoints(j, xyz, xyz + nPointCount,
-              (padfZ) ? xyz + nPointCount * 2 : nullptr);
+    // Write back the transformed coordinates in place. The point count
+    // can only decrease, so no reallocation is needed.
+    for (int i = 0; i < j; i++)
+    {
+        paoPoints[i].x = padfX[i];
+        paoPoints[i].y = padfY[i];
+    }
+    if (padfZTransformed && j)
+        memcpy(padfZ, padfZTransformed, sizeof(double) * j);
+    setNumPoints(j, FALSE);
     CPLFree(xyz);
     CPLFree(pabSuccess);
 
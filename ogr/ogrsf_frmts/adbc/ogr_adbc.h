@@ -177,6 +177,13 @@ class OGRADBCDataset final : public GDALDataset
     bool m_bIsDuckDBDataset = false;
     bool m_bIsDuckDBDriver = false;
     bool m_bSpatialLoaded = false;
+    int m_nNumThreads = 1;
+    bool m_bPartitionsUnsupported = false;
+
+    bool ReadPartitions(struct AdbcPartitions *partitions,
+                        struct ArrowSchema *schema,
+                        struct ArrowArrayStream *out_stream,
+                        struct AdbcError *error);
 
   public:
     OGRADBCDataset() = default;
@@ -208,6 +215,10 @@ class OGRADBCDataset final : public GDALDataset
 
     OGRLayer *ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
                          const char *pszDialect) override;
+
+    AdbcStatusCode ExecuteQuery(struct AdbcStatement *statement,
+                                struct ArrowArrayStream *out_stream,
+                                struct AdbcError *error);
 };
 
 /************************************************************************/
@@ -23,6 +23,13 @@
 #include <arrow-adbc/adbc_driver_manager.h>
 #endif
 
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #define OGR_ADBC_VERSION ADBC_VERSION_1_1_0
 static_assert(sizeof(AdbcDriver) == ADBC_DRIVER_1_1_0_SIZE);
 
@@ -73,6 +80,195 @@ AdbcStatusCode OGRADBCLoadDriver(const char *driver_name,
     }
 }
 
+/************************************************************************/
+/*                      OGRADBCPartitionedStream                        */
+/************************************************************************/
+
+/** Exposes the streams of the partitions of a result set as a single
+ * ArrowArrayStream. The partitions are read concurrently by worker threads,
+ * so batches are returned in an unspecified order (partitions are not
+ * ordered anyway).
+ */
+class OGRADBCPartitionedStream
+{
+    std::vector<std::unique_ptr<OGRArrowArrayStream>> m_apoStreams{};
+    struct ArrowSchema m_schema{};
+    const int m_nMaxThreads;
+
+    std::vector<std::thread> m_aoThreads{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<struct ArrowArray> m_aoQueue{};
+    size_t m_nMaxQueueSize = 0;
+    size_t m_nNextPartition = 0;
+    int m_nRunningThreads = 0;
+    bool m_bStop = false;
+    int m_nErrorCode = 0;
+    std::string m_osLastError{};
+
+    void WorkerThread();
+
+    int GetNext(struct ArrowArray *out_array);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRADBCPartitionedStream)
+
+  public:
+    OGRADBCPartitionedStream(
+        std::vector<std::unique_ptr<OGRArrowArrayStream>> &&apoStreams,
+        struct ArrowSchema *schema, int nMaxThreads)
+        : m_apoStreams(std::move(apoStreams)), m_nMaxThreads(nMaxThreads)
+    {
+        memcpy(&m_schema, schema, sizeof(m_schema));
+        schema->release = nullptr;
+    }
+
+    ~OGRADBCPartitionedStream();
+
+    void ExportTo(struct ArrowArrayStream *out_stream);
+};
+
+/************************************************************************/
+/*                    ~OGRADBCPartitionedStream()                       */
+/************************************************************************/
+
+OGRADBCPartitionedStream::~OGRADBCPartitionedStream()
+{
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_bStop = true;
+    }
+    m_oCV.notify_all();
+    for (auto &oThread : m_aoThreads)
+        oThread.join();
+    for (auto &array : m_aoQueue)
+        array.release(&array);
+    if (m_schema.release)
+        m_schema.release(&m_schema);
+}
+
+/************************************************************************/
+/*                           WorkerThread()                             */
+/************************************************************************/
+
+void OGRADBCPartitionedStream::WorkerThread()
+{
+    std::unique_lock oLock(m_oMutex);
+    while (!m_bStop && m_nNextPartition < m_apoStreams.size())
+    {
+        auto &poStream = m_apoStreams[m_nNextPartition++];
+        while (!m_bStop)
+        {
+            struct ArrowArray array;
+            memset(&array, 0, sizeof(array));
+            oLock.unlock();
+            const int nRet = poStream->get_next(&array);
+            oLock.lock();
+            if (nRet != 0)
+            {
+                if (m_nErrorCode == 0)
+                {
+                    m_nErrorCode = nRet;
+                    const char *pszError =
+                        poStream->get()->get_last_error(poStream->get());
+                    m_osLastError = pszError ? pszError : "";
+                }
+                m_bStop = true;
+                break;
+            }
+            if (!array.release)
+                break;  // end of partition
+
+            m_oCV.wait(oLock,
+                       [this] {
+                           return m_bStop ||
+                                  m_aoQueue.size() < m_nMaxQueueSize;
+                       });
+            if (m_bStop)
+            {
+                array.release(&array);
+                break;
+            }
+            m_aoQueue.push_back(array);
+            m_oCV.notify_all();
+        }
+    }
+    --m_nRunningThreads;
+    m_oCV.notify_all();
+}
+
+/************************************************************************/
+/*                              GetNext()                               */
+/************************************************************************/
+
+int OGRADBCPartitionedStream::GetNext(struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+
+    std::unique_lock oLock(m_oMutex);
+    if (m_aoThreads.empty() && !m_apoStreams.empty())
+    {
+        // Start the workers on the first request
+        const int nThreads = static_cast<int>(std::min<size_t>(
+            std::max(1, m_nMaxThreads), m_apoStreams.size()));
+        m_nMaxQueueSize = 2 * nThreads;
+        m_nRunningThreads = nThreads;
+        for (int i = 0; i < nThreads; ++i)
+            m_aoThreads.emplace_back([this] { WorkerThread(); });
+    }
+
+    m_oCV.wait(oLock,
+               [this]
+               {
+                   return m_nErrorCode != 0 || !m_aoQueue.empty() ||
+                          m_nRunningThreads == 0;
+               });
+    if (m_nErrorCode != 0)
+        return m_nErrorCode;
+    if (!m_aoQueue.empty())
+    {
+        memcpy(out_array, &m_aoQueue.front(), sizeof(*out_array));
+        m_aoQueue.pop_front();
+        m_oCV.notify_all();
+    }
+    // else end of stream: out_array->release == nullptr
+    return 0;
+}
+
+/************************************************************************/
+/*                              ExportTo()                              */
+/************************************************************************/
+
+void OGRADBCPartitionedStream::ExportTo(struct ArrowArrayStream *out_stream)
+{
+    out_stream->get_schema =
+        [](struct ArrowArrayStream *stream, struct ArrowSchema *out_schema)
+    {
+        auto self = static_cast<OGRADBCPartitionedStream *>(
+            stream->private_data);
+        return OGRCloneArrowSchema(&self->m_schema, out_schema) ? 0 : EIO;
+    };
+    out_stream->get_next =
+        [](struct ArrowArrayStream *stream, struct ArrowArray *out_array)
+    {
+        return static_cast<OGRADBCPartitionedStream *>(stream->private_data)
+            ->GetNext(out_array);
+    };
+    out_stream->get_last_error = [](struct ArrowArrayStream *stream)
+    {
+        auto self = static_cast<OGRADBCPartitionedStream *>(
+            stream->private_data);
+        std::lock_guard oLock(self->m_oMutex);
+        return self->m_osLastError.empty() ? nullptr
+                                           : self->m_osLastError.c_str();
+    };
+    out_stream->release = [](struct ArrowArrayStream *stream)
+    {
+        delete static_cast<OGRADBCPartitionedStream *>(stream->private_data);
+        stream->release = nullptr;
+    };
+    out_stream->private_data = this;
+}
+
 }  // namespace
 
 // Helper to wrap driver callbacks
@@ -168,9 +364,7 @@ OGRADBCDataset::CreateLayer(const char *pszStatement, const char *pszLayerName,
     }
 
     auto stream = std::make_unique<OGRArrowArrayStream>();
-    int64_t rows_affected = -1;
-    if (ADBC_CALL(StatementExecuteQuery, statement.get(), stream->get(),
-                  &rows_affected, error) != ADBC_STATUS_OK)
+    if (ExecuteQuery(statement.get(), stream->get(), error) != ADBC_STATUS_OK)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "AdbcStatementExecuteQuery() failed: %s", error.message());
@@ -192,6 +386,111 @@ OGRADBCDataset::CreateLayer(const char *pszStatement, const char *pszLayerName,
         std::move(stream), &schema, bInternalUse);
 }
 
+/************************************************************************/
+/*                            ExecuteQuery()                            */
+/************************************************************************/
+
+/** Executes a statement, using partitioned execution if the number of
+ * threads is greater than one and the ADBC driver supports it, and
+ * AdbcStatementExecuteQuery() otherwise.
+ */
+AdbcStatusCode OGRADBCDataset::ExecuteQuery(struct AdbcStatement *statement,
+                                            struct ArrowArrayStream *out_stream,
+                                            struct AdbcError *error)
+{
+    int64_t rows_affected = -1;
+    if (m_nNumThreads > 1 && !m_bPartitionsUnsupported &&
+        m_driver.StatementExecutePartitions && m_driver.ConnectionReadPartition)
+    {
+        struct ArrowSchema schema;
+        memset(&schema, 0, sizeof(schema));
+        struct AdbcPartitions partitions;
+        memset(&partitions, 0, sizeof(partitions));
+        const AdbcStatusCode eStatus =
+            ADBC_CALL(StatementExecutePartitions, statement, &schema,
+                      &partitions, &rows_affected, error);
+        if (eStatus == ADBC_STATUS_OK)
+        {
+            if (ReadPartitions(&partitions, &schema, out_stream, error))
+                return ADBC_STATUS_OK;
+        }
+        else
+        {
+            CPLDebug("ADBC", "AdbcStatementExecutePartitions() failed: %s",
+                     error->message ? error->message : "");
+            if (eStatus == ADBC_STATUS_NOT_IMPLEMENTED)
+                m_bPartitionsUnsupported = true;
+        }
+        if (error->release)
+            error->release(error);
+        memset(error, 0, sizeof(*error));
+        CPLDebug("ADBC", "Falling back to AdbcStatementExecuteQuery()");
+    }
+
+    return ADBC_CALL(StatementExecuteQuery, statement, out_stream,
+                     &rows_affected, error);
+}
+
+/************************************************************************/
+/*                           ReadPartitions()                           */
+/************************************************************************/
+
+/** Opens the streams of the partitions returned by
+ * AdbcStatementExecutePartitions(), and exposes them as a single stream.
+ * Takes ownership of partitions and schema in all cases.
+ */
+bool OGRADBCDataset::ReadPartitions(struct AdbcPartitions *partitions,
+                                    struct ArrowSchema *schema,
+                                    struct ArrowArrayStream *out_stream,
+                                    struct AdbcError *error)
+{
+    CPLDebug("ADBC", "Reading %d partition(s) with up to %d threads",
+             static_cast<int>(partitions->num_partitions), m_nNumThreads);
+
+    // The connection is only used from this thread. Worker threads only
+    // read from the partition streams.
+    std::vector<std::unique_ptr<OGRArrowArrayStream>> apoStreams;
+    bool bOK = true;
+    for (size_t i = 0; i < partitions->num_partitions; ++i)
+    {
+        auto stream = std::make_unique<OGRArrowArrayStream>();
+        if (ADBC_CALL(ConnectionReadPartition, m_connection.get(),
+                      partitions->partitions[i],
+                      partitions->partition_lengths[i], stream->get(),
+                      error) != ADBC_STATUS_OK)
+        {
+            CPLDebug("ADBC", "AdbcConnectionReadPartition() failed: %s",
+                     error->message ? error->message : "");
+            bOK = false;
+            break;
+        }
+        apoStreams.push_back(std::move(stream));
+    }
+    if (partitions->release)
+        partitions->release(partitions);
+
+    if (!bOK)
+    {
+        if (schema->release)
+            schema->release(schema);
+        return false;
+    }
+
+    if (apoStreams.size() == 1)
+    {
+        if (schema->release)
+            schema->release(schema);
+        memcpy(out_stream, apoStreams[0]->get(), sizeof(*out_stream));
+        memset(apoStreams[0]->get(), 0, sizeof(*out_stream));
+        return true;
+    }
+
+    auto poStream = new OGRADBCPartitionedStream(std::move(apoStreams), schema,
+                                                 m_nNumThreads);
+    poStream->ExportTo(out_stream);
+    return true;
+}
+
 /************************************************************************/
 /*                             ExecuteSQL()                             */
 /************************************************************************/
@@ -253,6 +552,12 @@ bool OGRADBCDataset::Open(const GDALOpenInfo *poOpenInfo)
     bool bIsParquet =
         OGRADBCDriverIsParquet(poOpenInfo) || IsParquetExtension(pszFilename);
     const char *pszSQL = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "SQL");
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    m_nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                        ? CPLGetNumCPUs()
+                        : std::clamp(atoi(pszNumThreads), 1, 1024);
     if (!bIsParquet && pszSQL)
     {
         CPLString osSQL(pszSQL);
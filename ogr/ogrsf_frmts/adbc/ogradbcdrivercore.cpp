@@ -122,6 +122,9 @@ void OGRADBCDriverSetCommonMetadata(GDALDriver *poDriver)
         "  <Option name='PRELUDE_STATEMENTS' type='string' description='SQL "
         "statement(s) to send on the database connection before any other "
         "ones'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "threads used to read the partitions of results, when the ADBC driver "
+        "supports partitioned execution. Integer or ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_SUPPORTED_SQL_DIALECTS,
                               "NATIVE OGRSQL SQLITE");
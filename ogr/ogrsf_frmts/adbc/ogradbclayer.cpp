@@ -489,11 +489,10 @@ bool OGRADBCLayer::ReplaceStatement(const char *pszNewStatement)
     else
     {
         auto stream = std::make_unique<OGRArrowArrayStream>();
-        int64_t rows_affected = -1;
         ArrowSchema newSchema;
         memset(&newSchema, 0, sizeof(newSchema));
-        if (ADBC_CALL(StatementExecuteQuery, statement.get(), stream->get(),
-                      &rows_affected, error) != ADBC_STATUS_OK)
+        if (m_poDS->ExecuteQuery(statement.get(), stream->get(), error) !=
+            ADBC_STATUS_OK)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "AdbcStatementExecuteQuery() failed: %s", error.message());
@@ -846,9 +845,8 @@ bool OGRADBCLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
 bool OGRADBCLayer::GetArrowStreamInternal(struct ArrowArrayStream *out_stream)
 {
     OGRADBCError error;
-    int64_t rows_affected = -1;
-    if (ADBC_CALL(StatementExecuteQuery, m_statement.get(), out_stream,
-                  &rows_affected, error) != ADBC_STATUS_OK)
+    if (m_poDS->ExecuteQuery(m_statement.get(), out_stream, error) !=
+        ADBC_STATUS_OK)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "AdbcStatementExecuteQuery() failed: %s", error.message());
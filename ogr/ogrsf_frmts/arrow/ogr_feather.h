@@ -142,6 +142,8 @@ class OGRFeatherWriterLayer final : public OGRArrowWriterLayer
 
     GDALDataset *m_poDS = nullptr;
     bool m_bStreamFormat = false;
+    //! Number of threads used to compress buffers (0 = libarrow default)
+    int m_nNumThreads = 0;
     std::shared_ptr<arrow::ipc::RecordBatchWriter> m_poFileWriter{};
     std::shared_ptr<arrow::KeyValueMetadata> m_poFooterKeyValueMetadata{};
 
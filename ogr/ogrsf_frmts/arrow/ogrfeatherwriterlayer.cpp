@@ -183,6 +183,16 @@ bool OGRFeatherWriterLayer::SetOptions(const std::string &osFilename,
         }
     }
 
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr));
+    if (pszNumThreads)
+    {
+        m_nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                            ? CPLGetNumCPUs()
+                            : std::max(1, atoi(pszNumThreads));
+    }
+
     m_bInitializationOK = true;
     return true;
 }
@@ -313,6 +323,16 @@ void OGRFeatherWriterLayer::CreateWriter()
 
     auto options = arrow::ipc::IpcWriteOptions::Defaults();
     options.memory_pool = m_poMemoryPool;
+    if (m_nNumThreads > 0)
+    {
+        // Buffers of the columns of a record batch are compressed in
+        // parallel on the Arrow CPU thread pool when use_threads is set.
+        options.use_threads = m_nNumThreads > 1;
+        if (options.use_threads)
+        {
+            CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(m_nNumThreads));
+        }
+    }
 
     {
         auto result = arrow::util::Codec::Create(m_eCompression);
@@ -441,6 +441,12 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
     GetGeomEncodingAsString(OGRArrowGeomEncoding eGeomEncoding,
                             bool bForParquetGeo);
 
+    int GetGeoArrowStructPassthroughDepth(const struct ArrowSchema *psSchema,
+                                          int iGeomField) const;
+    bool IsArrowGeomSchemaSupported(const struct ArrowSchema *schema,
+                                    CSLConstList papszOptions,
+                                    std::string &osErrorMsg) const;
+
     virtual bool IsSupportedGeometryType(OGRwkbGeometryType eGType) const = 0;
 
     virtual std::string GetDriverUCName() const = 0;
@@ -526,11 +532,11 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
                            int bApproxOK = TRUE) override;
     GIntBig GetFeatureCount(int bForce) override;
 
-    bool IsArrowSchemaSupported(const struct ArrowSchema * /*schema*/,
-                                CSLConstList /* papszOptions */,
-                                std::string & /*osErrorMsg */) const override
+    bool IsArrowSchemaSupported(const struct ArrowSchema *schema,
+                                CSLConstList papszOptions,
+                                std::string &osErrorMsg) const override
     {
-        return true;
+        return IsArrowGeomSchemaSupported(schema, papszOptions, osErrorMsg);
     }
 
     bool
@@ -3597,6 +3597,74 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
         }
     }
 
+    else if (poNode->eNodeType == SNT_OPERATION &&
+             poNode->nOperation == SWQ_IN && poNode->nSubExprCount >= 2)
+    {
+        // "column IN (v1, ..., vN)" implies
+        // "column >= min(vi) AND column <= max(vi)", which is enough to
+        // skip row groups or features.
+        const swq_expr_node *poColumn = poNode->papoSubExpr[0];
+        if (poColumn->eNodeType == SNT_COLUMN &&
+            (poColumn->field_index < m_poFeatureDefn->GetFieldCount() ||
+             poColumn->field_index ==
+                 m_poFeatureDefn->GetFieldCount() + SPF_FID))
+        {
+            const OGRFieldDefn oDummyFIDFieldDefn(m_osFIDColumn.c_str(),
+                                                  OFTInteger64);
+            const OGRFieldDefn *poFieldDefn =
+                (poColumn->field_index ==
+                 m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                    ? &oDummyFIDFieldDefn
+                    : m_poFeatureDefn->GetFieldDefn(poColumn->field_index);
+            const bool bIsStringField = poFieldDefn->GetType() == OFTString;
+            const bool bIsRealField = poFieldDefn->GetType() == OFTReal;
+
+            const auto IsLess = [](const Constraint &a, const Constraint &b)
+            {
+                switch (a.eType)
+                {
+                    case Constraint::Type::Integer:
+                        return a.sValue.Integer < b.sValue.Integer;
+                    case Constraint::Type::Integer64:
+                        return a.sValue.Integer64 < b.sValue.Integer64;
+                    case Constraint::Type::Real:
+                        return a.sValue.Real < b.sValue.Real;
+                    case Constraint::Type::String:
+                        break;
+                }
+                return strcmp(a.sValue.String, b.sValue.String) < 0;
+            };
+
+            Constraint constraintMin;
+            Constraint constraintMax;
+            bool bOK = true;
+            for (int i = 1; bOK && i < poNode->nSubExprCount; ++i)
+            {
+                const swq_expr_node *poValue = poNode->papoSubExpr[i];
+                Constraint constraint;
+                bOK = poValue->eNodeType == SNT_CONSTANT &&
+                      !poValue->is_null &&
+                      (bIsStringField == (poValue->field_type == SWQ_STRING)) &&
+                      (!bIsRealField || poValue->field_type == SWQ_FLOAT) &&
+                      FillTargetValueFromSrcExpr(poFieldDefn, &constraint,
+                                                 poValue);
+                if (bOK && (i == 1 || IsLess(constraint, constraintMin)))
+                    constraintMin = constraint;
+                if (bOK && (i == 1 || IsLess(constraintMax, constraint)))
+                    constraintMax = constraint;
+            }
+            if (bOK)
+            {
+                constraintMin.iField = poColumn->field_index;
+                constraintMin.nOperation = SWQ_GE;
+                AddConstraint(constraintMin);
+                constraintMax.iField = poColumn->field_index;
+                constraintMax.nOperation = SWQ_LE;
+                AddConstraint(constraintMax);
+            }
+        }
+    }
+
     else if (poNode->eNodeType == SNT_OPERATION &&
              poNode->nOperation == SWQ_ISNULL && poNode->nSubExprCount == 1)
     {
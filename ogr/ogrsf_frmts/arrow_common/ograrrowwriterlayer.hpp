@@ -2285,6 +2285,205 @@ static inline bool TestBit(const uint8_t *pabyData, size_t nIdx)
     return (pabyData[nIdx / 8] & (1 << (nIdx % 8))) != 0;
 }
 
+/************************************************************************/
+/*                 GetGeoArrowStructPassthroughDepth()                  */
+/************************************************************************/
+
+/** Returns the number of list levels above the point struct if the input
+ * array described by psSchema uses exactly the GeoArrow struct encoding of
+ * geometry field iGeomField, and can thus be written as it is.
+ * Returns -1 otherwise.
+ */
+inline int OGRArrowWriterLayer::GetGeoArrowStructPassthroughDepth(
+    const struct ArrowSchema *psSchema, int iGeomField) const
+{
+    if (iGeomField < 0 ||
+        iGeomField >= static_cast<int>(m_aeGeomEncoding.size()))
+        return -1;
+
+    const auto eGeomEncoding = m_aeGeomEncoding[iGeomField];
+    int nDepth = 0;
+    switch (eGeomEncoding)
+    {
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_POINT:
+            nDepth = 0;
+            break;
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_LINESTRING:
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_MULTIPOINT:
+            nDepth = 1;
+            break;
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_POLYGON:
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_MULTILINESTRING:
+            nDepth = 2;
+            break;
+        case OGRArrowGeomEncoding::GEOARROW_STRUCT_MULTIPOLYGON:
+            nDepth = 3;
+            break;
+        default:
+            return -1;
+    }
+
+    // Linestring and multipoint (resp. polygon and multilinestring) have the
+    // same layout, so rely on the extension name, when present, to
+    // disambiguate them.
+    if (psSchema->metadata)
+    {
+        const auto oMetadata = OGRParseArrowMetadata(psSchema->metadata);
+        const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+        if (oIter != oMetadata.end() &&
+            oIter->second != GetGeomEncodingAsString(eGeomEncoding, false))
+        {
+            return -1;
+        }
+    }
+
+    for (int i = 0; i < nDepth; ++i)
+    {
+        if (strcmp(psSchema->format, "+l") != 0 || psSchema->n_children != 1)
+            return -1;
+        psSchema = psSchema->children[0];
+    }
+
+    const auto eGType =
+        m_poFeatureDefn->GetGeomFieldDefn(iGeomField)->GetType();
+    std::vector<const char *> apszCoordNames{"x", "y"};
+    if (OGR_GT_HasZ(eGType))
+        apszCoordNames.push_back("z");
+    if (OGR_GT_HasM(eGType))
+        apszCoordNames.push_back("m");
+    if (strcmp(psSchema->format, "+s") != 0 ||
+        psSchema->n_children != static_cast<int64_t>(apszCoordNames.size()))
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < apszCoordNames.size(); ++i)
+    {
+        const auto psChild = psSchema->children[i];
+        if (strcmp(psChild->format, "g") != 0 ||
+            strcmp(psChild->name, apszCoordNames[i]) != 0)
+        {
+            return -1;
+        }
+    }
+    return nDepth;
+}
+
+/************************************************************************/
+/*                    IsArrowGeomSchemaSupported()                      */
+/************************************************************************/
+
+/** Checks that the geometry columns of the schema are either binary (WKB)
+ * or use exactly the GeoArrow struct encoding of the output column.
+ */
+inline bool OGRArrowWriterLayer::IsArrowGeomSchemaSupported(
+    const struct ArrowSchema *schema, CSLConstList papszOptions,
+    std::string &osErrorMsg) const
+{
+    const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+    const char *pszSingleGeomFieldName =
+        CSLFetchNameValue(papszOptions, "GEOMETRY_NAME");
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const auto psChild = schema->children[i];
+        int iGeomField = m_poFeatureDefn->GetGeomFieldIndex(psChild->name);
+        if (iGeomField < 0 && nGeomFieldCount == 1 && pszSingleGeomFieldName &&
+            strcmp(psChild->name, pszSingleGeomFieldName) == 0)
+        {
+            iGeomField = 0;
+        }
+        if (iGeomField < 0 || strcmp(psChild->format, "z") == 0 ||
+            strcmp(psChild->format, "Z") == 0)
+        {
+            continue;
+        }
+        if (GetGeoArrowStructPassthroughDepth(psChild, iGeomField) < 0)
+        {
+            osErrorMsg = "Geometry field '";
+            osErrorMsg += psChild->name;
+            osErrorMsg += "' is neither binary nor using the GeoArrow "
+                          "encoding of the output layer";
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   GetGeoArrowStructArrayEnvelope()                   */
+/************************************************************************/
+
+/** Computes the envelope of the geometry at row iRow of a GeoArrow struct
+ * array, with nDepth list levels above the point struct.
+ * Returns false for an empty geometry.
+ */
+static bool GetGeoArrowStructArrayEnvelope(const struct ArrowArray *psArray,
+                                           int nDepth, bool bHasZ,
+                                           int64_t iRow,
+                                           OGREnvelope3D &sEnvelope)
+{
+    int64_t nStart = iRow;
+    int64_t nEnd = iRow + 1;
+    for (int i = 0; i < nDepth; ++i)
+    {
+        const int32_t *panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]) +
+            psArray->offset;
+        nStart = panOffsets[nStart];
+        nEnd = panOffsets[nEnd];
+        psArray = psArray->children[0];
+    }
+
+    const auto GetCoords = [psArray](int iCoord)
+    {
+        const auto psCoordArray = psArray->children[iCoord];
+        return static_cast<const double *>(psCoordArray->buffers[1]) +
+               psCoordArray->offset + psArray->offset;
+    };
+    const double *padfX = GetCoords(0);
+    const double *padfY = GetCoords(1);
+    const double *padfZ = bHasZ ? GetCoords(2) : nullptr;
+
+    sEnvelope = OGREnvelope3D();
+    for (int64_t i = nStart; i < nEnd; ++i)
+    {
+        // Empty points are encoded with NaN coordinates
+        if (std::isnan(padfX[i]) || std::isnan(padfY[i]))
+            continue;
+        sEnvelope.MinX = std::min(sEnvelope.MinX, padfX[i]);
+        sEnvelope.MinY = std::min(sEnvelope.MinY, padfY[i]);
+        sEnvelope.MaxX = std::max(sEnvelope.MaxX, padfX[i]);
+        sEnvelope.MaxY = std::max(sEnvelope.MaxY, padfY[i]);
+        if (padfZ && !std::isnan(padfZ[i]))
+        {
+            sEnvelope.MinZ = std::min(sEnvelope.MinZ, padfZ[i]);
+            sEnvelope.MaxZ = std::max(sEnvelope.MaxZ, padfZ[i]);
+        }
+    }
+    return sEnvelope.IsInit() != 0;
+}
+
+/************************************************************************/
+/*                          RetypeArrayData()                           */
+/************************************************************************/
+
+/** Returns a shallow copy of data, whose type (and the type of its children)
+ * is replaced by the structurally identical type, but whose nested field
+ * names or nullability may differ.
+ */
+static std::shared_ptr<arrow::ArrayData>
+RetypeArrayData(const std::shared_ptr<arrow::ArrayData> &data,
+                const std::shared_ptr<arrow::DataType> &type)
+{
+    auto newData = data->Copy();
+    newData->type = type;
+    for (size_t i = 0; i < newData->child_data.size(); ++i)
+    {
+        newData->child_data[i] = RetypeArrayData(
+            newData->child_data[i], type->field(static_cast<int>(i))->type());
+    }
+    return newData;
+}
+
 /************************************************************************/
 /*                       WriteArrowBatchInternal()                      */
 /************************************************************************/
@@ -2350,7 +2549,10 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
             const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
             if (oIter != oMetadata.end() &&
                 (oIter->second == EXTENSION_NAME_OGC_WKB ||
-                 oIter->second == EXTENSION_NAME_GEOARROW_WKB))
+                 oIter->second == EXTENSION_NAME_GEOARROW_WKB ||
+                 (nGeomFieldCount == 1 &&
+                  GetGeoArrowStructPassthroughDepth(schema->children[i], 0) >=
+                      0)))
             {
                 pszSingleGeomFieldName = schema->children[i]->name;
             }
@@ -2683,6 +2885,8 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
     // Process geometry columns:
     // - if the output encoding is WKB, then just note the geometry type and
     //   envelope.
+    // - if the input and output encodings are the same GeoArrow struct
+    //   encoding, also just note the geometry type and envelope.
     // - otherwise convert to the output encoding.
     int nBuilderIdx = 0;
     if (!m_osFIDColumn.empty())
@@ -2691,6 +2895,7 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
     }
     std::map<std::string, std::shared_ptr<arrow::Array>>
         oMapGeomFieldNameToArray;
+    std::set<int> oSetGeoArrowPassthroughFieldIdx;
     for (int i = 0; i < nGeomFieldCount; ++i, ++nBuilderIdx)
     {
         const char *pszThisGeomFieldName =
@@ -2709,6 +2914,67 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
             }
         }
 
+        const auto psGeomArray = array->children[nIdx];
+        const uint8_t *pabyValidity =
+            psGeomArray->null_count != 0
+                ? static_cast<const uint8_t *>(psGeomArray->buffers[0])
+                : nullptr;
+
+        const int nGeoArrowDepth =
+            GetGeoArrowStructPassthroughDepth(lSchema.children[nIdx], i);
+        if (nGeoArrowDepth >= 0)
+        {
+            const auto eGType =
+                m_poFeatureDefn->GetGeomFieldDefn(i)->GetType();
+            const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGType));
+            OGREnvelope3D sEnvelope3D;
+            for (int64_t iRow = 0; iRow < psGeomArray->length; ++iRow)
+            {
+                bool bValidGeom = false;
+                if ((!pabyValidity ||
+                     TestBit(pabyValidity, static_cast<size_t>(
+                                               iRow + psGeomArray->offset))) &&
+                    GetGeoArrowStructArrayEnvelope(psGeomArray, nGeoArrowDepth,
+                                                   bHasZ, iRow, sEnvelope3D))
+                {
+                    bValidGeom = true;
+                    m_oSetWrittenGeometryTypes[i].insert(eGType);
+                    if (sEnvelope3D.Is3D())
+                        m_aoEnvelopes[i].Merge(sEnvelope3D);
+                    else
+                        m_aoEnvelopes[i].Merge(
+                            static_cast<const OGREnvelope &>(sEnvelope3D));
+                    if (m_bWriteBBoxStruct)
+                    {
+                        aadfMinX[i].push_back(
+                            castToFloatDown(sEnvelope3D.MinX));
+                        aadfMinY[i].push_back(
+                            castToFloatDown(sEnvelope3D.MinY));
+                        aadfMaxX[i].push_back(castToFloatUp(sEnvelope3D.MaxX));
+                        aadfMaxY[i].push_back(castToFloatUp(sEnvelope3D.MaxY));
+                    }
+                }
+                if (!bValidGeom && m_bWriteBBoxStruct)
+                {
+                    if ((bboxStructSchema[i].flags & ARROW_FLAG_NULLABLE))
+                    {
+                        bboxStructArray[i].null_count++;
+                        aabyBboxStructValidity[i][iRow / 8] &=
+                            ~(1 << static_cast<int>(iRow % 8));
+                    }
+                    aadfMinX[i].push_back(0.0f);
+                    aadfMinY[i].push_back(0.0f);
+                    aadfMaxX[i].push_back(0.0f);
+                    aadfMaxY[i].push_back(0.0f);
+                }
+            }
+            // The array is kept as it is, but its type must be made
+            // identical to the one of the layer schema.
+            oSetGeoArrowPassthroughFieldIdx.insert(nIdx);
+            bRebuildBatch = true;
+            continue;
+        }
+
         if (strcmp(lSchema.children[nIdx]->format, "z") != 0 &&
             strcmp(lSchema.children[nIdx]->format, "Z") != 0)
         {
@@ -2718,11 +2984,6 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
             return false;
         }
 
-        const auto psGeomArray = array->children[nIdx];
-        const uint8_t *pabyValidity =
-            psGeomArray->null_count != 0
-                ? static_cast<const uint8_t *>(psGeomArray->buffers[0])
-                : nullptr;
         const bool bUseOffsets32 =
             (strcmp(lSchema.children[nIdx]->format, "z") == 0);
         const uint32_t *panOffsets32 =
@@ -2873,6 +3134,10 @@ inline bool OGRArrowWriterLayer::WriteArrowBatchInternal(
                 oMapGeomFieldNameToArray.find(m_poSchema->field(i)->name());
             if (oIter != oMapGeomFieldNameToArray.end())
                 apoArrays.emplace_back(oIter->second);
+            else if (cpl::contains(oSetGeoArrowPassthroughFieldIdx, i))
+                apoArrays.emplace_back(arrow::MakeArray(
+                    RetypeArrayData(poRecordBatch->column(i)->data(),
+                                    m_poSchema->field(i)->type())));
             else
                 apoArrays.emplace_back(poRecordBatch->column(i));
             if (apoArrays.back()->type()->id() !=
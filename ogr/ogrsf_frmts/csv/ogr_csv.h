@@ -15,7 +15,10 @@
 #define OGR_CSV_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogrsidecarspatialindex.h"
 
+#include <atomic>
+#include <memory>
 #include <set>
 
 typedef enum
@@ -29,6 +32,7 @@ typedef enum
 } OGRCSVGeometryFormat;
 
 class OGRCSVDataSource;
+class OGRCSVParallelReader;
 
 typedef enum
 {
@@ -82,6 +86,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     bool bHasFieldNames = false;
 
     OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *TranslateRecord(char **papszTokens, int64_t nFID);
 
     bool bNew = false;
     bool bInWriteMode = false;
@@ -122,7 +127,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(CSLConstList papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth = false;
+    // Atomic as records may be translated by several threads
+    std::atomic<bool> bWarningBadTypeOrWidth{false};
     bool bKeepSourceColumns = false;
     bool bKeepGeomColumns = true;
 
@@ -134,6 +140,19 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     StringQuoting m_eStringQuoting = StringQuoting::IF_AMBIGUOUS;
 
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSpatialIndex{};
+    bool m_bSpatialIndexOpenAttempted = false;
+    bool m_bIndexEntriesComputed = false;
+    bool m_bUseIndexEntries = false;
+    std::vector<OGRSidecarSpatialIndex::Entry> m_aoIndexEntries{};
+    size_t m_nIndexEntryIdx = 0;
+
+    OGRSidecarSpatialIndex *GetSpatialIndex();
+
+    friend class OGRCSVParallelReader;
+    std::unique_ptr<OGRCSVParallelReader> m_poParallelReader{};
+    bool m_bParallelReadingChecked = false;
+
     char **GetNextLineTokens();
 
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
@@ -215,6 +234,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
+    virtual OGRErr SetIgnoredFields(CSLConstList papszFields) override;
 
     OGRFeatureDefn *GetLayerDefn() override
     {
@@ -266,6 +286,9 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     }
 
     OGRErr WriteHeader();
+
+    bool CreateSpatialIndex();
+    bool DropSpatialIndex();
 };
 
 /************************************************************************/
@@ -320,6 +343,9 @@ class OGRCSVDataSource final : public GDALDataset
 
     int TestCapability(const char *) override;
 
+    OGRLayer *ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
+                         const char *pszDialect) override;
+
     void CreateForSingleFile(const char *pszDirname, const char *pszFilename);
 
     void EnableGeometryFields()
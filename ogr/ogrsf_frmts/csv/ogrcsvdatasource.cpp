@@ -459,6 +459,53 @@ int OGRCSVDataSource::TestCapability(const char *pszCap)
         return FALSE;
 }
 
+/************************************************************************/
+/*                             ExecuteSQL()                             */
+/*                                                                      */
+/*      We override this to provide special handling of SPATIAL INDEX  */
+/*      commands. Supported forms are:                                  */
+/*                                                                      */
+/*        CREATE SPATIAL INDEX ON layer_name                            */
+/*        DROP SPATIAL INDEX ON layer_name                              */
+/************************************************************************/
+
+OGRLayer *OGRCSVDataSource::ExecuteSQL(const char *pszStatement,
+                                       OGRGeometry *poSpatialFilter,
+                                       const char *pszDialect)
+{
+    const bool bCreate =
+        STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX ON ");
+    if (bCreate || STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX ON "))
+    {
+        const char *pszLayerName =
+            pszStatement + (bCreate ? strlen("CREATE SPATIAL INDEX ON ")
+                                    : strlen("DROP SPATIAL INDEX ON "));
+        OGRLayer *poLayer = GetLayerByName(pszLayerName);
+        if (poLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Layer %s not recognised.",
+                     pszLayerName);
+        }
+        else if (bUpdate)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Spatial indices can only be managed on datasets "
+                     "opened in read-only mode");
+        }
+        else if (bCreate)
+        {
+            cpl::down_cast<OGRCSVLayer *>(poLayer)->CreateSpatialIndex();
+        }
+        else
+        {
+            cpl::down_cast<OGRCSVLayer *>(poLayer)->DropSpatialIndex();
+        }
+        return nullptr;
+    }
+
+    return GDALDataset::ExecuteSQL(pszStatement, poSpatialFilter, pszDialect);
+}
+
 /************************************************************************/
 /*                              GetLayer()                              */
 /************************************************************************/
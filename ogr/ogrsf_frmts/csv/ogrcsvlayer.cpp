@@ -25,7 +25,10 @@
 #endif
 #include <algorithm>
 #include <cinttypes>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -35,6 +38,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -852,6 +856,14 @@ std::vector<std::string> OGRCSVLayer::GetFileList()
     ret.emplace_back(pszFilename);
     if (!m_osCSVTFilename.empty())
         ret.emplace_back(m_osCSVTFilename);
+    const std::string osIndexFilename(
+        OGRSidecarSpatialIndex::GetFilename(pszFilename));
+    VSIStatBufL sStat;
+    if (!bNew &&
+        VSIStatExL(osIndexFilename.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+    {
+        ret.emplace_back(osIndexFilename);
+    }
     return ret;
 }
 
@@ -1238,6 +1250,9 @@ char **OGRCSVLayer::AutodetectFieldTypes(CSLConstList papszOpenOptions,
 OGRCSVLayer::~OGRCSVLayer()
 
 {
+    // Must be done first, as worker threads may still be translating records
+    m_poParallelReader.reset();
+
     if (m_nFeaturesRead > 0)
     {
         CPLDebug("CSV", "%d features read on layer '%s'.",
@@ -1264,6 +1279,9 @@ OGRCSVLayer::~OGRCSVLayer()
 void OGRCSVLayer::ResetReading()
 
 {
+    m_poParallelReader.reset();
+    m_bParallelReadingChecked = false;
+
     if (fpCSV)
         VSIRewindL(fpCSV);
 
@@ -1278,6 +1296,11 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     m_nNextFID = FID_INITIAL_VALUE;
+
+    m_bIndexEntriesComputed = false;
+    m_bUseIndexEntries = false;
+    m_aoIndexEntries.clear();
+    m_nIndexEntryIdx = 0;
 }
 
 /************************************************************************/
@@ -1313,6 +1336,9 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < FID_INITIAL_VALUE || fpCSV == nullptr)
         return nullptr;
+    // Records read ahead by the parallel reader are discarded, and
+    // m_nNextFID is the FID of the next record in the file.
+    m_poParallelReader.reset();
     if (nFID < m_nNextFID || bNeedRewindBeforeRead)
         ResetReading();
     while (m_nNextFID < nFID)
@@ -1341,6 +1367,28 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
+    if ((m_nNextFID % 100000) == 0)
+    {
+        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
+                 static_cast<uint64_t>(fpCSV->Tell()));
+    }
+
+    OGRFeature *poFeature = TranslateRecord(papszTokens, m_nNextFID++);
+
+    m_nFeaturesRead++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          TranslateRecord()                           */
+/************************************************************************/
+
+/** Creates the feature of FID nFID from the tokens of its record, which
+ * are freed. May be called by several threads at once.
+ */
+OGRFeature *OGRCSVLayer::TranslateRecord(char **papszTokens, int64_t nFID)
+{
     // Create the OGR feature.
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
 
@@ -1447,29 +1495,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         const OGRFieldType eFieldType = poFieldDefn->GetType();
         const OGRFieldSubType eFieldSubType = poFieldDefn->GetSubType();
 
-        const auto WarnOnceBadValue = [this, poFieldDefn]()
+        const auto WarnOnceBadValue = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Invalid value type found in record %" PRId64
                          " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
-        const auto WarnTooLargeWidth = [this, poFieldDefn]()
+        const auto WarnTooLargeWidth = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Value with a width greater than field width "
                          "found in record %" PRId64 " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
@@ -1555,7 +1601,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                      "field precision found in record %" PRId64
                                      " for field %s. "
                                      "This warning will no longer be emitted",
-                                     m_nNextFID, poFieldDefn->GetNameRef());
+                                     nFID, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1717,18 +1763,220 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
     CSLDestroy(papszTokens);
 
-    if ((m_nNextFID % 100000) == 0)
+    // Translate the record id.
+    poFeature->SetFID(nFID);
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                         OGRCSVParallelReader                         */
+/************************************************************************/
+
+/** Reads the records of a layer by batches, which are translated into
+ * features by worker threads, and returns the features in record order.
+ *
+ * Records are still split from the file by the calling thread, as a
+ * double-quoted field may contain newline characters, so that the start of
+ * a record cannot be determined without reading the file from its start.
+ */
+class OGRCSVParallelReader
+{
+    struct Batch
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+        int64_t nFirstFID = 0;
+        std::vector<char **> apapszTokens{};
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+
+        Batch() = default;
+        CPL_DISALLOW_COPY_ASSIGN(Batch)
+
+        ~Batch()
+        {
+            for (char **papszTokens : apapszTokens)
+                CSLDestroy(papszTokens);
+        }
+    };
+
+    OGRCSVLayer &m_oLayer;
+    const size_t m_nMaxInFlight;
+    bool m_bEOF = false;
+
+    //! Batches submitted, in record order
+    std::deque<std::shared_ptr<Batch>> m_apoPending{};
+    std::shared_ptr<Batch> m_poCurrent{};
+    size_t m_nIdxInCurrent = 0;
+
+    std::unique_ptr<GDALThreadReservation> m_poThreadReservation{};
+    // Last member: jobs translate records with the settings of m_oLayer
+    CPLJobQueuePtr m_poJobQueue{};
+
+    //! Number of records of a batch
+    static constexpr size_t BATCH_SIZE = 1000;
+
+    void SubmitJobs();
+    void TranslateBatch(Batch &oBatch);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRCSVParallelReader)
+
+  public:
+    OGRCSVParallelReader(
+        OGRCSVLayer &oLayer, int nThreads,
+        std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+        CPLJobQueuePtr poJobQueue)
+        : m_oLayer(oLayer), m_nMaxInFlight(2 * static_cast<size_t>(nThreads)),
+          m_poThreadReservation(std::move(poThreadReservation)),
+          m_poJobQueue(std::move(poJobQueue))
     {
-        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
-                 static_cast<uint64_t>(fpCSV->Tell()));
     }
 
-    // Translate the record id.
-    poFeature->SetFID(m_nNextFID++);
+    static std::unique_ptr<OGRCSVParallelReader> Create(OGRCSVLayer &oLayer);
 
-    m_nFeaturesRead++;
+    OGRFeature *GetNextFeature();
 
-    return poFeature;
+    void WaitCompletion()
+    {
+        m_poJobQueue->WaitCompletion();
+    }
+};
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Returns a parallel reader if multithreaded reading is enabled and
+ * worthwhile, or nullptr.
+ */
+std::unique_ptr<OGRCSVParallelReader>
+OGRCSVParallelReader::Create(OGRCSVLayer &oLayer)
+{
+    if (oLayer.bNew || oLayer.bInWriteMode || oLayer.fpCSV == nullptr ||
+        STARTS_WITH(oLayer.pszFilename, "/vsistdin/"))
+        return nullptr;
+
+    VSIStatBufL sStat;
+    const double dfMinSizeMB = CPLAtof(
+        CPLGetConfigOption("OGR_CSV_MULTITHREADING_MIN_FILE_SIZE", "10"));
+    if (VSIStatL(oLayer.pszFilename, &sStat) != 0 ||
+        static_cast<double>(sStat.st_size) < dfMinSizeMB * 1024 * 1024)
+        return nullptr;
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadReservation =
+        std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+    CPLDebug("CSV", "Reading features with %d threads", nThreads);
+    return std::make_unique<OGRCSVParallelReader>(
+        oLayer, nThreads, std::move(poThreadReservation),
+        poThreadPool->CreateJobQueue());
+}
+
+/************************************************************************/
+/*                           TranslateBatch()                           */
+/************************************************************************/
+
+/** Run by worker threads */
+void OGRCSVParallelReader::TranslateBatch(Batch &oBatch)
+{
+    oBatch.apoFeatures.reserve(oBatch.apapszTokens.size());
+    int64_t nFID = oBatch.nFirstFID;
+    for (char **&papszTokens : oBatch.apapszTokens)
+    {
+        oBatch.apoFeatures.emplace_back(
+            m_oLayer.TranslateRecord(papszTokens, nFID++));
+        papszTokens = nullptr;
+    }
+    oBatch.apapszTokens.clear();
+}
+
+/************************************************************************/
+/*                             SubmitJobs()                             */
+/************************************************************************/
+
+void OGRCSVParallelReader::SubmitJobs()
+{
+    while (!m_bEOF && m_apoPending.size() < m_nMaxInFlight)
+    {
+        auto poBatch = std::make_shared<Batch>();
+        poBatch->nFirstFID = m_oLayer.m_nNextFID;
+        poBatch->apapszTokens.reserve(BATCH_SIZE);
+        while (poBatch->apapszTokens.size() < BATCH_SIZE)
+        {
+            char **papszTokens = m_oLayer.GetNextLineTokens();
+            if (papszTokens == nullptr)
+            {
+                m_bEOF = true;
+                break;
+            }
+            if ((m_oLayer.m_nNextFID % 100000) == 0)
+            {
+                CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64,
+                         m_oLayer.m_nNextFID,
+                         static_cast<uint64_t>(m_oLayer.fpCSV->Tell()));
+            }
+            m_oLayer.m_nNextFID++;
+            poBatch->apapszTokens.push_back(papszTokens);
+        }
+        if (poBatch->apapszTokens.empty())
+            break;
+
+        m_apoPending.push_back(poBatch);
+        if (!m_poJobQueue->SubmitJob(
+                [this, poBatch]()
+                {
+                    TranslateBatch(*poBatch);
+                    std::lock_guard oLock(poBatch->oMutex);
+                    poBatch->bDone = true;
+                    poBatch->oCV.notify_one();
+                }))
+        {
+            TranslateBatch(*poBatch);
+            poBatch->bDone = true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRCSVParallelReader::GetNextFeature()
+{
+    while (!m_poCurrent || m_nIdxInCurrent == m_poCurrent->apoFeatures.size())
+    {
+        m_poCurrent.reset();
+        SubmitJobs();
+        if (m_apoPending.empty())
+            return nullptr;
+        auto poBatch = std::move(m_apoPending.front());
+        m_apoPending.pop_front();
+        {
+            std::unique_lock oLock(poBatch->oMutex);
+            poBatch->oCV.wait(oLock, [&poBatch] { return poBatch->bDone; });
+        }
+        m_poCurrent = std::move(poBatch);
+        m_nIdxInCurrent = 0;
+        // Keep the worker threads busy while the caller processes this batch
+        SubmitJobs();
+    }
+    m_oLayer.m_nFeaturesRead++;
+    return m_poCurrent->apoFeatures[m_nIdxInCurrent++].release();
 }
 
 /************************************************************************/
@@ -1741,11 +1989,41 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     if (bNeedRewindBeforeRead)
         ResetReading();
 
+    if (m_poFilterGeom != nullptr && m_iGeomFieldFilter == 0 &&
+        !m_bIndexEntriesComputed)
+    {
+        m_bIndexEntriesComputed = true;
+        if (auto poSpatialIndex = GetSpatialIndex())
+        {
+            m_bUseIndexEntries =
+                poSpatialIndex->Search(m_sFilterEnvelope, m_aoIndexEntries);
+        }
+    }
+
+    if (!m_bUseIndexEntries && !m_bParallelReadingChecked)
+    {
+        m_bParallelReadingChecked = true;
+        m_poParallelReader = OGRCSVParallelReader::Create(*this);
+    }
+
     // Read features till we find one that satisfies our current
     // spatial criteria.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        if (m_bUseIndexEntries)
+        {
+            if (m_nIndexEntryIdx >= m_aoIndexEntries.size())
+                return nullptr;
+            const auto &sEntry = m_aoIndexEntries[m_nIndexEntryIdx];
+            ++m_nIndexEntryIdx;
+            if (VSIFSeekL(fpCSV, sEntry.nOffset, SEEK_SET) != 0)
+                return nullptr;
+            m_nNextFID = sEntry.nFID;
+        }
+
+        OGRFeature *poFeature = m_poParallelReader
+                                    ? m_poParallelReader->GetNextFeature()
+                                    : GetNextUnfilteredFeature();
         if (poFeature == nullptr)
             return nullptr;
 
@@ -1758,6 +2036,18 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                          SetIgnoredFields()                          */
+/************************************************************************/
+
+OGRErr OGRCSVLayer::SetIgnoredFields(CSLConstList papszFields)
+{
+    // Worker threads test whether fields are ignored
+    if (m_poParallelReader)
+        m_poParallelReader->WaitCompletion();
+    return OGRLayer::SetIgnoredFields(papszFields);
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -1780,10 +2070,99 @@ int OGRCSVLayer::TestCapability(const char *pszCap)
         return TRUE;
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return GetSpatialIndex() != nullptr;
     else
         return FALSE;
 }
 
+/************************************************************************/
+/*                          GetSpatialIndex()                           */
+/************************************************************************/
+
+// Returns the sidecar spatial index, if there is one that is up-to-date
+OGRSidecarSpatialIndex *OGRCSVLayer::GetSpatialIndex()
+{
+    if (!m_bSpatialIndexOpenAttempted)
+    {
+        m_bSpatialIndexOpenAttempted = true;
+        if (!bNew && !bInWriteMode && fpCSV != nullptr &&
+            poFeatureDefn->GetGeomFieldCount() > 0)
+        {
+            m_poSpatialIndex = OGRSidecarSpatialIndex::Open(
+                pszFilename, poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef());
+        }
+    }
+    return m_poSpatialIndex.get();
+}
+
+/************************************************************************/
+/*                         CreateSpatialIndex()                         */
+/************************************************************************/
+
+// Indexes the first geometry field in a .ogrsidx file.
+bool OGRCSVLayer::CreateSpatialIndex()
+{
+    if (bNew || bInWriteMode || fpCSV == nullptr ||
+        STARTS_WITH(pszFilename, "/vsistdin/"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "A spatial index can only be created on a file opened "
+                 "for reading");
+        return false;
+    }
+    if (poFeatureDefn->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Layer %s has no geometry field", GetDescription());
+        return false;
+    }
+
+    auto poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(0);
+    const bool bGeomFieldIgnored = CPL_TO_BOOL(poGeomFieldDefn->IsIgnored());
+    poGeomFieldDefn->SetIgnored(false);
+
+    OGRSidecarSpatialIndex::Builder oBuilder;
+    ResetReading();
+    while (true)
+    {
+        // Records are read with CPLReadLine3L(), which leaves the file
+        // positioned at the start of the next record.
+        const vsi_l_offset nOffset = VSIFTellL(fpCSV);
+        auto poFeature =
+            std::unique_ptr<OGRFeature>(GetNextUnfilteredFeature());
+        if (!poFeature)
+            break;
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            oBuilder.AddFeature(sEnvelope, nOffset, poFeature->GetFID());
+        }
+    }
+    poGeomFieldDefn->SetIgnored(bGeomFieldIgnored);
+    ResetReading();
+
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexOpenAttempted = false;
+    if (!oBuilder.Write(pszFilename, poGeomFieldDefn->GetNameRef()))
+        return false;
+    return GetSpatialIndex() != nullptr;
+}
+
+/************************************************************************/
+/*                          DropSpatialIndex()                          */
+/************************************************************************/
+
+bool OGRCSVLayer::DropSpatialIndex()
+{
+    ResetReading();
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexOpenAttempted = true;
+    return OGRSidecarSpatialIndex::Remove(pszFilename);
+}
+
 /************************************************************************/
 /*                          PreCreateField()                            */
 /************************************************************************/
@@ -20,6 +20,10 @@
 #include "ogr_p.h"
 #include "cpl_http.h"
 #include "cpl_json.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <atomic>
 
 #include <map>
 #include <memory>
@@ -77,6 +81,22 @@ class OGRElasticLayer final : public OGRLayer
     CPLString m_osBulkContent{};
     int m_nBulkUpload{};
 
+    //! Maximum number of _bulk requests in flight
+    int m_nBulkConcurrency = 1;
+
+    struct BulkRequest
+    {
+        CPLString osContent{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        bool bRet = true;
+        std::atomic<bool> bDone{false};
+    };
+
+    std::vector<std::unique_ptr<BulkRequest>> m_apoBulkRequests{};
+    // Must be declared after m_apoBulkRequests, so that pending jobs are
+    // completed before the requests they use are destroyed.
+    CPLJobQueuePtr m_poBulkJobQueue{};
+
     CPLString m_osFID{};
 
     std::vector<std::vector<CPLString>> m_aaosFieldPaths{};
@@ -122,7 +142,8 @@ class OGRElasticLayer final : public OGRLayer
 
     void CopyMembersTo(OGRElasticLayer *poNew);
 
-    bool PushIndex();
+    bool PushIndex(bool bWaitCompletion = true);
+    bool CollectBulkRequests(int nMaxRemaining);
     CPLString BuildMap();
 
     OGRErr WriteMapIfNecessary();
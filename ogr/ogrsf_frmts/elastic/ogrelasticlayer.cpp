@@ -22,6 +22,9 @@
 #include "ogrlibjsonutils.h"
 #include "ogrgeojsongeometry.h"
 #include "ogr_geo_utils.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 
 #include <cstdlib>
 #include <set>
@@ -105,6 +108,9 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
     {
         m_nBulkUpload =
             atoi(CSLFetchNameValueDef(papszOptions, "BULK_SIZE", "1000000"));
+        m_nBulkConcurrency = std::max(
+            1, atoi(CSLFetchNameValueDef(papszOptions, "BULK_CONCURRENCY",
+                                         "2")));
     }
 
     const char *pszStoredFields =
@@ -244,6 +250,7 @@ void OGRElasticLayer::CopyMembersTo(OGRElasticLayer *poNew)
     poNew->m_bFeatureDefnFinalized = true;
     poNew->m_osBulkContent = m_osBulkContent;
     poNew->m_nBulkUpload = m_nBulkUpload;
+    poNew->m_nBulkConcurrency = m_nBulkConcurrency;
     poNew->m_osFID = m_osFID;
     poNew->m_aaosFieldPaths = m_aaosFieldPaths;
     poNew->m_aosMapToFieldIndex = m_aosMapToFieldIndex;
@@ -2697,7 +2704,7 @@ OGRErr OGRElasticLayer::ICreateFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if ((int)m_osBulkContent.length() > m_nBulkUpload)
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bWaitCompletion = */ false))
             {
                 return OGRERR_FAILURE;
             }
@@ -2871,20 +2878,108 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
 /*                             PushIndex()                              */
 /************************************************************************/
 
-bool OGRElasticLayer::PushIndex()
+// Uploads the pending bulk content. If bWaitCompletion is false and
+// BULK_CONCURRENCY > 1, the _bulk request is sent by a worker thread, so that
+// the caller can go on building the next batch while up to
+// m_nBulkConcurrency requests are in flight. Errors of asynchronous requests
+// are reported by a later call.
+bool OGRElasticLayer::PushIndex(bool bWaitCompletion)
 {
+    bool bRet = true;
+    if (!bWaitCompletion && m_nBulkConcurrency > 1 &&
+        !m_osBulkContent.empty())
+    {
+        if (!m_poBulkJobQueue)
+        {
+            auto poThreadPool = GDALGetGlobalThreadPool(m_nBulkConcurrency);
+            if (poThreadPool)
+                m_poBulkJobQueue = poThreadPool->CreateJobQueue();
+        }
+        if (m_poBulkJobQueue)
+        {
+            bRet = CollectBulkRequests(m_nBulkConcurrency - 1);
+
+            auto poRequest = std::make_unique<BulkRequest>();
+            poRequest->osContent = std::move(m_osBulkContent);
+            m_osBulkContent.clear();
+            BulkRequest *poRequestPtr = poRequest.get();
+            m_apoBulkRequests.push_back(std::move(poRequest));
+
+            const CPLString osURL(CPLSPrintf("%s/_bulk", m_poDS->GetURL()));
+            const CPLStringList aosThreadLocalConfigOptions(
+                CPLGetThreadLocalConfigOptions());
+            auto poDS = m_poDS;
+            const auto job = [poDS, poRequestPtr, osURL,
+                              aosThreadLocalConfigOptions]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    aosThreadLocalConfigOptions.List());
+                {
+                    auto oAccumulator =
+                        poRequestPtr->oErrorAccumulator
+                            .InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    poRequestPtr->bRet =
+                        poDS->UploadFile(osURL, poRequestPtr->osContent);
+                    poRequestPtr->osContent.clear();
+                }
+                CPLSetThreadLocalConfigOptions(nullptr);
+                poRequestPtr->bDone = true;
+            };
+            if (!m_poBulkJobQueue->SubmitJob(job))
+                job();
+            return bRet;
+        }
+    }
+
+    if (!m_apoBulkRequests.empty())
+        bRet = CollectBulkRequests(0);
+
     if (m_osBulkContent.empty())
     {
-        return true;
+        return bRet;
     }
 
-    const bool bRet = m_poDS->UploadFile(
-        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
+    if (!m_poDS->UploadFile(CPLSPrintf("%s/_bulk", m_poDS->GetURL()),
+                            m_osBulkContent))
+        bRet = false;
     m_osBulkContent.clear();
 
     return bRet;
 }
 
+/************************************************************************/
+/*                        CollectBulkRequests()                         */
+/************************************************************************/
+
+// Waits until at most nMaxRemaining asynchronous _bulk requests are in
+// flight, and reports the errors of the completed ones.
+bool OGRElasticLayer::CollectBulkRequests(int nMaxRemaining)
+{
+    if (!m_poBulkJobQueue)
+        return true;
+
+    m_poBulkJobQueue->WaitCompletion(nMaxRemaining);
+
+    bool bRet = true;
+    auto oIter = m_apoBulkRequests.begin();
+    while (oIter != m_apoBulkRequests.end())
+    {
+        if ((*oIter)->bDone)
+        {
+            (*oIter)->oErrorAccumulator.ReplayErrors();
+            if (!(*oIter)->bRet)
+                bRet = false;
+            oIter = m_apoBulkRequests.erase(oIter);
+        }
+        else
+        {
+            ++oIter;
+        }
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                            CreateField()                             */
 /************************************************************************/
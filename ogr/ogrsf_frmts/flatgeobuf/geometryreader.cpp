@@ -505,3 +505,271 @@ OGRGeometry *GeometryReader::read()
     }
     return nullptr;
 }
+
+/************************************************************************/
+/*                      Direct conversion to WKB                        */
+/************************************************************************/
+
+namespace
+{
+
+// Points of a non-nested geometry, and their split into parts (rings or
+// line strings). Consistency checks are at least as strict as in read().
+class SimpleGeometryParts
+{
+    const Geometry *m_geometry;
+    const bool m_hasZ;
+    const bool m_hasM;
+    uint32_t m_nPoints = 0;
+
+  public:
+    SimpleGeometryParts(const Geometry *geometry, bool hasZ, bool hasM)
+        : m_geometry(geometry), m_hasZ(hasZ), m_hasM(hasM)
+    {
+    }
+
+    bool init()
+    {
+        const auto pXy = m_geometry->xy();
+        if (pXy == nullptr || (pXy->size() % 2) != 0 ||
+            pXy->size() >= feature_max_buffer_size / sizeof(OGRRawPoint))
+            return false;
+        m_nPoints = pXy->size() / 2;
+        if (m_hasZ &&
+            (m_geometry->z() == nullptr || m_geometry->z()->size() < m_nPoints))
+            return false;
+        if (m_hasM &&
+            (m_geometry->m() == nullptr || m_geometry->m()->size() < m_nPoints))
+            return false;
+        return true;
+    }
+
+    uint32_t getPointCount() const
+    {
+        return m_nPoints;
+    }
+
+    size_t getDimension() const
+    {
+        return 2 + (m_hasZ ? 1 : 0) + (m_hasM ? 1 : 0);
+    }
+
+    // Calls f(start, count) on each part defined by ends, or the single part
+    // made of all points. Returns false on inconsistent or empty parts.
+    template <class F> bool forEachPart(F f) const
+    {
+        const auto ends = m_geometry->ends();
+        if (ends == nullptr || ends->size() < 2)
+            return m_nPoints > 0 && f(0, m_nPoints);
+        uint32_t start = 0;
+        for (uint32_t i = 0; i < ends->size(); i++)
+        {
+            const auto e = ends->Get(i);
+            if (e <= start || e > m_nPoints)
+                return false;
+            if (!f(start, e - start))
+                return false;
+            start = e;
+        }
+        return true;
+    }
+
+    GByte *writePoints(GByte *pabyOut, uint32_t start, uint32_t count) const
+    {
+        // FlatGeobuf values are little-endian, as in NDR WKB
+        const GByte *xy =
+            reinterpret_cast<const GByte *>(m_geometry->xy()->data()) +
+            start * 2 * sizeof(double);
+        if (!m_hasZ && !m_hasM)
+        {
+            memcpy(pabyOut, xy, count * 2 * sizeof(double));
+            return pabyOut + count * 2 * sizeof(double);
+        }
+        const GByte *z =
+            m_hasZ ? reinterpret_cast<const GByte *>(m_geometry->z()->data()) +
+                         start * sizeof(double)
+                   : nullptr;
+        const GByte *m =
+            m_hasM ? reinterpret_cast<const GByte *>(m_geometry->m()->data()) +
+                         start * sizeof(double)
+                   : nullptr;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            memcpy(pabyOut, xy + i * 2 * sizeof(double), 2 * sizeof(double));
+            pabyOut += 2 * sizeof(double);
+            if (z)
+            {
+                memcpy(pabyOut, z + i * sizeof(double), sizeof(double));
+                pabyOut += sizeof(double);
+            }
+            if (m)
+            {
+                memcpy(pabyOut, m + i * sizeof(double), sizeof(double));
+                pabyOut += sizeof(double);
+            }
+        }
+        return pabyOut;
+    }
+};
+
+constexpr size_t WKB_HEADER_SIZE = 1 + sizeof(uint32_t);
+
+GByte *WriteWkbUInt32(GByte *pabyOut, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyOut, &nVal, sizeof(nVal));
+    return pabyOut + sizeof(nVal);
+}
+
+GByte *WriteWkbHeader(GByte *pabyOut, OGRwkbGeometryType eType, bool hasZ,
+                      bool hasM)
+{
+    *pabyOut = wkbNDR;
+    return WriteWkbUInt32(pabyOut + 1, static_cast<uint32_t>(eType) +
+                                           (hasZ ? 1000 : 0) +
+                                           (hasM ? 2000 : 0));
+}
+
+size_t GetSimpleWkbSize(const Geometry *geometry, GeometryType geometryType,
+                        bool hasZ, bool hasM)
+{
+    SimpleGeometryParts parts(geometry, hasZ, hasM);
+    if (!parts.init())
+        return 0;
+    const size_t pointSize = parts.getDimension() * sizeof(double);
+    size_t nSize = 0;
+    switch (geometryType)
+    {
+        case GeometryType::Point:
+            if (parts.getPointCount() == 0)
+                return 0;
+            return WKB_HEADER_SIZE + pointSize;
+        case GeometryType::MultiPoint:
+            return WKB_HEADER_SIZE + sizeof(uint32_t) +
+                   parts.getPointCount() * (WKB_HEADER_SIZE + pointSize);
+        case GeometryType::LineString:
+            return WKB_HEADER_SIZE + sizeof(uint32_t) +
+                   parts.getPointCount() * pointSize;
+        case GeometryType::MultiLineString:
+            nSize = WKB_HEADER_SIZE + sizeof(uint32_t);
+            if (!parts.forEachPart(
+                    [&nSize, pointSize](uint32_t, uint32_t count)
+                    {
+                        nSize += WKB_HEADER_SIZE + sizeof(uint32_t) +
+                                 count * pointSize;
+                        return true;
+                    }))
+                return 0;
+            return nSize;
+        case GeometryType::Polygon:
+            nSize = WKB_HEADER_SIZE + sizeof(uint32_t);
+            if (!parts.forEachPart(
+                    [&nSize, pointSize](uint32_t, uint32_t count)
+                    {
+                        nSize += sizeof(uint32_t) + count * pointSize;
+                        return true;
+                    }))
+                return 0;
+            return nSize;
+        default:
+            break;
+    }
+    return 0;
+}
+
+GByte *WriteSimpleWkb(GByte *pabyOut, const Geometry *geometry,
+                      GeometryType geometryType, bool hasZ, bool hasM)
+{
+    SimpleGeometryParts parts(geometry, hasZ, hasM);
+    CPL_IGNORE_RET_VAL(parts.init());
+    uint32_t nParts = 0;
+    switch (geometryType)
+    {
+        case GeometryType::Point:
+            pabyOut = WriteWkbHeader(pabyOut, wkbPoint, hasZ, hasM);
+            return parts.writePoints(pabyOut, 0, 1);
+        case GeometryType::MultiPoint:
+            pabyOut = WriteWkbHeader(pabyOut, wkbMultiPoint, hasZ, hasM);
+            pabyOut = WriteWkbUInt32(pabyOut, parts.getPointCount());
+            for (uint32_t i = 0; i < parts.getPointCount(); i++)
+            {
+                pabyOut = WriteWkbHeader(pabyOut, wkbPoint, hasZ, hasM);
+                pabyOut = parts.writePoints(pabyOut, i, 1);
+            }
+            return pabyOut;
+        case GeometryType::LineString:
+            pabyOut = WriteWkbHeader(pabyOut, wkbLineString, hasZ, hasM);
+            pabyOut = WriteWkbUInt32(pabyOut, parts.getPointCount());
+            return parts.writePoints(pabyOut, 0, parts.getPointCount());
+        case GeometryType::MultiLineString:
+        case GeometryType::Polygon:
+        {
+            const bool bIsPolygon = geometryType == GeometryType::Polygon;
+            pabyOut = WriteWkbHeader(
+                pabyOut, bIsPolygon ? wkbPolygon : wkbMultiLineString, hasZ,
+                hasM);
+            parts.forEachPart(
+                [&nParts](uint32_t, uint32_t)
+                {
+                    ++nParts;
+                    return true;
+                });
+            pabyOut = WriteWkbUInt32(pabyOut, nParts);
+            parts.forEachPart(
+                [&pabyOut, &parts, bIsPolygon, hasZ,
+                 hasM](uint32_t start, uint32_t count)
+                {
+                    if (!bIsPolygon)
+                        pabyOut =
+                            WriteWkbHeader(pabyOut, wkbLineString, hasZ, hasM);
+                    pabyOut = WriteWkbUInt32(pabyOut, count);
+                    pabyOut = parts.writePoints(pabyOut, start, count);
+                    return true;
+                });
+            return pabyOut;
+        }
+        default:
+            break;
+    }
+    return pabyOut;
+}
+
+}  // namespace
+
+size_t GeometryReader::getWkbSize() const
+{
+    if (m_geometryType == GeometryType::MultiPolygon)
+    {
+        const auto parts = m_geometry->parts();
+        if (parts == nullptr)
+            return 0;
+        size_t nSize = WKB_HEADER_SIZE + sizeof(uint32_t);
+        for (uoffset_t i = 0; i < parts->size(); i++)
+        {
+            const size_t nPartSize = GetSimpleWkbSize(
+                parts->Get(i), GeometryType::Polygon, m_hasZ, m_hasM);
+            if (nPartSize == 0)
+                return 0;
+            nSize += nPartSize;
+        }
+        return nSize;
+    }
+    return GetSimpleWkbSize(m_geometry, m_geometryType, m_hasZ, m_hasM);
+}
+
+void GeometryReader::writeWkb(GByte *pabyOut) const
+{
+    if (m_geometryType == GeometryType::MultiPolygon)
+    {
+        const auto parts = m_geometry->parts();
+        pabyOut = WriteWkbHeader(pabyOut, wkbMultiPolygon, m_hasZ, m_hasM);
+        pabyOut = WriteWkbUInt32(pabyOut, parts->size());
+        for (uoffset_t i = 0; i < parts->size(); i++)
+        {
+            pabyOut = WriteSimpleWkb(pabyOut, parts->Get(i),
+                                     GeometryType::Polygon, m_hasZ, m_hasM);
+        }
+        return;
+    }
+    WriteSimpleWkb(pabyOut, m_geometry, m_geometryType, m_hasZ, m_hasM);
+}
@@ -96,6 +96,14 @@ class GeometryReader
     }
 
     OGRGeometry *read();
+
+    // Direct conversion to ISO WKB, without instantiating OGRGeometry
+    // objects. Only handles (Multi)Point, (Multi)LineString and
+    // (Multi)Polygon. getWkbSize() returns 0 for other geometry types, or
+    // if the geometry has any inconsistency, in which case read() must be
+    // used instead (which will report errors if needed).
+    size_t getWkbSize() const;
+    void writeWkb(GByte *pabyOut) const;
 };
 
 }  // namespace ogr_flatgeobuf
@@ -16,6 +16,7 @@
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_time.h"
+#include "gdal_thread_pool.h"
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogrlayerarrow.h"
@@ -28,6 +29,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <new>
 #include <stdexcept>
@@ -534,6 +536,57 @@ static bool SupportsSeekWhileWriting(const std::string &osFilename)
            STARTS_WITH(osFilename.c_str(), "/vsimem/");
 }
 
+/** Returns a runner spreading jobs over the global thread pool, according
+ * to GDAL_NUM_THREADS, or running them serially.
+ */
+static FlatGeobuf::ParallelRunner CreateParallelRunner(
+    uint64_t nFeatures,
+    std::unique_ptr<GDALThreadReservation> &poThreadReservation)
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    //! Minimum number of features for multithreading to be worthwhile
+    constexpr uint64_t MIN_FEATURES = 100 * 1000;
+    if (nThreads <= 1 || nFeatures < MIN_FEATURES)
+        return FlatGeobuf::runSerially;
+
+    poThreadReservation = std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        return FlatGeobuf::runSerially;
+    CPLDebug("FlatGeobuf", "Building spatial index with %d threads", nThreads);
+
+    return [poThreadPool, nThreads](
+               size_t nCount, size_t nMinChunkSize,
+               const std::function<void(size_t, size_t)> &fn)
+    {
+        if (nCount < 2 * nMinChunkSize)
+        {
+            FlatGeobuf::runSerially(nCount, nMinChunkSize, fn);
+            return;
+        }
+        // A few jobs per thread, to balance the load
+        const size_t nChunkSize = std::max(
+            nMinChunkSize, nCount / (4 * static_cast<size_t>(nThreads)) + 1);
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (size_t nBegin = 0; nBegin < nCount; nBegin += nChunkSize)
+        {
+            const size_t nEnd = std::min(nCount, nBegin + nChunkSize);
+            if (!poJobQueue->SubmitJob([&fn, nBegin, nEnd]()
+                                       { fn(nBegin, nEnd); }))
+            {
+                fn(nBegin, nEnd);
+            }
+        }
+        poJobQueue->WaitCompletion();
+    };
+}
+
 bool OGRFlatGeobufLayer::CreateFinalFile()
 {
     // no spatial index requested, we are (almost) done
@@ -607,8 +660,20 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
 
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    const auto runner =
+        CreateParallelRunner(m_featuresCount, poThreadReservation);
+
     CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
+    try
+    {
+        hilbertSort(m_featureItems, runner);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Create: %s", e.what());
+        return false;
+    }
     CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
     uint64_t featureOffset = 0;
     for (auto &item : m_featureItems)
@@ -620,16 +685,17 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
     c = 0;
     try
     {
-        const auto fillNodeItems = [this](NodeItem *dest)
+        const auto fillNodeItems = [this, &runner](NodeItem *dest)
         {
-            size_t i = 0;
-            for (const auto &featureItem : m_featureItems)
-            {
-                dest[i] = featureItem.nodeItem;
-                ++i;
-            }
+            runner(m_featureItems.size(), 10000,
+                   [this, dest](size_t begin, size_t end)
+                   {
+                       for (size_t i = begin; i < end; ++i)
+                           dest[i] = m_featureItems[i].nodeItem;
+                   });
         };
-        PackedRTree tree(fillNodeItems, m_featureItems.size(), extent);
+        PackedRTree tree(fillNodeItems, m_featureItems.size(), extent, 16,
+                         runner);
         CPLDebugOnly("FlatGeobuf", "PackedRTree extent %f, %f, %f, %f",
                      extentVector[0], extentVector[1], extentVector[2],
                      extentVector[3]);
@@ -1123,16 +1189,33 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         }
     }
 
-    const auto err = ensureFeatureBuf(featureSize);
-    if (err != OGRERR_NONE)
-        return err;
-    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        return CPLErrorIO("reading feature");
+    // Directly use the file content when it is available in memory
+    // (/vsimem/ or memory-mapped local file), and suitably aligned for
+    // FlatBuffers.
+    const GByte *featureBuf = nullptr;
+    const vsi_l_offset featureOffset = VSIFTellL(m_poFp);
+    const void *mappedFeature =
+        m_poFp->GetReadOnlyPointer(featureOffset, featureSize);
+    if (mappedFeature &&
+        (reinterpret_cast<uintptr_t>(mappedFeature) % sizeof(double)) == 0 &&
+        VSIFSeekL(m_poFp, featureOffset + featureSize, SEEK_SET) == 0)
+    {
+        featureBuf = static_cast<const GByte *>(mappedFeature);
+    }
+    else
+    {
+        const auto err = ensureFeatureBuf(featureSize);
+        if (err != OGRERR_NONE)
+            return err;
+        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
+            return CPLErrorIO("reading feature");
+        featureBuf = m_featureBuf;
+    }
     m_offset += featureSize + sizeof(featureSize);
 
     if (m_bVerifyBuffers)
     {
-        Verifier v(m_featureBuf, featureSize);
+        Verifier v(featureBuf, featureSize);
         const auto ok = VerifyFeatureBuffer(v);
         if (!ok)
         {
@@ -1146,7 +1229,7 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         }
     }
 
-    const auto feature = GetRoot<Feature>(m_featureBuf);
+    const auto feature = GetRoot<Feature>(featureBuf);
     const auto geometry = feature->geometry();
     if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
     {
@@ -1604,20 +1687,31 @@ begin:
             auto geometryType = m_geometryType;
             if (geometryType == GeometryType::Unknown)
                 geometryType = geometry->type();
-            auto poOGRGeometry = std::unique_ptr<OGRGeometry>(
-                GeometryReader(geometry, geometryType, m_hasZ, m_hasM).read());
-            if (poOGRGeometry == nullptr)
+            const GeometryReader reader(geometry, geometryType, m_hasZ,
+                                        m_hasM);
+            // Fast path, for the most common geometry types, where the WKB
+            // is directly written from the FlatBuffers coordinate vectors.
+            std::unique_ptr<OGRGeometry> poOGRGeometry;
+            size_t nWKBSize = reader.getWkbSize();
+            if (nWKBSize == 0)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Failed to read geometry");
-                goto error;
-            }
+                poOGRGeometry.reset(
+                    GeometryReader(geometry, geometryType, m_hasZ, m_hasM)
+                        .read());
+                if (poOGRGeometry == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to read geometry");
+                    goto error;
+                }
 
-            if (!FilterGeometry(poOGRGeometry.get()))
-                goto end_of_loop;
+                if (!FilterGeometry(poOGRGeometry.get()))
+                    goto end_of_loop;
+
+                nWKBSize = poOGRGeometry->WkbSize();
+            }
 
             const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[0];
-            const size_t nWKBSize = poOGRGeometry->WkbSize();
 
             if (iFeat > 0)
             {
@@ -1639,7 +1733,36 @@ begin:
                 errorErrno = ENOMEM;
                 goto error;
             }
-            poOGRGeometry->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            if (poOGRGeometry)
+            {
+                poOGRGeometry->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else
+            {
+                reader.writeWkb(outPtr);
+                // The offsets of the WKB are overwritten by the next
+                // feature if this one is discarded.
+                OGREnvelope sEnvelope;
+                if (m_poFilterGeom &&
+                    !FilterWKBGeometry(outPtr, nWKBSize,
+                                       /* bEnvelopeAlreadySet = */ false,
+                                       sEnvelope))
+                {
+                    goto end_of_loop;
+                }
+            }
+        }
+        else if (!m_poFeatureDefn->IsGeometryIgnored())
+        {
+            // Consistent with FilterGeometry() used by GetNextFeature()
+            if (m_poFilterGeom)
+                goto end_of_loop;
+            const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[0];
+            if (iArrowField >= 0 && !sHelper.SetNull(iArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
         }
 
         abSetFields.clear();
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <iostream>
 
@@ -182,6 +183,59 @@ void hilbertSort(std::vector<NodeItem> &items)
               });
 }
 
+void runSerially(size_t count, size_t /* minChunkSize */,
+                 const std::function<void(size_t, size_t)> &fn)
+{
+    if (count > 0)
+        fn(0, count);
+}
+
+void sortHilbertKeys(std::vector<std::pair<uint32_t, size_t>> &keys,
+                     const ParallelRunner &runner)
+{
+    // Decreasing Hilbert value, as hilbertSort(), then increasing index
+    const auto cmp = [](const std::pair<uint32_t, size_t> &a,
+                        const std::pair<uint32_t, size_t> &b)
+    {
+        return a.first > b.first ||
+               (a.first == b.first && a.second < b.second);
+    };
+
+    // Sort sub-ranges independently
+    std::mutex mutex;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    runner(keys.size(), 10000,
+           [&](size_t begin, size_t end)
+           {
+               std::sort(keys.begin() + begin, keys.begin() + end, cmp);
+               std::lock_guard<std::mutex> lock(mutex);
+               ranges.emplace_back(begin, end);
+           });
+    std::sort(ranges.begin(), ranges.end());
+
+    // and merge adjacent sorted sub-ranges pairwise
+    while (ranges.size() > 1)
+    {
+        std::vector<std::pair<size_t, size_t>> merged((ranges.size() + 1) / 2);
+        runner(ranges.size() / 2, 1,
+               [&](size_t begin, size_t end)
+               {
+                   for (size_t i = begin; i < end; ++i)
+                   {
+                       const auto &a = ranges[2 * i];
+                       const auto &b = ranges[2 * i + 1];
+                       std::inplace_merge(keys.begin() + a.first,
+                                          keys.begin() + b.first,
+                                          keys.begin() + b.second, cmp);
+                       merged[i] = std::make_pair(a.first, b.second);
+                   }
+               });
+        if ((ranges.size() % 2) != 0)
+            merged.back() = ranges.back();
+        ranges = std::move(merged);
+    }
+}
+
 NodeItem calcExtent(const std::vector<std::shared_ptr<Item>> &items)
 {
     return std::accumulate(
@@ -251,20 +305,30 @@ PackedRTree::generateLevelBounds(const uint64_t numItems,
     return levelBounds;
 }
 
-void PackedRTree::generateNodes()
+void PackedRTree::generateNodes(const ParallelRunner &runner)
 {
     for (uint32_t i = 0; i < _levelBounds.size() - 1; i++)
     {
-        auto pos = _levelBounds[i].first;
-        auto end = _levelBounds[i].second;
-        auto newpos = _levelBounds[i + 1].first;
-        while (pos < end)
-        {
-            NodeItem node = NodeItem::create(pos);
-            for (uint32_t j = 0; j < _nodeSize && pos < end; j++)
-                node.expand(_nodeItems[pos++]);
-            _nodeItems[newpos++] = node;
-        }
+        const auto levelStart = _levelBounds[i].first;
+        const auto levelEnd = _levelBounds[i].second;
+        const auto parentStart = _levelBounds[i + 1].first;
+        const auto numParents = _levelBounds[i + 1].second - parentStart;
+        // Parent nodes only depend on their children, so that the nodes of
+        // a level can be computed concurrently
+        runner(static_cast<size_t>(numParents), 1024,
+               [&](size_t begin, size_t end)
+               {
+                   for (size_t p = begin; p < end; p++)
+                   {
+                       auto pos = levelStart + p * _nodeSize;
+                       const auto childEnd =
+                           std::min<uint64_t>(pos + _nodeSize, levelEnd);
+                       NodeItem node = NodeItem::create(pos);
+                       while (pos < childEnd)
+                           node.expand(_nodeItems[pos++]);
+                       _nodeItems[parentStart + p] = node;
+                   }
+               });
     }
 }
 
@@ -318,6 +382,16 @@ PackedRTree::PackedRTree(std::function<void(NodeItem *)> fillNodeItems,
     generateNodes();
 }
 
+PackedRTree::PackedRTree(std::function<void(NodeItem *)> fillNodeItems,
+                         const uint64_t numItems, const NodeItem &extent,
+                         const uint16_t nodeSize, const ParallelRunner &runner)
+    : _extent(extent), _numItems(numItems)
+{
+    init(nodeSize);
+    fillNodeItems(_nodeItems + _numNodes - _numItems);
+    generateNodes(runner);
+}
+
 std::vector<SearchResultItem>
 PackedRTree::search(double minX, double minY, double maxX, double maxY) const
 {
@@ -18,7 +18,10 @@
 
 #include <cmath>
 #include <deque>
+#include <functional>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -109,6 +112,58 @@ template <class ITEM_TYPE> void hilbertSort(std::deque<ITEM_TYPE> &items)
         });
 }
 
+/**
+ * Calls fn(begin, end) on sub-ranges, of at least minChunkSize elements
+ * (except the last one), partitioning [0, count). Sub-ranges may be
+ * processed concurrently. Returns once all of them have been processed.
+ */
+using ParallelRunner = std::function<void(
+    size_t count, size_t minChunkSize,
+    const std::function<void(size_t begin, size_t end)> &fn)>;
+
+void runSerially(size_t count, size_t minChunkSize,
+                 const std::function<void(size_t, size_t)> &fn);
+
+void sortHilbertKeys(std::vector<std::pair<uint32_t, size_t>> &keys,
+                     const ParallelRunner &runner);
+
+/**
+ * Same as hilbertSort(std::deque<ITEM_TYPE>&), but with Hilbert values
+ * computed once per item, and both their computation and their sort
+ * spread with runner. Items with the same Hilbert value keep their
+ * relative order, so the result does not depend on the parallelism.
+ */
+template <class ITEM_TYPE>
+void hilbertSort(std::deque<ITEM_TYPE> &items, const ParallelRunner &runner)
+{
+    constexpr size_t MIN_CHUNK_SIZE = 10000;
+    NodeItem extent = calcExtent(items);
+    const double minX = extent.minX;
+    const double minY = extent.minY;
+    const double width = extent.width();
+    const double height = extent.height();
+    std::vector<std::pair<uint32_t, size_t>> keys(items.size());
+    runner(items.size(), MIN_CHUNK_SIZE,
+           [&](size_t begin, size_t end)
+           {
+               for (size_t i = begin; i < end; ++i)
+               {
+                   keys[i].first = hilbert(items[i].nodeItem, HILBERT_MAX,
+                                           minX, minY, width, height);
+                   keys[i].second = i;
+               }
+           });
+    sortHilbertKeys(keys, runner);
+    std::deque<ITEM_TYPE> sorted(items.size());
+    runner(items.size(), MIN_CHUNK_SIZE,
+           [&](size_t begin, size_t end)
+           {
+               for (size_t i = begin; i < end; ++i)
+                   sorted[i] = std::move(items[keys[i].second]);
+           });
+    items.swap(sorted);
+}
+
 void hilbertSort(std::vector<NodeItem> &items);
 NodeItem calcExtent(const std::vector<std::shared_ptr<Item>> &items);
 NodeItem calcExtent(const std::vector<NodeItem> &rects);
@@ -126,7 +181,7 @@ class PackedRTree
     uint16_t _nodeSize;
     std::vector<std::pair<uint64_t, uint64_t>> _levelBounds;
     void init(const uint16_t nodeSize);
-    void generateNodes();
+    void generateNodes(const ParallelRunner &runner = runSerially);
     void fromData(const void *data);
 
   public:
@@ -145,6 +200,9 @@ class PackedRTree
     PackedRTree(std::function<void(NodeItem *)> fillNodeItems,
                 const uint64_t numItems, const NodeItem &extent,
                 const uint16_t nodeSize = 16);
+    PackedRTree(std::function<void(NodeItem *)> fillNodeItems,
+                const uint64_t numItems, const NodeItem &extent,
+                const uint16_t nodeSize, const ParallelRunner &runner);
     std::vector<SearchResultItem> search(double minX, double minY, double maxX,
                                          double maxY) const;
     static std::vector<SearchResultItem> streamSearch(
@@ -62,4 +62,28 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                        SupportsRangeMatches()                        */
+/************************************************************************/
+
+bool OGRAttrIndex::SupportsRangeMatches() const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+GIntBig *OGRAttrIndex::GetRangeMatches(const OGRField * /* psMin */,
+                                       bool /* bMinIncluded */,
+                                       const OGRField * /* psMax */,
+                                       bool /* bMaxIncluded */,
+                                       GIntBig * /* panFIDList */,
+                                       int * /* nFIDCount */,
+                                       int * /* nLength */)
+{
+    return nullptr;
+}
+
 //! @endcond
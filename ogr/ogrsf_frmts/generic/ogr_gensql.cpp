@@ -1472,6 +1472,118 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                         BuildJoinHashTable()                         */
+/*                                                                      */
+/*      For a join on the equality of an integer field of the primary   */
+/*      table and an integer field of the secondary table, read the     */
+/*      secondary table once and build a hash table from the key to     */
+/*      the FID of the first matching feature, instead of issuing an    */
+/*      attribute filter on the secondary table for each primary        */
+/*      feature.                                                        */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::BuildJoinHashTable(int iJoin)
+{
+    JoinHashTable &oHashTable = m_aoJoinHashTables[iJoin];
+    oHashTable.bBuilt = true;
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2)
+        return;
+
+    const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+    if (poPrimary->eNodeType == SNT_COLUMN &&
+        poPrimary->table_index == psJoinInfo->secondary_table)
+        std::swap(poPrimary, poSecondary);
+    if (poPrimary->eNodeType != SNT_COLUMN || poPrimary->table_index != 0 ||
+        poSecondary->eNodeType != SNT_COLUMN ||
+        poSecondary->table_index != psJoinInfo->secondary_table)
+        return;
+
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+    if (poJoinLayer == m_poSrcLayer ||
+        !poJoinLayer->TestCapability(OLCRandomRead))
+        return;
+
+    const auto IsIntegerField = [](OGRLayer *poLayer, int iField)
+    {
+        const OGRFeatureDefn *poLayerDefn = poLayer->GetLayerDefn();
+        if (iField < 0 || iField >= poLayerDefn->GetFieldCount())
+            return false;
+        const auto eType = poLayerDefn->GetFieldDefn(iField)->GetType();
+        return eType == OFTInteger || eType == OFTInteger64;
+    };
+    if (!IsIntegerField(m_poSrcLayer, poPrimary->field_index) ||
+        !IsIntegerField(poJoinLayer, poSecondary->field_index))
+        return;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_GENSQL_HASH_JOIN", "YES")))
+        return;
+
+    const int iSecondaryField = poSecondary->field_index;
+    poJoinLayer->SetAttributeFilter(nullptr);
+    for (auto &&poJoinFeat : *poJoinLayer)
+    {
+        if (poJoinFeat->IsFieldSetAndNotNull(iSecondaryField))
+        {
+            // emplace() keeps the first feature for a given key, consistently
+            // with the first result of the attribute filter.
+            oHashTable.oMapKeyToFID.emplace(
+                poJoinFeat->GetFieldAsInteger64(iSecondaryField),
+                poJoinFeat->GetFID());
+        }
+    }
+    poJoinLayer->ResetReading();
+
+    oHashTable.iPrimaryField = poPrimary->field_index;
+    oHashTable.bUsable = true;
+    CPLDebug("GenSQL", "Using hash join on %s (%d distinct keys)",
+             poJoinLayer->GetName(),
+             static_cast<int>(oHashTable.oMapKeyToFID.size()));
+}
+
+/************************************************************************/
+/*                   FetchJoinFeatureWithHashTable()                    */
+/*                                                                      */
+/*      Returns false if the join cannot be resolved with a hash        */
+/*      table, in which case the generic attribute filter based         */
+/*      method must be used.                                            */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::FetchJoinFeatureWithHashTable(
+    int iJoin, OGRFeature *poSrcFeat,
+    std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    if (m_aoJoinHashTables.empty())
+        m_aoJoinHashTables.resize(m_pSelectInfo->join_count);
+    if (!m_aoJoinHashTables[iJoin].bBuilt)
+        BuildJoinHashTable(iJoin);
+
+    const JoinHashTable &oHashTable = m_aoJoinHashTables[iJoin];
+    if (!oHashTable.bUsable)
+        return false;
+
+    poJoinFeature.reset();
+    // if source key is null, we can't do join.
+    if (poSrcFeat->IsFieldSetAndNotNull(oHashTable.iPrimaryField))
+    {
+        const auto oIter = oHashTable.oMapKeyToFID.find(
+            poSrcFeat->GetFieldAsInteger64(oHashTable.iPrimaryField));
+        if (oIter != oHashTable.oMapKeyToFID.end())
+        {
+            const int secondary_table =
+                m_pSelectInfo->join_defs[iJoin].secondary_table;
+            poJoinFeature.reset(
+                m_apoTableLayers[secondary_table]->GetFeature(oIter->second));
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1503,6 +1615,13 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        std::unique_ptr<OGRFeature> poJoinFeature;
+        if (FetchJoinFeatureWithHashTable(iJoin, poSrcFeat, poJoinFeature))
+        {
+            apoFeatures.push_back(std::move(poJoinFeature));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1517,8 +1636,6 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
             continue;
         }
 
-        std::unique_ptr<OGRFeature> poJoinFeature;
-
         poJoinLayer->ResetReading();
         if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
             poJoinFeature.reset(poJoinLayer->GetNextFeature());
@@ -2255,6 +2372,23 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      ORDER BY ... LIMIT n [OFFSET m] case: only the n + m first       */
+    /*      records need to be retained. This cannot be done if a filter    */
+    /*      must be evaluated on the result features.                       */
+    /* -------------------------------------------------------------------- */
+    constexpr GIntBig MAX_TOP_K = 100 * 1000;
+    if (psSelectInfo->limit > 0 && psSelectInfo->offset >= 0 &&
+        psSelectInfo->offset < MAX_TOP_K &&
+        psSelectInfo->limit <= MAX_TOP_K - psSelectInfo->offset &&
+        m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
+    {
+        CreateOrderByIndexTopK(
+            static_cast<size_t>(psSelectInfo->offset + psSelectInfo->limit));
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2402,6 +2536,129 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     ResetReading();
 }
 
+/************************************************************************/
+/*                       CreateOrderByIndexTopK()                       */
+/*                                                                      */
+/*      Variant of CreateOrderByIndex() that only keeps the nTopK       */
+/*      first records in a bounded max-heap, which reduces memory       */
+/*      usage to O(nTopK) and the complexity to O(N log(nTopK)).        */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::CreateOrderByIndexTopK(size_t nTopK)
+{
+    const int nOrderItems = m_pSelectInfo->order_specs;
+
+    // Row i of asIndexFields holds the key values of the record of FID
+    // anFIDList[i], which is the anSequence[i]-th one of the source layer.
+    std::vector<OGRField> asIndexFields;
+    std::vector<GIntBig> anFIDList;
+    std::vector<GIntBig> anSequence;
+    std::vector<size_t> anHeap;
+    try
+    {
+        const size_t nReserve = std::min<size_t>(nTopK, 1000);
+        asIndexFields.reserve(nOrderItems * nReserve);
+        anFIDList.reserve(nReserve);
+        anSequence.reserve(nReserve);
+        anHeap.reserve(nReserve);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return;
+    }
+
+    // Ties are resolved with the sequence number, so that the result is
+    // the same as the one of the (stable) sort of CreateOrderByIndex()
+    const auto Less = [this, nOrderItems, &asIndexFields,
+                       &anSequence](size_t i, size_t j)
+    {
+        const int nRes = Compare(asIndexFields.data() + i * nOrderItems,
+                                 asIndexFields.data() + j * nOrderItems);
+        if (nRes != 0)
+            return nRes < 0;
+        return anSequence[i] < anSequence[j];
+    };
+
+    std::vector<OGRField> asCurrentFields(nOrderItems);
+    GIntBig nSequence = 0;
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        memset(asCurrentFields.data(), 0, sizeof(OGRField) * nOrderItems);
+        ReadIndexFields(poSrcFeat.get(), nOrderItems, asCurrentFields.data());
+
+        if (anHeap.size() < nTopK)
+        {
+            try
+            {
+                asIndexFields.insert(asIndexFields.end(),
+                                     asCurrentFields.begin(),
+                                     asCurrentFields.end());
+                anFIDList.push_back(poSrcFeat->GetFID());
+                anSequence.push_back(nSequence);
+                anHeap.push_back(anHeap.size());
+            }
+            catch (const std::bad_alloc &)
+            {
+                FreeIndexFields(asCurrentFields.data(), 1);
+                FreeIndexFields(asIndexFields.data(), anFIDList.size());
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "CreateOrderByIndex(): out of memory");
+                return;
+            }
+            std::push_heap(anHeap.begin(), anHeap.end(), Less);
+        }
+        else
+        {
+            // The current record comes after all the retained ones, so it
+            // only replaces the greatest one if it is strictly less.
+            const size_t iGreatest = anHeap.front();
+            OGRField *pasGreatestFields =
+                asIndexFields.data() + iGreatest * nOrderItems;
+            if (Compare(asCurrentFields.data(), pasGreatestFields) < 0)
+            {
+                std::pop_heap(anHeap.begin(), anHeap.end(), Less);
+                FreeIndexFields(pasGreatestFields, 1);
+                memcpy(pasGreatestFields, asCurrentFields.data(),
+                       sizeof(OGRField) * nOrderItems);
+                anFIDList[iGreatest] = poSrcFeat->GetFID();
+                anSequence[iGreatest] = nSequence;
+                std::push_heap(anHeap.begin(), anHeap.end(), Less);
+            }
+            else
+            {
+                FreeIndexFields(asCurrentFields.data(), 1);
+            }
+        }
+        ++nSequence;
+    }
+
+    std::sort_heap(anHeap.begin(), anHeap.end(), Less);
+
+    /* -------------------------------------------------------------------- */
+    /*      Build m_anFIDIndex, unless the retained records are the first   */
+    /*      ones of the source layer in their natural order.                */
+    /* -------------------------------------------------------------------- */
+    bool bAlreadySorted = true;
+    for (size_t i = 0; i < anHeap.size(); ++i)
+    {
+        if (anSequence[anHeap[i]] != static_cast<GIntBig>(i))
+        {
+            bAlreadySorted = false;
+            break;
+        }
+    }
+    if (!bAlreadySorted)
+    {
+        m_anFIDIndex.reserve(anHeap.size());
+        for (const size_t iRow : anHeap)
+            m_anFIDIndex.push_back(anFIDList[iRow]);
+    }
+
+    FreeIndexFields(asIndexFields.data(), anFIDList.size());
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -19,6 +19,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <unordered_map>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -73,10 +74,27 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Hash table from the key value to the FID of the first matching
+    // secondary feature, for joins on an integer equality
+    struct JoinHashTable
+    {
+        bool bBuilt = false;
+        bool bUsable = false;
+        int iPrimaryField = -1;
+        std::unordered_map<GIntBig, GIntBig> oMapKeyToFID{};
+    };
+
+    std::vector<JoinHashTable> m_aoJoinHashTables{};
+
     bool PrepareSummary();
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
+    void CreateOrderByIndexTopK(size_t nTopK);
+    void BuildJoinHashTable(int iJoin);
+    bool
+    FetchJoinFeatureWithHashTable(int iJoin, OGRFeature *poSrcFeat,
+                                  std::unique_ptr<OGRFeature> &poJoinFeature);
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
     void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
@@ -0,0 +1,481 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  In-memory implementation of attribute indexes, supporting
+ *           equality and range lookups.
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_attrind.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                           OGRMemAttrIndex                            */
+/*                                                                      */
+/*      Index of one field, as an ordered multimap from the field       */
+/*      value to the FIDs. Strings are indexed lower-cased, as OGR      */
+/*      SQL compares them case insensitively. Null and NaN values are   */
+/*      not indexed, as no comparison matches them.                     */
+/************************************************************************/
+
+namespace
+{
+template <class Key> class OGRMemAttrIndex final : public OGRAttrIndex
+{
+    const OGRFieldType m_eType;
+    std::multimap<Key, GIntBig> m_oMap{};
+
+    bool GetKey(const OGRField *psField, Key &key) const;
+
+    static GIntBig *AppendFID(GIntBig *panFIDList, int *nFIDCount,
+                              int *nLength, GIntBig nFID);
+
+  public:
+    explicit OGRMemAttrIndex(OGRFieldType eType) : m_eType(eType)
+    {
+    }
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
+                           int *nLength) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+
+    bool SupportsRangeMatches() const override
+    {
+        return true;
+    }
+
+    GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                             const OGRField *psMax, bool bMaxIncluded,
+                             GIntBig *panFIDList, int *nFIDCount,
+                             int *nLength) override;
+};
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+template <>
+bool OGRMemAttrIndex<GIntBig>::GetKey(const OGRField *psField,
+                                      GIntBig &key) const
+{
+    key = m_eType == OFTInteger ? psField->Integer : psField->Integer64;
+    return true;
+}
+
+template <>
+bool OGRMemAttrIndex<double>::GetKey(const OGRField *psField,
+                                     double &key) const
+{
+    key = psField->Real;
+    return !std::isnan(key);
+}
+
+template <>
+bool OGRMemAttrIndex<std::string>::GetKey(const OGRField *psField,
+                                          std::string &key) const
+{
+    if (psField->String == nullptr)
+        return false;
+    key = CPLString(psField->String).tolower();
+    return true;
+}
+
+/************************************************************************/
+/*                             AppendFID()                              */
+/************************************************************************/
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::AppendFID(GIntBig *panFIDList, int *nFIDCount,
+                                         int *nLength, GIntBig nFID)
+{
+    if (*nFIDCount >= *nLength - 1)
+    {
+        *nLength = (*nLength) * 2 + 10;
+        panFIDList = static_cast<GIntBig *>(
+            CPLRealloc(panFIDList, sizeof(GIntBig) * (*nLength)));
+    }
+    panFIDList[(*nFIDCount)++] = nFID;
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+template <class Key>
+GIntBig OGRMemAttrIndex<Key>::GetFirstMatch(OGRField *psKey)
+{
+    Key key;
+    if (!GetKey(psKey, key))
+        return OGRNullFID;
+    const auto oIter = m_oMap.find(key);
+    return oIter == m_oMap.end() ? OGRNullFID : oIter->second;
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetAllMatches(OGRField *psKey,
+                                             GIntBig *panFIDList,
+                                             int *nFIDCount, int *nLength)
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    Key key;
+    if (GetKey(psKey, key))
+    {
+        const auto oRange = m_oMap.equal_range(key);
+        for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+            panFIDList =
+                AppendFID(panFIDList, nFIDCount, nLength, oIter->second);
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount = 0;
+    int nLength = 0;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetRangeMatches(
+    const OGRField *psMin, bool bMinIncluded, const OGRField *psMax,
+    bool bMaxIncluded, GIntBig *panFIDList, int *nFIDCount, int *nLength)
+{
+    auto oBegin = m_oMap.begin();
+    auto oEnd = m_oMap.end();
+    if (psMin)
+    {
+        Key key;
+        if (!GetKey(psMin, key))
+            return nullptr;
+        oBegin = bMinIncluded ? m_oMap.lower_bound(key)
+                              : m_oMap.upper_bound(key);
+    }
+    if (psMax)
+    {
+        Key key;
+        if (!GetKey(psMax, key))
+            return nullptr;
+        oEnd = bMaxIncluded ? m_oMap.upper_bound(key) : m_oMap.lower_bound(key);
+    }
+
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    // An empty range (min > max) has its begin iterator after its end.
+    if (oBegin != m_oMap.end() &&
+        (oEnd == m_oMap.end() || !(oEnd->first < oBegin->first)))
+    {
+        for (auto oIter = oBegin; oIter != oEnd; ++oIter)
+            panFIDList =
+                AppendFID(panFIDList, nFIDCount, nLength, oIter->second);
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                              AddEntry()                              */
+/************************************************************************/
+
+template <class Key>
+OGRErr OGRMemAttrIndex<Key>::AddEntry(OGRField *psKey, GIntBig nFID)
+{
+    Key key;
+    if (GetKey(psKey, key))
+        m_oMap.emplace(std::move(key), nFID);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            RemoveEntry()                             */
+/************************************************************************/
+
+template <class Key>
+OGRErr OGRMemAttrIndex<Key>::RemoveEntry(OGRField *psKey, GIntBig nFID)
+{
+    Key key;
+    if (GetKey(psKey, key))
+    {
+        const auto oRange = m_oMap.equal_range(key);
+        for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+        {
+            if (oIter->second == nFID)
+            {
+                m_oMap.erase(oIter);
+                break;
+            }
+        }
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+template <class Key> OGRErr OGRMemAttrIndex<Key>::Clear()
+{
+    m_oMap.clear();
+    return OGRERR_NONE;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                        OGRMemLayerAttrIndex                          */
+/************************************************************************/
+
+class OGRMemLayerAttrIndex final : public OGRLayerAttrIndex
+{
+    std::map<int, std::unique_ptr<OGRAttrIndex>> m_oMapIndexes{};
+
+  public:
+    OGRMemLayerAttrIndex() = default;
+
+    OGRErr Initialize(const char *pszIndexPath, OGRLayer *) override;
+
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+};
+
+/************************************************************************/
+/*                             Initialize()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::Initialize(const char * /* pszIndexPath */,
+                                        OGRLayer *poLayerIn)
+{
+    poLayer = poLayerIn;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::CreateIndex(int iField)
+{
+    OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    if (iField < 0 || iField >= poDefn->GetFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid field index %d for index creation.", iField);
+        return OGRERR_FAILURE;
+    }
+
+    if (m_oMapIndexes.find(iField) != m_oMapIndexes.end())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "It seems we already have an index for field %d/%s\n"
+                 "of layer %s.",
+                 iField, poDefn->GetFieldDefn(iField)->GetNameRef(),
+                 poLayer->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    const OGRFieldType eType = poDefn->GetFieldDefn(iField)->GetType();
+    switch (eType)
+    {
+        case OFTInteger:
+        case OFTInteger64:
+            m_oMapIndexes[iField] =
+                std::make_unique<OGRMemAttrIndex<GIntBig>>(eType);
+            break;
+
+        case OFTReal:
+            m_oMapIndexes[iField] =
+                std::make_unique<OGRMemAttrIndex<double>>(eType);
+            break;
+
+        case OFTString:
+            m_oMapIndexes[iField] =
+                std::make_unique<OGRMemAttrIndex<std::string>>(eType);
+            break;
+
+        default:
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Indexing not supported for the field type of field %s.",
+                     poDefn->GetFieldDefn(iField)->GetNameRef());
+            return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::DropIndex(int iField)
+{
+    const auto oIter = m_oMapIndexes.find(iField);
+    if (oIter == m_oMapIndexes.end())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DROP INDEX on field (%d) that doesn't have an index.",
+                 iField);
+        return OGRERR_FAILURE;
+    }
+    m_oMapIndexes.erase(oIter);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::IndexAllFeatures(int iField)
+{
+    // Index all features, whatever the current filters of the layer.
+    const std::string osAttrQuery =
+        poLayer->GetAttrQueryString() ? poLayer->GetAttrQueryString() : "";
+    const int iGeomFieldFilter = poLayer->GetGeomFieldFilter();
+    std::unique_ptr<OGRGeometry> poSpatialFilter(
+        poLayer->GetSpatialFilter() ? poLayer->GetSpatialFilter()->clone()
+                                    : nullptr);
+    if (!osAttrQuery.empty())
+        poLayer->SetAttributeFilter(nullptr);
+    if (poSpatialFilter)
+        poLayer->SetSpatialFilter(nullptr);
+
+    OGRErr eErr = OGRERR_NONE;
+    poLayer->ResetReading();
+    while (eErr == OGRERR_NONE)
+    {
+        std::unique_ptr<OGRFeature> poFeature(poLayer->GetNextFeature());
+        if (!poFeature)
+            break;
+        eErr = AddToIndex(poFeature.get(), iField);
+    }
+
+    if (poSpatialFilter)
+        poLayer->SetSpatialFilter(iGeomFieldFilter, poSpatialFilter.get());
+    if (!osAttrQuery.empty())
+        poLayer->SetAttributeFilter(osAttrQuery.c_str());
+    poLayer->ResetReading();
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                             AddToIndex()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::AddToIndex(OGRFeature *poFeature,
+                                        int iTargetField)
+{
+    if (poFeature->GetFID() == OGRNullFID)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Attempt to index feature with no FID.");
+        return OGRERR_FAILURE;
+    }
+
+    for (const auto &[iField, poIndex] : m_oMapIndexes)
+    {
+        if (iTargetField != -1 && iTargetField != iField)
+            continue;
+
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+
+        const OGRErr eErr = poIndex->AddEntry(poFeature->GetRawFieldRef(iField),
+                                              poFeature->GetFID());
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          RemoveFromIndex()                           */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::RemoveFromIndex(OGRFeature *poFeature)
+{
+    for (const auto &[iField, poIndex] : m_oMapIndexes)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+
+        const OGRErr eErr = poIndex->RemoveEntry(
+            poFeature->GetRawFieldRef(iField), poFeature->GetFID());
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRMemLayerAttrIndex::GetFieldIndex(int iField)
+{
+    const auto oIter = m_oMapIndexes.find(iField);
+    return oIter == m_oMapIndexes.end() ? nullptr : oIter->second.get();
+}
+
+/************************************************************************/
+/*                     OGRCreateMemoryLayerIndex()                      */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRCreateMemoryLayerIndex()
+
+{
+    return new OGRMemLayerAttrIndex();
+}
+
+//! @endcond
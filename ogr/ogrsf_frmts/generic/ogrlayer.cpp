@@ -865,6 +865,78 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                          FillNextFeature()                           */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature.
+
+ This method is similar to GetNextFeature(), except that the previous content
+ of oFeature is replaced with the next feature, instead of a new feature being
+ returned. Calling it in a loop with the same feature object enables drivers
+ to reuse its memory, which avoids allocating and destroying an OGRFeature and
+ its field array for each iteration.
+
+ To benefit from that, oFeature should have been created with the feature
+ definition returned by GetLayerDefn(). The default implementation calls
+ GetNextFeature() and exchanges the content of the returned feature with
+ oFeature, which may change the feature definition of oFeature.
+
+ If no more features are available, the content of oFeature is unspecified.
+
+ This method is the same as the C function OGR_L_FillNextFeature().
+
+ @param oFeature feature into which the next feature is read.
+ @return true if a feature has been read, false if no more features are
+ available.
+
+ @since GDAL 3.12
+*/
+
+bool OGRLayer::FillNextFeature(OGRFeature &oFeature)
+{
+    std::unique_ptr<OGRFeature> poFeature(GetNextFeature());
+    if (!poFeature)
+        return false;
+    oFeature.Swap(*poFeature);
+    return true;
+}
+
+/************************************************************************/
+/*                        OGR_L_FillNextFeature()                       */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature.
+
+ This function is similar to OGR_L_GetNextFeature(), except that the previous
+ content of hFeat is replaced with the next feature, instead of a new feature
+ being returned. See OGRLayer::FillNextFeature() for more details.
+
+ This function is the same as the C++ method OGRLayer::FillNextFeature().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeat handle to the feature into which the next feature is read,
+ typically created with OGR_F_Create(OGR_L_GetLayerDefn(hLayer)).
+ @return true if a feature has been read, false if no more features are
+ available.
+
+ @since GDAL 3.12
+*/
+
+bool OGR_L_FillNextFeature(OGRLayerH hLayer, OGRFeatureH hFeat)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_FillNextFeature", false);
+    VALIDATE_POINTER1(hFeat, "OGR_L_FillNextFeature", false);
+
+    return OGRLayer::FromHandle(hLayer)->FillNextFeature(
+        *OGRFeature::FromHandle(hFeat));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -2175,6 +2247,72 @@ int OGRLayer::InstallFilter(const OGRGeometry *poFilter)
 
 //! @endcond
 
+/************************************************************************/
+/*                    PointIntersectsPolygonalFilter()                  */
+/************************************************************************/
+
+/* Determines whether the point (dfX, dfY) intersects the filter geometry,
+ * without going through GEOS, when the filter geometry is a (multi)polygon
+ * made of linear rings. Returns false if the filter geometry is of another
+ * type.
+ */
+static bool PointIntersectsPolygonalFilter(double dfX, double dfY,
+                                           const OGRGeometry *poFilterGeom,
+                                           bool &bIntersects)
+{
+    const auto PointIntersectsPolygon =
+        [](const OGRPoint &oPoint, const OGRPolygon *poPolygon)
+    {
+        bool bInExteriorRing = false;
+        for (const auto *poRing : *poPolygon)
+        {
+            // Points on the boundary of a ring, hole or not, intersect
+            if (poRing->isPointOnRingBoundary(&oPoint, TRUE))
+                return true;
+            const bool bInRing = CPL_TO_BOOL(poRing->isPointInRing(&oPoint));
+            if (!bInExteriorRing)
+            {
+                if (!bInRing)
+                    return false;
+                bInExteriorRing = true;
+            }
+            else if (bInRing)
+            {
+                return false;
+            }
+        }
+        return bInExteriorRing;
+    };
+
+    const OGRPoint oPoint(dfX, dfY);
+    switch (wkbFlatten(poFilterGeom->getGeometryType()))
+    {
+        case wkbPolygon:
+        {
+            bIntersects =
+                PointIntersectsPolygon(oPoint, poFilterGeom->toPolygon());
+            return true;
+        }
+
+        case wkbMultiPolygon:
+        {
+            bIntersects = false;
+            for (const auto *poPolygon : *(poFilterGeom->toMultiPolygon()))
+            {
+                if (PointIntersectsPolygon(oPoint, poPolygon))
+                {
+                    bIntersects = true;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
 /************************************************************************/
 /*                   DoesGeometryHavePointInEnvelope()                  */
 /************************************************************************/
@@ -2302,6 +2440,15 @@ int OGRLayer::FilterGeometry(const OGRGeometry *poGeometry)
                 return true;
         }
 
+        bool bIntersects = false;
+        if (wkbFlatten(poGeometry->getGeometryType()) == wkbPoint &&
+            PointIntersectsPolygonalFilter(poGeometry->toPoint()->getX(),
+                                           poGeometry->toPoint()->getY(),
+                                           m_poFilterGeom, bIntersects))
+        {
+            return bIntersects;
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Fallback to full intersect test (using GEOS) if we still */
@@ -2367,6 +2514,15 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
             {
                 return true;
             }
+            double dfX = 0;
+            double dfY = 0;
+            bool bIntersects = false;
+            if (OGRWKBGetPoint(pabyWKB, nWKBSize, dfX, dfY) &&
+                PointIntersectsPolygonalFilter(dfX, dfY, poFilterGeom,
+                                               bIntersects))
+            {
+                return bIntersects;
+            }
             else if (OGRGeometryFactory::haveGEOS())
             {
                 OGRGeometry *poGeom = nullptr;
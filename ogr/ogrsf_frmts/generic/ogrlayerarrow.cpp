@@ -4821,6 +4821,426 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                        ColumnarPredicate                             */
+/************************************************************************/
+
+namespace
+{
+// Comparison of a top-level numeric Arrow column with constants
+struct ColumnarPredicate
+{
+    const struct ArrowArray *psArray = nullptr;
+    char chFormat = 0;
+    swq_op eOp = SWQ_EQ;  // EQ, NE, LT, LE, GT, GE, BETWEEN, IN or ISNULL
+    bool bNot = false;    // only for ISNULL
+    bool bFloat = false;  // whether comparison is done on doubles
+    std::vector<int64_t> anValues{};
+    std::vector<double> adfValues{};
+};
+}  // namespace
+
+/************************************************************************/
+/*                    GetColumnarPredicateColumn()                      */
+/************************************************************************/
+
+static bool GetColumnarPredicateColumn(
+    const OGRFeatureDefn *poFeatureDefn, const swq_expr_node *poNode,
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+    ColumnarPredicate &sPredicate)
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0 ||
+        poNode->field_index < 0 ||
+        poNode->field_index >= poFeatureDefn->GetFieldCount())
+    {
+        return false;
+    }
+    const auto poFieldDefn = poFeatureDefn->GetFieldDefn(poNode->field_index);
+    const auto oIter = oMapFieldNameToArrowPath.find(poFieldDefn->GetNameRef());
+    if (oIter == oMapFieldNameToArrowPath.end() || oIter->second.size() != 1)
+        return false;
+    const int iChild = oIter->second[0];
+    const char *format = schema->children[iChild]->format;
+    if (format[0] == 0 || format[1] != 0)
+        return false;
+
+    // Only accept the Arrow types whose values are set unchanged in the
+    // OGR field by FillValidityArrayFromAttrQuery()
+    const char chFormat = format[0];
+    bool bOK = false;
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger64:
+            bOK = chFormat == ARROW_LETTER_UINT32 ||
+                  chFormat == ARROW_LETTER_INT64;
+            [[fallthrough]];
+        case OFTInteger:
+            bOK = bOK || chFormat == ARROW_LETTER_INT8 ||
+                  chFormat == ARROW_LETTER_UINT8 ||
+                  chFormat == ARROW_LETTER_INT16 ||
+                  chFormat == ARROW_LETTER_UINT16 ||
+                  chFormat == ARROW_LETTER_INT32;
+            break;
+        case OFTReal:
+            bOK = chFormat == ARROW_LETTER_FLOAT32 ||
+                  chFormat == ARROW_LETTER_FLOAT64;
+            sPredicate.bFloat = true;
+            break;
+        default:
+            break;
+    }
+    if (!bOK)
+        return false;
+
+    sPredicate.psArray = array->children[iChild];
+    sPredicate.chFormat = chFormat;
+    return true;
+}
+
+/************************************************************************/
+/*                     CollectColumnarPredicates()                      */
+/************************************************************************/
+
+// Decomposes the expression into a conjunction of ColumnarPredicate.
+// Returns false if the expression does not have that form.
+static bool CollectColumnarPredicates(
+    const OGRFeatureDefn *poFeatureDefn, const swq_expr_node *poNode,
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+    std::vector<ColumnarPredicate> &aoPredicates)
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    if (poNode->nOperation == SWQ_AND && poNode->nSubExprCount == 2)
+    {
+        return CollectColumnarPredicates(
+                   poFeatureDefn, poNode->papoSubExpr[0], schema, array,
+                   oMapFieldNameToArrowPath, aoPredicates) &&
+               CollectColumnarPredicates(
+                   poFeatureDefn, poNode->papoSubExpr[1], schema, array,
+                   oMapFieldNameToArrowPath, aoPredicates);
+    }
+
+    ColumnarPredicate sPredicate;
+    if (poNode->nOperation == SWQ_NOT && poNode->nSubExprCount == 1)
+    {
+        sPredicate.bNot = true;
+        poNode = poNode->papoSubExpr[0];
+        if (poNode->eNodeType != SNT_OPERATION ||
+            poNode->nOperation != SWQ_ISNULL)
+        {
+            return false;
+        }
+    }
+
+    const int nCount = poNode->nSubExprCount;
+    sPredicate.eOp = static_cast<swq_op>(poNode->nOperation);
+    switch (sPredicate.eOp)
+    {
+        case SWQ_ISNULL:
+        {
+            if (nCount != 1 ||
+                !GetColumnarPredicateColumn(
+                    poFeatureDefn, poNode->papoSubExpr[0], schema, array,
+                    oMapFieldNameToArrowPath, sPredicate))
+            {
+                return false;
+            }
+            aoPredicates.push_back(std::move(sPredicate));
+            return true;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+            break;
+
+        default:
+            return false;
+    }
+
+    if (nCount < 2 || (sPredicate.eOp == SWQ_BETWEEN && nCount != 3) ||
+        (sPredicate.eOp != SWQ_BETWEEN && sPredicate.eOp != SWQ_IN &&
+         nCount != 2))
+    {
+        return false;
+    }
+
+    // Normalize "constant op column" as "column op' constant"
+    int iColumn = 0;
+    if (nCount == 2 && sPredicate.eOp != SWQ_IN &&
+        poNode->papoSubExpr[0]->eNodeType == SNT_CONSTANT)
+    {
+        iColumn = 1;
+        switch (sPredicate.eOp)
+        {
+            case SWQ_LT:
+                sPredicate.eOp = SWQ_GT;
+                break;
+            case SWQ_LE:
+                sPredicate.eOp = SWQ_GE;
+                break;
+            case SWQ_GT:
+                sPredicate.eOp = SWQ_LT;
+                break;
+            case SWQ_GE:
+                sPredicate.eOp = SWQ_LE;
+                break;
+            default:
+                break;
+        }
+    }
+    if (!GetColumnarPredicateColumn(poFeatureDefn, poNode->papoSubExpr[iColumn],
+                                    schema, array, oMapFieldNameToArrowPath,
+                                    sPredicate))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < nCount; ++i)
+    {
+        if (i == iColumn)
+            continue;
+        const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+        if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null ||
+            !(SWQ_IS_INTEGER(poConstant->field_type) ||
+              poConstant->field_type == SWQ_FLOAT))
+        {
+            return false;
+        }
+        if (poConstant->field_type == SWQ_FLOAT)
+            sPredicate.bFloat = true;
+    }
+
+    for (int i = 0; i < nCount; ++i)
+    {
+        if (i == iColumn)
+            continue;
+        const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+        if (sPredicate.bFloat)
+        {
+            sPredicate.adfValues.push_back(
+                poConstant->field_type == SWQ_FLOAT
+                    ? poConstant->float_value
+                    : static_cast<double>(poConstant->int_value));
+        }
+        else
+        {
+            sPredicate.anValues.push_back(poConstant->int_value);
+        }
+    }
+    if (sPredicate.eOp == SWQ_IN)
+    {
+        std::sort(sPredicate.anValues.begin(), sPredicate.anValues.end());
+        std::sort(sPredicate.adfValues.begin(), sPredicate.adfValues.end());
+    }
+
+    aoPredicates.push_back(std::move(sPredicate));
+    return true;
+}
+
+/************************************************************************/
+/*                   FilterArrowColumnByPredicate()                     */
+/************************************************************************/
+
+// Unselects the rows whose value does not satisfy the predicate.
+// Written so that compilers can vectorize the loop.
+template <class T, class Pred>
+static void FilterArrowColumnByPredicate(const struct ArrowArray *psArray,
+                                         std::vector<uint8_t> &abySelection,
+                                         Pred pred)
+{
+    const size_t nLength = abySelection.size();
+    const T *CPL_RESTRICT paValues =
+        static_cast<const T *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    uint8_t *CPL_RESTRICT pabySelection = abySelection.data();
+    for (size_t i = 0; i < nLength; ++i)
+        pabySelection[i] &= static_cast<uint8_t>(pred(paValues[i]));
+}
+
+template <class Pred>
+static void FilterArrowColumnByPredicate(const ColumnarPredicate &sPredicate,
+                                         std::vector<uint8_t> &abySelection,
+                                         Pred pred)
+{
+    const auto psArray = sPredicate.psArray;
+    switch (sPredicate.chFormat)
+    {
+        case ARROW_LETTER_INT8:
+            FilterArrowColumnByPredicate<int8_t>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_UINT8:
+            FilterArrowColumnByPredicate<uint8_t>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_INT16:
+            FilterArrowColumnByPredicate<int16_t>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_UINT16:
+            FilterArrowColumnByPredicate<uint16_t>(psArray, abySelection,
+                                                   pred);
+            break;
+        case ARROW_LETTER_INT32:
+            FilterArrowColumnByPredicate<int32_t>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_UINT32:
+            FilterArrowColumnByPredicate<uint32_t>(psArray, abySelection,
+                                                   pred);
+            break;
+        case ARROW_LETTER_INT64:
+            FilterArrowColumnByPredicate<int64_t>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_FLOAT32:
+            FilterArrowColumnByPredicate<float>(psArray, abySelection, pred);
+            break;
+        case ARROW_LETTER_FLOAT64:
+            FilterArrowColumnByPredicate<double>(psArray, abySelection, pred);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                      ApplyColumnarPredicate()                        */
+/************************************************************************/
+
+template <class V>
+static void ApplyColumnarPredicate(const ColumnarPredicate &sPredicate,
+                                   const std::vector<V> &aValues,
+                                   std::vector<uint8_t> &abySelection)
+{
+    const V a = aValues[0];
+    switch (sPredicate.eOp)
+    {
+        case SWQ_EQ:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) == a; });
+            break;
+        case SWQ_NE:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) != a; });
+            break;
+        case SWQ_LT:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) < a; });
+            break;
+        case SWQ_LE:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) <= a; });
+            break;
+        case SWQ_GT:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) > a; });
+            break;
+        case SWQ_GE:
+            FilterArrowColumnByPredicate(sPredicate, abySelection,
+                                         [a](auto v)
+                                         { return static_cast<V>(v) >= a; });
+            break;
+        case SWQ_BETWEEN:
+        {
+            const V b = aValues[1];
+            FilterArrowColumnByPredicate(
+                sPredicate, abySelection, [a, b](auto v)
+                { return static_cast<V>(v) >= a && static_cast<V>(v) <= b; });
+            break;
+        }
+        case SWQ_IN:
+        {
+            // aValues is sorted
+            FilterArrowColumnByPredicate(
+                sPredicate, abySelection,
+                [&aValues](auto v)
+                {
+                    return std::binary_search(aValues.begin(), aValues.end(),
+                                              static_cast<V>(v));
+                });
+            break;
+        }
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*               FillValidityArrayFromColumnarPredicates()              */
+/************************************************************************/
+
+static size_t FillValidityArrayFromColumnarPredicates(
+    const std::vector<ColumnarPredicate> &aoPredicates,
+    std::vector<bool> &abyValidityFromFilters)
+{
+    const size_t nLength = abyValidityFromFilters.size();
+    std::vector<uint8_t> abySelection(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+        abySelection[i] = abyValidityFromFilters[i];
+
+    for (const auto &sPredicate : aoPredicates)
+    {
+        const auto psArray = sPredicate.psArray;
+        const uint8_t *pabyValidity =
+            psArray->null_count == 0
+                ? nullptr
+                : static_cast<const uint8_t *>(psArray->buffers[0]);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        if (sPredicate.eOp == SWQ_ISNULL)
+        {
+            if (!pabyValidity)
+            {
+                if (!sPredicate.bNot)
+                    std::fill(abySelection.begin(), abySelection.end(), 0);
+                continue;
+            }
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                if (TestBit(pabyValidity, i + nOffset) != sPredicate.bNot)
+                    abySelection[i] = 0;
+            }
+            continue;
+        }
+
+        if (sPredicate.bFloat)
+            ApplyColumnarPredicate(sPredicate, sPredicate.adfValues,
+                                   abySelection);
+        else
+            ApplyColumnarPredicate(sPredicate, sPredicate.anValues,
+                                   abySelection);
+
+        // Comparisons with a NULL value are never true
+        if (pabyValidity)
+        {
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                if (!TestBit(pabyValidity, i + nOffset))
+                    abySelection[i] = 0;
+            }
+        }
+    }
+
+    size_t nCountIntersecting = 0;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        abyValidityFromFilters[i] = abySelection[i] != 0;
+        nCountIntersecting += abySelection[i];
+    }
+    return nCountIntersecting;
+}
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4839,6 +5259,22 @@ static size_t FillValidityArrayFromAttrQuery(
     BuildMapFieldNameToArrowPath(schema, oMapFieldNameToArrowPath,
                                  std::string(), anArrowPathTmp);
 
+    // Fast path for conjunctions of comparisons of numeric columns with
+    // constants, evaluated directly on the Arrow buffers.
+    // The config option is for debug and testing purposes only.
+    if (CPLTestBool(CPLGetConfigOption("OGR_SQL_COMPILE_WHERE", "YES")))
+    {
+        std::vector<ColumnarPredicate> aoPredicates;
+        if (CollectColumnarPredicates(
+                poFeatureDefn,
+                static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+                schema, array, oMapFieldNameToArrowPath, aoPredicates))
+        {
+            return FillValidityArrayFromColumnarPredicates(
+                aoPredicates, abyValidityFromFilters);
+        }
+    }
+
     struct UsedFieldsInfo
     {
         int iOGRFieldIndex{};
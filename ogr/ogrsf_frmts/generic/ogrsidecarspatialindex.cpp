@@ -0,0 +1,395 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Sidecar spatial index for sequentially readable vector files
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogrsidecarspatialindex.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+
+#include "packedrtree.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+//! @cond Doxygen_Suppress
+
+using namespace FlatGeobuf;
+
+// File layout (little-endian):
+// - magic:         8 bytes: "OGRSIDX" followed by the version number (1)
+// - uint64:        size of the data file
+// - int64:         modification time of the data file
+// - uint64:        number of indexed features
+// - uint16:        node size of the R-tree
+// - uint16:        reserved (0)
+// - uint32:        length of the name of the indexed geometry field
+// - name of the indexed geometry field (without nul terminator)
+// - packed Hilbert R-tree, whose leaf offsets are byte offsets of records
+// - int64 x number of indexed features: FID of the leaves of the R-tree
+
+constexpr GByte SIDX_MAGIC[] = {'O', 'G', 'R', 'S', 'I', 'D', 'X', 1};
+constexpr int SIDX_FIXED_HEADER_SIZE = 40;
+constexpr uint16_t SIDX_NODE_SIZE = 16;
+constexpr uint32_t SIDX_MAX_GEOM_FIELD_NAME_LENGTH = 10 * 1024;
+
+/************************************************************************/
+/*                          GetDataFileStat()                           */
+/************************************************************************/
+
+static bool GetDataFileStat(const std::string &osDataFilename,
+                            uint64_t &nSize, int64_t &nMTime)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osDataFilename.c_str(), &sStat) != 0)
+        return false;
+    nSize = static_cast<uint64_t>(sStat.st_size);
+    nMTime = static_cast<int64_t>(sStat.st_mtime);
+    return true;
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+/** Returns the name of the sidecar index file of a data file */
+std::string
+OGRSidecarSpatialIndex::GetFilename(const std::string &osDataFilename)
+{
+    return osDataFilename + ".ogrsidx";
+}
+
+/************************************************************************/
+/*                       ~OGRSidecarSpatialIndex()                      */
+/************************************************************************/
+
+OGRSidecarSpatialIndex::~OGRSidecarSpatialIndex() = default;
+
+/************************************************************************/
+/*                        Builder::AddFeature()                         */
+/************************************************************************/
+
+/** Registers a feature, whose record starts at nOffset in the data file.
+ * Features with an empty envelope must not be added.
+ */
+void OGRSidecarSpatialIndex::Builder::AddFeature(const OGREnvelope &sEnvelope,
+                                                 vsi_l_offset nOffset,
+                                                 GIntBig nFID)
+{
+    Item sItem;
+    sItem.sEnvelope = sEnvelope;
+    sItem.sEntry.nOffset = nOffset;
+    sItem.sEntry.nFID = nFID;
+    m_aoItems.push_back(sItem);
+}
+
+/************************************************************************/
+/*                           Builder::Write()                           */
+/************************************************************************/
+
+/** Writes the index of the registered features, for the data file in
+ * its current state.
+ */
+bool OGRSidecarSpatialIndex::Builder::Write(const std::string &osDataFilename,
+                                            const std::string &osGeomFieldName)
+{
+    uint64_t nDataFileSize = 0;
+    int64_t nDataFileMTime = 0;
+    if (!GetDataFileStat(osDataFilename, nDataFileSize, nDataFileMTime))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s",
+                 osDataFilename.c_str());
+        return false;
+    }
+
+    const std::string osFilename(GetFilename(osDataFilename));
+    auto fp = VSIVirtualHandleUniquePtr(VSIFOpenL(osFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    const uint64_t nItems = static_cast<uint64_t>(m_aoItems.size());
+    const uint32_t nNameLength = static_cast<uint32_t>(std::min<size_t>(
+        osGeomFieldName.size(), SIDX_MAX_GEOM_FIELD_NAME_LENGTH));
+
+    GByte abyHeader[SIDX_FIXED_HEADER_SIZE] = {0};
+    memcpy(abyHeader, SIDX_MAGIC, sizeof(SIDX_MAGIC));
+    CPL_LSBPTR64(&nDataFileSize);
+    memcpy(abyHeader + 8, &nDataFileSize, sizeof(nDataFileSize));
+    CPL_LSBPTR64(&nDataFileMTime);
+    memcpy(abyHeader + 16, &nDataFileMTime, sizeof(nDataFileMTime));
+    uint64_t nItemsLSB = nItems;
+    CPL_LSBPTR64(&nItemsLSB);
+    memcpy(abyHeader + 24, &nItemsLSB, sizeof(nItemsLSB));
+    uint16_t nNodeSize = SIDX_NODE_SIZE;
+    CPL_LSBPTR16(&nNodeSize);
+    memcpy(abyHeader + 32, &nNodeSize, sizeof(nNodeSize));
+    uint32_t nNameLengthLSB = nNameLength;
+    CPL_LSBPTR32(&nNameLengthLSB);
+    memcpy(abyHeader + 36, &nNameLengthLSB, sizeof(nNameLengthLSB));
+
+    bool bOK = fp->Write(abyHeader, sizeof(abyHeader), 1) == 1 &&
+               fp->Write(osGeomFieldName.data(), 1, nNameLength) == nNameLength;
+
+    if (bOK && nItems > 0)
+    {
+        try
+        {
+            std::vector<NodeItem> aoNodes;
+            aoNodes.reserve(m_aoItems.size());
+            for (size_t i = 0; i < m_aoItems.size(); ++i)
+            {
+                const auto &sEnv = m_aoItems[i].sEnvelope;
+                aoNodes.push_back(NodeItem{sEnv.MinX, sEnv.MinY, sEnv.MaxX,
+                                           sEnv.MaxY,
+                                           static_cast<uint64_t>(i)});
+            }
+            hilbertSort(aoNodes);
+
+            // The offset of the leaves is the index of the item until
+            // sorting is done: replace it with the offset of the record.
+            std::vector<int64_t> anFIDs;
+            anFIDs.reserve(aoNodes.size());
+            for (auto &oNode : aoNodes)
+            {
+                const auto &sEntry =
+                    m_aoItems[static_cast<size_t>(oNode.offset)].sEntry;
+                oNode.offset = static_cast<uint64_t>(sEntry.nOffset);
+                int64_t nFID = static_cast<int64_t>(sEntry.nFID);
+                CPL_LSBPTR64(&nFID);
+                anFIDs.push_back(nFID);
+            }
+            m_aoItems.clear();
+
+            const NodeItem extent = calcExtent(aoNodes);
+            PackedRTree oTree(aoNodes, extent, SIDX_NODE_SIZE);
+            aoNodes.clear();
+            oTree.streamWrite(
+                [&fp, &bOK](uint8_t *data, size_t size)
+                { bOK = bOK && fp->Write(data, 1, size) == size; });
+
+            bOK = bOK && fp->Write(anFIDs.data(), sizeof(int64_t),
+                                   anFIDs.size()) == anFIDs.size();
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot build spatial index: %s", e.what());
+            bOK = false;
+        }
+    }
+
+    bOK = fp->Close() == 0 && bOK;
+    fp.reset();
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 osFilename.c_str());
+        VSIUnlink(osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Opens the index of a data file, for the geometry field of the specified
+ * name.
+ *
+ * Returns nullptr if there is no index, or if it does not correspond to
+ * the geometry field or to the current state of the data file.
+ */
+std::unique_ptr<OGRSidecarSpatialIndex>
+OGRSidecarSpatialIndex::Open(const std::string &osDataFilename,
+                             const std::string &osGeomFieldName)
+{
+    const std::string osFilename(GetFilename(osDataFilename));
+    VSIStatBufL sStat;
+    if (VSIStatExL(osFilename.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) != 0)
+        return nullptr;
+
+    auto fp = VSIVirtualHandleUniquePtr(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+
+    GByte abyHeader[SIDX_FIXED_HEADER_SIZE];
+    if (fp->Read(abyHeader, sizeof(abyHeader), 1) != 1 ||
+        memcmp(abyHeader, SIDX_MAGIC, sizeof(SIDX_MAGIC)) != 0)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index", osFilename.c_str());
+        return nullptr;
+    }
+
+    uint64_t nIndexedDataFileSize = 0;
+    memcpy(&nIndexedDataFileSize, abyHeader + 8, sizeof(uint64_t));
+    CPL_LSBPTR64(&nIndexedDataFileSize);
+    int64_t nIndexedDataFileMTime = 0;
+    memcpy(&nIndexedDataFileMTime, abyHeader + 16, sizeof(int64_t));
+    CPL_LSBPTR64(&nIndexedDataFileMTime);
+    uint64_t nItems = 0;
+    memcpy(&nItems, abyHeader + 24, sizeof(uint64_t));
+    CPL_LSBPTR64(&nItems);
+    uint16_t nNodeSize = 0;
+    memcpy(&nNodeSize, abyHeader + 32, sizeof(uint16_t));
+    CPL_LSBPTR16(&nNodeSize);
+    uint32_t nNameLength = 0;
+    memcpy(&nNameLength, abyHeader + 36, sizeof(uint32_t));
+    CPL_LSBPTR32(&nNameLength);
+
+    uint64_t nDataFileSize = 0;
+    int64_t nDataFileMTime = 0;
+    if (!GetDataFileStat(osDataFilename, nDataFileSize, nDataFileMTime) ||
+        nDataFileSize != nIndexedDataFileSize ||
+        nDataFileMTime != nIndexedDataFileMTime)
+    {
+        CPLDebug("OGR", "Ignoring %s, which is older than %s",
+                 osFilename.c_str(), osDataFilename.c_str());
+        return nullptr;
+    }
+
+    if (nNodeSize < 2 || nNameLength > SIDX_MAX_GEOM_FIELD_NAME_LENGTH)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index", osFilename.c_str());
+        return nullptr;
+    }
+    std::string osIndexedGeomFieldName;
+    osIndexedGeomFieldName.resize(nNameLength);
+    if (fp->Read(osIndexedGeomFieldName.data(), 1, nNameLength) !=
+        nNameLength)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index", osFilename.c_str());
+        return nullptr;
+    }
+    if (osIndexedGeomFieldName != osGeomFieldName)
+    {
+        CPLDebug("OGR", "%s indexes geometry field '%s', not '%s'",
+                 osFilename.c_str(), osIndexedGeomFieldName.c_str(),
+                 osGeomFieldName.c_str());
+        return nullptr;
+    }
+
+    auto poIndex =
+        std::unique_ptr<OGRSidecarSpatialIndex>(new OGRSidecarSpatialIndex());
+    poIndex->m_nItems = nItems;
+    poIndex->m_nNodeSize = nNodeSize;
+    poIndex->m_nTreeOffset = SIDX_FIXED_HEADER_SIZE + nNameLength;
+    if (nItems > 0)
+    {
+        try
+        {
+            poIndex->m_nFIDsOffset =
+                poIndex->m_nTreeOffset + PackedRTree::size(nItems, nNodeSize);
+        }
+        catch (const std::exception &e)
+        {
+            CPLDebug("OGR", "%s is not a valid spatial index: %s",
+                     osFilename.c_str(), e.what());
+            return nullptr;
+        }
+        if (poIndex->m_nFIDsOffset + nItems * sizeof(int64_t) !=
+            static_cast<uint64_t>(sStat.st_size))
+        {
+            CPLDebug("OGR", "%s is not a valid spatial index: wrong size",
+                     osFilename.c_str());
+            return nullptr;
+        }
+    }
+    poIndex->m_fp = std::move(fp);
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Remove()                               */
+/************************************************************************/
+
+/** Removes the index of a data file, if it exists */
+bool OGRSidecarSpatialIndex::Remove(const std::string &osDataFilename)
+{
+    const std::string osFilename(GetFilename(osDataFilename));
+    VSIStatBufL sStat;
+    if (VSIStatExL(osFilename.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) != 0)
+        return true;
+    if (VSIUnlink(osFilename.c_str()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                 osFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Returns in aoEntries the records of the features whose envelope
+ * intersects sEnvelope, sorted by increasing offset.
+ */
+bool OGRSidecarSpatialIndex::Search(const OGREnvelope &sEnvelope,
+                                    std::vector<Entry> &aoEntries)
+{
+    aoEntries.clear();
+    if (m_nItems == 0)
+        return true;
+
+    try
+    {
+        const NodeItem n{sEnvelope.MinX, sEnvelope.MinY, sEnvelope.MaxX,
+                         sEnvelope.MaxY, 0};
+        const auto readNode = [this](uint8_t *buf, size_t i, size_t s)
+        {
+            if (m_fp->Seek(m_nTreeOffset + i, SEEK_SET) != 0)
+                throw std::runtime_error("I/O seek failure");
+            if (m_fp->Read(buf, 1, s) != s)
+                throw std::runtime_error("I/O read failure");
+        };
+        const auto aoResults =
+            PackedRTree::streamSearch(m_nItems, m_nNodeSize, n, readNode);
+
+        // Leaves are visited in the order of the R-tree. Fetch their FID
+        // in that order, and then sort by offset to read records
+        // sequentially.
+        aoEntries.reserve(aoResults.size());
+        for (const auto &oResult : aoResults)
+        {
+            int64_t nFID = 0;
+            if (m_fp->Seek(m_nFIDsOffset + oResult.index * sizeof(int64_t),
+                           SEEK_SET) != 0 ||
+                m_fp->Read(&nFID, sizeof(nFID), 1) != 1)
+            {
+                throw std::runtime_error("I/O read failure");
+            }
+            CPL_LSBPTR64(&nFID);
+            aoEntries.push_back(Entry{
+                static_cast<vsi_l_offset>(oResult.offset),
+                static_cast<GIntBig>(nFID)});
+        }
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nOffset < b.nOffset; });
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Spatial index search failed: %s",
+                 e.what());
+        aoEntries.clear();
+        return false;
+    }
+    return true;
+}
+
+//! @endcond
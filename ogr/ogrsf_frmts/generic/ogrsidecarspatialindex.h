@@ -0,0 +1,95 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Sidecar spatial index for sequentially readable vector files
+ * Author:   Even Rouault <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRSIDECARSPATIALINDEX_H_INCLUDED
+#define OGRSIDECARSPATIALINDEX_H_INCLUDED
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "ogr_core.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                        OGRSidecarSpatialIndex                        */
+/************************************************************************/
+
+/** Spatial index stored in a <data_filename>.ogrsidx file next to a data
+ * file whose features are records that can be read from their byte offset.
+ *
+ * It is made of the packed Hilbert R-tree of the FlatGeobuf driver, that
+ * indexes the envelopes of the features, and whose leaves point to the
+ * byte offset of the feature records in the data file, followed by the
+ * FID of each leaf. The size and modification time of the data file are
+ * recorded, so that an index that is older than the data file is ignored.
+ */
+class CPL_DLL OGRSidecarSpatialIndex
+{
+  public:
+    /** Feature record pointed by the index */
+    struct Entry
+    {
+        vsi_l_offset nOffset;
+        GIntBig nFID;
+    };
+
+    /** Collects the features of the data file, and writes the index */
+    class CPL_DLL Builder
+    {
+        struct Item
+        {
+            OGREnvelope sEnvelope;
+            Entry sEntry;
+        };
+
+        std::vector<Item> m_aoItems{};
+
+      public:
+        void AddFeature(const OGREnvelope &sEnvelope, vsi_l_offset nOffset,
+                        GIntBig nFID);
+        bool Write(const std::string &osDataFilename,
+                   const std::string &osGeomFieldName);
+    };
+
+    ~OGRSidecarSpatialIndex();
+
+    static std::string GetFilename(const std::string &osDataFilename);
+    static std::unique_ptr<OGRSidecarSpatialIndex>
+    Open(const std::string &osDataFilename, const std::string &osGeomFieldName);
+    static bool Remove(const std::string &osDataFilename);
+
+    bool Search(const OGREnvelope &sEnvelope, std::vector<Entry> &aoEntries);
+
+    /** Number of features (with a non-empty geometry) that are indexed */
+    uint64_t GetFeatureCount() const
+    {
+        return m_nItems;
+    }
+
+  private:
+    VSIVirtualHandleUniquePtr m_fp{};
+    uint64_t m_nItems = 0;
+    uint16_t m_nNodeSize = 0;
+    vsi_l_offset m_nTreeOffset = 0;
+    vsi_l_offset m_nFIDsOffset = 0;
+
+    OGRSidecarSpatialIndex() = default;
+    CPL_DISALLOW_COPY_ASSIGN(OGRSidecarSpatialIndex)
+};
+
+//! @endcond
+
+#endif  // OGRSIDECARSPATIALINDEX_H_INCLUDED
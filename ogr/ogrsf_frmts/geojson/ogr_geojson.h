@@ -19,6 +19,7 @@
 #include "memdataset.h"
 
 #include <cstdio>
+#include <memory>
 #include <vector>  // Used by OGRGeoJSONLayer.
 #include "ogrgeojsonutils.h"
 #include "ogrgeojsonwriter.h"
@@ -27,6 +28,7 @@ constexpr const char *INVALID_CONTENT_FOR_JSON_LIKE =
     "__INVALID_CONTENT_FOR_JSON_LIKE__";
 
 class OGRGeoJSONDataSource;
+class OGRGeoJSONParallelWriter;
 
 GDALDataset *OGRGeoJSONDriverOpenInternal(GDALOpenInfo *poOpenInfo,
                                           GeoJSONSourceType nSrcType,
@@ -227,9 +229,21 @@ class OGRGeoJSONWriteLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache oTransformCache_;
     OGRGeoJSONWriteOptions oWriteOptions_;
 
+    //! Whether at least one feature has been written to the file
+    bool m_bFeatureWritten = false;
+    //! Number of features after which they are encoded by worker threads
+    const GIntBig m_nMinFeaturesParallelWrite;
+    bool m_bParallelWriterChecked = false;
+    std::unique_ptr<OGRGeoJSONParallelWriter> m_poParallelWriter{};
+
+    friend class OGRGeoJSONParallelWriter;
+
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONWriteLayer)
 
     void FinishWriting();
+    void ExtendLayerEnvelope(const OGRGeometry *poGeometry);
+    void SerializeFeature(OGRFeature *poFeature, std::string &osJson) const;
+    OGRErr WriteSerializedFeature(const std::string &osJson);
 };
 
 /************************************************************************/
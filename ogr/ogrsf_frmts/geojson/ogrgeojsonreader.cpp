@@ -18,9 +18,15 @@
 #include "ogrlibjsonutils.h"
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
+#include "gdal_thread_pool.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <set>
 #include <functional>
 
@@ -153,6 +159,9 @@ OGRGeoJSONReader::OGRGeoJSONReader()
 
 OGRGeoJSONReader::~OGRGeoJSONReader()
 {
+    // Must be done first, as worker threads may still be translating features
+    poParallelParser_.reset();
+
     if (nullptr != poGJObject_)
     {
         json_object_put(poGJObject_);
@@ -267,6 +276,45 @@ OGRFeature *OGRGeoJSONReaderStreamingParser::GetNextFeature()
     return nullptr;
 }
 
+/************************************************************************/
+/*                   OGRGeoJSONReaderAssignUniqueFID()                  */
+/************************************************************************/
+
+static void OGRGeoJSONReaderAssignUniqueFID(OGRFeature *poFeat,
+                                            std::set<GIntBig> &oSetUsedFIDs,
+                                            bool &bOriginalIdModifiedEmitted)
+{
+    GIntBig nFID = poFeat->GetFID();
+    if (nFID == OGRNullFID)
+    {
+        nFID = static_cast<GIntBig>(oSetUsedFIDs.size());
+        while (cpl::contains(oSetUsedFIDs, nFID))
+        {
+            ++nFID;
+        }
+    }
+    else if (cpl::contains(oSetUsedFIDs, nFID))
+    {
+        if (!bOriginalIdModifiedEmitted)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Several features with id = " CPL_FRMT_GIB " have "
+                     "been found. Altering it to be unique. "
+                     "This warning will not be emitted anymore for "
+                     "this layer",
+                     nFID);
+            bOriginalIdModifiedEmitted = true;
+        }
+        nFID = static_cast<GIntBig>(oSetUsedFIDs.size());
+        while (cpl::contains(oSetUsedFIDs, nFID))
+        {
+            ++nFID;
+        }
+    }
+    oSetUsedFIDs.insert(nFID);
+    poFeat->SetFID(nFID);
+}
+
 /************************************************************************/
 /*                          GotFeature()                                */
 /************************************************************************/
@@ -289,36 +337,8 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
             m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
         if (poFeat)
         {
-            GIntBig nFID = poFeat->GetFID();
-            if (nFID == OGRNullFID)
-            {
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (cpl::contains(m_oSetUsedFIDs, nFID))
-                {
-                    ++nFID;
-                }
-            }
-            else if (cpl::contains(m_oSetUsedFIDs, nFID))
-            {
-                if (!m_bOriginalIdModifiedEmitted)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Several features with id = " CPL_FRMT_GIB " have "
-                             "been found. Altering it to be unique. "
-                             "This warning will not be emitted anymore for "
-                             "this layer",
-                             nFID);
-                    m_bOriginalIdModifiedEmitted = true;
-                }
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (cpl::contains(m_oSetUsedFIDs, nFID))
-                {
-                    ++nFID;
-                }
-            }
-            m_oSetUsedFIDs.insert(nFID);
-            poFeat->SetFID(nFID);
-
+            OGRGeoJSONReaderAssignUniqueFID(poFeat, m_oSetUsedFIDs,
+                                            m_bOriginalIdModifiedEmitted);
             m_apoFeatures.push_back(poFeat);
         }
     }
@@ -343,6 +363,12 @@ void OGRGeoJSONReaderStreamingParser::FinalizeLayerDefn()
     m_apoFieldDefn.clear();
 }
 
+static const char *const OGRGeoJSONReaderTooComplexMessage =
+    "GeoJSON object too complex/large. You may define the "
+    "OGR_GEOJSON_MAX_OBJ_SIZE configuration option to "
+    "a value in megabytes to allow "
+    "for larger features, or 0 to remove any size limit.";
+
 /************************************************************************/
 /*                            TooComplex()                              */
 /************************************************************************/
@@ -350,10 +376,409 @@ void OGRGeoJSONReaderStreamingParser::FinalizeLayerDefn()
 void OGRGeoJSONReaderStreamingParser::TooComplex()
 {
     if (!ExceptionOccurred())
-        EmitException("GeoJSON object too complex/large. You may define the "
-                      "OGR_GEOJSON_MAX_OBJ_SIZE configuration option to "
-                      "a value in megabytes to allow "
-                      "for larger features, or 0 to remove any size limit.");
+        EmitException(OGRGeoJSONReaderTooComplexMessage);
+}
+
+/************************************************************************/
+/*                  OGRGeoJSONFeaturesArrayScanner                      */
+/************************************************************************/
+
+namespace
+{
+
+/** Extracts the serialized members of the "features" array of a
+ * FeatureCollection, without parsing them.
+ *
+ * Only strings and nesting levels are tracked, which is much faster than
+ * building JSON objects, so that the actual parsing of the members can be
+ * done by worker threads. The input is assumed to have been validated by
+ * the first pass of OGRGeoJSONReaderStreamingParser.
+ */
+class OGRGeoJSONFeaturesArrayScanner
+{
+    int m_nDepth = 0;
+    bool m_bInString = false;
+    bool m_bEscaped = false;
+    bool m_bLastStringIsFeatures = false;
+    bool m_bKeyIsFeatures = false;
+    bool m_bInFeaturesArray = false;
+    bool m_bFeaturesArrayFinished = false;
+    bool m_bInMember = false;
+    //! Content of the string being read at the root level
+    std::string m_osRootString{};
+    //! Beginning of the member being read, when split between buffers
+    std::string m_osCurMember{};
+
+  public:
+    void Scan(const char *pszData, size_t nLen,
+              std::vector<std::string> &aosMembers);
+
+    bool IsFeaturesArrayFinished() const
+    {
+        return m_bFeaturesArrayFinished;
+    }
+
+    size_t GetCurMemberSize() const
+    {
+        return m_osCurMember.size();
+    }
+};
+
+void OGRGeoJSONFeaturesArrayScanner::Scan(const char *pszData, size_t nLen,
+                                          std::vector<std::string> &aosMembers)
+{
+    size_t nMemberStart = 0;
+    for (size_t i = 0; i < nLen; ++i)
+    {
+        const char ch = pszData[i];
+        if (m_bInString)
+        {
+            if (m_bEscaped)
+                m_bEscaped = false;
+            else if (ch == '\\')
+                m_bEscaped = true;
+            else if (ch == '"')
+            {
+                m_bInString = false;
+                if (m_nDepth == 1)
+                    m_bLastStringIsFeatures = m_osRootString == "features";
+                continue;
+            }
+            if (m_nDepth == 1 && m_osRootString.size() <= strlen("features"))
+                m_osRootString += ch;
+            continue;
+        }
+
+        switch (ch)
+        {
+            case '"':
+                m_bInString = true;
+                if (m_nDepth == 1)
+                    m_osRootString.clear();
+                break;
+
+            case ':':
+                if (m_nDepth == 1)
+                    m_bKeyIsFeatures = m_bLastStringIsFeatures;
+                break;
+
+            case '{':
+            case '[':
+                if (m_bInFeaturesArray && m_nDepth == 2 && ch == '{')
+                {
+                    m_bInMember = true;
+                    nMemberStart = i;
+                }
+                else if (m_nDepth == 1 && ch == '[' && m_bKeyIsFeatures &&
+                         !m_bFeaturesArrayFinished)
+                {
+                    m_bInFeaturesArray = true;
+                }
+                ++m_nDepth;
+                break;
+
+            case '}':
+            case ']':
+                --m_nDepth;
+                if (m_bInMember && m_nDepth == 2)
+                {
+                    m_bInMember = false;
+                    m_osCurMember.append(pszData + nMemberStart,
+                                         i + 1 - nMemberStart);
+                    aosMembers.push_back(std::move(m_osCurMember));
+                    m_osCurMember.clear();
+                }
+                else if (m_bInFeaturesArray && m_nDepth == 1)
+                {
+                    m_bInFeaturesArray = false;
+                    m_bFeaturesArrayFinished = true;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (m_bInMember)
+        m_osCurMember.append(pszData + nMemberStart, nLen - nMemberStart);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                    OGRGeoJSONReaderParallelParser                    */
+/************************************************************************/
+
+/** Reads the features of a FeatureCollection by batches, whose members are
+ * parsed and translated into OGRFeature by worker threads, and returns
+ * them in their order in the file.
+ */
+class OGRGeoJSONReaderParallelParser
+{
+    struct Batch
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+        std::vector<std::string> aosJson{};
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    };
+
+    OGRGeoJSONReader &m_oReader;
+    OGRGeoJSONLayer *const m_poLayer;
+    const size_t m_nMaxInFlight;
+    const size_t m_nMaxObjectSize;
+    OGRGeoJSONFeaturesArrayScanner m_oScanner{};
+    bool m_bEOF = false;
+
+    //! Batches submitted, in file order
+    std::deque<std::shared_ptr<Batch>> m_apoPending{};
+    std::shared_ptr<Batch> m_poCurrent{};
+    size_t m_nIdxInCurrent = 0;
+
+    std::set<GIntBig> m_oSetUsedFIDs{};
+    bool m_bOriginalIdModifiedEmitted = false;
+
+    std::unique_ptr<GDALThreadReservation> m_poThreadReservation{};
+    // Last member: jobs translate features with m_oReader and m_poLayer
+    CPLJobQueuePtr m_poJobQueue{};
+
+    //! Approximate number of bytes of JSON text of a batch
+    static constexpr size_t BATCH_SIZE = 1024 * 1024;
+    //! Maximum number of features of a batch
+    static constexpr size_t BATCH_MAX_FEATURES = 1000;
+
+    bool ReadBatch(std::vector<std::string> &aosJson);
+    void SubmitJobs();
+    void TranslateBatch(Batch &oBatch);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONReaderParallelParser)
+
+  public:
+    OGRGeoJSONReaderParallelParser(
+        OGRGeoJSONReader &oReader, OGRGeoJSONLayer *poLayer, int nThreads,
+        std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+        CPLJobQueuePtr poJobQueue);
+
+    static std::unique_ptr<OGRGeoJSONReaderParallelParser>
+    Create(OGRGeoJSONReader &oReader, OGRGeoJSONLayer *poLayer,
+           vsi_l_offset nFileSize);
+
+    OGRFeature *GetNextFeature();
+
+    inline bool GetOriginalIdModifiedEmitted() const
+    {
+        return m_bOriginalIdModifiedEmitted;
+    }
+
+    inline void SetOriginalIdModifiedEmitted(bool b)
+    {
+        m_bOriginalIdModifiedEmitted = b;
+    }
+};
+
+/************************************************************************/
+/*                   OGRGeoJSONReaderParallelParser()                   */
+/************************************************************************/
+
+OGRGeoJSONReaderParallelParser::OGRGeoJSONReaderParallelParser(
+    OGRGeoJSONReader &oReader, OGRGeoJSONLayer *poLayer, int nThreads,
+    std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+    CPLJobQueuePtr poJobQueue)
+    : m_oReader(oReader), m_poLayer(poLayer),
+      m_nMaxInFlight(2 * static_cast<size_t>(nThreads)),
+      m_nMaxObjectSize(OGRGeoJSONReaderStreamingParserGetMaxObjectSize()),
+      m_poThreadReservation(std::move(poThreadReservation)),
+      m_poJobQueue(std::move(poJobQueue))
+{
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Returns a parallel parser if multithreaded reading is enabled and
+ * worthwhile, or nullptr. The file must be positioned at its beginning.
+ */
+std::unique_ptr<OGRGeoJSONReaderParallelParser>
+OGRGeoJSONReaderParallelParser::Create(OGRGeoJSONReader &oReader,
+                                       OGRGeoJSONLayer *poLayer,
+                                       vsi_l_offset nFileSize)
+{
+    // Features are then read back from their serialized form
+    if (oReader.bStoreNativeData_)
+        return nullptr;
+
+    const double dfMinSizeMB = CPLAtof(CPLGetConfigOption(
+        "OGR_GEOJSON_MULTITHREADING_MIN_FILE_SIZE", "10"));
+    if (static_cast<double>(nFileSize) < dfMinSizeMB * 1024 * 1024)
+        return nullptr;
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadReservation =
+        std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+    CPLDebug("GeoJSON", "Reading features with %d threads", nThreads);
+    return std::make_unique<OGRGeoJSONReaderParallelParser>(
+        oReader, poLayer, nThreads, std::move(poThreadReservation),
+        poThreadPool->CreateJobQueue());
+}
+
+/************************************************************************/
+/*                             ReadBatch()                              */
+/************************************************************************/
+
+/** Collects the serialized features of the next batch. Returns false in
+ * case of error. */
+bool OGRGeoJSONReaderParallelParser::ReadBatch(
+    std::vector<std::string> &aosJson)
+{
+    size_t nBatchBytes = 0;
+    while (!m_bEOF && nBatchBytes < BATCH_SIZE &&
+           aosJson.size() < BATCH_MAX_FEATURES)
+    {
+        size_t nRead = VSIFReadL(m_oReader.pabyBuffer_, 1,
+                                 m_oReader.nBufferSize_, m_oReader.fp_);
+        m_bEOF = nRead < m_oReader.nBufferSize_;
+        size_t nSkip = 0;
+        if (m_oReader.bFirstSeg_)
+        {
+            m_oReader.bFirstSeg_ = false;
+            nSkip = m_oReader.SkipPrologEpilogAndUpdateJSonPLikeWrapper(nRead);
+        }
+        if (m_bEOF && m_oReader.bJSonPLikeWrapper_ && nRead > nSkip)
+            nRead--;
+        const size_t nFirstNew = aosJson.size();
+        m_oScanner.Scan(
+            reinterpret_cast<const char *>(m_oReader.pabyBuffer_ + nSkip),
+            nRead - nSkip, aosJson);
+
+        size_t nMaxMemberSize = m_oScanner.GetCurMemberSize();
+        for (size_t i = nFirstNew; i < aosJson.size(); ++i)
+        {
+            nBatchBytes += aosJson[i].size();
+            nMaxMemberSize = std::max(nMaxMemberSize, aosJson[i].size());
+        }
+        if (m_nMaxObjectSize > 0 && nMaxMemberSize > m_nMaxObjectSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     OGRGeoJSONReaderTooComplexMessage);
+            m_bEOF = true;
+            return false;
+        }
+
+        if (m_oScanner.IsFeaturesArrayFinished())
+            m_bEOF = true;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           TranslateBatch()                           */
+/************************************************************************/
+
+/** Run by worker threads */
+void OGRGeoJSONReaderParallelParser::TranslateBatch(Batch &oBatch)
+{
+    oBatch.apoFeatures.reserve(oBatch.aosJson.size());
+    for (auto &osJson : oBatch.aosJson)
+    {
+        json_object *poObj = nullptr;
+        if (OGRJSonParse(osJson.c_str(), &poObj))
+        {
+            // Same as OGRJSONCollectionStreamingParser::EndObject()
+            json_object *poObjTypeObj =
+                CPL_json_object_object_get(poObj, "type");
+            if (poObjTypeObj &&
+                json_object_get_type(poObjTypeObj) == json_type_string &&
+                strcmp(json_object_get_string(poObjTypeObj), "Feature") == 0)
+            {
+                oBatch.apoFeatures.emplace_back(
+                    m_oReader.ReadFeature(m_poLayer, poObj, nullptr));
+            }
+            json_object_put(poObj);
+        }
+        std::string().swap(osJson);
+    }
+}
+
+/************************************************************************/
+/*                             SubmitJobs()                             */
+/************************************************************************/
+
+void OGRGeoJSONReaderParallelParser::SubmitJobs()
+{
+    while (!m_bEOF && m_apoPending.size() < m_nMaxInFlight)
+    {
+        auto poBatch = std::make_shared<Batch>();
+        if (!ReadBatch(poBatch->aosJson) || poBatch->aosJson.empty())
+            break;
+        m_apoPending.push_back(poBatch);
+        if (!m_poJobQueue->SubmitJob(
+                [this, poBatch]()
+                {
+                    TranslateBatch(*poBatch);
+                    std::lock_guard oLock(poBatch->oMutex);
+                    poBatch->bDone = true;
+                    poBatch->oCV.notify_one();
+                }))
+        {
+            TranslateBatch(*poBatch);
+            poBatch->bDone = true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONReaderParallelParser::GetNextFeature()
+{
+    while (true)
+    {
+        if (m_poCurrent && m_nIdxInCurrent < m_poCurrent->apoFeatures.size())
+        {
+            OGRFeature *poFeat =
+                m_poCurrent->apoFeatures[m_nIdxInCurrent++].release();
+            if (poFeat)
+            {
+                OGRGeoJSONReaderAssignUniqueFID(poFeat, m_oSetUsedFIDs,
+                                                m_bOriginalIdModifiedEmitted);
+                return poFeat;
+            }
+            continue;
+        }
+
+        m_poCurrent.reset();
+        SubmitJobs();
+        if (m_apoPending.empty())
+            return nullptr;
+        auto poBatch = std::move(m_apoPending.front());
+        m_apoPending.pop_front();
+        {
+            std::unique_lock oLock(poBatch->oMutex);
+            poBatch->oCV.wait(oLock, [&poBatch] { return poBatch->bDone; });
+        }
+        m_poCurrent = std::move(poBatch);
+        m_nIdxInCurrent = 0;
+        // Keep the worker threads busy while the caller processes this batch
+        SubmitJobs();
+    }
 }
 
 /************************************************************************/
@@ -659,6 +1084,10 @@ void OGRGeoJSONReader::ResetReading()
             poStreamingParser_->GetOriginalIdModifiedEmitted();
     delete poStreamingParser_;
     poStreamingParser_ = nullptr;
+    if (poParallelParser_)
+        bOriginalIdModifiedEmitted_ =
+            poParallelParser_->GetOriginalIdModifiedEmitted();
+    poParallelParser_.reset();
 }
 
 /************************************************************************/
@@ -668,17 +1097,33 @@ void OGRGeoJSONReader::ResetReading()
 OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
 {
     CPLAssert(fp_);
-    if (poStreamingParser_ == nullptr)
+    if (poStreamingParser_ == nullptr && poParallelParser_ == nullptr)
     {
-        poStreamingParser_ = new OGRGeoJSONReaderStreamingParser(
-            *this, poLayer, false, bStoreNativeData_);
-        poStreamingParser_->SetOriginalIdModifiedEmitted(
-            bOriginalIdModifiedEmitted_);
+        VSIFSeekL(fp_, 0, SEEK_END);
+        const vsi_l_offset nFileSize = VSIFTellL(fp_);
         VSIFSeekL(fp_, 0, SEEK_SET);
         bFirstSeg_ = true;
         bJSonPLikeWrapper_ = false;
+
+        poParallelParser_ =
+            OGRGeoJSONReaderParallelParser::Create(*this, poLayer, nFileSize);
+        if (poParallelParser_)
+        {
+            poParallelParser_->SetOriginalIdModifiedEmitted(
+                bOriginalIdModifiedEmitted_);
+        }
+        else
+        {
+            poStreamingParser_ = new OGRGeoJSONReaderStreamingParser(
+                *this, poLayer, false, bStoreNativeData_);
+            poStreamingParser_->SetOriginalIdModifiedEmitted(
+                bOriginalIdModifiedEmitted_);
+        }
     }
 
+    if (poParallelParser_)
+        return poParallelParser_->GetNextFeature();
+
     OGRFeature *poFeat = poStreamingParser_->GetNextFeature();
     if (poFeat)
         return poFeat;
@@ -727,11 +1172,7 @@ OGRFeature *OGRGeoJSONReader::GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID)
         CPLDebug("GeoJSON",
                  "Establishing index to features for first GetFeature() call");
 
-        if (poStreamingParser_)
-            bOriginalIdModifiedEmitted_ =
-                poStreamingParser_->GetOriginalIdModifiedEmitted();
-        delete poStreamingParser_;
-        poStreamingParser_ = nullptr;
+        ResetReading();
 
         OGRGeoJSONReaderStreamingParser oParser(*this, poLayer, false,
                                                 bStoreNativeData_);
@@ -2381,10 +2822,10 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     }
     else
     {
-        static bool bWarned = false;
-        if (!bWarned)
+        // Atomic as features may be read by several threads
+        static std::atomic<bool> bWarned{false};
+        if (!bWarned.exchange(true))
         {
-            bWarned = true;
             CPLDebug(
                 "GeoJSON",
                 "Non conformant Feature object. Missing \'geometry\' member.");
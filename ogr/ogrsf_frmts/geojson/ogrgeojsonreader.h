@@ -21,6 +21,7 @@
 #include "ogrgeojsonutils.h"
 #include "directedacyclicgraph.hpp"
 
+#include <memory>
 #include <utility>
 #include <map>
 #include <set>
@@ -130,6 +131,7 @@ class OGRGeoJSONBaseReader
 
 class OGRGeoJSONDataSource;
 class OGRGeoJSONReaderStreamingParser;
+class OGRGeoJSONReaderParallelParser;
 
 class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 {
@@ -171,9 +173,11 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
   private:
     friend class OGRGeoJSONReaderStreamingParser;
+    friend class OGRGeoJSONReaderParallelParser;
 
     json_object *poGJObject_;
     OGRGeoJSONReaderStreamingParser *poStreamingParser_;
+    std::unique_ptr<OGRGeoJSONReaderParallelParser> poParallelParser_{};
     bool bFirstSeg_;
     bool bJSonPLikeWrapper_;
     VSILFILE *fp_;
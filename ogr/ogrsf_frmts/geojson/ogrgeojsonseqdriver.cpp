@@ -20,6 +20,7 @@
 #include "ogrgeojsonreader.h"
 #include "ogrgeojsonwriter.h"
 #include "ogrgeojsongeometry.h"
+#include "ogrsidecarspatialindex.h"
 
 #include <algorithm>
 #include <memory>
@@ -36,6 +37,8 @@ class OGRGeoJSONSeqDataSource final : public GDALDataset
 
     std::vector<std::unique_ptr<OGRLayer>> m_apoLayers{};
     CPLString m_osTmpFile;
+    // Name of the file, when reading from a seekable file
+    std::string m_osFilename{};
     VSILFILE *m_fp = nullptr;
     bool m_bSupportsRead = true;
     bool m_bAtEOF = false;
@@ -55,6 +58,8 @@ class OGRGeoJSONSeqDataSource final : public GDALDataset
                            const OGRGeomFieldDefn *poGeomFieldDefn,
                            CSLConstList papszOptions) override;
     int TestCapability(const char *pszCap) override;
+    OGRLayer *ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
+                         const char *pszDialect) override;
 
     bool Open(GDALOpenInfo *poOpenInfo, GeoJSONSourceType nSrcType);
     bool Create(const char *pszName, char **papszOptions);
@@ -80,17 +85,32 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     size_t m_nPosInBuffer = 0;
     size_t m_nBufferValidSize = 0;
 
+    // File offset of m_osBuffer[0]
+    vsi_l_offset m_nBufferFileOffset = 0;
+    // File offset of the object returned by the last GetNextObject() call
+    vsi_l_offset m_nCurObjectOffset = 0;
+
     vsi_l_offset m_nFileSize = 0;
     GIntBig m_nIter = 0;
 
     GIntBig m_nTotalFeatures = 0;
     GIntBig m_nNextFID = 0;
 
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSpatialIndex{};
+    bool m_bSpatialIndexOpenAttempted = false;
+    bool m_bIndexEntriesComputed = false;
+    bool m_bUseIndexEntries = false;
+    std::vector<OGRSidecarSpatialIndex::Entry> m_aoIndexEntries{};
+    size_t m_nIndexEntryIdx = 0;
+
     std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
     json_object *GetNextObject(bool bLooseIdentification);
+    void SeekToObject(vsi_l_offset nOffset);
+    OGRFeature *GetNextRawFeature();
+    OGRSidecarSpatialIndex *GetSpatialIndex();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -127,6 +147,9 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     {
         return m_poDS;
     }
+
+    bool CreateSpatialIndex();
+    bool DropSpatialIndex();
 };
 
 /************************************************************************/
@@ -292,6 +315,48 @@ int OGRGeoJSONSeqDataSource::TestCapability(const char *pszCap)
     return FALSE;
 }
 
+/************************************************************************/
+/*                             ExecuteSQL()                             */
+/*                                                                      */
+/*      We override this to provide special handling of SPATIAL INDEX  */
+/*      commands. Supported forms are:                                  */
+/*                                                                      */
+/*        CREATE SPATIAL INDEX ON layer_name                            */
+/*        DROP SPATIAL INDEX ON layer_name                              */
+/************************************************************************/
+
+OGRLayer *OGRGeoJSONSeqDataSource::ExecuteSQL(const char *pszStatement,
+                                              OGRGeometry *poSpatialFilter,
+                                              const char *pszDialect)
+{
+    const bool bCreate =
+        STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX ON ");
+    if (bCreate || STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX ON "))
+    {
+        const char *pszLayerName =
+            pszStatement + (bCreate ? strlen("CREATE SPATIAL INDEX ON ")
+                                    : strlen("DROP SPATIAL INDEX ON "));
+        auto poLayer =
+            cpl::down_cast<OGRGeoJSONSeqLayer *>(GetLayerByName(pszLayerName));
+        if (poLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Layer %s not recognised.",
+                     pszLayerName);
+        }
+        else if (bCreate)
+        {
+            poLayer->CreateSpatialIndex();
+        }
+        else
+        {
+            poLayer->DropSpatialIndex();
+        }
+        return nullptr;
+    }
+
+    return GDALDataset::ExecuteSQL(pszStatement, poSpatialFilter, pszDialect);
+}
+
 /************************************************************************/
 /*                           OGRGeoJSONSeqLayer()                       */
 /************************************************************************/
@@ -479,7 +544,35 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_osFeatureBuffer.clear();
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
+    m_nBufferFileOffset = 0;
     m_nNextFID = 0;
+    m_bIndexEntriesComputed = false;
+    m_bUseIndexEntries = false;
+    m_aoIndexEntries.clear();
+    m_nIndexEntryIdx = 0;
+}
+
+/************************************************************************/
+/*                           SeekToObject()                             */
+/************************************************************************/
+
+// Positions the reader so that the next GetNextObject() call returns
+// the object starting at nOffset.
+void OGRGeoJSONSeqLayer::SeekToObject(vsi_l_offset nOffset)
+{
+    m_osFeatureBuffer.clear();
+    if (nOffset >= m_nBufferFileOffset &&
+        nOffset < m_nBufferFileOffset + m_nBufferValidSize)
+    {
+        m_nPosInBuffer = static_cast<size_t>(nOffset - m_nBufferFileOffset);
+    }
+    else
+    {
+        VSIFSeekL(m_poDS->m_fp, nOffset, SEEK_SET);
+        m_nBufferFileOffset = nOffset;
+        m_nPosInBuffer = m_osBuffer.size();
+        m_nBufferValidSize = m_osBuffer.size();
+    }
 }
 
 /************************************************************************/
@@ -498,6 +591,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             {
                 return nullptr;
             }
+            m_nBufferFileOffset = VSIFTellL(m_poDS->m_fp);
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
             m_nPosInBuffer = 0;
@@ -524,6 +618,9 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
         }
 
+        if (m_osFeatureBuffer.empty())
+            m_nCurObjectOffset = m_nBufferFileOffset + m_nPosInBuffer;
+
         // Find next feature separator in buffer
         const size_t nNextSepPos = m_osBuffer.find(
             m_poDS->m_bIsRSSeparated ? RS : '\n', m_nPosInBuffer);
@@ -583,60 +680,103 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
 }
 
 /************************************************************************/
-/*                           GetNextFeature()                           */
+/*                          GetNextRawFeature()                         */
 /************************************************************************/
 
-OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
+// Returns the next feature, without FID if it has no id member, and
+// without applying filters.
+OGRFeature *OGRGeoJSONSeqLayer::GetNextRawFeature()
 {
-    if (!m_poDS->m_bSupportsRead)
-    {
-        return nullptr;
-    }
-    if (m_bWriteOnlyLayer && m_poDS->m_apoLayers.size() > 1)
-    {
-        CPLError(CE_Failure, CPLE_NotSupported,
-                 "GetNextFeature() not supported when appending a new layer");
-        return nullptr;
-    }
-
-    GetLayerDefn();  // force scan if not already done
     while (true)
     {
         auto poObject = GetNextObject(false);
         if (!poObject)
             return nullptr;
-        OGRFeature *poFeature;
         auto type = OGRGeoJSONGetType(poObject);
         if (type == GeoJSONObject::eFeature)
         {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
+            OGRFeature *poFeature = m_oReader.ReadFeature(
+                this, poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
+            return poFeature;
         }
         else if (type == GeoJSONObject::eFeatureCollection ||
                  type == GeoJSONObject::eUnknown)
         {
             json_object_put(poObject);
-            continue;
         }
         else
         {
             OGRGeometry *poGeom =
                 m_oReader.ReadGeometry(poObject, GetSpatialRef());
             json_object_put(poObject);
-            if (!poGeom)
+            if (poGeom)
             {
-                continue;
+                OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+                poFeature->SetGeometryDirectly(poGeom);
+                return poFeature;
             }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
+    }
+}
 
-        if (poFeature->GetFID() == OGRNullFID)
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
+{
+    if (!m_poDS->m_bSupportsRead)
+    {
+        return nullptr;
+    }
+    if (m_bWriteOnlyLayer && m_poDS->m_apoLayers.size() > 1)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GetNextFeature() not supported when appending a new layer");
+        return nullptr;
+    }
+
+    GetLayerDefn();  // force scan if not already done
+
+    if (m_poFilterGeom != nullptr && !m_bIndexEntriesComputed)
+    {
+        m_bIndexEntriesComputed = true;
+        if (auto poSpatialIndex = GetSpatialIndex())
         {
-            poFeature->SetFID(m_nNextFID);
-            m_nNextFID++;
+            m_bUseIndexEntries =
+                poSpatialIndex->Search(m_sFilterEnvelope, m_aoIndexEntries);
+        }
+    }
+
+    while (true)
+    {
+        OGRFeature *poFeature;
+        if (m_bUseIndexEntries)
+        {
+            if (m_nIndexEntryIdx >= m_aoIndexEntries.size())
+                return nullptr;
+            const auto &sEntry = m_aoIndexEntries[m_nIndexEntryIdx];
+            ++m_nIndexEntryIdx;
+            SeekToObject(sEntry.nOffset);
+            poFeature = GetNextRawFeature();
+            if (!poFeature)
+                return nullptr;
+            if (poFeature->GetFID() == OGRNullFID)
+                poFeature->SetFID(sEntry.nFID);
         }
+        else
+        {
+            poFeature = GetNextRawFeature();
+            if (!poFeature)
+                return nullptr;
+            if (poFeature->GetFID() == OGRNullFID)
+            {
+                poFeature->SetFID(m_nNextFID);
+                m_nNextFID++;
+            }
+        }
+
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
@@ -678,10 +818,96 @@ int OGRGeoJSONSeqLayer::TestCapability(const char *pszCap)
     {
         return m_poDS->GetAccess() == GA_Update;
     }
+    if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return GetSpatialIndex() != nullptr;
 
     return false;
 }
 
+/************************************************************************/
+/*                          GetSpatialIndex()                           */
+/************************************************************************/
+
+// Returns the sidecar spatial index, if there is one that is up-to-date
+OGRSidecarSpatialIndex *OGRGeoJSONSeqLayer::GetSpatialIndex()
+{
+    if (!m_bSpatialIndexOpenAttempted)
+    {
+        m_bSpatialIndexOpenAttempted = true;
+        if (!m_poDS->m_osFilename.empty() && !m_bWriteOnlyLayer)
+        {
+            m_poSpatialIndex = OGRSidecarSpatialIndex::Open(
+                m_poDS->m_osFilename,
+                m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef());
+        }
+    }
+    return m_poSpatialIndex.get();
+}
+
+/************************************************************************/
+/*                         CreateSpatialIndex()                         */
+/************************************************************************/
+
+bool OGRGeoJSONSeqLayer::CreateSpatialIndex()
+{
+    if (m_poDS->m_osFilename.empty() || m_bWriteOnlyLayer ||
+        !m_poDS->m_bSupportsRead)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "A spatial index can only be created on a file opened "
+                 "for reading");
+        return false;
+    }
+
+    GetLayerDefn();  // force scan if not already done
+
+    if (m_poDS->GetAccess() == GA_Update)
+        VSIFFlushL(m_poDS->m_fp);
+
+    OGRSidecarSpatialIndex::Builder oBuilder;
+    ResetReading();
+    while (true)
+    {
+        auto poFeature = std::unique_ptr<OGRFeature>(GetNextRawFeature());
+        if (!poFeature)
+            break;
+        if (poFeature->GetFID() == OGRNullFID)
+        {
+            poFeature->SetFID(m_nNextFID);
+            m_nNextFID++;
+        }
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            oBuilder.AddFeature(sEnvelope, m_nCurObjectOffset,
+                                poFeature->GetFID());
+        }
+    }
+    ResetReading();
+
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexOpenAttempted = false;
+    if (!oBuilder.Write(m_poDS->m_osFilename,
+                        m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef()))
+        return false;
+    return GetSpatialIndex() != nullptr;
+}
+
+/************************************************************************/
+/*                          DropSpatialIndex()                          */
+/************************************************************************/
+
+bool OGRGeoJSONSeqLayer::DropSpatialIndex()
+{
+    ResetReading();
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexOpenAttempted = true;
+    return m_poDS->m_osFilename.empty() ||
+           OGRSidecarSpatialIndex::Remove(m_poDS->m_osFilename);
+}
+
 /************************************************************************/
 /*                           ICreateFeature()                           */
 /************************************************************************/
@@ -697,6 +923,10 @@ OGRErr OGRGeoJSONSeqLayer::ICreateFeature(OGRFeature *poFeature)
         VSIFSeekL(m_poDS->m_fp, 0, SEEK_END);
     }
 
+    // The spatial index, if any, is no longer up-to-date
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexOpenAttempted = true;
+
     std::unique_ptr<OGRFeature> poFeatureToWrite;
     if (m_poCT != nullptr)
     {
@@ -798,6 +1028,8 @@ bool OGRGeoJSONSeqDataSource::Open(GDALOpenInfo *poOpenInfo,
             osLayerName = CPLGetBasenameSafe(poOpenInfo->pszFilename);
             std::swap(m_fp, poOpenInfo->fpL);
         }
+        if (!STARTS_WITH(pszUnprefixedFilename, "/vsistdin/"))
+            m_osFilename = pszUnprefixedFilename;
     }
     else if (nSrcType == eGeoJSONSourceText)
     {
@@ -14,9 +14,219 @@
 #include "ogr_geojson.h"
 #include "ogrgeojsonwriter.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_vsi_virtual.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/************************************************************************/
+/*                      OGRGeoJSONParallelWriter                        */
+/************************************************************************/
+
+/** Encodes features to JSON by batches in worker threads, and writes them
+ * in their submission order.
+ */
+class OGRGeoJSONParallelWriter
+{
+    struct Batch
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        std::vector<std::string> aosJson{};
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    OGRGeoJSONWriteLayer &m_oLayer;
+    const size_t m_nMaxInFlight;
+    bool m_bWriteError = false;
+
+    //! Batches submitted, in submission order
+    std::deque<std::shared_ptr<Batch>> m_apoPending{};
+    std::shared_ptr<Batch> m_poCurrent{};
+
+    std::unique_ptr<GDALThreadReservation> m_poThreadReservation{};
+    // Last member: jobs encode features with the settings of m_oLayer
+    CPLJobQueuePtr m_poJobQueue{};
+
+    //! Maximum number of features of a batch
+    static constexpr size_t BATCH_MAX_FEATURES = 1000;
+
+    void EncodeBatch(Batch &oBatch);
+    void SubmitCurrent();
+    void WriteFront();
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONParallelWriter)
+
+  public:
+    OGRGeoJSONParallelWriter(
+        OGRGeoJSONWriteLayer &oLayer, int nThreads,
+        std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+        CPLJobQueuePtr poJobQueue);
+
+    static std::unique_ptr<OGRGeoJSONParallelWriter>
+    Create(OGRGeoJSONWriteLayer &oLayer);
+
+    OGRErr AddFeature(std::unique_ptr<OGRFeature> &&poFeature);
+    OGRErr Flush();
+};
+
+/************************************************************************/
+/*                     OGRGeoJSONParallelWriter()                       */
+/************************************************************************/
+
+OGRGeoJSONParallelWriter::OGRGeoJSONParallelWriter(
+    OGRGeoJSONWriteLayer &oLayer, int nThreads,
+    std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+    CPLJobQueuePtr poJobQueue)
+    : m_oLayer(oLayer), m_nMaxInFlight(2 * static_cast<size_t>(nThreads)),
+      m_poThreadReservation(std::move(poThreadReservation)),
+      m_poJobQueue(std::move(poJobQueue))
+{
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Returns a parallel writer if multithreaded writing is enabled, or
+ * nullptr.
+ */
+std::unique_ptr<OGRGeoJSONParallelWriter>
+OGRGeoJSONParallelWriter::Create(OGRGeoJSONWriteLayer &oLayer)
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return nullptr;
+
+    // The source of the features may be a multithreaded reader
+    auto poThreadReservation =
+        std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+    CPLDebug("GeoJSON", "Writing features with %d threads", nThreads);
+    return std::make_unique<OGRGeoJSONParallelWriter>(
+        oLayer, nThreads, std::move(poThreadReservation),
+        poThreadPool->CreateJobQueue());
+}
+
+/************************************************************************/
+/*                            EncodeBatch()                             */
+/************************************************************************/
+
+/** Run by worker threads */
+void OGRGeoJSONParallelWriter::EncodeBatch(Batch &oBatch)
+{
+    auto oAccumulator = oBatch.oErrorAccumulator.InstallForCurrentScope();
+    oBatch.aosJson.resize(oBatch.apoFeatures.size());
+    for (size_t i = 0; i < oBatch.apoFeatures.size(); ++i)
+    {
+        m_oLayer.SerializeFeature(oBatch.apoFeatures[i].get(),
+                                  oBatch.aosJson[i]);
+        oBatch.apoFeatures[i].reset();
+    }
+    oBatch.apoFeatures.clear();
+}
+
+/************************************************************************/
+/*                           SubmitCurrent()                            */
+/************************************************************************/
+
+void OGRGeoJSONParallelWriter::SubmitCurrent()
+{
+    auto poBatch = std::move(m_poCurrent);
+    m_poCurrent.reset();
+    m_apoPending.push_back(poBatch);
+    if (!m_poJobQueue->SubmitJob(
+            [this, poBatch]()
+            {
+                EncodeBatch(*poBatch);
+                std::lock_guard oLock(poBatch->oMutex);
+                poBatch->bDone = true;
+                poBatch->oCV.notify_one();
+            }))
+    {
+        EncodeBatch(*poBatch);
+        poBatch->bDone = true;
+    }
+}
+
+/************************************************************************/
+/*                            WriteFront()                              */
+/************************************************************************/
+
+/** Waits for the oldest submitted batch to be encoded, and writes it */
+void OGRGeoJSONParallelWriter::WriteFront()
+{
+    auto poBatch = std::move(m_apoPending.front());
+    m_apoPending.pop_front();
+    {
+        std::unique_lock oLock(poBatch->oMutex);
+        poBatch->oCV.wait(oLock, [&poBatch] { return poBatch->bDone; });
+    }
+    poBatch->oErrorAccumulator.ReplayErrors();
+    for (const auto &osJson : poBatch->aosJson)
+    {
+        if (!m_bWriteError &&
+            m_oLayer.WriteSerializedFeature(osJson) != OGRERR_NONE)
+        {
+            m_bWriteError = true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                             AddFeature()                             */
+/************************************************************************/
+
+/** Queues a feature for encoding. Returns an error if writing a previous
+ * batch failed.
+ */
+OGRErr
+OGRGeoJSONParallelWriter::AddFeature(std::unique_ptr<OGRFeature> &&poFeature)
+{
+    if (!m_poCurrent)
+    {
+        m_poCurrent = std::make_shared<Batch>();
+        m_poCurrent->apoFeatures.reserve(BATCH_MAX_FEATURES);
+    }
+    m_poCurrent->apoFeatures.push_back(std::move(poFeature));
+    if (m_poCurrent->apoFeatures.size() == BATCH_MAX_FEATURES)
+    {
+        SubmitCurrent();
+        while (m_apoPending.size() > m_nMaxInFlight)
+            WriteFront();
+    }
+    return m_bWriteError ? OGRERR_FAILURE : OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Flush()                                */
+/************************************************************************/
+
+/** Encodes and writes all queued features */
+OGRErr OGRGeoJSONParallelWriter::Flush()
+{
+    if (m_poCurrent)
+        SubmitCurrent();
+    while (!m_apoPending.empty())
+        WriteFront();
+    return m_bWriteError ? OGRERR_FAILURE : OGRERR_NONE;
+}
 
 /************************************************************************/
 /*                         OGRGeoJSONWriteLayer()                       */
@@ -40,7 +250,9 @@ OGRGeoJSONWriteLayer::OGRGeoJSONWriteLayer(const char *pszName,
           CSLFetchNameValueDef(papszOptions, "WRAPDATELINE", "YES"))),
       osForeignMembers_(
           CSLFetchNameValueDef(papszOptions, "FOREIGN_MEMBERS_FEATURE", "")),
-      poCT_(poCT)
+      poCT_(poCT),
+      m_nMinFeaturesParallelWrite(CPLAtoGIntBig(CPLGetConfigOption(
+          "OGR_GEOJSON_WRITE_MULTITHREADING_MIN_FEATURES", "10000")))
 {
     if (!osForeignMembers_.empty())
     {
@@ -102,6 +314,9 @@ OGRGeoJSONWriteLayer::~OGRGeoJSONWriteLayer()
 
 void OGRGeoJSONWriteLayer::FinishWriting()
 {
+    if (m_poParallelWriter)
+        m_poParallelWriter->Flush();
+
     if (m_nPositionBeforeFCClosed == 0)
     {
         VSILFILE *fp = poDS_->GetOutputFile();
@@ -163,12 +378,16 @@ void OGRGeoJSONWriteLayer::FinishWriting()
 
 OGRErr OGRGeoJSONWriteLayer::SyncToDisk()
 {
+    OGRErr eErr = OGRERR_NONE;
+    if (m_poParallelWriter)
+        eErr = m_poParallelWriter->Flush();
+
     if (m_nPositionBeforeFCClosed == 0 && poDS_->GetFpOutputIsSeekable())
     {
         FinishWriting();
     }
 
-    return OGRERR_NONE;
+    return eErr;
 }
 
 /************************************************************************/
@@ -177,8 +396,6 @@ OGRErr OGRGeoJSONWriteLayer::SyncToDisk()
 
 OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
 {
-    VSILFILE *fp = poDS_->GetOutputFile();
-
     OGRFeature *poFeatureToWrite;
     if (poCT_ != nullptr || bRFC7946_)
     {
@@ -296,22 +513,52 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
     {
         poFeatureToWrite->SetFID(nOutCounter_);
     }
-    json_object *poObj =
-        OGRGeoJSONWriteFeature(poFeatureToWrite, oWriteOptions_);
-    CPLAssert(nullptr != poObj);
 
-    if (m_nPositionBeforeFCClosed)
+    ExtendLayerEnvelope(poFeatureToWrite->GetGeometryRef());
+
+    if (!m_bParallelWriterChecked &&
+        nOutCounter_ >= m_nMinFeaturesParallelWrite)
     {
-        // If we had called SyncToDisk() previously, undo its effects
-        fp->Seek(m_nPositionBeforeFCClosed, SEEK_SET);
-        m_nPositionBeforeFCClosed = 0;
+        m_bParallelWriterChecked = true;
+        m_poParallelWriter = OGRGeoJSONParallelWriter::Create(*this);
     }
 
-    if (nOutCounter_ > 0)
+    OGRErr eErr;
+    if (m_poParallelWriter)
     {
-        /* Separate "Feature" entries in "FeatureCollection" object. */
-        VSIFPrintfL(fp, ",\n");
+        std::unique_ptr<OGRFeature> poOwnedFeature(
+            poFeatureToWrite != poFeature ? poFeatureToWrite
+                                          : poFeature->Clone());
+        eErr = m_poParallelWriter->AddFeature(std::move(poOwnedFeature));
     }
+    else
+    {
+        std::string osJson;
+        SerializeFeature(poFeatureToWrite, osJson);
+        eErr = WriteSerializedFeature(osJson);
+
+        if (poFeatureToWrite != poFeature)
+            delete poFeatureToWrite;
+    }
+
+    ++nOutCounter_;
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                          SerializeFeature()                          */
+/************************************************************************/
+
+/** Returns in osJson the JSON text of a feature, including its foreign
+ * members. May be called concurrently by several threads.
+ */
+void OGRGeoJSONWriteLayer::SerializeFeature(OGRFeature *poFeature,
+                                            std::string &osJson) const
+{
+    json_object *poObj = OGRGeoJSONWriteFeature(poFeature, oWriteOptions_);
+    CPLAssert(nullptr != poObj);
+
     const char *pszJson = json_object_to_json_string_ext(
         poObj, JSON_C_TO_STRING_SPACED
 #ifdef JSON_C_TO_STRING_NOSLASHESCAPE
@@ -319,13 +566,16 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
 #endif
     );
 
-    OGRErr eErr = OGRERR_NONE;
     size_t nLen = strlen(pszJson);
     if (!osForeignMembers_.empty())
     {
         if (nLen > 2 && pszJson[nLen - 2] == ' ' && pszJson[nLen - 1] == '}')
         {
-            nLen -= 2;
+            osJson.reserve(nLen + osForeignMembers_.size() + 1);
+            osJson.assign(pszJson, nLen - 2);
+            osJson += ", ";
+            osJson += osForeignMembers_;
+            osJson += '}';
         }
         else
         {
@@ -333,29 +583,53 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Unexpected JSON output for feature. Cannot write foreign "
                      "member");
-            osForeignMembers_.clear();
+            osJson.assign(pszJson, nLen);
         }
     }
-    if (VSIFWriteL(pszJson, nLen, 1, fp) != 1)
+    else
     {
-        CPLError(CE_Failure, CPLE_FileIO, "Cannot write feature");
-        eErr = OGRERR_FAILURE;
+        osJson.assign(pszJson, nLen);
     }
-    else if (!osForeignMembers_.empty() &&
-             (VSIFWriteL(", ", 2, 1, fp) != 1 ||
-              VSIFWriteL(osForeignMembers_.c_str(), osForeignMembers_.size(), 1,
-                         fp) != 1 ||
-              VSIFWriteL("}", 1, 1, fp) != 1))
+
+    json_object_put(poObj);
+}
+
+/************************************************************************/
+/*                       WriteSerializedFeature()                       */
+/************************************************************************/
+
+OGRErr OGRGeoJSONWriteLayer::WriteSerializedFeature(const std::string &osJson)
+{
+    VSILFILE *fp = poDS_->GetOutputFile();
+
+    if (m_nPositionBeforeFCClosed)
     {
-        CPLError(CE_Failure, CPLE_FileIO, "Cannot write feature");
-        eErr = OGRERR_FAILURE;
+        // If we had called SyncToDisk() previously, undo its effects
+        fp->Seek(m_nPositionBeforeFCClosed, SEEK_SET);
+        m_nPositionBeforeFCClosed = 0;
     }
 
-    json_object_put(poObj);
+    if (m_bFeatureWritten)
+    {
+        /* Separate "Feature" entries in "FeatureCollection" object. */
+        VSIFPrintfL(fp, ",\n");
+    }
+    m_bFeatureWritten = true;
 
-    ++nOutCounter_;
+    if (VSIFWriteL(osJson.data(), osJson.size(), 1, fp) != 1)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write feature");
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                        ExtendLayerEnvelope()                         */
+/************************************************************************/
 
-    OGRGeometry *poGeometry = poFeatureToWrite->GetGeometryRef();
+void OGRGeoJSONWriteLayer::ExtendLayerEnvelope(const OGRGeometry *poGeometry)
+{
     if (poGeometry != nullptr && !poGeometry->IsEmpty())
     {
         OGREnvelope3D sEnvelope = OGRGeoJSONGetBBox(poGeometry, oWriteOptions_);
@@ -435,11 +709,6 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
             sEnvelopeLayer.Merge(sEnvelope);
         }
     }
-
-    if (poFeatureToWrite != poFeature)
-        delete poFeatureToWrite;
-
-    return eErr;
 }
 
 /************************************************************************/
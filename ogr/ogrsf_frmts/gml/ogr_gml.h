@@ -19,7 +19,9 @@
 #include "gmlreader.h"
 #include "gmlutils.h"
 
+#include <deque>
 #include <memory>
+#include <string>
 #include <vector>
 
 class OGRGMLDataSource;
@@ -55,6 +57,25 @@ class OGRGMLLayer final : public OGRLayer
 
     bool bFaceHoleNegative;
 
+    // Features read ahead from the GML reader, whose geometry has been built
+    // in worker threads
+    struct PrefetchedFeature
+    {
+        std::unique_ptr<GMLFeature> poGMLFeature{};
+        std::unique_ptr<OGRGeometry> poGeom{};
+        std::string osErrorMsg{};
+    };
+
+    int m_nNumThreads = 1;
+    std::deque<PrefetchedFeature> m_aoPrefetchedFeatures{};
+    std::vector<void *> m_ahWorkerCacheSRS{};
+
+    bool CanPrefetchFeatures();
+    bool PrefetchFeatures();
+    OGRGeometry *BuildGeometry(const CPLXMLNode *const *papsGeometry,
+                               const char *pszSRSName, void *hCacheSRSIn,
+                               OGRwkbGeometryType eGeomType) const;
+
     CPL_DISALLOW_COPY_ASSIGN(OGRGMLLayer)
 
   public:
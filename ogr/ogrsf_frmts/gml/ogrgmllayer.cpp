@@ -16,9 +16,13 @@
 #include "cpl_conv.h"
 #include "cpl_port.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_p.h"
 #include "ogr_api.h"
 
+#include <algorithm>
+
 /************************************************************************/
 /*                           OGRGMLLayer()                              */
 /************************************************************************/
@@ -44,6 +48,16 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    if (!bWriter)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        m_nNumThreads = CPLGetNumCPUs();
+        if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+            m_nNumThreads =
+                std::max(1, std::min(2 * m_nNumThreads, atoi(pszNumThreads)));
+    }
 }
 
 /************************************************************************/
@@ -59,6 +73,8 @@ OGRGMLLayer::~OGRGMLLayer()
         poFeatureDefn->Release();
 
     GML_BuildOGRGeometryFromList_DestroyCache(hCacheSRS);
+    for (void *hWorkerCacheSRS : m_ahWorkerCacheSRS)
+        GML_BuildOGRGeometryFromList_DestroyCache(hWorkerCacheSRS);
 }
 
 /************************************************************************/
@@ -85,6 +101,7 @@ void OGRGMLLayer::ResetReading()
     }
 
     iNextGMLId = 0;
+    m_aoPrefetchedFeatures.clear();
     poDS->GetReader()->ResetReading();
     CPLDebug("GML", "ResetReading()");
     if (poDS->GetLayerCount() > 1 && poDS->GetReadMode() == STANDARD)
@@ -108,6 +125,150 @@ static GIntBig Increment(GIntBig nVal)
     return nVal;
 }
 
+/************************************************************************/
+/*                           BuildGeometry()                            */
+/************************************************************************/
+
+OGRGeometry *OGRGMLLayer::BuildGeometry(const CPLXMLNode *const *papsGeometry,
+                                        const char *pszSRSName,
+                                        void *hCacheSRSIn,
+                                        OGRwkbGeometryType eGeomType) const
+{
+    OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+        papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(), pszSRSName,
+        poDS->GetConsiderEPSGAsURN(), poDS->GetSwapCoordinates(),
+        poDS->GetSecondaryGeometryOption(), hCacheSRSIn, bFaceHoleNegative);
+
+    // Do geometry type changes if needed to match layer geometry type.
+    if (poGeom != nullptr)
+        poGeom = OGRGeometryFactory::forceTo(poGeom, eGeomType);
+    return poGeom;
+}
+
+/************************************************************************/
+/*                        CanPrefetchFeatures()                         */
+/************************************************************************/
+
+// Features are read ahead only in the standard read mode, where features of
+// other layers are just skipped, and for the common case of a single
+// geometry field.
+bool OGRGMLLayer::CanPrefetchFeatures()
+{
+    return m_nNumThreads > 1 && poDS->GetReadMode() == STANDARD &&
+           poFeatureDefn->GetGeomFieldCount() == 1;
+}
+
+/************************************************************************/
+/*                          PrefetchFeatures()                          */
+/************************************************************************/
+
+// Read ahead a batch of features of this layer, and build their geometry in
+// worker threads, as this dominates the time spent in GetNextFeature() for
+// large geometries. Returns false when there is no more feature.
+bool OGRGMLLayer::PrefetchFeatures()
+{
+    constexpr size_t FEATURES_PER_JOB = 256;
+    const size_t nMaxFeatures =
+        static_cast<size_t>(m_nNumThreads) * FEATURES_PER_JOB;
+    while (m_aoPrefetchedFeatures.size() < nMaxFeatures)
+    {
+        GMLFeature *poGMLFeature = poDS->GetReader()->NextFeature();
+        if (poGMLFeature == nullptr)
+            break;
+
+        // We count reading low level GML features as a feature read for
+        // work checking purposes, though at least we didn't necessary
+        // have to turn it into an OGRFeature.
+        m_nFeaturesRead++;
+
+        if (poGMLFeature->GetClass() != poFClass)
+        {
+            delete poGMLFeature;
+            continue;
+        }
+
+        PrefetchedFeature oFeature;
+        oFeature.poGMLFeature.reset(poGMLFeature);
+        m_aoPrefetchedFeatures.push_back(std::move(oFeature));
+    }
+
+    const size_t nFeatures = m_aoPrefetchedFeatures.size();
+    if (nFeatures == 0)
+        return false;
+
+    const size_t nJobs =
+        std::min(static_cast<size_t>(m_nNumThreads),
+                 (nFeatures + FEATURES_PER_JOB - 1) / FEATURES_PER_JOB);
+    // Each job uses its own SRS cache, since they are not thread-safe
+    while (m_ahWorkerCacheSRS.size() < nJobs)
+        m_ahWorkerCacheSRS.push_back(
+            GML_BuildOGRGeometryFromList_CreateCache());
+
+    const char *pszSRSName = poDS->GetGlobalSRSName();
+    const OGRwkbGeometryType eGeomType = GetGeomType();
+    const auto BuildGeometries =
+        [this, pszSRSName, eGeomType, nFeatures, nJobs](size_t iJob)
+    {
+        void *hWorkerCacheSRS = m_ahWorkerCacheSRS[iJob];
+        for (size_t i = iJob * nFeatures / nJobs;
+             i < (iJob + 1) * nFeatures / nJobs; ++i)
+        {
+            auto &oFeature = m_aoPrefetchedFeatures[i];
+            const CPLXMLNode *const *papsGeometry =
+                oFeature.poGMLFeature->GetGeometryList();
+            const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
+            const CPLXMLNode *psBoundedByGeometry =
+                oFeature.poGMLFeature->GetBoundedByGeometry();
+            if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+            {
+                apsGeometries[0] = psBoundedByGeometry;
+                papsGeometry = apsGeometries;
+            }
+            if (papsGeometry[0] == nullptr ||
+                strcmp(papsGeometry[0]->pszValue, "null") == 0)
+                continue;
+
+            // Errors are reported by GetNextFeature() in the main thread
+            CPLErrorReset();
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            oFeature.poGeom.reset(BuildGeometry(papsGeometry, pszSRSName,
+                                                hWorkerCacheSRS, eGeomType));
+            CPLPopErrorHandler();
+            if (!oFeature.poGeom)
+                oFeature.osErrorMsg = CPLGetLastErrorMsg();
+        }
+    };
+
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (nJobs > 1)
+    {
+        poThreadReservation = std::make_unique<GDALThreadReservation>(
+            static_cast<int>(nJobs));
+        if (poThreadReservation->GetThreadCount() > 1)
+            poThreadPool =
+                GDALGetGlobalThreadPool(poThreadReservation->GetThreadCount());
+    }
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (size_t iJob = 0; iJob < nJobs; ++iJob)
+        {
+            if (!poJobQueue->SubmitJob([&BuildGeometries, iJob]()
+                                       { BuildGeometries(iJob); }))
+                BuildGeometries(iJob);
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (size_t iJob = 0; iJob < nJobs; ++iJob)
+            BuildGeometries(iJob);
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -135,8 +296,22 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
     /* ==================================================================== */
     while (true)
     {
-        GMLFeature *poGMLFeature = poDS->PeekStoredGMLFeature();
-        if (poGMLFeature != nullptr)
+        GMLFeature *poGMLFeature = nullptr;
+        bool bIsPrefetched = false;
+        std::unique_ptr<OGRGeometry> poPrefetchedGeom;
+        std::string osPrefetchErrorMsg;
+        if (CanPrefetchFeatures())
+        {
+            if (m_aoPrefetchedFeatures.empty() && !PrefetchFeatures())
+                return nullptr;
+            auto &oFeature = m_aoPrefetchedFeatures.front();
+            poGMLFeature = oFeature.poGMLFeature.release();
+            poPrefetchedGeom = std::move(oFeature.poGeom);
+            osPrefetchErrorMsg = std::move(oFeature.osErrorMsg);
+            m_aoPrefetchedFeatures.pop_front();
+            bIsPrefetched = true;
+        }
+        else if ((poGMLFeature = poDS->PeekStoredGMLFeature()) != nullptr)
         {
             poDS->SetStoredGMLFeature(nullptr);
         }
@@ -339,24 +514,25 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else if (papsGeometry[0] != nullptr)
         {
-            const char *pszSRSName = poDS->GetGlobalSRSName();
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            poGeom = GML_BuildOGRGeometryFromList(
-                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
-                pszSRSName, poDS->GetConsiderEPSGAsURN(),
-                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
-                hCacheSRS, bFaceHoleNegative);
-            CPLPopErrorHandler();
-
-            // Do geometry type changes if needed to match layer geometry type.
-            if (poGeom != nullptr)
+            CPLString osLastErrorMsg;
+            if (bIsPrefetched)
             {
-                poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                poGeom = poPrefetchedGeom.release();
+                osLastErrorMsg = osPrefetchErrorMsg;
             }
             else
             {
-                const CPLString osLastErrorMsg(CPLGetLastErrorMsg());
+                const char *pszSRSName = poDS->GetGlobalSRSName();
+                CPLPushErrorHandler(CPLQuietErrorHandler);
+                poGeom = BuildGeometry(papsGeometry, pszSRSName, hCacheSRS,
+                                       GetGeomType());
+                CPLPopErrorHandler();
+                if (poGeom == nullptr)
+                    osLastErrorMsg = CPLGetLastErrorMsg();
+            }
 
+            if (poGeom == nullptr)
+            {
                 const bool bGoOn = CPLTestBool(
                     CPLGetConfigOption("GML_SKIP_CORRUPTED_FEATURES", "NO"));
 
@@ -15,18 +15,118 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <deque>
 #include <limits>
 #include <set>
 #include <utility>
+#include <vector>
 
 #if !defined(DEBUG_VERBOSE) && defined(DEBUG_VERBOSE_GPKG)
 #define DEBUG_VERBOSE
 #endif
 
+/************************************************************************/
+/*            GDALGPKGMBTilesLikePseudoDataset::TileEncodingJob         */
+/************************************************************************/
+
+// A Byte tile whose image encoding is done by a worker thread. The job owns
+// a copy of the tile pixels, so that m_pabyCachedTiles can be reused
+// immediately by the caller.
+struct GDALGPKGMBTilesLikePseudoDataset::TileEncodingJob
+{
+    // Dataset (main dataset or overview) into which the tile is inserted
+    GDALGPKGMBTilesLikePseudoDataset *poDS = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALDriver *poDriver = nullptr;
+    CPLStringList aosDriverOptions{};
+    std::vector<GByte> abyPixels{};
+    // Index in abyPixels of the band of each band of the encoded tile
+    std::vector<int> anSrcBand{};
+    std::unique_ptr<GDALColorTable> poCT{};
+    CPLString osMemFileName{};
+
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+    CPLErrorAccumulator oErrorAccumulator{};
+    std::atomic<bool> bDone{false};
+
+    TileEncodingJob() = default;
+    TileEncodingJob(const TileEncodingJob &) = delete;
+    TileEncodingJob &operator=(const TileEncodingJob &) = delete;
+
+    ~TileEncodingJob()
+    {
+        CPLFree(pabyBlob);
+    }
+
+    void Encode();
+};
+
+/************************************************************************/
+/*                         TileEncodingJob::Encode()                    */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::TileEncodingJob::Encode()
+{
+    auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    std::unique_ptr<MEMDataset> poMEMDS(MEMDataset::Create(
+        "", nBlockXSize, nBlockYSize, 0, GDT_Byte, nullptr));
+    const size_t nBandBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize;
+    for (int i = 0; i < static_cast<int>(anSrcBand.size()); i++)
+    {
+        auto hBand = MEMCreateRasterBandEx(
+            poMEMDS.get(), i + 1,
+            abyPixels.data() + anSrcBand[i] * nBandBlockSize, GDT_Byte, 0, 0,
+            false);
+        poMEMDS->AddMEMBand(hBand);
+    }
+    if (poCT)
+        poMEMDS->GetRasterBand(1)->SetColorTable(poCT.get());
+
+    GDALDataset *poOutDS =
+        poDriver->CreateCopy(osMemFileName, poMEMDS.get(), FALSE,
+                             aosDriverOptions.List(), nullptr, nullptr);
+    if (poOutDS)
+    {
+        GDALClose(poOutDS);
+        pabyBlob = VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+    }
+    VSIUnlink(osMemFileName);
+
+    // Release the tile pixels as soon as possible
+    std::vector<GByte>().swap(abyPixels);
+
+    bDone = true;
+}
+
+/************************************************************************/
+/*          GDALGPKGMBTilesLikePseudoDataset::TileEncodingContext       */
+/************************************************************************/
+
+struct GDALGPKGMBTilesLikePseudoDataset::TileEncodingContext
+{
+    CPLJobQueuePtr poJobQueue{};
+    int nThreads = 0;
+    // Submitted jobs, in submission order, whose tile is not inserted yet
+    std::deque<std::unique_ptr<TileEncodingJob>> apoJobs{};
+    // Set when a job failed while its tile was inserted outside of WriteTile()
+    bool bDeferredFailure = false;
+};
+
 /************************************************************************/
 /*                    GDALGPKGMBTilesLikePseudoDataset()                */
 /************************************************************************/
@@ -53,6 +153,11 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    if (m_poTileEncodingContext)
+    {
+        // Tiles not inserted by FlushTiles() at that point are lost
+        m_poTileEncodingContext->poJobQueue->WaitCompletion();
+    }
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -156,6 +261,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
         }
     }
 
+    if (poMainDS->ProcessTileEncodingJobs(true) != CE_None)
+        eErr = CE_Failure;
+
     if (poMainDS->m_nTileInsertionCount > 0)
     {
         if (poMainDS->ICommitTransaction() != OGRERR_NONE)
@@ -865,6 +973,8 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         return pabyData;
     }
 
+    WaitForPendingTileEncoding(nRow, nCol);
+
 #ifdef DEBUG_VERBOSE
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
@@ -1400,6 +1510,8 @@ GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 
 bool GDALGPKGMBTilesLikePseudoDataset::DeleteTile(int nRow, int nCol)
 {
+    WaitForPendingTileEncoding(nRow, nCol);
+
     char *pszSQL =
         sqlite3_mprintf("DELETE FROM \"%w\" "
                         "WHERE zoom_level = %d AND tile_row = %d AND "
@@ -1894,6 +2006,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
     {
         auto poMEMDS = MEMDataset::Create("", nBlockXSize, nBlockYSize, 0,
                                           eTileDT, nullptr);
+        // Index in m_pabyCachedTiles of the source of each band of poMEMDS
+        // (only for Byte tiles)
+        std::vector<int> anTileSrcBand;
         int nTileBands = nBands;
         if (bPartialTile && nBands == 1 && m_poCT == nullptr &&
             bTileDriverSupports2Bands)
@@ -2167,6 +2282,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                     iSrc = (i < 3) ? 0 : 3;
                 else if (nBands == 2 && nTileBands >= 3)
                     iSrc = (i < 3) ? 0 : 1;
+                anTileSrcBand.push_back(iSrc);
 
                 auto hBand = MEMCreateRasterBandEx(
                     poMEMDS, i + 1,
@@ -2362,6 +2478,41 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
+
+        // Byte tiles can be encoded by a worker thread, while the insertion
+        // into the database is done by this thread in submission order.
+        if (eTileDT == GDT_Byte)
+        {
+            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+                m_poParentDS ? m_poParentDS : this;
+            if (poMainDS->GetTileEncodingContext())
+            {
+                auto poJob = std::make_unique<TileEncodingJob>();
+                poJob->poDS = this;
+                poJob->nRow = nRow;
+                poJob->nCol = nCol;
+                poJob->nBlockXSize = nBlockXSize;
+                poJob->nBlockYSize = nBlockYSize;
+                poJob->poDriver = l_poDriver;
+                poJob->aosDriverOptions.Assign(papszDriverOptions, true);
+                poJob->anSrcBand = std::move(anTileSrcBand);
+                const int nSrcBands =
+                    1 + *std::max_element(poJob->anSrcBand.begin(),
+                                          poJob->anSrcBand.end());
+                poJob->abyPixels.assign(m_pabyCachedTiles,
+                                        m_pabyCachedTiles +
+                                            nSrcBands * nBandBlockSize);
+                const GDALColorTable *poTileCT =
+                    poMEMDS->GetRasterBand(1)->GetColorTable();
+                if (poTileCT)
+                    poJob->poCT.reset(poTileCT->Clone());
+                poJob->osMemFileName = osMemFileName;
+                delete poMEMDS;
+
+                return poMainDS->SubmitTileEncodingJob(std::move(poJob));
+            }
+        }
+
 #ifdef DEBUG
         VSIStatBufL sStat;
         CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
@@ -2378,64 +2529,11 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             vsi_l_offset nBlobSize = 0;
             GByte *pabyBlob =
                 VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+            eErr = InsertTileData(nRow, nCol, pabyBlob,
+                                  static_cast<size_t>(nBlobSize));
 
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
-            {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
-            }
-            poMainDS->m_nTileInsertionCount++;
-
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLFree(pabyBlob);
-            }
-            else
-            {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
-            }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
-
-            if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+            if (eErr == CE_None && (m_eTF == GPKG_TF_PNG_16BIT ||
+                                    m_eTF == GPKG_TF_TIFF_32BIT_FLOAT))
             {
                 GIntBig nTileId = GetTileId(nRow, nCol);
                 if (nTileId == 0)
@@ -2444,7 +2542,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2453,9 +2551,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
-                                             nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
+                                                 nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -2498,6 +2596,206 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
     return eErr;
 }
 
+/************************************************************************/
+/*                           InsertTileData()                           */
+/************************************************************************/
+
+// Insert (or replace) the encoded tile at (nRow, nCol). Takes ownership of
+// pabyBlob.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::InsertTileData(int nRow, int nCol,
+                                                        GByte *pabyBlob,
+                                                        size_t nBlobSize)
+{
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount < 0)
+    {
+        CPLFree(pabyBlob);
+        return CE_Failure;
+    }
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    CPLErr eErr = CE_Failure;
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+    return eErr;
+}
+
+/************************************************************************/
+/*                       GetTileEncodingContext()                       */
+/************************************************************************/
+
+// Return the context for the encoding of tiles in worker threads, or nullptr
+// if GDAL_NUM_THREADS does not allow more than one thread. Must be called on
+// the main dataset.
+GDALGPKGMBTilesLikePseudoDataset::TileEncodingContext *
+GDALGPKGMBTilesLikePseudoDataset::GetTileEncodingContext()
+{
+    CPLAssert(m_poParentDS == nullptr);
+    if (!m_bTileEncodingContextInitialized)
+    {
+        m_bTileEncodingContextInitialized = true;
+
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+        if (nThreads > 1)
+        {
+            nThreads = std::min(nThreads, 1024);
+            CPLWorkerThreadPool *poThreadPool =
+                GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+            {
+                auto poContext = std::make_unique<TileEncodingContext>();
+                poContext->poJobQueue = poThreadPool->CreateJobQueue();
+                poContext->nThreads = nThreads;
+                m_poTileEncodingContext = std::move(poContext);
+            }
+        }
+    }
+    return m_poTileEncodingContext.get();
+}
+
+/************************************************************************/
+/*                        SubmitTileEncodingJob()                       */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikePseudoDataset::SubmitTileEncodingJob(
+    std::unique_ptr<TileEncodingJob> poJob)
+{
+    TileEncodingContext *poContext = m_poTileEncodingContext.get();
+    CPLAssert(poContext);
+
+    // Each pending job owns a copy of a tile, so this bounds memory usage
+    poContext->poJobQueue->WaitCompletion(poContext->nThreads - 1);
+
+    TileEncodingJob *poJobRaw = poJob.get();
+    poContext->apoJobs.push_back(std::move(poJob));
+    if (!poContext->poJobQueue->SubmitJob([poJobRaw]() { poJobRaw->Encode(); }))
+    {
+        poJobRaw->Encode();
+    }
+
+    // Do not let encoded tiles accumulate behind a slow one
+    return ProcessTileEncodingJobs(static_cast<int>(poContext->apoJobs.size()) >
+                                   2 * poContext->nThreads);
+}
+
+/************************************************************************/
+/*                       ProcessTileEncodingJobs()                      */
+/************************************************************************/
+
+// Insert the tiles of the jobs that are completed, in submission order.
+// If bWaitAll is true, wait for all jobs to be completed.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::ProcessTileEncodingJobs(bool bWaitAll)
+{
+    TileEncodingContext *poContext = m_poTileEncodingContext.get();
+    if (!poContext)
+        return CE_None;
+
+    if (bWaitAll)
+        poContext->poJobQueue->WaitCompletion();
+
+    CPLErr eErr = CE_None;
+    if (poContext->bDeferredFailure)
+    {
+        poContext->bDeferredFailure = false;
+        eErr = CE_Failure;
+    }
+    while (!poContext->apoJobs.empty() && poContext->apoJobs.front()->bDone)
+    {
+        auto poJob = std::move(poContext->apoJobs.front());
+        poContext->apoJobs.pop_front();
+        poJob->oErrorAccumulator.ReplayErrors();
+        if (poJob->pabyBlob == nullptr)
+        {
+            eErr = CE_Failure;
+            continue;
+        }
+        GByte *pabyBlob = poJob->pabyBlob;
+        poJob->pabyBlob = nullptr;
+        if (poJob->poDS->InsertTileData(poJob->nRow, poJob->nCol, pabyBlob,
+                                        static_cast<size_t>(
+                                            poJob->nBlobSize)) != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                     WaitForPendingTileEncoding()                     */
+/************************************************************************/
+
+// Make sure that the tile at (nRow, nCol) of this dataset, if it is being
+// encoded, is inserted before the database is accessed for it.
+void GDALGPKGMBTilesLikePseudoDataset::WaitForPendingTileEncoding(int nRow,
+                                                                  int nCol)
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    TileEncodingContext *poContext = poMainDS->m_poTileEncodingContext.get();
+    if (!poContext)
+        return;
+    for (const auto &poJob : poContext->apoJobs)
+    {
+        if (poJob->poDS == this && poJob->nRow == nRow && poJob->nCol == nCol)
+        {
+            if (poMainDS->ProcessTileEncodingJobs(true) != CE_None)
+                poContext->bDeferredFailure = true;
+            break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                     FlushRemainingShiftedTiles()                     */
 /************************************************************************/
@@ -17,6 +17,8 @@
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <memory>
+
 typedef struct
 {
     int nRow;
@@ -98,6 +100,19 @@ class GDALGPKGMBTilesLikePseudoDataset
   private:
     bool m_bInWriteTile = false;
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
+    CPLErr InsertTileData(int nRow, int nCol, GByte *pabyBlob,
+                          size_t nBlobSize);
+
+    // Encoding of tiles in worker threads. Only set on the main dataset.
+    struct TileEncodingJob;
+    struct TileEncodingContext;
+    std::unique_ptr<TileEncodingContext> m_poTileEncodingContext{};
+    bool m_bTileEncodingContextInitialized = false;
+    TileEncodingContext *GetTileEncodingContext();
+    CPLErr SubmitTileEncodingJob(std::unique_ptr<TileEncodingJob> poJob);
+    CPLErr ProcessTileEncodingJobs(bool bWaitAll);
+    void WaitForPendingTileEncoding(int nRow, int nCol);
+
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
     bool DeleteFromGriddedTileAncillary(GIntBig nTileId);
@@ -597,7 +597,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToFill = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToFill);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -656,6 +658,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 /************************************************************************/
 
 struct OGRGPKGTableLayerFillArrowArray;
+struct OGRGPKGArrowBatchGeometry;
+class OGRGPKGArrowBatchGeometryEncoder;
+class OGRGPKGSpatialFilterArrowReader;
 struct sqlite_rtree_bl;
 
 class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
@@ -751,6 +756,12 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     OGRISO8601Format m_sDateTimeFormat = {OGRISO8601Precision::AUTO};
 
+    // Set during WriteArrowBatch() when geometries are encoded by worker
+    // threads. m_psArrowBatchGeometry is the one of the feature being
+    // inserted.
+    OGRGPKGArrowBatchGeometryEncoder *m_poArrowBatchGeometryEncoder = nullptr;
+    OGRGPKGArrowBatchGeometry *m_psArrowBatchGeometry = nullptr;
+
     void StartAsyncRTree();
     void CancelAsyncRTree();
     void RemoveAsyncRTreeTempDB();
@@ -819,16 +830,34 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     std::unique_ptr<OGRGPKGTableLayerFillArrowArray> m_poFillArrowArray{};
     std::unique_ptr<GDALGeoPackageDataset> m_poOtherDS{};
 
+    // Used when a spatial filter is evaluated by worker threads
+    std::unique_ptr<OGRGPKGSpatialFilterArrowReader>
+        m_poSpatialFilterArrowReader{};
+
+    friend class OGRGPKGSpatialFilterArrowReader;
+
     virtual int GetNextArrowArray(struct ArrowArrayStream *,
                                   struct ArrowArray *out_array) override;
+    OGRGeoPackageTableLayer *
+    OpenArrowWorkerLayer(GDALOpenInfo &oOpenInfo,
+                         std::unique_ptr<GDALGeoPackageDataset> &poOtherDS);
+    std::string
+    GetFillArrowArraySelect(const OGRArrowArrayHelper &oHelper);
     int GetNextArrowArrayInternal(struct ArrowArray *out_array,
                                   std::string &osErrorMsg,
                                   bool &bMemoryLimitReached);
+    int GetNextArrowArrayFromFIDs(struct ArrowArray *out_array,
+                                  const std::vector<GIntBig> &anFIDs,
+                                  size_t &nFIDsProcessed,
+                                  std::string &osErrorMsg,
+                                  bool &bMemoryLimitReached);
     int GetNextArrowArrayAsynchronous(struct ArrowArrayStream *stream,
                                       struct ArrowArray *out_array);
     void GetNextArrowArrayAsynchronousWorker();
     void CancelAsyncNextArrowArray();
 
+    OGRFeature *GetNextTableFeature(OGRFeature *poFeatureToFill);
+
   protected:
     friend void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext,
                                                    int /*argc*/,
@@ -877,12 +906,17 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                           bool bUpdateStyleString) override;
     OGRErr DeleteFeature(GIntBig nFID) override;
 
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
     OGRErr ISetSpatialFilter(int iGeomField,
                              const OGRGeometry *poGeom) override;
 
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    bool FillNextFeature(OGRFeature &oFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
@@ -726,6 +726,8 @@ void RegisterOGRGeoPackage()
         "database should be opened in nolock mode'/>"
         "  <Option name='IMMUTABLE' type='boolean' description='Whether the "
         "database should be opened in immutable mode'/>"
+        "  <Option name='MMAP_SIZE' type='int' description='Maximum number of "
+        "bytes of the database file accessed through memory-mapped I/O'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(
@@ -77,6 +77,19 @@ void OGRGeoPackageLayer::ClearStatement()
 
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+// If poFeatureToFill is not null, it is filled with the next feature instead
+// of a new feature being allocated, and it is returned.
+OGRFeature *
+OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeatureToFill)
+
 {
     if (m_bEOF)
         return nullptr;
@@ -119,14 +132,16 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poFeatureToFill);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        if (poFeature != poFeatureToFill)
+            delete poFeature;
     }
 }
 
@@ -328,13 +343,19 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToFill)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or reuse the one      */
+    /*      provided by the caller.                                         */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToFill;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(m_poFeatureDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -20,12 +20,15 @@
 #include "ogr_p.h"
 #include "sqlite_rtree_bulk_load/wrapper.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <cmath>
+#include <deque>
 #include <limits>
+#include <memory>
 
 #undef SQLITE_STATIC
 #define SQLITE_STATIC static_cast<sqlite3_destructor_type>(nullptr)
@@ -35,6 +38,289 @@
 static const char UNSUPPORTED_OP_READ_ONLY[] =
     "%s : unsupported operation on a read-only datasource.";
 
+/************************************************************************/
+/*                      OGRGPKGArrowBatchGeometry                       */
+/************************************************************************/
+
+/** Geometry of a row of a batch passed to WriteArrowBatch() */
+struct OGRGPKGArrowBatchGeometry
+{
+    std::unique_ptr<OGRGeometry> poGeom{};
+    // GeoPackage geometry blob, ready to be bound to the INSERT statement
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyBlob{};
+    size_t nBlobSize = 0;
+    OGREnvelope sEnvelope{};
+    bool bError = false;
+};
+
+/************************************************************************/
+/*                   OGRGPKGArrowBatchGeometryEncoder                   */
+/************************************************************************/
+
+/** Converts the WKB geometries of a batch passed to WriteArrowBatch() into
+ * GeoPackage geometry blobs in worker threads, while the calling thread
+ * inserts the rows in the table.
+ */
+class OGRGPKGArrowBatchGeometryEncoder
+{
+    struct Chunk
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+    };
+
+    //! Number of rows encoded by a job
+    static constexpr size_t CHUNK_SIZE = 1000;
+
+    const struct ArrowArray *const m_psArray;
+    const bool m_bLargeBinary;
+    const int m_iSrs;
+    const OGRGeomCoordinateBinaryPrecision m_sPrecision;
+    std::vector<OGRGPKGArrowBatchGeometry> m_asGeometries;
+    std::vector<std::unique_ptr<Chunk>> m_apoChunks{};
+    size_t m_nNextGeometry = 0;
+
+    std::unique_ptr<GDALThreadReservation> m_poThreadReservation{};
+    // Last member, as jobs fill m_asGeometries and m_apoChunks
+    CPLJobQueuePtr m_poJobQueue{};
+
+    void EncodeChunk(size_t iChunk);
+    template <class OffsetType> void EncodeChunk(size_t iChunk);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGPKGArrowBatchGeometryEncoder)
+
+  public:
+    OGRGPKGArrowBatchGeometryEncoder(
+        const struct ArrowArray *psArray, bool bLargeBinary, int iSrs,
+        const OGRGeomCoordinateBinaryPrecision &sPrecision,
+        std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+        CPLJobQueuePtr poJobQueue)
+        : m_psArray(psArray), m_bLargeBinary(bLargeBinary), m_iSrs(iSrs),
+          m_sPrecision(sPrecision),
+          m_asGeometries(static_cast<size_t>(psArray->length)),
+          m_poThreadReservation(std::move(poThreadReservation)),
+          m_poJobQueue(std::move(poJobQueue))
+    {
+    }
+
+    static std::unique_ptr<OGRGPKGArrowBatchGeometryEncoder>
+    Create(const struct ArrowArray *psArray, bool bLargeBinary, int iSrs,
+           const OGRGeomCoordinateBinaryPrecision &sPrecision);
+
+    void Start();
+    OGRGPKGArrowBatchGeometry *GetNext();
+};
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Returns an encoder if multithreaded encoding is enabled and worthwhile,
+ * or nullptr.
+ */
+std::unique_ptr<OGRGPKGArrowBatchGeometryEncoder>
+OGRGPKGArrowBatchGeometryEncoder::Create(
+    const struct ArrowArray *psArray, bool bLargeBinary, int iSrs,
+    const OGRGeomCoordinateBinaryPrecision &sPrecision)
+{
+    if (psArray->length < static_cast<int64_t>(2 * CHUNK_SIZE))
+        return nullptr;
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadReservation =
+        std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    if (nThreads <= 1)
+        return nullptr;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+    return std::make_unique<OGRGPKGArrowBatchGeometryEncoder>(
+        psArray, bLargeBinary, iSrs, sPrecision,
+        std::move(poThreadReservation), poThreadPool->CreateJobQueue());
+}
+
+/************************************************************************/
+/*                               Start()                                */
+/************************************************************************/
+
+void OGRGPKGArrowBatchGeometryEncoder::Start()
+{
+    const size_t nChunks =
+        (m_asGeometries.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    for (size_t i = 0; i < nChunks; ++i)
+        m_apoChunks.push_back(std::make_unique<Chunk>());
+    for (size_t i = 0; i < nChunks; ++i)
+    {
+        if (!m_poJobQueue->SubmitJob([this, i]() { EncodeChunk(i); }))
+            EncodeChunk(i);
+    }
+}
+
+/************************************************************************/
+/*                            EncodeChunk()                             */
+/************************************************************************/
+
+/** Run by worker threads */
+void OGRGPKGArrowBatchGeometryEncoder::EncodeChunk(size_t iChunk)
+{
+    if (m_bLargeBinary)
+        EncodeChunk<int64_t>(iChunk);
+    else
+        EncodeChunk<int32_t>(iChunk);
+
+    auto &oChunk = *(m_apoChunks[iChunk]);
+    std::lock_guard oLock(oChunk.oMutex);
+    oChunk.bDone = true;
+    oChunk.oCV.notify_one();
+}
+
+template <class OffsetType>
+void OGRGPKGArrowBatchGeometryEncoder::EncodeChunk(size_t iChunk)
+{
+    const size_t nStart = iChunk * CHUNK_SIZE;
+    const size_t nEnd = std::min(nStart + CHUNK_SIZE, m_asGeometries.size());
+    const auto nOffset = static_cast<size_t>(m_psArray->offset);
+    const uint8_t *pabyValidity =
+        m_psArray->null_count == 0
+            ? nullptr
+            : static_cast<const uint8_t *>(m_psArray->buffers[0]);
+    const auto *panOffsets =
+        static_cast<const OffsetType *>(m_psArray->buffers[1]) + nOffset;
+    const GByte *pabyData = static_cast<const GByte *>(m_psArray->buffers[2]);
+    for (size_t i = nStart; i < nEnd; ++i)
+    {
+        if (pabyValidity &&
+            (pabyValidity[(i + nOffset) / 8] & (1 << ((i + nOffset) % 8))) == 0)
+        {
+            continue;
+        }
+        // Corrupted WKB results in a null geometry, as in the generic
+        // implementation of WriteArrowBatch()
+        OGRGeometry *poGeom = nullptr;
+        size_t nBytesConsumedOut = 0;
+        OGRGeometryFactory::createFromWkb(
+            pabyData + static_cast<size_t>(panOffsets[i]), nullptr, &poGeom,
+            static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]),
+            wkbVariantIso, nBytesConsumedOut);
+        if (!poGeom)
+            continue;
+        auto &sGeom = m_asGeometries[i];
+        sGeom.poGeom.reset(poGeom);
+        sGeom.pabyBlob.reset(GPkgGeometryFromOGR(poGeom, m_iSrs, &m_sPrecision,
+                                                 &sGeom.nBlobSize));
+        if (!sGeom.pabyBlob)
+            sGeom.bError = true;
+        else if (!poGeom->IsEmpty())
+            poGeom->getEnvelope(&sGeom.sEnvelope);
+    }
+}
+
+/************************************************************************/
+/*                              GetNext()                               */
+/************************************************************************/
+
+/** Returns the geometry of the next row, once it has been encoded */
+OGRGPKGArrowBatchGeometry *OGRGPKGArrowBatchGeometryEncoder::GetNext()
+{
+    if (m_nNextGeometry == m_asGeometries.size())
+        return nullptr;
+    auto &oChunk = *(m_apoChunks[m_nNextGeometry / CHUNK_SIZE]);
+    {
+        std::unique_lock oLock(oChunk.oMutex);
+        oChunk.oCV.wait(oLock, [&oChunk] { return oChunk.bDone; });
+    }
+    return &m_asGeometries[m_nNextGeometry++];
+}
+
+/************************************************************************/
+/*                   OGRGPKGSpatialFilterArrowReader                    */
+/************************************************************************/
+
+/** Evaluates the spatial filter of GetNextArrowArray() in worker threads.
+ *
+ * The calling thread collects the candidate FIDs from the RTree, and
+ * dispatches them by batches of at most the maximum batch size to worker
+ * threads, that each use their own read-only connection to decode the
+ * geometries, apply the exact spatial filter and fill an ArrowArray.
+ * Batches are returned in the order in which the RTree emitted them.
+ */
+class OGRGPKGSpatialFilterArrowReader
+{
+    struct Worker
+    {
+        std::unique_ptr<GDALGeoPackageDataset> poDS{};
+        OGRGeoPackageTableLayer *poLayer = nullptr;
+    };
+
+    struct Batch
+    {
+        std::vector<GIntBig> anFIDs{};
+        size_t nFIDsProcessed = 0;
+        struct ArrowArray sArray{};
+        int nRet = 0;
+        std::string osErrorMsg{};
+        bool bMemoryLimitReached = false;
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+
+        Batch() = default;
+        CPL_DISALLOW_COPY_ASSIGN(Batch)
+
+        ~Batch()
+        {
+            if (sArray.release)
+                sArray.release(&sArray);
+        }
+    };
+
+    sqlite3_stmt *m_hStmt = nullptr;
+    bool m_bEOF = false;
+    const size_t m_nMaxBatchSize;
+    std::vector<std::unique_ptr<Worker>> m_apoWorkers{};
+    std::mutex m_oMutex{};
+    std::vector<Worker *> m_apoFreeWorkers{};
+    std::deque<std::shared_ptr<Batch>> m_apoPendingBatches{};
+
+    std::unique_ptr<GDALThreadReservation> m_poThreadReservation{};
+    // Last member, as jobs use m_apoFreeWorkers under m_oMutex
+    CPLJobQueuePtr m_poJobQueue{};
+
+    void SubmitBatches();
+    void Submit(const std::shared_ptr<Batch> &poBatch);
+    void RunBatch(Batch &oBatch);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGPKGSpatialFilterArrowReader)
+
+  public:
+    OGRGPKGSpatialFilterArrowReader(
+        size_t nMaxBatchSize,
+        std::unique_ptr<GDALThreadReservation> &&poThreadReservation,
+        CPLJobQueuePtr poJobQueue)
+        : m_nMaxBatchSize(nMaxBatchSize),
+          m_poThreadReservation(std::move(poThreadReservation)),
+          m_poJobQueue(std::move(poJobQueue))
+    {
+    }
+
+    ~OGRGPKGSpatialFilterArrowReader();
+
+    static std::unique_ptr<OGRGPKGSpatialFilterArrowReader>
+    Create(OGRGeoPackageTableLayer *poLayer);
+
+    int GetNextArrowArray(struct ArrowArray *out_array);
+};
+
 //----------------------------------------------------------------------
 // SaveExtent()
 //
@@ -241,8 +527,18 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
         if (poGeom)
         {
             size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
+            GByte *pabyWkb = nullptr;
+            if (m_psArrowBatchGeometry)
+            {
+                // Already encoded by a worker thread of WriteArrowBatch()
+                szWkb = m_psArrowBatchGeometry->nBlobSize;
+                pabyWkb = m_psArrowBatchGeometry->pabyBlob.release();
+            }
+            else
+            {
+                pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                              &m_sBinaryPrecision, &szWkb);
+            }
             if (!pabyWkb)
                 return OGRERR_FAILURE;
             int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
@@ -1545,6 +1841,8 @@ OGRGeoPackageTableLayer::~OGRGeoPackageTableLayer()
 
 void OGRGeoPackageTableLayer::CancelAsyncNextArrowArray()
 {
+    m_poSpatialFilterArrowReader.reset();
+
     if (m_poFillArrowArray)
     {
         std::lock_guard oLock(m_poFillArrowArray->oMutex);
@@ -2333,6 +2631,22 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
 
     CancelAsyncNextArrowArray();
 
+    m_psArrowBatchGeometry = nullptr;
+    if (m_poArrowBatchGeometryEncoder)
+    {
+        // Attach the geometry encoded by WriteArrowBatch() worker threads
+        m_psArrowBatchGeometry = m_poArrowBatchGeometryEncoder->GetNext();
+        if (!m_psArrowBatchGeometry || m_psArrowBatchGeometry->bError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot encode geometry of feature");
+            m_psArrowBatchGeometry = nullptr;
+            return OGRERR_FAILURE;
+        }
+        poFeature->SetGeomFieldDirectly(
+            0, m_psArrowBatchGeometry->poGeom.release());
+    }
+
     std::string osUpsertUniqueColumnName;
     if (bUpsert && poFeature->GetFID() == OGRNullFID)
     {
@@ -2572,7 +2886,10 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
         if (!poGeom->IsEmpty())
         {
             OGREnvelope oEnv;
-            poGeom->getEnvelope(&oEnv);
+            if (m_psArrowBatchGeometry)
+                oEnv = m_psArrowBatchGeometry->sEnvelope;
+            else
+                poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
             if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
@@ -2686,6 +3003,106 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+
+    // Look for the WKB geometry column, whose conversion to GeoPackage
+    // geometry blobs can be done by worker threads. The rows are then
+    // inserted by the generic implementation, from a view of the batch
+    // without that column.
+    int iGeomChild = -1;
+    if (m_poDS->GetUpdate() && m_poFeatureDefn->GetGeomFieldCount() == 1 &&
+        !m_poArrowBatchGeometryEncoder && strcmp(schema->format, "+s") == 0 &&
+        schema->n_children == array->n_children && array->offset == 0 &&
+        !CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "FALSE")))
+    {
+        const char *pszFIDName =
+            CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+        const char *pszGeomFieldName = CSLFetchNameValueDef(
+            papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+        if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+            pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+        for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+        {
+            const auto psChild = schema->children[i];
+            const char *pszName = psChild->name ? psChild->name : "";
+            if (psChild->dictionary ||
+                (strcmp(psChild->format, "z") != 0 &&
+                 strcmp(psChild->format, "Z") != 0) ||
+                (pszFIDName && strcmp(pszName, pszFIDName) == 0) ||
+                m_poFeatureDefn->GetFieldIndex(pszName) >= 0)
+            {
+                continue;
+            }
+            bool bIsGeom = m_poFeatureDefn->GetGeomFieldIndex(pszName) == 0 ||
+                           strcmp(pszName, pszGeomFieldName) == 0;
+            if (!bIsGeom && psChild->metadata)
+            {
+                const auto oMetadata =
+                    OGRParseArrowMetadata(psChild->metadata);
+                const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+                bIsGeom = oIter != oMetadata.end() &&
+                          (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                           oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+            }
+            if (bIsGeom)
+            {
+                if (iGeomChild >= 0)
+                {
+                    // Let the generic implementation deal with that
+                    iGeomChild = -1;
+                    break;
+                }
+                iGeomChild = i;
+            }
+        }
+    }
+    if (iGeomChild < 0)
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
+
+    auto poEncoder = OGRGPKGArrowBatchGeometryEncoder::Create(
+        array->children[iGeomChild],
+        strcmp(schema->children[iGeomChild]->format, "Z") == 0, m_iSrs,
+        m_sBinaryPrecision);
+    if (!poEncoder)
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    // Shallow copies, that must not be released
+    std::vector<struct ArrowSchema *> apsSchemaChildren(
+        schema->children, schema->children + schema->n_children);
+    apsSchemaChildren.erase(apsSchemaChildren.begin() + iGeomChild);
+    struct ArrowSchema sSchemaWithoutGeom = *schema;
+    sSchemaWithoutGeom.n_children = schema->n_children - 1;
+    sSchemaWithoutGeom.children = apsSchemaChildren.data();
+
+    std::vector<struct ArrowArray *> apsArrayChildren(
+        array->children, array->children + array->n_children);
+    apsArrayChildren.erase(apsArrayChildren.begin() + iGeomChild);
+    struct ArrowArray sArrayWithoutGeom = *array;
+    sArrayWithoutGeom.n_children = array->n_children - 1;
+    sArrayWithoutGeom.children = apsArrayChildren.data();
+
+    poEncoder->Start();
+    m_poArrowBatchGeometryEncoder = poEncoder.get();
+    const bool bRet = OGRLayer::WriteArrowBatch(
+        &sSchemaWithoutGeom, &sArrayWithoutGeom, papszOptions);
+    m_poArrowBatchGeometryEncoder = nullptr;
+    m_psArrowBatchGeometry = nullptr;
+    return bRet;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -3619,6 +4036,27 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 /************************************************************************/
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    return GetNextTableFeature(nullptr);
+}
+
+/************************************************************************/
+/*                          FillNextFeature()                           */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::FillNextFeature(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::FillNextFeature(oFeature);
+    return GetNextTableFeature(&oFeature) != nullptr;
+}
+
+/************************************************************************/
+/*                        GetNextTableFeature()                         */
+/************************************************************************/
+
+OGRFeature *
+OGRGeoPackageTableLayer::GetNextTableFeature(OGRFeature *poFeatureToFill)
 {
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
@@ -3635,7 +4073,7 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
             return nullptr;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
+    OGRFeature *poFeature = GetNextFeatureInternal(poFeatureToFill);
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
@@ -8608,6 +9046,314 @@ void OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronousWorker()
     m_poFillArrowArray->oCV.notify_one();
 }
 
+/************************************************************************/
+/*                     GetArrowThreadsAvailable()                       */
+/************************************************************************/
+
+static int GetArrowThreadsAvailable()
+{
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+    if (pszMaxThreads == nullptr)
+        return std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    else
+        return atoi(pszMaxThreads);
+}
+
+/************************************************************************/
+/*                       OpenArrowWorkerLayer()                         */
+/************************************************************************/
+
+/** Opens a read-only connection to the dataset, and returns the layer
+ * corresponding to this one, configured with the same ArrowArrayStream
+ * options and ignored fields, or nullptr.
+ */
+OGRGeoPackageTableLayer *OGRGeoPackageTableLayer::OpenArrowWorkerLayer(
+    GDALOpenInfo &oOpenInfo, std::unique_ptr<GDALGeoPackageDataset> &poOtherDS)
+{
+    poOtherDS = std::make_unique<GDALGeoPackageDataset>();
+    if (!poOtherDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+    {
+        return nullptr;
+    }
+    auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+        poOtherDS->GetLayerByName(GetName()));
+    if (poOtherLayer == nullptr ||
+        poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+            m_poFeatureDefn->GetFieldCount())
+    {
+        return nullptr;
+    }
+
+    // Install query logging callback
+    if (m_poDS->pfnQueryLoggerFunc)
+    {
+        poOtherDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
+                                      m_poDS->poQueryLoggerArg);
+    }
+
+    poOtherLayer->m_aosArrowArrayStreamOptions = m_aosArrowArrayStreamOptions;
+    auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+            m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+    }
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+    {
+        poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+            m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+    }
+    return poOtherLayer;
+}
+
+/************************************************************************/
+/*              OGRGPKGSpatialFilterArrowReader::Create()               */
+/************************************************************************/
+
+/** Returns a reader if the spatial filter of the layer can be evaluated by
+ * worker threads, or nullptr.
+ */
+std::unique_ptr<OGRGPKGSpatialFilterArrowReader>
+OGRGPKGSpatialFilterArrowReader::Create(OGRGeoPackageTableLayer *poLayer)
+{
+    GDALGeoPackageDataset *poDS = poLayer->m_poDS;
+    if (poDS->GetAccess() != GA_ReadOnly || !poLayer->m_bIsTable ||
+        poLayer->m_pszFidColumn == nullptr ||
+        poLayer->m_pszAttrQueryString != nullptr ||
+        poLayer->m_iGeomFieldFilter != 0 || !poLayer->HasSpatialIndex() ||
+        sqlite3_threadsafe() == 0)
+    {
+        return nullptr;
+    }
+
+    OGREnvelope sEnvelope;
+    poLayer->m_poFilterGeom->getEnvelope(&sEnvelope);
+    if (std::isinf(sEnvelope.MinX) || std::isinf(sEnvelope.MinY) ||
+        std::isinf(sEnvelope.MaxX) || std::isinf(sEnvelope.MaxY))
+    {
+        return nullptr;
+    }
+    // As in ResetStatement(), do not use the spatial index if the filter
+    // covers the whole layer extent.
+    const OGREnvelope *psExtent = poLayer->m_poExtent.get();
+    if (psExtent && sEnvelope.MinX <= psExtent->MinX &&
+        sEnvelope.MinY <= psExtent->MinY && sEnvelope.MaxX >= psExtent->MaxX &&
+        sEnvelope.MaxY >= psExtent->MaxY)
+    {
+        return nullptr;
+    }
+
+    int nThreads = GetArrowThreadsAvailable();
+    if (nThreads <= 1)
+        return nullptr;
+    auto poThreadReservation =
+        std::make_unique<GDALThreadReservation>(nThreads);
+    nThreads = poThreadReservation->GetThreadCount();
+    if (nThreads <= 1)
+        return nullptr;
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        poLayer->m_aosArrowArrayStreamOptions);
+    auto poReader = std::make_unique<OGRGPKGSpatialFilterArrowReader>(
+        static_cast<size_t>(nMaxBatchSize), std::move(poThreadReservation),
+        poThreadPool->CreateJobQueue());
+
+    GDALOpenInfo oOpenInfo(poDS->GetDescription(), GA_ReadOnly);
+    oOpenInfo.papszOpenOptions = poDS->GetOpenOptions();
+    oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        auto poWorker = std::make_unique<Worker>();
+        poWorker->poLayer =
+            poLayer->OpenArrowWorkerLayer(oOpenInfo, poWorker->poDS);
+        if (poWorker->poLayer == nullptr)
+            break;
+        // Each worker needs its own prepared geometry
+        poWorker->poLayer->SetSpatialFilter(poLayer->m_poFilterGeom);
+        poReader->m_apoFreeWorkers.push_back(poWorker.get());
+        poReader->m_apoWorkers.push_back(std::move(poWorker));
+    }
+    if (poReader->m_apoWorkers.size() < 2)
+        return nullptr;
+
+    CPLString osSQL;
+    osSQL.Printf("SELECT id FROM \"%s\" WHERE "
+                 "maxx >= %.12f AND minx <= %.12f AND "
+                 "maxy >= %.12f AND miny <= %.12f",
+                 SQLEscapeName(poLayer->m_osRTreeName).c_str(),
+                 sEnvelope.MinX - 1e-11, sEnvelope.MaxX + 1e-11,
+                 sEnvelope.MinY - 1e-11, sEnvelope.MaxY + 1e-11);
+    if (SQLPrepareWithError(poDS->GetDB(), osSQL.c_str(), -1,
+                            &poReader->m_hStmt, nullptr) != SQLITE_OK)
+    {
+        return nullptr;
+    }
+
+    CPLDebug("GPKG", "Using %d threads to evaluate the spatial filter",
+             static_cast<int>(poReader->m_apoWorkers.size()));
+    return poReader;
+}
+
+/************************************************************************/
+/*                ~OGRGPKGSpatialFilterArrowReader()                    */
+/************************************************************************/
+
+OGRGPKGSpatialFilterArrowReader::~OGRGPKGSpatialFilterArrowReader()
+{
+    m_poJobQueue->WaitCompletion();
+    if (m_hStmt)
+        sqlite3_finalize(m_hStmt);
+}
+
+/************************************************************************/
+/*           OGRGPKGSpatialFilterArrowReader::SubmitBatches()           */
+/************************************************************************/
+
+/** Collects candidate FIDs from the RTree, and submits them to the worker
+ * threads, so that there is a pending batch for each worker.
+ */
+void OGRGPKGSpatialFilterArrowReader::SubmitBatches()
+{
+    while (!m_bEOF && m_apoPendingBatches.size() < m_apoWorkers.size())
+    {
+        auto poBatch = std::make_shared<Batch>();
+        while (poBatch->anFIDs.size() < m_nMaxBatchSize)
+        {
+            const int rc = sqlite3_step(m_hStmt);
+            if (rc == SQLITE_ROW)
+            {
+                poBatch->anFIDs.push_back(sqlite3_column_int64(m_hStmt, 0));
+            }
+            else
+            {
+                if (rc != SQLITE_DONE)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "sqlite3_step() failed: %s",
+                             sqlite3_errmsg(sqlite3_db_handle(m_hStmt)));
+                }
+                m_bEOF = true;
+                break;
+            }
+        }
+        if (poBatch->anFIDs.empty())
+            break;
+        // Reading in FID order is more friendly with the layout of the
+        // table B-tree.
+        std::sort(poBatch->anFIDs.begin(), poBatch->anFIDs.end());
+        Submit(poBatch);
+        m_apoPendingBatches.push_back(std::move(poBatch));
+    }
+}
+
+/************************************************************************/
+/*              OGRGPKGSpatialFilterArrowReader::Submit()               */
+/************************************************************************/
+
+void OGRGPKGSpatialFilterArrowReader::Submit(
+    const std::shared_ptr<Batch> &poBatch)
+{
+    if (!m_poJobQueue->SubmitJob([this, poBatch]() { RunBatch(*poBatch); }))
+        RunBatch(*poBatch);
+}
+
+/************************************************************************/
+/*             OGRGPKGSpatialFilterArrowReader::RunBatch()              */
+/************************************************************************/
+
+/** Run by worker threads */
+void OGRGPKGSpatialFilterArrowReader::RunBatch(Batch &oBatch)
+{
+    Worker *poWorker = nullptr;
+    {
+        // There are never more batches in flight than workers
+        std::lock_guard oLock(m_oMutex);
+        CPLAssert(!m_apoFreeWorkers.empty());
+        poWorker = m_apoFreeWorkers.back();
+        m_apoFreeWorkers.pop_back();
+    }
+
+    oBatch.nRet = poWorker->poLayer->GetNextArrowArrayFromFIDs(
+        &oBatch.sArray, oBatch.anFIDs, oBatch.nFIDsProcessed,
+        oBatch.osErrorMsg, oBatch.bMemoryLimitReached);
+
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_apoFreeWorkers.push_back(poWorker);
+    }
+
+    std::lock_guard oLock(oBatch.oMutex);
+    oBatch.bDone = true;
+    oBatch.oCV.notify_one();
+}
+
+/************************************************************************/
+/*         OGRGPKGSpatialFilterArrowReader::GetNextArrowArray()         */
+/************************************************************************/
+
+int OGRGPKGSpatialFilterArrowReader::GetNextArrowArray(
+    struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    while (true)
+    {
+        SubmitBatches();
+        if (m_apoPendingBatches.empty())
+            return 0;
+
+        auto poBatch = std::move(m_apoPendingBatches.front());
+        m_apoPendingBatches.pop_front();
+        {
+            std::unique_lock oLock(poBatch->oMutex);
+            poBatch->oCV.wait(oLock, [&poBatch] { return poBatch->bDone; });
+        }
+
+        if (!poBatch->osErrorMsg.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     poBatch->osErrorMsg.c_str());
+            m_bEOF = true;
+            m_apoPendingBatches.clear();
+            return EIO;
+        }
+        if (poBatch->nRet != 0)
+        {
+            m_bEOF = true;
+            m_apoPendingBatches.clear();
+            return poBatch->nRet;
+        }
+
+        if (poBatch->bMemoryLimitReached &&
+            poBatch->nFIDsProcessed < poBatch->anFIDs.size())
+        {
+            // Process the remaining candidates of this batch before the
+            // next pending ones.
+            auto poRemainingBatch = std::make_shared<Batch>();
+            poRemainingBatch->anFIDs.assign(
+                poBatch->anFIDs.begin() +
+                    static_cast<std::ptrdiff_t>(poBatch->nFIDsProcessed),
+                poBatch->anFIDs.end());
+            Submit(poRemainingBatch);
+            m_apoPendingBatches.push_front(std::move(poRemainingBatch));
+        }
+
+        // Batches whose candidates have all been rejected by the exact
+        // spatial filter must not be reported as the end of the stream.
+        if (poBatch->sArray.release)
+        {
+            memcpy(out_array, &poBatch->sArray, sizeof(*out_array));
+            memset(&poBatch->sArray, 0, sizeof(poBatch->sArray));
+            return 0;
+        }
+    }
+}
+
 /************************************************************************/
 /*                      GetNextArrowArray()                             */
 /************************************************************************/
@@ -8639,6 +9385,18 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return OGRGeoPackageLayer::GetNextArrowArray(stream, out_array);
     }
 
+    if (m_poFilterGeom != nullptr && !m_poSpatialFilterArrowReader &&
+        !m_bGetNextArrowArrayCalledSinceResetReading && m_iNextShapeId == 0)
+    {
+        m_poSpatialFilterArrowReader =
+            OGRGPKGSpatialFilterArrowReader::Create(this);
+    }
+    if (m_poSpatialFilterArrowReader)
+    {
+        m_bGetNextArrowArrayCalledSinceResetReading = true;
+        return m_poSpatialFilterArrowReader->GetNextArrowArray(out_array);
+    }
+
     if (m_nIsCompatOfOptimizedGetNextArrowArray == FALSE ||
         m_pszFidColumn == nullptr || !m_soFilter.empty() ||
         m_poFillArrowArray ||
@@ -8785,30 +9543,18 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         stopThread();
     }
 
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
     // Start asynchronous tasks to prefetch the next ArrowArray
     if (m_poDS->GetAccess() == GA_ReadOnly &&
         m_oQueueArrowArrayPrefetchTasks.empty() &&
         m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
             m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
+        sqlite3_threadsafe() != 0 && GetArrowThreadsAvailable() >= 2 &&
         CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
     {
         const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
             DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
                          nMaxBatchSize),
-            GetThreadsAvailable()));
+            GetArrowThreadsAvailable()));
         CPLDebug("GPKG", "Using %d threads", nMaxTasks);
         GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
         oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
@@ -8819,46 +9565,17 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             task->m_iStartShapeId =
                 m_iNextShapeId +
                 static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
-            {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
+            auto poOtherLayer = OpenArrowWorkerLayer(oOpenInfo, task->m_poDS);
+            if (poOtherLayer == nullptr)
             {
                 break;
             }
 
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
-            {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
-            }
-
             task->m_poLayer = poOtherLayer;
             task->m_psArrowArray = std::make_unique<struct ArrowArray>();
             memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
 
             poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            auto poOtherFDefn = poOtherLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
-            {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
-            }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
-            {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
-            }
-
             poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
 
             auto taskPtr = task.get();
@@ -8957,8 +9674,64 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
         SQLITE_UTF8 | SQLITE_DETERMINISTIC, &sFillArrowArray, nullptr,
         OGR_GPKG_FillArrowArray_Step, OGR_GPKG_FillArrowArray_Finalize);
 
-    std::string osSQL;
-    osSQL = "SELECT OGR_GPKG_FillArrowArray_INTERNAL(-1,";
+    std::string osSQL = GetFillArrowArraySelect(*sFillArrowArray.psHelper);
+    osSQL += " WHERE \"";
+    osSQL += SQLEscapeName(m_pszFidColumn);
+    osSQL += "\" BETWEEN ";
+    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += " AND ";
+    osSQL += std::to_string(m_iNextShapeId +
+                            sFillArrowArray.psHelper->m_nMaxBatchSize);
+
+    // CPLDebug("GPKG", "%s", osSQL.c_str());
+
+    char *pszErrMsg = nullptr;
+    if (sqlite3_exec(m_poDS->GetDB(), osSQL.c_str(), nullptr, nullptr,
+                     &pszErrMsg) != SQLITE_OK)
+    {
+        if (!sFillArrowArray.bErrorOccurred &&
+            !sFillArrowArray.bMemoryLimitReached)
+        {
+            osErrorMsg = pszErrMsg ? pszErrMsg : "unknown error";
+        }
+    }
+    sqlite3_free(pszErrMsg);
+
+    bMemoryLimitReached = sFillArrowArray.bMemoryLimitReached;
+
+    // Delete function
+    sqlite3_create_function(m_poDS->GetDB(), "OGR_GPKG_FillArrowArray_INTERNAL",
+                            -1, SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
+                            nullptr, nullptr, nullptr);
+
+    if (sFillArrowArray.bErrorOccurred)
+    {
+        sFillArrowArray.psHelper->ClearArray();
+        return ENOMEM;
+    }
+
+    sFillArrowArray.psHelper->Shrink(sFillArrowArray.nCountRows);
+    if (sFillArrowArray.nCountRows == 0)
+    {
+        sFillArrowArray.psHelper->ClearArray();
+    }
+
+    m_iNextShapeId += sFillArrowArray.nCountRows;
+
+    return 0;
+}
+
+/************************************************************************/
+/*                       GetFillArrowArraySelect()                      */
+/************************************************************************/
+
+/** Returns the "SELECT OGR_GPKG_FillArrowArray_INTERNAL(...) FROM table"
+ * part of the statement used to fill an ArrowArray.
+ */
+std::string OGRGeoPackageTableLayer::GetFillArrowArraySelect(
+    const OGRArrowArrayHelper &oHelper)
+{
+    std::string osSQL = "SELECT OGR_GPKG_FillArrowArray_INTERNAL(-1,";
     int nCountArgs = 1;
 
     osSQL += '"';
@@ -8966,8 +9739,8 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += '"';
     ++nCountArgs;
 
-    if (!sFillArrowArray.psHelper->m_mapOGRGeomFieldToArrowField.empty() &&
-        sFillArrowArray.psHelper->m_mapOGRGeomFieldToArrowField[0] >= 0)
+    if (!oHelper.m_mapOGRGeomFieldToArrowField.empty() &&
+        oHelper.m_mapOGRGeomFieldToArrowField[0] >= 0)
     {
         osSQL += ',';
         osSQL += '"';
@@ -8977,11 +9750,9 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
     const int SQLITE_MAX_FUNCTION_ARG =
         sqlite3_limit(m_poDS->GetDB(), SQLITE_LIMIT_FUNCTION_ARG, -1);
-    for (int iField = 0; iField < sFillArrowArray.psHelper->m_nFieldCount;
-         iField++)
+    for (int iField = 0; iField < oHelper.m_nFieldCount; iField++)
     {
-        const int iArrowField =
-            sFillArrowArray.psHelper->m_mapOGRFieldToArrowField[iField];
+        const int iArrowField = oHelper.m_mapOGRFieldToArrowField[iField];
         if (iArrowField >= 0)
         {
             if (nCountArgs == SQLITE_MAX_FUNCTION_ARG)
@@ -9003,27 +9774,86 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
     osSQL += ") FROM \"";
     osSQL += SQLEscapeName(m_pszTableName);
-    osSQL += "\" WHERE \"";
-    osSQL += SQLEscapeName(m_pszFidColumn);
-    osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
-    osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
-                            sFillArrowArray.psHelper->m_nMaxBatchSize);
+    osSQL += '"';
+    return osSQL;
+}
 
-    // CPLDebug("GPKG", "%s", osSQL.c_str());
+/************************************************************************/
+/*                      GetNextArrowArrayFromFIDs()                     */
+/************************************************************************/
 
-    char *pszErrMsg = nullptr;
-    if (sqlite3_exec(m_poDS->GetDB(), osSQL.c_str(), nullptr, nullptr,
-                     &pszErrMsg) != SQLITE_OK)
+/** Fills an ArrowArray with the features of anFIDs that pass the spatial
+ * filter. nFIDsProcessed is set to the number of FIDs that have been
+ * processed, which is lower than anFIDs.size() if bMemoryLimitReached is set.
+ *
+ * Errors are not emitted but returned in osErrorMsg, as this is run by
+ * worker threads.
+ */
+int OGRGeoPackageTableLayer::GetNextArrowArrayFromFIDs(
+    struct ArrowArray *out_array, const std::vector<GIntBig> &anFIDs,
+    size_t &nFIDsProcessed, std::string &osErrorMsg, bool &bMemoryLimitReached)
+{
+    bMemoryLimitReached = false;
+    nFIDsProcessed = 0;
+    memset(out_array, 0, sizeof(*out_array));
+
+    auto psHelper = std::make_unique<OGRArrowArrayHelper>(
+        m_poDS, m_poFeatureDefn, m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
     {
-        if (!sFillArrowArray.bErrorOccurred &&
-            !sFillArrowArray.bMemoryLimitReached)
+        return ENOMEM;
+    }
+
+    OGRGPKGTableLayerFillArrowArray sFillArrowArray;
+    sFillArrowArray.psHelper = std::move(psHelper);
+    sFillArrowArray.nCountRows = 0;
+    sFillArrowArray.bMemoryLimitReached = false;
+    sFillArrowArray.bErrorOccurred = false;
+    sFillArrowArray.bDateTimeAsString = m_aosArrowArrayStreamOptions.FetchBool(
+        GAS_OPT_DATETIME_AS_STRING, false);
+    sFillArrowArray.poFeatureDefn = m_poFeatureDefn;
+    sFillArrowArray.poLayer = this;
+    sFillArrowArray.hDB = m_poDS->GetDB();
+    memset(&sFillArrowArray.brokenDown, 0, sizeof(sFillArrowArray.brokenDown));
+    if (m_poFilterGeom)
+        sFillArrowArray.poLayerForFilterGeom = this;
+
+    sqlite3_create_function(
+        m_poDS->GetDB(), "OGR_GPKG_FillArrowArray_INTERNAL", -1,
+        SQLITE_UTF8 | SQLITE_DETERMINISTIC, &sFillArrowArray, nullptr,
+        OGR_GPKG_FillArrowArray_Step, OGR_GPKG_FillArrowArray_Finalize);
+
+    std::string osSQL = GetFillArrowArraySelect(*sFillArrowArray.psHelper);
+    osSQL += " WHERE \"";
+    osSQL += SQLEscapeName(m_pszFidColumn);
+    osSQL += "\" = ?";
+
+    sqlite3_stmt *hStmt = nullptr;
+    if (sqlite3_prepare_v2(m_poDS->GetDB(), osSQL.c_str(), -1, &hStmt,
+                           nullptr) != SQLITE_OK)
+    {
+        osErrorMsg = sqlite3_errmsg(m_poDS->GetDB());
+    }
+    else
+    {
+        for (; nFIDsProcessed < anFIDs.size(); ++nFIDsProcessed)
         {
-            osErrorMsg = pszErrMsg ? pszErrMsg : "unknown error";
+            sqlite3_bind_int64(hStmt, 1, anFIDs[nFIDsProcessed]);
+            const int rc = sqlite3_step(hStmt);
+            sqlite3_reset(hStmt);
+            if (sFillArrowArray.bErrorOccurred ||
+                sFillArrowArray.bMemoryLimitReached)
+            {
+                break;
+            }
+            if (rc != SQLITE_ROW && rc != SQLITE_DONE)
+            {
+                osErrorMsg = sqlite3_errmsg(m_poDS->GetDB());
+                break;
+            }
         }
+        sqlite3_finalize(hStmt);
     }
-    sqlite3_free(pszErrMsg);
 
     bMemoryLimitReached = sFillArrowArray.bMemoryLimitReached;
 
@@ -9044,8 +9874,6 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
         sFillArrowArray.psHelper->ClearArray();
     }
 
-    m_iNextShapeId += sFillArrowArray.nCountRows;
-
     return 0;
 }
 
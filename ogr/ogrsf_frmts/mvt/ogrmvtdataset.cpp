@@ -3346,6 +3346,32 @@ class OGRMVTWriterDataset final : public GDALDataset
         std::set<CPLString> m_oSetFields;
     };
 
+    // Content of the temporary database for a tile, and result of its
+    // encoding by EncodeTile()
+    class MVTTileToEncode
+    {
+      public:
+        class Row
+        {
+          public:
+            size_t m_iLayer = 0;
+            std::string m_osFeature{};
+            double m_dfAreaOrLength = 0;
+        };
+
+        int m_nZ = 0;
+        int m_nX = 0;
+        int m_nY = 0;
+        std::vector<CPLString> m_aosLayerNames{};
+        std::vector<Row> m_asRows{};  // ordered by layer name and idx
+
+        // Tile at full resolution, used to collect the layer properties
+        MVTTile m_oTile{};
+        std::string m_osTileBuffer{};
+        bool m_bTooManyFeatures = false;
+        bool m_bTooBigTile = false;
+    };
+
     std::vector<std::unique_ptr<OGRMVTWriterLayer>> m_apoLayers;
     CPLString m_osTempDB;
     mutable std::mutex m_oDBMutex;
@@ -3428,22 +3454,21 @@ class OGRMVTWriterDataset final : public GDALDataset
                                       const std::string &osKey,
                                       const MVTTileLayerValue &oValue);
 
-    void EncodeFeature(const void *pabyBlob, int nBlobSize,
+    void EncodeFeature(const std::string &osBlob,
                        std::shared_ptr<MVTTileLayer> &poTargetLayer,
                        std::map<CPLString, GUInt32> &oMapKeyToIdx,
                        std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-                       MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-                       unsigned &nFeaturesInTile);
+                       GUInt32 nExtent, unsigned &nFeaturesInTile) const;
 
-    std::string
-    EncodeTile(int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer,
-               sqlite3_stmt *hStmtRows,
-               std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-               std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead);
+    void EncodeTile(MVTTileToEncode &oTileToEncode) const;
 
-    std::string RecodeTileLowerResolution(int nZ, int nX, int nY, int nExtent,
-                                          sqlite3_stmt *hStmtLayer,
-                                          sqlite3_stmt *hStmtRows);
+    std::string RecodeTileLowerResolution(const MVTTileToEncode &oTileToEncode,
+                                          GUInt32 nExtent) const;
+
+    static void
+    CollectLayerProperties(const MVTTileToEncode &oTileToEncode,
+                           std::map<CPLString, MVTLayerProperties> &oMap,
+                           std::set<CPLString> &oSetLayers);
 
     bool CreateOutput();
 
@@ -4819,16 +4844,14 @@ GetReducedPrecisionGeometry(MVTTileLayerFeature::GeomType eGeomType,
 /************************************************************************/
 
 void OGRMVTWriterDataset::EncodeFeature(
-    const void *pabyBlob, int nBlobSize,
-    std::shared_ptr<MVTTileLayer> &poTargetLayer,
+    const std::string &osBlob, std::shared_ptr<MVTTileLayer> &poTargetLayer,
     std::map<CPLString, GUInt32> &oMapKeyToIdx,
-    std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-    MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-    unsigned &nFeaturesInTile)
+    std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx, GUInt32 nExtent,
+    unsigned &nFeaturesInTile) const
 {
     size_t nUncompressedSize = 0;
-    void *pCompressed =
-        CPLZLibInflate(pabyBlob, nBlobSize, nullptr, 0, &nUncompressedSize);
+    void *pCompressed = CPLZLibInflate(osBlob.data(), osBlob.size(), nullptr,
+                                       0, &nUncompressedSize);
     GByte *pabyUncompressed = static_cast<GByte *>(pCompressed);
 
     MVTTileLayer oSrcTileLayer;
@@ -4846,10 +4869,6 @@ void OGRMVTWriterDataset::EncodeFeature(
             if (poSrcFeature->hasId())
                 poFeature->setId(poSrcFeature->getId());
             poFeature->setType(poSrcFeature->getType());
-            if (poLayerProperties)
-            {
-                poLayerProperties->m_oCountGeomType[poSrcFeature->getType()]++;
-            }
             bool bOK = true;
             if (nExtent < m_nExtent)
             {
@@ -4922,12 +4941,6 @@ void OGRMVTWriterDataset::EncodeFeature(
                         const auto &osKey = srcKeys[nSrcIdxKey];
                         const auto &oValue = srcValues[nSrcIdxValue];
 
-                        if (poLayerProperties)
-                        {
-                            UpdateLayerProperties(poLayerProperties, osKey,
-                                                  oValue);
-                        }
-
                         poFeature->addTag(oMapKeyToIdx[osKey]);
                         poFeature->addTag(oMapValueToIdx[oValue]);
                     }
@@ -4951,94 +4964,43 @@ void OGRMVTWriterDataset::EncodeFeature(
 /*                            EncodeTile()                              */
 /************************************************************************/
 
-std::string OGRMVTWriterDataset::EncodeTile(
-    int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer, sqlite3_stmt *hStmtRows,
-    std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-    std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead)
+// Called from worker threads: must only access the rows of oTileToEncode,
+// and read-only members of the dataset.
+void OGRMVTWriterDataset::EncodeTile(MVTTileToEncode &oTileToEncode) const
 {
-    MVTTile oTargetTile;
-
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
+    const int nZ = oTileToEncode.m_nZ;
+    const int nX = oTileToEncode.m_nX;
+    const int nY = oTileToEncode.m_nY;
+    const auto &asRows = oTileToEncode.m_asRows;
+    MVTTile &oTargetTile = oTileToEncode.m_oTile;
 
     unsigned nFeaturesInTile = 0;
-    const GIntBig nProgressStep =
-        std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
-
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    size_t iRow = 0;
+    while (nFeaturesInTile < m_nMaxFeatures && iRow < asRows.size())
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
-
-        auto oIterMapLayerProps = oMapLayerProps.find(pszLayerName);
-        MVTLayerProperties *poLayerProperties = nullptr;
-        if (oIterMapLayerProps == oMapLayerProps.end())
-        {
-            if (oSetLayers.size() < knMAX_COUNT_LAYERS)
-            {
-                oSetLayers.insert(pszLayerName);
-                if (oMapLayerProps.size() < knMAX_REPORT_LAYERS)
-                {
-                    MVTLayerProperties props;
-                    props.m_nMinZoom = nZ;
-                    props.m_nMaxZoom = nZ;
-                    oMapLayerProps[pszLayerName] = std::move(props);
-                    poLayerProperties = &(oMapLayerProps[pszLayerName]);
-                }
-            }
-        }
-        else
-        {
-            poLayerProperties = &(oIterMapLayerProps->second);
-        }
-        if (poLayerProperties)
-        {
-            poLayerProperties->m_nMinZoom =
-                std::min(nZ, poLayerProperties->m_nMinZoom);
-            poLayerProperties->m_nMaxZoom =
-                std::max(nZ, poLayerProperties->m_nMaxZoom);
-        }
+        const size_t iLayer = asRows[iRow].m_iLayer;
 
         std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
         oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
+        poTargetLayer->setName(oTileToEncode.m_aosLayerNames[iLayer]);
         poTargetLayer->setVersion(m_nMVTVersion);
         poTargetLayer->setExtent(m_nExtent);
 
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (; nFeaturesInTile < m_nMaxFeatures && iRow < asRows.size() &&
+               asRows[iRow].m_iLayer == iLayer;
+             ++iRow)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, poLayerProperties, m_nExtent,
+            EncodeFeature(asRows[iRow].m_osFeature, poTargetLayer,
+                          oMapKeyToIdx, oMapValueToIdx, m_nExtent,
                           nFeaturesInTile);
-
-            nTempTilesRead++;
-            if (nTempTilesRead == m_nTempTiles ||
-                (nTempTilesRead % nProgressStep) == 0)
-            {
-                const int nPct =
-                    static_cast<int>((100 * nTempTilesRead) / m_nTempTiles);
-                CPLDebug("MVT", "%d%%...", nPct);
-            }
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
-    std::string oTileBuffer(oTargetTile.write());
+    std::string &oTileBuffer = oTileToEncode.m_osTileBuffer;
+    oTileBuffer = oTargetTile.write();
     size_t nSizeBefore = oTileBuffer.size();
     if (m_bGZip)
         GZIPCompress(oTileBuffer);
@@ -5047,35 +5009,20 @@ std::string OGRMVTWriterDataset::EncodeTile(
         static_cast<double>(nSizeAfter) / nSizeBefore;
 
     const bool bTooManyFeatures = nFeaturesInTile >= m_nMaxFeatures;
-    if (bTooManyFeatures && !m_bMaxFeaturesOptSpecified)
-    {
-        m_bMaxFeaturesOptSpecified = true;
-        CPLError(CE_Warning, CPLE_AppDefined,
-                 "At least one tile exceeded the default maximum number of "
-                 "features per tile (%u) and was truncated to satisfy it.",
-                 m_nMaxFeatures);
-    }
+    oTileToEncode.m_bTooManyFeatures = bTooManyFeatures;
 
     // If the tile size is above the allowed values or there are too many
     // features, then sort by descending area / length until we get to the
     // limit.
     bool bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
-    if (bTooBigTile && !m_bMaxTileSizeOptSpecified)
-    {
-        m_bMaxTileSizeOptSpecified = true;
-        CPLError(CE_Warning, CPLE_AppDefined,
-                 "At least one tile exceeded the default maximum tile size of "
-                 "%u bytes and was encoded at lower resolution",
-                 m_nMaxTileSize);
-    }
+    oTileToEncode.m_bTooBigTile = bTooBigTile;
 
     GUInt32 nExtent = m_nExtent;
     while (bTooBigTile && !bTooManyFeatures && nExtent >= 256)
     {
         nExtent /= 2;
         nSizeBefore = oTileBuffer.size();
-        oTileBuffer = RecodeTileLowerResolution(nZ, nX, nY, nExtent, hStmtLayer,
-                                                hStmtRows);
+        oTileBuffer = RecodeTileLowerResolution(oTileToEncode, nExtent);
         bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
         CPLDebug("MVT",
                  "Recoding tile %d/%d/%d with extent = %u. "
@@ -5099,21 +5046,21 @@ std::string OGRMVTWriterDataset::EncodeTile(
                      nZ, nX, nY, m_nMaxFeatures);
         }
 
-        oTargetTile.clear();
-
         const unsigned nTotalFeaturesInTile =
             std::min(m_nMaxFeatures, nFeaturesInTile);
-        char *pszSQL =
-            sqlite3_mprintf("SELECT layer, feature FROM temp "
-                            "WHERE z = %d AND x = %d AND y = %d ORDER BY "
-                            "area_or_length DESC LIMIT %d",
-                            nZ, nX, nY, nTotalFeaturesInTile);
-        sqlite3_stmt *hTmpStmt = nullptr;
-        CPL_IGNORE_RET_VAL(
-            sqlite3_prepare_v2(m_hDB, pszSQL, -1, &hTmpStmt, nullptr));
-        sqlite3_free(pszSQL);
-        if (!hTmpStmt)
-            return std::string();
+
+        // Rows are ordered by layer name and idx, so a stable sort gives
+        // the order of "ORDER BY area_or_length DESC"
+        std::vector<size_t> anRowIdx(asRows.size());
+        for (size_t i = 0; i < anRowIdx.size(); ++i)
+            anRowIdx[i] = i;
+        std::stable_sort(anRowIdx.begin(), anRowIdx.end(),
+                         [&asRows](size_t a, size_t b) {
+                             return asRows[a].m_dfAreaOrLength >
+                                    asRows[b].m_dfAreaOrLength;
+                         });
+        if (anRowIdx.size() > nTotalFeaturesInTile)
+            anRowIdx.resize(nTotalFeaturesInTile);
 
         class TargetTileLayerProps
         {
@@ -5123,58 +5070,49 @@ std::string OGRMVTWriterDataset::EncodeTile(
             std::map<MVTTileLayerValue, GUInt32> m_oMapValueToIdx;
         };
 
-        std::map<std::string, TargetTileLayerProps> oMapLayerNameToTargetLayer;
+        MVTTile oReducedTile;
+        std::map<size_t, TargetTileLayerProps> oMapLayerIdxToTargetLayer;
 
         nFeaturesInTile = 0;
         const unsigned nCheckStep = std::max(1U, nTotalFeaturesInTile / 100);
-        while (sqlite3_step(hTmpStmt) == SQLITE_ROW)
+        for (const size_t iRowIdx : anRowIdx)
         {
-            const char *pszLayerName = reinterpret_cast<const char *>(
-                sqlite3_column_text(hTmpStmt, 0));
-            int nBlobSize = sqlite3_column_bytes(hTmpStmt, 1);
-            const void *pabyBlob = sqlite3_column_blob(hTmpStmt, 1);
-
-            std::shared_ptr<MVTTileLayer> poTargetLayer;
-            std::map<CPLString, GUInt32> *poMapKeyToIdx;
-            std::map<MVTTileLayerValue, GUInt32> *poMapValueToIdx;
-            auto oIter = oMapLayerNameToTargetLayer.find(pszLayerName);
-            if (oIter == oMapLayerNameToTargetLayer.end())
+            const auto &oRow = asRows[iRowIdx];
+
+            auto oIter = oMapLayerIdxToTargetLayer.find(oRow.m_iLayer);
+            if (oIter == oMapLayerIdxToTargetLayer.end())
             {
-                poTargetLayer =
-                    std::shared_ptr<MVTTileLayer>(new MVTTileLayer());
                 TargetTileLayerProps props;
-                props.m_poLayer = poTargetLayer;
-                oTargetTile.addLayer(poTargetLayer);
-                poTargetLayer->setName(pszLayerName);
-                poTargetLayer->setVersion(m_nMVTVersion);
-                poTargetLayer->setExtent(nExtent);
-                oMapLayerNameToTargetLayer[pszLayerName] = std::move(props);
-                poMapKeyToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapKeyToIdx;
-                poMapValueToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapValueToIdx;
-            }
-            else
-            {
-                poTargetLayer = oIter->second.m_poLayer;
-                poMapKeyToIdx = &oIter->second.m_oMapKeyToIdx;
-                poMapValueToIdx = &oIter->second.m_oMapValueToIdx;
+                props.m_poLayer =
+                    std::shared_ptr<MVTTileLayer>(new MVTTileLayer());
+                oReducedTile.addLayer(props.m_poLayer);
+                props.m_poLayer->setName(
+                    oTileToEncode.m_aosLayerNames[oRow.m_iLayer]);
+                props.m_poLayer->setVersion(m_nMVTVersion);
+                props.m_poLayer->setExtent(nExtent);
+                oIter = oMapLayerIdxToTargetLayer
+                            .insert(std::make_pair(oRow.m_iLayer,
+                                                   std::move(props)))
+                            .first;
             }
 
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, *poMapKeyToIdx,
-                          *poMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+            EncodeFeature(oRow.m_osFeature, oIter->second.m_poLayer,
+                          oIter->second.m_oMapKeyToIdx,
+                          oIter->second.m_oMapValueToIdx, nExtent,
+                          nFeaturesInTile);
 
             if (nFeaturesInTile == nTotalFeaturesInTile ||
                 (bTooBigTile && (nFeaturesInTile % nCheckStep == 0)))
             {
-                if (oTargetTile.getSize() * dfCompressionRatio > m_nMaxTileSize)
+                if (oReducedTile.getSize() * dfCompressionRatio >
+                    m_nMaxTileSize)
                 {
                     break;
                 }
             }
         }
 
-        oTileBuffer = oTargetTile.write();
+        oTileBuffer = oReducedTile.write();
         if (m_bGZip)
             GZIPCompress(oTileBuffer);
 
@@ -5183,11 +5121,7 @@ std::string OGRMVTWriterDataset::EncodeTile(
             CPLDebug("MVT", "For tile %d/%d/%d, final tile size is %u", nZ, nX,
                      nY, static_cast<unsigned>(oTileBuffer.size()));
         }
-
-        sqlite3_finalize(hTmpStmt);
     }
-
-    return oTileBuffer;
 }
 
 /************************************************************************/
@@ -5195,49 +5129,36 @@ std::string OGRMVTWriterDataset::EncodeTile(
 /************************************************************************/
 
 std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
-    int nZ, int nX, int nY, int nExtent, sqlite3_stmt *hStmtLayer,
-    sqlite3_stmt *hStmtRows)
+    const MVTTileToEncode &oTileToEncode, GUInt32 nExtent) const
 {
     MVTTile oTargetTile;
 
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
+    const auto &asRows = oTileToEncode.m_asRows;
     unsigned nFeaturesInTile = 0;
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    size_t iRow = 0;
+    while (nFeaturesInTile < m_nMaxFeatures && iRow < asRows.size())
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
+        const size_t iLayer = asRows[iRow].m_iLayer;
 
         std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
         oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
+        poTargetLayer->setName(oTileToEncode.m_aosLayerNames[iLayer]);
         poTargetLayer->setVersion(m_nMVTVersion);
         poTargetLayer->setExtent(nExtent);
 
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (; nFeaturesInTile < m_nMaxFeatures && iRow < asRows.size() &&
+               asRows[iRow].m_iLayer == iLayer;
+             ++iRow)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+            EncodeFeature(asRows[iRow].m_osFeature, poTargetLayer,
+                          oMapKeyToIdx, oMapValueToIdx, nExtent,
+                          nFeaturesInTile);
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     if (m_bGZip)
         GZIPCompress(oTileBuffer);
@@ -5245,6 +5166,65 @@ std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
     return oTileBuffer;
 }
 
+/************************************************************************/
+/*                      CollectLayerProperties()                        */
+/************************************************************************/
+
+void OGRMVTWriterDataset::CollectLayerProperties(
+    const MVTTileToEncode &oTileToEncode,
+    std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
+    std::set<CPLString> &oSetLayers)
+{
+    const int nZ = oTileToEncode.m_nZ;
+    for (const auto &poLayer : oTileToEncode.m_oTile.getLayers())
+    {
+        const CPLString osLayerName(poLayer->getName());
+        auto oIterMapLayerProps = oMapLayerProps.find(osLayerName);
+        MVTLayerProperties *poLayerProperties = nullptr;
+        if (oIterMapLayerProps == oMapLayerProps.end())
+        {
+            if (oSetLayers.size() < knMAX_COUNT_LAYERS)
+            {
+                oSetLayers.insert(osLayerName);
+                if (oMapLayerProps.size() < knMAX_REPORT_LAYERS)
+                {
+                    MVTLayerProperties props;
+                    props.m_nMinZoom = nZ;
+                    props.m_nMaxZoom = nZ;
+                    oMapLayerProps[osLayerName] = std::move(props);
+                    poLayerProperties = &(oMapLayerProps[osLayerName]);
+                }
+            }
+        }
+        else
+        {
+            poLayerProperties = &(oIterMapLayerProps->second);
+        }
+        if (!poLayerProperties)
+            continue;
+
+        poLayerProperties->m_nMinZoom =
+            std::min(nZ, poLayerProperties->m_nMinZoom);
+        poLayerProperties->m_nMaxZoom =
+            std::max(nZ, poLayerProperties->m_nMaxZoom);
+
+        // Tags of the features of the full resolution tile are in the
+        // same order as in the source features
+        const auto &aosKeys = poLayer->getKeys();
+        const auto &aoValues = poLayer->getValues();
+        for (const auto &poFeature : poLayer->getFeatures())
+        {
+            poLayerProperties->m_oCountGeomType[poFeature->getType()]++;
+            const auto &anTags = poFeature->getTags();
+            for (size_t i = 0; i + 1 < anTags.size(); i += 2)
+            {
+                UpdateLayerProperties(poLayerProperties, aosKeys[anTags[i]],
+                                      aoValues[anTags[i + 1]]);
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                            CreateOutput()                            */
 /************************************************************************/
@@ -5274,29 +5254,16 @@ bool OGRMVTWriterDataset::CreateOutput()
         return false;
     }
 
-    sqlite3_stmt *hStmtLayer = nullptr;
-    CPL_IGNORE_RET_VAL(
-        sqlite3_prepare_v2(m_hDB,
-                           "SELECT DISTINCT layer FROM temp "
-                           "WHERE z = ? AND x = ? AND y = ? ORDER BY layer",
-                           -1, &hStmtLayer, nullptr));
-    if (hStmtLayer == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        return false;
-    }
     sqlite3_stmt *hStmtRows = nullptr;
     CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
         m_hDB,
-        "SELECT feature FROM temp "
-        "WHERE z = ? AND x = ? AND y = ? AND layer = ? ORDER BY idx",
+        "SELECT layer, feature, area_or_length FROM temp "
+        "WHERE z = ? AND x = ? AND y = ? ORDER BY layer, idx",
         -1, &hStmtRows, nullptr));
     if (hStmtRows == nullptr)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
         sqlite3_finalize(hStmtZXY);
-        sqlite3_finalize(hStmtLayer);
         return false;
     }
 
@@ -5312,7 +5279,6 @@ bool OGRMVTWriterDataset::CreateOutput()
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
             sqlite3_finalize(hStmtZXY);
-            sqlite3_finalize(hStmtLayer);
             sqlite3_finalize(hStmtRows);
             return false;
         }
@@ -5322,20 +5288,52 @@ bool OGRMVTWriterDataset::CreateOutput()
     int nLastX = -1;
     bool bRet = true;
     GIntBig nTempTilesRead = 0;
+    const GIntBig nProgressStep =
+        std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    const auto WriteTile = [&](const MVTTileToEncode &oTile)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
+        const int nZ = oTile.m_nZ;
+        const int nX = oTile.m_nX;
+        const int nY = oTile.m_nY;
 
-        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
-                                           oMapLayerProps, oSetLayers,
-                                           nTempTilesRead));
+        CollectLayerProperties(oTile, oMapLayerProps, oSetLayers);
 
+        const GIntBig nTempTilesReadBefore = nTempTilesRead;
+        for (const auto &poLayer : oTile.m_oTile.getLayers())
+            nTempTilesRead += poLayer->getFeatures().size();
+        if (nTempTilesRead == m_nTempTiles ||
+            nTempTilesRead / nProgressStep !=
+                nTempTilesReadBefore / nProgressStep)
+        {
+            const int nPct =
+                static_cast<int>((100 * nTempTilesRead) / m_nTempTiles);
+            CPLDebug("MVT", "%d%%...", nPct);
+        }
+
+        if (oTile.m_bTooManyFeatures && !m_bMaxFeaturesOptSpecified)
+        {
+            m_bMaxFeaturesOptSpecified = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "At least one tile exceeded the default maximum number "
+                     "of features per tile (%u) and was truncated to satisfy "
+                     "it.",
+                     m_nMaxFeatures);
+        }
+        if (oTile.m_bTooBigTile && !m_bMaxTileSizeOptSpecified)
+        {
+            m_bMaxTileSizeOptSpecified = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "At least one tile exceeded the default maximum tile "
+                     "size of %u bytes and was encoded at lower resolution",
+                     m_nMaxTileSize);
+        }
+
+        const std::string &oTileBuffer = oTile.m_osTileBuffer;
+        bool bOK = true;
         if (oTileBuffer.empty())
         {
-            bRet = false;
+            bOK = false;
         }
         else if (hInsertStmt)
         {
@@ -5346,7 +5344,7 @@ bool OGRMVTWriterDataset::CreateOutput()
                               static_cast<int>(oTileBuffer.size()),
                               SQLITE_STATIC);
             const int rc = sqlite3_step(hInsertStmt);
-            bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
+            bOK = (rc == SQLITE_OK || rc == SQLITE_DONE);
             sqlite3_reset(hInsertStmt);
         }
         else
@@ -5374,24 +5372,112 @@ bool OGRMVTWriterDataset::CreateOutput()
             {
                 const size_t nRet = VSIFWriteL(oTileBuffer.data(), 1,
                                                oTileBuffer.size(), fpOut);
-                bRet = (nRet == oTileBuffer.size());
+                bOK = (nRet == oTileBuffer.size());
                 VSIFCloseL(fpOut);
             }
             else
             {
-                bRet = false;
+                bOK = false;
             }
         }
 
-        if (!bRet)
+        if (!bOK)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Error while writing tile %d/%d/%d", nZ, nX, nY);
-            break;
         }
+        return bOK;
+    };
+
+    // Tiles are read from the temporary database and written to the output
+    // in the main thread, in z, x, y order, but they are encoded by batches
+    // in worker threads. The layer properties are collected in the main
+    // thread, in tile order, so that the output does not depend on the
+    // number of threads.
+    const size_t nMaxTilesInBatch =
+        m_bThreadPoolOK
+            ? static_cast<size_t>(10 * m_oThreadPool.GetThreadCount())
+            : 1;
+    constexpr size_t MAX_BATCH_SIZE = 100 * 1024 * 1024;
+    std::vector<std::unique_ptr<MVTTileToEncode>> apoBatch;
+    size_t nBatchSize = 0;
+
+    const auto ProcessBatch = [&]()
+    {
+        if (apoBatch.size() > 1)
+        {
+            for (auto &poTile : apoBatch)
+            {
+                MVTTileToEncode *poTileToEncode = poTile.get();
+                if (!m_oThreadPool.SubmitJob([this, poTileToEncode]()
+                                             { EncodeTile(*poTileToEncode); }))
+                {
+                    EncodeTile(*poTileToEncode);
+                }
+            }
+            m_oThreadPool.WaitCompletion();
+        }
+        else
+        {
+            for (auto &poTile : apoBatch)
+                EncodeTile(*poTile);
+        }
+
+        for (const auto &poTile : apoBatch)
+        {
+            if (!WriteTile(*poTile))
+            {
+                bRet = false;
+                break;
+            }
+        }
+        apoBatch.clear();
+        nBatchSize = 0;
+    };
+
+    while (bRet && sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    {
+        auto poTile = std::make_unique<MVTTileToEncode>();
+        poTile->m_nZ = sqlite3_column_int(hStmtZXY, 0);
+        poTile->m_nX = sqlite3_column_int(hStmtZXY, 1);
+        poTile->m_nY = sqlite3_column_int(hStmtZXY, 2);
+
+        sqlite3_bind_int(hStmtRows, 1, poTile->m_nZ);
+        sqlite3_bind_int(hStmtRows, 2, poTile->m_nX);
+        sqlite3_bind_int(hStmtRows, 3, poTile->m_nY);
+        while (sqlite3_step(hStmtRows) == SQLITE_ROW)
+        {
+            const char *pszLayerName = reinterpret_cast<const char *>(
+                sqlite3_column_text(hStmtRows, 0));
+            if (!pszLayerName)
+                pszLayerName = "";
+            if (poTile->m_aosLayerNames.empty() ||
+                poTile->m_aosLayerNames.back() != pszLayerName)
+            {
+                poTile->m_aosLayerNames.push_back(pszLayerName);
+            }
+
+            MVTTileToEncode::Row oRow;
+            oRow.m_iLayer = poTile->m_aosLayerNames.size() - 1;
+            const int nBlobSize = sqlite3_column_bytes(hStmtRows, 1);
+            const char *pabyBlob =
+                static_cast<const char *>(sqlite3_column_blob(hStmtRows, 1));
+            if (pabyBlob)
+                oRow.m_osFeature.assign(pabyBlob, nBlobSize);
+            oRow.m_dfAreaOrLength = sqlite3_column_double(hStmtRows, 2);
+            nBatchSize += oRow.m_osFeature.size();
+            poTile->m_asRows.push_back(std::move(oRow));
+        }
+        sqlite3_reset(hStmtRows);
+
+        apoBatch.push_back(std::move(poTile));
+        if (apoBatch.size() >= nMaxTilesInBatch || nBatchSize >= MAX_BATCH_SIZE)
+            ProcessBatch();
     }
+    if (bRet && !apoBatch.empty())
+        ProcessBatch();
+
     sqlite3_finalize(hStmtZXY);
-    sqlite3_finalize(hStmtLayer);
     sqlite3_finalize(hStmtRows);
     if (hInsertStmt)
         sqlite3_finalize(hInsertStmt);
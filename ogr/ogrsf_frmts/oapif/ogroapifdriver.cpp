@@ -16,10 +16,15 @@
 #include "cpl_http.h"
 #include "ogr_swq.h"
 #include "parsexsd.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cinttypes>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 
@@ -94,14 +99,19 @@ class OGROAPIFDataset final : public GDALDataset
 
     std::string m_osDateTime{};
 
+    // Number of pages of features fetched ahead by a worker thread
+    int m_nPrefetchPages = 0;
+
     bool Download(const CPLString &osURL, const char *pszAccept,
                   CPLString &osResult, CPLString &osContentType,
-                  CPLStringList *paosHeaders = nullptr);
+                  CPLStringList *paosHeaders = nullptr,
+                  bool bUsePersistentSession = true);
 
     bool DownloadJSon(const CPLString &osURL, CPLJSONDocument &oDoc,
                       const char *pszAccept = MEDIA_TYPE_GEOJSON
                       ", " MEDIA_TYPE_JSON,
-                      CPLStringList *paosHeaders = nullptr);
+                      CPLStringList *paosHeaders = nullptr,
+                      bool bUsePersistentSession = true);
 
     bool LoadJSONCollection(const CPLJSONObject &oCollection,
                             const CPLJSONArray &oGlobalCRSList);
@@ -178,8 +188,38 @@ class OGROAPIFLayer final : public OGRLayer
     CPLJSONDocument m_oCurDoc{};
     int m_iFeatureInPage = 0;
 
+    // Page of features downloaded, and opened as GeoJSON, by a worker thread
+    struct PrefetchedPage
+    {
+        CPLString osURL{};
+        CPLJSONDocument oDoc{};
+        CPLStringList aosHeaders{};
+        std::unique_ptr<GDALDataset> poDS{};
+        bool bOK = false;
+    };
+
+    // State shared with the prefetching job
+    struct PrefetchState
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        std::deque<std::unique_ptr<PrefetchedPage>> apoPages{};
+        CPLString osNextURL{};
+        bool bRunning = false;
+        bool bStop = false;
+    };
+
+    PrefetchState m_oPrefetch{};
+    CPLJobQueuePtr m_poPrefetchJobQueue{};
+
     void EstablishFeatureDefn();
     OGRFeature *GetNextRawFeature();
+    CPLString GetNextPageURL(const CPLJSONDocument &oDoc,
+                             const CPLString &osURL) const;
+    void StartPrefetch();
+    void StopPrefetch();
+    void PrefetchJob(const CPLStringList &aosThreadLocalConfigOptions);
+    std::unique_ptr<PrefetchedPage> GetPrefetchedPage(const CPLString &osURL);
     CPLString AddFilters(const CPLString &osURL);
     CPLString BuildFilter(const swq_expr_node *poNode);
     CPLString BuildFilterCQLText(const swq_expr_node *poNode);
@@ -361,7 +401,8 @@ CPLString OGROAPIFDataset::ResolveURL(const CPLString &osURL,
 
 bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
                                CPLString &osResult, CPLString &osContentType,
-                               CPLStringList *paosHeaders)
+                               CPLStringList *paosHeaders,
+                               bool bUsePersistentSession)
 {
 #ifndef REMOVE_HACK
     VSIStatBufL sStatBuf;
@@ -391,9 +432,13 @@ bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
         papszOptions =
             CSLSetNameValue(papszOptions, "USERPWD", m_osUserPwd.c_str());
     }
-    m_bMustCleanPersistent = true;
-    papszOptions =
-        CSLAddString(papszOptions, CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    // The persistent session cannot be shared with worker threads
+    if (bUsePersistentSession)
+    {
+        m_bMustCleanPersistent = true;
+        papszOptions = CSLAddString(papszOptions,
+                                    CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    }
     CPLString osURLWithQueryParameters(osURL);
     if (!m_osUserQueryParams.empty() &&
         osURL.find('?' + m_osUserQueryParams) == std::string::npos &&
@@ -530,11 +575,13 @@ bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
 
 bool OGROAPIFDataset::DownloadJSon(const CPLString &osURL,
                                    CPLJSONDocument &oDoc, const char *pszAccept,
-                                   CPLStringList *paosHeaders)
+                                   CPLStringList *paosHeaders,
+                                   bool bUsePersistentSession)
 {
     CPLString osResult;
     CPLString osContentType;
-    if (!Download(osURL, pszAccept, osResult, osContentType, paosHeaders))
+    if (!Download(osURL, pszAccept, osResult, osContentType, paosHeaders,
+                  bUsePersistentSession))
         return false;
     return oDoc.LoadMemory(osResult);
 }
@@ -1154,6 +1201,10 @@ bool OGROAPIFDataset::Open(GDALOpenInfo *poOpenInfo)
     m_osDateTime =
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "DATETIME", "");
 
+    m_nPrefetchPages = std::max(0, atoi(CSLFetchNameValueDef(
+                                       poOpenInfo->papszOpenOptions,
+                                       "PREFETCH_PAGES", "0")));
+
     const int initialRequestPageSize = atoi(CSLFetchNameValueDef(
         poOpenInfo->papszOpenOptions, "INITIAL_REQUEST_PAGE_SIZE", "-1"));
 
@@ -1437,6 +1488,7 @@ OGROAPIFLayer::OGROAPIFLayer(OGROAPIFDataset *poDS, const CPLString &osName,
 
 OGROAPIFLayer::~OGROAPIFLayer()
 {
+    StopPrefetch();
     m_poFeatureDefn->Release();
 }
 
@@ -1967,6 +2019,7 @@ void OGROAPIFLayer::EstablishFeatureDefn()
 
 void OGROAPIFLayer::ResetReading()
 {
+    StopPrefetch();
     m_poUnderlyingDS.reset();
     m_poUnderlyingLayer = nullptr;
     m_nFID = 1;
@@ -2074,9 +2127,16 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
             const CPLString osURL(m_osGetURL);
             m_osGetURL.clear();
             CPLStringList aosHeaders;
-            if (!m_poDS->DownloadJSon(osURL, m_oCurDoc,
-                                      MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
-                                      &aosHeaders))
+            auto poPrefetchedPage = GetPrefetchedPage(osURL);
+            if (poPrefetchedPage)
+            {
+                m_oCurDoc = std::move(poPrefetchedPage->oDoc);
+                aosHeaders = std::move(poPrefetchedPage->aosHeaders);
+            }
+            else if (!m_poDS->DownloadJSon(osURL, m_oCurDoc,
+                                           MEDIA_TYPE_GEOJSON
+                                           ", " MEDIA_TYPE_JSON,
+                                           &aosHeaders))
             {
                 return nullptr;
             }
@@ -2137,14 +2197,22 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                 }
             }
 
-            const CPLString osTmpFilename(
-                VSIMemGenerateHiddenFilename("oapif.json"));
-            m_oCurDoc.Save(osTmpFilename);
-            m_poUnderlyingDS =
-                std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
-                    GDALOpenEx(osTmpFilename, GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
-                               nullptr, nullptr, nullptr)));
-            VSIUnlink(osTmpFilename);
+            if (poPrefetchedPage && poPrefetchedPage->poDS)
+            {
+                m_poUnderlyingDS = std::move(poPrefetchedPage->poDS);
+            }
+            else
+            {
+                const CPLString osTmpFilename(
+                    VSIMemGenerateHiddenFilename("oapif.json"));
+                m_oCurDoc.Save(osTmpFilename);
+                m_poUnderlyingDS =
+                    std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
+                        GDALOpenEx(osTmpFilename,
+                                   GDAL_OF_VECTOR | GDAL_OF_INTERNAL, nullptr,
+                                   nullptr, nullptr)));
+                VSIUnlink(osTmpFilename);
+            }
             if (!m_poUnderlyingDS.get())
             {
                 return nullptr;
@@ -2162,41 +2230,7 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
             // actually
             if (m_poUnderlyingLayer->GetFeatureCount() > 0 && m_osGetID.empty())
             {
-                CPLJSONArray oLinks = m_oCurDoc.GetRoot().GetArray("links");
-                if (oLinks.IsValid())
-                {
-                    int nCountRelNext = 0;
-                    std::string osNextURL;
-                    for (int i = 0; i < oLinks.Size(); i++)
-                    {
-                        CPLJSONObject oLink = oLinks[i];
-                        if (!oLink.IsValid() ||
-                            oLink.GetType() != CPLJSONObject::Type::Object)
-                        {
-                            continue;
-                        }
-                        if (EQUAL(oLink.GetString("rel").c_str(), "next"))
-                        {
-                            nCountRelNext++;
-                            auto type = oLink.GetString("type");
-                            if (type == MEDIA_TYPE_GEOJSON ||
-                                type == MEDIA_TYPE_JSON)
-                            {
-                                m_osGetURL = oLink.GetString("href");
-                                break;
-                            }
-                            else if (type.empty())
-                            {
-                                osNextURL = oLink.GetString("href");
-                            }
-                        }
-                    }
-                    if (nCountRelNext == 1 && m_osGetURL.empty())
-                    {
-                        // In case we go a "rel": "next" without a "type"
-                        m_osGetURL = std::move(osNextURL);
-                    }
-                }
+                m_osGetURL = GetNextPageURL(m_oCurDoc, osURL);
 
 #ifdef no_longer_used
                 // Recommendation /rec/core/link-header
@@ -2224,12 +2258,14 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                         }
                     }
                 }
-#endif
-
                 if (!m_osGetURL.empty())
                 {
                     m_osGetURL = m_poDS->ResolveURL(m_osGetURL, osURL);
                 }
+#endif
+
+                if (!m_osGetURL.empty() && m_poDS->m_nPrefetchPages > 0)
+                    StartPrefetch();
             }
         }
 
@@ -2289,6 +2325,214 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
     return poFeature;
 }
 
+/************************************************************************/
+/*                           GetNextPageURL()                           */
+/************************************************************************/
+
+// Returns the resolved URL of the "next" link of a page of features, or an
+// empty string. May be called from a worker thread.
+CPLString OGROAPIFLayer::GetNextPageURL(const CPLJSONDocument &oDoc,
+                                        const CPLString &osURL) const
+{
+    CPLString osRet;
+    CPLJSONArray oLinks = oDoc.GetRoot().GetArray("links");
+    if (oLinks.IsValid())
+    {
+        int nCountRelNext = 0;
+        std::string osNextURL;
+        for (int i = 0; i < oLinks.Size(); i++)
+        {
+            CPLJSONObject oLink = oLinks[i];
+            if (!oLink.IsValid() ||
+                oLink.GetType() != CPLJSONObject::Type::Object)
+            {
+                continue;
+            }
+            if (EQUAL(oLink.GetString("rel").c_str(), "next"))
+            {
+                nCountRelNext++;
+                auto type = oLink.GetString("type");
+                if (type == MEDIA_TYPE_GEOJSON || type == MEDIA_TYPE_JSON)
+                {
+                    osRet = oLink.GetString("href");
+                    break;
+                }
+                else if (type.empty())
+                {
+                    osNextURL = oLink.GetString("href");
+                }
+            }
+        }
+        if (nCountRelNext == 1 && osRet.empty())
+        {
+            // In case we go a "rel": "next" without a "type"
+            osRet = std::move(osNextURL);
+        }
+    }
+    if (!osRet.empty())
+    {
+        osRet = m_poDS->ResolveURL(osRet, osURL);
+    }
+    return osRet;
+}
+
+/************************************************************************/
+/*                           StartPrefetch()                            */
+/************************************************************************/
+
+// Make sure that the prefetching job runs, starting from m_osGetURL if no
+// page has been prefetched yet.
+void OGROAPIFLayer::StartPrefetch()
+{
+    {
+        std::lock_guard oLock(m_oPrefetch.oMutex);
+        if (m_oPrefetch.bRunning)
+            return;
+        if (m_oPrefetch.apoPages.empty())
+            m_oPrefetch.osNextURL = m_osGetURL;
+        if (m_oPrefetch.osNextURL.empty() ||
+            static_cast<int>(m_oPrefetch.apoPages.size()) >=
+                m_poDS->m_nPrefetchPages)
+        {
+            return;
+        }
+    }
+
+    if (!m_poPrefetchJobQueue)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(1);
+        if (!poThreadPool)
+            return;
+        m_poPrefetchJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    m_oPrefetch.bRunning = true;
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+    if (!m_poPrefetchJobQueue->SubmitJob(
+            [this, aosThreadLocalConfigOptions]()
+            { PrefetchJob(aosThreadLocalConfigOptions); }))
+    {
+        std::lock_guard oLock(m_oPrefetch.oMutex);
+        m_oPrefetch.bRunning = false;
+    }
+}
+
+/************************************************************************/
+/*                           StopPrefetch()                             */
+/************************************************************************/
+
+void OGROAPIFLayer::StopPrefetch()
+{
+    if (!m_poPrefetchJobQueue)
+        return;
+    {
+        std::lock_guard oLock(m_oPrefetch.oMutex);
+        m_oPrefetch.bStop = true;
+    }
+    m_poPrefetchJobQueue->WaitCompletion();
+    m_oPrefetch.apoPages.clear();
+    m_oPrefetch.osNextURL.clear();
+    m_oPrefetch.bRunning = false;
+    m_oPrefetch.bStop = false;
+}
+
+/************************************************************************/
+/*                            PrefetchJob()                             */
+/************************************************************************/
+
+// Runs in a worker thread. Downloads and opens pages by following "next"
+// links, until m_nPrefetchPages pages are waiting to be consumed.
+// Errors are silenced: if a page cannot be prefetched, the main thread will
+// download it again and report the error.
+void OGROAPIFLayer::PrefetchJob(
+    const CPLStringList &aosThreadLocalConfigOptions)
+{
+    CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    while (true)
+    {
+        CPLString osURL;
+        {
+            std::lock_guard oLock(m_oPrefetch.oMutex);
+            if (m_oPrefetch.bStop || m_oPrefetch.osNextURL.empty() ||
+                static_cast<int>(m_oPrefetch.apoPages.size()) >=
+                    m_poDS->m_nPrefetchPages)
+            {
+                m_oPrefetch.bRunning = false;
+                m_oPrefetch.oCV.notify_one();
+                CPLSetThreadLocalConfigOptions(nullptr);
+                return;
+            }
+            osURL = m_oPrefetch.osNextURL;
+        }
+
+        auto poPage = std::make_unique<PrefetchedPage>();
+        poPage->osURL = osURL;
+        CPLString osNextURL;
+        if (m_poDS->DownloadJSon(osURL, poPage->oDoc,
+                                 MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
+                                 &poPage->aosHeaders,
+                                 /* bUsePersistentSession = */ false))
+        {
+            poPage->bOK = true;
+            const CPLString osTmpFilename(
+                VSIMemGenerateHiddenFilename("oapif.json"));
+            poPage->oDoc.Save(osTmpFilename);
+            poPage->poDS.reset(GDALDataset::FromHandle(
+                GDALOpenEx(osTmpFilename, GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
+                           nullptr, nullptr, nullptr)));
+            VSIUnlink(osTmpFilename);
+            if (poPage->oDoc.GetRoot().GetArray("features").Size() > 0)
+                osNextURL = GetNextPageURL(poPage->oDoc, osURL);
+        }
+
+        std::lock_guard oLock(m_oPrefetch.oMutex);
+        m_oPrefetch.apoPages.push_back(std::move(poPage));
+        m_oPrefetch.osNextURL = std::move(osNextURL);
+        m_oPrefetch.oCV.notify_one();
+    }
+}
+
+/************************************************************************/
+/*                         GetPrefetchedPage()                          */
+/************************************************************************/
+
+// Returns the prefetched page for osURL, waiting for it if it is being
+// downloaded, or nullptr if it has not been prefetched.
+std::unique_ptr<OGROAPIFLayer::PrefetchedPage>
+OGROAPIFLayer::GetPrefetchedPage(const CPLString &osURL)
+{
+    if (!m_poPrefetchJobQueue)
+        return nullptr;
+
+    std::unique_ptr<PrefetchedPage> poPage;
+    {
+        std::unique_lock oLock(m_oPrefetch.oMutex);
+        m_oPrefetch.oCV.wait(oLock,
+                             [this]
+                             {
+                                 return !m_oPrefetch.apoPages.empty() ||
+                                        !m_oPrefetch.bRunning;
+                             });
+        if (!m_oPrefetch.apoPages.empty())
+        {
+            poPage = std::move(m_oPrefetch.apoPages.front());
+            m_oPrefetch.apoPages.pop_front();
+        }
+    }
+
+    if (poPage && poPage->bOK && poPage->osURL == osURL)
+    {
+        return poPage;
+    }
+
+    // The prefetched pages do not follow the expected sequence, or the
+    // download failed: discard them.
+    StopPrefetch();
+    return nullptr;
+}
+
 /************************************************************************/
 /*                            GetFeature()                              */
 /************************************************************************/
@@ -3261,6 +3505,9 @@ void RegisterOGROAPIF()
         "  <Option name='INITIAL_REQUEST_PAGE_SIZE' type='int' "
         "description='Maximum number of features to retrieve in the initial "
         "request issued to determine the schema from a feature sample'/>"
+        "  <Option name='PREFETCH_PAGES' type='int' "
+        "description='Number of pages of features to fetch ahead in a "
+        "background thread' default='0'/>"
         "  <Option name='USERPWD' type='string' "
         "description='Basic authentication as username:password'/>"
         "  <Option name='IGNORE_SCHEMA' type='boolean' "
@@ -40,6 +40,15 @@ class CPL_DLL OGRAttrIndex
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
 
     virtual OGRErr Clear() = 0;
+
+    virtual bool SupportsRangeMatches() const;
+
+    // psMin and/or psMax may be nullptr for an unbounded side of the range.
+    // The returned list follows the conventions of GetAllMatches().
+    virtual GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                                     const OGRField *psMax, bool bMaxIncluded,
+                                     GIntBig *panFIDList, int *nFIDCount,
+                                     int *nLength);
 };
 
 /************************************************************************/
@@ -74,6 +83,7 @@ class CPL_DLL OGRLayerAttrIndex
 };
 
 OGRLayerAttrIndex CPL_DLL *OGRCreateDefaultLayerIndex();
+OGRLayerAttrIndex CPL_DLL *OGRCreateMemoryLayerIndex();
 
 //! @endcond
 
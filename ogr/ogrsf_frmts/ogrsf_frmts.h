@@ -212,6 +212,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual bool FillNextFeature(OGRFeature &oFeature);
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
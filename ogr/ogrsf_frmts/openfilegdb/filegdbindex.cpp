@@ -150,6 +150,7 @@ class FileGDBNotIterator final : public FileGDBIterator
     virtual void Reset() override;
     virtual int64_t GetNextRowSortedByFID() override;
     virtual int64_t GetRowCount() override;
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap) override;
 };
 
 /************************************************************************/
@@ -179,6 +180,7 @@ class FileGDBAndIterator final : public FileGDBIterator
 
     virtual void Reset() override;
     virtual int64_t GetNextRowSortedByFID() override;
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap) override;
 };
 
 /************************************************************************/
@@ -210,6 +212,47 @@ class FileGDBOrIterator final : public FileGDBIterator
     virtual void Reset() override;
     virtual int64_t GetNextRowSortedByFID() override;
     virtual int64_t GetRowCount() override;
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap) override;
+};
+
+/************************************************************************/
+/*                        FileGDBBitmapIterator                         */
+/************************************************************************/
+
+class FileGDBBitmapIterator final : public FileGDBIterator
+{
+    FileGDBIterator *poIterBase = nullptr;
+    std::vector<uint64_t> m_anBitmap{};
+    bool m_bBitmapBuilt = false;
+    int64_t m_iRow = 0;
+    int64_t m_nRowCount = -1;
+
+    void BuildBitmapIfNeeded();
+
+    FileGDBBitmapIterator(const FileGDBBitmapIterator &) = delete;
+    FileGDBBitmapIterator &operator=(const FileGDBBitmapIterator &) = delete;
+
+  public:
+    explicit FileGDBBitmapIterator(FileGDBIterator *poIterBase);
+
+    virtual ~FileGDBBitmapIterator()
+    {
+        delete poIterBase;
+    }
+
+    virtual FileGDBTable *GetTable() override
+    {
+        return poIterBase->GetTable();
+    }
+
+    virtual void Reset() override
+    {
+        m_iRow = 0;
+    }
+
+    virtual int64_t GetNextRowSortedByFID() override;
+    virtual int64_t GetRowCount() override;
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap) override;
 };
 
 /************************************************************************/
@@ -362,6 +405,7 @@ class FileGDBIndexIterator final : public FileGDBIndexIteratorBase
     virtual int64_t GetNextRowSortedByFID() override;
     virtual int64_t GetRowCount() override;
     virtual void Reset() override;
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap) override;
 
     virtual int64_t GetNextRowSortedByValue() override
     {
@@ -487,6 +531,15 @@ FileGDBIterator *FileGDBIterator::BuildOr(FileGDBIterator *poIter1,
     return new FileGDBOrIterator(poIter1, poIter2, bIteratorAreExclusive);
 }
 
+/************************************************************************/
+/*                           BuildBitmap()                              */
+/************************************************************************/
+
+FileGDBIterator *FileGDBIterator::BuildBitmap(FileGDBIterator *poIterBase)
+{
+    return new FileGDBBitmapIterator(poIterBase);
+}
+
 /************************************************************************/
 /*                           GetRowCount()                              */
 /************************************************************************/
@@ -501,6 +554,36 @@ int64_t FileGDBIterator::GetRowCount()
     return nCount;
 }
 
+/************************************************************************/
+/*                           SetBitInBitmap()                           */
+/************************************************************************/
+
+static inline void SetBitInBitmap(std::vector<uint64_t> &anBitmap,
+                                  int64_t nRow)
+{
+    const uint64_t nWord = static_cast<uint64_t>(nRow) / 64;
+    if (nWord < anBitmap.size())
+        anBitmap[static_cast<size_t>(nWord)] |= static_cast<uint64_t>(1)
+                                                 << (nRow % 64);
+}
+
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    Reset();
+    while (true)
+    {
+        const int64_t nRow = GetNextRowSortedByFID();
+        if (nRow < 0)
+            break;
+        SetBitInBitmap(anBitmap, nRow);
+    }
+    Reset();
+}
+
 /************************************************************************/
 /*                         FileGDBTrivialIterator()                     */
 /************************************************************************/
@@ -600,6 +683,42 @@ int64_t FileGDBNotIterator::GetRowCount()
     return poTable->GetValidRecordCount() - poIterBase->GetRowCount();
 }
 
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBNotIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    std::vector<uint64_t> anBitmapBase(anBitmap.size());
+    poIterBase->AddRowsToBitmap(anBitmapBase);
+
+    const int64_t nTotalRecordCount = poTable->GetTotalRecordCount();
+    if (bNoHoles)
+    {
+        for (size_t i = 0; i < anBitmap.size(); ++i)
+            anBitmap[i] |= ~anBitmapBase[i];
+        // Clear the bits after the last row
+        if ((nTotalRecordCount % 64) != 0 && !anBitmap.empty())
+        {
+            anBitmap.back() &=
+                (static_cast<uint64_t>(1) << (nTotalRecordCount % 64)) - 1;
+        }
+    }
+    else
+    {
+        for (int64_t iRowIter = 0; iRowIter < nTotalRecordCount; ++iRowIter)
+        {
+            const size_t iWord = static_cast<size_t>(iRowIter / 64);
+            if ((anBitmapBase[iWord] >> (iRowIter % 64)) & 1)
+                continue;
+            if (poTable->GetOffsetInTableForRow(iRowIter))
+                anBitmap[iWord] |= static_cast<uint64_t>(1) << (iRowIter % 64);
+            else if (poTable->HasGotError())
+                break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                          FileGDBAndIterator()                        */
 /************************************************************************/
@@ -673,6 +792,20 @@ int64_t FileGDBAndIterator::GetNextRowSortedByFID()
     }
 }
 
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBAndIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    std::vector<uint64_t> anBitmap1(anBitmap.size());
+    poIter1->AddRowsToBitmap(anBitmap1);
+    std::vector<uint64_t> anBitmap2(anBitmap.size());
+    poIter2->AddRowsToBitmap(anBitmap2);
+    for (size_t i = 0; i < anBitmap.size(); ++i)
+        anBitmap[i] |= anBitmap1[i] & anBitmap2[i];
+}
+
 /************************************************************************/
 /*                          FileGDBOrIterator()                         */
 /************************************************************************/
@@ -762,6 +895,116 @@ int64_t FileGDBOrIterator::GetRowCount()
         return FileGDBIterator::GetRowCount();
 }
 
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBOrIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    poIter1->AddRowsToBitmap(anBitmap);
+    poIter2->AddRowsToBitmap(anBitmap);
+}
+
+/************************************************************************/
+/*                        FileGDBBitmapIterator()                       */
+/************************************************************************/
+
+FileGDBBitmapIterator::FileGDBBitmapIterator(FileGDBIterator *poIterBaseIn)
+    : poIterBase(poIterBaseIn)
+{
+}
+
+/************************************************************************/
+/*                         BuildBitmapIfNeeded()                        */
+/************************************************************************/
+
+void FileGDBBitmapIterator::BuildBitmapIfNeeded()
+{
+    if (m_bBitmapBuilt)
+        return;
+    m_bBitmapBuilt = true;
+
+    const int64_t nTotalRecordCount = GetTable()->GetTotalRecordCount();
+    try
+    {
+        m_anBitmap.resize(static_cast<size_t>((nTotalRecordCount + 63) / 64));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate bitmap for " CPL_FRMT_GIB " rows",
+                 static_cast<GIntBig>(nTotalRecordCount));
+        m_nRowCount = 0;
+        return;
+    }
+    poIterBase->AddRowsToBitmap(m_anBitmap);
+}
+
+/************************************************************************/
+/*                        GetNextRowSortedByFID()                       */
+/************************************************************************/
+
+int64_t FileGDBBitmapIterator::GetNextRowSortedByFID()
+{
+    BuildBitmapIfNeeded();
+
+    size_t iWord = static_cast<size_t>(m_iRow / 64);
+    while (iWord < m_anBitmap.size())
+    {
+        // Bits of the rows >= m_iRow in the current word
+        const uint64_t nWord = m_anBitmap[iWord] >> (m_iRow % 64);
+        if (nWord == 0)
+        {
+            ++iWord;
+            m_iRow = static_cast<int64_t>(iWord) * 64;
+            continue;
+        }
+        int nBit = 0;
+        while (((nWord >> nBit) & 1) == 0)
+            ++nBit;
+        const int64_t nRet = m_iRow + nBit;
+        m_iRow = nRet + 1;
+        return nRet;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                           GetRowCount()                              */
+/************************************************************************/
+
+int64_t FileGDBBitmapIterator::GetRowCount()
+{
+    BuildBitmapIfNeeded();
+
+    if (m_nRowCount < 0)
+    {
+        m_nRowCount = 0;
+        for (uint64_t nWord : m_anBitmap)
+        {
+            while (nWord)
+            {
+                nWord &= nWord - 1;
+                ++m_nRowCount;
+            }
+        }
+    }
+    return m_nRowCount;
+}
+
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBBitmapIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    BuildBitmapIfNeeded();
+
+    const size_t nWords = std::min(anBitmap.size(), m_anBitmap.size());
+    for (size_t i = 0; i < nWords; ++i)
+        anBitmap[i] |= m_anBitmap[i];
+}
+
 /************************************************************************/
 /*                     FileGDBIndexIteratorBase()                       */
 /************************************************************************/
@@ -2040,6 +2283,35 @@ int64_t FileGDBIndexIterator::GetRowCount()
     return nRowCount;
 }
 
+/************************************************************************/
+/*                          AddRowsToBitmap()                           */
+/************************************************************************/
+
+void FileGDBIndexIterator::AddRowsToBitmap(std::vector<uint64_t> &anBitmap)
+{
+    if (nSortedCount >= 0)
+    {
+        for (int i = 0; i < nSortedCount; ++i)
+            SetBitInBitmap(anBitmap, panSortedRows[i]);
+        Reset();
+        return;
+    }
+
+    // No need to sort the rows by FID
+    const bool bSaveAscending = bAscending;
+    bAscending = true; /* for a tiny bit of more efficiency */
+    Reset();
+    while (true)
+    {
+        const int64_t nRow = GetNextRow();
+        if (nRow < 0)
+            break;
+        SetBitInBitmap(anBitmap, nRow);
+    }
+    bAscending = bSaveAscending;
+    Reset();
+}
+
 /************************************************************************/
 /*                            GetMinMaxValue()                          */
 /************************************************************************/
@@ -719,6 +719,11 @@ class FileGDBTable
         return m_nCurRow;
     }
 
+    GUInt32 GetCurRowBlobLength() const
+    {
+        return m_nRowBlobLength;
+    }
+
     bool IsCurRowDeleted() const
     {
         return m_bIsDeleted;
@@ -790,6 +795,11 @@ class FileGDBIterator
     virtual int64_t GetNextRowSortedByFID() = 0;
     virtual int64_t GetRowCount();
 
+    /* Sets the bit of the selected rows in a bitmap of
+     * (GetTable()->GetTotalRecordCount() + 63) / 64 words, where row i is
+     * bit (i % 64) of word i / 64. Will reset the iterator */
+    virtual void AddRowsToBitmap(std::vector<uint64_t> &anBitmap);
+
     /* Only available on a BuildIsNotNull() iterator */
     virtual const OGRField *GetMinValue(int &eOutOGRFieldType);
     virtual const OGRField *GetMaxValue(int &eOutOGRFieldType);
@@ -813,6 +823,9 @@ class FileGDBIterator
     static FileGDBIterator *BuildOr(FileGDBIterator *poIter1,
                                     FileGDBIterator *poIter2,
                                     int bIteratorAreExclusive = FALSE);
+    /* Evaluates poIterBase into a bitmap of the rows of the table. Takes
+     * ownership of poIterBase */
+    static FileGDBIterator *BuildBitmap(FileGDBIterator *poIterBase);
 };
 
 /************************************************************************/
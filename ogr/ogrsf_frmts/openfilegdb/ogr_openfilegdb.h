@@ -141,6 +141,10 @@ class OGROpenFileGDBLayer final : public OGRLayer
     int BuildLayerDefinition();
     int BuildGeometryColumnGDBv10(const std::string &osParentDefinition);
     OGRFeature *GetCurrentFeature();
+    void AddToSpatialIndexInBuilding(const OGRField *psField, int64_t iRow);
+    static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom);
+
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
 
     std::unique_ptr<FileGDBOGRGeometryConverter> m_poGeomConverter{};
 
@@ -263,6 +267,8 @@ class OGROpenFileGDBLayer final : public OGRLayer
     virtual OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     virtual GIntBig GetFeatureCount(int bForce = TRUE) override;
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
@@ -280,6 +286,9 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     virtual int TestCapability(const char *) override;
 
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     virtual OGRErr Rename(const char *pszNewName) override;
 
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
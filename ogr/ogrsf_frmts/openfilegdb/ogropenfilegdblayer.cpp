@@ -38,6 +38,8 @@
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 
 OGROpenFileGDBGeomFieldDefn::~OGROpenFileGDBGeomFieldDefn() = default;
 
@@ -1692,6 +1694,18 @@ OGRErr OGROpenFileGDBLayer::SetAttributeFilter(const char *pszFilter)
         if (m_poAttributeIterator != nullptr &&
             m_eSpatialIndexState == SPI_IN_BUILDING)
             m_eSpatialIndexState = SPI_INVALID;
+
+        // For AND / OR trees and IN lists, evaluate the indexes into a
+        // bitmap, which avoids sorting by FID the rows of each index
+        // iterator, and merging them through a deep chain of iterators.
+        if (m_poAttributeIterator != nullptr &&
+            poNode->eNodeType == SNT_OPERATION &&
+            (poNode->nOperation == SWQ_AND || poNode->nOperation == SWQ_OR ||
+             (poNode->nOperation == SWQ_IN && poNode->nSubExprCount > 2)))
+        {
+            m_poAttributeIterator =
+                FileGDBIterator::BuildBitmap(m_poAttributeIterator);
+        }
         if (m_bIteratorSufficientToEvaluateFilter < 0)
             m_bIteratorSufficientToEvaluateFilter = FALSE;
     }
@@ -1719,6 +1733,67 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                     AddToSpatialIndexInBuilding()                   */
+/***********************************************************************/
+
+void OGROpenFileGDBLayer::AddToSpatialIndexInBuilding(const OGRField *psField,
+                                                      int64_t iRow)
+{
+    OGREnvelope sFeatureEnvelope;
+    if (m_poLyrTable->GetFeatureExtent(psField, &sFeatureEnvelope))
+    {
+#if SIZEOF_VOIDP < 8
+        if (iRow > INT32_MAX)
+        {
+            // m_pQuadTree stores iRow values as void*
+            // This would overflow here.
+            m_eSpatialIndexState = SPI_INVALID;
+        }
+        else
+#endif
+        {
+            CPLRectObj sBounds;
+            sBounds.minx = sFeatureEnvelope.MinX;
+            sBounds.miny = sFeatureEnvelope.MinY;
+            sBounds.maxx = sFeatureEnvelope.MaxX;
+            sBounds.maxy = sFeatureEnvelope.MaxY;
+            CPLQuadTreeInsertWithBounds(
+                m_pQuadTree,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(iRow)),
+                &sBounds);
+        }
+    }
+}
+
+/***********************************************************************/
+/*                       PromoteToMultiGeometry()                      */
+/***********************************************************************/
+
+/* Layers of polygons or lines are advertized as multi geometries */
+/* static */
+OGRGeometry *OGROpenFileGDBLayer::PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    OGRwkbGeometryType eFlattenType = wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1746,34 +1821,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
             if (psField != nullptr)
             {
                 if (m_eSpatialIndexState == SPI_IN_BUILDING)
-                {
-                    OGREnvelope sFeatureEnvelope;
-                    if (m_poLyrTable->GetFeatureExtent(psField,
-                                                       &sFeatureEnvelope))
-                    {
-#if SIZEOF_VOIDP < 8
-                        if (iRow > INT32_MAX)
-                        {
-                            // m_pQuadTree stores iRow values as void*
-                            // This would overflow here.
-                            m_eSpatialIndexState = SPI_INVALID;
-                        }
-                        else
-#endif
-                        {
-                            CPLRectObj sBounds;
-                            sBounds.minx = sFeatureEnvelope.MinX;
-                            sBounds.miny = sFeatureEnvelope.MinY;
-                            sBounds.maxx = sFeatureEnvelope.MaxX;
-                            sBounds.maxy = sFeatureEnvelope.MaxY;
-                            CPLQuadTreeInsertWithBounds(
-                                m_pQuadTree,
-                                reinterpret_cast<void *>(
-                                    static_cast<uintptr_t>(iRow)),
-                                &sBounds);
-                        }
-                    }
-                }
+                    AddToSpatialIndexInBuilding(psField, iRow);
 
                 if (m_poFilterGeom != nullptr &&
                     m_eSpatialIndexState != SPI_COMPLETED &&
@@ -1787,26 +1835,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -1979,6 +2008,365 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                        GetNextArrowArray()                          */
+/***********************************************************************/
+
+// Specialized implementation restricted to sequential reading without
+// filters. Values of the row blobs are directly written into the Arrow
+// buffers, without going through OGRFeature.
+// In other cases, fall back to generic implementation.
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!BuildLayerDefinition())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    if (m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        m_nFilteredFeatureCount >= 0 || m_iFieldToReadAsBinary >= 0 ||
+        m_iFIDAsRegularColumnIndex >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                               false))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    // If any requested field is not of a type handled below, use generic
+    // implementation
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTInt16)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                if (!poFieldDefn->GetDomainName().empty())
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTReal:
+                if (eSubType != OFSTNone && eSubType != OFSTFloat32)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTInteger64:
+            case OFTString:
+            case OFTBinary:
+            case OFTDate:
+            case OFTDateTime:
+                if (eSubType != OFSTNone)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            default:
+                return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
+    }
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    if (sHelper.m_nChildren == 0)
+    {
+        out_array->release(out_array);
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    if (m_bEOF)
+    {
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        return 0;
+    }
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    // Pairs of (FileGDB field index, OGR field index) of requested fields
+    std::vector<std::pair<int, int>> anRequestedFields;
+    {
+        int iOGRIdx = 0;
+        for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount();
+             iGDBIdx++)
+        {
+            if (iGDBIdx == m_iGeomFieldIdx ||
+                iGDBIdx == m_poLyrTable->GetObjectIdFieldIdx())
+                continue;
+            if (sHelper.m_mapOGRFieldToArrowField[iOGRIdx] >= 0)
+                anRequestedFields.emplace_back(iGDBIdx, iOGRIdx);
+            iOGRIdx++;
+        }
+    }
+
+    const int iGeomArrowField =
+        m_iGeomFieldIdx >= 0 ? sHelper.m_mapOGRGeomFieldToArrowField[0] : -1;
+    if (iGeomArrowField < 0 && m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+    const bool bGeomNullable =
+        m_iGeomFieldIdx >= 0 &&
+        m_poFeatureDefn->GetGeomFieldDefn(0)->IsNullable();
+    std::unique_ptr<OGRGeometry> poEmptyGeom;
+    if (iGeomArrowField >= 0 && !bGeomNullable)
+    {
+        const auto eGeomType = m_poFeatureDefn->GetGeomType();
+        poEmptyGeom.reset(OGRGeometryFactory::createGeometry(
+            wkbFlatten(eGeomType) == wkbUnknown ? wkbGeometryCollection
+                                                : eGeomType));
+    }
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int nCount = 0;
+    while (nCount < sHelper.m_nMaxBatchSize &&
+           m_iCurFeat < m_poLyrTable->GetTotalRecordCount())
+    {
+        const int64_t iRow =
+            m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+        if (iRow < 0)
+        {
+            m_bEOF = TRUE;
+            break;
+        }
+
+        std::unique_ptr<OGRGeometry> poGeom;
+        const OGRField *psGeomField = nullptr;
+        if (iGeomArrowField >= 0)
+        {
+            psGeomField = m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if (psGeomField)
+            {
+                OGRGeometry *poRawGeom =
+                    m_poGeomConverter->GetAsGeometry(psGeomField);
+                if (poRawGeom)
+                    poGeom.reset(PromoteToMultiGeometry(poRawGeom));
+            }
+        }
+        const OGRGeometry *poGeomToWrite =
+            poGeom ? poGeom.get() : bGeomNullable ? nullptr : poEmptyGeom.get();
+        const size_t nWKBSize = poGeomToWrite ? poGeomToWrite->WkbSize() : 0;
+
+        // Stop before this row if its strings, binaries or geometry could
+        // make the batch exceed the memory limit. It will be returned by next
+        // call.
+        if (nCount > 0)
+        {
+            // Strings in UTF-16 may need up to 1.5 times more bytes once
+            // recoded to UTF-8
+            const uint64_t nMaxValueSize =
+                2 * static_cast<uint64_t>(m_poLyrTable->GetCurRowBlobLength());
+            bool bStop = false;
+            if (iGeomArrowField >= 0)
+            {
+                const auto panOffsets = static_cast<const int32_t *>(
+                    out_array->children[iGeomArrowField]->buffers[1]);
+                bStop = nWKBSize + panOffsets[nCount] > nMemLimit;
+            }
+            for (const auto &[iGDBIdx, iOGRIdx] : anRequestedFields)
+            {
+                if (bStop)
+                    break;
+                const auto eType =
+                    m_poFeatureDefn->GetFieldDefn(iOGRIdx)->GetType();
+                if (eType != OFTString && eType != OFTBinary)
+                    continue;
+                const int iArrowField =
+                    sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+                const auto panOffsets = static_cast<const int32_t *>(
+                    out_array->children[iArrowField]->buffers[1]);
+                bStop = nMaxValueSize + panOffsets[nCount] > nMemLimit;
+            }
+            if (bStop)
+            {
+                m_iCurFeat = iRow;
+                break;
+            }
+        }
+
+        m_iCurFeat = iRow + 1;
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[nCount] = iRow + 1;
+
+        if (iGeomArrowField >= 0)
+        {
+            if (psGeomField && m_eSpatialIndexState == SPI_IN_BUILDING)
+                AddToSpatialIndexInBuilding(psGeomField, iRow);
+
+            if (poGeomToWrite)
+            {
+                GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, nCount, nWKBSize);
+                if (!pabyDst)
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+                poGeomToWrite->exportToWkb(wkbNDR, pabyDst, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iGeomArrowField, nCount))
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+        }
+
+        for (const auto &[iGDBIdx, iOGRIdx] : anRequestedFields)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+            struct ArrowArray *psArray = out_array->children[iArrowField];
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iOGRIdx);
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                if (m_poLyrTable->HasGotError())
+                {
+                    sHelper.ClearArray();
+                    m_bEOF = TRUE;
+                    return EIO;
+                }
+                if (!sHelper.SetNull(iArrowField, nCount))
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+                continue;
+            }
+
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTInt16)
+                        OGRArrowArrayHelper::SetInt16(
+                            psArray, nCount,
+                            static_cast<int16_t>(psField->Integer));
+                    else
+                        OGRArrowArrayHelper::SetInt32(psArray, nCount,
+                                                      psField->Integer);
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    OGRArrowArrayHelper::SetInt64(psArray, nCount,
+                                                  psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                        OGRArrowArrayHelper::SetFloat(
+                            psArray, nCount, static_cast<float>(psField->Real));
+                    else
+                        OGRArrowArrayHelper::SetDouble(psArray, nCount,
+                                                       psField->Real);
+                    break;
+                }
+
+                case OFTString:
+                {
+                    const size_t nLen = strlen(psField->String);
+                    GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, nCount, nLen);
+                    if (!pabyDst)
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    memcpy(pabyDst, psField->String, nLen);
+                    break;
+                }
+
+                case OFTBinary:
+                {
+                    const size_t nLen = psField->Binary.nCount;
+                    GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, nCount, nLen);
+                    if (!pabyDst)
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    if (nLen)
+                        memcpy(pabyDst, psField->Binary.paData, nLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    OGRArrowArrayHelper::SetDate(psArray, nCount, brokenDown,
+                                                 *psField);
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    OGRArrowArrayHelper::SetDateTime(
+                        psArray, nCount, brokenDown,
+                        sHelper.m_anTZFlags[iOGRIdx], sField);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        ++nCount;
+    }
+
+    if (m_eSpatialIndexState == SPI_IN_BUILDING &&
+        m_iCurFeat == m_poLyrTable->GetTotalRecordCount())
+    {
+        CPLDebug("OpenFileGDB", "SPI_COMPLETED");
+        m_eSpatialIndexState = SPI_COMPLETED;
+    }
+
+    sHelper.Shrink(nCount);
+    if (nCount == 0)
+    {
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+    }
+    return 0;
+}
+
+/***********************************************************************/
+/*                         GetMetadataItem()                           */
+/***********************************************************************/
+
+const char *OGROpenFileGDBLayer::GetMetadataItem(const char *pszName,
+                                                 const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -2340,6 +2728,10 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
     {
         return TRUE; /* ? */
     }
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+    }
 
     else if (EQUAL(pszCap, OLCMeasuredGeometries))
         return TRUE;
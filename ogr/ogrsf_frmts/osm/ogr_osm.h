@@ -409,6 +409,16 @@ class OGROSMDataSource final : public GDALDataset
 
     std::vector<LonLat> m_asLonLatCache{};
 
+    // Maximum number of threads used to resolve the nodes of ways
+    int m_nNumThreads = 1;
+
+    // Resolved coordinates of the nodes of the ways of m_asWayFeaturePairs.
+    // The coordinates of the i-th way are the m_anWayLonLatCount[i] values
+    // starting at m_asWayLonLat[m_anWayLonLatOffset[i]]
+    std::vector<LonLat> m_asWayLonLat{};
+    std::vector<size_t> m_anWayLonLatOffset{};
+    std::vector<unsigned int> m_anWayLonLatCount{};
+
     std::array<const char *, 7> m_ignoredKeys = {{"area", "created_by",
                                                   "converted_by", "note",
                                                   "todo", "fixme", "FIXME"}};
@@ -528,7 +538,9 @@ class OGROSMDataSource final : public GDALDataset
     bool StartTransactionCacheDB();
     bool CommitTransactionCacheDB();
 
-    int FindNode(GIntBig nID);
+    int FindNode(GIntBig nID) const;
+    unsigned int ResolveWayNodes(const WayFeaturePair &sWayFeaturePairs,
+                                 LonLat *pasLonLat) const;
     void ProcessWaysBatch();
 
     void ProcessPolygonsStandalone();
@@ -536,8 +548,13 @@ class OGROSMDataSource final : public GDALDataset
     void LookupNodes();
     void LookupNodesSQLite();
     void LookupNodesCustom();
-    void LookupNodesCustomCompressedCase();
-    void LookupNodesCustomNonCompressedCase();
+    unsigned int
+    LookupNodesCustomCompressedCase(unsigned int iStart, unsigned int iEnd,
+                                    bool bUsePRead,
+                                    std::vector<std::string> &aosErrors) const;
+    unsigned int LookupNodesCustomNonCompressedCase(
+        unsigned int iStart, unsigned int iEnd, bool bUsePRead,
+        std::vector<std::string> &aosErrors) const;
 
     unsigned int
     LookupWays(std::map<GIntBig, std::pair<int, void *>> &aoMapWays,
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -40,6 +41,8 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -977,6 +980,82 @@ static bool DecompressSector(const GByte *pabyIn, int nSectorSize,
     return nRead == nSectorSize;
 }
 
+/************************************************************************/
+/*                           ReadNodesFile()                            */
+/************************************************************************/
+
+// Read nSize bytes at nOffset of the nodes file. Positional reads do not
+// change the file position, and may thus be issued by several threads.
+static size_t ReadNodesFile(VSILFILE *fp, bool bUsePRead, void *pBuffer,
+                            size_t nSize, vsi_l_offset nOffset)
+{
+    if (bUsePRead)
+    {
+        const size_t nRead = fp->PRead(pBuffer, nSize, nOffset);
+        return nRead <= nSize ? nRead : 0;
+    }
+    if (VSIFSeekL(fp, nOffset, SEEK_SET) != 0)
+        return 0;
+    return VSIFReadL(pBuffer, 1, nSize, fp);
+}
+
+/************************************************************************/
+/*                           SplitInRanges()                            */
+/************************************************************************/
+
+// Split [0, nItems[ in at most nMaxRanges contiguous ranges of at least
+// nMinItemsPerRange items (except if there are fewer items).
+static std::vector<std::pair<size_t, size_t>>
+SplitInRanges(size_t nItems, size_t nMinItemsPerRange, int nMaxRanges)
+{
+    const size_t nRanges = std::max<size_t>(
+        1, std::min<size_t>(std::max(1, nMaxRanges),
+                            nItems / std::max<size_t>(1, nMinItemsPerRange)));
+    std::vector<std::pair<size_t, size_t>> aoRanges;
+    for (size_t i = 0; i < nRanges; ++i)
+    {
+        aoRanges.emplace_back(i * nItems / nRanges,
+                              (i + 1) * nItems / nRanges);
+    }
+    return aoRanges;
+}
+
+/************************************************************************/
+/*                        RunInWorkerThreads()                          */
+/************************************************************************/
+
+// Call job(i) for i in [0, nJobs[, using the global thread pool when there
+// are several jobs.
+static void RunInWorkerThreads(size_t nJobs, int nMaxThreads,
+                               const std::function<void(size_t)> &job)
+{
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (nJobs > 1 && nMaxThreads > 1)
+    {
+        poThreadReservation = std::make_unique<GDALThreadReservation>(
+            static_cast<int>(std::min<size_t>(nJobs, nMaxThreads)));
+        if (poThreadReservation->GetThreadCount() > 1)
+            poThreadPool = GDALGetGlobalThreadPool(
+                poThreadReservation->GetThreadCount());
+    }
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (size_t i = 0; i < nJobs; ++i)
+        {
+            if (!poJobQueue->SubmitJob([&job, i]() { job(i); }))
+                job(i);
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (size_t i = 0; i < nJobs; ++i)
+            job(i);
+    }
+}
+
 /************************************************************************/
 /*                           LookupNodesCustom()                        */
 /************************************************************************/
@@ -1052,10 +1131,51 @@ void OGROSMDataSource::LookupNodesCustom()
         pasLonLatArray[i].nLat = 0;
     }
 #else
-    if (m_bCompressNodes)
-        LookupNodesCustomCompressedCase();
-    else
-        LookupNodesCustomNonCompressedCase();
+    // The sorted identifiers are split into ranges that are resolved by
+    // worker threads. Each thread reads the nodes file with positional reads,
+    // and compacts the nodes it has found at the beginning of its range.
+    constexpr size_t MIN_NODES_PER_JOB = 50000;
+    auto aoRanges =
+        SplitInRanges(m_nReqIds, MIN_NODES_PER_JOB,
+                      m_fpNodes->HasPRead() ? m_nNumThreads : 1);
+    const bool bUsePRead = aoRanges.size() > 1;
+    if (bUsePRead)
+        VSIFFlushL(m_fpNodes);
+
+    std::vector<unsigned int> anFound(aoRanges.size());
+    std::vector<std::vector<std::string>> aaosErrors(aoRanges.size());
+    RunInWorkerThreads(
+        aoRanges.size(), m_nNumThreads,
+        [this, &aoRanges, &anFound, &aaosErrors, bUsePRead](size_t iRange)
+        {
+            const auto iStart =
+                static_cast<unsigned int>(aoRanges[iRange].first);
+            const auto iEnd =
+                static_cast<unsigned int>(aoRanges[iRange].second);
+            anFound[iRange] =
+                m_bCompressNodes
+                    ? LookupNodesCustomCompressedCase(iStart, iEnd, bUsePRead,
+                                                      aaosErrors[iRange])
+                    : LookupNodesCustomNonCompressedCase(
+                          iStart, iEnd, bUsePRead, aaosErrors[iRange]);
+        });
+
+    j = 0;
+    for (size_t iRange = 0; iRange < aoRanges.size(); ++iRange)
+    {
+        for (const auto &osError : aaosErrors[iRange])
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osError.c_str());
+        const auto iStart = static_cast<unsigned int>(aoRanges[iRange].first);
+        if (j != iStart)
+        {
+            memmove(m_panReqIds + j, m_panReqIds + iStart,
+                    anFound[iRange] * sizeof(GIntBig));
+            memmove(m_pasLonLatArray + j, m_pasLonLatArray + iStart,
+                    anFound[iRange] * sizeof(LonLat));
+        }
+        j += anFound[iRange];
+    }
+    m_nReqIds = j;
 #endif
 }
 
@@ -1063,19 +1183,26 @@ void OGROSMDataSource::LookupNodesCustom()
 /*                      LookupNodesCustomCompressedCase()               */
 /************************************************************************/
 
-void OGROSMDataSource::LookupNodesCustomCompressedCase()
+// Resolve the coordinates of the sorted identifiers of m_panReqIds[iStart:iEnd]
+// The identifiers that are found, and their coordinates, are compacted at the
+// beginning of the range, and their number is returned.
+// This may be called concurrently on different ranges when bUsePRead is set.
+unsigned int OGROSMDataSource::LookupNodesCustomCompressedCase(
+    unsigned int iStart, unsigned int iEnd, bool bUsePRead,
+    std::vector<std::string> &aosErrors) const
 {
     constexpr int SECURITY_MARGIN = 8 + 8 + 2 * NODE_PER_SECTOR;
     GByte abyRawSector[SECTOR_SIZE + SECURITY_MARGIN];
     memset(abyRawSector + SECTOR_SIZE, 0, SECURITY_MARGIN);
+    GByte abySector[SECTOR_SIZE];
 
     int l_nBucketOld = -1;
     int l_nOffInBucketReducedOld = -1;
     int k = 0;
     int nOffFromBucketStart = 0;
 
-    unsigned int j = 0;  // Used after for.
-    for (unsigned int i = 0; i < m_nReqIds; i++)
+    unsigned int j = iStart;  // Used after for.
+    for (unsigned int i = iStart; i < iEnd; i++)
     {
         const GIntBig id = m_panReqIds[i];
         const int nBucket = static_cast<int>(id / NODE_PER_BUCKET);
@@ -1096,16 +1223,16 @@ void OGROSMDataSource::LookupNodesCustomCompressedCase()
             const auto oIter = m_oMapBuckets.find(nBucket);
             if (oIter == m_oMapBuckets.end())
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot read node " CPL_FRMT_GIB, id);
+                aosErrors.push_back(
+                    CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
                 continue;
                 // FIXME ?
             }
             const Bucket *psBucket = &(oIter->second);
             if (psBucket->u.panSectorSize == nullptr)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot read node " CPL_FRMT_GIB, id);
+                aosErrors.push_back(
+                    CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
                 continue;
                 // FIXME ?
             }
@@ -1121,37 +1248,40 @@ void OGROSMDataSource::LookupNodesCustomCompressedCase()
                         COMPRESS_SIZE_FROM_BYTE(psBucket->u.panSectorSize[k]);
             }
 
-            VSIFSeekL(m_fpNodes, psBucket->nOff + nOffFromBucketStart,
-                      SEEK_SET);
+            const vsi_l_offset nSectorOffset =
+                psBucket->nOff + nOffFromBucketStart;
             if (nSectorSize == SECTOR_SIZE)
             {
-                if (VSIFReadL(m_pabySector, 1, static_cast<size_t>(SECTOR_SIZE),
-                              m_fpNodes) != static_cast<size_t>(SECTOR_SIZE))
+                if (ReadNodesFile(m_fpNodes, bUsePRead, abySector,
+                                  static_cast<size_t>(SECTOR_SIZE),
+                                  nSectorOffset) !=
+                    static_cast<size_t>(SECTOR_SIZE))
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot read node " CPL_FRMT_GIB, id);
+                    aosErrors.push_back(
+                        CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
                     continue;
                     // FIXME ?
                 }
             }
             else
             {
-                if (static_cast<int>(VSIFReadL(abyRawSector, 1, nSectorSize,
-                                               m_fpNodes)) != nSectorSize)
+                if (ReadNodesFile(m_fpNodes, bUsePRead, abyRawSector,
+                                  nSectorSize, nSectorOffset) !=
+                    static_cast<size_t>(nSectorSize))
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot read sector for node " CPL_FRMT_GIB, id);
+                    aosErrors.push_back(CPLSPrintf(
+                        "Cannot read sector for node " CPL_FRMT_GIB, id));
                     continue;
                     // FIXME ?
                 }
                 abyRawSector[nSectorSize] = 0;
 
-                if (!DecompressSector(abyRawSector, nSectorSize, m_pabySector))
+                if (!DecompressSector(abyRawSector, nSectorSize, abySector))
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Error while uncompressing sector for "
-                             "node " CPL_FRMT_GIB,
-                             id);
+                    aosErrors.push_back(
+                        CPLSPrintf("Error while uncompressing sector for "
+                                   "node " CPL_FRMT_GIB,
+                                   id));
                     continue;
                     // FIXME ?
                 }
@@ -1163,22 +1293,25 @@ void OGROSMDataSource::LookupNodesCustomCompressedCase()
 
         m_panReqIds[j] = id;
         memcpy(m_pasLonLatArray + j,
-               m_pabySector + nOffInBucketReducedRemainder * sizeof(LonLat),
+               abySector + nOffInBucketReducedRemainder * sizeof(LonLat),
                sizeof(LonLat));
 
         if (m_pasLonLatArray[j].nLon || m_pasLonLatArray[j].nLat)
             j++;
     }
-    m_nReqIds = j;
+    return j - iStart;
 }
 
 /************************************************************************/
 /*                    LookupNodesCustomNonCompressedCase()              */
 /************************************************************************/
 
-void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
+// Same as LookupNodesCustomCompressedCase(), for the non-compressed case.
+unsigned int OGROSMDataSource::LookupNodesCustomNonCompressedCase(
+    unsigned int iStart, unsigned int iEnd, bool bUsePRead,
+    std::vector<std::string> &aosErrors) const
 {
-    unsigned int j = 0;  // Used after for.
+    unsigned int j = iStart;  // Used after for.
 
     int l_nBucketOld = -1;
     const Bucket *psBucket = nullptr;
@@ -1192,7 +1325,7 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
     size_t nValidBytes = 0;
     int k = 0;
     int nSectorBase = 0;
-    for (unsigned int i = 0; i < m_nReqIds; i++)
+    for (unsigned int i = iStart; i < iEnd; i++)
     {
         const GIntBig id = m_panReqIds[i];
         const int nBucket = static_cast<int>(id / NODE_PER_BUCKET);
@@ -1209,16 +1342,16 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
             const auto oIter = m_oMapBuckets.find(nBucket);
             if (oIter == m_oMapBuckets.end())
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot read node " CPL_FRMT_GIB, id);
+                aosErrors.push_back(
+                    CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
                 continue;
                 // FIXME ?
             }
             psBucket = &(oIter->second);
             if (psBucket->u.pabyBitmap == nullptr)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot read node " CPL_FRMT_GIB, id);
+                aosErrors.push_back(
+                    CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
                 continue;
                 // FIXME ?
             }
@@ -1251,9 +1384,8 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
             // Align on 4096 boundary to be glibc caching friendly
             const GIntBig nAlignedNewPos =
                 nNewOffset & ~(static_cast<GIntBig>(knDISK_SECTOR_SIZE) - 1);
-            VSIFSeekL(m_fpNodes, nAlignedNewPos, SEEK_SET);
-            nValidBytes =
-                VSIFReadL(abyDiskSector, 1, knDISK_SECTOR_SIZE, m_fpNodes);
+            nValidBytes = ReadNodesFile(m_fpNodes, bUsePRead, abyDiskSector,
+                                        knDISK_SECTOR_SIZE, nAlignedNewPos);
             nOldOffset = nAlignedNewPos;
         }
 
@@ -1263,8 +1395,8 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
         if (nValidBytes < sizeof(LonLat) ||
             nOffsetInDiskSector > nValidBytes - sizeof(LonLat))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read node " CPL_FRMT_GIB, id);
+            aosErrors.push_back(
+                CPLSPrintf("Cannot read node " CPL_FRMT_GIB, id));
             continue;
         }
         memcpy(&m_pasLonLatArray[j], abyDiskSector + nOffsetInDiskSector,
@@ -1274,7 +1406,7 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
         if (m_pasLonLatArray[j].nLon || m_pasLonLatArray[j].nLat)
             j++;
     }
-    m_nReqIds = j;
+    return j - iStart;
 }
 
 /************************************************************************/
@@ -1579,7 +1711,7 @@ void OGROSMDataSource::IndexWay(GIntBig nWayID, bool bIsArea,
 /*                              FindNode()                              */
 /************************************************************************/
 
-int OGROSMDataSource::FindNode(GIntBig nID)
+int OGROSMDataSource::FindNode(GIntBig nID) const
 {
     if (m_nReqIds == 0)
         return -1;
@@ -1599,95 +1731,144 @@ int OGROSMDataSource::FindNode(GIntBig nID)
 }
 
 /************************************************************************/
-/*                         ProcessWaysBatch()                           */
+/*                          ResolveWayNodes()                           */
 /************************************************************************/
 
-void OGROSMDataSource::ProcessWaysBatch()
+// Fill pasLonLat, which must be able to hold sWayFeaturePairs.nRefs + 1
+// values, with the coordinates of the nodes of the way that have been found
+// by LookupNodes(), and return their number. Areas are closed.
+// This only reads the state of the datasource, and can thus be called
+// concurrently.
+unsigned int
+OGROSMDataSource::ResolveWayNodes(const WayFeaturePair &sWayFeaturePairs,
+                                  LonLat *pasLonLat) const
 {
-    if (m_asWayFeaturePairs.empty())
-        return;
-
-    // printf("nodes = %d, features = %d\n", nUnsortedReqIds, int(m_asWayFeaturePairs.size()));
-    LookupNodes();
-
-    for (WayFeaturePair &sWayFeaturePairs : m_asWayFeaturePairs)
-    {
-        const bool bIsArea = sWayFeaturePairs.bIsArea;
-        m_asLonLatCache.clear();
+    unsigned int nCount = 0;
 
 #ifdef ENABLE_NODE_LOOKUP_BY_HASHING
-        if (m_bHashedIndexValid)
+    if (m_bHashedIndexValid)
+    {
+        for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
         {
-            for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
+            int nIndInHashArray = static_cast<int>(
+                HASH_ID_FUNC(sWayFeaturePairs.panNodeRefs[i]) %
+                HASHED_INDEXES_ARRAY_SIZE);
+            int nIdx = m_panHashedIndexes[nIndInHashArray];
+            if (nIdx < -1)
             {
-                int nIndInHashArray = static_cast<int>(
-                    HASH_ID_FUNC(sWayFeaturePairs.panNodeRefs[i]) %
-                    HASHED_INDEXES_ARRAY_SIZE);
-                int nIdx = m_panHashedIndexes[nIndInHashArray];
-                if (nIdx < -1)
+                int iBucket = -nIdx - 2;
+                while (true)
                 {
-                    int iBucket = -nIdx - 2;
-                    while (true)
+                    nIdx = m_psCollisionBuckets[iBucket].nInd;
+                    if (m_panReqIds[nIdx] ==
+                        sWayFeaturePairs.panNodeRefs[i])
+                        break;
+                    iBucket = m_psCollisionBuckets[iBucket].nNext;
+                    if (iBucket < 0)
                     {
-                        nIdx = m_psCollisionBuckets[iBucket].nInd;
-                        if (m_panReqIds[nIdx] ==
-                            sWayFeaturePairs.panNodeRefs[i])
-                            break;
-                        iBucket = m_psCollisionBuckets[iBucket].nNext;
-                        if (iBucket < 0)
-                        {
-                            nIdx = -1;
-                            break;
-                        }
+                        nIdx = -1;
+                        break;
                     }
                 }
-                else if (nIdx >= 0 &&
-                         m_panReqIds[nIdx] != sWayFeaturePairs.panNodeRefs[i])
-                    nIdx = -1;
+            }
+            else if (nIdx >= 0 &&
+                     m_panReqIds[nIdx] != sWayFeaturePairs.panNodeRefs[i])
+                nIdx = -1;
 
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+            if (nIdx >= 0)
+            {
+                pasLonLat[nCount++] = m_pasLonLatArray[nIdx];
             }
         }
-        else
+    }
+    else
 #endif  // ENABLE_NODE_LOOKUP_BY_HASHING
+    {
+        int nIdx = -1;
+        for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
         {
-            int nIdx = -1;
-            for (unsigned int i = 0; i < sWayFeaturePairs.nRefs; i++)
+            if (nIdx >= 0 && sWayFeaturePairs.panNodeRefs[i] ==
+                                 sWayFeaturePairs.panNodeRefs[i - 1] + 1)
             {
-                if (nIdx >= 0 && sWayFeaturePairs.panNodeRefs[i] ==
-                                     sWayFeaturePairs.panNodeRefs[i - 1] + 1)
-                {
-                    if (static_cast<unsigned>(nIdx + 1) < m_nReqIds &&
-                        m_panReqIds[nIdx + 1] ==
-                            sWayFeaturePairs.panNodeRefs[i])
-                        nIdx++;
-                    else
-                        nIdx = -1;
-                }
+                if (static_cast<unsigned>(nIdx + 1) < m_nReqIds &&
+                    m_panReqIds[nIdx + 1] ==
+                        sWayFeaturePairs.panNodeRefs[i])
+                    nIdx++;
                 else
-                    nIdx = FindNode(sWayFeaturePairs.panNodeRefs[i]);
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+                    nIdx = -1;
+            }
+            else
+                nIdx = FindNode(sWayFeaturePairs.panNodeRefs[i]);
+            if (nIdx >= 0)
+            {
+                pasLonLat[nCount++] = m_pasLonLatArray[nIdx];
             }
         }
+    }
 
-        if (!m_asLonLatCache.empty() && bIsArea)
-        {
-            m_asLonLatCache.push_back(m_asLonLatCache[0]);
-        }
+    if (nCount > 0 && sWayFeaturePairs.bIsArea)
+    {
+        pasLonLat[nCount++] = pasLonLat[0];
+    }
+
+    return nCount;
+}
 
-        if (m_asLonLatCache.size() < 2)
+/************************************************************************/
+/*                         ProcessWaysBatch()                           */
+/************************************************************************/
+
+void OGROSMDataSource::ProcessWaysBatch()
+{
+    if (m_asWayFeaturePairs.empty())
+        return;
+
+    LookupNodes();
+
+    // Resolving the coordinates of the nodes of ways only reads the node
+    // arrays filled by LookupNodes(), so it is split among worker threads
+    // that write to disjoint parts of m_asWayLonLat.
+    const size_t nWays = m_asWayFeaturePairs.size();
+    m_anWayLonLatOffset.resize(nWays + 1);
+    m_anWayLonLatCount.resize(nWays);
+    size_t nTotalLonLat = 0;
+    for (size_t i = 0; i < nWays; ++i)
+    {
+        m_anWayLonLatOffset[i] = nTotalLonLat;
+        nTotalLonLat += m_asWayFeaturePairs[i].nRefs + 1;
+    }
+    m_anWayLonLatOffset[nWays] = nTotalLonLat;
+    m_asWayLonLat.resize(nTotalLonLat);
+
+    constexpr size_t MIN_WAYS_PER_JOB = 5000;
+    const auto aoRanges = SplitInRanges(nWays, MIN_WAYS_PER_JOB, m_nNumThreads);
+    RunInWorkerThreads(aoRanges.size(), m_nNumThreads,
+                       [this, &aoRanges](size_t iRange)
+                       {
+                           for (size_t i = aoRanges[iRange].first;
+                                i < aoRanges[iRange].second; ++i)
+                           {
+                               m_anWayLonLatCount[i] = ResolveWayNodes(
+                                   m_asWayFeaturePairs[i],
+                                   m_asWayLonLat.data() +
+                                       m_anWayLonLatOffset[i]);
+                           }
+                       });
+
+    for (size_t iWay = 0; iWay < nWays; ++iWay)
+    {
+        WayFeaturePair &sWayFeaturePairs = m_asWayFeaturePairs[iWay];
+        const bool bIsArea = sWayFeaturePairs.bIsArea;
+        const LonLat *pasLonLat =
+            m_asWayLonLat.data() + m_anWayLonLatOffset[iWay];
+        const unsigned int nLonLat = m_anWayLonLatCount[iWay];
+
+        if (nLonLat < 2)
         {
             CPLDebug("OSM",
                      "Way " CPL_FRMT_GIB
                      " with %d nodes that could be found. Discarding it",
-                     sWayFeaturePairs.nWayID,
-                     static_cast<int>(m_asLonLatCache.size()));
+                     sWayFeaturePairs.nWayID, static_cast<int>(nLonLat));
             sWayFeaturePairs.poFeature.reset();
             sWayFeaturePairs.bIsArea = false;
             continue;
@@ -1697,14 +1878,12 @@ void OGROSMDataSource::ProcessWaysBatch()
         {
             IndexWay(sWayFeaturePairs.nWayID, /*bIsArea = */ true,
                      sWayFeaturePairs.nTags, sWayFeaturePairs.pasTags,
-                     m_asLonLatCache.data(),
-                     static_cast<int>(m_asLonLatCache.size()),
+                     pasLonLat, static_cast<int>(nLonLat),
                      &sWayFeaturePairs.sInfo);
         }
         else
             IndexWay(sWayFeaturePairs.nWayID, bIsArea, 0, nullptr,
-                     m_asLonLatCache.data(),
-                     static_cast<int>(m_asLonLatCache.size()), nullptr);
+                     pasLonLat, static_cast<int>(nLonLat), nullptr);
 
         if (sWayFeaturePairs.poFeature == nullptr)
         {
@@ -1714,17 +1893,17 @@ void OGROSMDataSource::ProcessWaysBatch()
         OGRLineString *poLS = new OGRLineString();
         OGRGeometry *poGeom = poLS;
 
-        const int nPoints = static_cast<int>(m_asLonLatCache.size());
+        const int nPoints = static_cast<int>(nLonLat);
         poLS->setNumPoints(nPoints, /*bZeroizeNewContent=*/false);
         for (int i = 0; i < nPoints; i++)
         {
-            poLS->setPoint(i, INT_TO_DBL(m_asLonLatCache[i].nLon),
-                           INT_TO_DBL(m_asLonLatCache[i].nLat));
+            poLS->setPoint(i, INT_TO_DBL(pasLonLat[i].nLon),
+                           INT_TO_DBL(pasLonLat[i].nLat));
         }
 
         sWayFeaturePairs.poFeature->SetGeometryDirectly(poGeom);
 
-        if (m_asLonLatCache.size() != sWayFeaturePairs.nRefs)
+        if (nLonLat != sWayFeaturePairs.nRefs)
             CPLDebug("OSM",
                      "For way " CPL_FRMT_GIB
                      ", got only %d nodes instead of %d",
@@ -2722,6 +2901,13 @@ int OGROSMDataSource::Open(const char *pszFilename,
     if (CPLFetchBool(papszOpenOptionsIn, "INTERLEAVED_READING", false))
         m_bInterleavedReading = TRUE;
 
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    m_nNumThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        m_nNumThreads =
+            std::max(0, std::min(2 * m_nNumThreads, atoi(pszNumThreads)));
+
     /* The following 4 config options are only useful for debugging */
     m_bIndexPoints = CPLTestBool(CPLGetConfigOption("OSM_INDEX_POINTS", "YES"));
     m_bUsePointsIndex =
@@ -84,6 +84,8 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     std::vector<int> m_anMapFieldIndexToParquetColumn{};
     std::vector<std::vector<int>> m_anMapGeomFieldIndexToParquetColumns{};
     bool m_bHasMissingMappingToParquet = false;
+    //! Maximum number of row groups decoded concurrently during a scan
+    int m_nConcurrentRowGroups = 1;
 
     //! Contains pairs of (selected feature idx, total feature idx) break points.
     std::vector<std::pair<int64_t, int64_t>> m_asFeatureIdxRemapping{};
@@ -117,6 +119,7 @@ class OGRParquetLayer final : public OGRParquetLayerBase
         const std::map<std::string, int> &oMapParquetColumnNameToIdx);
     bool CreateRecordBatchReader(int iStartingRowGroup);
     bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
+    bool CreateSequentialRecordBatchReader(const std::vector<int> &anRowGroups);
     bool ReadNextBatch() override;
 
     void InvalidateCachedBatches() override;
@@ -146,6 +149,7 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     OGRParquetLayer(OGRParquetDataset *poDS, const char *pszLayerName,
                     std::unique_ptr<parquet::arrow::FileReader> &&arrow_reader,
                     CSLConstList papszOpenOptions);
+    ~OGRParquetLayer() override;
 
     void ResetReading() override;
     OGRFeature *GetFeature(GIntBig nFID) override;
@@ -319,6 +323,8 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     std::shared_ptr<const arrow::KeyValueMetadata> m_poKeyValueMetadata{};
     bool m_bForceCounterClockwiseOrientation = false;
     bool m_bEdgesSpherical = false;
+    //! Whether the columns of a row group are encoded in parallel
+    bool m_bUseThreads = false;
     parquet::WriterProperties::Builder m_oWriterPropertiesBuilder{};
 
     //! Temporary GeoPackage dataset. Only used in SORT_BY_BBOX mode
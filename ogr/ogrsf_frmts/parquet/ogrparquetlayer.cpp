@@ -14,13 +14,17 @@
 #include "cpl_time.h"
 #include "cpl_multiproc.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
 
 #include <algorithm>
 #include <cinttypes>
+#include <condition_variable>
+#include <deque>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <set>
 #include <utility>
 
@@ -523,6 +527,9 @@ OGRParquetLayer::OGRParquetLayer(
     if (pszUseThreads && CPLTestBool(pszUseThreads))
     {
         m_poArrowReader->set_use_threads(true);
+        m_nConcurrentRowGroups = std::max(
+            1, atoi(CPLGetConfigOption("OGR_PARQUET_CONCURRENT_ROW_GROUPS",
+                                       CPLSPrintf("%d", nNumCPUs))));
     }
 
     EstablishFeatureDefn();
@@ -1344,6 +1351,225 @@ void OGRParquetLayer::ResetReading()
     }
 }
 
+/************************************************************************/
+/*                           ~OGRParquetLayer()                         */
+/************************************************************************/
+
+OGRParquetLayer::~OGRParquetLayer()
+{
+    // Must be done before m_poArrowReader is destroyed, as a
+    // OGRParquetConcurrentRecordBatchReader may still be decoding row groups.
+    m_poRecordBatchReader.reset();
+}
+
+/************************************************************************/
+/*                        CreateRowGroupReader()                        */
+/************************************************************************/
+
+static arrow::Result<std::shared_ptr<arrow::RecordBatchReader>>
+CreateRowGroupReader(parquet::arrow::FileReader *poArrowReader,
+                     const std::vector<int> &anRowGroups,
+                     const std::vector<int> *panColumns)
+{
+#if PARQUET_VERSION_MAJOR >= 21
+    auto result =
+        panColumns
+            ? poArrowReader->GetRecordBatchReader(anRowGroups, *panColumns)
+            : poArrowReader->GetRecordBatchReader(anRowGroups);
+    if (!result.ok())
+        return result.status();
+    return std::shared_ptr<arrow::RecordBatchReader>(std::move(*result));
+#else
+    std::shared_ptr<arrow::RecordBatchReader> poRecordBatchReader;
+    const auto status =
+        panColumns ? poArrowReader->GetRecordBatchReader(
+                         anRowGroups, *panColumns, &poRecordBatchReader)
+                   : poArrowReader->GetRecordBatchReader(anRowGroups,
+                                                         &poRecordBatchReader);
+    if (!status.ok())
+        return status;
+    if (poRecordBatchReader == nullptr)
+        return arrow::Status::UnknownError("GetRecordBatchReader() failed");
+    return poRecordBatchReader;
+#endif
+}
+
+/************************************************************************/
+/*                OGRParquetConcurrentRecordBatchReader                 */
+/************************************************************************/
+
+namespace
+{
+
+/** Record batch reader that decodes several row groups concurrently, in
+ * worker threads, and returns their batches in row group order.
+ */
+class OGRParquetConcurrentRecordBatchReader final
+    : public arrow::RecordBatchReader
+{
+    struct RowGroupResult
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        bool bDone = false;
+        arrow::Status oStatus{};
+        std::vector<std::shared_ptr<arrow::RecordBatch>> apoBatches{};
+    };
+
+    parquet::arrow::FileReader *const m_poArrowReader;
+    const std::vector<int> m_anRowGroups;
+    const std::vector<int> m_anColumns;
+    const bool m_bAllColumns;
+    const size_t m_nMaxInFlight;
+    size_t m_nNextRowGroupToSubmit = 0;
+    std::shared_ptr<arrow::Schema> m_poSchema{};
+
+    //! Row groups submitted, in row group order
+    std::deque<std::shared_ptr<RowGroupResult>> m_apoPending{};
+    std::shared_ptr<RowGroupResult> m_poCurrent{};
+    size_t m_nIdxInCurrent = 0;
+
+    // Last member, so that pending jobs are waited for before the row group
+    // results they fill are destroyed.
+    CPLJobQueuePtr m_poJobQueue{};
+
+    void SubmitJobs()
+    {
+        while (m_nNextRowGroupToSubmit < m_anRowGroups.size() &&
+               m_apoPending.size() < m_nMaxInFlight)
+        {
+            auto poResult = std::make_shared<RowGroupResult>();
+            m_apoPending.push_back(poResult);
+            const int iRowGroup = m_anRowGroups[m_nNextRowGroupToSubmit++];
+            if (!m_poJobQueue->SubmitJob(
+                    [this, poResult, iRowGroup]()
+                    {
+                        auto oStatus =
+                            ReadRowGroup(iRowGroup, poResult->apoBatches);
+                        std::lock_guard oLock(poResult->oMutex);
+                        poResult->oStatus = std::move(oStatus);
+                        poResult->bDone = true;
+                        poResult->oCV.notify_one();
+                    }))
+            {
+                poResult->oStatus =
+                    arrow::Status::UnknownError("Cannot submit job");
+                poResult->bDone = true;
+            }
+        }
+    }
+
+    arrow::Status
+    ReadRowGroup(int iRowGroup,
+                 std::vector<std::shared_ptr<arrow::RecordBatch>> &apoBatches)
+    {
+        auto poReaderRes =
+            CreateRowGroupReader(m_poArrowReader, {iRowGroup},
+                                 m_bAllColumns ? nullptr : &m_anColumns);
+        if (!poReaderRes.ok())
+            return poReaderRes.status();
+        auto poReader = std::move(*poReaderRes);
+        while (true)
+        {
+            std::shared_ptr<arrow::RecordBatch> poBatch;
+            auto status = poReader->ReadNext(&poBatch);
+            if (!status.ok())
+                return status;
+            if (poBatch == nullptr)
+                break;
+            apoBatches.push_back(std::move(poBatch));
+        }
+        return arrow::Status::OK();
+    }
+
+  public:
+    OGRParquetConcurrentRecordBatchReader(
+        parquet::arrow::FileReader *poArrowReader,
+        const std::vector<int> &anRowGroups, const std::vector<int> *panColumns,
+        size_t nMaxInFlight, CPLJobQueuePtr poJobQueue)
+        : m_poArrowReader(poArrowReader), m_anRowGroups(anRowGroups),
+          m_anColumns(panColumns ? *panColumns : std::vector<int>()),
+          m_bAllColumns(panColumns == nullptr), m_nMaxInFlight(nMaxInFlight),
+          m_poJobQueue(std::move(poJobQueue))
+    {
+        SubmitJobs();
+    }
+
+    // Only known once the first batch has been read. Not used by the driver.
+    std::shared_ptr<arrow::Schema> schema() const override
+    {
+        return m_poSchema;
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *out) override
+    {
+        while (!m_poCurrent ||
+               m_nIdxInCurrent == m_poCurrent->apoBatches.size())
+        {
+            m_poCurrent.reset();
+            if (m_apoPending.empty())
+            {
+                out->reset();
+                return arrow::Status::OK();
+            }
+            auto poResult = std::move(m_apoPending.front());
+            m_apoPending.pop_front();
+            {
+                std::unique_lock oLock(poResult->oMutex);
+                poResult->oCV.wait(oLock,
+                                   [&poResult] { return poResult->bDone; });
+            }
+            if (!poResult->oStatus.ok())
+            {
+                m_poJobQueue->WaitCompletion();
+                m_apoPending.clear();
+                m_nNextRowGroupToSubmit = m_anRowGroups.size();
+                return poResult->oStatus;
+            }
+            m_poCurrent = std::move(poResult);
+            m_nIdxInCurrent = 0;
+            // Keep the queue full
+            SubmitJobs();
+        }
+        *out = std::move(m_poCurrent->apoBatches[m_nIdxInCurrent++]);
+        if (!m_poSchema)
+            m_poSchema = (*out)->schema();
+        return arrow::Status::OK();
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                    CreateSequentialRecordBatchReader()               */
+/************************************************************************/
+
+/** Creates m_poRecordBatchReader to scan the specified row groups in order.
+ *
+ * When several threads may be used, row groups are decoded concurrently.
+ */
+bool OGRParquetLayer::CreateSequentialRecordBatchReader(
+    const std::vector<int> &anRowGroups)
+{
+    if (m_nConcurrentRowGroups > 1 && anRowGroups.size() > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(m_nConcurrentRowGroups);
+        if (poThreadPool)
+        {
+            CPLDebugOnly("PARQUET", "Decoding up to %d row groups concurrently",
+                         m_nConcurrentRowGroups);
+            m_poRecordBatchReader =
+                std::make_shared<OGRParquetConcurrentRecordBatchReader>(
+                    m_poArrowReader.get(), anRowGroups,
+                    m_bIgnoredFields ? &m_anRequestedParquetColumns : nullptr,
+                    static_cast<size_t>(m_nConcurrentRowGroups),
+                    poThreadPool->CreateJobQueue());
+            return true;
+        }
+    }
+    return CreateRecordBatchReader(anRowGroups);
+}
+
 /************************************************************************/
 /*                      CreateRecordBatchReader()                       */
 /************************************************************************/
@@ -1681,8 +1907,10 @@ bool OGRParquetLayer::ReadNextBatch()
                                          eType, eSubType, osMinTmp, osMaxTmp) ||
                                      !bFoundMin || !bFoundMax)
                             {
-                                bIterateEverything = true;
-                                break;
+                                // No statistics for this row group: this
+                                // constraint cannot be used to skip it, but
+                                // other ones might.
+                                continue;
                             }
                         }
 
@@ -1817,11 +2045,6 @@ bool OGRParquetLayer::ReadNextBatch()
                             bSelectGroup = false;
                             break;
                         }
-                        else if (res == IsConstraintPossibleRes::UNKNOWN)
-                        {
-                            bIterateEverything = true;
-                            break;
-                        }
                     }
                 }
 
@@ -1842,7 +2065,11 @@ bool OGRParquetLayer::ReadNextBatch()
         {
             m_asFeatureIdxRemapping.clear();
             m_oFeatureIdxRemappingIter = m_asFeatureIdxRemapping.begin();
-            if (!CreateRecordBatchReader(0))
+            std::vector<int> anAllGroups;
+            anAllGroups.reserve(nNumGroups);
+            for (int i = 0; i < nNumGroups; ++i)
+                anAllGroups.push_back(i);
+            if (!CreateSequentialRecordBatchReader(anAllGroups))
                 return false;
         }
         else
@@ -1857,7 +2084,7 @@ bool OGRParquetLayer::ReadNextBatch()
                      m_poArrowReader->num_row_groups());
             m_nFeatureIdx = m_oFeatureIdxRemappingIter->second;
             ++m_oFeatureIdxRemappingIter;
-            if (!CreateRecordBatchReader(anSelectedGroups))
+            if (!CreateSequentialRecordBatchReader(anSelectedGroups))
             {
                 return false;
             }
@@ -497,6 +497,24 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
     m_bEdgesSpherical = EQUAL(
         CSLFetchNameValueDef(papszOptions, "EDGES", "PLANAR"), "SPHERICAL");
 
+#if PARQUET_VERSION_MAJOR > 10
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszNumThreads);
+    if (nNumThreads > 1)
+    {
+        // Columns of a row group are encoded and compressed in parallel
+        // by WriteRecordBatch(), using the Arrow CPU thread pool.
+        CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
+        m_bUseThreads = true;
+        // Make sure WriteRecordBatch() does not split our row groups.
+        m_oWriterPropertiesBuilder.max_row_group_length(m_nRowGroupSize);
+    }
+#endif
+
     m_bInitializationOK = true;
     return true;
 }
@@ -1006,8 +1024,11 @@ void OGRParquetWriterLayer::CreateWriter()
         FinalizeSchema();
     }
 
-    auto arrowWriterProperties =
-        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+    parquet::ArrowWriterProperties::Builder oArrowWriterPropertiesBuilder;
+    oArrowWriterPropertiesBuilder.store_schema();
+    if (m_bUseThreads)
+        oArrowWriterPropertiesBuilder.set_use_threads(true);
+    auto arrowWriterProperties = oArrowWriterPropertiesBuilder.build();
     CPL_IGNORE_RET_VAL(Open(*m_poSchema, m_poMemoryPool, m_poOutputStream,
                             m_oWriterPropertiesBuilder.build(),
                             std::move(arrowWriterProperties), &m_poFileWriter,
@@ -1082,6 +1103,46 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 
 bool OGRParquetWriterLayer::FlushGroup()
 {
+#if PARQUET_VERSION_MAJOR > 10
+    if (m_bUseThreads)
+    {
+        // Write the whole row group at once, so that Arrow can encode its
+        // columns in parallel, which WriteColumnChunk() cannot do.
+        const int64_t nRows = m_apoBuilders[0]->length();
+        std::vector<std::shared_ptr<arrow::Array>> apoArrays;
+        const bool bArraysOK = WriteArrays(
+            [&apoArrays](const std::shared_ptr<arrow::Field> &,
+                         const std::shared_ptr<arrow::Array> &array)
+            {
+                apoArrays.push_back(array);
+                return true;
+            });
+        ClearArrayBuilers();
+        if (!bArraysOK)
+            return false;
+
+        auto status = m_poFileWriter->NewBufferedRowGroup();
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "NewBufferedRowGroup() failed with %s",
+                     status.message().c_str());
+            return false;
+        }
+
+        const auto poBatch =
+            arrow::RecordBatch::Make(m_poSchema, nRows, std::move(apoArrays));
+        status = m_poFileWriter->WriteRecordBatch(*poBatch);
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteRecordBatch() failed: %s", status.message().c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
+
 #if PARQUET_VERSION_MAJOR >= 20
     auto status = m_poFileWriter->NewRowGroup();
 #else
@@ -1252,25 +1313,15 @@ bool OGRParquetWriterLayer::CreateFieldFromArrowSchema(
 }
 #endif
 
+#if PARQUET_VERSION_MAJOR > 10
+
 /************************************************************************/
-/*                        IsArrowSchemaSupported()                      */
+/*                    IsArrowSchemaSupportedInternal()                  */
 /************************************************************************/
 
-#if PARQUET_VERSION_MAJOR > 10
-bool OGRParquetWriterLayer::IsArrowSchemaSupported(
-    const struct ArrowSchema *schema, CSLConstList papszOptions,
-    std::string &osErrorMsg) const
+static bool IsArrowSchemaSupportedInternal(const struct ArrowSchema *schema,
+                                           std::string &osErrorMsg)
 {
-    if (m_poTmpGPKGLayer)
-    {
-        // When using SORT_BY_BBOX=YES option, we can't directly write the
-        // input array, because we need to sort features. But this process
-        // only supports the base Arrow types supported by
-        // OGRLayer::WriteArrowBatch()
-        return OGRLayer::IsArrowSchemaSupported(schema, papszOptions,
-                                                osErrorMsg);
-    }
-
     if (schema->format[0] == 'e' && schema->format[1] == 0)
     {
         osErrorMsg = "float16 not supported";
@@ -1301,14 +1352,35 @@ bool OGRParquetWriterLayer::IsArrowSchemaSupported(
     }
     for (int64_t i = 0; i < schema->n_children; ++i)
     {
-        if (!IsArrowSchemaSupported(schema->children[i], papszOptions,
-                                    osErrorMsg))
+        if (!IsArrowSchemaSupportedInternal(schema->children[i], osErrorMsg))
         {
             return false;
         }
     }
     return true;
 }
+
+/************************************************************************/
+/*                        IsArrowSchemaSupported()                      */
+/************************************************************************/
+
+bool OGRParquetWriterLayer::IsArrowSchemaSupported(
+    const struct ArrowSchema *schema, CSLConstList papszOptions,
+    std::string &osErrorMsg) const
+{
+    if (m_poTmpGPKGLayer)
+    {
+        // When using SORT_BY_BBOX=YES option, we can't directly write the
+        // input array, because we need to sort features. But this process
+        // only supports the base Arrow types supported by
+        // OGRLayer::WriteArrowBatch()
+        return OGRLayer::IsArrowSchemaSupported(schema, papszOptions,
+                                                osErrorMsg);
+    }
+
+    return IsArrowSchemaSupportedInternal(schema, osErrorMsg) &&
+           IsArrowGeomSchemaSupported(schema, papszOptions, osErrorMsg);
+}
 #endif
 
 /************************************************************************/
@@ -23,6 +23,7 @@
 
 #include <map>
 #include <optional>
+#include <string>
 #include <vector>
 
 /* These are the OIDs for some builtin types, as returned by PQftype(). */
@@ -308,6 +309,31 @@ class OGRPGTableLayer final : public OGRPGLayer
     OGRErr CreateFeatureViaInsert(OGRFeature *poFeature);
     CPLString BuildCopyFields();
 
+    // Encoding of the columns of a COPY in binary format, in the order of
+    // BuildCopyFields()
+    enum class CopyBinaryType
+    {
+        INT2,
+        INT4,
+        INT8,
+        BOOL,
+        FLOAT4,
+        FLOAT8,
+        NUMERIC,
+        TEXT,
+        BYTEA,
+        EWKB,
+        WKB,
+    };
+
+    bool m_bCopyBinary = false;
+    std::vector<CopyBinaryType> m_aeCopyBinaryTypes{};
+    std::string m_osCopyBinaryBuffer{};
+
+    bool ComputeCopyBinaryTypes();
+    OGRErr CreateFeatureViaCopyBinary(OGRFeature *poFeature);
+    OGRErr PutCopyData(const char *pabyData, size_t nSize);
+
     int bHasWarnedIncompatibleGeom = false;
     void CheckGeomTypeCompatibility(int iGeomField, OGRGeometry *poGeom);
 
@@ -18,8 +18,11 @@
 #include "cpl_error.h"
 #include "ogr_p.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <limits>
 #include <mutex>
 #include <thread>
 
@@ -2128,6 +2131,9 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     /* Tell the datasource we are now planning to copy data */
     poDS->StartCopy(this);
 
+    if (m_bCopyBinary)
+        return CreateFeatureViaCopyBinary(poFeature);
+
     /* First process geometry */
     for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
     {
@@ -2218,14 +2224,26 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     /*      Execute the copy.                                       */
     /* ------------------------------------------------------------ */
 
-    OGRErr result = OGRERR_NONE;
-
-    int copyResult = PQputCopyData(hPGConn, osCommand.c_str(),
-                                   static_cast<int>(osCommand.size()));
 #ifdef DEBUG_VERBOSE
     CPLDebug("PG", "PQputCopyData(%s)", osCommand.c_str());
 #endif
 
+    return PutCopyData(osCommand.c_str(), osCommand.size());
+}
+
+/************************************************************************/
+/*                            PutCopyData()                             */
+/************************************************************************/
+
+OGRErr OGRPGTableLayer::PutCopyData(const char *pabyData, size_t nSize)
+{
+    PGconn *hPGConn = poDS->GetPGConn();
+
+    OGRErr result = OGRERR_NONE;
+
+    int copyResult =
+        PQputCopyData(hPGConn, pabyData, static_cast<int>(nSize));
+
     switch (copyResult)
     {
         case 0:
@@ -2242,6 +2260,550 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     return result;
 }
 
+/************************************************************************/
+/*                       ComputeCopyBinaryTypes()                       */
+/************************************************************************/
+
+// Determine whether the COPY can use the binary format, which avoids
+// formatting and parsing values as text, and hex-encoding geometries.
+// This is only possible when the binary encoding of each column can be
+// derived from its PostgreSQL type and the OGR type of the field.
+bool OGRPGTableLayer::ComputeCopyBinaryTypes()
+{
+    m_aeCopyBinaryTypes.clear();
+
+    if (!CPLTestBool(CPLGetConfigOption("PG_USE_COPY_BINARY", "YES")))
+        return false;
+
+    PGconn *hPGConn = poDS->GetPGConn();
+    CPLString osCommand;
+    osCommand.Printf(
+        "SELECT a.attname, t.typname FROM pg_attribute a "
+        "JOIN pg_type t ON t.oid = a.atttypid "
+        "WHERE a.attnum > 0 AND NOT a.attisdropped "
+        "AND a.attrelid = %s::regclass",
+        OGRPGEscapeString(hPGConn, pszSqlTableName).c_str());
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand.c_str());
+    if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK)
+    {
+        OGRPGClearResult(hResult);
+        return false;
+    }
+    std::map<std::string, std::string> oMapColumnTypes;
+    for (int iRecord = 0; iRecord < PQntuples(hResult); iRecord++)
+    {
+        oMapColumnTypes[PQgetvalue(hResult, iRecord, 0)] =
+            PQgetvalue(hResult, iRecord, 1);
+    }
+    OGRPGClearResult(hResult);
+
+    const auto GetColumnType = [&oMapColumnTypes](const char *pszName)
+    {
+        const auto oIter = oMapColumnTypes.find(pszName);
+        return oIter == oMapColumnTypes.end() ? std::string()
+                                              : oIter->second;
+    };
+
+    const auto GetIntegerType = [](const std::string &osType,
+                                   std::optional<CopyBinaryType> &eType)
+    {
+        if (osType == "int2")
+            eType = CopyBinaryType::INT2;
+        else if (osType == "int4")
+            eType = CopyBinaryType::INT4;
+        else if (osType == "int8")
+            eType = CopyBinaryType::INT8;
+    };
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
+    {
+        const OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        const std::string osType =
+            GetColumnType(poGeomFieldDefn->GetNameRef());
+        if (poGeomFieldDefn->ePostgisType == GEOM_TYPE_WKB &&
+            osType == "bytea")
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::WKB);
+        else if ((poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY &&
+                  osType == "geometry") ||
+                 (poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY &&
+                  osType == "geography"))
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::EWKB);
+        else
+            return false;
+    }
+
+    int nFIDIndex = -1;
+    if (bFIDColumnInCopyFields)
+    {
+        nFIDIndex = poFeatureDefn->GetFieldIndex(pszFIDColumn);
+        std::optional<CopyBinaryType> eType;
+        GetIntegerType(GetColumnType(pszFIDColumn), eType);
+        if (!eType)
+            return false;
+        m_aeCopyBinaryTypes.push_back(*eType);
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (i == nFIDIndex || poFieldDefn->IsGenerated())
+            continue;
+
+        const std::string osType = GetColumnType(poFieldDefn->GetNameRef());
+        std::optional<CopyBinaryType> eType;
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+            case OFTInteger64:
+            case OFTReal:
+                if (poFieldDefn->GetType() != OFTReal)
+                {
+                    GetIntegerType(osType, eType);
+                    if (osType == "bool" &&
+                        poFieldDefn->GetType() == OFTInteger)
+                        eType = CopyBinaryType::BOOL;
+                }
+                if (osType == "float4")
+                    eType = CopyBinaryType::FLOAT4;
+                else if (osType == "float8")
+                    eType = CopyBinaryType::FLOAT8;
+                else if (osType == "numeric")
+                    eType = CopyBinaryType::NUMERIC;
+                break;
+
+            case OFTString:
+                if (osType == "text" || osType == "varchar" ||
+                    osType == "bpchar" || osType == "json")
+                    eType = CopyBinaryType::TEXT;
+                break;
+
+            case OFTBinary:
+                if (osType == "bytea")
+                    eType = CopyBinaryType::BYTEA;
+                break;
+
+            default:
+                break;
+        }
+        if (!eType)
+            return false;
+        m_aeCopyBinaryTypes.push_back(*eType);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      CopyBinaryAppend helpers                        */
+/************************************************************************/
+
+static void CopyBinaryAppendInt16(std::string &osBuffer, GInt16 nVal)
+{
+    CPL_MSBPTR16(&nVal);
+    osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static void CopyBinaryAppendInt32(std::string &osBuffer, GInt32 nVal)
+{
+    CPL_MSBPTR32(&nVal);
+    osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static void CopyBinaryAppendInt64(std::string &osBuffer, GInt64 nVal)
+{
+    CPL_MSBPTR64(&nVal);
+    osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+/************************************************************************/
+/*                      CopyBinaryAppendNumeric()                       */
+/************************************************************************/
+
+// Append the binary representation of a PostgreSQL NUMERIC from its
+// decimal text representation, as sent by the text COPY format. The
+// display scale is the number of decimal digits, so that the server applies
+// the same rounding to the type modifier of the column as with the text
+// format.
+static bool CopyBinaryAppendNumeric(std::string &osBuffer, const char *pszVal)
+{
+    constexpr GUInt16 NUMERIC_POS = 0x0000;
+    constexpr GUInt16 NUMERIC_NEG = 0x4000;
+    constexpr int NBASE_DIGITS = 4;
+
+    const char *pszIter = pszVal;
+    GUInt16 nSign = NUMERIC_POS;
+    if (*pszIter == '-' || *pszIter == '+')
+    {
+        if (*pszIter == '-')
+            nSign = NUMERIC_NEG;
+        ++pszIter;
+    }
+
+    // Significant decimal digits, and count of digits after the point
+    std::string osDigits;
+    int nFracDigits = 0;
+    bool bAfterPoint = false;
+    for (; *pszIter != '\0' && *pszIter != 'e' && *pszIter != 'E';
+         ++pszIter)
+    {
+        if (*pszIter == '.' && !bAfterPoint)
+            bAfterPoint = true;
+        else if (*pszIter >= '0' && *pszIter <= '9')
+        {
+            if (!osDigits.empty() || *pszIter != '0')
+                osDigits += *pszIter;
+            if (bAfterPoint)
+                ++nFracDigits;
+        }
+        else
+            return false;
+    }
+    int nExponent = 0;
+    if (*pszIter != '\0')
+    {
+        ++pszIter;
+        if (*pszIter == '\0')
+            return false;
+        char *pszEnd = nullptr;
+        const long nVal = strtol(pszIter, &pszEnd, 10);
+        if (*pszEnd != '\0' || nVal < -1000 || nVal > 1000)
+            return false;
+        nExponent = static_cast<int>(nVal);
+    }
+
+    const int nDScale = std::max(0, nFracDigits - nExponent);
+
+    if (osDigits.empty())
+    {
+        CopyBinaryAppendInt32(osBuffer, 8);
+        CopyBinaryAppendInt16(osBuffer, 0);  // ndigits
+        CopyBinaryAppendInt16(osBuffer, 0);  // weight
+        CopyBinaryAppendInt16(osBuffer, NUMERIC_POS);
+        CopyBinaryAppendInt16(osBuffer, static_cast<GInt16>(nDScale));
+        return true;
+    }
+
+    // Decimal exponent of the last digit, rounded down to a multiple of
+    // NBASE_DIGITS by appending zeros.
+    int nLastDigitExp = nExponent - nFracDigits;
+    const int nPadRight =
+        ((nLastDigitExp % NBASE_DIGITS) + NBASE_DIGITS) % NBASE_DIGITS;
+    osDigits.append(nPadRight, '0');
+    nLastDigitExp -= nPadRight;
+    osDigits.insert(
+        0, (NBASE_DIGITS - osDigits.size() % NBASE_DIGITS) % NBASE_DIGITS, '0');
+
+    std::vector<GInt16> anNBaseDigits;
+    for (size_t i = 0; i < osDigits.size(); i += NBASE_DIGITS)
+    {
+        anNBaseDigits.push_back(static_cast<GInt16>(
+            atoi(osDigits.substr(i, NBASE_DIGITS).c_str())));
+    }
+    const int nWeight = nLastDigitExp / NBASE_DIGITS +
+                        static_cast<int>(anNBaseDigits.size()) - 1;
+    while (anNBaseDigits.back() == 0)
+        anNBaseDigits.pop_back();
+
+    CopyBinaryAppendInt32(
+        osBuffer, static_cast<GInt32>(8 + 2 * anNBaseDigits.size()));
+    CopyBinaryAppendInt16(osBuffer,
+                          static_cast<GInt16>(anNBaseDigits.size()));
+    CopyBinaryAppendInt16(osBuffer, static_cast<GInt16>(nWeight));
+    CopyBinaryAppendInt16(osBuffer, static_cast<GInt16>(nSign));
+    CopyBinaryAppendInt16(osBuffer, static_cast<GInt16>(nDScale));
+    for (const GInt16 nDigit : anNBaseDigits)
+        CopyBinaryAppendInt16(osBuffer, nDigit);
+    return true;
+}
+
+/************************************************************************/
+/*                     CreateFeatureViaCopyBinary()                     */
+/************************************************************************/
+
+OGRErr OGRPGTableLayer::CreateFeatureViaCopyBinary(OGRFeature *poFeature)
+{
+    std::string &osBuffer = m_osCopyBinaryBuffer;
+    osBuffer.clear();
+    CopyBinaryAppendInt16(osBuffer,
+                          static_cast<GInt16>(m_aeCopyBinaryTypes.size()));
+    size_t iCol = 0;
+
+    const auto ReportOutOfRange = [poFeature](const char *pszFieldName)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Value of field %s of feature " CPL_FRMT_GIB
+                 " is out of range for its column type",
+                 pszFieldName, poFeature->GetFID());
+        return OGRERR_FAILURE;
+    };
+
+    const auto AppendInteger =
+        [&osBuffer, &ReportOutOfRange](CopyBinaryType eType, GIntBig nVal,
+                                       const char *pszFieldName)
+    {
+        switch (eType)
+        {
+            case CopyBinaryType::INT2:
+                if (nVal < std::numeric_limits<GInt16>::min() ||
+                    nVal > std::numeric_limits<GInt16>::max())
+                    return ReportOutOfRange(pszFieldName);
+                CopyBinaryAppendInt32(osBuffer, 2);
+                CopyBinaryAppendInt16(osBuffer, static_cast<GInt16>(nVal));
+                break;
+            case CopyBinaryType::INT4:
+                if (nVal < std::numeric_limits<GInt32>::min() ||
+                    nVal > std::numeric_limits<GInt32>::max())
+                    return ReportOutOfRange(pszFieldName);
+                CopyBinaryAppendInt32(osBuffer, 4);
+                CopyBinaryAppendInt32(osBuffer, static_cast<GInt32>(nVal));
+                break;
+            default:
+                CPLAssert(eType == CopyBinaryType::INT8);
+                CopyBinaryAppendInt32(osBuffer, 8);
+                CopyBinaryAppendInt64(osBuffer, nVal);
+                break;
+        }
+        return OGRERR_NONE;
+    };
+
+    /* First process geometry */
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++, iCol++)
+    {
+        const OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+        if (poGeom == nullptr)
+        {
+            CopyBinaryAppendInt32(osBuffer, -1);
+            continue;
+        }
+
+        CheckGeomTypeCompatibility(i, poGeom);
+
+        poGeom->closeRings();
+        poGeom->set3D(poGeomFieldDefn->GeometryTypeFlags &
+                      OGRGeometry::OGR_G_3D);
+        poGeom->setMeasured(poGeomFieldDefn->GeometryTypeFlags &
+                            OGRGeometry::OGR_G_MEASURED);
+
+        // Same WKB variant as OGRGeometryToHexEWKB() and GeometryToBYTEA()
+        const int nPostGISMajor = poDS->sPostGISVersion.nMajor;
+        const int nPostGISMinor = poDS->sPostGISVersion.nMinor;
+        const bool bPostGIS22OrLater =
+            nPostGISMajor > 2 || (nPostGISMajor == 2 && nPostGISMinor >= 2);
+        const OGRwkbVariant eWkbVariant =
+            (bPostGIS22OrLater &&
+             wkbFlatten(poGeom->getGeometryType()) == wkbPoint &&
+             poGeom->IsEmpty())
+                ? wkbVariantIso
+            : nPostGISMajor < 2 ? wkbVariantPostGIS1
+                                : wkbVariantOldOgc;
+
+        // EWKB inserts the SRID after the geometry type
+        const bool bWithSRID = m_aeCopyBinaryTypes[iCol] ==
+                                   CopyBinaryType::EWKB &&
+                               poGeomFieldDefn->nSRSId > 0;
+        const size_t nWkbSize = poGeom->WkbSize();
+        const size_t nSize = nWkbSize + (bWithSRID ? 4 : 0);
+        if (nSize > static_cast<size_t>(std::numeric_limits<int>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Too large geometry");
+            return OGRERR_FAILURE;
+        }
+        CopyBinaryAppendInt32(osBuffer, static_cast<GInt32>(nSize));
+        const size_t nOffset = osBuffer.size();
+        try
+        {
+            osBuffer.resize(nOffset + nSize);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory: too large geometry");
+            return OGRERR_FAILURE;
+        }
+        GByte *pabyWKB = reinterpret_cast<GByte *>(&osBuffer[nOffset]);
+        if (poGeom->exportToWkb(wkbNDR, pabyWKB + (bWithSRID ? 4 : 0),
+                                eWkbVariant) != OGRERR_NONE)
+        {
+            return OGRERR_FAILURE;
+        }
+        if (bWithSRID)
+        {
+            // Move the byte order and geometry type before the SRID
+            memmove(pabyWKB, pabyWKB + 4, 5);
+            pabyWKB[4] |= 0x20;  // SRID flag (0x20000000 in little endian)
+            const GInt32 nSRSId = CPL_LSBWORD32(poGeomFieldDefn->nSRSId);
+            memcpy(pabyWKB + 5, &nSRSId, 4);
+        }
+    }
+
+    int nFIDIndex = -1;
+    if (bFIDColumnInCopyFields)
+    {
+        nFIDIndex = poFeatureDefn->GetFieldIndex(pszFIDColumn);
+        if (poFeature->GetFID() == OGRNullFID)
+        {
+            CopyBinaryAppendInt32(osBuffer, -1);
+        }
+        else if (AppendInteger(m_aeCopyBinaryTypes[iCol], poFeature->GetFID(),
+                               pszFIDColumn) != OGRERR_NONE)
+        {
+            return OGRERR_FAILURE;
+        }
+        iCol++;
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (i == nFIDIndex || poFieldDefn->IsGenerated())
+            continue;
+
+        const CopyBinaryType eType = m_aeCopyBinaryTypes[iCol++];
+        const char *pszFieldName = poFieldDefn->GetNameRef();
+        if (!poFeature->IsFieldSetAndNotNull(i))
+        {
+            CopyBinaryAppendInt32(osBuffer, -1);
+            continue;
+        }
+
+        switch (eType)
+        {
+            case CopyBinaryType::INT2:
+            case CopyBinaryType::INT4:
+            case CopyBinaryType::INT8:
+                if (AppendInteger(eType, poFeature->GetFieldAsInteger64(i),
+                                  pszFieldName) != OGRERR_NONE)
+                    return OGRERR_FAILURE;
+                break;
+
+            case CopyBinaryType::BOOL:
+            {
+                // Only 0 and 1 are accepted by the text format
+                const int nVal = poFeature->GetFieldAsInteger(i);
+                if (nVal != 0 && nVal != 1)
+                    return ReportOutOfRange(pszFieldName);
+                CopyBinaryAppendInt32(osBuffer, 1);
+                osBuffer += static_cast<char>(nVal);
+                break;
+            }
+
+            case CopyBinaryType::FLOAT4:
+            {
+                const double dfVal = poFeature->GetFieldAsDouble(i);
+                if (std::isfinite(dfVal) &&
+                    std::fabs(dfVal) > std::numeric_limits<float>::max())
+                    return ReportOutOfRange(pszFieldName);
+                float fVal = static_cast<float>(dfVal);
+                CPL_MSBPTR32(&fVal);
+                CopyBinaryAppendInt32(osBuffer, 4);
+                osBuffer.append(reinterpret_cast<const char *>(&fVal), 4);
+                break;
+            }
+
+            case CopyBinaryType::FLOAT8:
+            {
+                double dfVal = poFeature->GetFieldAsDouble(i);
+                CPL_MSBPTR64(&dfVal);
+                CopyBinaryAppendInt32(osBuffer, 8);
+                osBuffer.append(reinterpret_cast<const char *>(&dfVal), 8);
+                break;
+            }
+
+            case CopyBinaryType::NUMERIC:
+            {
+                const double dfVal = poFeature->GetFieldAsDouble(i);
+                if (std::isnan(dfVal) || std::isinf(dfVal))
+                {
+                    constexpr GUInt16 NUMERIC_NAN = 0xC000;
+                    constexpr GUInt16 NUMERIC_PINF = 0xD000;
+                    constexpr GUInt16 NUMERIC_NINF = 0xF000;
+                    CopyBinaryAppendInt32(osBuffer, 8);
+                    CopyBinaryAppendInt16(osBuffer, 0);
+                    CopyBinaryAppendInt16(osBuffer, 0);
+                    CopyBinaryAppendInt16(
+                        osBuffer, static_cast<GInt16>(
+                                      std::isnan(dfVal) ? NUMERIC_NAN
+                                      : dfVal > 0       ? NUMERIC_PINF
+                                                        : NUMERIC_NINF));
+                    CopyBinaryAppendInt16(osBuffer, 0);
+                }
+                else if (!CopyBinaryAppendNumeric(
+                             osBuffer, poFeature->GetFieldAsString(i)))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot convert value '%s' of field %s to "
+                             "numeric",
+                             poFeature->GetFieldAsString(i), pszFieldName);
+                    return OGRERR_FAILURE;
+                }
+                break;
+            }
+
+            case CopyBinaryType::TEXT:
+            {
+                const char *pszStrValue = poFeature->GetFieldAsString(i);
+                size_t nLen = strlen(pszStrValue);
+                const int nMaxWidth = poFieldDefn->GetWidth();
+                if (nMaxWidth > 0)
+                {
+                    // Truncate to the width in characters, as done in
+                    // OGRPGCommonAppendCopyRegularFields()
+                    int iUTFChar = 0;
+                    for (size_t iChar = 0; iChar < nLen; iChar++)
+                    {
+                        if ((pszStrValue[iChar] & 0xc0) != 0x80)
+                        {
+                            if (iUTFChar == nMaxWidth)
+                            {
+                                CPLDebug("PG",
+                                         "Truncated %s field value, it was "
+                                         "too long.",
+                                         pszFieldName);
+                                nLen = iChar;
+                                break;
+                            }
+                            iUTFChar++;
+                        }
+                    }
+                }
+                if (poDS->IsUTF8ClientEncoding() &&
+                    !CPLIsUTF8(pszStrValue, static_cast<int>(nLen)))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Non UTF-8 content found when writing feature "
+                             CPL_FRMT_GIB " of layer %s: %s",
+                             poFeature->GetFID(), poFeatureDefn->GetName(),
+                             pszStrValue);
+                    return OGRERR_FAILURE;
+                }
+                CopyBinaryAppendInt32(osBuffer, static_cast<GInt32>(nLen));
+                osBuffer.append(pszStrValue, nLen);
+                break;
+            }
+
+            case CopyBinaryType::BYTEA:
+            {
+                int nLen = 0;
+                const GByte *pabyData = poFeature->GetFieldAsBinary(i, &nLen);
+                CopyBinaryAppendInt32(osBuffer, nLen);
+                osBuffer.append(reinterpret_cast<const char *>(pabyData),
+                                nLen);
+                break;
+            }
+
+            case CopyBinaryType::EWKB:
+            case CopyBinaryType::WKB:
+                CPLAssert(false);
+                return OGRERR_FAILURE;
+        }
+    }
+
+    return PutCopyData(osBuffer.data(), osBuffer.size());
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -3428,11 +3990,15 @@ OGRErr OGRPGTableLayer::StartCopy()
 
     CPLString osFields = BuildCopyFields();
 
+    // Must be done before the COPY, as no other statement can be issued
+    // during it.
+    m_bCopyBinary = ComputeCopyBinaryTypes();
+
     size_t size = osFields.size() + strlen(pszSqlTableName) + 100;
     char *pszCommand = static_cast<char *>(CPLMalloc(size));
 
-    snprintf(pszCommand, size, "COPY %s (%s) FROM STDIN;", pszSqlTableName,
-             osFields.c_str());
+    snprintf(pszCommand, size, "COPY %s (%s) FROM STDIN%s;", pszSqlTableName,
+             osFields.c_str(), m_bCopyBinary ? " WITH BINARY" : "");
 
     PGconn *hPGConn = poDS->GetPGConn();
     PGresult *hResult = OGRPG_PQexec(hPGConn, pszCommand);
@@ -3442,7 +4008,17 @@ OGRErr OGRPGTableLayer::StartCopy()
         CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
     }
     else
+    {
         bCopyActive = TRUE;
+        if (m_bCopyBinary)
+        {
+            // Signature, flags and header extension length
+            constexpr char achHeader[] = "PGCOPY\n\377\r\n\0"
+                                         "\0\0\0\0"
+                                         "\0\0\0\0";
+            PutCopyData(achHeader, sizeof(achHeader) - 1);
+        }
+    }
 
     OGRPGClearResult(hResult);
     CPLFree(pszCommand);
@@ -3470,6 +4046,14 @@ OGRErr OGRPGTableLayer::EndCopy()
 
     bCopyActive = FALSE;
 
+    if (m_bCopyBinary)
+    {
+        // File trailer: a tuple field count of -1
+        constexpr char achTrailer[] = "\377\377";
+        PutCopyData(achTrailer, sizeof(achTrailer) - 1);
+        m_bCopyBinary = false;
+    }
+
     int copyResult = PQputCopyEnd(hPGConn, nullptr);
 
     switch (copyResult)
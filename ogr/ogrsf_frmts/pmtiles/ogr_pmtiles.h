@@ -13,15 +13,18 @@
 #ifndef OGR_PMTILES_H_INCLUDED
 #define OGR_PMTILES_H_INCLUDED
 
+#include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "ogrsf_frmts.h"
 
 #include "cpl_compressor.h"
+#include "cpl_mem_cache.h"
 #include "cpl_vsi_virtual.h"
 
 #include "include_pmtiles.h"
 
 #include <limits>
+#include <map>
 #include <set>
 #include <stack>
 
@@ -74,6 +77,8 @@ class OGRPMTilesDataset final : public GDALDataset
 
     static const char *GetTileType(const pmtiles::headerv3 &sHeader);
 
+    static bool IsRasterTileType(const pmtiles::headerv3 &sHeader);
+
     inline const std::string &GetMetadataContent() const
     {
         return m_osMetadata;
@@ -100,6 +105,29 @@ class OGRPMTilesDataset final : public GDALDataset
      */
     const std::string *ReadTileData(uint64_t nOffset, uint64_t nSize);
 
+    /** Return the deserialized entries of the (root or leaf) directory
+     * at the specified offset, or nullptr in case of error.
+     * Directories are cached, so that browsing through tiles does not need
+     * to read and decompress them again.
+     */
+    std::shared_ptr<const std::vector<pmtiles::entryv3>>
+    GetDirectory(uint64_t nOffset, uint64_t nSize, const char *pszDataType);
+
+    //! Whether tile data is compressed
+    inline bool HasTileDataCompression() const
+    {
+        return m_psTileDataDecompressor != nullptr;
+    }
+
+    /** Read several ranges of raw tile data at once, which allows network
+     * file systems to coalesce them. Returns 0 in case of success.
+     */
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets, const size_t *panSizes)
+    {
+        return m_poFile->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+    }
+
   private:
     VSIVirtualHandleUniquePtr m_poFile{};
 
@@ -129,6 +157,11 @@ class OGRPMTilesDataset final : public GDALDataset
 
     std::vector<std::unique_ptr<OGRLayer>> m_apoLayers{};
 
+    //! Cache of deserialized directories, indexed by their file offset
+    lru11::Cache<uint64_t,
+                 std::shared_ptr<const std::vector<pmtiles::entryv3>>>
+        m_oDirectoryCache{32};
+
     //! Minimum zoom level got from header
     int m_nMinZoomLevel = 0;
 
@@ -333,6 +366,118 @@ class OGRPMTilesVectorLayer final
     CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesVectorLayer)
 };
 
+/************************************************************************/
+/*                       OGRPMTilesRasterDataset                        */
+/************************************************************************/
+
+class OGRPMTilesRasterDataset final : public GDALPamDataset
+{
+  public:
+    OGRPMTilesRasterDataset() = default;
+
+    ~OGRPMTilesRasterDataset() override;
+
+    bool Open(GDALOpenInfo *poOpenInfo);
+
+    CPLErr GetGeoTransform(GDALGeoTransform &gt) const override;
+
+    const OGRSpatialReference *GetSpatialRef() const override;
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+    static GDALDataset *CreateCopy(const char *pszFilename,
+                                   GDALDataset *poSrcDS, int bStrict,
+                                   char **papszOptions,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressData);
+
+  private:
+    friend class OGRPMTilesRasterBand;
+
+    //! Tile archive. Owned by the full resolution dataset
+    std::unique_ptr<OGRPMTilesDataset> m_poTileSourceOwned{};
+
+    //! Tile archive. Points to the one of the full resolution dataset
+    OGRPMTilesDataset *m_poTileSource = nullptr;
+
+    //! Overview datasets. Only set on the full resolution dataset
+    std::vector<std::unique_ptr<OGRPMTilesRasterDataset>> m_apoOverviewDS{};
+
+    //! Geotransform
+    GDALGeoTransform m_gt{};
+
+    //! EPSG:3857
+    OGRSpatialReference m_oSRS{};
+
+    //! Zoom level of this dataset
+    int m_nZoomLevel = 0;
+
+    //! Tile column of the left-most tiles
+    int m_nMinTileX = 0;
+
+    //! Tile row of the top-most tiles
+    int m_nMinTileY = 0;
+
+    //! Number of bands of the source tiles, once known
+    int m_nTileBandCount = 0;
+
+    //! Tile column and row of the tile in m_abyCachedTile, or -1
+    int m_nCachedTileX = -1;
+    int m_nCachedTileY = -1;
+
+    //! Last decoded tile, pixel-interleaved on nBands
+    std::vector<GByte> m_abyCachedTile{};
+
+    //! Raw tile data fetched by PrefetchTiles(), indexed by file offset
+    std::map<uint64_t, std::string> m_oMapPrefetchedTileData{};
+
+    //! Location of tiles found by PrefetchTiles(), indexed by (x, y)
+    std::map<std::pair<int, int>, std::pair<uint64_t, uint32_t>>
+        m_oMapPrefetchedTileLocation{};
+
+    bool InitRaster(OGRPMTilesRasterDataset *poParentDS, int nZoomLevel,
+                    int nBandCount, int nTileSize, double dfMinX,
+                    double dfMinY, double dfMaxX, double dfMaxY);
+
+    void PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize);
+
+    bool LoadTile(int nTileX, int nTileY);
+
+    bool DecodeTile(const std::string &osTileData);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesRasterDataset)
+};
+
+/************************************************************************/
+/*                        OGRPMTilesRasterBand                          */
+/************************************************************************/
+
+class OGRPMTilesRasterBand final : public GDALPamRasterBand
+{
+  public:
+    OGRPMTilesRasterBand(OGRPMTilesRasterDataset *poDS, int nBand,
+                         int nTileSize);
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) override;
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+    GDALColorInterp GetColorInterpretation() override;
+
+    int GetOverviewCount() override;
+
+    GDALRasterBand *GetOverview(int nIdx) override;
+};
+
 #ifdef HAVE_MVT_WRITE_SUPPORT
 
 /************************************************************************/
@@ -101,6 +101,18 @@ const char *OGRPMTilesDataset::GetTileType(const pmtiles::headerv3 &sHeader)
     return CPLSPrintf("invalid (%d)", sHeader.tile_type);
 }
 
+/************************************************************************/
+/*                         IsRasterTileType()                           */
+/************************************************************************/
+
+/* static */
+bool OGRPMTilesDataset::IsRasterTileType(const pmtiles::headerv3 &sHeader)
+{
+    return sHeader.tile_type == pmtiles::TILETYPE_PNG ||
+           sHeader.tile_type == pmtiles::TILETYPE_JPEG ||
+           sHeader.tile_type == pmtiles::TILETYPE_WEBP;
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /************************************************************************/
@@ -132,10 +144,16 @@ bool OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
     // Check tile type
     const bool bAcceptAnyTileType = CPLTestBool(CSLFetchNameValueDef(
         poOpenInfo->papszOpenOptions, "ACCEPT_ANY_TILE_TYPE", "NO"));
+    const bool bRasterTileType = IsRasterTileType(m_sHeader);
     if (bAcceptAnyTileType)
     {
         // do nothing. Internal use only by /vsipmtiles/
     }
+    else if (bRasterTileType &&
+             (poOpenInfo->nOpenFlags & GDAL_OF_RASTER) != 0)
+    {
+        // do nothing. Used by OGRPMTilesRasterDataset
+    }
     else if (m_sHeader.tile_type != pmtiles::TILETYPE_MVT)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -292,7 +310,7 @@ bool OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
         m_nMaxZoomLevel = 30;
     }
 
-    if (bAcceptAnyTileType)
+    if (bAcceptAnyTileType || bRasterTileType)
         return true;
 
     // If using the pmtiles go utility, vector_layers and tilestats are
@@ -452,3 +470,25 @@ const std::string *OGRPMTilesDataset::ReadTileData(uint64_t nOffset,
 {
     return Read(m_psTileDataDecompressor, nOffset, nSize, "tile data");
 }
+
+/************************************************************************/
+/*                             GetDirectory()                           */
+/************************************************************************/
+
+std::shared_ptr<const std::vector<pmtiles::entryv3>>
+OGRPMTilesDataset::GetDirectory(uint64_t nOffset, uint64_t nSize,
+                                const char *pszDataType)
+{
+    std::shared_ptr<const std::vector<pmtiles::entryv3>> poEntries;
+    if (m_oDirectoryCache.tryGet(nOffset, poEntries))
+        return poEntries;
+
+    const auto *posStr = ReadInternal(nOffset, nSize, pszDataType);
+    if (!posStr)
+        return nullptr;
+
+    poEntries = std::make_shared<const std::vector<pmtiles::entryv3>>(
+        pmtiles::deserialize_directory(*posStr));
+    m_oDirectoryCache.insert(nOffset, poEntries);
+    return poEntries;
+}
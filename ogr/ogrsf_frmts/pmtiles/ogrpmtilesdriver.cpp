@@ -39,6 +39,34 @@ static GDALDataset *OGRPMTilesDriverOpen(GDALOpenInfo *poOpenInfo)
 {
     if (!OGRPMTilesDriverIdentify(poOpenInfo))
         return nullptr;
+
+    if ((poOpenInfo->nOpenFlags & GDAL_OF_RASTER) != 0)
+    {
+        pmtiles::headerv3 sHeader;
+        try
+        {
+            sHeader = pmtiles::deserialize_header(std::string(
+                reinterpret_cast<const char *>(poOpenInfo->pabyHeader), 127));
+        }
+        catch (const std::exception &)
+        {
+            return nullptr;
+        }
+        if (OGRPMTilesDataset::IsRasterTileType(sHeader))
+        {
+            if (poOpenInfo->eAccess == GA_Update)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Update of raster PMTiles is not supported");
+                return nullptr;
+            }
+            auto poDS = std::make_unique<OGRPMTilesRasterDataset>();
+            if (!poDS->Open(poOpenInfo))
+                return nullptr;
+            return poDS.release();
+        }
+    }
+
     auto poDS = std::make_unique<OGRPMTilesDataset>();
     if (!poDS->Open(poOpenInfo))
         return nullptr;
@@ -148,6 +176,7 @@ void RegisterOGRPMTiles()
     GDALDriver *poDriver = new GDALDriver();
 
     poDriver->SetDescription("PMTiles");
+    poDriver->SetMetadataItem(GDAL_DCAP_RASTER, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_VECTOR, "YES");
     poDriver->SetMetadataItem(GDAL_DMD_LONGNAME, "ProtoMap Tiles");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "pmtiles");
@@ -160,14 +189,14 @@ void RegisterOGRPMTiles()
         "  <Option name='ZOOM_LEVEL' type='integer' "
         "description='Zoom level of full resolution. If not specified, maximum "
         "non-empty zoom level'/>"
-        "  <Option name='CLIP' type='boolean' "
+        "  <Option name='CLIP' scope='vector' type='boolean' "
         "description='Whether to clip geometries to tile extent' "
         "default='YES'/>"
-        "  <Option name='ZOOM_LEVEL_AUTO' type='boolean' "
+        "  <Option name='ZOOM_LEVEL_AUTO' scope='vector' type='boolean' "
         "description='Whether to auto-select the zoom level for vector layers "
         "according to spatial filter extent. Only for display purpose' "
         "default='NO'/>"
-        "  <Option name='JSON_FIELD' type='boolean' "
+        "  <Option name='JSON_FIELD' scope='vector' type='boolean' "
         "description='For vector layers, "
         "whether to put all attributes as a serialized JSon dictionary'/>"
         "</OpenOptionList>");
@@ -179,8 +208,9 @@ void RegisterOGRPMTiles()
     poDriver->pfnCanVectorTranslateFrom =
         OGRPMTilesDriverCanVectorTranslateFrom;
     poDriver->pfnVectorTranslateFrom = OGRPMTilesDriverVectorTranslateFrom;
+    poDriver->pfnCreateCopy = OGRPMTilesRasterDataset::CreateCopy;
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
 
-#ifdef HAVE_MVT_WRITE_SUPPORT
     poDriver->SetMetadataItem(
         GDAL_DMD_CREATIONOPTIONLIST,
         "<CreationOptionList>"
@@ -192,7 +222,51 @@ void RegisterOGRPMTiles()
         "description='Layer type' default='overlay'>"
         "    <Value>overlay</Value>"
         "    <Value>baselayer</Value>"
-        "  </Option>" MVT_MBTILES_PMTILES_COMMON_DSCO "</CreationOptionList>");
+        "  </Option>"
+        "  <Option name='TILE_FORMAT' scope='raster' type='string-select' "
+        "description='Format to use to create tiles' default='PNG'>"
+        "    <Value>PNG</Value>"
+        "    <Value>PNG8</Value>"
+        "    <Value>JPEG</Value>"
+        "    <Value>WEBP</Value>"
+        "  </Option>"
+        "  <Option name='QUALITY' scope='raster' type='int' min='1' max='100' "
+        "description='Quality for JPEG and WEBP tiles' default='75'/>"
+        "  <Option name='ZLEVEL' scope='raster' type='int' min='1' max='9' "
+        "description='DEFLATE compression level for PNG tiles' default='6'/>"
+        "  <Option name='DITHER' scope='raster' type='boolean' "
+        "description='Whether to apply Floyd-Steinberg dithering (for "
+        "TILE_FORMAT=PNG8)' default='NO'/>"
+        "  <Option name='BLOCKSIZE' scope='raster' type='int' "
+        "description='Block size in pixels' default='256' min='64' "
+        "max='8192'/>"
+        "  <Option name='ZOOM_LEVEL_STRATEGY' scope='raster' "
+        "type='string-select' description='Strategy to determine zoom level.' "
+        "default='AUTO'>"
+        "    <Value>AUTO</Value>"
+        "    <Value>LOWER</Value>"
+        "    <Value>UPPER</Value>"
+        "  </Option>"
+        "  <Option name='RESAMPLING' scope='raster' type='string-select' "
+        "description='Resampling algorithm.' default='BILINEAR'>"
+        "    <Value>NEAREST</Value>"
+        "    <Value>BILINEAR</Value>"
+        "    <Value>CUBIC</Value>"
+        "    <Value>CUBICSPLINE</Value>"
+        "    <Value>LANCZOS</Value>"
+        "    <Value>MODE</Value>"
+        "    <Value>AVERAGE</Value>"
+        "  </Option>"
+        "  <Option name='OVERVIEW_COUNT' scope='raster' type='int' min='0' "
+        "description='Number of overview levels (lower zoom levels) to "
+        "generate. By default, down to the zoom level at which the raster "
+        "fits into a single tile'/>"
+#ifdef HAVE_MVT_WRITE_SUPPORT
+        MVT_MBTILES_PMTILES_COMMON_DSCO
+#endif
+        "</CreationOptionList>");
+
+#ifdef HAVE_MVT_WRITE_SUPPORT
 
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_LAYER, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_FIELD, "YES");
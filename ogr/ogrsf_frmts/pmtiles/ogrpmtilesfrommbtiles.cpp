@@ -81,7 +81,16 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
     oObj.Set("scheme", "xyz");
 
     const auto osFormat = oObj.GetString("format", "{missing}");
-    if (osFormat != "pbf")
+    uint8_t nTileType;
+    if (osFormat == "pbf")
+        nTileType = pmtiles::TILETYPE_MVT;
+    else if (osFormat == "png")
+        nTileType = pmtiles::TILETYPE_PNG;
+    else if (osFormat == "jpg" || osFormat == "jpeg")
+        nTileType = pmtiles::TILETYPE_JPEG;
+    else if (osFormat == "webp")
+        nTileType = pmtiles::TILETYPE_WEBP;
+    else
     {
         CPLError(CE_Failure, CPLE_AppDefined, "format=%s unhandled",
                  osFormat.c_str());
@@ -102,8 +111,33 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         return false;
     }
 
+    const CPLStringList aosBounds(
+        CSLTokenizeString2(oObj.GetString("bounds").c_str(), ",", 0));
+    if (aosBounds.size() != 4)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Expected 4 values for bounds");
+        return false;
+    }
+    const double dfMinX = CPLAtof(aosBounds[0]);
+    const double dfMinY = CPLAtof(aosBounds[1]);
+    const double dfMaxX = CPLAtof(aosBounds[2]);
+    const double dfMaxY = CPLAtof(aosBounds[3]);
+    if (std::fabs(dfMinX) > 180 || std::fabs(dfMinY) > 90 ||
+        std::fabs(dfMaxX) > 180 || std::fabs(dfMaxY) > 90)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds");
+        return false;
+    }
+
+    // The raster MBTiles driver only writes center if explicitly asked for.
+    // Default to the center of the bounds at the minimum zoom level.
+    const std::string osCenter = oObj.GetString(
+        "center", nTileType == pmtiles::TILETYPE_MVT
+                      ? ""
+                      : CPLSPrintf("%.17g,%.17g,%d", (dfMinX + dfMaxX) / 2,
+                                   (dfMinY + dfMaxY) / 2, nMinZoom));
     const CPLStringList aosCenter(
-        CSLTokenizeString2(oObj.GetString("center").c_str(), ",", 0));
+        CSLTokenizeString2(osCenter.c_str(), ",", 0));
     if (aosCenter.size() != 3)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Expected 3 values for center");
@@ -123,24 +157,6 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         return false;
     }
 
-    const CPLStringList aosBounds(
-        CSLTokenizeString2(oObj.GetString("bounds").c_str(), ",", 0));
-    if (aosBounds.size() != 4)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Expected 4 values for bounds");
-        return false;
-    }
-    const double dfMinX = CPLAtof(aosBounds[0]);
-    const double dfMinY = CPLAtof(aosBounds[1]);
-    const double dfMaxX = CPLAtof(aosBounds[2]);
-    const double dfMaxY = CPLAtof(aosBounds[3]);
-    if (std::fabs(dfMinX) > 180 || std::fabs(dfMinY) > 90 ||
-        std::fabs(dfMaxX) > 180 || std::fabs(dfMaxY) > 90)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds");
-        return false;
-    }
-
     CPLJSONDocument oMetadataDoc;
     oMetadataDoc.SetRoot(oObj);
     osMetadata = oMetadataDoc.SaveAsString();
@@ -159,8 +175,12 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
     sHeader.tile_contents_count = 0;
     sHeader.clustered = true;
     sHeader.internal_compression = pmtiles::COMPRESSION_GZIP;
-    sHeader.tile_compression = pmtiles::COMPRESSION_GZIP;
-    sHeader.tile_type = pmtiles::TILETYPE_MVT;
+    // MVT tiles are GZip-compressed in MBTiles. Image formats are already
+    // compressed.
+    sHeader.tile_compression = nTileType == pmtiles::TILETYPE_MVT
+                                   ? pmtiles::COMPRESSION_GZIP
+                                   : pmtiles::COMPRESSION_NONE;
+    sHeader.tile_type = nTileType;
     sHeader.min_zoom = static_cast<uint8_t>(nMinZoom);
     sHeader.max_zoom = static_cast<uint8_t>(nMaxZoom);
     sHeader.min_lon_e7 = static_cast<int32_t>(dfMinX * 10e6);
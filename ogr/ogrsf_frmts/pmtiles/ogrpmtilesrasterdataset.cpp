@@ -0,0 +1,774 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implementation of PMTiles raster support
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_pmtiles.h"
+
+#include "ogrpmtilesfrommbtiles.h"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+
+// Maximum number of tiles whose data is fetched at once by PrefetchTiles()
+constexpr int MAX_PREFETCHED_TILES = 1024;
+
+// Maximum cumulated size of tile data fetched at once by PrefetchTiles()
+constexpr size_t MAX_PREFETCHED_BYTES = 100 * 1024 * 1024;
+
+/************************************************************************/
+/*                     ~OGRPMTilesRasterDataset()                       */
+/************************************************************************/
+
+OGRPMTilesRasterDataset::~OGRPMTilesRasterDataset()
+{
+    OGRPMTilesRasterDataset::FlushCache(true);
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+bool OGRPMTilesRasterDataset::Open(GDALOpenInfo *poOpenInfo)
+{
+    m_poTileSourceOwned = std::make_unique<OGRPMTilesDataset>();
+    if (!m_poTileSourceOwned->Open(poOpenInfo))
+        return false;
+    m_poTileSource = m_poTileSourceOwned.get();
+
+    SetDescription(poOpenInfo->pszFilename);
+
+    const auto &sHeader = m_poTileSource->GetHeader();
+    const int nMinZoomLevel = m_poTileSource->GetMinZoomLevel();
+    const int nMaxZoomLevel = m_poTileSource->GetMaxZoomLevel();
+    const int nZoomLevel =
+        atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "ZOOM_LEVEL",
+                                  CPLSPrintf("%d", nMaxZoomLevel)));
+    if (nZoomLevel < nMinZoomLevel || nZoomLevel > nMaxZoomLevel)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid zoom level. Should be in [%d,%d] range",
+                 nMinZoomLevel, nMaxZoomLevel);
+        return false;
+    }
+
+    // Figure out the tile dimension from a tile of the zoom level
+    int nTileSize = 256;
+    {
+        OGRPMTilesTileIterator oIter(m_poTileSource, nZoomLevel);
+        const auto sTile = oIter.GetNextTile();
+        if (sTile.offset != 0)
+        {
+            const auto *posStr =
+                m_poTileSource->ReadTileData(sTile.offset, sTile.length);
+            if (!posStr)
+                return false;
+            const std::string osTmpFilename =
+                VSIMemGenerateHiddenFilename("pmtiles_tile");
+            VSIFCloseL(VSIFileFromMemBuffer(
+                osTmpFilename.c_str(),
+                reinterpret_cast<GByte *>(const_cast<char *>(posStr->data())),
+                posStr->size(), false));
+            const char *const apszAllowedDrivers[] = {"PNG", "JPEG", "WEBP",
+                                                      nullptr};
+            auto poTileDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+                osTmpFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+                apszAllowedDrivers));
+            if (poTileDS)
+            {
+                nTileSize = poTileDS->GetRasterXSize();
+                if (poTileDS->GetRasterYSize() != nTileSize ||
+                    nTileSize < 64 || nTileSize > 8192)
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Unsupported tile dimension: %dx%d",
+                             poTileDS->GetRasterXSize(),
+                             poTileDS->GetRasterYSize());
+                    poTileDS.reset();
+                    VSIUnlink(osTmpFilename.c_str());
+                    return false;
+                }
+                poTileDS.reset();
+            }
+            VSIUnlink(osTmpFilename.c_str());
+        }
+    }
+
+    // Extent of the dataset, in EPSG:3857
+    constexpr double MAX_LAT = 85.0511287798066;
+    const double dfMinLon = sHeader.min_lon_e7 / 10e6;
+    const double dfMinLat = std::max(-MAX_LAT, sHeader.min_lat_e7 / 10e6);
+    const double dfMaxLon = sHeader.max_lon_e7 / 10e6;
+    const double dfMaxLat = std::min(MAX_LAT, sHeader.max_lat_e7 / 10e6);
+    if (!(dfMinLon < dfMaxLon && dfMinLat < dfMaxLat))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds in header");
+        return false;
+    }
+    const auto LongToX = [](double dfLon)
+    { return SPHERICAL_RADIUS * dfLon / 180 * M_PI; };
+    const auto LatToY = [](double dfLat)
+    {
+        return SPHERICAL_RADIUS *
+               log(tan(M_PI / 4 + 0.5 * dfLat / 180 * M_PI));
+    };
+    const double dfMinX = LongToX(dfMinLon);
+    const double dfMinY = LatToY(dfMinLat);
+    const double dfMaxX = LongToX(dfMaxLon);
+    const double dfMaxY = LatToY(dfMaxLat);
+
+    // JPEG tiles have no transparency. Otherwise expose an alpha band, to
+    // make the difference between missing and non-empty tiles.
+    const int nBandCount = sHeader.tile_type == pmtiles::TILETYPE_JPEG ? 3 : 4;
+
+    if (!InitRaster(nullptr, nZoomLevel, nBandCount, nTileSize, dfMinX, dfMinY,
+                    dfMaxX, dfMaxY))
+    {
+        return false;
+    }
+
+    for (int nOvrZoomLevel = nZoomLevel - 1; nOvrZoomLevel >= nMinZoomLevel;
+         --nOvrZoomLevel)
+    {
+        auto poOvrDS = std::make_unique<OGRPMTilesRasterDataset>();
+        if (!poOvrDS->InitRaster(this, nOvrZoomLevel, nBandCount, nTileSize,
+                                 dfMinX, dfMinY, dfMaxX, dfMaxY))
+        {
+            break;
+        }
+        m_apoOverviewDS.push_back(std::move(poOvrDS));
+    }
+
+    GDALDataset::SetMetadata(m_poTileSource->GetMetadata());
+    GDALDataset::SetMetadataItem("ZOOM_LEVEL", CPLSPrintf("%d", nZoomLevel));
+    GDALDataset::SetMetadataItem("INTERLEAVE", "PIXEL", "IMAGE_STRUCTURE");
+
+    TryLoadXML(poOpenInfo->GetSiblingFiles());
+
+    return true;
+}
+
+/************************************************************************/
+/*                             InitRaster()                             */
+/************************************************************************/
+
+bool OGRPMTilesRasterDataset::InitRaster(OGRPMTilesRasterDataset *poParentDS,
+                                         int nZoomLevel, int nBandCount,
+                                         int nTileSize, double dfMinX,
+                                         double dfMinY, double dfMaxX,
+                                         double dfMaxY)
+{
+    if (poParentDS)
+    {
+        m_poTileSource = poParentDS->m_poTileSource;
+        SetDescription(poParentDS->GetDescription());
+        SetPamFlags(GetPamFlags() | GPF_DISABLED);
+    }
+
+    m_nZoomLevel = nZoomLevel;
+    const int nMatrixSize = 1 << nZoomLevel;
+    const double dfTileExtent = 2 * MAX_GM / nMatrixSize;
+    const auto ToTileIdx = [nMatrixSize](double dfVal)
+    {
+        return static_cast<int>(std::clamp(dfVal, 0.0, nMatrixSize - 1.0));
+    };
+    m_nMinTileX = ToTileIdx(std::floor((dfMinX + MAX_GM) / dfTileExtent));
+    m_nMinTileY = ToTileIdx(std::floor((MAX_GM - dfMaxY) / dfTileExtent));
+    const int nMaxTileX =
+        std::max(m_nMinTileX,
+                 ToTileIdx(std::ceil((dfMaxX + MAX_GM) / dfTileExtent) - 1));
+    const int nMaxTileY =
+        std::max(m_nMinTileY,
+                 ToTileIdx(std::ceil((MAX_GM - dfMinY) / dfTileExtent) - 1));
+
+    if (nMaxTileX - m_nMinTileX + 1 > INT_MAX / nTileSize ||
+        nMaxTileY - m_nMinTileY + 1 > INT_MAX / nTileSize)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Too large raster for zoom level %d", nZoomLevel);
+        return false;
+    }
+    nRasterXSize = (nMaxTileX - m_nMinTileX + 1) * nTileSize;
+    nRasterYSize = (nMaxTileY - m_nMinTileY + 1) * nTileSize;
+
+    m_gt[0] = -MAX_GM + m_nMinTileX * dfTileExtent;
+    m_gt[1] = dfTileExtent / nTileSize;
+    m_gt[3] = MAX_GM - m_nMinTileY * dfTileExtent;
+    m_gt[5] = -m_gt[1];
+
+    m_oSRS.importFromEPSG(3857);
+    m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+
+    try
+    {
+        m_abyCachedTile.resize(static_cast<size_t>(nTileSize) * nTileSize *
+                               nBandCount);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate tile buffer");
+        return false;
+    }
+
+    for (int i = 1; i <= nBandCount; ++i)
+        SetBand(i, new OGRPMTilesRasterBand(this, i, nTileSize));
+
+    return true;
+}
+
+/************************************************************************/
+/*                          GetGeoTransform()                           */
+/************************************************************************/
+
+CPLErr OGRPMTilesRasterDataset::GetGeoTransform(GDALGeoTransform &gt) const
+{
+    gt = m_gt;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                           GetSpatialRef()                            */
+/************************************************************************/
+
+const OGRSpatialReference *OGRPMTilesRasterDataset::GetSpatialRef() const
+{
+    return &m_oSRS;
+}
+
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+// Locate all the tiles intersecting the window of interest, and fetch the
+// data of the ones not already in the block cache with a single
+// ReadMultiRange() call, which network file systems can coalesce into a
+// few HTTP range requests.
+void OGRPMTilesRasterDataset::PrefetchTiles(int nXOff, int nYOff, int nXSize,
+                                            int nYSize)
+{
+    int nTileSize = 0;
+    papoBands[0]->GetBlockSize(&nTileSize, &nTileSize);
+    const int nBlockXStart = nXOff / nTileSize;
+    const int nBlockYStart = nYOff / nTileSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nTileSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nTileSize;
+    if ((nBlockXStart == nBlockXEnd && nBlockYStart == nBlockYEnd) ||
+        (nBlockXEnd - nBlockXStart + 1) >
+            MAX_PREFETCHED_TILES / (nBlockYEnd - nBlockYStart + 1))
+    {
+        return;
+    }
+
+    // Skip tiles whose location is already known, or are in the block cache
+    std::vector<std::pair<int, int>> anTilesToLocate;
+    for (int nBlockYOff = nBlockYStart; nBlockYOff <= nBlockYEnd; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nBlockXStart; nBlockXOff <= nBlockXEnd;
+             ++nBlockXOff)
+        {
+            const std::pair<int, int> oTileXY(m_nMinTileX + nBlockXOff,
+                                              m_nMinTileY + nBlockYOff);
+            if (cpl::contains(m_oMapPrefetchedTileLocation, oTileXY))
+                continue;
+            auto poBlock =
+                papoBands[0]->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            anTilesToLocate.push_back(oTileXY);
+        }
+    }
+    if (anTilesToLocate.size() < 2)
+        return;
+
+    m_oMapPrefetchedTileLocation.clear();
+    m_oMapPrefetchedTileData.clear();
+    for (const auto &oTileXY : anTilesToLocate)
+    {
+        // Missing tiles are marked with a zero offset
+        m_oMapPrefetchedTileLocation[oTileXY] = std::pair<uint64_t, uint32_t>(
+            0, 0);
+    }
+
+    OGRPMTilesTileIterator oIter(m_poTileSource, m_nZoomLevel,
+                                 m_nMinTileX + nBlockXStart,
+                                 m_nMinTileY + nBlockYStart,
+                                 m_nMinTileX + nBlockXEnd,
+                                 m_nMinTileY + nBlockYEnd);
+    std::map<uint64_t, uint32_t> oMapOffsetToLength;
+    while (true)
+    {
+        const auto sTile = oIter.GetNextTile();
+        if (sTile.offset == 0)
+            break;
+        const std::pair<int, int> oTileXY(static_cast<int>(sTile.x),
+                                          static_cast<int>(sTile.y));
+        auto oIterLoc = m_oMapPrefetchedTileLocation.find(oTileXY);
+        if (oIterLoc != m_oMapPrefetchedTileLocation.end())
+        {
+            oIterLoc->second =
+                std::pair<uint64_t, uint32_t>(sTile.offset, sTile.length);
+            // Deduplicated tiles share the same offset: read them once
+            oMapOffsetToLength[sTile.offset] = sTile.length;
+        }
+    }
+
+    // Tile data must be read as it is stored for ReadMultiRange() to be
+    // used.
+    if (oMapOffsetToLength.size() < 2 ||
+        m_poTileSource->HasTileDataCompression())
+    {
+        return;
+    }
+
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    size_t nTotalSize = 0;
+    for (const auto &[nOffset, nLength] : oMapOffsetToLength)
+    {
+        nTotalSize += nLength;
+        if (nTotalSize > MAX_PREFETCHED_BYTES)
+        {
+            m_oMapPrefetchedTileData.clear();
+            return;
+        }
+        auto &osData = m_oMapPrefetchedTileData[nOffset];
+        osData.resize(nLength);
+        apData.push_back(osData.data());
+        anOffsets.push_back(nOffset);
+        anSizes.push_back(nLength);
+    }
+
+    if (m_poTileSource->ReadMultiRange(static_cast<int>(apData.size()),
+                                       apData.data(), anOffsets.data(),
+                                       anSizes.data()) != 0)
+    {
+        // Fallback to reading tiles one by one
+        m_oMapPrefetchedTileData.clear();
+    }
+}
+
+/************************************************************************/
+/*                             LoadTile()                               */
+/************************************************************************/
+
+// Decode the tile at (nTileX, nTileY) in m_abyCachedTile
+bool OGRPMTilesRasterDataset::LoadTile(int nTileX, int nTileY)
+{
+    if (nTileX == m_nCachedTileX && nTileY == m_nCachedTileY)
+        return true;
+    m_nCachedTileX = -1;
+    m_nCachedTileY = -1;
+
+    uint64_t nOffset = 0;
+    uint32_t nLength = 0;
+    const std::pair<int, int> oTileXY(nTileX, nTileY);
+    const auto oIterLoc = m_oMapPrefetchedTileLocation.find(oTileXY);
+    if (oIterLoc != m_oMapPrefetchedTileLocation.end())
+    {
+        nOffset = oIterLoc->second.first;
+        nLength = oIterLoc->second.second;
+    }
+    else
+    {
+        OGRPMTilesTileIterator oIter(m_poTileSource, m_nZoomLevel, nTileX,
+                                     nTileY, nTileX, nTileY);
+        const auto sTile = oIter.GetNextTile();
+        nOffset = sTile.offset;
+        nLength = sTile.length;
+    }
+
+    bool bRet = true;
+    if (nOffset == 0)
+    {
+        // Missing tile
+        std::fill(m_abyCachedTile.begin(), m_abyCachedTile.end(), 0);
+    }
+    else
+    {
+        const auto oIterData = m_oMapPrefetchedTileData.find(nOffset);
+        if (oIterData != m_oMapPrefetchedTileData.end())
+        {
+            bRet = DecodeTile(oIterData->second);
+        }
+        else
+        {
+            const auto *posStr = m_poTileSource->ReadTileData(nOffset, nLength);
+            bRet = posStr != nullptr && DecodeTile(*posStr);
+        }
+    }
+
+    if (bRet)
+    {
+        m_nCachedTileX = nTileX;
+        m_nCachedTileY = nTileY;
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                            DecodeTile()                              */
+/************************************************************************/
+
+// Decode a PNG/JPEG/WEBP tile into m_abyCachedTile, expanding grey levels,
+// color tables and missing alpha channel to our nBands pixel-interleaved
+// layout.
+bool OGRPMTilesRasterDataset::DecodeTile(const std::string &osTileData)
+{
+    const std::string osTmpFilename =
+        VSIMemGenerateHiddenFilename("pmtiles_tile");
+    VSIFCloseL(VSIFileFromMemBuffer(
+        osTmpFilename.c_str(),
+        reinterpret_cast<GByte *>(const_cast<char *>(osTileData.data())),
+        osTileData.size(), false));
+
+    const char *const apszAllowedDrivers[] = {"PNG", "JPEG", "WEBP", nullptr};
+    auto poTileDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        osTmpFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+        apszAllowedDrivers));
+
+    int nTileSize = 0;
+    papoBands[0]->GetBlockSize(&nTileSize, &nTileSize);
+    bool bRet = false;
+    if (!poTileDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot decode tile");
+    }
+    else if (poTileDS->GetRasterXSize() != nTileSize ||
+             poTileDS->GetRasterYSize() != nTileSize ||
+             poTileDS->GetRasterCount() == 0 ||
+             poTileDS->GetRasterCount() > 4)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Tile has unexpected dimensions or band count");
+    }
+    else
+    {
+        const int nTileBands = poTileDS->GetRasterCount();
+        const GDALColorTable *poCT =
+            nTileBands == 1 ? poTileDS->GetRasterBand(1)->GetColorTable()
+                            : nullptr;
+        const size_t nPixels = static_cast<size_t>(nTileSize) * nTileSize;
+        const bool bHasAlphaInTile = nTileBands == 2 || nTileBands == 4;
+        if (poCT)
+        {
+            std::vector<GByte> abyIndices(nPixels);
+            bRet = poTileDS->GetRasterBand(1)->RasterIO(
+                       GF_Read, 0, 0, nTileSize, nTileSize, abyIndices.data(),
+                       nTileSize, nTileSize, GDT_Byte, 0, 0,
+                       nullptr) == CE_None;
+            std::array<std::array<GByte, 4>, 256> aabyLUT{};
+            for (int i = 0; i < std::min(256, poCT->GetColorEntryCount()); ++i)
+            {
+                const auto psEntry = poCT->GetColorEntry(i);
+                aabyLUT[i] = {static_cast<GByte>(psEntry->c1),
+                              static_cast<GByte>(psEntry->c2),
+                              static_cast<GByte>(psEntry->c3),
+                              static_cast<GByte>(psEntry->c4)};
+            }
+            for (size_t i = 0; bRet && i < nPixels; ++i)
+            {
+                memcpy(&m_abyCachedTile[i * nBands],
+                       aabyLUT[abyIndices[i]].data(), nBands);
+            }
+        }
+        else
+        {
+            // Map our R,G,B[,A] bands to the ones of the tile
+            std::array<int, 4> anBandMap{};
+            const bool bGrey = nTileBands <= 2;
+            for (int i = 0; i < 3; ++i)
+                anBandMap[i] = bGrey ? 1 : i + 1;
+            int nBandsToRead = 3;
+            if (nBands == 4 && bHasAlphaInTile)
+            {
+                anBandMap[3] = nTileBands;
+                nBandsToRead = 4;
+            }
+            bRet = poTileDS->RasterIO(
+                       GF_Read, 0, 0, nTileSize, nTileSize,
+                       m_abyCachedTile.data(), nTileSize, nTileSize, GDT_Byte,
+                       nBandsToRead, anBandMap.data(), nBands,
+                       static_cast<GSpacing>(nBands) * nTileSize, 1,
+                       nullptr) == CE_None;
+            if (bRet && nBands == 4 && !bHasAlphaInTile)
+            {
+                for (size_t i = 0; i < nPixels; ++i)
+                    m_abyCachedTile[i * nBands + 3] = 255;
+            }
+        }
+    }
+
+    poTileDS.reset();
+    VSIUnlink(osTmpFilename.c_str());
+    return bRet;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr OGRPMTilesRasterDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    // Requests at a lower resolution are redirected to overviews, which
+    // will do their own prefetching.
+    if (eRWFlag == GF_Read && nBufXSize >= nXSize && nBufYSize >= nYSize)
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                        OGRPMTilesRasterBand()                        */
+/************************************************************************/
+
+OGRPMTilesRasterBand::OGRPMTilesRasterBand(OGRPMTilesRasterDataset *poDSIn,
+                                           int nBandIn, int nTileSize)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    eDataType = GDT_Byte;
+    nRasterXSize = poDSIn->GetRasterXSize();
+    nRasterYSize = poDSIn->GetRasterYSize();
+    nBlockXSize = nTileSize;
+    nBlockYSize = nTileSize;
+}
+
+/************************************************************************/
+/*                            IReadBlock()                              */
+/************************************************************************/
+
+CPLErr OGRPMTilesRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                        void *pData)
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesRasterDataset *>(poDS);
+    if (!poGDS->LoadTile(poGDS->m_nMinTileX + nBlockXOff,
+                         poGDS->m_nMinTileY + nBlockYOff))
+    {
+        return CE_Failure;
+    }
+
+    // Also fill the blocks of the other bands, since we have decoded the
+    // whole tile.
+    const int nBands = poGDS->GetRasterCount();
+    const int nPixels = nBlockXSize * nBlockYSize;
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        if (iBand == nBand)
+        {
+            GDALCopyWords(poGDS->m_abyCachedTile.data() + iBand - 1, GDT_Byte,
+                          nBands, pData, GDT_Byte, 1, nPixels);
+            continue;
+        }
+        auto poOtherBand = poGDS->GetRasterBand(iBand);
+        GDALRasterBlock *poBlock =
+            poOtherBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+        if (poBlock)
+        {
+            poBlock->DropLock();
+            continue;
+        }
+        poBlock = poOtherBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+        if (poBlock)
+        {
+            GDALCopyWords(poGDS->m_abyCachedTile.data() + iBand - 1, GDT_Byte,
+                          nBands, poBlock->GetDataRef(), GDT_Byte, 1, nPixels);
+            poBlock->DropLock();
+        }
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr OGRPMTilesRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff,
+                                       int nYOff, int nXSize, int nYSize,
+                                       void *pData, int nBufXSize,
+                                       int nBufYSize, GDALDataType eBufType,
+                                       GSpacing nPixelSpace,
+                                       GSpacing nLineSpace,
+                                       GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBufXSize >= nXSize && nBufYSize >= nYSize)
+    {
+        cpl::down_cast<OGRPMTilesRasterDataset *>(poDS)->PrefetchTiles(
+            nXOff, nYOff, nXSize, nYSize);
+    }
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                      GetColorInterpretation()                        */
+/************************************************************************/
+
+GDALColorInterp OGRPMTilesRasterBand::GetColorInterpretation()
+{
+    return static_cast<GDALColorInterp>(GCI_RedBand + nBand - 1);
+}
+
+/************************************************************************/
+/*                          GetOverviewCount()                          */
+/************************************************************************/
+
+int OGRPMTilesRasterBand::GetOverviewCount()
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesRasterDataset *>(poDS);
+    return static_cast<int>(poGDS->m_apoOverviewDS.size());
+}
+
+/************************************************************************/
+/*                            GetOverview()                             */
+/************************************************************************/
+
+GDALRasterBand *OGRPMTilesRasterBand::GetOverview(int nIdx)
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesRasterDataset *>(poDS);
+    if (nIdx < 0 || nIdx >= GetOverviewCount())
+        return nullptr;
+    return poGDS->m_apoOverviewDS[nIdx]->GetRasterBand(nBand);
+}
+
+/************************************************************************/
+/*                            CreateCopy()                              */
+/************************************************************************/
+
+// Raster tiles are generated with the MBTiles driver in a temporary file,
+// which is then converted to a PMTiles file, with deduplication of tiles
+// and a clustered layout, as done for vector tiles.
+GDALDataset *OGRPMTilesRasterDataset::CreateCopy(
+    const char *pszFilename, GDALDataset *poSrcDS, int bStrict,
+    char **papszOptions, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    auto poMBTilesDriver = GetGDALDriverManager()->GetDriverByName("MBTiles");
+    if (!poMBTilesDriver)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Creation of raster PMTiles requires the MBTiles driver");
+        return nullptr;
+    }
+
+    const char *pszTileFormat =
+        CSLFetchNameValueDef(papszOptions, "TILE_FORMAT", "PNG");
+    if (!EQUAL(pszTileFormat, "PNG") && !EQUAL(pszTileFormat, "PNG8") &&
+        !EQUAL(pszTileFormat, "JPEG") && !EQUAL(pszTileFormat, "WEBP"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported value for TILE_FORMAT: %s", pszTileFormat);
+        return nullptr;
+    }
+
+    CPLStringList aosOptions(papszOptions);
+    const char *pszOverviewCount = aosOptions.FetchNameValue("OVERVIEW_COUNT");
+    const int nOverviewCount = pszOverviewCount ? atoi(pszOverviewCount) : -1;
+    aosOptions.SetNameValue("OVERVIEW_COUNT", nullptr);
+    if (!aosOptions.FetchNameValue("NAME"))
+        aosOptions.SetNameValue("NAME",
+                                CPLGetBasenameSafe(pszFilename).c_str());
+
+    std::string osTmpFile(pszFilename);
+    if (!VSIIsLocal(pszFilename))
+    {
+        osTmpFile = CPLGenerateTempFilenameSafe(CPLGetFilename(pszFilename));
+    }
+    osTmpFile += ".tmp.mbtiles";
+
+    void *pScaledProgress =
+        GDALCreateScaledProgress(0.0, 0.8, pfnProgress, pProgressData);
+    auto poMBTilesDS = std::unique_ptr<GDALDataset>(poMBTilesDriver->CreateCopy(
+        osTmpFile.c_str(), poSrcDS, bStrict, aosOptions.List(),
+        pScaledProgress ? GDALScaledProgress : nullptr, pScaledProgress));
+    GDALDestroyScaledProgress(pScaledProgress);
+    if (!poMBTilesDS)
+    {
+        VSIUnlink(osTmpFile.c_str());
+        return nullptr;
+    }
+
+    // Build overviews down to the zoom level at which the whole raster
+    // fits into a single tile, or the number specified by the user.
+    const int nMaxZoom =
+        atoi(CSLFetchNameValueDef(poMBTilesDS->GetMetadata(), "ZOOM_LEVEL",
+                                  "0"));
+    int nTileSize = 0;
+    poMBTilesDS->GetRasterBand(1)->GetBlockSize(&nTileSize, &nTileSize);
+    int nMinZoom = nMaxZoom;
+    if (nOverviewCount >= 0)
+    {
+        nMinZoom = std::max(0, nMaxZoom - nOverviewCount);
+    }
+    else
+    {
+        int nMaxDim = std::max(poMBTilesDS->GetRasterXSize(),
+                               poMBTilesDS->GetRasterYSize());
+        while (nMinZoom > 0 && nMaxDim > nTileSize)
+        {
+            --nMinZoom;
+            nMaxDim = DIV_ROUND_UP(nMaxDim, 2);
+        }
+    }
+
+    bool bRet = true;
+    if (nMinZoom < nMaxZoom)
+    {
+        std::vector<int> anOverviewList;
+        for (int nZoom = nMaxZoom - 1; nZoom >= nMinZoom; --nZoom)
+            anOverviewList.push_back(1 << (nMaxZoom - nZoom));
+        std::vector<int> anBandList;
+        for (int i = 1; i <= poMBTilesDS->GetRasterCount(); ++i)
+            anBandList.push_back(i);
+        pScaledProgress =
+            GDALCreateScaledProgress(0.8, 0.95, pfnProgress, pProgressData);
+        bRet = poMBTilesDS->BuildOverviews(
+                   CSLFetchNameValueDef(papszOptions, "RESAMPLING",
+                                        "BILINEAR"),
+                   static_cast<int>(anOverviewList.size()),
+                   anOverviewList.data(), static_cast<int>(anBandList.size()),
+                   anBandList.data(),
+                   pScaledProgress ? GDALScaledProgress : nullptr,
+                   pScaledProgress, nullptr) == CE_None;
+        GDALDestroyScaledProgress(pScaledProgress);
+    }
+
+    bRet = poMBTilesDS->Close() == CE_None && bRet;
+    poMBTilesDS.reset();
+
+    bRet = bRet && OGRPMTilesConvertFromMBTiles(pszFilename, osTmpFile.c_str());
+    VSIUnlink(osTmpFile.c_str());
+    if (!bRet)
+        return nullptr;
+
+    if (pfnProgress)
+        pfnProgress(1.0, "", pProgressData);
+
+    GDALOpenInfo oOpenInfo(pszFilename, GDAL_OF_RASTER | GA_ReadOnly);
+    auto poDS = std::make_unique<OGRPMTilesRasterDataset>();
+    if (!poDS->Open(&oOpenInfo))
+        return nullptr;
+    return poDS.release();
+}
@@ -23,6 +23,8 @@
 #include "shapefil.h"
 #include "shp_vsi.h"
 #include "ogrlayerpool.h"
+#include "ogrsidecarspatialindex.h"
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -38,7 +40,8 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToFill = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
@@ -136,6 +139,11 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     SBNSearchHandle m_hSBN = nullptr;
     bool CheckForSBN();
 
+    bool m_bCheckedForSidecarSpatialIndex = false;
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSidecarSpatialIndex{};
+    bool CheckForSidecarSpatialIndex();
+    OGRErr CreateSidecarSpatialIndex();
+
     bool m_bSbnSbxDeleted = false;
 
     CPLString ConvertCodePage(const char *);
@@ -186,6 +194,8 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     bool StartUpdate(const char *pszOperation);
 
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToFill);
+
     void CloseUnderlyingLayer() override;
 
     // WARNING: Each of the below public methods should start with a call to
@@ -211,7 +221,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId, OGRFeature *poFeatureToFill = nullptr);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -226,6 +236,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool FillNextFeature(OGRFeature &oFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
@@ -1228,7 +1228,8 @@ const char *const *OGRShapeDataSource::GetExtensionsForDeletion()
 {
     static const char *const apszExtensions[] = {
         "shp",  "shx", "dbf", "sbn", "sbx", "prj", "idm", "ind", "qix", "cpg",
-        "qpj",  // QGIS projection file
+        "qpj",          // QGIS projection file
+        "shp.ogrsidx",  // OGRSidecarSpatialIndex
         nullptr};
     return apszExtensions;
 }
@@ -14,6 +14,7 @@
 #include "ogrshape.h"
 
 #include <cerrno>
+#include <climits>
 #include <limits>
 #include <cmath>
 #include <cstddef>
@@ -22,6 +23,7 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
 #include <string>
 
 #include "cpl_conv.h"
@@ -31,6 +33,9 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "gdal_thread_pool.h"
+#include "include_fast_float.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -612,6 +617,29 @@ bool OGRShapeLayer::CheckForSBN()
     return m_hSBN != nullptr;
 }
 
+/************************************************************************/
+/*                    CheckForSidecarSpatialIndex()                     */
+/************************************************************************/
+
+bool OGRShapeLayer::CheckForSidecarSpatialIndex()
+
+{
+    if (m_bCheckedForSidecarSpatialIndex)
+        return m_poSidecarSpatialIndex != nullptr;
+
+    // The index is checked against the .shp file.
+    if (m_hSHP == nullptr || m_poFeatureDefn->GetGeomFieldCount() == 0)
+        return false;
+
+    m_poSidecarSpatialIndex = OGRSidecarSpatialIndex::Open(
+        VSI_SHP_GetFilename(m_hSHP->fpSHP),
+        m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef());
+
+    m_bCheckedForSidecarSpatialIndex = true;
+
+    return m_poSidecarSpatialIndex != nullptr;
+}
+
 /************************************************************************/
 /*                            ScanIndices()                             */
 /*                                                                      */
@@ -675,16 +703,21 @@ bool OGRShapeLayer::ScanIndices()
 
     if (bTryQIXorSBN)
     {
-        if (!m_bCheckedForQIX)
+        if (!m_bCheckedForSidecarSpatialIndex)
+            CPL_IGNORE_RET_VAL(CheckForSidecarSpatialIndex());
+        if (m_poSidecarSpatialIndex == nullptr && !m_bCheckedForQIX)
             CPL_IGNORE_RET_VAL(CheckForQIX());
-        if (m_hQIX == nullptr && !m_bCheckedForSBN)
+        if (m_poSidecarSpatialIndex == nullptr && m_hQIX == nullptr &&
+            !m_bCheckedForSBN)
             CPL_IGNORE_RET_VAL(CheckForSBN());
     }
 
     /* -------------------------------------------------------------------- */
     /*      Compute spatial index if appropriate.                           */
     /* -------------------------------------------------------------------- */
-    if (bTryQIXorSBN && (m_hQIX != nullptr || m_hSBN != nullptr) &&
+    if (bTryQIXorSBN &&
+        (m_poSidecarSpatialIndex != nullptr || m_hQIX != nullptr ||
+         m_hSBN != nullptr) &&
         m_panSpatialFIDs == nullptr)
     {
         double adfBoundsMin[4] = {oSpatialFilterEnvelope.MinX,
@@ -692,7 +725,30 @@ bool OGRShapeLayer::ScanIndices()
         double adfBoundsMax[4] = {oSpatialFilterEnvelope.MaxX,
                                   oSpatialFilterEnvelope.MaxY, 0.0, 0.0};
 
-        if (m_hQIX != nullptr)
+        if (m_poSidecarSpatialIndex != nullptr)
+        {
+            std::vector<OGRSidecarSpatialIndex::Entry> aoEntries;
+            if (m_poSidecarSpatialIndex->Search(oSpatialFilterEnvelope,
+                                                aoEntries))
+            {
+                m_nSpatialFIDCount = static_cast<int>(aoEntries.size());
+                m_panSpatialFIDs = static_cast<int *>(malloc(
+                    sizeof(int) * std::max<size_t>(1, aoEntries.size())));
+                if (m_panSpatialFIDs != nullptr)
+                {
+                    for (int i = 0; i < m_nSpatialFIDCount; i++)
+                        m_panSpatialFIDs[i] =
+                            static_cast<int>(aoEntries[i].nFID);
+                    std::sort(m_panSpatialFIDs,
+                              m_panSpatialFIDs + m_nSpatialFIDCount);
+                }
+                else
+                {
+                    m_nSpatialFIDCount = 0;
+                }
+            }
+        }
+        else if (m_hQIX != nullptr)
             m_panSpatialFIDs = SHPSearchDiskTreeEx(
                 m_hQIX, adfBoundsMin, adfBoundsMax, &m_nSpatialFIDCount);
         else
@@ -882,7 +938,8 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToFill)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -903,7 +960,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          m_bHasWarnedWrongWindingOrder,
+                                          poFeatureToFill);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -917,14 +975,15 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          m_bHasWarnedWrongWindingOrder,
+                                          poFeatureToFill);
         }
     }
     else
     {
-        poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId,
-                                      nullptr, m_osEncoding,
-                                      m_bHasWarnedWrongWindingOrder);
+        poFeature = SHPReadOGRFeature(
+            m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId, nullptr, m_osEncoding,
+            m_bHasWarnedWrongWindingOrder, poFeatureToFill);
     }
 
     return poFeature;
@@ -936,6 +995,30 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                          FillNextFeature()                           */
+/************************************************************************/
+
+bool OGRShapeLayer::FillNextFeature(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::FillNextFeature(oFeature);
+    return GetNextFeatureInternal(&oFeature) != nullptr;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+// If poFeatureToFill is not null, it is filled with the next feature instead
+// of a new feature being allocated, and it is returned.
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToFill)
+
 {
     if (!TouchLayer())
         return nullptr;
@@ -968,7 +1051,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]));
+                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]),
+                           poFeatureToFill);
 
             m_iMatchingFID++;
         }
@@ -987,10 +1071,10 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                          VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(m_iNextShapeId);
+                    poFeature = FetchShape(m_iNextShapeId, poFeatureToFill);
             }
             else
-                poFeature = FetchShape(m_iNextShapeId);
+                poFeature = FetchShape(m_iNextShapeId, poFeatureToFill);
 
             m_iNextShapeId++;
         }
@@ -1012,7 +1096,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToFill)
+                delete poFeature;
         }
     }
 }
@@ -1088,7 +1173,7 @@ OGRErr OGRShapeLayer::ISetFeature(OGRFeature *poFeature)
     }
 
     m_bHeaderDirty = true;
-    if (CheckForQIX() || CheckForSBN())
+    if (CheckForQIX() || CheckForSBN() || CheckForSidecarSpatialIndex())
         DropSpatialIndex();
 
     unsigned int nOffset = 0;
@@ -1166,7 +1251,7 @@ OGRErr OGRShapeLayer::DeleteFeature(GIntBig nFID)
         return OGRERR_FAILURE;
 
     m_bHeaderDirty = true;
-    if (CheckForQIX() || CheckForSBN())
+    if (CheckForQIX() || CheckForSBN() || CheckForSidecarSpatialIndex())
         DropSpatialIndex();
     m_eNeedRepack = YES;
 
@@ -1190,7 +1275,7 @@ OGRErr OGRShapeLayer::ICreateFeature(OGRFeature *poFeature)
     }
 
     m_bHeaderDirty = true;
-    if (CheckForQIX() || CheckForSBN())
+    if (CheckForQIX() || CheckForSBN() || CheckForSidecarSpatialIndex())
         DropSpatialIndex();
 
     poFeature->SetFID(OGRNullFID);
@@ -1788,7 +1873,8 @@ int OGRShapeLayer::TestCapability(const char *pszCap)
 
     if (EQUAL(pszCap, OLCFastFeatureCount))
     {
-        if (!(m_poFilterGeom == nullptr || CheckForQIX() || CheckForSBN()))
+        if (!(m_poFilterGeom == nullptr || CheckForQIX() || CheckForSBN() ||
+              CheckForSidecarSpatialIndex()))
             return FALSE;
 
         if (m_poAttrQuery != nullptr)
@@ -1803,7 +1889,7 @@ int OGRShapeLayer::TestCapability(const char *pszCap)
         return m_bUpdateAccess;
 
     if (EQUAL(pszCap, OLCFastSpatialFilter))
-        return CheckForQIX() || CheckForSBN();
+        return CheckForQIX() || CheckForSBN() || CheckForSidecarSpatialIndex();
 
     if (EQUAL(pszCap, OLCFastGetExtent))
         return TRUE;
@@ -2632,7 +2718,7 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
     if (!StartUpdate("DropSpatialIndex"))
         return OGRERR_FAILURE;
 
-    if (!CheckForQIX() && !CheckForSBN())
+    if (!CheckForQIX() && !CheckForSBN() && !CheckForSidecarSpatialIndex())
     {
         CPLError(CE_Warning, CPLE_AppDefined,
                  "Layer %s has no spatial index, DROP SPATIAL INDEX failed.",
@@ -2642,6 +2728,17 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
 
     const bool bHadQIX = m_hQIX != nullptr;
 
+    if (m_poSidecarSpatialIndex != nullptr)
+    {
+        m_poSidecarSpatialIndex.reset();
+        m_bCheckedForSidecarSpatialIndex = false;
+        if (!OGRSidecarSpatialIndex::Remove(
+                VSI_SHP_GetFilename(m_hSHP->fpSHP)))
+        {
+            return OGRERR_FAILURE;
+        }
+    }
+
     SHPCloseDiskTree(m_hQIX);
     m_hQIX = nullptr;
     m_bCheckedForQIX = false;
@@ -2702,11 +2799,17 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     /* -------------------------------------------------------------------- */
     /*      If we have an existing spatial index, blow it away first.       */
     /* -------------------------------------------------------------------- */
-    if (CheckForQIX())
+    if (CheckForQIX() || CheckForSidecarSpatialIndex())
         DropSpatialIndex();
 
     m_bCheckedForQIX = false;
 
+    if (EQUAL(CPLGetConfigOption("SHAPE_SPATIAL_INDEX_FORMAT", "QIX"),
+              "OGRSIDX"))
+    {
+        return CreateSidecarSpatialIndex();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Build a quadtree structure for this file.                       */
     /* -------------------------------------------------------------------- */
@@ -2748,6 +2851,217 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                         ReadShapeEnvelopes()                         */
+/************************************************************************/
+
+/** Reads the bounding box of the shapes [iStart, iEnd[ from the header of
+ * their record in the .shp file, without reading their vertices. The
+ * envelope of null and empty shapes is left uninitialized.
+ */
+static bool ReadShapeEnvelopes(const char *pszSHPFilename, SHPHandle hSHP,
+                               int iStart, int iEnd, OGREnvelope *pasEnvelopes)
+{
+    auto fp = VSIVirtualHandleUniquePtr(VSIFOpenL(pszSHPFilename, "rb"));
+    if (!fp)
+        return false;
+
+    // Record header, shape type, bounding box, and number of parts and
+    // points of a polyline or polygon.
+    GByte abyRecord[8 + 4 + 32 + 8];
+    for (int i = iStart; i < iEnd; ++i)
+    {
+        const vsi_l_offset nOffset = hSHP->panRecOffset[i];
+        const size_t nSize = hSHP->panRecSize[i];
+        if (nOffset == 0 || nSize < 4)
+            continue;
+        const size_t nToRead = 8 + std::min(nSize, sizeof(abyRecord) - 8);
+        if (fp->Seek(nOffset, SEEK_SET) != 0 ||
+            fp->Read(abyRecord, 1, nToRead) != nToRead)
+        {
+            return false;
+        }
+
+        int32_t nSHPType = 0;
+        memcpy(&nSHPType, abyRecord + 8, sizeof(nSHPType));
+        CPL_LSBPTR32(&nSHPType);
+        double adfBounds[4] = {0, 0, 0, 0};
+        switch (nSHPType)
+        {
+            case SHPT_NULL:
+                continue;
+
+            case SHPT_POINT:
+            case SHPT_POINTZ:
+            case SHPT_POINTM:
+            {
+                if (nToRead < 8 + 4 + 16)
+                    continue;
+                memcpy(adfBounds, abyRecord + 12, 2 * sizeof(double));
+                adfBounds[2] = adfBounds[0];
+                adfBounds[3] = adfBounds[1];
+                break;
+            }
+
+            default:
+            {
+                // Number of points of a multipoint, or of a polyline,
+                // polygon or multipatch
+                const bool bMultiPoint = nSHPType == SHPT_MULTIPOINT ||
+                                         nSHPType == SHPT_MULTIPOINTZ ||
+                                         nSHPType == SHPT_MULTIPOINTM;
+                const size_t nPointCountOffset = bMultiPoint ? 44 : 48;
+                if (nToRead < nPointCountOffset + 4)
+                    continue;
+                int32_t nPoints = 0;
+                memcpy(&nPoints, abyRecord + nPointCountOffset,
+                       sizeof(nPoints));
+                CPL_LSBPTR32(&nPoints);
+                if (nPoints <= 0)
+                    continue;
+                memcpy(adfBounds, abyRecord + 12, 4 * sizeof(double));
+                break;
+            }
+        }
+
+        for (double &dfVal : adfBounds)
+            CPL_LSBPTR64(&dfVal);
+        if (std::isnan(adfBounds[0]) || std::isnan(adfBounds[1]) ||
+            std::isnan(adfBounds[2]) || std::isnan(adfBounds[3]))
+        {
+            continue;
+        }
+        pasEnvelopes[i].MinX = adfBounds[0];
+        pasEnvelopes[i].MinY = adfBounds[1];
+        pasEnvelopes[i].MaxX = adfBounds[2];
+        pasEnvelopes[i].MaxY = adfBounds[3];
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     CreateSidecarSpatialIndex()                      */
+/************************************************************************/
+
+// Indexes the shapes in a packed Hilbert R-tree, stored in a .shp.ogrsidx
+// file. The bounding boxes of the shapes are read by several threads.
+OGRErr OGRShapeLayer::CreateSidecarSpatialIndex()
+
+{
+    if (m_hSHP == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Layer %s has no geometry",
+                 m_poFeatureDefn->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    OGRShapeLayer::SyncToDisk();
+    // The header has just been written: prevent SHPClose() from writing it
+    // again, which would make the index look older than the .shp file.
+    m_hSHP->bUpdated = FALSE;
+
+    const std::string osSHPFilename(VSI_SHP_GetFilename(m_hSHP->fpSHP));
+    CPLDebug("SHAPE", "Creating index file %s",
+             OGRSidecarSpatialIndex::GetFilename(osSHPFilename).c_str());
+
+    const int nRecords = m_hSHP->nRecords;
+    std::vector<OGREnvelope> asEnvelopes;
+    try
+    {
+        asEnvelopes.resize(static_cast<size_t>(nRecords));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for the spatial index");
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    }
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = std::max(0, std::min(2 * nThreads, atoi(pszNumThreads)));
+    //! Minimum number of shapes whose envelope is read by a job
+    constexpr int MIN_CHUNK_SIZE = 1000;
+    if (nRecords < 2 * MIN_CHUNK_SIZE)
+        nThreads = 1;
+    std::unique_ptr<GDALThreadReservation> poThreadReservation;
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (nThreads > 1)
+    {
+        poThreadReservation = std::make_unique<GDALThreadReservation>(nThreads);
+        nThreads = poThreadReservation->GetThreadCount();
+        if (nThreads > 1)
+            poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    }
+
+    // A few jobs per thread, to balance the load
+    const int nChunkSize =
+        poThreadPool ? std::max(MIN_CHUNK_SIZE, nRecords / (4 * nThreads) + 1)
+                     : std::max(1, nRecords);
+    const int nChunks =
+        nRecords / nChunkSize + (nRecords % nChunkSize != 0 ? 1 : 0);
+    std::atomic<bool> bOK{true};
+    const auto ReadChunk =
+        [this, &osSHPFilename, &asEnvelopes, &bOK, nRecords,
+         nChunkSize](int iChunk)
+    {
+        const int iStart = iChunk * nChunkSize;
+        const int iEnd = std::min(nRecords, iStart + nChunkSize);
+        if (!ReadShapeEnvelopes(osSHPFilename.c_str(), m_hSHP, iStart, iEnd,
+                                asEnvelopes.data()))
+        {
+            bOK = false;
+        }
+    };
+
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            if (!poJobQueue->SubmitJob([&ReadChunk, iChunk]()
+                                       { ReadChunk(iChunk); }))
+            {
+                ReadChunk(iChunk);
+            }
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+            ReadChunk(iChunk);
+    }
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read the shapes of %s to build the spatial index",
+                 osSHPFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    OGRSidecarSpatialIndex::Builder oBuilder;
+    for (int i = 0; i < nRecords; ++i)
+    {
+        const auto &sEnvelope = asEnvelopes[static_cast<size_t>(i)];
+        if (sEnvelope.IsInit())
+            oBuilder.AddFeature(sEnvelope, m_hSHP->panRecOffset[i], i);
+    }
+    asEnvelopes.clear();
+    asEnvelopes.shrink_to_fit();
+
+    if (!oBuilder.Write(osSHPFilename,
+                        m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef()))
+    {
+        return OGRERR_FAILURE;
+    }
+
+    m_bCheckedForSidecarSpatialIndex = false;
+    return CheckForSidecarSpatialIndex() ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
 /************************************************************************/
 /*                       CheckFileDeletion()                            */
 /************************************************************************/
@@ -2923,7 +3237,7 @@ OGRErr OGRShapeLayer::Repack()
     /*      Cleanup any existing spatial index.  It will become             */
     /*      meaningless when the fids change.                               */
     /* -------------------------------------------------------------------- */
-    if (CheckForQIX() || CheckForSBN())
+    if (CheckForQIX() || CheckForSBN() || CheckForSidecarSpatialIndex())
         DropSpatialIndex();
 
     /* -------------------------------------------------------------------- */
@@ -3664,6 +3978,9 @@ void OGRShapeLayer::CloseUnderlyingLayer()
     m_hSBN = nullptr;
     m_bCheckedForSBN = false;
 
+    m_poSidecarSpatialIndex.reset();
+    m_bCheckedForSidecarSpatialIndex = false;
+
     m_eFileDescriptorsState = FD_CLOSED;
 }
 
@@ -3711,6 +4028,14 @@ void OGRShapeLayer::AddToFileList(CPLStringList &oFileList)
             oFileList.AddStringDirectly(
                 VSIGetCanonicalFilename(poGeomFieldDefn->GetPrjFilename()));
         }
+        if (CheckForSidecarSpatialIndex())
+        {
+            const std::string osIndexFilename =
+                OGRSidecarSpatialIndex::GetFilename(
+                    VSI_SHP_GetFilename(m_hSHP->fpSHP));
+            oFileList.AddStringDirectly(
+                VSIGetCanonicalFilename(osIndexFilename.c_str()));
+        }
         if (CheckForQIX())
         {
             const std::string osQIXFilename =
@@ -3848,12 +4173,115 @@ GDALDataset *OGRShapeLayer::GetDataset()
     return m_poDS;
 }
 
+/************************************************************************/
+/*                        GetTrimmedDBFValue()                          */
+/************************************************************************/
+
+// Return the value of a DBF field, as DBFReadStringAttribute() would do:
+// truncated at the first nul character and with leading and trailing spaces
+// removed.
+static const char *GetTrimmedDBFValue(const char *pszField, int nWidth,
+                                      int &nLen)
+{
+    const char *pszNul =
+        static_cast<const char *>(memchr(pszField, 0, nWidth));
+    const char *pszEnd = pszNul ? pszNul : pszField + nWidth;
+    while (pszField < pszEnd && *pszField == ' ')
+        ++pszField;
+    while (pszEnd > pszField && pszEnd[-1] == ' ')
+        --pszEnd;
+    nLen = static_cast<int>(pszEnd - pszField);
+    return pszField;
+}
+
+/************************************************************************/
+/*                         IsDBFValueNull()                             */
+/************************************************************************/
+
+// Same as DBFIsValueNULL() in dbfopen.c, but on a trimmed value that is not
+// nul terminated.
+static bool IsDBFValueNull(char chType, const char *pszValue, int nLen,
+                           int nWidth)
+{
+    switch (chType)
+    {
+        case 'N':
+        case 'F':
+            return nLen == 0 || pszValue[0] == '*';
+
+        case 'D':
+        {
+            if (nLen == 0 ||
+                (nLen >= 8 && memcmp(pszValue, "00000000", 8) == 0))
+                return true;
+            if (nLen < nWidth)
+                return nLen == 1 && pszValue[0] == '0';
+            for (int i = 0; i < nLen; ++i)
+            {
+                if (pszValue[i] != '0')
+                    return false;
+            }
+            return true;
+        }
+
+        case 'L':
+            return nLen > 0 && pszValue[0] == '?';
+
+        default:
+            return nLen == 0;
+    }
+}
+
+/************************************************************************/
+/*                         ParseDBFInteger()                            */
+/************************************************************************/
+
+// Parse a value made only of an optional sign followed by at most 18 digits.
+// Return false if the value has another form, in which case the caller must
+// use the same (slower) conversion as OGRFeature::SetField().
+static bool ParseDBFInteger(const char *pszValue, int nLen, int64_t &nVal)
+{
+    int i = 0;
+    const bool bNegative = nLen > 0 && pszValue[0] == '-';
+    if (nLen > 0 && (pszValue[0] == '-' || pszValue[0] == '+'))
+        ++i;
+    if (i == nLen || nLen - i > 18)
+        return false;
+    int64_t nAcc = 0;
+    for (; i < nLen; ++i)
+    {
+        const char ch = pszValue[i];
+        if (ch < '0' || ch > '9')
+            return false;
+        nAcc = nAcc * 10 + (ch - '0');
+    }
+    nVal = bNegative ? -nAcc : nAcc;
+    return true;
+}
+
+/************************************************************************/
+/*                   IsASCIICompatibleEncoding()                        */
+/************************************************************************/
+
+// Whether ASCII only strings are identical once recoded from that encoding
+// to UTF-8.
+static bool IsASCIICompatibleEncoding(const std::string &osEncoding)
+{
+    return EQUAL(osEncoding.c_str(), CPL_ENC_UTF8) ||
+           STARTS_WITH_CI(osEncoding.c_str(), "ISO-8859-") ||
+           STARTS_WITH_CI(osEncoding.c_str(), "CP125") ||
+           STARTS_WITH_CI(osEncoding.c_str(), "CP8") ||
+           EQUAL(osEncoding.c_str(), "CP437");
+}
+
 /************************************************************************/
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementation restricted to situations where the geometry is
+// not requested and there are no filters. Records of the DBF file are read by
+// blocks, and the requested columns are directly decoded into the Arrow
+// buffers, without going through DBFReadAttribute() and OGRFeature.
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3865,17 +4293,40 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!m_hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    if (!m_hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        m_hDBF->bCurrentRecordModified || m_hDBF->nRecordLength <= 0 ||
+        (m_hSHP != nullptr && m_hSHP->nRecords != m_hDBF->nRecords))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
-    // If any field is not ignored, use generic implementation
+    // If any requested field is not of a type handled below, use generic
+    // implementation
     const int nFieldCount = m_poFeatureDefn->GetFieldCount();
     for (int i = 0; i < nFieldCount; ++i)
     {
-        if (!m_poFeatureDefn->GetFieldDefn(i)->IsIgnored())
-            return OGRLayer::GetNextArrowArray(stream, out_array);
+        const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTBoolean)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                if (!poFieldDefn->GetDomainName().empty())
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTInteger64:
+            case OFTReal:
+            case OFTString:
+            case OFTDate:
+                if (eSubType != OFSTNone)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            default:
+                return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
     }
     if (GetGeomType() != wkbNone &&
         !m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
@@ -3888,35 +4339,277 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return ENOMEM;
     }
 
-    if (!sHelper.m_bIncludeFID)
+    if (sHelper.m_nChildren == 0)
     {
         out_array->release(out_array);
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    const bool bRecode = !m_osEncoding.empty();
+    const bool bSkipRecodingOfASCII =
+        bRecode && IsASCIICompatibleEncoding(m_osEncoding);
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    std::vector<int> anRequestedFields;
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        if (sHelper.m_mapOGRFieldToArrowField[i] >= 0)
+            anRequestedFields.push_back(i);
+    }
+
+    const int nRecordLength = m_hDBF->nRecordLength;
+    constexpr int BLOCK_SIZE = 1024 * 1024;
+    const int nMaxRecordsPerBlock = std::max(1, BLOCK_SIZE / nRecordLength);
+    std::vector<char> abyBlock;
+    std::string osTmp;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    VSILFILE *fpDBF = VSI_SHP_GetVSIL(m_hDBF->fp);
+    // The position of the DBF file is changed below
+    m_hDBF->bRequireNextWriteSeek = TRUE;
+
     int nCount = 0;
-    while (m_iNextShapeId < m_nTotalShapeCount)
+    while (nCount < sHelper.m_nMaxBatchSize &&
+           m_iNextShapeId < m_nTotalShapeCount)
     {
-        const bool bIsDeleted =
-            CPL_TO_BOOL(DBFIsRecordDeleted(m_hDBF, m_iNextShapeId));
-        if (bIsDeleted)
+        const int nRecordsInBlock = std::min(
+            {nMaxRecordsPerBlock, sHelper.m_nMaxBatchSize - nCount,
+             m_nTotalShapeCount - m_iNextShapeId});
+        try
         {
-            ++m_iNextShapeId;
-            continue;
+            abyBlock.resize(static_cast<size_t>(nRecordsInBlock) *
+                            nRecordLength);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate DBF block buffer");
+            sHelper.ClearArray();
+            return ENOMEM;
         }
-        if (VSIFEofL(VSI_SHP_GetVSIL(m_hDBF->fp)) ||
-            VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
+        const vsi_l_offset nBlockOffset =
+            static_cast<vsi_l_offset>(m_hDBF->nHeaderLength) +
+            static_cast<vsi_l_offset>(m_iNextShapeId) * nRecordLength;
+        if (VSIFSeekL(fpDBF, nBlockOffset, SEEK_SET) != 0 ||
+            VSIFReadL(abyBlock.data(), nRecordLength, nRecordsInBlock,
+                      fpDBF) != static_cast<size_t>(nRecordsInBlock))
         {
-            out_array->release(out_array);
-            memset(out_array, 0, sizeof(*out_array));
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read %d records from DBF file at record %d",
+                     nRecordsInBlock, m_iNextShapeId);
+            sHelper.ClearArray();
             return EIO;
         }
-        sHelper.m_panFIDValues[nCount] = m_iNextShapeId;
-        ++m_iNextShapeId;
-        ++nCount;
-        if (nCount == sHelper.m_nMaxBatchSize)
-            break;
+
+        for (int iRec = 0; iRec < nRecordsInBlock; ++iRec)
+        {
+            const char *pachRecord =
+                abyBlock.data() + static_cast<size_t>(iRec) * nRecordLength;
+            if (pachRecord[0] == '*')
+            {
+                // Deleted record
+                ++m_iNextShapeId;
+                continue;
+            }
+
+            // Stop before this record if its strings could make the batch
+            // exceed the memory limit. It will be returned by next call.
+            if (nCount > 0)
+            {
+                for (const int iField : anRequestedFields)
+                {
+                    if (m_poFeatureDefn->GetFieldDefn(iField)->GetType() !=
+                        OFTString)
+                        continue;
+                    const int iArrowField =
+                        sHelper.m_mapOGRFieldToArrowField[iField];
+                    const auto panOffsets = static_cast<const int32_t *>(
+                        out_array->children[iArrowField]->buffers[1]);
+                    const uint32_t nCurLength =
+                        static_cast<uint32_t>(panOffsets[nCount]);
+                    // Recoding to UTF-8 may use up to 4 bytes per character
+                    const uint32_t nMaxLen = static_cast<uint32_t>(
+                        m_hDBF->panFieldSize[iField] * (bRecode ? 4 : 1));
+                    if (nMaxLen > nMemLimit - std::min(nMemLimit, nCurLength))
+                    {
+                        sHelper.Shrink(nCount);
+                        return 0;
+                    }
+                }
+            }
+
+            if (sHelper.m_panFIDValues)
+                sHelper.m_panFIDValues[nCount] = m_iNextShapeId;
+
+            for (const int iField : anRequestedFields)
+            {
+                const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(iField);
+                const int iArrowField =
+                    sHelper.m_mapOGRFieldToArrowField[iField];
+                struct ArrowArray *psArray = out_array->children[iArrowField];
+                const int nWidth = m_hDBF->panFieldSize[iField];
+                int nLen = 0;
+                const char *pszValue = GetTrimmedDBFValue(
+                    pachRecord + m_hDBF->panFieldOffset[iField], nWidth, nLen);
+
+                const auto eType = poFieldDefn->GetType();
+                const bool bIsNull =
+                    eType == OFTString
+                        ? nLen == 0
+                        : IsDBFValueNull(m_hDBF->pachFieldType[iField],
+                                         pszValue, nLen, nWidth);
+                if (bIsNull)
+                {
+                    if (sHelper.m_abNullableFields[iField])
+                    {
+                        if (!sHelper.SetNull(iArrowField, nCount))
+                        {
+                            sHelper.ClearArray();
+                            return ENOMEM;
+                        }
+                    }
+                    else if (eType == OFTString)
+                    {
+                        OGRArrowArrayHelper::SetEmptyStringOrBinary(psArray,
+                                                                    nCount);
+                    }
+                    continue;
+                }
+
+                switch (eType)
+                {
+                    case OFTInteger:
+                    {
+                        if (poFieldDefn->GetSubType() == OFSTBoolean)
+                        {
+                            const char ch = pszValue[0];
+                            if (ch == 'T' || ch == 't' || ch == 'Y' ||
+                                ch == 'y')
+                            {
+                                OGRArrowArrayHelper::SetBoolOn(psArray,
+                                                               nCount);
+                            }
+                            break;
+                        }
+                        int64_t nVal64 = 0;
+                        if (!ParseDBFInteger(pszValue, nLen, nVal64))
+                        {
+                            osTmp.assign(pszValue, nLen);
+                            nVal64 = std::strtoll(osTmp.c_str(), nullptr, 10);
+                        }
+                        OGRArrowArrayHelper::SetInt32(
+                            psArray, nCount,
+                            nVal64 > INT_MAX   ? INT_MAX
+                            : nVal64 < INT_MIN ? INT_MIN
+                                               : static_cast<int>(nVal64));
+                        break;
+                    }
+
+                    case OFTInteger64:
+                    {
+                        int64_t nVal64 = 0;
+                        if (!ParseDBFInteger(pszValue, nLen, nVal64))
+                        {
+                            osTmp.assign(pszValue, nLen);
+                            nVal64 =
+                                CPLAtoGIntBigEx(osTmp.c_str(), FALSE, nullptr);
+                        }
+                        OGRArrowArrayHelper::SetInt64(psArray, nCount, nVal64);
+                        break;
+                    }
+
+                    case OFTReal:
+                    {
+                        double dfVal = 0;
+                        const auto answer = fast_float::from_chars(
+                            pszValue, pszValue + nLen, dfVal);
+                        if (answer.ec != std::errc() ||
+                            answer.ptr != pszValue + nLen)
+                        {
+                            osTmp.assign(pszValue, nLen);
+                            dfVal = CPLStrtod(osTmp.c_str(), nullptr);
+                        }
+                        OGRArrowArrayHelper::SetDouble(psArray, nCount, dfVal);
+                        break;
+                    }
+
+                    case OFTString:
+                    {
+                        if (bRecode && !(bSkipRecodingOfASCII &&
+                                         CPLIsASCII(pszValue, nLen)))
+                        {
+                            osTmp.assign(pszValue, nLen);
+                            char *pszUTF8 = CPLRecode(
+                                osTmp.c_str(), m_osEncoding, CPL_ENC_UTF8);
+                            const size_t nUTF8Len = strlen(pszUTF8);
+                            GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                                iArrowField, nCount, nUTF8Len);
+                            if (pabyDst)
+                                memcpy(pabyDst, pszUTF8, nUTF8Len);
+                            CPLFree(pszUTF8);
+                            if (!pabyDst)
+                            {
+                                sHelper.ClearArray();
+                                return ENOMEM;
+                            }
+                        }
+                        else
+                        {
+                            GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                                iArrowField, nCount, nLen);
+                            if (!pabyDst)
+                            {
+                                sHelper.ClearArray();
+                                return ENOMEM;
+                            }
+                            memcpy(pabyDst, pszValue, nLen);
+                        }
+                        break;
+                    }
+
+                    case OFTDate:
+                    {
+                        OGRField sFld;
+                        memset(&sFld, 0, sizeof(sFld));
+                        osTmp.assign(pszValue, nLen);
+                        const char *pszDate = osTmp.c_str();
+                        if (nLen >= 10 && pszDate[2] == '/' &&
+                            pszDate[5] == '/')
+                        {
+                            sFld.Date.Month =
+                                static_cast<GByte>(atoi(pszDate + 0));
+                            sFld.Date.Day =
+                                static_cast<GByte>(atoi(pszDate + 3));
+                            sFld.Date.Year =
+                                static_cast<GInt16>(atoi(pszDate + 6));
+                        }
+                        else
+                        {
+                            const int nFullDate = atoi(pszDate);
+                            sFld.Date.Year =
+                                static_cast<GInt16>(nFullDate / 10000);
+                            sFld.Date.Month =
+                                static_cast<GByte>((nFullDate / 100) % 100);
+                            sFld.Date.Day =
+                                static_cast<GByte>(nFullDate % 100);
+                        }
+                        OGRArrowArrayHelper::SetDate(psArray, nCount,
+                                                     brokenDown, sFld);
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+
+            ++m_iNextShapeId;
+            ++m_nFeaturesRead;
+            ++nCount;
+        }
     }
     sHelper.Shrink(nCount);
     if (nCount == 0)
@@ -1280,10 +1280,13 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
 
+// If poFeatureToFill is not null, it is reset and filled instead of a new
+// feature being allocated, and it is returned on success.
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToFill)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1307,7 +1310,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToFill;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1583,6 +1583,30 @@ bool OGRSQLiteBaseDataSource::OpenOrCreateDB(int flagsIn,
             sqlite3_busy_timeout(hDB, atoi(pszVal));
         }
 
+        // With memory-mapped I/O, the connections opened on the same file
+        // share the pages of the operating system cache (or the buffer of a
+        // /vsimem/ file), instead of each one copying them in its own page
+        // cache.
+        const char *pszMMapSize =
+            CSLFetchNameValue(papszOpenOptions, "MMAP_SIZE");
+        if (pszMMapSize != nullptr)
+        {
+            const GIntBig nMMapSize = CPLAtoGIntBig(pszMMapSize);
+            if (nMMapSize < 0)
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "Invalid value for MMAP_SIZE open option: %s",
+                         pszMMapSize);
+            }
+            else
+            {
+                CPL_IGNORE_RET_VAL(sqlite3_exec(
+                    hDB, CPLSPrintf("PRAGMA mmap_size = " CPL_FRMT_GIB,
+                                    nMMapSize),
+                    nullptr, nullptr, nullptr));
+            }
+        }
+
 #ifdef SQLITE_OPEN_URI
         if (iterOpen == 0 && bNoLock && !bImmutable)
         {
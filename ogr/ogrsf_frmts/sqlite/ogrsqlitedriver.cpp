@@ -324,6 +324,8 @@ void RegisterOGRSQLite()
         "creating the layer. "
         "The overrides are defined as a JSON list of field definitions. "
         "This can be a filename or a JSON string or a URL.'/>"
+        "  <Option name='MMAP_SIZE' type='int' description='Maximum number of "
+        "bytes of the database file accessed through memory-mapped I/O'/>"
         "</OpenOptionList>");
 
     CPLString osCreationOptions(
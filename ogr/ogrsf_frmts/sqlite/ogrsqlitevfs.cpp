@@ -48,6 +48,10 @@ typedef struct
     VSILFILE *fp;
     int bDeleteOnClose;
     char *pszFilename;
+    // Whether this is a /vsimem/ file opened in read-only mode, whose pages
+    // can be directly returned by xFetch()
+    int bReadOnlyMemFile;
+    sqlite3_int64 nMMapSize;
 } OGRSQLiteFileStruct;
 
 static int OGRSQLiteIOClose(sqlite3_file *pFile)
@@ -172,14 +176,24 @@ static int OGRSQLiteIOCheckReservedLock(DEBUG_ONLY sqlite3_file *pFile,
     return SQLITE_OK;
 }
 
-static int OGRSQLiteIOFileControl(DEBUG_ONLY sqlite3_file *pFile,
-                                  DEBUG_ONLY int op, DEBUG_ONLY void *pArg)
+static int OGRSQLiteIOFileControl(sqlite3_file *pFile, int op, void *pArg)
 {
-#ifdef DEBUG_IO
     OGRSQLiteFileStruct *pMyFile =
         reinterpret_cast<OGRSQLiteFileStruct *>(pFile);
+#ifdef DEBUG_IO
     CPLDebug("SQLITE", "OGRSQLiteIOFileControl(%p, %d)", pMyFile->fp, op);
 #endif
+    if (op == SQLITE_FCNTL_MMAP_SIZE)
+    {
+        // Set from PRAGMA mmap_size. A negative value is a query of the
+        // current value.
+        sqlite3_int64 *pnMMapSize = static_cast<sqlite3_int64 *>(pArg);
+        const sqlite3_int64 nNewMMapSize = *pnMMapSize;
+        *pnMMapSize = pMyFile->nMMapSize;
+        if (nNewMMapSize >= 0)
+            pMyFile->nMMapSize = nNewMMapSize;
+        return SQLITE_OK;
+    }
     return SQLITE_NOTFOUND;
 }
 
@@ -203,8 +217,46 @@ static int OGRSQLiteIODeviceCharacteristics(DEBUG_ONLY sqlite3_file *pFile)
     return 0;
 }
 
+static int OGRSQLiteIOFetch(sqlite3_file *pFile, sqlite3_int64 iOfst,
+                            int iAmt, void **pp)
+{
+    OGRSQLiteFileStruct *pMyFile =
+        reinterpret_cast<OGRSQLiteFileStruct *>(pFile);
+    *pp = nullptr;
+    // Returning nullptr makes SQLite fall back to xRead()
+    if (pMyFile->bReadOnlyMemFile && iOfst >= 0 && iAmt > 0 &&
+        iOfst + iAmt <= pMyFile->nMMapSize)
+    {
+        vsi_l_offset nLength = 0;
+        GByte *pabyData =
+            VSIGetMemFileBuffer(pMyFile->pszFilename, &nLength, FALSE);
+        if (pabyData && static_cast<vsi_l_offset>(iOfst + iAmt) <= nLength)
+        {
+            *pp = pabyData + iOfst;
+        }
+    }
+#ifdef DEBUG_IO
+    CPLDebug("SQLITE", "OGRSQLiteIOFetch(%p, %d, %d) = %p", pMyFile->fp, iAmt,
+             static_cast<int>(iOfst), *pp);
+#endif
+    return SQLITE_OK;
+}
+
+static int OGRSQLiteIOUnfetch(DEBUG_ONLY sqlite3_file *pFile,
+                              DEBUG_ONLY sqlite3_int64 iOfst,
+                              DEBUG_ONLY void *p)
+{
+#ifdef DEBUG_IO
+    OGRSQLiteFileStruct *pMyFile =
+        reinterpret_cast<OGRSQLiteFileStruct *>(pFile);
+    CPLDebug("SQLITE", "OGRSQLiteIOUnfetch(%p, %d, %p)", pMyFile->fp,
+             static_cast<int>(iOfst), p);
+#endif
+    return SQLITE_OK;
+}
+
 static const sqlite3_io_methods OGRSQLiteIOMethods = {
-    1,
+    3,
     OGRSQLiteIOClose,
     OGRSQLiteIORead,
     OGRSQLiteIOWrite,
@@ -221,8 +273,8 @@ static const sqlite3_io_methods OGRSQLiteIOMethods = {
     nullptr,  // xShmLock
     nullptr,  // xShmBarrier
     nullptr,  // xShmUnmap
-    nullptr,  // xFetch
-    nullptr,  // xUnfetch
+    OGRSQLiteIOFetch,
+    OGRSQLiteIOUnfetch,
 };
 
 static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zNameIn,
@@ -244,6 +296,8 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zNameIn,
     pMyFile->pMethods = nullptr;
     pMyFile->bDeleteOnClose = FALSE;
     pMyFile->pszFilename = nullptr;
+    pMyFile->bReadOnlyMemFile = FALSE;
+    pMyFile->nMMapSize = 0;
     if (flags & SQLITE_OPEN_READONLY)
         pMyFile->fp = VSIFOpenL(osName.c_str(), "rb");
     else if (flags & SQLITE_OPEN_CREATE)
@@ -275,6 +329,8 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zNameIn,
     pMyFile->pMethods = &OGRSQLiteIOMethods;
     pMyFile->bDeleteOnClose = (flags & SQLITE_OPEN_DELETEONCLOSE);
     pMyFile->pszFilename = CPLStrdup(osName.c_str());
+    pMyFile->bReadOnlyMemFile = (flags & SQLITE_OPEN_READONLY) != 0 &&
+                                STARTS_WITH(osName.c_str(), "/vsimem/");
 
     if (pOutFlags != nullptr)
         *pOutFlags = flags;
@@ -396,8 +396,16 @@ typedef struct
     GIntBig nNextWishedIndex;
     GIntBig nCurFeatureIndex;
 
-    GByte *pabyGeomBLOB;
-    int nGeomBLOBLen;
+    /* Index past the last feature to return when a LIMIT clause has been */
+    /* pushed down, or -1 */
+    GIntBig nEndIndex;
+
+    /* Cache of the SpatiaLite blobs of the geometry fields of the current */
+    /* feature, so that they are exported only once, whatever the number */
+    /* of times a geometry column is requested */
+    int nGeomFieldCount;
+    GByte **papabyGeomBLOB;
+    int *panGeomBLOBLen; /* -1 when not yet computed */
 } OGR2SQLITE_vtab_cursor;
 
 #ifdef VIRTUAL_OGR_DYNAMIC_EXTENSION_ENABLED
@@ -843,6 +851,21 @@ static bool OGR2SQLITE_IsHandledOp(int op)
     return false;
 }
 
+/************************************************************************/
+/*                    OGR2SQLITE_IsLimitOrOffsetOp()                    */
+/************************************************************************/
+
+static bool OGR2SQLITE_IsLimitOrOffsetOp(CPL_UNUSED int op)
+{
+#ifdef SQLITE_INDEX_CONSTRAINT_LIMIT
+    /* SQLite >= 3.38 */
+    return op == SQLITE_INDEX_CONSTRAINT_LIMIT ||
+           op == SQLITE_INDEX_CONSTRAINT_OFFSET;
+#else
+    return false;
+#endif
+}
+
 /************************************************************************/
 /*                        OGR2SQLITE_BestIndex()                        */
 /************************************************************************/
@@ -946,6 +969,14 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
              osQueryPatternUsable.c_str(), osQueryPatternNotUsable.c_str());
 #endif
 
+    // Arbitrary estimate of the number of rows of a full scan. It only
+    // matters relatively to the estimates of the plans using constraints,
+    // so that SQLite picks the most selective one, in particular for the
+    // inner table of joins.
+    double dfEstimatedRows = 1e6;
+    bool bUniqueRow = false;
+    bool bAllConstraintsConsumed = true;
+
     int nConstraints = 0;
     for (int i = 0; i < pIndex->nConstraint; i++)
     {
@@ -954,20 +985,59 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
         if (pMyVTab->bHasFIDColumn && iCol >= 0)
             --iCol;
 
-        if (pIndex->aConstraint[i].usable &&
-            OGR2SQLITE_IsHandledOp(pIndex->aConstraint[i].op) &&
-            iCol < poFDefn->GetFieldCount() &&
-            (iCol < 0 || poFDefn->GetFieldDefn(iCol)->GetType() != OFTBinary))
+        const int nOp = pIndex->aConstraint[i].op;
+        if (OGR2SQLITE_IsLimitOrOffsetOp(nOp))
+        {
+            // Handled below, once we know if all other constraints are
+            // consumed
+            pIndex->aConstraintUsage[i].argvIndex = 0;
+            pIndex->aConstraintUsage[i].omit = false;
+        }
+        else if (pIndex->aConstraint[i].usable &&
+                 OGR2SQLITE_IsHandledOp(nOp) &&
+                 iCol < poFDefn->GetFieldCount() &&
+                 (iCol < 0 ||
+                  poFDefn->GetFieldDefn(iCol)->GetType() != OFTBinary))
         {
             pIndex->aConstraintUsage[i].argvIndex = nConstraints + 1;
             pIndex->aConstraintUsage[i].omit = true;
 
             nConstraints++;
+
+            if (nOp == SQLITE_INDEX_CONSTRAINT_EQ)
+            {
+                if (iCol < 0)
+                    bUniqueRow = true;
+                dfEstimatedRows /= 100;
+            }
+            else
+            {
+                dfEstimatedRows /= 4;
+            }
         }
         else
         {
             pIndex->aConstraintUsage[i].argvIndex = 0;
             pIndex->aConstraintUsage[i].omit = false;
+            if (pIndex->aConstraint[i].usable)
+                bAllConstraintsConsumed = false;
+        }
+    }
+
+    // LIMIT and OFFSET can only be applied by the OGR layer if it also
+    // evaluates all the other constraints. SQLite also checks that.
+    if (bAllConstraintsConsumed)
+    {
+        for (int i = 0; i < pIndex->nConstraint; i++)
+        {
+            if (pIndex->aConstraint[i].usable &&
+                OGR2SQLITE_IsLimitOrOffsetOp(pIndex->aConstraint[i].op))
+            {
+                pIndex->aConstraintUsage[i].argvIndex = nConstraints + 1;
+                pIndex->aConstraintUsage[i].omit = true;
+
+                nConstraints++;
+            }
         }
     }
 
@@ -979,18 +1049,13 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
             static_cast<int>(sizeof(int)) * (1 + 2 * nConstraints)));
         panConstraints[0] = nConstraints;
 
-        nConstraints = 0;
-
         for (int i = 0; i < pIndex->nConstraint; i++)
         {
-            if (pIndex->aConstraintUsage[i].omit)
+            const int iArg = pIndex->aConstraintUsage[i].argvIndex - 1;
+            if (iArg >= 0)
             {
-                panConstraints[2 * nConstraints + 1] =
-                    pIndex->aConstraint[i].iColumn;
-                panConstraints[2 * nConstraints + 2] =
-                    pIndex->aConstraint[i].op;
-
-                nConstraints++;
+                panConstraints[2 * iArg + 1] = pIndex->aConstraint[i].iColumn;
+                panConstraints[2 * iArg + 2] = pIndex->aConstraint[i].op;
             }
         }
     }
@@ -998,6 +1063,18 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
     pIndex->orderByConsumed = false;
     pIndex->idxNum = 0;
 
+    if (bUniqueRow)
+        dfEstimatedRows = 1;
+    pIndex->estimatedCost = std::max(1.0, dfEstimatedRows);
+#if SQLITE_VERSION_NUMBER >= 3008002L
+    pIndex->estimatedRows =
+        static_cast<sqlite3_int64>(std::max(1.0, dfEstimatedRows));
+#endif
+#if SQLITE_VERSION_NUMBER >= 3009000L
+    if (bUniqueRow)
+        pIndex->idxFlags |= SQLITE_INDEX_SCAN_UNIQUE;
+#endif
+
     if (nConstraints != 0)
     {
         pIndex->idxStr = reinterpret_cast<char *>(panConstraints);
@@ -1034,6 +1111,20 @@ static int OGR2SQLITE_DisconnectDestroy(sqlite3_vtab *pVTab)
     return SQLITE_OK;
 }
 
+/************************************************************************/
+/*                       OGR2SQLITE_ResetGeomBLOBs()                    */
+/************************************************************************/
+
+static void OGR2SQLITE_ResetGeomBLOBs(OGR2SQLITE_vtab_cursor *pMyCursor)
+{
+    for (int i = 0; i < pMyCursor->nGeomFieldCount; i++)
+    {
+        CPLFree(pMyCursor->papabyGeomBLOB[i]);
+        pMyCursor->papabyGeomBLOB[i] = nullptr;
+        pMyCursor->panGeomBLOBLen[i] = -1;
+    }
+}
+
 /************************************************************************/
 /*                           OGR2SQLITE_Open()                          */
 /************************************************************************/
@@ -1085,9 +1176,14 @@ static int OGR2SQLITE_Open(sqlite3_vtab *pVTab, sqlite3_vtab_cursor **ppCursor)
     pCursor->nNextWishedIndex = 0;
     pCursor->nCurFeatureIndex = -1;
     pCursor->nFeatureCount = -1;
+    pCursor->nEndIndex = -1;
 
-    pCursor->pabyGeomBLOB = nullptr;
-    pCursor->nGeomBLOBLen = -1;
+    pCursor->nGeomFieldCount = poLayer->GetLayerDefn()->GetGeomFieldCount();
+    pCursor->papabyGeomBLOB = static_cast<GByte **>(
+        CPLCalloc(std::max(1, pCursor->nGeomFieldCount), sizeof(GByte *)));
+    pCursor->panGeomBLOBLen = static_cast<int *>(
+        CPLMalloc(std::max(1, pCursor->nGeomFieldCount) * sizeof(int)));
+    OGR2SQLITE_ResetGeomBLOBs(pCursor);
 
     return SQLITE_OK;
 }
@@ -1110,7 +1206,9 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
     delete pMyCursor->poFeature;
     delete pMyCursor->poDupDataSource;
 
-    CPLFree(pMyCursor->pabyGeomBLOB);
+    OGR2SQLITE_ResetGeomBLOBs(pMyCursor);
+    CPLFree(pMyCursor->papabyGeomBLOB);
+    CPLFree(pMyCursor->panGeomBLOBLen);
 
     CPLFree(pCursor);
 
@@ -1138,11 +1236,27 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
         return SQLITE_ERROR;
 
     CPLString osAttributeFilter;
+    GIntBig nLimit = -1;
+    GIntBig nOffset = 0;
 
     OGRFeatureDefn *poFDefn = pMyCursor->poLayer->GetLayerDefn();
 
     for (int i = 0; i < argc; i++)
     {
+#ifdef SQLITE_INDEX_CONSTRAINT_LIMIT
+        if (panConstraints[2 * i + 2] == SQLITE_INDEX_CONSTRAINT_LIMIT)
+        {
+            // A negative LIMIT means no limit
+            nLimit = sqlite3_value_int64(argv[i]);
+            continue;
+        }
+        else if (panConstraints[2 * i + 2] == SQLITE_INDEX_CONSTRAINT_OFFSET)
+        {
+            nOffset = std::max<GIntBig>(0, sqlite3_value_int64(argv[i]));
+            continue;
+        }
+#endif
+
         int nCol = panConstraints[2 * i + 1];
         OGRFieldDefn *poFieldDefn = nullptr;
 
@@ -1158,7 +1272,7 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
                 return SQLITE_ERROR;
         }
 
-        if (i != 0)
+        if (!osAttributeFilter.empty())
             osAttributeFilter += " AND ";
 
         if (poFieldDefn != nullptr)
@@ -1316,8 +1430,29 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
         pMyCursor->nFeatureCount = -1;
     pMyCursor->poLayer->ResetReading();
 
-    if (pMyCursor->nFeatureCount < 0)
+    delete pMyCursor->poFeature;
+    pMyCursor->poFeature = nullptr;
+    OGR2SQLITE_ResetGeomBLOBs(pMyCursor);
+
+    // Rows are numbered from the OFFSET, so that nEndIndex and
+    // nFeatureCount are comparable with nNextWishedIndex
+    pMyCursor->nNextWishedIndex = nOffset;
+    pMyCursor->nCurFeatureIndex = -1;
+    pMyCursor->nEndIndex =
+        nLimit >= 0 ? (nLimit > std::numeric_limits<GIntBig>::max() - nOffset
+                           ? std::numeric_limits<GIntBig>::max()
+                           : nOffset + nLimit)
+                    : -1;
+
+    if (pMyCursor->nFeatureCount < 0 &&
+        pMyCursor->nNextWishedIndex != pMyCursor->nEndIndex)
     {
+        if (nOffset > 0 &&
+            pMyCursor->poLayer->SetNextByIndex(nOffset) != OGRERR_NONE)
+        {
+            // Past the end of the layer
+            return SQLITE_OK;
+        }
         pMyCursor->poFeature = pMyCursor->poLayer->GetNextFeature();
 #ifdef DEBUG_OGR2SQLITE
         CPLDebug("OGR2SQLITE", "GetNextFeature() --> " CPL_FRMT_GIB,
@@ -1325,9 +1460,6 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
 #endif
     }
 
-    pMyCursor->nNextWishedIndex = 0;
-    pMyCursor->nCurFeatureIndex = -1;
-
     return SQLITE_OK;
 }
 
@@ -1347,11 +1479,13 @@ static int OGR2SQLITE_Next(sqlite3_vtab_cursor *pCursor)
     if (pMyCursor->nFeatureCount < 0)
     {
         delete pMyCursor->poFeature;
-        pMyCursor->poFeature = pMyCursor->poLayer->GetNextFeature();
+        // Do not read past the LIMIT
+        pMyCursor->poFeature =
+            pMyCursor->nNextWishedIndex != pMyCursor->nEndIndex
+                ? pMyCursor->poLayer->GetNextFeature()
+                : nullptr;
 
-        CPLFree(pMyCursor->pabyGeomBLOB);
-        pMyCursor->pabyGeomBLOB = nullptr;
-        pMyCursor->nGeomBLOBLen = -1;
+        OGR2SQLITE_ResetGeomBLOBs(pMyCursor);
 
 #ifdef DEBUG_OGR2SQLITE
         CPLDebug("OGR2SQLITE", "GetNextFeature() --> " CPL_FRMT_GIB,
@@ -1379,7 +1513,9 @@ static int OGR2SQLITE_Eof(sqlite3_vtab_cursor *pCursor)
     }
     else
     {
-        return pMyCursor->nNextWishedIndex >= pMyCursor->nFeatureCount;
+        return pMyCursor->nNextWishedIndex >= pMyCursor->nFeatureCount ||
+               (pMyCursor->nEndIndex >= 0 &&
+                pMyCursor->nNextWishedIndex >= pMyCursor->nEndIndex);
     }
 }
 
@@ -1393,6 +1529,15 @@ static void OGR2SQLITE_GoToWishedIndex(OGR2SQLITE_vtab_cursor *pMyCursor)
     {
         if (pMyCursor->nCurFeatureIndex < pMyCursor->nNextWishedIndex)
         {
+            // Typically for OFFSET
+            if (pMyCursor->nNextWishedIndex > pMyCursor->nCurFeatureIndex + 1 &&
+                pMyCursor->poLayer->TestCapability(OLCFastSetNextByIndex) &&
+                pMyCursor->poLayer->SetNextByIndex(
+                    pMyCursor->nNextWishedIndex) == OGRERR_NONE)
+            {
+                pMyCursor->nCurFeatureIndex = pMyCursor->nNextWishedIndex - 1;
+            }
+
             do
             {
                 pMyCursor->nCurFeatureIndex++;
@@ -1406,9 +1551,7 @@ static void OGR2SQLITE_GoToWishedIndex(OGR2SQLITE_vtab_cursor *pMyCursor)
 #endif
             } while (pMyCursor->nCurFeatureIndex < pMyCursor->nNextWishedIndex);
 
-            CPLFree(pMyCursor->pabyGeomBLOB);
-            pMyCursor->pabyGeomBLOB = nullptr;
-            pMyCursor->nGeomBLOBLen = -1;
+            OGR2SQLITE_ResetGeomBLOBs(pMyCursor);
         }
     }
 }
@@ -1487,74 +1630,42 @@ static int OGR2SQLITE_Column(sqlite3_vtab_cursor *pCursor,
                             SQLITE_TRANSIENT);
         return SQLITE_OK;
     }
-    else if (nCol == (nFieldCount + 1) && poFDefn->GetGeomType() != wkbNone)
+    else if (nCol > nFieldCount &&
+             nCol - (nFieldCount + 1) < pMyCursor->nGeomFieldCount)
     {
-        if (pMyCursor->nGeomBLOBLen < 0)
+        const int iGeomField = nCol - (nFieldCount + 1);
+        int &nGeomBLOBLen = pMyCursor->panGeomBLOBLen[iGeomField];
+        GByte *&pabyGeomBLOB = pMyCursor->papabyGeomBLOB[iGeomField];
+        if (nGeomBLOBLen < 0)
         {
-            OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
             if (poGeom == nullptr)
             {
-                pMyCursor->nGeomBLOBLen = 0;
+                nGeomBLOBLen = 0;
             }
             else
             {
-                CPLAssert(pMyCursor->pabyGeomBLOB == nullptr);
+                CPLAssert(pabyGeomBLOB == nullptr);
 
                 const OGRSpatialReference *poSRS =
                     poGeom->getSpatialReference();
                 int nSRSId = pMyCursor->pVTab->poModule->FetchSRSId(poSRS);
 
-                OGR2SQLITE_ExportGeometry(poGeom, nSRSId,
-                                          pMyCursor->pabyGeomBLOB,
-                                          pMyCursor->nGeomBLOBLen);
+                OGR2SQLITE_ExportGeometry(poGeom, nSRSId, pabyGeomBLOB,
+                                          nGeomBLOBLen);
             }
         }
 
-        if (pMyCursor->nGeomBLOBLen == 0)
+        if (nGeomBLOBLen == 0)
         {
             sqlite3_result_null(pContext);
         }
         else
         {
-            GByte *pabyGeomBLOBDup =
-                static_cast<GByte *>(CPLMalloc(pMyCursor->nGeomBLOBLen));
-            memcpy(pabyGeomBLOBDup, pMyCursor->pabyGeomBLOB,
-                   pMyCursor->nGeomBLOBLen);
-            sqlite3_result_blob(pContext, pabyGeomBLOBDup,
-                                pMyCursor->nGeomBLOBLen, CPLFree);
-        }
-
-        return SQLITE_OK;
-    }
-    else if (nCol > (nFieldCount + 1) &&
-             nCol - (nFieldCount + 1) < poFDefn->GetGeomFieldCount())
-    {
-        OGRGeometry *poGeom =
-            poFeature->GetGeomFieldRef(nCol - (nFieldCount + 1));
-        if (poGeom == nullptr)
-        {
-            sqlite3_result_null(pContext);
+            sqlite3_result_blob(pContext, pabyGeomBLOB, nGeomBLOBLen,
+                                SQLITE_TRANSIENT);
         }
-        else
-        {
-            const OGRSpatialReference *poSRS = poGeom->getSpatialReference();
-            int nSRSId = pMyCursor->pVTab->poModule->FetchSRSId(poSRS);
 
-            GByte *pabyGeomBLOB = nullptr;
-            int nGeomBLOBLen = 0;
-            OGR2SQLITE_ExportGeometry(poGeom, nSRSId, pabyGeomBLOB,
-                                      nGeomBLOBLen);
-
-            if (nGeomBLOBLen == 0)
-            {
-                sqlite3_result_null(pContext);
-            }
-            else
-            {
-                sqlite3_result_blob(pContext, pabyGeomBLOB, nGeomBLOBLen,
-                                    CPLFree);
-            }
-        }
         return SQLITE_OK;
     }
     else if (nCol == nFieldCount + 1 + poFDefn->GetGeomFieldCount())
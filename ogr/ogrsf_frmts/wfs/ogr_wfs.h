@@ -13,11 +13,15 @@
 #ifndef OGR_WFS_H_INCLUDED
 #define OGR_WFS_H_INCLUDED
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 #include <map>
 
 #include "cpl_minixml.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "gmlfeature.h"
 #include "cpl_http.h"
@@ -111,6 +115,24 @@ class OGRWFSLayer final : public OGRLayer
     int nPagingStartIndex;
     int nFeatureRead;
 
+    // Pages of features downloaded ahead by worker threads, indexed by
+    // their paging start index
+    struct PrefetchedPage
+    {
+        CPLString osURL{};
+        CPLHTTPResult *psResult = nullptr;
+        bool bDone = false;
+    };
+
+    std::mutex m_oPrefetchMutex{};
+    std::condition_variable m_oPrefetchCV{};
+    std::map<int, std::unique_ptr<PrefetchedPage>> m_oMapPrefetchedPages{};
+    CPLJobQueuePtr m_poPrefetchJobQueue{};
+
+    void SchedulePrefetch();
+    CPLHTTPResult *TakePrefetchedPage(const CPLString &osURL);
+    void ClearPrefetchedPages();
+
     OGRFeatureDefn *BuildLayerDefnFromFeatureClass(GMLFeatureClass *poClass);
 
     char *pszRequiredOutputFormat;
@@ -333,6 +355,7 @@ class OGRWFSDataSource final : public GDALDataset
     bool bPagingAllowed;
     int nPageSize;
     int nBaseStartIndex;
+    int nPrefetchPages = 0;
     bool DetectSupportPagingWFS2(const CPLXMLNode *psGetCapabilitiesResponse,
                                  const CPLXMLNode *psConfigurationRoot);
 
@@ -462,6 +485,7 @@ class OGRWFSDataSource final : public GDALDataset
     void SaveLayerSchema(const char *pszLayerName, const CPLXMLNode *psSchema);
 
     CPLHTTPResult *HTTPFetch(const char *pszURL, char **papszOptions);
+    CPLStringList GetHTTPFetchOptions(CSLConstList papszOptions) const;
 
     bool IsPagingAllowed() const
     {
@@ -478,6 +502,11 @@ class OGRWFSDataSource final : public GDALDataset
         return nBaseStartIndex;
     }
 
+    int GetPrefetchPages() const
+    {
+        return nPrefetchPages;
+    }
+
     void LoadMultipleLayerDefn(const char *pszLayerName, char *pszNS,
                                char *pszNSVal);
 
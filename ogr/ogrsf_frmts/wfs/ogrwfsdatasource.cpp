@@ -166,6 +166,9 @@ OGRWFSDataSource::OGRWFSDataSource()
       bKeepLayerNamePrefix(false), bEmptyAsNull(true),
       bInvertAxisOrderIfLatLong(true), bExposeGMLId(true)
 {
+    nPrefetchPages = std::max(
+        0, atoi(CPLGetConfigOption("OGR_WFS_PREFETCH_PAGES", "0")));
+
     if (bPagingAllowed)
     {
         const char *pszOption =
@@ -2139,6 +2142,22 @@ CPLString WFS_DecodeURL(const CPLString &osSrc)
     return ret;
 }
 
+/************************************************************************/
+/*                       GetHTTPFetchOptions()                          */
+/************************************************************************/
+
+CPLStringList
+OGRWFSDataSource::GetHTTPFetchOptions(CSLConstList papszOptions) const
+{
+    CPLStringList aosNewOptions(papszOptions);
+    if (bUseHttp10)
+        aosNewOptions.AddNameValue("HTTP_VERSION", "1.0");
+    if (papszHttpOptions)
+        aosNewOptions.Assign(
+            CSLMerge(aosNewOptions.StealList(), papszHttpOptions), true);
+    return aosNewOptions;
+}
+
 /************************************************************************/
 /*                            HTTPFetch()                               */
 /************************************************************************/
@@ -2146,14 +2165,8 @@ CPLString WFS_DecodeURL(const CPLString &osSrc)
 CPLHTTPResult *OGRWFSDataSource::HTTPFetch(const char *pszURL,
                                            char **papszOptions)
 {
-    char **papszNewOptions = CSLDuplicate(papszOptions);
-    if (bUseHttp10)
-        papszNewOptions =
-            CSLAddNameValue(papszNewOptions, "HTTP_VERSION", "1.0");
-    if (papszHttpOptions)
-        papszNewOptions = CSLMerge(papszNewOptions, papszHttpOptions);
-    CPLHTTPResult *psResult = CPLHTTPFetch(pszURL, papszNewOptions);
-    CSLDestroy(papszNewOptions);
+    CPLHTTPResult *psResult =
+        CPLHTTPFetch(pszURL, GetHTTPFetchOptions(papszOptions).List());
 
     if (psResult == nullptr)
     {
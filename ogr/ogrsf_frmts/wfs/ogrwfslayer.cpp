@@ -17,6 +17,7 @@
 #include "cpl_http.h"
 #include "parsexsd.h"
 #include "ogrwfsfilter.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                            OGRWFSLayer()                             */
@@ -79,6 +80,8 @@ OGRWFSLayer *OGRWFSLayer::Clone()
 OGRWFSLayer::~OGRWFSLayer()
 
 {
+    ClearPrefetchedPages();
+
     if (bInTransaction)
         OGRWFSLayer::CommitTransaction();
 
@@ -701,6 +704,123 @@ bool OGRWFSLayer::MustRetryIfNonCompliantServer(const char *pszServerAnswer)
     return bRetry;
 }
 
+/************************************************************************/
+/*                          SchedulePrefetch()                          */
+/************************************************************************/
+
+// Starts the download, in worker threads, of the GetFeature responses of
+// the OGR_WFS_PREFETCH_PAGES pages that follow the current one.
+void OGRWFSLayer::SchedulePrefetch()
+{
+    const int nPrefetchPages = poDS->GetPrefetchPages();
+    if (!m_poPrefetchJobQueue)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nPrefetchPages);
+        if (!poThreadPool)
+            return;
+        m_poPrefetchJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    const CPLStringList aosOptions(poDS->GetHTTPFetchOptions(nullptr));
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+    const int nCurStartIndex = nPagingStartIndex;
+    for (int i = 1; i <= nPrefetchPages; ++i)
+    {
+        const int nStartIndex = nCurStartIndex + i * poDS->GetPageSize();
+        if (m_nNumberMatched >= 0 && nStartIndex >= m_nNumberMatched)
+            break;
+        {
+            std::lock_guard oLock(m_oPrefetchMutex);
+            if (m_oMapPrefetchedPages.find(nStartIndex) !=
+                m_oMapPrefetchedPages.end())
+                continue;
+        }
+
+        auto poPage = std::make_unique<PrefetchedPage>();
+        nPagingStartIndex = nStartIndex;
+        poPage->osURL = MakeGetFeatureURL(0, FALSE);
+        PrefetchedPage *poPagePtr = poPage.get();
+        {
+            std::lock_guard oLock(m_oPrefetchMutex);
+            m_oMapPrefetchedPages[nStartIndex] = std::move(poPage);
+        }
+
+        const auto job =
+            [this, poPagePtr, aosOptions, aosThreadLocalConfigOptions]()
+        {
+            CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+            CPLHTTPResult *psResult;
+            {
+                // Errors are reported when the page is fetched again by
+                // the main thread.
+                CPLErrorStateBackuper oErrorStateBackuper(
+                    CPLQuietErrorHandler);
+                psResult = CPLHTTPFetch(poPagePtr->osURL, aosOptions.List());
+            }
+            CPLSetThreadLocalConfigOptions(nullptr);
+            {
+                std::lock_guard oLock(m_oPrefetchMutex);
+                poPagePtr->psResult = psResult;
+                poPagePtr->bDone = true;
+            }
+            m_oPrefetchCV.notify_all();
+        };
+        if (!m_poPrefetchJobQueue->SubmitJob(job))
+            job();
+    }
+    nPagingStartIndex = nCurStartIndex;
+}
+
+/************************************************************************/
+/*                         TakePrefetchedPage()                         */
+/************************************************************************/
+
+// Returns the prefetched response for the current page, waiting for its
+// download to complete, or nullptr if it is not available.
+CPLHTTPResult *OGRWFSLayer::TakePrefetchedPage(const CPLString &osURL)
+{
+    CPLHTTPResult *psResult = nullptr;
+    bool bMatch = false;
+    {
+        std::unique_lock oLock(m_oPrefetchMutex);
+        auto oIter = m_oMapPrefetchedPages.find(nPagingStartIndex);
+        if (oIter != m_oMapPrefetchedPages.end())
+        {
+            PrefetchedPage *poPage = oIter->second.get();
+            m_oPrefetchCV.wait(oLock, [poPage] { return poPage->bDone; });
+            psResult = poPage->psResult;
+            bMatch = poPage->osURL == osURL;
+            m_oMapPrefetchedPages.erase(oIter);
+        }
+    }
+
+    if (psResult && bMatch && psResult->nStatus == 0 &&
+        psResult->pszErrBuf == nullptr && psResult->pabyData != nullptr)
+    {
+        return psResult;
+    }
+
+    // The server did not return the expected number of features per page,
+    // or a request failed: discard what has been prefetched.
+    CPLHTTPDestroyResult(psResult);
+    ClearPrefetchedPages();
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        ClearPrefetchedPages()                        */
+/************************************************************************/
+
+void OGRWFSLayer::ClearPrefetchedPages()
+{
+    if (m_poPrefetchJobQueue)
+        m_poPrefetchJobQueue->WaitCompletion();
+    for (auto &oIter : m_oMapPrefetchedPages)
+        CPLHTTPDestroyResult(oIter.second->psResult);
+    m_oMapPrefetchedPages.clear();
+}
+
 /************************************************************************/
 /*                         FetchGetFeature()                            */
 /************************************************************************/
@@ -712,6 +832,12 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
     CPLDebug("WFS", "%s", osURL.c_str());
 
     CPLHTTPResult *psResult = nullptr;
+    if (nRequestMaxFeatures == 0 && bPagingActive &&
+        poDS->GetPrefetchPages() > 0)
+    {
+        psResult = TakePrefetchedPage(osURL);
+        SchedulePrefetch();
+    }
 
     CPLString osOutputFormat = CPLURLGetValue(osURL, "OUTPUTFORMAT");
 
@@ -735,7 +861,8 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
         }
     };
 
-    if (CPLTestBool(CPLGetConfigOption("OGR_WFS_USE_STREAMING", "YES")))
+    if (psResult == nullptr &&
+        CPLTestBool(CPLGetConfigOption("OGR_WFS_USE_STREAMING", "YES")))
     {
         CPLString osStreamingName;
         if (STARTS_WITH(osURL, "/vsimem/") &&
@@ -860,7 +987,8 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
     }
 
     bStreamingDS = false;
-    psResult = poDS->HTTPFetch(osURL, nullptr);
+    if (psResult == nullptr)
+        psResult = poDS->HTTPFetch(osURL, nullptr);
     if (psResult == nullptr)
     {
         return nullptr;
@@ -1212,6 +1340,7 @@ void OGRWFSLayer::ResetReading()
 {
     if (poFeatureDefn == nullptr)
         return;
+    ClearPrefetchedPages();
     if (bPagingActive)
         bReloadNeeded = true;
     nPagingStartIndex = 0;
@@ -20,8 +20,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <string>
 #include <mutex>
+#include <tuple>
 #include <set>
 #include <vector>
 
@@ -10827,6 +10829,7 @@ OGRErr OGRSpatialReference::SetExtension(const char *pszTargetKey,
 /************************************************************************/
 
 static void CleanupSRSWGS84Mutex();
+static void CleanupCachedSRS();
 
 /**
  * \brief Cleanup cached SRS related memory.
@@ -10845,6 +10848,7 @@ void OSRCleanup(void)
     OGRCTDumpStatistics();
     CSVDeaccess(nullptr);
     CleanupSRSWGS84Mutex();
+    CleanupCachedSRS();
     OSRCTCleanCache();
     OSRCleanupTLSContext();
 }
@@ -11489,6 +11493,196 @@ static void CleanupSRSWGS84Mutex()
     }
 }
 
+/************************************************************************/
+/*                         Shared SRS cache                             */
+/************************************************************************/
+
+namespace
+{
+struct OGRCachedSRSKey
+{
+    std::string osDefinition;
+    std::string osOptions;
+    OSRAxisMappingStrategy eAxisMappingStrategy;
+
+    bool operator<(const OGRCachedSRSKey &other) const
+    {
+        return std::tie(eAxisMappingStrategy, osDefinition, osOptions) <
+               std::tie(other.eAxisMappingStrategy, other.osDefinition,
+                        other.osOptions);
+    }
+};
+
+struct OGRCachedIsSameValue
+{
+    std::weak_ptr<const OGRSpatialReference> poSRS1{};
+    std::weak_ptr<const OGRSpatialReference> poSRS2{};
+    bool bIsSame = false;
+};
+
+typedef std::pair<const OGRSpatialReference *, const OGRSpatialReference *>
+    OGRCachedIsSameKey;
+
+constexpr size_t CACHED_SRS_MAX_SIZE = 256;
+
+typedef lru11::Cache<
+    OGRCachedSRSKey, std::shared_ptr<const OGRSpatialReference>,
+    lru11::NullLock,
+    std::map<OGRCachedSRSKey,
+             typename std::list<lru11::KeyValuePair<
+                 OGRCachedSRSKey,
+                 std::shared_ptr<const OGRSpatialReference>>>::iterator>>
+    OGRCachedSRSMap;
+
+typedef lru11::Cache<
+    OGRCachedIsSameKey, OGRCachedIsSameValue, lru11::NullLock,
+    std::map<OGRCachedIsSameKey,
+             typename std::list<lru11::KeyValuePair<
+                 OGRCachedIsSameKey, OGRCachedIsSameValue>>::iterator>>
+    OGRCachedIsSameMap;
+
+std::mutex goCachedSRSMutex;
+// Allocated on the heap and freed by OSRCleanup(), so that cached objects
+// are not destroyed during static destruction, after PROJ contexts.
+OGRCachedSRSMap *gpoCachedSRS = nullptr;
+OGRCachedIsSameMap *gpoCachedIsSame = nullptr;
+}  // namespace
+
+/************************************************************************/
+/*                       GetCachedFromUserInput()                       */
+/************************************************************************/
+
+/**
+ * \brief Returns a shared read-only instance of a SRS object, initialized with
+ * SetFromUserInput().
+ *
+ * Instances are cached process-wide, and keyed by the definition and the
+ * axis mapping strategy, so that repeated requests with the same definition,
+ * typically done by drivers when opening many layers or tiles, do not
+ * re-parse it. Returned instances are thread-safe (see
+ * AssignAndSetThreadSafe()), and must not be modified (their methods that
+ * are not const must not be called).
+ *
+ * Failures to parse the definition are not cached.
+ *
+ * @param pszDefinition Definition, as accepted by SetFromUserInput().
+ * @param eAxisMappingStrategy Axis mapping strategy of the returned instance.
+ * @param papszOptions Options passed to SetFromUserInput(), or nullptr.
+ * @return a shared instance, or nullptr in case of error.
+ * @since GDAL 3.12
+ */
+
+std::shared_ptr<const OGRSpatialReference>
+OGRSpatialReference::GetCachedFromUserInput(
+    const char *pszDefinition, OSRAxisMappingStrategy eAxisMappingStrategy,
+    CSLConstList papszOptions)
+{
+    OGRCachedSRSKey oKey{pszDefinition, std::string(), eAxisMappingStrategy};
+    for (CSLConstList papszIter = papszOptions; papszIter && *papszIter;
+         ++papszIter)
+    {
+        oKey.osOptions += *papszIter;
+        oKey.osOptions += '\n';
+    }
+    {
+        std::lock_guard oLock(goCachedSRSMutex);
+        std::shared_ptr<const OGRSpatialReference> poSRS;
+        if (gpoCachedSRS && gpoCachedSRS->tryGet(oKey, poSRS))
+            return poSRS;
+    }
+
+    // Done outside of the lock, so that slow definitions (e.g. network
+    // access) do not block other threads.
+    OGRSpatialReference oSRS;
+    if (oSRS.SetFromUserInput(pszDefinition, papszOptions) != OGRERR_NONE)
+        return nullptr;
+    oSRS.SetAxisMappingStrategy(eAxisMappingStrategy);
+
+    // Use Release() rather than delete, in case Reference() has been called
+    // on it, typically by OGRGeomFieldDefn::SetSpatialRef()
+    std::shared_ptr<const OGRSpatialReference> poSRS(
+        new OGRSpatialReference(), OGRSpatialReferenceReleaser());
+    const_cast<OGRSpatialReference *>(poSRS.get())
+        ->AssignAndSetThreadSafe(oSRS);
+
+    std::lock_guard oLock(goCachedSRSMutex);
+    std::shared_ptr<const OGRSpatialReference> poOtherSRS;
+    // Another thread may have inserted it in the meantime
+    if (!gpoCachedSRS)
+        gpoCachedSRS = new OGRCachedSRSMap(CACHED_SRS_MAX_SIZE);
+    else if (gpoCachedSRS->tryGet(oKey, poOtherSRS))
+        return poOtherSRS;
+    gpoCachedSRS->insert(std::move(oKey), poSRS);
+    return poSRS;
+}
+
+/************************************************************************/
+/*                           IsSameCached()                             */
+/************************************************************************/
+
+/**
+ * \brief Returns whether two SRS are the same, with the default options of
+ * IsSame(), and cache the result.
+ *
+ * This is meant to be used with instances returned by
+ * GetCachedFromUserInput(), or more generally instances that are not modified
+ * once shared, for which the result of the comparison does not change.
+ *
+ * @since GDAL 3.12
+ */
+
+bool OGRSpatialReference::IsSameCached(
+    const std::shared_ptr<const OGRSpatialReference> &poSRS1,
+    const std::shared_ptr<const OGRSpatialReference> &poSRS2)
+{
+    if (poSRS1 == poSRS2)
+        return true;
+    if (!poSRS1 || !poSRS2)
+        return false;
+
+    // Normalize the order of the pair, as IsSame() is symmetric
+    const bool bSwap = std::less<const OGRSpatialReference *>()(poSRS2.get(),
+                                                                poSRS1.get());
+    const auto &poFirst = bSwap ? poSRS2 : poSRS1;
+    const auto &poSecond = bSwap ? poSRS1 : poSRS2;
+    const OGRCachedIsSameKey oKey(poFirst.get(), poSecond.get());
+    {
+        std::lock_guard oLock(goCachedSRSMutex);
+        OGRCachedIsSameValue oValue;
+        // The address of an object that is no longer alive may have been
+        // reused, so check that the cached entry is about the same objects.
+        if (gpoCachedIsSame && gpoCachedIsSame->tryGet(oKey, oValue) &&
+            oValue.poSRS1.lock() == poFirst && oValue.poSRS2.lock() == poSecond)
+        {
+            return oValue.bIsSame;
+        }
+    }
+
+    OGRCachedIsSameValue oValue;
+    oValue.poSRS1 = poFirst;
+    oValue.poSRS2 = poSecond;
+    oValue.bIsSame = CPL_TO_BOOL(poFirst->IsSame(poSecond.get()));
+
+    std::lock_guard oLock(goCachedSRSMutex);
+    if (!gpoCachedIsSame)
+        gpoCachedIsSame = new OGRCachedIsSameMap(CACHED_SRS_MAX_SIZE);
+    gpoCachedIsSame->insert(oKey, oValue);
+    return oValue.bIsSame;
+}
+
+/************************************************************************/
+/*                          CleanupCachedSRS()                          */
+/************************************************************************/
+
+static void CleanupCachedSRS()
+{
+    std::lock_guard oLock(goCachedSRSMutex);
+    delete gpoCachedIsSame;
+    gpoCachedIsSame = nullptr;
+    delete gpoCachedSRS;
+    gpoCachedSRS = nullptr;
+}
+
 /************************************************************************/
 /*                         OSRImportFromProj4()                         */
 /************************************************************************/
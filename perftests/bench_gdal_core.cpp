@@ -0,0 +1,777 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Micro-benchmarks of core hot paths
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_time.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "gdalwarper.h"
+#include "ogr_api.h"
+#include "ogr_geometry.h"
+#include "ogr_recordbatch.h"
+#include "ogrsf_frmts.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Benchmarks of the code paths that dominate typical raster and vector
+// workloads, run on synthetic in-memory data so that results only depend on
+// the build and the machine.
+//
+// Command line options and JSON output follow the conventions of Google
+// Benchmark, so that its tools/compare.py script can be used to compare the
+// output of two builds:
+//   bench_gdal_core --benchmark_out=before.json
+//   bench_gdal_core --benchmark_out=after.json
+//   compare.py benchmarks before.json after.json
+
+namespace
+{
+
+/************************************************************************/
+/*                            BenchmarkCase                             */
+/************************************************************************/
+
+// The setup function prepares the data and returns the function run at
+// each iteration. The latter returns the number of items it processed, used
+// to compute a throughput.
+using BenchmarkBody = std::function<GIntBig()>;
+using BenchmarkSetup = std::function<BenchmarkBody()>;
+
+struct BenchmarkCase
+{
+    std::string osName{};
+    BenchmarkSetup setup{};
+};
+
+std::vector<BenchmarkCase> &GetCases()
+{
+    static std::vector<BenchmarkCase> aoCases;
+    return aoCases;
+}
+
+void Register(const std::string &osName, BenchmarkSetup setup)
+{
+    GetCases().push_back(BenchmarkCase{osName, std::move(setup)});
+}
+
+/************************************************************************/
+/*                          FillPseudoRandom()                          */
+/************************************************************************/
+
+// Deterministic content, so that runs are reproducible
+void FillPseudoRandom(GDALRasterBand *poBand)
+{
+    const int nXSize = poBand->GetXSize();
+    const int nYSize = poBand->GetYSize();
+    std::vector<double> adfLine(nXSize);
+    uint32_t nState = 12345;
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            nState = nState * 1103515245U + 12345U;
+            // Smooth gradient plus noise, closer to real imagery than
+            // white noise
+            adfLine[iX] = ((iX + iY) / 16 + ((nState >> 16) & 63)) % 256;
+        }
+        CPL_IGNORE_RET_VAL(poBand->RasterIO(GF_Write, 0, iY, nXSize, 1,
+                                            adfLine.data(), nXSize, 1,
+                                            GDT_Float64, 0, 0, nullptr));
+    }
+}
+
+std::shared_ptr<GDALDataset> CreateMEMRaster(int nXSize, int nYSize,
+                                             GDALDataType eDT)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    std::shared_ptr<GDALDataset> poDS(
+        poDriver->Create("", nXSize, nYSize, 1, eDT, nullptr));
+    FillPseudoRandom(poDS->GetRasterBand(1));
+    return poDS;
+}
+
+/************************************************************************/
+/*                        RegisterCopyWords()                           */
+/************************************************************************/
+
+void RegisterCopyWords()
+{
+    const std::pair<GDALDataType, GDALDataType> aPairs[] = {
+        {GDT_Byte, GDT_Byte},      {GDT_Byte, GDT_Float32},
+        {GDT_Float32, GDT_Byte},   {GDT_Int16, GDT_Float64},
+        {GDT_UInt16, GDT_Byte},    {GDT_Float64, GDT_Float32},
+        {GDT_Float32, GDT_Float64}};
+    for (const auto &[eSrcDT, eDstDT] : aPairs)
+    {
+        for (const bool bInterleaved : {false, true})
+        {
+            std::string osName("CopyWords/");
+            osName += GDALGetDataTypeName(eSrcDT);
+            osName += "_to_";
+            osName += GDALGetDataTypeName(eDstDT);
+            if (bInterleaved)
+                osName += "/src_stride3";
+            Register(
+                osName,
+                [eSrcDT = eSrcDT, eDstDT = eDstDT, bInterleaved]()
+                {
+                    constexpr int N_WORDS = 1024 * 1024;
+                    const int nSrcSize = GDALGetDataTypeSizeBytes(eSrcDT);
+                    const int nDstSize = GDALGetDataTypeSizeBytes(eDstDT);
+                    const int nSrcStride =
+                        bInterleaved ? 3 * nSrcSize : nSrcSize;
+                    auto pabySrc = std::make_shared<std::vector<GByte>>(
+                        static_cast<size_t>(N_WORDS) * nSrcStride);
+                    for (size_t i = 0; i < pabySrc->size(); ++i)
+                        (*pabySrc)[i] = static_cast<GByte>(i * 7);
+                    auto pabyDst = std::make_shared<std::vector<GByte>>(
+                        static_cast<size_t>(N_WORDS) * nDstSize);
+                    return [=]()
+                    {
+                        GDALCopyWords(pabySrc->data(), eSrcDT, nSrcStride,
+                                      pabyDst->data(), eDstDT, nDstSize,
+                                      N_WORDS);
+                        return static_cast<GIntBig>(N_WORDS);
+                    };
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                        RegisterRasterIO()                            */
+/************************************************************************/
+
+void RegisterRasterIO()
+{
+    const std::pair<const char *, GDALRIOResampleAlg> aAlgs[] = {
+        {"nearest", GRIORA_NearestNeighbour},
+        {"bilinear", GRIORA_Bilinear},
+        {"cubic", GRIORA_Cubic},
+        {"lanczos", GRIORA_Lanczos},
+        {"average", GRIORA_Average},
+        {"mode", GRIORA_Mode}};
+    for (const auto &[pszAlg, eAlg] : aAlgs)
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+        {
+            // Downsampling by a non-integer factor, and upsampling
+            for (const double dfFactor : {0.4, 2.5})
+            {
+                if (dfFactor > 1 &&
+                    (eAlg == GRIORA_Average || eAlg == GRIORA_Mode))
+                    continue;
+                const std::string osName(CPLSPrintf(
+                    "RasterIO/%s/%s/%s", pszAlg, GDALGetDataTypeName(eDT),
+                    dfFactor < 1 ? "downsample" : "upsample"));
+                Register(
+                    osName,
+                    [eAlg = eAlg, eDT, dfFactor]()
+                    {
+                        const int nSrcSize = dfFactor < 1 ? 2048 : 512;
+                        auto poDS = CreateMEMRaster(nSrcSize, nSrcSize, eDT);
+                        const int nBufSize =
+                            static_cast<int>(nSrcSize * dfFactor);
+                        auto pabyBuf = std::make_shared<std::vector<GByte>>(
+                            static_cast<size_t>(nBufSize) * nBufSize *
+                            GDALGetDataTypeSizeBytes(eDT));
+                        return [=]()
+                        {
+                            GDALRasterIOExtraArg sExtraArg;
+                            INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+                            sExtraArg.eResampleAlg = eAlg;
+                            CPL_IGNORE_RET_VAL(
+                                poDS->GetRasterBand(1)->RasterIO(
+                                    GF_Read, 0, 0, nSrcSize, nSrcSize,
+                                    pabyBuf->data(), nBufSize, nBufSize, eDT,
+                                    0, 0, &sExtraArg));
+                            return static_cast<GIntBig>(nBufSize) * nBufSize;
+                        };
+                    });
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                        RegisterOverviews()                           */
+/************************************************************************/
+
+void RegisterOverviews()
+{
+    for (const char *pszAlg :
+         {"NEAREST", "AVERAGE", "RMS", "BILINEAR", "CUBIC", "MODE"})
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+        {
+            const std::string osName(CPLSPrintf("Overview/%s/%s", pszAlg,
+                                                GDALGetDataTypeName(eDT)));
+            Register(osName,
+                     [pszAlg, eDT]()
+                     {
+                         constexpr int SIZE = 2048;
+                         auto poSrcDS = CreateMEMRaster(SIZE, SIZE, eDT);
+                         auto poOvrDS =
+                             CreateMEMRaster(SIZE / 2, SIZE / 2, eDT);
+                         return [=]()
+                         {
+                             GDALRasterBandH hOvrBand =
+                                 GDALRasterBand::ToHandle(
+                                     poOvrDS->GetRasterBand(1));
+                             CPL_IGNORE_RET_VAL(GDALRegenerateOverviews(
+                                 GDALRasterBand::ToHandle(
+                                     poSrcDS->GetRasterBand(1)),
+                                 1, &hOvrBand, pszAlg, nullptr, nullptr));
+                             return static_cast<GIntBig>(SIZE / 2) *
+                                    (SIZE / 2);
+                         };
+                     });
+        }
+    }
+}
+
+/************************************************************************/
+/*                          RegisterWarp()                              */
+/************************************************************************/
+
+void RegisterWarp()
+{
+    const std::pair<const char *, GDALResampleAlg> aAlgs[] = {
+        {"near", GRA_NearestNeighbour}, {"bilinear", GRA_Bilinear},
+        {"cubic", GRA_Cubic},           {"cubicspline", GRA_CubicSpline},
+        {"lanczos", GRA_Lanczos},       {"average", GRA_Average}};
+    for (const auto &[pszAlg, eAlg] : aAlgs)
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+        {
+            const std::string osName(CPLSPrintf("Warp/%s/%s", pszAlg,
+                                                GDALGetDataTypeName(eDT)));
+            Register(
+                osName,
+                [eAlg = eAlg, eDT]()
+                {
+                    constexpr int SRC_SIZE = 1024;
+                    constexpr int DST_SIZE = 800;
+                    auto poSrcDS = CreateMEMRaster(SRC_SIZE, SRC_SIZE, eDT);
+                    GDALGeoTransform srcGT;
+                    srcGT.yorig = SRC_SIZE;
+                    srcGT.yscale = -1;
+                    poSrcDS->SetGeoTransform(srcGT);
+
+                    auto poDriver =
+                        GetGDALDriverManager()->GetDriverByName("MEM");
+                    std::shared_ptr<GDALDataset> poDstDS(poDriver->Create(
+                        "", DST_SIZE, DST_SIZE, 1, eDT, nullptr));
+                    // Slightly shifted and scaled grid, so that all
+                    // resampling kernels do actual interpolation
+                    const double dfRes =
+                        static_cast<double>(SRC_SIZE) / DST_SIZE;
+                    GDALGeoTransform dstGT;
+                    dstGT.xorig = 0.3;
+                    dstGT.xscale = dfRes;
+                    dstGT.yorig = SRC_SIZE - 0.3;
+                    dstGT.yscale = -dfRes;
+                    poDstDS->SetGeoTransform(dstGT);
+                    return [=]()
+                    {
+                        CPL_IGNORE_RET_VAL(GDALReprojectImage(
+                            GDALDataset::ToHandle(poSrcDS.get()), nullptr,
+                            GDALDataset::ToHandle(poDstDS.get()), nullptr,
+                            eAlg, 0, 0, nullptr, nullptr, nullptr));
+                        return static_cast<GIntBig>(DST_SIZE) * DST_SIZE;
+                    };
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                       RegisterBlockCache()                           */
+/************************************************************************/
+
+// Several threads, each with its own dataset handle, reading blocks that
+// are all in the block cache: this measures the cost of cache lookups and
+// of the contention on the global cache lock.
+void RegisterBlockCache()
+{
+    const int nMaxThreads =
+        std::max(1, std::min(8, static_cast<int>(CPLGetNumCPUs())));
+    for (int nThreads = 1; nThreads <= nMaxThreads; nThreads *= 2)
+    {
+        Register(
+            CPLSPrintf("BlockCache/threads:%d", nThreads),
+            [nThreads]()
+            {
+                constexpr int SIZE = 2048;
+                constexpr int BLOCK_SIZE = 64;
+                const std::string osFilename(
+                    VSIMemGenerateHiddenFilename("bench_block_cache.tif"));
+                {
+                    auto poSrcDS = CreateMEMRaster(SIZE, SIZE, GDT_Byte);
+                    CPLStringList aosOptions;
+                    aosOptions.SetNameValue("TILED", "YES");
+                    aosOptions.SetNameValue("BLOCKXSIZE",
+                                            CPLSPrintf("%d", BLOCK_SIZE));
+                    aosOptions.SetNameValue("BLOCKYSIZE",
+                                            CPLSPrintf("%d", BLOCK_SIZE));
+                    auto poDriver =
+                        GetGDALDriverManager()->GetDriverByName("GTiff");
+                    std::unique_ptr<GDALDataset>(
+                        poDriver->CreateCopy(osFilename.c_str(), poSrcDS.get(),
+                                             false, aosOptions.List(), nullptr,
+                                             nullptr))
+                        .reset();
+                }
+                if (GDALGetCacheMax64() < 4 * SIZE * SIZE * nThreads)
+                    GDALSetCacheMax64(4 * SIZE * SIZE * nThreads);
+
+                using DatasetVector = std::vector<std::unique_ptr<GDALDataset>>;
+                auto apoDS = std::make_shared<DatasetVector>();
+                for (int i = 0; i < nThreads; ++i)
+                {
+                    apoDS->emplace_back(GDALDataset::Open(
+                        osFilename.c_str(), GDAL_OF_RASTER));
+                }
+                // The file is kept open by the datasets
+                VSIUnlink(osFilename.c_str());
+
+                return [apoDS, nThreads]()
+                {
+                    const auto ReadAllBlocks = [](GDALDataset *poDS)
+                    {
+                        GByte abyBuffer[BLOCK_SIZE * BLOCK_SIZE];
+                        auto poBand = poDS->GetRasterBand(1);
+                        for (int iY = 0; iY < SIZE; iY += BLOCK_SIZE)
+                        {
+                            for (int iX = 0; iX < SIZE; iX += BLOCK_SIZE)
+                            {
+                                CPL_IGNORE_RET_VAL(poBand->RasterIO(
+                                    GF_Read, iX, iY, BLOCK_SIZE, BLOCK_SIZE,
+                                    abyBuffer, BLOCK_SIZE, BLOCK_SIZE,
+                                    GDT_Byte, 0, 0, nullptr));
+                            }
+                        }
+                    };
+                    std::vector<std::thread> aoThreads;
+                    for (int i = 0; i < nThreads; ++i)
+                        aoThreads.emplace_back(ReadAllBlocks,
+                                               (*apoDS)[i].get());
+                    for (auto &oThread : aoThreads)
+                        oThread.join();
+                    return static_cast<GIntBig>(nThreads) *
+                           (SIZE / BLOCK_SIZE) * (SIZE / BLOCK_SIZE);
+                };
+            });
+    }
+}
+
+/************************************************************************/
+/*                           RegisterWKB()                              */
+/************************************************************************/
+
+void RegisterWKB()
+{
+    const std::pair<const char *, std::function<OGRGeometry *()>> aGeoms[] = {
+        {"linestring_10000pts",
+         []()
+         {
+             auto poLS = new OGRLineString();
+             for (int i = 0; i < 10000; ++i)
+                 poLS->addPoint(i, i % 100);
+             return poLS;
+         }},
+        {"multipolygon_1000x5pts",
+         []()
+         {
+             auto poMP = new OGRMultiPolygon();
+             for (int i = 0; i < 1000; ++i)
+             {
+                 auto poRing = std::make_unique<OGRLinearRing>();
+                 poRing->addPoint(i, 0);
+                 poRing->addPoint(i + 1, 0);
+                 poRing->addPoint(i + 1, 1);
+                 poRing->addPoint(i, 1);
+                 poRing->addPoint(i, 0);
+                 auto poPoly = std::make_unique<OGRPolygon>();
+                 poPoly->addRing(std::move(poRing));
+                 poMP->addGeometry(std::move(poPoly));
+             }
+             return poMP;
+         }},
+        {"multipoint_10000pts",
+         []()
+         {
+             auto poMP = new OGRMultiPoint();
+             for (int i = 0; i < 10000; ++i)
+                 poMP->addGeometryDirectly(new OGRPoint(i, i % 100));
+             return poMP;
+         }}};
+    for (const auto &[pszName, factory] : aGeoms)
+    {
+        Register(std::string("WKB/import/").append(pszName),
+                 [factory = factory]()
+                 {
+                     std::unique_ptr<OGRGeometry> poGeom(factory());
+                     auto pabyWKB = std::make_shared<std::vector<GByte>>(
+                         poGeom->WkbSize());
+                     poGeom->exportToWkb(wkbNDR, pabyWKB->data(),
+                                         wkbVariantIso);
+                     return [pabyWKB]()
+                     {
+                         OGRGeometry *poGeomOut = nullptr;
+                         CPL_IGNORE_RET_VAL(OGRGeometryFactory::createFromWkb(
+                             pabyWKB->data(), nullptr, &poGeomOut,
+                             pabyWKB->size(), wkbVariantIso));
+                         delete poGeomOut;
+                         return static_cast<GIntBig>(pabyWKB->size());
+                     };
+                 });
+    }
+}
+
+/************************************************************************/
+/*                         CreateMEMLayer()                             */
+/************************************************************************/
+
+constexpr int N_FEATURES = 100 * 1000;
+
+std::shared_ptr<GDALDataset> CreateMEMLayer()
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    std::shared_ptr<GDALDataset> poDS(
+        poDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+    auto poLayer = poDS->CreateLayer("layer", nullptr, wkbPoint, nullptr);
+    OGRFieldDefn oFieldInt("i", OFTInteger);
+    poLayer->CreateField(&oFieldInt);
+    OGRFieldDefn oFieldReal("r", OFTReal);
+    poLayer->CreateField(&oFieldReal);
+    OGRFieldDefn oFieldStr("s", OFTString);
+    poLayer->CreateField(&oFieldStr);
+    for (int i = 0; i < N_FEATURES; ++i)
+    {
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        oFeature.SetField(0, i);
+        oFeature.SetField(1, (i * 37) % 1000 / 10.0);
+        oFeature.SetField(2, CPLSPrintf("val%d", i % 10));
+        oFeature.SetGeometryDirectly(new OGRPoint(i % 1000, i / 1000));
+        CPL_IGNORE_RET_VAL(poLayer->CreateFeature(&oFeature));
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                        RegisterOGRSQL()                              */
+/************************************************************************/
+
+void RegisterOGRSQL()
+{
+    const std::pair<const char *, const char *> aFilters[] = {
+        {"int_comparison", "i < 50000"},
+        {"string_equality", "s = 'val3'"},
+        {"string_like", "s LIKE 'val1%'"},
+        {"between_and_in", "r BETWEEN 10 AND 20 AND s IN ('val1', 'val2')"},
+        {"arithmetic", "i * 2 + r > 100000"}};
+    for (const auto &[pszName, pszFilter] : aFilters)
+    {
+        Register(std::string("OGRSQL/filter/").append(pszName),
+                 [pszFilter = pszFilter]()
+                 {
+                     auto poDS = CreateMEMLayer();
+                     return [poDS, pszFilter]()
+                     {
+                         auto poLayer = poDS->GetLayer(0);
+                         poLayer->SetAttributeFilter(pszFilter);
+                         for (auto &&poFeature : poLayer)
+                             CPL_IGNORE_RET_VAL(poFeature);
+                         poLayer->SetAttributeFilter(nullptr);
+                         return static_cast<GIntBig>(N_FEATURES);
+                     };
+                 });
+    }
+    Register("OGRSQL/select_distinct",
+             []()
+             {
+                 auto poDS = CreateMEMLayer();
+                 return [poDS]()
+                 {
+                     OGRLayer *poLayer = poDS->ExecuteSQL(
+                         "SELECT DISTINCT s FROM layer", nullptr, nullptr);
+                     if (poLayer)
+                     {
+                         for (auto &&poFeature : poLayer)
+                             CPL_IGNORE_RET_VAL(poFeature);
+                         poDS->ReleaseResultSet(poLayer);
+                     }
+                     return static_cast<GIntBig>(N_FEATURES);
+                 };
+             });
+}
+
+/************************************************************************/
+/*                      RegisterArrowStream()                           */
+/************************************************************************/
+
+void RegisterArrowStream()
+{
+    for (const bool bWithGeometry : {false, true})
+    {
+        Register(bWithGeometry ? "ArrowStream/with_geometry"
+                               : "ArrowStream/attributes_only",
+                 [bWithGeometry]()
+                 {
+                     auto poDS = CreateMEMLayer();
+                     return [poDS, bWithGeometry]()
+                     {
+                         auto poLayer = poDS->GetLayer(0);
+                         if (!bWithGeometry)
+                         {
+                             const char *const apszIgnored[] = {
+                                 "OGR_GEOMETRY", nullptr};
+                             poLayer->SetIgnoredFields(apszIgnored);
+                         }
+                         struct ArrowArrayStream stream;
+                         if (poLayer->GetArrowStream(&stream))
+                         {
+                             while (true)
+                             {
+                                 struct ArrowArray array;
+                                 if (stream.get_next(&stream, &array) != 0 ||
+                                     array.release == nullptr)
+                                     break;
+                                 array.release(&array);
+                             }
+                             stream.release(&stream);
+                         }
+                         poLayer->SetIgnoredFields(nullptr);
+                         return static_cast<GIntBig>(N_FEATURES);
+                     };
+                 });
+    }
+}
+
+/************************************************************************/
+/*                             Usage()                                  */
+/************************************************************************/
+
+void Usage()
+{
+    printf("Usage: bench_gdal_core [--benchmark_list_tests]\n");
+    printf("                       [--benchmark_filter=<regex>]\n");
+    printf("                       [--benchmark_repetitions=<n>]\n");
+    printf("                       [--benchmark_min_time=<seconds>]\n");
+    printf("                       [--benchmark_out=<file.json>]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                              RunCase()                               */
+/************************************************************************/
+
+struct RunResult
+{
+    GIntBig nIterations = 0;
+    double dfRealTimeNs = 0;  // per iteration
+    double dfCPUTimeNs = 0;   // per iteration
+    GIntBig nItems = 0;       // per iteration (pixels, features, bytes...)
+};
+
+RunResult RunCase(const BenchmarkBody &body, double dfMinTime)
+{
+    RunResult res;
+    const auto start = std::chrono::steady_clock::now();
+    const clock_t startCPU = clock();
+    double dfElapsed = 0;
+    // Run at least twice, and until the minimum duration is reached
+    do
+    {
+        res.nItems = body();
+        ++res.nIterations;
+        dfElapsed = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    } while (res.nIterations < 2 || dfElapsed < dfMinTime);
+    const double dfCPU =
+        static_cast<double>(clock() - startCPU) / CLOCKS_PER_SEC;
+    res.dfRealTimeNs = dfElapsed * 1e9 / static_cast<double>(res.nIterations);
+    res.dfCPUTimeNs = dfCPU * 1e9 / static_cast<double>(res.nIterations);
+    return res;
+}
+
+CPLJSONObject ResultAsJSON(const std::string &osName, const RunResult &res,
+                           int nRepetitions, int iRepetition,
+                           const char *pszAggregate)
+{
+    CPLJSONObject oObj;
+    oObj.Add("name", pszAggregate ? osName + "_" + pszAggregate : osName);
+    oObj.Add("run_name", osName);
+    oObj.Add("run_type", pszAggregate ? "aggregate" : "iteration");
+    oObj.Add("repetitions", nRepetitions);
+    if (pszAggregate)
+        oObj.Add("aggregate_name", pszAggregate);
+    else
+        oObj.Add("repetition_index", iRepetition);
+    oObj.Add("threads", 1);
+    oObj.Add("iterations", static_cast<GInt64>(res.nIterations));
+    oObj.Add("real_time", res.dfRealTimeNs);
+    oObj.Add("cpu_time", res.dfCPUTimeNs);
+    oObj.Add("time_unit", "ns");
+    if (res.dfRealTimeNs > 0)
+        oObj.Add("items_per_second",
+                 static_cast<double>(res.nItems) * 1e9 / res.dfRealTimeNs);
+    return oObj;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    std::string osFilter(".*");
+    int nRepetitions = 3;
+    double dfMinTime = 0.5;
+    std::string osOut;
+    bool bList = false;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        const char *pszArg = argv[iArg];
+        if (STARTS_WITH(pszArg, "--benchmark_filter="))
+            osFilter = pszArg + strlen("--benchmark_filter=");
+        else if (STARTS_WITH(pszArg, "--benchmark_repetitions="))
+            nRepetitions = std::max(
+                1, atoi(pszArg + strlen("--benchmark_repetitions=")));
+        else if (STARTS_WITH(pszArg, "--benchmark_min_time="))
+            dfMinTime = CPLAtof(pszArg + strlen("--benchmark_min_time="));
+        else if (STARTS_WITH(pszArg, "--benchmark_out="))
+            osOut = pszArg + strlen("--benchmark_out=");
+        else if (strcmp(pszArg, "--benchmark_list_tests") == 0)
+            bList = true;
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    RegisterCopyWords();
+    RegisterRasterIO();
+    RegisterOverviews();
+    RegisterWarp();
+    RegisterBlockCache();
+    RegisterWKB();
+    RegisterOGRSQL();
+    RegisterArrowStream();
+
+    std::regex oFilter;
+    try
+    {
+        oFilter = std::regex(osFilter);
+    }
+    catch (const std::regex_error &e)
+    {
+        fprintf(stderr, "Invalid --benchmark_filter: %s\n", e.what());
+        exit(1);
+    }
+
+    CPLJSONArray oBenchmarks;
+    for (const auto &oCase : GetCases())
+    {
+        if (!std::regex_search(oCase.osName, oFilter))
+            continue;
+        if (bList)
+        {
+            printf("%s\n", oCase.osName.c_str());
+            continue;
+        }
+
+        const BenchmarkBody body = oCase.setup();
+        // Warm-up run, not accounted
+        body();
+
+        std::vector<RunResult> aoResults;
+        for (int i = 0; i < nRepetitions; ++i)
+        {
+            aoResults.push_back(RunCase(body, dfMinTime));
+            oBenchmarks.Add(ResultAsJSON(oCase.osName, aoResults.back(),
+                                         nRepetitions, i, nullptr));
+        }
+        std::sort(aoResults.begin(), aoResults.end(),
+                  [](const RunResult &a, const RunResult &b)
+                  { return a.dfRealTimeNs < b.dfRealTimeNs; });
+        const RunResult &median = aoResults[aoResults.size() / 2];
+        if (nRepetitions > 1)
+        {
+            oBenchmarks.Add(ResultAsJSON(oCase.osName, median, nRepetitions,
+                                         0, "median"));
+        }
+
+        printf("%-45s %12.0f ns %14.0f items/s\n", oCase.osName.c_str(),
+               median.dfRealTimeNs,
+               median.dfRealTimeNs > 0 ? static_cast<double>(median.nItems) *
+                                             1e9 / median.dfRealTimeNs
+                                       : 0.0);
+        fflush(stdout);
+    }
+
+    if (!osOut.empty())
+    {
+        CPLJSONObject oContext;
+        char szDate[64] = {};
+        const time_t nNow = time(nullptr);
+        struct tm brokenDown;
+        CPLUnixTimeToYMDHMS(nNow, &brokenDown);
+        strftime(szDate, sizeof(szDate), "%Y-%m-%dT%H:%M:%S+00:00",
+                 &brokenDown);
+        oContext.Add("date", szDate);
+        oContext.Add("executable", argv[0]);
+        oContext.Add("num_cpus", CPLGetNumCPUs());
+        oContext.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+        oContext.Add("gdal_build_info", GDALVersionInfo("BUILD_INFO"));
+#ifdef DEBUG
+        oContext.Add("library_build_type", "debug");
+#else
+        oContext.Add("library_build_type", "release");
+#endif
+
+        CPLJSONDocument oDoc;
+        oDoc.GetRoot().Add("context", oContext);
+        oDoc.GetRoot().Add("benchmarks", oBenchmarks);
+        if (!oDoc.Save(osOut))
+        {
+            fprintf(stderr, "Cannot write %s\n", osOut.c_str());
+            exit(1);
+        }
+    }
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return 0;
+}
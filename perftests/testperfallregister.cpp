@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test start-up cost of GDALAllRegister().
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal.h"
+#include "cpl_conv.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// Measures the time spent in GDALAllRegister(), as paid by every process
+// using GDAL, and separately the time needed to materialize the metadata of
+// all drivers (which drivers may build lazily).
+// Run with GDAL_DRIVER_PATH=disable to exclude the scanning of plugin
+// directories.
+
+int main(int /* argc */, char * /* argv */[])
+{
+    const auto start = std::chrono::steady_clock::now();
+    GDALAllRegister();
+    const auto afterRegister = std::chrono::steady_clock::now();
+
+    const int nDrivers = GDALGetDriverCount();
+    size_t nTotalSize = 0;
+    for (int i = 0; i < nDrivers; ++i)
+    {
+        GDALDriverH hDriver = GDALGetDriver(i);
+        for (const char *pszItem :
+             {GDAL_DMD_CREATIONOPTIONLIST, GDAL_DMD_OPENOPTIONLIST,
+              GDAL_DS_LAYER_CREATIONOPTIONLIST})
+        {
+            const char *pszValue =
+                GDALGetMetadataItem(hDriver, pszItem, nullptr);
+            if (pszValue)
+                nTotalSize += strlen(pszValue);
+        }
+    }
+    const auto afterMetadata = std::chrono::steady_clock::now();
+
+    printf("GDALAllRegister() of %d drivers: %.2f ms\n", nDrivers,
+           std::chrono::duration<double, std::milli>(afterRegister - start)
+               .count());
+    printf("Fetching option lists (%d bytes): %.2f ms\n",
+           static_cast<int>(nTotalSize),
+           std::chrono::duration<double, std::milli>(afterMetadata -
+                                                     afterRegister)
+               .count());
+
+    GDALDestroyDriverManager();
+    return 0;
+}
@@ -16,35 +16,53 @@
 #include <cstdlib>
 #include <ctime>
 
+// Throughput in GB/s, counting both bytes read and bytes written
+static double GetThroughput(int intype, int outtype, int nWords, int nIters,
+                            double dfSeconds)
+{
+    const double dfBytes =
+        static_cast<double>(
+            GDALGetDataTypeSizeBytes(static_cast<GDALDataType>(intype)) +
+            GDALGetDataTypeSizeBytes(static_cast<GDALDataType>(outtype))) *
+        nWords * nIters;
+    return dfSeconds > 0 ? dfBytes / dfSeconds / 1e9 : 0.0;
+}
+
 static void bench(void *in, void *out, int intype, int outtype)
 {
+    constexpr int N_WORDS = 256 * 256;
+    constexpr int N_ITERS = 1000;
+
     clock_t start = clock();
 
-    for (int i = 0; i < 1000; i++)
+    for (int i = 0; i < N_ITERS; i++)
         GDALCopyWords(in, (GDALDataType)intype, 16, out, (GDALDataType)outtype,
-                      16, 256 * 256);
+                      16, N_WORDS);
 
     clock_t end = clock();
 
-    printf("%s -> %s : %.2f s\n", GDALGetDataTypeName((GDALDataType)intype),
-           GDALGetDataTypeName((GDALDataType)outtype),
-           (end - start) * 1.0 / CLOCKS_PER_SEC);
+    double dfSeconds = (end - start) * 1.0 / CLOCKS_PER_SEC;
+    printf("%s -> %s : %.2f s, %.2f GB/s\n",
+           GDALGetDataTypeName((GDALDataType)intype),
+           GDALGetDataTypeName((GDALDataType)outtype), dfSeconds,
+           GetThroughput(intype, outtype, N_WORDS, N_ITERS, dfSeconds));
 
     start = clock();
 
-    for (int i = 0; i < 1000; i++)
+    for (int i = 0; i < N_ITERS; i++)
         GDALCopyWords(in, (GDALDataType)intype,
                       GDALGetDataTypeSizeBytes((GDALDataType)intype), out,
                       (GDALDataType)outtype,
                       GDALGetDataTypeSizeBytes((GDALDataType)outtype),
-                      256 * 256);
+                      N_WORDS);
 
     end = clock();
 
-    printf("%s -> %s (packed) : %.2f s\n",
+    dfSeconds = (end - start) * 1.0 / CLOCKS_PER_SEC;
+    printf("%s -> %s (packed) : %.2f s, %.2f GB/s\n",
            GDALGetDataTypeName((GDALDataType)intype),
-           GDALGetDataTypeName((GDALDataType)outtype),
-           (end - start) * 1.0 / CLOCKS_PER_SEC);
+           GDALGetDataTypeName((GDALDataType)outtype), dfSeconds,
+           GetThroughput(intype, outtype, N_WORDS, N_ITERS, dfSeconds));
 }
 
 int main(int /* argc */, char * /* argv */[])
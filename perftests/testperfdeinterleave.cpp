@@ -17,6 +17,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
 
 int main(int /* argc */, char * /* argv */[])
 {
@@ -81,6 +82,26 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // Hyperspectral-like band counts
+    for (int nComponents : {16, 224})
+    {
+        void *src2 = calloc(SIZE * SIZE, 4);
+        std::vector<void *> apDstBuffers;
+        const size_t nIters = SIZE * SIZE / 2 / nComponents;
+        for (int i = 0; i < nComponents; ++i)
+            apDstBuffers.push_back(malloc(nIters * 2));
+        const auto start = clock();
+        for (int i = 0; i < 2000; ++i)
+            GDALDeinterleave(src2, GDT_UInt16, nComponents,
+                             apDstBuffers.data(), GDT_UInt16, nIters);
+        const auto end = clock();
+        printf("GDALDeinterleave UInt16 %d : %.2f\n", nComponents,
+               (end - start) * 1.0 / CLOCKS_PER_SEC);
+        for (void *pDst : apDstBuffers)
+            free(pDst);
+        free(src2);
+    }
+
     VSIFree(src);
     VSIFree(dst0);
     VSIFree(dst1);
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Project:  GDAL Algorithms
+ * Purpose:  Test performance of the warping kernel with masked sources.
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal.h"
+#include "gdal_utils.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+constexpr int SRC_SIZE = 1024;
+constexpr int DST_SIZE = 1000;
+
+// Creates a source dataset of the given type where one pixel out of 16 is
+// invalid, either through the nodata value or through the alpha band.
+static GDALDatasetH CreateSource(GDALDataType eDT, bool bAlpha)
+{
+    GDALDriverH hDrv = GDALGetDriverByName("MEM");
+    GDALDatasetH hDS =
+        GDALCreate(hDrv, "", SRC_SIZE, SRC_SIZE, bAlpha ? 2 : 1, eDT, nullptr);
+    double adfGT[] = {0, 1, 0, SRC_SIZE, 0, -1};
+    GDALSetGeoTransform(hDS, adfGT);
+
+    std::vector<double> adfValues(static_cast<size_t>(SRC_SIZE) * SRC_SIZE);
+    std::vector<double> adfAlpha(adfValues.size());
+    for (size_t i = 0; i < adfValues.size(); ++i)
+    {
+        const bool bInvalid = (i % 16) == 0;
+        adfValues[i] = bInvalid && !bAlpha ? 0 : 1 + static_cast<int>(i % 250);
+        adfAlpha[i] = bInvalid ? 0 : 255;
+    }
+    GDALRasterBandH hBand = GDALGetRasterBand(hDS, 1);
+    CPL_IGNORE_RET_VAL(GDALRasterIO(hBand, GF_Write, 0, 0, SRC_SIZE, SRC_SIZE,
+                                    adfValues.data(), SRC_SIZE, SRC_SIZE,
+                                    GDT_Float64, 0, 0));
+    if (bAlpha)
+    {
+        GDALRasterBandH hAlphaBand = GDALGetRasterBand(hDS, 2);
+        GDALSetRasterColorInterpretation(hAlphaBand, GCI_AlphaBand);
+        CPL_IGNORE_RET_VAL(GDALRasterIO(
+            hAlphaBand, GF_Write, 0, 0, SRC_SIZE, SRC_SIZE, adfAlpha.data(),
+            SRC_SIZE, SRC_SIZE, GDT_Float64, 0, 0));
+    }
+    else
+    {
+        GDALSetRasterNoDataValue(hBand, 0);
+    }
+    return hDS;
+}
+
+static void bench(GDALDataType eDT, bool bAlpha, const char *pszResampling)
+{
+    GDALDatasetH hSrcDS = CreateSource(eDT, bAlpha);
+
+    CPLStringList aosArgv;
+    aosArgv.AddString("-of");
+    aosArgv.AddString("MEM");
+    aosArgv.AddString("-r");
+    aosArgv.AddString(pszResampling);
+    aosArgv.AddString("-ts");
+    aosArgv.AddString(CPLSPrintf("%d", DST_SIZE));
+    aosArgv.AddString(CPLSPrintf("%d", DST_SIZE));
+    aosArgv.AddString("-et");
+    aosArgv.AddString("0");
+    GDALWarpAppOptions *psOptions =
+        GDALWarpAppOptionsNew(aosArgv.List(), nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
+    GDALDatasetH hDstDS =
+        GDALWarp("", nullptr, 1, &hSrcDS, psOptions, nullptr);
+    const auto end = std::chrono::steady_clock::now();
+
+    printf("%s, %s, %s : %.3f s\n", GDALGetDataTypeName(eDT),
+           bAlpha ? "alpha" : "nodata", pszResampling,
+           std::chrono::duration<double>(end - start).count());
+
+    GDALWarpAppOptionsFree(psOptions);
+    GDALClose(hDstDS);
+    GDALClose(hSrcDS);
+}
+
+int main(int /* argc */, char * /* argv */[])
+{
+    GDALAllRegister();
+
+    for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+    {
+        for (const bool bAlpha : {false, true})
+        {
+            for (const char *pszResampling : {"cubic", "lanczos"})
+            {
+                bench(eDT, bAlpha, pszResampling);
+            }
+        }
+    }
+
+    GDALDestroyDriverManager();
+    return 0;
+}
@@ -10,6 +10,7 @@
  ****************************************************************************/
 
 #include "cpl_compressor.h"
+#include "cpl_compressor_priv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
@@ -49,6 +50,7 @@
 
 #include <limits>
 #include <mutex>
+#include <new>
 #include <type_traits>
 #include <vector>
 
@@ -56,6 +58,122 @@ static std::mutex gMutex;
 static std::vector<CPLCompressor *> *gpCompressors = nullptr;
 static std::vector<CPLCompressor *> *gpDecompressors = nullptr;
 
+/************************************************************************/
+/*                     CPLThreadLocalCompressionContexts                */
+/************************************************************************/
+
+namespace
+{
+struct CPLThreadLocalCompressionContexts
+{
+#ifdef HAVE_ZSTD
+    ZSTD_CCtx *psZSTDCCtx = nullptr;
+    ZSTD_DCtx *psZSTDDCtx = nullptr;
+#endif
+#ifdef HAVE_LIBDEFLATE
+    static constexpr int LIBDEFLATE_MAX_LEVEL = 12;
+    struct libdeflate_compressor
+        *apsDeflateCompressors[LIBDEFLATE_MAX_LEVEL + 1] = {};
+    struct libdeflate_decompressor *psDeflateDecompressor = nullptr;
+#endif
+
+    CPLThreadLocalCompressionContexts() = default;
+
+    ~CPLThreadLocalCompressionContexts()
+    {
+#ifdef HAVE_ZSTD
+        ZSTD_freeCCtx(psZSTDCCtx);
+        ZSTD_freeDCtx(psZSTDDCtx);
+#endif
+#ifdef HAVE_LIBDEFLATE
+        for (auto *psCompressor : apsDeflateCompressors)
+        {
+            if (psCompressor)
+                libdeflate_free_compressor(psCompressor);
+        }
+        if (psDeflateDecompressor)
+            libdeflate_free_decompressor(psDeflateDecompressor);
+#endif
+    }
+
+    CPLThreadLocalCompressionContexts(
+        const CPLThreadLocalCompressionContexts &) = delete;
+    CPLThreadLocalCompressionContexts &
+    operator=(const CPLThreadLocalCompressionContexts &) = delete;
+};
+}  // namespace
+
+static void CPLFreeThreadLocalCompressionContexts(void *pData)
+{
+    delete static_cast<CPLThreadLocalCompressionContexts *>(pData);
+}
+
+// Not using thread_local, since it does not work well with C++ objects in
+// DLLs on Windows.
+static CPLThreadLocalCompressionContexts *CPLGetThreadLocalCompressionContexts()
+{
+    int bMemoryErrorOccurred = false;
+    void *pData =
+        CPLGetTLSEx(CTLS_COMPRESSION_CONTEXTS, &bMemoryErrorOccurred);
+    if (bMemoryErrorOccurred)
+        return nullptr;
+    if (pData == nullptr)
+    {
+        auto psContexts =
+            new (std::nothrow) CPLThreadLocalCompressionContexts();
+        if (psContexts == nullptr)
+            return nullptr;
+        CPLSetTLSWithFreeFuncEx(CTLS_COMPRESSION_CONTEXTS, psContexts,
+                                CPLFreeThreadLocalCompressionContexts,
+                                &bMemoryErrorOccurred);
+        if (bMemoryErrorOccurred)
+        {
+            delete psContexts;
+            return nullptr;
+        }
+        return psContexts;
+    }
+    return static_cast<CPLThreadLocalCompressionContexts *>(pData);
+}
+
+#ifdef HAVE_LIBDEFLATE
+
+/************************************************************************/
+/*                CPLGetThreadLocalLibDeflateCompressor()               */
+/************************************************************************/
+
+struct libdeflate_compressor *CPLGetThreadLocalLibDeflateCompressor(int nLevel)
+{
+    if (nLevel < 0 ||
+        nLevel > CPLThreadLocalCompressionContexts::LIBDEFLATE_MAX_LEVEL)
+    {
+        return nullptr;
+    }
+    auto psContexts = CPLGetThreadLocalCompressionContexts();
+    if (psContexts == nullptr)
+        return nullptr;
+    auto &psCompressor = psContexts->apsDeflateCompressors[nLevel];
+    if (psCompressor == nullptr)
+        psCompressor = libdeflate_alloc_compressor(nLevel);
+    return psCompressor;
+}
+
+/************************************************************************/
+/*               CPLGetThreadLocalLibDeflateDecompressor()              */
+/************************************************************************/
+
+struct libdeflate_decompressor *CPLGetThreadLocalLibDeflateDecompressor()
+{
+    auto psContexts = CPLGetThreadLocalCompressionContexts();
+    if (psContexts == nullptr)
+        return nullptr;
+    if (psContexts->psDeflateDecompressor == nullptr)
+        psContexts->psDeflateDecompressor = libdeflate_alloc_decompressor();
+    return psContexts->psDeflateDecompressor;
+}
+
+#endif  // HAVE_LIBDEFLATE
+
 #ifdef HAVE_BLOSC
 static bool CPLBloscCompressor(const void *input_data, size_t input_size,
                                void **output_data, size_t *output_size,
@@ -376,19 +494,23 @@ static bool CPLZSTDCompressor(const void *input_data, size_t input_size,
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
-        ZSTD_CCtx *ctx = ZSTD_createCCtx();
+        auto psContexts = CPLGetThreadLocalCompressionContexts();
+        if (psContexts && psContexts->psZSTDCCtx == nullptr)
+            psContexts->psZSTDCCtx = ZSTD_createCCtx();
+        ZSTD_CCtx *ctx = psContexts ? psContexts->psZSTDCCtx : nullptr;
         if (ctx == nullptr)
         {
             *output_size = 0;
             return false;
         }
+        // Forget about the parameters of the previous use of the context
+        ZSTD_CCtx_reset(ctx, ZSTD_reset_session_and_parameters);
 
         const int level = atoi(CSLFetchNameValueDef(options, "LEVEL", "13"));
         if (ZSTD_isError(
                 ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, level)))
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Invalid compression level");
-            ZSTD_freeCCtx(ctx);
             *output_size = 0;
             return false;
         }
@@ -401,7 +523,6 @@ static bool CPLZSTDCompressor(const void *input_data, size_t input_size,
 
         size_t ret = ZSTD_compress2(ctx, *output_data, *output_size, input_data,
                                     input_size);
-        ZSTD_freeCCtx(ctx);
         if (ZSTD_isError(ret))
         {
             *output_size = 0;
@@ -482,6 +603,19 @@ static size_t CPLZSTDGetDecompressedSize(const void *input_data,
     return static_cast<size_t>(nRet);
 }
 
+static size_t CPLZSTDDecompress(void *output_data, size_t output_size,
+                                const void *input_data, size_t input_size)
+{
+    auto psContexts = CPLGetThreadLocalCompressionContexts();
+    if (psContexts && psContexts->psZSTDDCtx == nullptr)
+        psContexts->psZSTDDCtx = ZSTD_createDCtx();
+    if (psContexts == nullptr || psContexts->psZSTDDCtx == nullptr)
+        return ZSTD_decompress(output_data, output_size, input_data,
+                               input_size);
+    return ZSTD_decompressDCtx(psContexts->psZSTDDCtx, output_data,
+                               output_size, input_data, input_size);
+}
+
 static bool CPLZSTDDecompressor(const void *input_data, size_t input_size,
                                 void **output_data, size_t *output_size,
                                 CSLConstList /* options */,
@@ -490,8 +624,8 @@ static bool CPLZSTDDecompressor(const void *input_data, size_t input_size,
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
-        size_t ret =
-            ZSTD_decompress(*output_data, *output_size, input_data, input_size);
+        size_t ret = CPLZSTDDecompress(*output_data, *output_size, input_data,
+                                       input_size);
         if (ZSTD_isError(ret))
         {
             *output_size = CPLZSTDGetDecompressedSize(input_data, input_size);
@@ -520,7 +654,7 @@ static bool CPLZSTDDecompressor(const void *input_data, size_t input_size,
         }
 
         size_t ret =
-            ZSTD_decompress(*output_data, nOutSize, input_data, input_size);
+            CPLZSTDDecompress(*output_data, nOutSize, input_data, input_size);
         if (ZSTD_isError(ret))
         {
             *output_size = 0;
@@ -807,7 +941,7 @@ static void *CPLGZipCompress(const void *ptr, size_t nBytes, int nLevel,
     void *pTmp;
 #ifdef HAVE_LIBDEFLATE
     struct libdeflate_compressor *enc =
-        libdeflate_alloc_compressor(nLevel < 0 ? 7 : nLevel);
+        CPLGetThreadLocalLibDeflateCompressor(nLevel < 0 ? 7 : nLevel);
     if (enc == nullptr)
     {
         return nullptr;
@@ -823,9 +957,6 @@ static void *CPLGZipCompress(const void *ptr, size_t nBytes, int nLevel,
         pTmp = VSIMalloc(nTmpSize);
         if (pTmp == nullptr)
         {
-#ifdef HAVE_LIBDEFLATE
-            libdeflate_free_compressor(enc);
-#endif
             return nullptr;
         }
     }
@@ -838,7 +969,6 @@ static void *CPLGZipCompress(const void *ptr, size_t nBytes, int nLevel,
 #ifdef HAVE_LIBDEFLATE
     size_t nCompressedBytes =
         libdeflate_gzip_compress(enc, ptr, nBytes, pTmp, nTmpSize);
-    libdeflate_free_compressor(enc);
     if (nCompressedBytes == 0)
     {
         if (pTmp != outptr)
@@ -916,7 +1046,8 @@ static bool CPLZlibCompressor(const void *input_data, size_t input_size,
     if (output_data == nullptr && output_size != nullptr)
     {
 #if HAVE_LIBDEFLATE
-        struct libdeflate_compressor *enc = libdeflate_alloc_compressor(clevel);
+        struct libdeflate_compressor *enc =
+            CPLGetThreadLocalLibDeflateCompressor(clevel);
         if (enc == nullptr)
         {
             *output_size = 0;
@@ -926,7 +1057,6 @@ static bool CPLZlibCompressor(const void *input_data, size_t input_size,
             *output_size = libdeflate_zlib_compress_bound(enc, input_size);
         else
             *output_size = libdeflate_gzip_compress_bound(enc, input_size);
-        libdeflate_free_compressor(enc);
 #else
         // Really inefficient !
         size_t nOutSize = 0;
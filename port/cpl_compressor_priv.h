@@ -0,0 +1,32 @@
+/**********************************************************************
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Per-thread reusable compression contexts
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_COMPRESSOR_PRIV_H_INCLUDED
+#define CPL_COMPRESSOR_PRIV_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+// Creating compression/decompression contexts is not negligible compared to
+// the (de)compression of small buffers (e.g. 256x256 tiles or Zarr chunks), so
+// the following functions return contexts that are cached per thread and
+// must not be freed by the caller.
+
+#ifdef HAVE_LIBDEFLATE
+struct libdeflate_compressor;
+struct libdeflate_decompressor;
+
+struct libdeflate_compressor *CPLGetThreadLocalLibDeflateCompressor(int nLevel);
+struct libdeflate_decompressor *CPLGetThreadLocalLibDeflateDecompressor();
+#endif
+
+#endif  // DOXYGEN_SKIP
+
+#endif  // CPL_COMPRESSOR_PRIV_H_INCLUDED
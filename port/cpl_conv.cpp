@@ -55,8 +55,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 
 #if HAVE_UNISTD_H
 #include <unistd.h>
@@ -114,6 +116,36 @@ static bool gbIgnoreEnvVariables =
 static std::vector<std::pair<CPLSetConfigOptionSubscriber, void *>>
     gSetConfigOptionSubscribers{};
 
+namespace
+{
+/** Immutable view of g_papszConfigOptions, indexed by upper-cased key.
+ * Values are shared between successive snapshots, so that a string returned
+ * by CPLGetConfigOption() remains valid until the option of the same key is
+ * modified, as with the CSL list. */
+struct CPLConfigOptionsSnapshot
+{
+    std::unordered_map<std::string, std::shared_ptr<const std::string>>
+        oMap{};
+};
+
+/** Per-thread copy of the current snapshot, refreshed when the generation
+ * of the global options changes. */
+struct CPLConfigOptionsThreadCache
+{
+    GUIntBig nGeneration = 0;
+    std::shared_ptr<const CPLConfigOptionsSnapshot> poSnapshot{};
+    std::string osKey{};
+};
+}  // namespace
+
+// Protected by hConfigMutex
+static std::shared_ptr<const CPLConfigOptionsSnapshot>
+    gpoConfigOptionsSnapshot{};
+// Incremented, with hConfigMutex held, each time gpoConfigOptionsSnapshot
+// is replaced, so that readers can check without locking whether their
+// thread cache is up to date.
+static std::atomic<GUIntBig> gnConfigOptionsGeneration{1};
+
 // Used by CPLOpenShared() and friends.
 static CPLMutex *hSharedFileMutex = nullptr;
 static int nSharedFileCount = 0;
@@ -1655,6 +1687,90 @@ static void CPLAccessConfigOption(const char *pszKey, bool bGet)
 }
 #endif
 
+/************************************************************************/
+/*                  CPLUpdateConfigOptionsSnapshot()                    */
+/************************************************************************/
+
+/** Replace gpoConfigOptionsSnapshot after g_papszConfigOptions has been
+ * modified, either for a single key, or entirely if pszKey is null.
+ * Must be called with hConfigMutex held.
+ */
+static void CPLUpdateConfigOptionsSnapshot(const char *pszKey,
+                                           const char *pszValue)
+{
+    const auto ToUpper = [](const char *psz)
+    {
+        std::string osRet(psz);
+        for (char &ch : osRet)
+            ch = static_cast<char>(CPLToupper(static_cast<unsigned char>(ch)));
+        return osRet;
+    };
+
+    auto poNewSnapshot = std::make_shared<CPLConfigOptionsSnapshot>();
+    if (pszKey)
+    {
+        if (gpoConfigOptionsSnapshot)
+            poNewSnapshot->oMap = gpoConfigOptionsSnapshot->oMap;
+        if (pszValue)
+            poNewSnapshot->oMap[ToUpper(pszKey)] =
+                std::make_shared<const std::string>(pszValue);
+        else
+            poNewSnapshot->oMap.erase(ToUpper(pszKey));
+    }
+    else
+    {
+        for (const char *pszItem :
+             cpl::Iterate(const_cast<CSLConstList>(g_papszConfigOptions)))
+        {
+            char *pszItemKey = nullptr;
+            const char *pszItemValue = CPLParseNameValue(pszItem, &pszItemKey);
+            if (pszItemKey && pszItemValue)
+            {
+                // Like CSLFetchNameValue(), the first occurrence wins
+                poNewSnapshot->oMap.emplace(
+                    ToUpper(pszItemKey),
+                    std::make_shared<const std::string>(pszItemValue));
+            }
+            CPLFree(pszItemKey);
+        }
+    }
+    gpoConfigOptionsSnapshot = std::move(poNewSnapshot);
+    ++gnConfigOptionsGeneration;
+}
+
+/************************************************************************/
+/*                  CPLGetConfigOptionsThreadCache()                    */
+/************************************************************************/
+
+static void CPLFreeConfigOptionsThreadCache(void *pData)
+{
+    delete static_cast<CPLConfigOptionsThreadCache *>(pData);
+}
+
+static CPLConfigOptionsThreadCache *CPLGetConfigOptionsThreadCache()
+{
+    int bMemoryError = FALSE;
+    auto psCache = static_cast<CPLConfigOptionsThreadCache *>(
+        CPLGetTLSEx(CTLS_CONFIGOPTIONS_SNAPSHOT, &bMemoryError));
+    if (bMemoryError)
+        return nullptr;
+    if (psCache == nullptr)
+    {
+        psCache = new (std::nothrow) CPLConfigOptionsThreadCache();
+        if (psCache == nullptr)
+            return nullptr;
+        CPLSetTLSWithFreeFuncEx(CTLS_CONFIGOPTIONS_SNAPSHOT, psCache,
+                                CPLFreeConfigOptionsThreadCache,
+                                &bMemoryError);
+        if (bMemoryError)
+        {
+            delete psCache;
+            return nullptr;
+        }
+    }
+    return psCache;
+}
+
 /************************************************************************/
 /*                         CPLGetConfigOption()                         */
 /************************************************************************/
@@ -1671,6 +1787,10 @@ static void CPLAccessConfigOption(const char *pszKey, bool bGet)
  * in particular it will become invalid after a call to CPLSetConfigOption()
  * with the same key.
  *
+ * Starting with GDAL 3.12, looking up an option does not take a global lock,
+ * unless options have been modified with CPLSetConfigOption() since the
+ * previous lookup in the current thread.
+ *
  * To override temporary a potentially existing option with a new value, you
  * can use the following snippet :
  * \code{.cpp}
@@ -1772,6 +1892,7 @@ void CPLSetConfigOptions(const char *const *papszConfigOptions)
     CSLDestroy(const_cast<char **>(g_papszConfigOptions));
     g_papszConfigOptions = const_cast<volatile char **>(
         CSLDuplicate(const_cast<char **>(papszConfigOptions)));
+    CPLUpdateConfigOptionsSnapshot(nullptr, nullptr);
 }
 
 /************************************************************************/
@@ -1818,15 +1939,42 @@ const char *CPL_STDCALL CPLGetGlobalConfigOption(const char *pszKey,
     CPLAccessConfigOption(pszKey, TRUE);
 #endif
 
-    CPLMutexHolderD(&hConfigMutex);
+    CPLConfigOptionsThreadCache *psCache = CPLGetConfigOptionsThreadCache();
+    if (psCache == nullptr)
+    {
+        CPLMutexHolderD(&hConfigMutex);
 
-    const char *pszResult =
-        CSLFetchNameValue(const_cast<char **>(g_papszConfigOptions), pszKey);
+        const char *pszResult = CSLFetchNameValue(
+            const_cast<char **>(g_papszConfigOptions), pszKey);
 
-    if (pszResult == nullptr)
+        if (pszResult == nullptr)
+            return pszDefault;
+
+        return pszResult;
+    }
+
+    if (psCache->nGeneration !=
+        gnConfigOptionsGeneration.load(std::memory_order_acquire))
+    {
+        CPLMutexHolderD(&hConfigMutex);
+        psCache->poSnapshot = gpoConfigOptionsSnapshot;
+        psCache->nGeneration = gnConfigOptionsGeneration.load();
+    }
+
+    if (!psCache->poSnapshot || psCache->poSnapshot->oMap.empty())
         return pszDefault;
 
-    return pszResult;
+    // Reuse the buffer of the cache to avoid an allocation per call
+    psCache->osKey = pszKey;
+    for (char &ch : psCache->osKey)
+        ch = static_cast<char>(CPLToupper(static_cast<unsigned char>(ch)));
+
+    const auto &oMap = psCache->poSnapshot->oMap;
+    const auto oIter = oMap.find(psCache->osKey);
+    if (oIter == oMap.end())
+        return pszDefault;
+
+    return oIter->second->c_str();
 }
 
 /************************************************************************/
@@ -2086,6 +2234,7 @@ void CPL_STDCALL CPLSetConfigOption(const char *pszKey, const char *pszValue)
 
     g_papszConfigOptions = const_cast<volatile char **>(CSLSetNameValue(
         const_cast<char **>(g_papszConfigOptions), pszKey, pszValue));
+    CPLUpdateConfigOptionsSnapshot(pszKey, pszValue);
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/false);
@@ -2225,8 +2374,18 @@ void CPL_STDCALL CPLFreeConfig()
 
         CSLDestroy(const_cast<char **>(g_papszConfigOptions));
         g_papszConfigOptions = nullptr;
+        gpoConfigOptionsSnapshot.reset();
+        ++gnConfigOptionsGeneration;
 
         int bMemoryError = FALSE;
+        auto psCache = static_cast<CPLConfigOptionsThreadCache *>(
+            CPLGetTLSEx(CTLS_CONFIGOPTIONS_SNAPSHOT, &bMemoryError));
+        if (psCache != nullptr)
+        {
+            delete psCache;
+            CPLSetTLS(CTLS_CONFIGOPTIONS_SNAPSHOT, nullptr, FALSE);
+        }
+
         char **papszTLConfigOptions = reinterpret_cast<char **>(
             CPLGetTLSEx(CTLS_CONFIGOPTIONS, &bMemoryError));
         if (papszTLConfigOptions != nullptr)
@@ -19,9 +19,12 @@
 #define CPUID_SSSE3_ECX_BIT 9
 #define CPUID_OSXSAVE_ECX_BIT 27
 #define CPUID_AVX_ECX_BIT 28
+#define CPUID_F16C_ECX_BIT 29
 
 #define CPUID_SSE_EDX_BIT 25
 
+#define CPUID_AVX2_EBX_BIT 5
+
 #define BIT_XMM_STATE (1 << 1)
 #define BIT_YMM_STATE (2 << 1)
 
@@ -50,10 +53,30 @@
 #define CPL_CPUID(level, array)                                                \
     GCC_CPUID(level, array[0], array[1], array[2], array[3])
 
+#if defined(__x86_64)
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
+    __asm__("xchgq %%rbx, %q1\n"                                               \
+            "cpuid\n"                                                          \
+            "xchgq %%rbx, %q1"                                                 \
+            : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
+            : "0"(level), "2"(count))
+#else
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
+    __asm__("xchgl %%ebx, %1\n"                                                \
+            "cpuid\n"                                                          \
+            "xchgl %%ebx, %1"                                                  \
+            : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
+            : "0"(level), "2"(count))
+#endif
+
+#define CPL_CPUID_COUNT(level, count, array)                                   \
+    GCC_CPUID_COUNT(level, count, array[0], array[1], array[2], array[3])
+
 #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
 
 #include <intrin.h>
 #define CPL_CPUID(level, array) __cpuid(array, level)
+#define CPL_CPUID_COUNT(level, count, array) __cpuidex(array, level, count)
 
 #endif
 
@@ -196,4 +219,149 @@ bool CPLHaveRuntimeAVX()
 
 #endif  // defined(HAVE_AVX_AT_COMPILE_TIME) && !defined(CPLHaveRuntimeAVX)
 
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
+/************************************************************************/
+/*                         CPLHaveRuntimeAVX2()                         */
+/************************************************************************/
+
+#if defined(__GNUC__)
+
+static bool CPLDetectRuntimeAVX2()
+{
+    int cpuinfo[4] = {0, 0, 0, 0};
+    CPL_CPUID(0, cpuinfo);
+    if (cpuinfo[REG_EAX] < 7)
+        return false;
+
+    CPL_CPUID(1, cpuinfo);
+
+    // Check OSXSAVE and AVX features.
+    if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0 ||
+        (cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0)
+    {
+        return false;
+    }
+
+    // Issue XGETBV and check the XMM and YMM state bit.
+    unsigned int nXCRLow;
+    unsigned int nXCRHigh;
+    __asm__("xgetbv" : "=a"(nXCRLow), "=d"(nXCRHigh) : "c"(0));
+    if ((nXCRLow & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
+        (BIT_XMM_STATE | BIT_YMM_STATE))
+    {
+        return false;
+    }
+    CPL_IGNORE_RET_VAL(nXCRHigh);  // unused
+
+    // Check AVX2 feature (leaf 7, sub-leaf 0).
+    CPL_CPUID_COUNT(7, 0, cpuinfo);
+    return (cpuinfo[REG_EBX] & (1 << CPUID_AVX2_EBX_BIT)) != 0;
+}
+
+bool bCPLHasAVX2 = false;
+static void CPLHaveRuntimeAVX2Initialize() __attribute__((constructor));
+
+static void CPLHaveRuntimeAVX2Initialize()
+{
+    bCPLHasAVX2 = CPLDetectRuntimeAVX2();
+}
+
+#elif defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                \
+    (defined(_M_IX86) || defined(_M_X64))
+
+bool CPLHaveRuntimeAVX2()
+{
+    static const bool bHasAVX2 = []()
+    {
+        int cpuinfo[4] = {0, 0, 0, 0};
+        CPL_CPUID(0, cpuinfo);
+        if (cpuinfo[REG_EAX] < 7)
+            return false;
+
+        CPL_CPUID(1, cpuinfo);
+
+        // Check OSXSAVE and AVX features.
+        if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0 ||
+            (cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0)
+        {
+            return false;
+        }
+
+        // Check the XMM and YMM state bit.
+        unsigned __int64 xcrFeatureMask = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
+        if ((xcrFeatureMask & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
+            (BIT_XMM_STATE | BIT_YMM_STATE))
+        {
+            return false;
+        }
+
+        // Check AVX2 feature (leaf 7, sub-leaf 0).
+        CPL_CPUID_COUNT(7, 0, cpuinfo);
+        return (cpuinfo[REG_EBX] & (1 << CPUID_AVX2_EBX_BIT)) != 0;
+    }();
+    return bHasAVX2;
+}
+
+#else
+
+bool CPLHaveRuntimeAVX2()
+{
+    return false;
+}
+
+#endif
+
+#endif  // defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
+#if defined(HAVE_F16C_AT_COMPILE_TIME) && !defined(HAVE_INLINE_F16C)
+
+/************************************************************************/
+/*                         CPLHaveRuntimeF16C()                         */
+/************************************************************************/
+
+#if defined(__GNUC__)
+
+static bool CPLDetectRuntimeF16C()
+{
+    int cpuinfo[4] = {0, 0, 0, 0};
+    CPL_CPUID(1, cpuinfo);
+
+    // F16C instructions are VEX encoded, so they need the OS to save the
+    // YMM state, as AVX does.
+    if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0 ||
+        (cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0 ||
+        (cpuinfo[REG_ECX] & (1 << CPUID_F16C_ECX_BIT)) == 0)
+    {
+        return false;
+    }
+
+    // Issue XGETBV and check the XMM and YMM state bit.
+    unsigned int nXCRLow;
+    unsigned int nXCRHigh;
+    __asm__("xgetbv" : "=a"(nXCRLow), "=d"(nXCRHigh) : "c"(0));
+    CPL_IGNORE_RET_VAL(nXCRHigh);  // unused
+    return (nXCRLow & (BIT_XMM_STATE | BIT_YMM_STATE)) ==
+           (BIT_XMM_STATE | BIT_YMM_STATE);
+}
+
+bool bCPLHasF16C = false;
+static void CPLHaveRuntimeF16CInitialize() __attribute__((constructor));
+
+static void CPLHaveRuntimeF16CInitialize()
+{
+    bCPLHasF16C = CPLDetectRuntimeF16C();
+}
+
+#else
+
+bool CPLHaveRuntimeF16C()
+{
+    return false;
+}
+
+#endif
+
+#endif  // defined(HAVE_F16C_AT_COMPILE_TIME) && !defined(HAVE_INLINE_F16C)
+
 //! @endcond
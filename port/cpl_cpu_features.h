@@ -82,6 +82,46 @@ bool CPLHaveRuntimeAVX();
 #endif
 #endif
 
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+#if __AVX2__
+#define HAVE_INLINE_AVX2
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return true;
+}
+#elif defined(__GNUC__)
+extern bool bCPLHasAVX2;
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return bCPLHasAVX2;
+}
+#else
+bool CPLHaveRuntimeAVX2();
+#endif
+#endif
+
+#ifdef HAVE_F16C_AT_COMPILE_TIME
+#if __F16C__
+#define HAVE_INLINE_F16C
+
+static bool inline CPLHaveRuntimeF16C()
+{
+    return true;
+}
+#elif defined(__GNUC__)
+extern bool bCPLHasF16C;
+
+static bool inline CPLHaveRuntimeF16C()
+{
+    return bCPLHasF16C;
+}
+#else
+bool CPLHaveRuntimeF16C();
+#endif
+#endif
+
 //! @endcond
 
 #endif  // CPL_CPU_FEATURES_H
@@ -268,66 +268,103 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     if (pszString == nullptr)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
     const size_t nDelimiterLength = strlen(pszDelimiter);
+    const char chDelimiter = pszDelimiter[0];
+    std::string osToken;
+
+    const auto SkipDelimiter = [pszDelimiter, nDelimiterLength,
+                                bMergeDelimiter](const char *pszIter)
+    {
+        pszIter += nDelimiterLength;
+        if (bMergeDelimiter)
+        {
+            while (strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
+                pszIter += nDelimiterLength;
+        }
+        return pszIter;
+    };
 
     const char *pszIter = pszString;
     while (*pszIter != '\0')
     {
-        bool bInString = false;
-
-        int nTokenLen = 0;
-
-        // Try to find the next delimiter, marking end of token.
-        do
+        // Fast path: a token without double quote is copied as a whole,
+        // without going through an intermediate buffer.
+        const char *pszTokenEnd = pszIter;
+        while (*pszTokenEnd != '\0' && *pszTokenEnd != chDelimiter &&
+               *pszTokenEnd != '"')
+            ++pszTokenEnd;
+        if (*pszTokenEnd != '"' &&
+            (*pszTokenEnd == '\0' ||
+             strncmp(pszTokenEnd, pszDelimiter, nDelimiterLength) == 0))
+        {
+            const size_t nTokenLen = pszTokenEnd - pszIter;
+            char *pszToken = static_cast<char *>(CPLMalloc(nTokenLen + 1));
+            memcpy(pszToken, pszIter, nTokenLen);
+            pszToken[nTokenLen] = '\0';
+            aosRetList.AddStringDirectly(pszToken);
+            pszIter = *pszTokenEnd == '\0' ? pszTokenEnd
+                                           : SkipDelimiter(pszTokenEnd);
+        }
+        else
         {
-            // End if this is a delimiter skip it and break.
-            if (!bInString &&
-                strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
+            bool bInString = false;
+            osToken.clear();
+
+            // Try to find the next delimiter, marking end of token.
+            while (*pszIter != '\0')
             {
-                pszIter += nDelimiterLength;
-                if (bMergeDelimiter)
+                if (bInString)
                 {
-                    while (strncmp(pszIter, pszDelimiter, nDelimiterLength) ==
-                           0)
-                        pszIter += nDelimiterLength;
+                    const char *pszQuote = strchr(pszIter, '"');
+                    if (pszQuote == nullptr)
+                    {
+                        osToken.append(pszIter);
+                        pszIter += strlen(pszIter);
+                        break;
+                    }
+                    osToken.append(pszIter, pszQuote - pszIter);
+                    pszIter = pszQuote;
+                    if (pszIter[1] == '"')
+                    {
+                        // Doubled quotes in string resolve to one quote.
+                        osToken += '"';
+                        pszIter += 2;
+                    }
+                    else
+                    {
+                        bInString = false;
+                        if (bKeepLeadingAndClosingQuotes)
+                            osToken += '"';
+                        pszIter++;
+                    }
+                    continue;
                 }
-                break;
-            }
 
-            if (*pszIter == '"')
-            {
-                if (!bInString && nTokenLen > 0)
+                // End if this is a delimiter skip it and break.
+                if (strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
                 {
-                    // do not treat in a special way double quotes that appear
-                    // in the middle of a field (similarly to OpenOffice)
-                    // Like in records: 1,50°46'06.6"N 116°42'04.4,foo
+                    pszIter = SkipDelimiter(pszIter);
+                    break;
                 }
-                else if (!bInString || pszIter[1] != '"')
+
+                if (*pszIter == '"' && osToken.empty())
                 {
-                    bInString = !bInString;
-                    if (!bKeepLeadingAndClosingQuotes)
-                        continue;
+                    bInString = true;
+                    if (bKeepLeadingAndClosingQuotes)
+                        osToken += '"';
                 }
-                else  // Doubled quotes in string resolve to one quote.
+                else
                 {
-                    pszIter++;
+                    // do not treat in a special way double quotes that appear
+                    // in the middle of a field (similarly to OpenOffice)
+                    // Like in records: 1,50°46'06.6"N 116°42'04.4,foo
+                    osToken += *pszIter;
                 }
+                pszIter++;
             }
 
-            if (nTokenLen >= nTokenMax - 2)
-            {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
-            }
-
-            pszToken[nTokenLen] = *pszIter;
-            nTokenLen++;
-        } while (*(++pszIter) != '\0');
-
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+            aosRetList.AddString(osToken.c_str());
+        }
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
@@ -340,8 +377,6 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         }
     }
 
-    CPLFree(pszToken);
-
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
     else
@@ -656,36 +691,35 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
     {
         while (true)
         {
-            for (; i < osWorkLine.size(); ++i)
+            // Jump from one double quote to the next one
+            for (i = osWorkLine.find('"', i); i != std::string::npos;
+                 i = osWorkLine.find('"', i + 1))
             {
-                if (osWorkLine[i] == '\"')
+                if (!bInString)
                 {
-                    if (!bInString)
-                    {
-                        // Only consider " as the start of a quoted string
-                        // if it is the first character of the line, or
-                        // if it is immediately after the field delimiter.
-                        if (i == 0 ||
-                            (i >= nDelimiterLength &&
-                             osWorkLine.compare(i - nDelimiterLength,
-                                                nDelimiterLength, pszDelimiter,
-                                                nDelimiterLength) == 0))
-                        {
-                            bInString = true;
-                        }
-                    }
-                    else if (i + 1 < osWorkLine.size() &&
-                             osWorkLine[i + 1] == '"')
+                    // Only consider " as the start of a quoted string
+                    // if it is the first character of the line, or
+                    // if it is immediately after the field delimiter.
+                    if (i == 0 ||
+                        (i >= nDelimiterLength &&
+                         osWorkLine.compare(i - nDelimiterLength,
+                                            nDelimiterLength, pszDelimiter,
+                                            nDelimiterLength) == 0))
                     {
-                        // Escaped double quote in a quoted string
-                        ++i;
-                    }
-                    else
-                    {
-                        bInString = false;
+                        bInString = true;
                     }
                 }
+                else if (i + 1 < osWorkLine.size() && osWorkLine[i + 1] == '"')
+                {
+                    // Escaped double quote in a quoted string
+                    ++i;
+                }
+                else
+                {
+                    bInString = false;
+                }
             }
+            i = osWorkLine.size();
 
             if (!bInString)
             {
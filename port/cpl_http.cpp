@@ -533,6 +533,7 @@ constexpr TupleEnvVarOptionName asAssocEnvVarOptionName[] = {
     {"GDAL_HTTP_TCP_KEEPALIVE", "TCP_KEEPALIVE"},
     {"GDAL_HTTP_TCP_KEEPIDLE", "TCP_KEEPIDLE"},
     {"GDAL_HTTP_TCP_KEEPINTVL", "TCP_KEEPINTVL"},
+    {"GDAL_HTTP_SHARE_CONNECTIONS", "SHARE_CONNECTIONS"},
 };
 
 char **CPLHTTPGetOptionsFromEnv(const char *pszFilename)
@@ -691,6 +692,9 @@ bool CPLHTTPRetryContext::CanRetry()
     if (m_nRetryCount >= m_oParameters.nMaxRetry)
         return false;
     m_nRetryCount++;
+#ifdef HAVE_CURL
+    cpl::NetworkStatisticsLogger::LogRetry();
+#endif
     return true;
 }
 
@@ -712,6 +716,9 @@ bool CPLHTTPRetryContext::CanRetry(int response_code, const char *pszErrBuf,
     if (m_dfNextDelay == 0.0)
         return false;
     m_nRetryCount++;
+#ifdef HAVE_CURL
+    cpl::NetworkStatisticsLogger::LogRetry();
+#endif
     return true;
 }
 
@@ -1202,6 +1209,12 @@ int CPLHTTPPopFetchCallback(void)
  * taken into account if TCP_KEEPALIVE=YES.
  * Corresponding configuration option: GDAL_HTTP_TCP_KEEPINTVL.
  * </li>
+ * <li>SHARE_CONNECTIONS=YES/NO (GDAL >= 3.12): whether connections, TLS
+ * sessions and DNS entries should be shared among all the threads of the
+ * process, and requests should wait for an existing HTTP/2 connection to be
+ * multiplexed rather than opening a new one. Defaults to NO.
+ * Corresponding configuration option: GDAL_HTTP_SHARE_CONNECTIONS.
+ * </li>
  * <li>USERAGENT=string: value of User-Agent header. Starting with GDAL 3.7,
  * GDAL core sets it by default (during driver initialization) to GDAL/x.y.z
  * where x.y.z is the GDAL version number. Applications may override it with the
@@ -2103,6 +2116,59 @@ static int CPLHTTPCurlDebugFunction(CURL *handle, curl_infotype type,
     return 0;
 }
 
+/************************************************************************/
+/*                       CPLHTTPGetShareHandle()                        */
+/************************************************************************/
+
+namespace
+{
+// Process-wide share handle, so that easy handles of different threads
+// (and thus of different multi handles) can reuse the connections, TLS
+// sessions and DNS entries established by others.
+struct CPLHTTPShare
+{
+    CURLSH *hShare = nullptr;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> aoMutexes{};
+};
+
+std::mutex goShareMutex;
+CPLHTTPShare *gpoShare = nullptr;
+
+void CPLHTTPShareLock(CURL *, curl_lock_data data, curl_lock_access,
+                      void *userptr)
+{
+    auto poShare = static_cast<CPLHTTPShare *>(userptr);
+    poShare->aoMutexes[data].lock();
+}
+
+void CPLHTTPShareUnlock(CURL *, curl_lock_data data, void *userptr)
+{
+    auto poShare = static_cast<CPLHTTPShare *>(userptr);
+    poShare->aoMutexes[data].unlock();
+}
+
+CURLSH *CPLHTTPGetShareHandle()
+{
+    std::lock_guard oLock(goShareMutex);
+    if (!gpoShare)
+    {
+        CURLSH *hShare = curl_share_init();
+        if (!hShare)
+            return nullptr;
+        gpoShare = new CPLHTTPShare();
+        gpoShare->hShare = hShare;
+        curl_share_setopt(hShare, CURLSHOPT_LOCKFUNC, CPLHTTPShareLock);
+        curl_share_setopt(hShare, CURLSHOPT_UNLOCKFUNC, CPLHTTPShareUnlock);
+        curl_share_setopt(hShare, CURLSHOPT_USERDATA, gpoShare);
+        curl_share_setopt(hShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(hShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(hShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    }
+    return gpoShare->hShare;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                         CPLHTTPSetOptions()                          */
 /************************************************************************/
@@ -2586,6 +2652,24 @@ void *CPLHTTPSetOptions(void *pcurl, const char *pszURL,
         unchecked_curl_easy_setopt(http_handle, CURLOPT_COOKIEJAR,
                                    pszCookieJar);
 
+    // Process-wide sharing of connections
+    const char *pszShareConnections =
+        CSLFetchNameValue(papszOptions, "SHARE_CONNECTIONS");
+    if (pszShareConnections == nullptr)
+        pszShareConnections =
+            CPLGetConfigOption("GDAL_HTTP_SHARE_CONNECTIONS", "NO");
+    if (CPLTestBool(pszShareConnections))
+    {
+        CURLSH *hShare = CPLHTTPGetShareHandle();
+        if (hShare)
+        {
+            unchecked_curl_easy_setopt(http_handle, CURLOPT_SHARE, hShare);
+            // Prefer waiting for an existing HTTP/2 connection to be
+            // multiplexed rather than opening a new one.
+            unchecked_curl_easy_setopt(http_handle, CURLOPT_PIPEWAIT, 1L);
+        }
+    }
+
     // TCP keep-alive
     const char *pszTCPKeepAlive =
         CSLFetchNameValue(papszOptions, "TCP_KEEPALIVE");
@@ -2828,6 +2912,17 @@ void CPLHTTPCleanup()
     CPLDestroyMutex(hSessionMapMutex);
     hSessionMapMutex = nullptr;
 
+    {
+        std::lock_guard oLock(goShareMutex);
+        // Fails with CURLSHE_IN_USE if easy handles still use it, in which
+        // case we must leak it.
+        if (gpoShare && curl_share_cleanup(gpoShare->hShare) == CURLSHE_OK)
+        {
+            delete gpoShare;
+            gpoShare = nullptr;
+        }
+    }
+
 #if defined(_WIN32) && defined(HAVE_OPENSSL_CRYPTO)
     // This cleanup must be absolutely done before CPLOpenSSLCleanup()
     // for some unknown reason, but otherwise X509_free() in
@@ -13,11 +13,18 @@
 
 #include "cpl_error.h"
 #include "cpl_json_header.h"
+#include "cpl_json_streaming_parser.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 
 #include "cpl_http.h"
 #include "cpl_multiproc.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
 #define TO_JSONOBJ(x) static_cast<json_object *>(x)
 
 static const char *JSON_PATH_DELIMITER = "/";
@@ -285,6 +292,318 @@ bool CPLJSONDocument::LoadMemory(const std::string &osStr)
                       static_cast<int>(osStr.size()));
 }
 
+/*! @cond Doxygen_Suppress */
+namespace
+{
+
+/************************************************************************/
+/*                         CPLJSONPruningBuilder                        */
+/************************************************************************/
+
+// Builds a json-c object tree from the events of the streaming parser,
+// without materializing the values of the members whose path is in the list
+// of skipped members. This avoids the allocation of one json-c object per
+// value of large sub-trees (typically coordinates of geometries) that the
+// caller will not visit.
+class CPLJSONPruningBuilder final : public CPLJSonStreamingParser
+{
+  public:
+    explicit CPLJSONPruningBuilder(
+        const std::vector<std::string> &aosSkippedMembers)
+        : m_aosSkippedMembers(aosSkippedMembers)
+    {
+        std::sort(m_aosSkippedMembers.begin(), m_aosSkippedMembers.end());
+        SetMaxStringSize(INT_MAX);
+    }
+
+    ~CPLJSONPruningBuilder() override
+    {
+        if (m_poRoot)
+            json_object_put(m_poRoot);
+    }
+
+    json_object *StealRoot()
+    {
+        json_object *poRet = m_poRoot;
+        m_poRoot = nullptr;
+        return poRet;
+    }
+
+    bool IsComplete() const
+    {
+        return m_bHasRoot && m_apoStack.empty();
+    }
+
+  protected:
+    void String(const char *pszValue, size_t nLength) override
+    {
+        if (!SkipValue())
+            AddValue(json_object_new_string_len(pszValue,
+                                                static_cast<int>(nLength)));
+    }
+
+    void Number(const char *pszValue, size_t /* nLength */) override
+    {
+        if (SkipValue())
+            return;
+        if (strpbrk(pszValue, ".eEnN") == nullptr)
+        {
+            errno = 0;
+            const long long nVal = std::strtoll(pszValue, nullptr, 10);
+            if (errno == 0)
+            {
+                AddValue(json_object_new_int64(static_cast<int64_t>(nVal)));
+                return;
+            }
+        }
+        AddValue(json_object_new_double_s(CPLAtof(pszValue), pszValue));
+    }
+
+    void Boolean(bool b) override
+    {
+        if (!SkipValue())
+            AddValue(json_object_new_boolean(b));
+    }
+
+    void Null() override
+    {
+        if (!SkipValue())
+            AddValue(nullptr);
+    }
+
+    void StartObject() override
+    {
+        if (SkipContainer())
+            return;
+        json_object *poObj = json_object_new_object();
+        AddValue(poObj);
+        m_apoStack.push_back(poObj);
+        m_anPathLength.push_back(m_osPath.size());
+    }
+
+    void EndObject() override
+    {
+        EndContainer();
+    }
+
+    void StartObjectMember(const char *pszKey, size_t nLength) override
+    {
+        if (m_nSkipDepth > 0)
+            return;
+        m_osKey.assign(pszKey, nLength);
+        m_osPath.resize(m_anPathLength.back());
+        if (!m_osPath.empty())
+            m_osPath += JSON_PATH_DELIMITER;
+        m_osPath += m_osKey;
+        m_bSkipNextValue = std::binary_search(
+            m_aosSkippedMembers.begin(), m_aosSkippedMembers.end(), m_osPath);
+    }
+
+    void StartArray() override
+    {
+        if (SkipContainer())
+            return;
+        json_object *poArray = json_object_new_array();
+        AddValue(poArray);
+        m_apoStack.push_back(poArray);
+        m_anPathLength.push_back(m_osPath.size());
+    }
+
+    void EndArray() override
+    {
+        EndContainer();
+    }
+
+    void Exception(const char *pszMessage) override
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "JSON parsing error: %s",
+                 pszMessage);
+    }
+
+  private:
+    std::vector<std::string> m_aosSkippedMembers;
+    json_object *m_poRoot = nullptr;
+    bool m_bHasRoot = false;
+    std::vector<json_object *> m_apoStack{};
+    std::vector<size_t> m_anPathLength{};
+    std::string m_osPath{};
+    std::string m_osKey{};
+    bool m_bSkipNextValue = false;
+    int m_nSkipDepth = 0;
+
+    // Returns whether a scalar value must be ignored
+    bool SkipValue()
+    {
+        if (m_nSkipDepth > 0)
+            return true;
+        if (m_bSkipNextValue)
+        {
+            m_bSkipNextValue = false;
+            return true;
+        }
+        return false;
+    }
+
+    // Returns whether an object or array must be ignored
+    bool SkipContainer()
+    {
+        if (m_nSkipDepth > 0 || m_bSkipNextValue)
+        {
+            m_bSkipNextValue = false;
+            ++m_nSkipDepth;
+            return true;
+        }
+        return false;
+    }
+
+    void EndContainer()
+    {
+        if (m_nSkipDepth > 0)
+        {
+            --m_nSkipDepth;
+            return;
+        }
+        m_apoStack.pop_back();
+        m_osPath.resize(m_anPathLength.back());
+        m_anPathLength.pop_back();
+    }
+
+    void AddValue(json_object *poVal)
+    {
+        if (m_apoStack.empty())
+        {
+            m_poRoot = poVal;
+            m_bHasRoot = true;
+        }
+        else if (json_object_get_type(m_apoStack.back()) == json_type_object)
+        {
+            json_object_object_add(m_apoStack.back(), m_osKey.c_str(), poVal);
+        }
+        else
+        {
+            json_object_array_add(m_apoStack.back(), poVal);
+        }
+    }
+};
+
+}  // namespace
+
+/*! @endcond */
+
+/**
+ * Load json document from memory buffer, without materializing the value of
+ * the specified members.
+ *
+ * This is useful to save memory and time when loading large documents of
+ * which only some parts are of interest to the caller, for example a GeoJSON
+ * FeatureCollection whose geometries are not needed.
+ *
+ * @param  pabyData Buffer data.
+ * @param  nLength  Buffer size.
+ * @param  aosSkippedMembers Paths of the members to skip, relative to the
+ *                  root, with components separated by '/'. Arrays are
+ *                  transparent in paths, so "features/geometry" designates
+ *                  the geometry member of all objects of the "features"
+ *                  array. Skipped members are absent from the loaded
+ *                  document.
+ * @return          true on success. If error occurred it can be received using
+ * CPLGetLastErrorMsg method.
+ *
+ * @since GDAL 3.12
+ */
+bool CPLJSONDocument::LoadMemory(
+    const GByte *pabyData, size_t nLength,
+    const std::vector<std::string> &aosSkippedMembers)
+{
+    if (nullptr == pabyData)
+        return false;
+
+    CPLJSONPruningBuilder oBuilder(aosSkippedMembers);
+    if (!oBuilder.Parse(reinterpret_cast<const char *>(pabyData), nLength,
+                        true) ||
+        !oBuilder.IsComplete())
+    {
+        if (!oBuilder.ExceptionOccurred())
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "JSON parsing error: unexpected end of data");
+        return false;
+    }
+
+    if (m_poRootJsonObject)
+        json_object_put(TO_JSONOBJ(m_poRootJsonObject));
+    m_poRootJsonObject = oBuilder.StealRoot();
+    return true;
+}
+
+/**
+ * Load json document from file, without materializing the value of the
+ * specified members.
+ *
+ * The file is parsed by chunks, and is not entirely loaded in memory.
+ * The CPL_JSON_MAX_SIZE configuration option (100MB by default) limits the
+ * size of the file that can be loaded.
+ *
+ * @param  osPath Path to json file.
+ * @param  aosSkippedMembers Paths of the members to skip. See
+ *                 LoadMemory().
+ * @return         true on success. If error occurred it can be received using
+ * CPLGetLastErrorMsg method.
+ *
+ * @since GDAL 3.12
+ */
+bool CPLJSONDocument::Load(const std::string &osPath,
+                           const std::vector<std::string> &aosSkippedMembers)
+{
+    GIntBig nMaxSize = 0;
+    if (CPLParseMemorySize(CPLGetConfigOption("CPL_JSON_MAX_SIZE", "100MB"),
+                           &nMaxSize, nullptr) != CE_None ||
+        nMaxSize <= 0)
+        return false;
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osPath.c_str(), "rb"));
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Load json file %s failed",
+                 osPath.c_str());
+        return false;
+    }
+
+    CPLJSONPruningBuilder oBuilder(aosSkippedMembers);
+    constexpr size_t CHUNK_SIZE = 1024 * 1024;
+    std::string osBuffer;
+    osBuffer.resize(CHUNK_SIZE);
+    vsi_l_offset nTotalRead = 0;
+    bool bOK = true;
+    while (bOK)
+    {
+        const size_t nRead = fp->Read(osBuffer.data(), 1, CHUNK_SIZE);
+        nTotalRead += nRead;
+        if (nTotalRead > static_cast<vsi_l_offset>(nMaxSize))
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "File %s is larger than CPL_JSON_MAX_SIZE",
+                     osPath.c_str());
+            return false;
+        }
+        const bool bFinished = nRead < CHUNK_SIZE;
+        bOK = oBuilder.Parse(osBuffer.data(), nRead, bFinished);
+        if (bFinished)
+            break;
+    }
+    if (!bOK || !oBuilder.IsComplete())
+    {
+        if (!oBuilder.ExceptionOccurred())
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "JSON parsing error: unexpected end of data");
+        return false;
+    }
+
+    if (m_poRootJsonObject)
+        json_object_put(TO_JSONOBJ(m_poRootJsonObject));
+    m_poRootJsonObject = oBuilder.StealRoot();
+    return true;
+}
+
 /**
  * Load json document from file using small chunks of data.
  * @param  osPath      Path to json document file.
@@ -278,6 +278,10 @@ class CPL_DLL CPLJSONDocument
     bool Load(const std::string &osPath);
     bool LoadMemory(const std::string &osStr);
     bool LoadMemory(const GByte *pabyData, int nLength = -1);
+    bool Load(const std::string &osPath,
+              const std::vector<std::string> &aosSkippedMembers);
+    bool LoadMemory(const GByte *pabyData, size_t nLength,
+                    const std::vector<std::string> &aosSkippedMembers);
     bool LoadChunks(const std::string &osPath, size_t nChunkSize = 16384,
                     GDALProgressFunc pfnProgress = nullptr,
                     void *pProgressArg = nullptr);
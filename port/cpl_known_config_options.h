@@ -74,6 +74,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CHECK_WITH_INVERT_PROJ", // from gdaltransformer.cpp, gdalwarp_lib.cpp, gdalwarpoperation.cpp, ogrct.cpp
    "COG_DELETE_TEMP_FILES", // from cogdriver.cpp
    "COG_TMP_COMPRESSION", // from cogdriver.cpp
+   "COG_TMP_OVERVIEWS_MAX_IN_MEMORY_SIZE", // from cogdriver.cpp
    "COMPRESS_GEOM", // from ogrsqlitelayer.cpp
    "COMPRESS_OVERVIEW", // from gt_overview.cpp
    "CONVERT_YCBCR_TO_RGB", // from ecwdataset.cpp, geotiff.cpp, gtiffdataset.cpp, gtiffdataset_read.cpp, gtiffdataset_write.cpp, gtiffrasterband.cpp
@@ -99,6 +100,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_CURL_VERBOSE_DATA_IN", // from cpl_http.cpp
    "CPL_CURL_VSIMEM_PRINT_HEADERS", // from cpl_http.cpp
    "CPL_DEBUG", // from cpl_conv.cpp, cpl_error.cpp, gdalinfo_bin.cpp, gdalsrsinfo.cpp, gdalwarp_bin.cpp, gmlutils.cpp
+   "CPL_DEBUG_CGROUP_ROOT", // from cpl_multiproc.cpp
    "CPL_ENABLE_USERFAULTFD", // from cpl_userfaultfd.cpp
    "CPL_ERROR_SEPARATOR", // from cpl_error.cpp
    "CPL_GCE_CHECK_LOCAL_FILES", // from cpl_google_cloud.cpp
@@ -121,31 +123,47 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_SOZIP_MIN_FILE_SIZE", // from cpl_minizip_zip.cpp
    "CPL_TIMESTAMP", // from cpl_error.cpp
    "CPL_TMPDIR", // from cogdriver.cpp, cpl_path.cpp, gdal_misc.cpp, gdalwmscache.cpp, wcsutils.cpp
+   "CPL_TRACE_ENABLED", // from cpl_trace.cpp
+   "CPL_TRACE_FILE", // from cpl_trace.cpp
+   "CPL_TRACE_MAX_EVENTS", // from cpl_trace.cpp
    "CPL_VSI_MEM_MTIME", // from cpl_vsi_mem.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
+   "CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", // from cpl_vsil_abstract_archive.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_FILENAME", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR_LIST_TTL", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READAHEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_USE_INDEX", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_LIST_NUM_THREADS", // from cpl_vsil_s3.cpp
+   "CPL_VSIL_LOCAL_READ_NUM_THREADS", // from cpl_vsil_unix_stdio_64.cpp
+   "CPL_VSIL_LZ4_CHUNK_SIZE", // from cpl_vsil_zstd_lz4.cpp
+   "CPL_VSIL_LZ4_LEVEL", // from cpl_vsil_zstd_lz4.cpp
+   "CPL_VSIL_MULTIPART_UPLOAD_NUM_THREADS", // from cpl_vsil_s3.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_SHOW_NETWORK_STATS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_ZSTD_CHUNK_SIZE", // from cpl_vsil_zstd_lz4.cpp
+   "CPL_VSIL_ZSTD_LEVEL", // from cpl_vsil_zstd_lz4.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_LIST_UPLOADS_MAX", // from cpl_vsil_s3.cpp
    "CPL_VSIS3_UNLINK_BATCH_SIZE", // from cpl_vsil_s3.cpp
@@ -221,10 +239,12 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "FORCE_BLOCKSIZE", // from hfaopen.cpp
    "GDAL_ALLOW_LARGE_LIBJPEG_MEM_ALLOC", // from JPEG_band.cpp, jpgdataset.cpp
    "GDAL_ALLOW_REMOTE_RESOURCE_TO_ACCESS_LOCAL_FILE", // from vsikerchunk.cpp
+   "GDAL_APPROX_TRANSFORMER_CACHE_SIZE", // from gdaltransformer.cpp
    "GDAL_BAG_BLOCK_SIZE", // from bagdataset.cpp
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
+   "GDAL_CACHE_DIRTY_RATIO", // from gdalrasterblock.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
    "GDAL_CURL_CA_BUNDLE", // from cpl_http.cpp
@@ -239,9 +259,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_DAAS_SERVER_BYTE_LIMIT", // from daasdataset.cpp
    "GDAL_DAAS_X_FORWARDED_USER", // from daasdataset.cpp
    "GDAL_DATA", // from cpl_csv.cpp, cpl_findfile.cpp, gdaldrivermanager.cpp
+   "GDAL_DATASET_CACHEMAX", // from gdalrasterblock.cpp
    "GDAL_DEBUG_BLOCK_CACHE", // from gdalrasterblock.cpp
    "GDAL_DEBUG_CPU_COUNT", // from gdalalgorithm.cpp
    "GDAL_DEBUG_PROCESS_DYNAMIC_METADATA", // from gdaljp2metadata.cpp
+   "GDAL_DECODED_TILE_CACHE_SIZE", // from gdal_decoded_tile_cache.cpp
    "GDAL_DEFAULT_CREATE_COPY", // from gdaldriver.cpp
    "GDAL_DEFAULT_WMS_CACHE_PATH", // from gdalwmscache.cpp
    "GDAL_DISABLE_CPLLOCALEC", // from cpl_conv.cpp
@@ -271,10 +293,12 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_GEOLOC_USE_MAX_ACCURACY", // from gdalgeoloc.cpp
    "GDAL_GEOLOC_USE_TEMP_DATASETS", // from gdalgeoloc.cpp
    "GDAL_GEOREF_SOURCES", // from gdalgeorefpamdataset.cpp, gdaljp2abstractdataset.cpp, gtiffdataset_read.cpp
-   "GDAL_GRID_POINT_COUNT_THRESHOLD", // from gdalgrid.cpp
+   "GDAL_GRID_POINT_COUNT_THRESHOLD", // from gdal_grid_lib.cpp, gdalgrid.cpp
+   "GDAL_GRID_TILED", // from gdal_grid_lib.cpp
    "GDAL_GSSAPI_DELEGATION", // from cpl_http.cpp
    "GDAL_GTIFF_PREDICTOR_CHECKS", // from gtiffdataset_write.cpp
    "GDAL_HDF5_CHAR_AS_STRING", // from hdf5dataset.cpp
+   "GDAL_HDF5_DIRECT_CHUNK_READ", // from hdf5imagedataset.cpp
    "GDAL_HDF5_TEMP_ARRAY_ALLOC_SIZE", // from hdf5multidim.cpp
    "GDAL_HFA_OVR_BLOCKSIZE", // from hfaband.cpp
    "GDAL_HTTP_AUTH", // from cpl_http.cpp
@@ -293,6 +317,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HTTP_MAX_RETRY", // from cpl_http.cpp
    "GDAL_HTTP_MAX_TOTAL_CONNECTIONS", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", // from cpl_vsil_curl.cpp
+   "GDAL_HTTP_MERGE_RANGES_MAX_GAP", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MULTIPLEX", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MULTIRANGE", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_NETRC", // from cpl_http.cpp
@@ -301,6 +326,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HTTP_PROXYUSERPWD", // from cpl_http.cpp
    "GDAL_HTTP_RETRY_CODES", // from cpl_http.cpp
    "GDAL_HTTP_RETRY_DELAY", // from cpl_http.cpp
+   "GDAL_HTTP_SHARE_CONNECTIONS", // from cpl_http.cpp
    "GDAL_HTTP_SSL_VERIFYSTATUS", // from cpl_http.cpp
    "GDAL_HTTP_SSLCERT", // from cpl_http.cpp
    "GDAL_HTTP_SSLCERTTYPE", // from cpl_http.cpp
@@ -324,20 +350,24 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_LOAD_EXTRA_DIM_METADATA_DELAY", // from gdalmultidim.cpp
    "GDAL_LOCALE", // from gdaldllmain.cpp
    "GDAL_MAX_BAND_COUNT", // from gdal_misc.cpp, netcdfdataset.cpp, pcidskdataset2.cpp
-   "GDAL_MAX_CONNECTIONS", // from gdalogcapidataset.cpp, gdalwmsdataset.cpp
+   "GDAL_MAX_CONNECTIONS", // from gdalogcapidataset.cpp, gdalwmsdataset.cpp, stacitdataset.cpp
    "GDAL_MAX_DATASET_POOL_RAM_USAGE", // from gdalproxypool.cpp
    "GDAL_MAX_DATASET_POOL_SIZE", // from gdal_translate_bin.cpp, gdalproxypool.cpp, gdalwarp_bin.cpp
-   "GDAL_MAX_RAW_BLOCK_CACHE_SIZE", // from gtiffdataset_read.cpp
+   "GDAL_MAX_RAW_BLOCK_CACHE_SIZE", // from gtiffdataset_read.cpp, libertiffdataset.cpp
+   "GDAL_MAX_THREADS", // from gdal_thread_pool.cpp
    "GDAL_MEM_ENABLE_OPEN", // from memdataset.cpp
+   "GDAL_MULTIDIM_CACHE_REGULAR_SPACING", // from gdalmultidim.cpp
    "GDAL_NETCDF_ASSUME_LONGLAT", // from netcdfdataset.cpp
    "GDAL_NETCDF_BOTTOMUP", // from netcdfdataset.cpp
    "GDAL_NETCDF_CENTERLONG_180", // from netcdfdataset.cpp
+   "GDAL_NETCDF_CLASSIC_DIRECT_READ", // from netcdfdataset.cpp
    "GDAL_NETCDF_IGNORE_EQUALLY_SPACED_XY_CHECK", // from netcdfdataset.cpp
    "GDAL_NETCDF_IGNORE_XY_AXIS_NAME_CHECKS", // from netcdfdataset.cpp
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NODATA_MASK_BAND_CACHE", // from gdalnodatamaskband.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, cpl_vsil_zstd_lz4.cpp, gdal_footprint_lib.cpp, gdal_tps.cpp, gdalalg_vector_pipeline.cpp, gdalalgorithm.cpp, gdalbuildvrt_lib.cpp, gdaldem_lib.cpp, gdaldither.cpp, gdalgeoloc.cpp, gdalgeopackagerasterband.cpp, gdalgrid.cpp, gdalmediancut.cpp, gdalmultidim.cpp, gdalmultidim_gltorthorectification.cpp, gdalpansharpen.cpp, gdalproximity.cpp, gdalrasterband.cpp, gdaltileindexdataset.cpp, gdaltindex_lib.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, hdf5imagedataset.cpp, heifdataset.cpp, jpegxl.cpp, libertiffdataset.cpp, mrf_band.cpp, nearblack_lib.cpp, ogr2ogr_lib.cpp, ogradbcdataset.cpp, ogrcsvlayer.cpp, ogrfeatherwriterlayer.cpp, ogrflatgeobuflayer.cpp, ogrgeojsonreader.cpp, ogrgeojsonwritelayer.cpp, ogrgeometryfactory.cpp, ogrgeopackagetablelayer.cpp, ogrgmllayer.cpp, ogrmvtdataset.cpp, ogrosmdatasource.cpp, ogrparquetlayer.cpp, ogrparquetwriterlayer.cpp, ogrshapelayer.cpp, osm_parser.cpp, overview.cpp, rasterio.cpp, rawdataset.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp, zarr_v3_codec.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
@@ -347,6 +377,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_OVR_CHUNK_MAX_SIZE_FOR_TEMP_FILE", // from overview.cpp
    "GDAL_OVR_CHUNKYSIZE", // from overview.cpp
    "GDAL_OVR_PROPAGATE_NODATA", // from overview.cpp
+   "GDAL_OVR_STREAMING", // from overview.cpp
    "GDAL_OVR_TEMP_DRIVER", // from overview.cpp
    "GDAL_PAM_ENABLE_MARK_DIRTY", // from gdalpamdataset.cpp
    "GDAL_PAM_ENABLED", // from gdalpamdataset.cpp
@@ -376,13 +407,19 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_RASTER_TILE_EMIT_SPURIOUS_CHARS", // from gdalalg_raster_tile.cpp
    "GDAL_RASTER_TILE_HTML_PREC", // from gdalalg_raster_tile.cpp
    "GDAL_RASTER_TILE_KML_PREC", // from gdalalg_raster_tile.cpp
+   "GDAL_RASTERIO_DIRECT_DECODE", // from rasterio.cpp
+   "GDAL_RASTERIO_NUM_THREADS", // from rasterio.cpp
    "GDAL_RASTERIO_RESAMPLING", // from gdal_misc.cpp
+   "GDAL_RB_COMPRESSED_CACHE_CODEC", // from gdalrasterblock.cpp
+   "GDAL_RB_COMPRESSED_CACHE_MAX", // from gdalrasterblock.cpp
+   "GDAL_RB_EVICTION_POLICY", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_DROP_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_RB_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DETACH_BEFORE_WRITE", // from gdalrasterblock.cpp
    "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_LOCK_DEBUG_CONTENTION", // from gdalrasterblock.cpp
    "GDAL_RB_LOCK_TYPE", // from gdalrasterblock.cpp
+   "GDAL_RB_SHARD_COUNT", // from gdalrasterblock.cpp
    "GDAL_RB_TRYGET_SLEEP_AFTER_TAKE_LOCK", // from gdalrasterblock.cpp
    "GDAL_READDIR_LIMIT_ON_OPEN", // from gdalopeninfo.cpp, gtiffdataset_read.cpp, tiledbdense.cpp
    "GDAL_REPORT_DIRTY_BLOCK_FLUSHING", // from gdalabstractbandblockcache.cpp
@@ -570,6 +607,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "L1B_HIGH_GCP_DENSITY", // from l1bdataset.cpp
    "L1B_INTERPOL_GCPS", // from l1bdataset.cpp
    "L1B_METADATA_DIRECTORY", // from l1bdataset.cpp
+   "LIBERTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", // from libertiffdataset.cpp
    "LIBKML_ADD_RESOURCE_MAP", // from ogrlibkmlfeature.cpp
    "LIBKML_ALTITUDEMODE_FIELD", // from ogrlibkmlfield.cpp
    "LIBKML_BEGIN_FIELD", // from ogrlibkmlfield.cpp
@@ -677,7 +715,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ADBC_AUTO_LOAD_DUCKDB_SPATIAL", // from ogradbcdataset.cpp
    "OGR_API_SPY_FILE", // from ograpispy.cpp
    "OGR_API_SPY_SNAPSHOT_PATH", // from ograpispy.cpp
-   "OGR_APPLY_GEOM_SET_PRECISION", // from ogr2ogr_lib.cpp, ogrlayer.cpp
+   "OGR_APPLY_GEOM_SET_PRECISION", // from ogr2ogr_lib.cpp, ogrgeopackagetablelayer.cpp, ogrlayer.cpp
    "OGR_ARC_MAX_GAP", // from ogrgeometryfactory.cpp
    "OGR_ARC_STEPSIZE", // from ogrgeometryfactory.cpp
    "OGR_ARROW_COMPUTE_GEOMETRY_TYPE", // from ogrfeatherlayer.cpp
@@ -691,9 +729,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ARROW_WRITE_GEO", // from ogrfeatherwriterlayer.cpp
    "OGR_CSV_MAX_FIELD_COUNT", // from ogrcsvlayer.cpp
    "OGR_CSV_MAX_LINE_SIZE", // from ogrcsvdatasource.cpp
+   "OGR_CSV_MULTITHREADING_MIN_FILE_SIZE", // from ogrcsvlayer.cpp
    "OGR_CSV_SIMULATE_VSISTDIN", // from ogrcsvlayer.cpp
    "OGR_CT_DEBUG", // from ogrct.cpp
    "OGR_CT_FORCE_TRADITIONAL_GIS_ORDER", // from ogrct.cpp
+   "OGR_CT_NUM_THREADS", // from ogrct.cpp
    "OGR_CT_OP_SELECTION", // from ogrct.cpp
    "OGR_CT_PREFER_OFFICIAL_SRS_DEF", // from ogrct.cpp
    "OGR_CT_USE_SRS_COORDINATE_EPOCH", // from ogrct.cpp
@@ -710,13 +750,16 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_FGDB_WORKAROUND_CRASH_ON_BINARY_FIELD", // from FGdbLayer.cpp
    "OGR_FLATGEOBUF_STREAM_BASE_IMPL", // from ogrflatgeobuflayer.cpp
    "OGR_FORCE_ASCII", // from ogrgpxlayer.cpp, ogrlibkmlfield.cpp, ogrutils.cpp
+   "OGR_GENSQL_HASH_JOIN", // from ogr_gensql.cpp
    "OGR_GENSQL_STREAM_BASE_IMPL", // from ogr_gensql.cpp
    "OGR_GEOJSON_ARRAY_AS_STRING", // from ogrgeojsondatasource.cpp
    "OGR_GEOJSON_DATE_AS_STRING", // from ogrgeojsondatasource.cpp
    "OGR_GEOJSON_MAX_BYTES_FIRST_PASS", // from ogrgeojsondatasource.cpp, ogrgeojsonreader.cpp
    "OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", // from ogrgeojsonreader.cpp
    "OGR_GEOJSON_MAX_OBJ_SIZE", // from ogrgeojsonreader.cpp, ogrgeojsonseqdriver.cpp
+   "OGR_GEOJSON_MULTITHREADING_MIN_FILE_SIZE", // from ogrgeojsonreader.cpp
    "OGR_GEOJSON_REWRITE_IN_PLACE", // from ogrgeojsondatasource.cpp
+   "OGR_GEOJSON_WRITE_MULTITHREADING_MIN_FEATURES", // from ogrgeojsonwritelayer.cpp
    "OGR_GEOJSONSEQ_CHUNK_SIZE", // from ogrgeojsonseqdriver.cpp
    "OGR_GEOMETRY_ACCEPT_UNCLOSED_RING", // from ogrcurvepolygon.cpp, ogrpolygon.cpp
    "OGR_GML_NESTING_LEVEL", // from gmlhandler.cpp
@@ -742,6 +785,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_JSONFG_MAX_OBJ_SIZE", // from ogrjsonfgstreamingparser.cpp
    "OGR_LVBAG_CHECK_ALL_FILES", // from ogrlvbagdriver.cpp
    "OGR_LVBAG_MAX_OPENED", // from ogrlvbagdatasource.cpp
+   "OGR_MEM_SPATIAL_INDEX", // from ogrmemlayer.cpp
    "OGR_MONGODB_SPAT_INDEX_TYPE", // from ogrmongodbv3driver.cpp
    "OGR_MULTIPATCH_OMIT_Z", // from ogrpgeogeometry.cpp
    "OGR_MVT_CLIP", // from ogrmvtdataset.cpp
@@ -758,6 +802,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_PARQUET_BATCH_READ_AHEAD", // from ogrparquetdatasetlayer.cpp
    "OGR_PARQUET_BATCH_SIZE", // from ogrparquetdatasetlayer.cpp, ogrparquetlayer.cpp
    "OGR_PARQUET_COMPUTE_GEOMETRY_TYPE", // from ogrparquetlayer.cpp
+   "OGR_PARQUET_CONCURRENT_ROW_GROUPS", // from ogrparquetlayer.cpp
    "OGR_PARQUET_CRS_ENCODING", // from ogrparquetwriterlayer.cpp
    "OGR_PARQUET_CRS_OMIT_IF_WGS84", // from ogrparquetwriterlayer.cpp
    "OGR_PARQUET_FRAGMENT_READ_AHEAD", // from ogrparquetdatasetlayer.cpp
@@ -799,6 +844,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
+   "OGR_SQL_COMPILE_WHERE", // from ogrfeaturequery.cpp, ogrlayerarrow.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
@@ -837,6 +883,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_WFS_LOAD_MULTIPLE_LAYER_DEFN", // from ogrwfsdatasource.cpp
    "OGR_WFS_PAGE_SIZE", // from ogrwfsdatasource.cpp
    "OGR_WFS_PAGING_ALLOWED", // from ogrwfsdatasource.cpp
+   "OGR_WFS_PREFETCH_PAGES", // from ogrwfsdatasource.cpp
    "OGR_WFS_TRUST_CAPABILITIES_BOUNDS", // from ogrwfsdatasource.cpp
    "OGR_WFS_USE_STREAMING", // from ogrwfsjoinlayer.cpp, ogrwfslayer.cpp
    "OGR_WKT_PRECISION", // from ogrgeometry.cpp
@@ -934,6 +981,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "PG_SKIP_VIEWS", // from ogrpgdatasource.cpp
    "PG_USE_BASE64", // from ogrpgtablelayer.cpp
    "PG_USE_COPY", // from ogrpgdatasource.cpp, ogrpgdumplayer.cpp, ogrpgtablelayer.cpp
+   "PG_USE_COPY_BINARY", // from ogrpgtablelayer.cpp
    "PG_USE_GEOGRAPHY", // from ogrpgdatasource.cpp
    "PG_USE_POSTGIS", // from ogrpgdatasource.cpp
    "PG_USE_POSTGIS2_OPTIM", // from ogrpgdatasource.cpp
@@ -985,6 +1033,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "SHAPE_ENCODING", // from ogrshapelayer.cpp
    "SHAPE_RESTORE_SHX", // from ogrshapedatasource.cpp
    "SHAPE_REWIND_ON_WRITE", // from ogrshapelayer.cpp
+   "SHAPE_SPATIAL_INDEX_FORMAT", // from ogrshapelayer.cpp
    "SPARSE_OK_OVERVIEW", // from gt_overview.cpp
    "SPATIALITE_INIT_VERBOSE", // from ogrsqlitedatasource.cpp
    "SPATIALITE_LOAD", // from ogrsqlitedatasource.cpp
@@ -995,6 +1044,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "SQLITE_USE_URI", // from ogrsqlitedatasource.cpp, ogrsqlitedriver.cpp
    "SRP_SINGLE_GEN_IN_THF_AS_DATASET", // from srpdataset.cpp
    "SSL_CERT_FILE", // from cpl_http.cpp
+   "STACIT_CACHE_MAX_PAGES", // from stacitdataset.cpp
    "SWIFT_AUTH_TOKEN", // from cpl_swift.cpp
    "SWIFT_AUTH_V1_URL", // from cpl_swift.cpp
    "SWIFT_KEY", // from cpl_swift.cpp
@@ -1030,10 +1080,12 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "VRT_MIN_MAX_FROM_SOURCES", // from vrtsourcedrasterband.cpp
    "VRT_NUM_THREADS", // from vrtdataset.cpp
    "VRT_SHARED_SOURCE", // from vrtsources.cpp
+   "VRT_VECTORIZED_EXPRESSION", // from pixelfunctions.cpp
    "VRT_VIRTUAL_OVERVIEWS", // from gdalbuildvrt_lib.cpp, vrtdataset.cpp
    "VSI_CACHE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp, cpl_vsil_unix_stdio_64.cpp, cpl_vsil_win32.cpp
    "VSI_CACHE_SIZE", // from cpl_vsil_cache.cpp
    "VSI_FLUSH", // from cpl_vsil_win32.cpp
+   "VSI_HUGE_PAGES", // from cpl_vsisimple.cpp
    "VSIAZ_CHUNK_SIZE", // from cpl_vsil_az.cpp
    "VSIAZ_CHUNK_SIZE_BYTES", // from cpl_vsil_az.cpp
    "VSICRYPT_ADD_KEY_CHECK", // from cpl_vsil_crypt.cpp
@@ -1352,6 +1352,150 @@ void CPLCleanupTLS()
 /* ==================================================================== */
 /************************************************************************/
 
+#ifdef __linux
+/************************************************************************/
+/*                        CPLGetCGroupCPULimit()                        */
+/************************************************************************/
+
+// Return the number of CPUs allowed by the CPU bandwidth limit (quota) of
+// the cgroup of the process, typically set by container runtimes
+// ("docker --cpus" or Kubernetes CPU limits), or 0 if there is none.
+// pszRoot is prepended to /proc/self/cgroup and /sys/fs/cgroup, and is
+// empty except for testing.
+static int CPLGetCGroupCPULimit(const char *pszRoot)
+{
+    char szFilename[1024];
+    char szGroupName[256];
+    bool bV1 = false;
+    szGroupName[0] = 0;
+    {
+        snprintf(szFilename, sizeof(szFilename), "%s/proc/self/cgroup",
+                 pszRoot);
+        FILE *f = fopen(szFilename, "rb");
+        if (!f)
+            return 0;
+        char szLine[256];
+        // Find line like "4:cpu,cpuacct:/docker/xxxx" for cgroup V1 or
+        // single line "0::/...." for cgroup V2.
+        while (fgets(szLine, sizeof(szLine), f))
+        {
+            const char *pszGroup = nullptr;
+            for (const char *pszController :
+                 {":cpu,cpuacct:", ":cpuacct,cpu:", ":cpu:"})
+            {
+                const char *pszCPU = strstr(szLine, pszController);
+                if (pszCPU)
+                {
+                    pszGroup = pszCPU + strlen(pszController);
+                    bV1 = true;
+                    break;
+                }
+            }
+            if (!pszGroup && strncmp(szLine, "0::", strlen("0::")) == 0)
+                pszGroup = szLine + strlen("0::");
+            if (pszGroup)
+            {
+                snprintf(szGroupName, sizeof(szGroupName), "%s", pszGroup);
+                char *pszEOL = strchr(szGroupName, '\n');
+                if (pszEOL)
+                    *pszEOL = '\0';
+                if (bV1)
+                    break;
+            }
+        }
+        fclose(f);
+    }
+    if (szGroupName[0] == 0)
+        return 0;
+
+    const auto ReadFile = [](const char *pszFilenameIn, char *pszBuffer,
+                             size_t nBufferSize)
+    {
+        FILE *f = fopen(pszFilenameIn, "rb");
+        if (!f)
+            return false;
+        const size_t nRead = fread(pszBuffer, 1, nBufferSize - 1, f);
+        pszBuffer[nRead] = 0;
+        fclose(f);
+        return nRead > 0;
+    };
+
+    // Take the most restrictive limit of the whole szGroupName hierarchy
+    double dfLimit = 0;
+    const auto UpdateLimit = [&dfLimit](double dfQuota, double dfPeriod)
+    {
+        if (dfQuota > 0 && dfPeriod > 0)
+        {
+            const double dfThisLimit = dfQuota / dfPeriod;
+            if (dfLimit == 0 || dfThisLimit < dfLimit)
+                dfLimit = dfThisLimit;
+        }
+    };
+
+    char szBuffer[64];
+    if (bV1)
+    {
+        // Read cpu.cfs_quota_us in the whole szGroupName hierarchy.
+        // Make sure to end up by reading
+        // /sys/fs/cgroup/cpu/cpu.cfs_quota_us itself, as Docker sets the
+        // quota of the container there, while /proc/self/cgroup reports
+        // /docker/xxxx (same as CPLGetUsablePhysicalRAM())
+        while (true)
+        {
+            // cpu.cfs_quota_us is -1 when there is no limitation
+            snprintf(szFilename, sizeof(szFilename),
+                     "%s/sys/fs/cgroup/cpu/%s/cpu.cfs_quota_us", pszRoot,
+                     szGroupName);
+            if (ReadFile(szFilename, szBuffer, sizeof(szBuffer)))
+            {
+                const double dfQuota = CPLAtof(szBuffer);
+                snprintf(szFilename, sizeof(szFilename),
+                         "%s/sys/fs/cgroup/cpu/%s/cpu.cfs_period_us", pszRoot,
+                         szGroupName);
+                if (ReadFile(szFilename, szBuffer, sizeof(szBuffer)))
+                    UpdateLimit(dfQuota, CPLAtof(szBuffer));
+            }
+
+            char *pszLastSlash = strrchr(szGroupName, '/');
+            if (!pszLastSlash)
+                break;
+            *pszLastSlash = '\0';
+        }
+    }
+    else
+    {
+        // Read cpu.max in the whole szGroupName hierarchy. The root cgroup
+        // has no cpu.max file.
+        while (true)
+        {
+            // cpu.max is like "max 100000" when there is no limitation,
+            // or "200000 100000" for a limit of 2 CPUs.
+            snprintf(szFilename, sizeof(szFilename),
+                     "%s/sys/fs/cgroup/%s/cpu.max", pszRoot, szGroupName);
+            if (ReadFile(szFilename, szBuffer, sizeof(szBuffer)) &&
+                strncmp(szBuffer, "max", 3) != 0)
+            {
+                const CPLStringList aosTokens(
+                    CSLTokenizeString2(szBuffer, " \n", 0));
+                if (aosTokens.size() == 2)
+                    UpdateLimit(CPLAtof(aosTokens[0]), CPLAtof(aosTokens[1]));
+            }
+
+            char *pszLastSlash = strrchr(szGroupName, '/');
+            if (!pszLastSlash || pszLastSlash == szGroupName)
+                break;
+            *pszLastSlash = '\0';
+        }
+    }
+
+    if (dfLimit == 0)
+        return 0;
+    // A fractional limit, e.g 1.5, still allows using 2 CPUs part of the time
+    return static_cast<int>(
+        std::min(std::ceil(dfLimit), static_cast<double>(INT_MAX)));
+}
+#endif
+
 /************************************************************************/
 /*                             CPLGetNumCPUs()                          */
 /************************************************************************/
@@ -1382,6 +1526,20 @@ int CPLGetNumCPUs()
     }
 #endif
 
+#ifdef __linux
+    // The CPU quota of the cgroup is not expected to change during the
+    // lifetime of the process.
+    static const int nCGroupCPULimitProcess = CPLGetCGroupCPULimit("");
+    // Only for testing: read cgroup files relative to another root directory
+    const char *pszCGroupRoot =
+        CPLGetConfigOption("CPL_DEBUG_CGROUP_ROOT", nullptr);
+    const int nCGroupCPULimit = pszCGroupRoot
+                                    ? CPLGetCGroupCPULimit(pszCGroupRoot)
+                                    : nCGroupCPULimitProcess;
+    if (nCGroupCPULimit > 0 && nCGroupCPULimit < nCPUs)
+        nCPUs = nCGroupCPULimit;
+#endif
+
     return nCPUs;
 }
 
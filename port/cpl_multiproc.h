@@ -217,6 +217,8 @@ class CPL_DLL CPLLockHolder
 #define CTLS_PROJCONTEXTHOLDER 18      /* ogr_proj_p.cpp */
 #define CTLS_GDALDEFAULTOVR_ANTIREC 19 /* gdaldefaultoverviews.cpp */
 #define CTLS_HTTPFETCHCALLBACK 20      /* cpl_http.cpp */
+#define CTLS_COMPRESSION_CONTEXTS 21   /* cpl_compressor.cpp */
+#define CTLS_CONFIGOPTIONS_SNAPSHOT 22 /* cpl_conv.cpp */
 
 #define CTLS_MAX 32
 
@@ -0,0 +1,271 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Bulk-loaded packed Hilbert R-tree
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_packed_rtree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "cpl_error.h"
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                            HilbertIndex()                            */
+/************************************************************************/
+
+// Index of (x, y) along the Hilbert curve of order 16, using the bit
+// twiddling algorithm of http://threadlocalmutex.com/?p=126 (public domain)
+static uint32_t HilbertIndex(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                          CPLPackedRTree()                            */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param nNodeSize Number of children per node, between 2 and MAX_NODE_SIZE.
+ */
+CPLPackedRTree::CPLPackedRTree(int nNodeSize)
+    : m_nNodeSize(std::clamp(nNodeSize, 2, MAX_NODE_SIZE))
+{
+}
+
+/************************************************************************/
+/*                              Reserve()                               */
+/************************************************************************/
+
+/** Reserves room for the specified number of features before Build() */
+void CPLPackedRTree::Reserve(size_t nFeatureCount)
+{
+    m_aoPending.reserve(nFeatureCount);
+}
+
+/************************************************************************/
+/*                               Insert()                               */
+/************************************************************************/
+
+/** Adds a feature. Must not be called after Build() */
+void CPLPackedRTree::Insert(void *pFeature, const CPLRectObj &sBounds)
+{
+    CPLAssert(!m_bBuilt);
+    m_aoPending.push_back({sBounds, pFeature});
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Builds the tree from the inserted features. Must be called once, before
+ * searches, which can then be run concurrently from several threads.
+ */
+void CPLPackedRTree::Build()
+{
+    CPLAssert(!m_bBuilt);
+    m_bBuilt = true;
+
+    const size_t nItems = m_aoPending.size();
+    if (nItems == 0)
+        return;
+
+    // Sort features by the Hilbert index of the center of their bounds
+    double dfMinX = std::numeric_limits<double>::infinity();
+    double dfMinY = std::numeric_limits<double>::infinity();
+    double dfMaxX = -std::numeric_limits<double>::infinity();
+    double dfMaxY = -std::numeric_limits<double>::infinity();
+    for (const auto &oItem : m_aoPending)
+    {
+        dfMinX = std::min(dfMinX, oItem.sBounds.minx);
+        dfMinY = std::min(dfMinY, oItem.sBounds.miny);
+        dfMaxX = std::max(dfMaxX, oItem.sBounds.maxx);
+        dfMaxY = std::max(dfMaxY, oItem.sBounds.maxy);
+    }
+    constexpr double HILBERT_MAX = 65535;
+    const double dfScaleX =
+        dfMaxX > dfMinX ? HILBERT_MAX / (dfMaxX - dfMinX) : 0;
+    const double dfScaleY =
+        dfMaxY > dfMinY ? HILBERT_MAX / (dfMaxY - dfMinY) : 0;
+    const auto ToGrid = [](double dfVal)
+    {
+        // Also handles NaN and infinite values
+        if (!(dfVal >= 0))
+            return 0U;
+        return static_cast<uint32_t>(dfVal < HILBERT_MAX ? dfVal
+                                                         : HILBERT_MAX);
+    };
+
+    std::vector<std::pair<uint32_t, size_t>> anHilbertIdx;
+    anHilbertIdx.reserve(nItems);
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        const auto &sBounds = m_aoPending[i].sBounds;
+        const double dfX =
+            ((sBounds.minx + sBounds.maxx) / 2 - dfMinX) * dfScaleX;
+        const double dfY =
+            ((sBounds.miny + sBounds.maxy) / 2 - dfMinY) * dfScaleY;
+        anHilbertIdx.emplace_back(HilbertIndex(ToGrid(dfX), ToGrid(dfY)), i);
+    }
+    // Pairs are unique, so the result is deterministic
+    std::sort(anHilbertIdx.begin(), anHilbertIdx.end());
+
+    // Compute the number of nodes of each level
+    m_anLevelStart.push_back(0);
+    size_t nLevelCount = nItems;
+    size_t nTotal = nItems;
+    do
+    {
+        m_anLevelStart.push_back(nTotal);
+        nLevelCount = (nLevelCount + m_nNodeSize - 1) / m_nNodeSize;
+        nTotal += nLevelCount;
+    } while (nLevelCount > 1);
+    m_anLevelStart.push_back(nTotal);
+
+    m_adfMinX.resize(nTotal);
+    m_adfMinY.resize(nTotal);
+    m_adfMaxX.resize(nTotal);
+    m_adfMaxY.resize(nTotal);
+    m_apFeatures.resize(nItems);
+
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        const auto &oItem = m_aoPending[anHilbertIdx[i].second];
+        m_adfMinX[i] = oItem.sBounds.minx;
+        m_adfMinY[i] = oItem.sBounds.miny;
+        m_adfMaxX[i] = oItem.sBounds.maxx;
+        m_adfMaxY[i] = oItem.sBounds.maxy;
+        m_apFeatures[i] = oItem.pFeature;
+    }
+    anHilbertIdx.clear();
+    anHilbertIdx.shrink_to_fit();
+    m_aoPending.clear();
+    m_aoPending.shrink_to_fit();
+
+    // Compute the bounds of the nodes of upper levels from their children
+    for (size_t iLevel = 1; iLevel + 1 < m_anLevelStart.size(); ++iLevel)
+    {
+        const size_t nChildStart = m_anLevelStart[iLevel - 1];
+        const size_t nChildEnd = m_anLevelStart[iLevel];
+        for (size_t iNode = m_anLevelStart[iLevel];
+             iNode < m_anLevelStart[iLevel + 1]; ++iNode)
+        {
+            const size_t nBegin =
+                nChildStart + (iNode - m_anLevelStart[iLevel]) * m_nNodeSize;
+            const size_t nEnd = std::min(nBegin + m_nNodeSize, nChildEnd);
+            double dfNodeMinX = m_adfMinX[nBegin];
+            double dfNodeMinY = m_adfMinY[nBegin];
+            double dfNodeMaxX = m_adfMaxX[nBegin];
+            double dfNodeMaxY = m_adfMaxY[nBegin];
+            for (size_t i = nBegin + 1; i < nEnd; ++i)
+            {
+                dfNodeMinX = std::min(dfNodeMinX, m_adfMinX[i]);
+                dfNodeMinY = std::min(dfNodeMinY, m_adfMinY[i]);
+                dfNodeMaxX = std::max(dfNodeMaxX, m_adfMaxX[i]);
+                dfNodeMaxY = std::max(dfNodeMaxY, m_adfMaxY[i]);
+            }
+            m_adfMinX[iNode] = dfNodeMinX;
+            m_adfMinY[iNode] = dfNodeMinY;
+            m_adfMaxX[iNode] = dfNodeMaxX;
+            m_adfMaxY[iNode] = dfNodeMaxY;
+        }
+    }
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Returns in apFeatures the features whose bounds intersect sAoi.
+ *
+ * As with CPLQuadTreeSearch(), features whose bounds just touch sAoi are
+ * returned.
+ */
+void CPLPackedRTree::Search(const CPLRectObj &sAoi,
+                            std::vector<void *> &apFeatures) const
+{
+    CPLAssert(m_bBuilt);
+    apFeatures.clear();
+    Visit(sAoi,
+          [&apFeatures](void *pFeature)
+          {
+              apFeatures.push_back(pFeature);
+              return true;
+          });
+}
+
+/************************************************************************/
+/*                              HasMatch()                              */
+/************************************************************************/
+
+/** Returns whether at least one feature intersects sAoi. */
+bool CPLPackedRTree::HasMatch(const CPLRectObj &sAoi) const
+{
+    CPLAssert(m_bBuilt);
+    return !Visit(sAoi, [](void *) { return false; });
+}
+
+//! @endcond
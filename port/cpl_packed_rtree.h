@@ -0,0 +1,155 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Bulk-loaded packed Hilbert R-tree
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_PACKED_RTREE_H_INCLUDED
+#define CPL_PACKED_RTREE_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_quad_tree.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * \file cpl_packed_rtree.h
+ *
+ * Static spatial index, bulk-loaded once all features are known.
+ *
+ * Features are sorted along a Hilbert curve, and packed into nodes of a
+ * fixed capacity stored level by level in flat arrays, with a
+ * structure-of-arrays layout that lets compilers vectorize the intersection
+ * tests of the children of a node. This is much more cache friendly than
+ * CPLQuadTree for indices that are built once and queried many times, but
+ * features cannot be added or removed once the tree is built.
+ *
+ * Search results are returned in an unspecified order.
+ *
+ * @since GDAL 3.12
+ */
+
+#if defined(__cplusplus) && !defined(CPL_SUPPRESS_CPLUSPLUS)
+
+//! @cond Doxygen_Suppress
+
+class CPL_DLL CPLPackedRTree
+{
+  public:
+    /** Default number of children per node */
+    static constexpr int DEFAULT_NODE_SIZE = 16;
+    /** Maximum number of children per node */
+    static constexpr int MAX_NODE_SIZE = 64;
+
+    explicit CPLPackedRTree(int nNodeSize = DEFAULT_NODE_SIZE);
+
+    void Reserve(size_t nFeatureCount);
+    void Insert(void *pFeature, const CPLRectObj &sBounds);
+    void Build();
+
+    /** Returns whether Build() has been called */
+    bool IsBuilt() const
+    {
+        return m_bBuilt;
+    }
+
+    /** Returns the number of indexed features */
+    size_t GetFeatureCount() const
+    {
+        return m_bBuilt ? m_apFeatures.size() : m_aoPending.size();
+    }
+
+    void Search(const CPLRectObj &sAoi, std::vector<void *> &apFeatures) const;
+    bool HasMatch(const CPLRectObj &sAoi) const;
+
+    /** Calls visitor(pFeature) for each feature whose bounds intersect
+     * sAoi, until it returns false. Returns false if the visit has been
+     * interrupted.
+     */
+    template <class Visitor>
+    bool Visit(const CPLRectObj &sAoi, Visitor &&visitor) const
+    {
+        if (m_adfMinX.empty())
+            return true;
+        const int nTopLevel = static_cast<int>(m_anLevelStart.size()) - 2;
+        return VisitNodes(sAoi, visitor, nTopLevel, m_anLevelStart[nTopLevel],
+                          m_anLevelStart[nTopLevel + 1]);
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(CPLPackedRTree)
+
+    struct PendingFeature
+    {
+        CPLRectObj sBounds;
+        void *pFeature;
+    };
+
+    int m_nNodeSize;
+    bool m_bBuilt = false;
+    std::vector<PendingFeature> m_aoPending{};
+
+    // Index of the first node of each level in the following arrays, with
+    // level 0 being the leaves. The last value is the total number of nodes.
+    std::vector<size_t> m_anLevelStart{};
+    std::vector<double> m_adfMinX{};
+    std::vector<double> m_adfMinY{};
+    std::vector<double> m_adfMaxX{};
+    std::vector<double> m_adfMaxY{};
+    std::vector<void *> m_apFeatures{};
+
+    template <class Visitor>
+    bool VisitNodes(const CPLRectObj &sAoi, Visitor &visitor, int nLevel,
+                    size_t nBegin, size_t nEnd) const
+    {
+        // Written without branches so that it can be vectorized
+        bool abHit[MAX_NODE_SIZE];
+        const size_t nCount = nEnd - nBegin;
+        const double *padfMinX = m_adfMinX.data() + nBegin;
+        const double *padfMinY = m_adfMinY.data() + nBegin;
+        const double *padfMaxX = m_adfMaxX.data() + nBegin;
+        const double *padfMaxY = m_adfMaxY.data() + nBegin;
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            abHit[i] = (padfMinX[i] <= sAoi.maxx) & (padfMaxX[i] >= sAoi.minx) &
+                       (padfMinY[i] <= sAoi.maxy) & (padfMaxY[i] >= sAoi.miny);
+        }
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            if (!abHit[i])
+                continue;
+            if (nLevel == 0)
+            {
+                if (!visitor(m_apFeatures[nBegin + i]))
+                    return false;
+            }
+            else
+            {
+                const size_t nChildBegin =
+                    m_anLevelStart[nLevel - 1] +
+                    (nBegin + i - m_anLevelStart[nLevel]) * m_nNodeSize;
+                const size_t nChildEnd =
+                    std::min(nChildBegin + m_nNodeSize, m_anLevelStart[nLevel]);
+                if (!VisitNodes(sAoi, visitor, nLevel - 1, nChildBegin,
+                                nChildEnd))
+                    return false;
+            }
+        }
+        return true;
+    }
+};
+
+//! @endcond
+
+#endif /* defined(__cplusplus) && !defined(CPL_SUPPRESS_CPLUSPLUS) */
+
+#endif /* CPL_PACKED_RTREE_H_INCLUDED */
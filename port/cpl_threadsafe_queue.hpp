@@ -13,9 +13,15 @@
 #ifndef CPL_THREADSAFE_QUEUE_INCLUDED
 #define CPL_THREADSAFE_QUEUE_INCLUDED
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <utility>
 
 namespace cpl
 {
@@ -75,6 +81,205 @@ template <class T> class ThreadSafeQueue
     }
 };
 
+/** Bounded multi-producer multi-consumer lock-free queue.
+ *
+ * This is Dmitry Vyukov's array based queue: each cell of a ring buffer
+ * holds a sequence number that tells producers and consumers whether it is
+ * ready to be written or read, so that they only contend on an atomic
+ * increment of the enqueue or dequeue position.
+ *
+ * Contrary to ThreadSafeQueue, the capacity is fixed. try_push() and
+ * try_pop() never block. push() and pop() wait, with a backoff that goes
+ * from spinning to yielding and then to short sleeps, which makes this
+ * queue suitable for high rates of short-lived hand-offs between threads,
+ * but not for consumers that can be idle for long periods.
+ *
+ * T must be default constructible and move assignable.
+ */
+template <class T> class LockFreeBoundedQueue
+{
+  private:
+    struct Cell
+    {
+        std::atomic<size_t> nSequence{0};
+        T value{};
+    };
+
+    // Avoid false sharing between producers and consumers
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    std::unique_ptr<Cell[]> m_cells;
+    const size_t m_nMask;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_nEnqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_nDequeuePos{0};
+
+    static size_t RoundUpToPowerOfTwo(size_t nVal)
+    {
+        size_t nRet = 2;
+        while (nRet < nVal)
+            nRet <<= 1;
+        return nRet;
+    }
+
+    /** Waits a bit more at each call */
+    class Backoff
+    {
+        int m_nIter = 0;
+
+      public:
+        void wait()
+        {
+            if (m_nIter < 64)
+            {
+                // busy spin
+            }
+            else if (m_nIter < 1024)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            if (m_nIter < 1024)
+                ++m_nIter;
+        }
+    };
+
+    template <class U> bool try_push_internal(U &&value)
+    {
+        size_t nPos = m_nEnqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = m_cells[nPos & m_nMask];
+            const size_t nSeq = cell.nSequence.load(std::memory_order_acquire);
+            const auto nDiff = static_cast<std::ptrdiff_t>(nSeq - nPos);
+            if (nDiff == 0)
+            {
+                if (m_nEnqueuePos.compare_exchange_weak(
+                        nPos, nPos + 1, std::memory_order_relaxed))
+                {
+                    cell.value = std::forward<U>(value);
+                    cell.nSequence.store(nPos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (nDiff < 0)
+            {
+                return false;  // full
+            }
+            else
+            {
+                nPos = m_nEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    LockFreeBoundedQueue(const LockFreeBoundedQueue &) = delete;
+    LockFreeBoundedQueue &operator=(const LockFreeBoundedQueue &) = delete;
+
+  public:
+    /** Constructor. The capacity is rounded up to a power of two, and
+     * is at least 2. */
+    explicit LockFreeBoundedQueue(size_t nCapacity)
+        : m_cells(new Cell[RoundUpToPowerOfTwo(nCapacity)]),
+          m_nMask(RoundUpToPowerOfTwo(nCapacity) - 1)
+    {
+        for (size_t i = 0; i <= m_nMask; ++i)
+            m_cells[i].nSequence.store(i, std::memory_order_relaxed);
+    }
+
+    /** Returns the maximum number of elements of the queue */
+    size_t capacity() const
+    {
+        return m_nMask + 1;
+    }
+
+    /** Returns the number of elements of the queue. Only approximate when
+     * other threads modify the queue concurrently. */
+    size_t size_approx() const
+    {
+        const size_t nEnqueuePos =
+            m_nEnqueuePos.load(std::memory_order_relaxed);
+        const size_t nDequeuePos =
+            m_nDequeuePos.load(std::memory_order_relaxed);
+        return nEnqueuePos > nDequeuePos ? nEnqueuePos - nDequeuePos : 0;
+    }
+
+    /** Adds an element if the queue is not full. Returns whether it has
+     * been added. */
+    bool try_push(const T &value)
+    {
+        return try_push_internal(value);
+    }
+
+    /** Adds an element if the queue is not full. Returns whether it has
+     * been added, in which case value has been moved from. */
+    bool try_push(T &&value)
+    {
+        return try_push_internal(std::move(value));
+    }
+
+    /** Adds an element, waiting for room if the queue is full */
+    void push(T &&value)
+    {
+        Backoff oBackoff;
+        while (!try_push_internal(std::move(value)))
+            oBackoff.wait();
+    }
+
+    /** Adds an element, waiting for room if the queue is full */
+    void push(const T &value)
+    {
+        Backoff oBackoff;
+        while (!try_push_internal(value))
+            oBackoff.wait();
+    }
+
+    /** Removes the oldest element into value, if the queue is not empty.
+     * Returns whether an element has been removed. */
+    bool try_pop(T &value)
+    {
+        size_t nPos = m_nDequeuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = m_cells[nPos & m_nMask];
+            const size_t nSeq = cell.nSequence.load(std::memory_order_acquire);
+            const auto nDiff = static_cast<std::ptrdiff_t>(nSeq - (nPos + 1));
+            if (nDiff == 0)
+            {
+                if (m_nDequeuePos.compare_exchange_weak(
+                        nPos, nPos + 1, std::memory_order_relaxed))
+                {
+                    value = std::move(cell.value);
+                    cell.nSequence.store(nPos + m_nMask + 1,
+                                         std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (nDiff < 0)
+            {
+                return false;  // empty
+            }
+            else
+            {
+                nPos = m_nDequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /** Removes and returns the oldest element, waiting for one if the queue
+     * is empty */
+    T pop()
+    {
+        T value{};
+        Backoff oBackoff;
+        while (!try_pop(value))
+            oBackoff.wait();
+        return value;
+    }
+};
+
 }  // namespace cpl
 
 #endif  // CPL_THREADSAFE_QUEUE_INCLUDED
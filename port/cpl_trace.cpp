@@ -0,0 +1,420 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing of hot code paths and performance counters
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_trace.h"
+
+#include "cpl_conv.h"
+#include "cpl_json_streaming_writer.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                          CPLTraceEvent                               */
+/************************************************************************/
+
+struct CPLTraceEvent
+{
+    const char *pszName;
+    GIntBig nStart;
+    GIntBig nEnd;
+};
+
+/************************************************************************/
+/*                       CPLTraceThreadBuffer                           */
+/************************************************************************/
+
+/** Events recorded by a given thread. The mutex is only contended while
+ * events are exported or reset. */
+struct CPLTraceThreadBuffer
+{
+    std::mutex oMutex{};
+    GIntBig nThreadId = 0;
+    std::vector<CPLTraceEvent> aoEvents{};
+};
+
+/************************************************************************/
+/*                           CPLTraceState                              */
+/************************************************************************/
+
+struct CPLTraceState
+{
+    /** -1: to be determined from CPL_TRACE_ENABLED, 0: disabled, 1: enabled */
+    std::atomic<int> nEnabled{-1};
+
+    /** Serializes the determination of nEnabled, and protects osTraceFile */
+    std::mutex oInitMutex{};
+
+    /** Value of CPL_TRACE_FILE when tracing was enabled. Captured then, as
+     * configuration options may have been freed when it is written. */
+    std::string osTraceFile{};
+
+    std::once_flag oAtExitRegistered{};
+
+    std::atomic<GIntBig> anCounters[CPL_TRACE_COUNTER_COUNT]{};
+
+    /** Protects aoBuffers */
+    std::mutex oMutex{};
+
+    /** Buffers of all threads that have recorded events. Buffers of threads
+     * that have terminated are kept so that their events can be exported. */
+    std::vector<std::shared_ptr<CPLTraceThreadBuffer>> aoBuffers{};
+
+    /** Maximum number of events recorded, over all threads */
+    std::atomic<GIntBig> nMaxEvents{0};
+    std::atomic<GIntBig> nEventCount{0};
+    std::atomic<GIntBig> nDroppedEvents{0};
+
+    const std::chrono::steady_clock::time_point oEpoch =
+        std::chrono::steady_clock::now();
+};
+
+static CPLTraceState &GetState()
+{
+    static CPLTraceState oState;
+    return oState;
+}
+
+thread_local std::shared_ptr<CPLTraceThreadBuffer> tl_poBuffer{};
+
+constexpr const char *const apszCounterNames[] = {
+    "vsi_read_calls",
+    "vsi_bytes_read",
+    "network_bytes_downloaded",
+    "block_cache_hits",
+    "block_cache_misses",
+    "blocks_read",
+    "blocks_written",
+    "warp_chunks",
+};
+
+static_assert(CPL_ARRAYSIZE(apszCounterNames) == CPL_TRACE_COUNTER_COUNT,
+              "apszCounterNames and CPLTraceCounter are inconsistent");
+
+}  // namespace
+
+/************************************************************************/
+/*                          WriteChromeTrace()                          */
+/************************************************************************/
+
+static void WriteChromeTrace()
+{
+    auto &oState = GetState();
+    std::string osFilename;
+    {
+        std::lock_guard oLock(oState.oInitMutex);
+        osFilename = oState.osTraceFile;
+    }
+    if (osFilename.empty())
+        return;
+    char *pszJSON = CPLTraceGetEventsAsChromeTraceJSON(nullptr);
+    // Use stdio rather than VSI, as this runs at process termination
+    FILE *f = fopen(osFilename.c_str(), "wb");
+    if (f)
+    {
+        fwrite(pszJSON, 1, strlen(pszJSON), f);
+        fclose(f);
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osFilename.c_str());
+    }
+    CPLFree(pszJSON);
+}
+
+/************************************************************************/
+/*                         CPLTraceIsEnabled()                          */
+/************************************************************************/
+
+/**
+ * \brief Return whether tracing is enabled.
+ *
+ * Tracing is enabled when the CPL_TRACE_ENABLED configuration option is set
+ * to YES, or when the CPL_TRACE_FILE configuration option is set to the name
+ * of a file where a Chrome trace (viewable with chrome://tracing or
+ * https://ui.perfetto.dev) is written at process termination.
+ *
+ * For efficiency, those configuration options are read only once, until
+ * CPLTraceReset() is called.
+ *
+ * The maximum number of recorded spans, over all threads, can be set with
+ * the CPL_TRACE_MAX_EVENTS configuration option (default is 1000000).
+ * Performance counters are not subject to that limit.
+ *
+ * @since GDAL 3.12
+ */
+int CPLTraceIsEnabled(void)
+{
+    auto &oState = GetState();
+    int nEnabled = oState.nEnabled.load(std::memory_order_relaxed);
+    if (CPL_UNLIKELY(nEnabled < 0))
+    {
+        std::lock_guard oLock(oState.oInitMutex);
+        nEnabled = oState.nEnabled.load();
+        if (nEnabled < 0)
+        {
+            const char *pszFilename =
+                CPLGetConfigOption("CPL_TRACE_FILE", nullptr);
+            nEnabled =
+                (pszFilename != nullptr ||
+                 CPLTestBool(CPLGetConfigOption("CPL_TRACE_ENABLED", "NO")))
+                    ? TRUE
+                    : FALSE;
+            oState.nMaxEvents = std::max<GIntBig>(
+                0, CPLAtoGIntBig(
+                       CPLGetConfigOption("CPL_TRACE_MAX_EVENTS", "1000000")));
+            oState.osTraceFile = pszFilename ? pszFilename : "";
+            if (pszFilename)
+            {
+                std::call_once(oState.oAtExitRegistered,
+                               []() { atexit(WriteChromeTrace); });
+            }
+            oState.nEnabled = nEnabled;
+        }
+    }
+    return nEnabled;
+}
+
+/************************************************************************/
+/*                            CPLTraceReset()                           */
+/************************************************************************/
+
+/**
+ * \brief Clear recorded spans and counters.
+ *
+ * The effect of the CPL_TRACE_ENABLED configuration option will also be
+ * reset. That is, the next traced operation will check its value again.
+ *
+ * @since GDAL 3.12
+ */
+void CPLTraceReset(void)
+{
+    auto &oState = GetState();
+    std::lock_guard oLock(oState.oMutex);
+    for (auto &nCounter : oState.anCounters)
+        nCounter = 0;
+    for (auto &poBuffer : oState.aoBuffers)
+    {
+        std::lock_guard oLockBuffer(poBuffer->oMutex);
+        poBuffer->aoEvents.clear();
+    }
+    oState.nEventCount = 0;
+    oState.nDroppedEvents = 0;
+    oState.nEnabled = -1;
+}
+
+/************************************************************************/
+/*                         CPLTraceGetCounter()                         */
+/************************************************************************/
+
+/**
+ * \brief Return the value of a performance counter.
+ *
+ * Counters are only updated when tracing is enabled (see CPLTraceIsEnabled())
+ *
+ * @since GDAL 3.12
+ */
+GIntBig CPLTraceGetCounter(CPLTraceCounter eCounter)
+{
+    if (eCounter < 0 || eCounter >= CPL_TRACE_COUNTER_COUNT)
+        return 0;
+    return GetState().anCounters[eCounter].load(std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                         CPLTraceCounterAdd()                         */
+/************************************************************************/
+
+/**
+ * \brief Increment a performance counter, if tracing is enabled.
+ *
+ * @since GDAL 3.12
+ */
+void CPLTraceCounterAdd(CPLTraceCounter eCounter, GIntBig nValue)
+{
+    if (!CPLTraceIsEnabled() || eCounter < 0 ||
+        eCounter >= CPL_TRACE_COUNTER_COUNT)
+        return;
+    GetState().anCounters[eCounter].fetch_add(nValue,
+                                              std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                        CPLTraceGetTimestamp()                        */
+/************************************************************************/
+
+/** Return the number of microseconds elapsed since the initialization of
+ * the tracing subsystem. */
+GIntBig CPLTraceGetTimestamp(void)
+{
+    return static_cast<GIntBig>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - GetState().oEpoch)
+            .count());
+}
+
+/************************************************************************/
+/*                         CPLTraceRecordSpan()                         */
+/************************************************************************/
+
+/** Record a span for the current thread. pszName must point to a string
+ * that lives until the process terminates. */
+void CPLTraceRecordSpan(const char *pszName, GIntBig nStartMicroSec,
+                        GIntBig nEndMicroSec)
+{
+    auto &oState = GetState();
+    if (oState.nEventCount.fetch_add(1, std::memory_order_relaxed) >=
+        oState.nMaxEvents)
+    {
+        oState.nEventCount.fetch_sub(1, std::memory_order_relaxed);
+        oState.nDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (!tl_poBuffer)
+    {
+        auto poBuffer = std::make_shared<CPLTraceThreadBuffer>();
+        poBuffer->nThreadId = CPLGetPID();
+        {
+            std::lock_guard oLock(oState.oMutex);
+            oState.aoBuffers.push_back(poBuffer);
+        }
+        tl_poBuffer = std::move(poBuffer);
+    }
+
+    std::lock_guard oLock(tl_poBuffer->oMutex);
+    tl_poBuffer->aoEvents.push_back({pszName, nStartMicroSec, nEndMicroSec});
+}
+
+/************************************************************************/
+/*                            WriteCounters()                           */
+/************************************************************************/
+
+static void WriteCounters(CPLJSonStreamingWriter &oWriter)
+{
+    auto &oState = GetState();
+    auto oObj = oWriter.MakeObjectContext();
+    for (int i = 0; i < CPL_TRACE_COUNTER_COUNT; ++i)
+    {
+        oWriter.AddObjKey(apszCounterNames[i]);
+        oWriter.Add(static_cast<std::int64_t>(
+            oState.anCounters[i].load(std::memory_order_relaxed)));
+    }
+    oWriter.AddObjKey("dropped_events");
+    oWriter.Add(static_cast<std::int64_t>(oState.nDroppedEvents.load()));
+}
+
+/************************************************************************/
+/*                 CPLTraceGetCountersAsSerializedJSON()                */
+/************************************************************************/
+
+/**
+ * \brief Return performance counters, as a JSON serialized object.
+ *
+ * Example of output:
+ * \code{.js}
+ * {
+ *   "vsi_read_calls":124,
+ *   "vsi_bytes_read":1048576,
+ *   "network_bytes_downloaded":0,
+ *   "block_cache_hits":12,
+ *   "block_cache_misses":64,
+ *   "blocks_read":64,
+ *   "blocks_written":0,
+ *   "warp_chunks":0,
+ *   "dropped_events":0
+ * }
+ * \endcode
+ *
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.12
+ */
+char *CPLTraceGetCountersAsSerializedJSON(CSLConstList papszOptions)
+{
+    CPL_IGNORE_RET_VAL(papszOptions);
+    CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+    WriteCounters(oWriter);
+    return CPLStrdup(oWriter.GetString().c_str());
+}
+
+/************************************************************************/
+/*                 CPLTraceGetEventsAsChromeTraceJSON()                 */
+/************************************************************************/
+
+/**
+ * \brief Return the recorded spans, in the Chrome trace event format.
+ *
+ * The output can be loaded in chrome://tracing or https://ui.perfetto.dev.
+ * Each span is a complete ("X") event, with the thread id as "tid" and
+ * timestamps in microseconds. Performance counters are reported in the
+ * "otherData" member.
+ *
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.12
+ */
+char *CPLTraceGetEventsAsChromeTraceJSON(CSLConstList papszOptions)
+{
+    CPL_IGNORE_RET_VAL(papszOptions);
+    auto &oState = GetState();
+    CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+    oWriter.SetPrettyFormatting(false);
+    {
+        auto oObj = oWriter.MakeObjectContext();
+        oWriter.AddObjKey("traceEvents");
+        {
+            auto oArray = oWriter.MakeArrayContext();
+            std::lock_guard oLock(oState.oMutex);
+            for (const auto &poBuffer : oState.aoBuffers)
+            {
+                std::lock_guard oLockBuffer(poBuffer->oMutex);
+                for (const auto &sEvent : poBuffer->aoEvents)
+                {
+                    auto oEventObj = oWriter.MakeObjectContext();
+                    oWriter.AddObjKey("name");
+                    oWriter.Add(sEvent.pszName);
+                    oWriter.AddObjKey("cat");
+                    oWriter.Add("gdal");
+                    oWriter.AddObjKey("ph");
+                    oWriter.Add("X");
+                    oWriter.AddObjKey("ts");
+                    oWriter.Add(static_cast<std::int64_t>(sEvent.nStart));
+                    oWriter.AddObjKey("dur");
+                    oWriter.Add(
+                        static_cast<std::int64_t>(sEvent.nEnd - sEvent.nStart));
+                    oWriter.AddObjKey("pid");
+                    oWriter.Add(1);
+                    oWriter.AddObjKey("tid");
+                    oWriter.Add(static_cast<std::int64_t>(poBuffer->nThreadId));
+                }
+            }
+        }
+        oWriter.AddObjKey("displayTimeUnit");
+        oWriter.Add("ms");
+        oWriter.AddObjKey("otherData");
+        WriteCounters(oWriter);
+    }
+    return CPLStrdup(oWriter.GetString().c_str());
+}
@@ -0,0 +1,110 @@
+/**********************************************************************
+ *
+ * Name:     cpl_trace.h
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing of hot code paths and performance counters
+ * Author:   Even Rouault, <even dot rouault at spatialys.com>
+ *
+ **********************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_TRACE_H_INCLUDED
+#define CPL_TRACE_H_INCLUDED
+
+#include "cpl_port.h"
+
+/**
+ * \file cpl_trace.h
+ *
+ * Tracing of hot code paths (raster I/O, block reading, file reads, warping)
+ * as timed spans, and aggregate performance counters.
+ *
+ * Collection is enabled by setting the CPL_TRACE_ENABLED configuration
+ * option to YES before the first traced operation. When it is disabled,
+ * the cost of an instrumented code path is a single test of a cached flag.
+ *
+ * @since GDAL 3.12
+ */
+
+CPL_C_START
+
+/** Performance counters collected when tracing is enabled.
+ * @since GDAL 3.12
+ */
+typedef enum
+{
+    /** Number of VSIFReadL() and VSIFReadMultiRangeL() calls */
+    CPL_TRACE_COUNTER_VSI_READ_CALLS = 0,
+    /** Number of bytes read through VSIFReadL() and VSIFReadMultiRangeL() */
+    CPL_TRACE_COUNTER_VSI_BYTES_READ = 1,
+    /** Number of bytes downloaded by network file systems (/vsicurl/ etc.) */
+    CPL_TRACE_COUNTER_NETWORK_BYTES_DOWNLOADED = 2,
+    /** Number of raster blocks found in the block cache */
+    CPL_TRACE_COUNTER_BLOCK_CACHE_HITS = 3,
+    /** Number of raster blocks not found in the block cache */
+    CPL_TRACE_COUNTER_BLOCK_CACHE_MISSES = 4,
+    /** Number of raster blocks read (and decoded) by drivers */
+    CPL_TRACE_COUNTER_BLOCKS_READ = 5,
+    /** Number of raster blocks written (and encoded) by drivers */
+    CPL_TRACE_COUNTER_BLOCKS_WRITTEN = 6,
+    /** Number of chunks processed by the warping engine */
+    CPL_TRACE_COUNTER_WARP_CHUNKS = 7,
+    /** Number of counters. Not a counter itself. */
+    CPL_TRACE_COUNTER_COUNT = 8
+} CPLTraceCounter;
+
+int CPL_DLL CPLTraceIsEnabled(void);
+void CPL_DLL CPLTraceReset(void);
+
+GIntBig CPL_DLL CPLTraceGetCounter(CPLTraceCounter eCounter);
+void CPL_DLL CPLTraceCounterAdd(CPLTraceCounter eCounter, GIntBig nValue);
+
+char CPL_DLL *CPLTraceGetCountersAsSerializedJSON(CSLConstList papszOptions);
+char CPL_DLL *CPLTraceGetEventsAsChromeTraceJSON(CSLConstList papszOptions);
+
+/*! @cond Doxygen_Suppress */
+void CPL_DLL CPLTraceRecordSpan(const char *pszName, GIntBig nStartMicroSec,
+                                GIntBig nEndMicroSec);
+GIntBig CPL_DLL CPLTraceGetTimestamp(void);
+/*! @endcond */
+
+CPL_C_END
+
+#if defined(__cplusplus) && !defined(CPL_SUPPRESS_CPLUSPLUS)
+
+/** Scoped timer that records a span in the trace when tracing is enabled.
+ *
+ * pszName must point to a string that lives until the process terminates,
+ * typically a string literal.
+ *
+ * @since GDAL 3.12
+ */
+class CPL_DLL CPLTraceScope
+{
+    const char *const m_pszName;
+    GIntBig m_nStart = -1;
+
+    CPL_DISALLOW_COPY_ASSIGN(CPLTraceScope)
+
+  public:
+    /** Constructor */
+    explicit CPLTraceScope(const char *pszName) : m_pszName(pszName)
+    {
+        if (CPLTraceIsEnabled())
+            m_nStart = CPLTraceGetTimestamp();
+    }
+
+    /** Destructor */
+    ~CPLTraceScope()
+    {
+        if (m_nStart >= 0)
+            CPLTraceRecordSpan(m_pszName, m_nStart, CPLTraceGetTimestamp());
+    }
+};
+
+#endif /* defined(__cplusplus) && !defined(CPL_SUPPRESS_CPLUSPLUS) */
+
+#endif /* CPL_TRACE_H_INCLUDED */
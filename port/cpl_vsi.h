@@ -297,6 +297,7 @@ void CPL_DLL *VSIMallocAligned(size_t nAlignment,
                                size_t nSize) CPL_WARN_UNUSED_RESULT;
 void CPL_DLL *VSIMallocAlignedAuto(size_t nSize) CPL_WARN_UNUSED_RESULT;
 void CPL_DLL VSIFreeAligned(void *ptr);
+void CPL_DLL VSIAdviseHugePages(void *ptr, size_t nSize);
 
 void CPL_DLL *VSIMallocAlignedAutoVerbose(size_t nSize, const char *pszFile,
                                           int nLine) CPL_WARN_UNUSED_RESULT;
@@ -454,6 +455,11 @@ int CPL_DLL VSISync(const char *pszSource, const char *pszTarget,
                     GDALProgressFunc pProgressFunc, void *pProgressData,
                     char ***ppapszOutputs);
 
+int CPL_DLL VSIGZipBuildIndex(const char *pszFilename,
+                              const char *const *papszOptions,
+                              GDALProgressFunc pProgressFunc,
+                              void *pProgressData);
+
 int CPL_DLL VSIMultipartUploadGetCapabilities(
     const char *pszFilename, int *pbNonSequentialUploadSupported,
     int *pbParallelUploadSupported, int *pbAbortSupported,
@@ -483,6 +489,8 @@ GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
 
 void CPL_DLL VSINetworkStatsReset(void);
 char CPL_DLL *VSINetworkStatsGetAsSerializedJSON(char **papszOptions);
+void CPL_DLL VSINetworkStatsBeginScope(void);
+char CPL_DLL *VSINetworkStatsEndScope(CSLConstList papszOptions);
 
 /* ==================================================================== */
 /*      Install special file access handlers.                           */
@@ -511,6 +519,8 @@ void VSIInstall7zFileHandler(void);   /* No reason to export that */
 void VSIInstallRarFileHandler(void);  /* No reason to export that */
 void VSIInstallGZipFileHandler(void); /* No reason to export that */
 void VSIInstallZipFileHandler(void);  /* No reason to export that */
+void VSIInstallZstdFileHandler(void); /* No reason to export that */
+void VSIInstallLZ4FileHandler(void);  /* No reason to export that */
 void VSIInstallStdinHandler(void);    /* No reason to export that */
 void VSIInstallHdfsHandler(void);     /* No reason to export that */
 void VSIInstallWebHdfsHandler(void);  /* No reason to export that */
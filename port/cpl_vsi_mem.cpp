@@ -180,6 +180,9 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    const void *GetReadOnlyPointer(vsi_l_offset nOffset,
+                                   size_t nSize) override;
 };
 
 /************************************************************************/
@@ -503,6 +506,26 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
     return 0;
 }
 
+/************************************************************************/
+/*                        GetReadOnlyPointer()                          */
+/************************************************************************/
+
+const void *VSIMemHandle::GetReadOnlyPointer(vsi_l_offset nOffset,
+                                             size_t nSize)
+{
+    if (!m_bReadAllowed)
+        return nullptr;
+
+    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
+
+    if (nOffset > poFile->nLength || nSize > poFile->nLength - nOffset ||
+        poFile->pabyData == nullptr)
+    {
+        return nullptr;
+    }
+    return poFile->pabyData + static_cast<size_t>(nOffset);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -124,6 +125,29 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    /** Return a read-only pointer to the nSize bytes of the file starting at
+     * nOffset, without copying them.
+     *
+     * This is implemented for /vsimem/ files, and for local files opened in
+     * read-only mode on POSIX systems, where the file is memory-mapped.
+     * Callers must fall back to Read() or PRead() when it returns nullptr.
+     *
+     * The pointer remains valid until the handle is closed, as long as the
+     * file is not modified (or truncated) in the meantime. The file position
+     * is not changed, and there is no alignment guarantee.
+     *
+     * @param nOffset Start offset of the range.
+     * @param nSize Size of the range (in bytes).
+     * @return a pointer, or nullptr if not supported or if the range is not
+     * fully within the file.
+     * @since GDAL 3.12
+     */
+    virtual const void *GetReadOnlyPointer(CPL_UNUSED vsi_l_offset nOffset,
+                                           CPL_UNUSED size_t nSize)
+    {
+        return nullptr;
+    }
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -457,6 +481,8 @@ class VSIArchiveContent
     vsi_l_offset nFileSize = 0;
     int nEntries = 0;
     VSIArchiveEntry *entries = nullptr;
+    //! Map from the file name of an entry to its index in entries
+    std::unordered_map<std::string, int> oMapFileNameToIdx{};
 
     ~VSIArchiveContent();
 };
@@ -512,6 +538,15 @@ class VSIArchiveFilesystemHandler : public VSIFilesystemHandler
                                   const char *fileInArchiveName,
                                   const VSIArchiveEntry **archiveEntry);
 
+    /** Returns a single-word textual representation of pOffset, or an
+     * empty string if the listing of archives cannot be persisted in the
+     * CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR directory. */
+    virtual std::string
+    SerializeFileOffset(const VSIArchiveEntryFileOffset *pOffset);
+    /** Reverse operation of SerializeFileOffset() */
+    virtual VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const char *pszSerialized);
+
     virtual bool IsLocal(const char *pszPath) override;
 
     virtual bool
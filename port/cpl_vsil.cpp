@@ -25,12 +25,14 @@
 #endif
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -38,6 +40,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
 
@@ -532,6 +535,12 @@ char **CPLReadDir(const char *pszPath)
  *     only the pszName and nMode members of VSIDIR are guaranteed to be set.
  *     This is implemented efficiently for the Unix virtual file system.
  * </li>
+ * <li>NUM_THREADS=integer|ALL_CPUS: (GDAL >= 3.12) Number of threads used
+ *     to list sub-directories concurrently, when nRecurseDepth < 0. Only
+ *     implemented for /vsis3/, /vsigs/, /vsioss/, /vsiaz/ and /vsiadls/.
+ *     Defaults to the value of the CPL_VSIL_LIST_NUM_THREADS configuration
+ *     option, or 1.
+ * </li>
  * </ul>
  *
  * @return a handle, or NULL in case of error
@@ -910,6 +919,16 @@ int VSIMove(const char *oldpath, const char *newpath,
  * - /vsiadls/ -> /vsiadls/
  * - any of the above or /vsicurl/ -> /vsiaz/ (starting with GDAL 3.8)
  *
+ * Starting with GDAL 3.12, the following options may be used to download
+ * network files (/vsicurl/, /vsis3/, /vsigs/, /vsiaz/, etc.) in parallel
+ * with ranged requests, when the target supports random writing (typically
+ * a local file):
+ * - NUM_THREADS=integer or ALL_CPUS: number of parallel requests. Defaults
+ *   to 1, that is a single sequential download.
+ * - CHUNK_SIZE=size in bytes, or with a memory unit suffix: size of each
+ *   request. Defaults to 8 MB. Only files larger than it are downloaded in
+ *   parallel.
+ *
  * @param pszSource Source filename. UTF-8 encoded. May be NULL if fpSource is
  * not NULL.
  * @param pszTarget Target filename.  UTF-8 encoded. Must not be NULL
@@ -2038,6 +2057,140 @@ VSIVirtualHandle *VSIFilesystemHandler::Open(const char *pszFilename,
     return Open(pszFilename, pszAccess, false, nullptr);
 }
 
+/************************************************************************/
+/*                     CopyFileParallelDownload()                       */
+/************************************************************************/
+
+// Copies fpSource into fpOut with nThreads threads, each issuing PRead()
+// requests of nChunkSize bytes. Only used on network sources with a
+// thread-safe PRead() implementation, for which a single stream, limited by
+// the latency, cannot use all the available bandwidth.
+static int CopyFileParallelDownload(const char *pszSource,
+                                    const char *pszTarget, VSILFILE *fpSource,
+                                    VSILFILE *fpOut, vsi_l_offset nSourceSize,
+                                    size_t nChunkSize, int nThreads,
+                                    const std::string &osMsg,
+                                    GDALProgressFunc pProgressFunc,
+                                    void *pProgressData)
+{
+    const vsi_l_offset nChunkCount =
+        (nSourceSize + nChunkSize - 1) / nChunkSize;
+    nThreads = static_cast<int>(
+        std::min(static_cast<vsi_l_offset>(nThreads), nChunkCount));
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    vsi_l_offset iCurChunk = 0;
+    vsi_l_offset nChunksDone = 0;
+    int nRunningThreads = nThreads;
+    bool bStop = false;
+    bool bSuccess = true;
+
+    const auto threadFunc = [pszSource, pszTarget, fpSource, fpOut,
+                             nSourceSize, nChunkSize, nChunkCount, &oMutex,
+                             &oCV, &iCurChunk, &nChunksDone, &nRunningThreads,
+                             &bStop, &bSuccess,
+                             aosTLConfigOptions = CPLStringList(
+                                 CPLGetThreadLocalConfigOptions())]()
+    {
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+
+        std::vector<GByte> abyBuffer;
+        try
+        {
+            abyBuffer.resize(nChunkSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer");
+            std::lock_guard oLock(oMutex);
+            bSuccess = false;
+            bStop = true;
+        }
+
+        while (!abyBuffer.empty())
+        {
+            vsi_l_offset iChunk;
+            {
+                std::lock_guard oLock(oMutex);
+                if (bStop || iCurChunk == nChunkCount)
+                    break;
+                iChunk = iCurChunk;
+                ++iCurChunk;
+            }
+            const vsi_l_offset nOffset = iChunk * nChunkSize;
+            const size_t nToRead = static_cast<size_t>(
+                std::min(static_cast<vsi_l_offset>(nChunkSize),
+                         nSourceSize - nOffset));
+            const size_t nRead =
+                fpSource->PRead(abyBuffer.data(), nToRead, nOffset);
+
+            std::lock_guard oLock(oMutex);
+            if (nRead != nToRead)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Copying of %s to %s failed: error while reading "
+                         "source file at offset %" PRIu64,
+                         pszSource, pszTarget, static_cast<uint64_t>(nOffset));
+                bSuccess = false;
+                bStop = true;
+                break;
+            }
+            if (fpOut->Seek(nOffset, SEEK_SET) != 0 ||
+                fpOut->Write(abyBuffer.data(), 1, nToRead) != nToRead)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Copying of %s to %s failed: error while writing into "
+                         "target file",
+                         pszSource, pszTarget);
+                bSuccess = false;
+                bStop = true;
+                break;
+            }
+            ++nChunksDone;
+            oCV.notify_one();
+        }
+
+        CPLSetThreadLocalConfigOptions(nullptr);
+
+        std::lock_guard oLock(oMutex);
+        --nRunningThreads;
+        oCV.notify_one();
+    };
+
+    std::vector<std::thread> aThreads;
+    for (int i = 0; i < nThreads; ++i)
+        aThreads.emplace_back(threadFunc);
+
+    {
+        std::unique_lock oLock(oMutex);
+        while (nRunningThreads > 0)
+        {
+            oCV.wait(oLock);
+            if (pProgressFunc && !bStop)
+            {
+                const double dfProgress =
+                    static_cast<double>(nChunksDone) / nChunkCount;
+                oLock.unlock();
+                const bool bContinue =
+                    pProgressFunc(dfProgress, osMsg.c_str(), pProgressData);
+                oLock.lock();
+                if (!bContinue)
+                {
+                    bSuccess = false;
+                    bStop = true;
+                }
+            }
+        }
+    }
+
+    for (auto &oThread : aThreads)
+        oThread.join();
+
+    return bSuccess ? 0 : -1;
+}
+
 /************************************************************************/
 /*                             CopyFile()                               */
 /************************************************************************/
@@ -2070,7 +2223,51 @@ int VSIFilesystemHandler::CopyFile(const char *pszSource, const char *pszTarget,
         }
     }
 
-    VSILFILE *fpOut = VSIFOpenEx2L(pszTarget, "wb", TRUE, papszOptions);
+    // Parallel download of network files, with ranged requests, if asked
+    // to.
+    CPLStringList aosTargetOptions(papszOptions);
+    int nThreads = 1;
+    size_t nChunkSize = 8 * 1024 * 1024;
+#ifndef CPL_MULTIPROC_STUB
+    if (const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS"))
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    }
+    if (const char *pszChunkSize =
+            CSLFetchNameValue(papszOptions, "CHUNK_SIZE"))
+    {
+        GIntBig nVal = 0;
+        if (CPLParseMemorySize(pszChunkSize, &nVal, nullptr) != CE_None ||
+            nVal <= 0 ||
+            static_cast<GUIntBig>(nVal) > std::numeric_limits<size_t>::max())
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for CHUNK_SIZE: %s", pszChunkSize);
+            return -1;
+        }
+        nChunkSize = static_cast<size_t>(nVal);
+    }
+#endif
+    aosTargetOptions.SetNameValue("NUM_THREADS", nullptr);
+    aosTargetOptions.SetNameValue("CHUNK_SIZE", nullptr);
+    bool bParallelDownload = false;
+    if (nThreads > 1 && pszSource && !VSIIsLocal(pszSource) &&
+        fpSource->HasPRead() && VSISupportsRandomWrite(pszTarget, false))
+    {
+        if (nSourceSize == static_cast<vsi_l_offset>(-1))
+        {
+            VSIStatBufL sStat;
+            if (VSIStatL(pszSource, &sStat) == 0)
+                nSourceSize = sStat.st_size;
+        }
+        bParallelDownload = nSourceSize != static_cast<vsi_l_offset>(-1) &&
+                            nSourceSize > nChunkSize;
+    }
+
+    VSILFILE *fpOut =
+        VSIFOpenEx2L(pszTarget, "wb", TRUE, aosTargetOptions.List());
     if (!fpOut)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s", pszTarget);
@@ -2083,6 +2280,18 @@ int VSIFilesystemHandler::CopyFile(const char *pszSource, const char *pszTarget,
     else
         pszSource = "(unknown filename)";
 
+    if (bParallelDownload)
+    {
+        int ret = CopyFileParallelDownload(
+            pszSource, pszTarget, fpSource, fpOut, nSourceSize, nChunkSize,
+            nThreads, osMsg, pProgressFunc, pProgressData);
+        if (VSIFCloseL(fpOut) != 0)
+            ret = -1;
+        if (ret != 0)
+            VSIUnlink(pszTarget);
+        return ret;
+    }
+
     int ret = 0;
     constexpr size_t nBufferSize = 10 * 4096;
     std::vector<GByte> abyBuffer(nBufferSize, 0);
@@ -3064,6 +3273,15 @@ int VSIFFlushL(VSILFILE *fp)
 size_t VSIFReadL(void *pBuffer, size_t nSize, size_t nCount, VSILFILE *fp)
 
 {
+    if (CPLTraceIsEnabled())
+    {
+        CPLTraceScope oTraceScope("VSIFReadL");
+        const size_t nRet = fp->Read(pBuffer, nSize, nCount);
+        CPLTraceCounterAdd(CPL_TRACE_COUNTER_VSI_READ_CALLS, 1);
+        CPLTraceCounterAdd(CPL_TRACE_COUNTER_VSI_BYTES_READ,
+                           static_cast<GIntBig>(nRet * nSize));
+        return nRet;
+    }
     return fp->Read(pBuffer, nSize, nCount);
 }
 
@@ -3123,6 +3341,21 @@ int VSIFReadMultiRangeL(int nRanges, void **ppData,
                         const vsi_l_offset *panOffsets, const size_t *panSizes,
                         VSILFILE *fp)
 {
+    if (CPLTraceIsEnabled())
+    {
+        CPLTraceScope oTraceScope("VSIFReadMultiRangeL");
+        const int nRet =
+            fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+        if (nRet == 0)
+        {
+            GIntBig nTotal = 0;
+            for (int i = 0; i < nRanges; ++i)
+                nTotal += static_cast<GIntBig>(panSizes[i]);
+            CPLTraceCounterAdd(CPL_TRACE_COUNTER_VSI_BYTES_READ, nTotal);
+        }
+        CPLTraceCounterAdd(CPL_TRACE_COUNTER_VSI_READ_CALLS, 1);
+        return nRet;
+    }
     return fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
 }
 
@@ -4105,6 +4338,8 @@ VSIFileManager *VSIFileManager::Get()
     VSIInstallGZipFileHandler();
     VSIInstallZipFileHandler();
 #endif
+    VSIInstallZstdFileHandler();
+    VSIInstallLZ4FileHandler();
 #ifdef HAVE_LIBARCHIVE
     VSIInstall7zFileHandler();
     VSIInstallRarFileHandler();
@@ -13,13 +13,15 @@
 #include "cpl_port.h"
 #include "cpl_vsi_virtual.h"
 
+#include <algorithm>
+#include <climits>
 #include <cstring>
 #if HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
 #include <ctime>
 #include <map>
-#include <set>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,6 +29,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 
@@ -130,6 +133,228 @@ static CPLString GetStrippedFilename(const CPLString &osFileName, bool &bIsDir)
     return osRet;
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+std::string VSIArchiveFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset * /* pOffset */)
+{
+    return std::string();
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *VSIArchiveFilesystemHandler::DeserializeFileOffset(
+    const char * /* pszSerialized */)
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/*                       GetIndexCacheFilename()                        */
+/************************************************************************/
+
+constexpr const char *INDEX_CACHE_SIGNATURE = "GDAL_VSIARCHIVE_INDEX 1";
+
+// Returns the name of the file where the listing of the archive is
+// persisted, or an empty string if persistence is disabled or if the
+// identity of the archive cannot be established.
+static std::string GetIndexCacheFilename(const char *pszPrefix,
+                                         const char *archiveFilename,
+                                         const VSIStatBufL &sStat)
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0' || sStat.st_mtime == 0 ||
+        strchr(archiveFilename, '\n') != nullptr)
+    {
+        return std::string();
+    }
+
+    std::string osKey(pszPrefix);
+    osKey += '\n';
+    osKey += archiveFilename;
+    osKey += CPLSPrintf("\nmtime:" CPL_FRMT_GIB "\nsize:" CPL_FRMT_GUIB,
+                        static_cast<GIntBig>(sStat.st_mtime),
+                        static_cast<GUIntBig>(sStat.st_size));
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osRet(CPLFormFilenameSafe(pszDir, pszHex, "idx"));
+    CPLFree(pszHex);
+    return osRet;
+}
+
+/************************************************************************/
+/*                         LoadIndexCache()                             */
+/************************************************************************/
+
+// Loads a listing persisted by SaveIndexCache(). The file starts with a
+// header line, followed by the archive file name and a line per entry with
+// "is_dir uncompressed_size modified_time serialized_offset file_name".
+static VSIArchiveContent *
+LoadIndexCache(VSIArchiveFilesystemHandler *poHandler,
+               const std::string &osCacheFilename, const char *archiveFilename,
+               const VSIStatBufL &sStat)
+{
+    GByte *pabyRet = nullptr;
+    vsi_l_offset nSize = 0;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (!VSIIngestFile(nullptr, osCacheFilename.c_str(), &pabyRet, &nSize,
+                           -1))
+        {
+            return nullptr;
+        }
+    }
+    const char *pszIter = reinterpret_cast<const char *>(pabyRet);
+    const char *const pszEnd = pszIter + nSize;
+
+    const auto ReadLine = [&pszIter, pszEnd](std::string &osLine)
+    {
+        const char *pszEOL = static_cast<const char *>(
+            memchr(pszIter, '\n', static_cast<size_t>(pszEnd - pszIter)));
+        if (pszEOL == nullptr)
+            return false;
+        osLine.assign(pszIter, pszEOL - pszIter);
+        pszIter = pszEOL + 1;
+        return true;
+    };
+
+    auto content = std::make_unique<VSIArchiveContent>();
+    content->mTime = sStat.st_mtime;
+    content->nFileSize = static_cast<vsi_l_offset>(sStat.st_size);
+
+    std::string osLine;
+    bool bOK = ReadLine(osLine) &&
+               osLine.compare(0, strlen(INDEX_CACHE_SIGNATURE),
+                              INDEX_CACHE_SIGNATURE) == 0;
+    GIntBig nEntries = 0;
+    if (bOK)
+    {
+        nEntries =
+            CPLAtoGIntBig(osLine.c_str() + strlen(INDEX_CACHE_SIGNATURE));
+        bOK = nEntries > 0 && nEntries < INT_MAX &&
+              ReadLine(osLine) && osLine == archiveFilename;
+    }
+    if (bOK)
+    {
+        content->entries = static_cast<VSIArchiveEntry *>(VSI_CALLOC_VERBOSE(
+            static_cast<size_t>(nEntries), sizeof(VSIArchiveEntry)));
+        bOK = content->entries != nullptr;
+    }
+    while (bOK && content->nEntries < nEntries)
+    {
+        bOK = ReadLine(osLine);
+        // Locate the start of the 5 fields. The file name is the remainder
+        // of the line, as it may contain spaces.
+        size_t anPos[5] = {0, 0, 0, 0, 0};
+        for (int i = 1; bOK && i < 5; ++i)
+        {
+            const size_t nSpacePos = osLine.find(' ', anPos[i - 1]);
+            bOK = nSpacePos != std::string::npos;
+            anPos[i] = nSpacePos + 1;
+        }
+        if (!bOK)
+            break;
+        const char *pszLine = osLine.c_str();
+        VSIArchiveEntry &entry = content->entries[content->nEntries];
+        entry.bIsDir = atoi(pszLine + anPos[0]) != 0;
+        entry.uncompressed_size =
+            static_cast<vsi_l_offset>(CPLAtoGIntBig(pszLine + anPos[1]));
+        entry.nModifiedTime = CPLAtoGIntBig(pszLine + anPos[2]);
+        const std::string osOffset(
+            osLine.substr(anPos[3], anPos[4] - anPos[3] - 1));
+        if (osOffset != "-")
+        {
+            entry.file_pos = poHandler->DeserializeFileOffset(osOffset.c_str());
+            if (entry.file_pos == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+        }
+        entry.fileName = CPLStrdup(pszLine + anPos[4]);
+        content->oMapFileNameToIdx[entry.fileName] = content->nEntries;
+        content->nEntries++;
+    }
+    VSIFree(pabyRet);
+
+    if (!bOK)
+    {
+        CPLDebug("VSIArchive", "Ignoring invalid index cache file %s",
+                 osCacheFilename.c_str());
+        return nullptr;
+    }
+    CPLDebug("VSIArchive", "Listing of %s read from %s", archiveFilename,
+             osCacheFilename.c_str());
+    return content.release();
+}
+
+/************************************************************************/
+/*                         SaveIndexCache()                             */
+/************************************************************************/
+
+static void SaveIndexCache(VSIArchiveFilesystemHandler *poHandler,
+                           const std::string &osCacheFilename,
+                           const char *archiveFilename,
+                           const VSIArchiveContent *content)
+{
+    std::string osContent(CPLSPrintf("%s %d\n%s\n", INDEX_CACHE_SIGNATURE,
+                                     content->nEntries, archiveFilename));
+    for (int i = 0; i < content->nEntries; ++i)
+    {
+        const VSIArchiveEntry &entry = content->entries[i];
+        std::string osOffset("-");
+        if (entry.file_pos)
+        {
+            osOffset = poHandler->SerializeFileOffset(entry.file_pos);
+            if (osOffset.empty())
+                return;
+        }
+        if (strchr(entry.fileName, '\n') != nullptr)
+            return;
+        osContent += CPLSPrintf("%d " CPL_FRMT_GUIB " " CPL_FRMT_GIB " ",
+                                entry.bIsDir ? 1 : 0,
+                                static_cast<GUIntBig>(entry.uncompressed_size),
+                                entry.nModifiedTime);
+        osContent += osOffset;
+        osContent += ' ';
+        osContent += entry.fileName;
+        osContent += '\n';
+    }
+
+    const std::string osDir(CPLGetPathSafe(osCacheFilename.c_str()));
+    VSIStatBufL sStat;
+    if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        VSIMkdirRecursive(osDir.c_str(), 0755);
+
+    // Write in a temporary file renamed afterwards, so that concurrent
+    // processes never see a partially written file.
+    const std::string osTmpFilename(
+        osCacheFilename +
+        CPLSPrintf(".tmp" CPL_FRMT_GIB,
+                   static_cast<GIntBig>(CPLGetPID())));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLDebug("VSIArchive", "Cannot create %s", osTmpFilename.c_str());
+        return;
+    }
+    const bool bOK =
+        VSIFWriteL(osContent.data(), 1, osContent.size(), fp) ==
+        osContent.size();
+    if (VSIFCloseL(fp) != 0 || !bOK ||
+        VSIRename(osTmpFilename.c_str(), osCacheFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                       GetContentOfArchive()                          */
 /************************************************************************/
@@ -162,6 +387,19 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
         }
     }
 
+    const std::string osCacheFilename(
+        GetIndexCacheFilename(GetPrefix(), archiveFilename, sStat));
+    if (!osCacheFilename.empty())
+    {
+        VSIArchiveContent *content =
+            LoadIndexCache(this, osCacheFilename, archiveFilename, sStat);
+        if (content)
+        {
+            oFileList[archiveFilename] = content;
+            return content;
+        }
+    }
+
     bool bMustClose = poReader == nullptr;
     if (poReader == nullptr)
     {
@@ -184,7 +422,23 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
     content->entries = nullptr;
     oFileList[archiveFilename] = content;
 
-    std::set<CPLString> oSet;
+    // Grow the array of entries geometrically, as archives may have
+    // millions of them.
+    int nEntriesAlloc = 0;
+    const auto AddEntry =
+        [content, &nEntriesAlloc](char *pszFileName) -> VSIArchiveEntry &
+    {
+        if (content->nEntries == nEntriesAlloc)
+        {
+            nEntriesAlloc = std::max(16, nEntriesAlloc + nEntriesAlloc / 2);
+            content->entries = static_cast<VSIArchiveEntry *>(CPLRealloc(
+                content->entries, sizeof(VSIArchiveEntry) * nEntriesAlloc));
+        }
+        content->oMapFileNameToIdx[pszFileName] = content->nEntries;
+        VSIArchiveEntry &entry = content->entries[content->nEntries];
+        entry.fileName = pszFileName;
+        return entry;
+    };
 
     do
     {
@@ -198,68 +452,43 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
             continue;
         }
 
-        if (oSet.find(osStrippedFilename) == oSet.end())
+        if (!cpl::contains(content->oMapFileNameToIdx, osStrippedFilename))
         {
-            oSet.insert(osStrippedFilename);
-
             // Add intermediate directory structure.
             const char *pszBegin = osStrippedFilename.c_str();
             for (const char *pszIter = pszBegin; *pszIter; pszIter++)
             {
                 if (*pszIter == '/')
                 {
-                    char *pszStrippedFileName2 = CPLStrdup(osStrippedFilename);
-                    pszStrippedFileName2[pszIter - pszBegin] = 0;
-                    if (oSet.find(pszStrippedFileName2) == oSet.end())
+                    const std::string osDirName(pszBegin, pszIter - pszBegin);
+                    if (!cpl::contains(content->oMapFileNameToIdx, osDirName))
                     {
-                        oSet.insert(pszStrippedFileName2);
-
-                        content->entries =
-                            static_cast<VSIArchiveEntry *>(CPLRealloc(
-                                content->entries, sizeof(VSIArchiveEntry) *
-                                                      (content->nEntries + 1)));
-                        content->entries[content->nEntries].fileName =
-                            pszStrippedFileName2;
-                        content->entries[content->nEntries].nModifiedTime =
-                            poReader->GetModifiedTime();
-                        content->entries[content->nEntries].uncompressed_size =
-                            0;
-                        content->entries[content->nEntries].bIsDir = TRUE;
-                        content->entries[content->nEntries].file_pos = nullptr;
+                        VSIArchiveEntry &entry =
+                            AddEntry(CPLStrdup(osDirName.c_str()));
+                        entry.nModifiedTime = poReader->GetModifiedTime();
+                        entry.uncompressed_size = 0;
+                        entry.bIsDir = TRUE;
+                        entry.file_pos = nullptr;
 #ifdef DEBUG_VERBOSE
-                        const int nEntries = content->nEntries;
                         CPLDebug("VSIArchive",
                                  "[%d] %s : " CPL_FRMT_GUIB " bytes",
-                                 content->nEntries + 1,
-                                 content->entries[nEntries].fileName,
-                                 content->entries[nEntries].uncompressed_size);
+                                 content->nEntries + 1, entry.fileName,
+                                 entry.uncompressed_size);
 #endif
                         content->nEntries++;
                     }
-                    else
-                    {
-                        CPLFree(pszStrippedFileName2);
-                    }
                 }
             }
 
-            content->entries = static_cast<VSIArchiveEntry *>(
-                CPLRealloc(content->entries,
-                           sizeof(VSIArchiveEntry) * (content->nEntries + 1)));
-            content->entries[content->nEntries].fileName =
-                CPLStrdup(osStrippedFilename);
-            content->entries[content->nEntries].nModifiedTime =
-                poReader->GetModifiedTime();
-            content->entries[content->nEntries].uncompressed_size =
-                poReader->GetFileSize();
-            content->entries[content->nEntries].bIsDir = bIsDir;
-            content->entries[content->nEntries].file_pos =
-                poReader->GetFileOffset();
+            VSIArchiveEntry &entry = AddEntry(CPLStrdup(osStrippedFilename));
+            entry.nModifiedTime = poReader->GetModifiedTime();
+            entry.uncompressed_size = poReader->GetFileSize();
+            entry.bIsDir = bIsDir;
+            entry.file_pos = poReader->GetFileOffset();
 #ifdef DEBUG_VERBOSE
             CPLDebug("VSIArchive", "[%d] %s : " CPL_FRMT_GUIB " bytes",
-                     content->nEntries + 1,
-                     content->entries[content->nEntries].fileName,
-                     content->entries[content->nEntries].uncompressed_size);
+                     content->nEntries + 1, entry.fileName,
+                     entry.uncompressed_size);
 #endif
             content->nEntries++;
         }
@@ -269,6 +498,9 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
     if (bMustClose)
         delete (poReader);
 
+    if (!osCacheFilename.empty())
+        SaveIndexCache(this, osCacheFilename, archiveFilename, content);
+
     return content;
 }
 
@@ -286,14 +518,12 @@ int VSIArchiveFilesystemHandler::FindFileInArchive(
     const VSIArchiveContent *content = GetContentOfArchive(archiveFilename);
     if (content)
     {
-        for (int i = 0; i < content->nEntries; i++)
+        const auto oIter = content->oMapFileNameToIdx.find(fileInArchiveName);
+        if (oIter != content->oMapFileNameToIdx.end())
         {
-            if (strcmp(fileInArchiveName, content->entries[i].fileName) == 0)
-            {
-                if (archiveEntry)
-                    *archiveEntry = &content->entries[i];
-                return TRUE;
-            }
+            if (archiveEntry)
+                *archiveEntry = &content->entries[oIter->second];
+            return TRUE;
         }
     }
     return FALSE;
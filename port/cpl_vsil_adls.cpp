@@ -210,8 +210,8 @@ class VSIADLSFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
     char **GetFileList(const char *pszFilename, int nMaxFiles,
                        bool bCacheEntries, bool *pbGotFileList);
 
-    VSIDIR *OpenDir(const char *pszPath, int nRecurseDepth,
-                    const char *const *papszOptions) override;
+    VSIDIR *OpenDirInternal(const char *pszPath, int nRecurseDepth,
+                            const char *const *papszOptions) override;
 
     enum class Event
     {
@@ -2080,11 +2080,12 @@ char *VSIADLSFSHandler::GetSignedURL(const char *pszFilename,
 }
 
 /************************************************************************/
-/*                            OpenDir()                                 */
+/*                          OpenDirInternal()                           */
 /************************************************************************/
 
-VSIDIR *VSIADLSFSHandler::OpenDir(const char *pszPath, int nRecurseDepth,
-                                  const char *const *papszOptions)
+VSIDIR *VSIADLSFSHandler::OpenDirInternal(const char *pszPath,
+                                          int nRecurseDepth,
+                                          const char *const *papszOptions)
 {
     if (nRecurseDepth > 0)
     {
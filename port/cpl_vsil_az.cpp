@@ -532,8 +532,8 @@ class VSIAzureFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
     char **GetFileList(const char *pszFilename, int nMaxFiles,
                        bool bCacheEntries, bool *pbGotFileList);
 
-    VSIDIR *OpenDir(const char *pszPath, int nRecurseDepth,
-                    const char *const *papszOptions) override;
+    VSIDIR *OpenDirInternal(const char *pszPath, int nRecurseDepth,
+                            const char *const *papszOptions) override;
 
     // Block list upload
     std::string PutBlock(const std::string &osFilename, int nPartNumber,
@@ -2450,11 +2450,12 @@ char *VSIAzureFSHandler::GetSignedURL(const char *pszFilename,
 }
 
 /************************************************************************/
-/*                            OpenDir()                                 */
+/*                          OpenDirInternal()                           */
 /************************************************************************/
 
-VSIDIR *VSIAzureFSHandler::OpenDir(const char *pszPath, int nRecurseDepth,
-                                   const char *const *papszOptions)
+VSIDIR *VSIAzureFSHandler::OpenDirInternal(const char *pszPath,
+                                           int nRecurseDepth,
+                                           const char *const *papszOptions)
 {
     if (nRecurseDepth > 0)
     {
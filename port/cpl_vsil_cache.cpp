@@ -104,6 +104,12 @@ class VSICachedFile final : public VSIVirtualHandle
     {
         return m_poBase->PRead(pBuffer, nSize, nOffset);
     }
+
+    const void *GetReadOnlyPointer(vsi_l_offset nOffset,
+                                   size_t nSize) override
+    {
+        return m_poBase->GetReadOnlyPointer(nOffset, nSize);
+    }
 };
 
 /************************************************************************/
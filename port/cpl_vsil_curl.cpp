@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <memory>
@@ -28,6 +30,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
@@ -78,6 +81,17 @@ char *VSINetworkStatsGetAsSerializedJSON(char ** /* papszOptions */)
     return nullptr;
 }
 
+void VSINetworkStatsBeginScope(void)
+{
+    // Not supported
+}
+
+char *VSINetworkStatsEndScope(CSLConstList /* papszOptions */)
+{
+    // Not supported
+    return nullptr;
+}
+
 /************************************************************************/
 /*                      VSICurlInstallReadCbk()                         */
 /************************************************************************/
@@ -501,6 +515,10 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
     }
 
     m_bCached = poFSIn->AllowCachedDataFor(pszFilename);
+    // Readahead relies on the cache of downloaded regions
+    m_bReadaheadEnabled =
+        m_bCached &&
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_READAHEAD", "NO"));
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
 }
 
@@ -510,6 +528,11 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
 VSICurlHandle::~VSICurlHandle()
 {
+    if (m_bReadaheadInFlight)
+    {
+        m_poReadaheadHandle->Interrupt();
+        m_poReadaheadPool->WaitCompletion();
+    }
     if (m_oThreadAdviseRead.joinable())
     {
         m_oThreadAdviseRead.join();
@@ -902,7 +925,15 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle,
     CPLHTTPRestoreSigPipeHandler(old_handler);
 
     if (hEasyHandle)
+    {
+        double dfTotalTime = 0;
+        if (curl_easy_getinfo(hEasyHandle, CURLINFO_TOTAL_TIME,
+                              &dfTotalTime) == CURLE_OK)
+        {
+            cpl::NetworkStatisticsLogger::LogLatency(dfTotalTime);
+        }
         curl_multi_remove_handle(hCurlMultiHandle, hEasyHandle);
+    }
 }
 
 /************************************************************************/
@@ -1756,17 +1787,17 @@ struct CurrentDownload
     VSICurlFilesystemHandlerBase *m_poFS = nullptr;
     std::string m_osURL{};
     vsi_l_offset m_nStartOffset = 0;
-    int m_nBlocks = 0;
+    size_t m_nSize = 0;
     std::string m_osAlreadyDownloadedData{};
     bool m_bHasAlreadyDownloadedData = false;
 
     CurrentDownload(VSICurlFilesystemHandlerBase *poFS, const char *pszURL,
                     vsi_l_offset startOffset, int nBlocks)
         : m_poFS(poFS), m_osURL(pszURL), m_nStartOffset(startOffset),
-          m_nBlocks(nBlocks)
+          m_nSize(static_cast<size_t>(nBlocks) * VSICURLGetDownloadChunkSize())
     {
-        auto res = m_poFS->NotifyStartDownloadRegion(m_osURL, m_nStartOffset,
-                                                     m_nBlocks);
+        auto res =
+            m_poFS->NotifyStartDownloadRegion(m_osURL, m_nStartOffset, m_nSize);
         m_bHasAlreadyDownloadedData = res.first;
         m_osAlreadyDownloadedData = std::move(res.second);
     }
@@ -1785,22 +1816,87 @@ struct CurrentDownload
     {
         CPLAssert(!m_bHasAlreadyDownloadedData);
         m_bHasAlreadyDownloadedData = true;
-        m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nBlocks,
-                                         osData);
+        m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nSize,
+                                         osData.data(), osData.size());
     }
 
     ~CurrentDownload()
     {
         if (!m_bHasAlreadyDownloadedData)
-            m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nBlocks,
-                                             std::string());
+            m_poFS->NotifyStopDownloadRegion(m_osURL, m_nStartOffset, m_nSize,
+                                             nullptr, 0);
     }
 
     CurrentDownload(const CurrentDownload &) = delete;
     CurrentDownload &operator=(const CurrentDownload &) = delete;
 };
+
+/************************************************************************/
+/*                       GetRegionInDownloadId()                        */
+/************************************************************************/
+
+std::string GetRegionInDownloadId(const std::string &osURL,
+                                  vsi_l_offset startOffset, size_t nSize)
+{
+    std::string osId(osURL);
+    osId += '_';
+    osId += std::to_string(startOffset);
+    osId += '_';
+    osId += std::to_string(nSize);
+    return osId;
+}
+
 }  // namespace
 
+/************************************************************************/
+/*                      StartOrJoinDownloadRegion()                     */
+/************************************************************************/
+
+/** Indicate intent at downloading a new region, without blocking.
+ *
+ * Returns nullptr if the region is not already in download in another
+ * thread. In that case, the caller must download it and then call
+ * NotifyStopDownloadRegion(), even in case of failure.
+ * Otherwise returns the region in download, whose content must be retrieved
+ * with WaitForDownloadRegion(). The caller should not wait for it while it has
+ * itself downloads in progress, to avoid deadlocks between threads.
+ */
+std::shared_ptr<VSICurlFilesystemHandlerBase::RegionInDownload>
+VSICurlFilesystemHandlerBase::StartOrJoinDownloadRegion(
+    const std::string &osURL, vsi_l_offset startOffset, size_t nSize)
+{
+    const std::string osId(GetRegionInDownloadId(osURL, startOffset, nSize));
+
+    std::lock_guard oLock(m_oMutex);
+    auto &poRegion = m_oMapRegionInDownload[osId];
+    if (poRegion)
+    {
+        poRegion->nWaiters++;
+        return poRegion;
+    }
+    poRegion = std::make_shared<RegionInDownload>();
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        WaitForDownloadRegion()                       */
+/************************************************************************/
+
+/** Wait for the completion of a region returned by
+ * StartOrJoinDownloadRegion(), and return its content (empty if the download
+ * failed).
+ */
+std::string
+VSICurlFilesystemHandlerBase::WaitForDownloadRegion(RegionInDownload &oRegion)
+{
+    std::unique_lock oLock(oRegion.oMutex);
+    while (oRegion.bDownloadInProgress)
+    {
+        oRegion.oCond.wait(oLock);
+    }
+    return oRegion.osData;
+}
+
 /************************************************************************/
 /*                      NotifyStartDownloadRegion()                     */
 /************************************************************************/
@@ -1818,75 +1914,51 @@ struct CurrentDownload
  */
 std::pair<bool, std::string>
 VSICurlFilesystemHandlerBase::NotifyStartDownloadRegion(
-    const std::string &osURL, vsi_l_offset startOffset, int nBlocks)
+    const std::string &osURL, vsi_l_offset startOffset, size_t nSize)
 {
-    std::string osId(osURL);
-    osId += '_';
-    osId += std::to_string(startOffset);
-    osId += '_';
-    osId += std::to_string(nBlocks);
-
-    m_oMutex.lock();
-    auto oIter = m_oMapRegionInDownload.find(osId);
-    if (oIter != m_oMapRegionInDownload.end())
-    {
-        auto &region = *(oIter->second);
-        std::unique_lock<std::mutex> oRegionLock(region.oMutex);
-        m_oMutex.unlock();
-        region.nWaiters++;
-        while (region.bDownloadInProgress)
-        {
-            region.oCond.wait(oRegionLock);
-        }
-        std::string osRet = region.osData;
-        region.nWaiters--;
-        region.oCond.notify_one();
-        return std::pair<bool, std::string>(true, osRet);
-    }
-    else
-    {
-        auto poRegionInDownload = std::make_unique<RegionInDownload>();
-        poRegionInDownload->bDownloadInProgress = true;
-        m_oMapRegionInDownload[osId] = std::move(poRegionInDownload);
-        m_oMutex.unlock();
+    auto poRegion = StartOrJoinDownloadRegion(osURL, startOffset, nSize);
+    if (!poRegion)
         return std::pair<bool, std::string>(false, std::string());
-    }
+    return std::pair<bool, std::string>(true,
+                                        WaitForDownloadRegion(*poRegion));
 }
 
 /************************************************************************/
 /*                      NotifyStopDownloadRegion()                      */
 /************************************************************************/
 
+/** Indicate that the download of a region started with
+ * StartOrJoinDownloadRegion() or NotifyStartDownloadRegion() is completed,
+ * and wake up the threads waiting for it. pData is nullptr in case of
+ * failure.
+ */
 void VSICurlFilesystemHandlerBase::NotifyStopDownloadRegion(
-    const std::string &osURL, vsi_l_offset startOffset, int nBlocks,
-    const std::string &osData)
+    const std::string &osURL, vsi_l_offset startOffset, size_t nSize,
+    const char *pData, size_t nDataSize)
 {
-    std::string osId(osURL);
-    osId += '_';
-    osId += std::to_string(startOffset);
-    osId += '_';
-    osId += std::to_string(nBlocks);
+    const std::string osId(GetRegionInDownloadId(osURL, startOffset, nSize));
 
-    m_oMutex.lock();
-    auto oIter = m_oMapRegionInDownload.find(osId);
-    CPLAssert(oIter != m_oMapRegionInDownload.end());
-    auto &region = *(oIter->second);
+    std::shared_ptr<RegionInDownload> poRegion;
+    bool bHasWaiters = false;
     {
-        std::unique_lock<std::mutex> oRegionLock(region.oMutex);
-        if (region.nWaiters)
-        {
-            region.osData = osData;
-            region.bDownloadInProgress = false;
-            region.oCond.notify_all();
-
-            while (region.nWaiters)
-            {
-                region.oCond.wait(oRegionLock);
-            }
-        }
+        std::lock_guard oLock(m_oMutex);
+        auto oIter = m_oMapRegionInDownload.find(osId);
+        CPLAssert(oIter != m_oMapRegionInDownload.end());
+        if (oIter == m_oMapRegionInDownload.end())
+            return;
+        poRegion = std::move(oIter->second);
+        m_oMapRegionInDownload.erase(oIter);
+        // No new waiter can join once the region is removed from the map
+        bHasWaiters = poRegion->nWaiters > 0;
+    }
+    if (bHasWaiters)
+    {
+        std::lock_guard oRegionLock(poRegion->oMutex);
+        if (pData)
+            poRegion->osData.assign(pData, nDataSize);
+        poRegion->bDownloadInProgress = false;
+        poRegion->oCond.notify_all();
     }
-    m_oMapRegionInDownload.erase(oIter);
-    m_oMutex.unlock();
 }
 
 /************************************************************************/
@@ -2302,7 +2374,8 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer,
+                        m_bCached);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
@@ -2354,7 +2427,19 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
-            poFS->GetRegion(m_pszURL, nOffsetToDownload);
+            poFS->GetRegion(m_pszURL, nOffsetToDownload, m_bCached);
+        if (psRegion == nullptr && m_bReadaheadInFlight &&
+            nOffsetToDownload >= m_nReadaheadOffset &&
+            nOffsetToDownload <
+                m_nReadaheadOffset + static_cast<vsi_l_offset>(
+                                         m_nReadaheadBlocks) *
+                                         knDOWNLOAD_CHUNK_SIZE)
+        {
+            // The region is being prefetched
+            WaitForReadahead();
+            psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload, m_bCached);
+        }
+        NetworkStatisticsLogger::LogCacheAccess(psRegion != nullptr);
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
@@ -2370,6 +2455,13 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                 constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
                 if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
                     nBlocksToDownload *= 2;
+                // And make sure the request is large enough to keep the
+                // network link busy.
+                if (m_bReadaheadEnabled)
+                    nBlocksToDownload =
+                        std::max(nBlocksToDownload,
+                                 std::min(MAX_CHUNK_SIZE_INCREASE_FACTOR,
+                                          GetBandwidthDelayProductBlocks()));
             }
             else
             {
@@ -2394,10 +2486,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
-                    nullptr)
+                if (poFS->GetRegion(m_pszURL,
+                                    nOffsetToDownload +
+                                        static_cast<vsi_l_offset>(i) *
+                                            knDOWNLOAD_CHUNK_SIZE,
+                                    m_bCached) != nullptr)
                 {
                     nBlocksToDownload = i;
                     break;
@@ -2410,6 +2503,7 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             if (nBlocksToDownload > knMAX_REGIONS)
                 nBlocksToDownload = knMAX_REGIONS;
 
+            const auto nStartTime = std::chrono::steady_clock::now();
             osRegion = DownloadRegion(nOffsetToDownload, nBlocksToDownload);
             if (osRegion.empty())
             {
@@ -2417,6 +2511,14 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                     bError = true;
                 return 0;
             }
+            if (m_bReadaheadEnabled)
+            {
+                UpdateThroughputEstimate(
+                    osRegion.size(),
+                    std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - nStartTime)
+                        .count());
+            }
         }
 
         const vsi_l_offset nRegionOffset = iterOffset - nOffsetToDownload;
@@ -2450,11 +2552,267 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     if (ret != nMemb)
         bEOF = true;
 
+    if (m_bReadaheadEnabled)
+        ReadaheadAfterRead(curOffset,
+                           static_cast<size_t>(iterOffset - curOffset));
+
     curOffset = iterOffset;
 
     return ret;
 }
 
+/************************************************************************/
+/*                      UpdateThroughputEstimate()                      */
+/************************************************************************/
+
+void VSICurlHandle::UpdateThroughputEstimate(size_t nBytes, double dfDuration)
+{
+    if (nBytes == 0 || dfDuration <= 0)
+        return;
+    // The fastest request is assumed to be dominated by the round-trip
+    // latency, and the remainder of the duration of the other requests
+    // by the transfer.
+    if (m_dfLatency == 0 || dfDuration < m_dfLatency)
+        m_dfLatency = dfDuration;
+    const double dfTransferDuration = dfDuration - m_dfLatency;
+    if (dfTransferDuration > 0)
+    {
+        const double dfBandwidth =
+            static_cast<double>(nBytes) / dfTransferDuration;
+        m_dfBandwidth = m_dfBandwidth == 0
+                            ? dfBandwidth
+                            : 0.5 * (m_dfBandwidth + dfBandwidth);
+    }
+}
+
+/************************************************************************/
+/*                   GetBandwidthDelayProductBlocks()                   */
+/************************************************************************/
+
+// Returns the number of chunks that can be transferred during a round-trip,
+// i.e. the minimum size of a request to make a good use of the network link.
+int VSICurlHandle::GetBandwidthDelayProductBlocks() const
+{
+    const double dfBlocks = m_dfBandwidth * m_dfLatency /
+                            static_cast<double>(VSICURLGetDownloadChunkSize());
+    if (!(dfBlocks >= 1))
+        return 1;
+    if (dfBlocks >= std::numeric_limits<int>::max())
+        return std::numeric_limits<int>::max();
+    return static_cast<int>(std::ceil(dfBlocks));
+}
+
+/************************************************************************/
+/*                         WaitForReadahead()                           */
+/************************************************************************/
+
+void VSICurlHandle::WaitForReadahead()
+{
+    if (!m_bReadaheadInFlight)
+        return;
+    m_poReadaheadPool->WaitCompletion();
+    m_bReadaheadInFlight = false;
+    UpdateThroughputEstimate(m_nReadaheadDownloaded, m_dfReadaheadDuration);
+}
+
+/************************************************************************/
+/*                         ScheduleReadahead()                          */
+/************************************************************************/
+
+// Downloads in a background thread the nBlocks chunks starting at nOffset,
+// and adds them to the cache of regions, where Read() will find them.
+void VSICurlHandle::ScheduleReadahead(vsi_l_offset nOffset, int nBlocks)
+{
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+
+    // Skip already cached chunks
+    for (int i = 0; i < GetMaxRegions() &&
+                    poFS->GetRegion(m_pszURL, nOffset, m_bCached) != nullptr;
+         ++i)
+    {
+        nOffset += knDOWNLOAD_CHUNK_SIZE;
+    }
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (oFileProp.bHasComputedFileSize)
+    {
+        if (nOffset >= oFileProp.fileSize)
+            return;
+        const vsi_l_offset nRemainingBlocks =
+            (oFileProp.fileSize - nOffset + knDOWNLOAD_CHUNK_SIZE - 1) /
+            knDOWNLOAD_CHUNK_SIZE;
+        if (static_cast<vsi_l_offset>(nBlocks) > nRemainingBlocks)
+            nBlocks = static_cast<int>(nRemainingBlocks);
+    }
+    if (nBlocks <= 0)
+        return;
+
+    if (!m_poReadaheadHandle)
+    {
+        // A dedicated handle, only used by the readahead thread, so that
+        // the state of this one is not modified concurrently.
+        m_poReadaheadHandle.reset(
+            poFS->CreateFileHandle(m_osFilename.c_str()));
+        if (!m_poReadaheadHandle)
+        {
+            m_bReadaheadEnabled = false;
+            return;
+        }
+        m_poReadaheadHandle->m_bReadaheadEnabled = false;
+        // A single thread kept alive during the life of the handle, so
+        // that it reuses its connection.
+        m_poReadaheadPool = std::make_unique<CPLWorkerThreadPool>(1);
+    }
+
+    m_bReadaheadInFlight = true;
+    m_nReadaheadOffset = nOffset;
+    m_nReadaheadBlocks = nBlocks;
+    m_nReadaheadDownloaded = 0;
+    m_dfReadaheadDuration = 0;
+
+#ifdef DEBUG_VERBOSE
+    CPLDebug(poFS->GetDebugKey(),
+             "Readahead of %d blocks at offset " CPL_FRMT_GUIB, nBlocks,
+             static_cast<GUIntBig>(nOffset));
+#endif
+
+    const auto task =
+        [this, nOffset, nBlocks, knDOWNLOAD_CHUNK_SIZE,
+         aosTLConfigOptions = CPLStringList(CPLGetThreadLocalConfigOptions())]()
+    {
+        const size_t nSize =
+            static_cast<size_t>(nBlocks) * knDOWNLOAD_CHUNK_SIZE;
+        std::string osBuffer;
+        try
+        {
+            osBuffer.resize(nSize);
+        }
+        catch (const std::exception &)
+        {
+            return;
+        }
+
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        // Errors will be emitted, if needed, when Read() downloads the
+        // region itself.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+        auto poHandle = m_poReadaheadHandle.get();
+        // Cancel the sequential heuristics of the readahead handle, so
+        // that it downloads exactly what we ask.
+        poHandle->lastDownloadedOffset = VSI_L_OFFSET_MAX;
+        const auto nStartTime = std::chrono::steady_clock::now();
+        poHandle->Seek(nOffset, SEEK_SET);
+        const size_t nRead = poHandle->Read(osBuffer.data(), 1, nSize);
+        m_nReadaheadDownloaded = nRead;
+        m_dfReadaheadDuration = std::chrono::duration<double>(
+                                    std::chrono::steady_clock::now() -
+                                    nStartTime)
+                                    .count();
+        CPLSetThreadLocalConfigOptions(nullptr);
+    };
+    if (!m_poReadaheadPool->SubmitJob(task))
+        m_bReadaheadInFlight = false;
+}
+
+/************************************************************************/
+/*                        ReadaheadAfterRead()                          */
+/************************************************************************/
+
+// Called after each Read() to detect sequential or strided access
+// patterns, and prefetch the regions that are going to be read next.
+void VSICurlHandle::ReadaheadAfterRead(vsi_l_offset nOffset, size_t nSize)
+{
+    const bool bSequential = m_nLastReadOffset != VSI_L_OFFSET_MAX &&
+                             nOffset == m_nLastReadOffset + m_nLastReadSize;
+    const GIntBig nStride =
+        m_nLastReadOffset != VSI_L_OFFSET_MAX
+            ? static_cast<GIntBig>(nOffset - m_nLastReadOffset)
+            : 0;
+    const bool bStrided =
+        !bSequential && nStride > 0 && nStride == m_nLastReadStride;
+    m_nLastReadOffset = nOffset;
+    m_nLastReadSize = nSize;
+    m_nLastReadStride = nStride;
+    if (nSize == 0 || bEOF || (!bSequential && !bStrided))
+        return;
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const vsi_l_offset nEnd = nOffset + nSize;
+    if (bSequential)
+    {
+        // Chunks already cached are skipped by ScheduleReadahead()
+        vsi_l_offset nNextOffset =
+            (nEnd / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+        int nBlocks = 1;
+        if (m_bReadaheadInFlight)
+        {
+            // Not yet reached the window being prefetched
+            if (nEnd < m_nReadaheadOffset)
+                return;
+            // Prefetch the window following it, twice as large.
+            nNextOffset = m_nReadaheadOffset +
+                          static_cast<vsi_l_offset>(m_nReadaheadBlocks) *
+                              knDOWNLOAD_CHUNK_SIZE;
+            nBlocks = 2 * m_nReadaheadBlocks;
+            WaitForReadahead();
+        }
+        else if (m_nReadaheadBlocks > 0)
+        {
+            nBlocks = 2 * m_nReadaheadBlocks;
+        }
+        // Keep room in the cache for the region being read.
+        constexpr int MAX_READAHEAD_BLOCKS = 128;
+        nBlocks = std::min(std::max(nBlocks, GetBandwidthDelayProductBlocks()),
+                           std::min(MAX_READAHEAD_BLOCKS,
+                                    std::max(1, GetMaxRegions() / 2)));
+        ScheduleReadahead(nNextOffset, nBlocks);
+    }
+    else
+    {
+        // Prefetch the chunks of the next read, assuming the same size.
+        const vsi_l_offset nNextOffset = nOffset + nStride;
+        const vsi_l_offset nNextOffsetToDownload =
+            (nNextOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+        const int nBlocks = static_cast<int>(std::min<vsi_l_offset>(
+            std::max(1, GetMaxRegions() / 2),
+            (nNextOffset + nSize - nNextOffsetToDownload +
+             knDOWNLOAD_CHUNK_SIZE - 1) /
+                knDOWNLOAD_CHUNK_SIZE));
+        if (m_bReadaheadInFlight &&
+            nNextOffsetToDownload >= m_nReadaheadOffset &&
+            nNextOffsetToDownload <
+                m_nReadaheadOffset +
+                    static_cast<vsi_l_offset>(m_nReadaheadBlocks) *
+                        knDOWNLOAD_CHUNK_SIZE)
+        {
+            return;
+        }
+        WaitForReadahead();
+        ScheduleReadahead(nNextOffsetToDownload, nBlocks);
+    }
+}
+
+/************************************************************************/
+/*                        GetMergeRangesMaxGap()                        */
+/************************************************************************/
+
+// Maximum number of bytes between two ranges so that they are fetched with a
+// single request in ReadMultiRange() and AdviseRead()
+static vsi_l_offset GetMergeRangesMaxGap()
+{
+    const char *pszVal =
+        CPLGetConfigOption("GDAL_HTTP_MERGE_RANGES_MAX_GAP", "0");
+    GIntBig nVal = 0;
+    if (CPLParseMemorySize(pszVal, &nVal, nullptr) != CE_None || nVal < 0)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for GDAL_HTTP_MERGE_RANGES_MAX_GAP: %s",
+                 pszVal);
+        return 0;
+    }
+    return static_cast<vsi_l_offset>(nVal);
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2515,43 +2873,99 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     }
 #endif
 
-    std::vector<CURL *> aHandles;
-    std::vector<WriteFuncStruct> asWriteFuncData(nRanges);
-    std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRanges);
-    std::vector<char *> apszRanges;
-    std::vector<struct curl_slist *> aHeaders;
-
-    struct CurlErrBuffer
-    {
-        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
-    };
-
-    std::vector<CurlErrBuffer> asCurlErrors(nRanges);
-
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    const vsi_l_offset nMaxGap =
+        bMergeConsecutiveRanges ? GetMergeRangesMaxGap() : 0;
 
-    for (int i = 0, iRequest = 0; i < nRanges;)
+    // Group consecutive ranges, or ranges separated by at most nMaxGap bytes,
+    // into requests.
+    struct RangeRequest
     {
+        int iFirstRange = 0;
+        int iLastRange = 0;
+        vsi_l_offset nStartOffset = 0;
         size_t nSize = 0;
+        // Set if the request is already being downloaded by another thread
+        std::shared_ptr<VSICurlFilesystemHandlerBase::RegionInDownload>
+            poJoinedDownload{};
+    };
+
+    std::vector<RangeRequest> aoRequests;
+    for (int i = 0; i < nRanges;)
+    {
         int iNext = i;
-        // Identify consecutive ranges
+        vsi_l_offset nEndOffset = panOffsets[i] + panSizes[i];
         while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-               panOffsets[iNext] + panSizes[iNext] == panOffsets[iNext + 1])
+               panOffsets[iNext + 1] >= nEndOffset &&
+               panOffsets[iNext + 1] - nEndOffset <= nMaxGap)
         {
-            nSize += panSizes[iNext];
             iNext++;
+            nEndOffset = panOffsets[iNext] + panSizes[iNext];
         }
-        nSize += panSizes[iNext];
 
-        if (nSize == 0)
+        const size_t nSize = static_cast<size_t>(nEndOffset - panOffsets[i]);
+        if (nSize > 0)
         {
-            i = iNext + 1;
-            continue;
+            RangeRequest oRequest;
+            oRequest.iFirstRange = i;
+            oRequest.iLastRange = iNext;
+            oRequest.nStartOffset = panOffsets[i];
+            oRequest.nSize = nSize;
+            // Do not issue requests that are already in progress in another
+            // thread (typically when several threads open the same file at
+            // the same time). We will wait for them once our own requests
+            // are completed.
+            oRequest.poJoinedDownload =
+                poFS->StartOrJoinDownloadRegion(m_pszURL, panOffsets[i], nSize);
+            aoRequests.push_back(std::move(oRequest));
         }
+        i = iNext + 1;
+    }
+
+    // Dispatch the content of a request to the ranges it covers
+    const auto CopyToRanges = [nRanges, ppData, panOffsets,
+                               panSizes](const RangeRequest &oRequest,
+                                         const char *pData, size_t nDataSize)
+    {
+        for (int iRange = oRequest.iFirstRange; iRange <= oRequest.iLastRange;
+             ++iRange)
+        {
+            CPLAssert(iRange < nRanges);
+            CPL_IGNORE_RET_VAL(nRanges);
+            if (panSizes[iRange] == 0)
+                continue;
+            const size_t nRelOffset =
+                static_cast<size_t>(panOffsets[iRange] - oRequest.nStartOffset);
+            if (nRelOffset + panSizes[iRange] > nDataSize)
+                return false;
+            memcpy(ppData[iRange], pData + nRelOffset, panSizes[iRange]);
+        }
+        return true;
+    };
+
+    const size_t nRequests = aoRequests.size();
+    std::vector<CURL *> aHandles(nRequests);
+    std::vector<WriteFuncStruct> asWriteFuncData(nRequests);
+    std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRequests);
+    std::vector<char *> apszRanges(nRequests);
+    std::vector<struct curl_slist *> aHeaders(nRequests);
+
+    struct CurlErrBuffer
+    {
+        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
+    };
+
+    std::vector<CurlErrBuffer> asCurlErrors(nRequests);
+
+    for (size_t iRequest = 0; iRequest < nRequests; ++iRequest)
+    {
+        const auto &oRequest = aoRequests[iRequest];
+        if (oRequest.poJoinedDownload)
+            continue;
 
         CURL *hCurlHandle = curl_easy_init();
-        aHandles.push_back(hCurlHandle);
+        aHandles[iRequest] = hCurlHandle;
 
         // As the multi-range request is likely not the first one, we don't
         // need to wait as we already know if pipelining is possible
@@ -2574,9 +2988,10 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
                                    VSICurlHandleWriteFunc);
         asWriteFuncHeaderData[iRequest].bIsHTTP = STARTS_WITH(m_pszURL, "http");
-        asWriteFuncHeaderData[iRequest].nStartOffset = panOffsets[i];
+        asWriteFuncHeaderData[iRequest].nStartOffset = oRequest.nStartOffset;
 
-        asWriteFuncHeaderData[iRequest].nEndOffset = panOffsets[i] + nSize - 1;
+        asWriteFuncHeaderData[iRequest].nEndOffset =
+            oRequest.nStartOffset + oRequest.nSize - 1;
 
         char rangeStr[512] = {};
         snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
@@ -2591,13 +3006,12 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         {
             // So it gets included in Azure signature
             char *pszRange = CPLStrdup(CPLSPrintf("Range: bytes=%s", rangeStr));
-            apszRanges.push_back(pszRange);
+            apszRanges[iRequest] = pszRange;
             headers = curl_slist_append(headers, pszRange);
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
         }
         else
         {
-            apszRanges.push_back(nullptr);
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
         }
 
@@ -2607,35 +3021,28 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
         headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
-        aHeaders.push_back(headers);
+        aHeaders[iRequest] = headers;
         curl_multi_add_handle(hMultiHandle, hCurlHandle);
-
-        i = iNext + 1;
-        iRequest++;
     }
 
-    if (!aHandles.empty())
+    if (std::any_of(aHandles.begin(), aHandles.end(),
+                    [](CURL *hCurlHandle) { return hCurlHandle != nullptr; }))
     {
         VSICURLMultiPerform(hMultiHandle);
     }
 
     int nRet = 0;
-    size_t iReq = 0;
-    int iRange = 0;
     size_t nTotalDownloaded = 0;
-    for (; iReq < aHandles.size(); iReq++, iRange++)
+    for (size_t iReq = 0; iReq < nRequests; iReq++)
     {
-        while (iRange < nRanges && panSizes[iRange] == 0)
-        {
-            iRange++;
-        }
-        if (iRange == nRanges)
-            break;
+        if (!aHandles[iReq])
+            continue;
+        const auto &oRequest = aoRequests[iReq];
 
         long response_code = 0;
         curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
 
-        if (ENABLE_DEBUG && asCurlErrors[iRange].szCurlErrBuf[0] != '\0')
+        if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
         {
             char rangeStr[512] = {};
             snprintf(rangeStr, sizeof(rangeStr),
@@ -2643,7 +3050,7 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                      asWriteFuncHeaderData[iReq].nStartOffset,
                      asWriteFuncHeaderData[iReq].nEndOffset);
 
-            const char *pszErrorMsg = &asCurlErrors[iRange].szCurlErrBuf[0];
+            const char *pszErrorMsg = &asCurlErrors[iReq].szCurlErrBuf[0];
             CPLDebug(poFS->GetDebugKey(),
                      "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
                      osURL.c_str(), rangeStr, static_cast<int>(response_code),
@@ -2665,40 +3072,20 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                      "Request for %s failed with response_code=%ld", rangeStr,
                      response_code);
             nRet = -1;
+            poFS->NotifyStopDownloadRegion(m_pszURL, oRequest.nStartOffset,
+                                           oRequest.nSize, nullptr, 0);
         }
-        else if (nRet == 0)
+        else
         {
-            size_t nOffset = 0;
-            size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-            nTotalDownloaded += nRemainingSize;
-            CPLAssert(iRange < nRanges);
-            while (true)
+            nTotalDownloaded += asWriteFuncData[iReq].nSize;
+            poFS->NotifyStopDownloadRegion(
+                m_pszURL, oRequest.nStartOffset, oRequest.nSize,
+                asWriteFuncData[iReq].pBuffer, asWriteFuncData[iReq].nSize);
+            if (nRet == 0 &&
+                !CopyToRanges(oRequest, asWriteFuncData[iReq].pBuffer,
+                              asWriteFuncData[iReq].nSize))
             {
-                if (nRemainingSize < panSizes[iRange])
-                {
-                    nRet = -1;
-                    break;
-                }
-
-                if (panSizes[iRange] > 0)
-                {
-                    memcpy(ppData[iRange],
-                           asWriteFuncData[iReq].pBuffer + nOffset,
-                           panSizes[iRange]);
-                }
-
-                if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
-                    panOffsets[iRange] + panSizes[iRange] ==
-                        panOffsets[iRange + 1])
-                {
-                    nOffset += panSizes[iRange];
-                    nRemainingSize -= panSizes[iRange];
-                    iRange++;
-                }
-                else
-                {
-                    break;
-                }
+                nRet = -1;
             }
         }
 
@@ -2713,6 +3100,35 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
     NetworkStatisticsLogger::LogGET(nTotalDownloaded);
 
+    // Now that our own requests are completed, collect the ones issued by
+    // other threads.
+    for (const auto &oRequest : aoRequests)
+    {
+        if (!oRequest.poJoinedDownload || nRet != 0)
+            continue;
+        if (ENABLE_DEBUG)
+            CPLDebug(poFS->GetDebugKey(),
+                     "Waiting for concurrent download of " CPL_FRMT_GUIB
+                     "-" CPL_FRMT_GUIB " (%s)...",
+                     oRequest.nStartOffset,
+                     oRequest.nStartOffset + oRequest.nSize - 1, m_pszURL);
+        const std::string osData = VSICurlFilesystemHandlerBase::
+            WaitForDownloadRegion(*(oRequest.poJoinedDownload));
+        if (!CopyToRanges(oRequest, osData.data(), osData.size()))
+        {
+            // The download failed in the other thread: retry it ourselves
+            const int nRangesReq =
+                oRequest.iLastRange - oRequest.iFirstRange + 1;
+            if (VSIVirtualHandle::ReadMultiRange(
+                    nRangesReq, ppData + oRequest.iFirstRange,
+                    panOffsets + oRequest.iFirstRange,
+                    panSizes + oRequest.iFirstRange) != 0)
+            {
+                nRet = -1;
+            }
+        }
+    }
+
     if (ENABLE_DEBUG)
         CPLDebug(poFS->GetDebugKey(), "Download completed");
 
@@ -3357,6 +3773,12 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    // Ranges of COG tiles are separated by the leader and trailer markers
+    constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
+    const vsi_l_offset nMaxGap =
+        bMergeConsecutiveRanges
+            ? std::max<vsi_l_offset>(SIZE_COG_MARKERS, GetMergeRangesMaxGap())
+            : 0;
 
     try
     {
@@ -3366,11 +3788,10 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         {
             int iNext = i;
             // Identify consecutive ranges
-            constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
             auto nEndOffset = panOffsets[iNext] + panSizes[iNext];
             while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
                    panOffsets[iNext + 1] > panOffsets[iNext] &&
-                   panOffsets[iNext] + panSizes[iNext] + SIZE_COG_MARKERS >=
+                   panOffsets[iNext] + panSizes[iNext] + nMaxGap >=
                        panOffsets[iNext + 1] &&
                    panOffsets[iNext + 1] + panSizes[iNext + 1] > nEndOffset)
             {
@@ -3438,6 +3859,17 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
         size_t nTotalDownloaded = 0;
 
+        // Do not download ranges already in download in another thread. We
+        // will wait for them once our own downloads are completed.
+        for (auto &poRange : m_aoAdviseReadRanges)
+        {
+            poRange->poJoinedDownload = poFS->StartOrJoinDownloadRegion(
+                m_pszURL, poRange->nStartOffset, poRange->nSize);
+            poRange->bRegisteredDownload = !poRange->poJoinedDownload;
+            if (poRange->poJoinedDownload)
+                poRange->bToRetry = false;
+        }
+
         while (true)
         {
 
@@ -3572,6 +4004,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 }
 
                 bool bToRetry = false;
+                bool bOK = false;
                 if ((response_code != 206 && response_code != 225) ||
                     asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
                         asWriteFuncHeaderData[iReq].nStartOffset +
@@ -3617,12 +4050,24 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     m_aoAdviseReadRanges[iReq]->abyData.resize(nSize);
 
                     nTotalDownloaded += nSize;
+                    bOK = true;
                 }
 
                 m_aoAdviseReadRanges[iReq]->bToRetry = bToRetry;
 
                 if (!bToRetry)
                 {
+                    auto &oRange = *(m_aoAdviseReadRanges[iReq]);
+                    if (oRange.bRegisteredDownload)
+                    {
+                        oRange.bRegisteredDownload = false;
+                        poFS->NotifyStopDownloadRegion(
+                            m_pszURL, oRange.nStartOffset, oRange.nSize,
+                            bOK ? reinterpret_cast<const char *>(
+                                      oRange.abyData.data())
+                                : nullptr,
+                            bOK ? oRange.abyData.size() : 0);
+                    }
                     std::lock_guard<std::mutex> oLock(
                         m_aoAdviseReadRanges[iReq]->oMutex);
                     m_aoAdviseReadRanges[iReq]->bDone = true;
@@ -3674,7 +4119,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                         m_aoAdviseReadRanges[i]->oMutex);
                     bReqDone = m_aoAdviseReadRanges[i]->bDone;
                 }
-                if (!bReqDone && !m_aoAdviseReadRanges[i]->bToRetry)
+                if (!bReqDone && !m_aoAdviseReadRanges[i]->bToRetry &&
+                    aHandles[i])
                 {
                     DealWithRequest(aHandles[i]);
                 }
@@ -3696,7 +4142,35 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     curl_slist_free_all(aHeaders[i]);
             }
             if (!bRetry)
-                break;
+            {
+                // Now that our own downloads are completed, collect the ones
+                // done by other threads
+                for (auto &poRange : m_aoAdviseReadRanges)
+                {
+                    if (!poRange->poJoinedDownload)
+                        continue;
+                    const std::string osData = VSICurlFilesystemHandlerBase::
+                        WaitForDownloadRegion(*(poRange->poJoinedDownload));
+                    poRange->poJoinedDownload.reset();
+                    if (!osData.empty() && osData.size() <= poRange->nSize)
+                    {
+                        memcpy(poRange->abyData.data(), osData.data(),
+                               osData.size());
+                        poRange->abyData.resize(osData.size());
+                        std::lock_guard<std::mutex> oLock(poRange->oMutex);
+                        poRange->bDone = true;
+                        poRange->oCV.notify_all();
+                    }
+                    else
+                    {
+                        // Failed in the other thread: download it ourselves
+                        poRange->bToRetry = true;
+                        bRetry = true;
+                    }
+                }
+                if (!bRetry)
+                    break;
+            }
             CPLSleep(dfDelay);
         }
 
@@ -3925,18 +4399,33 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
 
 std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
-                                        vsi_l_offset nFileOffsetStart)
+                                        vsi_l_offset nFileOffsetStart,
+                                        bool bAllowDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
     std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
+        CPLMutexHolder oHolder(&hMutex);
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    if (bAllowDiskCache && VSICurlDiskCacheIsEnabled())
+    {
+        out = VSICurlDiskCacheGetRegion(pszURL, nFileOffsetStart);
+        if (out)
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out);
+        }
         return out;
     }
 
@@ -3949,14 +4438,20 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             bool bAllowDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+        std::shared_ptr<std::string> value(new std::string());
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
+
+    if (bAllowDiskCache && VSICurlDiskCacheIsEnabled())
+        VSICurlDiskCacheAddRegion(pszURL, nFileOffsetStart, nSize, pData);
 }
 
 /************************************************************************/
@@ -4221,6 +4716,9 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='GDAL_HTTP_MERGE_CONSECUTIVE_RANGES' type='boolean' "      \
     "description='Whether to merge consecutive ranges in multirange "          \
     "requests' default='YES'/>"                                                \
+    "  <Option name='GDAL_HTTP_MERGE_RANGES_MAX_GAP' type='string' "           \
+    "description='Maximum number of bytes between ranges merged in a single "  \
+    "request' default='0'/>"                                                   \
     "  <Option name='CPL_VSIL_CURL_NON_CACHED' type='string' "                 \
     "description='Colon-separated list of filenames whose content"             \
     "must not be cached across open attempts'/>"                               \
@@ -5819,6 +6317,8 @@ long CurlRequestHelper::perform(CURL *hCurlHandle, struct curl_slist *headers,
 // Global variable
 NetworkStatisticsLogger NetworkStatisticsLogger::gInstance{};
 int NetworkStatisticsLogger::gnEnabled = -1;  // unknown state
+thread_local std::vector<NetworkStatisticsLogger::ScopeStats>
+    NetworkStatisticsLogger::tl_aoScopes{};
 
 static void ShowNetworkStats()
 {
@@ -5939,6 +6439,13 @@ NetworkStatisticsLogger::GetCountersForContext()
 
 void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes)
 {
+    CPLTraceCounterAdd(CPL_TRACE_COUNTER_NETWORK_BYTES_DOWNLOADED,
+                       static_cast<GIntBig>(nDownloadedBytes));
+    for (auto &oScope : tl_aoScopes)
+    {
+        oScope.counters.nGET++;
+        oScope.counters.nGETDownloadedBytes += nDownloadedBytes;
+    }
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5951,6 +6458,11 @@ void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes)
 
 void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
 {
+    for (auto &oScope : tl_aoScopes)
+    {
+        oScope.counters.nPUT++;
+        oScope.counters.nPUTUploadedBytes += nUploadedBytes;
+    }
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5963,6 +6475,8 @@ void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
 
 void NetworkStatisticsLogger::LogHEAD()
 {
+    for (auto &oScope : tl_aoScopes)
+        oScope.counters.nHEAD++;
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5975,6 +6489,12 @@ void NetworkStatisticsLogger::LogHEAD()
 void NetworkStatisticsLogger::LogPOST(size_t nUploadedBytes,
                                       size_t nDownloadedBytes)
 {
+    for (auto &oScope : tl_aoScopes)
+    {
+        oScope.counters.nPOST++;
+        oScope.counters.nPOSTUploadedBytes += nUploadedBytes;
+        oScope.counters.nPOSTDownloadedBytes += nDownloadedBytes;
+    }
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5988,6 +6508,8 @@ void NetworkStatisticsLogger::LogPOST(size_t nUploadedBytes,
 
 void NetworkStatisticsLogger::LogDELETE()
 {
+    for (auto &oScope : tl_aoScopes)
+        oScope.counters.nDELETE++;
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5997,6 +6519,105 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogRetry()
+{
+    for (auto &oScope : tl_aoScopes)
+        oScope.nRetries++;
+}
+
+void NetworkStatisticsLogger::LogCacheAccess(bool bHit)
+{
+    for (auto &oScope : tl_aoScopes)
+    {
+        if (bHit)
+            oScope.nCacheHits++;
+        else
+            oScope.nCacheMisses++;
+    }
+}
+
+void NetworkStatisticsLogger::LogLatency(double dfSeconds)
+{
+    if (tl_aoScopes.empty())
+        return;
+    const double dfMs = dfSeconds * 1000;
+    int iBucket = 0;
+    while (iBucket < ScopeStats::LATENCY_BUCKET_COUNT - 1 &&
+           dfMs > ScopeStats::anLatencyBucketsMs[iBucket])
+    {
+        ++iBucket;
+    }
+    for (auto &oScope : tl_aoScopes)
+    {
+        oScope.nLatencyCount++;
+        oScope.dfLatencySumMs += dfMs;
+        oScope.dfLatencyMaxMs = std::max(oScope.dfLatencyMaxMs, dfMs);
+        oScope.anLatencyHistogram[iBucket]++;
+    }
+}
+
+void NetworkStatisticsLogger::BeginScope()
+{
+    tl_aoScopes.emplace_back();
+}
+
+std::string NetworkStatisticsLogger::EndScope()
+{
+    if (tl_aoScopes.empty())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "VSINetworkStatsEndScope() called without a matching "
+                 "VSINetworkStatsBeginScope()");
+        return std::string();
+    }
+    CPLJSONObject oJSON;
+    tl_aoScopes.back().AsJSON(oJSON);
+    tl_aoScopes.pop_back();
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+void NetworkStatisticsLogger::ScopeStats::AsJSON(CPLJSONObject &oJSON) const
+{
+    Stats oStats;
+    oStats.counters = counters;
+    oStats.AsJSON(oJSON);
+
+    oJSON.Add("retries", nRetries);
+
+    CPLJSONObject oCache;
+    oCache.Add("hits", nCacheHits);
+    oCache.Add("misses", nCacheMisses);
+    if (nCacheHits + nCacheMisses > 0)
+    {
+        oCache.Add("hit_ratio", static_cast<double>(nCacheHits) /
+                                    static_cast<double>(nCacheHits +
+                                                        nCacheMisses));
+    }
+    oJSON.Add("cache", oCache);
+
+    CPLJSONObject oLatency;
+    oLatency.Add("count", nLatencyCount);
+    if (nLatencyCount > 0)
+    {
+        oLatency.Add("mean_ms", dfLatencySumMs /
+                                    static_cast<double>(nLatencyCount));
+        oLatency.Add("max_ms", dfLatencyMaxMs);
+    }
+    CPLJSONArray oHistogram;
+    for (int i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+    {
+        CPLJSONObject oBucket;
+        if (i < LATENCY_BUCKET_COUNT - 1)
+            oBucket.Add("upper_bound_ms", anLatencyBucketsMs[i]);
+        else
+            oBucket.AddNull("upper_bound_ms");
+        oBucket.Add("count", anLatencyHistogram[i]);
+        oHistogram.Add(oBucket);
+    }
+    oLatency.Add("histogram", oHistogram);
+    oJSON.Add("latency", oLatency);
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6550,6 +7171,91 @@ char *VSINetworkStatsGetAsSerializedJSON(CPL_UNUSED char **papszOptions)
         cpl::NetworkStatisticsLogger::GetReportAsSerializedJSON().c_str());
 }
 
+/************************************************************************/
+/*                     VSINetworkStatsBeginScope()                      */
+/************************************************************************/
+
+/**
+ * \brief Start collecting network statistics for the current thread.
+ *
+ * All network requests issued by the current thread until the matching
+ * VSINetworkStatsEndScope() call are accounted in the scope, independently
+ * of the CPL_VSIL_NETWORK_STATS_ENABLED configuration option. This is for
+ * example useful to measure the cost of a GDALOpen() or RasterIO() call.
+ * Requests issued by other threads are not accounted.
+ *
+ * Scopes may be nested: a request is accounted in all the scopes open
+ * in the current thread.
+ *
+ * @since GDAL 3.12
+ */
+
+void VSINetworkStatsBeginScope(void)
+{
+    cpl::NetworkStatisticsLogger::BeginScope();
+}
+
+/************************************************************************/
+/*                      VSINetworkStatsEndScope()                       */
+/************************************************************************/
+
+/**
+ * \brief Stop collecting network statistics for the innermost scope of the
+ * current thread, and return them as a JSON serialized object.
+ *
+ * Example of output:
+ * \code{.js}
+ * {
+ *   "methods":{
+ *     "HEAD":{
+ *       "count":1
+ *     },
+ *     "GET":{
+ *       "count":2,
+ *       "downloaded_bytes":32768
+ *     }
+ *   },
+ *   "retries":0,
+ *   "cache":{
+ *     "hits":5,
+ *     "misses":2,
+ *     "hit_ratio":0.714
+ *   },
+ *   "latency":{
+ *     "count":3,
+ *     "mean_ms":12.5,
+ *     "max_ms":20.1,
+ *     "histogram":[
+ *       {
+ *         "upper_bound_ms":1,
+ *         "count":0
+ *       },
+ *       [...]
+ *       {
+ *         "upper_bound_ms":null,
+ *         "count":0
+ *       }
+ *     ]
+ *   }
+ * }
+ * \endcode
+ *
+ * "cache" reports the accesses to the in-memory (or disk) cache of
+ * downloaded regions of /vsicurl/ based file systems. "latency" reports the
+ * total duration of individual requests.
+ *
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr if
+ * there is no open scope.
+ * @since GDAL 3.12
+ */
+
+char *VSINetworkStatsEndScope(CPL_UNUSED CSLConstList papszOptions)
+{
+    const std::string osRet = cpl::NetworkStatisticsLogger::EndScope();
+    return osRet.empty() ? nullptr : CPLStrdup(osRet.c_str());
+}
+
 #endif /* HAVE_CURL */
 
 #undef ENABLE_DEBUG
@@ -23,6 +23,7 @@
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
@@ -200,19 +201,23 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     // Data structure and map to store regions that are in progress, to
     // avoid simultaneous downloads of the same region in different threads
     // Cf https://github.com/OSGeo/gdal/issues/8041
+    // Also used by ReadMultiRange() and AdviseRead().
     struct RegionInDownload
     {
         std::mutex oMutex{};
         std::condition_variable oCond{};
-        bool bDownloadInProgress = false;
-        int nWaiters = 0;
+        bool bDownloadInProgress = true;
+        int nWaiters = 0;  // protected by m_oMutex
         std::string osData{};
     };
 
     std::mutex m_oMutex{};
-    std::map<std::string, std::unique_ptr<RegionInDownload>>
+    std::map<std::string, std::shared_ptr<RegionInDownload>>
         m_oMapRegionInDownload{};
 
+    // To be able to create the handle used for readahead
+    friend class VSICurlHandle;
+
   protected:
     CPLMutex *hMutex = nullptr;
 
@@ -292,17 +297,23 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     }
 
     std::shared_ptr<std::string> GetRegion(const char *pszURL,
-                                           vsi_l_offset nFileOffsetStart);
+                                           vsi_l_offset nFileOffsetStart,
+                                           bool bAllowDiskCache = false);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData,
+                   bool bAllowDiskCache = false);
 
+    std::shared_ptr<RegionInDownload>
+    StartOrJoinDownloadRegion(const std::string &osURL,
+                              vsi_l_offset startOffset, size_t nSize);
+    static std::string WaitForDownloadRegion(RegionInDownload &oRegion);
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
-                              vsi_l_offset startOffset, int nBlocks);
+                              vsi_l_offset startOffset, size_t nSize);
     void NotifyStopDownloadRegion(const std::string &osURL,
-                                  vsi_l_offset startOffset, int nBlocks,
-                                  const std::string &osData);
+                                  vsi_l_offset startOffset, size_t nSize,
+                                  const char *pData, size_t nDataSize);
 
     bool GetCachedFileProp(const char *pszURL, FileProp &oFileProp);
     void SetCachedFileProp(const char *pszURL, FileProp &oFileProp);
@@ -426,6 +437,11 @@ class VSICurlHandle : public VSIVirtualHandle
         size_t nSize = 0;
         std::vector<GByte> abyData{};
         CPLHTTPRetryContext retryContext;
+        // Set if the range is already being downloaded by another thread
+        std::shared_ptr<VSICurlFilesystemHandlerBase::RegionInDownload>
+            poJoinedDownload{};
+        // Set if other threads may wait for our download of the range
+        bool bRegisteredDownload = false;
 
         explicit AdviseReadRange(const CPLHTTPRetryParameters &oRetryParameters)
             : retryContext(oRetryParameters)
@@ -442,6 +458,31 @@ class VSICurlHandle : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    // Used by the readahead of Read() (CPL_VSIL_CURL_READAHEAD=YES)
+    bool m_bReadaheadEnabled = false;
+    std::unique_ptr<VSICurlHandle> m_poReadaheadHandle{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poReadaheadPool{};
+    bool m_bReadaheadInFlight = false;
+    vsi_l_offset m_nReadaheadOffset = 0;
+    int m_nReadaheadBlocks = 0;
+    // Set by the readahead job, and read once it is completed
+    size_t m_nReadaheadDownloaded = 0;
+    double m_dfReadaheadDuration = 0;
+    // Access pattern detection
+    vsi_l_offset m_nLastReadOffset = VSI_L_OFFSET_MAX;
+    size_t m_nLastReadSize = 0;
+    GIntBig m_nLastReadStride = 0;
+    // Estimates of the latency (duration of the fastest request, in seconds)
+    // and of the bandwidth (bytes per second).
+    double m_dfLatency = 0;
+    double m_dfBandwidth = 0;
+
+    void UpdateThroughputEstimate(size_t nBytes, double dfDuration);
+    int GetBandwidthDelayProductBlocks() const;
+    void WaitForReadahead();
+    void ScheduleReadahead(vsi_l_offset nOffset, int nBlocks);
+    void ReadaheadAfterRead(vsi_l_offset nOffset, size_t nSize);
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const std::string & /*osVerb*/,
@@ -605,6 +646,9 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
     char **GetFileList(const char *pszFilename, int nMaxFiles,
                        bool *pbGotFileList) override;
 
+    // To create the handle helpers of parallel part uploads
+    friend class VSIMultipartWriteHandle;
+
     virtual IVSIS3LikeHandleHelper *CreateHandleHelper(const char *pszURI,
                                                        bool bAllowNoObject) = 0;
 
@@ -621,6 +665,13 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 
     IVSIS3LikeFSHandler() = default;
 
+    virtual VSIDIR *OpenDirInternal(const char *pszPath, int nRecurseDepth,
+                                    const char *const *papszOptions);
+
+    bool ListDirInParallel(
+        const char *pszPath, int nThreads, const char *const *papszOptions,
+        std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries);
+
   public:
     int Unlink(const char *pszFilename) override;
     int Mkdir(const char *pszDirname, long nMode) override;
@@ -839,7 +890,25 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Used when parts are uploaded in parallel
+    // (CPL_VSIL_MULTIPART_UPLOAD_NUM_THREADS > 1)
+    struct UploadSlot
+    {
+        std::vector<GByte> abyBuffer{};
+        std::unique_ptr<IVSIS3LikeHandleHelper> poS3HandleHelper{};
+    };
+
+    int m_nMaxConcurrentUploads = 1;
+    std::mutex m_oUploadMutex{};
+    std::condition_variable m_oUploadCV{};
+    std::vector<std::unique_ptr<UploadSlot>> m_apoFreeUploadSlots{};
+    int m_nPendingUploads = 0;
+    bool m_bUploadError = false;
+    std::unique_ptr<CPLWorkerThreadPool> m_poUploadPool{};
+
     bool UploadPart();
+    bool SubmitUploadPart();
+    bool WaitForPendingUploads();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -1151,6 +1220,33 @@ class NetworkStatisticsLogger
     std::map<GIntBig, std::vector<ContextPathItem>>
         m_mapThreadIdToContextPath{};
 
+    /** Statistics collected between VSINetworkStatsBeginScope() and
+     * VSINetworkStatsEndScope(), for the requests issued by one thread.
+     */
+    struct ScopeStats
+    {
+        /** Upper bounds, in milliseconds, of the buckets of the latency
+         * histogram. An additional last bucket collects larger latencies. */
+        static constexpr int anLatencyBucketsMs[] = {
+            1, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000};
+        static constexpr int LATENCY_BUCKET_COUNT =
+            static_cast<int>(CPL_ARRAYSIZE(anLatencyBucketsMs)) + 1;
+
+        Counters counters{};
+        GIntBig nRetries = 0;
+        GIntBig nCacheHits = 0;
+        GIntBig nCacheMisses = 0;
+        GIntBig nLatencyCount = 0;
+        double dfLatencySumMs = 0;
+        double dfLatencyMaxMs = 0;
+        GIntBig anLatencyHistogram[LATENCY_BUCKET_COUNT] = {};
+
+        void AsJSON(CPLJSONObject &oJSON) const;
+    };
+
+    /** Stack of scopes opened by the current thread */
+    static thread_local std::vector<ScopeStats> tl_aoScopes;
+
     static void ReadEnabled();
 
     std::vector<Counters *> GetCountersForContext();
@@ -1187,6 +1283,16 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogRetry();
+
+    static void LogCacheAccess(bool bHit);
+
+    static void LogLatency(double dfSeconds);
+
+    static void BeginScope();
+
+    static std::string EndScope();
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -1255,6 +1361,20 @@ void VSICURLDestroyCacheFileProp();
 
 void VSICURLMultiCleanup(CURLM *hCurlMultiHandle);
 
+// On-disk cache of downloaded regions (CPL_VSIL_CURL_DISK_CACHE_DIR)
+bool VSICurlDiskCacheIsEnabled();
+std::shared_ptr<std::string> VSICurlDiskCacheGetRegion(const char *pszURL,
+                                                       vsi_l_offset nOffset);
+void VSICurlDiskCacheAddRegion(const char *pszURL, vsi_l_offset nOffset,
+                               size_t nSize, const char *pData);
+bool VSICurlDiskCacheDirListIsEnabled();
+bool VSICurlDiskCacheGetDirList(
+    const std::string &osKey,
+    std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries);
+void VSICurlDiskCacheAddDirList(
+    const std::string &osKey,
+    const std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries);
+
 //! @endcond
 
 #endif  // HAVE_CURL
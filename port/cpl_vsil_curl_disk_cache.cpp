@@ -0,0 +1,501 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  On-disk cache of regions downloaded by network file systems
+ * Author:   Even Rouault, even.rouault at spatialys.com
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even.rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+/************************************************************************/
+/*                        GetDiskCacheDirectory()                       */
+/************************************************************************/
+
+std::string GetDiskCacheDirectory()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                         GetDiskCacheMaxSize()                        */
+/************************************************************************/
+
+GIntBig GetDiskCacheMaxSize()
+{
+    const char *pszVal =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", "1GB");
+    GIntBig nVal = 0;
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(pszVal, &nVal, &bUnitSpecified) != CE_None ||
+        nVal <= 0)
+    {
+        static bool bWarned = false;
+        if (!bWarned)
+        {
+            bWarned = true;
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for CPL_VSIL_CURL_DISK_CACHE_SIZE: %s. "
+                     "Using 1GB",
+                     pszVal);
+        }
+        nVal = static_cast<GIntBig>(1024) * 1024 * 1024;
+    }
+    return nVal;
+}
+
+/************************************************************************/
+/*                         GetDirListCacheTTL()                         */
+/************************************************************************/
+
+// Number of seconds during which directory listings are cached on disk, or
+// 0 if they are not cached.
+int GetDirListCacheTTL()
+{
+    return std::max(
+        0, atoi(CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR_LIST_TTL",
+                                   "0")));
+}
+
+/************************************************************************/
+/*                          GetKeyFilename()                            */
+/************************************************************************/
+
+// Returns the name of the file of the cache entry of osKey, in a
+// sub-directory named from the first 2 hexadecimal characters of its hash.
+std::string GetKeyFilename(const std::string &osDir, const std::string &osKey,
+                           std::string *posSubDir)
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+
+    const std::string osSubDir(CPLFormFilenameSafe(
+        osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr));
+    if (posSubDir)
+        *posSubDir = osSubDir;
+    return CPLFormFilenameSafe(osSubDir.c_str(), osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                          GetEntryFilename()                          */
+/************************************************************************/
+
+// Returns the name of the file of the cache entry of a region of pszURL.
+// Returns an empty string if the identity of the remote file is unknown.
+std::string GetEntryFilename(const std::string &osDir, const char *pszURL,
+                             vsi_l_offset nOffset, std::string *posSubDir)
+{
+    cpl::FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != cpl::EXIST_YES)
+    {
+        return std::string();
+    }
+
+    std::string osKey(pszURL);
+    if (!oFileProp.ETag.empty())
+    {
+        osKey += "\nETag:";
+        osKey += oFileProp.ETag;
+    }
+    else if (oFileProp.mTime != 0 && oFileProp.bHasComputedFileSize)
+    {
+        osKey += CPLSPrintf("\nmtime:" CPL_FRMT_GIB "\nsize:" CPL_FRMT_GUIB,
+                            static_cast<GIntBig>(oFileProp.mTime),
+                            static_cast<GUIntBig>(oFileProp.fileSize));
+    }
+    else
+    {
+        // We cannot detect whether the file has been modified
+        return std::string();
+    }
+    osKey += CPLSPrintf("\noffset:" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(nOffset));
+
+    return GetKeyFilename(osDir, osKey, posSubDir);
+}
+
+/************************************************************************/
+/*                             Evict()                                  */
+/************************************************************************/
+
+// Removes the oldest entries until the total size of the cache is below
+// 90% of its maximum size. Also removes temporary files that have been
+// abandoned (process killed in the middle of writing an entry).
+void Evict(const std::string &osDir, GIntBig nMaxSize)
+{
+    std::vector<std::tuple<time_t, GIntBig, std::string>> aoEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    constexpr time_t STALE_TMP_FILE_DELAY = 3600;
+
+    const CPLStringList aosSubDirs(VSIReadDir(osDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir(
+            CPLFormFilenameSafe(osDir.c_str(), pszSubDir, nullptr));
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            if (pszFile[0] == '.')
+                continue;
+            std::string osFilename(
+                CPLFormFilenameSafe(osSubDir.c_str(), pszFile, nullptr));
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+            {
+                continue;
+            }
+            if (strstr(pszFile, ".tmp"))
+            {
+                if (sStat.st_mtime + STALE_TMP_FILE_DELAY < nNow)
+                    VSIUnlink(osFilename.c_str());
+                continue;
+            }
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            aoEntries.emplace_back(sStat.st_mtime,
+                                   static_cast<GIntBig>(sStat.st_size),
+                                   std::move(osFilename));
+        }
+    }
+
+    if (nTotalSize <= nMaxSize)
+        return;
+
+    std::sort(aoEntries.begin(), aoEntries.end());
+    const GIntBig nTargetSize = nMaxSize / 10 * 9;
+    for (const auto &[nMTime, nSize, osFilename] : aoEntries)
+    {
+        if (nTotalSize <= nTargetSize)
+            break;
+        // Another process may have already removed it
+        VSIUnlink(osFilename.c_str());
+        nTotalSize -= nSize;
+    }
+}
+
+/************************************************************************/
+/*                             WriteEntry()                             */
+/************************************************************************/
+
+// Entries are first written in a temporary file, and then renamed, so that
+// concurrent processes never see partially written entries.
+void WriteEntry(const std::string &osDir, const std::string &osSubDir,
+                const std::string &osFilename, size_t nSize, const char *pData)
+{
+    VSIStatBufL sStat;
+    if (VSIStatExL(osSubDir.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) != 0)
+    {
+        // May fail if created concurrently by another process: just
+        // check afterwards that it exists.
+        VSIMkdirRecursive(osSubDir.c_str(), 0755);
+        if (VSIStatExL(osSubDir.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) != 0)
+        {
+            static bool bWarned = false;
+            if (!bWarned)
+            {
+                bWarned = true;
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Cannot create directory %s for the network "
+                         "disk cache",
+                         osSubDir.c_str());
+            }
+            return;
+        }
+    }
+
+    static std::atomic<GUIntBig> gnCounter{0};
+    static const GUIntBig gnRandom = []()
+    {
+        std::random_device oRD;
+        return (static_cast<GUIntBig>(oRD()) << 32) | oRD();
+    }();
+    const std::string osTmpFilename(
+        osFilename + CPLSPrintf(".tmp" CPL_FRMT_GUIB "_" CPL_FRMT_GUIB, gnRandom,
+                                static_cast<GUIntBig>(++gnCounter)));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (!fp)
+        return;
+    const bool bOK = VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    if (VSIFCloseL(fp) != 0 || !bOK ||
+        VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    // Scan the cache directory at the first insertion, and then each time
+    // this process has written 10% of the maximum size. As other processes
+    // may also add entries, the size bound is only approximately honored.
+    static std::mutex goMutex;
+    static GIntBig gnWrittenSinceLastScan = -1;
+    const GIntBig nMaxSize = GetDiskCacheMaxSize();
+    bool bScan = false;
+    {
+        std::lock_guard oLock(goMutex);
+        if (gnWrittenSinceLastScan < 0 ||
+            gnWrittenSinceLastScan > nMaxSize / 10)
+        {
+            gnWrittenSinceLastScan = 0;
+            bScan = true;
+        }
+        gnWrittenSinceLastScan += static_cast<GIntBig>(nSize);
+    }
+    if (bScan)
+        Evict(osDir, nMaxSize);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VSICurlDiskCacheIsEnabled()                      */
+/************************************************************************/
+
+bool VSICurlDiskCacheIsEnabled()
+{
+    return !GetDiskCacheDirectory().empty();
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCacheGetRegion()                      */
+/************************************************************************/
+
+/** Retrieves from the on-disk cache the region starting at nOffset of the
+ * file at pszURL.
+ *
+ * The file properties of pszURL must have already been retrieved, to know
+ * its ETag or its modification time and size.
+ */
+std::shared_ptr<std::string> VSICurlDiskCacheGetRegion(const char *pszURL,
+                                                       vsi_l_offset nOffset)
+{
+    const std::string osDir(GetDiskCacheDirectory());
+    if (osDir.empty())
+        return nullptr;
+    const std::string osFilename(
+        GetEntryFilename(osDir, pszURL, nOffset, nullptr));
+    if (osFilename.empty())
+        return nullptr;
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return nullptr;
+    std::shared_ptr<std::string> poData;
+    if (VSIFSeekL(fp, 0, SEEK_END) == 0)
+    {
+        const vsi_l_offset nSize = VSIFTellL(fp);
+        if (nSize > 0 && nSize <= static_cast<vsi_l_offset>(
+                                      VSICURLGetDownloadChunkSize()) &&
+            VSIFSeekL(fp, 0, SEEK_SET) == 0)
+        {
+            poData = std::make_shared<std::string>();
+            poData->resize(static_cast<size_t>(nSize));
+            if (VSIFReadL(poData->data(), 1, poData->size(), fp) !=
+                poData->size())
+            {
+                poData.reset();
+            }
+        }
+    }
+    VSIFCloseL(fp);
+    return poData;
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCacheAddRegion()                      */
+/************************************************************************/
+
+/** Stores in the on-disk cache the region starting at nOffset of the
+ * file at pszURL.
+ */
+void VSICurlDiskCacheAddRegion(const char *pszURL, vsi_l_offset nOffset,
+                               size_t nSize, const char *pData)
+{
+    const std::string osDir(GetDiskCacheDirectory());
+    if (osDir.empty() || nSize == 0)
+        return;
+    std::string osSubDir;
+    const std::string osFilename(
+        GetEntryFilename(osDir, pszURL, nOffset, &osSubDir));
+    if (osFilename.empty())
+        return;
+
+    VSIStatBufL sStat;
+    if (VSIStatExL(osFilename.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+        return;
+
+    WriteEntry(osDir, osSubDir, osFilename, nSize, pData);
+}
+
+/************************************************************************/
+/*                  VSICurlDiskCacheDirListIsEnabled()                  */
+/************************************************************************/
+
+bool VSICurlDiskCacheDirListIsEnabled()
+{
+    return VSICurlDiskCacheIsEnabled() && GetDirListCacheTTL() > 0;
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCacheGetDirList()                     */
+/************************************************************************/
+
+/** Retrieves from the on-disk cache the entries of the directory listing
+ * identified by osKey, if it has been stored less than
+ * CPL_VSIL_CURL_DISK_CACHE_DIR_LIST_TTL seconds ago.
+ */
+bool VSICurlDiskCacheGetDirList(
+    const std::string &osKey,
+    std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries)
+{
+    const std::string osDir(GetDiskCacheDirectory());
+    const int nTTL = GetDirListCacheTTL();
+    if (osDir.empty() || nTTL <= 0)
+        return false;
+    const std::string osKeyWithType("dirlist:" + osKey);
+    const std::string osFilename(GetKeyFilename(osDir, osKeyWithType, nullptr));
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+        sStat.st_mtime + nTTL < time(nullptr))
+    {
+        return false;
+    }
+
+    CPLJSONDocument oDoc;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        if (!oDoc.Load(osFilename))
+            return false;
+    }
+    const auto oRoot = oDoc.GetRoot();
+    // Protects against hash collisions
+    if (oRoot.GetString("key") != osKeyWithType)
+        return false;
+    const auto oEntries = oRoot.GetArray("entries");
+    if (!oEntries.IsValid())
+        return false;
+
+    apoEntries.clear();
+    apoEntries.reserve(oEntries.Size());
+    for (const auto &oEntry : oEntries)
+    {
+        auto poEntry = std::make_unique<VSIDIREntry>();
+        poEntry->pszName = CPLStrdup(oEntry.GetString("name").c_str());
+        if (oEntry.GetObj("mode").IsValid())
+        {
+            poEntry->nMode = oEntry.GetInteger("mode");
+            poEntry->bModeKnown = true;
+        }
+        if (oEntry.GetObj("size").IsValid())
+        {
+            poEntry->nSize = static_cast<GUIntBig>(oEntry.GetLong("size"));
+            poEntry->bSizeKnown = true;
+        }
+        if (oEntry.GetObj("mtime").IsValid())
+        {
+            poEntry->nMTime = oEntry.GetLong("mtime");
+            poEntry->bMTimeKnown = true;
+        }
+        for (const auto &oExtra : oEntry.GetObj("extra").GetChildren())
+        {
+            poEntry->papszExtra =
+                CSLSetNameValue(poEntry->papszExtra, oExtra.GetName().c_str(),
+                                oExtra.ToString().c_str());
+        }
+        apoEntries.push_back(std::move(poEntry));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCacheAddDirList()                     */
+/************************************************************************/
+
+/** Stores in the on-disk cache the entries of the directory listing
+ * identified by osKey.
+ */
+void VSICurlDiskCacheAddDirList(
+    const std::string &osKey,
+    const std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries)
+{
+    const std::string osDir(GetDiskCacheDirectory());
+    if (osDir.empty() || GetDirListCacheTTL() <= 0)
+        return;
+    const std::string osKeyWithType("dirlist:" + osKey);
+    std::string osSubDir;
+    const std::string osFilename(
+        GetKeyFilename(osDir, osKeyWithType, &osSubDir));
+
+    CPLJSONDocument oDoc;
+    auto oRoot = oDoc.GetRoot();
+    oRoot.Add("key", osKeyWithType);
+    CPLJSONArray oEntries;
+    for (const auto &poEntry : apoEntries)
+    {
+        CPLJSONObject oEntry;
+        oEntry.Add("name", poEntry->pszName);
+        if (poEntry->bModeKnown)
+            oEntry.Add("mode", poEntry->nMode);
+        if (poEntry->bSizeKnown)
+            oEntry.Add("size", static_cast<GInt64>(poEntry->nSize));
+        if (poEntry->bMTimeKnown)
+            oEntry.Add("mtime", static_cast<GInt64>(poEntry->nMTime));
+        if (poEntry->papszExtra)
+        {
+            CPLJSONObject oExtra;
+            for (const auto &[pszKey, pszValue] : cpl::IterateNameValue(
+                     static_cast<CSLConstList>(poEntry->papszExtra)))
+            {
+                oExtra.Add(pszKey, pszValue);
+            }
+            oEntry.Add("extra", oExtra);
+        }
+        oEntries.Add(oEntry);
+    }
+    oRoot.Add("entries", oEntries);
+
+    // Always overwrite existing entries, which may have expired
+    const std::string osContent(oDoc.SaveAsString());
+    WriteEntry(osDir, osSubDir, osFilename, osContent.size(),
+               osContent.data());
+}
+
+//! @endcond
+
+#endif  // HAVE_CURL
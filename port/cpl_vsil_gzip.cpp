@@ -92,6 +92,7 @@
 #include <utility>
 #include <vector>
 
+#include "cpl_compressor_priv.h"
 #include "cpl_error.h"
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
@@ -130,6 +131,372 @@ constexpr int gz_magic[2] = {0x1f, 0x8b};  // gzip magic header
 
 // #define ENABLE_DEBUG 1
 
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSIGZipIndex                                */
+/* ==================================================================== */
+/************************************************************************/
+
+/* A .gzidx file is a sidecar index of "access points" of a .gz file, built
+   by VSIGZipBuildIndex(), in the spirit of the zran.c example of zlib.
+   Each access point is located at a deflate block boundary, and stores
+   the 32 KB of uncompressed data that precede it, so that decompression can
+   be started from it with a fresh inflate stream.
+
+   Layout (all integers are little-endian):
+   - header: "VSIGZIDX" magic, uint32 version, uint32 reserved
+   - the windows of the access points
+   - the table of access points, GZIP_INDEX_POINT_SIZE bytes each:
+     uint64 compressed offset, uint64 uncompressed offset,
+     uint64 offset of the window in the index, uint32 CRC of the uncompressed
+     data of the gzip member before the access point, uint16 size of the
+     window, uint8 number of bits of the byte before the compressed offset
+     that belong to the access point, uint8 reserved
+   - footer: uint64 size and int64 modification time of the .gz file,
+     uint64 uncompressed size, uint64 span, uint64 offset of the table,
+     uint32 number of access points, uint32 reserved
+*/
+
+constexpr const char *GZIP_INDEX_EXTENSION = ".gzidx";
+constexpr const char GZIP_INDEX_MAGIC[] = "VSIGZIDX";
+constexpr uint32_t GZIP_INDEX_VERSION = 1;
+constexpr int GZIP_INDEX_HEADER_SIZE = 16;
+constexpr int GZIP_INDEX_POINT_SIZE = 32;
+constexpr int GZIP_INDEX_FOOTER_SIZE = 48;
+constexpr int GZIP_INDEX_WINDOW_SIZE = 32768;
+constexpr vsi_l_offset GZIP_INDEX_DEFAULT_SPAN = 8 * 1024 * 1024;
+
+namespace
+{
+struct VSIGZipAccessPoint
+{
+    vsi_l_offset nCompressedOffset = 0;
+    vsi_l_offset nUncompressedOffset = 0;
+    vsi_l_offset nWindowOffset = 0;
+    uLong nCRC = 0;
+    int nWindowSize = 0;
+    int nBits = 0;
+};
+
+struct VSIGZipIndex
+{
+    std::string osFilename{};
+    vsi_l_offset nUncompressedSize = 0;
+    vsi_l_offset nSpan = 0;
+    std::vector<VSIGZipAccessPoint> aoPoints{};
+
+    const VSIGZipAccessPoint *GetPointBefore(vsi_l_offset nOffset) const;
+    bool PrimeStream(z_stream *pStream, VSIVirtualHandle *poGZFile,
+                     const VSIGZipAccessPoint &oPoint) const;
+
+    static std::shared_ptr<VSIGZipIndex> Load(const char *pszGZFilename,
+                                              vsi_l_offset nCompressedSize);
+};
+
+uint64_t GetUInt64LSB(const GByte *pabyData)
+{
+    uint64_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR64(&nVal);
+    return nVal;
+}
+
+uint32_t GetUInt32LSB(const GByte *pabyData)
+{
+    uint32_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR32(&nVal);
+    return nVal;
+}
+
+void SetUInt64LSB(GByte *pabyData, uint64_t nVal)
+{
+    CPL_LSBPTR64(&nVal);
+    memcpy(pabyData, &nVal, sizeof(nVal));
+}
+
+void SetUInt32LSB(GByte *pabyData, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyData, &nVal, sizeof(nVal));
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VSIGZipIndex::GetPointBefore()                   */
+/************************************************************************/
+
+// Returns the last access point whose uncompressed offset is <= nOffset
+const VSIGZipAccessPoint *
+VSIGZipIndex::GetPointBefore(vsi_l_offset nOffset) const
+{
+    auto oIter = std::upper_bound(
+        aoPoints.begin(), aoPoints.end(), nOffset,
+        [](vsi_l_offset nVal, const VSIGZipAccessPoint &oPoint)
+        { return nVal < oPoint.nUncompressedOffset; });
+    if (oIter == aoPoints.begin())
+        return nullptr;
+    --oIter;
+    return &(*oIter);
+}
+
+/************************************************************************/
+/*                      VSIGZipIndex::PrimeStream()                     */
+/************************************************************************/
+
+// Prepares a raw inflate stream (just initialized or reset) to decompress
+// from the access point, and positions poGZFile at the compressed offset of
+// the access point.
+bool VSIGZipIndex::PrimeStream(z_stream *pStream, VSIVirtualHandle *poGZFile,
+                               const VSIGZipAccessPoint &oPoint) const
+{
+    std::vector<GByte> abyWindow;
+    if (oPoint.nWindowSize > 0)
+    {
+        VSIVirtualHandleUniquePtr fpIndex(VSIFOpenL(osFilename.c_str(), "rb"));
+        abyWindow.resize(oPoint.nWindowSize);
+        if (!fpIndex || fpIndex->Seek(oPoint.nWindowOffset, SEEK_SET) != 0 ||
+            fpIndex->Read(abyWindow.data(), 1, abyWindow.size()) !=
+                abyWindow.size())
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read window from %s",
+                     osFilename.c_str());
+            return false;
+        }
+    }
+
+    if (poGZFile->Seek(oPoint.nCompressedOffset - (oPoint.nBits ? 1 : 0),
+                       SEEK_SET) != 0)
+    {
+        return false;
+    }
+    if (oPoint.nBits)
+    {
+        GByte byVal = 0;
+        if (poGZFile->Read(&byVal, 1, 1) != 1 ||
+            inflatePrime(pStream, oPoint.nBits, byVal >> (8 - oPoint.nBits)) !=
+                Z_OK)
+        {
+            return false;
+        }
+    }
+    return abyWindow.empty() ||
+           inflateSetDictionary(pStream, abyWindow.data(),
+                                static_cast<uInt>(abyWindow.size())) == Z_OK;
+}
+
+/************************************************************************/
+/*                         VSIGZipIndex::Load()                         */
+/************************************************************************/
+
+// Loads the .gzidx file of pszGZFilename, if it exists and matches the
+// current size and modification time of the .gz file.
+std::shared_ptr<VSIGZipIndex>
+VSIGZipIndex::Load(const char *pszGZFilename, vsi_l_offset nCompressedSize)
+{
+    std::string osIndexFilename(pszGZFilename);
+    osIndexFilename += GZIP_INDEX_EXTENSION;
+
+    VSIStatBufL sStat;
+    if (VSIStatExL(osIndexFilename.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) != 0)
+        return nullptr;
+    if (VSIStatL(pszGZFilename, &sStat) != 0)
+        return nullptr;
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+
+    GByte abyHeader[GZIP_INDEX_HEADER_SIZE];
+    GByte abyFooter[GZIP_INDEX_FOOTER_SIZE];
+    if (fp->Read(abyHeader, 1, sizeof(abyHeader)) != sizeof(abyHeader) ||
+        memcmp(abyHeader, GZIP_INDEX_MAGIC, 8) != 0 ||
+        GetUInt32LSB(abyHeader + 8) != GZIP_INDEX_VERSION ||
+        fp->Seek(0, SEEK_END) != 0 ||
+        fp->Tell() < GZIP_INDEX_HEADER_SIZE + GZIP_INDEX_FOOTER_SIZE)
+    {
+        CPLDebug("GZIP", "%s is not a valid index", osIndexFilename.c_str());
+        return nullptr;
+    }
+    const vsi_l_offset nIndexSize = fp->Tell();
+    if (fp->Seek(nIndexSize - GZIP_INDEX_FOOTER_SIZE, SEEK_SET) != 0 ||
+        fp->Read(abyFooter, 1, sizeof(abyFooter)) != sizeof(abyFooter))
+    {
+        return nullptr;
+    }
+
+    if (GetUInt64LSB(abyFooter) != nCompressedSize ||
+        static_cast<GIntBig>(GetUInt64LSB(abyFooter + 8)) !=
+            static_cast<GIntBig>(sStat.st_mtime))
+    {
+        CPLDebug("GZIP", "Ignoring %s, built for another version of %s",
+                 osIndexFilename.c_str(), pszGZFilename);
+        return nullptr;
+    }
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    poIndex->osFilename = std::move(osIndexFilename);
+    poIndex->nUncompressedSize = GetUInt64LSB(abyFooter + 16);
+    poIndex->nSpan = GetUInt64LSB(abyFooter + 24);
+    const vsi_l_offset nTableOffset = GetUInt64LSB(abyFooter + 32);
+    const uint32_t nPoints = GetUInt32LSB(abyFooter + 40);
+    if (nTableOffset < GZIP_INDEX_HEADER_SIZE ||
+        nTableOffset + static_cast<vsi_l_offset>(nPoints) *
+                               GZIP_INDEX_POINT_SIZE +
+                           GZIP_INDEX_FOOTER_SIZE !=
+            nIndexSize)
+    {
+        CPLDebug("GZIP", "%s is corrupted", poIndex->osFilename.c_str());
+        return nullptr;
+    }
+
+    std::vector<GByte> abyTable;
+    try
+    {
+        abyTable.resize(static_cast<size_t>(nPoints) * GZIP_INDEX_POINT_SIZE);
+        poIndex->aoPoints.resize(nPoints);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    if (fp->Seek(nTableOffset, SEEK_SET) != 0 ||
+        fp->Read(abyTable.data(), 1, abyTable.size()) != abyTable.size())
+    {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const GByte *pabyPoint = abyTable.data() + i * GZIP_INDEX_POINT_SIZE;
+        auto &oPoint = poIndex->aoPoints[i];
+        oPoint.nCompressedOffset = GetUInt64LSB(pabyPoint);
+        oPoint.nUncompressedOffset = GetUInt64LSB(pabyPoint + 8);
+        oPoint.nWindowOffset = GetUInt64LSB(pabyPoint + 16);
+        oPoint.nCRC = GetUInt32LSB(pabyPoint + 24);
+        oPoint.nWindowSize = pabyPoint[28] | (pabyPoint[29] << 8);
+        oPoint.nBits = pabyPoint[30];
+        if (oPoint.nCompressedOffset > nCompressedSize ||
+            (oPoint.nBits > 0 && oPoint.nCompressedOffset == 0) ||
+            oPoint.nBits >= 8 || oPoint.nWindowSize > GZIP_INDEX_WINDOW_SIZE ||
+            oPoint.nWindowOffset + oPoint.nWindowSize > nTableOffset ||
+            oPoint.nUncompressedOffset > poIndex->nUncompressedSize ||
+            (i > 0 && oPoint.nUncompressedOffset <
+                          poIndex->aoPoints[i - 1].nUncompressedOffset))
+        {
+            CPLDebug("GZIP", "%s is corrupted", poIndex->osFilename.c_str());
+            return nullptr;
+        }
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                  VSIGZipDecompressFromAccessPoint()                  */
+/************************************************************************/
+
+// Decompresses nToRead bytes, nToSkip bytes after the access point, using
+// a dedicated handle on the .gz file. Used for parallel decompression.
+// Note that the CRC of the decompressed data is not checked.
+static bool VSIGZipDecompressFromAccessPoint(const char *pszGZFilename,
+                                             const VSIGZipIndex &oIndex,
+                                             const VSIGZipAccessPoint &oPoint,
+                                             vsi_l_offset nToSkip,
+                                             GByte *pabyDst, size_t nToRead)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszGZFilename, "rb"));
+    if (!fp)
+        return false;
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return false;
+
+    bool bOK = oIndex.PrimeStream(&sStream, fp.get(), oPoint);
+    std::vector<GByte> abyIn, abyDiscard;
+    try
+    {
+        abyIn.resize(Z_BUFSIZE);
+        if (nToSkip)
+            abyDiscard.resize(Z_BUFSIZE);
+    }
+    catch (const std::exception &)
+    {
+        bOK = false;
+    }
+
+    const auto FillInput = [&sStream, &fp, &abyIn]()
+    {
+        if (sStream.avail_in == 0)
+        {
+            sStream.next_in = abyIn.data();
+            sStream.avail_in =
+                static_cast<uInt>(fp->Read(abyIn.data(), 1, abyIn.size()));
+        }
+        return sStream.avail_in > 0;
+    };
+
+    bool bRawDeflate = true;
+    while (bOK && nToRead > 0)
+    {
+        if (!FillInput())
+        {
+            bOK = false;
+            break;
+        }
+
+        const bool bSkipping = nToSkip > 0;
+        const uInt nAvailOut =
+            bSkipping ? static_cast<uInt>(std::min<vsi_l_offset>(
+                            nToSkip, abyDiscard.size()))
+                      : static_cast<uInt>(std::min<size_t>(nToRead, UINT_MAX));
+        sStream.next_out = bSkipping ? abyDiscard.data() : pabyDst;
+        sStream.avail_out = nAvailOut;
+        const int ret = inflate(&sStream, Z_NO_FLUSH);
+        const uInt nProduced = nAvailOut - sStream.avail_out;
+        if (bSkipping)
+        {
+            nToSkip -= nProduced;
+        }
+        else
+        {
+            pabyDst += nProduced;
+            nToRead -= nProduced;
+        }
+
+        if (ret == Z_STREAM_END)
+        {
+            // End of a gzip member. In raw mode, skip the CRC and size
+            // trailer ourselves. The next members are decoded in gzip mode.
+            if (bRawDeflate)
+            {
+                for (int i = 0; bOK && i < 8; ++i)
+                {
+                    bOK = FillInput();
+                    if (bOK)
+                    {
+                        sStream.next_in++;
+                        sStream.avail_in--;
+                    }
+                }
+                bRawDeflate = false;
+            }
+            if (bOK && nToRead > 0 &&
+                inflateReset2(&sStream, MAX_WBITS + 16) != Z_OK)
+            {
+                bOK = false;
+            }
+        }
+        else if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            bOK = false;
+        }
+    }
+    inflateEnd(&sStream);
+    return bOK;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIGZipHandle                                  */
@@ -180,11 +547,19 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    // Access points from the .gzidx file, if any
+    std::shared_ptr<VSIGZipIndex> m_poIndex{};
+    int m_nIndexThreads = 0;
+    bool m_bInParallelRead = false;
+    std::unique_ptr<CPLWorkerThreadPool> m_poIndexPool{};
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
     int gzrewind();
     uLong getLong();
+    bool RestoreFromAccessPoint(const VSIGZipAccessPoint &oPoint);
+    bool ReadParallel(GByte *pabyBuffer, size_t nToRead, size_t &nRead);
 
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipHandle)
 
@@ -239,6 +614,13 @@ class VSIGZipHandle final : public VSIVirtualHandle
     {
         m_bCanSaveInfo = false;
     }
+
+    void LoadIndex();
+
+    bool HasIndex() const
+    {
+        return m_poIndex != nullptr;
+    }
 };
 
 #ifdef ENABLE_DEFLATE64
@@ -406,6 +788,8 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
 
+    poHandle->m_poIndex = m_poIndex;
+
     // Most important: duplicate the snapshots!
 
     for (unsigned int i = 0; i < m_compressed_size / snapshot_byte_interval + 1;
@@ -855,6 +1239,28 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         return false;
     }
 
+    // Jump to the closest access point of the index, if it is closer than
+    // the current position
+    if (m_poIndex)
+    {
+        const vsi_l_offset nTarget = out + offset;
+        const auto poPoint = m_poIndex->GetPointBefore(nTarget);
+        if (poPoint && poPoint->nUncompressedOffset > out)
+        {
+#ifdef ENABLE_DEBUG
+            CPLDebug("GZIP",
+                     "using access point at uncompressed offset " CPL_FRMT_GUIB,
+                     poPoint->nUncompressedOffset);
+#endif
+            if (!RestoreFromAccessPoint(*poPoint) && gzrewind() < 0)
+            {
+                CPL_VSIL_GZ_RETURN(FALSE);
+                return false;
+            }
+            offset = nTarget - out;
+        }
+    }
+
     for (unsigned int i = 0; i < m_compressed_size / snapshot_byte_interval + 1;
          i++)
     {
@@ -1016,6 +1422,15 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
 
     const unsigned len =
         static_cast<unsigned int>(nSize) * static_cast<unsigned int>(nMemb);
+
+    if (m_poIndex && !m_bInParallelRead && len > m_poIndex->nSpan &&
+        !m_transparent)
+    {
+        size_t nRead = 0;
+        if (ReadParallel(static_cast<GByte *>(buf), len, nRead))
+            return nRead / nSize;
+    }
+
     Bytef *pStart =
         static_cast<Bytef *>(buf);  // Start off point for crc computation.
     // == stream.next_out but not forced far (for MSDOS).
@@ -1222,6 +1637,158 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
     return ret;
 }
 
+/************************************************************************/
+/*                             LoadIndex()                              */
+/************************************************************************/
+
+void VSIGZipHandle::LoadIndex()
+{
+    if (!m_pszBaseFileName ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_USE_INDEX", "YES")))
+    {
+        return;
+    }
+    m_poIndex = VSIGZipIndex::Load(m_pszBaseFileName, m_compressed_size);
+    if (m_poIndex && m_uncompressed_size == 0)
+        m_uncompressed_size = m_poIndex->nUncompressedSize;
+}
+
+/************************************************************************/
+/*                       RestoreFromAccessPoint()                       */
+/************************************************************************/
+
+bool VSIGZipHandle::RestoreFromAccessPoint(const VSIGZipAccessPoint &oPoint)
+{
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    if (inflateReset(&stream) != Z_OK ||
+        !m_poIndex->PrimeStream(&stream, m_poBaseHandle, oPoint))
+    {
+        return false;
+    }
+    z_err = Z_OK;
+    z_eof = 0;
+    m_bEOF = false;
+    m_transparent = 0;
+    crc = oPoint.nCRC;
+    in = oPoint.nCompressedOffset - startOff;
+    out = oPoint.nUncompressedOffset;
+    return true;
+}
+
+/************************************************************************/
+/*                            ReadParallel()                            */
+/************************************************************************/
+
+// Splits a large read at the access points of the index, and decompresses
+// the pieces in parallel. The last piece is decompressed by this handle, so
+// that it ends up positioned after the requested range.
+// Returns false if the read cannot or should not be parallelized.
+bool VSIGZipHandle::ReadParallel(GByte *pabyBuffer, size_t nToRead,
+                                 size_t &nRead)
+{
+    if (m_nIndexThreads == 0)
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        m_nIndexThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszThreads);
+        m_nIndexThreads = std::max(1, std::min(128, m_nIndexThreads));
+    }
+    if (m_nIndexThreads <= 1)
+        return false;
+
+    const vsi_l_offset nStart = out;
+    const vsi_l_offset nEnd =
+        std::min(nStart + nToRead, m_poIndex->nUncompressedSize);
+    if (nEnd <= nStart)
+        return false;
+
+    // Access points strictly inside the requested range split it in pieces
+    const auto &aoPoints = m_poIndex->aoPoints;
+    std::vector<const VSIGZipAccessPoint *> apoSplitPoints;
+    for (auto oIter = std::upper_bound(
+             aoPoints.begin(), aoPoints.end(), nStart,
+             [](vsi_l_offset nVal, const VSIGZipAccessPoint &oPoint)
+             { return nVal < oPoint.nUncompressedOffset; });
+         oIter != aoPoints.end() && oIter->nUncompressedOffset < nEnd; ++oIter)
+    {
+        apoSplitPoints.push_back(&(*oIter));
+    }
+    if (apoSplitPoints.empty())
+        return false;
+
+    if (!m_poIndexPool)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(m_nIndexThreads, nullptr, nullptr, false))
+        {
+            m_nIndexThreads = 1;
+            return false;
+        }
+        m_poIndexPool = std::move(poPool);
+    }
+
+    std::mutex oMutex;
+    bool bOK = true;
+    const std::string osGZFilename(m_pszBaseFileName);
+    const VSIGZipIndex &oIndex = *m_poIndex;
+    vsi_l_offset nPieceStart = nStart;
+    for (const auto *poSplitPoint : apoSplitPoints)
+    {
+        const auto poStartPoint = oIndex.GetPointBefore(nPieceStart);
+        CPLAssert(poStartPoint);
+        const vsi_l_offset nPieceEnd = poSplitPoint->nUncompressedOffset;
+        GByte *pabyDst = pabyBuffer + static_cast<size_t>(nPieceStart - nStart);
+        const size_t nPieceSize = static_cast<size_t>(nPieceEnd - nPieceStart);
+        const vsi_l_offset nToSkip =
+            nPieceStart - poStartPoint->nUncompressedOffset;
+        const auto task = [&oMutex, &bOK, &osGZFilename, &oIndex, poStartPoint,
+                           nToSkip, pabyDst, nPieceSize]()
+        {
+            if (!VSIGZipDecompressFromAccessPoint(osGZFilename.c_str(), oIndex,
+                                                  *poStartPoint, nToSkip,
+                                                  pabyDst, nPieceSize))
+            {
+                std::lock_guard oLock(oMutex);
+                bOK = false;
+            }
+        };
+        if (!m_poIndexPool->SubmitJob(task))
+        {
+            std::lock_guard oLock(oMutex);
+            bOK = false;
+        }
+        nPieceStart = nPieceEnd;
+    }
+
+    // Decompress the last piece ourselves, which also sets the state of the
+    // stream at the end of the requested range.
+    size_t nLastPieceRead = 0;
+    const size_t nLastPieceOffset = static_cast<size_t>(nPieceStart - nStart);
+    m_bInParallelRead = true;
+    if (gzseek(nPieceStart, SEEK_SET))
+    {
+        nLastPieceRead = Read(pabyBuffer + nLastPieceOffset, 1,
+                              nToRead - nLastPieceOffset);
+    }
+    m_poIndexPool->WaitCompletion();
+
+    if (bOK && out == nPieceStart + nLastPieceRead)
+    {
+        nRead = nLastPieceOffset + nLastPieceRead;
+    }
+    else
+    {
+        CPLDebug("GZIP", "Parallel decompression failed. Retrying serially");
+        nRead = 0;
+        if (gzseek(nStart, SEEK_SET))
+            nRead = Read(pabyBuffer, 1, nToRead);
+    }
+    m_bInParallelRead = false;
+    return true;
+}
+
 /************************************************************************/
 /*                              getLong()                               */
 /************************************************************************/
@@ -3116,7 +3683,12 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
     {
         VSIGZipHandle *poHandle = poHandleLastGZipFile->Duplicate();
         if (poHandle)
+        {
+            // The index may have been built after the cached handle
+            if (!poHandle->HasIndex())
+                poHandle->LoadIndex();
             return poHandle;
+        }
     }
 #else
     CPL_IGNORE_RET_VAL(pszAccess);
@@ -3151,6 +3723,7 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
         delete poHandle;
         return nullptr;
     }
+    poHandle->LoadIndex();
     return poHandle;
 }
 
@@ -3276,15 +3849,285 @@ const char *VSIGZipFilesystemHandler::GetOptions()
 {
     return "<Options>"
            "  <Option name='GDAL_NUM_THREADS' type='string' "
-           "description='Number of threads for compression. Either a integer "
+           "description='Number of threads for compression, and for "
+           "decompression when a .gzidx index is available. Either a integer "
            "or ALL_CPUS'/>"
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
+           "  <Option name='CPL_VSIL_GZIP_USE_INDEX' type='boolean' "
+           "description='Whether to use a .gzidx index when it exists' "
+           "default='YES'/>"
            "</Options>";
 }
 
 //! @endcond
+/************************************************************************/
+/*                         VSIGZipBuildIndex()                          */
+/************************************************************************/
+
+/**
+ * \brief Build an index of access points of a .gz file.
+ *
+ * The index is written in a sidecar file, by default with the same name as
+ * the .gz file and a .gzidx extension, which is automatically used by
+ * /vsigzip/ when it exists (unless the CPL_VSIL_GZIP_USE_INDEX configuration
+ * option is set to NO). It then allows seeking to any place of the
+ * uncompressed stream by decompressing at most SPAN bytes, and large reads
+ * to be decompressed by several threads (controlled by the GDAL_NUM_THREADS
+ * configuration option).
+ *
+ * Each access point uses roughly 32 KB in the index. Building the index
+ * requires one sequential decompression of the whole file. The index is
+ * ignored if the size or the modification time of the .gz file changes.
+ *
+ * Options supported are:
+ * <ul>
+ * <li>INDEX_FILENAME=filename: name of the index file. Note that only
+ * indexes named after the .gz file are automatically used.</li>
+ * <li>SPAN=size: minimum number of uncompressed bytes between two access
+ * points. Memory units may be specified. Defaults to 8MB.</li>
+ * </ul>
+ *
+ * @param pszFilename Name of the .gz file, with or without the /vsigzip/
+ * prefix.
+ * @param papszOptions NULL or a NULL terminated list of options.
+ * @param pProgressFunc Progress callback, or NULL.
+ * @param pProgressData User data of progress callback, or NULL.
+ * @return 0 on success.
+ * @since GDAL 3.12
+ */
+int VSIGZipBuildIndex(const char *pszFilename,
+                      const char *const *papszOptions,
+                      GDALProgressFunc pProgressFunc, void *pProgressData)
+{
+    const char *pszGZFilename = STARTS_WITH_CI(pszFilename, "/vsigzip/")
+                                    ? pszFilename + strlen("/vsigzip/")
+                                    : pszFilename;
+    const std::string osIndexFilename(CSLFetchNameValueDef(
+        papszOptions, "INDEX_FILENAME",
+        (std::string(pszGZFilename) + GZIP_INDEX_EXTENSION).c_str()));
+
+    vsi_l_offset nSpan = GZIP_INDEX_DEFAULT_SPAN;
+    if (const char *pszSpan = CSLFetchNameValue(papszOptions, "SPAN"))
+    {
+        GIntBig nVal = 0;
+        if (CPLParseMemorySize(pszSpan, &nVal, nullptr) != CE_None ||
+            nVal < GZIP_INDEX_WINDOW_SIZE)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for SPAN: %s. Must be at least %d bytes",
+                     pszSpan, GZIP_INDEX_WINDOW_SIZE);
+            return -1;
+        }
+        nSpan = static_cast<vsi_l_offset>(nVal);
+    }
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszGZFilename, &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s", pszGZFilename);
+        return -1;
+    }
+    const vsi_l_offset nCompressedSize =
+        static_cast<vsi_l_offset>(sStat.st_size);
+
+    VSIVirtualHandleUniquePtr fpIn(VSIFOpenL(pszGZFilename, "rb"));
+    if (!fpIn)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s", pszGZFilename);
+        return -1;
+    }
+    VSIVirtualHandleUniquePtr fpOut(VSIFOpenL(osIndexFilename.c_str(), "wb"));
+    if (!fpOut)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osIndexFilename.c_str());
+        return -1;
+    }
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    // Only accept the gzip format, and not the zlib one
+    if (inflateInit2(&sStream, MAX_WBITS + 16) != Z_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "inflateInit2() failed");
+        return -1;
+    }
+
+    std::vector<GByte> abyIn, abyOut, abyWindow;
+    try
+    {
+        abyIn.resize(Z_BUFSIZE);
+        abyOut.resize(Z_BUFSIZE);
+        abyWindow.resize(GZIP_INDEX_WINDOW_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        inflateEnd(&sStream);
+        return -1;
+    }
+
+    GByte abyHeader[GZIP_INDEX_HEADER_SIZE] = {};
+    memcpy(abyHeader, GZIP_INDEX_MAGIC, 8);
+    SetUInt32LSB(abyHeader + 8, GZIP_INDEX_VERSION);
+    bool bOK = fpOut->Write(abyHeader, 1, sizeof(abyHeader)) ==
+               sizeof(abyHeader);
+    vsi_l_offset nIndexOffset = sizeof(abyHeader);
+
+    std::vector<VSIGZipAccessPoint> aoPoints;
+    vsi_l_offset nTotalIn = 0;
+    vsi_l_offset nTotalOut = 0;
+    bool bFinished = false;
+    const auto FillInput = [&sStream, &fpIn, &abyIn]()
+    {
+        if (sStream.avail_in == 0)
+        {
+            sStream.next_in = abyIn.data();
+            sStream.avail_in =
+                static_cast<uInt>(fpIn->Read(abyIn.data(), 1, abyIn.size()));
+        }
+        return sStream.avail_in > 0;
+    };
+
+    while (bOK && !bFinished)
+    {
+        if (sStream.avail_in == 0)
+        {
+            if (!FillInput())
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "%s is truncated",
+                         pszGZFilename);
+                bOK = false;
+                break;
+            }
+            if (pProgressFunc &&
+                !pProgressFunc(static_cast<double>(nTotalIn) /
+                                   std::max<vsi_l_offset>(1, nCompressedSize),
+                               "", pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "Interrupted by user");
+                bOK = false;
+                break;
+            }
+        }
+
+        // The decompressed data itself is not needed: zlib keeps the last
+        // 32 KB in its window, that we retrieve with inflateGetDictionary()
+        sStream.next_out = abyOut.data();
+        sStream.avail_out = static_cast<uInt>(abyOut.size());
+        const uInt nAvailInBefore = sStream.avail_in;
+        const int ret = inflate(&sStream, Z_BLOCK);
+        nTotalIn += nAvailInBefore - sStream.avail_in;
+        nTotalOut += abyOut.size() - sStream.avail_out;
+
+        if (ret == Z_STREAM_END)
+        {
+            // Check for a concatenated gzip member
+            if (!FillInput())
+            {
+                bFinished = true;
+            }
+            else if (sStream.next_in[0] != gz_magic[0] ||
+                     inflateReset2(&sStream, MAX_WBITS + 16) != Z_OK)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "%s has trailing data after the last gzip member",
+                         pszGZFilename);
+                bOK = false;
+            }
+            continue;
+        }
+        else if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decompression of %s failed (z_err = %d)", pszGZFilename,
+                     ret);
+            bOK = false;
+            break;
+        }
+
+        // At a deflate block boundary (or just after a gzip header), that is
+        // not at the end of the last block of a member?
+        if ((sStream.data_type & 128) != 0 && (sStream.data_type & 64) == 0 &&
+            (aoPoints.empty() ||
+             nTotalOut - aoPoints.back().nUncompressedOffset >= nSpan))
+        {
+            VSIGZipAccessPoint oPoint;
+            oPoint.nCompressedOffset = nTotalIn;
+            oPoint.nUncompressedOffset = nTotalOut;
+            oPoint.nBits = sStream.data_type & 7;
+            // In gzip mode, adler is the CRC32 of the data of the member
+            oPoint.nCRC = sStream.adler;
+            uInt nWindowSize = static_cast<uInt>(abyWindow.size());
+            if (inflateGetDictionary(&sStream, abyWindow.data(),
+                                     &nWindowSize) != Z_OK)
+            {
+                bOK = false;
+                break;
+            }
+            oPoint.nWindowSize = static_cast<int>(nWindowSize);
+            oPoint.nWindowOffset = nIndexOffset;
+            bOK = fpOut->Write(abyWindow.data(), 1, nWindowSize) ==
+                  nWindowSize;
+            nIndexOffset += nWindowSize;
+            aoPoints.push_back(oPoint);
+        }
+    }
+    inflateEnd(&sStream);
+
+    if (bOK && aoPoints.size() > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too many access points");
+        bOK = false;
+    }
+
+    if (bOK)
+    {
+        std::vector<GByte> abyTable(aoPoints.size() * GZIP_INDEX_POINT_SIZE);
+        for (size_t i = 0; i < aoPoints.size(); ++i)
+        {
+            const auto &oPoint = aoPoints[i];
+            GByte *pabyPoint = abyTable.data() + i * GZIP_INDEX_POINT_SIZE;
+            SetUInt64LSB(pabyPoint, oPoint.nCompressedOffset);
+            SetUInt64LSB(pabyPoint + 8, oPoint.nUncompressedOffset);
+            SetUInt64LSB(pabyPoint + 16, oPoint.nWindowOffset);
+            SetUInt32LSB(pabyPoint + 24, static_cast<uint32_t>(oPoint.nCRC));
+            pabyPoint[28] = static_cast<GByte>(oPoint.nWindowSize & 0xff);
+            pabyPoint[29] = static_cast<GByte>(oPoint.nWindowSize >> 8);
+            pabyPoint[30] = static_cast<GByte>(oPoint.nBits);
+        }
+
+        GByte abyFooter[GZIP_INDEX_FOOTER_SIZE] = {};
+        SetUInt64LSB(abyFooter, nCompressedSize);
+        SetUInt64LSB(abyFooter + 8, static_cast<uint64_t>(sStat.st_mtime));
+        SetUInt64LSB(abyFooter + 16, nTotalOut);
+        SetUInt64LSB(abyFooter + 24, nSpan);
+        SetUInt64LSB(abyFooter + 32, nIndexOffset);
+        SetUInt32LSB(abyFooter + 40, static_cast<uint32_t>(aoPoints.size()));
+
+        bOK = fpOut->Write(abyTable.data(), 1, abyTable.size()) ==
+                  abyTable.size() &&
+              fpOut->Write(abyFooter, 1, sizeof(abyFooter)) ==
+                  sizeof(abyFooter);
+    }
+
+    if (fpOut->Close() != 0)
+        bOK = false;
+    fpOut.reset();
+    if (!bOK)
+    {
+        VSIUnlink(osIndexFilename.c_str());
+        return -1;
+    }
+
+    if (pProgressFunc)
+        pProgressFunc(1.0, "", pProgressData);
+    return 0;
+}
+
 /************************************************************************/
 /*                   VSIInstallGZipFileHandler()                        */
 /************************************************************************/
@@ -3546,6 +4389,11 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     std::vector<CPLString> GetExtensions() override;
     VSIArchiveReader *CreateReader(const char *pszZipFileName) override;
 
+    std::string
+    SerializeFileOffset(const VSIArchiveEntryFileOffset *pOffset) override;
+    VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const char *pszSerialized) override;
+
     VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
                            bool bSetError,
                            CSLConstList /* papszOptions */) override;
@@ -3707,6 +4555,38 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+std::string VSIZipFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset *pOffset)
+{
+    const auto poZipOffset =
+        static_cast<const VSIZipEntryFileOffset *>(pOffset);
+    return CPLSPrintf(
+        CPL_FRMT_GUIB "," CPL_FRMT_GUIB,
+        static_cast<GUIntBig>(poZipOffset->m_file_pos.pos_in_zip_directory),
+        static_cast<GUIntBig>(poZipOffset->m_file_pos.num_of_file));
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *
+VSIZipFilesystemHandler::DeserializeFileOffset(const char *pszSerialized)
+{
+    const char *pszComma = strchr(pszSerialized, ',');
+    if (pszComma == nullptr)
+        return nullptr;
+    unz_file_pos file_pos;
+    file_pos.pos_in_zip_directory =
+        static_cast<uLong64>(CPLAtoGIntBig(pszSerialized));
+    file_pos.num_of_file = static_cast<uLong64>(CPLAtoGIntBig(pszComma + 1));
+    return new VSIZipEntryFileOffset(file_pos);
+}
+
 /************************************************************************/
 /*                         VSISOZipHandle                               */
 /************************************************************************/
@@ -4979,7 +5859,7 @@ void *CPLZLibDeflate(const void *ptr, size_t nBytes, int nLevel, void *outptr,
     void *pTmp;
 #ifdef HAVE_LIBDEFLATE
     struct libdeflate_compressor *enc =
-        libdeflate_alloc_compressor(nLevel < 0 ? 7 : nLevel);
+        CPLGetThreadLocalLibDeflateCompressor(nLevel < 0 ? 7 : nLevel);
     if (enc == nullptr)
     {
         return nullptr;
@@ -4995,9 +5875,6 @@ void *CPLZLibDeflate(const void *ptr, size_t nBytes, int nLevel, void *outptr,
         pTmp = VSIMalloc(nTmpSize);
         if (pTmp == nullptr)
         {
-#ifdef HAVE_LIBDEFLATE
-            libdeflate_free_compressor(enc);
-#endif
             return nullptr;
         }
     }
@@ -5010,7 +5887,6 @@ void *CPLZLibDeflate(const void *ptr, size_t nBytes, int nLevel, void *outptr,
 #ifdef HAVE_LIBDEFLATE
     size_t nCompressedBytes =
         libdeflate_zlib_compress(enc, ptr, nBytes, pTmp, nTmpSize);
-    libdeflate_free_compressor(enc);
     if (nCompressedBytes == 0)
     {
         if (pTmp != outptr)
@@ -5115,7 +5991,8 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
 #ifdef HAVE_LIBDEFLATE
     if (outptr)
     {
-        struct libdeflate_decompressor *dec = libdeflate_alloc_decompressor();
+        struct libdeflate_decompressor *dec =
+            CPLGetThreadLocalLibDeflateDecompressor();
         if (dec == nullptr)
         {
             if (bAllowResizeOutptr)
@@ -5137,7 +6014,6 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
         }
         if (pnOutBytes)
             *pnOutBytes = nOutBytes;
-        libdeflate_free_decompressor(dec);
         if (res == LIBDEFLATE_INSUFFICIENT_SPACE && bAllowResizeOutptr)
         {
             if (nOutAvailableBytes >
@@ -24,6 +24,7 @@
 #include <errno.h>
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <set>
@@ -31,6 +32,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #include "cpl_aws.h"
@@ -784,6 +786,12 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
     }
+
+#ifndef CPL_MULTIPROC_STUB
+    m_nMaxConcurrentUploads = std::max(
+        1, atoi(VSIGetPathSpecificOption(
+               pszFilename, "CPL_VSIL_MULTIPART_UPLOAD_NUM_THREADS", "1")));
+#endif
 }
 
 /************************************************************************/
@@ -1038,6 +1046,129 @@ bool VSIMultipartWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                         SubmitUploadPart()                           */
+/************************************************************************/
+
+// Uploads the content of m_pabyBuffer as a new part in a worker thread, so
+// that the caller can go on filling the buffer in the meantime. Blocks while
+// m_nMaxConcurrentUploads parts are being uploaded.
+bool VSIMultipartWriteHandle::SubmitUploadPart()
+{
+    ++m_nPartNumber;
+    if (m_nPartNumber > m_poFS->GetMaximumPartCount())
+    {
+        m_bError = true;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%d parts have been uploaded for %s failed. "
+                 "This is the maximum. "
+                 "Increase VSI%s_CHUNK_SIZE to a higher value (e.g. 500 for "
+                 "500 MiB)",
+                 m_poFS->GetMaximumPartCount(), m_osFilename.c_str(),
+                 m_poFS->GetDebugKey());
+        return false;
+    }
+
+    std::unique_ptr<UploadSlot> poSlot;
+    {
+        std::unique_lock oLock(m_oUploadMutex);
+        while (!m_bUploadError && m_apoFreeUploadSlots.empty() &&
+               m_nPendingUploads >= m_nMaxConcurrentUploads)
+        {
+            m_oUploadCV.wait(oLock);
+        }
+        if (m_bUploadError)
+            return false;
+        if (!m_apoFreeUploadSlots.empty())
+        {
+            poSlot = std::move(m_apoFreeUploadSlots.back());
+            m_apoFreeUploadSlots.pop_back();
+        }
+        m_aosEtags.resize(m_nPartNumber);
+    }
+
+    if (!poSlot)
+    {
+        poSlot = std::make_unique<UploadSlot>();
+        try
+        {
+            poSlot->abyBuffer.resize(m_nBufferSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer for %s",
+                     m_poFS->GetFSPrefix().c_str());
+            return false;
+        }
+        // Each upload needs its own helper, as UploadPart() modifies
+        // its query parameters.
+        poSlot->poS3HandleHelper.reset(m_poFS->CreateHandleHelper(
+            m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+        if (!poSlot->poS3HandleHelper)
+            return false;
+    }
+    if (!m_poUploadPool)
+    {
+        m_poUploadPool =
+            std::make_unique<CPLWorkerThreadPool>(m_nMaxConcurrentUploads);
+    }
+
+    memcpy(poSlot->abyBuffer.data(), m_pabyBuffer, m_nBufferOff);
+    const size_t nPartSize = m_nBufferOff;
+    const int nPartNumber = m_nPartNumber;
+    m_nBufferOff = 0;
+
+    {
+        std::lock_guard oLock(m_oUploadMutex);
+        ++m_nPendingUploads;
+    }
+    UploadSlot *poSlotRaw = poSlot.release();
+    const auto task =
+        [this, poSlotRaw, nPartNumber, nPartSize,
+         aosTLConfigOptions = CPLStringList(CPLGetThreadLocalConfigOptions())]()
+    {
+        std::unique_ptr<UploadSlot> poSlotThisJob(poSlotRaw);
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        const std::string osEtag = m_poFS->UploadPart(
+            m_osFilename, nPartNumber, m_osUploadID,
+            static_cast<vsi_l_offset>(m_nBufferSize) * (nPartNumber - 1),
+            poSlotThisJob->abyBuffer.data(), nPartSize,
+            poSlotThisJob->poS3HandleHelper.get(), m_oRetryParameters,
+            nullptr);
+        CPLSetThreadLocalConfigOptions(nullptr);
+
+        std::lock_guard oLock(m_oUploadMutex);
+        if (osEtag.empty())
+            m_bUploadError = true;
+        else
+            m_aosEtags[nPartNumber - 1] = osEtag;
+        m_apoFreeUploadSlots.push_back(std::move(poSlotThisJob));
+        --m_nPendingUploads;
+        m_oUploadCV.notify_all();
+    };
+    if (!m_poUploadPool->SubmitJob(task))
+    {
+        delete poSlotRaw;
+        std::lock_guard oLock(m_oUploadMutex);
+        --m_nPendingUploads;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       WaitForPendingUploads()                        */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPendingUploads()
+{
+    std::unique_lock oLock(m_oUploadMutex);
+    while (m_nPendingUploads > 0)
+        m_oUploadCV.wait(oLock);
+    return !m_bUploadError;
+}
+
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1190,7 +1321,8 @@ size_t VSIMultipartWriteHandle::Write(const void *pBuffer, size_t nSize,
                     return 0;
                 }
             }
-            if (!UploadPart())
+            if (!(m_nMaxConcurrentUploads > 1 ? SubmitUploadPart()
+                                              : UploadPart()))
             {
                 m_bError = true;
                 return 0;
@@ -1741,6 +1873,8 @@ int VSIMultipartWriteHandle::Close()
         }
         else
         {
+            if (!WaitForPendingUploads())
+                m_bError = true;
             if (m_bError)
             {
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
@@ -3275,12 +3409,264 @@ char **IVSIS3LikeFSHandler::GetFileList(const char *pszDirname, int nMaxFiles,
     return aosFileList.StealList();
 }
 
+/************************************************************************/
+/*                          VSIDIRFromEntries                           */
+/************************************************************************/
+
+// Directory whose entries have been fully retrieved when it is opened
+struct VSIDIRFromEntries final : public VSIDIR
+{
+    std::vector<std::unique_ptr<VSIDIREntry>> m_apoEntries{};
+    size_t m_nPos = 0;
+
+    explicit VSIDIRFromEntries(
+        std::vector<std::unique_ptr<VSIDIREntry>> &&apoEntries)
+        : m_apoEntries(std::move(apoEntries))
+    {
+    }
+
+    const VSIDIREntry *NextDirEntry() override
+    {
+        if (m_nPos == m_apoEntries.size())
+            return nullptr;
+        return m_apoEntries[m_nPos++].get();
+    }
+};
+
+/************************************************************************/
+/*                       GetListingNumThreads()                         */
+/************************************************************************/
+
+static int GetListingNumThreads(const char *pszPath,
+                                CSLConstList papszOptions)
+{
+#if defined(CPL_MULTIPROC_STUB)
+    (void)pszPath;
+    (void)papszOptions;
+    return 1;
+#else
+    const char *pszValue = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (!pszValue)
+        pszValue = VSIGetPathSpecificOption(pszPath,
+                                            "CPL_VSIL_LIST_NUM_THREADS", "1");
+    if (EQUAL(pszValue, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::clamp(atoi(pszValue), 1, 64);
+#endif
+}
+
+/************************************************************************/
+/*                         ListDirInParallel()                          */
+/************************************************************************/
+
+/** Recursively lists pszPath, by first listing its immediate content, and
+ * then listing each of its sub-directories in a separate request sequence,
+ * with up to nThreads of them issued concurrently.
+ *
+ * The listing of a prefix with many objects is a sequence of paginated
+ * requests that cannot be parallelized, so this is only beneficial when the
+ * objects are spread into several sub-directories.
+ */
+bool IVSIS3LikeFSHandler::ListDirInParallel(
+    const char *pszPath, int nThreads, const char *const *papszOptions,
+    std::vector<std::unique_ptr<VSIDIREntry>> &apoEntries)
+{
+    std::string osPath(pszPath);
+    if (!osPath.empty() && osPath.back() == '/' && osPath != GetFSPrefix())
+        osPath.pop_back();
+
+    std::vector<std::unique_ptr<VSIDIREntry>> apoTopEntries;
+    {
+        auto poDir = std::unique_ptr<VSIDIR>(
+            OpenDirInternal(osPath.c_str(), 0, papszOptions));
+        if (!poDir)
+            return false;
+        while (const auto *psEntry = poDir->NextDirEntry())
+            apoTopEntries.push_back(std::make_unique<VSIDIREntry>(*psEntry));
+    }
+
+    // Sub-directory names end with a slash when there is also a file of
+    // the same name.
+    const auto GetSubdirName = [](const VSIDIREntry &sEntry)
+    {
+        std::string osName(sEntry.pszName);
+        if (!osName.empty() && osName.back() == '/')
+            osName.pop_back();
+        return osName;
+    };
+
+    std::vector<size_t> anSubdirIdx;
+    for (size_t i = 0; i < apoTopEntries.size(); ++i)
+    {
+        if (VSI_ISDIR(apoTopEntries[i]->nMode) &&
+            !GetSubdirName(*apoTopEntries[i]).empty())
+        {
+            anSubdirIdx.push_back(i);
+        }
+    }
+
+    // The PREFIX filter only applies to the top-level entries
+    CPLStringList aosSubdirOptions(CSLDuplicate(papszOptions));
+    aosSubdirOptions.SetNameValue("PREFIX", nullptr);
+
+    std::vector<std::vector<std::unique_ptr<VSIDIREntry>>> aapoSubdirEntries(
+        anSubdirIdx.size());
+    std::atomic<size_t> nNextSubdir{0};
+    std::atomic<bool> bSuccess{true};
+    const std::string osSep(osPath == GetFSPrefix() ? "" : "/");
+    const auto threadFunc = [this, &anSubdirIdx, &apoTopEntries,
+                             &aapoSubdirEntries, &nNextSubdir, &bSuccess,
+                             &aosSubdirOptions, &osPath, &osSep,
+                             &GetSubdirName]()
+    {
+        while (bSuccess)
+        {
+            const size_t i = nNextSubdir++;
+            if (i >= anSubdirIdx.size())
+                break;
+            const std::string osSubdirPath(
+                osPath + osSep + GetSubdirName(*apoTopEntries[anSubdirIdx[i]]));
+            auto poDir = std::unique_ptr<VSIDIR>(OpenDirInternal(
+                osSubdirPath.c_str(), -1, aosSubdirOptions.List()));
+            if (!poDir)
+            {
+                bSuccess = false;
+                break;
+            }
+            while (const auto *psEntry = poDir->NextDirEntry())
+            {
+                aapoSubdirEntries[i].push_back(
+                    std::make_unique<VSIDIREntry>(*psEntry));
+            }
+        }
+    };
+
+    const int nThreadCount =
+        static_cast<int>(std::min<size_t>(nThreads, anSubdirIdx.size()));
+    if (nThreadCount > 1)
+    {
+        std::vector<std::thread> aThreads;
+        for (int i = 0; i < nThreadCount; ++i)
+        {
+            aThreads.emplace_back(
+                [&threadFunc, aosTLConfigOptions = CPLStringList(
+                                  CPLGetThreadLocalConfigOptions())]()
+                {
+                    CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+                    threadFunc();
+                    CPLSetThreadLocalConfigOptions(nullptr);
+                });
+        }
+        for (auto &oThread : aThreads)
+            oThread.join();
+    }
+    else
+    {
+        threadFunc();
+    }
+    if (!bSuccess)
+        return false;
+
+    apoEntries.clear();
+    size_t iSubdir = 0;
+    for (size_t i = 0; i < apoTopEntries.size(); ++i)
+    {
+        const bool bIsListedSubdir =
+            iSubdir < anSubdirIdx.size() && anSubdirIdx[iSubdir] == i;
+        const std::string osSubdirName(
+            bIsListedSubdir ? GetSubdirName(*apoTopEntries[i]) : std::string());
+        apoEntries.push_back(std::move(apoTopEntries[i]));
+        if (bIsListedSubdir)
+        {
+            for (auto &poEntry : aapoSubdirEntries[iSubdir])
+            {
+                const std::string osName(osSubdirName + "/" +
+                                         poEntry->pszName);
+                CPLFree(poEntry->pszName);
+                poEntry->pszName = CPLStrdup(osName.c_str());
+                apoEntries.push_back(std::move(poEntry));
+            }
+            aapoSubdirEntries[iSubdir].clear();
+            ++iSubdir;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                            OpenDir()                                 */
 /************************************************************************/
 
 VSIDIR *IVSIS3LikeFSHandler::OpenDir(const char *pszPath, int nRecurseDepth,
                                      const char *const *papszOptions)
+{
+    if (nRecurseDepth > 0 || !STARTS_WITH_CI(pszPath, GetFSPrefix().c_str()))
+        return OpenDirInternal(pszPath, nRecurseDepth, papszOptions);
+
+    const int nThreads = nRecurseDepth < 0
+                             ? GetListingNumThreads(pszPath, papszOptions)
+                             : 1;
+    // Listings done to modify the content of a directory must not use
+    // the on-disk cache, which is not invalidated by modifications. This is
+    // signaled by CACHE_ENTRIES=NO (VSIRmdirRecursive()), or by the internal
+    // USE_CACHED_LISTING=NO option (VSISync()).
+    const bool bUseDiskCache =
+        VSICurlDiskCacheDirListIsEnabled() &&
+        atoi(CSLFetchNameValueDef(papszOptions, "MAXFILES", "0")) == 0 &&
+        CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "CACHE_ENTRIES", "YES")) &&
+        CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "USE_CACHED_LISTING", "YES"));
+    if (nThreads <= 1 && !bUseDiskCache)
+        return OpenDirInternal(pszPath, nRecurseDepth, papszOptions);
+
+    std::string osCacheKey;
+    std::vector<std::unique_ptr<VSIDIREntry>> apoEntries;
+    if (bUseDiskCache)
+    {
+        std::string osPath(pszPath);
+        if (!osPath.empty() && osPath.back() == '/' && osPath != GetFSPrefix())
+            osPath.pop_back();
+        osCacheKey = CPLSPrintf(
+            "%s\ndepth:%d\nprefix:%s\nsynthetize_missing_dirs:%d",
+            osPath.c_str(), nRecurseDepth,
+            CSLFetchNameValueDef(papszOptions, "PREFIX", ""),
+            static_cast<int>(CPLTestBool(CSLFetchNameValueDef(
+                papszOptions, "SYNTHETIZE_MISSING_DIRECTORIES", "NO"))));
+        if (VSICurlDiskCacheGetDirList(osCacheKey, apoEntries))
+        {
+            CPLDebug(GetDebugKey(), "Using cached listing of %s", pszPath);
+            return new VSIDIRFromEntries(std::move(apoEntries));
+        }
+    }
+
+    if (nThreads > 1)
+    {
+        if (!ListDirInParallel(pszPath, nThreads, papszOptions, apoEntries))
+            return nullptr;
+    }
+    else
+    {
+        auto poDir = std::unique_ptr<VSIDIR>(
+            OpenDirInternal(pszPath, nRecurseDepth, papszOptions));
+        if (!poDir)
+            return nullptr;
+        while (const auto *psEntry = poDir->NextDirEntry())
+            apoEntries.push_back(std::make_unique<VSIDIREntry>(*psEntry));
+    }
+
+    if (bUseDiskCache)
+        VSICurlDiskCacheAddDirList(osCacheKey, apoEntries);
+    return new VSIDIRFromEntries(std::move(apoEntries));
+}
+
+/************************************************************************/
+/*                          OpenDirInternal()                           */
+/************************************************************************/
+
+VSIDIR *IVSIS3LikeFSHandler::OpenDirInternal(const char *pszPath,
+                                             int nRecurseDepth,
+                                             const char *const *papszOptions)
 {
     if (nRecurseDepth > 0)
     {
@@ -4295,8 +4681,12 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 return false;
         }
 
-        auto poTargetDir = std::unique_ptr<VSIDIR>(
-            VSIOpenDir(osTargetDir.c_str(), bRecursive ? -1 : 0, nullptr));
+        // Do not use listings of the target cached on disk, as they may be
+        // outdated.
+        const char *const apszTargetOptions[] = {"USE_CACHED_LISTING=NO",
+                                                 nullptr};
+        auto poTargetDir = std::unique_ptr<VSIDIR>(VSIOpenDir(
+            osTargetDir.c_str(), bRecursive ? -1 : 0, apszTargetOptions));
         std::set<std::string> oSetTargetSubdirs;
         std::map<std::string, VSIDIREntry> oMapExistingTargetFiles;
         // Enumerate existing target files and directories
@@ -497,6 +497,11 @@ class VSITarFilesystemHandler final : public VSIArchiveFilesystemHandler
     std::vector<CPLString> GetExtensions() override;
     VSIArchiveReader *CreateReader(const char *pszTarFileName) override;
 
+    std::string
+    SerializeFileOffset(const VSIArchiveEntryFileOffset *pOffset) override;
+    VSIArchiveEntryFileOffset *
+    DeserializeFileOffset(const char *pszSerialized) override;
+
     VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
                            bool bSetError,
                            CSLConstList /* papszOptions */) override;
@@ -549,6 +554,33 @@ VSITarFilesystemHandler::CreateReader(const char *pszTarFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+std::string VSITarFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset *pOffset)
+{
+    const auto poTarOffset =
+        static_cast<const VSITarEntryFileOffset *>(pOffset);
+#ifdef HAVE_FUZZER_FRIENDLY_ARCHIVE
+    if (!poTarOffset->m_osFileName.empty())
+        return std::string();
+#endif
+    return CPLSPrintf(CPL_FRMT_GUIB, poTarOffset->m_nOffset);
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+VSIArchiveEntryFileOffset *
+VSITarFilesystemHandler::DeserializeFileOffset(const char *pszSerialized)
+{
+    return new VSITarEntryFileOffset(
+        static_cast<GUIntBig>(CPLAtoGIntBig(pszSerialized)));
+}
+
 /************************************************************************/
 /*                                 Open()                               */
 /************************************************************************/
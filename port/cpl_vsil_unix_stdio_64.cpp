@@ -65,6 +65,9 @@
 #ifdef HAVE_PREAD_BSD
 #include <sys/uio.h>
 #endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
@@ -73,8 +76,13 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -82,6 +90,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
 
 #if defined(UNIX_STDIO_64)
 
@@ -156,6 +165,9 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     CPLMutex *hMutex = nullptr;
 #endif
 
+    std::mutex m_oReadThreadPoolMutex{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poReadThreadPool{};
+
   public:
     VSIUnixStdioFilesystemHandler() = default;
 #ifdef VSI_COUNT_BYTES_READ
@@ -181,6 +193,9 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
                                  bool /* bAllowLocalTempFile */) override;
     bool SupportsRandomWrite(const char *pszPath,
                              bool /* bAllowLocalTempFile */) override;
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
+
+    CPLWorkerThreadPool *GetReadThreadPool(int nThreads);
 
     VSIDIR *OpenDir(const char *pszPath, int nRecurseDepth,
                     const char *const *papszOptions) override;
@@ -221,9 +236,15 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     // file and thus a call to our Seek(0, SEEK_SET) before a read will be a
     // no-op.
     bool bModeAppendReadWrite = false;
+    VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #ifdef VSI_COUNT_BYTES_READ
     vsi_l_offset nTotalBytesRead = 0;
-    VSIUnixStdioFilesystemHandler *poFS = nullptr;
+#endif
+#ifdef HAVE_MMAP
+    // Mappings of the whole file created by GetReadOnlyPointer(). A new one
+    // is created when the file has grown, but the previous ones must be
+    // kept, as pointers into them may still be in use.
+    std::vector<std::pair<void *, size_t>> m_aoMappings{};
 #endif
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, FILE *fpIn,
@@ -251,6 +272,17 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
+#ifdef POSIX_FADV_WILLNEED
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+#endif
+#ifdef HAVE_MMAP
+    const void *GetReadOnlyPointer(vsi_l_offset nOffset,
+                                   size_t nSize) override;
 #endif
 };
 
@@ -258,18 +290,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
 /*                       VSIUnixStdioHandle()                           */
 /************************************************************************/
 
-VSIUnixStdioHandle::VSIUnixStdioHandle(
-#ifndef VSI_COUNT_BYTES_READ
-    CPL_UNUSED
-#endif
-        VSIUnixStdioFilesystemHandler *poFSIn,
-    FILE *fpIn, bool bReadOnlyIn, bool bModeAppendReadWriteIn)
+VSIUnixStdioHandle::VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn,
+                                       FILE *fpIn, bool bReadOnlyIn,
+                                       bool bModeAppendReadWriteIn)
     : fp(fpIn), bReadOnly(bReadOnlyIn),
-      bModeAppendReadWrite(bModeAppendReadWriteIn)
-#ifdef VSI_COUNT_BYTES_READ
-      ,
-      poFS(poFSIn)
-#endif
+      bModeAppendReadWrite(bModeAppendReadWriteIn), poFS(poFSIn)
 {
 }
 
@@ -289,6 +314,12 @@ int VSIUnixStdioHandle::Close()
     poFS->AddToTotal(nTotalBytesRead);
 #endif
 
+#ifdef HAVE_MMAP
+    for (const auto &[pAddr, nSize] : m_aoMappings)
+        munmap(pAddr, nSize);
+    m_aoMappings.clear();
+#endif
+
     int ret = fclose(fp);
     fp = nullptr;
     return ret;
@@ -686,6 +717,196 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fileno(fp), pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                            PReadFully()                              */
+/************************************************************************/
+
+// Unlike PRead(), retries on short reads and interrupted system calls.
+static bool PReadFully(int fd, void *pBuffer, size_t nSize,
+                       vsi_l_offset nOffset)
+{
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    while (nSize > 0)
+    {
+#ifdef HAVE_PREAD64
+        const auto nRead = pread64(fd, pabyBuffer, nSize, nOffset);
+#else
+        const auto nRead =
+            pread(fd, pabyBuffer, nSize, static_cast<off_t>(nOffset));
+#endif
+        if (nRead < 0 && errno == EINTR)
+            continue;
+        if (nRead <= 0)
+            return false;
+        pabyBuffer += nRead;
+        nSize -= static_cast<size_t>(nRead);
+        nOffset += static_cast<vsi_l_offset>(nRead);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GetReadMultiRangeNumThreads()                   */
+/************************************************************************/
+
+static int GetReadMultiRangeNumThreads()
+{
+    const char *pszValue =
+        CPLGetConfigOption("CPL_VSIL_LOCAL_READ_NUM_THREADS", "1");
+    const int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    return std::clamp(nThreads, 1, 128);
+}
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // pread() would not see data still in the stdio write buffer
+    if (!bReadOnly)
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+
+    // Large ranges are split in pieces, so that they can also be read
+    // concurrently.
+    struct Piece
+    {
+        GByte *pabyData;
+        vsi_l_offset nOffset;
+        size_t nSize;
+    };
+
+    constexpr size_t PIECE_SIZE = 1024 * 1024;
+    std::vector<Piece> asPieces;
+    vsi_l_offset nTotalSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        GByte *pabyData = static_cast<GByte *>(ppData[i]);
+        for (size_t nDone = 0; nDone < panSizes[i]; nDone += PIECE_SIZE)
+        {
+            asPieces.push_back({pabyData + nDone, panOffsets[i] + nDone,
+                                std::min(PIECE_SIZE, panSizes[i] - nDone)});
+        }
+        nTotalSize += panSizes[i];
+    }
+
+    const int fd = fileno(fp);
+    std::atomic<bool> bOK{true};
+    std::atomic<size_t> nNextPiece{0};
+    const auto ReadPieces = [fd, &asPieces, &bOK, &nNextPiece]()
+    {
+        size_t i;
+        while (bOK && (i = nNextPiece++) < asPieces.size())
+        {
+            const auto &sPiece = asPieces[i];
+            if (!PReadFully(fd, sPiece.pabyData, sPiece.nSize, sPiece.nOffset))
+                bOK = false;
+        }
+    };
+
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        GetReadMultiRangeNumThreads(), asPieces.size()));
+    if (nThreads > 1)
+    {
+        auto poQueue = poFS->GetReadThreadPool(nThreads)->CreateJobQueue();
+        // The calling thread also reads pieces while waiting.
+        for (int i = 1; i < nThreads; ++i)
+        {
+            if (!poQueue->SubmitJob(ReadPieces))
+                break;
+        }
+        ReadPieces();
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        ReadPieces();
+    }
+
+#ifdef VSI_COUNT_BYTES_READ
+    nTotalBytesRead += nTotalSize;
+#else
+    CPL_IGNORE_RET_VAL(nTotalSize);
+#endif
+
+    return bOK ? 0 : -1;
+}
+#endif
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+#ifdef POSIX_FADV_WILLNEED
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    // Let the kernel start reading the ranges asynchronously into the page
+    // cache.
+    const int fd = fileno(fp);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] == 0 ||
+            panOffsets[i] > static_cast<vsi_l_offset>(
+                                std::numeric_limits<off_t>::max()))
+            continue;
+        CPL_IGNORE_RET_VAL(posix_fadvise(fd, static_cast<off_t>(panOffsets[i]),
+                                         static_cast<off_t>(panSizes[i]),
+                                         POSIX_FADV_WILLNEED));
+    }
+}
+#endif
+
+/************************************************************************/
+/*                        GetReadOnlyPointer()                          */
+/************************************************************************/
+
+#ifdef HAVE_MMAP
+const void *VSIUnixStdioHandle::GetReadOnlyPointer(vsi_l_offset nOffset,
+                                                   size_t nSize)
+{
+    if (!bReadOnly)
+        return nullptr;
+
+    const auto IsInLastMapping = [this, nOffset, nSize]()
+    {
+        return !m_aoMappings.empty() &&
+               nOffset <= m_aoMappings.back().second &&
+               nSize <= m_aoMappings.back().second - nOffset;
+    };
+
+    if (!IsInLastMapping())
+    {
+        struct stat sStat;
+        if (fstat(fileno(fp), &sStat) != 0 || sStat.st_size <= 0 ||
+            static_cast<GUIntBig>(sStat.st_size) >
+                std::numeric_limits<size_t>::max())
+        {
+            return nullptr;
+        }
+        const size_t nFileSize = static_cast<size_t>(sStat.st_size);
+        if ((!m_aoMappings.empty() &&
+             nFileSize <= m_aoMappings.back().second) ||
+            nOffset > nFileSize || nSize > nFileSize - nOffset)
+        {
+            return nullptr;
+        }
+        void *pAddr =
+            mmap(nullptr, nFileSize, PROT_READ, MAP_SHARED, fileno(fp), 0);
+        if (pAddr == MAP_FAILED)
+            return nullptr;
+        m_aoMappings.emplace_back(pAddr, nFileSize);
+    }
+
+    return static_cast<const GByte *>(m_aoMappings.back().first) +
+           static_cast<size_t>(nOffset);
+}
 #endif
 
 /************************************************************************/
@@ -1017,6 +1238,37 @@ bool VSIUnixStdioFilesystemHandler::SupportsSequentialWrite(
     return access(CPLGetDirnameSafe(pszPath).c_str(), W_OK) == 0;
 }
 
+/************************************************************************/
+/*                     HasOptimizedReadMultiRange()                     */
+/************************************************************************/
+
+int VSIUnixStdioFilesystemHandler::HasOptimizedReadMultiRange(
+    const char * /* pszPath */)
+{
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+    return GetReadMultiRangeNumThreads() > 1;
+#else
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                        GetReadThreadPool()                           */
+/************************************************************************/
+
+// Returns the pool used by ReadMultiRange(), growing it to nThreads if
+// needed. Threads are started lazily.
+CPLWorkerThreadPool *
+VSIUnixStdioFilesystemHandler::GetReadThreadPool(int nThreads)
+{
+    std::lock_guard oLock(m_oReadThreadPoolMutex);
+    if (!m_poReadThreadPool)
+        m_poReadThreadPool = std::make_unique<CPLWorkerThreadPool>();
+    if (m_poReadThreadPool->GetThreadCount() < nThreads)
+        m_poReadThreadPool->Setup(nThreads, nullptr, nullptr, false);
+    return m_poReadThreadPool.get();
+}
+
 /************************************************************************/
 /*                     SupportsRandomWrite()                            */
 /************************************************************************/
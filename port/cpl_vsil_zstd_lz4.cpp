@@ -0,0 +1,1456 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Implement VSI large file api for /vsizstd/ and /vsilz4/
+ * Author:   Even Rouault, even.rouault at spatialys.com
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsi_virtual.h"
+
+#if defined(HAVE_ZSTD) || defined(HAVE_LZ4)
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef HAVE_LZ4
+#include <lz4frame.h>
+#endif
+
+//! @cond Doxygen_Suppress
+
+/* Files written by /vsizstd/ and /vsilz4/ are made of a sequence of
+   independently compressed frames of CPL_VSIL_{ZSTD|LZ4}_CHUNK_SIZE
+   uncompressed bytes, followed by a seek table, stored in a skippable frame,
+   and using the layout of the Zstandard seekable format
+   (https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md).
+   Skippable frames are defined identically for Zstandard and LZ4, so the
+   same layout is used for both. Regular decoders ignore the seek table.
+
+   When reading, the seek table, if present, is used to start decompression
+   from the frame containing the requested offset. For other files, frame
+   boundaries are recorded while decompressing, so that backward seeks do
+   not require restarting from the beginning of the file.
+*/
+
+constexpr uint32_t SKIPPABLE_SEEK_TABLE_MAGIC = 0x184D2A5E;
+constexpr uint32_t SEEKABLE_MAGIC = 0x8F92EAB1;
+constexpr int SKIPPABLE_HEADER_SIZE = 8;
+constexpr int SEEK_TABLE_FOOTER_SIZE = 9;
+constexpr GByte SEEK_TABLE_CHECKSUM_FLAG = 0x80;
+constexpr GByte SEEK_TABLE_RESERVED_BITS = 0x7C;
+
+constexpr size_t COMPRESSED_BUFFER_SIZE = 128 * 1024;
+
+namespace
+{
+
+uint32_t GetUInt32LSB(const GByte *pabyData)
+{
+    uint32_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR32(&nVal);
+    return nVal;
+}
+
+void AppendUInt32LSB(std::vector<GByte> &abyData, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+    abyData.insert(abyData.end(), pabyVal, pabyVal + sizeof(nVal));
+}
+
+/************************************************************************/
+/*                        VSIFrameDecompressor                          */
+/************************************************************************/
+
+// Streaming decompressor of a sequence of frames.
+class VSIFrameDecompressor
+{
+  public:
+    virtual ~VSIFrameDecompressor() = default;
+
+    // Prepares for the decompression of a new frame.
+    virtual bool Reset() = 0;
+
+    // Decompresses from pabyIn[nInPos] into pabyOut[nOutPos], and updates
+    // nInPos and nOutPos. bFrameEnd is set when the end of a frame has been
+    // reached (and all its data output). Emits a CPLError() on failure.
+    virtual bool Decompress(const GByte *pabyIn, size_t nInSize,
+                            size_t &nInPos, GByte *pabyOut, size_t nOutSize,
+                            size_t &nOutPos, bool &bFrameEnd) = 0;
+};
+
+/************************************************************************/
+/*                           VSIFramedCodec                             */
+/************************************************************************/
+
+// Description of a compression method and of its settings.
+class VSIFramedCodec
+{
+  public:
+    virtual ~VSIFramedCodec() = default;
+
+    // Filesystem prefix, e.g. "/vsizstd/"
+    virtual const char *GetPrefix() const = 0;
+
+    virtual std::unique_ptr<VSIFrameDecompressor>
+    CreateDecompressor() const = 0;
+
+    // Compresses a buffer as a single frame. Must be thread-safe.
+    virtual bool CompressFrame(const GByte *pabyIn, size_t nInSize,
+                               int nLevel,
+                               std::vector<GByte> &abyOut) const = 0;
+
+    // Value of the CPL_VSIL_xxx_LEVEL configuration option
+    virtual int GetLevel() const = 0;
+
+    // Value of the CPL_VSIL_xxx_CHUNK_SIZE configuration option
+    virtual size_t GetChunkSize() const = 0;
+
+    virtual const char *GetOptions() const = 0;
+};
+
+/************************************************************************/
+/*                         ParseChunkSize()                             */
+/************************************************************************/
+
+// Seek table entries are 32 bit, so limit the size of frames.
+constexpr size_t MAX_CHUNK_SIZE = 1024 * 1024 * 1024;
+
+size_t ParseChunkSize(const char *pszOptionName, const char *pszValue)
+{
+    GIntBig nVal = 0;
+    if (CPLParseMemorySize(pszValue, &nVal, nullptr) != CE_None ||
+        nVal < 1024 || static_cast<GUIntBig>(nVal) > MAX_CHUNK_SIZE)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for %s: %s. Must be between 1K and 1G. "
+                 "Using 1M",
+                 pszOptionName, pszValue);
+        return 1024 * 1024;
+    }
+    return static_cast<size_t>(nVal);
+}
+
+/************************************************************************/
+/*                          GetNumThreads()                             */
+/************************************************************************/
+
+int GetNumThreads()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszThreads)
+        return 1;
+    const int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads);
+    return std::max(1, std::min(128, nThreads));
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         VSIFramedReadHandle                          */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIFramedReadHandle final : public VSIVirtualHandle
+{
+    struct FrameStart
+    {
+        vsi_l_offset nCompressedOffset = 0;
+        vsi_l_offset nUncompressedOffset = 0;
+    };
+
+    const std::string m_osFilename;
+    VSIVirtualHandleUniquePtr m_poBaseHandle;
+    std::unique_ptr<VSIFrameDecompressor> m_poDecompressor{};
+
+    // Start of frames, sorted by increasing offsets. Complete when read from
+    // the seek table, otherwise only frames already decompressed are listed.
+    std::vector<FrameStart> m_aoFrames{};
+    bool m_bHasSeekTable = false;
+
+    bool m_bUncompressedSizeKnown = false;
+    vsi_l_offset m_nUncompressedSize = 0;
+
+    std::vector<GByte> m_abyIn{};
+    size_t m_nInPos = 0;
+    size_t m_nInSize = 0;
+    // Offset in the compressed file of m_abyIn[0]
+    vsi_l_offset m_nInBufferOffset = 0;
+    bool m_bBaseEOF = false;
+    // Whether the decompressor is in the middle of a frame
+    bool m_bInFrame = false;
+
+    std::vector<GByte> m_abyDiscard{};
+
+    // Uncompressed offset at which the decompressor is
+    vsi_l_offset m_nCurOffset = 0;
+    // Uncompressed offset returned by Tell()
+    vsi_l_offset m_nWantedOffset = 0;
+
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIFramedReadHandle)
+
+    void ReadSeekTable();
+    bool RestartFrom(const FrameStart &oFrame);
+    const FrameStart &GetFrameBefore(vsi_l_offset nOffset) const;
+    size_t Decompress(GByte *pabyDst, size_t nToRead);
+    bool SkipUntil(vsi_l_offset nOffset);
+    bool PositionDecompressor();
+
+  public:
+    VSIFramedReadHandle(const std::string &osFilename,
+                        VSIVirtualHandleUniquePtr poBaseHandle);
+
+    bool Init(const VSIFramedCodec &oCodec);
+
+    bool GetUncompressedSize(vsi_l_offset &nSize);
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nCount) override;
+    void ClearErr() override;
+    int Eof() override;
+    int Error() override;
+    int Close() override;
+};
+
+/************************************************************************/
+/*                         VSIFramedReadHandle()                        */
+/************************************************************************/
+
+VSIFramedReadHandle::VSIFramedReadHandle(const std::string &osFilename,
+                                         VSIVirtualHandleUniquePtr poBaseHandle)
+    : m_osFilename(osFilename), m_poBaseHandle(std::move(poBaseHandle))
+{
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool VSIFramedReadHandle::Init(const VSIFramedCodec &oCodec)
+{
+    m_poDecompressor = oCodec.CreateDecompressor();
+    if (!m_poDecompressor || !m_poDecompressor->Reset())
+        return false;
+    try
+    {
+        m_abyIn.resize(COMPRESSED_BUFFER_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+
+    ReadSeekTable();
+    if (m_aoFrames.empty())
+        m_aoFrames.push_back(FrameStart());
+    return m_poBaseHandle->Seek(0, SEEK_SET) == 0;
+}
+
+/************************************************************************/
+/*                           ReadSeekTable()                            */
+/************************************************************************/
+
+void VSIFramedReadHandle::ReadSeekTable()
+{
+    if (m_poBaseHandle->Seek(0, SEEK_END) != 0)
+        return;
+    const vsi_l_offset nFileSize = m_poBaseHandle->Tell();
+    if (nFileSize < SKIPPABLE_HEADER_SIZE + SEEK_TABLE_FOOTER_SIZE)
+        return;
+
+    GByte abyFooter[SEEK_TABLE_FOOTER_SIZE];
+    if (m_poBaseHandle->Seek(nFileSize - SEEK_TABLE_FOOTER_SIZE, SEEK_SET) !=
+            0 ||
+        m_poBaseHandle->Read(abyFooter, 1, sizeof(abyFooter)) !=
+            sizeof(abyFooter) ||
+        GetUInt32LSB(abyFooter + 5) != SEEKABLE_MAGIC ||
+        (abyFooter[4] & SEEK_TABLE_RESERVED_BITS) != 0)
+    {
+        return;
+    }
+    const uint32_t nFrames = GetUInt32LSB(abyFooter);
+    const int nEntrySize =
+        (abyFooter[4] & SEEK_TABLE_CHECKSUM_FLAG) != 0 ? 12 : 8;
+    const vsi_l_offset nTableSize =
+        SKIPPABLE_HEADER_SIZE +
+        static_cast<vsi_l_offset>(nFrames) * nEntrySize +
+        SEEK_TABLE_FOOTER_SIZE;
+    if (nTableSize > nFileSize)
+        return;
+
+    std::vector<GByte> abyTable;
+    try
+    {
+        abyTable.resize(static_cast<size_t>(nTableSize));
+        m_aoFrames.reserve(nFrames);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    if (m_poBaseHandle->Seek(nFileSize - nTableSize, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyTable.data(), 1, abyTable.size()) !=
+            abyTable.size() ||
+        GetUInt32LSB(abyTable.data()) != SKIPPABLE_SEEK_TABLE_MAGIC ||
+        GetUInt32LSB(abyTable.data() + 4) != nTableSize - SKIPPABLE_HEADER_SIZE)
+    {
+        return;
+    }
+
+    FrameStart oFrame;
+    for (uint32_t i = 0; i < nFrames; ++i)
+    {
+        const GByte *pabyEntry =
+            abyTable.data() + SKIPPABLE_HEADER_SIZE +
+            static_cast<size_t>(i) * nEntrySize;
+        m_aoFrames.push_back(oFrame);
+        oFrame.nCompressedOffset += GetUInt32LSB(pabyEntry);
+        oFrame.nUncompressedOffset += GetUInt32LSB(pabyEntry + 4);
+    }
+    if (oFrame.nCompressedOffset != nFileSize - nTableSize)
+    {
+        CPLDebug("VSIFRAMED", "%s: inconsistent seek table. Ignoring it",
+                 m_osFilename.c_str());
+        m_aoFrames.clear();
+        return;
+    }
+    m_bHasSeekTable = true;
+    m_bUncompressedSizeKnown = true;
+    m_nUncompressedSize = oFrame.nUncompressedOffset;
+}
+
+/************************************************************************/
+/*                           GetFrameBefore()                           */
+/************************************************************************/
+
+// Returns the last known frame starting at or before nOffset
+const VSIFramedReadHandle::FrameStart &
+VSIFramedReadHandle::GetFrameBefore(vsi_l_offset nOffset) const
+{
+    auto oIter = std::upper_bound(
+        m_aoFrames.begin(), m_aoFrames.end(), nOffset,
+        [](vsi_l_offset nVal, const FrameStart &oFrame)
+        { return nVal < oFrame.nUncompressedOffset; });
+    CPLAssert(oIter != m_aoFrames.begin());
+    --oIter;
+    return *oIter;
+}
+
+/************************************************************************/
+/*                            RestartFrom()                             */
+/************************************************************************/
+
+bool VSIFramedReadHandle::RestartFrom(const FrameStart &oFrame)
+{
+    m_nInPos = 0;
+    m_nInSize = 0;
+    m_nInBufferOffset = oFrame.nCompressedOffset;
+    m_bBaseEOF = false;
+    m_bInFrame = false;
+    m_nCurOffset = oFrame.nUncompressedOffset;
+    if (!m_poDecompressor->Reset() ||
+        m_poBaseHandle->Seek(oFrame.nCompressedOffset, SEEK_SET) != 0)
+    {
+        m_bError = true;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+// Decompresses up to nToRead bytes at the current position of the
+// decompressor. Returns the number of bytes decompressed.
+size_t VSIFramedReadHandle::Decompress(GByte *pabyDst, size_t nToRead)
+{
+    size_t nProduced = 0;
+    while (nProduced < nToRead && !m_bError)
+    {
+        if (m_nInPos == m_nInSize && !m_bBaseEOF)
+        {
+            m_nInBufferOffset += m_nInSize;
+            m_nInPos = 0;
+            m_nInSize = m_poBaseHandle->Read(m_abyIn.data(), 1, m_abyIn.size());
+            if (m_nInSize < m_abyIn.size())
+                m_bBaseEOF = true;
+        }
+        if (m_nInPos == m_nInSize && !m_bInFrame)
+        {
+            // End of the compressed stream
+            m_bUncompressedSizeKnown = true;
+            m_nUncompressedSize = m_nCurOffset;
+            break;
+        }
+
+        const size_t nInPosBefore = m_nInPos;
+        size_t nOutPos = 0;
+        bool bFrameEnd = false;
+        if (!m_poDecompressor->Decompress(
+                m_abyIn.data(), m_nInSize, m_nInPos, pabyDst + nProduced,
+                nToRead - nProduced, nOutPos, bFrameEnd))
+        {
+            m_bError = true;
+            break;
+        }
+        nProduced += nOutPos;
+        m_nCurOffset += nOutPos;
+
+        if (bFrameEnd)
+        {
+            m_bInFrame = false;
+            const vsi_l_offset nNextFrameOffset = m_nInBufferOffset + m_nInPos;
+            if (!m_bHasSeekTable &&
+                nNextFrameOffset > m_aoFrames.back().nCompressedOffset &&
+                m_nCurOffset >= m_aoFrames.back().nUncompressedOffset)
+            {
+                FrameStart oFrame;
+                oFrame.nCompressedOffset = nNextFrameOffset;
+                oFrame.nUncompressedOffset = m_nCurOffset;
+                m_aoFrames.push_back(oFrame);
+            }
+        }
+        else if (m_nInPos > nInPosBefore || nOutPos > 0)
+        {
+            m_bInFrame = true;
+        }
+        else if (m_bBaseEOF)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "%s is truncated",
+                     m_osFilename.c_str());
+            m_bError = true;
+        }
+    }
+    return nProduced;
+}
+
+/************************************************************************/
+/*                             SkipUntil()                              */
+/************************************************************************/
+
+bool VSIFramedReadHandle::SkipUntil(vsi_l_offset nOffset)
+{
+    if (m_nCurOffset < nOffset && m_abyDiscard.empty())
+    {
+        try
+        {
+            m_abyDiscard.resize(COMPRESSED_BUFFER_SIZE);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            return false;
+        }
+    }
+    while (m_nCurOffset < nOffset)
+    {
+        const size_t nToSkip = static_cast<size_t>(std::min<vsi_l_offset>(
+            nOffset - m_nCurOffset, m_abyDiscard.size()));
+        if (Decompress(m_abyDiscard.data(), nToSkip) < nToSkip)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        PositionDecompressor()                        */
+/************************************************************************/
+
+// Makes the decompressor ready to output the byte at m_nWantedOffset.
+// Returns false at end of file or on error.
+bool VSIFramedReadHandle::PositionDecompressor()
+{
+    if (m_bError)
+        return false;
+    if (m_bUncompressedSizeKnown && m_nWantedOffset >= m_nUncompressedSize)
+        return false;
+    if (m_nWantedOffset == m_nCurOffset)
+        return true;
+
+    const FrameStart &oFrame = GetFrameBefore(m_nWantedOffset);
+    if (m_nWantedOffset < m_nCurOffset ||
+        oFrame.nUncompressedOffset > m_nCurOffset)
+    {
+        if (!RestartFrom(oFrame))
+            return false;
+    }
+    return SkipUntil(m_nWantedOffset);
+}
+
+/************************************************************************/
+/*                        GetUncompressedSize()                         */
+/************************************************************************/
+
+// Returns the uncompressed size, which requires decompressing the whole
+// file if it has no seek table.
+bool VSIFramedReadHandle::GetUncompressedSize(vsi_l_offset &nSize)
+{
+    if (!m_bUncompressedSizeKnown)
+    {
+        const FrameStart &oFrame = m_aoFrames.back();
+        if (oFrame.nUncompressedOffset > m_nCurOffset && !RestartFrom(oFrame))
+            return false;
+        SkipUntil(std::numeric_limits<vsi_l_offset>::max());
+        if (m_bError || !m_bUncompressedSizeKnown)
+            return false;
+    }
+    nSize = m_nUncompressedSize;
+    return true;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIFramedReadHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nWantedOffset = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nWantedOffset += nOffset;
+    }
+    else
+    {
+        vsi_l_offset nSize = 0;
+        if (!GetUncompressedSize(nSize))
+            return -1;
+        m_nWantedOffset = nSize + nOffset;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIFramedReadHandle::Tell()
+{
+    return m_nWantedOffset;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIFramedReadHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
+{
+    if (nSize == 0 || nCount == 0)
+        return 0;
+    const size_t nToRead = nSize * nCount;
+    if (!PositionDecompressor())
+    {
+        m_bEOF = !m_bError;
+        return 0;
+    }
+    const size_t nRead = Decompress(static_cast<GByte *>(pBuffer), nToRead);
+    m_nWantedOffset += nRead;
+    if (nRead < nToRead && !m_bError)
+        m_bEOF = true;
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIFramedReadHandle::Write(const void * /* pBuffer */,
+                                  size_t /* nSize */, size_t /* nCount */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Write() not supported on files opened in read-only mode");
+    return 0;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void VSIFramedReadHandle::ClearErr()
+{
+    m_bEOF = false;
+    if (m_bError)
+    {
+        // The state of the decompressor is undefined after an error
+        m_bError = false;
+        RestartFrom(m_aoFrames.front());
+    }
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIFramedReadHandle::Eof()
+{
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int VSIFramedReadHandle::Error()
+{
+    return m_bError;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIFramedReadHandle::Close()
+{
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        m_poBaseHandle.reset();
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         VSIFramedWriteHandle                         */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIFramedWriteHandle final : public VSIVirtualHandle
+{
+    struct Job
+    {
+        std::vector<GByte> abyIn{};
+        std::vector<GByte> abyOut{};
+        bool bDone = false;
+        bool bOK = false;
+    };
+
+    std::shared_ptr<const VSIFramedCodec> m_poCodec;
+    VSIVirtualHandleUniquePtr m_poBaseHandle;
+    const int m_nLevel;
+    const size_t m_nChunkSize;
+    const int m_nThreads;
+
+    std::vector<GByte> m_abyCurChunk{};
+    vsi_l_offset m_nCurOffset = 0;
+    // Pairs of compressed and uncompressed sizes of the frames written
+    std::vector<std::pair<uint32_t, uint32_t>> m_anFrameSizes{};
+    bool m_bError = false;
+
+    // Frames being compressed by the worker threads, in file order
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::shared_ptr<Job>> m_apoJobs{};
+    // Declared last to be destroyed first
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIFramedWriteHandle)
+
+    bool SubmitChunk();
+    bool WriteFrame(size_t nUncompressedSize,
+                    const std::vector<GByte> &abyCompressed);
+    bool WriteCompletedFrames(bool bWaitForOne, bool bWaitForAll);
+    bool WriteSeekTable();
+
+  public:
+    VSIFramedWriteHandle(const std::shared_ptr<const VSIFramedCodec> &poCodec,
+                         VSIVirtualHandleUniquePtr poBaseHandle);
+    ~VSIFramedWriteHandle() override;
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nCount) override;
+
+    void ClearErr() override
+    {
+    }
+
+    int Eof() override
+    {
+        return 0;
+    }
+
+    int Error() override
+    {
+        return m_bError;
+    }
+
+    int Close() override;
+};
+
+/************************************************************************/
+/*                        VSIFramedWriteHandle()                        */
+/************************************************************************/
+
+VSIFramedWriteHandle::VSIFramedWriteHandle(
+    const std::shared_ptr<const VSIFramedCodec> &poCodec,
+    VSIVirtualHandleUniquePtr poBaseHandle)
+    : m_poCodec(poCodec), m_poBaseHandle(std::move(poBaseHandle)),
+      m_nLevel(poCodec->GetLevel()), m_nChunkSize(poCodec->GetChunkSize()),
+      m_nThreads(GetNumThreads())
+{
+    if (m_nThreads > 1)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (poPool->Setup(m_nThreads, nullptr, nullptr, false))
+            m_poPool = std::move(poPool);
+    }
+}
+
+/************************************************************************/
+/*                       ~VSIFramedWriteHandle()                        */
+/************************************************************************/
+
+VSIFramedWriteHandle::~VSIFramedWriteHandle()
+{
+    VSIFramedWriteHandle::Close();
+}
+
+/************************************************************************/
+/*                             WriteFrame()                             */
+/************************************************************************/
+
+bool VSIFramedWriteHandle::WriteFrame(size_t nUncompressedSize,
+                                      const std::vector<GByte> &abyCompressed)
+{
+    if (abyCompressed.size() > std::numeric_limits<uint32_t>::max() ||
+        m_anFrameSizes.size() == std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large frame or file");
+        return false;
+    }
+    if (m_poBaseHandle->Write(abyCompressed.data(), 1, abyCompressed.size()) !=
+        abyCompressed.size())
+    {
+        return false;
+    }
+    m_anFrameSizes.emplace_back(static_cast<uint32_t>(abyCompressed.size()),
+                                static_cast<uint32_t>(nUncompressedSize));
+    return true;
+}
+
+/************************************************************************/
+/*                        WriteCompletedFrames()                        */
+/************************************************************************/
+
+// Writes the frames whose compression is finished, in order. If bWaitForOne
+// is set, waits for the compression of the first pending frame. If
+// bWaitForAll is set, waits for all pending frames.
+bool VSIFramedWriteHandle::WriteCompletedFrames(bool bWaitForOne,
+                                                bool bWaitForAll)
+{
+    bool bOK = true;
+    while (true)
+    {
+        std::shared_ptr<Job> poJob;
+        {
+            std::unique_lock oLock(m_oMutex);
+            if (m_apoJobs.empty())
+                break;
+            if (!m_apoJobs.front()->bDone)
+            {
+                if (!bWaitForOne && !bWaitForAll)
+                    break;
+                m_oCV.wait(oLock, [this] { return m_apoJobs.front()->bDone; });
+            }
+            poJob = m_apoJobs.front();
+            m_apoJobs.pop_front();
+        }
+        bWaitForOne = false;
+        // Once an error occurred, just drain the pending jobs
+        if (bOK && !m_bError)
+        {
+            bOK = poJob->bOK && WriteFrame(poJob->abyIn.size(), poJob->abyOut);
+        }
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                            SubmitChunk()                             */
+/************************************************************************/
+
+bool VSIFramedWriteHandle::SubmitChunk()
+{
+    if (!m_poPool)
+    {
+        std::vector<GByte> abyOut;
+        const bool bOK =
+            m_poCodec->CompressFrame(m_abyCurChunk.data(), m_abyCurChunk.size(),
+                                     m_nLevel, abyOut) &&
+            WriteFrame(m_abyCurChunk.size(), abyOut);
+        m_abyCurChunk.clear();
+        return bOK;
+    }
+
+    auto poJob = std::make_shared<Job>();
+    poJob->abyIn.swap(m_abyCurChunk);
+    {
+        std::lock_guard oLock(m_oMutex);
+        m_apoJobs.push_back(poJob);
+    }
+    const bool bSubmitted = m_poPool->SubmitJob(
+        [this, poJob]()
+        {
+            const bool bOK =
+                m_poCodec->CompressFrame(poJob->abyIn.data(),
+                                         poJob->abyIn.size(), m_nLevel,
+                                         poJob->abyOut);
+            std::lock_guard oLock(m_oMutex);
+            poJob->bOK = bOK;
+            poJob->bDone = true;
+            m_oCV.notify_all();
+        });
+    if (!bSubmitted)
+    {
+        std::lock_guard oLock(m_oMutex);
+        poJob->bDone = true;
+    }
+
+    // Limit the number of chunks in memory
+    size_t nPendingJobs;
+    {
+        std::lock_guard oLock(m_oMutex);
+        nPendingJobs = m_apoJobs.size();
+    }
+    const bool bOK = WriteCompletedFrames(
+        nPendingJobs >= 2 * static_cast<size_t>(m_nThreads), false);
+    return bSubmitted && bOK;
+}
+
+/************************************************************************/
+/*                           WriteSeekTable()                           */
+/************************************************************************/
+
+bool VSIFramedWriteHandle::WriteSeekTable()
+{
+    std::vector<GByte> abyTable;
+    const size_t nFrames = m_anFrameSizes.size();
+    const size_t nTableContentSize = nFrames * 8 + SEEK_TABLE_FOOTER_SIZE;
+    if (nTableContentSize > std::numeric_limits<uint32_t>::max())
+    {
+        // Should not happen given the minimum chunk size
+        return true;
+    }
+    abyTable.reserve(SKIPPABLE_HEADER_SIZE + nTableContentSize);
+    AppendUInt32LSB(abyTable, SKIPPABLE_SEEK_TABLE_MAGIC);
+    AppendUInt32LSB(abyTable, static_cast<uint32_t>(nTableContentSize));
+    for (const auto &[nCompressedSize, nUncompressedSize] : m_anFrameSizes)
+    {
+        AppendUInt32LSB(abyTable, nCompressedSize);
+        AppendUInt32LSB(abyTable, nUncompressedSize);
+    }
+    AppendUInt32LSB(abyTable, static_cast<uint32_t>(nFrames));
+    abyTable.push_back(0);  // descriptor: no checksum
+    AppendUInt32LSB(abyTable, SEEKABLE_MAGIC);
+    return m_poBaseHandle->Write(abyTable.data(), 1, abyTable.size()) ==
+           abyTable.size();
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIFramedWriteHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    if (nOffset == 0 && (nWhence == SEEK_END || nWhence == SEEK_CUR))
+        return 0;
+    if (nWhence == SEEK_SET && nOffset == m_nCurOffset)
+        return 0;
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Seeking is not supported on writable %s files",
+             m_poCodec->GetPrefix());
+    return -1;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIFramedWriteHandle::Tell()
+{
+    return m_nCurOffset;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIFramedWriteHandle::Read(void * /* pBuffer */, size_t /* nSize */,
+                                  size_t /* nCount */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Read() not supported on files opened in write-only mode");
+    return 0;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIFramedWriteHandle::Write(const void *pBuffer, size_t nSize,
+                                   size_t nCount)
+{
+    if (m_bError || !m_poBaseHandle)
+        return 0;
+    const GByte *pabyIn = static_cast<const GByte *>(pBuffer);
+    size_t nRemaining = nSize * nCount;
+    while (nRemaining > 0)
+    {
+        if (m_abyCurChunk.capacity() < m_nChunkSize)
+        {
+            try
+            {
+                m_abyCurChunk.reserve(m_nChunkSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+                m_bError = true;
+                return 0;
+            }
+        }
+        const size_t nToCopy =
+            std::min(nRemaining, m_nChunkSize - m_abyCurChunk.size());
+        m_abyCurChunk.insert(m_abyCurChunk.end(), pabyIn, pabyIn + nToCopy);
+        pabyIn += nToCopy;
+        nRemaining -= nToCopy;
+        m_nCurOffset += nToCopy;
+        if (m_abyCurChunk.size() == m_nChunkSize && !SubmitChunk())
+        {
+            m_bError = true;
+            return 0;
+        }
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIFramedWriteHandle::Close()
+{
+    if (!m_poBaseHandle)
+        return 0;
+
+    bool bOK = !m_bError;
+    // An empty file still gets an (empty) frame, to be a valid stream
+    if (bOK && (!m_abyCurChunk.empty() || m_anFrameSizes.empty()))
+        bOK = SubmitChunk();
+    if (m_poPool)
+        bOK = WriteCompletedFrames(false, true) && bOK;
+    bOK = bOK && WriteSeekTable();
+    if (m_poBaseHandle->Close() != 0)
+        bOK = false;
+    m_poBaseHandle.reset();
+    m_bError = !bOK;
+    return bOK ? 0 : -1;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                      VSIFramedFilesystemHandler                      */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIFramedFilesystemHandler final : public VSIFilesystemHandler
+{
+    const std::shared_ptr<const VSIFramedCodec> m_poCodec;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIFramedFilesystemHandler)
+
+    std::unique_ptr<VSIFramedReadHandle>
+    OpenReadOnly(const char *pszFilename, bool bSetError);
+
+  public:
+    explicit VSIFramedFilesystemHandler(
+        std::shared_ptr<const VSIFramedCodec> poCodec)
+        : m_poCodec(std::move(poCodec))
+    {
+    }
+
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError, CSLConstList papszOptions) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+
+    const char *GetOptions() override
+    {
+        return m_poCodec->GetOptions();
+    }
+
+    bool SupportsSequentialWrite(const char *pszPath,
+                                 bool bAllowLocalTempFile) override;
+
+    bool SupportsRandomWrite(const char * /* pszPath */,
+                             bool /* bAllowLocalTempFile */) override
+    {
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                            OpenReadOnly()                            */
+/************************************************************************/
+
+std::unique_ptr<VSIFramedReadHandle>
+VSIFramedFilesystemHandler::OpenReadOnly(const char *pszFilename,
+                                         bool bSetError)
+{
+    const char *pszBaseFilename = pszFilename + strlen(m_poCodec->GetPrefix());
+    VSIVirtualHandleUniquePtr poBaseHandle(
+        VSIFOpenExL(pszBaseFilename, "rb", bSetError));
+    if (!poBaseHandle)
+        return nullptr;
+    auto poHandle = std::make_unique<VSIFramedReadHandle>(
+        pszBaseFilename, std::move(poBaseHandle));
+    if (!poHandle->Init(*m_poCodec))
+        return nullptr;
+    return poHandle;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandle *
+VSIFramedFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
+                                 bool bSetError,
+                                 CSLConstList /* papszOptions */)
+{
+    const char *pszPrefix = m_poCodec->GetPrefix();
+    if (!STARTS_WITH_CI(pszFilename, pszPrefix))
+        return nullptr;
+
+    if (strchr(pszAccess, 'w') != nullptr || strchr(pszAccess, 'a') != nullptr)
+    {
+        if (strchr(pszAccess, '+') != nullptr ||
+            strchr(pszAccess, 'a') != nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Only read-only or write-only access is supported for "
+                     "%s",
+                     pszPrefix);
+            return nullptr;
+        }
+        VSIVirtualHandleUniquePtr poBaseHandle(
+            VSIFOpenExL(pszFilename + strlen(pszPrefix), "wb", bSetError));
+        if (!poBaseHandle)
+            return nullptr;
+        return new VSIFramedWriteHandle(m_poCodec, std::move(poBaseHandle));
+    }
+
+    if (strchr(pszAccess, '+') != nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only read-only or write-only access is supported for %s",
+                 pszPrefix);
+        return nullptr;
+    }
+
+    auto poHandle = OpenReadOnly(pszFilename, bSetError);
+    if (!poHandle)
+        return nullptr;
+    // Wrap inside a buffered reader to make small backward seeks cheap
+    return VSICreateBufferedReaderHandle(poHandle.release());
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSIFramedFilesystemHandler::Stat(const char *pszFilename,
+                                     VSIStatBufL *pStatBuf, int nFlags)
+{
+    const char *pszPrefix = m_poCodec->GetPrefix();
+    if (!STARTS_WITH_CI(pszFilename, pszPrefix))
+        return -1;
+
+    memset(pStatBuf, 0, sizeof(VSIStatBufL));
+    int nRet = VSIStatExL(pszFilename + strlen(pszPrefix), pStatBuf, nFlags);
+    if (nRet == 0 && (nFlags & VSI_STAT_SIZE_FLAG) != 0 &&
+        VSI_ISREG(pStatBuf->st_mode))
+    {
+        // Fast if the file has a seek table, otherwise it requires
+        // decompressing the whole file.
+        auto poHandle = OpenReadOnly(pszFilename, false);
+        vsi_l_offset nSize = 0;
+        if (poHandle && poHandle->GetUncompressedSize(nSize))
+            pStatBuf->st_size = nSize;
+        else
+            nRet = -1;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                      SupportsSequentialWrite()                       */
+/************************************************************************/
+
+bool VSIFramedFilesystemHandler::SupportsSequentialWrite(
+    const char *pszPath, bool bAllowLocalTempFile)
+{
+    const char *pszPrefix = m_poCodec->GetPrefix();
+    if (!STARTS_WITH_CI(pszPath, pszPrefix))
+        return false;
+    const char *pszBaseFilename = pszPath + strlen(pszPrefix);
+    return VSIFileManager::GetHandler(pszBaseFilename)
+        ->SupportsSequentialWrite(pszBaseFilename, bAllowLocalTempFile);
+}
+
+#ifdef HAVE_ZSTD
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            Zstandard codec                           */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIZstdDecompressor final : public VSIFrameDecompressor
+{
+    ZSTD_DStream *m_psStream = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdDecompressor)
+
+  public:
+    VSIZstdDecompressor() : m_psStream(ZSTD_createDStream())
+    {
+    }
+
+    ~VSIZstdDecompressor() override
+    {
+        ZSTD_freeDStream(m_psStream);
+    }
+
+    bool Reset() override
+    {
+        return m_psStream != nullptr &&
+               !ZSTD_isError(ZSTD_initDStream(m_psStream));
+    }
+
+    bool Decompress(const GByte *pabyIn, size_t nInSize, size_t &nInPos,
+                    GByte *pabyOut, size_t nOutSize, size_t &nOutPos,
+                    bool &bFrameEnd) override
+    {
+        ZSTD_inBuffer sIn = {pabyIn, nInSize, nInPos};
+        ZSTD_outBuffer sOut = {pabyOut, nOutSize, nOutPos};
+        const size_t nRet = ZSTD_decompressStream(m_psStream, &sOut, &sIn);
+        if (ZSTD_isError(nRet))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "ZSTD_decompressStream() failed: %s",
+                     ZSTD_getErrorName(nRet));
+            return false;
+        }
+        nInPos = sIn.pos;
+        nOutPos = sOut.pos;
+        bFrameEnd = nRet == 0;
+        return true;
+    }
+};
+
+class VSIZstdCodec final : public VSIFramedCodec
+{
+  public:
+    const char *GetPrefix() const override
+    {
+        return "/vsizstd/";
+    }
+
+    std::unique_ptr<VSIFrameDecompressor> CreateDecompressor() const override
+    {
+        return std::make_unique<VSIZstdDecompressor>();
+    }
+
+    bool CompressFrame(const GByte *pabyIn, size_t nInSize, int nLevel,
+                       std::vector<GByte> &abyOut) const override
+    {
+        ZSTD_CCtx *psCtx = ZSTD_createCCtx();
+        if (!psCtx)
+            return false;
+        size_t nRet = 0;
+        try
+        {
+            abyOut.resize(ZSTD_compressBound(nInSize));
+            nRet = ZSTD_CCtx_setParameter(psCtx, ZSTD_c_compressionLevel,
+                                          nLevel);
+            if (!ZSTD_isError(nRet))
+                nRet = ZSTD_CCtx_setParameter(psCtx, ZSTD_c_checksumFlag, 1);
+            if (!ZSTD_isError(nRet))
+                nRet = ZSTD_compress2(psCtx, abyOut.data(), abyOut.size(),
+                                      pabyIn, nInSize);
+        }
+        catch (const std::exception &)
+        {
+            ZSTD_freeCCtx(psCtx);
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            return false;
+        }
+        ZSTD_freeCCtx(psCtx);
+        if (ZSTD_isError(nRet))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "ZSTD compression failed: %s",
+                     ZSTD_getErrorName(nRet));
+            return false;
+        }
+        abyOut.resize(nRet);
+        return true;
+    }
+
+    int GetLevel() const override
+    {
+        const int nLevel =
+            atoi(CPLGetConfigOption("CPL_VSIL_ZSTD_LEVEL", "3"));
+        return std::max(1, std::min(ZSTD_maxCLevel(), nLevel));
+    }
+
+    size_t GetChunkSize() const override
+    {
+        return ParseChunkSize(
+            "CPL_VSIL_ZSTD_CHUNK_SIZE",
+            CPLGetConfigOption("CPL_VSIL_ZSTD_CHUNK_SIZE", "1M"));
+    }
+
+    const char *GetOptions() const override
+    {
+        return "<Options>"
+               "  <Option name='GDAL_NUM_THREADS' type='string' "
+               "description='Number of threads for compression. Either a "
+               "integer or ALL_CPUS'/>"
+               "  <Option name='CPL_VSIL_ZSTD_CHUNK_SIZE' type='string' "
+               "description='Uncompressed size of frames. Use K(ilobytes) or "
+               "M(egabytes) suffix' default='1M'/>"
+               "  <Option name='CPL_VSIL_ZSTD_LEVEL' type='int' "
+               "description='Compression level' default='3' min='1' "
+               "max='22'/>"
+               "</Options>";
+    }
+};
+
+#endif  // HAVE_ZSTD
+
+#ifdef HAVE_LZ4
+
+/************************************************************************/
+/* ==================================================================== */
+/*                              LZ4 codec                               */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSILZ4Decompressor final : public VSIFrameDecompressor
+{
+    LZ4F_dctx *m_psCtx = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSILZ4Decompressor)
+
+  public:
+    VSILZ4Decompressor()
+    {
+        if (LZ4F_isError(
+                LZ4F_createDecompressionContext(&m_psCtx, LZ4F_VERSION)))
+        {
+            m_psCtx = nullptr;
+        }
+    }
+
+    ~VSILZ4Decompressor() override
+    {
+        if (m_psCtx)
+            LZ4F_freeDecompressionContext(m_psCtx);
+    }
+
+    bool Reset() override
+    {
+        if (!m_psCtx)
+            return false;
+        LZ4F_resetDecompressionContext(m_psCtx);
+        return true;
+    }
+
+    bool Decompress(const GByte *pabyIn, size_t nInSize, size_t &nInPos,
+                    GByte *pabyOut, size_t nOutSize, size_t &nOutPos,
+                    bool &bFrameEnd) override
+    {
+        size_t nIn = nInSize - nInPos;
+        size_t nOut = nOutSize - nOutPos;
+        const size_t nRet = LZ4F_decompress(m_psCtx, pabyOut + nOutPos, &nOut,
+                                            pabyIn + nInPos, &nIn, nullptr);
+        if (LZ4F_isError(nRet))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "LZ4F_decompress() failed: %s", LZ4F_getErrorName(nRet));
+            return false;
+        }
+        nInPos += nIn;
+        nOutPos += nOut;
+        bFrameEnd = nRet == 0;
+        return true;
+    }
+};
+
+class VSILZ4Codec final : public VSIFramedCodec
+{
+  public:
+    const char *GetPrefix() const override
+    {
+        return "/vsilz4/";
+    }
+
+    std::unique_ptr<VSIFrameDecompressor> CreateDecompressor() const override
+    {
+        return std::make_unique<VSILZ4Decompressor>();
+    }
+
+    bool CompressFrame(const GByte *pabyIn, size_t nInSize, int nLevel,
+                       std::vector<GByte> &abyOut) const override
+    {
+        LZ4F_preferences_t sPrefs;
+        memset(&sPrefs, 0, sizeof(sPrefs));
+        sPrefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+        sPrefs.frameInfo.contentSize = nInSize;
+        sPrefs.compressionLevel = nLevel;
+        try
+        {
+            abyOut.resize(LZ4F_compressFrameBound(nInSize, &sPrefs));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            return false;
+        }
+        const size_t nRet = LZ4F_compressFrame(abyOut.data(), abyOut.size(),
+                                               pabyIn, nInSize, &sPrefs);
+        if (LZ4F_isError(nRet))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "LZ4F_compressFrame() failed: %s",
+                     LZ4F_getErrorName(nRet));
+            return false;
+        }
+        abyOut.resize(nRet);
+        return true;
+    }
+
+    int GetLevel() const override
+    {
+        const int nLevel = atoi(CPLGetConfigOption("CPL_VSIL_LZ4_LEVEL", "0"));
+        return std::max(0, std::min(12, nLevel));
+    }
+
+    size_t GetChunkSize() const override
+    {
+        return ParseChunkSize(
+            "CPL_VSIL_LZ4_CHUNK_SIZE",
+            CPLGetConfigOption("CPL_VSIL_LZ4_CHUNK_SIZE", "1M"));
+    }
+
+    const char *GetOptions() const override
+    {
+        return "<Options>"
+               "  <Option name='GDAL_NUM_THREADS' type='string' "
+               "description='Number of threads for compression. Either a "
+               "integer or ALL_CPUS'/>"
+               "  <Option name='CPL_VSIL_LZ4_CHUNK_SIZE' type='string' "
+               "description='Uncompressed size of frames. Use K(ilobytes) or "
+               "M(egabytes) suffix' default='1M'/>"
+               "  <Option name='CPL_VSIL_LZ4_LEVEL' type='int' "
+               "description='Compression level. Values of 3 and above select "
+               "the high compression mode' default='0' min='0' max='12'/>"
+               "</Options>";
+    }
+};
+
+#endif  // HAVE_LZ4
+
+}  // namespace
+
+//! @endcond
+
+#endif  // defined(HAVE_ZSTD) || defined(HAVE_LZ4)
+
+/************************************************************************/
+/*                     VSIInstallZstdFileHandler()                      */
+/************************************************************************/
+
+/*!
+ \brief Install /vsizstd/ Zstandard file system handler (requires libzstd)
+
+ A special file handler is installed that allows reading on-the-fly and
+ writing in Zstandard (.zst) files.
+
+ \verbatim embed:rst
+ See :ref:`/vsizstd/ documentation <vsizstd>`
+ \endverbatim
+
+ @since GDAL 3.12
+ */
+void VSIInstallZstdFileHandler(void)
+{
+#ifdef HAVE_ZSTD
+    VSIFileManager::InstallHandler(
+        "/vsizstd/",
+        new VSIFramedFilesystemHandler(std::make_shared<VSIZstdCodec>()));
+#endif
+}
+
+/************************************************************************/
+/*                      VSIInstallLZ4FileHandler()                      */
+/************************************************************************/
+
+/*!
+ \brief Install /vsilz4/ LZ4 file system handler (requires liblz4)
+
+ A special file handler is installed that allows reading on-the-fly and
+ writing in LZ4 frame format (.lz4) files.
+
+ \verbatim embed:rst
+ See :ref:`/vsilz4/ documentation <vsilz4>`
+ \endverbatim
+
+ @since GDAL 3.12
+ */
+void VSIInstallLZ4FileHandler(void)
+{
+#ifdef HAVE_LZ4
+    VSIFileManager::InstallHandler(
+        "/vsilz4/",
+        new VSIFramedFilesystemHandler(std::make_shared<VSILZ4Codec>()));
+#endif
+}
@@ -69,7 +69,7 @@
 // DEBUG_VSIMALLOC must also be defined.
 // #define DEBUG_VSIMALLOC_MPROTECT
 
-#ifdef DEBUG_VSIMALLOC_MPROTECT
+#if defined(DEBUG_VSIMALLOC_MPROTECT) || defined(__linux)
 #include <sys/mman.h>
 #endif
 
@@ -998,6 +998,54 @@ void VSIFreeAligned(void *ptr)
 #endif
 }
 
+/************************************************************************/
+/*                         VSIAdviseHugePages()                         */
+/************************************************************************/
+
+/** Advise the operating system to back a large buffer with huge pages.
+ *
+ * This reduces the number of TLB misses when processing large in-memory
+ * rasters. This is only implemented on Linux, with transparent huge pages
+ * (madvise(MADV_HUGEPAGE)), and it is only done for buffers of at least
+ * 32 MB, on the part of the buffer aligned on the huge page size. It should
+ * be called before the buffer is first written, for example just after
+ * VSICalloc(), as memory already touched is only collapsed into huge pages
+ * lazily by the kernel. It can be disabled by setting the VSI_HUGE_PAGES
+ * configuration option to NO.
+ *
+ * This is only a hint: failures are silently ignored.
+ *
+ * @param ptr Buffer, or NULL.
+ * @param nSize Size of the buffer in bytes.
+ * @since GDAL 3.12
+ */
+
+void VSIAdviseHugePages(void *ptr, size_t nSize)
+{
+#if defined(__linux) && defined(MADV_HUGEPAGE)
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    constexpr size_t MIN_SIZE = 32 * 1024 * 1024;
+    if (ptr == nullptr || nSize < MIN_SIZE ||
+        !CPLTestBool(CPLGetConfigOption("VSI_HUGE_PAGES", "YES")))
+        return;
+    const uintptr_t nStart = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t nAlignedStart =
+        (nStart + HUGE_PAGE_SIZE - 1) & ~(uintptr_t(HUGE_PAGE_SIZE) - 1);
+    const uintptr_t nAlignedEnd =
+        (nStart + nSize) & ~(uintptr_t(HUGE_PAGE_SIZE) - 1);
+    if (nAlignedEnd > nAlignedStart &&
+        madvise(reinterpret_cast<void *>(nAlignedStart),
+                nAlignedEnd - nAlignedStart, MADV_HUGEPAGE) != 0)
+    {
+        CPLDebugOnce("CPL", "madvise(MADV_HUGEPAGE) failed: %s",
+                     strerror(errno));
+    }
+#else
+    CPL_IGNORE_RET_VAL(ptr);
+    CPL_IGNORE_RET_VAL(nSize);
+#endif
+}
+
 /************************************************************************/
 /*                             VSIStrdup()                              */
 /************************************************************************/
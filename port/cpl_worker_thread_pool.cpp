@@ -13,7 +13,9 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 
 #include "cpl_conv.h"
@@ -21,6 +23,7 @@
 #include "cpl_vsi.h"
 
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
 
 /************************************************************************/
 /*                         CPLWorkerThreadPool()                        */
@@ -93,6 +96,7 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
@@ -132,6 +136,16 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  * @return true in case of success.
  */
 bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
+{
+    return SubmitJobInternal(std::move(task), nullptr);
+}
+
+/************************************************************************/
+/*                         SubmitJobInternal()                          */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::SubmitJobInternal(std::function<void()> task,
+                                            CPLJobQueue *poQueue)
 {
 #ifdef DEBUG
     {
@@ -144,7 +158,10 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
     if (threadLocalCurrentThreadPool == this)
     {
         // If there are waiting threads or we have not started all allowed
-        // threads, we can submit this job asynchronously
+        // threads, we can submit this job asynchronously.
+        // This also applies to jobs of a job queue: callers may wait for
+        // them on their own synchronization primitives, instead of
+        // CPLJobQueue::WaitCompletion() that runs pending jobs.
         {
             std::unique_lock<std::mutex> oGuard(m_mutex);
             if (nWaitingWorkerThreads > 0 ||
@@ -160,6 +177,18 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
             task();
             return true;
         }
+
+        // Queue the job in the deque of the current thread, to avoid
+        // contention on m_mutex and run it in priority after the current
+        // job, unless it is stolen by another thread.
+        nPendingJobs++;
+        CPLWorkerThread *psWorkerThread = threadLocalCurrentWorkerThread;
+        {
+            std::lock_guard<std::mutex> oGuardJobs(
+                psWorkerThread->m_jobsMutex);
+            psWorkerThread->m_jobs.push_back(
+                CPLWorkerThreadJob{std::move(task), poQueue});
+        }
     }
 
     std::unique_lock<std::mutex> oGuard(m_mutex);
@@ -188,9 +217,27 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
             aWT.emplace_back(std::move(wt));
     }
 
-    jobQueue.emplace(task);
-    nPendingJobs++;
+    if (threadLocalCurrentThreadPool != this)
+    {
+        jobQueue.push_back(CPLWorkerThreadJob{std::move(task), poQueue});
+        nPendingJobs++;
+    }
+
+    WakeUpWaitingWorkerThread(oGuard);
 
+    // coverity[double_unlock]
+    return true;
+}
+
+/************************************************************************/
+/*                     WakeUpWaitingWorkerThread()                      */
+/************************************************************************/
+
+// Must be called with m_mutex locked by oGuard. It might be unlocked on
+// return.
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThread(
+    std::unique_lock<std::mutex> &oGuard)
+{
     if (psWaitingWorkerThreadsList)
     {
         CPLWorkerThread *psWorkerThread =
@@ -221,9 +268,6 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
 
         CPLFree(psToFree);
     }
-
-    // coverity[double_unlock]
-    return true;
 }
 
 /************************************************************************/
@@ -279,44 +323,16 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
             }
         }
 
-        jobQueue.emplace([=] { pfnFunc(pData); });
+        jobQueue.push_back(
+            CPLWorkerThreadJob{[=] { pfnFunc(pData); }, nullptr});
         nPendingJobs++;
     }
 
-    for (size_t i = 0; i < apData.size(); i++)
+    for (size_t i = 0; i < apData.size() && psWaitingWorkerThreadsList; i++)
     {
-        if (psWaitingWorkerThreadsList)
-        {
-            CPLWorkerThread *psWorkerThread;
-
-            psWorkerThread = static_cast<CPLWorkerThread *>(
-                psWaitingWorkerThreadsList->pData);
-
-            CPLAssert(psWorkerThread->bMarkedAsWaiting);
-            psWorkerThread->bMarkedAsWaiting = false;
-
-            CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-            CPLList *psToFree = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psNext;
-            nWaitingWorkerThreads--;
-
-#if DEBUG_VERBOSE
-            CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-            {
-                std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-                // coverity[uninit_use_in_call]
-                oGuard.unlock();
-                psWorkerThread->m_cv.notify_one();
-            }
-
-            CPLFree(psToFree);
+        WakeUpWaitingWorkerThread(oGuard);
+        if (!oGuard.owns_lock())
             oGuard.lock();
-        }
-        else
-        {
-            break;
-        }
     }
 
     return true;
@@ -337,8 +353,12 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    // Must be incremented before checking nPendingJobs. See
+    // DeclareJobFinished()
+    m_nPendingJobsWaiters++;
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return nPendingJobs <= nMaxRemainingJobs; });
+    m_nPendingJobsWaiters--;
 }
 
 /************************************************************************/
@@ -354,12 +374,18 @@ void CPLWorkerThreadPool::WaitEvent()
     // a notification occurs, jobs could be submitted which would increase
     // nPendingJobs, so a job completion may looks like a spurious wakeup.
     std::unique_lock<std::mutex> oGuard(m_mutex);
-    if (nPendingJobs == 0)
-        return;
+    m_nPendingJobsWaiters++;
     const int nPendingJobsBefore = nPendingJobs;
-    m_cv.wait(oGuard, [this, nPendingJobsBefore]
-              { return nPendingJobs < nPendingJobsBefore || m_bNotifyEvent; });
-    m_bNotifyEvent = false;
+    if (nPendingJobsBefore > 0)
+    {
+        m_cv.wait(oGuard,
+                  [this, nPendingJobsBefore] {
+                      return nPendingJobs < nPendingJobsBefore ||
+                             m_bNotifyEvent;
+                  });
+        m_bNotifyEvent = false;
+    }
+    m_nPendingJobsWaiters--;
 }
 
 /************************************************************************/
@@ -434,6 +460,8 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
             bRet = false;
             break;
         }
+        // Worker threads iterate over aWT to steal jobs
+        std::lock_guard<std::mutex> oGuard(m_mutex);
         aWT.emplace_back(std::move(wt));
     }
 
@@ -465,9 +493,16 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 
 void CPLWorkerThreadPool::DeclareJobFinished()
 {
-    std::lock_guard<std::mutex> oGuard(m_mutex);
+    // Only take the mutex if a thread is waiting in WaitCompletion() or
+    // WaitEvent(). As both nPendingJobs and m_nPendingJobsWaiters are
+    // sequentially consistent, either the waiting thread sees the updated
+    // value of nPendingJobs, or we see that it is waiting.
     nPendingJobs--;
-    m_cv.notify_one();
+    if (m_nPendingJobsWaiters > 0)
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_cv.notify_all();
+    }
 }
 
 /************************************************************************/
@@ -477,20 +512,34 @@ void CPLWorkerThreadPool::DeclareJobFinished()
 std::function<void()>
 CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
 {
-    std::unique_lock<std::mutex> oGuard(m_mutex);
     while (true)
     {
+        {
+            // Run first the most recent job submitted from this thread.
+            // Other threads only remove jobs from that deque, so checking
+            // it without m_mutex cannot miss a job.
+            std::lock_guard<std::mutex> oGuardJobs(
+                psWorkerThread->m_jobsMutex);
+            if (!psWorkerThread->m_jobs.empty())
+            {
+                auto task = std::move(psWorkerThread->m_jobs.back().task);
+                psWorkerThread->m_jobs.pop_back();
+                return task;
+            }
+        }
+
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+
         if (eState == CPLWTS_STOP)
             return std::function<void()>();
 
-        if (jobQueue.size())
+        CPLWorkerThreadJob oJob;
+        if (TakeJob(psWorkerThread, nullptr, oJob))
         {
 #if DEBUG_VERBOSE
             CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            auto task = std::move(jobQueue.front());
-            jobQueue.pop();
-            return task;
+            return std::move(oJob.task);
         }
 
         if (!psWorkerThread->bMarkedAsWaiting)
@@ -532,12 +581,96 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
         oGuard.unlock();
         // coverity[wait_not_in_locked_loop]
         psWorkerThread->m_cv.wait(oGuardThisThread);
-        // coverity[lock_order]
-        oGuard.lock();
 #endif
     }
 }
 
+/************************************************************************/
+/*                              TakeJob()                               */
+/************************************************************************/
+
+// Must be called with m_mutex locked.
+// Take the oldest job of poQueue (or of any queue if poQueue is null), either
+// from the shared queue, or stolen from the deque of another worker thread.
+bool CPLWorkerThreadPool::TakeJob(CPLWorkerThread *psWorkerThread,
+                                  const CPLJobQueue *poQueue,
+                                  CPLWorkerThreadJob &oJob)
+{
+    const auto IsCandidate = [poQueue](const CPLWorkerThreadJob &oOtherJob)
+    { return poQueue == nullptr || oOtherJob.poQueue == poQueue; };
+
+    auto oIter = std::find_if(jobQueue.begin(), jobQueue.end(), IsCandidate);
+    if (oIter != jobQueue.end())
+    {
+        oJob = std::move(*oIter);
+        jobQueue.erase(oIter);
+        return true;
+    }
+
+    for (auto &wt : aWT)
+    {
+        if (wt.get() == psWorkerThread)
+            continue;
+        std::lock_guard<std::mutex> oGuardJobs(wt->m_jobsMutex);
+        oIter = std::find_if(wt->m_jobs.begin(), wt->m_jobs.end(), IsCandidate);
+        if (oIter != wt->m_jobs.end())
+        {
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p steals a job from %p", psWorkerThread,
+                     wt.get());
+#endif
+            oJob = std::move(*oIter);
+            wt->m_jobs.erase(oIter);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                           RunPendingJob()                            */
+/************************************************************************/
+
+// If called from a worker thread of this pool, run a job of poQueue that has
+// not been started yet, and return true. Used to avoid blocking worker
+// threads (and potentially deadlocking) when a job waits for jobs it has
+// submitted.
+bool CPLWorkerThreadPool::RunPendingJob(const CPLJobQueue *poQueue)
+{
+    CPLWorkerThread *psWorkerThread = threadLocalCurrentWorkerThread;
+    if (threadLocalCurrentThreadPool != this || psWorkerThread == nullptr)
+        return false;
+
+    CPLWorkerThreadJob oJob;
+    bool bFound = false;
+    {
+        std::lock_guard<std::mutex> oGuardJobs(psWorkerThread->m_jobsMutex);
+        auto &jobs = psWorkerThread->m_jobs;
+        for (auto oIter = jobs.rbegin(); oIter != jobs.rend(); ++oIter)
+        {
+            if (oIter->poQueue == poQueue)
+            {
+                oJob = std::move(*oIter);
+                jobs.erase(std::next(oIter).base());
+                bFound = true;
+                break;
+            }
+        }
+    }
+    if (!bFound)
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        bFound = TakeJob(psWorkerThread, poQueue, oJob);
+    }
+    if (!bFound)
+        return false;
+
+    oJob.task();
+    DeclareJobFinished();
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateJobQueue()                             */
 /************************************************************************/
@@ -619,7 +752,7 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
         DeclareJobFinished();
     };
     // cppcheck-suppress knownConditionTrueFalse
-    return m_poPool->SubmitJob(std::move(lambda));
+    return m_poPool->SubmitJobInternal(std::move(lambda), this);
 }
 
 /************************************************************************/
@@ -627,6 +760,10 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
 /************************************************************************/
 
 /** Wait for completion of part or whole jobs.
+ *
+ * When called from a job of the worker thread pool, the jobs of this queue
+ * that have not been started yet are run by the calling thread, instead
+ * of blocking it.
  *
  * @param nMaxRemainingJobs Maximum number of pendings jobs that are allowed
  *                          in the queue after this method has completed. Might
@@ -634,6 +771,17 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            if (m_nPendingJobs <= nMaxRemainingJobs)
+                return;
+        }
+        if (!m_poPool->RunPendingJob(this))
+            break;
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return m_nPendingJobs <= nMaxRemainingJobs; });
@@ -652,6 +800,17 @@ bool CPLJobQueue::WaitEvent()
     // NOTE - This isn't quite right. After nPendingJobsBefore is set but before
     // a notification occurs, jobs could be submitted which would increase
     // nPendingJobs, so a job completion may looks like a spurious wakeup.
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        if (m_nPendingJobs == 0)
+            return false;
+    }
+    if (m_poPool->RunPendingJob(this))
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        return m_nPendingJobs > 0;
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     if (m_nPendingJobs == 0)
         return false;
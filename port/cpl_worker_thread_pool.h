@@ -16,7 +16,9 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -30,9 +32,17 @@
  * @since GDAL 2.1
  */
 
+class CPLJobQueue;
+
 #ifndef DOXYGEN_SKIP
 class CPLWorkerThreadPool;
 
+struct CPLWorkerThreadJob
+{
+    std::function<void()> task{};
+    CPLJobQueue *poQueue = nullptr;  // Job queue of the job, if any
+};
+
 struct CPLWorkerThread
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThread)
@@ -46,6 +56,11 @@ struct CPLWorkerThread
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
+
+    // Jobs submitted by jobs running in this thread. This thread takes them
+    // from the back, other threads steal them from the front.
+    std::mutex m_jobsMutex{};
+    std::deque<CPLWorkerThreadJob> m_jobs{};
 };
 
 typedef enum
@@ -56,7 +71,6 @@ typedef enum
 } CPLWorkerThreadState;
 #endif  // ndef DOXYGEN_SKIP
 
-class CPLJobQueue;
 /// Unique pointer to a job queue.
 using CPLJobQueuePtr = std::unique_ptr<CPLJobQueue>;
 
@@ -69,8 +83,9 @@ class CPL_DLL CPLWorkerThreadPool
     mutable std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    std::queue<std::function<void()>> jobQueue;
-    int nPendingJobs = 0;
+    std::deque<CPLWorkerThreadJob> jobQueue;
+    std::atomic<int> nPendingJobs{0};
+    std::atomic<int> m_nPendingJobsWaiters{0};
     bool m_bNotifyEvent = false;
 
     CPLList *psWaitingWorkerThreadsList = nullptr;
@@ -82,6 +97,13 @@ class CPL_DLL CPLWorkerThreadPool
 
     void DeclareJobFinished();
     std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
+    bool TakeJob(CPLWorkerThread *psWorkerThread, const CPLJobQueue *poQueue,
+                 CPLWorkerThreadJob &oJob);
+    void WakeUpWaitingWorkerThread(std::unique_lock<std::mutex> &oGuard);
+    bool SubmitJobInternal(std::function<void()> task, CPLJobQueue *poQueue);
+    bool RunPendingJob(const CPLJobQueue *poQueue);
+
+    friend class CPLJobQueue;
 
   public:
     CPLWorkerThreadPool();
@@ -200,6 +200,8 @@ void CPL_STDCALL PyCPLErrorHandler(CPLErr eErrClass, CPLErrorNum err_no, const c
 %rename (HasThreadSupport) wrapper_HasThreadSupport;
 %rename (NetworkStatsReset) VSINetworkStatsReset;
 %rename (NetworkStatsGetAsSerializedJSON) VSINetworkStatsGetAsSerializedJSON;
+%rename (NetworkStatsBeginScope) VSINetworkStatsBeginScope;
+%rename (NetworkStatsEndScope) VSINetworkStatsEndScope;
 
 %apply Pointer NONNULL {const char *pszScope};
 retStringAndCPLFree*
@@ -704,6 +706,19 @@ bool wrapper_VSISync(const char* pszSource,
 
 bool VSIAbortPendingUploads(const char *utf8_path );
 
+%rename (GZipBuildIndex) wrapper_VSIGZipBuildIndex;
+%feature( "kwargs" ) wrapper_VSIGZipBuildIndex;
+
+%inline {
+int wrapper_VSIGZipBuildIndex(const char* utf8_path,
+                              char** options = NULL,
+                              GDALProgressFunc callback=NULL,
+                              void* callback_data=NULL)
+{
+    return VSIGZipBuildIndex( utf8_path, options, callback, callback_data );
+}
+}
+
 #endif
 
 %rename (CopyFile) wrapper_VSICopyFile;
@@ -977,6 +992,8 @@ void VSICurlPartialClearCache( const char* utf8_path );
 
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
+void VSINetworkStatsBeginScope();
+retStringAndCPLFree* VSINetworkStatsEndScope( char** options = NULL );
 
 #endif /* !defined(SWIGJAVA) */
 
@@ -201,6 +201,7 @@
 %constant char *DMD_EXTENSION          = GDAL_DMD_EXTENSION;
 %constant char *DMD_CONNECTION_PREFIX  = GDAL_DMD_CONNECTION_PREFIX;
 %constant char *DMD_EXTENSIONS         = GDAL_DMD_EXTENSIONS;
+%constant char *DMD_OPEN_SIGNATURES    = GDAL_DMD_OPEN_SIGNATURES;
 %constant char *DMD_CREATIONOPTIONLIST = GDAL_DMD_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST;
@@ -297,6 +298,8 @@
 #define GDAL_DMD_CONNECTION_PREFIX  "DMD_CONNECTION_PREFIX"
 #define DMD_EXTENSIONS "DMD_EXTENSIONS"
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
+#define DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
+#define GDAL_DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
 #define DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST "DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST"
@@ -1378,6 +1378,10 @@ public:
     return OGR_L_UpsertFeature(self, feature);
   }
 
+  bool FillNextFeature(OGRFeatureShadow *feature) {
+    return OGR_L_FillNextFeature(self, feature);
+  }
+
 #if defined(SWIGCSHARP)
 %apply int PINNED[] {int *panUpdatedFieldsIdx};
 %apply int PINNED[] {int *panUpdatedGeomFieldsIdx};
@@ -129,6 +129,25 @@ Feature:
     A feature or None if no more features are available.
 ";
 
+%feature("docstring")  FillNextFeature "
+Fetch the next available feature from this layer into an existing feature.
+
+This avoids allocating a new feature at each iteration.
+
+For more details: :cpp:func:`OGR_L_FillNextFeature`
+
+Parameters
+-----------
+feature: Feature
+    The feature into which the next feature is read, typically created
+    with ``ogr.Feature(lyr.GetLayerDefn())``.
+
+Returns
+--------
+bool:
+    True if a feature has been read, False if no more features are available.
+";
+
 %feature("docstring")  SetFeature "
 Rewrite an existing feature.
 
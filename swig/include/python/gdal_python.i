@@ -4041,7 +4041,7 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
               zFactor=None, scale=None, xscale=None, yscale=None, azimuth=None, altitude=None,
               combined=False, multiDirectional=False, igor=False,
               slopeFormat=None, trigonometric=False, zeroForFlat=False,
-              addAlpha=None, colorSelection=None,
+              addAlpha=None, colorSelection=None, numThreads=None,
               callback=None, callback_data=None):
     """Create a DEMProcessingOptions() object that can be passed to gdal.DEMProcessing()
 
@@ -4089,6 +4089,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
         adds an alpha band to the output file (only for processing = 'color-relief')
     colorSelection:
         (color-relief only) Determines how color entries are selected from an input value. Can be "nearest_color_entry", "exact_color_entry" or "linear_interpolation". Defaults to "linear_interpolation"
+    numThreads:
+        number of threads to use, or "ALL_CPUS". Not used by "color-relief".
     callback:
         callback method
     callback_data:
@@ -4150,6 +4152,8 @@ def DEMProcessingOptions(options=None, colorFilename=None, format=None,
                 raise ValueError("Unsupported value for colorSelection")
         if addAlpha:
             new_options += ['-alpha']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -4193,7 +4197,7 @@ def DEMProcessing(destName, srcDS, processing, **kwargs):
 def NearblackOptions(options=None, format=None,
          creationOptions=None, white = False, colors=None,
          maxNonBlack=None, nearDist=None, setAlpha = False, setMask = False,
-         alg=None,
+         alg=None, numThreads=None,
          callback=None, callback_data=None):
     """Create a NearblackOptions() object that can be passed to gdal.Nearblack()
 
@@ -4219,6 +4223,8 @@ def NearblackOptions(options=None, format=None,
         adds a mask band to the output file.
     alg:
         "twopasses" (default), or "floodfill"
+    numThreads:
+        number of threads to use, or "ALL_CPUS". Only used by the "twopasses" algorithm, or by its initial step in "floodfill".
     callback:
         callback method
     callback_data:
@@ -4260,6 +4266,8 @@ def NearblackOptions(options=None, format=None,
             new_options += ['-setmask']
         if alg:
             new_options += ['-alg', alg]
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -4837,6 +4845,7 @@ def FootprintOptions(options=None,
                      writeAbsolutePath=False,
                      layerCreationOptions=None,
                      datasetCreationOptions=None,
+                     numThreads=None,
                      callback=None, callback_data=None):
     """Create a FootprintOptions() object that can be passed to gdal.Footprint()
 
@@ -4880,6 +4889,8 @@ def FootprintOptions(options=None,
         Enables writing the absolute path of the input dataset. By default, the filename is written in the location field exactly as the dataset name.
     layerName:
         output layer name
+    numThreads:
+        number of threads used to read the source mask, or "ALL_CPUS"
     callback:
         callback method
     callback_data:
@@ -4948,6 +4959,8 @@ def FootprintOptions(options=None,
             new_options += ['-no_location']
         if writeAbsolutePath:
             new_options += ['-write_absolute_path']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -5069,6 +5082,9 @@ def BuildVRTOptions(options=None,
                     nodataMaxMaskThreshold=None,
                     strict=False,
                     writeAbsolutePath=False,
+                    trustSourceProperties=False,
+                    numThreads=None,
+                    metadataCache=None,
                     pixelFunction=None,
                     pixelFunctionArgs=None,
                     creationOptions=None,
@@ -5122,6 +5138,12 @@ def BuildVRTOptions(options=None,
         list or dict of creation options
     writeAbsolutePath:
         Enables writing the absolute path of the input datasets. By default, input filenames are written in a relative way with respect to the VRT filename (when possible)
+    trustSourceProperties:
+        Whether to record the properties of the input datasets, so that they are only opened when their pixels are read from the VRT.
+    numThreads:
+        Number of threads used to open the input datasets, or "ALL_CPUS".
+    metadataCache:
+        Filename of a JSON file where the properties of the input datasets are cached.
     callback:
         callback method.
     callback_data:
@@ -5176,6 +5198,12 @@ def BuildVRTOptions(options=None,
             new_options += ['-strict']
         if writeAbsolutePath:
             new_options += ['-write_absolute_path']
+        if trustSourceProperties:
+            new_options += ['-trust_source_properties']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
+        if metadataCache is not None:
+            new_options += ['-metadata_cache', str(metadataCache)]
         if creationOptions is not None:
             _addCreationOptions(new_options, creationOptions)
         if pixelFunction:
@@ -5263,7 +5291,8 @@ def TileIndexOptions(options=None,
                      bandCount=None,
                      mask=None,
                      metadataOptions=None,
-                     fetchMD=None):
+                     fetchMD=None,
+                     numThreads=None):
     """Create a TileIndexOptions() object that can be passed to gdal.TileIndex()
 
     Parameters
@@ -5316,6 +5345,8 @@ def TileIndexOptions(options=None,
         Fetch a metadata item from the raster tile and write it as a field in the
         tile index.
         Tuple (raster metadata item name, target field name, target field type), or list of such tuples, with target field type in "String", "Integer", "Integer64", "Real", "Date", "DateTime";
+    numThreads:
+        Number of threads used to open the input rasters, or "ALL_CPUS".
     """
 
     # Only used for tests
@@ -5406,6 +5437,8 @@ def TileIndexOptions(options=None,
                     new_options += ['-fetch_md', mdItemName, fieldName, fieldType]
             else:
                 new_options += ['-fetch_md', fetchMD[0], fetchMD[1], fetchMD[2]]
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -460,9 +460,29 @@ void BitStuffer2::BitStuff(Byte** ppByte, const vector<unsigned int>& dataVec, i
 
   // do the stuffing
   const unsigned int* srcPtr = &dataVec[0];
-  int bitPos = 0;
   assert(numBits <= 32); // to avoid coverity warning about large shift a bit later, when doing (*srcPtr++) >> (32 - bitPos)
 
+#ifdef GDAL_COMPILATION
+  // GDAL specific: accumulate values in a 64 bit register, and flush it
+  // 32 bits at a time, which avoids the read-modify-write of each output
+  // uint and the unpredictable branch of the generic code.
+  unsigned long long acc = 0;
+  int accBits = 0;
+  for (unsigned int i = 0; i < numElements; i++)
+  {
+    acc |= (unsigned long long)srcPtr[i] << accBits;
+    accBits += numBits;
+    if (accBits >= 32)
+    {
+      *dstPtr++ = (unsigned int)acc;
+      acc >>= 32;
+      accBits -= 32;
+    }
+  }
+  if (accBits > 0)
+    *dstPtr = (unsigned int)acc;
+#else
+  int bitPos = 0;
   for (unsigned int i = 0; i < numElements; i++)
   {
     if (32 - bitPos >= numBits)
@@ -482,6 +502,7 @@ void BitStuffer2::BitStuff(Byte** ppByte, const vector<unsigned int>& dataVec, i
       bitPos += numBits - 32;
     }
   }
+#endif
 
   // copy the bytes to the outgoing byte stream
   size_t numBytesUsed = numBytes - NumTailBytesNotNeeded(numElements, numBits);
@@ -524,7 +545,14 @@ bool BitStuffer2::BitUnStuff(const Byte** ppByte, size_t& nBytesRemaining, vecto
 
   try
   {
+#ifdef GDAL_COMPILATION
+    // GDAL specific: one extra uint so that the 64 bit reads below never
+    // go past the end of the buffer
+    m_tmpBitStuffVec.resize(numUInts + 1);
+    m_tmpBitStuffVec[numUInts] = 0;
+#else
     m_tmpBitStuffVec.resize(numUInts);
+#endif
   }
   catch( const std::exception& )
   {
@@ -538,6 +566,21 @@ bool BitStuffer2::BitUnStuff(const Byte** ppByte, size_t& nBytesRemaining, vecto
   // do the un-stuffing
   unsigned int* srcPtr = &m_tmpBitStuffVec[0];
   unsigned int* dstPtr = &dataVec[0];
+
+#ifdef GDAL_COMPILATION
+  // GDAL specific: extract each value from a 64 bit window starting at the
+  // uint that contains its first bit. This has no data dependent branch,
+  // and iterations are independent, so that compilers can vectorize it.
+  const unsigned long long mask = (1ULL << numBits) - 1;
+  for (unsigned int i = 0; i < numElements; i++)
+  {
+    const unsigned long long bitPos = (unsigned long long)i * numBits;
+    const size_t iUInt = (size_t)(bitPos >> 5);
+    const unsigned long long window =
+      srcPtr[iUInt] | ((unsigned long long)srcPtr[iUInt + 1] << 32);
+    dstPtr[i] = (unsigned int)((window >> (bitPos & 31)) & mask);
+  }
+#else
   int bitPos = 0;
   int nb = 32 - numBits;
 
@@ -560,6 +603,7 @@ bool BitStuffer2::BitUnStuff(const Byte** ppByte, size_t& nBytesRemaining, vecto
       bitPos -= nb;
     }
   }
+#endif
 
   *ppByte += numBytesUsed;
   nBytesRemaining -= numBytesUsed;
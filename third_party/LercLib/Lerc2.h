@@ -1310,6 +1310,24 @@ bool Lerc2::ReadTile(const Byte** ppByte, size_t& nBytesRemainingInOut, T* data,
 
       if (bufferVec.size() == maxElementCount)    // all valid
       {
+#ifdef GDAL_COMPILATION
+        // GDAL specific: unit stride loops over contiguous rows, that
+        // compilers can vectorize
+        if (nDim == 1)
+        {
+          const int nTileCols = j1 - j0;
+          for (int i = i0; i < i1; i++, srcPtr += nTileCols)
+          {
+            T* const dstRow = data + (size_t)i * nCols + j0;
+            for (int j = 0; j < nTileCols; j++)
+            {
+              double z = offset + srcPtr[j] * invScale;
+              dstRow[j] = (T)std::min(z, zMax);    // make sure we stay in the orig range
+            }
+          }
+        }
+        else
+#endif
         for (int i = i0; i < i1; i++)
         {
           int k = i * nCols + j0;